@@ -0,0 +1,28 @@
+/***************************************************************************//**
+* \file TEST_MODEL_aot_float.h
+*
+* \brief
+* Generated with scripts/ml_aot_gen.py, this file contains the TEST_MODEL model
+* (float) compiled ahead of time: constant layers and a straight-line invoke
+* of the kernels on a static arena, without the TFLM interpreter.
+******************************************************************************/
+
+
+#ifndef TEST_MODEL_AOT_FLOAT_H
+#define TEST_MODEL_AOT_FLOAT_H
+
+#include "tensorflow/lite/c/common.h"
+
+
+#define TEST_MODEL_AOT_FLOAT_ARENA_SIZE (3200u)
+#define TEST_MODEL_AOT_FLOAT_FLASH_SIZE (52008u) /* Weights, bias and tables */
+#define TEST_MODEL_AOT_FLOAT_RAM_SIZE (3200u) /* Arena and scratch */
+
+TfLiteStatus TEST_MODEL_aot_float_init(void);
+TfLiteTensor *TEST_MODEL_aot_float_input(int index);
+void *TEST_MODEL_aot_float_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_aot_float_output(int index);
+void *TEST_MODEL_aot_float_output_ptr(int index);
+TfLiteStatus TEST_MODEL_aot_float_invoke(void);
+
+#endif // TEST_MODEL_AOT_FLOAT_H
@@ -0,0 +1,911 @@
+/***************************************************************************//**
+* \file TEST_MODEL_aot_int8x8.c
+*
+* \brief
+* Generated with scripts/ml_aot_gen.py, this file contains the TEST_MODEL model
+* (int8x8) compiled ahead of time: constant layers and a straight-line invoke
+* of the kernels on a static arena, without the TFLM interpreter.
+******************************************************************************/
+
+
+#include "TEST_MODEL_aot_int8x8.h"
+
+#include <stddef.h>
+
+#include "ml_sparse_fc.h"
+#include "ml_softmax_s8.h"
+
+
+static const int8_t TEST_MODEL_aot_int8x8_0_weights[12544] __attribute__((aligned(4))) = {
+    -46, -10, 45, 32, 22, -40, -36, -26, 40, 44, -20, -19, 33, 37, 5, 1,
+    -37, 5, -19, -12, 50, -47, 2, -39, 38, 29, -9, -1, 37, -13, 13, 37,
+    -13, -25, 28, 11, 2, -20, -40, -45, -31, -28, 32, -34, 46, -42, -16, -25,
+    14, 5, 48, -47, 40, -39, 38, 5, -47, -25, -22, 28, -44, 20, -16, 42,
+    48, -8, -20, 37, -55, 1, 29, -30, -31, -39, 47, -27, 10, -43, 1, 28,
+    6, 40, -43, -3, 22, -51, 41, -39, 22, 27, -37, 37, -54, -46, 20, -49,
+    -43, -52, 13, -54, -55, -28, -59, 22, -7, -41, -40, 8, -22, -27, -9, 46,
+    -13, 47, 6, 32, -49, 33, 24, -9, -4, 34, 18, -47, 45, 38, 10, -39,
+    -46, -18, -28, 54, 27, 27, -28, -17, -21, -30, 44, -33, 12, -7, 45, -20,
+    29, -25, -7, 43, -44, -26, 24, 31, 25, -54, -44, -11, 7, -7, -25, 27,
+    2, 35, 21, 30, -13, -23, -39, -43, -6, -42, 12, -24, 20, -5, 18, -38,
+    -6, 37, 1, -35, 22, -34, 14, -73, -67, -11, -30, -12, 16, 68, 6, -5,
+    -23, -33, -13, 16, -44, 44, -22, -48, 38, 9, 39, -12, -45, -39, -3, -7,
+    -28, -60, 7, -26, -32, -49, -31, -23, 32, 32, 29, -4, -7, -21, -48, -36,
+    -30, 47, -13, 37, 13, -46, -23, 30, -34, -18, 34, -21, -56, -45, -51, 21,
+    -34, 47, -5, -9, -24, -29, -30, -29, -52, -41, -6, -5, 41, 15, -21, -39,
+    40, -44, -29, -37, 39, -47, -65, 32, 10, -58, -31, 7, 31, 48, -15, 11,
+    -48, -38, -14, -4, 18, 16, 6, -48, 32, -35, -45, -2, -5, -20, -8, 35,
+    23, -66, -7, -36, 26, 3, 17, -31, 9, 17, -32, 22, 24, -3, 18, 39,
+    24, 46, 36, -48, -15, 21, -34, -24, 56, -49, 41, 36, -44, -1, -61, -49,
+    -14, 38, -34, -17, 49, 16, 6, 35, -51, 32, 30, 47, 17, 14, 24, -21,
+    -21, -42, 18, 23, 38, -50, 35, -8, -35, -6, 9, -27, 9, -30, -18, 45,
+    3, 30, 0, 9, -35, -46, -8, 11, -34, -26, 19, -46, -23, -16, -13, -13,
+    45, -42, 0, -14, 13, -23, 12, -10, 8, -29, 34, -2, -21, 46, 5, -5,
+    -42, -36, -36, 38, 9, 28, -47, -46, 47, 20, -42, 10, -40, -42, 15, -46,
+    -44, -62, -50, -2, 13, 26, 41, 15, -16, -5, -7, -3, -21, -53, -38, -50,
+    -4, -14, 12, -11, -48, 7, -31, -50, 45, -16, 20, 36, -8, 9, -26, 21,
+    -1, -29, 13, -12, -37, -6, -3, -15, -54, -21, 32, -33, -20, -39, -24, -50,
+    -39, 27, -30, -39, 3, -64, 8, 20, 25, 4, -27, 30, 27, -46, 42, -6,
+    11, -20, 21, -53, 4, -41, 18, -30, 6, -6, 30, -19, -41, 21, -43, -46,
+    34, 34, 21, 5, 5, 33, 41, 40, 37, 19, 22, 38, 12, 5, -46, -39,
+    10, -8, -44, -39, 27, 9, -13, 40, 49, -29, -34, -50, -54, -6, 47, -41,
+    31, -46, 2, -17, 41, -39, -33, -38, -32, -9, 38, -37, 0, 29, -52, -68,
+    -30, -50, -26, 37, -39, -13, 0, -4, -11, 38, -13, -31, 49, 5, 48, 19,
+    46, -41, -46, -7, -17, 25, -15, -34, -34, -13, -21, 32, 8, 40, -14, 14,
+    30, 8, -38, -10, 14, -22, -3, -13, -11, -19, 47, 27, -48, 1, 11, -39,
+    -66, -3, 7, 47, -27, 28, -46, -14, 43, 20, -45, -11, 36, -11, -13, -44,
+    13, -18, -18, 4, -5, -52, 41, -37, 5, -31, -51, -4, 11, 16, 19, 28,
+    -36, -58, -18, 39, -14, 15, -52, -50, 9, 36, 25, 10, -44, -11, -40, -37,
+    -6, -10, 0, 24, 6, 7, -15, 38, -53, 54, -45, 9, -10, -42, 27, 48,
+    -50, -16, -26, -29, 31, 45, -34, 7, 43, -15, 16, 25, 24, -35, 8, -43,
+    -24, 13, -9, -16, -8, -25, 4, 20, -2, 56, -37, -27, -36, 46, 8, 37,
+    40, -1, -25, -20, -60, -50, 29, -44, 15, 32, 11, 7, 32, 49, -16, 3,
+    -54, 1, 19, -42, 36, -43, 15, -22, -27, 48, -9, 1, -7, 0, -37, 15,
+    13, 27, 39, -47, -30, -30, -18, -41, -33, 29, -5, -48, -9, 42, -15, -28,
+    -43, 8, 18, 11, 14, 6, 27, -46, 17, -28, 13, 30, 5, 26, -28, 20,
+    -36, 30, -31, -27, 34, -23, -42, 18, -37, -15, 11, 28, -17, 19, -45, 32,
+    -45, 15, 27, 47, -34, 10, -13, 41, 19, 40, -5, -26, 51, 18, -13, -17,
+    48, -19, -19, -34, -40, -46, -37, 27, 22, 1, -25, 19, 29, 24, -3, -17,
+    35, -48, -41, 40, 50, -8, 31, 22, 22, -25, 27, -42, -11, -14, 21, 27,
+    -50, -17, -11, -28, 22, 12, -6, 27, -28, 42, 2, -21, 47, 40, -11, 1,
+    19, -21, 44, 33, -7, 37, -39, 43, -2, 25, 31, 7, 46, 22, -33, 42,
+    -39, 8, -11, 17, -1, 42, -48, -5, 10, -3, -45, -9, 28, 50, -36, 12,
+    57, -10, -42, 4, -52, -24, 13, -52, 18, -30, -41, 15, -16, 33, 22, -20,
+    16, -29, -48, -7, -29, 7, 13, 12, 24, 56, -29, -22, -46, 16, -19, -55,
+    -89, -8, -30, -4, 10, -13, -26, -47, 1, -2, 3, -14, -45, 12, -13, -5,
+    21, 26, 43, 17, 1, -37, -27, 11, -16, 12, 19, 3, 14, 8, -43, 52,
+    -8, 9, -16, -24, -28, 26, -26, -64, -60, -14, 30, -47, -19, 31, -51, -51,
+    -29, -43, 0, -75, -56, 0, -7, -3, -3, 27, 29, -26, 20, -6, -23, 1,
+    32, -22, 27, -14, 8, -35, 54, -21, -42, 23, -14, 0, 51, -22, -5, 24,
+    14, -8, -69, 6, -8, 45, 32, -27, 48, 53, -37, -41, 0, 7, -30, -46,
+    13, -12, -21, 26, 15, -47, -25, -7, -1, -22, -38, 28, -2, -20, -20, -8,
+    -34, -23, -1, 53, -35, -3, 47, 10, 29, -17, 0, -25, 16, -84, -28, -29,
+    -17, 3, 5, -50, -41, -25, 21, 32, -53, 7, -23, 29, 13, -8, -11, 39,
+    25, 20, 34, -7, 32, -28, 15, 20, -48, -18, -74, 37, -14, 46, 48, -51,
+    17, 14, -62, 15, -8, -41, 8, 12, 49, -31, -9, 18, 28, -27, 41, 22,
+    39, 29, -69, -29, -21, -16, -73, 26, 18, 36, 6, 9, -47, -49, 6, 21,
+    -53, -36, 0, -15, 8, -36, 4, 9, -80, 10, 7, 25, 15, 28, -13, -3,
+    9, -24, -75, 1, -49, -9, 5, 7, -47, 2, -27, -18, 14, -52, 16, 8,
+    37, -60, -16, -49, -33, 23, -23, -54, 43, -30, 40, -32, -41, 8, -7, -46,
+    -11, -5, 46, -15, 23, 22, 14, -5, -11, 15, -6, 2, -40, -58, -32, -61,
+    -5, -6, -23, 32, -46, 30, -22, 15, 67, -45, 3, 29, -34, 48, 38, 2,
+    4, 5, 20, -26, 15, -20, 21, -5, 3, -69, -15, 3, -24, -41, -22, 17,
+    40, -12, 52, 58, 86, 42, -58, -33, -13, -40, -10, -47, -29, 47, 70, 2,
+    32, 1, 14, 9, 10, -15, -49, -60, -12, -1, -3, -17, 7, -25, 15, -16,
+    -11, 13, 31, 17, 0, 41, 19, 33, -9, 23, 29, -4, 4, -35, -7, 34,
+    6, 10, -56, -84, -21, -23, -13, -10, 1, 32, -23, -2, 36, 22, -25, -22,
+    -2, -27, 8, -34, 27, 3, -13, 43, 38, 31, -13, 12, -46, -47, -11, -77,
+    -73, -15, 19, 7, 45, 40, 39, 53, 31, -10, 36, -21, -47, -17, -32, -30,
+    44, -40, 38, 20, 7, -39, 61, -5, -74, -5, -84, 18, 14, -9, -12, -10,
+    14, 21, -32, -38, -30, -18, 51, 9, -43, -51, -19, -21, -23, 30, -30, 16,
+    33, -14, 9, 11, -42, 16, -24, 18, -13, 49, -15, 29, -6, -19, -29, 9,
+    -47, 16, 22, 54, 26, -24, -4, 5, 46, 9, -17, -45, -30, 33, 54, -17,
+    -36, -29, -16, -5, 0, -25, -17, -19, -31, -45, 13, 29, -70, 39, -3, -4,
+    -11, -39, -23, -23, -62, 17, 31, 38, -6, 31, 43, 41, 40, 4, 24, -14,
+    -10, -12, -11, -40, 34, -2, 13, 3, -29, 22, -39, 18, -26, 25, -33, 5,
+    10, -9, -1, 29, 29, 6, -13, -22, 51, -10, -13, -10, -7, 29, -26, -41,
+    -2, 12, -29, -19, 10, -12, -47, -25, -24, 41, 43, -41, -44, -6, 18, 42,
+    -31, 46, -32, -27, 19, -16, 31, -34, -2, 1, 0, -21, 8, -43, -19, -14,
+    -46, 5, -6, 22, 44, 21, -26, -41, -55, -44, 31, 46, -29, -27, 38, 14,
+    15, 38, 44, 28, 2, -5, -4, -2, 7, 30, 5, 22, -54, -47, 22, -4,
+    12, 47, -20, 4, -23, 24, -62, 43, 43, -60, 12, 8, -7, -7, -11, 8,
+    -4, -3, 19, 14, -63, 16, 1, -66, -34, -40, 23, 23, 2, 2, -23, 26,
+    -37, 45, 12, -14, 14, -53, -20, -33, -29, -23, -24, -9, 7, -48, 3, -43,
+    18, -39, -44, -45, -37, -26, 21, -33, 4, 41, 38, -8, -29, -47, -9, -48,
+    -17, 22, -52, 10, -39, -53, -55, -31, 51, 13, 55, -4, -58, -55, -61, -9,
+    -18, -32, 30, -3, 3, 17, -20, -21, 2, 41, 8, -41, 1, 41, 28, 45,
+    8, -23, -37, 13, 26, 33, 17, -49, -1, 9, -29, 19, 51, -39, 38, -7,
+    16, -20, 32, -9, -16, -27, -25, 16, -17, 41, 19, 45, -49, -27, 32, -24,
+    -34, 34, 26, -3, 39, -11, -51, 27, 26, 31, 5, 24, 35, 37, -5, -7,
+    -7, 33, -54, 32, -49, -35, -14, 13, -46, -3, -16, -32, -31, 31, -30, 15,
+    -19, -48, 45, 42, -16, 19, -14, 22, 44, -36, 38, 36, 21, -12, 22, 39,
+    -61, -14, -46, -22, -18, -24, 35, -34, -27, -32, 28, -31, -49, -11, -31, -11,
+    15, -35, -46, -36, -38, 20, -8, -11, -38, 9, -41, -1, -52, -52, -73, -23,
+    -58, 2, -72, -9, 20, -36, -53, 13, -26, 52, 1, -14, 1, 1, -32, -33,
+    24, 51, -6, 1, -12, 17, -16, -47, 10, -40, 7, -12, -13, -44, 7, -51,
+    25, -28, -18, 6, -53, 10, 16, -49, 15, -19, 26, -4, -13, -34, -10, -31,
+    26, -6, 31, -39, 0, 12, -40, -2, -4, -80, 18, 28, 8, -24, 25, 21,
+    39, 26, 19, 21, 30, -49, -27, 9, 21, -6, -3, 46, -25, 15, 18, 54,
+    26, -13, 2, -28, -63, -44, -31, -23, -17, -32, 9, 0, -32, 7, 32, 33,
+    -29, -17, 24, 45, -23, -43, 15, 6, -32, 9, -25, 8, 32, -34, -21, -10,
+    -33, -46, 1, -40, -56, 34, -20, -22, 38, -6, 52, 45, -29, -24, -31, 30,
+    35, 26, -27, 25, 18, 4, 23, -19, 25, 15, -27, -44, -3, -62, -38, -51,
+    -27, 1, -32, -3, -30, 22, 13, 25, 11, 17, -45, -6, -10, 0, 8, -42,
+    -23, -30, 15, 5, 8, -33, 20, 2, 6, -4, -48, -24, -13, -28, 15, 14,
+    4, -2, -2, -46, -5, -11, -23, -13, 39, 60, 43, -75, -40, -10, 10, -27,
+    -42, -3, -27, 1, -39, -52, -5, -31, -25, 12, 26, -9, -38, -1, -16, -41,
+    -14, 56, -5, -37, 24, 13, 39, -51, 35, -32, 17, 20, 2, 36, 5, -29,
+    24, 21, -35, -12, 32, 24, -2, 32, 7, -37, -22, 12, 59, -10, 60, 33,
+    41, -16, 48, -70, -13, -19, -48, 19, 8, 21, 26, 41, -60, 25, -77, -46,
+    -20, -34, -11, -41, -38, -15, 2, -43, 35, -27, 64, 21, 22, -35, -22, 16,
+    39, -12, -4, 6, 26, 34, -1, 39, -7, -9, 12, 10, -16, 2, 46, -12,
+    38, -41, 3, -18, -70, 0, 50, -48, -11, -66, 18, 18, 10, -11, 18, 46,
+    -7, 25, 43, 56, -19, -16, -29, 12, 10, -30, 23, 5, 23, -15, -20, -44,
+    -30, 57, 24, -23, 34, -35, -10, 52, 34, -12, 0, 42, -2, 44, 28, -20,
+    3, 25, 23, -43, 43, 58, 17, 41, 60, 21, 42, -45, -42, 69, 14, -8,
+    18, 26, -5, 13, 32, 45, -38, 31, 23, -22, 49, 5, -8, -18, -22, 38,
+    -5, -14, -13, 15, 44, 17, -35, 44, 34, -9, 26, 21, -43, -50, 41, -17,
+    -29, 30, 19, -27, 16, -23, 5, -11, -20, 59, -13, 16, 43, -23, 22, 40,
+    19, -11, -44, -24, -24, 9, 37, -43, -15, -45, -24, -37, 53, 26, -31, 0,
+    16, 30, -32, -31, 11, 34, -11, -18, 23, 10, 25, -15, -7, -41, 21, 13,
+    -40, 17, -54, 9, -35, 18, 33, 19, 34, -64, -26, -16, -23, -75, 9, -27,
+    -46, -21, 39, -23, 2, -64, 32, -2, -35, -18, -35, 54, 21, -42, 20, -29,
+    48, -3, -27, -17, 9, 28, 16, -11, -96, 17, 5, -35, -2, -19, 22, -7,
+    27, 29, 0, -76, -42, 27, -13, 27, 36, -16, 55, -24, -7, 10, -19, -24,
+    -18, -2, 16, -59, -29, -50, 5, -11, 41, 35, 21, -26, 9, -10, 34, -27,
+    34, 3, -31, -17, -35, 50, 17, -11, -44, 38, 34, -61, -1, -22, 12, -22,
+    -7, -34, -39, -33, -43, 16, -59, -28, -34, 25, -60, 4, 32, 14, -19, 16,
+    -12, 30, -49, 39, -46, -2, -6, 21, 61, -4, -17, 11, 12, -39, 45, -43,
+    -25, 9, -24, 0, -21, 8, 33, -37, -1, 22, 72, 27, -20, 1, -38, 21,
+    -22, -46, 50, 29, -27, -1, 8, -26, -33, -23, 12, 8, 0, 18, -28, -4,
+    25, -28, -23, 40, -15, -16, 42, 7, -40, -26, 25, 29, -1, 42, 28, 39,
+    -22, -1, 4, 15, -14, 22, 29, 8, 4, -5, -74, -42, -19, -16, -28, 38,
+    -21, 18, 33, 47, -25, -51, 25, -6, -2, 26, -48, -39, 26, 20, -43, 27,
+    -39, -29, -65, -8, -51, -26, -20, -47, 12, -9, -47, -7, -30, -24, -42, 15,
+    28, 15, 6, 34, -32, 16, -43, -42, 43, -11, 24, 2, 5, -40, 50, -16,
+    -26, 2, -24, -62, -59, 12, -35, -18, 15, 25, 30, -14, 31, -29, 46, 13,
+    22, 32, 17, 39, -42, -50, -4, 25, 40, 50, 33, 32, 14, -25, -34, 40,
+    50, -21, -39, -15, -29, 50, 30, -41, 47, 26, -8, -32, -28, -36, 23, -37,
+    5, -20, 36, 44, 25, 26, -35, -14, -2, 26, -29, -19, -21, 21, 20, 28,
+    2, 3, 3, -14, -1, 9, 3, -29, 25, 39, -9, 51, 35, 34, 15, -42,
+    -10, 22, 23, 9, -58, 25, -34, 0, 46, 20, 33, -4, 18, 45, -7, -52,
+    50, -32, 43, 20, -12, -5, 29, -40, -32, -35, 17, -7, -41, -4, 2, -42,
+    17, -18, -15, 12, -45, -31, -43, -34, -15, -26, 27, -31, 19, -12, -51, -4,
+    6, -50, 19, -4, 0, -24, -29, -43, 20, -2, -14, 35, 19, -8, -57, -41,
+    30, -48, -61, 0, -49, -24, 0, -15, -19, 7, -11, -29, -28, -42, 2, 6,
+    -12, -45, 49, -5, -46, -11, -17, -27, 7, -34, -45, -19, 4, -50, -16, 5,
+    11, -42, -55, 39, 44, -17, 27, 9, -19, -38, 46, -50, -20, -49, -28, 8,
+    5, 17, -54, 18, -35, -56, -51, -20, 4, -23, 21, 15, 22, 38, 33, -29,
+    -29, -18, -35, -47, -37, 16, 36, 33, 34, 37, -13, 24, 38, 30, 22, 19,
+    12, -57, 30, 9, 16, 17, 26, 8, 24, -9, -16, -41, -48, 39, 17, 26,
+    -20, 23, -24, 46, -26, 9, -33, -49, 22, -19, -17, 7, 36, 10, -25, 2,
+    -16, -62, -16, -56, -15, 5, 23, 13, 31, -30, 6, -42, 8, -23, -6, 0,
+    0, 41, -26, 13, 22, -21, 0, -52, -58, -27, 11, 35, -8, -61, 1, 4,
+    -3, -7, -6, 16, 29, 46, -40, -30, -14, 28, 14, -49, 40, 35, -51, 7,
+    -48, 7, 33, 14, -47, -18, 22, -30, -42, -2, -8, -6, -50, -45, 11, 26,
+    -21, 8, 25, -2, 21, 30, -7, -37, 2, -11, 3, -30, -16, -5, 5, 28,
+    -45, -52, 8, -46, 23, -58, -63, -3, -14, -35, -10, 3, 17, 14, -15, -11,
+    12, 11, 12, -34, -45, -21, 47, 11, 34, 40, 33, -22, -29, -12, -31, -39,
+    25, -10, 32, 30, -16, -36, -20, -26, 9, -20, -21, 21, 34, 40, -44, 12,
+    27, 41, -22, -35, -20, -11, -62, -18, -7, 28, -58, -65, 25, 27, 22, -34,
+    40, -15, -18, 45, -25, 44, 36, -12, -31, 28, -2, 33, -38, -20, -10, -50,
+    -32, -22, 25, 11, -27, -54, -64, 18, 29, -15, -27, 36, -12, -53, -38, 44,
+    7, 5, 20, 17, 50, -2, -8, -25, 38, -25, -14, -41, 3, 17, -25, 8,
+    20, 23, 28, 19, 20, -6, 4, -17, 40, -18, -55, -36, -37, -19, -39, -40,
+    -47, -21, 25, 33, -29, 9, -11, -9, -33, -23, -37, -25, 30, 24, 4, -24,
+    -23, -10, -33, -30, 23, -31, 32, -42, -45, -49, 11, 45, -47, 30, 20, 30,
+    35, 4, -20, -42, -55, 4, 40, 35, -29, -18, 28, 8, -22, -32, -50, -41,
+    -20, -50, -55, 14, -8, -46, 14, 3, -46, -3, -48, -40, 34, 16, 36, 44,
+    -8, -58, -22, -6, 10, -22, 19, -45, -43, 22, 0, -8, 29, 39, -1, -8,
+    -22, -18, 3, -6, -45, -27, -24, -17, 14, -33, 35, -38, 18, 1, 19, 19,
+    28, 2, -36, -51, -19, -52, 9, -9, -58, 13, -48, -53, -35, 24, 0, -4,
+    12, 4, 8, 13, 3, -53, 20, -22, 44, 8, 25, 16, 0, -2, 10, -31,
+    -13, 17, 18, -55, 33, -29, -53, -41, -43, -51, 10, 31, 12, 22, -17, -17,
+    -11, -22, -33, -39, 42, 14, -50, 17, 32, -48, 22, -37, 7, 14, 12, 18,
+    6, 33, 26, -25, -38, -12, -13, 6, 15, -32, -47, 45, -46, -53, 8, -3,
+    31, -36, -28, 11, -56, -50, -32, -33, -31, -56, 20, -57, 21, -55, -18, 5,
+    3, 12, -34, -1, 4, 34, -1, 16, 43, -13, -14, -37, 1, 1, 13, -6,
+    -50, 38, 3, -24, -48, 0, -9, 22, -15, -4, -29, 20, -38, 35, 16, -39,
+    -32, 50, 7, -24, -41, 9, -29, 13, 7, -45, -55, -54, 41, -26, -39, 5,
+    2, 14, -16, 20, -30, 43, 46, 28, -27, -27, 41, -35, 50, 51, -31, 28,
+    -43, -15, -15, 34, -53, -12, -51, -28, 34, -13, 36, -25, -12, -19, -47, -57,
+    -14, -1, 44, 7, 51, -1, 44, -25, 45, -2, -28, -44, 8, -27, -29, -23,
+    -46, 36, -1, -38, -32, -34, 14, 49, 27, -22, -5, -26, -18, 23, -9, -5,
+    -14, 21, 40, -48, -49, -8, 2, 1, -2, -46, 6, -35, 0, -24, 9, -30,
+    23, -46, -41, -10, 10, -51, -47, 42, 27, 22, 30, -18, -49, -30, -29, -21,
+    -20, -14, -37, -50, -24, 42, -50, -2, -31, -3, 18, 32, -39, -8, 48, 40,
+    -36, -4, -18, -17, 21, 22, -12, -48, -25, -44, -27, -39, 40, -33, -43, -43,
+    17, -33, 34, -41, 19, 4, 43, -18, -47, 35, 26, 7, 28, -26, 39, -37,
+    48, -34, -7, -14, 20, 26, -9, -5, 28, 37, 32, 28, 16, 27, -46, 52,
+    -23, -44, 9, -32, -12, -6, 44, -13, -19, 38, 11, 42, 55, 41, -21, -42,
+    41, -48, 10, 7, -19, 29, 20, -33, -48, -34, -41, 30, -37, -5, 7, 37,
+    -1, 9, -4, 36, 35, 3, -6, -6, 28, -25, 28, -2, 26, -48, 25, -4,
+    5, -13, -49, -8, -51, -38, -51, 34, -10, -7, 7, -17, 30, -25, -40, 0,
+    -12, -41, 46, -26, 21, -30, -35, -43, 47, -36, -25, 32, 4, 30, 44, -19,
+    45, 35, 7, -39, 46, -21, 35, -32, 10, 27, -55, -24, -3, 34, -42, -30,
+    -42, 27, 33, 4, 27, 20, -38, 0, -26, -12, 9, -27, -33, -14, -22, -44,
+    -4, -55, -13, 44, 14, -35, -9, 24, 0, -31, 16, -21, 2, -35, -1, -30,
+    38, -59, 39, -26, 36, -35, -48, -29, -33, 33, -2, 13, -38, -10, -14, 10,
+    4, 22, -10, -36, -11, -23, -8, 10, -19, 19, 16, 9, -40, 24, -6, -13,
+    29, 6, 15, 18, -46, 3, 28, -44, -24, -54, 33, 5, -26, 27, -19, 20,
+    -48, 19, -3, -60, 9, -38, 15, -52, -43, 2, -55, 24, 33, -5, -24, -32,
+    -35, -47, 14, -26, -17, 31, -26, 30, -12, -59, 40, 8, 6, 26, -18, -3,
+    -56, 10, -2, 4, -52, -53, -40, -1, 42, -40, -23, 6, 9, -1, 44, 37,
+    15, 8, -26, 2, -60, 44, -9, -49, -2, -23, 27, 21, -50, -16, 35, -12,
+    38, 19, -19, -7, 44, 3, -25, 27, -18, -29, 4, 13, 30, 12, -1, -16,
+    -35, -19, 31, -13, 23, -57, -22, -21, -3, 8, -4, -6, -28, -15, 6, 12,
+    -41, 42, 37, -47, 41, 17, -35, -6, 44, -24, -23, 18, 30, -23, 9, -43,
+    0, 31, 23, 20, -51, 2, 45, -29, 12, -4, -15, -5, -37, 15, 0, 17,
+    45, -37, -33, -45, -35, -33, 21, -33, -55, -6, -22, 27, -46, -36, -26, 33,
+    -10, 14, -40, 47, 11, -6, -7, -29, -28, -26, -8, 23, 48, 16, -19, -4,
+    14, 14, -44, 19, -41, 17, -2, -23, -5, -3, 20, 19, -41, 13, -25, -31,
+    -12, 37, 40, 17, -34, -15, 45, -1, 31, 24, -14, 42, 32, -25, -21, -4,
+    26, 6, 21, 30, -51, -16, -1, -14, -7, 31, -47, -33, 10, 22, 26, -48,
+    -15, 9, 10, -10, -33, -38, -23, -12, -42, -5, 38, -23, 4, -15, -10, -30,
+    20, -34, -35, -36, 13, 5, -3, -36, -54, -1, 31, 5, -28, 6, -46, -6,
+    32, 37, 34, 35, 37, -47, 21, 43, -1, 6, 1, 19, -15, -43, 32, -36,
+    41, 2, -35, -56, 4, -8, 25, -47, -50, 24, 20, 11, -12, -3, -23, -25,
+    -22, -21, -40, -28, 45, -23, 50, -10, -46, -36, 42, 28, -34, -23, 23, 30,
+    41, -45, -5, 15, 7, -33, 49, 34, -38, -53, 5, 6, -32, -21, -22, 14,
+    -42, 1, 26, 38, -2, -19, 25, -41, -4, 23, -56, -6, 1, 28, -50, -6,
+    13, -48, 39, -18, -17, 14, -39, -20, -41, 16, 29, 19, 14, -14, -1, 13,
+    35, -49, -17, 21, 36, -49, -9, 14, 45, 9, 40, 4, -42, -46, 10, -43,
+    23, -6, 41, 23, 36, -3, -36, 41, -2, -7, -12, -1, -22, 0, -11, -32,
+    35, -17, 34, -27, 49, -16, -44, 7, -51, -40, 36, -3, 24, -52, -27, -15,
+    14, -16, -29, 25, -7, 36, 8, 27, -10, 25, -32, -9, -38, 1, 19, -34,
+    -49, 7, -16, -12, 11, -24, 11, 10, -17, 32, -20, 2, -25, 27, 5, -31,
+    -5, -52, 12, -20, 39, -35, -24, 14, 30, 27, 27, -44, -6, 24, -44, 36,
+    29, -48, 27, -20, -29, 31, -6, 6, -30, 30, -26, -34, 1, -30, -36, -33,
+    -2, -51, 35, 41, -47, -8, -39, 45, 34, -8, 8, -42, -36, 28, 47, 4,
+    -23, 40, -11, 39, 27, 12, -34, -24, -22, -11, 18, 2, 18, 18, -17, -6,
+    49, 12, -12, 26, 34, -36, -4, -39, 37, 32, -16, -25, 17, 38, 9, -49,
+    -2, 45, -9, 42, 23, -12, -25, -11, 34, -49, -52, -35, 12, -4, 45, -42,
+    0, -15, -12, -9, -51, -41, 23, 49, 9, -50, -10, 14, -25, 6, -42, 4,
+    -14, -34, 32, -50, 33, 51, -29, -42, -10, -8, 18, 23, -51, -7, 12, 11,
+    -13, 38, -28, 25, 30, 20, -16, 24, -49, 41, -29, -30, 51, -47, -51, -10,
+    41, 4, -31, -4, 38, 31, 24, -45, 14, 38, -18, 49, -2, 9, 1, 38,
+    19, -31, -32, 4, -39, 11, 22, -15, -52, -40, 41, 5, 40, -42, 42, -12,
+    40, 7, -8, -50, 18, 45, 33, -26, 44, 26, -13, 43, 27, 55, 54, -1,
+    23, 32, -21, 37, 46, -14, 29, 13, -41, 47, -33, -26, 9, 30, 32, -44,
+    17, -39, 18, 8, 8, 0, 42, 11, 33, 18, -31, -43, 6, 4, -8, 2,
+    62, -37, -4, -56, 8, 16, -65, 19, -2, -16, 3, -34, 25, 13, -27, 38,
+    49, 37, -32, 20, 24, -32, -20, 34, 44, 39, -12, -9, 50, 23, -45, -26,
+    -36, -46, 31, 33, -21, -63, -4, -55, 52, 50, 14, 15, -50, 41, -29, 9,
+    28, 57, -10, 29, -29, 25, 11, 9, -5, 14, 37, 2, -32, 4, -6, 19,
+    -24, 18, -23, -35, -7, -42, -46, -47, -50, 16, 15, -20, 44, 36, 16, -15,
+    39, 2, -14, 55, 25, 9, -34, 30, -35, 11, -17, 46, 25, -45, -20, -62,
+    22, 8, -10, -23, -3, -51, 12, -21, -23, 13, 23, 20, -30, -30, -6, -7,
+    10, -34, -35, -13, 15, -23, -6, -6, -29, -38, 25, -12, -44, 34, -22, -26,
+    -40, -4, 40, 29, 9, -47, -59, 12, -16, -39, -52, -4, -42, -29, -48, -33,
+    41, 29, 61, -10, -33, -34, 10, 25, -49, -19, -20, -23, -10, -48, -42, -24,
+    -37, -23, 9, -22, 36, -80, -26, -24, -57, 36, 8, 29, 35, 0, 0, -19,
+    5, 28, -35, -44, 6, 12, -45, -21, -30, -2, -31, 38, 20, -31, -4, -44,
+    0, -52, 14, 12, -8, 41, -8, -29, 39, 24, 43, 13, 10, -35, -25, 24,
+    9, 27, -44, -2, 27, -6, 21, -37, 44, -46, 34, -42, -67, -26, -56, -9,
+    -37, 10, -18, 33, 16, -9, -52, 9, -14, -48, 7, -32, -33, 27, -29, -30,
+    -38, -52, 4, -45, -11, 30, 12, -2, 35, -22, -8, 21, 55, 0, 3, 39,
+    -54, 27, 33, -10, -8, 32, -37, -59, -24, 49, 7, 33, 35, 26, 38, 27,
+    -34, -51, 12, -55, 32, 2, -2, 9, 21, 19, -10, -13, 50, 5, -32, 12,
+    21, 24, 34, -44, -20, 12, 48, -1, 27, 20, -25, 6, -43, -6, 11, -25,
+    -41, 22, 19, -9, -54, 25, 13, -2, -24, -28, 26, 17, -29, -46, 33, -29,
+    12, 4, -18, -8, 40, 9, -50, -15, -15, 18, 26, 8, -30, -59, -16, -49,
+    28, -20, 15, -1, 23, 30, -32, -38, 12, 1, -20, -36, -9, 8, 54, 45,
+    -25, -39, -44, 24, 24, -22, 45, -44, -64, -65, 1, -19, -11, 2, 17, 6,
+    -41, 42, -48, -44, -20, -32, -16, -31, -31, 14, 2, 1, 20, -32, 39, 2,
+    -26, 0, -53, -5, -56, -45, -51, -33, -13, -18, -68, -36, -5, 31, 2, 16,
+    41, 52, 29, 5, -29, -24, -33, 2, 19, 31, 47, -22, -37, -22, -45, -37,
+    -60, -8, 6, 2, -31, -25, 37, -43, 27, -30, 44, -18, 6, -34, 1, -34,
+    -42, 27, -34, -36, -44, 12, -49, 28, 21, 8, -40, 24, 17, -27, 30, -38,
+    -30, 14, -50, -12, 21, -15, -15, 34, -42, 17, 55, 5, -55, -6, 8, 29,
+    -13, 19, -10, 1, 29, -57, -33, 44, -40, -3, 22, -36, -5, -43, 7, -27,
+    21, 8, 10, 11, -2, -33, 49, -1, -53, 35, 9, -13, -47, 5, -2, -11,
+    13, -8, -23, -19, 9, -3, -4, 10, -44, 32, -6, 18, 11, -16, 16, 7,
+    -51, -39, 9, -13, 39, -46, 9, -7, 49, -50, -9, -32, 18, 13, 42, 46,
+    32, -9, 14, 40, -32, 43, 20, -42, -25, 1, -14, -32, 26, 5, 33, -30,
+    -38, -43, 20, -3, 10, 25, 46, 58, -18, -50, 6, 38, -16, -10, 21, -11,
+    10, -2, -24, 27, -26, -38, 12, -22, 9, -35, 12, -27, 10, 26, -13, 3,
+    18, -11, -30, 20, 0, 21, 9, -26, 40, 51, -2, -38, -28, 47, -24, -43,
+    -31, 23, -31, -28, 10, -2, 34, 39, 15, 13, -38, -42, 28, -6, -23, 19,
+    -37, 20, 4, -22, -14, 14, -18, -5, 32, 42, 32, 52, -49, 16, 34, -9,
+    -31, 28, -13, -26, -10, -1, -6, -47, 14, -47, -23, 49, -45, 38, -7, -28,
+    41, -25, 10, -10, 30, -23, -43, 25, 12, 24, -19, 1, 14, -46, -15, -50,
+    22, -27, 45, -16, 16, -38, 35, 22, 32, 20, 33, -29, 41, 46, 0, 11,
+    -5, 4, -35, 43, -2, -48, 33, -41, 22, -13, -14, -41, -22, 35, 9, -20,
+    -38, 23, 50, -19, 25, 10, 50, 24, 36, -44, -42, 43, -33, -9, 5, -13,
+    -15, 33, -24, 36, -50, -5, 16, -22, -32, -48, -47, -21, -31, 49, 21, -41,
+    37, -8, -25, -24, -14, -12, -33, 25, 44, -44, -2, 13, 0, 36, 51, 32,
+    -40, -18, 36, 15, 22, 45, -44, -11, -10, -9, -6, -41, -27, 14, 44, 45,
+    -3, -20, 36, -39, 0, 30, -19, -41, -14, 38, 36, 25, 8, 4, -6, -41,
+    22, 38, -3, -41, 19, 14, 0, -38, -43, -36, -24, -23, -13, 0, 19, -40,
+    -25, -26, 8, 14, 31, 23, 41, -1, 42, 44, 42, -37, -43, 49, 12, 10,
+    25, -13, -9, 43, 3, -35, 47, -1, -1, -3, -41, 14, 34, 18, -49, -1,
+    -34, -40, -37, -20, 23, 38, 1, -18, -6, -16, -15, 28, 21, -15, 22, 26,
+    38, 40, -44, 26, -46, 1, -12, -48, 46, 45, -27, -48, -24, -11, 34, -4,
+    -8, 17, 4, -18, 11, 48, 35, 4, 19, -4, 33, 41, -17, 42, -13, -24,
+    -12, 9, 21, -12, -18, -17, 19, -9, 23, -19, -22, 38, 2, -53, 10, -19,
+    32, -30, -34, -36, -35, 15, 23, 37, -20, -20, -17, 35, -20, -42, 47, -24,
+    33, -35, -53, 1, -44, -12, -11, -4, -51, -46, -48, 21, 43, -15, -16, -11,
+    -46, 16, 29, -5, 46, -5, -13, -23, 16, -45, -15, 26, -11, -7, -9, -16,
+    -27, -51, -3, -15, 41, -19, 39, -51, -42, 48, -31, 26, 30, -39, -2, 34,
+    2, 19, 26, 19, -23, -41, -12, -4, -2, -49, 14, -55, 8, 28, 36, 1,
+    5, -24, 27, -19, -27, -26, 47, 2, 41, -40, 5, 23, 45, -2, 42, -30,
+    -2, 7, 7, 33, -16, -1, 28, 11, -10, -28, 1, 0, 18, -37, -27, -20,
+    -30, 11, 34, -12, -18, -50, 17, -10, 33, 14, 23, -8, -16, 14, 32, -44,
+    21, -35, -45, -8, 34, -11, 22, -9, 20, -29, 0, 37, -45, 33, 13, -49,
+    49, -31, -39, -16, 20, 35, -9, -50, 12, 10, -33, -8, -47, -28, -23, 11,
+    -4, -51, -18, -47, 39, 10, -3, -10, 0, -30, 1, 33, 35, 6, -7, 13,
+    26, 14, 25, -21, -12, -58, -6, -38, -5, 31, -8, -14, 31, -55, 33, 5,
+    8, 44, -41, -18, 20, -49, 37, 12, 13, 29, -45, 34, 10, -35, 4, -9,
+    6, -31, 33, 18, 4, 29, -38, 33, 6, -37, -1, -48, -39, 7, -1, -28,
+    -26, 33, 21, 3, 46, 10, -34, 24, -25, 8, -42, 14, -39, -30, -7, 30,
+    28, 22, -18, -14, -22, -1, -32, -49, 38, -9, 47, 2, 32, 2, -24, -3,
+    26, 16, 14, -47, -14, 21, 26, -10, 10, -21, -14, -56, -43, -41, -14, -57,
+    -12, -12, -15, -34, -44, 9, -51, -50, -13, -25, 39, 15, 50, -44, -43, 15,
+    1, 28, 33, -32, 46, 33, 11, 3, -43, 34, 23, 21, -41, 41, 34, -16,
+    -11, 16, -18, 16, 22, -50, -12, 6, 51, 8, 29, -16, 14, -2, 27, -16,
+    42, -23, -7, -46, -24, 28, 31, -54, 26, -42, 6, 39, -32, 31, -30, 45,
+    44, -18, -15, 28, -37, 2, -1, -45, -33, -36, -27, -49, -44, 17, -20, 39,
+    -3, -21, -57, -21, 11, 3, -42, 39, -15, 6, -5, 30, -10, 38, 29, -45,
+    -44, 16, 30, 35, 51, -1, 1, -1, -18, 10, -30, -50, 23, 30, -35, 36,
+    -11, -28, -53, -18, -47, -9, 41, -7, 20, 32, -19, -6, -2, -22, 38, -9,
+    2, 42, 47, -48, -6, 13, -29, -38, -38, 38, 18, 13, 20, -33, 17, 16,
+    -16, -29, 12, 20, 23, 47, -48, -46, 25, -30, -44, 29, -48, 39, -8, -42,
+    48, -36, 18, -25, -16, -20, -35, 31, -23, -15, -20, -41, -51, -32, -45, -37,
+    34, -28, -42, -32, -50, 46, 38, 18, -1, 40, 50, 26, 43, 20, 15, 36,
+    36, 25, -21, -30, 40, -36, -4, 11, -3, -26, -16, 6, 9, 10, -30, -46,
+    2, 25, -42, -9, 51, 42, -8, -34, 32, -12, -5, 27, -10, 32, -51, -10,
+    2, -16, -2, -34, 8, 20, 1, -10, 1, -45, 3, 29, 34, -29, 45, 30,
+    21, 1, 10, 15, 1, -43, -19, -27, 41, -19, 19, -4, -31, -25, -5, -8,
+    3, 14, -6, -45, -9, 33, -41, 43, 12, 16, -5, 28, -44, 9, -12, -3,
+    44, -7, 21, -51, -3, 38, -21, -31, 6, 45, 42, -22, -31, -11, 16, 42,
+    14, -39, -26, 44, 46, 26, -30, 40, 13, -2, -43, 8, -4, -39, -5, 34,
+    -37, 7, -10, -1, -15, 19, 12, 39, -1, 6, 46, -17, 20, 5, -31, -5,
+    17, 12, 34, 43, -38, -27, 46, -18, -30, 36, 23, -17, 41, 48, 41, -17,
+    3, -17, -34, 4, -21, 51, -32, -35, -19, -37, 14, -18, 33, 9, 22, 6,
+    11, 17, -3, 28, -21, -44, -1, -37, 28, -33, -24, 17, -28, 37, -17, 14,
+    -35, 27, -22, 31, -42, 37, 50, -7, 25, 28, 12, 1, 36, -31, -21, -44,
+    11, -27, 17, -23, 7, 40, -10, 10, 20, 38, -19, 44, 19, 46, 12, 6,
+    -20, 46, -31, 49, -42, -21, -14, -32, -15, -7, -20, -14, -48, 9, 8, 15,
+    -48, 2, -13, 56, -4, -16, 33, -1, 7, 12, -27, 33, -16, 19, 29, -9,
+    31, 38, -30, 46, 27, -25, 40, -24, 21, 39, 18, 27, -54, 16, -26, 15,
+    -40, -41, 30, -2, -50, -13, 30, 22, 7, 33, -51, 22, -18, 26, 33, 29,
+    -32, -37, -30, -29, 27, -23, -39, 15, 24, -17, 34, 32, -5, 18, -18, 13,
+    -48, 32, 6, -37, 47, -10, -47, 48, -14, -32, -14, 43, 35, -42, 48, 5,
+    -50, -51, -24, -32, 17, -31, 16, -54, 12, 38, 7, 20, -41, -48, 2, -13,
+    -15, -3, -23, -28, 15, -28, 22, -9, 3, 37, 42, 4, -51, -38, -51, 30,
+    -6, 12, 7, -11, -30, -13, 9, 20, -52, 21, 33, -45, -8, -1, -15, 17,
+    14, 44, -7, -51, 41, 34, -39, 27, 41, -7, -57, 30, -24, 14, -52, -10,
+    -34, -2, 31, -54, -43, -11, 21, 39, 40, -10, 15, -47, 22, 50, -7, 5,
+    -53, -21, 12, -8, -5, -29, 24, -13, -42, -49, -33, 24, -40, -14, 26, -38,
+    -53, -6, -12, 35, -25, 8, -36, -2, 15, -24, 45, -43, 48, -34, 25, -44,
+    -30, 37, 30, 25, -15, 22, 15, -59, -18, -8, -42, 23, 2, -35, 43, -29,
+    -6, -50, 13, 9, -2, 18, -22, 1, 55, 17, 26, 33, 23, 25, -37, 8,
+    29, 37, 14, 6, 19, -54, 42, -9, 39, -26, -26, 40, 6, -4, -21, 32,
+    34, 47, -14, 65, -24, 18, 21, 18, -11, 30, 39, -2, -4, -37, -12, 35,
+    -9, 44, -47, 34, 32, -47, 44, 19, -45, -26, 31, 36, 18, 27, 47, 47,
+    4, -49, 12, -29, 32, -14, -55, -5, 28, -48, -56, -14, 48, -28, -47, 35,
+    26, -53, -40, -29, -46, 49, -13, 34, 42, -40, 38, 28, 51, 29, -10, -29,
+    40, -38, 14, 21, 19, 27, -17, -47, -21, -62, -8, -8, 45, 13, 7, 4,
+    -6, 2, -5, 44, 50, 42, -45, 7, 48, -29, 1, 13, 27, -48, 39, -32,
+    25, -25, -39, -49, -46, 18, 31, 38, 14, -34, -41, -1, -25, -48, -9, -36,
+    15, -45, -50, 34, 9, 14, -49, -15, -34, 35, 17, -49, 22, -54, -57, 18,
+    36, -42, 2, 44, 6, 41, -38, -30, -48, -44, -14, 29, -15, -4, 29, 18,
+    -34, 25, -43, -1, 27, -16, 36, 9, -16, -42, 43, 15, -54, -25, -48, 33,
+    19, -15, -43, -2, 3, -24, 12, 19, 36, 22, 12, 25, 45, 45, -45, 22,
+    13, -34, 3, 28, -49, -54, 22, 39, 1, -49, -39, -30, -28, 38, -46, -5,
+    -3, 43, -37, 36, 38, 1, -14, 46, -41, -12, -26, -26, -42, -34, -42, 40,
+    -13, 38, 10, -27, 15, 19, -37, -46, 40, -22, -31, -10, -30, -12, -40, -17,
+    -47, -21, -21, -42, 50, 42, -25, -52, -22, -22, 31, 34, -29, -31, 4, 2,
+    -30, -56, -13, -42, 11, -5, -49, -1, 13, 29, 1, 3, -1, 9, 44, -49,
+    37, -38, 44, 30, -16, 25, 21, 0, 10, -3, 39, 15, -57, -54, 15, 38,
+    17, -3, 23, 4, -35, 31, 45, -3, -21, -10, 25, -23, -46, 27, -20, -16,
+    -27, 18, 28, -36, -39, -46, -40, -30, -20, 29, -50, -37, 28, -7, -9, 5,
+    26, -15, 36, 41, -17, -36, 34, -6, -32, -25, -12, -29, -48, -17, 30, -29,
+    6, -46, -7, 3, 12, 23, -24, 33, 25, 10, 4, -1, -18, 22, -31, 28,
+    -23, -16, -35, 8, 24, -46, -16, 37, -59, -53, 16, 21, 10, -54, 10, 20,
+    -27, 22, 13, 17, -29, -37, -46, -43, -38, 33, -39, 49, 34, 13, -29, 41,
+    2, 20, -14, 31, 5, -47, 0, -43, 43, -48, 45, -36, 15, 20, -35, -44,
+    2, 32, -1, 10, 1, -2, 49, 22, -1, 37, 15, 3, -49, -26, 40, -29,
+    -42, -17, 21, -12, -33, 19, -46, -37, 4, -27, 24, -27, 36, -14, 28, 43,
+    18, 23, -24, 39, -18, -39, 8, -20, -34, 10, 36, -42, -37, 45, 5, -37,
+    -41, 10, 19, 4, -49, 25, 38, 37, 48, -49, 8, -8, 24, -13, -9, 32,
+    -18, 2, -22, -45, -19, 7, -36, -36, -27, 0, 7, 33, -10, -19, 0, 7,
+    -49, -17, 39, -44, 4, -16, 37, -13, -43, -11, -11, -21, 38, 30, 8, -38,
+    46, -50, -14, -33, -48, -18, -39, -10, -17, 23, -3, 22, -29, 35, -2, -13,
+    50, 35, 21, -25, -23, 15, 19, 1, -10, 42, 33, -4, -14, -44, -40, 47,
+    -48, 17, -29, 22, 43, -33, -22, -11, 11, 16, -46, 39, -16, -31, -51, 32,
+    -30, -30, 7, -20, -43, -1, 32, -10, 48, 15, 41, -3, 35, 13, 25, -56,
+    4, 39, -7, -2, 15, -12, -7, -55, -29, -79, -22, 28, 27, -20, -48, -11,
+    41, 1, -47, -33, -35, -32, -1, -46, 30, -54, 35, 40, 7, -25, 20, 17,
+    -45, 19, 29, -31, -13, 1, -54, 4, 40, -11, -17, 46, -20, -40, 12, 40,
+    6, 7, -39, -23, 11, -92, -1, -80, -6, -6, 4, -24, -20, -26, 45, -11,
+    -54, -26, -60, -51, 26, -49, 2, -16, -40, -1, -51, 37, -51, -6, 43, -28,
+    10, -12, -11, 8, 0, -14, -48, -22, -34, 32, -24, 3, 23, -39, -40, 19,
+    -13, 25, -23, -19, -7, 38, -33, 4, -29, -25, -34, 15, -55, -57, -45, -41,
+    17, 23, -23, -3, -24, -10, -21, -34, -11, -45, -33, -42, -18, -45, 21, 4,
+    7, -31, 20, 54, -20, 18, -6, -14, -44, 9, -66, 14, -12, -5, -17, 25,
+    -1, 1, -2, 5, -23, 12, -38, -7, 6, -36, -27, -18, -30, -37, 14, -17,
+    12, -18, -16, -15, -4, -17, -25, -46, -25, 4, 18, -47, 10, -21, -23, 22,
+    19, -1, -20, -54, -25, -16, -18, 36, 9, 31, 13, -10, 23, -25, 17, 17,
+    -40, -15, 9, -57, -9, 65, 7, 20, 45, -38, -51, -49, 12, -57, -60, -34,
+    7, 26, -68, -6, -17, 16, -41, -30, -50, 28, -50, -31, -68, 4, -8, -2,
+    27, 23, 3, 22, 31, 13, 26, -13, 7, -40, -32, -12, 1, 23, 30, -35,
+    -6, 8, 14, 12, -33, -14, 35, 59, -57, 3, 5, -35, 12, 63, 12, 15,
+    -43, 4, 15, -29, -12, -48, -22, -2, 26, 11, -46, 35, -30, -49, -30, -17,
+    -42, -25, -6, -52, 4, -68, -27, -54, -30, -11, 32, -2, -21, -14, -11, 8,
+    34, -17, 9, -61, 28, -26, 12, -10, 25, -16, -32, 34, -45, 1, -44, -35,
+    10, 5, -4, 17, 24, 49, -17, 24, 20, -48, -8, -31, -2, 41, -45, -46,
+    -16, 41, 37, 4, 38, 1, -48, 31, -39, 8, -51, -58, -66, 14, -39, -4,
+    -12, 42, 11, -7, 5, -63, -29, -87, 25, -2, 18, -4, 28, 12, -50, -40,
+    2, 16, 1, -22, -23, 28, -36, -16, 19, -27, -44, -47, 21, 21, 8, 9,
+    25, -44, -43, -71, 57, -12, -21, -22, 2, 4, -30, -39, 4, 29, 8, 19,
+    18, -60, -11, -68, -6, -16, 26, 23, 29, 10, 14, 7, -7, -78, 7, -6,
+    -30, -38, -43, -2, 37, 29, -39, 45, 14, -11, -32, -14, -6, 18, -28, 2,
+    -51, 20, -7, -18, 34, 24, -5, 11, -49, -7, -15, -6, 9, 27, -20, 25,
+    -14, -27, 48, 8, 42, 51, -36, 42, -10, -22, -5, -28, 5, 21, -35, -17,
+    -30, 8, 29, -3, -2, 5, -10, -16, -6, -45, -51, -44, -3, -14, 1, 22,
+    7, 33, 26, -46, -3, -9, -20, 20, 11, -36, 42, -22, 15, -20, 22, -32,
+    1, -28, 10, -31, -58, 28, -69, 0, -48, 66, 18, -23, 22, 13, 44, -37,
+    -49, 49, -26, -43, 19, 12, 13, 29, 3, 29, -35, -14, 21, 52, 18, -29,
+    -16, -2, 14, 14, -21, 46, -28, -21, -45, 3, 6, -22, -8, -7, -43, 18,
+    15, 6, -22, -52, 2, -16, 28, -19, 1, -23, -12, 34, -12, 23, 9, 40,
+    43, 33, 42, 27, 3, 23, 48, -27, 19, -27, -30, -64, -49, 12, 35, -30,
+    -23, -34, 5, 34, 14, 52, -32, -25, -7, 8, -1, 25, 41, 25, 28, 23,
+    -14, -30, -49, 46, 25, 39, -41, 21, -5, 8, -19, 10, -53, -29, 6, -33,
+    -17, -5, 68, 21, 0, 31, 26, -32, 17, -6, -11, -32, 0, -50, 18, 10,
+    -38, -6, 17, -41, -78, -47, 2, -67, -14, 27, -70, 0, 34, -30, -36, -47,
+    22, -18, -1, 41, -37, -44, 33, -6, -9, -33, -51, 27, -11, 16, -4, 0,
+    17, -22, 36, -20, 10, 26, -3, 16, -40, -44, -9, -27, 7, -32, 6, -46,
+    30, -41, 5, 46, 34, 6, 28, -3, 21, 45, 9, -10, 45, -59, -1, 4,
+    15, -50, -39, -47, -33, 33, -15, 27, 46, 42, -48, 5, -5, 26, -41, 23,
+    -32, -31, 14, 35, -16, 32, -44, 25, -8, -5, 6, 32, -24, 7, -32, 12,
+    -5, 44, 0, -49, -12, -51, -8, -23, -49, 9, -43, -28, -11, 26, -40, 37,
+    51, 65, 20, 64, -15, -49, 28, -16, -30, -4, -14, 8, -60, -60, -20, -31,
+    11, -13, 35, 18, -14, -19, 45, 0, -38, -51, 22, -35, -30, -11, 19, 24,
+    12, -2, 17, 48, 2, 32, 42, 52, 0, 29, -35, -11, 34, -35, -35, -48,
+    13, 23, 14, 34, 11, 21, -47, -13, 2, 46, 56, 25, -16, -25, 34, -16,
+    58, 55, -20, -7, -13, -7, 8, 36, -28, 4, 15, -28, 14, -51, -36, 21,
+    -3, -43, -16, -19, -42, -18, -52, 13, 18, 65, 0, 7, -9, -23, 29, 31,
+    69, 26, -1, -41, -17, -40, -39, -68, 22, -2, 19, 44, -49, -18, -2, 0,
+    -24, 18, -6, -8, -25, 11, 31, 23, 36, 34, 22, 1, 22, 20, 50, 6,
+    28, 22, -57, 19, -10, 19, -8, 38, -48, -13, -36, 32, -5, -33, -6, 22,
+    32, -21, 4, 32, 20, -4, 23, -38, 45, 29, -33, 22, -26, 5, -14, 5,
+    -51, 49, -20, -19, -51, -29, -3, -40, 62, 21, -30, -24, 7, 18, -9, -14,
+    -37, 29, 32, -4, -19, 17, 11, 15, 21, -3, 18, 26, -15, 39, -18, 49,
+    13, 45, 32, 26, 14, -32, 5, 25, 0, 15, 9, 8, 19, -8, 14, 43,
+    -14, -34, 40, 35, -9, -8, -50, 20, -19, -13, -15, 45, -18, 45, 6, -41,
+    12, -10, 39, 15, 17, -6, -52, 12, -48, -34, 23, -19, 51, -4, -15, -20,
+    2, 2, -21, -6, -7, 30, 13, 39, -35, 43, -7, 24, -34, -18, -61, -37,
+    -51, -54, 18, 5, -28, -12, -53, -9, 0, 12, 8, 49, 46, 10, 8, -15,
+    0, 56, -22, -9, 9, -18, -50, 22, -56, -56, -26, -53, -68, -5, -13, -69,
+    -46, -44, -4, -75, 39, -29, 8, -24, -20, -33, 20, -49, -9, -36, -12, 19,
+    -31, -3, -36, -8, -3, -65, 18, -20, -89, -43, -63, -62, -87, -12, -60, -46,
+    -42, -14, -24, -43, 38, -11, -8, -76, -17, 6, 24, 37, -41, 4, 13, 20,
+    -20, -53, -48, -76, -30, 0, -41, -60, -19, -4, -10, -15, 2, 5, 5, -36,
+    20, -31, -39, -13, 1, -36, -8, 37, -42, -25, 47, 6, -12, -5, -57, 15,
+    -25, -40, -1, 20, -21, 27, -32, -60, -6, -54, 4, 34, -1, -59, -29, 20,
+    18, -38, -51, 31, 32, -45, -40, 61, -3, 39, -18, 16, 17, -22, -14, 10,
+    13, -10, 24, 17, 7, 14, -6, 6, -52, -33, 18, -51, -34, 37, 20, -50,
+    -7, 32, -13, 33, -11, 38, -1, -26, 19, -29, 21, 5, -18, 40, 45, -14,
+    -57, -35, 24, 16, -22, 14, -59, -26, 21, 91, 38, 29, 2, -24, -5, -30,
+    57, -14, 10, 46, 31, 39, -31, 44, 30, -26, 43, -38, 39, 4, 27, -45,
+    19, 11, 38, 41, 29, 44, 88, -8, 31, 9, 34, 8, 55, -6, -9, 17,
+    27, -26, 15, 27, -16, 37, 38, 40, -26, -29, -43, 56, -2, -13, 17, 58,
+    26, 60, 57, 39, 4, -14, 36, 2, -13, -26, 26, -15, -18, 35, -20, 50,
+    -10, -31, -20, -18, 20, -10, 27, -47, 30, 46, -36, -4, 12, 18, 109, -15,
+    -23, -20, 0, -36, -30, 52, -25, 25, -14, 24, 48, -31, 35, 31, 23, -27,
+    -26, 49, -8, 20, 24, -1, 40, 46, 9, 75, 53, -42, -10, -28, 21, 7,
+    -9, 53, 46, -23, 29, 19, -13, -11, 28, 1, 8, 20, 48, 18, -37, -10,
+    -22, 76, 16, 83, 6, 31, 11, -24, 1, -37, -25, -56, 30, -44, 7, 20,
+    16, 15, 10, -21, -43, -50, -17, -46, -34, -47, 12, 4, 16, -32, 36, 26,
+    84, 7, 85, -12, -29, 4, -46, 58, -4, -19, 20, -44, -14, -30, 2, 5,
+    -21, 11, 22, -42, 33, 39, 7, 17, 17, -35, 3, 35, 65, 54, 67, 48,
+    -31, -20, 29, -4, -55, -13, -13, -4, -68, -35, 15, 20, -22, 2, -3, -18,
+    6, -15, -23, 15, 2, 31, 21, 50, 34, -10, 0, 5, 28, -38, -4, 11,
+    -72, -8, -65, -65, -64, -10, -20, -61, -11, -65, 14, -18, -31, 8, 43, 1,
+    -41, -18, 10, 46, -4, 34, -12, 3, 19, -38, -23, 23, -23, 32, -29, -45,
+    45, 13, 44, -44, -3, -37, -69, 19, -51, 18, -28, 44, 7, -9, 24, 2,
+    25, -39, 11, 42, -14, -7, 16, -3, 49, -34, -31, 32, -17, -9, -48, 22,
+    19, 23, 30, -8, -28, -34, -46, -45, -42, -6, 17, 39, 19, -46, 26, 14,
+    23, -10, -41, 37, 1, -13, 46, -17, 22, 29, -22, 27, 22, -31, 36, -22,
+    46, -27, -22, -47, -33, -19, -51, 2, -11, -12, 2, -26, -26, -43, -22, -45,
+    40, -9, -5, -62, 42, 51, 14, -14, 36, 38, 22, 11, 33, 38, 64, -33,
+    7, 19, 28, -35, 25, -28, -24, -21, 39, -45, -51, -30, -44, -26, 38, 47,
+    -2, 22, 6, 28, 30, 46, 68, 10, 5, 21, 6, 21, -23, 19, 43, 28,
+    36, 32, -13, -35, 35, -48, 43, 24, 48, -26, -38, 20, 37, -46, -54, 49,
+    12, 3, 8, 2, 10, -37, 18, 4, 47, 11, 30, -14, 62, -7, 35, -4,
+    31, -2, -22, -35, -62, -56, 54, 23, -30, -67, 10, 32, -33, 7, -47, -13,
+    -16, 9, 68, 18, 0, 12, -13, 15, 14, 1, -16, 24, 23, 12, 48, 41,
+    -34, -38, -9, -3, 1, 5, 10, -27, 15, 0, -7, 10, 0, 19, -17, 22,
+    42, -53, 40, -19, -26, -46, -53, 28, 48, -11, -38, -47, 31, 16, 2, 27,
+    -15, -46, -1, 13, -37, -46, -50, -12, -51, -60, 30, 4, -50, -59, -7, -30,
+    -82, -30, 17, 19, -50, -37, -8, -45, -50, -23, -41, 10, -22, -22, 4, -37,
+    -41, 29, -13, -11, -26, -3, -3, -58, -63, 20, -44, 3, -21, -40, 12, -5,
+    6, 17, 37, 33, 34, -22, -41, 0, 22, 14, -42, -50, 5, -20, 18, 9,
+    -14, 3, -43, 8, -12, 22, 3, -12, -9, -6, 0, -21, -19, 48, -24, 35,
+    -1, -12, -31, -47, -42, 1, -2, 41, -33, -41, -34, 14, -35, -48, -2, -25,
+    -30, -58, -18, -82, -32, -10, -73, -8, -5, 8, -5, 20, 10, 23, -14, 43,
+    -25, -2, -18, 9, -14, -49, 44, -50, -22, -39, -17, -23, 16, -28, -16, -45,
+    15, -22, -5, 27, -4, -14, -14, 8, -51, -44, -73, 7, 7, 24, 34, 36,
+    -14, 4, -49, 2, 19, -6, -18, -22, 6, 0, 1, 24, -11, 11, -2, 45,
+    49, -28, 21, 20, -1, -6, 4, 42, 2, -51, 19, -34, 5, -59, 29, -14,
+    0, -39, 6, -58, 26, 38, -12, 30, 47, -16, 11, 36, 9, -25, 10, -24,
+    5, -44, 35, -14, -36, 30, 11, -18, 21, -37, -6, 28, 37, 10, -26, 19,
+    7, -2, -33, 56, 39, 40, -40, 12, -40, -27, 28, 44, -59, 15, 22, 66,
+    6, 62, 47, -17, -14, -31, 30, 35, 4, -26, -10, 16, -25, -16, 49, 27,
+    -51, 4, -75, 9, -4, -12, -19, 11, -34, -21, -21, 48, 32, 21, -27, 10,
+    -32, -21, 29, -46, 13, 1, 16, 8, 18, 21, -9, 4, -4, -45, -46, -52,
+    -36, 5, -29, 10, -5, 2, 49, -26, 42, 37, 39, 78, 64, 33, -33, 8,
+    21, 2, -28, -16, 39, 23, 2, 32, 24, -8, 23, 32, -4, -40, -33, -40,
+    -74, 15, 4, -15, 34, -9, -15, 12, -11, 42, 29, -20, -46, -15, 35, -27,
+    49, 29, -25, 23, -45, -15, -44, -29, 10, -29, 30, 17, -41, -23, 6, 2,
+    37, 56, 9, -11, -17, -28, -1, 18, 27, -12, -35, 35, -51, -20, -18, -31,
+    21, 8, 17, -34, -40, -24, -2, 7, -12, 11, 10, -50, -11, -25, 21, 16,
+    -14, 0, 51, 18, -25, 28, -15, 27, -41, 26, -15, 5, 7, -20, -30, 12,
+    -32, -18, -45, 26, 5, -30, 28, -46, 0, -11, 37, 52, 21, -7, 47, 11,
+    50, -2, 3, 8, 30, 2, -16, 34, 31, 10, -23, 10, -42, -17, -49, 28,
+    47, -61, -46, -25, -44, 29, -4, 27, 15, 26, 8, 20, 30, 4, -48, 9,
+    14, 1, 10, -23, -73, 4, -14, 3, -47, -21, 18, 11, -12, -46, -20, -52,
+    18, -4, 35, -44, -5, 24, -26, -3, -14, -54, 13, -19, -67, -5, 9, 8,
+    -72, 6, -57, 41, 12, -37, -34, 43, -3, -21, 43, 56, -58, -29, 24, -17,
+    -46, -72, 3, 8, -31, -72, 7, -25, 7, 24, -47, -38, 38, -7, 6, -45,
+    20, 7, 18, 12, 48, -12, 44, -14, 2, 12, -44, -15, -52, -24, -20, -85,
+    -8, -21, 9, -40, -52, 45, -10, 3, -17, -3, 3, 24, 16, 29, 37, -28,
+    -20, -11, -22, -55, 9, -2, -84, -48, 12, -56, -82, 16, -38, 3, -48, 26,
+    -18, -15, 26, 26, 21, 11, -39, 6, -15, 22, 44, 47, 22, -63, -23, 36,
+    -60, 25, 11, 33, -51, -70, -32, -10, -13, -62, 23, -34, -64, 32, -57, -60,
+    21, -29, -21, -23, 7, 8, 26, -8, -10, 3, 13, 21, -37, 1, -19, 14,
+    12, -24, 10, 30, 5, -5, -33, -42, 9, -51, 29, 10, 6, 39, -20, 39,
+    19, 7, -10, 19, -20, 31, -28, -31, -8, 47, -40, 13, -41, 13, 48, 4,
+    -5, -31, -9, 14, 19, -7, -4, 5, 51, 46, -18, -36, -23, 21, 23, 44,
+    -28, -23, -50, 38, -51, -24, 35, 49, -4, -31, 38, -40, -19, -28, -20, 50,
+    -47, 50, 5, 19, 46, -19, -1, 24, 8, 34, -51, -51, 2, -25, -49, 16,
+    -51, -37, 34, -27, -15, 6, 21, 33, 21, 30, -18, 20, -8, 7, 47, -17,
+    4, -14, 43, 3, -5, -1, 50, 35, 44, -24, 10, 6, -36, 40, -8, -24,
+    -22, -40, 48, 37, 18, -3, 14, -28, 32, -36, 47, -20, 2, -9, -33, 10,
+    -40, 47, 45, 10, 25, -54, 14, 38, -36, -49, 41, -41, -18, -35, -28, 41,
+    -44, -21, 22, 27, 20, -28, -46, 10, 23, -25, 32, 27, -9, 1, 23, 19,
+    -19, 45, 30, 22, 27, -22, -25, -32, 32, 30, -15, 33, -56, 44, -40, -37,
+    -2, -49, 47, -25, -16, 37, -21, 3, -4, 5, -17, -2, -5, 50, 44, 31,
+    45, -1, -13, 29, 20, -8, 27, 11, -48, 1, -30, 43, 38, 42, 15, -32,
+    47, -2, 20, -8, -21, 49, 5, -47, 18, 34, -22, -26, 40, -15, 40, 6,
+    13, -37, -34, -54, 43, -46, 45, -33, 16, -56, -46, -34, 30, 25, -52, 31,
+    38, -49, -9, -15, 29, -14, -9, -41, 14, 29, -4, -38, -56, -37, 14, -18,
+    40, 6, 20, 13, -13, 0, -40, 26, 44, 13, 13, 24, -41, 9, 8, -39,
+    51, 34, -15, 17, -45, 10, -47, -37, -26, 37, 31, -6, -49, -22, -52, 31,
+    -30, -22, 33, 0, 34, -24, 18, 20, -42, 48, -49, -40, 42, -17, -15, 12,
+    28, -28, -35, 40, 31, -38, -30, -8, -23, 31, -1, 4, -16, -5, 16, -35,
+    8, -40, -8, 42, 6, -19, 49, -31, -14, 3, 22, 42, -27, -38, -30, 34,
+    22, -18, -49, -3, -29, -25, -10, -42, -11, 15, 33, 22, -23, 32, 4, 5,
+    45, -19, -1, -51, -32, 34, -11, 17, 5, -36, 31, -34, -23, 17, -6, -49,
+    -53, -7, 23, 1, 38, -28, -24, -21, 42, 45, -27, 15, 27, 0, -22, 32,
+    15, -26, -32, -40, -17, 16, -34, 10, 1, 44, -26, -3, 41, 45, 9, -40,
+    32, 8, -39, 30, 6, -26, -41, -48, 33, -40, -1, 41, 40, 33, -9, 2,
+    -33, 4, -53, 13, -30, -38, 23, -38, 45, -31, -14, 1, 34, 27, -55, -19,
+    35, 19, 9, 0, 22, -46, 3, -16, -18, 33, 3, -47, 8, 6, -41, 20,
+    47, -39, 33, 34, 6, 1, -43, -9, 38, 25, -45, -34, -7, -27, -2, -35,
+    2, 24, -41, 33, 11, 43, -52, -5, 35, 35, -1, -24, 23, -49, -32, -9,
+    -40, -11, -42, -40, -17, -2, 38, -49, -44, -42, 38, -20, 1, -36, -43, 40,
+    -43, 9, -56, 35, -37, -7, -19, -8, 8, -39, 20, -47, 6, -30, -51, 3,
+    35, -31, -36, -2, -42, -27, 16, 48, -24, -40, 4, 29, -23, 22, 27, -30,
+    -36, -56, -38, 24, -14, 5, 25, -43, -42, -36, -6, 39, -16, 22, -19, -25,
+    42, -36, 32, -4, 27, 8, 35, -50, 1, -22, 42, 34, -46, -35, -27, 30,
+    -58, 17, 27, -29, -43, -54, 26, -28, -4, -51, -47, 37, 21, 4, 38, 32,
+    -43, -45, 37, -36, -19, -16, -16, -36, -19, -37, 45, -25, -38, -20, 28, -3,
+    -13, -7, 23, 22, -2, 13, 29, 20, 1, 23, -14, -14, 19, 33, 9, 8,
+    -47, 40, 13, 31, -8, 20, -5, -9, -15, -26, 23, -6, 23, -49, 36, 27,
+    -15, -27, -24, -15, -46, 49, -51, 28, 18, 14, -49, -31, 32, 18, 41, 32,
+    23, 44, 24, -42, 33, -6, -44, -13, 25, -4, 45, -44, 3, -46, 2, 9,
+    -9, 26, 51, -28, -22, 46, -39, 4, 9, 29, 23, -24, 32, -55, -45, -27,
+    -40, -28, -53, 8, 21, -44, 2, -13, 34, 1, -13, -10, 6, 28, 42, -24,
+    39, 47, 4, -12, -48, 49, -15, 6, -12, 0, -34, -4, 1, -51, 14, 10,
+    33, 6, -54, 44, 1, -32, -22, -31, 30, -42, -1, -33, 29, 34, 1, 50,
+    -4, 36, 44, -25, -50, -41, 34, 29, -42, -5, -37, -28, -25, -9, 11, -35,
+    12, -39, 23, 37, -39, 16, -21, 36, 13, -10, 33, -5, 11, 23, 23, 17,
+    3, -45, -26, -24, 15, 40, 51, -1, -28, -5, -4, 47, -40, -12, -17, -11,
+    26, -15, -1, 25, 47, -15, -41, 27, 22, 7, 45, 20, -32, 43, -11, -32,
+    18, 39, -32, 8, -3, -9, -19, -11, 32, -18, -12, 45, 0, 3, 0, 10,
+    -8, 24, -35, -38, 3, -13, -39, -37, 19, -3, 18, -39, -10, 12, 45, 27,
+    -23, -47, -37, -17, 23, -37, -13, 37, -26, -21, 7, 17, 12, -35, 1, -37,
+    45, -10, 24, 48, 25, -20, 48, -5, 7, -76, -21, -43, 0, 29, -43, -1,
+    9, -29, 39, -49, 40, -2, 43, -47, 4, -14, 22, -18, 38, -3, 65, -30,
+    -36, 18, 28, -83, -50, -62, -55, -61, 29, -8, -11, 8, -28, -19, -6, -15,
+    12, 9, 49, -9, 50, -43, -1, 41, 4, -51, 34, 30, -43, -77, -59, -13,
+    -63, -50, -5, -10, -63, -40, -47, 17, -8, -52, -49, 24, -16, -16, 35, -4,
+    -27, 33, -22, 44, 58, -37, 22, 19, -5, 10, -67, 64, -74, 7, -24, -28,
+    9, -15, -34, -11, -67, -10, 13, -20, 43, 33, 14, -6, -36, -41, 45, -47,
+    1, -27, -57, 23, -37, 9, -42, -23, -41, -25, -27, -25, -42, -39, 0, -44,
+    17, 4, 4, 24, 36, 32, 23, -40, 4, -23, -25, 8, -24, 19, 4, 41,
+    4, -9, -38, -27, 36, -11, -15, 66, -12, -13, 22, -3, 2, -39, -16, 6,
+    6, -3, 31, 8, -2, 34, -43, 31, -23, -35, 9, 29, -39, -10, -23, 11,
+    -16, 36, -6, -31, 34, 31, 37, -20, 6, -15, -14, -11, -50, -15, -15, -43,
+    -45, 42, 8, -38, -4, -40, -22, 10, -15, -26, 40, 10, -28, 7, 21, -4,
+    -1, -23, 21, -15, 5, -26, -6, -29, -24, -30, -12, -20, -35, -22, 16, -51,
+    23, 20, -31, -36, -43, -36, -39, 43, 25, 25, -33, 7, -18, -12, -36, -51,
+    -54, 16, -28, -20, 7, -34, -41, -38, 48, -11, 36, -39, 25, 6, 16, 25,
+    -5, 36, 5, -13, -18, -3, 11, -28, 47, 39, 0, 34, -22, -27, 38, -41,
+    -31, 32, 37, 19, -3, 9, -54, 41, 31, 31, -1, -1, 3, 2, 54, 3,
+    40, -6, -39, -26, -7, -8, 45, 49, 10, -3, -48, 43, 15, -13, -29, -26,
+    -38, -12, -37, 25, 72, -4, -12, 72, 37, -19, 39, -3, -18, 24, -10, 25,
+    11, 73, 1, -18, 42, 22, -21, 18, -16, -15, 9, 29, -6, -15, -26, -78,
+    8, 39, 32, -12, 16, 45, -9, -20, -24, -3, -12, 42, 5, -2, 45, -4,
+    22, -54, -40, -59, -39, 0, 7, -35, 15, -64, 28, -24, -20, 21, -29, 8,
+    -22, -8, -18, 32, 17, 0, 13, 34, 13, 13, -3, 55, 23, -3, -16, -64,
+    -71, -19, -68, -5, 43, 8, -13, -17, 18, -26, 29, 48, 37, 17, 48, -8,
+    -28, -38, -29, 37, 16, 51, 53, -35, -5, 22, 6, -16, -13, 9, -54, 10,
+    -14, 49, -64, -61, -51, 11, 10, 30, 0, 8, -45, -21, 63, -22, -27, 48,
+    -4, 38, 50, -33, -34, -41, -3, -48, -8, 2, 2, -4, 18, -8, 41, -65,
+    -32, -52, -15, 40, 7, 1, 54, -3, -2, -28, 18, 37, 19, -34, -23, 33,
+    29, 23, -12, -62, -82, 69, -19, 36, 27, -36, -22, -2, -28, -14, -57, 15,
+    38, 14, -34, -21, -37, 21, -4, -2, 40, -16, -59, -28, -27, 13, -54, -15,
+    -27, -41, 36, -22, 16, -47, -29, -73, 38, 26, -21, -64, -24, -41, -25, 6,
+    -1, -8, -8, -26, -12, 15, -36, 14, -14, -10, -33, -28, -49, 9, -27, -50,
+    44, -24, -27, 9, 37, -24, 18, -63, -22, 5, -54, -47, -26, -20, -34, -24,
+    5, -29, -11, -74, 16, -7, -19, 22, -45, -16, 4, -28, 3, -8, 51, -50,
+    6, -67, -18, -44, 26, 0, 4, -44, -2, 12, 23, -14, 17, -36, -15, 5,
+    20, 11, 26, 37, -35, 41, 36, 16, 26, -49, -41, -59, 3, 10, -1, -57,
+    -36, 23, -32, -1, -1, -14, -27, -40, -21, -47, 4, -53, -17, -26, -45, 0,
+    37, -43, 59, 20, 46, 27, -21, 9, -11, -45, 16, -31, -4, -20, 20, -1,
+    -62, -28, -3, 11, -65, -14, -2, 30, -25, 75, -45, 40, 41, -7, 14, -33,
+    29, -2, -1, 27, -28, 34, 1, -39, 12, -48, -62, 20, -44, -47, 2, -16,
+    -11, 12, 13, 23, 92, 127, -23, 92, -8, 9, -21, 15, -34, -50, 39, 15,
+    -28, -18, 5, 24, 31, 23, -3, -15, 26, 39, -29, 29, 25, -7, 43, 22,
+    17, 47, 104, 71, 78, 10, 42, 31, 47, 2, -43, 1, -1, 36, -35, -24,
+    3, 45, 18, 46, 20, 28, 25, -70, 30, 40, 28, 89, -3, 10, 70, 84,
+    95, 15, 7, 4, 38, -37, 4, -47, -21, 4, -18, 32, 2, -47, -49, -13,
+    -3, -80, 41, -23, 12, 38, 60, -55, 0, -26, 74, -48, -11, -42, -41, -8,
+    -37, -9, 10, -21, 32, -49, 46, -46, -19, -17, -44, -45, -12, 17, 31, -10,
+    27, 30, -8, 11, -37, -51, 42, -19, 0, 0, 26, -10, 15, -26, -7, 9,
+    42, -50, 31, 13, -29, 29, -38, 10, 38, 8, -18, -25, -32, 46, -3, 13,
+    -22, 49, -21, 44, 19, -45, -22, -28, 8, -43, 38, -44, 7, 29, -5, 29,
+    -17, 7, -11, 10, -19, -9, -35, 29, 35, -46, -41, 44, -23, -21, 1, 33,
+    -28, 11, -33, 43, 51, -1, 34, -29, 26, -54, -11, -51, -50, 9, 19, 43,
+    -17, 36, 42, 36, 28, -43, -14, -66, 5, 39, 39, 12, 6, 45, 16, 39,
+    -37, 32, 9, 6, 18, 22, -20, 42, -22, -27, 25, -30, -16, 52, -20, 15,
+    -47, -33, 39, 3, 50, 18, -19, 18, 33, -4, 15, -15, 41, 11, 45, 9,
+    4, -10, 5, -2, 4, -40, 37, -36, 28, -20, -21, -25, -35, 16, 15, -37,
+    0, -28, 7, 2, -15, 34, 12, 12, 37, 2, -37, 41, 43, 41, 23, 34,
+    22, 24, 19, -27, 26, -28, 38, -18, 41, 34, -46, 11, -4, 22, 32, -6,
+    -20, 58, 26, 14, 19, 20, 9, 15, 30, -21, -41, 27, -30, 11, 21, -21,
+    3, 35, -21, -6, 6, -23, -2, 36, -4, 36, -2, 49, -1, 35, -18, 6,
+    24, 26, 28, -27, -3, 5, 8, 39, -27, 21, 17, 15, 13, -32, 1, 30,
+    -36, -8, 14, -38, 37, 31, -24, 54, 31, 53, 79, 35, 11, 32, -11, 28,
+    35, 30, -32, -48, -25, -16, -3, -13, 24, -8, -15, -17, 16, 40, 21, -26,
+    4, -22, 16, 5, -16, 32, 35, -30, -36, -27, -17, 43, 6, 55, -13, -41,
+    31, -45, -19, -22, -15, 42, 42, 6, -31, -38, -3, -8, 10, -17, 2, -5,
+    -40, -33, 80, 42, -14, -38, -41, 32, -24, 51, -17, -51, -44, 1, 24, 20,
+    23, 15, 7, -44, -22, 14, -37, -1, -3, -50, -92, -60, -60, -14, -47, 45,
+    -22, 51, -33, 25, -6, 6, 12, 14, 24, 9, -28, 30, -6, 1, -9, 41,
+    2, -49, -3, -45, -60, -22, 1, 17, -9, 30, -32, 5, 30, -30, 1, 8,
+    12, -34, 12, 32, -11, -16, 45, 20, 6, 32, 17, -48, 16, 10, -13, 24,
+    -34, 15, -51, -64, -57, -10, 27, 48, 17, -31, -25, -48, 30, 32, -46, 23,
+    27, 9, 30, -6, 26, 3, 10, -2, 1, -26, -32, 36, 22, 25, 11, 35,
+    52, -23, -45, 28, 43, 7, -11, -9, -46, -48, -51, -57, -46, 9, -55, 22,
+    -11, 4, 1, -46, -43, 15, -3, -25, -11, -30, -18, -23, 44, -28, 14, -7,
+    47, 40, -22, 47, -10, -21, -5, -61, -21, 14, -46, -26, -30, -3, 46, 15,
+    -15, -3, 45, -5, -16, -18, 12, -35, -30, 13, 29, -41, 42, -27, 40, 65,
+    33, 14, -20, 6, -24, -72, -101, -58, -50, -48, -27, -2, -7, -18, -19, 37,
+    -27, -30, -1, -5, 48, 36, -5, 42, 13, -15, 16, 55, -11, -15, -37, -1,
+    -42, -68, -63, -44, -39, -61, -44, -37, 28, 15, -13, -23, 51, -22, 24, -5,
+    14, -8, -32, 37, -9, 44, -28, 11, 22, 6, 41, 36, 9, 13, 31, -15,
+    4, 23, -59, -40, -19, 47, 0, 18, 8, 9, 34, 23, 4, -57, -7, -30,
+    21, -20, 47, 56, 33, -14, 64, 20, -12, 3, -24, 10, 3, 41, 8, -3,
+    -21, 28, -37, -23, 7, 16, 36, -19, 37, -66, 10, -21, 11, -24, 25, 85,
+    47, -39, -31, 27, 54, 27, 41, 37, 19, -18, 16, 37, -37, -26, 20, -23,
+    25, 1, 23, 20, 16, -21, -8, 25, -16, 39, -39, -22, -34, -5, 38, 30,
+    -22, 4, 6, -28, -3, 28, -6, -31, 47, 13, 19, -48, -18, 16, 24, 9,
+    -23, -32, -6, 9, -45, -30, 16, 35, -23, 43, 8, -25, 39, 63, -17, 31,
+    19, 7, 40, -27, 15, -54, 26, 10, 20, -45, -22, -53, -40, -9, 0, -16,
+    -29, -9, -33, 14, 37, 4, 5, 7, -24, -14, 34, 18, -33, 7, 31, 5,
+    10, 6, 0, 37, -44, 43, -37, -54, 31, 39, -17, -21, 6, -30, -44, 11,
+    32, 35, 44, 48, -17, -4, 42, -31, 35, -44, -31, -27, -42, -20, 35, 24,
+    26, -5, 12, 11, 7, 33, 38, 18, 5, 22, 45, -27, 25, -27, 45, -34,
+    -17, -41, 26, -7, 40, -12, -3, 55, -18, 21, 23, 38, -11, -53, -41, 10,
+    -43, -35, -1, 22, 0, -46, -31, 32, -48, 25, 1, -26, -51, 24, 23, 33,
+    -1, 35, -29, 27, 0, -44, -18, -25, -8, -11, -22, 3, -11, -16, -42, -35,
+    -27, -23, 12, -1, -35, -19, -21, 46, -13, 5, -16, 49, 11, -38, 36, -6,
+    -24, 42, 16, 46, 24, -48, 43, -6, 29, 21, 45, -9, -20, -1, 37, -36,
+    -8, 18, -47, -2, 13, -42, -23, 9, 5, 45, 34, -20, 23, 28, -13, -27,
+    44, -4, -5, -32, 31, 36, -46, 24, 19, -28, -6, -47, -34, 49, 35, 26,
+    34, -47, -41, -27, -16, -38, 6, 35, -18, 28, 23, 3, -24, -6, 24, -51,
+    31, -25, -22, 44, 17, 45, 40, 36, 32, -45, 17, -49, -11, 14, -5, -30,
+    -38, 16, -19, -27, -19, -17, -28, -33, -17, 20, -30, 33, 46, 5, -42, 9,
+    5, 50, 20, 31, 33, -11, -24, 18, 45, -15, -30, 0, -20, 8, 14, 1,
+    -45, 1, 17, -17, -47, 42, 24, -26, -10, 4, 36, -18, -20, -15, -37, 36,
+    -11, 6, -29, 50, -24, 26, 10, -52, 0, -21, -7, -41, -36, -37, 14, -15,
+    23, -36, 39, -4, -52, 20, -35, -21, -49, -9, 50, 17, 43, -15, 24, 18,
+    -27, -5, 25, 28, 17, -1, -27, -37, 12, 3, -7, -2, -37, 5, 4, -20,
+    -1, 29, -4, -11, 0, 79, -3, 70, 31, 20, 25, 60, 13, 1, 26, -3,
+    20, 2, -22, -45, 58, 13, -37, -23, 13, 15, -11, 45, 49, 10, 52, 42,
+    -9, 18, 60, 33, 63, 14, -10, 27, -11, 4, 33, 36, 11, 48, 31, -11,
+    4, 14, 43, 9, 21, 15, 16, -3, 59, 1, 2, 76, 14, 7, -10, 62,
+    30, 53, 8, 3, 3, 0, 42, 33, -39, 33, 41, 19, 12, 29, 7, 29,
+    -28, -3, 20, 6, -27, -8, 18, -16, 2, 47, -32, 37, 4, 16, 22, 24,
+    -40, -24, 21, 27, -23, 15, -11, 27, 74, 39, -16, -6, 4, 0, 23, 5,
+    23, 9, -25, 29, -8, 34, 12, -19, 52, -18, 34, -3, -12, 0, 26, 15,
+    13, 3, -26, 12, -9, -2, 44, 21, 25, 5, -61, 7, -31, 32, 10, 5,
+    -41, 20, 51, 2, -3, -6, -54, 23, -40, 0, 1, -4, -34, -35, -17, -38,
+    -11, 5, 10, -61, 5, -5, -70, 28, 45, -51, 4, -51, -18, 13, 70, -12,
+    -32, 47, -6, -4, 44, -11, 7, -10, -35, -11, -91, 14, -31, -21, -47, 13,
+    32, 14, -39, -7, 10, -47, -56, 38, 38, 33, -21, -5, 29, 43, -2, -2,
+    -13, -30, -26, -28, -69, -8, -34, -35, 18, -10, -15, 30, -28, 32, 13, -38,
+    -18, 24, 38, -46, -36, -25, 49, -53, -17, 29, 0, -51, 11, 5, -17, -19,
+    -61, -4, -12, 6, 40, 7, 24, -12, 26, -27, 16, -9, -16, 59, -13, 18,
+    47, 43, 17, 18, 36, -45, -15, -25, -61, 5, -18, -77, -4, -38, -24, 22,
+    40, 4, 19, -22, 8, -30, 20, -29, -8, 18, 37, -33, 11, 33, 6, -12,
+    27, 1, 31, 28, 18, -10, 26, -53, -21, -34, 33, 27, -54, -31, 34, 33,
+    -2, 11, -12, 28, -9, 34, -12, 50, -44, -2, 35, 2, 24, -45, 26, 11,
+    -5, -28, -24, -30, 32, -14, 6, 20, -11, -2, -29, -19, -42, -54, -75, -46,
+    2, -35, -48, 10, 30, -52, 2, 21, 25, -56, 13, -7, 27, -22, -47, -35,
+    -1, -22, 2, -4, -33, 8, -12, 33, -8, -6, -26, -21, -58, -21, -5, -10,
+    -13, 0, 6, 1, -53, -2, -21, 26, 29, -5, -27, 12, 6, -28, 63, 11,
+    16, -26, -12, -34, -42, -58, 9, 32, -50, -9, 20, 20, -21, -27, 11, 26,
+    26, -40, -66, -42, -44, -32, -24, 6, -6, -22, 25, -14, -19, -55, -53, -20,
+    -28, 37, -2, 3, 24, -19, -30, 1, -28, 50, 34, 40, 14, -1, -65, 27,
+    22, 23, 36, -29, -55, -38, 22, 27, -55, -25, -5, -49, 12, 7, -51, 34,
+    -35, 9, 15, -4, 0, -44, 6, -36, -41, -6, -8, 23, 40, -34, -3, 10,
+    -39, 35, 23, 1, -33, 1, -20, -14, -23, 20, -43, 25, 33, -38, -27, 33,
+    12, -12, -35, 15, -49, 47, -18, -5, 6, -4, 15, -4, 1, -31, -11, 17,
+    11, 22, -6, -51, -11, -61, 23, -62, -12, 48, -23, 33, -7, -47, 34, 27,
+    6, 17, 27, 18, -12, 12, -14, -7, 37, -4, 25, 35, 16, 35, -2, 43,
+    56, -2, 16, -41, 34, 33, 0, 17, 8, -29, 9, -24, -14, 22, -8, -27,
+    -44, -18, -2, 1, -62, 32, -41, -54, 35, 22, 63, -1, 19, -37, -46, 44,
+    -22, 8, 7, 27, 27, 17, 25, -24, -47, 10, 33, 56, 17, -9, 14, 58,
+    26, 62, -27, 39, 55, 68, -21, 14, 0, -39, 45, 17, -22, 1, 21, -40,
+    25, -20, -4, -29, -4, -29, 25, 31, 22, 11, -33, 6, 47, -41, 25, -43,
+    49, 36, -43, 19, -25, -43, 25, -6, 21, -14, -17, -29, 49, 35, -22, 28,
+    -3, 39, 29, 24, -13, 30, 2, -2, -5, 10, 38, -50, -21, -36, 13, -6,
+    -48, -16, 27, -30, 40, -5, -14, -8, 1, 19, 21, 22, -37, -39, -33, 6,
+    -43, -48, -8, -3, -66, 20, -14, -14, -6, 53, 3, -17, -28, -4, -1, 3,
+    -14, 5, -38, -24, 23, 39, -7, -43, 19, -38, 16, -22, -20, -56, -45, -2,
+    -42, -68, 24, -4, 7, -18, 43, -27, 38, -23, 36, -17, 42, 24, 12, -12,
+    -19, -3, -22, -18, -19, 35, -14, 13, -32, -20, -25, -45, 19, 32, -43, -30,
+    28, 13, 3, 0, 37, -23, 23, -93, -3, -39, 13, -33, 2, 20, 21, 29,
+    23, -1, -19, -30, -7, -22, -37, 37, -16, -5, 11, 26, -30, 28, 23, -41,
+    -29, 8, 14, 12, -7, 13, 37, 21, 36, 38, 5, -2, 33, 55, 31, -20,
+    72, -31, 30, -12, 12, -13, -19, 8, -33, -37, -10, 15, -40, 14, -13, -37,
+    35, -5, 17, 66, -9, 3, 50, -41, 2, -33, 41, -34, -11, -32, -17, -27,
+    11, 19, -45, -28, -2, -2, 16, 0, -5, 26, 0, 14, -15, 6, 15, 18,
+    16, 38, 48, -1, 18, -13, 30, -24, 20, -25, 45, -12, 21, 8, -26, -33,
+    -16, -18, 2, 0, 32, 18, -7, -13, -81, 34, 20, 56, -3, -17, 31, 49,
+    15, 0, -17, -9, -6, 48, -24, -9, -27, -2, 1, -4, -59, 0, -35, 32,
+    13, 17, 32, -53, -58, 50, -70, 39, 41, -49, 5, -4, 37, -59, -6, 14,
+    13, -24, 61, 56, 37, -49, 6, -50, 21, 19, -23, 12, -40, 33, 39, -38,
+    -30, -26, -9, -25, 31, -46, -24, -13, 14, 20, -46, -41, -3, 55, 10, -41,
+    41, -45, -12, 56, -1, 8, 4, 8, 70, -15, 9, -35, -35, -33, -61, 10,
+    -43, 29, 28, 4, -3, 10, 21, 16, -19, 29, 19, -3, -29, 35, -6, 14,
+    5, 30, -18, 37, -12, -16, 46, -8, 20, -67, -8, -11, -2, 46, -14, -9,
+    10, -19, 23, 46, 7, -39, 16, -15, 55, -3, 19, -9, 39, -21, 1, -21,
+    -7, -24, -49, 9, 14, -20, -26, 46, -19, -7, -25, 37, -26, 29, -18, 11,
+    -26, 11, -55, -13, -9, 55, 37, -6, 58, -48, -18, 0, -19, 0, -40, -24,
+    37, -21, -27, -47, -24, 23, -42, -13, -5, 14, 37, -76, -57, -35, -11, 8,
+    -17, -20, 10, -16, 30, 4, -30, -3, -5, 28, 31, 25, 24, 49, 36, -12,
+    -28, 43, -16, 34, -29, -40, -64, -10, 17, -39, 0, 37, 26, 33, 29, -14,
+    7, -36, -29, -40, 23, -55, -48, 33, -17, 44, 21, -39, -38, -12, -36, -54,
+    -12, -71, -54, 36, 2, 52, 23, 3, 10, -4, -6, -52, 27, 0, 18, 21,
+    -55, -56, -5, 17, -6, 32, -21, 30, -3, 14, 47, -20, -18, -93, -33, -38,
+    32, -6, -21, 41, 7, -4, 5, -9, -30, -21, -53, 25, -7, 38, -14, -61,
+    -51, -4, -31, 50, 18, -11, -7, -13, -23, -45, -58, -8, 32, 53, 14, 28,
+    27, -1, -48, -4, 22, -19, 7, -43, 37, -35, -5, -7, -26, 1, -16, 37,
+    34, 25, -20, -21, -46, 0, -6, -1, 12, -22, -11, -15, -3, -13, -51, -13,
+    -20, -15, 22, 24, -17, -46, 15, -43, 38, -7, 21, -26, -51, 46, 13, -56,
+    -49, 32, 15, 16, 15, 3, -37, 10, -19, -10, 2, -18, -21, -17, 36, -5,
+    -9, -61, 7, -17, 21, 11, -11, 10, -23, 19, 24, 28, 15, -24, -44, -9,
+    -30, -6, 17, -26, 36, 6, -12, 11, -50, -22, -50, 19, -22, -56, 32, 29,
+    10, -41, -43, 47, -16, 40, -33, 1, -56, -24, -46, -57, -26, 18, -11, 10,
+    0, 15, 4, 22, 33, -44, 51, 4, 43, -5, 39, -67, -21, 41, -16, 22,
+    34, 40, -29, -62, -1, -41, -24, -37, -3, 24, -46, 1, 23, -1, 12, -39,
+    -5, 20, 37, -5, 16, -3, 13, 6, 38, 16, 30, -20, 49, -31, -42, -45,
+    17, 12, -9, 17, -82, -72, -77, -42, -49, -8, -8, 1, 5, -17, -2, -52,
+    -40, -17, 32, -27, -2, 6, -12, -11, -39, 12, 34, -30, -14, -47, 10, -47,
+    -5, 20, -13, 3, -79, -81, -11, -7, 12, -58, -30, -45, -63, 12, -5, 2,
+    41, 5, 32, -33, -46, 42, -3, 22, -49, 15, 9, -1, 38, 25, -39, 14,
+    -12, -52, -61, 19, 32, -11, -17, -5, 7, 7, 25, -48, -10, 15, 14, 16,
+};
+
+static const int32_t TEST_MODEL_aot_int8x8_0_bias[16] __attribute__((aligned(4))) = {
+    -17, -15, -15, -20, -9, -22, -11, -13, -20, -2, -21, -8, -10, -13, -5, -78,
+};
+
+static const int8_t TEST_MODEL_aot_int8x8_1_weights[256] __attribute__((aligned(4))) = {
+    62, 26, -22, 28, 32, 73, 27, -95, -26, -66, -98, -57, -20, 61, 12, 47,
+    -70, -127, 28, 50, 84, -94, -73, -72, -82, -107, 75, 97, -63, -32, -20, 26,
+    -34, 23, 66, -103, 69, -4, 34, 14, -7, 89, -75, 84, -54, -11, 72, -48,
+    56, -103, 66, 72, -101, 69, 68, 54, 49, -58, -43, 48, -52, 13, -7, -11,
+    -25, 32, -69, -97, -37, -38, 82, -97, -68, -84, -41, -84, 20, 60, 97, -64,
+    111, -45, 85, -64, 69, -80, -52, -3, 24, -46, 88, 59, 30, 12, -41, -50,
+    81, -37, 67, -22, 42, 25, 93, 98, 94, -60, 12, 0, -33, -95, -59, 11,
+    77, 66, -95, -69, -51, 14, 50, -19, -85, 23, -1, 108, 78, -95, -68, 100,
+    27, 17, -73, 44, 53, -4, -34, -99, 42, 9, 13, -109, 30, 54, -32, 60,
+    73, 1, -77, -60, 0, 62, -18, -39, -44, -83, -58, 52, -15, -60, 108, -46,
+    -46, -14, 80, -58, -90, -11, -4, -88, 62, -17, 47, 1, 2, -94, 31, 44,
+    -53, -69, 76, -104, -45, -111, 49, 91, -35, -16, 3, -49, 53, 81, -13, -13,
+    32, 10, -90, 61, 57, -99, -110, 52, 29, 37, -46, -11, -92, 87, 102, -20,
+    -60, 93, -18, -52, 91, 84, 55, -30, -53, -31, 80, 53, 1, -99, -28, 0,
+    -105, -57, -49, -65, 51, 94, 94, 94, 13, 64, -35, -5, -27, -9, 50, 10,
+    17, 68, -19, -21, 37, 88, 86, 70, -101, -85, 0, 69, 45, -35, 22, -76,
+};
+
+static const int32_t TEST_MODEL_aot_int8x8_1_bias[16] __attribute__((aligned(4))) = {
+    -25, 91, 55, -4, -1, -22, -8, 2, -5, 96, -21, 0, -6, 0, -31, -17,
+};
+
+static const int8_t TEST_MODEL_aot_int8x8_2_weights[160] __attribute__((aligned(4))) = {
+    -35, 51, -63, -79, -65, 78, 28, -91, -86, -69, -59, 18, -27, -90, -37, -20,
+    -16, -89, -42, -42, -49, 61, -8, 9, -14, 45, 28, -77, 48, 52, 37, -60,
+    -51, -19, 4, -44, 25, -20, 15, 25, -21, 23, -73, -17, 20, 36, 52, -49,
+    5, -63, 92, 75, 26, -40, -52, -30, -69, -2, 94, -7, -16, 82, 44, 6,
+    27, -45, 54, -81, -5, -17, -63, 60, -30, -78, 24, 7, -83, -12, 59, -35,
+    -85, -34, -4, 31, 19, -26, -18, 51, -39, 2, 108, -12, 51, -57, -54, -74,
+    -70, 25, -7, -53, 2, 16, -56, -35, -11, -2, -52, -21, 32, 92, 47, -12,
+    66, -50, 83, -46, -62, -60, -38, -36, 38, -79, -127, 58, -76, 52, 74, 17,
+    -23, 3, 80, -56, -84, -39, -95, -15, 69, 55, 64, -39, 31, -2, -85, 61,
+    -67, -100, -96, 85, 23, -59, 18, 23, 14, 71, -79, -26, -7, -69, -91, -6,
+};
+
+static const int32_t TEST_MODEL_aot_int8x8_2_bias[10] __attribute__((aligned(4))) = {
+    -159, -220, -55, 88, -105, 133, -64, -170, 265, -74,
+};
+
+static const ml_fc_s8_layer_t TEST_MODEL_aot_int8x8_layers[3] = {
+    {16, 784, 8, 3136, NULL, NULL, TEST_MODEL_aot_int8x8_0_weights, TEST_MODEL_aot_int8x8_0_bias, 128, -128, 2118029030, -10, NULL, NULL, -128, 127},
+    {16, 16, 8, 64, NULL, NULL, TEST_MODEL_aot_int8x8_1_weights, TEST_MODEL_aot_int8x8_1_bias, 128, -128, 1568967610, -6, NULL, NULL, -128, 127},
+    {10, 16, 8, 40, NULL, NULL, TEST_MODEL_aot_int8x8_2_weights, TEST_MODEL_aot_int8x8_2_bias, 128, 48, 1192445541, -7, NULL, NULL, -128, 127},
+};
+
+static const ml_softmax_s8_t TEST_MODEL_aot_int8x8_softmax = {1569258240, 26, -31, 1, 10};
+
+/* Activations, at the offsets planned for the tflm_less model */
+static uint8_t TEST_MODEL_aot_int8x8_arena[800] __attribute__((aligned(16)));
+/* Input of the fully connected kernel widened to 16 bits */
+static uint32_t TEST_MODEL_aot_int8x8_scratch[392];
+
+/* Type, quantization and bytes of the input and the output, read by
+ * source/ml_benchmark.c */
+static const TfLiteTensor TEST_MODEL_aot_int8x8_io[2] = {
+    {.type = kTfLiteInt8, .params = {1.000000000e+00f, -128}, .bytes = 784},
+    {.type = kTfLiteInt8, .params = {3.906250000e-03f, -128}, .bytes = 10},
+};
+
+TfLiteStatus TEST_MODEL_aot_int8x8_init(void)
+{
+    return kTfLiteOk;
+}
+
+TfLiteTensor *TEST_MODEL_aot_int8x8_input(int index)
+{
+    (void) index;
+    return (TfLiteTensor *) &TEST_MODEL_aot_int8x8_io[0];
+}
+
+void *TEST_MODEL_aot_int8x8_input_ptr(int index)
+{
+    (void) index;
+    return &TEST_MODEL_aot_int8x8_arena[0];
+}
+
+TfLiteTensor *TEST_MODEL_aot_int8x8_output(int index)
+{
+    (void) index;
+    return (TfLiteTensor *) &TEST_MODEL_aot_int8x8_io[1];
+}
+
+void *TEST_MODEL_aot_int8x8_output_ptr(int index)
+{
+    (void) index;
+    return &TEST_MODEL_aot_int8x8_arena[0];
+}
+
+TfLiteStatus TEST_MODEL_aot_int8x8_invoke(void)
+{
+    uint8_t *arena = TEST_MODEL_aot_int8x8_arena;
+
+    ml_fc_s8_dense(&TEST_MODEL_aot_int8x8_layers[0], (const int8_t *) &arena[0], (int8_t *) &arena[784],
+                   TEST_MODEL_aot_int8x8_scratch);
+    ml_fc_s8_dense(&TEST_MODEL_aot_int8x8_layers[1], (const int8_t *) &arena[784], (int8_t *) &arena[0],
+                   TEST_MODEL_aot_int8x8_scratch);
+    ml_fc_s8_dense(&TEST_MODEL_aot_int8x8_layers[2], (const int8_t *) &arena[0], (int8_t *) &arena[16],
+                   TEST_MODEL_aot_int8x8_scratch);
+    ml_softmax_s8(&TEST_MODEL_aot_int8x8_softmax, (const int8_t *) &arena[16], (int8_t *) &arena[0]);
+    return kTfLiteOk;
+}
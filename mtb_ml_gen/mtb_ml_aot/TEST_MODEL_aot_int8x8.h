@@ -0,0 +1,28 @@
+/***************************************************************************//**
+* \file TEST_MODEL_aot_int8x8.h
+*
+* \brief
+* Generated with scripts/ml_aot_gen.py, this file contains the TEST_MODEL model
+* (int8x8) compiled ahead of time: constant layers and a straight-line invoke
+* of the kernels on a static arena, without the TFLM interpreter.
+******************************************************************************/
+
+
+#ifndef TEST_MODEL_AOT_INT8X8_H
+#define TEST_MODEL_AOT_INT8X8_H
+
+#include "tensorflow/lite/c/common.h"
+
+
+#define TEST_MODEL_AOT_INT8X8_ARENA_SIZE (800u)
+#define TEST_MODEL_AOT_INT8X8_FLASH_SIZE (13128u) /* Weights, bias and tables */
+#define TEST_MODEL_AOT_INT8X8_RAM_SIZE (2368u) /* Arena and scratch */
+
+TfLiteStatus TEST_MODEL_aot_int8x8_init(void);
+TfLiteTensor *TEST_MODEL_aot_int8x8_input(int index);
+void *TEST_MODEL_aot_int8x8_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_aot_int8x8_output(int index);
+void *TEST_MODEL_aot_int8x8_output_ptr(int index);
+TfLiteStatus TEST_MODEL_aot_int8x8_invoke(void);
+
+#endif // TEST_MODEL_AOT_INT8X8_H
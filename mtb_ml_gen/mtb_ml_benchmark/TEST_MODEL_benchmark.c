@@ -0,0 +1,63 @@
+/***************************************************************************//**
+* \file TEST_MODEL_benchmark.c
+*
+* \brief
+* Generated with scripts/ml_benchmark_gen.py, this file lists the
+* tflm_less models of TEST_MODEL linked for the benchmark.
+******************************************************************************/
+
+
+#include "TEST_MODEL_benchmark.h"
+
+
+TfLiteStatus TEST_MODEL_int8x8_init(void);
+TfLiteTensor *TEST_MODEL_int8x8_input(int index);
+void *TEST_MODEL_int8x8_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_int8x8_output(int index);
+void *TEST_MODEL_int8x8_output_ptr(int index);
+TfLiteStatus TEST_MODEL_int8x8_invoke(void);
+
+TfLiteStatus TEST_MODEL_int16x8_init(void);
+TfLiteTensor *TEST_MODEL_int16x8_input(int index);
+void *TEST_MODEL_int16x8_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_int16x8_output(int index);
+void *TEST_MODEL_int16x8_output_ptr(int index);
+TfLiteStatus TEST_MODEL_int16x8_invoke(void);
+
+TfLiteStatus TEST_MODEL_float_init(void);
+TfLiteTensor *TEST_MODEL_float_input(int index);
+void *TEST_MODEL_float_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_float_output(int index);
+void *TEST_MODEL_float_output_ptr(int index);
+TfLiteStatus TEST_MODEL_float_invoke(void);
+
+TfLiteStatus TEST_MODEL_aot_int8x8_init(void);
+TfLiteTensor *TEST_MODEL_aot_int8x8_input(int index);
+void *TEST_MODEL_aot_int8x8_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_aot_int8x8_output(int index);
+void *TEST_MODEL_aot_int8x8_output_ptr(int index);
+TfLiteStatus TEST_MODEL_aot_int8x8_invoke(void);
+
+TfLiteStatus TEST_MODEL_aot_int16x8_init(void);
+TfLiteTensor *TEST_MODEL_aot_int16x8_input(int index);
+void *TEST_MODEL_aot_int16x8_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_aot_int16x8_output(int index);
+void *TEST_MODEL_aot_int16x8_output_ptr(int index);
+TfLiteStatus TEST_MODEL_aot_int16x8_invoke(void);
+
+TfLiteStatus TEST_MODEL_aot_float_init(void);
+TfLiteTensor *TEST_MODEL_aot_float_input(int index);
+void *TEST_MODEL_aot_float_input_ptr(int index);
+TfLiteTensor *TEST_MODEL_aot_float_output(int index);
+void *TEST_MODEL_aot_float_output_ptr(int index);
+TfLiteStatus TEST_MODEL_aot_float_invoke(void);
+
+
+const ml_benchmark_variant_t TEST_MODEL_benchmark_variants[6] = {
+    {"tflm_less int8x8", TEST_MODEL_int8x8_init, TEST_MODEL_int8x8_input, TEST_MODEL_int8x8_input_ptr, TEST_MODEL_int8x8_output, TEST_MODEL_int8x8_output_ptr, TEST_MODEL_int8x8_invoke, 800, 14602, 1784},
+    {"tflm_less int16x8", TEST_MODEL_int16x8_init, TEST_MODEL_int16x8_input, TEST_MODEL_int16x8_input_ptr, TEST_MODEL_int16x8_output, TEST_MODEL_int16x8_output_ptr, TEST_MODEL_int16x8_invoke, 3666, 16822, 4650},
+    {"tflm_less float", TEST_MODEL_float_init, TEST_MODEL_float_input, TEST_MODEL_float_input_ptr, TEST_MODEL_float_output, TEST_MODEL_float_output_ptr, TEST_MODEL_float_invoke, 3200, 53097, 4184},
+    {"aot int8x8", TEST_MODEL_aot_int8x8_init, TEST_MODEL_aot_int8x8_input, TEST_MODEL_aot_int8x8_input_ptr, TEST_MODEL_aot_int8x8_output, TEST_MODEL_aot_int8x8_output_ptr, TEST_MODEL_aot_int8x8_invoke, 800, 13128, 2368},
+    {"aot int16x8", TEST_MODEL_aot_int16x8_init, TEST_MODEL_aot_int16x8_input, TEST_MODEL_aot_int16x8_input_ptr, TEST_MODEL_aot_int16x8_output, TEST_MODEL_aot_int16x8_output_ptr, TEST_MODEL_aot_int16x8_invoke, 1600, 15348, 1600},
+    {"aot float", TEST_MODEL_aot_float_init, TEST_MODEL_aot_float_input, TEST_MODEL_aot_float_input_ptr, TEST_MODEL_aot_float_output, TEST_MODEL_aot_float_output_ptr, TEST_MODEL_aot_float_invoke, 3200, 52008, 3200},
+};
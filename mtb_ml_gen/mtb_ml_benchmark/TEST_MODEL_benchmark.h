@@ -0,0 +1,20 @@
+/***************************************************************************//**
+* \file TEST_MODEL_benchmark.h
+*
+* \brief
+* Generated with scripts/ml_benchmark_gen.py, this file lists the
+* tflm_less models of TEST_MODEL linked for the benchmark.
+******************************************************************************/
+
+
+#ifndef TEST_MODEL_BENCHMARK_H
+#define TEST_MODEL_BENCHMARK_H
+
+#include "ml_benchmark.h"
+
+
+#define TEST_MODEL_BENCHMARK_NUM_OF_VARIANTS (6u)
+
+extern const ml_benchmark_variant_t TEST_MODEL_benchmark_variants[6];
+
+#endif // TEST_MODEL_BENCHMARK_H
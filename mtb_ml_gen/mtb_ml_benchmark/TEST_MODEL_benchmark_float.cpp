@@ -0,0 +1,44 @@
+/***************************************************************************//**
+* \file TEST_MODEL_benchmark_float.cpp
+*
+* \brief
+* Generated with scripts/ml_benchmark_gen.py, this file compiles the
+* tflm_less float model of TEST_MODEL with its global symbols renamed,
+* so it links next to the other variants.
+******************************************************************************/
+
+#define TEST_MODEL_PreinterpretedMicroContext TEST_MODEL_float_PreinterpretedMicroContext
+#define TEST_MODEL_classify_scores TEST_MODEL_float_classify_scores
+#define TEST_MODEL_init TEST_MODEL_float_init
+#define TEST_MODEL_input TEST_MODEL_float_input
+#define TEST_MODEL_input_dims TEST_MODEL_float_input_dims
+#define TEST_MODEL_input_dims_len TEST_MODEL_float_input_dims_len
+#define TEST_MODEL_input_ptr TEST_MODEL_float_input_ptr
+#define TEST_MODEL_input_size TEST_MODEL_float_input_size
+#define TEST_MODEL_inputs TEST_MODEL_float_inputs
+#define TEST_MODEL_invoke TEST_MODEL_float_invoke
+#define TEST_MODEL_invoke_classify TEST_MODEL_float_invoke_classify
+#define TEST_MODEL_model TEST_MODEL_float_model
+#define TEST_MODEL_op_user_data TEST_MODEL_float_op_user_data
+#define TEST_MODEL_op_user_data0_kernel_sums TEST_MODEL_float_op_user_data0_kernel_sums
+#define TEST_MODEL_op_user_data0_per_channel_output_multiplier TEST_MODEL_float_op_user_data0_per_channel_output_multiplier
+#define TEST_MODEL_op_user_data0_per_channel_output_shift TEST_MODEL_float_op_user_data0_per_channel_output_shift
+#define TEST_MODEL_op_user_data1_kernel_sums TEST_MODEL_float_op_user_data1_kernel_sums
+#define TEST_MODEL_op_user_data1_per_channel_output_multiplier TEST_MODEL_float_op_user_data1_per_channel_output_multiplier
+#define TEST_MODEL_op_user_data1_per_channel_output_shift TEST_MODEL_float_op_user_data1_per_channel_output_shift
+#define TEST_MODEL_op_user_data2_kernel_sums TEST_MODEL_float_op_user_data2_kernel_sums
+#define TEST_MODEL_op_user_data2_per_channel_output_multiplier TEST_MODEL_float_op_user_data2_per_channel_output_multiplier
+#define TEST_MODEL_op_user_data2_per_channel_output_shift TEST_MODEL_float_op_user_data2_per_channel_output_shift
+#define TEST_MODEL_output TEST_MODEL_float_output
+#define TEST_MODEL_output_dims TEST_MODEL_float_output_dims
+#define TEST_MODEL_output_dims_len TEST_MODEL_float_output_dims_len
+#define TEST_MODEL_output_ptr TEST_MODEL_float_output_ptr
+#define TEST_MODEL_output_size TEST_MODEL_float_output_size
+#define TEST_MODEL_outputs TEST_MODEL_float_outputs
+#define TEST_MODEL_reset TEST_MODEL_float_reset
+
+// The layer breakdown and the startup phases are those of the model set in
+// the Makefile, the markers of the variants are removed
+#undef ML_LAYER_PROFILE
+#undef ML_BOOT_PROFILE
+#include "TEST_MODEL_tflm_less_model_float.cpp"
@@ -0,0 +1,2494 @@
+/***************************************************************************//**
+* \file TEST_MODEL_fc_float.c
+*
+* \brief
+* Generated with scripts/ml_fc_float_gen.py, this file contains the fully
+* connected layers of the TEST_MODEL model (float) with float32 weights and with
+* half precision weights.
+******************************************************************************/
+
+
+#include "TEST_MODEL_fc_float.h"
+
+#include <stddef.h>
+
+
+static const float TEST_MODEL_fc_float_0_weights[12544] __attribute__((aligned(4))) = {
+    -7.716856152e-02f, 7.581643760e-02f, -1.701147854e-02f, 5.423094332e-02f, 3.645171970e-02f, -6.009365618e-02f, -6.745803356e-02f, -4.357703775e-02f,
+    6.695532799e-02f, -3.396892175e-02f, 7.357504964e-02f, -3.282382339e-02f, 5.508430302e-02f, 8.243389428e-03f, 6.166101992e-02f, 1.035518944e-03f,
+    -6.325252354e-02f, -3.174285591e-02f, 8.279070258e-03f, -2.100045979e-02f, 8.466853201e-02f, 2.746738493e-03f, -7.908388227e-02f, -6.618372351e-02f,
+    6.336908042e-02f, -1.469344646e-02f, 4.968598485e-02f, -1.823514700e-03f, 6.255842745e-02f, 2.112253010e-02f, -2.175632864e-02f, 6.244695187e-02f,
+    -2.184001356e-02f, 4.700160027e-02f, -4.307072237e-02f, 1.928085089e-02f, 2.597182291e-03f, -6.801535189e-02f, -3.302295133e-02f, -7.608538121e-02f,
+    -5.211374164e-02f, 5.454590917e-02f, -4.661459848e-02f, -5.787784979e-02f, 7.698592544e-02f, -2.746649459e-02f, -7.090158761e-02f, -4.270862043e-02f,
+    2.414790541e-02f, 8.132202923e-02f, 8.828423917e-03f, -8.019596338e-02f, 6.738108397e-02f, 6.379923224e-02f, -6.608837098e-02f, 8.109033108e-03f,
+    -7.981373370e-02f, -3.715190291e-02f, -4.187340289e-02f, 4.778304696e-02f, -7.502554357e-02f, -2.643911168e-02f, 3.308317438e-02f, 7.091361284e-02f,
+    8.190880716e-02f, -3.297993913e-02f, -1.280147955e-02f, 6.264237314e-02f, -9.339284152e-02f, 4.928237572e-02f, 2.270991914e-03f, -5.073635653e-02f,
+    -5.257181823e-02f, 7.994294912e-02f, -6.520503759e-02f, -4.623460397e-02f, 1.723477058e-02f, 1.323006465e-03f, -7.284054160e-02f, 4.706421494e-02f,
+    1.034920663e-02f, -7.207098603e-02f, 6.761035323e-02f, -5.891956389e-03f, 3.678604960e-02f, 6.892156601e-02f, -8.658546209e-02f, -6.646502763e-02f,
+    3.668251634e-02f, -6.173824891e-02f, 4.515746608e-02f, 6.248579174e-02f, -9.063028544e-02f, 3.371116146e-02f, -7.822876424e-02f, -8.324468136e-02f,
+    -7.222215086e-02f, 2.126684412e-02f, -8.822640032e-02f, -9.058509767e-02f, -9.251926094e-02f, -9.916467220e-02f, -4.725233838e-02f, 3.687123582e-02f,
+    -1.153109968e-02f, -6.688463688e-02f, -6.854538620e-02f, 1.350021455e-02f, -3.724059835e-02f, -1.456749626e-02f, -4.502910003e-02f, 7.709763944e-02f,
+    -2.125861496e-02f, 1.086223871e-02f, 7.930494845e-02f, 5.464291573e-02f, -8.276097476e-02f, 3.972182795e-02f, 5.637636408e-02f, -1.478427928e-02f,
+    -7.131015882e-03f, 3.033412062e-02f, 5.797749758e-02f, -7.890312374e-02f, 7.651159167e-02f, 1.749683917e-02f, 6.388901919e-02f, -6.584338099e-02f,
+    -7.755575329e-02f, -4.734020308e-02f, -3.119187616e-02f, 9.144906700e-02f, 4.549057782e-02f, -4.766055942e-02f, 4.556280375e-02f, -2.824290842e-02f,
+    -3.531909734e-02f, 7.381176203e-02f, -5.112459511e-02f, -5.577583611e-02f, 1.988723874e-02f, 7.577963173e-02f, -1.103755087e-02f, -3.378162161e-02f,
+    4.958226532e-02f, -1.098894887e-02f, -4.279902950e-02f, 7.211856544e-02f, -7.391048968e-02f, 4.008642212e-02f, -4.333525896e-02f, 5.298880488e-02f,
+    4.262086377e-02f, -7.409480959e-02f, -9.152757376e-02f, -1.939610578e-02f, 1.204241626e-02f, -4.209978506e-02f, -1.204440743e-02f, 4.637692869e-02f,
+    3.053892404e-03f, 3.514941037e-02f, 5.860398710e-02f, 5.000096560e-02f, -2.184678987e-02f, -6.607458740e-02f, -3.854641318e-02f, -7.294415683e-02f,
+    -1.031218469e-02f, 1.981883496e-02f, -7.088576257e-02f, -3.982746601e-02f, 3.354747593e-02f, 3.047310188e-02f, -8.105511777e-03f, -6.400520355e-02f,
+    -9.994396009e-03f, 1.175069367e-03f, 6.273484975e-02f, -5.835069343e-02f, 3.731514141e-02f, 2.299168520e-02f, -5.824068189e-02f, -1.226326451e-01f,
+    -1.130596027e-01f, -5.097545683e-02f, -1.895424537e-02f, -1.960971393e-02f, 2.690052800e-02f, 1.097812876e-02f, 1.144791394e-01f, -9.133215994e-03f,
+    -3.818608448e-02f, -2.279935591e-02f, -5.631347001e-02f, 2.722348645e-02f, -7.510464638e-02f, -3.722435609e-02f, 7.413771003e-02f, -8.039963245e-02f,
+    6.443905085e-02f, 6.628447771e-02f, 1.566247456e-02f, -2.022278868e-02f, -7.566933334e-02f, -5.697859451e-03f, -6.640779227e-02f, -1.111064758e-02f,
+    -4.662216827e-02f, 1.204779465e-02f, -1.020353809e-01f, -4.359650239e-02f, -5.379148200e-02f, -5.212191865e-02f, -8.246507496e-02f, -3.824838623e-02f,
+    5.472137779e-02f, 4.880883917e-02f, 5.418903381e-02f, -6.527457852e-03f, -1.177980471e-02f, -8.138448745e-02f, -3.579094261e-02f, -6.137899682e-02f,
+    -5.133095756e-02f, -2.240299433e-02f, 7.916146517e-02f, 6.239206344e-02f, 2.146249264e-02f, -3.935584426e-02f, -7.826037705e-02f, 5.067810789e-02f,
+    -5.823107436e-02f, 5.768287182e-02f, -2.973264270e-02f, -3.468706086e-02f, -9.390097857e-02f, -8.536788076e-02f, -7.523915172e-02f, 3.606980667e-02f,
+    -5.801463500e-02f, -8.537806571e-03f, 7.909929007e-02f, -1.485164091e-02f, -4.117789119e-02f, -5.044493452e-02f, -4.910557717e-02f, -4.816420004e-02f,
+    -8.716021478e-02f, -1.000174601e-02f, -6.934594363e-02f, -7.717505097e-03f, 6.881070137e-02f, -3.594060615e-02f, 2.484719083e-02f, -6.595155597e-02f,
+    6.741484255e-02f, -4.960753396e-02f, -7.365486026e-02f, -6.277100742e-02f, 6.631032377e-02f, -1.091959849e-01f, -7.862433791e-02f, 5.396355316e-02f,
+    1.754994132e-02f, -5.185147375e-02f, -9.810889512e-02f, 1.123675797e-02f, 5.203919113e-02f, -2.494963445e-02f, 8.024166524e-02f, 1.925379224e-02f,
+    -8.184374124e-02f, -2.433242276e-02f, -6.499616057e-02f, -6.941144355e-03f, 3.101874329e-02f, 1.092352252e-02f, 2.724547312e-02f, -8.054425567e-02f,
+    5.390392244e-02f, -7.657339424e-02f, -5.841955543e-02f, -2.586783841e-03f, -9.075840004e-03f, -1.401187852e-02f, -3.364363685e-02f, 5.992328376e-02f,
+    3.858220950e-02f, -1.200966816e-02f, -1.115056574e-01f, -6.010553986e-02f, 4.371737316e-02f, 2.836234681e-02f, 4.573916551e-03f, -5.240895227e-02f,
+    1.509817597e-02f, -5.435813591e-02f, 2.796105295e-02f, 3.760427237e-02f, 4.084943235e-02f, 3.065661713e-02f, -4.629102536e-03f, 6.642761081e-02f,
+    4.069358855e-02f, 6.074430421e-02f, 7.760316133e-02f, -8.028407395e-02f, -2.598005533e-02f, -5.768917501e-02f, 3.581443056e-02f, -3.999969363e-02f,
+    9.436222166e-02f, 6.875344366e-02f, -8.303250372e-02f, 6.009802967e-02f, -7.351581007e-02f, -1.027249992e-01f, -1.168401912e-03f, -8.287306875e-02f,
+    -2.432085574e-02f, -5.720006675e-02f, 6.492861360e-02f, -2.920640633e-02f, 8.253552020e-02f, 9.414528497e-03f, 2.781185135e-02f, 5.898514763e-02f,
+    -8.672954887e-02f, 5.003455281e-02f, 5.357902870e-02f, 7.887644321e-02f, 2.796151675e-02f, 4.111875221e-02f, 2.301021293e-02f, -3.592771664e-02f,
+    -3.469982743e-02f, 3.087739646e-02f, -7.128459960e-02f, 3.886946291e-02f, 6.371140480e-02f, 5.968188867e-02f, -8.364479244e-02f, -1.432085410e-02f,
+    -5.989628285e-02f, 1.581410505e-02f, -1.025369484e-02f, -4.590816051e-02f, 1.486417558e-02f, -3.090923466e-02f, -5.126229674e-02f, 7.580862939e-02f,
+    5.503691733e-03f, 4.857856838e-04f, 4.993277788e-02f, 1.498481166e-02f, -5.970156565e-02f, -1.273627114e-02f, -7.787775248e-02f, 1.897207461e-02f,
+    -5.742535740e-02f, 3.281750903e-02f, -4.423026368e-02f, -7.826501876e-02f, -3.875762969e-02f, -2.200365067e-02f, -2.675059997e-02f, -2.149861678e-02f,
+    7.572873682e-02f, 6.108038942e-04f, -7.086846232e-02f, -2.328526601e-02f, 2.233454771e-02f, 1.990947314e-02f, -3.841600195e-02f, -1.737095974e-02f,
+    1.338969637e-02f, 5.703791231e-02f, -4.938746989e-02f, -2.812013030e-03f, -3.512826189e-02f, 8.217803203e-03f, 7.727413625e-02f, -8.462556638e-03f,
+    -7.057271153e-02f, -6.099208444e-02f, -6.074158102e-02f, 6.434187293e-02f, 1.491241343e-02f, -8.012273163e-02f, 4.731012881e-02f, -7.831134647e-02f,
+    7.963770628e-02f, -7.061293721e-02f, 3.334573656e-02f, 1.650527120e-02f, -6.717032194e-02f, 2.486000955e-02f, -7.067620009e-02f, -7.790628821e-02f,
+    -7.356865704e-02f, -8.466745913e-02f, -1.043846309e-01f, -3.206267022e-03f, 2.136436850e-02f, 6.926383078e-02f, 4.393881187e-02f, 2.540229633e-02f,
+    -2.786428481e-02f, -1.144115254e-02f, -7.922246121e-03f, -5.523116328e-03f, -3.600607440e-02f, -6.478925049e-02f, -8.921543509e-02f, -8.462332934e-02f,
+    -6.322898436e-03f, 1.943808049e-02f, -2.382707782e-02f, -1.823799312e-02f, -8.099207282e-02f, -5.166730657e-02f, 1.176390052e-02f, -8.439140767e-02f,
+    7.526087761e-02f, 3.407756612e-02f, -2.733461373e-02f, 6.009630114e-02f, -1.409865078e-02f, -4.308591038e-02f, 1.561354846e-02f, 3.516228497e-02f,
+    -2.408889122e-03f, 2.261612564e-02f, -4.920569807e-02f, -2.028713934e-02f, -6.222076714e-02f, -5.791070405e-03f, -9.750890546e-03f, -2.581975609e-02f,
+    -9.115174413e-02f, 5.422105268e-02f, -3.558671474e-02f, -5.566630512e-02f, -3.298627958e-02f, -4.082204401e-02f, -6.523471326e-02f, -8.509063721e-02f,
+    -6.584105641e-02f, -5.042204633e-02f, 4.493956268e-02f, -6.643775851e-02f, 4.900714383e-03f, 1.303224824e-02f, -1.079241037e-01f, 3.358543664e-02f,
+    4.272663966e-02f, -4.499659315e-02f, 6.384750362e-03f, 5.020507425e-02f, 4.553474113e-02f, 7.088871300e-02f, -7.738515735e-02f, -1.067860331e-02f,
+    1.799107902e-02f, 3.537258506e-02f, -3.403056040e-02f, -9.001209587e-02f, 7.387736812e-03f, 3.047118522e-02f, -6.871251017e-02f, -5.040373653e-02f,
+    9.923846461e-03f, 5.003692582e-02f, -1.020805910e-02f, -3.232483566e-02f, -6.987657398e-02f, -7.228549570e-02f, 3.553341329e-02f, -7.771811634e-02f,
+    5.666851997e-02f, 3.517686948e-02f, 5.676443502e-02f, 7.680141833e-03f, 9.206650779e-03f, 6.956923008e-02f, 5.634729937e-02f, 6.838066131e-02f,
+    6.257534027e-02f, 3.693575040e-02f, 3.205978870e-02f, 6.424923241e-02f, 2.090288885e-02f, -7.758697122e-02f, 8.220823482e-03f, -6.589053571e-02f,
+    1.656104624e-02f, -7.372020930e-02f, -1.429945044e-02f, -6.650577486e-02f, 4.553679377e-02f, -2.153006382e-02f, 1.493341103e-02f, 6.727038324e-02f,
+    8.238290250e-02f, -5.754356831e-02f, -4.896284640e-02f, -8.520256728e-02f, -9.125136584e-02f, 7.940112799e-02f, -1.009711903e-02f, -6.879747659e-02f,
+    5.166959763e-02f, 2.855210332e-03f, -7.724288106e-02f, -2.809648402e-02f, 6.862727553e-02f, -5.560059845e-02f, -6.509873271e-02f, -6.468031555e-02f,
+    -5.455032736e-02f, 6.360321492e-02f, -1.524179429e-02f, -6.240555644e-02f, -7.285422762e-04f, -8.847414702e-02f, 4.968144000e-02f, -1.153058559e-01f,
+    -5.009862408e-02f, -4.332984239e-02f, -8.507400751e-02f, 6.257897615e-02f, -6.508053839e-02f, -5.677714944e-04f, -2.181423455e-02f, -6.756567396e-03f,
+    -1.898978092e-02f, -2.275879867e-02f, 6.465477496e-02f, -5.261210725e-02f, 8.239317685e-02f, 8.170459419e-02f, 7.733427454e-03f, 3.157210723e-02f,
+    7.840030640e-02f, -7.800913602e-02f, -6.912427396e-02f, -1.197372656e-02f, -2.822033130e-02f, -2.582171559e-02f, 4.289027676e-02f, -5.722866580e-02f,
+    -5.753151700e-02f, -3.611768782e-02f, -2.138293907e-02f, 5.470896885e-02f, 1.377876848e-02f, -2.341513894e-02f, 6.803865731e-02f, 2.367633581e-02f,
+    5.082829297e-02f, -6.473654509e-02f, 1.268751640e-02f, -1.665490307e-02f, 2.361941896e-02f, -4.548090044e-03f, -3.752976283e-02f, -2.137183025e-02f,
+    -1.858971640e-02f, 7.877026498e-02f, -3.163092583e-02f, 4.524125904e-02f, -8.082097769e-02f, 1.868768409e-02f, 1.878779614e-03f, -6.555377692e-02f,
+    -1.115622446e-01f, 1.226420607e-02f, -4.295314662e-03f, 7.926328480e-02f, -4.627394676e-02f, -7.748340815e-02f, 4.764237627e-02f, -2.422666363e-02f,
+    7.288731635e-02f, -7.611984015e-02f, 3.453931212e-02f, -1.775502414e-02f, 6.058746576e-02f, -2.247063816e-02f, -1.888075098e-02f, -7.487964630e-02f,
+    2.259209380e-02f, -3.045200743e-02f, -3.115517646e-02f, 6.717249751e-03f, -8.546609432e-03f, 6.895911694e-02f, -8.816045523e-02f, -6.295785308e-02f,
+    8.843528107e-03f, -8.545091748e-02f, -5.216662958e-02f, -5.937208422e-03f, 1.868417859e-02f, 3.140496835e-02f, 2.632382326e-02f, 4.789907113e-02f,
+    -6.112532690e-02f, -3.028291091e-02f, -9.718257934e-02f, 6.539069861e-02f, -2.283135429e-02f, -8.788805455e-02f, 2.574077621e-02f, -8.451138437e-02f,
+    1.437995583e-02f, 4.187916219e-02f, 6.132633984e-02f, 1.749921963e-02f, -7.480172068e-02f, -6.775249541e-02f, -1.794806309e-02f, -6.230803207e-02f,
+    -1.080193929e-02f, 8.338811458e-04f, -1.659744419e-02f, 4.110310972e-02f, 1.067483611e-02f, -2.606128156e-02f, 1.155422628e-02f, 6.444176286e-02f,
+    -8.922144771e-02f, -7.548394799e-02f, 9.203244001e-02f, 1.544312108e-02f, -1.683851145e-02f, 4.608676583e-02f, -7.045875490e-02f, 8.168403059e-02f,
+    -8.397348970e-02f, -4.443882033e-02f, -2.636345103e-02f, -4.898213968e-02f, 5.255725980e-02f, -5.816751719e-02f, 7.599704713e-02f, 1.235426217e-02f,
+    7.207435369e-02f, 2.684585005e-02f, -2.526894212e-02f, 4.205097258e-02f, 4.072751477e-02f, 1.406269986e-02f, -5.879034847e-02f, -7.311273366e-02f,
+    -4.109019041e-02f, -1.569602638e-02f, 2.210854739e-02f, -2.725224011e-02f, -1.387597807e-02f, 6.128082983e-03f, -4.213332385e-02f, 3.348805010e-02f,
+    -3.142785048e-03f, -6.242090091e-02f, 9.450474381e-02f, -4.589283094e-02f, -6.048868224e-02f, 1.345130708e-02f, 7.715937495e-02f, 6.265644729e-02f,
+    6.696753204e-02f, -4.159878939e-02f, -1.926898956e-03f, -3.439596668e-02f, -1.012575105e-01f, 4.964517429e-02f, -8.497003466e-02f, -7.419575006e-02f,
+    2.533338778e-02f, 1.848083548e-02f, 5.357106030e-02f, 1.234929543e-02f, 5.367383733e-02f, -2.637743764e-02f, 8.251405507e-02f, 4.819598980e-03f,
+    -9.104143828e-02f, 3.215621784e-02f, 2.047202550e-03f, -7.025203109e-02f, 6.058668345e-02f, 2.587209828e-02f, -7.291176170e-02f, -3.712593392e-02f,
+    -4.502223805e-02f, -1.461936533e-02f, 8.048057556e-02f, 2.299197018e-03f, -1.109834015e-02f, -6.197980046e-02f, -1.548603177e-04f, 2.489498258e-02f,
+    2.230393700e-02f, 6.629666686e-02f, 4.587761685e-02f, -7.912807912e-02f, -5.138812587e-02f, -2.976235189e-02f, -5.040980130e-02f, -6.852076203e-02f,
+    -5.655979738e-02f, -8.850474842e-03f, 4.959329590e-02f, -8.117996156e-02f, -1.569834165e-02f, -2.581387199e-02f, 7.107127458e-02f, -4.657610878e-02f,
+    -7.276090235e-02f, 3.033525683e-02f, 1.380759105e-02f, 1.833123527e-02f, 2.398846671e-02f, 4.510401189e-02f, 9.946390986e-03f, -7.705308497e-02f,
+    2.952831239e-02f, 2.165924758e-02f, -4.704619572e-02f, 5.050769448e-02f, 8.060805500e-03f, -4.729099572e-02f, 4.385391623e-02f, 3.346795216e-02f,
+    -6.162107736e-02f, -5.193378404e-02f, 5.022561178e-02f, -4.559049383e-02f, 5.739305913e-02f, -7.070484012e-02f, -3.805397078e-02f, 2.988842130e-02f,
+    -6.316759437e-02f, 1.894081384e-02f, -2.523873560e-02f, 4.659966007e-02f, -2.875006571e-02f, -7.541599125e-02f, 3.222966939e-02f, 5.446788669e-02f,
+    -7.640202343e-02f, 4.551954567e-02f, 2.601280063e-02f, 8.000949025e-02f, -5.751940981e-02f, -2.225905657e-02f, 1.659208536e-02f, 6.941907108e-02f,
+    3.269188851e-02f, -8.480899036e-03f, 6.683640182e-02f, -4.432995617e-02f, 8.677667379e-02f, -2.279331163e-02f, 3.118231334e-02f, -2.789559029e-02f,
+    8.124258369e-02f, -3.236942738e-02f, -3.203163296e-02f, -5.669469386e-02f, -6.729539484e-02f, -6.247666478e-02f, -7.718999684e-02f, 4.642366245e-02f,
+    3.755959123e-02f, -4.220155627e-02f, 1.249596477e-03f, 3.147970140e-02f, 4.934392869e-02f, -4.709914327e-03f, 3.994762897e-02f, -2.943407744e-02f,
+    5.934685469e-02f, -7.009737939e-02f, -8.032175153e-02f, 6.835986674e-02f, 8.432528377e-02f, 5.160835385e-02f, -1.341567189e-02f, 3.669841588e-02f,
+    3.672127426e-02f, 4.525960982e-02f, -4.153756797e-02f, -7.095312327e-02f, -1.901675761e-02f, 3.593831509e-02f, -2.435566485e-02f, 4.515373707e-02f,
+    -8.434422314e-02f, -1.776920259e-02f, -2.946605906e-02f, -4.771082476e-02f, 3.662530333e-02f, -1.005090773e-02f, 2.082470804e-02f, 4.558269680e-02f,
+    -4.783935472e-02f, 3.620356321e-03f, 7.039675117e-02f, -3.607731685e-02f, 7.861135900e-02f, -1.931583881e-02f, 6.748332083e-02f, 1.340985298e-03f,
+    3.166672587e-02f, 7.392841578e-02f, -3.545388207e-02f, 5.571034551e-02f, -1.154880971e-02f, -6.640508771e-02f, 6.212601438e-02f, 7.297428697e-02f,
+    -2.703382168e-03f, 5.258164927e-02f, 4.264849797e-02f, 1.214711089e-02f, 7.720196247e-02f, -5.547329038e-02f, 3.798602521e-02f, 7.139694691e-02f,
+    -6.602440774e-02f, -1.877359301e-02f, 1.416183263e-02f, 2.911075950e-02f, -1.146793365e-03f, -8.128613979e-02f, 7.052245736e-02f, -9.078755975e-03f,
+    1.654203236e-02f, -7.637158781e-02f, -5.607448518e-03f, -1.490781456e-02f, 4.652762413e-02f, -6.127293780e-02f, 8.463219553e-02f, 2.014311031e-02f,
+    9.624337405e-02f, -7.102607936e-02f, -1.678576879e-02f, 7.483308204e-03f, -8.830589801e-02f, 2.201704122e-02f, -4.049292579e-02f, -8.727339655e-02f,
+    3.071828559e-02f, -6.917619705e-02f, -5.108541623e-02f, 2.522208914e-02f, -2.692706697e-02f, 3.762576729e-02f, 5.655414984e-02f, -3.301017359e-02f,
+    2.631599456e-02f, -8.169403672e-02f, -4.949050769e-02f, -1.217478514e-02f, -4.897565767e-02f, 2.255017310e-02f, 1.102814078e-02f, 2.042366564e-02f,
+    3.970695660e-02f, -4.928369448e-02f, 9.379129857e-02f, -3.730745986e-02f, -7.781846821e-02f, -3.169066831e-02f, 2.713357657e-02f, -9.294913709e-02f,
+    -1.497542411e-01f, -5.058456957e-02f, -1.283008885e-02f, -7.450344507e-03f, 1.634516567e-02f, -4.464269802e-02f, -2.115720324e-02f, -7.996205986e-02f,
+    2.266623080e-03f, 5.441182293e-03f, -3.937543370e-03f, -2.426902577e-02f, -7.544582337e-02f, -2.271187864e-02f, 1.954537630e-02f, -8.706867695e-03f,
+    3.630978614e-02f, 7.345733047e-02f, 4.423063993e-02f, 2.907726169e-02f, 9.696576744e-04f, -4.499049857e-02f, -6.210218742e-02f, 1.887213998e-02f,
+    -2.746292017e-02f, 3.186888620e-02f, 2.097769082e-02f, 4.771048203e-03f, 2.290453762e-02f, -7.221203297e-02f, 1.275301538e-02f, 8.743358403e-02f,
+    -1.356641389e-02f, -2.678041160e-02f, 1.539864857e-02f, -4.011137784e-02f, -4.779989272e-02f, -4.308984801e-02f, 4.442294687e-02f, -1.081003174e-01f,
+    -1.020609811e-01f, 5.053813756e-02f, -2.379285730e-02f, -8.009751886e-02f, -3.261352703e-02f, -8.619765937e-02f, 5.203507841e-02f, -8.581764996e-02f,
+    -4.927808791e-02f, -4.426592786e-04f, -7.299387455e-02f, -1.263920814e-01f, -9.537307173e-02f, -1.206316520e-02f, 7.399665192e-04f, -5.613652989e-03f,
+    -5.605902057e-03f, 4.908776656e-02f, 4.543287307e-02f, -4.371172935e-02f, 3.363991156e-02f, -3.932593763e-02f, -1.038688235e-02f, 2.199831186e-03f,
+    5.456425622e-02f, 4.558115825e-02f, -3.691790998e-02f, -2.447438799e-02f, 1.405948028e-02f, 9.159428626e-02f, -5.946185440e-02f, -3.532501683e-02f,
+    -7.153813541e-02f, -2.374864370e-02f, 3.861513734e-02f, -1.806740038e-04f, 8.644526452e-02f, -7.638029289e-03f, -3.666616604e-02f, 4.015901685e-02f,
+    2.347335778e-02f, -1.162499785e-01f, -1.319660340e-02f, 1.081298757e-02f, -1.303008664e-02f, 5.340790749e-02f, 7.646419853e-02f, -4.589021578e-02f,
+    8.155038953e-02f, -6.289329380e-02f, 8.956079185e-02f, -6.910450011e-02f, -1.126572679e-04f, -5.127907917e-02f, 1.112830825e-02f, -7.695244253e-02f,
+    2.120075002e-02f, -3.476094082e-02f, -1.992592774e-02f, 4.314744473e-02f, 2.531703562e-02f, -4.269972444e-02f, -7.877853513e-02f, -1.113210525e-02f,
+    -1.382154878e-03f, -6.406396627e-02f, -3.687102720e-02f, 4.723859578e-02f, -4.137806594e-03f, -3.307007253e-02f, -3.336793184e-02f, -1.417665090e-02f,
+    -5.783187598e-02f, -1.060570125e-03f, -3.884260729e-02f, 9.002617002e-02f, -5.858808011e-02f, 7.979632914e-02f, -4.790205974e-03f, 1.629287936e-02f,
+    4.932783544e-02f, -6.336593287e-06f, -2.924761362e-02f, -4.243397713e-02f, 2.743018977e-02f, -4.746536911e-02f, -1.417735517e-01f, -4.902404547e-02f,
+    -2.844503522e-02f, 7.890162058e-03f, 5.462733563e-03f, -8.495868742e-02f, -6.978676468e-02f, 3.549890220e-02f, -4.213279858e-02f, 5.467993766e-02f,
+    -8.890305459e-02f, -3.845812380e-02f, 1.157082897e-02f, 4.968327284e-02f, 2.225257270e-02f, -1.784497499e-02f, -1.349352486e-02f, 6.672156602e-02f,
+    4.223047942e-02f, 5.792981759e-02f, 3.432378918e-02f, -1.217667386e-02f, 5.397661403e-02f, 2.545109391e-02f, -4.813529924e-02f, 3.450968862e-02f,
+    -8.042249084e-02f, -1.242651269e-01f, -2.997451834e-02f, 6.276347488e-02f, -2.292887121e-02f, 8.109832555e-02f, 7.847616076e-02f, -8.556073159e-02f,
+    2.898375690e-02f, -1.055269316e-01f, 2.365440875e-02f, 2.553639747e-02f, -1.382440981e-02f, 1.374943834e-02f, -7.010213286e-02f, 1.946594194e-02f,
+    8.267209679e-02f, -1.554245874e-02f, -5.283795670e-02f, 3.106007911e-02f, 4.720453545e-02f, 6.949473172e-02f, -4.558001831e-02f, 3.783453628e-02f,
+    6.571672112e-02f, -1.166210473e-01f, 4.907905310e-02f, -4.927511141e-02f, -3.498247638e-02f, -1.236648113e-01f, -2.747509256e-02f, 4.385849833e-02f,
+    3.089523874e-02f, 9.738274850e-03f, 6.092181802e-02f, 1.593738981e-02f, -7.974423468e-02f, 1.039691176e-02f, -8.278506249e-02f, 3.542308509e-02f,
+    -8.896503597e-02f, 5.262379418e-04f, -6.136422604e-02f, -2.460423112e-02f, 1.298596710e-02f, 6.380380597e-03f, -6.000022963e-02f, 1.486375928e-02f,
+    -1.344292462e-01f, 1.122071408e-02f, 1.675405353e-02f, 4.205014557e-02f, 2.564313076e-02f, -2.161649242e-02f, 4.805253819e-02f, -4.459457472e-03f,
+    1.516806241e-02f, -1.271398962e-01f, -4.071615636e-02f, 1.984707080e-03f, -8.213286102e-02f, 7.787437644e-03f, -1.585628279e-02f, 1.140195038e-02f,
+    -7.892775536e-02f, -4.511164501e-02f, 3.255301854e-03f, -3.090593778e-02f, 2.317944914e-02f, 2.772605233e-02f, -8.782348782e-02f, 1.430152636e-02f,
+    6.242423505e-02f, -2.749132179e-02f, -1.015750915e-01f, -8.199132234e-02f, -5.575790629e-02f, -3.897462413e-02f, 3.881292045e-02f, -9.193069488e-02f,
+    7.213504612e-02f, 6.789273024e-02f, -5.061373860e-02f, -5.379956216e-02f, -6.879048795e-02f, -1.181225106e-02f, 1.400005911e-02f, -7.854843140e-02f,
+    -1.908708364e-02f, 7.701697946e-02f, -9.014783427e-03f, -2.557584457e-02f, 3.943413869e-02f, 2.449301258e-02f, 3.654482216e-02f, -7.943969220e-03f,
+    -1.881767064e-02f, -1.095956378e-02f, 2.542537637e-02f, 4.204124212e-03f, -6.747234613e-02f, -5.437469110e-02f, -9.832815826e-02f, -1.037959605e-01f,
+    -8.703780361e-03f, -3.837337345e-02f, -9.836177342e-03f, 5.447662622e-02f, -7.802164555e-02f, -3.740325943e-02f, 5.038221180e-02f, 2.468991838e-02f,
+    1.133194491e-01f, 5.331197288e-03f, -7.602103055e-02f, 4.964514077e-02f, -5.793663859e-02f, 6.391324848e-02f, 8.108289540e-02f, 2.711030887e-03f,
+    6.823396310e-03f, 3.321703151e-02f, 7.683698088e-03f, -4.351873696e-02f, 2.563748136e-02f, 3.615359217e-02f, -3.382703289e-02f, -8.146830834e-03f,
+    5.206417292e-03f, -2.537783049e-02f, -1.170230284e-01f, 5.871325266e-03f, -4.037669674e-02f, -3.654893115e-02f, -6.986385584e-02f, 2.843847871e-02f,
+    6.821621209e-02f, 8.785772324e-02f, -2.057714760e-02f, 9.829504788e-02f, 1.458442807e-01f, -9.810579568e-02f, 7.097396255e-02f, -5.570984632e-02f,
+    -2.160455287e-02f, -1.662354916e-02f, -6.709227711e-02f, -8.011075854e-02f, -4.839891195e-02f, 1.181624532e-01f, 7.937354594e-02f, 3.228843212e-03f,
+    5.366306379e-02f, 2.323847450e-02f, 2.012975048e-03f, 1.497774571e-02f, 1.676642522e-02f, -8.207757771e-02f, -2.533046529e-02f, -1.021253616e-01f,
+    -1.945710741e-02f, -4.686127417e-03f, -1.781662228e-03f, -2.872462943e-02f, 1.253942121e-02f, 2.586807497e-02f, -4.191850871e-02f, -2.678381838e-02f,
+    -1.862886921e-02f, 5.234451592e-02f, 2.196893282e-02f, 2.860742807e-02f, 2.046599984e-04f, 3.176214546e-02f, 6.930434704e-02f, 5.586307496e-02f,
+    -1.600296982e-02f, 4.966742918e-02f, 3.965715691e-02f, -6.621966604e-03f, 6.986775901e-03f, -1.221859455e-02f, -5.936441198e-02f, 5.810282752e-02f,
+    1.070054527e-02f, -9.461729974e-02f, 1.758077554e-02f, -1.411514580e-01f, -3.555645421e-02f, -2.169714309e-02f, -3.901944309e-02f, -1.763410494e-02f,
+    2.252623904e-03f, -3.915333375e-02f, 5.430080742e-02f, -2.764960518e-03f, 6.090802699e-02f, -4.230716452e-02f, 3.634303063e-02f, -3.673273325e-02f,
+    -4.110246897e-03f, 1.412783749e-02f, -4.507582262e-02f, -5.745621026e-02f, 4.503745586e-02f, -2.274556272e-02f, 5.008835346e-03f, 7.333789766e-02f,
+    6.360687315e-02f, -2.112179995e-02f, 5.263456702e-02f, 2.033672668e-02f, -7.723396271e-02f, -1.790953800e-02f, -7.892668247e-02f, -1.299706399e-01f,
+    -1.239646822e-01f, 3.284534067e-02f, -2.578896098e-02f, 1.114560664e-02f, 7.572305948e-02f, 6.548651308e-02f, 6.714479625e-02f, 8.882819116e-02f,
+    5.262054130e-02f, 6.118838862e-02f, -1.771683991e-02f, -3.626818582e-02f, -7.996254414e-02f, -5.454090238e-02f, -2.792419121e-02f, -5.112886056e-02f,
+    7.440465689e-02f, 6.426488608e-02f, -6.828149408e-02f, 3.440331295e-02f, 1.149953436e-02f, 1.038195863e-01f, -6.548207253e-02f, -8.885551244e-03f,
+    -1.255756319e-01f, -1.415140033e-01f, -8.328657597e-03f, 2.979867160e-02f, 2.318010479e-02f, -1.986980438e-02f, -1.480181515e-02f, -1.758277230e-02f,
+    2.284263074e-02f, -5.478776246e-02f, 3.512607887e-02f, -6.351196766e-02f, -5.060682446e-02f, 8.557631075e-02f, -3.109470010e-02f, 1.523964200e-02f,
+    -7.315050811e-02f, -3.223738819e-02f, -8.656217903e-02f, -3.512094915e-02f, -3.944987804e-02f, -5.070217699e-02f, 5.063319951e-02f, 2.764381841e-02f,
+    5.500676110e-02f, 1.518141478e-02f, -2.283601649e-02f, 1.864218339e-02f, -7.106153667e-02f, -4.058417678e-02f, 2.774896100e-02f, 3.066839650e-02f,
+    -2.158253826e-02f, -2.534229681e-02f, 8.199461550e-02f, 4.865643010e-02f, -1.081929635e-02f, -4.895298183e-02f, -3.293015808e-02f, 1.584319398e-02f,
+    -7.983079553e-02f, 3.773577139e-02f, 2.781028487e-02f, 9.085353464e-02f, 4.356442392e-02f, -6.333217025e-03f, -4.095524922e-02f, 8.729059249e-03f,
+    7.712273300e-02f, -2.874330245e-02f, 1.562888920e-02f, -7.530583441e-02f, -5.078070611e-02f, 9.123175591e-02f, 5.582256243e-02f, -2.891015634e-02f,
+    -6.107043847e-02f, -2.653557062e-02f, -4.954130203e-02f, -8.217117749e-03f, -6.663348904e-05f, -2.799735218e-02f, -4.262324423e-02f, -3.247408196e-02f,
+    -5.313611776e-02f, 2.141335420e-02f, -7.605007291e-02f, 4.843438417e-02f, -1.181056723e-01f, -5.655811168e-03f, 6.598618627e-02f, -6.117376499e-03f,
+    -1.797921211e-02f, -3.879644722e-02f, -6.642513722e-02f, -3.923392668e-02f, -1.047068685e-01f, 5.239984021e-02f, 2.880205587e-02f, 6.369386613e-02f,
+    -1.056174934e-02f, 7.249781489e-02f, 5.191532895e-02f, 6.890004128e-02f, 6.716194004e-02f, 4.131640121e-02f, 6.464052014e-03f, -2.390010655e-02f,
+    -1.624377631e-02f, -1.816466078e-02f, -2.006190456e-02f, -6.768868864e-02f, 5.742707476e-02f, 2.149279416e-02f, -4.017896019e-03f, 4.953165539e-03f,
+    -4.863962531e-02f, -6.514883041e-02f, 3.638870269e-02f, 3.045432270e-02f, -4.366497695e-02f, -5.590689182e-02f, 4.222915694e-02f, 8.564559743e-03f,
+    1.654780656e-02f, -1.495342003e-03f, -1.559089404e-02f, 4.948418587e-02f, 4.882913083e-02f, -2.202049457e-02f, 1.031223219e-02f, -3.664684668e-02f,
+    8.638317883e-02f, -2.227559313e-02f, -1.686584577e-02f, -1.624710485e-02f, -1.168944221e-02f, -4.401773959e-02f, 4.925544560e-02f, -6.940955669e-02f,
+    -3.445706796e-03f, -4.952192307e-02f, 2.101692371e-02f, -3.232310712e-02f, 1.650933363e-02f, -7.939916104e-02f, -2.003471740e-02f, -4.240400344e-02f,
+    -3.994658217e-02f, 7.274073362e-02f, 6.869754195e-02f, -6.931556016e-02f, -7.460587472e-02f, 3.058541380e-02f, -9.327818640e-03f, 7.055295259e-02f,
+    -5.267991498e-02f, -5.408137664e-02f, 7.775886357e-02f, -4.592031986e-02f, 3.266537935e-02f, 5.211232975e-02f, -2.763290145e-02f, -5.732568726e-02f,
+    -3.754640231e-03f, 5.107853794e-04f, 1.605321304e-03f, -3.507762775e-02f, 1.280547678e-02f, -3.190397471e-02f, -7.299495488e-02f, -2.326027676e-02f,
+    -7.693495601e-02f, -9.868350811e-03f, 9.006498381e-03f, 3.633584827e-02f, 7.401521504e-02f, -4.369196296e-02f, 3.568492457e-02f, -6.963163614e-02f,
+    -9.232621640e-02f, 5.205980688e-02f, -7.408081740e-02f, 7.773143798e-02f, -4.925327003e-02f, 6.431216747e-02f, -4.541853070e-02f, 2.333696559e-02f,
+    2.574293502e-02f, 7.414646447e-02f, 6.491886079e-02f, 4.789312184e-02f, 2.609101357e-03f, -6.793237757e-03f, -8.950658143e-03f, -2.883478533e-03f,
+    1.139670145e-02f, 8.152384311e-03f, 5.035315454e-02f, 3.691811860e-02f, -9.092961252e-02f, 3.799904138e-02f, -8.008426428e-02f, -7.492229342e-03f,
+    1.958289742e-02f, -3.327307478e-02f, 7.977147400e-02f, 6.768863648e-03f, -3.872371837e-02f, -1.049249396e-01f, 4.045420140e-02f, 7.274944335e-02f,
+    7.198246568e-02f, 2.061701752e-02f, -1.018631160e-01f, 1.410914864e-02f, -1.252165530e-02f, -1.816989481e-02f, -1.245240215e-02f, 1.274207328e-02f,
+    -6.541399285e-03f, 3.140295297e-02f, -4.559277557e-03f, 2.418655716e-02f, -1.066271365e-01f, 2.329841722e-03f, 2.748826705e-02f, -1.121877730e-01f,
+    -5.823153257e-02f, 3.876945376e-02f, -6.825447828e-02f, 3.869172931e-02f, 3.804184496e-03f, -3.960537910e-02f, 2.773143351e-03f, 4.312163219e-02f,
+    -6.254340708e-02f, 2.081573568e-02f, 7.550378144e-02f, -2.411288954e-02f, 2.370751649e-02f, -3.378954902e-02f, -9.023572505e-02f, -5.535368994e-02f,
+    -4.910943285e-02f, -4.106084257e-02f, -3.818370774e-02f, -1.470701396e-02f, 1.127630100e-02f, 5.322179291e-03f, -8.087530732e-02f, -7.306805998e-02f,
+    2.990616858e-02f, -7.415624708e-02f, -6.649664789e-02f, -7.552722842e-02f, -6.243809313e-02f, 3.529660031e-02f, -4.474982619e-02f, -5.629725382e-02f,
+    6.973475218e-03f, 6.450521946e-02f, 6.855981052e-02f, -1.341188699e-02f, -4.876416177e-02f, -1.460000314e-02f, -7.973158360e-02f, -8.078684658e-02f,
+    -2.847524174e-02f, -8.809775859e-02f, 3.783049062e-02f, 1.731218398e-02f, -6.555343419e-02f, -9.274847806e-02f, -8.928778023e-02f, -5.212756619e-02f,
+    8.567374945e-02f, 9.208400548e-02f, 2.118236199e-02f, -6.474787369e-03f, -9.738819301e-02f, -1.029803082e-01f, -9.302534908e-02f, -1.469238102e-02f,
+    -3.005319834e-02f, 5.021762848e-02f, -5.386270955e-02f, -5.722351372e-03f, 5.183674395e-03f, -3.340920433e-02f, 2.822463959e-02f, -3.498222679e-02f,
+    3.942050040e-03f, 1.431871206e-02f, 6.907661259e-02f, -6.943526119e-02f, 1.119667897e-03f, 4.683689401e-02f, 6.888107955e-02f, 7.572256774e-02f,
+    1.394495927e-02f, -6.280654669e-02f, -3.844909370e-02f, 2.154455148e-02f, 4.471376166e-02f, 2.820021659e-02f, 5.637054145e-02f, -8.287314326e-02f,
+    -2.057118341e-03f, -4.937427863e-02f, 1.507068425e-02f, 3.291042149e-02f, 8.659489453e-02f, 6.457693875e-02f, -6.589548290e-02f, -1.101896912e-02f,
+    2.783859521e-02f, 5.453947186e-02f, -3.301182017e-02f, -1.469574124e-02f, -2.769909799e-02f, -4.296454787e-02f, -4.529401660e-02f, 2.682381868e-02f,
+    -2.847511694e-02f, 3.150477260e-02f, 6.952096522e-02f, 7.635390759e-02f, -8.284311742e-02f, 5.454936624e-02f, -4.583868012e-02f, -4.107578099e-02f,
+    -5.696113780e-02f, 4.322107136e-02f, 5.737736821e-02f, -4.549093544e-03f, 6.612853706e-02f, -8.611783385e-02f, -1.885107905e-02f, 4.599514604e-02f,
+    4.381857812e-02f, 8.612938225e-03f, 5.307531357e-02f, 4.100537300e-02f, 5.972824991e-02f, -8.075542748e-03f, 6.194747984e-02f, -1.142261177e-02f,
+    -1.136550307e-02f, -9.079572558e-02f, 5.494033173e-02f, 5.428305641e-02f, -8.232470602e-02f, -2.313203923e-02f, -5.980451778e-02f, 2.221603692e-02f,
+    -7.802080363e-02f, -2.633386850e-02f, -5.013486836e-03f, -5.348739773e-02f, -5.155038834e-02f, -5.037045479e-02f, 5.288728699e-02f, 2.611261047e-02f,
+    -3.200444207e-02f, 7.577389479e-02f, -8.075343072e-02f, 7.041932642e-02f, -2.760389075e-02f, -2.420489490e-02f, 3.146198392e-02f, 3.740590811e-02f,
+    7.486259937e-02f, 6.501489878e-02f, -6.007098407e-02f, 6.135021150e-02f, 3.510446101e-02f, 3.711894527e-02f, -1.960683800e-02f, 6.577418000e-02f,
+    -1.028660014e-01f, -7.741195709e-02f, -2.446185611e-02f, -3.665406257e-02f, -3.034931608e-02f, 5.932780728e-02f, -4.049403965e-02f, -5.805275217e-02f,
+    -4.495421052e-02f, 4.656119272e-02f, -5.365250632e-02f, -5.292347074e-02f, -8.297523856e-02f, -5.228983611e-02f, -1.807952113e-02f, -1.819165237e-02f,
+    2.560240775e-02f, -7.808261365e-02f, -5.875721574e-02f, -6.097146869e-02f, -6.346907467e-02f, -1.423583180e-02f, 3.397288918e-02f, -1.908443868e-02f,
+    -6.406138837e-02f, -6.974168122e-02f, 1.541734301e-02f, -1.309523359e-03f, -8.803559095e-02f, -1.230226159e-01f, -8.771616966e-02f, -3.858464211e-02f,
+    -9.807646275e-02f, -1.214318573e-01f, 2.927677473e-03f, -1.560541056e-02f, 3.302728385e-02f, -8.966650814e-02f, -6.064661592e-02f, 2.241541445e-02f,
+    -4.457742721e-02f, 1.243211678e-03f, 8.778355271e-02f, -2.384471707e-02f, 1.460820436e-03f, -5.464263260e-02f, 9.042844176e-04f, -5.628949031e-02f,
+    4.110966623e-02f, -1.084418595e-02f, 8.536937833e-02f, 1.512238756e-03f, -1.962215826e-02f, -2.642158233e-02f, 2.845964395e-02f, -7.961649448e-02f,
+    1.664047129e-02f, 1.207663119e-02f, -6.757219881e-02f, -2.003691159e-02f, -2.273387834e-02f, 1.128629129e-02f, -7.490541786e-02f, -8.620882034e-02f,
+    4.296253249e-02f, -3.079524823e-02f, -4.657880217e-02f, 9.594736621e-03f, -8.936220407e-02f, 2.635939792e-02f, 1.765615866e-02f, -8.339091390e-02f,
+    2.483403683e-02f, 4.434416071e-02f, -3.128213808e-02f, -6.824709475e-03f, -2.220535278e-02f, -1.702663302e-02f, -5.789181218e-02f, -5.310318992e-02f,
+    4.414268956e-02f, 5.254046991e-02f, -1.058807131e-02f, -6.544159353e-02f, 8.896675354e-06f, -6.793738902e-02f, 2.021961473e-02f, -4.115978722e-03f,
+    -7.381197065e-03f, 3.103051335e-02f, -1.344558597e-01f, 4.682062566e-02f, 1.367296092e-02f, 4.207892343e-02f, -4.028096423e-02f, 3.616425395e-02f,
+    6.598424166e-02f, 3.206348047e-02f, 4.319404066e-02f, 3.533458337e-02f, 5.116847530e-02f, -4.632889479e-02f, -8.304435015e-02f, 1.596286893e-02f,
+    3.490215540e-02f, -4.488840699e-03f, -1.050374657e-02f, 7.779487967e-02f, -4.176982865e-02f, 3.121635132e-02f, 2.560106479e-02f, 9.150771797e-02f,
+    4.352258891e-02f, 3.752861172e-03f, -2.155818045e-02f, -4.745526612e-02f, -1.065216586e-01f, -5.250225216e-02f, -7.506233454e-02f, -3.915650770e-02f,
+    -2.922783233e-02f, 1.583332196e-02f, -5.436306819e-02f, 9.978850721e-05f, -5.321291089e-02f, 5.365409330e-02f, 1.139894873e-02f, 5.614008009e-02f,
+    -4.851002991e-02f, 4.051360115e-02f, -2.900985628e-02f, 7.674902678e-02f, -3.919560835e-02f, 2.613772452e-02f, -7.257763296e-02f, 1.039774064e-02f,
+    -5.464436114e-02f, -4.272701591e-02f, 1.522346772e-02f, 1.283201575e-02f, 5.408048630e-02f, -3.612551093e-02f, -5.745310709e-02f, -1.689268090e-02f,
+    -5.521007627e-02f, 2.135287737e-03f, -7.844030857e-02f, -6.744857132e-02f, -9.504332393e-02f, -3.329373151e-02f, 5.674862117e-02f, -3.755705059e-02f,
+    6.405947357e-02f, 8.840151876e-02f, -1.023419760e-02f, 7.555847615e-02f, -4.903413728e-02f, -5.234551802e-02f, -4.045770690e-02f, 4.990716279e-02f,
+    5.904404819e-02f, -4.492715374e-02f, 4.426513985e-02f, 4.208859429e-02f, 3.101387247e-02f, 3.809173778e-02f, 7.598071359e-03f, -3.240640089e-02f,
+    4.293645173e-02f, -4.548145458e-02f, 2.492831089e-02f, -7.382688671e-02f, -5.683372729e-03f, -6.411170959e-02f, -1.046938300e-01f, -8.570994437e-02f,
+    -4.581254348e-02f, -5.406019464e-02f, 1.870285370e-03f, -4.286529031e-03f, -5.079096183e-02f, 2.198498137e-02f, 3.692778572e-02f, 4.179493710e-02f,
+    1.870221272e-02f, -7.662252337e-02f, 2.886017039e-02f, -1.010533422e-02f, -1.772675663e-02f, 1.267537102e-02f, 6.441156147e-04f, -7.023409009e-02f,
+    -3.844993189e-02f, 2.603106946e-02f, -5.093354359e-02f, 8.162348531e-03f, 1.332914550e-02f, 3.386031464e-02f, -5.563193187e-02f, 3.781012027e-03f,
+    1.083925832e-02f, -8.045344800e-02f, -7.557701319e-03f, -4.113837704e-02f, -2.203534730e-02f, 2.540328540e-02f, -4.685605690e-02f, 2.399598435e-02f,
+    6.858584005e-03f, -4.116802011e-03f, -2.633425174e-03f, -7.706919312e-02f, -8.783885278e-03f, -3.878670558e-02f, -1.785014383e-02f, -2.154310048e-02f,
+    6.523537636e-02f, 7.312573493e-02f, 1.009662151e-01f, -1.264817715e-01f, -6.831342727e-02f, 1.765590347e-02f, -1.689909957e-02f, -4.505792260e-02f,
+    -7.165122777e-02f, -4.627420381e-02f, -5.116702057e-03f, 1.037421403e-03f, -6.581703573e-02f, -8.175199851e-03f, -8.711889386e-02f, -5.223137140e-02f,
+    -4.164271802e-02f, 4.382152110e-02f, 1.994913071e-02f, -1.453506947e-02f, -6.401969492e-02f, -2.701173536e-02f, -1.572692883e-03f, -6.846124679e-02f,
+    -2.369425073e-02f, -8.901298977e-03f, 9.534252435e-02f, -6.191970408e-02f, 4.020218551e-02f, 6.613554060e-02f, 2.151124366e-02f, -8.663538098e-02f,
+    5.852229893e-02f, 2.808672376e-02f, -5.486569554e-02f, 3.313360363e-02f, 3.083531745e-03f, 8.745631203e-03f, 6.132773310e-02f, -4.866876826e-02f,
+    3.973553702e-02f, -5.911528692e-02f, 3.507587686e-02f, -2.026749402e-02f, 5.417193845e-02f, -3.893200541e-03f, 4.064272717e-02f, 5.343266577e-02f,
+    1.155023184e-02f, -3.723390773e-02f, -6.278648227e-02f, 2.047071606e-02f, 1.000574455e-01f, 1.005631611e-01f, -1.647648215e-02f, 5.526554957e-02f,
+    6.861141324e-02f, 8.080129325e-02f, -2.641588263e-02f, -1.190941706e-01f, -2.254269831e-02f, -8.086265624e-02f, -3.135395423e-02f, 3.275487572e-02f,
+    1.398904994e-02f, 4.384024441e-02f, 3.546344116e-02f, 6.856274605e-02f, -1.012779698e-01f, -1.295337826e-01f, 4.235609993e-02f, -7.820959389e-02f,
+    -3.390128538e-02f, -1.887616515e-02f, -5.723781139e-02f, -6.976668537e-02f, -6.418033689e-02f, 3.832267364e-03f, -2.531800047e-02f, -7.345045358e-02f,
+    5.979262665e-02f, 1.078350991e-01f, -4.489142820e-02f, 3.581604362e-02f, 3.697067499e-02f, -3.651025891e-02f, -5.846011266e-02f, 2.693813667e-02f,
+    6.620768458e-02f, -6.777071860e-03f, -2.109905332e-02f, 9.688468650e-03f, 4.373145476e-02f, -1.198525773e-03f, 5.671661347e-02f, 6.556961685e-02f,
+    -1.176564489e-02f, 2.019417286e-02f, -1.599627174e-02f, 1.679714210e-02f, -2.771905623e-02f, 7.698463649e-02f, 3.092889441e-03f, -2.030018531e-02f,
+    6.403893977e-02f, 4.831593484e-03f, -6.985978782e-02f, -2.987740934e-02f, -1.183016077e-01f, 8.444553614e-02f, 5.424831761e-04f, -8.035489172e-02f,
+    -1.853507012e-02f, 3.107969463e-02f, -1.113500670e-01f, 3.019295447e-02f, 1.741562597e-02f, 3.042783588e-02f, -1.923398860e-02f, 7.822187245e-02f,
+    -1.265168656e-02f, 7.223010808e-02f, 4.250846803e-02f, 9.522040933e-02f, -3.165066615e-02f, -4.908977076e-02f, -2.650738135e-02f, 2.085541189e-02f,
+    1.683810353e-02f, 3.942832351e-02f, -5.058464408e-02f, 8.341631852e-03f, 3.874609247e-02f, -3.429118916e-02f, -2.615314163e-02f, -7.443332672e-02f,
+    -5.083781853e-02f, 3.971037269e-02f, 9.594555944e-02f, -3.929487988e-02f, 5.803582072e-02f, -1.769910753e-02f, -5.880776048e-02f, 8.746507019e-02f,
+    5.723197386e-02f, -1.461807842e-04f, -1.992986538e-02f, 7.050886750e-02f, -3.365692217e-03f, 4.794913158e-02f, 7.378505170e-02f, -3.297226876e-02f,
+    5.105042364e-03f, 3.903174773e-02f, 4.297650233e-02f, -7.231450081e-02f, 7.305197418e-02f, 2.863314003e-02f, 9.734115750e-02f, 6.856013834e-02f,
+    1.009349972e-01f, 7.018403709e-02f, 3.589818627e-02f, -7.555764914e-02f, -7.027000934e-02f, 2.422726154e-02f, 1.172417104e-01f, -1.396821905e-02f,
+    2.960514277e-02f, -8.804410696e-03f, 4.441125691e-02f, 2.118057944e-02f, 5.464224145e-02f, -6.364797056e-02f, 7.625095546e-02f, 5.294628441e-02f,
+    3.824489191e-02f, 8.339513093e-02f, -3.641040251e-02f, 8.888081647e-03f, -1.363175735e-02f, -3.637382388e-02f, -3.065454029e-02f, 6.495956331e-02f,
+    -8.322776295e-03f, -2.206251211e-02f, -2.328426018e-02f, 2.536799759e-02f, 7.390853018e-02f, -5.836470798e-02f, 2.906144783e-02f, 7.491045445e-02f,
+    5.676437169e-02f, 4.357209429e-02f, -1.519397087e-02f, 3.517809510e-02f, -7.205176353e-02f, 6.981241703e-02f, -8.527883142e-02f, -2.830582112e-02f,
+    -4.820490628e-02f, 3.173149377e-02f, 5.001999810e-02f, -4.643127322e-02f, 2.729645371e-02f, 8.648579940e-03f, -3.842636198e-02f, -1.933553629e-02f,
+    -3.376776725e-02f, -2.244447917e-02f, 9.983757138e-02f, 2.659099549e-02f, 7.248996198e-02f, 3.687486425e-02f, -3.825093061e-02f, 6.782017648e-02f,
+    3.161171451e-02f, -7.380831987e-02f, -1.900398731e-02f, -4.093692452e-02f, -3.997656330e-02f, 6.295320392e-02f, 1.597587392e-02f, -7.208652794e-02f,
+    -2.522697300e-02f, -3.979265317e-02f, -7.621970773e-02f, -6.207298860e-02f, 8.955781907e-02f, -5.154607818e-02f, 4.377731308e-02f, 6.353982026e-04f,
+    2.649979852e-02f, -5.388698727e-02f, 5.131724849e-02f, -5.184165016e-02f, 1.936709322e-02f, -1.886811480e-02f, 5.800860375e-02f, -3.071264364e-02f,
+    3.923241422e-02f, 4.253814369e-02f, 1.732636988e-02f, -2.506889217e-02f, -1.204443071e-02f, 3.557420895e-02f, -6.857238710e-02f, 2.179388143e-02f,
+    -6.798356771e-02f, -9.111075848e-02f, 2.819339558e-02f, 1.531536970e-02f, -5.882374197e-02f, 5.577613413e-02f, 3.040078655e-02f, 3.277091309e-02f,
+    5.710283667e-02f, -4.333950579e-02f, -1.081874445e-01f, -2.633675747e-02f, -3.893748671e-02f, 1.464828290e-02f, -1.270362884e-01f, -4.628768563e-02f,
+    -7.696431130e-02f, 6.581617892e-02f, -3.576863185e-02f, -3.861340880e-02f, 3.366007470e-03f, 5.489210784e-02f, -1.086030826e-01f, -2.748843050e-03f,
+    -5.927918851e-02f, -5.917201936e-02f, -3.017651290e-02f, 9.130611271e-02f, 3.468666598e-02f, 3.381771222e-02f, -7.101757079e-02f, -4.935606197e-02f,
+    8.055067062e-02f, -4.612064362e-02f, -5.109670106e-03f, -2.936097980e-02f, 1.498714276e-02f, 2.649987489e-02f, 4.680094123e-02f, -1.795271225e-02f,
+    -1.613622606e-01f, 8.850047365e-03f, 2.903988026e-02f, -5.849808827e-02f, -4.175995011e-03f, 3.734595701e-02f, -3.244742379e-02f, -1.216623187e-02f,
+    4.584677145e-02f, 2.740815398e-04f, 4.823677614e-02f, -1.282786578e-01f, -7.140944153e-02f, -2.130172774e-02f, 4.603377730e-02f, 4.626991600e-02f,
+    6.003660709e-02f, 9.334523231e-02f, -2.748472802e-02f, -4.009064287e-02f, -1.115623862e-02f, -3.254070133e-02f, 1.708140597e-02f, -4.096101597e-02f,
+    -3.102700785e-02f, 2.729544975e-02f, -3.588001942e-03f, -9.932964295e-02f, -4.841280356e-02f, 8.038996719e-03f, -8.464597166e-02f, -1.899108291e-02f,
+    6.913118064e-02f, 3.526185080e-02f, 5.908348039e-02f, -4.331805184e-02f, 1.486233622e-02f, 5.660435930e-02f, -1.705118269e-02f, -4.617017880e-02f,
+    5.815238133e-02f, -5.267135426e-02f, 4.356486723e-03f, -2.948153764e-02f, -5.981510505e-02f, 2.887492068e-02f, 8.495675027e-02f, -1.824302971e-02f,
+    -7.411252707e-02f, 5.665279925e-02f, 6.491577625e-02f, -1.022936925e-01f, -1.246421016e-03f, 2.079494484e-02f, -3.764772788e-02f, -3.660374880e-02f,
+    -1.249009185e-02f, -6.651934236e-02f, -5.729652941e-02f, -5.506182835e-02f, -7.235150784e-02f, -9.989260137e-02f, 2.768640220e-02f, -4.806441441e-02f,
+    -5.725190416e-02f, -1.021570563e-01f, 4.302562028e-02f, 6.632637233e-03f, 5.477709323e-02f, -3.129160032e-02f, 2.301761694e-02f, 2.727246657e-02f,
+    -1.996456832e-02f, -8.235787600e-02f, 5.080090463e-02f, 6.617951393e-02f, -7.831855863e-02f, -1.042074710e-02f, -3.401714144e-03f, 3.504970670e-02f,
+    1.029292941e-01f, -2.897241339e-02f, -6.113380194e-03f, 1.849117130e-02f, 2.079772949e-02f, 7.553295791e-02f, -6.604489684e-02f, -7.200770825e-02f,
+    -4.290356115e-02f, -3.972082585e-02f, 1.478765346e-02f, 2.743283985e-04f, -3.606172651e-02f, 5.610527843e-02f, 1.372553501e-02f, -6.225652620e-02f,
+    -2.017597202e-03f, 1.222837716e-01f, 3.765043616e-02f, 4.642182961e-02f, -3.336470202e-02f, -6.421636790e-02f, 1.161180437e-03f, 3.605813533e-02f,
+    -3.740588948e-02f, 8.479647338e-02f, -7.739399374e-02f, 4.887770116e-02f, -4.539949819e-02f, 1.327634323e-02f, -8.564240416e-04f, -4.432821274e-02f,
+    -5.581599101e-02f, 2.065090090e-02f, -3.829722479e-02f, 1.382596046e-02f, 6.898086285e-04f, -4.743220657e-02f, 3.087332845e-02f, -7.121101022e-03f,
+    4.177308083e-02f, -3.875987232e-02f, -4.722321033e-02f, 6.722008437e-02f, -2.533711120e-02f, 7.146085054e-02f, -2.630615979e-02f, 1.260513626e-02f,
+    -6.754935533e-02f, 4.232469201e-02f, -4.397165775e-02f, 4.949764907e-02f, -2.161130309e-03f, 4.692883790e-02f, 7.178328931e-02f, 6.598421931e-02f,
+    -3.733351827e-02f, 6.165243685e-03f, -1.608267426e-03f, 2.556656860e-02f, -2.354241908e-02f, 4.814799130e-02f, 3.679630905e-02f, 1.281130221e-02f,
+    6.657804828e-03f, -1.252160370e-01f, -9.068757296e-03f, -7.087135315e-02f, -3.226707131e-02f, -4.706899449e-02f, -2.784088254e-02f, 6.377816945e-02f,
+    -3.520304710e-02f, 5.620096251e-02f, 3.119525872e-02f, 7.999879122e-02f, -4.307474941e-02f, 4.212582111e-02f, -8.532694727e-02f, -1.024842262e-02f,
+    -4.208840430e-03f, -8.107431233e-02f, 4.431457818e-02f, -6.635957956e-02f, 4.358033836e-02f, -7.194043696e-02f, 3.370529413e-02f, 4.637050629e-02f,
+    -6.539932638e-02f, -1.105861738e-01f, -4.967947677e-02f, -1.302600931e-02f, -8.654821664e-02f, -3.401945159e-02f, -4.456337914e-02f, -7.994861156e-02f,
+    2.010976337e-02f, -7.983441651e-02f, -1.460694335e-02f, -1.104955841e-02f, -4.987168312e-02f, -7.146002352e-02f, -4.026104510e-02f, 2.480330318e-02f,
+    4.793615639e-02f, 9.522221982e-03f, 2.489446104e-02f, 5.700427294e-02f, -5.445079505e-02f, -7.258963585e-02f, 2.689868957e-02f, -7.050451636e-02f,
+    7.224568725e-02f, 4.084286094e-02f, -1.857171953e-02f, 3.213293850e-03f, 8.705921471e-03f, 8.441646397e-02f, -6.796536595e-02f, -2.726510540e-02f,
+    -4.418542236e-02f, -4.136331379e-02f, 3.762880340e-03f, -1.050634310e-01f, -9.928563982e-02f, -5.977457017e-02f, 1.943489350e-02f, -3.028966300e-02f,
+    2.504595369e-02f, 5.123071373e-02f, 4.226668179e-02f, -2.403923869e-02f, 5.299049616e-02f, 7.738275826e-02f, -4.972570390e-02f, 2.279140055e-02f,
+    3.660568595e-02f, 2.869629860e-02f, 5.396842957e-02f, 6.567907333e-02f, -7.097969949e-02f, -6.345681846e-03f, -8.394052088e-02f, 4.272694886e-02f,
+    6.755119562e-02f, 5.620998144e-02f, 8.525100350e-02f, 5.332960188e-02f, 2.375213057e-02f, -5.668485165e-02f, -4.166407511e-02f, 6.771293283e-02f,
+    8.464586735e-02f, -6.557296216e-02f, -3.541371971e-02f, -2.597737312e-02f, -4.929976538e-02f, 5.019100010e-02f, 8.459243178e-02f, -7.002088428e-02f,
+    8.000151813e-02f, -1.282799244e-02f, 4.332864285e-02f, -5.347034335e-02f, -4.719771072e-02f, 3.817245364e-02f, -6.117773801e-02f, -6.191052496e-02f,
+    7.705643773e-03f, 6.102807820e-02f, -3.426004946e-02f, 7.425116748e-02f, 4.239454865e-02f, -5.842903629e-02f, 4.407645389e-02f, -2.286674082e-02f,
+    -4.038218874e-03f, -4.907277972e-02f, 4.392668232e-02f, -3.286007792e-02f, -3.533032909e-02f, 3.314940259e-02f, 3.598669916e-02f, 4.700533673e-02f,
+    3.726609051e-03f, 4.773534834e-03f, 4.667833447e-03f, -2.401260287e-02f, -1.287981868e-03f, 5.043998361e-03f, 1.485250145e-02f, -4.965463653e-02f,
+    4.245890677e-02f, -1.524416357e-02f, 6.601439416e-02f, 8.565254509e-02f, 5.921681225e-02f, 2.538171597e-02f, 5.806776881e-02f, -7.039238513e-02f,
+    -1.647209562e-02f, 3.920957446e-02f, 3.786724061e-02f, 1.465853676e-02f, -9.881448001e-02f, -5.788419396e-02f, 4.254945740e-02f, -2.230400059e-05f,
+    7.842806727e-02f, 5.646218732e-02f, 3.371895105e-02f, -6.694232579e-03f, 3.077296540e-02f, -1.224284898e-02f, 7.681556791e-02f, -8.811499178e-02f,
+    8.495491743e-02f, 7.336412370e-02f, -5.476210266e-02f, 3.329376131e-02f, -2.029858530e-02f, 4.924215376e-02f, -8.325606585e-03f, -6.742662936e-02f,
+    -5.434289202e-02f, 2.871336602e-02f, -5.880906433e-02f, -1.133490168e-02f, -6.851927191e-02f, 3.600852564e-03f, -7.471843623e-03f, -7.079404593e-02f,
+    2.821729146e-02f, -2.455494553e-02f, -3.112400323e-02f, 2.042471431e-02f, -7.680548728e-02f, -7.230085135e-02f, -5.207340047e-02f, -5.742582679e-02f,
+    -2.504224516e-02f, 4.594511539e-02f, -4.415890947e-02f, -5.246539414e-02f, 3.182871640e-02f, -8.668400347e-02f, -1.963681728e-02f, -6.842568517e-03f,
+    1.063356549e-02f, 3.160323948e-02f, -8.403762430e-02f, -7.282697596e-03f, -3.003149759e-04f, -4.850406572e-02f, -4.099912569e-02f, -7.250297070e-02f,
+    3.369482607e-02f, -2.361639403e-02f, -4.151068628e-03f, 5.891516805e-02f, 3.287123144e-02f, -9.576752037e-02f, -1.297960803e-02f, -7.001199573e-02f,
+    5.091950297e-02f, -1.035399884e-01f, -8.189364523e-02f, 4.487533006e-04f, -8.334414661e-02f, -3.046719357e-04f, -4.040141404e-02f, -2.456573024e-02f,
+    -3.212977573e-02f, -1.925713010e-02f, 1.261323225e-02f, -4.926107079e-02f, -4.729339108e-02f, 4.197314382e-03f, -7.020968199e-02f, 9.443888441e-03f,
+    -2.009469643e-02f, 8.204693347e-02f, -7.590539753e-02f, -8.070756681e-03f, -7.703390718e-02f, -2.822955884e-02f, -1.788662374e-02f, -4.548832402e-02f,
+    1.229629107e-02f, -7.570678741e-02f, -5.702367052e-02f, -3.249606118e-02f, 6.358034909e-03f, -2.623027377e-02f, -8.465304971e-02f, 9.003807791e-03f,
+    1.853576303e-02f, -9.270415455e-02f, -7.126830518e-02f, 6.506310403e-02f, 7.439894974e-02f, 4.513950273e-02f, -2.872165293e-02f, 1.520962268e-02f,
+    -3.150726855e-02f, 7.778629661e-02f, -6.459712982e-02f, -8.472895622e-02f, -3.298634663e-02f, -4.657297581e-02f, -8.270157874e-02f, 1.433517970e-02f,
+    8.079674095e-03f, -9.039660543e-02f, 2.953124233e-02f, 2.972125821e-02f, -5.985871702e-02f, -8.594964445e-02f, -9.404218197e-02f, -3.411586955e-02f,
+    6.755114533e-03f, 3.504064307e-02f, -3.905208781e-02f, 2.458946221e-02f, 3.775421903e-02f, 5.594375730e-02f, 6.428088993e-02f, -4.923971742e-02f,
+    -4.948681965e-02f, -5.949621648e-02f, -2.963876911e-02f, -7.924240083e-02f, -6.295110285e-02f, 6.115012243e-02f, 2.713943087e-02f, 5.526686087e-02f,
+    5.805788189e-02f, -2.173648961e-02f, 6.316666305e-02f, 4.088706151e-02f, 6.413628161e-02f, 3.745556250e-02f, 5.081556737e-02f, 3.197842091e-02f,
+    1.966058649e-02f, 5.117319897e-02f, -9.658037126e-02f, 1.503755059e-02f, 2.625545673e-02f, 4.409703240e-02f, 2.868285403e-02f, 1.315048430e-02f,
+    4.045068473e-02f, -2.635487355e-02f, -1.448461134e-02f, -6.851898879e-02f, -8.035378903e-02f, 2.900005504e-02f, 6.578974426e-02f, 4.376667365e-02f,
+    -3.403200209e-02f, -4.003141820e-02f, 3.963559493e-02f, 7.689745724e-02f, -4.335809499e-02f, -5.599668622e-02f, 1.597471721e-02f, -8.345086873e-02f,
+    3.685886040e-02f, -2.929973602e-02f, -3.206655756e-02f, 1.225189958e-02f, 6.090937555e-02f, -4.264006019e-02f, 1.692216285e-02f, 2.977600088e-03f,
+    -2.694861777e-02f, -2.709189989e-02f, -1.053315252e-01f, -9.506894648e-02f, -2.541899495e-02f, 3.894870356e-02f, 8.293026127e-03f, 2.156384662e-02f,
+    5.229677260e-02f, 1.083331928e-02f, -5.006074905e-02f, -7.054149359e-02f, 1.368427277e-02f, -9.336516261e-03f, -3.849056363e-02f, -1.428380347e-04f,
+    -3.928251390e-04f, -4.401427135e-02f, 6.882689148e-02f, 2.267857455e-02f, 3.703479469e-02f, 2.962287399e-04f, -3.563240916e-02f, -8.775676042e-02f,
+    -9.740092605e-02f, 1.891074330e-02f, -4.495656118e-02f, 5.916387588e-02f, -1.302786544e-02f, 1.718920772e-03f, -1.026208848e-01f, 7.580602076e-03f,
+    -4.931537434e-03f, -9.761448018e-03f, -1.131876372e-02f, 2.751885168e-02f, 4.847939685e-02f, -6.804470718e-02f, 7.760316879e-02f, -5.081363767e-02f,
+    -2.303297818e-02f, 2.298720181e-02f, 4.736344889e-02f, -8.222550154e-02f, 6.774470210e-02f, -8.624827862e-02f, 5.889577046e-02f, 1.137260534e-02f,
+    -8.028065413e-02f, 5.501956120e-02f, 1.111975778e-02f, 2.379290760e-02f, -7.965473831e-02f, 3.656798974e-02f, -3.010784276e-02f, -5.088236555e-02f,
+    -7.155369967e-02f, -1.277223136e-02f, -3.969061654e-03f, -9.811688215e-03f, -8.486629277e-02f, 1.851495169e-02f, -7.582064718e-02f, 4.459544644e-02f,
+    -3.610996902e-02f, 4.303728044e-02f, 1.378298737e-02f, -3.559358651e-03f, 3.574034572e-02f, -1.169229671e-02f, 5.052882060e-02f, -6.230939180e-02f,
+    3.221393796e-03f, 5.229357630e-03f, -1.857514493e-02f, -5.147016048e-02f, -2.774374373e-02f, 8.255377412e-03f, -8.049131371e-03f, 4.804666340e-02f,
+    -7.674741000e-02f, 1.351882238e-02f, -8.841095120e-02f, -7.815428078e-02f, 3.922292963e-02f, -1.059726104e-01f, -9.750576317e-02f, -5.222603213e-03f,
+    -2.435276657e-02f, -1.740604267e-02f, -5.895249173e-02f, 5.498797633e-03f, 2.829196677e-02f, -2.602209151e-02f, 2.445026860e-02f, -1.828449965e-02f,
+    2.071110159e-02f, 2.088541910e-02f, 1.937049814e-02f, -5.710080639e-02f, -7.556396723e-02f, 7.855652273e-02f, -3.529511392e-02f, 1.877222024e-02f,
+    5.762911960e-02f, 5.522084236e-02f, 6.684257835e-02f, -3.744558245e-02f, -4.897209629e-02f, -5.215419456e-02f, -2.110442892e-02f, -6.595969945e-02f,
+    4.152087122e-02f, 5.324136466e-02f, -1.690679602e-02f, 5.010232702e-02f, -2.730734088e-02f, -3.441568092e-02f, -6.099342927e-02f, -4.320999235e-02f,
+    1.562362909e-02f, -3.515328467e-02f, -3.413860872e-02f, 3.581251204e-02f, 5.814562738e-02f, -7.484944165e-02f, 6.687234342e-02f, 2.022682317e-02f,
+    4.567433521e-02f, -3.794566542e-02f, 6.965496391e-02f, -5.954204500e-02f, -3.457822651e-02f, -1.040930822e-01f, -1.788146608e-02f, -3.092559800e-02f,
+    -1.123329811e-02f, -9.849876910e-02f, 4.741004482e-02f, -1.097635776e-01f, 4.305479303e-02f, 3.725922480e-02f, 4.505340010e-02f, -5.677574128e-02f,
+    6.794296950e-02f, -3.065429255e-02f, -2.503059059e-02f, 7.554993033e-02f, -4.238561913e-02f, 5.997674912e-02f, 7.506199926e-02f, -2.065476030e-02f,
+    -5.219925195e-02f, -3.565952182e-03f, 4.679904506e-02f, 5.633802339e-02f, -6.439565122e-02f, -1.723336242e-02f, -3.356335312e-02f, -8.451534808e-02f,
+    -5.468717217e-02f, 4.194959626e-02f, -3.795566037e-02f, 1.857503504e-02f, -4.559103772e-02f, -1.082012132e-01f, -9.044499695e-02f, 2.956984378e-02f,
+    4.935748503e-02f, -4.597462714e-02f, -2.556039765e-02f, 6.105748937e-02f, -2.010427229e-02f, -6.498385966e-02f, -9.015422314e-02f, 7.382314652e-02f,
+    1.187870838e-02f, 3.390700743e-02f, 9.104978293e-03f, 2.950956672e-02f, 8.497460186e-02f, -1.365786791e-02f, -2.915825229e-03f, -4.299436882e-02f,
+    6.433924288e-02f, -2.367980778e-02f, -4.286652803e-02f, -6.918939948e-02f, 5.896194372e-03f, -4.254168645e-02f, 2.834334411e-02f, 1.383956615e-02f,
+    3.425610438e-02f, 4.754577577e-02f, 3.824876621e-02f, 3.227351606e-02f, 3.304440901e-02f, 6.240142044e-03f, -9.895005263e-03f, -2.919812687e-02f,
+    6.698676944e-02f, -9.301614761e-02f, -3.030459955e-02f, -6.119488552e-02f, -6.252329797e-02f, -6.617467850e-02f, -3.284963965e-02f, -6.822957844e-02f,
+    -7.962437719e-02f, 4.161392152e-02f, -3.591322899e-02f, 5.493282527e-02f, -4.885889217e-02f, -1.845108904e-02f, 1.487495750e-02f, -1.539671794e-02f,
+    -5.520217866e-02f, -6.321681291e-02f, -3.833227232e-02f, -4.167576134e-02f, 5.109961703e-02f, 7.046829443e-03f, 4.081473872e-02f, -4.072151333e-02f,
+    -3.876229376e-02f, -5.547497422e-02f, -1.653510891e-02f, -5.019880086e-02f, 3.897326067e-02f, 5.407017097e-02f, -5.305114761e-02f, -7.170507312e-02f,
+    -7.608397305e-02f, 1.817120798e-02f, -8.312965930e-02f, 7.644995302e-02f, -7.889363170e-02f, 3.428509831e-02f, 4.989519715e-02f, 5.022908747e-02f,
+    5.844554305e-02f, -3.354138136e-02f, 6.485200021e-03f, -7.030145824e-02f, -9.253479540e-02f, 6.804330647e-02f, 7.146077696e-03f, 5.939820036e-02f,
+    -4.892979935e-02f, 4.772601649e-02f, -3.112730011e-02f, 1.310519781e-02f, -3.645600379e-02f, -8.468210697e-02f, -5.473456159e-02f, -7.007735223e-02f,
+    -3.306416422e-02f, -9.285850078e-02f, -8.452882618e-02f, 2.322974615e-02f, -1.356319804e-02f, 2.445960045e-02f, -7.821383327e-02f, 4.983209074e-03f,
+    -7.751670480e-02f, -8.066148311e-02f, -4.323191941e-03f, -6.821689755e-02f, 5.783260986e-02f, 6.145652756e-02f, 2.708359249e-02f, 7.463816553e-02f,
+    -1.268267352e-02f, -3.773621097e-02f, -9.757272154e-02f, -9.793357924e-03f, 1.614314318e-02f, 3.173096478e-02f, -3.664088622e-02f, -7.668837905e-02f,
+    -7.264400274e-02f, -1.256037740e-05f, 3.649978340e-02f, -1.288370509e-02f, 4.832089692e-02f, -1.623870456e-03f, 6.543806195e-02f, -1.361454837e-02f,
+    -3.654418886e-02f, 4.961068276e-03f, -3.069929965e-02f, -1.073884219e-02f, -7.549405843e-02f, -4.067146033e-02f, -4.486540332e-02f, -2.881004661e-02f,
+    2.398803830e-02f, 5.991042033e-02f, -5.524679646e-02f, -6.407029182e-02f, 3.017506376e-02f, 3.248005733e-02f, 2.308116760e-03f, 3.209722415e-02f,
+    4.744279385e-02f, -6.121068075e-02f, 3.915474750e-03f, -8.578611910e-02f, -3.185309842e-02f, 1.474360749e-02f, -8.707828820e-02f, -1.492793113e-02f,
+    -9.720814973e-02f, -8.141064644e-02f, 2.248160914e-02f, -8.922864497e-02f, -5.836871639e-02f, -5.098196561e-04f, 4.083503038e-02f, -7.477343082e-03f,
+    2.025339007e-02f, 1.386735588e-02f, 6.645752117e-03f, 2.197239175e-02f, 5.197701044e-03f, 3.308002278e-02f, -8.944715559e-02f, -3.710022941e-02f,
+    7.498122752e-02f, 4.227253795e-02f, 1.395449042e-02f, 2.745095268e-02f, 4.765632912e-04f, 1.742997579e-02f, -3.733426100e-03f, -5.184457451e-02f,
+    -2.127704397e-02f, 3.086869046e-02f, 2.950006165e-02f, -9.371537715e-02f, 5.598131940e-02f, -9.026697278e-02f, -4.890200496e-02f, -7.008026540e-02f,
+    -7.209566981e-02f, 1.734200493e-02f, -8.583705127e-02f, 5.195866525e-02f, 1.947542280e-02f, -2.829207480e-02f, 3.733684123e-02f, -2.904564701e-02f,
+    -1.805285178e-02f, -5.652150884e-02f, -3.719083220e-02f, -6.584191322e-02f, 7.145736367e-02f, -8.492443711e-02f, 2.313194424e-02f, 2.954751253e-02f,
+    5.451267213e-02f, 3.798239678e-02f, -8.049019426e-02f, -6.270392984e-02f, 1.163764670e-02f, 1.944848895e-02f, 2.287137881e-02f, 3.091497906e-02f,
+    1.061560679e-02f, 4.402198642e-02f, 5.623670667e-02f, -4.158930853e-02f, -6.470867991e-02f, -2.161900513e-02f, -2.085949294e-02f, 9.935982525e-03f,
+    2.596157789e-02f, -7.946305722e-02f, -5.447735637e-02f, 7.679961622e-02f, -7.766719908e-02f, 1.387116127e-02f, -8.947937191e-02f, -4.722744226e-03f,
+    5.238499865e-02f, -4.724373668e-02f, -6.104195863e-02f, 1.900194958e-02f, -9.515487403e-02f, -5.403897539e-02f, -8.454988152e-02f, -5.504028127e-02f,
+    -5.169801041e-02f, 3.301561624e-02f, -9.474182129e-02f, -9.661749005e-02f, 3.576349095e-02f, -3.009393252e-02f, -9.241431952e-02f, 8.500268683e-03f,
+    4.346290138e-03f, -5.777667463e-02f, 2.060700953e-02f, -9.620785713e-04f, 6.831459701e-03f, -1.934625208e-03f, 5.662016571e-02f, 2.737842873e-02f,
+    7.309468836e-02f, -2.349398471e-02f, -2.213058248e-02f, -6.308639050e-02f, 1.000562799e-03f, 2.160860039e-02f, 2.480787924e-03f, -9.761884809e-03f,
+    -8.512319624e-02f, 5.628790706e-03f, 6.351419538e-02f, -4.111085832e-02f, -8.170558512e-02f, -1.560061704e-02f, -2.559960703e-04f, 3.795438260e-02f,
+    -2.503382415e-02f, -4.964851215e-02f, -6.100975908e-03f, 3.386593610e-02f, -6.416809559e-02f, 2.690373547e-02f, 5.922885239e-02f, -6.656906754e-02f,
+    -5.450691655e-02f, 1.242165267e-02f, 8.447013795e-02f, -4.012523219e-02f, -6.999897957e-02f, -4.946899042e-02f, 1.481014770e-02f, 2.224920876e-02f,
+    1.262286864e-02f, -9.253011644e-02f, -7.650479674e-02f, -9.051409364e-02f, 6.888951361e-02f, -6.646854430e-02f, -4.309506714e-02f, 7.746045478e-03f,
+    3.638381138e-03f, -2.684144117e-02f, 2.335248701e-02f, 3.350152075e-02f, -5.016954243e-02f, 7.735899091e-02f, 7.251852006e-02f, 4.751306027e-02f,
+    -4.532757029e-02f, 6.851486862e-02f, -4.638788849e-02f, -5.950282514e-02f, 8.458994329e-02f, -5.306529626e-02f, 8.581006527e-02f, 4.650786519e-02f,
+    -7.248645276e-02f, -2.557146922e-02f, -2.468804643e-02f, 5.751474574e-02f, -8.897706121e-02f, -8.653155714e-02f, -2.046294324e-02f, -4.754206166e-02f,
+    5.821623653e-02f, 6.129384041e-02f, -2.254055627e-02f, -4.287055507e-02f, -1.969420165e-02f, -8.002200723e-02f, -3.239842877e-02f, -9.569385648e-02f,
+    -2.291777544e-02f, 7.473207265e-02f, -1.603463315e-03f, 1.139653474e-02f, 8.539348841e-02f, 7.387916744e-02f, -1.451320946e-03f, -4.231204093e-02f,
+    7.569326460e-02f, -4.755474627e-02f, -2.679504454e-03f, -7.426168025e-02f, 1.385920215e-02f, -4.855662957e-02f, -4.623899981e-02f, -3.808046132e-02f,
+    -7.796449214e-02f, -9.557191515e-04f, 6.005230546e-02f, -6.380141526e-02f, -5.404883251e-02f, 2.323106304e-02f, -5.779469386e-02f, 8.202083409e-02f,
+    4.587543383e-02f, -8.295644075e-03f, -3.655710816e-02f, -4.325163364e-02f, -3.004232980e-02f, -1.595396735e-02f, 3.848811612e-02f, -9.103081189e-03f,
+    -2.334942669e-02f, 6.743960083e-02f, 3.626054525e-02f, -8.066247404e-02f, -8.342356235e-02f, 4.127256572e-03f, -1.317078620e-02f, 8.632987738e-04f,
+    -2.740353346e-03f, 1.082835346e-02f, -7.813993096e-02f, -5.833782628e-02f, -5.205414345e-05f, 1.456094254e-02f, -4.020745680e-02f, -5.123788118e-02f,
+    3.868073970e-02f, -6.932805479e-02f, -7.702916116e-02f, -1.623754762e-02f, 1.668470912e-02f, -7.882395387e-02f, -8.548238873e-02f, 7.059736550e-02f,
+    4.562909156e-02f, 4.999671876e-02f, 3.750316054e-02f, -3.047104552e-02f, -8.332996815e-02f, -4.844338074e-02f, -5.070161447e-02f, -3.518636897e-02f,
+    -3.336576372e-02f, -6.313209981e-02f, -2.426320314e-02f, -8.445222676e-02f, -4.091390595e-02f, -8.420038968e-02f, 7.164502144e-02f, -2.541869879e-03f,
+    -5.250041932e-02f, 3.115326166e-02f, -5.171947181e-03f, 5.448244512e-02f, -6.587481499e-02f, 8.041100204e-02f, -1.303531975e-02f, 6.793010235e-02f,
+    -6.136637926e-02f, -2.959894761e-02f, -6.655417383e-03f, -2.787387744e-02f, 3.598826379e-02f, -2.043107897e-02f, 3.726416081e-02f, -8.181942999e-02f,
+    -4.218303412e-02f, -4.557222128e-02f, -7.374125719e-02f, -6.537169218e-02f, 6.812487543e-02f, -7.196126878e-02f, -5.509237945e-02f, -7.269202918e-02f,
+    2.937655151e-02f, 5.778768659e-02f, -5.513225123e-02f, -6.846388429e-02f, 3.215894848e-02f, 7.270051539e-02f, 6.818950176e-03f, -3.027323633e-02f,
+    -7.885583490e-02f, 4.465989769e-02f, 5.964235589e-02f, 1.172288880e-02f, 4.800505191e-02f, 6.571242958e-02f, -4.460097849e-02f, -6.301175058e-02f,
+    8.084483445e-02f, -1.179381460e-02f, -5.712597072e-02f, -2.421759069e-02f, 3.318616748e-02f, -1.468601823e-02f, 4.464626312e-02f, -9.008094668e-03f,
+    4.757504165e-02f, 5.437092483e-02f, 6.177470088e-02f, 4.789316654e-02f, 2.676561475e-02f, -7.739135623e-02f, 4.513913020e-02f, 8.766590804e-02f,
+    -3.933019564e-02f, 1.539320219e-02f, -7.463881373e-02f, -5.401994288e-02f, -1.984927431e-02f, 7.366192341e-02f, -9.661148302e-03f, -2.148697712e-02f,
+    -3.226742521e-02f, 1.798179001e-02f, 6.499858201e-02f, 7.154289633e-02f, 9.368869662e-02f, -3.482302278e-02f, 6.940799206e-02f, -7.172787189e-02f,
+    6.884870678e-02f, 1.654436439e-02f, -8.111889660e-02f, 1.262386888e-02f, -3.163577989e-02f, 3.368028998e-02f, 4.938858747e-02f, -5.527480319e-02f,
+    -8.060281724e-02f, -6.861528009e-02f, -5.700925738e-02f, 5.083671585e-02f, -6.252186745e-02f, 1.216846425e-02f, -8.204161189e-03f, 6.294338405e-02f,
+    -1.208852394e-03f, -7.182441186e-03f, 1.537826285e-02f, 6.123323366e-02f, 5.838894472e-02f, -1.092328411e-02f, 5.086324643e-03f, -1.096332353e-02f,
+    4.767966643e-02f, 4.716570675e-02f, -4.292476177e-02f, -4.135697149e-03f, 4.319472983e-02f, 4.265422001e-02f, -8.192969859e-02f, -6.609126925e-03f,
+    9.072475135e-03f, -8.265540749e-02f, -2.235670388e-02f, -1.293059438e-02f, -8.552854508e-02f, -8.630948514e-02f, -6.435741484e-02f, 5.802051723e-02f,
+    -1.757960021e-02f, 1.141891535e-02f, -1.193103287e-02f, -2.867050469e-02f, 5.097068474e-02f, -6.745384634e-02f, -4.269532487e-02f, -9.373918147e-05f,
+    -2.003449015e-02f, 7.819811255e-02f, -7.002649456e-02f, -4.332594946e-02f, 3.560511023e-02f, -5.989697948e-02f, -5.089830607e-02f, -7.179504633e-02f,
+    7.859008014e-02f, -4.178128764e-02f, -6.036088988e-02f, 5.469521880e-02f, 6.878577173e-03f, 7.435666025e-02f, 5.053973198e-02f, -3.286732361e-02f,
+    7.538202405e-02f, 1.146426611e-02f, 5.855368450e-02f, -6.649071723e-02f, 7.835268229e-02f, 5.849601701e-02f, -3.540925309e-02f, -5.341592804e-02f,
+    1.764175296e-02f, -9.303484857e-02f, 4.579870403e-02f, -4.028708488e-02f, -5.482209846e-03f, -7.036036998e-02f, 5.679349601e-02f, -5.019932240e-02f,
+    -7.092752308e-02f, 5.632150546e-02f, 4.545458406e-02f, 7.460910361e-03f, 4.519601911e-02f, -6.404057145e-02f, 3.384047374e-02f, 3.660470247e-05f,
+    -4.392600432e-02f, 1.528450847e-02f, -2.090748399e-02f, -4.491410032e-02f, -5.494121090e-02f, -3.728752583e-02f, -2.332390845e-02f, -7.393704355e-02f,
+    -6.210392807e-03f, -2.188894525e-02f, -9.216743708e-02f, 7.506466657e-02f, 2.339765429e-02f, -1.488970220e-02f, -5.868571997e-02f, 4.013565555e-02f,
+    -4.505690304e-04f, 2.782680094e-02f, -5.182280764e-02f, -3.493211791e-02f, 4.081244115e-03f, -1.394517487e-03f, -5.952252820e-02f, -5.073164776e-02f,
+    6.401154399e-02f, 6.507230550e-02f, -9.884847701e-02f, -4.360589758e-02f, 6.074866652e-02f, -8.171216398e-02f, -5.949978530e-02f, -4.835988209e-02f,
+    -5.503157526e-02f, -3.812348237e-03f, 5.508876964e-02f, 2.154061757e-02f, -6.387402117e-02f, -2.348436415e-02f, -1.672914438e-02f, 1.707701571e-02f,
+    6.024801638e-03f, -1.715795323e-02f, 3.720755875e-02f, -6.119932234e-02f, -1.936574653e-02f, -1.358606480e-02f, -3.836324811e-02f, 1.614486054e-02f,
+    -3.227016330e-02f, 2.721555717e-02f, 3.250072151e-02f, 1.446066611e-02f, -6.790667027e-02f, -1.037168037e-02f, 4.028473422e-02f, -2.125757746e-02f,
+    4.825142026e-02f, 2.539613843e-02f, 1.039257832e-02f, 3.021568619e-02f, -7.722200453e-02f, 4.722554982e-02f, 4.330543801e-03f, -7.411500067e-02f,
+    -4.135334119e-02f, 5.605411902e-02f, -9.168697149e-02f, 8.073030971e-03f, -4.364409298e-02f, -3.239719570e-02f, 4.515003785e-02f, 3.458109125e-02f,
+    -8.177027851e-02f, -5.328829866e-03f, 3.165518120e-02f, -1.016370058e-01f, 1.469225809e-02f, 2.616985701e-02f, -6.335583329e-02f, -8.846082538e-02f,
+    -7.261909544e-02f, -9.371843189e-02f, 3.698115936e-03f, 4.070092738e-02f, 5.608028173e-02f, -4.136497155e-02f, -9.107183665e-03f, -5.469863489e-02f,
+    -5.938426405e-02f, 2.393403649e-02f, -7.932106405e-02f, -4.361780733e-02f, -2.916074917e-02f, -4.373674095e-02f, 5.268507078e-02f, 5.138432607e-02f,
+    -2.072621137e-02f, 6.750443578e-02f, -9.951307625e-02f, 1.378904749e-02f, 1.002954412e-02f, -3.102555126e-02f, 4.454469308e-02f, -5.071267951e-03f,
+    -9.461577237e-02f, -3.489780938e-03f, 1.703276485e-02f, 7.282830309e-03f, -8.800233155e-02f, -6.782506406e-02f, -8.887685090e-02f, -1.704473165e-03f,
+    7.033646107e-02f, -3.841722757e-02f, -6.827231497e-02f, 9.901181795e-03f, 1.592127793e-02f, 7.378219813e-02f, -2.053544391e-03f, 6.334795058e-02f,
+    2.544848807e-02f, -4.402587563e-02f, 1.416825410e-02f, 2.910281299e-03f, -1.016002670e-01f, -1.567284763e-02f, 7.405041903e-02f, -8.217075467e-02f,
+    -3.863323480e-03f, 4.533758387e-02f, -3.967338428e-02f, 3.506942093e-02f, -8.471690863e-02f, 5.911825225e-02f, -2.676485293e-02f, -2.043319494e-02f,
+    6.465329975e-02f, -3.210788965e-02f, 3.193855286e-02f, -1.216765773e-02f, 7.492108643e-02f, -4.172495753e-02f, 5.680162460e-03f, 4.592349380e-02f,
+    -3.100161999e-02f, 7.482458372e-03f, -4.818774760e-02f, 2.259901725e-02f, 5.140540749e-02f, -1.088399789e-03f, 1.997476257e-02f, -2.774461173e-02f,
+    -5.903136730e-02f, 5.288204551e-02f, -3.225025162e-02f, -2.173564769e-02f, 3.934802860e-02f, -3.792341799e-02f, -9.706012160e-02f, -3.497190773e-02f,
+    -4.957857542e-03f, -7.296795957e-03f, 1.319425553e-02f, -1.064558793e-02f, -4.776802659e-02f, 9.872432798e-03f, -2.482030913e-02f, 2.088831738e-02f,
+    -6.977662444e-02f, 6.199668720e-02f, 7.069396228e-02f, -8.015735447e-02f, 6.966730207e-02f, -5.904295295e-02f, 2.874178998e-02f, -1.010290347e-02f,
+    7.414386421e-02f, -3.880766407e-02f, -4.116159305e-02f, 3.042023256e-02f, 5.128489435e-02f, 1.571941189e-02f, -3.880036995e-02f, -7.226905972e-02f,
+    -2.283336216e-04f, 3.866148368e-02f, 5.223587155e-02f, 3.415395692e-02f, -8.594258875e-02f, 7.672733068e-02f, 3.148538992e-03f, -4.946070910e-02f,
+    1.945932582e-02f, -2.607588097e-02f, -6.615036633e-03f, -8.915632963e-03f, -6.168850139e-02f, 3.990706755e-04f, 2.498085424e-02f, 2.875363454e-02f,
+    7.566674799e-02f, -5.625822023e-02f, -6.303714216e-02f, -7.590074092e-02f, -5.995129049e-02f, 3.621862084e-02f, -5.511332303e-02f, -5.580018088e-02f,
+    -9.349396825e-02f, -3.720988333e-02f, -1.093474496e-02f, 4.627334327e-02f, -7.746657729e-02f, -4.409523308e-02f, -6.001407653e-02f, 5.578893796e-02f,
+    -1.656076498e-02f, -6.707682461e-02f, 2.403457463e-02f, 7.992733270e-02f, 1.845186390e-02f, -1.225151960e-02f, -1.093129441e-02f, -4.869926721e-02f,
+    -4.696653783e-02f, -1.297302544e-02f, -4.351690784e-02f, 3.866210952e-02f, 8.170662820e-02f, -3.219835833e-02f, 2.768327855e-02f, -6.789839827e-03f,
+    2.360588312e-02f, -7.415387779e-02f, 2.422359027e-02f, 3.167474642e-02f, -6.957568973e-02f, -3.233487019e-03f, 2.878409997e-02f, -3.910840303e-02f,
+    -7.657449692e-03f, 3.398859873e-02f, -4.929603077e-03f, 3.197593242e-02f, -6.949092448e-02f, -4.185743630e-02f, 2.235151455e-02f, -5.193739384e-02f,
+    -2.060142718e-02f, 6.841085851e-02f, 6.176808476e-02f, 2.948603034e-02f, -5.681949481e-02f, 7.565267384e-02f, -2.449522354e-02f, -1.612869091e-03f,
+    5.284650996e-02f, -2.448061667e-02f, 3.979561478e-02f, 7.175268233e-02f, 5.442195386e-02f, -3.630733490e-02f, -4.237180203e-02f, -5.956497043e-03f,
+    4.390351102e-02f, 3.517466784e-02f, 9.296966717e-03f, 5.074232072e-02f, -8.580554277e-02f, -1.611350803e-03f, -2.640943974e-02f, -2.406499162e-02f,
+    -1.115266979e-02f, -7.943239063e-02f, 5.294277519e-02f, -5.555650219e-02f, 1.770281419e-02f, 4.385310411e-02f, 3.671338782e-02f, -8.028767258e-02f,
+    -2.503740788e-02f, 1.771461219e-02f, 1.473619416e-02f, -1.734237373e-02f, -5.616348609e-02f, -3.919842839e-02f, -6.412374973e-02f, -2.052049898e-02f,
+    -7.091352344e-02f, 6.449030340e-02f, -9.015013464e-03f, -3.923728690e-02f, 6.490901113e-03f, -1.672965661e-02f, -2.562244236e-02f, -5.047959089e-02f,
+    3.446311504e-02f, -5.925975740e-02f, -5.787230283e-02f, -6.084883958e-02f, 2.133883350e-02f, -5.276009440e-03f, 8.623534814e-03f, -6.035836414e-02f,
+    -9.038846940e-02f, 5.245412886e-02f, -1.134012709e-03f, 8.115729317e-03f, -4.808101431e-02f, -7.849792391e-02f, 9.876923636e-03f, -1.096808072e-02f,
+    5.481510982e-02f, 5.760636926e-02f, 6.188123301e-02f, 5.845788494e-02f, 6.305824965e-02f, 3.600854799e-02f, -7.941100746e-02f, 7.255835831e-02f,
+    -2.392004943e-03f, 1.156113576e-03f, 1.026673336e-02f, 3.217261657e-02f, -2.559461072e-02f, 5.448215455e-02f, -7.255089283e-02f, -5.997045338e-02f,
+    6.877011806e-02f, -5.963962153e-02f, 3.278482473e-03f, -9.463609755e-02f, 7.133602165e-03f, 4.207484424e-02f, -1.360515133e-02f, -7.974977791e-02f,
+    -8.479399234e-02f, 3.459607065e-02f, 3.981491178e-02f, 1.823686622e-02f, -2.053821646e-02f, -3.833549470e-02f, -5.780107342e-03f, -4.284491763e-02f,
+    -3.754093125e-02f, -6.805583835e-02f, -3.486344218e-02f, -4.751078784e-02f, 7.625806332e-02f, 8.463266492e-02f, -3.942706063e-02f, -1.618865319e-02f,
+    -7.750588655e-02f, 7.045851648e-02f, -6.101255864e-02f, 4.657084122e-02f, -5.700284243e-02f, 3.875630349e-02f, -3.883176297e-02f, 5.097049475e-02f,
+    6.881907582e-02f, -7.765435148e-03f, -7.582809031e-02f, 2.536107041e-02f, 1.143270731e-02f, 8.222028613e-02f, -5.644981563e-02f, 5.723629519e-02f,
+    -6.374229491e-02f, 8.450593799e-03f, -8.869797736e-02f, 9.294188581e-03f, -5.372981727e-02f, -3.684810549e-02f, -3.622713313e-02f, 2.296580002e-02f,
+    -7.077897340e-02f, 4.360202327e-02f, 1.627346152e-03f, 6.436076760e-02f, -4.117910285e-03f, 4.221096262e-02f, -3.245282173e-02f, -6.930909306e-02f,
+    -6.290689576e-03f, -9.488956630e-02f, 3.918337449e-02f, -1.055498328e-02f, 1.284746919e-03f, -8.478153497e-02f, 4.658512026e-02f, -1.063471846e-02f,
+    2.148774266e-02f, 6.625507772e-02f, -8.127953112e-02f, -2.978184074e-02f, -2.846390195e-02f, -6.506995112e-02f, 2.305897139e-02f, -3.345601261e-02f,
+    -6.932214648e-02f, 4.838197306e-02f, 2.714511193e-02f, 3.169722483e-02f, 2.308990434e-02f, -1.417368650e-03f, -2.380112186e-02f, 2.200886235e-02f,
+    5.877229199e-02f, -2.891147323e-02f, -8.195291460e-02f, 3.616086766e-02f, 6.069112569e-02f, -1.537447516e-02f, -8.244631439e-02f, 2.356377244e-02f,
+    7.558566332e-02f, 6.768035889e-02f, 1.598100923e-02f, 6.957516074e-03f, -7.071189582e-02f, 1.743110269e-02f, -7.768005878e-02f, -7.293004543e-02f,
+    3.877189383e-02f, 6.888774037e-02f, -9.859859943e-03f, 3.840519488e-02f, 6.086529419e-02f, -6.153034791e-02f, -4.495323170e-03f, 6.964185089e-02f,
+    -3.259117017e-03f, -2.002855763e-02f, -1.246479340e-02f, -1.301824697e-03f, -3.741883114e-02f, -1.913210377e-02f, 3.890295338e-04f, -5.447901040e-02f,
+    5.855435878e-02f, 5.662976950e-02f, -2.900979109e-02f, -4.489153251e-02f, 8.244173229e-02f, -7.510408759e-02f, -2.649637684e-02f, 1.250636578e-02f,
+    -8.582241088e-02f, 6.097091734e-02f, -6.834261119e-02f, -5.356254522e-03f, 4.071009904e-02f, -4.600563645e-02f, -8.831103146e-02f, -2.551740035e-02f,
+    2.389655821e-02f, -4.857442528e-02f, -2.757564187e-02f, 4.282201827e-02f, -1.152115874e-02f, 1.312617958e-02f, 6.111048907e-02f, 4.588583112e-02f,
+    -1.759021357e-02f, -5.475449935e-02f, 4.221316054e-02f, -1.557915471e-02f, -6.457115710e-02f, 3.191555664e-02f, 1.517715398e-03f, -5.824094266e-02f,
+    -8.283557743e-02f, -2.779020742e-02f, 1.120945811e-02f, -1.959159225e-02f, 1.891143620e-02f, 1.817698032e-02f, -4.125567526e-02f, 1.611884870e-02f,
+    -2.794651128e-02f, -3.348810598e-02f, 5.455629155e-02f, 3.627298400e-03f, -4.273582250e-02f, 8.760477416e-03f, 4.508426785e-02f, -5.183880031e-02f,
+    -9.076404385e-03f, 2.028391510e-02f, -8.729796857e-02f, -3.403763473e-02f, 6.513976306e-02f, -4.069717228e-02f, -5.896117911e-02f, 2.316442318e-02f,
+    5.103721470e-02f, 4.490774870e-02f, 4.558538273e-02f, -7.438565791e-02f, -9.616850875e-03f, -7.361661643e-02f, 3.970457613e-02f, 6.159071624e-02f,
+    4.835438728e-02f, 4.620763659e-02f, -8.041825891e-02f, -3.353225812e-02f, -4.947343841e-02f, -1.007241756e-02f, 5.197133869e-02f, 9.790420532e-03f,
+    -5.025244132e-02f, -4.332353920e-02f, 5.028808489e-02f, -5.782750621e-02f, 2.232095925e-03f, -6.062351167e-02f, -5.050348118e-02f, -5.506026745e-02f,
+    -3.720533801e-03f, 5.838474631e-02f, -8.535337448e-02f, 6.939393282e-02f, -7.904731482e-02f, -6.597321481e-02f, -1.281095948e-02f, 7.679478079e-02f,
+    5.779015273e-02f, 1.347430795e-02f, -1.408180594e-02f, -7.078040391e-02f, -6.048897654e-02f, 7.901188731e-02f, 4.673278332e-02f, 7.435075939e-03f,
+    -3.960628435e-02f, -1.873466559e-02f, 6.776469201e-02f, 6.536834687e-02f, 4.496804625e-02f, -5.682875961e-02f, 2.081814967e-02f, -4.001642019e-02f,
+    -3.723799065e-02f, 3.084369004e-02f, -1.829543151e-02f, 3.249380272e-03f, 2.987468801e-02f, -2.942239866e-02f, 3.073609807e-02f, -1.038453728e-02f,
+    8.214474469e-02f, -1.945166476e-02f, 2.033947781e-02f, 4.467437044e-02f, 5.699009448e-02f, -6.715151947e-03f, -6.103145331e-02f, -6.625252217e-02f,
+    6.313602626e-02f, -2.719620243e-02f, 5.412098765e-02f, -4.265396670e-02f, 2.807955444e-02f, 1.566933841e-02f, 6.477405131e-02f, -8.255572617e-02f,
+    -3.960219678e-03f, -1.544631645e-02f, 7.648713887e-02f, 7.031816244e-02f, 3.883397207e-02f, -4.213317111e-02f, -1.950672641e-02f, -1.918085851e-02f,
+    5.674467608e-02f, -8.830127865e-02f, -8.305936307e-02f, -5.902340263e-02f, 1.964551210e-02f, 7.666816562e-02f, -6.405052263e-03f, -7.030847669e-02f,
+    -3.119926841e-04f, -2.058393508e-02f, -2.516604215e-02f, -1.553009450e-02f, -8.571239561e-02f, 3.946541250e-02f, -6.969832629e-02f, 8.225286007e-02f,
+    1.540645212e-02f, -1.662807167e-02f, -8.520240337e-02f, 2.343168668e-02f, -4.237946868e-02f, -7.108913362e-02f, 1.066438295e-02f, 7.503881585e-03f,
+    -2.320452593e-02f, 5.397774652e-02f, -5.677381158e-02f, -8.478487283e-02f, 5.612478033e-02f, -4.890687764e-02f, 8.609172702e-02f, -7.050120831e-02f,
+    -1.677610725e-02f, 3.018691204e-02f, -1.328257471e-02f, 3.866046667e-02f, -8.546285331e-02f, 2.017102391e-02f, -1.167444885e-02f, 1.801499724e-02f,
+    -2.132590860e-02f, -4.752229154e-02f, 6.376290321e-02f, 4.231224954e-02f, 5.079287291e-02f, -2.684847638e-02f, 3.408239782e-02f, 4.113687575e-02f,
+    -8.212899417e-02f, -4.820989817e-02f, 7.002545893e-02f, -5.000529438e-02f, 8.648914099e-02f, -8.650522679e-02f, -7.867798954e-02f, -1.681066304e-02f,
+    6.908459961e-02f, -5.290492624e-02f, 7.538519800e-03f, -6.323181093e-03f, 6.490717828e-02f, 3.992374241e-02f, 5.299678445e-02f, -7.634174824e-02f,
+    2.290299535e-02f, -3.017359227e-02f, 6.371699274e-02f, 8.252784610e-02f, -2.638399601e-03f, 2.114586532e-03f, 1.543025672e-02f, 6.406995654e-02f,
+    3.241295367e-02f, -5.374683440e-02f, -5.177770928e-02f, 6.254568696e-03f, -6.538548321e-02f, 3.663195670e-02f, 1.814990118e-02f, -2.472226508e-02f,
+    -8.722539246e-02f, 6.922531128e-02f, -6.811598688e-02f, 8.470227942e-03f, 6.674786657e-02f, 7.088672370e-02f, -7.127261162e-02f, -1.947284490e-02f,
+    6.765399873e-02f, -1.332826912e-02f, 1.185324043e-02f, -8.420367539e-02f, 3.059311211e-02f, 5.507624149e-02f, 7.538776100e-02f, -4.454547539e-02f,
+    7.452180982e-02f, -2.249421179e-02f, 4.330754280e-02f, 7.181258500e-02f, 4.580114782e-02f, 9.069468826e-02f, 9.332326800e-02f, -2.248576377e-03f,
+    3.829005361e-02f, -3.518760577e-02f, 5.431882665e-02f, 6.270042062e-02f, 7.814753056e-02f, 4.892920703e-02f, -2.440339886e-02f, 2.250582539e-02f,
+    -6.900693476e-02f, -5.597794428e-02f, 7.955256850e-02f, -4.448535666e-02f, 1.477206871e-02f, 5.447844416e-02f, 5.147063360e-02f, -7.435811311e-02f,
+    2.827469260e-02f, 2.967590094e-02f, -6.636364758e-02f, 1.425563544e-02f, 1.342812181e-02f, 7.098731399e-02f, -7.011741400e-05f, 1.803506166e-02f,
+    5.590029433e-02f, -5.219005793e-02f, 3.000213765e-02f, -7.279350609e-02f, 9.886810556e-03f, -1.271272544e-02f, 6.135109812e-03f, 2.794956788e-03f,
+    1.054569259e-01f, -7.182741538e-03f, -6.275296211e-02f, -9.378388524e-02f, 1.427650359e-02f, -1.102148965e-01f, 2.715797536e-02f, 3.239676729e-02f,
+    -3.385336138e-03f, 5.844746716e-03f, -2.673522197e-02f, -5.663781986e-02f, 4.215556756e-02f, -4.616104066e-02f, 2.221230417e-02f, 6.487508118e-02f,
+    8.323447406e-02f, -5.454135686e-02f, 6.309114397e-02f, 3.295218945e-02f, 3.994232789e-02f, -3.342899680e-02f, -5.472455919e-02f, 5.679568648e-02f,
+    7.413340360e-02f, -2.097227238e-02f, 6.626951694e-02f, -1.532500330e-02f, 8.523425460e-02f, -7.590646297e-02f, 3.837929294e-02f, -4.376514629e-02f,
+    -6.033129990e-02f, 5.272554979e-02f, -7.740663737e-02f, 5.577193201e-02f, -3.495173529e-02f, -6.693657953e-03f, -1.060813367e-01f, -9.309797734e-02f,
+    8.788300306e-02f, 2.382295951e-02f, 8.478466421e-02f, 2.533033490e-02f, -8.385507762e-02f, -4.815272242e-02f, 6.983392686e-02f, 1.464905031e-02f,
+    4.732488096e-02f, -1.759133302e-02f, 9.613873810e-02f, 4.889115319e-02f, -4.866980761e-02f, 1.796014793e-02f, 4.285274819e-02f, 1.559650339e-02f,
+    -7.822904736e-03f, 6.312774867e-02f, 2.282150649e-02f, 3.514101729e-03f, -5.322476104e-02f, -1.050440688e-02f, 6.868703756e-03f, 3.216703609e-02f,
+    -4.006665200e-02f, -3.884171695e-02f, 3.050995059e-02f, -5.882104859e-02f, -1.121755224e-02f, -7.799331099e-02f, -7.062058896e-02f, -8.013208210e-02f,
+    -8.398342878e-02f, 2.458190173e-02f, 2.686701715e-02f, -3.398455679e-02f, 7.434438169e-02f, 2.713681757e-02f, 6.150683016e-02f, -2.519838698e-02f,
+    6.617052108e-02f, -2.317009307e-02f, 2.829336096e-03f, 9.340935946e-02f, 4.144246876e-02f, -5.775057524e-02f, 1.504258905e-02f, 5.027533695e-02f,
+    -5.873186514e-02f, -2.788712084e-02f, 1.932524517e-02f, 7.797908038e-02f, 4.160793871e-02f, -3.307206556e-02f, -7.586527616e-02f, -1.053042635e-01f,
+    3.677177057e-02f, -1.747221686e-02f, 1.385538839e-02f, -3.830907866e-02f, -5.870334804e-03f, 1.965095103e-02f, -8.644253761e-02f, -3.522903472e-02f,
+    -3.876435384e-02f, 3.811982647e-02f, 2.235563286e-02f, 3.361457586e-02f, -5.025726184e-02f, -9.920391254e-03f, -5.010620132e-02f, -1.100521069e-02f,
+    1.765156910e-02f, -5.945160612e-02f, -5.667989701e-02f, -2.268854901e-02f, 2.613905817e-02f, -9.418577887e-03f, -3.955072537e-02f, -1.086778659e-02f,
+    -4.826898128e-02f, 4.268096760e-02f, -6.442509592e-02f, -1.994609274e-02f, -7.501489669e-02f, -3.754657134e-02f, 5.697750673e-02f, -4.404898360e-02f,
+    -6.694816053e-02f, 6.736160070e-02f, -7.048333995e-03f, 4.943017662e-02f, 1.574777439e-02f, -9.973675758e-02f, -7.922703028e-02f, 2.031318471e-02f,
+    -2.693706192e-02f, -8.857560158e-02f, -6.615006179e-02f, -7.056950592e-03f, -7.111649215e-02f, -8.130186051e-02f, -4.938079789e-02f, -5.576311052e-02f,
+    6.978105754e-02f, 1.025937796e-01f, 4.924569651e-02f, -1.668254286e-02f, -5.637399107e-02f, 1.661692187e-02f, -5.779015273e-02f, 4.227478802e-02f,
+    -8.239018172e-02f, -3.322804719e-02f, -3.151927888e-02f, -3.880260140e-02f, -1.762888581e-02f, -7.109353691e-02f, -8.125628531e-02f, -4.137047008e-02f,
+    -6.175687537e-02f, 1.518786512e-02f, -3.960196674e-02f, -3.684295341e-02f, 6.035647169e-02f, -4.379714653e-02f, -1.348503232e-01f, -3.988380730e-02f,
+    -9.710442275e-02f, 1.301919576e-02f, 6.025116518e-02f, 4.956014827e-02f, 5.932690948e-02f, -4.124014813e-04f, 7.878793986e-04f, -3.225250915e-02f,
+    8.303778246e-03f, -5.932889879e-02f, 4.647762701e-02f, -7.511160523e-02f, 1.059159823e-02f, -7.572495192e-02f, 2.058546804e-02f, -3.592599556e-02f,
+    -5.001477152e-02f, -5.181763694e-02f, -4.192445893e-03f, 6.430901587e-02f, 3.294974938e-02f, -6.679436658e-03f, -5.152351409e-02f, -7.455138862e-02f,
+    5.301134661e-04f, 2.341608331e-02f, -8.850477636e-02f, 1.948661543e-02f, -1.341969799e-02f, -1.409034431e-02f, 6.936731189e-02f, -4.863864556e-02f,
+    6.645484269e-02f, 7.281565666e-02f, 4.104367271e-02f, 2.167715877e-02f, 1.626580767e-02f, -4.164300859e-02f, -5.898939073e-02f, 4.052016512e-02f,
+    1.450672746e-02f, -7.404710352e-02f, 4.609596729e-02f, -2.999494784e-03f, 4.542896152e-02f, 3.484329209e-02f, -1.005245652e-02f, -6.299079955e-02f,
+    7.386936992e-02f, 5.746944621e-02f, -7.807318866e-02f, -7.079147547e-02f, -1.127430275e-01f, -9.479593486e-02f, -4.439338669e-02f, -1.490021031e-02f,
+    -6.229811534e-02f, -3.089763224e-02f, 1.688239165e-02f, 5.535410717e-02f, 2.736859396e-02f, -8.837237209e-02f, -1.561932359e-02f, 1.569497958e-02f,
+    -2.299299464e-02f, 1.207715832e-02f, -8.101983368e-02f, -5.474057421e-02f, -5.627369508e-02f, -4.853988439e-02f, 4.613730311e-02f, -5.034870654e-02f,
+    -6.465839595e-02f, 7.138948888e-03f, -8.772621304e-02f, -7.649458200e-02f, -1.878627948e-02f, 1.987641864e-02f, 5.104399472e-02f, -3.743054811e-03f,
+    5.908750370e-02f, -1.418782957e-02f, -3.793486580e-02f, 3.511320055e-02f, 9.309647232e-02f, 5.552284420e-03f, -4.831305414e-04f, 6.631934643e-02f,
+    -9.139644355e-02f, 5.495875329e-02f, 4.597793147e-02f, -1.642884314e-02f, -1.335554570e-02f, -6.305135041e-02f, 5.485988781e-02f, -1.000882611e-01f,
+    -4.031471908e-02f, 1.241205726e-02f, 8.206325024e-02f, 5.627049506e-02f, 5.915522575e-02f, 6.499592960e-02f, 4.387779906e-02f, 4.480452836e-02f,
+    -5.791346729e-02f, 2.040191740e-02f, -8.638852090e-02f, -9.366905689e-02f, 5.409141630e-02f, -3.939302638e-03f, 3.657976864e-03f, 1.498726383e-02f,
+    3.507501259e-02f, -1.679324545e-02f, 3.256486356e-02f, -2.172545157e-02f, 8.476769924e-02f, -5.337195843e-02f, 8.532262407e-03f, 1.987739466e-02f,
+    3.562216088e-02f, 5.686376244e-02f, 4.126296937e-02f, -7.401847839e-02f, -3.457302600e-02f, 8.139809966e-02f, 2.033903450e-02f, -2.040751278e-03f,
+    4.571387172e-02f, -4.230850935e-02f, 3.345221281e-02f, 9.708204307e-03f, -7.291930169e-02f, 1.801901124e-02f, -9.306867607e-03f, -4.238613322e-02f,
+    -6.880718470e-02f, 3.160107881e-02f, 3.781112283e-02f, -1.564127207e-02f, -9.126140177e-02f, 2.274454199e-02f, 4.283357039e-02f, -3.725069808e-03f,
+    -3.998615965e-02f, 4.324006662e-02f, -4.788917676e-02f, 2.827241272e-02f, -4.888769612e-02f, 5.653227121e-02f, -7.723931223e-02f, -4.841500521e-02f,
+    1.970345341e-02f, -3.001763672e-02f, 6.041831337e-03f, -1.399388909e-02f, 6.737060845e-02f, -8.362998068e-02f, 1.499983668e-02f, -2.557932213e-02f,
+    -2.539979666e-02f, 4.437168315e-02f, 3.008638695e-02f, 1.434610598e-02f, -5.125524476e-02f, -2.746652253e-02f, -9.899321944e-02f, -8.273533732e-02f,
+    4.793163389e-02f, 2.472534403e-02f, -3.459376097e-02f, -1.698687789e-03f, 3.923135623e-02f, -5.441569537e-02f, 5.147561058e-02f, -6.350768358e-02f,
+    2.041141130e-02f, -3.333754838e-02f, 8.600277361e-04f, -6.027597189e-02f, -1.550636534e-02f, 9.205098450e-02f, 1.332540996e-02f, 7.638109475e-02f,
+    -4.151215032e-02f, -7.414351404e-02f, -6.659765542e-02f, 4.050199315e-02f, 4.076532647e-02f, 7.557727396e-02f, -3.684553131e-02f, -7.517100126e-02f,
+    -1.079515815e-01f, 1.297333161e-03f, -1.094341800e-01f, -3.206080571e-02f, -1.842411235e-02f, 2.809585445e-02f, 3.028318053e-03f, 1.096874662e-02f,
+    -6.940178573e-02f, -8.166447282e-02f, 7.149165869e-02f, -7.400491089e-02f, -3.357758000e-02f, -2.622593567e-02f, -5.473648012e-02f, -5.258022249e-02f,
+    -5.263980106e-02f, 3.536716104e-03f, 2.386029437e-02f, 9.265602566e-04f, 3.389343619e-02f, 6.654332578e-02f, -5.402462557e-02f, 2.944339765e-03f,
+    -4.308495298e-02f, -8.907775581e-02f, -5.109732738e-04f, -7.664594799e-03f, -9.402000904e-02f, -8.562020212e-02f, -7.618629932e-02f, -5.511585623e-02f,
+    -2.119069733e-02f, -1.145682037e-01f, -3.047132865e-02f, -6.001209468e-02f, -8.369009010e-03f, 3.661562456e-03f, 5.312174559e-02f, 2.725040540e-02f,
+    6.866325438e-02f, 4.847414419e-02f, 8.718414605e-02f, 7.890341803e-03f, -4.871990904e-02f, -5.532665923e-02f, -3.988576308e-02f, 2.768397564e-03f,
+    3.133721650e-02f, 7.995647192e-02f, 5.238900334e-02f, -3.672187030e-02f, -6.166355312e-02f, -7.675505430e-02f, -3.652575985e-02f, -6.317143142e-02f,
+    -1.008758545e-01f, 1.017406024e-02f, -1.317869127e-02f, 4.145258572e-03f, -5.163810775e-02f, 6.186648458e-02f, -4.300346971e-02f, -7.241889089e-02f,
+    4.548350349e-02f, 7.464835048e-02f, -5.125489831e-02f, -3.031518869e-02f, 1.036094502e-02f, 2.104051411e-03f, -5.815309659e-02f, -5.825958028e-02f,
+    -7.175740600e-02f, -5.704277381e-02f, 4.596862197e-02f, -6.005620211e-02f, -7.480484247e-02f, -8.312444389e-02f, 2.004453726e-02f, 4.777312651e-02f,
+    3.561905771e-02f, -6.804708391e-02f, 1.321316976e-02f, 4.011810571e-02f, 2.820741758e-02f, 5.088048801e-02f, -4.617931321e-02f, -6.484190375e-02f,
+    -4.995885491e-02f, -8.390827477e-02f, 2.431224845e-02f, -1.982445084e-02f, 3.477697447e-02f, -2.493864670e-02f, -2.582103014e-02f, 5.703964457e-02f,
+    -7.111028582e-02f, 9.238941967e-02f, 2.899342962e-02f, 8.698918857e-03f, -9.280360490e-02f, 1.290760748e-02f, -9.383396246e-03f, 4.816533625e-02f,
+    -2.277845144e-02f, -1.717156172e-02f, 3.250353038e-02f, 1.444962691e-03f, 4.957210645e-02f, -5.634990335e-02f, -9.657521546e-02f, 7.375805825e-02f,
+    -6.759084761e-02f, 3.665526956e-02f, -4.709098954e-03f, -6.096984074e-02f, -8.949344046e-03f, 1.181195397e-02f, -7.322990149e-02f, -4.616658017e-02f,
+    3.499616683e-02f, 1.622814685e-02f, 1.391271688e-02f, 1.780448854e-02f, -4.203277640e-03f, 8.265930414e-02f, -5.540349707e-02f, -1.023536664e-03f,
+    -8.959105611e-02f, 1.470906101e-02f, 5.974561721e-02f, -2.228288352e-02f, -8.022604883e-02f, -3.388732672e-03f, 8.365370333e-03f, -1.877654903e-02f,
+    2.265097387e-02f, -3.829124197e-02f, -1.433671638e-02f, -3.261351958e-02f, 1.496957429e-02f, -6.778682582e-03f, -5.888042506e-03f, 1.678678580e-02f,
+    -7.390569896e-02f, -1.079958677e-02f, 5.363654345e-02f, 3.114150092e-02f, 1.834553666e-02f, 2.717749774e-02f, -2.663415484e-02f, 1.236971095e-02f,
+    -8.639806509e-02f, 1.495942660e-02f, -6.644319743e-02f, -2.256892249e-02f, 6.545536965e-02f, 1.563492604e-02f, -7.805625349e-02f, -1.227476448e-02f,
+    8.194123209e-02f, -1.437989622e-02f, -8.439189941e-02f, -5.322200060e-02f, 3.044385277e-02f, 7.101111859e-02f, 2.238080278e-02f, 7.789593935e-02f,
+    5.438521504e-02f, 2.428316697e-02f, -1.475805044e-02f, 6.702359021e-02f, -5.357433856e-02f, 3.358769044e-02f, 7.332145423e-02f, -7.133775204e-02f,
+    -4.297972471e-02f, -2.415307239e-02f, 1.199224847e-03f, -5.378389359e-02f, 4.329918325e-02f, 5.559420958e-02f, 8.229628205e-03f, -5.025711656e-02f,
+    -6.385476142e-02f, 3.417324647e-02f, -7.280025631e-02f, -4.652388394e-03f, 1.710088551e-02f, 7.735946774e-02f, 4.223677516e-02f, 9.777828306e-02f,
+    -3.118294477e-02f, 9.612593800e-03f, -8.416698128e-02f, 6.489426643e-02f, -2.732682973e-02f, 3.489237279e-02f, -1.614799351e-02f, -1.866663620e-02f,
+    1.721848175e-02f, -4.098404199e-02f, -3.775236895e-03f, 4.615858570e-02f, -4.379021376e-02f, 1.998541877e-02f, -6.346523017e-02f, -3.671003133e-02f,
+    1.453692280e-02f, 2.090070210e-02f, -5.968840420e-02f, -4.517617449e-02f, 1.728720777e-02f, -2.227577940e-02f, 4.343764484e-02f, 5.161561072e-03f,
+    2.988567948e-02f, -5.057481676e-02f, -1.831265539e-02f, 3.454219550e-02f, -1.757823047e-04f, 1.520893816e-02f, 3.503881767e-02f, -4.463521764e-02f,
+    6.801912934e-02f, -3.305725986e-03f, 8.604096621e-02f, -6.487005949e-02f, -4.718019068e-02f, -4.108787701e-02f, 7.970226556e-02f, -7.317283005e-02f,
+    -5.184871331e-02f, -5.220394954e-02f, 3.849460930e-02f, -4.689920694e-02f, 1.628998108e-02f, 5.821159482e-02f, -3.624512581e-03f, 6.582404673e-02f,
+    2.588569000e-02f, -6.450094283e-02f, 2.263423055e-02f, -7.060622424e-02f, 4.790405929e-02f, -3.873677552e-02f, -1.022680104e-02f, 3.136258572e-02f,
+    -6.244432554e-02f, 6.198395044e-03f, 3.351932764e-02f, -3.784957901e-02f, -2.390487120e-02f, -3.037020378e-02f, 2.354085073e-02f, -8.804941550e-03f,
+    5.393451452e-02f, 5.402915180e-02f, 7.023905963e-02f, 8.720632643e-02f, -8.259807527e-02f, 5.679960176e-02f, 2.631487139e-02f, -1.582976617e-02f,
+    -5.153411999e-02f, -2.149998397e-02f, 4.684152082e-02f, -4.345112666e-02f, -1.655036025e-02f, -1.081065834e-02f, -2.450317144e-03f, -7.978635281e-02f,
+    2.416611463e-02f, -3.844093531e-02f, -8.000066131e-02f, 8.325162530e-02f, -7.656311244e-02f, -1.252803579e-02f, 6.383112073e-02f, -4.769937694e-02f,
+    6.911226362e-02f, 1.641441137e-02f, -4.185323045e-02f, -1.727581024e-02f, 5.045757070e-02f, -7.240052521e-02f, -3.882266209e-02f, 4.206305742e-02f,
+    2.078739740e-02f, -3.286527470e-02f, 4.007425532e-02f, 1.729904674e-03f, 2.428705804e-02f, -2.460406907e-02f, -7.815317810e-02f, -8.406407386e-02f,
+    3.648956493e-02f, 7.684011757e-02f, -4.549698159e-02f, -2.653031424e-02f, 2.716802061e-02f, 5.967019498e-02f, -6.454472989e-02f, 3.748740256e-02f,
+    5.469599366e-02f, 5.578787625e-02f, 3.425775841e-02f, -4.935223609e-02f, 6.920573860e-02f, -3.572465212e-04f, 7.732819766e-02f, 1.912402734e-02f,
+    -8.681460284e-03f, -5.885218456e-02f, 7.057960145e-03f, 7.190894336e-02f, -2.706838772e-03f, 5.618909001e-02f, -8.050451428e-02f, -6.932821125e-02f,
+    3.641109914e-02f, -2.398047596e-02f, -2.221272886e-02f, -6.902141124e-02f, -3.795959800e-02f, 1.584056765e-02f, 5.840115249e-02f, -3.401234373e-02f,
+    -6.395280361e-02f, 8.417004347e-02f, 3.948272765e-02f, -3.129507229e-02f, 4.242859781e-02f, 8.363196254e-02f, 1.722759753e-02f, 4.010421038e-02f,
+    6.091861427e-02f, -7.124774158e-02f, -7.379845530e-02f, 7.263652980e-02f, -5.567949638e-02f, 8.372850716e-03f, -1.584403962e-02f, -2.196138352e-02f,
+    -2.546793222e-02f, -4.084143043e-02f, 5.553045869e-02f, 6.072883308e-02f, -8.399851620e-02f, 2.650613338e-02f, -9.088747203e-03f, -3.653011844e-02f,
+    -5.455927923e-02f, -7.941527665e-02f, -8.115889132e-02f, -3.521597758e-02f, -5.256605893e-02f, 3.582700342e-02f, 8.299750090e-02f, -6.845058501e-02f,
+    6.176677346e-02f, -4.283432290e-02f, -1.276896149e-02f, -4.115746543e-02f, -2.344761789e-02f, -5.549129099e-02f, -2.010142244e-02f, 4.200896621e-02f,
+    7.493272424e-02f, -3.623672063e-03f, -7.379253209e-02f, 2.121747285e-02f, 2.372413874e-04f, 8.613885939e-02f, 6.155550480e-02f, 5.408076942e-02f,
+    -6.826902926e-02f, 6.115333736e-02f, -3.095368296e-02f, 2.469393611e-02f, 3.660444915e-02f, -7.481611520e-02f, 7.646349072e-02f, -1.829394698e-02f,
+    -1.772442460e-02f, -9.538203478e-03f, -1.582808048e-02f, -6.843010336e-02f, -4.520962760e-02f, 7.427910715e-02f, 2.296003141e-02f, 7.593292743e-02f,
+    -5.576290190e-03f, 6.146068871e-02f, -3.338138387e-02f, -6.626508385e-02f, 7.879456389e-04f, -3.208513930e-02f, 5.052556470e-02f, -6.988710910e-02f,
+    -2.307464927e-02f, 6.037623808e-02f, 6.502767652e-02f, 4.225246608e-02f, 1.269149873e-02f, -1.077958103e-02f, 5.918434355e-03f, -6.952837110e-02f,
+    3.733892739e-02f, -5.397088826e-03f, 6.422780454e-02f, -6.936565042e-02f, 3.182606399e-02f, -6.870478392e-04f, 2.409971505e-02f, -6.477759778e-02f,
+    -7.347639650e-02f, -4.038497806e-02f, -6.052254885e-02f, -3.817434609e-02f, -2.121683955e-02f, 3.237633407e-02f, -1.131441968e-04f, -6.831443310e-02f,
+    -4.259446636e-02f, 1.282057911e-02f, -4.324330389e-02f, 2.408704907e-02f, 5.163308606e-02f, 6.944505870e-02f, 3.895736113e-02f, -1.872458728e-03f,
+    7.157388330e-02f, 7.166013122e-02f, 7.460639626e-02f, -6.258987635e-02f, -7.278593630e-02f, 2.076342702e-02f, 8.236406744e-02f, 1.638448983e-02f,
+    4.146458209e-02f, -1.441007853e-02f, -2.136299014e-02f, 7.305628061e-02f, 4.646281712e-03f, 7.896123081e-02f, -5.933957919e-02f, -8.616668638e-04f,
+    -1.670582918e-03f, -6.953282654e-02f, -5.469280761e-03f, 2.387938835e-02f, 5.753131583e-02f, -8.210859448e-02f, 2.961346507e-02f, -9.585918742e-04f,
+    -5.786073580e-02f, -6.268643588e-02f, -6.674168259e-02f, -3.336442262e-02f, 3.838498518e-02f, 2.144689905e-03f, 6.401861459e-02f, -3.086501732e-02f,
+    -1.086371019e-02f, -2.469335683e-02f, -2.680696733e-02f, 4.803499579e-02f, 3.495280445e-02f, 3.672986478e-02f, -2.470258623e-02f, 4.412434623e-02f,
+    6.427489966e-02f, -7.468325645e-02f, 6.748338044e-02f, 4.438921809e-02f, -7.854517549e-02f, -1.960937679e-02f, 1.889792271e-03f, -8.047538251e-02f,
+    7.688389719e-02f, -4.519996047e-02f, 7.660207897e-02f, -8.109565824e-02f, -4.095238447e-02f, 5.727982521e-02f, -1.893843152e-02f, -7.275980432e-03f,
+    -1.400110684e-02f, 6.458448712e-03f, 2.820423245e-02f, -3.056743555e-02f, 1.941185817e-02f, 5.936443061e-02f, 8.124727011e-02f, 6.740674376e-03f,
+    3.164822608e-02f, 5.574578047e-02f, -7.173240185e-03f, 6.878662109e-02f, -2.888381109e-02f, -2.117856778e-02f, 7.015252113e-02f, -4.024093598e-02f,
+    -2.033971809e-02f, 3.568595275e-02f, 1.524481643e-02f, -1.986947283e-02f, -3.020210750e-02f, 3.216021508e-02f, -2.823414654e-02f, -1.577990316e-02f,
+    3.898878768e-02f, -3.675738350e-02f, -3.202599287e-02f, 6.379432231e-02f, 4.163956270e-03f, 1.748331822e-02f, -8.913197368e-02f, -3.144205362e-02f,
+    5.342693627e-02f, -5.726713687e-02f, -5.116016418e-02f, -6.154624373e-02f, -5.960666016e-02f, 3.891517222e-02f, 2.510405332e-02f, 6.191233546e-02f,
+    -3.452978283e-02f, -2.920001000e-02f, -3.457733616e-02f, 5.951179191e-02f, -3.436462209e-02f, 7.891401649e-02f, -7.044014335e-02f, -4.014223069e-02f,
+    5.577927828e-02f, -8.990038186e-02f, -5.969148502e-02f, 1.961784437e-03f, -7.348619401e-02f, -1.939548180e-02f, -2.025379241e-02f, -6.047162227e-03f,
+    -8.632764965e-02f, -8.035521209e-02f, -7.747306675e-02f, 3.611502424e-02f, 7.205238193e-02f, -2.643773705e-02f, -2.477960102e-02f, -1.811562106e-02f,
+    -7.691343874e-02f, 4.887458682e-02f, 2.674361505e-02f, -7.905694656e-03f, 7.791107148e-02f, -2.270733751e-02f, -8.344992995e-03f, -3.889179602e-02f,
+    2.680956200e-02f, -2.567695826e-02f, -7.607674599e-02f, 4.371102527e-02f, -1.853205077e-02f, -1.579511538e-02f, -1.224196982e-02f, -2.759718709e-02f,
+    -4.505810514e-02f, -5.242561921e-03f, -8.555358648e-02f, -2.523246780e-02f, 6.927998364e-02f, 6.618557870e-02f, -3.190076351e-02f, -8.544369787e-02f,
+    -7.112018019e-02f, -5.294990540e-02f, 8.057075739e-02f, 4.444408789e-02f, 5.076296628e-02f, -2.906895475e-03f, -6.621123105e-02f, 5.820364133e-02f,
+    3.255481366e-03f, 4.376907274e-02f, 3.168253228e-02f, 3.138301894e-02f, -3.957901523e-02f, -1.988907531e-02f, -6.889225543e-02f, -6.064153276e-03f,
+    -3.178633749e-03f, 2.372979559e-02f, -8.251748234e-02f, -9.308007360e-02f, 1.307178847e-02f, 6.135476753e-02f, 4.668990150e-02f, 1.022488461e-03f,
+    8.742932230e-03f, 4.494772106e-02f, -4.088866338e-02f, -3.184044361e-02f, -4.541160166e-02f, 7.969499379e-02f, -4.336541146e-02f, 3.621129785e-03f,
+    6.844608486e-02f, 8.550084196e-03f, -6.786942482e-02f, 3.960338980e-02f, 7.610224932e-02f, 7.106097043e-02f, -2.767223632e-03f, -5.028418452e-02f,
+    -3.614424495e-03f, 1.108068787e-02f, 1.165824477e-02f, 5.533016101e-02f, -2.757419832e-02f, 4.654828086e-02f, -1.563871629e-03f, 1.884323917e-02f,
+    -1.708172634e-02f, 2.146810526e-03f, -4.656548426e-02f, 5.756118917e-04f, 3.093682975e-02f, -4.574551061e-02f, -6.286900491e-02f, -3.337726370e-02f,
+    -4.986898974e-02f, 5.696151033e-02f, 1.839203201e-02f, -2.084676176e-02f, -3.047521412e-02f, 2.846017852e-02f, -8.394080400e-02f, -1.682617888e-02f,
+    5.573040992e-02f, 3.808364645e-02f, 2.399907447e-02f, -1.356845908e-02f, -2.712048963e-02f, 5.426415429e-02f, 2.337646112e-02f, -7.459972054e-02f,
+    3.586287796e-02f, -7.648591697e-02f, -5.945479125e-02f, -1.387754362e-02f, 5.757854506e-02f, 3.656746447e-02f, -1.843178831e-02f, -1.561091933e-02f,
+    3.435473889e-02f, -6.542902556e-04f, -4.823637754e-02f, 6.171592325e-02f, -7.650692761e-02f, 2.126390859e-02f, 5.558480322e-02f, -8.315736800e-02f,
+    8.318020403e-02f, -6.623767316e-02f, -5.262343213e-02f, -2.745892294e-02f, 3.319244087e-02f, -1.599626057e-02f, 5.833422393e-02f, -8.415098488e-02f,
+    1.972495578e-02f, -5.657183379e-02f, 1.655492745e-02f, -1.362070628e-02f, -7.935179025e-02f, -3.865233436e-02f, -4.667836428e-02f, 1.805224270e-02f,
+    -6.204233970e-03f, -3.000522032e-02f, -8.625652641e-02f, -7.961016148e-02f, 6.612068415e-02f, -5.214609671e-03f, 1.702143811e-02f, -1.618819311e-02f,
+    -5.370294093e-04f, 1.687566866e-03f, -5.052193254e-02f, 5.503180623e-02f, 5.964942276e-02f, -1.160573959e-02f, 1.070800889e-02f, 2.147418074e-02f,
+    4.325599223e-02f, 4.249915481e-02f, 2.306582406e-02f, -3.618897870e-02f, -2.108170092e-02f, -9.566522203e-03f, -9.836058319e-02f, -6.450121850e-02f,
+    -8.610832505e-03f, -1.403114852e-02f, 5.197080970e-02f, -2.286455408e-02f, 5.270837247e-02f, 5.555441231e-02f, -9.344492108e-02f, 9.210167453e-03f,
+    1.393788494e-02f, -6.918506324e-02f, 7.472566515e-02f, -3.048183396e-02f, 3.383203596e-02f, 6.196710467e-02f, -8.257133514e-02f, 2.105928957e-02f,
+    2.198659629e-02f, -7.579985261e-02f, 4.874841869e-02f, 5.726826191e-02f, 1.674845442e-02f, 7.423791569e-03f, -5.842122436e-02f, -1.553052105e-02f,
+    1.059714798e-02f, 5.564706773e-02f, -5.212421343e-02f, 3.116549924e-02f, 6.222689059e-03f, -6.487421691e-02f, 4.973040521e-02f, 5.541838706e-02f,
+    9.510209784e-03f, -1.073752530e-03f, -6.263827533e-02f, -8.111555874e-02f, -6.603444368e-02f, -9.591826820e-04f, 1.111027133e-02f, -4.658247530e-02f,
+    -4.328699782e-02f, 3.470928594e-02f, 5.592047796e-02f, 5.556821823e-03f, 7.820872962e-02f, -5.756594986e-02f, 1.675916649e-02f, 4.015738517e-02f,
+    -4.238189757e-02f, -7.106967270e-02f, 1.333006192e-02f, 2.314776741e-02f, -6.535288692e-02f, -1.114403829e-02f, -5.079265684e-02f, 5.094389245e-02f,
+    4.757644236e-02f, -3.022968769e-02f, 3.743975237e-02f, -2.399621345e-02f, -3.739645705e-02f, -5.468358099e-02f, -1.659366884e-03f, -8.269850910e-02f,
+    6.357987225e-02f, 7.893865556e-02f, -1.473388914e-02f, 3.482925473e-03f, 5.417595059e-02f, -3.977061436e-02f, 3.438337008e-03f, -5.178252235e-03f,
+    4.318578541e-02f, 2.372458577e-02f, 2.723549493e-02f, -7.904285192e-02f, -2.368655801e-02f, 4.309272021e-02f, 3.567217290e-02f, -1.651289873e-02f,
+    1.640776172e-02f, -2.370926179e-02f, -3.558075428e-02f, -9.494779259e-02f, -7.214190066e-02f, -2.301527746e-02f, -6.918461621e-02f, -9.572120011e-02f,
+    -2.066263743e-02f, -2.550286241e-02f, -2.058556862e-02f, -5.748566613e-02f, -7.488975674e-02f, -8.692169189e-02f, 1.472564600e-02f, -8.374839276e-02f,
+    -2.223744616e-02f, 6.549733132e-02f, -4.260676727e-02f, 2.560304664e-02f, 8.411885798e-02f, -7.294378430e-02f, -7.409306616e-02f, 2.496297099e-02f,
+    8.503932622e-04f, 5.543332174e-02f, 4.707474634e-02f, -5.334481597e-02f, 7.734059542e-02f, 1.839277707e-02f, 5.626474321e-02f, 5.888897460e-03f,
+    -7.336533070e-02f, 3.840490431e-02f, 5.708764493e-02f, 3.464123979e-02f, -6.945656240e-02f, 5.742050335e-02f, 6.922583282e-02f, -2.707875706e-02f,
+    -1.878123730e-02f, -2.998248674e-02f, 2.654798143e-02f, 2.636419609e-02f, 3.644373640e-02f, -2.059413493e-02f, -8.363751322e-02f, 1.071044710e-02f,
+    8.632899821e-02f, 4.958164692e-02f, 1.333296020e-02f, -2.713719755e-02f, 2.447284758e-02f, 4.534481093e-02f, -2.563020913e-03f, -2.645472065e-02f,
+    7.178609073e-02f, -1.149618905e-02f, -3.905291855e-02f, -7.789300382e-02f, -4.019482434e-02f, 5.313040316e-02f, 4.784338176e-02f, -9.197250754e-02f,
+    4.330649599e-02f, 1.040439401e-02f, -7.054632157e-02f, 6.597276777e-02f, -5.486807972e-02f, -5.142940581e-02f, 5.248713121e-02f, 7.606890053e-02f,
+    7.499478757e-02f, -2.477589622e-02f, -3.075304814e-02f, 4.809959233e-02f, -6.219983846e-02f, -1.047849655e-03f, 2.982668811e-03f, -7.521646470e-02f,
+    -5.593509600e-02f, -4.531671479e-02f, -6.073830649e-02f, -8.226656169e-02f, -7.349602133e-02f, -3.384281322e-02f, 2.843692899e-02f, 6.552653760e-02f,
+    -5.659847520e-03f, -9.688267112e-02f, -3.485603631e-02f, -3.486809134e-02f, 1.854380593e-02f, -7.132732123e-02f, 4.587990697e-03f, 6.597178429e-02f,
+    -2.470921353e-02f, -9.082776494e-03f, 1.062114537e-02f, 5.043869466e-02f, -1.618373580e-02f, 4.909376428e-02f, 6.466145068e-02f, -7.607508451e-02f,
+    -7.483094186e-02f, 5.018313229e-02f, 2.707220986e-02f, 5.965450034e-02f, 8.624842763e-02f, 1.522360719e-03f, -1.779906568e-03f, -1.271888614e-03f,
+    -3.021350503e-02f, -5.127497762e-02f, 1.722420566e-02f, -8.389519155e-02f, 3.854636475e-02f, -5.903157592e-02f, 5.091816932e-02f, 6.049080193e-02f,
+    -1.850505732e-02f, -8.888326585e-02f, -4.649823904e-02f, -3.028197773e-02f, -7.978404313e-02f, 6.921352446e-02f, -1.576399058e-02f, -1.181219611e-02f,
+    3.347887099e-02f, -3.182283044e-02f, 5.324229598e-02f, -9.469218552e-03f, -4.050657153e-03f, 6.420233846e-02f, -3.660954535e-02f, -1.520633511e-02f,
+    3.859453136e-03f, 7.856161147e-02f, 7.101903111e-02f, -8.150520921e-02f, -1.010161452e-02f, -4.978260025e-02f, 2.116585895e-02f, -6.448876858e-02f,
+    -6.491961330e-02f, 3.007305227e-02f, 6.371387839e-02f, 2.263538167e-02f, 3.417319804e-02f, 2.866329812e-02f, -5.543025210e-02f, 2.659351565e-02f,
+    -2.634065412e-02f, 2.085533179e-02f, -4.898610339e-02f, 3.380750492e-02f, 3.844908997e-02f, -8.114787191e-02f, 7.991054654e-02f, -7.773928344e-02f,
+    4.287433624e-02f, -7.395196706e-02f, -5.022105575e-02f, 4.870278016e-02f, -8.032961935e-02f, -1.337464806e-02f, 6.636444479e-02f, -7.167339325e-02f,
+    8.167231083e-02f, 2.972025611e-02f, -6.005142629e-02f, -4.194194078e-02f, -2.655331045e-02f, -5.842532963e-02f, -3.393732011e-02f, 5.232828856e-02f,
+    -3.818368167e-02f, -3.420495987e-02f, -2.578506060e-02f, -6.872349232e-02f, -8.683155477e-02f, -7.655882090e-02f, -5.372907221e-02f, -6.184938177e-02f,
+    5.820370466e-02f, -7.096067071e-02f, -4.648100957e-02f, -5.434553325e-02f, -8.495124429e-02f, 6.407144666e-02f, 7.719273865e-02f, 2.993519977e-02f,
+    -1.924858079e-03f, 8.384777606e-02f, 6.713326275e-02f, 4.345194623e-02f, 7.314804941e-02f, 2.498801984e-02f, 3.415999934e-02f, 6.074880436e-02f,
+    6.150942668e-02f, -3.516412526e-02f, 4.260743782e-02f, -5.053829402e-02f, 6.738404930e-02f, -7.107008714e-03f, -6.136508659e-02f, 1.940374076e-02f,
+    -5.514556542e-03f, -2.749755979e-02f, -4.402441904e-02f, 9.785487317e-03f, 1.479746308e-02f, -5.043186992e-02f, 1.703190058e-02f, -7.686910778e-02f,
+    2.760820091e-03f, -7.119253278e-02f, 4.175077379e-02f, -1.487820782e-02f, 8.544430882e-02f, -1.315359119e-02f, 7.011563331e-02f, -5.783504620e-02f,
+    5.432131141e-02f, -8.912702091e-03f, -1.972504891e-02f, 4.631593078e-02f, -1.615807787e-02f, -8.670956641e-02f, 5.360873416e-02f, -1.770737953e-02f,
+    3.469483927e-03f, -3.197805956e-03f, -2.623366006e-02f, -5.827256665e-02f, 1.379308105e-02f, 2.043339889e-03f, 3.459326550e-02f, -1.693851873e-02f,
+    8.983388543e-04f, 5.203664303e-03f, -7.650916278e-02f, 4.837928712e-02f, 5.731469393e-02f, 7.519276440e-02f, -4.863412306e-02f, 5.106018484e-02f,
+    3.589747846e-02f, 1.607230492e-02f, 2.213160507e-03f, 2.503207326e-02f, 1.811493537e-03f, -3.290320188e-02f, -7.235971838e-02f, -4.572622105e-02f,
+    6.987171620e-02f, 3.243220970e-02f, -3.186889738e-02f, -7.524623070e-03f, -5.315834284e-02f, -7.651542779e-03f, -4.228482395e-02f, -1.268026512e-02f,
+    5.704461131e-03f, -9.689474478e-03f, 2.360084653e-02f, -7.561068237e-02f, -1.469379663e-02f, -6.920976192e-02f, 5.651816726e-02f, 7.342939079e-02f,
+    2.001624554e-02f, -9.152941406e-03f, 2.632842213e-02f, 4.789385200e-02f, -7.405504584e-02f, -2.012255788e-02f, 1.601099595e-02f, -5.167257972e-03f,
+    7.459401339e-02f, 3.536786512e-02f, -1.140463725e-02f, -8.591586351e-02f, -5.365436897e-03f, -3.589273617e-02f, 6.345719844e-02f, -5.178545415e-02f,
+    1.062426809e-02f, 7.081925869e-02f, 7.641392201e-02f, -3.771965578e-02f, -5.252109468e-02f, 2.646826208e-02f, -1.810952462e-02f, 7.034508884e-02f,
+    2.338648587e-02f, -4.452024400e-02f, -6.554802507e-02f, 7.428361475e-02f, 7.727602124e-02f, -5.004939809e-02f, 4.336321354e-02f, 6.806316972e-02f,
+    2.274120599e-02f, -7.229699939e-02f, -2.691544592e-03f, 1.327332109e-02f, -6.272987928e-03f, -9.236045182e-03f, -6.669587642e-02f, 5.767071992e-02f,
+    -6.297796220e-02f, -1.758896373e-02f, 1.151192281e-02f, -1.757703256e-03f, -2.611302398e-02f, 2.072574943e-02f, 3.219630569e-02f, 6.600418687e-02f,
+    -2.090657363e-03f, 7.800473273e-02f, 1.007576287e-02f, -2.868097648e-02f, 3.325863928e-02f, -5.203714594e-02f, 7.764056325e-03f, -7.777251303e-03f,
+    2.858223766e-02f, 5.789959431e-02f, 2.024903148e-02f, 7.268337905e-02f, -6.494050473e-02f, 7.725796103e-02f, -4.493218660e-02f, -3.035997972e-02f,
+    -5.014970526e-02f, 3.853717446e-02f, 6.165228784e-02f, -2.890157327e-02f, 6.939783692e-02f, 6.935968995e-02f, 8.158427477e-02f, -2.931000665e-02f,
+    5.430914462e-03f, -5.714684352e-02f, -2.820238471e-02f, 7.426530123e-03f, -3.585198894e-02f, -5.368611217e-02f, 8.614465594e-02f, -5.855137855e-02f,
+    -3.198239207e-02f, 2.409686893e-02f, -6.237328053e-02f, -3.093947843e-02f, 5.574101210e-02f, 3.683014959e-02f, 1.541527361e-02f, 1.060023904e-02f,
+    1.826369762e-02f, -4.443113226e-03f, 2.872158960e-02f, 4.680223763e-02f, -3.573557362e-02f, -2.049149713e-03f, -7.395345718e-02f, -6.200847402e-02f,
+    4.741181433e-02f, -4.029284045e-02f, -5.508361384e-02f, 2.828459628e-02f, -4.800056294e-02f, -2.865043283e-02f, 6.285269558e-02f, 2.309415489e-02f,
+    -5.862322822e-02f, -3.672257438e-02f, 4.601767659e-02f, 5.288568139e-02f, -7.117236406e-02f, 8.379392326e-02f, 6.284095347e-02f, -1.166063547e-02f,
+    4.171055555e-02f, 2.025883645e-02f, 4.721662402e-02f, 1.630254090e-03f, 6.122633815e-02f, -3.508786857e-02f, -5.300066620e-02f, -7.432406396e-02f,
+    1.797319762e-02f, 2.941202931e-02f, -4.544588551e-02f, -3.938497603e-02f, 1.119731925e-02f, -1.709897630e-02f, 6.796396524e-02f, 1.715539582e-02f,
+    3.459859639e-02f, -3.196379170e-02f, 6.477475166e-02f, 7.496576011e-02f, 3.254992142e-02f, 2.098428831e-02f, 7.768186927e-02f, 1.090344228e-02f,
+    -3.302347660e-02f, -5.209409446e-02f, 7.818196714e-02f, 8.324898779e-02f, -7.107281685e-02f, -2.284204215e-02f, -3.565878794e-02f, -5.364650860e-02f,
+    -2.505936287e-02f, -3.443208337e-02f, -1.138884481e-02f, -2.301764116e-02f, -8.121391386e-02f, 1.301882230e-02f, 1.540431846e-02f, 2.509338222e-02f,
+    -8.034139127e-02f, -2.150499076e-02f, 3.169473726e-03f, 9.473197907e-02f, -6.624244153e-03f, 5.591509864e-02f, -2.699992247e-02f, -1.405334799e-03f,
+    1.126297936e-02f, -4.551425949e-02f, 2.067669854e-02f, 5.599573627e-02f, -2.684711292e-02f, 4.872845858e-02f, 3.215087578e-02f, -1.491553336e-02f,
+    5.288225412e-02f, -5.146423727e-02f, 6.354303658e-02f, 7.821109146e-02f, 4.481543973e-02f, 6.732298434e-02f, -4.260246456e-02f, -4.084733501e-02f,
+    3.493672609e-02f, 3.065173328e-02f, 6.584357470e-02f, 4.521967098e-02f, -9.140438586e-02f, -4.447837919e-02f, 2.644485049e-02f, 2.504855208e-02f,
+    -6.709105521e-02f, 5.095459893e-02f, -6.976234913e-02f, -2.839058870e-03f, -8.522761613e-02f, 5.121709406e-02f, -2.234030515e-02f, 3.750930354e-02f,
+    1.197631843e-02f, -8.640497923e-02f, 5.620924756e-02f, 3.731811792e-02f, -3.006432578e-02f, 5.503913015e-02f, 4.417180642e-02f, 4.896710813e-02f,
+    -5.353476480e-02f, -5.093861744e-02f, -6.289486587e-02f, -4.967675358e-02f, 4.617535323e-02f, -6.642293185e-02f, -3.828680143e-02f, 2.483522892e-02f,
+    3.993192315e-02f, 5.661758035e-02f, -2.896069363e-02f, 5.343339965e-02f, -7.854134776e-03f, -3.091038577e-02f, 3.072475456e-02f, 2.137884311e-02f,
+    -8.050735295e-02f, 1.080353744e-02f, 5.429879203e-02f, -6.333737820e-02f, 8.004485071e-02f, -7.995257527e-02f, -1.759760268e-02f, 8.131070435e-02f,
+    -2.345532179e-02f, -2.285071462e-02f, -5.346781760e-02f, 7.198115438e-02f, 5.877711251e-02f, 8.115936071e-02f, -7.177078724e-02f, 7.756930776e-03f,
+    -8.408034593e-02f, -4.074158520e-02f, -8.585299551e-02f, -5.464064702e-02f, 2.941311337e-02f, 2.712481655e-02f, -5.307837948e-02f, -9.053263813e-02f,
+    2.048082091e-02f, 1.175909583e-02f, 6.401731819e-02f, 3.385976329e-02f, -6.988028437e-02f, 3.024051199e-03f, -8.071546257e-02f, -2.152367868e-02f,
+    -2.522542328e-02f, -3.931834549e-02f, -5.198379047e-03f, -4.667872563e-02f, 2.586670220e-02f, 3.683060408e-02f, -4.780673608e-02f, -1.594879664e-02f,
+    4.507768434e-03f, 7.024111599e-02f, 6.246647239e-02f, 6.486363709e-03f, -8.688575774e-02f, -8.653078228e-02f, -6.466951221e-02f, 4.990999028e-02f,
+    -1.023903117e-02f, 1.137044374e-02f, 2.059221268e-02f, -1.890147105e-02f, -5.050807074e-02f, 1.588864252e-02f, -2.239667438e-02f, 3.451735526e-02f,
+    -8.733944595e-02f, 5.541810766e-02f, 3.510332480e-02f, -7.552868128e-02f, -1.337609626e-02f, -2.521876432e-02f, -1.828389475e-03f, 2.843495272e-02f,
+    2.372638136e-02f, -1.252579689e-02f, 7.410779595e-02f, -8.534175903e-02f, 6.982608140e-02f, -6.668267399e-02f, 5.746405944e-02f, 4.484032467e-02f,
+    6.903251261e-02f, -9.642899036e-02f, -1.212106552e-02f, 5.031333119e-02f, -4.079650342e-02f, -8.811431378e-02f, 2.350270748e-02f, -1.696135290e-02f,
+    -5.779549479e-02f, 5.176309124e-02f, -3.626118880e-03f, -9.077332914e-02f, -7.252802700e-02f, 3.613009304e-02f, -1.773862727e-02f, 6.529299170e-02f,
+    6.703843921e-02f, 2.564705722e-02f, -1.722595654e-02f, -7.884372026e-02f, 3.768006712e-02f, -1.199317910e-02f, 8.453862369e-02f, 8.687823080e-03f,
+    -8.906536549e-02f, 2.106907777e-02f, -3.623721749e-02f, -1.349135954e-02f, -8.228966966e-03f, 4.101228341e-02f, -4.970318452e-02f, -2.135744318e-02f,
+    -7.042118162e-02f, -5.598780885e-02f, -8.237505704e-02f, 4.074925184e-02f, -6.673473120e-02f, 4.441487789e-02f, -2.438524552e-02f, -6.419837475e-02f,
+    -9.009230137e-02f, -2.022645809e-02f, -1.022511721e-02f, 5.846169591e-02f, -4.290541634e-02f, -6.153060496e-02f, 1.298160013e-02f, -3.220703220e-03f,
+    2.582746744e-02f, 7.552185655e-02f, -4.026649520e-02f, -7.323164493e-02f, 8.162032813e-02f, 4.168266803e-02f, -5.684452131e-02f, -7.358253002e-02f,
+    -5.027667433e-02f, 5.105039850e-02f, 6.262318790e-02f, 4.140027240e-02f, -2.524300851e-02f, 2.571086958e-02f, 3.723614290e-02f, -9.980427474e-02f,
+    -3.025614843e-02f, -7.137919962e-02f, -1.313412935e-02f, 3.841849044e-02f, 4.068978131e-03f, 7.286568731e-02f, -5.960350484e-02f, -4.893704876e-02f,
+    -1.050237007e-02f, 2.277409844e-02f, -8.369318396e-02f, 1.553600840e-02f, -3.540575504e-03f, -3.759862483e-02f, 3.002101555e-02f, 2.389498753e-03f,
+    9.243877232e-02f, 4.338878766e-02f, 2.950030938e-02f, 5.517362431e-02f, 3.964769468e-02f, -6.228565797e-02f, 4.249519482e-02f, 1.367165614e-02f,
+    4.916479811e-02f, 2.312387712e-02f, 6.242268533e-02f, 9.625233710e-03f, 3.198025003e-02f, 7.040407509e-02f, -9.136360139e-02f, -1.544550061e-02f,
+    6.647366285e-02f, -4.358125478e-02f, -4.453888163e-02f, 6.778674573e-02f, 1.087672729e-02f, -3.586627916e-02f, -6.578660570e-03f, 5.420201272e-02f,
+    5.747860670e-02f, -2.380730212e-02f, 7.981126755e-02f, 1.096456572e-01f, -4.117812216e-02f, 3.577537462e-02f, 3.073891625e-02f, 2.969565801e-02f,
+    -1.850688457e-02f, 6.565249711e-02f, 5.072176829e-02f, -2.604178386e-03f, -6.478727330e-03f, -1.997975074e-02f, -6.194548309e-02f, 5.971042439e-02f,
+    -1.565928943e-02f, -7.952812314e-02f, 7.440719008e-02f, 5.755685270e-02f, 5.336991698e-02f, 7.485213876e-02f, -7.962378114e-02f, 3.134293854e-02f,
+    -7.537685335e-02f, 5.274411291e-02f, -4.311299697e-02f, 6.065253913e-02f, 3.053303063e-02f, 7.872980833e-02f, 4.519704729e-02f, 7.984576374e-02f,
+    7.191326004e-03f, 1.962246560e-02f, -8.241861314e-02f, -4.859970883e-02f, 5.425893143e-02f, -9.350057691e-02f, -2.443211153e-02f, -7.701607887e-03f,
+    4.782394320e-02f, -9.505583346e-02f, -8.169044554e-02f, -2.334262989e-02f, 8.086110651e-02f, -7.858776301e-02f, -4.691110551e-02f, 5.976750702e-02f,
+    4.471676424e-02f, -6.673756987e-02f, -8.907373995e-02f, -4.877828434e-02f, -7.831157744e-02f, -2.248679474e-02f, 8.338321000e-02f, 5.736456811e-02f,
+    7.065287232e-02f, 6.432276964e-02f, -6.795029342e-02f, 4.738888517e-02f, 8.572249115e-02f, -1.700718701e-02f, 4.869109765e-02f, -4.864276946e-02f,
+    6.704288721e-02f, 2.387700416e-02f, -6.424117833e-02f, 3.530173749e-02f, 3.210962191e-02f, -2.884943783e-02f, 4.550290108e-02f, -7.975583524e-02f,
+    -3.543077409e-02f, -1.356595289e-02f, -1.045067310e-01f, -1.326673478e-02f, 7.561589032e-02f, 1.188747212e-02f, 2.179234289e-02f, 6.427085958e-03f,
+    -9.776733816e-03f, -9.107352234e-03f, 2.682062797e-03f, 7.406264544e-02f, 8.476141095e-02f, -7.559944689e-02f, 7.071204484e-02f, 1.160008740e-02f,
+    8.097866178e-02f, 2.511932747e-03f, -4.902844876e-02f, 2.245888859e-02f, 4.484608769e-02f, 6.628794968e-02f, -8.119284362e-02f, -5.413414165e-02f,
+    4.188328236e-02f, -6.557520479e-02f, -4.272977635e-02f, -8.340522647e-02f, -7.825925946e-02f, 5.304260179e-02f, 2.987117879e-02f, 6.360258162e-02f,
+    2.426244505e-02f, -6.925929338e-02f, -5.773836747e-02f, -2.340484643e-03f, -4.167736694e-02f, -1.510699093e-02f, -8.093801886e-02f, -6.129173562e-02f,
+    2.609120309e-02f, -8.516638726e-02f, -7.593408972e-02f, 5.694657564e-02f, 1.566756330e-02f, -8.307611197e-02f, 2.344521135e-02f, -2.560026199e-02f,
+    -5.735029653e-02f, 2.896676399e-02f, 5.830737948e-02f, -8.303328604e-02f, 3.790564835e-02f, -9.614958614e-02f, -9.088160098e-02f, 3.078299202e-02f,
+    6.003108248e-02f, 3.086576937e-03f, -7.030227780e-02f, 7.390558720e-02f, 1.069770008e-02f, -6.465692073e-02f, 6.927303970e-02f, -5.116851628e-02f,
+    -8.054212481e-02f, -2.437144518e-02f, -7.361043990e-02f, 4.914031923e-02f, -2.599485964e-02f, 4.885584116e-02f, -7.429730613e-03f, 3.038313240e-02f,
+    -5.693605915e-02f, -7.266622037e-02f, 4.176284000e-02f, -1.389375306e-03f, 4.512023926e-02f, 6.044175103e-02f, -2.625188604e-02f, 1.568056643e-02f,
+    -2.735510655e-02f, 7.319866866e-02f, -7.132571936e-02f, 2.599925548e-02f, -9.044270217e-02f, -8.033873886e-02f, -4.211353138e-02f, 5.627967045e-02f,
+    3.244144097e-02f, -7.339426130e-02f, -2.553234249e-02f, -3.492278513e-03f, 5.616934504e-03f, 2.029461227e-02f, -3.989966959e-02f, 3.159448504e-02f,
+    6.084927917e-02f, 2.099162154e-02f, 3.767456859e-02f, 4.171623662e-02f, 7.668100297e-02f, -7.544608414e-02f, 7.681528479e-02f, 3.798565269e-02f,
+    2.145055123e-02f, 5.153827369e-03f, -5.732428282e-02f, 4.808942601e-02f, -8.304283023e-02f, 3.697229922e-02f, -9.178807586e-02f, 6.652617455e-02f,
+    2.217619214e-03f, -6.550345570e-02f, -8.242696524e-02f, -5.048951879e-02f, -4.711396247e-02f, -7.812526822e-02f, 6.361821294e-02f, -7.634609938e-03f,
+    -4.314415157e-03f, -6.287914515e-02f, 7.250984013e-02f, 6.111069024e-02f, 6.499117613e-02f, -2.330725826e-02f, 1.410169643e-03f, 7.686359435e-02f,
+    -6.988558918e-02f, -4.444421455e-02f, -2.099379897e-02f, -4.464181513e-02f, -7.052171975e-02f, -7.047938555e-02f, -5.711472780e-02f, 6.683166325e-02f,
+    -2.193319239e-02f, 1.757610962e-02f, 6.410211325e-02f, -4.505359381e-02f, 2.536338381e-02f, -6.305540353e-02f, 3.142940626e-02f, -7.818919420e-02f,
+    6.814013422e-02f, -5.171124265e-02f, -3.663931414e-02f, -1.674159057e-02f, -5.125357956e-02f, -6.688447297e-02f, -1.944398321e-02f, -2.805167437e-02f,
+    -7.998052984e-02f, -3.573717549e-02f, -3.594494238e-02f, -7.019853592e-02f, 8.481705934e-02f, -4.214470461e-02f, 7.052536309e-02f, -8.779036999e-02f,
+    -3.765860572e-02f, 5.294162780e-02f, -3.752523288e-02f, 5.726417527e-02f, -4.981092364e-02f, 7.011699490e-03f, -5.201944709e-02f, 3.411237383e-03f,
+    -5.123483017e-02f, -2.195805684e-02f, -9.405624121e-02f, -7.054057717e-02f, 1.919367164e-02f, -8.247303963e-02f, -8.008824661e-03f, -1.272315974e-03f,
+    2.190809324e-02f, 2.164374571e-03f, 4.862223193e-02f, 5.667410791e-03f, -2.028696239e-03f, 7.460612059e-02f, 1.548234560e-02f, -8.245076984e-02f,
+    6.220783293e-02f, 7.492804527e-02f, -6.410437077e-02f, 5.130437762e-02f, -2.718816325e-02f, 3.505178168e-02f, 4.220418260e-02f, 7.869752590e-04f,
+    1.665083878e-02f, 6.589589268e-02f, -5.231658928e-03f, 2.601887286e-02f, -9.607426822e-02f, 2.556973509e-02f, -9.134927392e-02f, 6.400465220e-02f,
+    2.927002497e-02f, 3.908217698e-02f, -4.494332708e-03f, 7.310734596e-03f, -5.953010544e-02f, 7.531219721e-02f, 5.263264105e-02f, -5.134738982e-03f,
+    -3.521067277e-02f, 4.278129339e-02f, -1.750987396e-02f, -3.914034739e-02f, -7.691723853e-02f, -3.421110660e-02f, 4.482894763e-02f, -2.718079835e-02f,
+    -4.517448694e-02f, 4.804220051e-02f, 3.075563908e-02f, -6.130061671e-02f, -6.537343562e-02f, -6.819976121e-02f, -7.771079242e-02f, -5.053993315e-02f,
+    -3.443438560e-02f, -8.391603827e-02f, 4.860239103e-02f, -6.288961321e-02f, 4.668796435e-02f, -1.544291154e-02f, -1.207729429e-02f, 8.542174473e-03f,
+    4.350657389e-02f, 6.040581316e-02f, -2.571098879e-02f, 6.886719167e-02f, -2.880936116e-02f, 5.677806586e-02f, -6.085666642e-02f, -9.474235587e-03f,
+    -5.326809734e-02f, -2.040700614e-02f, -4.274279252e-02f, -4.869246483e-02f, -8.094717562e-02f, 4.987686872e-02f, -2.850738913e-02f, -4.967218265e-02f,
+    9.715241380e-03f, -1.157965884e-02f, -7.820963115e-02f, 4.694511183e-03f, 1.977518760e-02f, -3.972906992e-02f, 3.894631192e-02f, 5.645440891e-02f,
+    4.218202457e-02f, 6.898232736e-03f, 1.627571136e-02f, -2.193454187e-03f, -3.117486835e-02f, -5.180361122e-02f, 3.749409318e-02f, 4.710093141e-02f,
+    -3.901712969e-02f, -5.908896029e-02f, -2.689656243e-02f, 1.353903115e-02f, 4.003667459e-02f, -2.740427107e-02f, -7.834856212e-02f, 6.291116029e-02f,
+    -9.940483421e-02f, 2.757300436e-02f, -9.007907659e-02f, 3.471284732e-02f, 1.734461822e-02f, 1.684426330e-02f, -9.195868671e-02f, 3.313215822e-02f,
+    -4.641194642e-02f, 2.166036330e-02f, 3.643348813e-02f, 2.947918139e-02f, -4.862752557e-02f, -7.763597369e-02f, -6.168896705e-02f, -7.316676527e-02f,
+    -6.425368786e-02f, -6.664608419e-02f, 5.647385120e-02f, 8.195710182e-02f, 5.794793367e-02f, -4.901606590e-02f, 2.113909274e-02f, 6.984469295e-02f,
+    3.655999666e-03f, -2.326183766e-02f, 3.375077620e-02f, 5.176352710e-02f, 8.265737444e-03f, 7.018644246e-04f, -7.954058051e-02f, -7.305344939e-02f,
+    7.256284356e-02f, 7.679400593e-02f, -8.174403012e-02f, -6.125506386e-02f, 2.469520830e-02f, -5.885179713e-02f, 3.381206095e-02f, -7.415444404e-02f,
+    3.378278343e-03f, -1.287768013e-03f, 5.386590958e-02f, 1.759506576e-02f, 1.703464193e-03f, 8.247292042e-02f, -2.714112401e-03f, 3.641833365e-02f,
+    -1.545041800e-03f, 2.595558763e-02f, 6.276264787e-02f, 4.371397197e-03f, -8.290840685e-02f, 6.738532335e-02f, -4.427960142e-02f, -4.932960868e-02f,
+    -7.086122036e-02f, 3.474578634e-02f, -2.817869931e-02f, -2.009321004e-02f, -5.511748791e-02f, -7.779799402e-02f, 3.178639710e-02f, -6.189127266e-02f,
+    7.056278177e-03f, 4.064155743e-02f, -4.613837600e-02f, -4.593074322e-02f, 6.165159866e-02f, 4.692954198e-02f, -2.347849123e-02f, 7.279295474e-02f,
+    2.964970469e-02f, -4.095670581e-02f, 3.935711086e-02f, 6.668156385e-02f, -2.993412316e-02f, 1.300820708e-02f, -6.591414660e-02f, -3.443636373e-02f,
+    -5.728390068e-02f, 6.041093171e-02f, 1.646765321e-02f, -7.132035494e-02f, -6.211324781e-02f, 8.501012810e-03f, 7.522453368e-02f, -6.276441365e-02f,
+    -6.895018369e-02f, 3.152459115e-02f, 1.714192517e-02f, 6.955124903e-03f, -8.220492303e-02f, 6.381821632e-02f, 4.291030392e-02f, 6.197616458e-02f,
+    8.154038340e-02f, 1.380725205e-02f, -8.335575461e-02f, -1.298943907e-02f, 4.117730260e-02f, -1.567848772e-02f, -2.113859355e-02f, 5.414564908e-02f,
+    -3.115602955e-02f, -3.676207364e-02f, 3.682777286e-03f, -7.670170069e-02f, -3.144400194e-02f, -6.103044003e-02f, 1.224236935e-02f, -6.006625667e-02f,
+    -4.633327574e-02f, 1.153805107e-02f, 2.432689071e-04f, 5.577775836e-02f, -1.653354615e-02f, 3.798156977e-04f, -3.192847967e-02f, 1.236579567e-02f,
+    -8.244831115e-02f, 6.662954390e-02f, -2.864389122e-02f, -7.431305200e-02f, 5.917496979e-03f, 6.328196824e-02f, -2.638041228e-02f, -2.176958323e-02f,
+    -7.214498520e-02f, -1.866159588e-02f, -1.880303770e-02f, -3.467387334e-02f, 6.389889121e-02f, 1.303339750e-02f, 5.016551912e-02f, -6.437810510e-02f,
+    7.834230363e-02f, -2.354677022e-02f, -8.405465633e-02f, -5.636055768e-02f, -8.169296384e-02f, -6.559978426e-02f, -3.072579950e-02f, -1.620175689e-02f,
+    -2.889571153e-02f, -4.619736690e-03f, 3.916786611e-02f, 3.691679239e-02f, -4.933205992e-02f, -4.116564058e-03f, 5.936411768e-02f, -2.242723107e-02f,
+    8.364844322e-02f, 3.514945507e-02f, 5.894851685e-02f, -4.270919785e-02f, -3.810970485e-02f, 3.288442641e-02f, 2.538090199e-02f, 1.632981002e-03f,
+    -1.763185859e-02f, 5.550314486e-02f, 7.041618228e-02f, -7.005482912e-03f, -2.340188622e-02f, -6.711787730e-02f, -7.460770756e-02f, 7.915137708e-02f,
+    -8.095935732e-02f, -4.818454012e-02f, 2.841149271e-02f, 3.671345487e-02f, 7.271912694e-02f, -3.743127361e-02f, -5.501371995e-02f, -1.859210804e-02f,
+    1.814727299e-02f, -7.706507295e-02f, 2.674905397e-02f, 6.629487872e-02f, -2.625844255e-02f, -8.569383621e-02f, -5.173620582e-02f, 5.474029481e-02f,
+    -5.147825554e-02f, 1.102394611e-02f, -5.039989203e-02f, -3.297593445e-02f, -7.295247912e-02f, 5.345080793e-02f, -2.514660358e-03f, -1.691358536e-02f,
+    8.110687137e-02f, 6.855881959e-02f, 2.474727854e-02f, -5.864592269e-03f, 5.887271836e-02f, 4.268536344e-02f, 2.241026796e-02f, -9.522532672e-02f,
+    7.478669286e-03f, -1.215896569e-02f, 6.637664884e-02f, -2.743724268e-03f, 2.518223040e-02f, -1.223402005e-02f, -2.044697478e-02f, -9.278462082e-02f,
+    -4.905745387e-02f, -3.744085133e-02f, -1.338774264e-01f, 4.715285823e-02f, 4.498513415e-02f, -8.092692494e-02f, -3.431130946e-02f, -1.791679859e-02f,
+    6.884014606e-02f, -7.856725901e-02f, 2.365536988e-03f, -5.491390079e-02f, -5.920506269e-02f, -1.416146406e-03f, -5.400593951e-02f, -7.727126777e-02f,
+    5.000251159e-02f, 5.930239335e-02f, -9.094315022e-02f, 6.791893393e-02f, 1.101482846e-02f, 3.297240660e-02f, -4.300729185e-02f, 2.809829079e-02f,
+    -7.606578618e-02f, 4.952992499e-02f, 3.233430907e-02f, -5.152471364e-02f, -2.212578245e-02f, -9.189269692e-02f, 1.324223587e-03f, 7.341925520e-03f,
+    6.723264605e-02f, -2.836370468e-02f, -1.802124269e-02f, 7.754240930e-02f, -3.346716240e-02f, 1.999923587e-02f, -6.703498214e-02f, 6.697340310e-02f,
+    1.005104464e-02f, -6.573795527e-02f, 1.143112313e-02f, -3.886939585e-02f, 1.857862249e-02f, -2.014675876e-03f, -1.557575762e-01f, -1.350526512e-01f,
+    -1.068356447e-02f, 7.097631227e-03f, -9.541103616e-03f, -4.009877145e-02f, -3.302014619e-02f, 7.652239501e-02f, -4.339413345e-02f, -1.819532365e-02f,
+    -9.155354649e-02f, -1.018968374e-01f, -4.469617084e-02f, -8.684253693e-02f, 4.367031157e-02f, 2.651462564e-03f, -8.349603415e-02f, -2.644276991e-02f,
+    -6.735510379e-02f, -8.549576253e-02f, -2.201780677e-03f, 6.286708266e-02f, -8.630448580e-02f, 7.330414653e-02f, -9.507868439e-03f, -4.708900675e-02f,
+    1.605863683e-02f, -1.923194341e-02f, -2.028796263e-02f, 1.304574404e-02f, -8.852843894e-05f, -8.076911420e-02f, -2.403135039e-02f, -3.740517423e-02f,
+    -5.719766393e-02f, -4.070271924e-02f, 5.390291661e-02f, 4.996439442e-03f, 3.849013895e-02f, -6.773718446e-02f, -6.657300889e-02f, 3.235619143e-02f,
+    -2.197377011e-02f, -3.853242472e-02f, 4.171238840e-02f, -3.168983012e-02f, -1.229117811e-02f, -5.591605604e-02f, 6.472867727e-02f, 6.836567074e-03f,
+    -4.825240001e-02f, -5.668103695e-02f, -4.206837714e-02f, 2.587698214e-02f, -9.246867895e-02f, -7.685585320e-02f, -9.589476138e-02f, -6.870533526e-02f,
+    2.875460684e-02f, -3.882718459e-02f, 3.816272318e-02f, -4.392271396e-03f, -4.084919021e-02f, -3.609647974e-02f, -1.768827997e-02f, -5.786153674e-02f,
+    -1.868081465e-02f, -5.581485108e-02f, -7.673081756e-02f, -7.091800123e-02f, -3.050068207e-02f, 3.603262454e-02f, -7.662763447e-02f, 6.787666120e-03f,
+    1.123265177e-02f, 3.328682482e-02f, -5.164981633e-02f, 9.117216617e-02f, -3.408883885e-02f, -1.092347316e-02f, 3.018801287e-02f, -2.374873497e-02f,
+    -7.449443638e-02f, -1.112196520e-01f, 1.506007556e-02f, 2.436882630e-02f, -2.049545012e-02f, -2.891916037e-02f, -9.286970831e-03f, 4.272517562e-02f,
+    -8.971101488e-04f, -3.182191402e-03f, 1.180906664e-03f, 8.131239563e-03f, -3.952143714e-02f, -6.355173141e-02f, 1.984632388e-02f, -1.248683874e-02f,
+    1.077918243e-02f, -4.591998830e-02f, -6.063660234e-02f, -3.048649803e-02f, -5.075819045e-02f, 2.431079745e-02f, -6.205637380e-02f, -2.947639115e-02f,
+    1.992788911e-02f, -2.672626637e-02f, -2.973587252e-02f, -2.565800771e-02f, -6.556020584e-03f, -4.255243391e-02f, -2.887742966e-02f, -7.734537125e-02f,
+    -4.195074365e-02f, 3.023603745e-02f, 6.587429903e-03f, -8.006801456e-02f, 1.690805517e-02f, -3.860686347e-02f, -3.567991778e-02f, 3.642493114e-02f,
+    3.173390776e-02f, -3.438716009e-02f, -1.602300792e-03f, -9.082125127e-02f, -4.163108394e-02f, -2.998498268e-02f, -2.662692033e-02f, 6.129716709e-02f,
+    1.563700289e-02f, 2.155508101e-02f, 5.294681713e-02f, -1.765219122e-02f, 3.901316598e-02f, 2.879368886e-02f, -4.157485813e-02f, 2.879723161e-02f,
+    -6.812945753e-02f, 1.548665203e-02f, -2.570126578e-02f, -9.590891749e-02f, -1.470521465e-02f, 1.181184128e-02f, 1.093068495e-01f, 3.459128365e-02f,
+    7.548739761e-02f, -8.598122746e-02f, -6.447190791e-02f, -8.211514354e-02f, 1.963115484e-02f, -1.020378098e-01f, -9.655506909e-02f, -5.670860037e-02f,
+    1.239121519e-02f, -1.151268780e-01f, 4.317033291e-02f, -9.462825954e-03f, -2.873222157e-02f, -6.915506721e-02f, 2.700729854e-02f, -5.072122067e-02f,
+    -8.431103826e-02f, -8.434784412e-02f, 4.667905718e-02f, -5.258873105e-02f, -1.147121713e-01f, -1.420569792e-02f, 6.899587810e-03f, -3.346135374e-03f,
+    4.617466778e-02f, 5.313795060e-03f, 3.831271455e-02f, 3.639642522e-02f, 5.209545791e-02f, 4.347967356e-02f, 2.124318667e-02f, -2.160242759e-02f,
+    1.233560126e-02f, -5.405163765e-02f, -6.720555574e-02f, -2.015300468e-02f, 1.405753777e-03f, 5.094921961e-02f, 3.803731874e-02f, -5.891950056e-02f,
+    -9.863302112e-03f, 2.419225872e-02f, 1.302639674e-02f, 1.971828006e-02f, -5.537786335e-02f, 5.839568749e-02f, -2.308471687e-02f, 9.943523258e-02f,
+    -9.631871432e-02f, 8.048437536e-03f, 4.246780183e-03f, -5.944897234e-02f, 1.986782625e-02f, 2.033729292e-02f, 1.065397188e-01f, 2.596392296e-02f,
+    -7.308226824e-02f, 2.474764921e-02f, 7.174908649e-03f, -4.910904169e-02f, -1.999961026e-02f, -3.697373718e-02f, -8.052231371e-02f, -3.789224429e-03f,
+    4.413742200e-02f, -7.822289318e-02f, 1.809525862e-02f, 5.864585936e-02f, -5.035985634e-02f, -5.004766211e-02f, -8.281292766e-02f, -2.794352919e-02f,
+    -7.123217732e-02f, -1.085120626e-02f, -4.294998944e-02f, -8.843361586e-02f, 7.472506724e-03f, -4.511562735e-02f, -1.146139503e-01f, -9.141170233e-02f,
+    -5.100572109e-02f, 5.481843650e-02f, -1.778885350e-02f, -3.949244041e-03f, -3.474098817e-02f, -1.784537360e-02f, -2.306256816e-02f, 1.326068863e-02f,
+    5.671148002e-02f, 1.527195331e-02f, -2.898347192e-02f, -1.027603149e-01f, 4.792864621e-02f, 1.950329170e-02f, -4.308021441e-02f, -1.733172685e-02f,
+    4.233197868e-02f, -5.429860204e-02f, -2.713659406e-02f, 5.754777789e-02f, -7.542511076e-02f, -7.483259588e-02f, 2.246131655e-03f, -5.950424075e-02f,
+    1.744435355e-02f, -6.230755709e-03f, 8.523366414e-03f, 2.908148058e-02f, 4.008058831e-02f, -2.808641456e-02f, 8.240421116e-02f, 4.076236859e-02f,
+    3.328759596e-02f, -1.270467509e-02f, -8.125558496e-02f, -5.232397094e-02f, -3.712282050e-03f, -7.560089231e-02f, 6.901884824e-02f, -7.714422047e-02f,
+    -2.772901393e-02f, 6.325128675e-02f, 7.006077468e-02f, 6.445251405e-03f, 6.490866840e-02f, -8.071333170e-02f, 1.520678401e-03f, 5.314676836e-02f,
+    -6.517982483e-02f, -8.648462594e-02f, 1.358483732e-02f, -9.781538695e-02f, -1.107277647e-01f, -6.555623561e-02f, 2.367172204e-02f, -7.056362927e-03f,
+    -1.974812150e-02f, 1.930162497e-02f, 7.084335387e-02f, -1.259229705e-02f, 8.288852870e-03f, -4.922634736e-02f, -1.071561202e-01f, -1.467642486e-01f,
+    4.269897938e-02f, 2.964317240e-02f, -2.728572814e-03f, -6.160536781e-03f, 4.708028212e-02f, -8.447065949e-02f, 2.095158026e-02f, -6.746987253e-02f,
+    3.896236420e-03f, 2.172321081e-03f, 2.786443755e-02f, -3.663016483e-02f, -3.821918368e-02f, -6.112889200e-02f, 4.806652293e-02f, -2.653970756e-02f,
+    3.136825934e-02f, -7.492380589e-02f, -4.509243369e-02f, -7.942593843e-02f, 3.555517644e-02f, 1.335443091e-02f, 3.608311340e-02f, 1.466005947e-02f,
+    4.258716851e-02f, -7.334294915e-02f, -7.486008853e-02f, -1.194941998e-01f, 9.563363343e-02f, -3.530022502e-02f, -2.004884556e-02f, -3.783044964e-02f,
+    3.545630258e-03f, -5.073052645e-02f, 6.569199730e-03f, -6.578318030e-02f, 6.125666201e-03f, 1.300723851e-02f, 4.953584448e-02f, 3.130932152e-02f,
+    3.054677509e-02f, -1.806906611e-02f, -1.014494970e-01f, -1.150109172e-01f, -9.458668530e-03f, 4.346412420e-02f, -2.691958845e-02f, 3.922420740e-02f,
+    4.880323634e-02f, 2.415173873e-02f, 1.706632227e-02f, 1.163672190e-02f, -1.256798301e-02f, 1.145173144e-02f, -1.313352287e-01f, -1.036623865e-02f,
+    -5.133963004e-02f, -7.211697847e-02f, -6.339796633e-02f, -3.874217160e-03f, 6.316723675e-02f, -6.558822840e-02f, 4.923053458e-02f, 7.614281029e-02f,
+    2.323009819e-02f, -5.328831449e-02f, -1.849579811e-02f, -2.384034358e-02f, -1.057164371e-02f, -4.736748338e-02f, 3.052951396e-02f, 3.295870032e-03f,
+    -8.568993956e-02f, -1.133814920e-02f, 3.342823312e-02f, -2.960677445e-02f, 5.814334750e-02f, -8.393378928e-03f, 3.981661052e-02f, 1.935977302e-02f,
+    -8.302333206e-02f, -2.512424998e-02f, -1.187967695e-02f, -1.081149094e-02f, 1.446646452e-02f, -3.325384855e-02f, 4.569989815e-02f, 4.220220074e-02f,
+    -2.411646396e-02f, 8.098627627e-02f, -4.562563822e-02f, 1.278609782e-02f, 7.103517652e-02f, -6.075419486e-02f, 8.632738888e-02f, 7.013977319e-02f,
+    -1.698754169e-02f, -8.556661196e-03f, -3.670924529e-02f, -4.712549970e-02f, 8.932451718e-03f, -5.922640860e-02f, 3.556707874e-02f, -2.889658511e-02f,
+    -5.124914646e-02f, 4.920361564e-02f, 1.395906880e-02f, -5.787527189e-03f, -2.659238875e-03f, -1.679631695e-02f, 8.926659822e-03f, -2.768171392e-02f,
+    -9.496695362e-03f, -8.631285280e-02f, -7.607184350e-02f, -7.352619618e-02f, -5.563487299e-03f, 1.046784804e-03f, -2.381489985e-02f, 3.691335768e-02f,
+    1.170955598e-02f, 4.365144670e-02f, 5.601564422e-02f, -7.830628008e-02f, -4.636725411e-03f, -3.368975967e-02f, -1.577498391e-02f, 3.396995738e-02f,
+    1.823229529e-02f, 7.142808288e-02f, -6.139102578e-02f, -3.666082770e-02f, 2.615718357e-02f, 3.764568269e-02f, -3.349825367e-02f, -5.347635597e-02f,
+    1.450500917e-03f, 1.763196103e-02f, -4.716471583e-02f, -5.275971815e-02f, -9.828785062e-02f, -1.162052602e-01f, 4.658091441e-02f, 4.717132251e-04f,
+    -8.140815794e-02f, 3.089458123e-02f, 1.122849956e-01f, -3.893016279e-02f, 3.700353205e-02f, 7.455436885e-02f, 2.168574929e-02f, -6.167599931e-02f,
+    -8.338356763e-02f, -4.422282428e-02f, 8.356998116e-02f, -7.181506604e-02f, 3.202112764e-02f, 2.141011506e-02f, 1.967008412e-02f, 4.815950990e-02f,
+    5.197340623e-03f, -5.878274888e-02f, 4.972607270e-02f, -2.306204103e-02f, 3.554686159e-02f, 3.065937571e-02f, 8.853342384e-02f, -4.863681272e-02f,
+    -2.706686966e-02f, 2.314639837e-02f, -2.754030516e-03f, 2.362915128e-02f, -3.522045165e-02f, -4.755059257e-02f, 7.759753615e-02f, -3.570208699e-02f,
+    -7.581000775e-02f, 1.057587564e-02f, 4.604533315e-03f, -3.722811118e-02f, -1.391468477e-02f, -7.301294059e-02f, -1.179676969e-02f, 3.037347086e-02f,
+    2.599826641e-02f, -3.769700602e-02f, 9.510557167e-03f, -8.862734586e-02f, 2.668289002e-03f, 4.718988761e-02f, -2.715874463e-02f, -3.233040869e-02f,
+    1.227054512e-03f, -1.981532387e-02f, -3.823574260e-02f, 5.739370361e-02f, -1.965169050e-02f, 1.439209096e-02f, 3.964761645e-02f, 6.766644120e-02f,
+    7.214067131e-02f, 7.024462521e-02f, 5.624606088e-02f, 4.487699270e-02f, 4.331134260e-03f, 8.132770658e-02f, 3.823871166e-02f, -4.623296484e-02f,
+    3.198392689e-02f, -5.040797591e-02f, -4.636591300e-02f, -1.072991118e-01f, -8.265934139e-02f, 5.829146504e-02f, 1.967563294e-02f, -5.049017817e-02f,
+    -3.914709017e-02f, 9.132619947e-03f, -5.743885040e-02f, 5.691281706e-02f, 2.434362657e-02f, -5.364595354e-02f, 8.704444766e-02f, -4.181952775e-02f,
+    -1.256541628e-02f, -1.416192157e-03f, 1.267577149e-02f, 4.251822084e-02f, 6.939340383e-02f, 4.776162282e-02f, 4.208871722e-02f, 3.909505904e-02f,
+    -2.433848381e-02f, -8.270217478e-02f, -5.054070801e-02f, 7.753451914e-02f, 4.191851243e-02f, -6.943736225e-02f, 6.654900312e-02f, 3.515068814e-02f,
+    -7.688912097e-03f, -3.271118924e-02f, 1.395623758e-02f, 1.625644043e-02f, -8.958595991e-02f, 1.088191569e-02f, -4.849496111e-02f, -5.524530262e-02f,
+    -2.862710692e-02f, 1.141344160e-01f, -8.336820640e-03f, 3.540960699e-02f, -2.784243843e-04f, 4.362578318e-02f, 5.250074714e-02f, -5.485504866e-02f,
+    2.948564664e-02f, -1.820129901e-02f, -9.866148233e-03f, -5.434929207e-02f, -5.417093635e-04f, 3.030778468e-02f, -8.391132206e-02f, 1.755015552e-02f,
+    -6.434486061e-02f, 2.892353758e-02f, -1.060494129e-02f, -7.007988542e-02f, -1.319686919e-01f, 2.622909378e-03f, -8.019248396e-02f, -1.127737388e-01f,
+    -2.415574156e-02f, -1.177496240e-01f, 4.498150572e-02f, 4.337693681e-04f, 5.719541013e-02f, -6.031291187e-02f, -5.097591504e-02f, -7.988329232e-02f,
+    3.747316077e-02f, -2.000290900e-03f, -3.053233400e-02f, 6.873334199e-02f, -6.302890927e-02f, 5.547963828e-02f, -7.486831397e-02f, -1.073279232e-02f,
+    -1.447553188e-02f, -8.639255166e-02f, -5.636877567e-02f, 4.521572590e-02f, -1.886703819e-02f, -6.588249002e-03f, 2.776389755e-02f, 3.275604395e-04f,
+    2.850379981e-02f, 6.090094522e-02f, -3.789953887e-02f, -3.437421098e-02f, 1.751080714e-02f, -5.574182142e-03f, 4.442387819e-02f, 2.653882094e-02f,
+    -6.811777502e-02f, -1.469209325e-02f, -7.369838655e-02f, -4.500836506e-02f, 1.266804989e-02f, 9.370416403e-03f, -5.439170823e-02f, -7.815094292e-02f,
+    5.086423457e-02f, 7.670395076e-03f, -6.842766702e-02f, 7.780545950e-02f, 5.717286468e-02f, 4.762868583e-02f, 9.808957577e-03f, -4.494562745e-03f,
+    3.588999808e-02f, 1.544271410e-02f, 7.585057616e-02f, -1.643565856e-02f, 7.544077188e-02f, -2.054388402e-03f, -9.901452810e-02f, 6.566460710e-03f,
+    2.607392520e-02f, -6.639721245e-02f, -8.368023485e-02f, -7.957976311e-02f, -5.560450256e-02f, -2.467200533e-02f, 5.519264936e-02f, 4.576855525e-02f,
+    7.697097957e-02f, -8.163008839e-02f, 7.029412687e-02f, 7.978230715e-03f, -7.610537112e-03f, -6.929528713e-02f, 4.400217533e-02f, 3.848150373e-02f,
+    -5.337753147e-02f, 2.390024066e-02f, -5.278754607e-02f, 5.929583311e-02f, -2.787090465e-02f, -7.389167696e-02f, 5.324545503e-02f, 4.176688194e-02f,
+    -1.424211264e-02f, 9.525775909e-03f, -8.921869099e-03f, 5.365052819e-02f, -4.053547606e-02f, -5.463053286e-02f, 1.165091246e-02f, 2.011261135e-02f,
+    -8.115254343e-03f, -8.393079042e-04f, 7.380869985e-02f, -8.249373734e-02f, -2.054511756e-02f, -1.400548965e-02f, -8.604847640e-02f, -3.920684010e-02f,
+    -8.284313977e-02f, -7.278642803e-02f, 1.472313702e-02f, -4.750849679e-02f, -1.780445129e-02f, -6.813663989e-02f, 4.315532744e-02f, 6.180912256e-02f,
+    8.590078354e-02f, 3.352940083e-02f, 1.103895381e-01f, 1.076345369e-01f, -2.488587052e-02f, 4.679809511e-02f, -8.246753365e-02f, -2.687760815e-02f,
+    -4.996054247e-02f, -2.355843224e-02f, -7.393334527e-03f, 1.274833549e-02f, -1.005285904e-01f, -3.444834426e-02f, -1.014284343e-01f, -5.259451270e-02f,
+    1.917098835e-02f, 5.882596970e-02f, -2.202801406e-02f, 2.970214933e-02f, -2.448229492e-02f, 7.609085739e-02f, -3.242460266e-02f, 6.390884519e-04f,
+    -6.382980943e-02f, 3.758589178e-02f, -8.615528792e-02f, -5.962865055e-02f, -5.022764951e-02f, 3.249865398e-02f, -1.818683743e-02f, 4.097257182e-02f,
+    2.077260800e-02f, 2.912902273e-02f, -3.627545200e-03f, 8.136583865e-02f, 3.368931357e-03f, 7.124816626e-02f, 5.336960778e-02f, 8.744763583e-02f,
+    -1.983802395e-05f, -5.904250592e-02f, 4.957762733e-02f, -1.786112227e-02f, 5.812667683e-02f, -5.851931125e-02f, -5.894251540e-02f, -8.032581955e-02f,
+    2.125533111e-02f, 2.387163788e-02f, 3.844073415e-02f, 5.745610595e-02f, 1.813155413e-02f, -7.876097411e-02f, 3.478268534e-02f, -2.184926718e-02f,
+    2.666060580e-03f, 9.381261468e-02f, 7.773698866e-02f, 4.167624936e-02f, -2.782613970e-02f, 5.704067647e-02f, -4.216765612e-02f, -2.692463435e-02f,
+    9.776855260e-02f, -3.400059044e-02f, 9.288280457e-02f, -1.172315609e-02f, -2.273615077e-02f, 1.359555312e-02f, -1.205127314e-02f, 6.126761436e-02f,
+    -4.731690511e-02f, 2.454372309e-02f, 7.350262254e-03f, -4.689369351e-02f, 2.348193526e-02f, -6.061198562e-02f, -8.621977270e-02f, 3.625525534e-02f,
+    -4.513308406e-03f, -2.731665969e-02f, -7.338330895e-02f, -3.192159906e-02f, -7.159208506e-02f, -8.787139505e-02f, -3.048102185e-02f, 2.116420865e-02f,
+    3.023085743e-02f, 6.353116478e-04f, 1.093185470e-01f, 1.173885632e-02f, -1.545261592e-02f, 4.906259850e-02f, -3.962752596e-02f, 5.200399086e-02f,
+    1.157918647e-01f, -9.706701385e-04f, 4.391400144e-02f, -6.961180270e-02f, -2.937444299e-02f, -6.595032662e-02f, -6.737660617e-02f, -1.145628616e-01f,
+    3.697812930e-02f, 3.274388239e-02f, -3.819443053e-03f, 7.424826920e-02f, -8.333705366e-02f, -3.530392190e-03f, -3.038368002e-02f, -4.493835731e-04f,
+    -4.085798189e-02f, -9.842975065e-03f, 3.122748807e-02f, -1.356479432e-02f, -4.167765751e-02f, 5.202561244e-02f, 1.845654659e-02f, 3.941203654e-02f,
+    6.061588228e-02f, 3.649420291e-02f, 5.664435774e-02f, 1.943605253e-03f, 3.789139166e-02f, 8.432866633e-02f, 3.463023528e-02f, 1.065165456e-02f,
+    4.733614624e-02f, -9.622956067e-02f, 3.679713979e-02f, 3.256586194e-02f, -1.740662567e-02f, -1.356065553e-02f, 3.155989945e-02f, 6.486694515e-02f,
+    -8.152509481e-02f, -6.164241582e-02f, -2.277095988e-02f, 5.440334603e-02f, -8.621498011e-03f, -1.058060210e-02f, -5.532139912e-02f, 3.716195375e-02f,
+    5.486346036e-02f, 6.828663405e-03f, -3.625023738e-02f, 5.356293917e-02f, 3.368074819e-02f, 3.861076757e-02f, -6.282441784e-03f, -6.444889307e-02f,
+    7.620618492e-02f, -5.575190485e-02f, 4.842287302e-02f, 3.763253242e-02f, -4.393969476e-02f, -2.412857488e-02f, 8.839056827e-03f, 8.801836520e-03f,
+    -8.603709191e-02f, -3.435322642e-02f, 8.197584748e-02f, -3.293313086e-02f, -8.569158614e-02f, -5.631535780e-03f, -4.888621345e-02f, -6.727474928e-02f,
+    1.046215370e-01f, -5.132053420e-02f, 3.564481065e-02f, -3.978330269e-02f, 1.123668626e-02f, -1.539532933e-02f, 3.072809055e-02f, -2.313146554e-02f,
+    -6.258008629e-02f, 5.450422689e-02f, 4.912309349e-02f, -6.630711257e-03f, -3.152245283e-02f, 1.928633824e-02f, 2.871995792e-02f, 2.555459365e-02f,
+    3.495819867e-02f, 3.001798876e-02f, -4.295818042e-03f, 4.453846440e-02f, -2.582977340e-02f, -3.074544109e-02f, 6.604678184e-02f, 8.355697989e-02f,
+    2.151200920e-02f, 5.466646329e-02f, 7.633531839e-02f, 4.406060651e-02f, 2.399033494e-02f, 8.948433213e-03f, -5.435945839e-02f, 4.202376306e-02f,
+    7.768282667e-04f, 1.452409662e-02f, 2.594443038e-02f, 1.310453750e-02f, 3.173360601e-02f, 2.309092507e-02f, -1.348813716e-02f, 7.300612330e-02f,
+    -2.366807126e-02f, 6.775151193e-02f, -5.801385269e-02f, 5.949424207e-02f, -1.475034188e-02f, -8.489854634e-02f, -1.309616864e-02f, 3.390352800e-02f,
+    -3.258237243e-02f, -2.496715635e-02f, -2.174897492e-02f, 7.544548064e-02f, -3.014526516e-02f, 9.873121977e-03f, 7.603295147e-02f, -6.847417355e-02f,
+    2.001947537e-02f, 6.573112309e-02f, -1.605486870e-02f, 2.568983659e-02f, 2.900619246e-02f, -8.719813079e-02f, -9.343007579e-03f, 2.042072453e-02f,
+    -8.150682598e-02f, 3.878265619e-02f, -5.715608597e-02f, -3.194994479e-02f, 8.666735888e-02f, -2.461031824e-02f, -6.529302336e-03f, -3.356316686e-02f,
+    3.246515756e-03f, -3.538717330e-02f, 2.976935357e-03f, -1.095871720e-02f, -1.119499188e-02f, 2.202131972e-02f, 5.033092946e-02f, 6.628555804e-02f,
+    -5.838279054e-02f, -1.238377299e-02f, 7.207582146e-02f, 3.987592831e-02f, -5.667562038e-02f, -1.028929800e-01f, -3.079106845e-02f, -6.215532124e-02f,
+    -8.584631979e-02f, 3.061114438e-02f, -9.182100743e-02f, 9.251761250e-03f, -4.671590030e-02f, -8.959206939e-02f, -1.992347464e-02f, -1.498566475e-02f,
+    -8.264434291e-04f, 1.387217734e-02f, 1.969479769e-02f, 8.279647678e-02f, 7.692462951e-02f, 1.353746187e-02f, 1.768647321e-02f, -2.564886026e-02f,
+    -3.720809182e-04f, -3.725405782e-02f, 9.467716515e-02f, -1.500677690e-02f, 1.595549285e-02f, -8.393707126e-02f, -3.047403507e-02f, 3.643593192e-02f,
+    -9.518858045e-02f, -4.343427718e-02f, -9.495033324e-02f, -8.900663257e-02f, -1.154544502e-01f, -2.125706710e-02f, -8.681960404e-03f, -1.163247749e-01f,
+    -7.693090290e-02f, -7.535362151e-03f, -7.435966283e-02f, -1.268590242e-01f, 6.621375680e-02f, 1.290435717e-02f, -4.819601774e-02f, -4.068632051e-02f,
+    -3.423574939e-02f, 3.417142853e-02f, -5.531724915e-02f, -8.297211677e-02f, -1.481825951e-02f, -2.006711811e-02f, -6.139735505e-02f, 3.205608204e-02f,
+    -5.182377622e-02f, -6.123770028e-02f, -4.696773365e-03f, -1.292591728e-02f, -5.136855412e-03f, 2.992417105e-02f, -1.095482931e-01f, -3.296450153e-02f,
+    -1.503942162e-01f, -1.070571467e-01f, -7.215956599e-02f, -1.041942537e-01f, -1.471616179e-01f, -1.019951105e-01f, -1.955036446e-02f, -7.794436067e-02f,
+    -7.062583417e-02f, -4.010103643e-02f, -2.390235290e-02f, -7.338511944e-02f, 6.453593820e-02f, -1.406808943e-02f, -1.868895814e-02f, -1.288323700e-01f,
+    -2.950451151e-02f, 4.014305398e-02f, 9.389580227e-03f, 6.206245720e-02f, -6.861636788e-02f, 2.173933387e-02f, 6.794108078e-03f, 3.305039927e-02f,
+    -3.398246691e-02f, -8.102901280e-02f, -9.011969715e-02f, -1.287896037e-01f, -5.067840964e-02f, -6.852626055e-02f, 1.743265748e-04f, -1.013877317e-01f,
+    -3.193963692e-02f, -1.707499661e-02f, -5.949597340e-03f, -2.567341365e-02f, 2.789320424e-03f, 8.489380591e-03f, 8.046529256e-03f, -6.027171761e-02f,
+    3.404615074e-02f, -6.627280265e-02f, -5.286550149e-02f, -2.154645883e-02f, 1.179525745e-03f, -1.408332679e-02f, -6.122517958e-02f, 6.193345785e-02f,
+    -7.046443224e-02f, 7.901838422e-02f, -4.183936864e-02f, 9.833925404e-03f, -2.030308917e-02f, -9.611369669e-02f, -8.865135722e-03f, 2.581091784e-02f,
+    -4.296116158e-02f, -1.977016451e-03f, -6.819462776e-02f, 3.295077756e-02f, -3.501403332e-02f, -5.457905680e-02f, 4.613243788e-02f, -1.012247056e-01f,
+    -1.070009358e-02f, 5.988467950e-03f, -9.173513949e-02f, 5.721040815e-02f, -1.569653512e-03f, -4.977804795e-02f, -9.922091663e-02f, 3.368731588e-02f,
+    2.965264022e-02f, -8.604729921e-02f, -6.386293471e-02f, 5.271756649e-02f, 5.421698093e-02f, -6.822919846e-02f, -7.563992590e-02f, 1.029991135e-01f,
+    -5.135932472e-03f, -3.116513044e-02f, 6.515445560e-02f, 2.657387219e-02f, 2.929306775e-02f, -2.293687128e-02f, -3.791068494e-02f, 1.673488319e-02f,
+    2.132256702e-02f, 4.026513547e-02f, -1.734520681e-02f, 2.887349762e-02f, 1.236625202e-02f, -1.045210660e-02f, 2.409976721e-02f, 1.087548956e-02f,
+    -8.809442073e-02f, 3.019552864e-02f, -5.498436838e-02f, -8.538113534e-02f, -5.660564452e-02f, 3.391384706e-02f, 6.198841333e-02f, -8.499395847e-02f,
+    -1.256075501e-02f, -2.275732532e-02f, 5.409330502e-02f, 5.585201085e-02f, -1.850109361e-02f, -2.409450011e-03f, 6.421088427e-02f, -4.463481531e-02f,
+    3.213020787e-02f, 3.505304828e-02f, -4.940821975e-02f, 7.959150709e-03f, -3.114416450e-02f, 7.556158304e-02f, 6.713920087e-02f, -2.366032451e-02f,
+    -9.600219131e-02f, 4.008926451e-02f, -5.857896432e-02f, 2.721732855e-02f, -3.738765046e-02f, -9.958624840e-02f, 2.332107909e-02f, -4.343294725e-02f,
+    3.463394567e-02f, 6.374809146e-02f, 1.543436348e-01f, 4.836695641e-02f, 3.242380917e-03f, -8.837155998e-03f, -4.070089012e-02f, -5.001234636e-02f,
+    9.618676454e-02f, 1.734017953e-02f, -2.282212488e-02f, 7.740879059e-02f, 5.236204714e-02f, -5.239639431e-02f, 6.514975429e-02f, 7.465302199e-02f,
+    5.089692026e-02f, 7.213675231e-02f, -4.354323074e-02f, -6.394216418e-02f, 6.624812633e-02f, 4.479146004e-02f, 6.185294129e-03f, -7.592821866e-02f,
+    3.202409670e-02f, 6.495113671e-02f, 1.846789941e-02f, 6.881618500e-02f, 4.971901700e-02f, 1.479973197e-01f, 7.408710569e-02f, -1.390535478e-02f,
+    5.229309201e-02f, 5.680254474e-02f, 1.449401584e-02f, 1.370760333e-02f, 9.293814003e-02f, -1.604208909e-02f, -9.938195348e-03f, 2.836501040e-02f,
+    4.643692076e-02f, 2.476175502e-02f, -4.436193407e-02f, 4.588139430e-02f, -2.627495490e-02f, 6.340782344e-02f, 6.172841415e-02f, 6.732025743e-02f,
+    -4.436149076e-02f, -7.340246439e-02f, -4.908736050e-02f, 9.514250606e-02f, -2.972302260e-03f, 2.900953591e-02f, -2.126499638e-02f, 9.718509763e-02f,
+    4.443480447e-02f, 9.682546556e-02f, 1.005821005e-01f, 6.622979790e-02f, 6.903752685e-03f, 6.004960835e-02f, -2.310362086e-02f, 2.870508702e-03f,
+    -2.216983400e-02f, 4.376089945e-02f, -4.313196242e-02f, -2.490104176e-02f, -2.966471203e-02f, -3.378415480e-02f, 5.906795338e-02f, 8.403960615e-02f,
+    -1.726401225e-02f, -3.351771832e-02f, -5.230230093e-02f, -2.972804010e-02f, 3.440937772e-02f, 4.522426426e-02f, -1.755040139e-02f, -7.907070220e-02f,
+    5.071362481e-02f, -6.007914618e-02f, 7.700617611e-02f, -7.008512504e-03f, 2.027575299e-02f, 1.836261451e-01f, 3.019925766e-02f, -2.485338412e-02f,
+    -3.803882375e-02f, -4.430089321e-04f, -3.320988268e-02f, -6.034702808e-02f, -4.990756884e-02f, -4.164737090e-02f, 8.752115071e-02f, 4.216463491e-02f,
+    -2.343799174e-02f, 8.070648462e-02f, 4.076268151e-02f, -5.273248255e-02f, 5.878603831e-02f, 3.901205957e-02f, 5.217790231e-02f, -4.548874870e-02f,
+    -4.449625313e-02f, -1.320825890e-02f, 8.306762576e-02f, 3.400992602e-02f, 4.084719718e-02f, 6.687289476e-02f, -1.178623643e-03f, 7.840038091e-02f,
+    1.540014893e-02f, 8.967089653e-02f, 1.260474324e-01f, -7.035979629e-02f, -1.644396037e-02f, 3.567082435e-02f, -4.648265988e-02f, 1.208009291e-02f,
+    -1.487077679e-02f, 7.746459544e-02f, 9.016010165e-02f, -3.966543451e-02f, 4.970237240e-02f, -2.135170996e-02f, 3.241709992e-02f, -1.898319647e-02f,
+    4.773119465e-02f, 1.409883425e-02f, 2.501145704e-03f, 3.388418630e-02f, 8.111573011e-02f, -6.208184361e-02f, 3.106858581e-02f, -1.625698991e-02f,
+    -3.735779226e-02f, 2.722440287e-02f, 1.290313303e-01f, 1.404525042e-01f, 1.045252569e-02f, 1.843091473e-02f, 5.271777138e-02f, -4.037638381e-02f,
+    8.962303400e-04f, -4.232193157e-02f, -6.213275716e-02f, -9.509056062e-02f, 5.079063773e-02f, 1.224422082e-02f, -7.485902309e-02f, 3.412138298e-02f,
+    2.735447511e-02f, 1.649141684e-02f, 2.604615316e-02f, -3.496725857e-02f, -7.272517681e-02f, -2.922634967e-02f, -8.486837894e-02f, -7.688875496e-02f,
+    -5.662757903e-02f, 1.997242682e-02f, -8.017948270e-02f, 7.527592126e-03f, 2.649430186e-02f, 6.133916974e-02f, -5.420691893e-02f, 4.321241379e-02f,
+    1.422678083e-01f, 1.436672807e-01f, 1.130485255e-02f, -1.993568242e-02f, -4.977792129e-02f, -7.724615186e-02f, 6.311874371e-03f, 9.714601934e-02f,
+    -6.859515794e-03f, 3.456457704e-02f, -3.210659698e-02f, -7.494459301e-02f, -2.306573652e-02f, 3.865034319e-03f, -5.026319623e-02f, 8.883470669e-03f,
+    -3.578367084e-02f, 3.677336499e-02f, 1.881983690e-02f, -7.036129385e-02f, 5.552235991e-02f, 1.119386591e-02f, 6.605802476e-02f, 2.805784717e-02f,
+    2.884014696e-02f, 4.225503188e-03f, -5.896682665e-02f, 5.988734961e-02f, 1.094632074e-01f, 1.133580059e-01f, 9.189946204e-02f, 8.192764223e-02f,
+    -5.283939093e-02f, 4.934108257e-02f, -3.345991671e-02f, -7.253393065e-03f, -9.375064075e-02f, -2.132423222e-02f, -2.224344201e-02f, -6.486240309e-03f,
+    -1.143506095e-01f, 2.584474161e-02f, -5.920904502e-02f, 3.432718292e-02f, -3.645640984e-02f, -5.193857942e-03f, 3.211281961e-03f, -3.064891323e-02f,
+    1.018087193e-02f, -3.944526240e-02f, -2.613632381e-02f, 2.602590993e-02f, 2.744623926e-03f, 3.578155488e-02f, 5.181272328e-02f, 8.460389078e-02f,
+    5.827805400e-02f, 2.175162081e-04f, -1.645272970e-02f, 8.231744170e-03f, 4.718601704e-02f, -6.854467094e-03f, -6.479898840e-02f, 1.903769746e-02f,
+    -1.223986745e-01f, -1.092386693e-01f, -1.281792391e-02f, -1.090496108e-01f, -1.078732163e-01f, -3.382493556e-02f, -1.731283776e-02f, -1.024717689e-01f,
+    -1.806264557e-02f, 2.406129241e-02f, -1.096122712e-01f, -3.021275438e-02f, -5.176299065e-02f, 7.255682349e-02f, 1.321820635e-02f, 2.451822860e-03f,
+    -6.910265982e-02f, 1.671251096e-02f, -2.963391133e-02f, 7.781054825e-02f, -6.104391068e-03f, -1.974684931e-02f, 5.736020207e-02f, 4.659205675e-03f,
+    3.265137225e-02f, -3.896493092e-02f, -6.395532191e-02f, 3.817528486e-02f, -3.959205747e-02f, -4.876906052e-02f, 5.362423882e-02f, -7.683041692e-02f,
+    7.593698800e-02f, 7.516681403e-02f, 2.154728957e-02f, -7.486704737e-02f, -5.787446164e-03f, -1.158436686e-01f, -6.244058162e-02f, 3.136870638e-02f,
+    -8.602975309e-02f, -4.802808911e-02f, 3.111461923e-02f, 7.431021333e-02f, 1.132488437e-02f, 4.056010023e-02f, -1.441227552e-02f, 2.717449563e-03f,
+    4.139180481e-02f, 1.874417067e-02f, -6.662250310e-02f, 7.113523781e-02f, -2.355467528e-02f, 2.722114325e-02f, -1.101537794e-02f, -4.248872399e-03f,
+    8.355213702e-02f, -5.190752074e-02f, -5.700336397e-02f, 5.323362723e-02f, -2.895395271e-02f, -8.107814938e-02f, -1.565801166e-02f, 3.749398515e-02f,
+    3.175991774e-02f, 5.140580609e-02f, 3.818750381e-02f, -1.375321299e-02f, -4.684275761e-02f, -7.726437598e-02f, -5.731167272e-02f, -7.626598328e-02f,
+    -7.175697386e-02f, 2.945592254e-02f, -1.093324274e-02f, 6.634618342e-02f, 3.250407428e-02f, 4.475307465e-02f, -7.795544714e-02f, 2.384091914e-02f,
+    3.854995966e-02f, -6.882490963e-02f, -1.741908491e-02f, 6.238511205e-02f, 2.457790077e-03f, 7.695400715e-02f, -2.273578942e-02f, -2.913028747e-02f,
+    3.659196198e-02f, -3.763043135e-02f, 4.943832755e-02f, 4.505507648e-02f, 3.767288476e-02f, 6.131006777e-02f, -5.282460898e-02f, -3.682957217e-02f,
+    7.766479254e-02f, -3.663620725e-02f, -4.590764269e-02f, -7.896012068e-02f, -5.588803813e-02f, -8.652447164e-02f, -3.152585030e-02f, 3.184922040e-03f,
+    -1.853721589e-02f, 3.963194788e-03f, -2.088537067e-02f, -4.327985644e-02f, -4.358777776e-02f, -3.697214276e-02f, -7.292466611e-02f, -7.656974345e-02f,
+    6.740924716e-02f, -7.688079495e-03f, -1.533556823e-02f, -1.046484932e-01f, 7.174930722e-02f, 2.353957668e-02f, 8.641403913e-02f, -2.427257225e-02f,
+    6.111306325e-02f, 3.700842708e-02f, 6.466441602e-02f, 1.805276424e-02f, 5.657156929e-02f, 1.081352606e-01f, 6.494177878e-02f, -5.604057759e-02f,
+    1.098723430e-02f, 4.652349651e-02f, 3.291364014e-02f, -5.916188657e-02f, 4.227559268e-02f, -4.102891311e-02f, -4.742002115e-02f, -3.510745615e-02f,
+    6.525181234e-02f, -8.609202504e-02f, -7.548910379e-02f, -5.106009915e-02f, -7.473094016e-02f, 6.418388337e-02f, -4.394863173e-02f, 7.948498428e-02f,
+    -3.551177913e-03f, 9.528652765e-03f, 3.780904785e-02f, 4.797036573e-02f, 5.140622333e-02f, 1.157159582e-01f, 7.769526541e-02f, 1.741081290e-02f,
+    8.029343560e-03f, 1.086179353e-02f, 3.621750697e-02f, 3.532345966e-02f, -3.913789243e-02f, 7.295405120e-02f, 3.168257326e-02f, 4.758209363e-02f,
+    6.104263291e-02f, -2.167914808e-02f, 5.354668200e-02f, -5.952433869e-02f, 5.844128132e-02f, 7.207255065e-02f, -8.121083677e-02f, 4.100754857e-02f,
+    8.025830984e-02f, -6.361566484e-02f, -4.457648471e-02f, 3.353274986e-02f, 6.174209341e-02f, -9.169929475e-02f, -7.849480212e-02f, 8.277443796e-02f,
+    2.024669759e-02f, 1.268848777e-02f, 4.718365613e-03f, 2.884430578e-03f, 1.680545695e-02f, 3.011903726e-02f, -6.186011806e-02f, 6.621246226e-03f,
+    7.873210311e-02f, 5.129439384e-02f, 1.861141808e-02f, -2.316111885e-02f, 1.039304584e-01f, 5.959472060e-02f, -1.258073375e-02f, -6.019145250e-03f,
+    5.229206383e-02f, -3.748928383e-02f, -2.752579749e-03f, -5.849709362e-02f, -1.045294330e-01f, 9.107950330e-02f, -9.522834420e-02f, 3.830439970e-02f,
+    -4.993458465e-02f, 1.757631265e-02f, -1.132853329e-01f, 5.398239940e-02f, -5.619263649e-02f, -7.919251174e-02f, 1.258683763e-02f, -2.264226414e-02f,
+    -2.767153829e-02f, 1.156688705e-01f, 1.592708752e-02f, 3.038728982e-02f, -7.985683042e-04f, -2.193768509e-02f, 2.021572925e-02f, 2.507548220e-02f,
+    2.359164506e-02f, -2.734702639e-02f, 1.762263011e-03f, 4.038256407e-02f, 3.824901581e-02f, 8.110107481e-02f, 2.090696990e-02f, 6.872462481e-02f,
+    -5.660458282e-02f, -1.461508311e-02f, -6.373575330e-02f, -4.617331084e-03f, 1.106946263e-03f, 1.688170433e-02f, 8.522512391e-03f, -4.578443617e-02f,
+    2.598230727e-02f, -1.121459436e-02f, -6.359945401e-04f, 1.725978777e-02f, 8.164915489e-04f, -2.814775333e-02f, 3.163037449e-02f, 3.659211099e-02f,
+    7.137174159e-02f, 6.708139926e-02f, -8.927585185e-02f, -3.268124163e-02f, -4.386064783e-02f, -8.931062371e-02f, -7.780687511e-02f, 4.807157815e-02f,
+    8.087630570e-02f, -6.443469971e-02f, -1.826439798e-02f, -7.904716581e-02f, 5.242431536e-02f, 3.764498048e-03f, 2.721057087e-02f, 4.598482326e-02f,
+    -2.471207827e-02f, -2.067786874e-03f, -7.761032879e-02f, 2.188247629e-02f, -6.264285743e-02f, -8.383792639e-02f, -7.820322365e-02f, -2.061009966e-02f,
+    -8.695959300e-02f, 5.109284446e-02f, -1.009038389e-01f, 7.258249912e-03f, -8.413305134e-02f, -1.153797004e-02f, -9.918906540e-02f, -5.124188215e-02f,
+    -1.390945464e-01f, 2.955029905e-02f, -5.047000200e-02f, 3.180254251e-02f, -8.438687772e-02f, -1.337292790e-02f, -6.220006943e-02f, -7.537130266e-02f,
+    -8.524247259e-02f, -6.886189431e-02f, -3.933309764e-02f, 1.634376124e-02f, -3.693908826e-02f, 6.342961453e-03f, -3.775180504e-02f, -6.218757480e-02f,
+    -6.867782027e-02f, -2.214663476e-02f, 4.971812665e-02f, -1.805791818e-02f, -4.336496443e-02f, -5.187639035e-03f, -5.653244443e-03f, -9.788879007e-02f,
+    -1.060348824e-01f, -7.422939688e-02f, 3.332332894e-02f, 4.483341239e-03f, -3.513721377e-02f, 1.956245489e-02f, -6.807194650e-02f, -8.649216965e-03f,
+    9.549811482e-03f, 6.201072782e-02f, 2.870076522e-02f, 5.625118688e-02f, 5.660117790e-02f, -6.854467094e-02f, -3.670647740e-02f, -4.333805700e-04f,
+    3.633926064e-02f, -7.169608772e-02f, 2.320168912e-02f, -8.496642113e-02f, 8.158384822e-03f, 2.961987443e-02f, -3.428639844e-02f, 1.586090401e-02f,
+    -2.359119989e-02f, -7.317129523e-02f, 4.390446469e-03f, 1.381863281e-02f, -1.959814131e-02f, 4.463263322e-03f, 3.693320230e-02f, -1.996809989e-02f,
+    -1.448259689e-02f, 5.394353648e-04f, -1.049557887e-02f, -3.566105291e-02f, -3.201288730e-02f, -4.091873020e-02f, 8.043362945e-02f, 5.938187987e-02f,
+    -2.118653851e-03f, -5.211233348e-02f, -2.013036795e-02f, -7.861921191e-02f, -7.055468112e-02f, -2.765398938e-03f, 1.713877195e-03f, 7.004593313e-02f,
+    -5.582088977e-02f, -5.720124766e-02f, -6.882831454e-02f, 2.313633636e-02f, -5.981388316e-02f, -3.416419961e-03f, -8.073198050e-02f, -4.209730402e-02f,
+    -5.033719912e-02f, -3.114632331e-02f, -9.732539952e-02f, -1.392710358e-01f, -5.486897752e-02f, -1.226286367e-01f, -1.636274718e-02f, -1.346083637e-02f,
+    -8.487066254e-03f, -8.650410920e-03f, 1.419141237e-02f, 3.375484794e-02f, 1.683189720e-02f, -2.339318953e-02f, 3.813623264e-02f, 7.314391434e-02f,
+    -4.185665771e-02f, -3.006684035e-02f, -3.598453011e-03f, 1.508491579e-02f, -2.422080562e-02f, 7.398923486e-02f, -8.261287957e-02f, -8.375881612e-02f,
+    -3.719355166e-02f, -2.912552655e-02f, -6.604143977e-02f, -3.944637626e-02f, 2.627172507e-02f, -2.781417966e-02f, -4.791288823e-02f, -7.621072233e-02f,
+    2.613666281e-02f, -9.262322448e-03f, -3.658702970e-02f, 4.642378539e-02f, -6.020464003e-03f, -2.344378456e-02f, -2.303550765e-02f, 1.365821343e-02f,
+    -8.647166193e-02f, -1.238434464e-01f, -7.428009063e-02f, 1.222487073e-02f, 1.235267613e-02f, 5.717014521e-02f, 3.989216685e-02f, 6.088146940e-02f,
+    -2.438773401e-02f, -8.242990822e-02f, 6.898133084e-03f, 3.809666960e-03f, 3.125402331e-02f, -3.043216281e-02f, -9.980360046e-03f, -3.788820282e-02f,
+    9.690030478e-03f, 8.881630492e-04f, -4.590738681e-04f, 4.127911851e-02f, -1.891989447e-02f, -3.735345090e-03f, 1.890312694e-02f, 7.633654028e-02f,
+    8.282695711e-02f, 3.618272394e-02f, -4.787755385e-02f, 3.443675488e-02f, -1.568657812e-03f, 6.504992489e-03f, -9.402153082e-03f, 7.167630643e-02f,
+    3.362684278e-03f, 3.229511529e-02f, -8.604543656e-02f, -5.769254267e-02f, 8.351603523e-03f, 4.833511636e-02f, -9.908037633e-02f, -2.339668758e-02f,
+    -3.888360807e-04f, 9.850759059e-03f, -6.527379900e-02f, -9.793137759e-02f, 4.470881075e-02f, -1.944288053e-02f, 6.492263824e-02f, 4.992525652e-02f,
+    7.948222756e-02f, 1.803020947e-02f, -2.740845829e-02f, 6.046399474e-02f, 1.524288207e-02f, 1.710794866e-02f, -4.146003723e-02f, -3.993637487e-02f,
+    7.751971483e-03f, 5.865079165e-02f, -7.512810826e-02f, -2.343901061e-02f, -6.047821417e-02f, 1.838882267e-02f, 5.022151396e-02f, -3.097684868e-02f,
+    3.603711724e-02f, -1.082944497e-02f, -6.189069897e-02f, 4.785826430e-02f, 6.274478137e-02f, -4.412774369e-02f, 1.748472080e-02f, 3.144765273e-02f,
+    1.148687582e-02f, -5.551712215e-02f, -2.998539014e-03f, 9.444603324e-02f, 6.573475897e-02f, -6.814586371e-02f, 6.703148782e-02f, 2.090188861e-02f,
+    -6.743110716e-02f, 4.729373753e-02f, -4.559414834e-02f, 7.427725941e-02f, -9.963875264e-02f, 3.718812019e-02f, 2.540510707e-02f, 1.122708097e-01f,
+    9.589893743e-03f, 7.962539047e-02f, 1.052045971e-01f, -2.867465466e-02f, -2.334481664e-02f, 5.072374269e-02f, -5.185573548e-02f, 5.871335045e-02f,
+    6.734198425e-03f, -1.687300578e-02f, -4.474924877e-02f, 2.653654665e-02f, -4.235565662e-02f, 8.349414170e-02f, -2.655815706e-02f, 4.547993466e-02f,
+    -8.654397726e-02f, -1.274570227e-01f, 7.215055171e-03f, 1.536679268e-02f, -6.390452385e-03f, -3.150720522e-02f, -1.977675408e-02f, 1.897844672e-02f,
+    -5.787584558e-02f, -3.558096662e-02f, -3.492425382e-02f, 8.121954650e-02f, 5.324448273e-02f, -4.629582912e-02f, 3.566175699e-02f, 1.641462743e-02f,
+    -5.372240022e-02f, 4.825731739e-02f, -3.628354147e-02f, -7.693940401e-02f, 2.268073149e-02f, 2.732693590e-02f, 1.731150784e-03f, 1.431418210e-02f,
+    3.071403131e-02f, -1.457145717e-02f, 3.591396660e-02f, 6.831245031e-03f, -6.524730008e-03f, -7.758642733e-02f, -7.681605220e-02f, -8.762422204e-02f,
+    -6.128721312e-02f, -4.889847711e-02f, 8.619907312e-03f, 1.766485348e-02f, -8.773811162e-03f, 8.280244470e-02f, 2.693655435e-03f, -4.360166192e-02f,
+    7.177403569e-02f, 6.643020362e-02f, 6.211408973e-02f, 1.316821128e-01f, 1.079614684e-01f, -5.598255992e-02f, 5.605520681e-02f, 1.333207451e-02f,
+    3.499916568e-02f, -4.784069955e-02f, 2.666176064e-03f, -2.671335265e-02f, 6.636653841e-02f, 3.879088210e-03f, 3.877081722e-02f, 5.364144966e-02f,
+    4.017749429e-02f, 3.963216767e-02f, -1.370035391e-02f, 5.467625335e-02f, -7.009379566e-03f, -5.502283946e-02f, -6.788754463e-02f, -6.709200144e-02f,
+    -1.255856901e-01f, 7.346733473e-03f, 2.458700538e-02f, -2.513045818e-02f, 5.810147151e-02f, -2.600142919e-02f, -1.450813469e-02f, 1.988022588e-02f,
+    -1.844628900e-02f, 4.973459989e-02f, 7.163058221e-02f, -3.421819210e-02f, -7.835537195e-02f, 5.854518712e-02f, -2.469301037e-02f, -4.580097273e-02f,
+    8.229985833e-02f, -4.261952639e-02f, 4.903043434e-02f, 3.825004771e-02f, -7.549592108e-02f, -7.449629903e-02f, -2.552307583e-02f, -4.899233580e-02f,
+    1.764552295e-02f, 5.070386827e-02f, -4.873858020e-02f, 2.864483558e-02f, -6.859239936e-02f, 9.309077635e-03f, -3.857725114e-02f, 3.942628391e-03f,
+    6.203711778e-02f, 1.584857143e-02f, 9.377902001e-02f, -1.877167076e-02f, -2.917243540e-02f, -1.524998224e-03f, -4.761532694e-02f, 2.975155041e-02f,
+    4.638747498e-02f, -5.963626131e-02f, -2.036145702e-02f, 5.950453505e-02f, -8.586443961e-02f, -2.961097285e-02f, -3.309740499e-02f, -5.281032622e-02f,
+    3.465852886e-02f, 2.952360921e-02f, 1.392600592e-02f, -5.704982951e-02f, -6.715451181e-02f, -2.773784101e-03f, -4.001102597e-02f, 1.135941595e-02f,
+    -2.029734664e-02f, 1.642067917e-02f, 1.877547055e-02f, -8.521274477e-02f, -1.925024390e-02f, 3.592794761e-02f, -4.273209348e-02f, 2.760739625e-02f,
+    -2.284665219e-02f, 8.547549695e-02f, -7.750378572e-04f, 3.119837493e-02f, -4.188617691e-02f, -2.539248206e-02f, 4.800701514e-02f, 4.639678821e-02f,
+    -6.882599741e-02f, -2.544365823e-02f, 4.364701360e-02f, 8.888292126e-03f, 1.122715697e-02f, -5.114459991e-02f, -3.399839252e-02f, 2.044264227e-02f,
+    -5.386291444e-02f, -7.669641078e-02f, -3.008540720e-02f, 4.327172041e-02f, 7.955032401e-03f, 4.682343826e-02f, -4.985212907e-02f, -7.698487490e-02f,
+    3.152067366e-04f, 6.177982315e-02f, -1.858458668e-02f, 8.779635280e-02f, 3.593901917e-02f, 7.999079674e-02f, -1.103687286e-02f, 1.858520508e-02f,
+    8.459115028e-02f, 5.459723063e-03f, -3.877529642e-03f, 1.317150053e-02f, 5.105863884e-02f, -2.685919777e-02f, 2.852778882e-03f, 5.797929689e-02f,
+    5.239868537e-02f, -3.853652254e-02f, 1.734883524e-02f, 1.605705917e-02f, -7.017131895e-02f, -8.316433430e-02f, -2.894706279e-02f, 4.731213674e-02f,
+    7.869248092e-02f, -7.712078840e-02f, -1.034200415e-01f, -4.191143438e-02f, -7.505985349e-02f, -6.700485013e-03f, 4.900973290e-02f, 4.592586681e-02f,
+    2.519414388e-02f, 1.342685428e-02f, 4.446720704e-02f, 3.446556628e-02f, 5.110843480e-02f, -8.044092357e-02f, 7.600402925e-03f, 1.604191400e-02f,
+    2.409407496e-02f, 1.666492783e-02f, 2.314924728e-03f, -3.871911019e-02f, -1.224882826e-01f, -2.319504879e-02f, 6.590986624e-03f, 5.373820662e-03f,
+    -7.896567136e-02f, 3.032387048e-02f, -3.620508313e-02f, 1.844044775e-02f, -2.102444135e-02f, -3.350203857e-02f, -7.742321491e-02f, -8.705145121e-02f,
+    3.057007119e-02f, 5.831580982e-02f, -7.129340433e-03f, -7.368137687e-02f, -8.557977155e-03f, -4.397370294e-02f, 4.077388346e-02f, -5.011949688e-03f,
+    -2.311776951e-02f, 2.209610678e-02f, -9.105793387e-02f, -3.240653872e-02f, -1.134890467e-01f, 1.504913624e-02f, -9.157522582e-03f, 1.357989106e-02f,
+    -1.217505187e-01f, -9.669592232e-02f, 9.341806173e-03f, 6.861478090e-02f, 2.023371309e-02f, -5.790702999e-02f, -6.303061545e-02f, 7.204976678e-02f,
+    -5.707537755e-03f, 7.293029130e-02f, -3.595933318e-02f, 9.454472363e-02f, -9.862131625e-02f, 4.047366604e-02f, -4.909786955e-02f, -2.835351229e-02f,
+    -7.818742841e-02f, 5.243840162e-03f, -1.220038831e-01f, 1.430776622e-02f, -5.172927305e-02f, 1.176520996e-02f, -1.218360290e-01f, -4.300421849e-02f,
+    1.172348019e-02f, -7.940632850e-02f, 4.067594558e-02f, -6.374035776e-02f, 6.438795477e-02f, 1.013781503e-02f, -1.251728833e-02f, -7.530207932e-02f,
+    3.332510591e-02f, 3.006564826e-02f, 1.263758540e-02f, 2.053496614e-02f, 8.165191859e-02f, 7.404380292e-02f, -1.987307519e-02f, -2.418593876e-02f,
+    4.167981446e-03f, -7.387875021e-02f, 2.020100132e-02f, -2.490422875e-02f, -8.733909577e-02f, -3.333251923e-02f, -3.976703808e-02f, -1.440682858e-01f,
+    -1.302966848e-02f, 1.443611085e-02f, -3.590661660e-02f, -6.691434234e-02f, -8.762305230e-02f, -1.631723717e-02f, 7.613585889e-02f, 4.929401446e-03f,
+    -2.872078307e-02f, 5.725264549e-03f, -5.229718983e-03f, 4.053801298e-02f, 2.680129558e-02f, 6.297121942e-02f, 4.851143062e-02f, -4.783072695e-02f,
+    -3.305442631e-02f, -3.653789684e-02f, -1.823505759e-02f, -9.274524450e-02f, 1.506289840e-02f, -1.415913999e-01f, -3.017192939e-03f, -8.117090166e-02f,
+    2.082888968e-02f, -1.377716362e-01f, -9.494090825e-02f, 2.778673731e-02f, -6.340929866e-02f, -8.169528842e-02f, 4.826942459e-03f, 4.457024485e-02f,
+    -3.085404634e-02f, 4.438170791e-02f, -2.472915687e-02f, 4.466985539e-02f, 3.554509953e-02f, -6.600271910e-02f, 1.838281006e-02f, 9.797744453e-03f,
+    -2.564360201e-02f, 7.374742627e-02f, 3.641699255e-02f, 7.949280739e-02f, 3.647910058e-02f, -3.834535927e-02f, -1.057357490e-01f, 6.002844125e-02f,
+    -1.014032587e-01f, 1.939673536e-02f, 4.254944250e-02f, 5.545161664e-02f, -8.604528755e-02f, -5.361754820e-02f, -1.176523343e-01f, -1.623968594e-02f,
+    -2.124819532e-02f, 3.873702511e-02f, -1.053836644e-01f, -5.735259503e-02f, -1.079323590e-01f, -9.558261186e-02f, 5.339918286e-02f, -1.007477790e-01f,
+    3.601908684e-02f, -3.481446579e-02f, -4.944512248e-02f, -3.861629590e-02f, 1.232255995e-02f, 4.339282215e-02f, 1.433275640e-02f, -1.428136230e-02f,
+    -1.727395505e-02f, 2.185593545e-02f, 5.416683853e-03f, 3.543781489e-02f, -6.227004156e-02f, -3.251222894e-02f, 1.094467938e-03f, 2.372188121e-02f,
+    1.962634176e-02f, 1.621066034e-02f, -4.058058932e-02f, 5.061955005e-02f, 8.038932458e-03f, -5.560445786e-02f, -8.236765862e-03f, -7.031430304e-02f,
+    1.541852951e-02f, 4.895269871e-02f, -8.552908897e-02f, 1.607199013e-02f, 1.058427989e-02f, -3.436093777e-02f, 6.598970294e-02f, 6.572775543e-02f,
+    3.180079162e-02f, -1.712599397e-02f, 1.202785969e-02f, 3.283472359e-02f, -3.426546231e-02f, -4.754058272e-02f, 5.269137025e-02f, -5.241132528e-02f,
+    -1.382393390e-02f, -6.690331548e-02f, 7.955946028e-02f, 2.163291723e-02f, -6.980757415e-02f, 8.044375479e-02f, 2.261979133e-02f, 7.434889674e-03f,
+    -7.854349911e-03f, -1.464034617e-02f, -5.298204720e-02f, 2.381401509e-02f, 3.141315281e-02f, -6.255581975e-03f, -1.156494021e-02f, 8.024238050e-03f,
+    8.654858172e-02f, -3.036681563e-02f, 7.845367491e-02f, -6.153529510e-02f, -3.829966486e-02f, 3.845557570e-02f, 3.589555621e-02f, 7.401029766e-02f,
+    -4.682491720e-02f, -8.411040902e-02f, -3.941984102e-02f, 6.467762589e-02f, -8.648961782e-02f, 5.980978906e-02f, -4.104373604e-02f, 8.349463344e-02f,
+    -6.291285623e-03f, 6.397562474e-02f, -5.269893259e-02f, -6.779126078e-02f, -3.250368312e-02f, -3.385197371e-02f, -4.802799225e-02f, 8.443403244e-02f,
+    -7.909507304e-02f, 9.078465402e-03f, 8.469830453e-02f, 3.237899393e-02f, 7.714888453e-02f, -2.082772553e-03f, -3.259316832e-02f, 4.038034379e-02f,
+    1.409295201e-02f, -8.534301072e-02f, 5.761335790e-02f, -8.592180908e-02f, 2.808451653e-03f, -8.193098754e-02f, -4.151849076e-02f, 2.768236771e-02f,
+    -8.626141399e-02f, 5.726667121e-02f, -6.184056401e-02f, -4.638494179e-02f, -2.593489364e-02f, 3.619190305e-02f, 1.010497939e-02f, 5.631207675e-02f,
+    3.528117761e-02f, -3.007389791e-02f, 5.085416138e-02f, 3.331063688e-02f, -1.301099360e-02f, 7.881234586e-02f, 1.252063364e-02f, -2.789361775e-02f,
+    7.489092648e-03f, 7.288224995e-02f, -2.349863946e-02f, 4.531867802e-03f, -8.245453238e-03f, 8.448091149e-02f, -2.218380570e-03f, 5.900539458e-02f,
+    7.405169308e-02f, 1.653331146e-02f, -4.102623463e-02f, 1.081243251e-02f, -6.004803255e-02f, -1.321025286e-02f, 6.822444499e-02f, -4.040364549e-02f,
+    -3.702476993e-02f, 8.140388876e-02f, -6.827174872e-02f, 6.192327291e-02f, 3.088746034e-02f, 2.284066379e-02f, -5.636997055e-03f, -4.775635153e-02f,
+    5.360709503e-02f, 7.959908247e-02f, -6.074240059e-02f, -3.401946276e-02f, 3.571130103e-03f, -5.561424792e-02f, -1.521731913e-02f, 1.714923978e-02f,
+    -6.674841791e-02f, 7.639448345e-02f, 7.903753221e-02f, 1.731615327e-02f, 4.297882318e-02f, 2.410370111e-02f, -9.179338068e-02f, 6.387281418e-02f,
+    -6.074327603e-02f, 7.009098679e-02f, -8.202936500e-02f, -7.008165121e-02f, -3.072456829e-02f, -4.707709700e-02f, -5.841912329e-02f, 6.966080517e-02f,
+    -7.381174713e-02f, 3.796473145e-02f, -3.540647402e-02f, 4.611798003e-02f, 3.425147384e-02f, -7.847486436e-02f, -4.702157527e-02f, 1.668653265e-02f,
+    3.874034062e-02f, 5.448335037e-02f, -4.303258285e-02f, 4.480075836e-02f, -1.538873464e-02f, 3.875418007e-02f, 1.978812739e-03f, 3.252265602e-02f,
+    -3.258251399e-02f, 4.987373203e-02f, 7.585532218e-02f, 3.663531318e-02f, 4.600869119e-02f, -4.260690138e-02f, -3.790009767e-02f, -5.375849828e-02f,
+    5.479953438e-02f, -2.477032132e-02f, 5.088408291e-02f, 5.643032119e-02f, -9.397445619e-02f, -6.834833324e-02f, 7.445541024e-02f, -6.317660958e-02f,
+    -3.849544562e-03f, 7.978619635e-02f, -8.266390115e-02f, -4.181536287e-02f, -2.627322264e-02f, -3.544225544e-02f, 6.244474277e-02f, 5.323253572e-03f,
+    -6.516464055e-03f, -2.818638086e-02f, 8.385005407e-03f, -3.695503576e-03f, -8.873455226e-03f, 7.473265380e-02f, 8.456874639e-02f, 5.154444277e-02f,
+    7.528373599e-02f, -2.251498774e-02f, -1.891060267e-03f, 4.831109941e-02f, 3.299438953e-02f, 4.542432353e-02f, -1.306347083e-02f, 1.775320433e-02f,
+    -8.187342435e-02f, -5.135407671e-02f, 8.819642826e-04f, 7.210639864e-02f, 6.354326755e-02f, 2.530271560e-02f, 7.144829631e-02f, -5.347735435e-02f,
+    8.020688593e-02f, 3.426252678e-02f, -3.768063616e-03f, -1.352875680e-02f, -3.601324558e-02f, 9.018689394e-03f, 8.340770751e-02f, -7.943426818e-02f,
+    3.072500229e-02f, -3.697223961e-02f, 5.822742358e-02f, -4.370427132e-02f, 6.839210540e-02f, 6.732616574e-02f, -2.466920763e-02f, 1.013042685e-02f,
+    2.188150957e-02f, -5.673812702e-02f, -6.285677850e-02f, -9.110628814e-02f, 7.310426235e-02f, 7.584460825e-02f, -7.817444205e-02f, -5.505311862e-02f,
+    2.623566613e-02f, -7.741113007e-02f, -9.434145689e-02f, -5.742850900e-02f, 5.069449916e-02f, -8.787626773e-02f, 4.183693603e-02f, 5.159258842e-02f,
+    6.445816159e-02f, -1.458562911e-02f, -8.202175051e-02f, -2.612121589e-02f, 4.874691367e-02f, -1.604538970e-02f, -2.320775390e-02f, -6.848511100e-02f,
+    2.406710945e-02f, -7.587533444e-03f, 4.974814132e-02f, -6.468854845e-02f, -9.475965053e-02f, 2.372304536e-02f, -6.292402744e-02f, -3.053284995e-02f,
+    6.750243157e-02f, 3.356477246e-02f, 1.035066042e-02f, 2.205237933e-02f, -2.187941596e-02f, -6.729549915e-02f, -3.756925871e-04f, 4.335262626e-02f,
+    7.462664694e-02f, 2.157329395e-02f, 2.179517411e-02f, 3.974084556e-02f, -6.898141652e-02f, 1.322050393e-02f, 1.568455994e-02f, -6.590630114e-02f,
+    8.651949465e-02f, -2.604310401e-02f, 5.761232600e-02f, 2.867997438e-02f, -7.677417994e-02f, -7.975843549e-02f, 1.758940890e-02f, -6.251997501e-02f,
+    -4.328730330e-02f, 5.277048051e-02f, 6.241908297e-02f, -1.087260060e-02f, -8.195793629e-02f, -8.852664381e-02f, -3.784273192e-02f, 5.271638930e-02f,
+    -5.097561330e-02f, 5.652301013e-02f, -3.795286268e-02f, 7.471580175e-04f, 5.816131085e-02f, 2.966342680e-02f, -4.009821266e-02f, 3.378932551e-02f,
+    -7.074214518e-02f, -8.293710649e-02f, 8.073841035e-02f, -6.802918017e-02f, 7.078318298e-02f, -2.508019097e-02f, -2.913233079e-02f, 2.047349513e-02f,
+    4.695793241e-02f, -5.921695754e-02f, -4.723713920e-02f, 6.831784546e-02f, 5.218841881e-02f, -5.116815865e-02f, -6.441706419e-02f, -1.293528732e-02f,
+    -3.821608424e-02f, -1.840495621e-03f, 5.263906345e-02f, 6.661862135e-03f, -2.678043582e-02f, 2.761610784e-02f, -7.699651644e-03f, -5.853383616e-02f,
+    1.315060258e-02f, -1.366198901e-02f, -6.784670055e-02f, 7.022029161e-02f, 1.087809354e-02f, 8.328811824e-02f, -3.250380233e-02f, -5.203400180e-02f,
+    -2.403380908e-02f, 3.755603358e-02f, 5.839298479e-03f, 7.122263312e-02f, -4.613948986e-02f, -5.029622465e-02f, -6.419121474e-02f, 5.777864903e-02f,
+    3.657638282e-02f, -8.249264956e-02f, -2.979177423e-02f, -4.348372575e-03f, -4.837160930e-02f, -1.766682789e-02f, -4.158565402e-02f, -7.152928412e-02f,
+    -1.885314099e-02f, 5.517820269e-02f, 2.532155067e-02f, 3.756482154e-02f, -3.865403309e-02f, 6.997052114e-03f, 5.413673446e-02f, 7.862046361e-03f,
+    7.666383684e-02f, -1.344121993e-03f, -3.142932430e-02f, -8.629689366e-02f, -5.401891097e-02f, -1.880277880e-02f, 5.813336372e-02f, 2.953442186e-02f,
+    8.529654704e-03f, 5.222802609e-02f, -6.046026945e-02f, -5.730110407e-02f, -3.926597908e-02f, -1.009920146e-02f, 2.874213457e-02f, -8.350069821e-02f,
+    -8.985633403e-02f, 3.914281726e-02f, -1.165052596e-02f, 1.699314918e-03f, 6.336254627e-02f, -3.970341384e-02f, -4.702750593e-02f, -3.629158810e-02f,
+    7.066732645e-02f, -4.620466381e-02f, 7.579430193e-02f, 2.513300627e-02f, 4.540677369e-02f, -3.767102584e-02f, -6.111711264e-04f, 5.371820554e-02f,
+    2.493018471e-02f, -5.481753871e-02f, -4.414166138e-02f, -6.745230407e-02f, -2.868665941e-02f, -5.770180747e-02f, 2.680161223e-02f, 1.669001393e-02f,
+    2.082519699e-03f, -4.381312057e-02f, 7.449606061e-02f, -5.883748643e-03f, 6.969176978e-02f, 1.499330625e-02f, 7.543493062e-02f, -6.792291254e-02f,
+    5.321893841e-02f, -6.534148008e-02f, 1.403160393e-02f, 5.147226155e-02f, 1.029706467e-02f, -6.929313391e-02f, -4.391163588e-02f, -8.037981391e-02f,
+    5.605591834e-02f, -2.195447683e-03f, -6.681884825e-02f, 6.910682470e-02f, 6.700889021e-02f, -1.574299671e-02f, 5.634122342e-02f, 3.877954790e-03f,
+    -5.516896397e-02f, -8.954788744e-02f, 6.652839482e-03f, 2.244454250e-02f, -5.066083372e-02f, 3.879715502e-02f, -6.401577592e-02f, -6.441819668e-02f,
+    7.519737631e-02f, -2.348382957e-02f, -5.179946497e-02f, 1.637324109e-03f, 5.721135065e-02f, -9.237343818e-02f, 4.605650157e-02f, -3.137426078e-02f,
+    5.908293650e-02f, 1.498417556e-02f, 3.235848993e-02f, 7.239878178e-04f, 3.691342473e-02f, 4.966877401e-03f, -7.788185775e-02f, -2.762601338e-02f,
+    -2.979771420e-02f, 5.635351874e-03f, 5.568947643e-02f, -7.909769565e-02f, 1.297826413e-02f, -6.844598055e-02f, 1.090565044e-02f, 3.380455077e-02f,
+    7.860695571e-02f, 5.519919842e-02f, -6.622603536e-02f, 5.800992996e-02f, 1.056226995e-02f, -7.346890122e-02f, 2.416857285e-03f, -1.510528382e-02f,
+    6.356643885e-02f, -7.548192143e-02f, 4.171914235e-02f, -5.670461804e-02f, -1.196448598e-02f, -3.893004498e-03f, -4.583428055e-02f, -5.878350139e-02f,
+    2.963662148e-03f, -6.989602745e-02f, 4.078358412e-02f, 5.578836799e-02f, 1.936060563e-02f, -8.735350519e-02f, 7.213143259e-02f, -9.177304804e-03f,
+    5.962337181e-02f, -9.576558368e-04f, 5.874686688e-02f, -4.022850841e-02f, 3.869252279e-02f, -5.418895558e-02f, -8.317394555e-02f, -1.478765253e-02f,
+    -6.820078194e-02f, -7.141677290e-02f, -1.817293279e-02f, -6.704419106e-02f, -2.795199119e-02f, 6.335780770e-02f, -3.719777334e-03f, -8.292380720e-02f,
+    -7.361914963e-02f, 6.464657933e-02f, -7.085826993e-02f, -3.394259512e-02f, 2.340950072e-03f, -7.334178686e-02f, -6.037731469e-02f, 6.753382087e-02f,
+    -7.254206389e-02f, -9.520766139e-02f, 1.513553318e-02f, 5.858912319e-02f, -6.308978051e-02f, -3.170714900e-02f, -1.184491348e-02f, -1.354819722e-02f,
+    1.376659889e-02f, 3.407732770e-02f, -6.666784734e-02f, -7.891484350e-02f, 1.062424574e-02f, -8.619192988e-02f, -5.146136135e-02f, 4.243428353e-03f,
+    5.945174396e-02f, -6.157222390e-02f, -5.163863301e-02f, -3.362502437e-03f, -7.098636776e-02f, 2.739725821e-02f, -4.505497962e-02f, 8.059233427e-02f,
+    -4.127749056e-02f, 6.452642381e-03f, -6.759203225e-02f, 4.850726202e-02f, -3.864695132e-02f, 4.632411897e-02f, 3.683825955e-02f, -4.988803342e-02f,
+    -6.001777202e-02f, -6.464723498e-02f, -9.457517415e-02f, 4.030926153e-02f, -2.283785678e-02f, 4.289850220e-02f, 8.972675540e-03f, -7.231755555e-02f,
+    -7.153724879e-02f, -1.062364317e-02f, -6.137781218e-02f, 6.546553224e-02f, -2.783640102e-02f, -3.248709068e-02f, 3.715312108e-02f, -4.164955765e-02f,
+    7.176621258e-02f, 5.463482812e-02f, -6.008333713e-02f, -7.562160492e-03f, 4.612562060e-02f, 5.847163498e-02f, 1.323216502e-02f, -8.425240964e-02f,
+    2.487259917e-03f, 7.144913077e-02f, -3.727887571e-02f, 5.739684403e-02f, -7.757808268e-02f, -4.506847262e-02f, -5.954793096e-02f, 5.137052760e-02f,
+    -9.858223796e-02f, 4.597848654e-02f, 2.913400345e-02f, -4.844141006e-02f, -7.235758752e-02f, 4.466127232e-02f, -9.072810411e-02f, -4.776657745e-02f,
+    -7.154527120e-03f, -8.014023304e-02f, -8.629291505e-02f, 6.256627291e-02f, 3.617674485e-02f, 6.485873461e-02f, 6.176584400e-03f, 5.434334278e-02f,
+    -7.293003798e-02f, 6.183984876e-02f, -7.684801519e-02f, -6.018871069e-02f, -3.213414550e-02f, -2.742011659e-02f, -2.783629298e-02f, -6.069095433e-02f,
+    -3.229827806e-02f, 7.591194659e-02f, -6.171160936e-02f, -4.293113202e-02f, -6.395120919e-02f, 4.693363234e-02f, -3.435111791e-02f, -5.000684410e-03f,
+    -2.141545340e-02f, 3.816452995e-02f, -1.216838323e-02f, 3.670451790e-02f, -2.782005351e-03f, 4.833681136e-02f, 2.143533714e-02f, 3.321060166e-02f,
+    1.079953276e-03f, -2.402951010e-02f, 3.969195485e-02f, -2.406308800e-02f, 3.265988082e-02f, 1.488915086e-02f, 5.510617048e-02f, 1.317202579e-02f,
+    -7.956340909e-02f, 2.142252587e-02f, 6.732944399e-02f, 5.292101577e-02f, -1.424883306e-02f, -8.132085204e-03f, 3.414399922e-02f, -1.438113675e-02f,
+    -2.464764565e-02f, 3.811622784e-02f, -4.326903075e-02f, -1.076638792e-02f, 3.898260742e-02f, 6.056683138e-02f, -8.209756762e-02f, 4.635632038e-02f,
+    -2.502718940e-02f, -4.041985050e-02f, -4.619764537e-02f, -2.524470724e-02f, -7.749348134e-02f, -8.555311710e-02f, 8.347150683e-02f, 4.717977345e-02f,
+    3.060401231e-02f, -8.278869092e-02f, 2.361575700e-02f, -5.312749743e-02f, 5.471836403e-02f, 7.000371814e-02f, 3.117592447e-02f, 5.359101295e-02f,
+    3.966990486e-02f, 4.032333195e-02f, 7.395023108e-02f, -7.043093443e-02f, 5.583731830e-02f, -7.503034174e-02f, -1.037170831e-02f, -2.231645584e-02f,
+    4.190836474e-02f, 7.602712512e-02f, -7.565120701e-03f, -7.355671376e-02f, 5.087072495e-03f, 3.841727972e-03f, -7.776208967e-02f, 1.520838030e-02f,
+    -1.517188177e-02f, 8.624787629e-02f, 4.338864982e-02f, -4.782766849e-02f, -3.778857365e-02f, -6.531571597e-02f, 7.831446826e-02f, 7.274033967e-03f,
+    1.590352319e-02f, 3.962996602e-02f, 4.866167530e-02f, -4.114025459e-02f, 5.326758325e-02f, -7.536897063e-02f, -9.302237630e-02f, -4.604705423e-02f,
+    -6.723472476e-02f, -8.893145621e-02f, -4.700441286e-02f, 1.347630844e-02f, 3.471799940e-02f, 3.066026373e-03f, -7.458178699e-02f, -2.244937792e-02f,
+    5.761003494e-02f, -2.160895802e-02f, 1.189157483e-03f, -1.764177531e-02f, 9.975117631e-03f, 7.087354362e-02f, 4.664823413e-02f, -3.974642605e-02f,
+    6.606832147e-02f, 6.104253232e-03f, 8.019150794e-02f, -1.987195760e-02f, -8.181724697e-02f, -2.554357424e-02f, 8.312065154e-02f, 9.898368269e-03f,
+    -1.955845952e-02f, -5.667678267e-02f, 4.034034209e-04f, -6.087328307e-03f, 1.015183865e-03f, 2.368666790e-02f, -8.638595045e-02f, 1.618709974e-02f,
+    5.563807115e-02f, -9.142649919e-02f, 1.012473181e-02f, 7.497747242e-02f, 1.271856134e-03f, -3.637494147e-02f, -5.453857407e-02f, -5.213407427e-02f,
+    5.062043667e-02f, -1.222670078e-03f, -7.085672021e-02f, -5.517794564e-02f, 4.821315408e-02f, 1.377239823e-03f, 5.812965333e-02f, 8.424775302e-02f,
+    -7.275287528e-03f, 7.482650131e-02f, 6.161643192e-02f, -4.276921600e-02f, -8.397199959e-02f, 5.818345398e-02f, -6.900014728e-02f, 4.836856574e-02f,
+    -7.176246494e-02f, -6.253495067e-02f, -8.020308800e-03f, -4.688285664e-02f, -4.220169410e-02f, 1.899773814e-02f, -1.602968201e-02f, -5.832247436e-02f,
+    2.082263492e-02f, 3.897451237e-02f, -6.643363833e-02f, 6.204019859e-02f, -6.595494598e-02f, -3.597936407e-02f, 2.634124458e-02f, 6.089521945e-02f,
+    2.142704278e-02f, 5.643503368e-02f, -1.681262255e-02f, -8.585996926e-03f, 1.890402287e-02f, 3.950536624e-02f, 3.876810148e-02f, 2.848448791e-02f,
+    5.467308220e-03f, -4.449727014e-02f, -7.592434436e-02f, -4.105086252e-02f, 2.572749928e-02f, 8.649273217e-02f, 6.743712723e-02f, -1.107267104e-03f,
+    -4.803204909e-02f, -7.012678776e-03f, -7.939144969e-03f, 7.946604490e-02f, -6.798473746e-02f, -2.836752310e-02f, -1.974706352e-02f, -1.859220117e-02f,
+    4.429171979e-02f, -2.177767456e-03f, -2.539803833e-02f, 4.247257113e-02f, 7.894614339e-02f, -6.924566627e-02f, -2.488876507e-02f, 4.537321627e-02f,
+    3.708442301e-02f, 7.633854449e-02f, 1.239288598e-02f, 3.386826813e-02f, -5.406697839e-02f, -1.937261969e-02f, 7.329054177e-02f, -5.465489998e-02f,
+    3.082901239e-02f, -5.350410193e-02f, 6.556000561e-02f, 1.362208463e-02f, -4.572920501e-03f, -3.136946633e-02f, -1.594058424e-02f, -1.910413802e-02f,
+    5.349744856e-02f, -2.007600665e-02f, -3.060882539e-02f, 7.574364543e-02f, 4.167929292e-04f, 5.356222391e-05f, 5.269527435e-03f, 1.697697490e-02f,
+    -1.340055466e-02f, -5.962499604e-02f, 4.019844532e-02f, -6.361106783e-02f, 5.252413452e-03f, -6.633351743e-02f, -2.230846882e-02f, -6.249599159e-02f,
+    3.254842758e-02f, 3.001595289e-02f, -5.233749747e-03f, -6.537812948e-02f, -1.676895469e-02f, 7.651421428e-02f, 1.967944205e-02f, 4.620109499e-02f,
+    -3.948133066e-02f, -6.238058954e-02f, -7.922655344e-02f, -2.824450284e-02f, 3.951762617e-02f, -2.224813402e-02f, -6.292642653e-02f, 6.229421496e-02f,
+    -4.308320954e-02f, 1.261521876e-02f, -3.486166522e-02f, 2.932991087e-02f, 2.038195729e-02f, 2.069391310e-03f, -5.908501893e-02f, -6.306338310e-02f,
+    7.645134628e-02f, 3.971460089e-02f, -1.746250503e-02f, 8.193019032e-02f, 4.205287620e-02f, 8.134258538e-02f, -3.299773484e-02f, -8.807697333e-03f,
+    1.243444812e-02f, -3.596733510e-02f, -1.289944202e-01f, -7.260323316e-02f, 2.498509712e-04f, -7.288534939e-02f, 4.901386052e-02f, -2.074233023e-03f,
+    1.495574694e-02f, 6.661202013e-02f, -4.963774607e-02f, -8.268447965e-02f, 6.753286719e-02f, 7.284377515e-02f, -2.866454422e-03f, -7.936109602e-02f,
+    5.995459855e-03f, 3.720422089e-02f, -2.283599228e-02f, -2.981963009e-02f, 6.371872127e-02f, 1.094381660e-01f, -5.725232419e-03f, -5.088490993e-02f,
+    -6.020211428e-02f, 4.800915346e-02f, 3.030391410e-02f, -1.395484060e-01f, -8.422528952e-02f, -9.309922159e-02f, -1.041940302e-01f, -1.023445874e-01f,
+    4.979908094e-02f, -1.776231080e-02f, -1.402841229e-02f, 1.347440109e-02f, -4.746038094e-02f, -9.490158409e-03f, -3.224009275e-02f, -2.564467490e-02f,
+    2.003949881e-02f, 8.269099891e-02f, 1.548285037e-02f, -1.497254521e-02f, 8.506798744e-02f, -1.442834735e-03f, -7.243343443e-02f, 6.999951601e-02f,
+    7.247022819e-03f, 5.713802576e-02f, -8.644422889e-02f, 5.147420615e-02f, -7.219329476e-02f, -9.931740165e-02f, -1.303227842e-01f, -2.191824652e-02f,
+    -1.062815934e-01f, -8.463547565e-03f, -8.400554955e-02f, -1.751356758e-02f, -1.063366607e-01f, -7.910724729e-02f, -6.705014408e-02f, 2.931998856e-02f,
+    -1.422400959e-02f, -8.318835497e-02f, -8.724765480e-02f, 4.051434994e-02f, -2.648139931e-02f, 5.919408426e-02f, -2.691241354e-02f, -6.745629013e-03f,
+    -4.592657834e-02f, -3.681623191e-02f, 5.629770458e-02f, 7.475768775e-02f, 9.785451740e-02f, 3.659098223e-02f, -6.319209188e-02f, 3.257517889e-02f,
+    -9.074324742e-03f, -1.125416979e-01f, 1.683918945e-02f, 1.079830378e-01f, -1.252995580e-01f, -4.112772271e-02f, 1.229091920e-02f, -4.778150842e-02f,
+    1.461439580e-02f, -5.772280321e-02f, -2.617691830e-02f, -1.776717231e-02f, -1.132177189e-01f, 2.177071013e-02f, -1.663362049e-02f, -3.360386565e-02f,
+    7.186965644e-02f, 2.392649092e-02f, 5.604845658e-02f, -9.720377624e-03f, -6.113122031e-02f, 7.605931163e-02f, -6.909567118e-02f, -7.896881551e-02f,
+    1.089888625e-03f, -9.660799056e-02f, -4.530608281e-02f, 3.808917105e-02f, -6.228216738e-02f, -7.145654410e-02f, 1.596470922e-02f, -3.845736012e-02f,
+    -6.842999160e-02f, -4.599946737e-02f, -4.150958732e-02f, -4.288607836e-02f, -7.051420957e-02f, 3.727842122e-04f, -6.669939309e-02f, -7.397662848e-02f,
+    2.910193801e-02f, 6.093127653e-03f, 6.901798770e-03f, 4.008106887e-02f, 6.097589433e-02f, 3.932416067e-02f, 5.365143344e-02f, -6.783359498e-02f,
+    7.179640234e-03f, -4.212594405e-02f, -3.840852156e-02f, 1.317264140e-02f, -4.023171961e-02f, 6.974607706e-03f, 3.258595988e-02f, 7.004662603e-02f,
+    6.953641307e-03f, -6.380372494e-02f, -1.471274067e-02f, -4.643204808e-02f, 6.045439094e-02f, -2.487308718e-02f, -1.820005104e-02f, 1.116247550e-01f,
+    -2.106258273e-02f, 3.705143929e-02f, -2.124185488e-02f, -5.778080318e-03f, 2.965357853e-03f, -2.705191448e-02f, -6.617336720e-02f, 9.721412323e-03f,
+    1.034228224e-02f, 5.304470286e-02f, -5.631967448e-03f, 1.276294887e-02f, -2.758339047e-03f, -7.223364711e-02f, 5.692043155e-02f, 5.274358764e-02f,
+    -3.825137764e-02f, 1.577023976e-02f, -5.835245922e-02f, 4.855967686e-02f, -6.651146710e-02f, -3.807016090e-02f, -1.653250493e-02f, 1.809771545e-02f,
+    -2.765838802e-02f, -9.294722229e-03f, 6.046094373e-02f, -5.207305774e-02f, 5.677268282e-02f, 6.210455298e-02f, 5.261730775e-02f, -3.294433653e-02f,
+    1.000304054e-02f, -2.288276516e-02f, -2.528365143e-02f, -1.814223640e-02f, -8.431576192e-02f, -2.467523143e-02f, -2.582018636e-02f, -7.208741456e-02f,
+    -7.535064220e-02f, 1.395989582e-02f, 7.087689638e-02f, -6.385243684e-02f, -6.113481708e-03f, -3.639559448e-02f, -6.799560785e-02f, 1.743038557e-02f,
+    -2.574023604e-02f, 6.730935723e-02f, -4.390948638e-02f, 1.733827032e-02f, -4.739668965e-02f, 3.587278351e-02f, 1.229787618e-02f, -6.879547611e-03f,
+    -1.906833029e-03f, 3.556870297e-02f, -3.854983300e-02f, -2.569324709e-02f, 8.698996156e-03f, -1.073975023e-02f, -4.324944317e-02f, -4.873414710e-02f,
+    -4.045177251e-02f, -1.949364133e-02f, -5.114439875e-02f, -3.316051513e-02f, -5.921919271e-02f, 2.707102336e-02f, -3.665122017e-02f, -8.618395776e-02f,
+    3.832883388e-02f, -5.199926719e-02f, 3.406526521e-02f, -6.152063236e-02f, -7.329720259e-02f, -6.660673022e-02f, -6.119660661e-02f, 7.185330242e-02f,
+    4.280032963e-02f, -5.541102216e-02f, 4.141096398e-02f, 1.202478912e-02f, -3.016303480e-02f, -6.036471948e-02f, -2.003750391e-02f, -8.681415766e-02f,
+    -9.155571461e-02f, -4.741760343e-02f, 2.767251618e-02f, -3.321123496e-02f, 1.151614636e-02f, -6.941166520e-02f, -5.801745877e-02f, -6.381469965e-02f,
+    8.143143356e-02f, 6.156517193e-02f, -1.929177716e-02f, -6.568650901e-02f, 4.158082232e-02f, 2.757464722e-02f, 1.002091076e-02f, 4.157657549e-02f,
+    -8.553383872e-03f, 9.157640859e-03f, 6.056811288e-02f, -2.116808854e-02f, -3.099066578e-02f, 1.940932870e-02f, -4.810105078e-03f, -4.808707163e-02f,
+    7.992866635e-02f, 5.792205338e-04f, 6.652278453e-02f, 5.771129578e-02f, -3.717731312e-02f, 6.386488676e-02f, -4.637760296e-02f, -6.842787564e-02f,
+    -5.228304863e-02f, 6.302779913e-02f, 5.334794149e-02f, 3.212633729e-02f, -5.551190116e-03f, -9.067001939e-02f, 1.444284525e-02f, 6.987233460e-02f,
+    5.170617253e-02f, -1.544051804e-03f, 5.308397859e-02f, -1.755239675e-03f, 5.559622310e-03f, 9.057836235e-02f, 2.736966824e-03f, 5.467813462e-03f,
+    6.782864034e-02f, -6.558046490e-02f, -1.031571627e-02f, -4.385652021e-02f, -1.266076975e-02f, 7.565286756e-02f, -1.268153917e-02f, 8.320805430e-02f,
+    1.722001284e-02f, -8.158075809e-02f, -4.230364691e-03f, 7.274454087e-02f, 2.581464313e-02f, -4.865557700e-02f, -2.154180221e-02f, -4.364687204e-02f,
+    -6.407755613e-02f, -6.288797408e-02f, -2.025135048e-02f, 4.296215624e-02f, 1.214585677e-01f, -1.971501485e-02f, -5.981169175e-03f, 1.223941892e-01f,
+    6.279868633e-02f, 6.551807374e-02f, -3.257707134e-02f, -5.309185944e-03f, -3.059420735e-02f, -1.725624874e-02f, 4.116362706e-02f, 4.304644093e-02f,
+    1.915687509e-02f, 1.081026625e-03f, 1.226695254e-01f, -2.992261015e-02f, 7.131052017e-02f, -3.543905541e-02f, 3.656425700e-02f, 3.065335751e-02f,
+    -2.672403492e-02f, 1.460901741e-02f, -2.464889735e-02f, 4.956589639e-02f, -9.627379477e-03f, -4.310343415e-02f, -2.575469762e-02f, -1.313819736e-01f,
+    1.412365399e-02f, 5.354189873e-02f, 6.579052657e-02f, -2.077305317e-02f, 2.681143768e-02f, -1.467273850e-02f, 7.639642060e-02f, -3.431035951e-02f,
+    -4.025896639e-02f, -2.003482543e-02f, -5.683643278e-03f, 7.153116912e-02f, 7.718430832e-03f, 7.558649778e-02f, -2.631278709e-03f, -7.210285868e-03f,
+    3.715774789e-02f, -6.809393317e-02f, -9.051905572e-02f, -9.963729978e-02f, -6.578915566e-02f, 1.119267009e-02f, -6.285992567e-04f, -5.860849097e-02f,
+    2.494420111e-02f, 4.739119112e-02f, -1.079376638e-01f, -4.083477706e-02f, -3.307965398e-02f, -4.974559695e-02f, 3.543115780e-02f, 1.359878946e-02f,
+    -3.642525524e-02f, -2.990195900e-02f, -1.333953999e-02f, 5.443658307e-02f, 2.932962030e-02f, 2.138903365e-02f, 5.256550503e-05f, 5.769858137e-02f,
+    2.134087123e-02f, -5.750683136e-03f, 2.148791030e-02f, 9.329540282e-02f, 3.924927115e-02f, -2.645039186e-02f, -5.548215471e-03f, -1.073847115e-01f,
+    -1.201286614e-01f, -1.153404862e-01f, -3.240400925e-02f, -8.706830442e-03f, 7.223697007e-02f, -2.184325457e-02f, 1.290243957e-02f, -2.917930298e-02f,
+    2.984396555e-02f, 4.963327944e-02f, -4.368076846e-02f, 8.102516085e-02f, 6.286613643e-02f, 8.083779365e-02f, 2.808133885e-02f, -1.330238301e-02f,
+    -4.690255225e-02f, -4.950596020e-02f, -6.501378864e-02f, 6.295926124e-02f, 2.733729966e-02f, 9.000643343e-02f, 8.543850482e-02f, -5.844987556e-02f,
+    -9.086539038e-03f, 9.763052687e-03f, 3.701131791e-02f, -2.657312527e-02f, -2.180931903e-02f, -9.153643996e-02f, 1.531492081e-02f, 1.657063328e-02f,
+    -2.356213331e-02f, -1.080270037e-01f, 8.303943276e-02f, -1.037904918e-01f, -8.630890399e-02f, 1.671184227e-02f, 1.935600489e-02f, 4.988981038e-02f,
+    7.991233724e-05f, -7.642462105e-02f, 1.321203168e-02f, -3.525613993e-02f, 1.070217937e-01f, -4.596150294e-02f, -3.633874282e-02f, 8.071184903e-02f,
+    -7.387983613e-03f, 8.486148715e-02f, 6.437234581e-02f, -5.590635166e-02f, -5.720338598e-02f, -5.816650577e-03f, -6.849277020e-02f, -8.065748215e-02f,
+    -1.434446406e-02f, 2.672341187e-03f, 2.841130132e-03f, -6.753899157e-03f, 2.969923615e-02f, 6.870703399e-02f, -1.344684977e-02f, -1.102831438e-01f,
+    -5.458976328e-02f, -2.602446824e-02f, -8.796121180e-02f, 6.790697575e-02f, 1.232392713e-02f, 9.067199379e-02f, 1.475503319e-03f, -4.445364233e-03f,
+    -3.487604205e-03f, 3.015423939e-02f, -4.733121768e-02f, 6.185553223e-02f, 3.174983710e-02f, -3.912506625e-02f, -5.810325593e-02f, 5.621059984e-02f,
+    4.899339378e-02f, -2.103409357e-02f, 3.922422230e-02f, -1.039258465e-01f, -1.377713084e-01f, -3.201640770e-02f, 1.163435876e-01f, 6.006400287e-02f,
+    4.503172636e-02f, -3.715835139e-02f, -6.163943931e-02f, -2.715694951e-03f, -4.734769836e-02f, -9.663560987e-02f, -2.440337092e-02f, 2.497912757e-02f,
+    6.397856027e-02f, -5.805769935e-02f, 2.401001006e-02f, -3.553321213e-02f, -6.206535175e-02f, -7.164729293e-03f, 3.591070324e-02f, -2.672344679e-03f,
+    6.716024131e-02f, -9.923997521e-02f, -2.786060795e-02f, -4.790989682e-02f, -4.607795179e-02f, -9.167790413e-02f, 2.232791856e-02f, -2.580511570e-02f,
+    -4.506022111e-02f, 6.045827270e-02f, -6.962843984e-02f, -3.739802167e-02f, 2.757320553e-02f, -4.864254966e-02f, -7.992290705e-02f, -1.226318479e-01f,
+    6.411031634e-02f, -3.591500595e-02f, 4.385626689e-02f, -1.075495332e-01f, -4.032662511e-02f, -4.155290872e-02f, -6.911189109e-02f, 1.001801807e-02f,
+    -2.530810889e-03f, -1.377474610e-02f, -1.409691107e-02f, -4.379714653e-02f, -1.952300780e-02f, -6.038562953e-02f, 2.465368621e-02f, 2.373111248e-02f,
+    -2.364922687e-02f, -5.500882119e-02f, -1.632099412e-02f, -4.663754627e-02f, -8.252477646e-02f, -4.515039176e-02f, 1.546922885e-02f, -8.433643728e-02f,
+    7.477006316e-02f, -4.547189176e-02f, -3.991932049e-02f, 1.448371913e-02f, 6.332913786e-02f, 3.046133928e-02f, -4.049753025e-02f, -1.069896445e-01f,
+    -3.764101118e-02f, -9.193071723e-02f, 8.332810365e-03f, -7.974054664e-02f, -4.321372509e-02f, -5.750182271e-02f, -3.371637687e-02f, -3.994790465e-02f,
+    7.876633666e-03f, -1.799224503e-02f, -4.977994040e-02f, -1.252638400e-01f, 2.727113478e-02f, -3.255375847e-02f, -1.208259631e-02f, 3.789186850e-02f,
+    -7.585819811e-02f, 6.404147949e-03f, -2.661467530e-02f, -4.726898298e-02f, 4.759863019e-03f, 8.640433848e-02f, -1.425055694e-02f, -8.526622504e-02f,
+    9.736187756e-03f, -3.032141738e-02f, -1.128593758e-01f, -7.349916548e-02f, 4.355830699e-02f, 6.038098596e-03f, -4.468652696e-05f, -7.517337054e-02f,
+    -4.182857927e-03f, 3.830580413e-02f, 1.947685331e-02f, -2.403257787e-02f, 2.877978608e-02f, -2.451578714e-02f, -6.099880487e-02f, 8.865459822e-03f,
+    3.437104821e-02f, 4.372284189e-02f, 1.843085326e-02f, 6.274384260e-02f, -5.992362276e-02f, 6.100805849e-02f, 6.916485727e-02f, 2.644409239e-02f,
+    4.441198707e-02f, -6.896863878e-02f, -8.314231783e-02f, -1.000488698e-01f, 5.378640722e-03f, -2.106308704e-03f, 1.750109717e-02f, -9.629410505e-02f,
+    -6.008363888e-02f, -5.401799828e-02f, 3.852349892e-02f, -1.025760896e-03f, -1.884114929e-03f, -4.627353698e-02f, -2.359582484e-02f, -6.840882450e-02f,
+    -3.557951376e-02f, 7.432018407e-03f, -8.023042977e-02f, -8.898723871e-02f, -2.805575728e-02f, -7.637861371e-02f, -4.401499406e-02f, 2.813465544e-04f,
+    6.290899217e-02f, 9.975568205e-02f, -7.338124514e-02f, 3.387784213e-02f, 7.817687094e-02f, -3.501803055e-02f, 4.533027858e-02f, 1.597166434e-02f,
+    -1.890419051e-02f, 2.730492130e-02f, -7.597608119e-02f, -5.229874328e-02f, -6.849979516e-03f, 3.405049443e-02f, -3.331374750e-02f, -1.485529356e-03f,
+    -1.048898622e-01f, -5.374324974e-03f, -4.666844383e-02f, 1.859056205e-02f, -1.091474816e-01f, -2.730010310e-03f, -2.307845838e-02f, 5.040629581e-02f,
+    -4.293709993e-02f, -7.658762485e-02f, 1.275014579e-01f, 6.698115170e-02f, 6.974136084e-02f, 2.440173551e-02f, -1.237769425e-02f, -5.531742051e-02f,
+    4.894141853e-02f, -1.809127629e-03f, -3.820292652e-03f, 4.517006874e-02f, -4.778150097e-02f, 9.769408498e-04f, 5.728193372e-02f, -6.613317877e-02f,
+    2.031104453e-02f, -1.039506719e-01f, -8.103197068e-02f, 3.459403291e-02f, -7.451348007e-02f, 3.226614324e-03f, -7.972939312e-02f, -2.735793591e-02f,
+    -1.879541762e-02f, 2.193111181e-02f, 1.953472197e-02f, 3.862812370e-02f, 1.553315073e-01f, -3.950098157e-02f, 2.145404667e-01f, 1.552268714e-01f,
+    -1.367990859e-02f, -3.629185259e-02f, 1.462570578e-02f, 2.591005713e-02f, -5.753425509e-02f, 6.575000286e-02f, -8.447194844e-02f, 2.472344413e-02f,
+    -4.652578756e-02f, 7.969702594e-03f, -3.112790920e-02f, 4.083703458e-02f, 5.167318881e-02f, -5.759323481e-03f, 3.906974196e-02f, -2.580357715e-02f,
+    4.320785776e-02f, -4.839428142e-02f, 6.664186716e-02f, 4.923170060e-02f, 4.175655544e-02f, 7.310011983e-02f, -1.234431565e-02f, 3.781472147e-02f,
+    2.850831486e-02f, 1.759865135e-01f, 7.964934409e-02f, 1.195934266e-01f, 1.317092627e-01f, 7.031126320e-02f, 1.669986546e-02f, 5.240336061e-02f,
+    7.934439182e-02f, -7.348103821e-02f, 4.217363894e-03f, 1.280337572e-03f, -1.117218751e-03f, -5.980411917e-02f, 6.060506031e-02f, -4.062566906e-02f,
+    5.048117135e-03f, 2.997076698e-02f, 7.680161297e-02f, 7.688628882e-02f, 3.319439292e-02f, 4.139113799e-02f, 4.777250439e-02f, -1.174570546e-01f,
+    5.134288594e-02f, 4.725904763e-02f, 6.748915464e-02f, 1.495242268e-01f, -5.172218196e-03f, 1.182905734e-01f, 1.716467552e-02f, 1.410948932e-01f,
+    1.607952863e-01f, 1.126372814e-02f, 2.587268502e-02f, 7.414884865e-03f, 6.362099946e-02f, 7.557950914e-03f, -6.234525889e-02f, -7.965551317e-02f,
+    -3.548140451e-02f, -2.982437983e-02f, 6.673842203e-03f, 5.386315659e-02f, 2.615088597e-03f, -8.209436387e-02f, -7.887843251e-02f, -2.204392292e-02f,
+    -5.691274535e-03f, 6.954091042e-02f, -1.359138489e-01f, -3.949438408e-02f, 2.104481310e-02f, 1.018182263e-01f, 6.480547041e-02f, -9.369483590e-02f,
+    -2.097133693e-04f, 1.251018345e-01f, -4.316871241e-02f, -8.071967214e-02f, -1.864945889e-02f, -6.895641237e-02f, -7.023330778e-02f, -1.358481497e-02f,
+    -6.194620579e-02f, 1.772566140e-02f, -1.491489261e-02f, -3.480323032e-02f, 5.446715653e-02f, 7.699820399e-02f, -8.259540796e-02f, -7.822936028e-02f,
+    -3.163902089e-02f, -7.451346517e-02f, -2.942391858e-02f, -7.542730868e-02f, -2.059601247e-02f, 5.203564465e-02f, 2.844480425e-02f, -1.642587036e-02f,
+    4.484803975e-02f, -1.409803331e-02f, 5.078005791e-02f, 1.846972108e-02f, -6.167879701e-02f, 7.055577636e-02f, -8.600047231e-02f, -3.175349161e-02f,
+    -6.859004498e-05f, 4.415577650e-02f, 3.445297480e-04f, -1.764837652e-02f, 2.485518903e-02f, -1.225364208e-02f, -4.382710159e-02f, 1.537275314e-02f,
+    7.100199163e-02f, 5.316501856e-02f, -8.420325816e-02f, 2.239812165e-02f, -4.907852411e-02f, -6.360693276e-02f, 4.826192558e-02f, 1.633621752e-02f,
+    6.364235282e-02f, -3.118956089e-02f, 1.404297817e-02f, -4.283092543e-02f, -5.385049805e-02f, -4.611760378e-03f, 7.726378739e-02f, 2.255768329e-02f,
+    -3.677820042e-02f, -3.466716409e-02f, 8.306549489e-02f, 7.509234548e-02f, 3.182480484e-02f, -3.726056963e-02f, -7.627183199e-02f, -4.666047916e-02f,
+    1.414504647e-02f, 6.485694647e-02f, -7.252711803e-02f, -7.380968332e-02f, 1.184991747e-02f, -8.281074464e-03f, 4.949860275e-02f, 4.849667847e-02f,
+    -2.898619696e-02f, -1.831396669e-02f, 1.195178181e-02f, 1.712024771e-02f, -3.293211386e-02f, -5.902311206e-02f, -1.576958410e-02f, 4.853395373e-02f,
+    5.864062533e-02f, -6.851059198e-02f, -7.728422433e-02f, 7.437578589e-02f, -3.960952163e-02f, 1.371087506e-03f, -3.554898128e-02f, 5.611908063e-02f,
+    -4.766364396e-02f, -5.575449020e-02f, 1.884606481e-02f, 7.220183313e-02f, 8.616474271e-02f, 5.791844428e-02f, -1.155011356e-03f, -4.913000017e-02f,
+    4.469098151e-02f, -1.826299541e-02f, -9.049731493e-02f, -8.652918786e-02f, -8.403898776e-02f, 3.137212619e-02f, 1.455919258e-02f, 7.331755012e-02f,
+    -2.811801061e-02f, 7.160449773e-02f, 6.108087674e-02f, 6.057220325e-02f, 4.760582000e-02f, -2.401325479e-02f, -7.215905190e-02f, -1.120133027e-01f,
+    7.993667386e-03f, 6.666623056e-02f, 6.577403098e-02f, 2.021736465e-02f, 1.034825668e-02f, 2.780176699e-02f, 7.520677149e-02f, 6.559576094e-02f,
+    -6.291920692e-02f, 1.448789984e-02f, 5.355156958e-02f, 1.095210202e-02f, 2.982499823e-02f, -3.400806710e-02f, 3.740527481e-02f, 7.178534567e-02f,
+    -3.771768883e-02f, 4.299360514e-02f, -4.604556412e-02f, -5.127757043e-02f, -2.656074427e-02f, -3.339799494e-02f, 8.792816848e-02f, 2.539470047e-02f,
+    -7.939251512e-02f, 6.657350063e-02f, -5.531170219e-02f, 5.543144420e-03f, 8.512154967e-02f, -3.258002922e-02f, 3.112828918e-02f, 2.958106250e-02f,
+    5.531964824e-02f, 2.502634935e-02f, -6.523094606e-03f, -2.592269704e-02f, 6.907729805e-02f, 7.528066635e-02f, 1.855755597e-02f, 1.436620578e-02f,
+    6.501320284e-03f, 8.967607282e-03f, -1.670120098e-02f, -2.992560854e-03f, 5.979101174e-03f, 6.280925870e-02f, -6.727314740e-02f, -6.097050756e-02f,
+    4.714678973e-02f, -3.513802588e-02f, -3.399777040e-02f, -4.246833175e-02f, -5.844980478e-02f, 2.468983829e-02f, 2.631940320e-02f, -6.231638789e-02f,
+    -5.495818332e-04f, 1.180098858e-02f, -4.775864631e-02f, 3.594944952e-03f, -2.497468889e-02f, 2.100967430e-02f, 5.824471265e-02f, 2.068459243e-02f,
+    6.195454299e-02f, -6.221053749e-02f, 3.456830978e-03f, 6.947938353e-02f, 7.247612625e-02f, 3.807612881e-02f, 6.945087761e-02f, 5.719589069e-02f,
+    3.697496280e-02f, 3.179873899e-02f, 3.984109312e-02f, -4.594008625e-02f, 4.458912089e-02f, 6.351818889e-02f, -4.801321775e-02f, -2.980883420e-02f,
+    6.853876263e-02f, -7.782989740e-02f, 5.709043518e-02f, 1.921747625e-02f, -6.628396921e-03f, 5.364425480e-02f, 3.669704124e-02f, -9.895772673e-03f,
+    -3.366237879e-02f, 4.424408823e-02f, 9.827481955e-02f, 2.371245809e-02f, 3.198854625e-02f, 1.436647028e-02f, 3.422322124e-02f, 2.575516142e-02f,
+    5.010595918e-02f, -6.964511424e-02f, -3.567635268e-02f, 4.540418833e-02f, -5.012114346e-02f, 3.592428938e-02f, 1.781597733e-02f, -3.560260311e-02f,
+    5.814216565e-03f, -3.501342982e-02f, 5.857260153e-02f, -9.969027713e-03f, 9.333368391e-03f, -3.837059252e-03f, -3.839176893e-02f, 6.079231948e-02f,
+    -7.526662201e-03f, -3.189526033e-03f, 6.138365716e-02f, 8.287245035e-02f, -1.802687533e-03f, -3.120756336e-02f, 5.842923373e-02f, 1.045081113e-02f,
+    3.976628184e-02f, 4.669209570e-02f, 4.335465655e-02f, -4.610507935e-02f, -5.429592449e-03f, 1.299756020e-02f, 7.670217659e-03f, 6.548176706e-02f,
+    -4.493076727e-02f, 2.831741981e-02f, 3.563723341e-02f, 2.582609840e-02f, 2.276624925e-02f, 2.389203291e-03f, -5.347154662e-02f, 5.139708892e-02f,
+    -6.088131666e-02f, 2.286500670e-02f, -1.405537501e-02f, -6.335334480e-02f, 6.168822199e-02f, -4.065921158e-02f, 5.247078091e-02f, 9.103675932e-02f,
+    5.173436552e-02f, 1.328442693e-01f, 8.953449130e-02f, 5.973605812e-02f, 1.880168915e-02f, -1.865717024e-02f, 5.324390903e-02f, 4.682956636e-02f,
+    5.927512422e-02f, -5.427911505e-02f, 5.104846507e-02f, -8.155424893e-02f, -4.208696634e-02f, -4.497384187e-03f, -2.626422793e-02f, -2.113184705e-02f,
+    4.107373208e-02f, -2.501962706e-02f, -1.312899217e-02f, -2.871795744e-02f, 2.652810887e-02f, 3.596620634e-02f, 6.741496176e-02f, -4.381242767e-02f,
+    7.420499809e-03f, 2.750328369e-02f, -3.731334582e-02f, 9.001382627e-03f, -2.704202756e-02f, 5.935069919e-02f, 5.474986881e-02f, -5.070561916e-02f,
+    -6.017513201e-02f, -2.856062353e-02f, -4.483355954e-02f, 7.317970693e-02f, 9.622744285e-03f, -2.200699411e-02f, 9.285025299e-02f, -6.848638505e-02f,
+    5.243883654e-02f, -3.172016889e-02f, -7.526106387e-02f, -3.784769773e-02f, -2.610603906e-02f, 7.115609199e-02f, 7.164341956e-02f, 1.040893141e-02f,
+    -5.195962265e-02f, -5.607667379e-03f, -6.362234801e-02f, -1.337603107e-02f, 1.646394655e-02f, 4.071204923e-03f, -2.845969796e-02f, -8.641398512e-03f,
+    -6.819220632e-02f, 1.350065917e-01f, -5.614368245e-02f, 7.018252462e-02f, -2.354951948e-02f, -6.851755083e-02f, -6.393668801e-02f, 5.339920521e-02f,
+    -4.011201113e-02f, -2.825875767e-02f, 8.664856106e-02f, -8.618497103e-02f, -7.479988039e-02f, 4.109350219e-02f, 1.764971996e-03f, 3.416063637e-02f,
+    3.963635117e-02f, 1.157639828e-02f, 2.573639527e-02f, -7.490761578e-02f, -3.728811815e-02f, -6.203273311e-02f, 2.416143939e-02f, -1.579230535e-03f,
+    -4.944995977e-03f, -1.551552415e-01f, -8.375663310e-02f, -1.008750722e-01f, -1.019367427e-01f, -7.911003381e-02f, -2.372331358e-02f, 7.675820589e-02f,
+    -3.787634522e-02f, -5.531048030e-02f, 8.596018702e-02f, 4.261898994e-02f, -1.047669165e-02f, 2.008698322e-02f, 1.003280282e-02f, 2.353288792e-02f,
+    4.026698694e-02f, -4.767739400e-02f, 1.573649608e-02f, 5.066750199e-02f, -1.062491164e-02f, -1.519297343e-02f, 2.173879882e-03f, 6.904394180e-02f,
+    3.147173673e-03f, -4.641411360e-03f, -8.303415030e-02f, -7.659122348e-02f, -1.012050658e-01f, 1.178044127e-03f, -3.636663780e-02f, 2.831913717e-02f,
+    -1.595338620e-02f, -5.381701514e-02f, 5.073583126e-02f, 8.874133229e-03f, 5.042663217e-02f, 1.559540629e-03f, -5.139739066e-02f, 1.350494660e-02f,
+    2.050336823e-02f, 2.016422525e-02f, -5.716287345e-02f, 5.433863774e-02f, -1.892867498e-02f, 7.521118224e-02f, -2.745177783e-02f, 3.294524923e-02f,
+    1.069030166e-02f, 2.896236442e-02f, 5.436592177e-02f, -8.112303168e-02f, 2.618987672e-02f, -2.205339260e-02f, 1.671758480e-02f, 3.992607072e-02f,
+    -5.806388333e-02f, -8.635714650e-02f, 2.553784102e-02f, -1.078482792e-01f, -9.637002647e-02f, 4.556396604e-02f, -1.682743244e-02f, 8.190494776e-02f,
+    2.814983577e-02f, -4.280114174e-02f, -5.286646634e-02f, -8.083401620e-02f, 5.124694481e-02f, -7.728242874e-02f, 5.429172143e-02f, 3.808047622e-02f,
+    4.481814429e-02f, 4.997094721e-02f, 1.471866947e-02f, -9.467029944e-03f, 4.350271821e-02f, 1.697577164e-02f, 4.808111582e-03f, -2.883658744e-03f,
+    2.428962849e-03f, -5.468054861e-02f, -4.410922527e-02f, 6.037242711e-02f, 3.710827231e-02f, 1.868803427e-02f, 4.219510779e-02f, 5.863601342e-02f,
+    8.799227327e-02f, -7.540169358e-02f, -3.894235939e-02f, 4.709526896e-02f, 7.320605218e-02f, -1.838169992e-02f, 1.168640703e-02f, -1.491404790e-02f,
+    -7.750982791e-02f, -8.647006750e-02f, -8.153754473e-02f, -9.622482955e-02f, -7.785924524e-02f, -9.279567748e-02f, 1.464784425e-02f, 3.659551218e-02f,
+    -1.918789931e-02f, 1.139544300e-03f, 7.254140452e-03f, -7.689975202e-02f, -7.327292114e-02f, -5.718653556e-03f, 2.484771796e-02f, -4.142409563e-02f,
+    -1.850579679e-02f, -2.956924029e-02f, -5.004306138e-02f, -3.958528116e-02f, 7.477157563e-02f, 2.290999517e-02f, -4.673305526e-02f, -1.200627163e-02f,
+    7.875801623e-02f, -3.689403459e-02f, 6.784915179e-02f, 7.857312262e-02f, -1.703517511e-02f, -8.639482781e-03f, -3.607763723e-02f, -1.024229974e-01f,
+    -3.473690152e-02f, -7.714431733e-02f, 2.305261977e-02f, -4.391977936e-02f, -5.148860440e-02f, 7.791078836e-02f, -5.308779888e-03f, 2.472148649e-02f,
+    -2.576025203e-02f, 7.579515129e-02f, -4.582226276e-03f, -8.759616874e-03f, -2.644629776e-02f, 2.028428391e-02f, -3.071565181e-02f, -5.907949805e-02f,
+    -5.046218261e-02f, 4.952393100e-02f, 2.215349302e-02f, -6.999838352e-02f, 7.161244750e-02f, 6.781901419e-02f, -4.538058117e-02f, 1.096212044e-01f,
+    5.574133247e-02f, -3.447609767e-02f, 2.411853522e-02f, 9.734447114e-03f, -4.083168879e-02f, -1.705785394e-01f, -1.215258688e-01f, -9.783106297e-02f,
+    -8.503247052e-02f, -4.626679048e-02f, -8.184339851e-02f, -2.900606021e-03f, -1.231901906e-02f, -3.147727251e-02f, -3.016348183e-02f, 6.326609850e-02f,
+    -4.532231763e-02f, -9.406488389e-04f, -5.081112310e-02f, -7.625266910e-03f, 8.163718879e-02f, -8.936420083e-03f, 6.017322093e-02f, 7.034645975e-02f,
+    2.252215147e-02f, 2.680313587e-02f, -2.597287484e-02f, 9.372001141e-02f, -1.916128583e-02f, -6.329102069e-02f, -2.507336996e-02f, -1.253373688e-03f,
+    -7.049979270e-02f, -1.059977412e-01f, -1.156280488e-01f, -7.416913658e-02f, -6.630611420e-02f, -7.442793250e-02f, -1.025016606e-01f, -6.171113253e-02f,
+    4.685983807e-02f, -2.193891443e-02f, 2.529239096e-02f, -3.845920041e-02f, 8.592089266e-02f, 4.072033614e-02f, -3.759067133e-02f, -9.279761463e-03f,
+    2.441791259e-02f, -5.348614231e-02f, -1.327184960e-02f, 6.196433306e-02f, -1.511333883e-02f, -4.737707600e-02f, 7.365456223e-02f, 1.921718754e-02f,
+    3.662095591e-02f, 6.929877400e-02f, 1.063307188e-02f, 6.081035733e-02f, 1.520544570e-02f, 5.246032774e-02f, 2.123652212e-02f, -2.539215423e-02f,
+    6.651137024e-03f, -1.002069786e-01f, 3.872752562e-02f, -6.757226586e-02f, -3.131357953e-02f, 3.191658470e-04f, 7.909262180e-02f, 3.009922244e-02f,
+    1.393465418e-02f, 5.701428652e-02f, 1.449968014e-02f, 3.860221431e-02f, 6.083149463e-03f, -1.125251036e-02f, -9.556572139e-02f, -5.116267875e-02f,
+    3.552494943e-02f, 7.990817726e-02f, -3.319474310e-02f, 9.394179285e-02f, 5.518829450e-02f, 1.085130125e-01f, -2.284990437e-02f, 3.423663229e-02f,
+    -2.089126408e-02f, -3.989907354e-02f, 4.711113404e-03f, 1.707352139e-02f, 5.835713353e-03f, 1.369392406e-02f, 6.912554801e-02f, -4.367643967e-03f,
+    -3.535590321e-02f, -6.177446619e-02f, 4.692431167e-02f, -3.883409500e-02f, 1.102793217e-02f, 6.144098565e-02f, 2.785517648e-02f, -3.180748224e-02f,
+    6.260497123e-02f, 1.649766229e-02f, -1.121670902e-01f, -3.598101437e-02f, 1.916750520e-02f, 4.166768491e-02f, -4.094082862e-02f, 1.441953629e-01f,
+    7.905028015e-02f, -5.283865705e-02f, -6.536489725e-02f, 4.528560117e-02f, 9.072532505e-02f, 6.874420494e-02f, 4.596069828e-02f, 6.264043599e-02f,
+    3.153976798e-02f, 2.640624531e-02f, -3.014544211e-02f, 6.191150472e-02f, -6.243246794e-02f, 3.368398920e-02f, -4.404988140e-02f, -3.824911267e-02f,
+    4.247215018e-02f, 3.958884254e-02f, 9.837057441e-04f, 3.382028267e-02f, 2.646469884e-02f, -1.388490293e-02f, -3.478905931e-02f, 4.182419181e-02f,
+    -2.736532688e-02f, -6.604903936e-02f, 6.508006901e-02f, -3.703786060e-02f, -5.751431361e-02f, 6.388327479e-02f, -8.863282390e-03f, 5.149793252e-02f,
+    -3.799390793e-02f, 1.037418935e-02f, 6.363612134e-03f, -4.730655998e-02f, -4.266923759e-03f, -9.935703129e-03f, 4.743406177e-02f, -5.263081565e-02f,
+    7.906966656e-02f, 3.197382763e-02f, 2.177862637e-02f, -8.112715185e-02f, -3.084738925e-02f, 4.054535553e-02f, 2.717451751e-02f, 1.587744802e-02f,
+    -3.856271878e-02f, -9.948615916e-03f, -5.370960757e-02f, 1.468785107e-02f, -7.634195685e-02f, 2.729048952e-02f, -5.036918446e-02f, 5.833327770e-02f,
+    -3.843624890e-02f, 1.347620226e-02f, 7.239922881e-02f, -4.297528043e-02f, 6.599504501e-02f, -2.848229371e-02f, 1.064224914e-01f, 5.176809803e-02f,
+    3.254190832e-02f, 6.674075127e-02f, 1.202922594e-02f, -4.557957128e-02f, 2.488438413e-02f, 4.471160099e-02f, -9.096491337e-02f, 1.724618673e-02f,
+    3.375866264e-02f, -3.664816171e-02f, -7.528708875e-02f, -8.878722042e-02f, -6.704069674e-02f, 1.581793476e-04f, -1.583103091e-02f, -2.785424143e-02f,
+    -4.961117357e-02f, -5.525911227e-02f, -1.534023881e-02f, 2.404669300e-02f, 6.216913834e-02f, 8.023472503e-03f, 6.250906736e-03f, 1.130944956e-02f,
+    -4.004855454e-02f, 5.729168653e-02f, -2.447515540e-02f, 3.080974892e-02f, -5.567801371e-02f, 5.193302035e-02f, 1.265021227e-02f, 9.060501121e-03f,
+    1.631128415e-02f, 3.791006748e-04f, 1.032918226e-02f, 6.279736012e-02f, -7.442249358e-02f, -6.197138876e-02f, 7.247154415e-02f, -9.116040915e-02f,
+    5.311162770e-02f, -2.788966708e-02f, 6.626476347e-02f, -3.500262648e-02f, 1.031877100e-02f, -7.423058897e-02f, -5.143134668e-02f, 1.843347400e-02f,
+    5.484423414e-02f, 7.509061694e-02f, 5.831513926e-02f, 8.135835081e-02f, -2.821892686e-02f, 7.035487890e-02f, -6.450273097e-03f, -5.233469605e-02f,
+    5.883242562e-02f, -5.233110860e-02f, -7.462663949e-02f, -4.587516561e-02f, -7.132610679e-02f, 5.917678028e-02f, -3.411164507e-02f, 4.026047513e-02f,
+    4.451812431e-02f, 1.998461410e-02f, -8.847479708e-03f, 1.922706142e-02f, 1.137747616e-02f, 6.395608187e-02f, 5.646692216e-02f, 3.016793728e-02f,
+    8.738316596e-03f, 7.536596060e-02f, 3.642010689e-02f, -4.489714652e-02f, 4.138842225e-02f, 7.538172603e-02f, -4.577348754e-02f, -5.697802082e-02f,
+    -2.860032767e-02f, 4.368402809e-02f, -6.852234155e-02f, -1.179242413e-02f, 6.801761687e-02f, -4.820622504e-03f, -2.027370036e-02f, 9.284579009e-02f,
+    -2.969090454e-02f, 3.950022161e-02f, 3.479725868e-02f, 6.457823515e-02f, -1.881882548e-02f, -6.908794492e-02f, -8.981040865e-02f, 1.719284616e-02f,
+    -7.180215418e-02f, -1.854531467e-03f, -5.888681859e-02f, 3.771515191e-02f, -4.274919629e-04f, -5.311935395e-02f, -7.719893754e-02f, 5.361875892e-02f,
+    -8.147735894e-02f, 1.917220652e-03f, 4.241810739e-02f, -4.420848563e-02f, -8.604051173e-02f, 3.881053254e-02f, 4.023559764e-02f, 5.607270449e-02f,
+    -1.533870003e-03f, -4.972181097e-02f, 5.930753052e-02f, 4.487976059e-02f, -6.220680661e-04f, -3.033123724e-02f, -7.504800707e-02f, -4.223330319e-02f,
+    -1.382324938e-02f, -3.785326332e-02f, -1.851082593e-02f, 5.084894598e-03f, -1.876888424e-02f, -7.166273892e-02f, -2.650275081e-02f, -5.929661542e-02f,
+    -4.502840340e-02f, 1.962852478e-02f, -3.939345479e-02f, -1.384899020e-03f, -5.848635733e-02f, -3.565110639e-02f, -3.256812319e-02f, 7.759216428e-02f,
+    -2.150913328e-02f, -2.744352072e-02f, 8.530475199e-03f, 8.279190958e-02f, 1.812184602e-02f, 6.009128690e-02f, -6.489788741e-02f, -1.089302450e-02f,
+    -4.086575285e-02f, 2.675276995e-02f, 7.127681375e-02f, 7.791392505e-02f, 4.024668038e-02f, 7.188935578e-02f, -8.074211329e-02f, -9.802721441e-03f,
+    4.851643741e-02f, 7.601055503e-02f, 3.523317724e-02f, -1.487384737e-02f, -3.339760005e-02f, 6.186877191e-02f, -2.308115363e-03f, -6.011475623e-02f,
+    -1.270221174e-02f, -7.983190566e-02f, 2.996863797e-02f, -4.073705059e-03f, 2.139632776e-02f, -3.837167844e-02f, -7.166875154e-02f, 1.506038476e-02f,
+    7.754144259e-03f, 5.776149407e-02f, 7.666928321e-02f, -3.438897803e-02f, 3.961990029e-02f, -2.259709314e-02f, 4.791093618e-02f, -4.568718001e-02f,
+    7.498866320e-02f, -7.821500301e-03f, -5.949124694e-03f, -5.421423540e-02f, 5.292630196e-02f, -7.698785514e-02f, 6.031687558e-02f, 4.014195502e-02f,
+    3.203588724e-02f, -9.875610471e-03f, -4.724928737e-02f, -7.923347503e-02f, -5.821727961e-02f, 5.984038115e-02f, 8.260913938e-02f, 4.361895844e-02f,
+    5.691998452e-02f, -6.901101023e-02f, -7.974534482e-02f, -4.602924362e-02f, -2.657067962e-02f, 9.879988618e-03f, -6.398238242e-02f, 5.979409069e-02f,
+    -2.971623093e-02f, 3.829571977e-02f, 4.699039832e-02f, 4.720194265e-03f, -4.108631611e-02f, 4.120492935e-02f, -9.804369882e-03f, -8.680214733e-02f,
+    5.253328383e-02f, -3.783794120e-02f, -4.234994948e-02f, 7.452552021e-02f, 2.943459153e-02f, 6.718914211e-02f, 7.624182105e-02f, 6.147904694e-02f,
+    5.444693565e-02f, 2.890614606e-02f, -7.577133924e-02f, -8.351920545e-02f, -1.821815409e-02f, -8.362214081e-03f, 2.417141199e-02f, -5.119237676e-02f,
+    -6.468781829e-02f, -3.207134828e-02f, 2.719269320e-02f, -4.645369574e-02f, -3.167441487e-02f, -4.683917761e-02f, -2.803495340e-02f, -5.558483303e-02f,
+    -2.888764068e-02f, -5.052627623e-02f, 3.321141377e-02f, 5.546350032e-02f, 7.770710438e-02f, -7.077980787e-02f, 7.874007337e-03f, 1.567220688e-02f,
+    8.223794401e-03f, 3.411436081e-02f, 8.433058858e-02f, 5.242783204e-02f, 5.622491986e-02f, -3.971528634e-02f, -1.911483146e-02f, 3.118218295e-02f,
+    7.558020949e-02f, -5.094622448e-02f, -2.558675781e-02f, -3.191484720e-04f, -3.448785096e-02f, 2.433802001e-02f, 1.402801089e-02f, 1.924238401e-03f,
+    -7.597667724e-02f, 2.806396410e-02f, 1.630037441e-03f, -2.806654945e-02f, -7.940622419e-02f, 4.136906564e-02f, 7.013967633e-02f, -4.398298264e-02f,
+    -1.682231762e-02f, 6.157816574e-02f, 7.414733060e-03f, -3.093297407e-02f, -3.385498747e-02f, -6.334291399e-02f, -2.569323778e-02f, 6.059918553e-02f,
+    -1.910183951e-02f, -4.916858301e-02f, 1.020818017e-02f, 8.522830904e-02f, -4.055275396e-02f, 1.690035313e-02f, 4.472803324e-02f, -8.754311502e-02f,
+    5.160429282e-04f, -1.134661678e-02f, -3.480488062e-02f, -6.891921163e-02f, -6.036975235e-02f, 2.382143587e-02f, -6.246350706e-02f, -2.602695487e-02f,
+    3.897479177e-02f, 6.559338421e-02f, -6.051111221e-02f, -7.568581030e-03f, -8.747117221e-02f, -5.965046957e-02f, 3.335575759e-02f, -3.465374187e-02f,
+    -8.230376244e-02f, 8.415597677e-02f, -1.539559569e-02f, 2.851876430e-02f, 7.324340194e-02f, 4.118529335e-02f, -2.547437511e-02f, 3.104683571e-02f,
+    -4.586571455e-02f, 4.162976891e-02f, -7.620150223e-03f, 4.764490947e-02f, 2.917356230e-02f, -4.611680284e-02f, -1.846100087e-03f, -6.325031817e-02f,
+    1.951252297e-02f, -1.220595371e-02f, 5.867389962e-03f, -3.993840422e-03f, -6.193211302e-02f, 6.086795591e-03f, 9.159681387e-03f, -3.412593529e-02f,
+    -1.641524723e-03f, -6.592184305e-03f, 4.833324999e-02f, -1.872720383e-02f, -9.051710367e-05f, -4.613124765e-03f, 1.333208531e-01f, 1.187433228e-01f,
+    5.202004686e-02f, 4.236964881e-02f, 3.346612677e-02f, 1.008053198e-01f, 2.232398279e-02f, 4.469502345e-02f, 1.084193122e-03f, -5.840023514e-03f,
+    3.378367051e-02f, -3.720391914e-02f, 2.681218553e-03f, -7.670525461e-02f, 9.816493839e-02f, -6.239110976e-02f, 2.167730406e-02f, -3.927998990e-02f,
+    2.248559706e-02f, -1.882172190e-02f, 2.528066188e-02f, 7.644701749e-02f, 8.302713931e-02f, 8.734498918e-02f, 1.675845496e-02f, 7.164258510e-02f,
+    -1.604359597e-02f, 1.013220921e-01f, 3.016929887e-02f, 5.543870479e-02f, 1.067423895e-01f, -1.713353954e-02f, 2.312563919e-02f, 4.595934972e-02f,
+    -1.903483644e-02f, 5.507565662e-02f, 6.719944533e-03f, 6.080498174e-02f, 1.916666329e-02f, 5.188029632e-02f, 8.111315221e-02f, -1.804095693e-02f,
+    5.969725084e-03f, 7.277942449e-02f, 2.366282046e-02f, 1.555391215e-02f, 3.550008684e-02f, 2.646479011e-02f, 2.509658039e-02f, -4.398221616e-03f,
+    9.985706955e-02f, 3.842029255e-03f, 2.199916635e-03f, 1.290100515e-01f, 2.323446982e-02f, -1.675249636e-02f, 1.202995703e-02f, 1.047348753e-01f,
+    5.065117031e-02f, 1.295819134e-02f, 8.927339315e-02f, 4.720095545e-03f, 4.680397920e-03f, 7.084187120e-02f, -2.094100491e-04f, 5.511138216e-02f,
+    -6.536697596e-02f, 6.861393154e-02f, 5.517806858e-02f, 3.150446713e-02f, 2.102850936e-02f, 1.161000412e-02f, 4.935296252e-02f, 4.872768372e-02f,
+    -4.714543745e-02f, 3.411503136e-02f, -5.147183314e-03f, 1.029184554e-02f, -4.527448490e-02f, 2.988378704e-02f, -1.296848524e-02f, -2.662890777e-02f,
+    3.285557497e-03f, -5.347736552e-02f, 7.921776921e-02f, 6.276283413e-02f, 7.420987356e-03f, 3.780268505e-02f, 2.676411159e-02f, 4.110984132e-02f,
+    -6.763888150e-02f, 3.574958444e-02f, -4.077018425e-02f, 4.634243995e-02f, -3.861007094e-02f, -1.826425083e-02f, 2.499744855e-02f, 4.482135922e-02f,
+    1.250371486e-01f, -2.729171701e-02f, 6.620113552e-02f, -9.963338263e-03f, 7.578720339e-03f, 3.830210119e-02f, -7.933961460e-04f, 8.906952105e-03f,
+    3.851557896e-02f, -4.250392690e-02f, 1.451826654e-02f, 4.854853824e-02f, -1.285249833e-02f, 2.055863664e-02f, 5.821622536e-02f, -3.134370968e-02f,
+    8.774731308e-02f, 5.692941695e-02f, -3.022750281e-02f, -4.495966248e-03f, -2.035542391e-02f, 4.390551895e-02f, 6.599288899e-04f, 2.542598546e-02f,
+    2.246634476e-02f, -4.374145716e-02f, 4.967872053e-03f, 2.071416937e-02f, -1.505148131e-02f, 7.477629185e-02f, -3.343264805e-03f, 3.606574610e-02f,
+    4.233608022e-02f, -1.030084789e-01f, 8.710240945e-03f, 1.149161160e-02f, -5.302151293e-02f, 1.650048606e-02f, 5.451411754e-02f, 7.967542857e-03f,
+    -7.000257075e-02f, 8.664149046e-02f, 3.336986154e-02f, 4.021171946e-03f, -4.542991985e-03f, -9.043543041e-02f, -1.052432880e-02f, 3.813748434e-02f,
+    -6.784642488e-02f, 9.558598395e-04f, 1.195109362e-04f, -5.995245650e-03f, -5.676404014e-02f, -2.802053094e-02f, -5.852843076e-02f, -6.377608329e-02f,
+    -1.932496764e-02f, 1.652568765e-02f, 8.395944722e-03f, -1.030844525e-01f, 7.783588022e-03f, -1.178332418e-01f, -8.719377220e-03f, 4.738661274e-02f,
+    7.561024278e-02f, 7.036170457e-03f, -8.534204960e-02f, -8.616881073e-02f, -2.976218984e-02f, 1.180023253e-01f, 2.194546908e-02f, -1.991330832e-02f,
+    -5.423504114e-02f, -9.346371517e-03f, 7.915482670e-02f, -6.266731303e-03f, 7.373990119e-02f, 1.262491569e-02f, -1.914920285e-02f, -1.695742086e-02f,
+    -5.865358189e-02f, -1.537471861e-01f, -1.893039793e-02f, 2.395818755e-02f, -5.155830085e-02f, -7.865706831e-02f, -3.552300483e-02f, 2.171962336e-02f,
+    5.464921519e-02f, -6.529449672e-02f, 2.394010872e-02f, -1.241014805e-02f, 1.645699330e-02f, -9.515475482e-02f, -7.986707240e-02f, 6.337781250e-02f,
+    6.480892003e-02f, -3.595743701e-02f, 5.595496669e-02f, -9.027485736e-03f, 4.930274934e-02f, -3.292657202e-03f, 7.316164672e-02f, -2.880047308e-03f,
+    -2.229722962e-02f, -4.310984164e-02f, -4.983912408e-02f, -4.669712484e-02f, -1.168969423e-01f, -5.737021938e-02f, -1.379817910e-02f, -5.905026570e-02f,
+    3.024724312e-02f, -2.537853271e-02f, -1.723388582e-02f, 5.078493431e-02f, -4.670529813e-02f, 2.130584046e-02f, 5.401998013e-02f, -6.389923394e-02f,
+    -3.007855453e-02f, 6.436745077e-02f, 4.026525840e-02f, -7.752785087e-02f, -6.070313230e-02f, 8.261831105e-02f, -4.176607355e-02f, -8.911616355e-02f,
+    -2.838181145e-02f, 3.476247366e-04f, 4.844215140e-02f, -8.603377640e-02f, 1.776685938e-02f, -2.865302190e-02f, 8.602072485e-03f, -3.140027076e-02f,
+    -1.025901213e-01f, -2.027591877e-02f, -6.328328513e-03f, 1.003688201e-02f, 6.822285801e-02f, 4.019263014e-02f, 1.156408712e-02f, -2.039017342e-02f,
+    4.347957671e-02f, 2.713362873e-02f, -4.625232890e-02f, -1.538413111e-02f, -2.701869234e-02f, -2.139317803e-02f, 9.885526448e-02f, 3.031316213e-02f,
+    7.894793153e-02f, 2.882501669e-02f, 7.345170528e-02f, 2.965286002e-02f, 5.999918655e-02f, -2.484015375e-02f, -7.557736337e-02f, -4.295119271e-02f,
+    -1.024952605e-01f, -3.026896343e-02f, 9.101871401e-03f, -1.295112073e-01f, -6.688430905e-03f, -4.033258185e-02f, -6.446570158e-02f, 3.684838116e-02f,
+    6.754196435e-02f, 3.150930256e-02f, 6.826066878e-03f, -3.643991798e-02f, 1.433650497e-02f, 3.407043219e-02f, -5.151247978e-02f, -4.921610281e-02f,
+    -1.378517598e-02f, 6.280355155e-02f, 3.071182780e-02f, -5.597244576e-02f, 1.774717867e-02f, 1.018843800e-02f, 5.632896349e-02f, -1.965522207e-02f,
+    4.633984342e-02f, 5.254174769e-02f, 1.180911087e-03f, 4.799215496e-02f, 3.018006310e-02f, 4.463120922e-02f, -1.688491739e-02f, -8.888353407e-02f,
+    -3.629963100e-02f, 5.544639006e-02f, -5.774460733e-02f, 4.601113498e-02f, -9.058526158e-02f, 5.682824552e-02f, -5.299069732e-02f, 5.526392907e-02f,
+    -3.226121189e-03f, -1.961607672e-02f, 1.873870380e-02f, 4.769036546e-02f, -1.556180976e-02f, -2.056533098e-02f, 5.670250207e-02f, 8.369559050e-02f,
+    -7.484915107e-02f, 5.860956013e-02f, -3.715539584e-03f, 2.579561435e-03f, 4.035704210e-02f, 4.414711520e-02f, -7.639742643e-02f, 1.798350923e-02f,
+    -9.029777721e-03f, -4.087761417e-02f, -4.794191569e-02f, -5.002299696e-02f, 5.371034890e-02f, 9.568585083e-03f, -2.433572337e-02f, 3.453718498e-02f,
+    -1.870700717e-02f, -4.973139241e-02f, -3.381317249e-03f, -3.181406483e-02f, -7.127203792e-02f, -1.268088371e-01f, -9.071505070e-02f, -7.705567032e-02f,
+    3.541757818e-03f, -8.175899088e-02f, -5.927405879e-02f, 1.743157208e-02f, 5.093891919e-02f, 2.538464963e-03f, -8.710495383e-02f, 3.624296561e-02f,
+    4.160758108e-02f, 2.141115256e-02f, -9.461346269e-02f, -1.265677530e-02f, 4.495479167e-02f, -7.972335815e-02f, -3.797911480e-02f, -5.857796595e-02f,
+    -1.492732204e-03f, 2.940424951e-03f, -3.694907948e-02f, -6.666055880e-03f, -5.581082404e-02f, -1.971825212e-02f, 1.422205009e-02f, 5.493224412e-02f,
+    -1.434784848e-02f, -4.416496679e-02f, -9.744260460e-03f, -3.545182571e-02f, -9.759204835e-02f, -8.098294027e-03f, -3.521960601e-02f, -1.622988284e-02f,
+    -2.170252055e-02f, 9.597465396e-03f, 5.271480768e-04f, 1.238509663e-03f, -8.985481411e-02f, -3.611441702e-02f, -4.200255033e-03f, 4.324804991e-02f,
+    4.860215634e-02f, -4.617387801e-02f, -8.022491820e-03f, 1.946001127e-02f, 1.067864988e-02f, 1.057654992e-01f, -4.737263545e-02f, 1.885201968e-02f,
+    2.644523047e-02f, -2.105925605e-02f, -4.379568249e-02f, -5.766390264e-02f, -7.100190967e-02f, 1.591479778e-02f, -9.836443514e-02f, 5.456247553e-02f,
+    -8.363772929e-02f, 3.430080414e-02f, -1.509749610e-02f, 3.429075330e-02f, -3.512845188e-02f, 1.834562421e-02f, -4.567021132e-02f, 4.320002720e-02f,
+    4.317635670e-02f, -1.119731665e-01f, -6.840895861e-02f, -7.044165581e-02f, -7.356796414e-02f, -4.125559703e-02f, -5.481643975e-02f, 1.070290990e-02f,
+    -1.065513957e-02f, 4.250177741e-02f, -3.638994321e-02f, -2.425544709e-02f, -3.135275841e-02f, -8.871783316e-02f, -9.216587245e-02f, -3.372600675e-02f,
+    -4.666311666e-02f, -3.577969037e-03f, 6.169331819e-02f, 4.326952156e-03f, 3.983846307e-02f, -5.111740157e-02f, -3.256437555e-02f, 1.140184700e-03f,
+    -4.754603654e-02f, 5.774164200e-02f, 8.389911801e-02f, 6.836253405e-02f, 2.360987477e-02f, -1.101115271e-01f, -2.191610169e-03f, 4.581712559e-02f,
+    3.657085076e-02f, 6.018859148e-02f, 3.855948150e-02f, -4.853660986e-02f, -9.280726314e-02f, 3.699042276e-02f, -6.348408014e-02f, 4.642871022e-02f,
+    -9.293089807e-02f, -9.190717712e-03f, -4.279634356e-02f, -8.336738497e-02f, 2.024989575e-02f, -8.597657830e-02f, 1.261342224e-02f, 5.769355223e-02f,
+    -5.936679617e-02f, 2.456187643e-02f, 1.588101499e-02f, -6.353616714e-03f, 2.767145634e-05f, 9.963646531e-03f, -7.462286204e-02f, -6.029055268e-02f,
+    -6.895908713e-02f, -1.383925881e-02f, -1.066364441e-02f, 3.968371823e-02f, 6.791330129e-02f, -4.376348108e-03f, -5.684335530e-02f, 1.686142199e-02f,
+    -6.515559554e-02f, 3.892130777e-02f, 5.892395601e-02f, 1.222096500e-03f, -5.583298206e-02f, -3.398074210e-02f, 2.237846609e-03f, -2.375295386e-02f,
+    -3.826579824e-02f, -7.231047750e-02f, 3.428737074e-02f, 4.284463823e-02f, 5.640764534e-02f, -4.492334649e-02f, -6.464962661e-02f, 5.636505783e-02f,
+    1.995926350e-02f, -5.918972194e-02f, -1.977725327e-02f, 2.535849810e-02f, -8.316675574e-02f, -2.961938269e-02f, 7.914771140e-02f, -8.791824803e-03f,
+    9.749657474e-03f, 2.538018487e-02f, -6.422659848e-03f, -5.949967075e-03f, 8.592287195e-04f, -1.925299503e-02f, -5.258321017e-02f, 2.869018540e-02f,
+    1.797809452e-02f, -9.956942871e-03f, 3.777946532e-02f, -8.624161780e-02f, -1.784397103e-02f, 3.922153264e-02f, -1.035170034e-01f, -1.049929038e-01f,
+    -2.026539296e-02f, -3.836600482e-02f, 8.118702471e-02f, 5.540430546e-02f, -1.205825061e-02f, 5.795224011e-02f, -7.968057692e-02f, 4.485192895e-02f,
+    1.081657689e-02f, 4.544458166e-02f, 2.884896286e-02f, 3.034998663e-02f, -1.968088932e-02f, -2.434739098e-02f, 2.029788494e-02f, -1.116515137e-02f,
+    6.291445345e-02f, 4.168093577e-02f, -7.558796089e-03f, 5.912151560e-02f, 2.709720097e-02f, -3.833473427e-03f, 5.887610093e-02f, 7.229403406e-02f,
+    9.394367039e-02f, 2.637096308e-02f, -2.789416350e-03f, -6.998200715e-02f, 5.774821714e-02f, -6.609994452e-04f, 5.615001917e-02f, 2.877281606e-02f,
+    1.333671063e-02f, 1.545059681e-02f, -4.943168163e-02f, -4.128240421e-02f, -2.395415865e-02f, -1.282184664e-02f, 3.645999730e-02f, -4.513452575e-02f,
+    -7.428381592e-02f, -2.897898434e-03f, -2.982048318e-02f, 1.288512489e-03f, -1.047236621e-01f, -6.955073029e-02f, 5.488395691e-02f, -9.056384861e-02f,
+    5.853721499e-02f, 1.071735844e-01f, 3.641646355e-02f, -1.898732036e-03f, 3.194935620e-02f, -7.759357989e-02f, -6.191078573e-02f, 7.460570335e-02f,
+    -3.713463247e-02f, 1.174380630e-02f, 1.409844309e-02f, 4.613235593e-02f, 4.504087567e-02f, 4.285055399e-02f, 2.882992476e-02f, -4.053130373e-02f,
+    -7.903668284e-02f, 5.538344383e-02f, 1.736489870e-02f, 9.393399209e-02f, 2.933677472e-02f, 2.299370803e-02f, -1.482112426e-02f, 9.871632606e-02f,
+    4.329960421e-02f, -4.629703239e-02f, 1.052331701e-01f, 6.655859202e-02f, 9.285705537e-02f, -3.577380627e-02f, 1.147231385e-01f, 2.337548696e-02f,
+    -1.379081950e-04f, 7.659424841e-02f, -6.657805294e-02f, 2.849351615e-02f, -3.688858449e-02f, 3.511899710e-02f, 8.776485920e-04f, -6.818372011e-02f,
+    4.287330806e-02f, -6.917707622e-03f, -3.301935643e-02f, -4.907875136e-02f, -6.119176745e-03f, 4.213036597e-02f, -4.847181216e-02f, 5.171196163e-02f,
+    3.735259920e-02f, -5.494582281e-02f, 1.899070293e-02f, 1.018480957e-02f, 7.907211781e-02f, 4.257181287e-02f, -6.935741007e-02f, -7.284983993e-02f,
+    8.304741979e-02f, -7.229598612e-02f, 6.088131666e-02f, 3.206329048e-02f, -4.176611453e-02f, 4.242506623e-02f, -7.247874141e-02f, -1.084437221e-02f,
+    3.508996218e-02f, -2.903720737e-02f, -2.434170619e-02f, -4.923728481e-02f, 8.360579610e-02f, -3.754561022e-02f, 5.938465893e-02f, 4.810541868e-02f,
+    -4.594683647e-03f, 4.855656996e-02f, 6.641514599e-02f, 4.012760893e-02f, -2.145716548e-02f, 2.851898316e-03f, 5.020651966e-02f, -3.068820806e-03f,
+    -8.528747596e-03f, 6.373854727e-02f, 1.681036688e-02f, -8.475359529e-02f, -3.509180248e-02f, 2.196831815e-02f, -6.156391278e-02f, -9.785889648e-03f,
+    -8.157411218e-02f, 4.538455606e-02f, -2.698187903e-02f, -5.146029219e-02f, 6.811732054e-02f, -2.388700098e-02f, -9.252481163e-03f, -1.429396123e-02f,
+    2.329550683e-03f, 3.631055355e-02f, 3.128287196e-02f, 3.719420731e-02f, -6.216827035e-02f, -5.529592559e-02f, -6.636741012e-02f, 1.021857001e-02f,
+    -7.211522758e-02f, -1.357733831e-02f, -8.082798868e-02f, -4.519305658e-03f, -1.106541678e-01f, -2.306586690e-02f, 3.406702727e-02f, -2.306373604e-02f,
+    -1.057217736e-02f, 4.977302626e-03f, 8.960148692e-02f, -2.921419032e-02f, -4.686711729e-02f, -1.309147221e-03f, -7.452809252e-03f, 5.064109340e-03f,
+    -2.354625612e-02f, -6.366784871e-02f, 8.911736310e-03f, -4.015671462e-02f, 3.861822188e-02f, -1.249769330e-02f, 6.604856253e-02f, -7.251765579e-02f,
+    3.176084161e-02f, 2.654559165e-02f, -6.457506120e-02f, -3.701533750e-02f, -3.357646242e-02f, -7.596939057e-02f, -9.431084245e-02f, -4.098281264e-03f,
+    -7.038960606e-02f, 4.078371078e-02f, -1.150090918e-01f, -7.078419439e-03f, 1.136551891e-02f, 7.196193933e-02f, -2.975450084e-02f, -4.527365789e-02f,
+    6.378526241e-02f, 6.091379002e-02f, -3.934688866e-02f, -2.850410342e-02f, 7.174109668e-02f, 2.109024674e-02f, 4.074021801e-02f, -2.110601217e-02f,
+    -3.210681304e-02f, -3.690086678e-02f, -5.545936525e-03f, -3.045594692e-02f, -3.204755858e-02f, -2.390482649e-02f, 5.911103636e-02f, 2.168829180e-02f,
+    -5.326751247e-02f, -4.267686605e-02f, -3.302925453e-02f, -7.611669600e-02f, 3.149138391e-02f, -7.342376560e-02f, 5.490059778e-02f, -5.024404079e-02f,
+    4.683547840e-02f, 4.628889263e-03f, 2.175506577e-02f, -1.885264501e-04f, 6.284013391e-02f, 3.939146176e-02f, -3.895901889e-02f, -1.566313952e-01f,
+    -5.592035595e-03f, 2.194438875e-02f, -6.640034169e-02f, -5.496374518e-02f, 3.532521427e-03f, 3.629087657e-02f, 3.387077153e-02f, 4.816868901e-02f,
+    3.822979331e-02f, -3.235117346e-02f, -1.600479940e-03f, -5.097417906e-02f, -1.185365207e-02f, -6.257439405e-02f, -3.751053289e-02f, 6.169603020e-02f,
+    -2.656816691e-02f, 1.806451194e-02f, -8.343239315e-03f, 4.387529194e-02f, -5.099121109e-02f, 3.812681884e-02f, 4.767401889e-02f, -6.887920201e-02f,
+    -4.839277640e-02f, 2.319158800e-02f, 1.347684115e-02f, 2.048579417e-02f, -1.157102175e-02f, 6.202016771e-02f, 2.231382206e-02f, 3.591341525e-02f,
+    6.083245575e-02f, 7.675208151e-03f, 6.494454294e-02f, -3.843473503e-03f, 5.578764156e-02f, 5.265060067e-02f, 9.310127050e-02f, -3.451604024e-02f,
+    1.210737899e-01f, 5.048603565e-02f, -5.250093341e-02f, -1.955942810e-02f, 1.966959238e-02f, -3.213534504e-02f, -2.253029495e-02f, 1.269747596e-02f,
+    -5.595065281e-02f, -1.680991426e-02f, -6.169557199e-02f, 2.583283186e-02f, -6.800670922e-02f, -2.166179195e-02f, 2.416350320e-02f, -6.222594157e-02f,
+    5.913863331e-02f, 2.870926447e-02f, -9.053071961e-03f, 1.115638465e-01f, -1.560791582e-02f, 8.437367529e-02f, 5.633316003e-03f, -6.914275885e-02f,
+    2.746046288e-03f, 6.960926950e-02f, -5.570113659e-02f, -5.827952549e-02f, -1.874695905e-02f, -2.919513918e-02f, -5.348886549e-02f, -4.613372311e-02f,
+    1.899220608e-02f, -7.686063647e-02f, 3.289753199e-02f, -4.659315944e-02f, -3.285748186e-03f, 2.731817774e-02f, -3.107871395e-03f, -3.542896884e-04f,
+    -8.477854542e-03f, -5.249002716e-04f, 4.400719330e-02f, 2.321379259e-02f, -2.509750985e-02f, 2.511123382e-02f, 9.946133010e-03f, 3.027762473e-02f,
+    2.627512813e-02f, 8.126211911e-02f, 6.415817887e-02f, -1.007868093e-03f, 3.050700575e-02f, 5.127293989e-02f, -2.215721272e-02f, -4.116300121e-02f,
+    3.429282457e-02f, 7.684308290e-02f, -4.155169427e-02f, -2.062627673e-02f, 3.626598045e-02f, -4.455031455e-02f, 1.300218794e-02f, -5.540569872e-02f,
+    -2.734078281e-02f, 3.376234090e-03f, -3.110971861e-02f, 2.030406904e-04f, 5.359478295e-02f, -1.163009275e-02f, 3.061923571e-02f, -2.194155008e-02f,
+    -1.362133771e-01f, 3.325794637e-02f, 5.736609548e-02f, 9.435584396e-02f, -4.335400183e-03f, 5.216192827e-02f, -2.925223112e-02f, 8.223422617e-02f,
+    2.531447075e-02f, -2.835381217e-02f, -7.049175474e-05f, -1.456452813e-02f, -1.056342479e-02f, -3.997612000e-02f, 8.065838367e-02f, -1.460153796e-02f,
+    -4.608732462e-02f, 1.944423537e-03f, -2.808097517e-03f, -7.306439802e-03f, -9.975775331e-02f, -5.995052680e-02f, -7.248992188e-05f, 5.375014246e-02f,
+    2.232383937e-02f, 5.323608220e-02f, 2.921603061e-02f, -8.894566447e-02f, -9.726694226e-02f, -1.181760356e-01f, 8.506005257e-02f, 6.528733671e-02f,
+    6.845944375e-02f, 8.536100388e-03f, -8.348968625e-02f, -7.040991914e-03f, 6.265565753e-02f, -1.068966743e-02f, -9.932538122e-02f, 2.309386991e-02f,
+    2.270005643e-02f, 1.029152349e-01f, -4.039474577e-02f, 9.492419660e-02f, 6.200048700e-02f, 9.554316290e-03f, -8.309424669e-02f, -8.450570703e-02f,
+    3.609666601e-02f, -3.949050978e-02f, 3.280662000e-02f, 2.036615275e-02f, -6.790753454e-02f, 6.571370363e-02f, 5.570957065e-02f, -6.492710859e-02f,
+    -5.131521448e-02f, -1.598183997e-02f, -4.347018898e-02f, -4.219394550e-02f, 5.245269835e-02f, -4.003156722e-02f, -7.815838605e-02f, -2.215216495e-02f,
+    2.341830358e-02f, -7.699128985e-02f, 3.334129602e-02f, -6.989222765e-02f, -4.647016060e-03f, 1.630790159e-02f, 9.297432005e-02f, -6.958692521e-02f,
+    6.878761202e-02f, -2.058870159e-02f, -7.562452555e-02f, 9.405717999e-02f, -2.028133720e-03f, 6.108895410e-03f, 1.421837416e-02f, 1.323415991e-02f,
+    1.182998717e-01f, 1.575270481e-02f, -2.493878268e-02f, -5.845007673e-02f, -5.861513689e-02f, -1.032811180e-01f, -5.500071868e-02f, 1.772522740e-02f,
+    -7.330738753e-02f, 4.690973461e-02f, 4.825160652e-02f, 7.244082168e-03f, -5.479860585e-03f, 3.588387370e-02f, 1.716639660e-02f, 2.723861299e-02f,
+    -3.258237243e-02f, 3.258117661e-02f, 4.959444702e-02f, -4.672422539e-03f, -4.856578261e-02f, -9.417094290e-03f, 5.961748213e-02f, 2.441890724e-02f,
+    8.598529734e-03f, -3.088566475e-02f, 5.145655200e-02f, 6.245430559e-02f, -2.022757009e-02f, 7.686699927e-02f, -2.676307969e-02f, -1.426613145e-02f,
+    3.364792839e-02f, -1.319914684e-02f, -1.130314097e-01f, -1.778124273e-02f, -3.002583981e-03f, -2.448945865e-02f, 7.782467455e-02f, -1.461817883e-02f,
+    1.736731641e-02f, 3.867609426e-02f, -3.207878768e-02f, 7.700512558e-02f, 1.172009669e-02f, 2.656760626e-02f, -6.671881676e-02f, -2.581262961e-02f,
+    9.312931448e-02f, 3.230589256e-02f, -5.499429069e-03f, -1.500284672e-02f, 6.511113793e-02f, 1.185461297e-03f, -3.585673496e-02f, -3.540763631e-02f,
+    -1.260646619e-02f, -8.227770030e-02f, -4.011372849e-02f, 1.486156695e-02f, 2.409742959e-02f, -4.456476495e-02f, -3.385675326e-02f, 7.821349800e-02f,
+    -3.169082478e-02f, -4.176456854e-02f, -1.186758094e-02f, 6.297827512e-02f, -4.310349375e-02f, -3.109314851e-02f, 4.821048677e-02f, 1.877858303e-02f,
+    -4.370249063e-02f, -9.280686826e-02f, 1.801344566e-02f, -2.142117731e-02f, -1.490877103e-02f, 6.275290251e-02f, 9.364277869e-02f, -9.853717871e-03f,
+    9.861315042e-02f, -3.064630553e-02f, -8.175475150e-02f, -8.823931421e-05f, -3.185019270e-02f, -6.808806211e-02f, -7.106247358e-04f, -4.136513546e-02f,
+    6.219101325e-02f, -4.589588568e-02f, -3.499664739e-02f, -7.864798605e-02f, -4.113080725e-02f, -7.150879502e-02f, 3.924970329e-02f, -2.149103023e-02f,
+    -7.643887307e-03f, 6.218143925e-02f, 2.327645943e-02f, -1.287524998e-01f, -9.607694298e-02f, -1.780656911e-02f, -5.907227471e-02f, 1.408422459e-02f,
+    -2.933534048e-02f, 1.747249626e-02f, -3.382756934e-02f, -2.640102431e-02f, 5.136055872e-02f, -5.014002696e-02f, 6.441962905e-03f, -4.839969333e-03f,
+    -7.818659768e-03f, 5.157707632e-02f, 4.727327079e-02f, 4.241041467e-02f, 4.086048529e-02f, 6.050730497e-02f, 8.222294599e-02f, -1.964186318e-02f,
+    -4.702496901e-02f, -2.658366784e-02f, 7.213167846e-02f, 5.764630064e-02f, -4.892780259e-02f, -1.073076352e-01f, -6.785060465e-02f, -1.772752032e-02f,
+    2.944137901e-02f, -6.445218460e-04f, -6.510593742e-02f, 6.332306564e-02f, 4.437667131e-02f, 4.932573438e-02f, 5.491937324e-02f, -2.362822555e-02f,
+    1.236439589e-02f, -4.867243394e-02f, -6.047599763e-02f, -6.723418087e-02f, 3.876179457e-02f, -8.178643882e-02f, -9.315681458e-02f, 5.622859299e-02f,
+    -2.884528227e-02f, 3.569986671e-02f, 7.485608757e-02f, -6.529575586e-02f, -6.386443228e-02f, -6.124703586e-02f, -2.085274458e-02f, -9.200264513e-02f,
+    -2.000306547e-02f, -9.048365057e-02f, -1.199058816e-01f, 6.114768237e-02f, 4.101956263e-03f, 3.904243186e-02f, 8.821604401e-02f, 4.257525783e-03f,
+    1.744778454e-02f, -1.037718449e-02f, -6.355832797e-03f, -8.868375421e-02f, 4.507094622e-02f, 3.063799627e-02f, 7.537728525e-04f, 3.630660474e-02f,
+    -9.301983565e-02f, -9.083141573e-03f, -9.503595531e-02f, 2.945961617e-02f, -1.078893710e-02f, -3.574306890e-02f, 5.350421369e-02f, 5.080113932e-02f,
+    -4.799894989e-03f, 7.926893234e-02f, 2.296806872e-02f, -3.321861103e-02f, -3.031116538e-02f, -5.538244545e-02f, -1.571133435e-01f, -6.376653910e-02f,
+    5.435730144e-02f, -3.537080437e-02f, -9.951477870e-03f, 6.936793029e-02f, 1.180714276e-02f, 7.608247455e-03f, -7.306152955e-03f, -1.587756351e-02f,
+    -5.129180476e-02f, -8.931763470e-02f, -3.514573351e-02f, 4.242711142e-02f, -1.241736207e-02f, -2.388359234e-02f, 6.355780363e-02f, -1.028527170e-01f,
+    -8.561836183e-02f, -5.254151300e-02f, -6.213171408e-03f, 8.362911642e-02f, 3.094546497e-02f, -1.166148484e-02f, -1.884993166e-02f, -2.227229625e-02f,
+    -3.955312073e-02f, -9.742049873e-02f, -7.603961974e-02f, -1.297008246e-02f, 5.351644754e-02f, 2.443357185e-02f, 9.035148472e-02f, 4.783663526e-02f,
+    4.549087584e-02f, -8.151163161e-02f, -1.112381346e-03f, -7.030839100e-03f, 3.697608039e-02f, 1.151024923e-02f, -3.183168545e-02f, -7.299428433e-02f,
+    6.249431521e-02f, -7.845162414e-03f, -5.881780386e-02f, -1.106314082e-02f, -4.322291911e-02f, -2.767631039e-02f, 8.699752507e-04f, 6.305469573e-02f,
+    5.670107901e-02f, -3.450125828e-02f, 4.157627374e-02f, -3.600220010e-02f, -7.697136700e-02f, -1.059916336e-02f, -5.024424754e-04f, -1.708237804e-03f,
+    2.075191587e-02f, -1.904715411e-02f, -3.643050417e-02f, -2.522703074e-02f, -5.233903881e-03f, -8.674405515e-02f, -2.119777352e-02f, -2.131152712e-02f,
+    -3.375102952e-02f, 3.791514039e-02f, -2.450317703e-02f, 4.063345492e-02f, -2.912320569e-02f, 2.518675104e-02f, -7.813063264e-02f, -7.346923649e-02f,
+    6.428613514e-02f, 3.558804095e-02f, -1.171679329e-02f, -4.321388900e-02f, -8.533673733e-02f, 2.205342799e-02f, 7.809079438e-02f, -9.420523047e-02f,
+    -8.356489986e-02f, 2.612514049e-02f, 5.470360443e-02f, 2.702493221e-02f, 2.550137974e-02f, -6.275388598e-02f, 4.710068461e-03f, 1.675195619e-02f,
+    -3.260064870e-02f, 2.550376812e-03f, -1.729934476e-02f, -3.096907213e-02f, -3.595547751e-02f, 6.096535176e-02f, -2.801517770e-02f, -7.880142890e-03f,
+    -1.582621597e-02f, 1.238421071e-02f, -1.028256714e-01f, -2.791734040e-02f, 3.623522073e-02f, -1.930713654e-02f, 1.795915514e-02f, 1.632679999e-02f,
+    -3.966090083e-02f, 4.067036510e-02f, 3.274773806e-02f, 4.693969712e-02f, 2.529265918e-02f, -7.434351742e-02f, -4.049265385e-02f, -1.557437610e-02f,
+    -5.091068894e-02f, 2.808171511e-02f, -1.080545597e-02f, -4.430461302e-02f, 6.132328510e-02f, -2.109429613e-02f, 1.020187885e-02f, 1.796637848e-02f,
+    -8.397974074e-02f, -8.397851139e-02f, -3.758042306e-02f, 3.182356805e-02f, -3.730151057e-02f, 5.324771255e-02f, -9.437200427e-02f, 4.845685512e-02f,
+    1.750246994e-02f, -7.288584858e-02f, -6.940023601e-02f, 7.999630272e-02f, -2.782521397e-02f, -5.509436131e-02f, 6.690587103e-02f, 1.259327633e-03f,
+    -9.496439993e-02f, -7.731977105e-02f, -4.077362642e-02f, -9.588647634e-02f, -4.414589703e-02f, -1.779093966e-02f, 3.075640649e-02f, 1.748167910e-02f,
+    -4.858180473e-04f, 6.757453550e-03f, 2.615238354e-02f, 3.740740195e-02f, 5.509674177e-02f, 8.585212380e-02f, -7.470610738e-02f, 7.475666702e-03f,
+    7.321366668e-02f, 6.600348651e-02f, -9.135385975e-03f, -1.132109463e-01f, -3.527783230e-02f, -2.782060578e-02f, 6.995594501e-02f, 3.632899374e-02f,
+    5.809937418e-02f, -4.981399328e-02f, 6.693723798e-02f, -1.054163873e-01f, -1.621560426e-03f, -4.103230312e-02f, -6.868629903e-02f, -6.265055388e-02f,
+    -4.944740795e-03f, -7.687255740e-02f, 3.983585909e-02f, 1.184439636e-03f, 3.900879622e-02f, 2.042369358e-02f, -1.544446568e-03f, -6.599850208e-02f,
+    -8.975734003e-03f, 6.221669167e-02f, 3.460237756e-02f, -9.072017856e-03f, 2.729677036e-02f, 2.198433690e-02f, -4.250479862e-03f, 1.028167084e-02f,
+    6.398601085e-02f, 5.052885413e-02f, 2.645790577e-02f, -3.439682350e-02f, 8.290304244e-02f, -7.145159692e-02f, -5.286501348e-02f, -7.677561790e-02f,
+    2.839861624e-02f, -1.570187509e-02f, 2.063596435e-02f, 2.936151996e-02f, -1.377989650e-01f, -1.296534389e-01f, -1.219276711e-01f, -7.154855877e-02f,
+    -8.195050061e-02f, -1.383958850e-02f, -1.429922972e-02f, 1.634628163e-03f, 7.887595333e-03f, -3.086521290e-03f, -2.885045856e-02f, -8.845035732e-02f,
+    -6.679327041e-02f, 5.488424376e-02f, -2.913872525e-02f, -4.613970965e-02f, -3.833858529e-03f, -1.947664469e-02f, 1.017258316e-02f, -1.859387010e-02f,
+    -6.585179269e-02f, 5.826060474e-02f, 2.102821320e-02f, -5.118867382e-02f, -2.350714803e-02f, 1.720205694e-02f, -7.902926207e-02f, -7.997630537e-02f,
+    -7.810100913e-03f, -2.194154635e-02f, 3.372016549e-02f, 5.701934919e-03f, -1.328944862e-01f, -1.878364570e-02f, -1.376587301e-01f, -1.175595634e-02f,
+    2.013838477e-02f, -5.011914670e-02f, -9.757991135e-02f, -7.637965679e-02f, -1.069900617e-01f, -8.366682567e-03f, 2.105063945e-02f, 2.695776522e-03f,
+    6.932237744e-02f, 5.474884808e-02f, 8.379645646e-03f, -5.547969043e-02f, -7.784058154e-02f, -4.703804851e-03f, 7.072131336e-02f, 3.687858582e-02f,
+    -8.263643086e-02f, 1.477843523e-02f, 2.610786259e-02f, -1.730237389e-03f, 6.383007020e-02f, -6.656876206e-02f, 4.255374148e-02f, 2.301248908e-02f,
+    -2.004302666e-02f, -1.034522206e-01f, -8.867432177e-02f, 3.285412490e-02f, 5.464205518e-02f, -2.861460857e-02f, -1.815971546e-02f, -8.784426376e-03f,
+    1.181075163e-02f, 4.177577794e-02f, 1.194937527e-02f, -8.031968772e-02f, -1.684793085e-02f, 2.438240498e-02f, 2.573490888e-02f, 2.689623088e-02f,
+};
+
+static const float TEST_MODEL_fc_bias_0[16] __attribute__((aligned(4))) = {
+    -2.906808257e-02f, -2.535588853e-02f, -2.571916208e-02f, -3.340749443e-02f, -1.458672062e-02f, -3.778142110e-02f, -1.864190400e-02f, -2.177993581e-02f,
+    -3.381760791e-02f, -3.145468887e-03f, -3.470837697e-02f, -1.431760192e-02f, -1.621253230e-02f, -2.215900458e-02f, -8.448129520e-03f, -1.323478967e-01f,
+};
+
+static const float TEST_MODEL_fc_float_1_weights[256] __attribute__((aligned(4))) = {
+    2.471558005e-01f, -8.787157387e-02f, 1.034278870e-01f, 1.121155843e-01f, 1.288125515e-01f, 1.069132984e-01f, 2.879985571e-01f, -3.757771254e-01f,
+    -1.039558053e-01f, -3.887584805e-01f, -2.611288130e-01f, -2.274107933e-01f, -7.855412364e-02f, 4.881056026e-02f, 2.426684350e-01f, 1.866422445e-01f,
+    -2.777791619e-01f, 1.096919328e-01f, -5.038787723e-01f, 1.970681995e-01f, 3.329713345e-01f, -2.909944654e-01f, -3.749123514e-01f, -2.858802378e-01f,
+    -3.239118457e-01f, 2.960385084e-01f, -4.233602285e-01f, 3.846522272e-01f, -2.503612638e-01f, -7.884063572e-02f, -1.271333843e-01f, 1.033064649e-01f,
+    -1.366844624e-01f, 2.602092326e-01f, 9.020406753e-02f, -4.079159796e-01f, 2.739965022e-01f, 1.329370588e-01f, -1.536777895e-02f, 5.379441381e-02f,
+    -2.601756342e-02f, -2.966234088e-01f, 3.521273136e-01f, 3.313485384e-01f, -2.126579583e-01f, 2.872415185e-01f, -4.382527992e-02f, -1.905963719e-01f,
+    2.212858349e-01f, 2.625053227e-01f, -4.087367654e-01f, 2.851059735e-01f, -4.026227295e-01f, 2.702987492e-01f, 2.730561495e-01f, 2.130895108e-01f,
+    1.957812160e-01f, -1.687282920e-01f, -2.308641970e-01f, 1.891989708e-01f, -2.081218809e-01f, -2.793738618e-02f, 5.245340243e-02f, -4.277591407e-02f,
+    -9.753395617e-02f, -2.731814384e-01f, 1.265156567e-01f, -3.836037517e-01f, -1.477819979e-01f, 3.247732818e-01f, -1.491887420e-01f, -3.829735518e-01f,
+    -2.685900927e-01f, -1.633644849e-01f, -3.313077390e-01f, -3.320869505e-01f, 7.993594557e-02f, 3.829262555e-01f, 2.379062474e-01f, -2.534924150e-01f,
+    4.420133233e-01f, 3.372243643e-01f, -1.798198968e-01f, -2.528530061e-01f, 2.723366916e-01f, -2.047917098e-01f, -3.192852437e-01f, -1.140783262e-02f,
+    9.358795732e-02f, 3.478966355e-01f, -1.830492169e-01f, 2.347849905e-01f, 1.181640923e-01f, -1.622496545e-01f, 4.752326012e-02f, -1.967473179e-01f,
+    3.203721344e-01f, 2.648100555e-01f, -1.477701366e-01f, -8.755644411e-02f, 1.671192348e-01f, 3.701964915e-01f, 9.974534810e-02f, 3.883560300e-01f,
+    3.747607768e-01f, 4.838669300e-02f, -2.371982485e-01f, -3.726678842e-04f, -1.314226985e-01f, -2.347202301e-01f, -3.780415356e-01f, 4.463272542e-02f,
+    3.035379946e-01f, -3.781960309e-01f, 2.617937624e-01f, -2.747242451e-01f, -2.006614953e-01f, 1.982216388e-01f, 5.476253107e-02f, -7.374288887e-02f,
+    -3.358652592e-01f, -2.976894844e-03f, 8.959213644e-02f, 4.303011894e-01f, 3.098987043e-01f, -2.685505748e-01f, -3.755672276e-01f, 3.979300261e-01f,
+    1.070277989e-01f, -2.893082798e-01f, 6.556950510e-02f, 1.740824133e-01f, 2.086045146e-01f, -1.336952299e-01f, -1.628285088e-02f, -3.943092525e-01f,
+    1.669186950e-01f, 5.136053264e-02f, 3.677896410e-02f, -4.321480095e-01f, 1.193122491e-01f, -1.278182864e-01f, 2.136320621e-01f, 2.382565439e-01f,
+    2.915899754e-01f, -3.045141697e-01f, 2.255250933e-03f, -2.380615324e-01f, -1.577121555e-03f, -7.272426784e-02f, 2.446699739e-01f, -1.549846083e-01f,
+    -1.762797236e-01f, -2.298694402e-01f, -3.303951621e-01f, 2.081897855e-01f, -5.855260417e-02f, 4.275114238e-01f, -2.391434610e-01f, -1.815357059e-01f,
+    -1.820333749e-01f, 3.162052631e-01f, -5.590165034e-02f, -2.305672765e-01f, -3.578613698e-01f, -1.399564464e-02f, -4.476702958e-02f, -3.475520313e-01f,
+    2.461743504e-01f, 1.874297559e-01f, -6.634512544e-02f, 4.454482347e-03f, 9.118698537e-03f, 1.236548871e-01f, -3.715940118e-01f, 1.747864634e-01f,
+    -2.118024677e-01f, 3.025668263e-01f, -2.719998360e-01f, -4.134526551e-01f, -1.776415557e-01f, 1.962099224e-01f, -4.393006563e-01f, 3.595593274e-01f,
+    -1.405685395e-01f, 1.163672470e-02f, -6.511113793e-02f, -1.957002878e-01f, 2.084012032e-01f, -5.046934262e-02f, 3.218776584e-01f, -5.318914354e-02f,
+    1.262205839e-01f, -3.551203907e-01f, 3.847476095e-02f, 2.421829998e-01f, 2.249119133e-01f, -4.370208085e-01f, -3.947344124e-01f, 2.048692703e-01f,
+    1.150062084e-01f, -1.819122136e-01f, 1.485129297e-01f, -4.318090528e-02f, -3.651118577e-01f, 4.036827981e-01f, 3.460210562e-01f, -8.108523488e-02f,
+    -2.395698726e-01f, -6.995925307e-02f, 3.704002798e-01f, -2.081954181e-01f, 3.629055619e-01f, 2.168343812e-01f, 3.338849843e-01f, -1.183153018e-01f,
+    -2.089315355e-01f, 3.174372017e-01f, -1.220751777e-01f, 2.115266919e-01f, 5.657603964e-03f, -1.122580692e-01f, -3.916055262e-01f, 1.723951660e-03f,
+    -4.149027467e-01f, -1.941294968e-01f, -2.272094339e-01f, -2.589852512e-01f, 2.037364393e-01f, 3.711670339e-01f, 3.748415411e-01f, 3.742226958e-01f,
+    5.274494737e-02f, -1.382130384e-01f, 2.550483644e-01f, -1.832749881e-02f, -1.090774238e-01f, 1.977736652e-01f, -3.719101474e-02f, 4.117984325e-02f,
+    6.663008034e-02f, -7.601210475e-02f, 2.705307901e-01f, -8.172542602e-02f, 1.485646814e-01f, 3.410594761e-01f, 3.504639268e-01f, 2.765978575e-01f,
+    -4.019425809e-01f, -1.617061389e-05f, -3.377996385e-01f, 2.744916975e-01f, 1.781102419e-01f, 8.749001473e-02f, -1.389779449e-01f, -3.008456528e-01f,
+};
+
+static const float TEST_MODEL_fc_bias_1[16] __attribute__((aligned(4))) = {
+    -1.736683547e-01f, 6.310200691e-01f, 3.806762993e-01f, -2.790568769e-02f, -3.754146397e-03f, -1.547143310e-01f, -5.475244671e-02f, 1.046868507e-02f,
+    -3.513761982e-02f, 6.707034707e-01f, -1.485709250e-01f, -1.073997468e-03f, -3.950461000e-02f, -8.828429854e-04f, -2.140079141e-01f, -1.162733734e-01f,
+};
+
+static const float TEST_MODEL_fc_float_2_weights[160] __attribute__((aligned(4))) = {
+    -1.818435639e-01f, -3.271497786e-01f, 2.638057768e-01f, -4.130510390e-01f, -3.366244733e-01f, 1.460515857e-01f, 4.044609964e-01f, -4.708631635e-01f,
+    -4.446982443e-01f, -3.084433377e-01f, -3.571842611e-01f, 9.133862704e-02f, -1.429202557e-01f, -1.901401579e-01f, -4.680180848e-01f, -1.035961434e-01f,
+    -8.143804222e-02f, -2.181440890e-01f, -4.614563882e-01f, -2.185821831e-01f, -2.536985576e-01f, -4.225172848e-02f, 3.188087046e-01f, 4.459692165e-02f,
+    -7.518127561e-02f, 1.466864347e-01f, 2.342489809e-01f, -3.997414410e-01f, 2.473521382e-01f, 1.905949712e-01f, 2.728975415e-01f, -3.094923198e-01f,
+    -2.658845186e-01f, 1.930797100e-02f, -9.770294279e-02f, -2.277726382e-01f, 1.295155734e-01f, 7.653806359e-02f, -1.029809341e-01f, 1.303509772e-01f,
+    -1.080427915e-01f, -3.811800778e-01f, 1.215924993e-01f, -8.712068200e-02f, 1.021518856e-01f, 2.712693214e-01f, 1.874935031e-01f, -2.535662949e-01f,
+    2.354108542e-02f, 4.790090322e-01f, -3.257150352e-01f, 3.878694177e-01f, 1.350133717e-01f, -2.682818770e-01f, -2.071737945e-01f, -1.563661695e-01f,
+    -3.606505990e-01f, 4.877177775e-01f, -1.277074590e-02f, -3.699871898e-02f, -8.330778033e-02f, 2.293486297e-01f, 4.277663827e-01f, 3.238923103e-02f,
+    1.401052475e-01f, 2.806529105e-01f, -2.357827872e-01f, -4.237400293e-01f, -2.620656230e-02f, -3.274523020e-01f, -8.716548234e-02f, 3.143094480e-01f,
+    -1.542107761e-01f, 1.271204501e-01f, -4.075104594e-01f, 3.541536257e-02f, -4.316002429e-01f, 3.083578646e-01f, -6.477420777e-02f, -1.798974574e-01f,
+    -4.442723691e-01f, -1.845618896e-02f, -1.747387052e-01f, 1.596950144e-01f, 9.674724191e-02f, -9.433070570e-02f, -1.338610947e-01f, 2.652850747e-01f,
+    -2.045241743e-01f, 5.637029409e-01f, 8.111040108e-03f, -6.384216994e-02f, 2.643272877e-01f, -2.831944525e-01f, -2.942922413e-01f, -3.874204755e-01f,
+    -3.659723699e-01f, -3.696420789e-02f, 1.277504265e-01f, -2.757526636e-01f, 1.065513492e-02f, -2.892259061e-01f, 8.141785860e-02f, -1.797658503e-01f,
+    -5.795215443e-02f, -2.680394351e-01f, -7.958070375e-03f, -1.075455174e-01f, 1.659587622e-01f, 2.427853644e-01f, 4.765645862e-01f, -6.325681508e-02f,
+    3.426122069e-01f, 4.312350452e-01f, -2.598595321e-01f, -2.381854206e-01f, -3.238958120e-01f, -1.953483671e-01f, -3.123241961e-01f, -1.852568537e-01f,
+    1.975127906e-01f, -6.604582667e-01f, -4.114306569e-01f, 3.029388785e-01f, -3.951897919e-01f, 3.854801059e-01f, 2.704842389e-01f, 9.038061649e-02f,
+    -1.173848286e-01f, 4.160877466e-01f, 1.306914818e-02f, -2.912055552e-01f, -4.359742701e-01f, -4.930051267e-01f, -2.037894130e-01f, -7.952573895e-02f,
+    3.590419292e-01f, 3.304163814e-01f, 2.865501642e-01f, -2.002592534e-01f, 1.587217301e-01f, -4.395082295e-01f, -1.146008726e-02f, 3.196739554e-01f,
+    -3.495066166e-01f, -5.003784299e-01f, -5.215967894e-01f, 4.404026866e-01f, 1.198655069e-01f, 9.366689622e-02f, -3.050836623e-01f, 1.200967282e-01f,
+    7.140997797e-02f, -4.103636146e-01f, 3.713421524e-01f, -1.340116411e-01f, -3.590224311e-02f, -4.725754559e-01f, -3.573066294e-01f, -3.282514960e-02f,
+};
+
+static const float TEST_MODEL_fc_bias_2[10] __attribute__((aligned(4))) = {
+    -5.049558878e-01f, -6.969504952e-01f, -1.736408025e-01f, 2.787025273e-01f, -3.324230313e-01f, 4.223543704e-01f, -2.016284019e-01f, -5.402867794e-01f,
+    8.409672379e-01f, -2.353725433e-01f,
+};
+
+static const ml_fc_f32_layer_t TEST_MODEL_fc_float_layers[3] = {
+    {16, 784, ML_FC_F32_WEIGHTS_F32, ML_FC_F32_ACT_RELU, TEST_MODEL_fc_float_0_weights, TEST_MODEL_fc_bias_0},
+    {16, 16, ML_FC_F32_WEIGHTS_F32, ML_FC_F32_ACT_RELU, TEST_MODEL_fc_float_1_weights, TEST_MODEL_fc_bias_1},
+    {10, 16, ML_FC_F32_WEIGHTS_F32, ML_FC_F32_ACT_NONE, TEST_MODEL_fc_float_2_weights, TEST_MODEL_fc_bias_2},
+};
+
+const ml_fc_f32_model_t TEST_MODEL_fc_float = {3, TEST_MODEL_fc_float_layers, 784, 52008, 1.000000000e+00f};
+
+static const uint16_t TEST_MODEL_fc_fp16_0_weights[12544] __attribute__((aligned(4))) = {
+    44272, 11482, 42075, 10993, 10410, 43953, 44113, 43412, 11337, 43097, 11445, 43060, 11021, 8248, 11237, 5182,
+    44044, 43024, 8253, 42336, 11627, 6560, 44304, 44092, 11278, 41862, 10844, 38776, 11265, 9576, 42386, 11262,
+    42391, 10756, 43395, 9456, 6482, 44122, 43066, 44255, 43692, 11003, 43511, 43881, 11501, 42760, 44170, 43383,
+    9775, 11572, 8325, 44322, 11344, 11285, 44091, 8231, 44316, 43201, 43356, 10782, 44237, 42693, 10300, 11402,
+    11582, 43065, 41614, 11266, 44538, 10831, 6311, 43647, 43707, 11550, 44076, 43499, 9321, 5483, 44201, 10758,
+    8524, 44189, 11348, 40457, 10421, 11369, 44427, 44097, 10418, 44007, 10696, 11264, 44493, 10321, 44290, 44372,
+    44191, 9586, 44454, 44492, 44524, 44633, 43532, 10424, 41447, 44104, 44131, 8938, 43204, 41845, 43460, 11503,
+    42353, 8592, 11539, 11007, 44364, 10518, 11063, 41874, 40781, 10180, 11116, 44301, 11494, 9339, 11287, 44087,
+    44279, 43535, 43004, 11738, 10707, 43546, 10709, 42811, 43141, 11449, 43659, 43812, 9495, 11482, 41383, 43091,
+    10841, 41376, 43386, 11422, 44219, 10530, 43404, 10952, 10613, 44222, 44508, 42231, 8746, 43364, 41515, 10736,
+    6721, 10368, 11136, 10854, 42392, 44091, 43247, 44203, 41288, 9491, 44169, 43289, 10315, 10189, 40998, 44057,
+    41246, 5328, 11268, 43896, 10439, 9699, 43892, 45017, 44860, 43654, 42202, 42245, 9955, 8607, 12116, 41133,
+    43235, 42454, 43829, 9976, 44239, 43204, 11455, 44325, 11296, 11326, 9218, 42285, 44248, 40406, 44096, 41392,
+    43512, 8747, 44680, 43413, 43747, 43692, 44359, 43237, 11009, 10815, 10992, 40623, 41480, 44341, 43157, 43995,
+    43666, 42428, 11537, 11260, 9599, 43274, 44290, 10877, 43892, 11106, 42909, 43121, 44546, 44407, 44241, 10398,
+    43885, 41055, 11536, 41883, 43333, 43637, 43593, 43562, 44436, 41247, 44144, 40935, 11367, 43162, 9820, 44089,
+    11345, 43610, 44215, 44036, 11326, 44797, 44296, 10984, 9342, 43683, 44615, 8641, 10921, 42595, 11555, 9454,
+    44349, 42555, 44073, 40732, 10225, 8600, 9978, 44328, 10982, 44263, 43898, 39244, 41126, 41773, 43086, 11180,
+    10480, 41510, 44835, 43954, 10649, 10051, 7343, 43701, 9147, 43765, 10024, 10448, 10555, 10201, 40125, 11328,
+    10549, 11206, 11511, 44323, 42663, 43874, 10390, 43295, 11786, 11366, 44368, 11185, 44212, 44691, 38089, 44366,
+    42554, 43858, 11304, 42874, 11592, 8402, 10015, 11149, 44429, 10856, 10972, 11532, 10024, 10563, 9700, 43161,
+    43121, 10216, 44176, 10490, 11284, 11172, 44378, 41813, 43947, 9228, 41280, 43488, 9116, 42986, 43664, 11482,
+    7587, 4086, 10852, 9132, 43940, 41605, 44284, 9435, 43866, 10291, 43433, 44290, 43254, 42402, 42713, 42369,
+    11481, 4353, 44169, 42486, 9656, 9497, 43243, 42098, 8923, 11085, 43602, 39362, 43135, 8245, 11506, 41045,
+    44164, 43983, 43974, 11294, 9123, 44321, 10766, 44291, 11545, 44165, 10309, 9274, 44109, 9821, 44166, 44284,
+    44213, 44395, 44718, 39569, 9592, 11375, 10656, 9857, 42786, 41436, 40974, 40360, 43164, 44070, 44470, 44394,
+    40570, 9466, 42522, 42155, 44335, 43677, 8710, 44391, 11473, 10333, 42751, 11185, 41784, 43396, 9214, 10368,
+    39151, 9674, 43596, 42290, 44023, 40430, 41214, 42652, 44501, 10993, 43150, 43808, 43065, 43322, 44077, 44402,
+    44087, 43636, 10689, 44097, 7429, 8876, 44776, 10317, 10616, 43458, 7818, 10861, 10708, 11401, 44276, 41336,
+    9371, 10375, 43099, 44483, 8081, 10189, 44134, 43636, 8469, 10856, 41274, 43043, 44153, 44192, 10380, 44281,
+    11073, 10369, 11076, 8157, 8375, 11380, 11062, 11360, 11265, 10426, 10267, 11293, 9562, 44279, 8246, 44088,
+    9277, 44216, 41810, 44098, 10708, 42371, 9125, 11342, 11590, 43870, 43588, 44404, 44503, 11541, 41259, 44135,
+    10909, 6617, 44274, 42801, 11364, 43806, 44075, 44068, 43772, 11282, 41934, 44029, 37368, 44458, 10844, 44897,
+    43626, 43404, 44402, 11265, 44074, 37031, 42390, 40683, 42205, 42452, 11299, 43708, 11590, 11579, 8171, 10251,
+    11525, 44286, 44141, 41505, 42809, 42652, 10621, 43859, 43869, 43168, 42361, 11009, 8974, 42495, 11355, 9744,
+    10882, 44069, 8831, 42051, 9740, 40104, 43214, 42361, 42178, 11531, 43020, 10698, 44332, 9417, 6066, 44082,
+    44836, 8775, 40038, 11539, 43500, 44277, 10777, 42548, 11434, 44255, 10348, 42124, 11201, 42433, 42197, 44235,
+    9673, 42956, 43002, 7905, 41056, 11370, 44452, 44040, 8327, 44408, 43693, 40468, 9416, 10245, 9917, 10786,
+    43987, 42945, 44600, 11311, 42456, 44448, 9879, 44393, 9053, 10588, 11226, 9339, 44234, 44118, 42136, 44026,
+    41352, 4821, 42048, 10563, 8567, 42668, 8682, 11296, 44470, 44245, 11748, 9192, 42064, 10726, 44162, 11578,
+    44384, 43440, 42688, 43589, 10938, 43890, 11485, 8787, 11421, 9951, 42616, 10594, 10551, 9011, 43910, 44206,
+    43330, 41989, 9641, 42746, 41755, 7750, 43365, 10313, 39536, 44029, 11788, 43488, 43966, 8931, 11504, 11267,
+    11337, 43347, 38884, 43111, 44667, 10843, 44400, 44224, 9852, 9403, 10971, 8787, 10975, 42689, 11592, 7407,
+    44500, 10270, 6193, 44159, 11201, 9888, 44203, 43201, 43459, 41852, 11559, 6325, 41391, 44015, 35091, 9824,
+    9654, 11326, 10719, 44304, 43668, 42911, 43636, 44131, 43837, 41096, 10841, 44338, 41989, 42652, 11404, 43510,
+    44200, 10180, 8978, 9393, 9764, 10694, 8472, 44270, 10127, 9611, 43526, 10871, 8225, 43534, 10653, 10313,
+    44003, 43686, 10862, 43478, 11097, 44166, 43231, 10151, 44043, 9433, 42614, 10743, 42844, 44244, 10272, 11001,
+    44260, 10708, 9897, 11551, 43869, 42419, 9279, 11377, 10287, 41048, 11335, 43437, 11662, 42454, 10236, 42788,
+    11571, 43045, 43034, 43842, 44111, 44031, 44273, 10737, 10447, 43367, 5406, 10248, 10833, 40147, 10525, 42889,
+    11161, 44156, 44324, 11360, 11622, 10907, 41694, 10419, 10419, 10699, 43345, 44170, 42206, 10394, 42556, 10696,
+    44390, 42125, 42891, 43547, 10416, 41253, 9557, 10710, 43552, 7018, 11393, 43166, 11528, 42226, 11346, 5502,
+    10254, 11451, 43146, 11042, 41450, 44096, 11252, 11436, 39305, 10939, 10614, 8760, 11505, 43802, 10461, 11410,
+    44090, 42190, 9024, 10100, 38066, 44340, 11395, 41126, 9276, 44259, 40382, 41890, 10741, 43992, 11627, 9512,
+    11817, 44172, 42060, 8106, 44455, 9635, 43311, 44438, 10205, 44141, 43658, 9845, 42725, 10449, 11069, 43066,
+    9917, 44346, 43606, 41532, 43589, 9670, 8613, 9530, 10517, 43599, 11777, 43206, 44283, 43022, 9970, 44531,
+    45259, 43642, 41618, 40865, 9263, 43447, 42347, 44318, 6308, 7570, 39944, 42550, 44244, 42448, 9473, 41077,
+    10406, 11444, 10665, 10098, 5106, 43458, 44019, 9429, 42760, 10260, 9567, 7395, 9693, 44191, 8840, 11673,
+    41714, 42715, 9186, 43298, 43550, 43396, 10672, 44779, 44680, 10872, 42519, 44320, 43053, 44420, 10921, 44414,
+    43599, 36673, 44204, 45067, 44571, 41517, 4624, 40384, 40382, 10825, 10705, 43416, 10318, 43273, 41297, 6273,
+    11004, 10710, 43194, 42564, 9011, 11741, 43932, 43142, 44180, 42516, 10481, 35308, 11656, 40914, 43185, 10532,
+    9730, 44913, 41666, 8585, 41644, 10966, 11493, 43488, 11576, 44038, 11707, 44140, 34658, 43664, 8627, 44269,
+    9581, 43123, 42266, 10630, 9851, 43383, 44299, 41395, 38313, 44058, 43192, 10764, 39997, 43068, 43077, 41794,
+    43879, 37976, 43257, 11715, 43904, 11547, 40168, 9260, 10832, 32874, 42877, 43374, 9990, 43539, 45193, 43590,
+    42824, 8202, 7576, 44400, 44151, 10379, 43365, 11008, 44465, 43244, 8685, 10844, 9650, 42129, 41705, 11333,
+    10600, 11114, 10341, 41532, 10985, 9860, 43561, 10347, 44326, 45044, 42924, 11268, 42463, 11569, 11526, 44410,
+    10091, 44737, 9742, 9866, 41748, 8970, 44157, 9468, 11594, 41973, 43715, 10228, 10763, 11379, 43478, 10456,
+    11317, 44919, 10824, 43599, 43130, 45034, 42761, 10653, 10217, 8444, 11212, 9236, 44315, 8531, 44364, 10377,
+    44466, 4176, 43995, 42572, 8870, 7817, 43950, 9116, 45133, 8639, 9290, 10594, 9873, 42377, 10791, 40081,
+    9156, 45074, 43318, 6161, 44354, 8185, 41999, 8662, 44301, 43462, 6827, 42985, 9711, 10009, 44447, 9043,
+    11262, 42762, 44672, 44351, 43811, 43261, 10488, 44514, 11422, 11352, 43643, 43747, 44135, 41484, 9003, 44295,
+    42211, 11502, 41118, 42636, 10508, 9797, 10414, 40977, 42193, 41372, 9858, 7246, 44113, 43766, 44619, 44709,
+    41077, 43241, 41225, 11001, 44286, 43210, 10867, 9810, 12097, 7542, 44254, 10843, 43882, 11287, 11568, 6541,
+    7933, 10304, 8158, 43410, 9872, 10401, 43092, 41004, 7509, 42623, 44925, 7683, 43307, 43182, 44153, 10056,
+    11358, 11679, 42309, 11850, 12459, 44615, 11403, 43810, 42376, 42049, 44107, 44321, 43570, 12176, 11540, 6813,
+    10974, 9715, 6175, 9131, 9291, 44353, 42620, 44681, 42235, 40140, 38732, 42842, 8812, 9887, 43358, 42715,
+    42181, 10931, 9632, 10067, 2741, 10257, 11375, 11047, 42009, 10844, 10515, 40648, 7976, 41538, 43929, 11120,
+    8571, 44558, 9344, 45188, 43149, 42382, 43263, 42116, 6301, 43267, 10995, 39338, 11212, 43370, 10407, 43188,
+    39989, 9020, 43461, 43867, 10692, 42451, 7457, 11442, 11282, 42344, 10941, 9525, 44273, 42134, 44301, 45097,
+    45039, 10292, 42650, 8629, 11481, 11313, 11340, 11695, 10940, 11221, 42121, 43172, 44318, 43771, 42790, 43659,
+    11459, 11293, 44127, 10343, 8675, 11941, 44081, 41101, 45061, 45191, 41028, 10145, 9711, 42262, 41876, 42112,
+    9689, 43779, 10367, 44049, 43642, 11642, 42998, 9165, 44206, 43040, 44426, 43135, 43277, 43645, 10875, 10004,
+    11018, 9158, 42457, 9414, 44172, 43314, 10011, 10202, 42374, 42621, 11583, 10810, 41354, 43588, 43063, 9230,
+    44316, 10453, 10015, 11729, 10644, 40572, 43326, 8312, 11504, 42844, 9216, 44242, 43648, 11735, 11045, 42855,
+    43985, 42699, 43607, 41013, 33886, 42795, 43381, 43048, 43725, 9595, 44254, 10803, 44943, 40395, 11321, 40516,
+    42138, 43255, 44096, 43270, 44724, 10933, 10080, 11284, 41320, 11428, 10917, 11369, 11340, 10570, 7839, 42526,
+    42025, 42150, 42275, 44117, 11098, 9601, 39965, 7442, 43578, 44075, 10408, 10188, 43415, 43816, 10600, 8291,
+    9276, 38432, 41980, 10837, 10816, 42403, 8520, 43185, 11655, 42420, 42065, 42025, 41468, 43426, 10830, 44145,
+    39695, 43607, 9569, 43043, 9274, 44309, 42273, 43373, 43293, 11432, 11366, 44144, 44230, 10196, 41159, 11396,
+    43710, 43756, 11514, 43489, 10286, 10924, 42771, 43862, 39857, 4143, 5779, 43133, 8846, 43029, 44204, 42484,
+    44269, 41229, 8348, 10407, 11453, 43416, 10385, 44149, 44521, 10922, 44222, 11514, 43598, 11294, 43472, 9721,
+    9879, 11455, 11304, 10785, 6488, 40693, 41109, 39400, 8662, 8237, 10866, 10426, 44498, 10461, 44320, 40876,
+    9475, 43074, 11547, 7918, 43253, 44727, 10542, 11432, 11419, 9543, 44677, 9017, 41577, 42151, 41568, 8838,
+    40627, 10245, 40107, 9777, 44755, 6342, 9993, 44846, 43892, 10486, 44126, 10484, 7114, 43282, 6574, 10629,
+    44033, 9556, 11477, 42540, 9746, 43091, 44486, 43798, 43593, 43329, 43235, 41864, 8646, 7539, 44333, 44205,
+    10152, 44223, 44097, 44245, 44030, 10373, 43450, 43829, 7972, 11297, 11363, 41694, 43582, 41850, 44314, 44332,
+    42826, 44451, 10456, 9327, 44082, 44528, 44471, 43692, 11644, 11749, 9580, 40609, 44604, 44695, 44532, 41862,
+    42930, 10862, 43749, 40412, 7503, 43079, 10042, 43130, 7177, 9045, 11372, 44146, 5270, 10751, 11369, 11481,
+    8996, 44037, 43244, 9604, 10681, 10040, 11063, 44366, 38967, 43602, 9143, 10294, 11659, 11298, 44088, 41380,
+    10016, 11003, 43066, 41862, 42775, 43392, 43468, 9950, 42826, 10248, 11379, 11491, 44365, 11003, 43486, 43330,
+    43851, 10632, 11096, 40105, 11323, 44419, 42195, 10723, 10652, 8297, 10955, 10560, 11173, 40994, 11246, 41433,
+    41426, 44496, 11016, 10995, 44357, 42476, 43944, 9648, 44286, 42686, 40226, 43737, 43673, 43635, 10949, 9903,
+    43033, 11481, 44331, 11394, 42769, 42546, 10247, 10442, 11467, 11305, 43952, 11226, 10366, 10432, 42245, 11318,
+    44693, 44276, 42563, 43185, 42949, 11160, 43311, 43886, 43457, 10742, 43742, 43718, 44367, 43697, 42145, 42152,
+    9870, 44287, 43909, 43982, 44048, 41802, 10329, 42211, 44058, 44151, 9189, 38237, 44450, 45024, 44445, 43248,
+    44615, 44998, 6655, 41981, 10298, 44477, 43971, 9661, 43445, 5400, 11678, 42523, 5628, 43775, 4968, 43828,
+    10563, 41357, 11639, 5682, 42246, 42692, 10057, 44312, 9283, 8751, 44115, 42273, 42450, 8647, 44235, 44420,
+    10624, 42978, 43510, 8426, 44472, 9919, 9349, 44374, 9820, 10669, 43009, 40701, 42415, 42076, 43881, 43724,
+    10662, 10938, 41324, 44080, 149, 44121, 9517, 39991, 40847, 10226, 45133, 10750, 8960, 10595, 43304, 10401,
+    11321, 10267, 10631, 10374, 10893, 43502, 44369, 9238, 10360, 40089, 41313, 11515, 43353, 10238, 9870, 11739,
+    10642, 7088, 42373, 43539, 44753, 43704, 44238, 43267, 42875, 9230, 43765, 1674, 43728, 10974, 8662, 11056,
+    43574, 10544, 42861, 11497, 43268, 9905, 44197, 8531, 43775, 43384, 9163, 8850, 10988, 43168, 43867, 42067,
+    43793, 6240, 44293, 44113, 44565, 43075, 11076, 43215, 11290, 11688, 41277, 11478, 43591, 43699, 43310, 10851,
+    11151, 43456, 10666, 10595, 10225, 10464, 8136, 43046, 10623, 43474, 9826, 44218, 40402, 44058, 44723, 44412,
+    43485, 43755, 6057, 40036, 43648, 9633, 10426, 10586, 9418, 44263, 10083, 41261, 42122, 8829, 4423, 44159,
+    43244, 9898, 43653, 8238, 8915, 10326, 43807, 7102, 8589, 44326, 40893, 43332, 42404, 9857, 43519, 9765,
+    7942, 39991, 39269, 44271, 41087, 43255, 42130, 42372, 11309, 11438, 11894, 45068, 44127, 9349, 42067, 43460,
+    44182, 43500, 40253, 5184, 44086, 41008, 44435, 43696, 43349, 10652, 9499, 41841, 44057, 42730, 38513, 44130,
+    42513, 41103, 11802, 44013, 10533, 11324, 9602, 44427, 11134, 10033, 43782, 10302, 6737, 8314, 11226, 43579,
+    10518, 43921, 10365, 42288, 10991, 39929, 10548, 10967, 8682, 43204, 44037, 9534, 11879, 11888, 42040, 11027,
+    11364, 11564, 42691, 44959, 42437, 44333, 43011, 10289, 9002, 10653, 10378, 11363, 44667, 45093, 10604, 44289,
+    43095, 42197, 43860, 44151, 44060, 7129, 42619, 44211, 11175, 12007, 43455, 10390, 10427, 43180, 43900, 9957,
+    11325, 40689, 42343, 8438, 10649, 38121, 11074, 11314, 41478, 9515, 42008, 9293, 42777, 11501, 6742, 42290,
+    11289, 7411, 44153, 42918, 44946, 11624, 4210, 44325, 42175, 10229, 44832, 10171, 9333, 10186, 42221, 11522,
+    41594, 11423, 10609, 11800, 43021, 43593, 42697, 9559, 9296, 10508, 43642, 8261, 10486, 43108, 42674, 44228,
+    43650, 10517, 11812, 43272, 11118, 42120, 43911, 11673, 11091, 35018, 42266, 11395, 39653, 10787, 11449, 43064,
+    7482, 10495, 10624, 44193, 11437, 10069, 11835, 11363, 11894, 11390, 10392, 44246, 44159, 9780, 12161, 41767,
+    10132, 41090, 10671, 9580, 11007, 44051, 11489, 10951, 10469, 11606, 43177, 8333, 41723, 43176, 42969, 11304,
+    41027, 42406, 42486, 9855, 11451, 43896, 10097, 11467, 11076, 10644, 41928, 10369, 44188, 11384, 44405, 42815,
+    43564, 10256, 10855, 43505, 9981, 8302, 43243, 42227, 43091, 42431, 11876, 9935, 11428, 10424, 43237, 11351,
+    10252, 44217, 42205, 43325, 43294, 11271, 9239, 44189, 42613, 43288, 44257, 44018, 11707, 43673, 10650, 4405,
+    9929, 43750, 10898, 43683, 9461, 42197, 11117, 42973, 10502, 10610, 9328, 42603, 41515, 10382, 44131, 9620,
+    44122, 44501, 10040, 9175, 43912, 11044, 10184, 10290, 11087, 43404, 44781, 42686, 43260, 9088, 45073, 43501,
+    44269, 11318, 43156, 43249, 6885, 11015, 44787, 39329, 43926, 43923, 42938, 11736, 10353, 10324, 44172, 43601,
+    11560, 43495, 40251, 42884, 9132, 9929, 10750, 42137, 45354, 8328, 10095, 43901, 40007, 10440, 43047, 41531,
+    10718, 3198, 10797, 45083, 44178, 42356, 10724, 10732, 11183, 11769, 42761, 43298, 41398, 43050, 9311, 43326,
+    42993, 9981, 39769, 44635, 43570, 8222, 44395, 42205, 11373, 10371, 11152, 43403, 9116, 11071, 42077, 43497,
+    11122, 43710, 7286, 42892, 43944, 10084, 11632, 42156, 44222, 11072, 11304, 44684, 38171, 9555, 43218, 43183,
+    41573, 44098, 43861, 43788, 44193, 44645, 10006, 43559, 43860, 44682, 10626, 7883, 11011, 43009, 9700, 9979,
+    42268, 44357, 10881, 11324, 44291, 41302, 39671, 10365, 11926, 42859, 40515, 9404, 9555, 11478, 44090, 44188,
+    43390, 43286, 9106, 3199, 43166, 11054, 8967, 44024, 38946, 12243, 10450, 10737, 43077, 44060, 5314, 10398,
+    43210, 11629, 44276, 10818, 43472, 8908, 37636, 43437, 43813, 9545, 43239, 8980, 4519, 43538, 10215, 40779,
+    10585, 43254, 43531, 11341, 42620, 11411, 42684, 8820, 44115, 10603, 43425, 10838, 39021, 10754, 11416, 11321,
+    43207, 7760, 38550, 9868, 42503, 10794, 10422, 8847, 7889, 45058, 41125, 44169, 43041, 43526, 42785, 11285,
+    43138, 11058, 10236, 11551, 43395, 10596, 44406, 41279, 40015, 44336, 10668, 44095, 10644, 44187, 10320, 10735,
+    44080, 44820, 43612, 41643, 44426, 43099, 43444, 44318, 9510, 44316, 41851, 41384, 43618, 44179, 43303, 9818,
+    10787, 8416, 9823, 11084, 43768, 44197, 9955, 44163, 11424, 10554, 42177, 6805, 8309, 11623, 44122, 42747,
+    43432, 43339, 7093, 44729, 44635, 43943, 9466, 42945, 9833, 10895, 10601, 42535, 10952, 11508, 43613, 9686,
+    10415, 10073, 10984, 11316, 44171, 40575, 44383, 10616, 11347, 11058, 11637, 10964, 9749, 43841, 43349, 11349,
+    11627, 44082, 43144, 42662, 43599, 10861, 11626, 44155, 11551, 41617, 10636, 43736, 43531, 10467, 43989, 44013,
+    8164, 11216, 43107, 11457, 10605, 43899, 10660, 42459, 39971, 43592, 10655, 43061, 43142, 10302, 10395, 10756,
+    7074, 7395, 7368, 42534, 38215, 7466, 9115, 43611, 10607, 41934, 11322, 11643, 11156, 9855, 11119, 44161,
+    42040, 10501, 10457, 9089, 44627, 43881, 10610, 33142, 11525, 11066, 10321, 40667, 10209, 41541, 11499, 44452,
+    11632, 11442, 43778, 10307, 42290, 10830, 41027, 44113, 43765, 10074, 43911, 41422, 44131, 7008, 40871, 44168,
+    10041, 42569, 43000, 9531, 44266, 44193, 43690, 43866, 42601, 10722, 43431, 43703, 10259, 44428, 42247, 40706,
+    8562, 10252, 44385, 40821, 36076, 43573, 43327, 44196, 10320, 42508, 40000, 11147, 10293, 44577, 41637, 44155,
+    10885, 44704, 44350, 3930, 44374, 36094, 43308, 42570, 43037, 42222, 8821, 43598, 43534, 7244, 44158, 8406,
+    42277, 11584, 44252, 40994, 44270, 42810, 42132, 43475, 8780, 44248, 43853, 43049, 7811, 42679, 44395, 8348,
+    9407, 44527, 44176, 11306, 11459, 10695, 42842, 9162, 43016, 11514, 44066, 44396, 43065, 43510, 44363, 9047,
+    8227, 44489, 10127, 10140, 43945, 44416, 44549, 43102, 7915, 10364, 43264, 9803, 10453, 11049, 11293, 43597,
+    43606, 43934, 42902, 44306, 44039, 11220, 9971, 11027, 11118, 42385, 11275, 10556, 11291, 10443, 10881, 10264,
+    9480, 10893, 44590, 9139, 9913, 10661, 10072, 8892, 10541, 42687, 41835, 44131, 44325, 10093, 11318, 10650,
+    43099, 43296, 10515, 11500, 43405, 43819, 9239, 44375, 10424, 42880, 43035, 8774, 11212, 43381, 9301, 6681,
+    42726, 42735, 44734, 44566, 42626, 10492, 8255, 9605, 10930, 8588, 43624, 44164, 8962, 41160, 43245, 34990,
+    36464, 43426, 11368, 9678, 10430, 3290, 43152, 44446, 44604, 9431, 43457, 11155, 41644, 5898, 44689, 8131,
+    40205, 41215, 41420, 9995, 10805, 44123, 11511, 43649, 42469, 9698, 10768, 44355, 11350, 44421, 11146, 8659,
+    44323, 11019, 8625, 9751, 44313, 10414, 42933, 43651, 44180, 41610, 39952, 41222, 44398, 9405, 44250, 10677,
+    43167, 10626, 8975, 39754, 10387, 41469, 10872, 44026, 6809, 7515, 42177, 43671, 42778, 8250, 40991, 10790,
+    44265, 8940, 44457, 44288, 10501, 44744, 44606, 40281, 42556, 42101, 43916, 7585, 10046, 42665, 9794, 42158,
+    9549, 9561, 9461, 43855, 44246, 11527, 43141, 9422, 11104, 11025, 11335, 43211, 43589, 43693, 42343, 44089,
+    10577, 10961, 42068, 10858, 42750, 43112, 43983, 43400, 9216, 43136, 43103, 10390, 11121, 44234, 11336, 9518,
+    10713, 43227, 11381, 43935, 43117, 44713, 42132, 42987, 41408, 44622, 10770, 44806, 10627, 10437, 10692, 43844,
+    11353, 42969, 42600, 11478, 43373, 11181, 11470, 42314, 43694, 39758, 10750, 11062, 44063, 42089, 43084, 44393,
+    43776, 10591, 43228, 9409, 43478, 44781, 44490, 10130, 10833, 43490, 42635, 11217, 42278, 44073, 44485, 11450,
+    8725, 10327, 8361, 10126, 11632, 41726, 39417, 43393, 11294, 42512, 43389, 44142, 7690, 43378, 10050, 8982,
+    10339, 10774, 10469, 10274, 10299, 7780, 41233, 42874, 11338, 44532, 42946, 43989, 44032, 44092, 43060, 44126,
+    44313, 10580, 43161, 11016, 43585, 42169, 9118, 41954, 43793, 44044, 43240, 43350, 10890, 7991, 10553, 43318,
+    43254, 43802, 42044, 43629, 10493, 10988, 43722, 44183, 44255, 9383, 44370, 11493, 44301, 10339, 10851, 10862,
+    11131, 43083, 7844, 44160, 44524, 11355, 8017, 11162, 43587, 10780, 43000, 8886, 43179, 44395, 43778, 44156,
+    43067, 44529, 44393, 9714, 41714, 9795, 44289, 7450, 44278, 44330, 40045, 44126, 11111, 11230, 9967, 11463,
+    41598, 43221, 44607, 41220, 9250, 10256, 43185, 44264, 44198, 32979, 10412, 41625, 10799, 38567, 11312, 41720,
+    43181, 7445, 42972, 41344, 44245, 43317, 43454, 42848, 9764, 11179, 43794, 44058, 10170, 10280, 6330, 10268,
+    10771, 43990, 7170, 44414, 43028, 9100, 44435, 41893, 44601, 44342, 9665, 44470, 43897, 36909, 10554, 40872,
+    9519, 8986, 7886, 9632, 7507, 10300, 44474, 43200, 11468, 10601, 8997, 9991, 4047, 9334, 39845, 43683,
+    42354, 10215, 10125, 44543, 11050, 44487, 43586, 44156, 44189, 9329, 44414, 10919, 9468, 42814, 10439, 42864,
+    42143, 43836, 43203, 44087, 11411, 44399, 9708, 10128, 11002, 10461, 44327, 44035, 8693, 9467, 9691, 10218,
+    8559, 10659, 11059, 43347, 44068, 42377, 42327, 8470, 9893, 44310, 43769, 11498, 44280, 8986, 44474, 40150,
+    10933, 43532, 43984, 9437, 44567, 43755, 44393, 43788, 43678, 10298, 44560, 44591, 10388, 42932, 44522, 8282,
+    7283, 43877, 9543, 37858, 7935, 38893, 11071, 9986, 11438, 42500, 42410, 44042, 5145, 9608, 6421, 41216,
+    44403, 7620, 11281, 43331, 44347, 41981, 35890, 10460, 42601, 43611, 40511, 10326, 44059, 9955, 11157, 44099,
+    43770, 8796, 11624, 43299, 44155, 43605, 9109, 9650, 8823, 44524, 44261, 44491, 11369, 44097, 43396, 8175,
+    7028, 42719, 9722, 10314, 43628, 11507, 11428, 10773, 43469, 11363, 43504, 43934, 11626, 43723, 11646, 10740,
+    44196, 42636, 42578, 11101, 44466, 44426, 42301, 43542, 11124, 11224, 42437, 43389, 42251, 44319, 43046, 44576,
+    42462, 11464, 38545, 8662, 11639, 11450, 38386, 43370, 11480, 43542, 39293, 44225, 8985, 43575, 43499, 43232,
+    44285, 37844, 11184, 44053, 43755, 9714, 43878, 11584, 10719, 41023, 43182, 43401, 42929, 42006, 10477, 41129,
+    42490, 11345, 10404, 44330, 44375, 7226, 41662, 4882, 39325, 8587, 44288, 43896, 33641, 9077, 43302, 43663,
+    10483, 44144, 44270, 42024, 9285, 44299, 44409, 11397, 10711, 10854, 10445, 42957, 44373, 43571, 43645, 43137,
+    43077, 44042, 42550, 44392, 43325, 44388, 11414, 39221, 43704, 10234, 40268, 11001, 44087, 11557, 41645, 11353,
+    43995, 42900, 40657, 42787, 10395, 42299, 10437, 44349, 43366, 43477, 44216, 44079, 11356, 44187, 43789, 44199,
+    10117, 11110, 43791, 44130, 10270, 11431, 7932, 42944, 44300, 10679, 11170, 8705, 10789, 11317, 43445, 44040,
+    11565, 41482, 43856, 42547, 10303, 41861, 10679, 41117, 10775, 10998, 11240, 10785, 9946, 44276, 10695, 11676,
+    43273, 9186, 44231, 43754, 42261, 11447, 41202, 42368, 43041, 9370, 11305, 11412, 11775, 43125, 11377, 44183,
+    11368, 9276, 44337, 8823, 43021, 10320, 10834, 43795, 44329, 44132, 43852, 10882, 44032, 8763, 41011, 11271,
+    38132, 40795, 9184, 11222, 11129, 41368, 7477, 41373, 10778, 10762, 43391, 39996, 10631, 10614, 44350, 40645,
+    8357, 44362, 42425, 41631, 44409, 44422, 44062, 11117, 42112, 8665, 41500, 42839, 10886, 44113, 43383, 34341,
+    42273, 11521, 44155, 43404, 10383, 43947, 43652, 44184, 11528, 43353, 43962, 11008, 7947, 11458, 10872, 43061,
+    11475, 8671, 11135, 44097, 11524, 11133, 43144, 43734, 9348, 44532, 10717, 43304, 40349, 44161, 11077, 43629,
+    44170, 11062, 10705, 8100, 10697, 44057, 10325, 614, 43423, 9171, 42330, 43456, 43784, 43206, 42489, 44219,
+    40540, 42395, 44518, 11470, 9725, 41888, 43907, 10531, 36706, 10016, 43682, 43129, 7214, 38326, 43934, 43646,
+    11289, 11306, 44628, 43413, 11207, 44347, 43934, 43569, 43787, 39887, 11021, 9604, 44055, 42499, 42056, 9311,
+    7723, 42084, 10435, 43989, 42229, 41717, 43241, 9250, 43041, 9976, 10281, 9063, 44121, 41295, 10536, 42353,
+    10797, 9856, 8530, 10172, 44273, 10763, 7279, 44222, 43339, 11053, 44510, 8226, 43414, 43046, 10695, 10349,
+    44348, 40309, 10253, 44673, 9094, 9907, 44046, 44457, 44198, 44543, 7059, 10550, 11054, 43339, 41130, 43776,
+    43930, 9761, 44308, 43413, 42871, 43417, 10942, 10900, 42318, 11346, 44638, 8975, 8483, 42993, 10676, 40241,
+    44558, 39718, 9308, 8053, 44450, 44119, 44464, 38651, 11392, 43243, 44127, 8466, 9235, 11449, 38965, 11278,
+    9860, 43427, 9025, 6646, 44673, 41987, 11453, 44354, 39913, 10702, 43284, 10365, 44396, 11153, 42714, 42299,
+    11299, 43036, 10263, 41531, 11468, 43351, 7633, 10721, 42992, 8105, 43563, 9673, 10900, 38005, 9501, 42778,
+    43918, 10949, 43041, 42384, 10505, 43227, 44598, 43130, 40212, 40825, 8897, 41331, 43549, 8462, 42587, 9561,
+    44151, 11248, 11398, 44321, 11381, 43919, 10076, 41260, 11455, 43256, 43333, 10186, 10897, 9222, 43255, 44192,
+    35707, 10483, 10928, 10335, 44416, 11497, 6771, 43605, 9467, 42669, 40646, 41105, 44005, 3722, 9829, 10076,
+    11480, 43827, 44041, 44252, 43948, 10403, 43790, 43812, 44540, 43203, 41369, 10732, 44277, 43429, 43951, 11044,
+    42045, 44107, 9767, 11550, 9401, 41542, 41369, 43580, 43523, 41636, 43410, 10483, 11579, 43039, 10006, 40692,
+    9739, 44223, 9780, 10254, 44148, 39583, 10078, 43266, 40919, 10330, 40204, 10264, 44147, 43356, 9657, 43686,
+    42310, 11361, 11240, 10124, 43846, 11479, 42565, 38555, 10948, 42564, 10520, 11416, 10999, 43174, 43372, 40473,
+    10655, 10369, 8387, 10879, 44414, 38554, 42691, 42537, 41398, 44309, 10951, 43804, 9352, 10653, 10419, 44323,
+    42601, 9353, 9100, 42097, 43824, 43268, 44059, 42305, 44170, 11297, 41118, 43270, 7846, 42056, 42639, 43638,
+    10345, 43926, 43880, 43978, 9590, 40295, 8298, 43962, 44489, 10935, 38053, 8232, 43560, 44294, 8463, 41374,
+    11012, 11104, 11244, 11132, 11273, 10396, 44309, 11429, 39142, 5308, 8514, 10270, 42637, 11001, 44197, 43949,
+    11367, 43938, 6839, 44559, 8014, 10595, 41719, 44315, 44397, 10350, 10521, 9387, 42306, 43240, 40427, 43388,
+    43214, 44123, 43126, 43541, 11489, 11627, 43276, 42021, 44278, 11394, 43983, 10742, 43852, 10486, 43256, 10886,
+    11368, 40948, 44250, 9854, 8667, 11587, 43834, 11092, 44052, 8276, 44461, 8386, 43745, 43191, 43171, 9697,
+    44168, 10645, 5802, 11294, 39991, 10599, 43047, 44144, 40561, 44563, 10500, 41319, 5443, 44397, 10743, 41330,
+    9600, 11326, 44340, 42912, 42825, 44074, 9703, 43080, 44144, 10801, 9971, 10255, 9705, 38350, 42520, 9634,
+    11142, 42855, 44351, 10401, 11205, 41951, 44359, 9736, 11478, 11349, 9239, 7968, 44167, 9334, 44281, 44203,
+    10486, 11369, 41228, 10474, 11210, 44000, 40090, 11381, 39597, 42273, 41570, 38229, 43210, 42214, 3680, 43769,
+    11135, 11072, 42861, 43455, 11591, 44239, 42696, 8807, 44414, 11214, 44128, 40316, 10550, 43492, 44455, 42632,
+    9758, 43576, 42767, 10619, 41446, 8888, 11218, 10720, 42113, 43778, 10599, 41978, 44066, 10262, 5687, 43892,
+    44365, 42781, 8637, 42244, 9431, 9383, 43336, 9248, 42792, 43081, 11004, 7022, 43384, 8316, 10693, 43683,
+    41126, 9521, 44438, 43099, 11307, 43318, 43916, 9710, 10888, 10688, 10710, 44227, 41196, 44214, 10517, 11234,
+    10800, 10730, 44326, 43083, 43605, 41256, 10919, 8451, 43631, 43404, 10864, 43879, 6290, 43971, 43639, 43788,
+    39839, 11129, 44406, 11377, 44303, 44089, 41615, 11498, 11110, 8934, 41782, 44168, 43966, 11535, 10747, 8093,
+    43282, 42188, 11350, 11311, 10690, 43846, 9556, 43295, 43204, 10213, 42159, 6824, 10150, 42888, 10206, 41297,
+    11586, 42235, 9525, 10680, 11083, 40672, 43984, 44093, 11274, 42742, 10989, 43382, 10032, 9219, 11301, 44361,
+    39950, 41961, 11493, 11392, 10489, 43365, 42238, 42217, 11075, 44455, 44369, 43918, 9479, 11496, 40591, 44160,
+    36125, 42309, 42609, 41972, 44412, 10509, 44150, 11588, 9187, 42050, 44404, 9728, 43373, 44173, 8566, 8111,
+    42481, 10985, 43844, 44397, 11055, 43587, 11651, 44163, 42059, 10170, 41677, 10483, 44408, 9514, 41466, 9373,
+    42358, 43541, 11285, 10602, 10880, 42720, 10333, 10564, 44354, 43564, 11387, 43623, 11657, 44425, 44297, 42062,
+    11372, 43718, 8120, 40570, 11303, 10524, 10953, 44259, 9693, 42937, 11284, 11592, 39271, 6229, 9190, 11290,
+    10278, 43745, 43681, 7784, 44079, 10416, 9381, 42580, 44437, 11374, 44124, 8278, 11334, 11401, 44176, 42236,
+    11348, 41683, 8722, 44388, 10197, 11021, 11475, 43444, 11461, 42434, 10635, 11417, 10717, 11726, 11769, 39067,
+    10471, 43137, 10996, 11267, 11520, 10819, 42559, 9667, 44139, 43818, 11543, 43442, 9104, 11001, 10903, 44226,
+    10045, 10137, 44095, 9037, 8928, 11403, 33944, 9374, 11048, 43694, 10158, 44201, 8464, 41602, 7752, 6585,
+    11968, 40795, 44036, 44545, 9039, 44814, 9972, 10278, 39663, 7676, 42712, 43840, 10597, 43497, 9648, 11303,
+    11604, 43771, 11274, 10296, 10525, 43079, 43777, 11077, 11455, 42334, 11326, 41945, 11636, 44252, 10474, 43418,
+    43961, 10944, 44276, 11044, 43129, 40667, 44746, 44533, 11680, 9753, 11629, 9852, 44382, 43562, 11384, 9088,
+    10767, 42113, 11815, 10818, 43579, 9369, 10620, 9212, 40961, 11274, 9688, 6962, 43728, 41313, 7945, 10270,
+    43297, 43257, 10192, 43911, 41406, 44286, 44165, 44321, 44384, 9803, 9953, 43098, 11458, 9970, 11231, 42611,
+    11324, 42478, 6603, 11770, 10574, 43876, 9140, 10863, 43909, 42788, 9458, 11518, 10579, 43068, 44251, 44733,
+    10421, 42105, 8984, 43239, 40451, 9480, 44424, 43138, 43254, 10465, 9657, 10317, 43631, 41236, 43626, 41378,
+    9349, 43932, 43841, 42447, 9905, 41171, 43280, 41360, 43566, 10615, 44064, 42267, 44237, 43214, 11083, 43427,
+    44105, 11344, 40760, 10836, 9224, 44642, 44306, 9523, 42725, 44459, 44092, 40762, 44173, 44340, 43602, 43811,
+    11383, 11921, 10830, 42053, 43831, 9281, 43878, 10601, 44358, 43073, 43017, 43255, 42115, 44173, 44339, 43340,
+    44008, 9159, 43282, 43191, 11194, 43419, 45137, 43291, 44599, 8874, 11190, 10840, 11160, 36546, 4724, 43041,
+    8256, 43928, 10739, 44239, 8556, 44249, 9541, 43161, 43623, 43682, 40011, 11294, 10296, 40663, 43672, 44229,
+    4184, 9727, 44458, 9469, 41695, 41783, 11377, 43578, 11329, 11433, 10561, 9613, 9258, 43349, 43917, 10544,
+    9069, 44221, 10726, 39461, 10705, 10358, 41254, 44040, 11450, 11099, 44287, 44168, 44855, 44561, 43439, 41889,
+    44025, 42985, 9298, 11030, 9986, 44456, 41983, 9221, 42467, 8751, 44335, 43778, 43828, 43575, 10728, 43634,
+    44067, 8015, 44445, 44261, 42191, 9495, 10889, 39850, 11152, 41796, 43227, 10367, 11765, 7599, 36842, 11327,
+    44505, 11017, 10723, 42037, 41687, 44041, 11014, 44648, 43305, 8795, 11585, 11060, 11154, 11305, 10654, 10684,
+    43882, 9529, 44423, 44543, 10988, 39945, 7038, 9132, 10365, 42061, 10283, 42384, 11629, 43733, 8286, 9495,
+    10383, 11079, 10568, 44221, 43117, 11574, 9525, 38958, 10714, 43370, 10312, 8440, 44203, 9373, 41156, 43373,
+    44135, 10252, 10455, 41985, 44503, 9683, 10620, 39841, 43294, 10633, 43553, 10045, 43586, 11068, 44273, 43570,
+    9483, 42927, 7728, 41770, 11344, 44378, 9134, 42636, 42625, 10670, 10164, 9048, 43664, 42760, 44630, 44364,
+    10787, 9812, 43118, 38645, 10502, 43767, 10903, 44049, 9530, 43076, 4876, 43959, 41968, 11748, 8915, 11491,
+    43344, 44223, 44099, 10543, 10552, 11478, 43191, 44240, 44777, 5456, 44801, 43035, 42167, 10033, 6708, 8606,
+    44145, 44346, 11411, 44220, 43084, 42679, 43778, 43707, 43709, 6974, 9756, 5015, 10327, 11330, 43754, 6664,
+    43396, 44467, 36912, 40921, 44548, 44411, 44256, 43790, 42349, 44885, 42957, 43950, 41033, 7040, 10957, 9978,
+    11365, 10804, 11668, 8202, 43580, 43797, 43291, 6571, 10243, 11550, 10933, 43187, 44005, 44266, 43181, 44043,
+    44661, 8502, 41663, 7231, 43676, 11243, 43393, 44195, 10706, 11463, 43664, 42947, 8526, 6223, 43890, 43893,
+    44184, 43853, 10722, 43952, 44234, 44370, 9506, 10781, 10383, 44123, 8900, 10531, 10041, 10883, 43497, 44070,
+    43621, 44383, 9785, 42259, 10356, 42594, 42652, 11085, 44173, 11754, 10092, 8308, 44528, 8860, 41166, 10794,
+    42453, 42085, 10281, 5611, 10840, 43830, 44590, 11448, 44115, 10417, 40146, 43982, 41109, 8716, 44208, 43497,
+    10363, 9256, 8992, 9359, 40014, 11594, 43799, 37937, 44476, 9096, 11174, 42420, 44322, 39665, 8264, 42191,
+    9676, 43239, 41815, 43053, 9130, 40689, 40456, 9292, 44219, 41352, 10974, 10233, 9394, 9973, 42705, 8789,
+    44424, 9129, 44097, 42439, 11312, 9217, 44287, 41545, 11583, 41821, 44391, 43728, 10187, 11403, 9659, 11516,
+    10998, 9783, 41870, 11338, 43740, 10317, 11441, 44177, 43392, 42543, 5353, 43746, 10635, 11038, 8247, 43631,
+    44054, 10336, 44201, 40132, 9313, 11507, 10600, 11842, 43004, 8428, 44387, 11303, 42751, 10359, 42018, 42183,
+    9320, 43327, 39867, 10729, 43419, 9502, 44048, 43187, 9073, 9562, 43940, 43464, 9325, 42420, 10639, 7497,
+    10151, 43641, 42160, 10348, 35267, 9161, 10364, 43447, 11354, 39621, 11650, 44071, 43530, 43330, 11546, 44207,
+    43683, 43695, 10477, 43521, 9260, 11123, 39788, 11318, 9888, 44065, 9675, 44165, 10786, 43253, 41276, 10244,
+    44030, 7769, 10314, 43224, 42527, 42950, 9735, 41090, 10983, 10986, 11391, 11669, 44361, 11077, 9917, 41997,
+    43673, 42369, 10751, 43408, 42045, 41353, 39173, 44315, 9776, 43244, 44319, 11604, 44262, 41578, 11286, 43547,
+    11372, 9268, 43355, 42092, 10869, 44194, 43256, 10594, 9554, 43061, 10529, 5910, 9784, 42572, 44288, 44385,
+    10412, 11499, 43475, 42699, 9972, 11171, 44066, 10444, 11008, 11044, 10339, 43601, 11374, 36314, 11507, 9445,
+    41074, 43912, 7994, 11418, 39307, 11057, 44327, 44144, 10409, 42532, 42416, 44139, 43228, 9230, 11130, 43099,
+    44056, 11619, 10510, 43009, 10606, 11610, 9321, 10530, 11212, 44175, 44217, 11430, 43809, 8265, 41998, 42399,
+    42629, 43322, 11036, 11206, 44384, 9929, 41127, 43181, 43772, 44309, 44338, 43138, 43706, 10390, 11600, 44129,
+    11240, 43388, 41610, 43333, 42497, 43802, 42277, 10593, 11468, 39788, 44217, 9583, 3014, 11651, 11233, 10988,
+    44127, 11220, 42989, 9810, 10415, 44234, 11493, 42159, 42122, 41186, 41997, 44129, 43465, 11457, 9697, 11484,
+    40374, 11230, 43078, 44094, 4724, 43035, 10872, 44153, 42472, 11194, 11305, 10601, 8832, 41349, 7695, 44147,
+    10440, 40327, 11292, 44144, 10259, 37281, 9771, 44069, 44212, 43307, 43967, 43235, 42350, 10277, 34666, 44127,
+    43380, 8848, 43401, 9771, 10908, 11378, 10493, 38827, 11413, 11414, 11462, 44033, 44201, 9553, 11589, 9266,
+    10575, 41825, 42360, 11437, 7362, 11534, 43928, 37647, 38616, 44147, 40346, 9757, 11101, 44353, 10133, 37850,
+    43880, 44035, 44101, 43077, 10474, 6244, 11289, 42983, 41360, 42578, 42717, 10790, 10361, 10420, 42579, 10662,
+    11293, 44232, 11346, 10671, 44295, 42245, 6078, 44327, 11500, 43465, 11495, 44337, 43326, 11093, 42201, 40819,
+    41771, 7837, 10040, 42963, 9464, 11161, 11571, 7911, 10253, 11043, 40792, 11367, 42853, 42348, 11389, 43303,
+    42293, 10385, 9166, 42262, 42939, 10270, 42810, 41994, 10494, 43188, 43033, 11285, 7236, 9338, 44468, 43014,
+    10967, 43861, 43660, 44001, 43937, 10491, 9837, 11245, 43115, 42874, 43117, 11166, 43110, 11533, 44162, 43299,
+    11044, 44481, 43940, 6149, 44212, 42231, 42287, 40497, 44422, 44325, 44277, 10399, 11421, 42693, 42584, 42147,
+    44268, 10818, 9945, 40972, 11516, 42448, 41030, 43258, 9949, 42643, 44254, 10648, 42175, 41995, 41541, 42769,
+    43460, 40286, 44410, 42614, 11375, 11324, 43029, 44408, 44173, 43719, 11560, 10672, 10879, 39412, 44093, 11123,
+    6827, 10650, 10254, 10244, 43281, 42263, 44137, 40502, 39555, 9747, 44360, 44533, 8881, 11226, 10746, 5168,
+    8314, 10689, 43324, 43027, 43472, 11546, 43405, 7019, 11361, 8289, 44120, 10514, 11487, 11404, 39339, 43632,
+    39783, 8620, 8696, 11029, 42767, 10741, 38504, 9427, 42079, 6246, 43510, 4279, 10219, 43483, 44038, 43078,
+    43618, 11083, 9397, 42326, 42957, 10057, 44383, 42063, 11042, 10464, 9765, 41714, 42737, 10994, 9724, 44230,
+    10391, 44261, 43932, 41755, 11103, 10414, 42168, 41982, 10342, 37212, 43565, 11238, 44261, 9586, 11037, 44370,
+    11603, 44093, 43708, 42760, 10304, 42008, 11127, 44387, 9485, 43838, 9277, 41721, 44308, 43251, 43514, 9375,
+    40538, 42926, 44421, 44312, 11323, 40279, 9308, 42021, 36966, 5866, 43640, 11019, 11171, 41457, 8572, 9599,
+    10633, 10609, 9704, 43170, 42342, 41190, 44620, 44065, 41065, 41775, 10919, 42458, 10943, 11036, 44539, 8375,
+    8995, 44142, 11464, 42958, 10325, 11247, 44361, 9572, 9633, 44250, 10813, 11093, 9290, 8090, 43898, 41972,
+    8557, 11039, 43692, 10234, 7775, 44071, 10846, 11032, 8415, 37990, 44034, 44337, 44090, 37852, 8624, 43510,
+    43402, 10353, 11048, 7601, 11521, 43870, 9290, 10532, 43373, 44172, 8915, 9709, 44079, 41397, 43648, 10885,
+    10775, 42941, 10443, 42533, 43209, 43776, 38604, 44363, 11282, 11533, 41867, 6946, 10991, 43287, 6923, 40269,
+    10631, 9747, 9977, 44303, 42512, 10628, 10385, 42042, 9267, 42514, 43150, 44564, 44190, 42468, 44142, 44576,
+    42314, 42631, 42309, 43868, 44235, 44432, 9098, 44380, 42417, 11313, 43380, 9870, 11618, 44203, 44222, 9828,
+    4855, 11032, 10759, 43732, 11507, 9397, 11060, 7688, 44210, 10474, 11087, 10351, 44146, 11098, 11374, 42735,
+    42191, 42925, 9932, 9920, 10410, 42310, 44378, 8572, 11654, 10841, 8916, 42738, 9796, 10702, 39232, 42694,
+    11416, 41443, 43264, 44284, 43301, 10957, 10784, 44515, 10635, 8532, 44164, 11321, 43782, 43669, 10936, 11486,
+    11469, 42584, 42975, 10792, 44022, 37963, 6684, 44240, 43817, 43469, 43974, 44356, 44212, 43093, 10056, 11314,
+    40396, 44595, 43126, 43127, 9407, 44177, 7347, 11321, 42579, 41126, 8560, 10869, 42021, 10825, 11299, 44254,
+    44234, 10860, 9966, 11171, 11653, 5692, 38730, 38198, 42940, 43664, 9321, 44383, 10479, 43918, 10884, 11198,
+    42173, 44464, 43508, 42945, 44315, 11374, 41993, 41484, 10313, 43027, 10961, 41177, 39974, 11292, 43184, 41929,
+    7143, 11527, 11404, 44343, 41260, 43615, 9579, 44065, 44072, 10163, 11284, 9675, 10336, 10070, 43800, 9935,
+    42686, 9559, 43589, 10324, 10476, 44338, 11549, 44282, 10621, 44220, 43630, 10812, 44324, 41689, 11327, 44182,
+    11578, 10140, 43952, 43358, 42700, 43898, 43096, 10931, 43235, 43105, 42650, 44134, 44431, 44262, 43745, 44011,
+    11123, 44171, 43507, 43765, 44400, 11290, 11505, 10154, 38882, 11614, 11340, 10640, 11438, 9830, 10335, 11207,
+    11232, 43136, 10612, 43640, 11344, 40775, 43995, 9464, 40358, 42762, 43427, 8451, 9108, 43637, 9308, 44267,
+    6567, 44174, 10584, 41886, 11640, 41660, 11389, 43879, 10996, 41104, 42253, 10734, 42019, 44429, 10973, 42120,
+    6939, 39565, 42679, 43893, 8976, 6191, 10350, 42070, 4956, 7508, 44262, 10801, 11094, 11472, 43578, 10889,
+    10392, 9245, 6280, 9833, 5995, 43062, 44194, 43482, 11385, 10279, 43028, 40885, 43726, 40918, 43370, 41598,
+    7639, 41206, 9739, 44247, 41862, 44142, 11068, 11443, 9504, 41136, 9917, 10785, 44221, 42279, 9241, 40267,
+    11462, 10375, 41431, 44416, 40319, 43160, 11280, 43681, 8561, 11400, 11492, 43220, 43705, 9927, 42147, 11393,
+    9725, 43443, 44082, 11457, 11506, 43624, 10637, 11355, 9682, 44193, 39299, 8908, 40556, 41147, 44101, 11106,
+    44040, 42113, 8677, 38707, 42671, 9550, 10271, 11321, 38984, 11518, 8489, 42840, 10306, 43689, 8179, 40951,
+    10065, 11113, 9519, 11431, 44072, 11506, 43456, 42950, 43627, 10479, 11236, 42854, 11377, 11376, 11577, 42881,
+    7568, 43857, 42808, 8091, 43159, 43743, 11651, 43903, 43032, 9771, 44028, 42988, 11043, 10423, 9189, 8557,
+    9389, 40077, 10074, 10750, 43155, 38962, 44220, 44016, 10770, 43304, 43789, 10046, 43557, 42838, 11270, 9705,
+    43905, 43187, 10724, 10949, 44174, 11613, 11270, 41464, 10583, 9520, 10763, 5805, 11222, 43134, 43721, 44226,
+    9370, 10120, 43473, 43275, 8636, 42081, 11354, 9316, 10350, 43031, 11301, 11468, 10283, 9567, 11513, 8597,
+    43066, 43691, 11521, 11604, 44172, 42457, 43152, 43742, 42602, 43112, 41429, 42468, 44339, 8874, 9187, 9837,
+    44324, 42369, 6782, 11792, 40649, 11048, 42729, 38338, 8644, 43475, 9547, 11051, 42719, 10813, 10270, 41891,
+    10949, 43670, 11281, 11521, 10685, 11343, 43380, 43322, 10361, 10201, 11319, 10698, 44506, 43441, 9925, 9834,
+    44107, 10886, 44151, 39376, 44404, 10894, 42424, 10445, 8738, 44424, 11058, 10439, 42930, 11020, 10663, 10821,
+    43738, 43653, 44038, 43612, 10729, 44096, 43239, 9820, 10524, 11071, 42858, 10967, 40965, 42986, 10206, 9593,
+    44327, 8584, 10995, 44046, 11551, 44318, 42113, 11572, 42497, 42458, 43736, 11419, 11142, 11570, 44184, 8177,
+    44386, 43319, 44415, 43774, 10120, 9970, 43723, 44491, 9534, 8709, 11289, 10326, 44153, 6705, 44330, 42371,
+    42613, 43272, 40275, 43514, 9887, 10423, 43551, 42005, 7326, 11391, 11263, 7844, 44432, 44426, 44068, 10851,
+    41278, 8658, 9542, 42199, 43639, 9233, 42428, 10347, 44439, 11032, 10366, 44245, 41689, 42613, 38781, 10056,
+    9747, 41578, 11454, 44406, 11384, 44101, 11099, 10685, 11371, 44588, 41525, 10865, 43321, 44452, 9732, 42072,
+    43878, 10912, 39789, 44495, 44196, 10400, 42123, 11310, 11338, 9873, 42089, 44300, 10451, 41508, 11625, 8307,
+    44467, 9573, 43171, 41704, 41015, 10560, 43613, 42360, 44162, 43819, 44358, 10551, 44101, 10671, 42558, 44060,
+    44484, 42286, 41276, 11132, 43390, 44000, 8870, 39577, 9885, 11477, 43303, 44208, 11577, 10582, 43847, 44214,
+    43631, 10889, 11266, 10573, 42614, 9877, 10436, 44643, 42943, 44177, 41658, 10475, 7211, 11434, 43937, 43588,
+    41313, 9685, 44379, 9204, 39744, 43216, 10159, 6373, 11755, 10638, 10125, 11024, 10515, 44025, 10608, 8960,
+    10827, 9707, 11261, 8430, 10264, 11394, 44505, 41960, 11329, 43412, 43443, 11351, 8594, 43159, 40637, 10992,
+    11099, 42520, 11548, 12036, 43333, 10388, 10207, 10138, 42173, 11316, 10878, 39253, 40610, 42269, 44014, 11173,
+    41986, 44311, 11459, 11102, 10965, 11466, 44313, 10243, 44243, 10944, 43397, 11203, 10193, 11530, 10697, 11548,
+    8029, 9478, 44358, 43577, 10994, 44540, 42561, 40931, 10783, 44565, 44346, 42490, 11565, 44296, 43521, 11174,
+    10681, 44101, 44467, 43582, 44291, 42434, 11606, 11096, 11398, 11294, 44121, 10769, 11644, 42075, 10812, 43578,
+    11338, 9757, 44061, 10373, 10268, 42851, 10707, 44315, 43145, 41714, 44720, 41675, 11479, 8726, 9620, 7829,
+    41217, 41130, 6526, 11453, 11629, 44247, 11399, 8688, 11567, 6437, 43591, 9664, 10686, 11326, 44338, 43758,
+    10588, 44082, 43384, 44375, 44290, 10954, 10150, 11282, 9782, 44143, 43876, 39115, 43350, 41916, 44334, 43992,
+    9902, 44403, 44252, 11082, 9219, 44369, 9729, 42638, 43863, 10090, 11127, 44368, 10458, 44583, 44497, 10209,
+    11183, 6738, 44160, 11451, 8570, 44067, 11375, 43661, 44328, 42557, 44214, 10826, 42664, 10817, 40860, 10183,
+    43850, 44199, 10584, 38321, 10694, 11197, 42680, 9220, 42753, 11439, 44177, 9896, 44490, 44324, 43364, 11060,
+    10279, 44210, 42633, 39719, 7616, 9522, 43291, 10251, 11210, 9568, 10451, 10583, 11496, 44244, 11499, 10461,
+    9598, 7495, 43862, 10792, 44369, 10428, 44512, 11330, 6283, 44081, 44358, 43638, 43528, 44288, 11282, 40913,
+    40043, 44038, 11428, 11218, 11305, 42487, 5575, 11499, 44153, 43440, 42336, 43447, 44163, 44163, 43856, 11335,
+    42397, 9344, 11290, 43460, 9854, 44041, 10246, 44289, 11356, 43678, 43185, 42057, 43663, 44104, 42234, 42798,
+    44318, 43155, 43162, 44158, 11630, 43365, 11395, 44446, 43218, 10951, 43214, 11092, 43616, 7982, 43689, 6908,
+    43663, 42399, 44549, 44164, 9450, 44359, 40986, 38198, 9628, 6255, 10809, 7630, 38952, 11462, 9197, 44359,
+    11254, 11468, 44058, 10897, 42742, 10365, 10599, 4722, 9283, 11320, 40283, 9897, 44582, 9868, 44505, 11289,
+    10110, 10497, 40090, 8060, 43935, 11474, 10941, 40258, 43138, 10618, 42108, 43267, 44268, 43105, 10685, 42741,
+    43464, 10790, 10208, 43993, 44079, 44125, 44281, 43640, 43112, 44383, 10809, 44038, 10746, 41960, 41519, 8288,
+    10642, 11195, 42645, 11368, 42848, 11077, 43978, 41178, 43729, 42297, 43385, 43580, 44334, 10850, 42828, 43612,
+    8441, 41454, 44289, 7375, 9488, 43286, 10492, 11066, 10598, 7952, 9259, 39038, 43003, 43682, 10445, 10759,
+    43263, 43920, 42723, 8943, 10528, 42756, 44292, 11271, 44637, 9999, 44484, 10353, 9329, 9296, 44515, 10302,
+    43505, 9612, 10410, 10124, 43577, 44280, 44005, 44207, 44061, 44100, 11067, 11583, 11115, 43590, 9577, 11384,
+    7037, 42484, 10322, 10912, 8251, 4544, 44311, 44205, 11429, 11498, 44347, 43991, 9810, 43912, 10324, 44223,
+    6891, 38214, 10981, 9345, 5882, 11591, 39311, 10409, 38484, 9893, 11268, 7290, 44366, 11344, 43435, 43600,
+    44169, 10355, 42807, 42277, 43790, 44283, 10258, 44012, 7994, 10548, 43496, 43489, 11236, 10754, 42499, 11433,
+    10135, 43326, 10506, 11333, 42922, 8873, 44088, 43112, 43861, 11196, 9271, 44177, 44019, 8282, 11472, 44036,
+    44138, 10249, 9315, 7967, 44355, 11286, 10622, 11247, 11576, 8978, 44374, 41639, 10565, 41988, 42345, 10990,
+    43002, 43189, 7051, 44265, 43014, 43984, 8773, 43952, 43502, 8680, 3065, 11044, 42044, 3641, 43030, 8789,
+    44359, 11332, 42837, 44226, 7695, 11277, 42689, 42387, 44190, 42183, 42192, 43120, 11287, 8876, 10860, 44063,
+    11524, 42503, 44385, 43831, 44346, 44083, 42974, 42022, 42854, 40123, 10499, 10426, 43601, 39991, 11161, 42430,
+    11610, 10368, 11148, 43383, 43233, 10294, 9855, 5808, 42116, 11035, 11394, 40748, 42494, 44108, 44230, 11537,
+    44334, 43563, 10054, 10419, 11431, 43211, 43787, 42178, 9381, 44271, 9945, 11326, 42681, 44412, 43679, 11010,
+    43671, 8613, 43636, 43065, 44203, 10967, 39206, 42068, 11569, 11363, 9814, 40449, 11145, 10615, 9661, 44568,
+    8104, 41530, 11328, 39327, 9842, 41540, 42300, 44528, 43592, 43211, 45129, 10761, 10690, 44334, 43108, 42134,
+    11368, 44295, 6360, 43783, 43924, 38349, 43754, 44274, 10854, 11159, 44498, 11353, 8612, 10296, 43393, 10033,
+    44254, 10839, 10276, 43672, 42410, 44514, 5485, 8069, 11342, 42819, 42141, 11510, 43081, 9503, 44106, 11337,
+    8485, 44085, 8666, 43258, 9410, 38944, 45308, 45138, 41336, 8005, 41187, 43298, 43066, 11494, 43406, 42152,
+    44508, 44677, 43449, 44431, 10647, 6510, 44376, 42693, 44112, 44409, 39042, 11270, 44422, 11441, 41182, 43527,
+    9244, 42220, 42290, 8878, 34253, 44331, 42535, 43210, 43858, 43318, 10982, 7454, 10477, 44118, 44099, 10276,
+    42400, 43247, 10583, 43022, 41547, 43816, 11301, 7936, 43565, 43841, 43362, 9888, 44523, 44267, 44579, 44134,
+    10076, 43256, 10467, 40063, 43323, 43167, 42119, 43880, 42184, 43813, 44265, 44170, 42959, 10397, 44263, 7923,
+    8640, 10307, 43676, 11734, 43101, 41368, 10170, 42516, 44229, 44830, 9142, 9789, 42303, 42855, 41153, 10616,
+    37721, 39556, 5334, 8234, 43279, 44049, 9493, 41573, 8581, 43489, 43971, 42958, 43647, 9785, 44017, 42892,
+    9498, 42712, 42909, 42642, 40631, 43378, 42853, 44275, 43359, 10174, 7871, 44320, 9300, 43249, 43153, 10410,
+    10256, 43111, 38544, 44496, 43348, 42925, 42705, 11225, 9217, 9605, 10951, 42117, 10494, 10079, 43346, 10079,
+    44124, 9198, 42644, 44579, 41863, 8716, 12031, 10349, 11477, 44417, 44064, 44353, 9479, 44680, 44590, 43842,
+    8792, 44894, 10631, 41176, 42843, 44141, 9962, 43646, 44389, 44390, 10746, 43707, 44887, 41798, 7953, 39642,
+    10729, 7537, 10471, 10409, 10923, 10641, 9584, 42376, 8785, 43755, 44109, 42281, 5570, 10886, 10462, 43915,
+    41229, 9777, 8875, 9484, 43799, 11130, 42473, 11869, 44586, 8223, 7257, 43932, 9494, 9525, 11986, 9894,
+    44205, 9814, 8025, 43593, 42271, 43196, 44327, 39875, 10662, 44290, 9378, 11138, 43634, 43624, 44365, 42791,
+    44175, 41358, 43391, 44457, 8103, 43462, 44886, 44506, 43655, 11012, 42126, 39947, 43122, 42130, 42471, 8906,
+    11074, 9170, 42859, 44692, 10787, 9470, 43396, 42096, 10603, 43763, 42738, 11102, 44244, 44234, 6298, 43934,
+    9335, 40545, 8285, 10098, 10529, 42801, 11590, 10552, 10307, 41601, 44339, 43699, 39834, 44247, 11371, 44272,
+    42777, 11276, 11388, 7834, 11303, 44330, 5691, 10958, 44076, 44425, 8949, 44611, 44822, 44082, 9743, 40762,
+    42254, 9457, 11401, 41586, 8254, 43597, 44764, 45234, 10615, 10135, 39319, 40527, 10759, 44392, 9565, 44113,
+    7163, 6259, 10018, 43184, 43236, 43987, 10791, 42699, 10244, 44236, 43462, 44309, 10381, 8918, 10398, 9090,
+    10611, 44210, 44235, 44966, 11807, 43141, 42274, 43224, 6979, 43646, 7866, 44086, 7750, 8873, 10839, 10242,
+    10194, 42144, 44670, 44892, 41176, 10640, 42724, 10501, 10815, 9775, 9310, 8693, 41583, 8669, 45108, 41295,
+    43666, 44190, 44047, 39919, 11275, 44083, 10829, 11488, 9714, 43730, 42172, 42522, 41322, 43536, 10193, 6848,
+    44412, 41422, 10311, 42900, 11121, 41036, 10521, 9461, 44368, 42607, 41493, 41353, 9064, 43074, 10713, 10599,
+    42540, 11567, 43479, 8844, 11404, 43975, 11654, 11389, 42073, 41058, 43187, 43528, 8339, 43925, 10381, 42854,
+    43663, 10828, 8998, 40429, 39282, 42061, 8338, 42774, 41181, 44422, 44254, 44213, 40370, 5194, 42521, 10426,
+    8703, 10646, 11052, 44291, 40127, 43088, 41994, 10329, 9387, 11410, 43996, 43185, 9906, 10450, 43082, 43736,
+    5617, 9348, 43529, 43713, 44618, 44912, 10742, 4027, 44342, 10217, 12080, 43260, 10429, 11461, 9613, 44005,
+    44374, 43433, 11609, 44185, 10265, 9595, 9481, 10794, 7506, 43910, 10845, 42471, 10381, 10201, 11691, 43578,
+    42734, 9709, 39332, 9741, 43138, 43542, 11511, 43154, 44250, 8554, 7351, 43204, 41760, 44204, 41482, 10183,
+    9896, 43219, 8415, 44460, 6519, 10762, 42740, 43043, 5383, 42259, 43237, 11097, 42248, 9054, 10515, 11349,
+    11422, 11391, 11059, 10687, 7279, 11572, 10469, 43499, 10264, 43636, 43503, 44766, 44362, 11126, 9481, 43638,
+    43267, 8365, 43866, 11081, 9787, 43742, 11666, 43354, 41583, 38349, 8829, 10609, 11377, 10781, 10595, 10497,
+    42555, 44363, 43640, 11510, 10590, 44146, 11330, 10368, 40928, 43056, 8997, 9257, 44476, 8594, 43573, 43794,
+    42836, 12110, 41029, 10376, 35984, 10646, 10936, 43781, 10124, 42153, 41229, 43765, 36976, 10178, 44383, 9342,
+    44062, 10088, 41326, 44156, 45113, 6495, 44322, 44856, 42543, 44937, 10690, 3867, 11090, 43960, 43654, 44317,
+    10444, 38937, 42961, 11366, 44041, 11034, 44235, 41343, 41833, 44423, 43831, 10698, 42196, 40639, 10012, 3422,
+    10060, 11212, 43226, 43110, 9340, 40373, 10672, 9931, 44124, 41862, 44215, 43459, 8828, 8396, 43766, 44288,
+    10883, 8155, 44129, 11515, 11089, 10777, 8454, 40090, 10392, 9192, 11483, 42037, 11476, 38965, 44630, 7865,
+    9901, 44096, 44379, 44312, 43806, 42577, 11025, 10716, 11501, 44345, 11392, 8214, 40907, 44143, 10658, 10477,
+    43733, 9758, 43714, 11159, 42787, 44219, 10961, 10585, 41803, 8417, 41105, 10974, 43312, 43774, 8695, 9510,
+    41000, 37600, 11449, 44360, 42306, 41772, 44418, 43269, 44365, 44201, 9098, 43541, 42127, 44124, 10630, 11241,
+    11647, 10315, 12049, 12003, 42591, 10749, 44359, 42721, 43621, 42504, 40850, 8839, 44655, 43113, 44670, 43707,
+    9448, 11144, 42404, 10139, 42564, 11487, 43046, 4412, 44054, 10448, 44420, 43938, 43630, 10281, 42152, 10559,
+    9553, 10101, 39790, 11573, 6886, 11407, 10965, 11673, 33101, 43919, 10841, 42131, 11121, 43902, 43915, 44324,
+    9585, 9756, 10476, 11099, 9380, 44298, 10356, 42392, 6518, 11777, 11514, 10582, 42784, 11085, 43366, 42725,
+    11842, 43098, 11762, 41473, 42450, 8950, 41516, 11224, 43534, 9800, 8071, 43521, 9731, 43970, 44421, 10404,
+    40095, 42750, 44210, 43030, 44181, 44448, 42958, 9579, 10173, 4404, 12031, 8707, 41961, 10824, 43283, 10920,
+    12137, 37876, 10655, 44149, 42885, 44089, 44112, 44885, 10428, 10289, 39890, 11456, 44373, 39739, 42951, 36701,
+    43323, 41226, 10239, 41714, 43350, 10921, 9402, 10507, 11202, 10412, 11072, 6134, 10458, 11622, 10351, 8564,
+    10767, 44585, 10422, 10283, 42101, 41713, 10250, 11303, 44344, 44004, 42452, 10999, 41066, 41323, 43797, 10434,
+    11014, 7934, 43172, 10971, 10320, 10481, 40559, 44064, 11489, 43811, 10803, 10449, 43424, 42541, 8327, 8322,
+    44418, 43110, 11583, 43063, 44412, 40388, 43586, 44110, 11954, 43666, 10384, 43288, 8641, 41954, 10206, 42476,
+    44033, 11002, 10826, 40650, 43017, 9456, 10074, 9867, 10362, 10159, 40038, 10675, 42653, 42975, 11322, 11609,
+    9602, 11007, 11491, 10660, 9764, 8341, 43765, 10593, 4701, 9072, 9892, 8886, 10256, 9705, 41704, 11436,
+    42511, 11350, 43885, 11166, 41869, 44399, 41653, 10327, 43052, 42596, 42385, 11476, 42936, 8462, 11486, 44130,
+    9504, 11317, 42012, 9876, 10093, 44437, 41161, 9530, 44343, 10487, 43857, 43031, 11660, 42573, 40624, 43084,
+    6822, 43144, 6681, 41372, 41403, 9635, 10865, 11326, 43897, 41559, 11421, 10523, 43841, 44694, 42978, 44021,
+    44415, 10198, 44512, 8381, 43515, 44476, 42266, 41900, 37573, 8986, 9483, 11597, 11500, 8942, 9351, 42641,
+    36377, 43205, 11791, 41903, 9238, 44383, 42957, 10410, 44568, 43407, 44564, 44466, 44900, 42353, 41074, 44914,
+    44268, 40887, 44226, 45071, 11325, 8859, 43563, 43317, 43106, 10336, 43797, 44367, 41878, 42275, 43996, 10266,
+    43682, 43991, 40143, 41630, 40259, 10153, 44803, 43064, 45264, 44762, 44190, 44715, 45238, 44679, 42241, 44285,
+    44165, 43298, 42526, 44210, 11297, 41780, 42185, 45087, 42894, 10531, 8399, 11250, 44132, 9617, 7925, 10299,
+    43098, 44336, 44485, 45087, 43645, 44131, 2486, 44669, 43031, 42079, 40472, 42643, 6582, 8281, 8223, 43959,
+    10332, 44094, 43716, 42372, 5333, 41782, 43990, 11245, 44162, 11535, 43355, 8457, 42291, 44583, 41098, 9884,
+    43392, 38925, 44125, 10296, 43131, 43772, 10728, 44666, 41338, 7714, 44511, 11091, 38510, 43615, 44634, 10320,
+    10135, 44418, 44054, 10943, 10993, 44126, 44247, 11928, 40258, 43002, 11307, 9934, 10112, 42463, 43226, 9289,
+    9589, 10535, 42097, 10084, 8789, 41306, 9771, 8593, 44451, 10171, 43786, 44407, 43839, 10327, 11247, 44401,
+    41582, 42451, 10989, 11046, 42172, 39151, 11292, 43447, 10269, 10365, 43603, 8211, 43001, 11478, 11340, 42511,
+    44581, 10530, 43904, 9976, 43209, 44640, 9720, 43407, 10351, 11284, 12528, 10801, 6820, 41094, 43318, 43623,
+    11816, 9328, 42456, 11508, 10932, 43701, 11307, 11463, 10884, 11422, 43411, 44056, 11325, 10684, 7765, 44252,
+    10265, 11304, 9402, 11367, 10845, 12476, 11454, 41759, 10930, 11077, 9068, 8965, 11763, 42011, 41239, 10051,
+    10738, 9815, 43438, 10719, 42682, 11279, 11239, 11343, 43438, 44211, 43592, 11799, 39446, 10093, 42354, 11832,
+    10672, 11826, 11888, 11325, 7954, 11184, 42474, 6625, 42413, 10650, 43397, 42592, 42904, 43091, 11152, 11617,
+    42091, 43082, 43698, 42908, 10344, 10698, 42110, 44303, 10878, 43953, 11502, 40749, 9521, 12768, 10171, 42589,
+    43230, 36674, 43072, 43961, 43619, 43349, 11674, 10598, 42496, 11562, 10552, 43712, 11142, 10494, 10926, 43475,
+    43442, 41667, 11601, 10330, 10554, 11336, 38100, 11525, 9187, 11709, 12297, 44161, 42038, 10385, 43507, 8751,
+    41885, 11509, 11717, 43284, 10845, 42359, 10278, 42204, 10780, 9016, 6431, 10326, 11569, 44018, 10228, 42025,
+    43208, 9976, 12321, 12415, 8538, 9400, 10943, 43307, 4952, 43371, 44020, 44566, 10880, 8773, 44234, 10334,
+    9985, 9273, 9899, 43130, 44200, 42875, 44398, 44268, 43840, 9501, 44322, 8117, 9928, 11226, 43760, 10632,
+    12429, 12441, 8650, 42267, 43615, 44274, 7799, 11832, 40710, 10349, 43036, 44236, 42472, 7146, 43631, 8332,
+    43157, 10421, 9425, 44161, 11035, 8635, 11322, 10031, 10082, 7252, 43916, 11178, 12033, 12097, 11746, 11582,
+    43715, 10833, 43080, 40813, 44544, 42358, 42418, 40612, 44882, 9886, 43924, 10341, 43179, 40274, 6804, 42969,
+    8502, 43277, 42673, 9898, 6559, 10388, 10914, 11626, 11126, 2849, 42038, 8247, 10762, 40709, 44070, 9440,
+    45013, 44798, 41616, 44795, 44775, 43092, 42095, 44687, 42144, 9769, 44804, 42940, 43680, 11429, 8901, 6405,
+    44140, 9287, 42902, 11515, 40512, 42254, 11096, 7365, 10286, 43261, 44056, 10467, 43281, 43582, 10973, 44267,
+    11484, 11472, 9604, 44235, 40429, 44906, 44030, 10244, 44418, 43558, 10231, 11457, 8652, 10545, 41825, 6545,
+    10572, 9420, 44100, 11405, 42504, 9976, 41380, 40026, 11609, 43685, 43852, 10960, 42858, 44336, 41986, 10445,
+    10257, 10900, 10467, 41739, 43519, 44274, 43862, 44258, 44184, 10122, 41369, 11327, 10281, 10682, 44285, 9754,
+    10479, 44136, 42102, 11260, 6409, 11501, 42450, 42869, 10415, 43217, 10836, 10692, 10450, 11225, 43715, 43191,
+    11512, 43184, 43488, 44302, 43815, 44426, 43017, 6790, 42175, 7183, 42329, 43402, 43412, 43196, 44203, 44263,
+    11344, 40927, 41946, 44723, 11416, 9735, 11656, 42551, 11219, 10429, 11299, 9375, 11070, 12012, 11304, 43820,
+    8608, 10740, 10295, 43923, 10601, 43328, 43538, 43134, 11309, 44419, 44245, 43657, 44232, 11292, 43424, 11542,
+    39750, 8417, 10455, 10788, 10900, 12136, 11513, 9333, 8220, 8592, 10403, 10373, 43266, 11435, 10254, 10775,
+    11216, 42381, 10971, 43934, 11131, 11421, 44339, 10560, 11555, 44050, 43445, 10315, 11239, 44510, 44294, 11596,
+    9519, 8831, 7381, 6632, 9293, 10166, 44011, 7880, 11530, 10897, 9412, 42478, 11943, 11169, 41585, 40490,
+    10930, 43212, 39331, 43901, 44721, 11732, 44568, 10471, 43620, 9344, 44864, 10985, 43825, 44305, 8818, 42444,
+    42773, 12135, 9236, 10183, 37515, 42398, 9517, 9835, 9738, 42752, 5944, 10539, 10469, 11569, 9562, 11366,
+    43839, 41852, 44052, 40122, 5257, 9298, 8285, 43484, 9895, 41406, 37174, 9323, 4784, 42805, 10252, 10415,
+    11409, 11339, 44471, 43055, 43421, 44471, 44283, 10791, 11565, 44064, 42157, 44303, 10934, 7094, 9975, 10723,
+    42580, 38972, 44280, 9626, 44034, 44382, 44289, 42311, 44433, 10890, 44661, 8047, 44386, 41448, 44633, 43663,
+    45171, 10129, 43638, 10258, 44391, 41689, 44022, 44243, 44405, 44136, 43273, 9263, 43194, 7807, 43221, 44022,
+    44133, 42411, 10845, 42143, 43405, 40272, 40394, 44612, 44745, 44224, 10308, 7319, 43135, 9474, 44123, 41070,
+    8420, 11248, 10073, 11059, 11071, 44131, 43187, 36634, 10407, 44183, 9713, 44400, 8237, 10133, 43107, 9231,
+    42506, 44207, 7295, 8979, 42244, 7314, 10426, 42269, 41834, 4203, 41312, 43153, 43033, 43325, 11558, 11162,
+    38999, 43692, 42279, 44296, 44164, 39338, 5893, 11388, 43813, 43858, 44136, 9708, 43944, 39679, 44331, 43363,
+    43633, 43001, 44603, 45173, 43782, 45017, 42032, 41700, 41048, 41070, 9028, 10322, 9295, 42493, 10466, 11438,
+    43356, 42930, 39775, 9145, 42547, 11452, 44362, 44380, 43203, 42869, 44090, 43277, 9914, 42783, 43554, 44257,
+    9905, 41150, 43183, 10737, 40490, 42496, 42470, 8958, 44425, 45037, 44225, 8770, 8787, 11089, 10523, 11211,
+    42558, 44359, 7952, 7117, 10240, 42954, 41244, 43226, 8438, 4935, 36741, 10569, 42200, 39846, 9431, 11491,
+    11597, 10402, 43553, 10344, 38509, 7849, 41168, 11414, 6883, 10274, 44418, 43874, 8263, 10800, 44631, 42493,
+    36447, 8459, 44077, 44613, 10681, 42234, 11304, 10852, 11542, 9374, 42756, 11197, 9166, 9313, 43343, 43293,
+    8176, 11138, 44239, 42496, 43966, 9397, 10862, 42990, 10397, 41355, 44012, 10784, 11268, 43430, 9338, 10246,
+    8674, 43803, 39460, 11787, 11317, 44125, 11338, 9562, 44113, 10766, 43478, 11457, 44640, 10435, 9857, 12079,
+    8425, 11545, 11964, 42839, 42490, 10878, 43683, 11140, 7909, 42066, 43450, 9931, 43372, 11608, 42701, 10706,
+    44426, 45076, 8035, 9182, 40587, 43016, 42256, 9436, 43880, 43150, 43128, 11571, 10961, 43501, 10385, 9268,
+    43744, 10797, 43173, 44269, 9678, 9983, 5911, 9044, 10205, 41846, 10393, 7935, 40622, 44279, 44267, 44444,
+    43992, 43586, 8298, 9350, 41086, 11597, 6532, 43413, 11416, 11328, 11251, 12343, 12009, 43818, 11053, 8915,
+    10363, 43552, 6518, 42711, 11327, 7154, 10486, 10974, 10533, 10515, 41732, 11008, 40749, 43787, 44120, 44107,
+    45061, 8070, 9803, 42607, 11120, 42664, 41838, 9495, 42169, 10846, 11414, 43105, 44292, 11134, 42578, 43485,
+    11588, 43381, 10823, 10469, 44245, 44229, 42633, 43589, 9348, 10877, 43581, 10069, 44132, 8388, 43248, 7178,
+    11249, 9231, 11776, 42190, 42872, 38463, 43544, 10142, 10736, 43938, 42294, 11166, 44415, 42901, 43069, 43714,
+    10352, 10127, 8993, 43853, 44108, 39342, 43295, 8657, 42290, 9268, 9422, 44404, 42222, 10393, 43384, 10001,
+    42457, 11640, 37465, 10237, 43357, 42624, 10789, 10736, 44136, 42627, 10646, 8333, 8640, 43660, 43098, 9532,
+    43749, 44265, 42932, 10634, 8211, 10750, 43618, 44269, 3370, 11240, 42178, 11678, 10394, 11551, 41383, 9410,
+    11626, 7575, 39921, 8894, 10889, 42720, 6616, 11116, 10933, 43247, 9329, 9244, 44158, 44371, 42857, 10766,
+    11529, 44272, 44702, 43357, 44238, 40668, 10822, 10721, 9843, 8928, 10673, 10345, 10891, 44326, 8136, 9243,
+    9771, 9284, 6334, 43253, 45015, 42480, 7872, 7553, 44302, 10179, 43170, 9401, 42338, 43082, 44277, 44434,
+    10195, 11127, 40781, 44215, 41058, 43425, 10552, 40226, 42475, 9640, 44500, 43046, 44867, 9141, 41136, 8948,
+    45003, 44592, 8392, 11364, 9518, 43881, 44041, 11420, 40408, 11435, 43162, 11789, 44624, 10542, 43593, 42818,
+    44289, 7519, 45007, 9043, 43679, 8710, 45004, 43393, 8705, 44309, 10549, 44052, 11295, 8497, 41577, 44242,
+    10308, 10162, 8824, 9538, 11578, 11453, 42262, 42545, 7237, 44218, 9516, 42592, 44439, 43076, 43287, 45212,
+    41644, 9060, 43161, 44104, 44444, 42029, 11487, 7436, 42842, 7645, 40283, 10544, 9948, 11272, 10806, 43551,
+    43067, 43181, 42155, 44528, 9142, 45192, 39470, 44338, 9557, 45161, 44564, 10013, 44047, 44346, 7409, 10676,
+    42982, 10670, 42581, 10680, 10381, 44089, 9397, 8452, 42641, 11448, 10409, 11542, 10411, 43241, 44740, 11183,
+    44669, 9463, 10610, 11033, 44418, 43741, 44936, 42024, 42353, 10485, 44735, 43863, 44776, 44574, 10966, 44659,
+    10396, 43125, 43604, 43249, 8783, 10638, 9047, 41808, 42092, 9624, 7564, 10377, 44024, 43049, 5244, 9747,
+    9478, 9254, 43314, 10875, 8222, 43806, 41016, 44160, 9189, 10820, 44409, 9245, 8555, 43110, 11321, 11317,
+    10258, 42082, 8745, 10292, 43107, 43542, 10943, 43701, 41748, 44104, 11544, 9610, 44152, 11558, 9674, 8093,
+    40965, 41855, 43720, 9753, 10245, 40552, 41452, 8220, 11658, 42950, 11525, 44000, 43239, 10476, 10392, 11453,
+    43518, 44386, 43276, 11300, 44425, 11176, 43329, 11608, 40561, 11288, 43711, 44119, 43049, 43093, 43558, 11623,
+    44304, 8358, 11628, 10277, 11504, 38980, 43052, 10539, 9015, 44406, 11104, 44416, 6592, 44350, 43344, 10006,
+    44421, 11093, 44010, 43504, 42660, 10402, 8492, 11061, 10372, 42931, 10882, 10308, 41641, 11531, 8809, 42788,
+    8107, 11434, 42500, 7332, 41017, 11624, 39051, 11149, 11453, 9276, 43328, 8585, 43952, 41667, 11358, 43308,
+    43197, 11574, 44127, 11245, 10216, 9689, 40390, 43549, 10973, 11544, 43974, 43099, 6992, 43806, 41931, 9316,
+    44102, 11492, 11535, 9327, 10624, 9772, 44512, 11286, 43974, 11388, 44352, 44156, 42974, 43527, 43898, 11381,
+    44217, 10460, 43144, 10727, 10338, 44294, 43525, 9286, 10485, 11001, 43394, 10684, 41953, 10486, 6157, 10282,
+    43052, 10850, 11483, 10416, 10724, 43380, 43226, 43746, 11012, 42583, 10883, 11065, 44548, 44128, 11460, 44043,
+    39906, 11547, 44362, 43354, 42682, 43145, 11262, 7539, 40620, 42807, 8267, 39826, 41099, 11464, 11626, 10905,
+    11473, 42436, 38847, 10799, 10297, 10704, 41648, 9355, 44349, 43667, 4922, 11421, 11281, 9850, 11411, 43736,
+    11554, 10339, 39864, 41709, 43164, 8350, 11607, 44309, 10206, 43196, 11124, 43416, 11361, 11343, 42577, 8496,
+    9626, 43843, 44038, 44501, 11438, 11483, 44289, 43788, 9911, 44276, 44554, 43866, 10877, 44448, 10587, 10907,
+    11296, 41848, 44352, 42672, 10813, 42012, 42481, 44130, 9769, 40901, 10846, 44068, 44561, 9747, 44039, 42961,
+    11346, 10316, 8525, 9637, 42394, 44111, 36392, 10637, 11463, 9606, 9620, 10518, 44138, 8901, 9220, 44088,
+    11658, 42667, 11104, 10072, 44266, 44315, 9345, 44032, 43402, 10945, 11261, 41361, 44351, 44458, 43224, 10943,
+    43654, 11068, 43228, 4639, 11122, 10136, 43298, 10323, 44167, 44367, 11563, 44123, 11400, 42604, 42869, 9534,
+    10755, 43924, 43532, 11359, 10926, 43661, 44063, 41631, 43236, 38794, 10941, 7890, 42715, 10002, 40930, 43902,
+    8892, 41727, 44120, 11390, 8594, 11605, 43049, 43689, 42535, 10447, 7675, 11407, 43496, 43632, 44060, 11109,
+    10415, 44360, 42912, 40052, 43569, 42118, 43347, 44180, 42196, 11024, 9851, 10447, 43251, 7978, 10990, 8198,
+    11496, 38273, 43014, 44422, 43754, 42192, 11121, 10128, 8286, 10927, 43965, 43862, 43271, 41260, 10076, 44376,
+    44480, 10499, 41463, 5878, 11278, 43285, 43525, 43173, 11398, 43498, 11482, 9839, 10704, 43218, 37122, 10976,
+    9826, 43780, 43430, 44113, 42840, 43875, 9948, 9286, 6212, 43420, 11461, 40454, 11382, 9133, 11476, 44121,
+    10960, 44079, 9007, 10903, 8518, 44143, 43423, 44325, 11053, 39039, 44103, 11372, 11338, 41992, 11062, 7153,
+    43792, 44475, 7888, 9663, 43644, 10487, 44057, 44063, 11472, 42499, 43681, 5813, 11091, 44521, 10725, 43012,
+    11152, 9132, 10276, 4590, 10426, 7446, 44284, 42770, 42913, 7621, 11041, 44304, 8869, 44129, 8597, 10324,
+    11528, 11025, 44093, 11117, 8552, 44212, 6387, 41916, 11281, 44245, 10583, 43842, 41504, 39929, 43486, 43910,
+    6674, 44153, 10552, 11044, 9461, 44439, 11422, 41139, 11170, 37848, 11141, 43302, 10484, 43760, 44371, 41874,
+    44125, 44178, 42151, 44106, 42792, 11278, 39838, 44367, 44214, 11299, 44169, 43096, 6347, 44210, 43962, 11346,
+    44197, 44568, 9152, 11136, 44042, 43023, 41489, 41712, 8972, 10333, 44100, 44301, 8561, 44420, 43670, 7256,
+    11164, 44002, 43676, 39651, 44171, 9988, 43460, 11560, 43337, 7836, 44115, 10805, 43250, 10734, 10423, 43619,
+    43951, 44067, 44558, 10537, 42457, 10622, 8344, 44193, 44180, 41328, 43995, 11313, 42784, 43049, 10433, 43349,
+    11416, 11006, 43953, 40894, 10727, 11132, 8902, 44388, 6424, 11411, 43206, 11097, 44279, 43461, 43935, 10899,
+    44623, 10723, 10101, 43571, 44194, 10679, 44494, 43549, 40788, 44321, 44422, 11265, 10401, 11303, 7763, 10997,
+    44203, 11242, 44267, 43956, 43037, 42757, 42784, 43973, 43042, 11484, 44006, 43391, 44056, 10754, 43110, 40223,
+    42363, 10467, 41531, 10419, 39347, 10800, 9597, 10304, 5228, 42535, 10517, 42537, 10286, 9120, 11022, 8894,
+    44312, 9596, 11343, 10950, 41804, 41002, 10335, 41821, 42575, 10465, 43402, 41347, 10493, 11201, 44353, 10735,
+    42600, 43308, 43498, 42614, 44278, 44410, 11608, 10762, 10198, 44364, 9740, 43725, 11009, 11387, 10235, 10972,
+    10516, 10537, 11452, 44162, 11046, 44237, 41295, 42423, 10589, 11486, 40895, 44213, 7478, 7134, 44282, 9161,
+    41925, 11653, 10638, 43551, 43222, 44078, 11523, 8051, 9234, 10515, 10811, 43332, 10961, 44243, 44532, 43493,
+    44110, 44465, 43524, 8934, 10354, 6727, 44230, 42431, 11104, 42376, 5343, 42116, 8475, 11401, 10745, 43286,
+    11322, 7744, 11554, 42262, 44348, 42634, 11602, 8465, 42242, 43841, 3740, 40508, 5160, 9744, 44423, 9253,
+    11039, 44506, 8495, 11468, 5430, 43176, 43771, 43692, 10875, 38146, 44169, 43792, 10796, 5540, 11121, 11620,
+    40819, 11466, 11235, 43385, 44384, 11123, 44138, 10801, 44184, 44033, 40987, 43520, 43367, 9437, 42011, 43895,
+    9557, 10493, 44096, 11249, 44089, 43163, 9918, 11211, 9596, 11065, 42062, 41061, 9431, 10511, 10486, 10059,
+    7577, 43442, 44252, 43329, 9878, 11657, 11345, 38025, 43558, 40750, 40977, 11542, 44122, 42819, 42254, 42178,
+    10667, 39030, 42624, 10608, 11533, 44143, 42591, 10703, 10431, 11491, 8792, 10326, 43756, 42230, 11441, 43775,
+    10212, 43737, 11314, 8953, 40111, 43012, 42005, 42212, 10969, 42276, 42966, 11481, 3796, 899, 7525, 9305,
+    41692, 43938, 10533, 44050, 7521, 44095, 42422, 44032, 10283, 10159, 40284, 44079, 42059, 11494, 9482, 10730,
+    43278, 44028, 44306, 42811, 10511, 42418, 44039, 11257, 43396, 8822, 43126, 10114, 9528, 6205, 43920, 44041,
+    11493, 10517, 42104, 11582, 10594, 11573, 43065, 41090, 8798, 43163, 45089, 44198, 3096, 44202, 10822, 38975,
+    9128, 11331, 43611, 44363, 11346, 11433, 39391, 44308, 7716, 10435, 42457, 42914, 11284, 12033, 40413, 43651,
+    43957, 10789, 10178, 45175, 44388, 44533, 44715, 44685, 10848, 42124, 41775, 8934, 43539, 41180, 43040, 42641,
+    9505, 11595, 9197, 41898, 11634, 38377, 44195, 11387, 8044, 11088, 44424, 10903, 44191, 44635, 45100, 42396,
+    44749, 41045, 44384, 42108, 44750, 44304, 44107, 10114, 41800, 44371, 44437, 10544, 42695, 11156, 42724, 40680,
+    43489, 43190, 11061, 11465, 11843, 10415, 44043, 10283, 41125, 44852, 9296, 12009, 45058, 43332, 8779, 43550,
+    9084, 43875, 42676, 42124, 44863, 9619, 42050, 43085, 11418, 9760, 11053, 41210, 43987, 11486, 44140, 44302,
+    5239, 44591, 43469, 10464, 44025, 44179, 9238, 43244, 44129, 43491, 43344, 43389, 44163, 3612, 44101, 44220,
+    10099, 7741, 7953, 10529, 11214, 10505, 10974, 44119, 8026, 43364, 43243, 8895, 43302, 7972, 10284, 11388,
+    7967, 44053, 41864, 43505, 11197, 42590, 42153, 12069, 42340, 10430, 42352, 40427, 6675, 42733, 44092, 8442,
+    8524, 10954, 40388, 8841, 39334, 44191, 11081, 10944, 43237, 9226, 43896, 10807, 44098, 43231, 42043, 9378,
+    42773, 41154, 11197, 43690, 11076, 11251, 10940, 43064, 8479, 42460, 42617, 42149, 44389, 42577, 42652, 44189,
+    44243, 8998, 11401, 44054, 40515, 43177, 44122, 9334, 42647, 11343, 43423, 9328, 43537, 10391, 8780, 40715,
+    38863, 10382, 43247, 42644, 8308, 41344, 43401, 43581, 43310, 42238, 43660, 43071, 43924, 9966, 43185, 44420,
+    10472, 43688, 10332, 44000, 44209, 44099, 43989, 11417, 10618, 43800, 10573, 8744, 42937, 43962, 42273, 44430,
+    44508, 43538, 10006, 43072, 8677, 44145, 43885, 44054, 11574, 11233, 42224, 44084, 10579, 9999, 8481, 10578,
+    41057, 8368, 11201, 42347, 42991, 9464, 40173, 43560, 11550, 4287, 11330, 11107, 43202, 11286, 43504, 44129,
+    43697, 11273, 10964, 10269, 40367, 44494, 9061, 11385, 10910, 38483, 10955, 38705, 7601, 11724, 6555, 7577,
+    11351, 44082, 41288, 43421, 41595, 11479, 41598, 11603, 9321, 44345, 40021, 11432, 9884, 43578, 42372, 43414,
+    44058, 44038, 42287, 10624, 12230, 42252, 40480, 12245, 11269, 11313, 43051, 40304, 42965, 42091, 10565, 10627,
+    9447, 5230, 12250, 42921, 11408, 43145, 10414, 10201, 42711, 9083, 42575, 10840, 41198, 43396, 42648, 45108,
+    9019, 10970, 11318, 42321, 9949, 41859, 11492, 43108, 43303, 42273, 40402, 11412, 8167, 11478, 39268, 40802,
+    10434, 44124, 44491, 44640, 44086, 8635, 37158, 43904, 9827, 10769, 44776, 43322, 43068, 43614, 10377, 8950,
+    43178, 42920, 41684, 11000, 10114, 9594, 882, 11107, 9591, 40420, 9600, 11769, 10502, 42693, 40366, 44767,
+    44976, 44898, 43046, 41077, 11424, 42392, 8859, 42872, 10148, 10842, 43415, 11568, 11270, 11564, 10032, 41680,
+    43521, 43606, 44073, 11272, 9984, 11715, 11640, 43899, 41127, 8448, 10429, 42701, 42389, 44508, 9175, 9278,
+    42504, 44778, 11601, 44709, 44422, 9287, 9461, 10851, 1341, 44260, 8900, 43139, 11993, 43490, 43175, 11562,
+    40849, 11630, 11295, 43816, 43858, 40437, 44130, 44329, 41816, 6521, 6610, 40682, 10138, 11366, 41699, 44815,
+    43773, 42666, 44449, 11353, 8783, 11726, 5643, 40077, 39717, 10168, 43535, 11243, 10256, 43266, 43888, 11058,
+    10821, 42338, 10501, 44711, 45161, 43033, 12146, 11184, 10692, 43202, 44004, 39312, 43535, 44591, 42559, 9829,
+    11288, 43886, 9766, 43148, 44018, 40790, 10393, 39289, 11340, 44634, 42786, 43554, 43494, 44510, 9655, 42651,
+    43461, 11197, 44149, 43209, 9999, 43578, 44317, 45017, 11290, 43161, 10653, 44770, 43305, 43346, 44140, 8481,
+    39215, 41741, 41784, 43419, 42239, 43963, 9808, 9747, 42510, 43787, 42030, 43512, 44360, 43463, 9196, 44390,
+    11465, 43474, 43292, 9066, 11278, 10188, 43311, 44761, 43217, 44514, 8260, 44314, 43400, 43868, 43089, 43293,
+    8200, 42139, 43615, 45058, 9979, 43051, 41520, 10458, 44251, 7823, 42704, 43533, 7392, 11656, 41804, 44405,
+    8444, 42947, 44857, 44212, 10643, 7727, 33518, 44240, 40009, 10471, 9468, 42535, 10078, 42567, 43983, 8330,
+    10342, 10649, 9400, 11268, 43948, 11215, 11373, 9925, 10671, 44138, 44370, 44647, 7554, 38992, 9339, 44586,
+    43953, 43754, 10478, 37940, 38840, 43500, 42506, 44129, 43150, 8092, 44322, 44466, 42799, 44259, 43426, 3228,
+    11271, 11874, 44210, 10326, 11521, 43131, 10701, 9239, 42199, 9981, 44253, 43698, 40708, 10332, 43076, 38422,
+    44727, 40321, 43513, 9410, 44796, 39319, 42472, 10868, 43391, 44263, 12308, 11337, 11383, 9791, 41558, 43797,
+    10820, 38761, 39891, 10696, 43550, 5120, 11093, 44092, 9523, 44711, 44336, 10350, 44229, 6812, 44314, 42753,
+    42192, 9629, 9472, 10482, 12536, 43278, 13022, 12536, 41729, 43173, 9085, 9890, 43869, 11317, 44392, 9812,
+    43509, 8213, 43000, 10554, 10909, 40422, 10496, 42651, 10632, 43570, 11332, 10829, 10584, 11438, 41554, 10455,
+    10060, 12706, 11545, 12199, 12343, 11392, 9286, 10933, 11540, 44212, 7250, 5439, 38035, 43944, 11202, 43315,
+    7467, 10156, 11498, 11500, 10304, 10572, 10781, 44932, 10898, 10765, 11346, 12489, 40268, 12178, 9317, 12420,
+    12581, 8644, 9888, 8088, 11282, 8125, 44027, 44313, 43147, 42915, 7894, 10981, 6491, 44353, 44300, 42405,
+    40404, 11379, 45145, 43278, 9571, 11908, 11302, 44543, 35551, 12289, 43399, 44331, 42182, 44138, 44159, 41717,
+    44014, 9354, 41891, 43124, 11001, 11502, 44361, 44290, 43021, 44229, 42888, 44244, 42310, 10921, 10056, 42036,
+    10686, 41784, 10880, 9402, 44005, 11396, 44417, 43024, 33919, 10663, 3493, 42117, 9821, 41542, 43420, 9183,
+    11403, 10958, 44388, 9660, 43592, 44050, 10797, 9263, 11283, 43004, 9009, 43387, 43749, 40121, 11506, 9670,
+    43189, 43120, 11601, 11470, 10259, 43205, 44258, 43513, 9022, 11303, 44196, 44217, 8721, 41021, 10838, 10805,
+    42860, 42160, 8735, 9314, 43063, 43918, 41993, 10806, 11138, 44130, 44274, 11459, 43282, 5534, 43149, 11055,
+    43546, 43811, 9427, 11423, 11652, 11114, 38075, 43594, 10680, 42157, 44491, 44426, 44385, 10244, 9076, 11441,
+    42803, 11413, 11217, 11201, 10776, 42534, 44190, 44843, 8216, 11332, 11318, 9517, 8524, 10014, 11472, 11315,
+    44039, 9067, 10971, 8604, 10147, 43098, 10442, 11416, 43220, 10625, 43493, 43664, 42701, 43078, 11681, 9856,
+    44309, 11331, 43796, 7597, 11635, 43052, 10232, 10131, 11029, 9832, 40622, 42659, 11372, 11473, 9408, 9051,
+    7848, 8343, 42055, 39457, 7711, 11269, 44110, 43982, 10761, 43135, 43098, 43376, 43899, 9810, 9917, 44026,
+    36993, 8715, 43549, 7005, 42597, 9569, 11125, 9548, 11246, 44023, 6932, 11378, 11427, 10464, 11378, 11090,
+    10428, 10258, 10522, 43489, 10677, 11281, 43557, 42914, 11363, 44283, 11087, 9451, 40650, 10974, 10418, 41233,
+    43087, 10666, 11850, 9746, 10264, 9051, 10337, 9880, 10858, 44149, 43153, 10704, 43626, 10393, 9360, 43151,
+    7668, 43131, 11135, 41243, 8391, 39900, 43242, 11208, 40885, 39560, 11227, 11598, 38754, 43005, 11131, 8538,
+    10519, 10746, 10637, 43495, 40335, 8872, 8155, 11313, 43456, 10048, 10384, 9885, 9684, 6373, 43736, 10900,
+    43979, 9690, 41778, 44046, 11237, 43316, 10935, 11732, 10911, 12352, 11707, 11173, 9424, 42183, 10961, 10751,
+    11158, 43763, 10889, 44344, 43363, 40091, 42681, 42345, 10562, 42600, 41657, 42842, 9931, 10395, 11345, 43420,
+    8089, 9994, 43207, 8348, 42732, 11161, 11010, 43646, 43956, 42832, 43453, 11439, 8429, 42402, 11761, 44130,
+    10934, 43023, 44241, 43224, 42671, 11406, 11414, 8532, 43687, 40382, 44050, 41689, 9271, 7211, 42825, 41069,
+    44125, 12370, 43824, 11390, 42503, 44131, 44056, 10966, 43298, 42812, 11660, 44420, 44234, 10563, 5947, 10335,
+    10515, 8685, 9879, 44235, 43206, 44017, 9775, 38520, 40208, 45303, 44380, 44661, 44678, 44304, 42515, 11498,
+    43225, 43796, 11648, 10613, 41309, 9508, 8483, 9734, 10535, 43546, 9223, 10876, 41329, 41927, 6260, 11371,
+    6770, 40129, 44368, 44263, 44666, 5331, 43176, 10048, 42006, 43747, 10879, 8331, 10868, 5731, 43668, 8938,
+    9536, 9513, 43857, 10997, 42201, 11472, 42759, 10296, 8569, 10090, 10997, 44337, 9908, 42405, 9288, 10524,
+    43887, 44423, 9866, 44775, 44587, 10709, 42063, 11582, 10037, 43387, 43716, 44332, 10895, 44274, 10995, 10464,
+    10685, 10853, 9097, 41177, 10641, 9305, 7404, 39400, 6393, 43776, 43429, 11194, 10432, 9417, 10599, 11137,
+    11682, 44243, 43260, 10759, 11439, 42165, 8700, 41891, 44278, 44425, 44344, 44585, 44284, 44528, 9088, 10415,
+    42217, 5291, 8046, 44268, 44209, 40411, 9820, 43341, 42173, 42898, 43624, 43281, 11465, 9693, 43515, 41510,
+    11530, 43193, 11352, 11527, 42076, 41068, 43166, 44686, 43122, 44272, 9703, 43423, 43671, 11516, 40304, 9812,
+    42648, 11482, 40113, 41084, 42693, 9521, 42973, 43920, 43638, 10839, 9644, 44155, 11413, 11351, 43471, 12036,
+    11043, 43114, 9773, 8444, 43322, 45429, 44999, 44611, 44401, 43500, 44349, 39409, 41551, 43015, 42937, 11277,
+    43469, 37813, 43649, 40911, 11578, 41107, 11188, 11393, 9668, 9949, 42662, 11776, 42216, 44045, 42603, 38178,
+    44163, 44745, 44902, 44223, 44094, 44227, 44687, 44006, 10752, 42398, 9850, 43244, 11648, 10550, 43216, 41152,
+    9792, 43737, 41676, 11246, 41917, 43536, 11447, 9451, 10416, 11375, 8562, 11209, 9161, 10935, 9584, 42624,
+    7888, 44650, 10485, 44115, 43010, 3387, 11536, 10165, 8994, 11084, 9069, 10481, 7739, 41411, 44574, 43660,
+    10380, 11549, 43072, 11779, 11024, 12018, 42457, 10338, 42329, 43291, 7379, 9311, 7674, 8963, 11373, 40057,
+    43143, 44008, 10754, 43257, 8613, 11229, 10018, 43026, 11266, 9273, 44846, 43163, 9448, 10581, 43326, 12445,
+    11535, 43715, 44079, 10700, 11726, 11366, 10722, 11266, 10249, 9923, 42936, 11245, 44030, 10320, 43427, 43237,
+    10608, 10513, 5127, 10324, 9926, 41756, 43124, 10586, 42753, 44090, 11306, 43198, 43869, 11287, 41098, 10903,
+    43229, 8528, 7812, 43534, 40031, 41238, 10770, 43709, 11535, 10264, 9619, 44337, 42982, 10545, 9973, 9233,
+    43248, 41240, 43744, 9093, 44259, 9981, 43634, 11127, 43243, 8934, 11426, 43392, 11321, 42827, 11984, 10912,
+    10282, 11333, 8745, 43478, 9823, 10681, 44498, 9322, 10322, 43185, 44242, 44463, 44106, 2351, 41998, 42785,
+    43610, 43795, 41947, 9768, 11253, 8220, 7783, 8650, 43296, 11093, 42564, 10211, 43808, 10918, 8826, 8356,
+    9261, 3638, 8522, 11269, 44227, 44015, 11427, 44502, 10956, 42788, 11326, 43131, 8521, 44224, 43669, 9400,
+    11013, 11470, 11127, 11573, 42809, 11393, 40603, 43699, 11144, 43699, 44231, 43487, 44177, 11155, 43102, 10535,
+    10675, 9502, 41096, 9452, 8659, 11288, 11066, 10169, 8313, 11475, 10409, 43455, 10572, 11475, 43484, 43851,
+    42834, 10647, 44131, 41482, 11354, 40176, 42289, 11761, 42906, 10510, 10356, 11298, 42193, 44140, 44479, 9319,
+    44184, 38809, 43914, 10452, 36609, 43725, 44273, 10973, 44343, 6106, 10606, 43433, 44418, 10488, 10534, 11053,
+    38472, 43613, 11159, 10687, 37145, 42948, 44238, 43368, 41748, 43224, 42173, 7477, 42190, 44182, 42697, 43927,
+    43459, 9478, 43275, 38316, 43900, 43152, 43051, 11511, 42370, 42759, 8286, 11596, 9380, 11185, 44071, 41364,
+    43323, 9945, 11408, 11517, 10535, 11418, 44331, 41221, 10806, 11485, 10371, 41886, 43078, 11243, 39098, 43954,
+    41601, 44316, 10156, 39980, 9594, 43241, 44182, 9142, 8177, 11109, 11496, 43111, 10514, 42441, 10786, 43481,
+    11469, 40961, 40472, 43760, 10950, 44269, 11192, 10531, 10266, 41230, 43532, 44306, 43892, 11177, 11593, 10645,
+    11081, 44139, 44315, 43492, 42701, 8463, 44056, 11175, 42907, 10471, 10756, 7381, 43330, 10566, 41221, 44430,
+    10937, 43224, 43372, 11461, 10121, 11341, 11489, 11231, 11000, 10086, 44249, 44376, 42154, 41032, 9776, 43661,
+    44068, 43035, 9974, 43506, 43022, 43519, 42797, 43805, 42853, 43640, 10304, 11033, 11513, 44168, 8200, 9219,
+    8246, 10334, 11622, 10934, 11058, 43285, 42213, 10236, 11478, 43653, 42637, 36155, 43114, 9787, 9007, 6114,
+    44253, 10031, 5805, 42799, 44309, 10572, 11389, 43425, 42062, 11234, 8088, 42987, 43093, 44046, 42644, 11202,
+    42212, 43595, 8506, 11636, 43313, 9300, 10682, 44442, 4154, 41423, 43124, 44137, 43962, 9753, 44031, 42666,
+    10493, 11315, 43967, 40896, 44441, 43939, 10309, 43120, 44356, 11619, 41954, 10061, 11440, 10566, 42629, 10227,
+    43487, 10580, 40910, 10777, 10104, 43495, 38800, 44044, 9471, 41536, 7682, 39959, 44013, 7740, 8369, 43102,
+    38585, 40640, 10800, 42187, 34287, 40121, 12356, 12185, 10921, 10604, 10313, 11892, 9655, 10681, 5233, 40443,
+    10323, 43203, 6526, 44265, 11848, 44028, 9613, 43271, 9666, 42194, 9849, 11493, 11600, 11671, 9290, 11414,
+    42011, 11900, 10169, 11033, 11989, 42083, 9708, 10722, 42207, 11021, 7906, 11208, 9448, 10916, 11569, 42142,
+    7709, 11432, 9743, 9207, 10379, 9926, 9837, 40065, 11876, 7134, 6273, 12321, 9715, 42058, 8745, 11956,
+    10876, 8866, 11703, 7381, 7371, 11401, 35549, 11022, 44079, 11364, 11024, 10248, 9570, 8690, 10833, 10813,
+    43529, 10334, 40261, 8517, 43468, 10150, 41636, 42705, 6843, 43736, 11538, 11268, 8089, 10455, 9946, 10563,
+    44116, 10387, 43320, 10735, 43249, 42157, 9830, 10685, 12288, 42749, 11325, 41242, 8131, 10471, 37504, 8335,
+    10478, 43377, 9071, 10807, 41621, 9539, 11124, 43011, 11678, 11081, 42941, 40091, 42294, 10655, 4456, 9858,
+    9664, 43417, 7446, 9550, 41909, 11465, 39641, 10398, 10603, 44696, 8310, 8674, 43721, 9273, 11002, 8212,
+    44155, 11660, 10309, 7198, 40103, 44490, 41315, 10466, 44120, 5077, 2005, 40484, 43844, 42796, 43902, 44053,
+    42226, 9275, 8268, 44697, 8184, 44939, 41079, 10769, 11479, 7988, 44406, 44420, 42910, 12173, 9630, 42265,
+    43761, 41161, 11537, 40555, 11448, 8823, 42215, 42071, 43906, 45291, 42201, 9762, 43673, 44297, 43148, 9615,
+    11007, 44078, 9761, 41563, 9271, 44567, 44317, 11278, 11302, 43162, 11050, 41119, 10832, 39614, 11439, 39398,
+    42421, 43397, 43617, 43514, 44923, 43864, 41745, 43919, 10174, 42623, 42089, 10880, 43514, 9588, 10986, 44055,
+    42931, 11295, 10535, 44278, 43973, 11594, 43353, 44468, 42820, 3506, 10803, 44418, 9356, 42838, 8295, 43013,
+    44689, 42289, 40571, 8484, 11358, 10533, 8684, 42296, 10641, 9970, 43500, 41952, 42731, 42362, 11860, 10179,
+    11533, 10081, 11443, 10135, 11182, 42588, 44246, 43391, 44687, 42944, 8361, 45093, 40665, 43306, 44064, 10423,
+    11347, 10248, 7933, 43178, 9047, 10332, 43672, 43597, 41743, 11269, 10205, 43818, 9355, 8503, 11062, 42248,
+    10734, 10938, 5334, 10789, 10170, 10678, 42067, 44464, 43173, 11033, 43876, 10724, 44492, 11078, 43720, 11027,
+    39579, 42246, 9420, 10779, 41976, 42308, 11074, 11611, 44234, 11137, 39836, 6472, 10538, 10663, 44260, 9371,
+    41120, 43323, 43555, 43623, 10976, 8422, 42555, 10348, 42186, 43614, 39661, 43026, 44176, 45071, 44494, 44270,
+    6977, 44348, 43926, 9334, 10885, 6451, 44435, 10404, 10579, 9595, 44558, 41595, 10689, 44314, 43228, 43903,
+    38429, 6662, 43195, 40659, 43813, 42252, 9032, 11016, 41817, 43431, 41213, 43146, 44607, 40997, 43138, 42024,
+    42382, 8426, 4178, 5395, 44480, 43167, 40013, 10633, 10809, 43497, 40988, 9467, 8568, 11973, 43536, 9427,
+    9925, 42340, 43419, 43874, 44171, 9235, 44620, 11004, 44378, 10340, 41915, 10340, 43135, 9394, 43481, 10632,
+    10631, 44843, 44129, 44162, 44213, 43336, 43780, 8571, 41333, 10609, 43176, 42550, 43011, 44462, 44518, 43089,
+    43513, 39764, 11238, 7278, 10521, 43659, 43051, 5292, 43542, 11108, 11615, 11360, 9739, 44812, 39037, 10717,
+    10414, 11188, 10480, 43574, 44529, 10428, 44048, 10737, 44531, 41141, 43386, 44374, 9519, 44417, 8821, 11107,
+    43929, 9802, 9233, 40578, 464, 8474, 44231, 43960, 44138, 41750, 41334, 10516, 11353, 40059, 43847, 9297,
+    44076, 10491, 11147, 5377, 43814, 43097, 6293, 42517, 43238, 44193, 10340, 10620, 11064, 43456, 44067, 11063,
+    9500, 43924, 42256, 9854, 44371, 42901, 11537, 41088, 8446, 9855, 40596, 40472, 4874, 42222, 43707, 10072,
+    9370, 41241, 10454, 44421, 42129, 10501, 44704, 44728, 42288, 43241, 11570, 11031, 41516, 11115, 44313, 10686,
+    8586, 10705, 10083, 10181, 42250, 42556, 9522, 41399, 11271, 10582, 40893, 11153, 9968, 39898, 11145, 11424,
+    11779, 9920, 39350, 44155, 11108, 37226, 11056, 10078, 8916, 9193, 43604, 43337, 42530, 41617, 10411, 43463,
+    44225, 39407, 42914, 5447, 44724, 44148, 11014, 44492, 11134, 11996, 10409, 38855, 10263, 44279, 44013, 11462,
+    43201, 8707, 9016, 10728, 10692, 10620, 10081, 43312, 44303, 11031, 9330, 11779, 10115, 9699, 41879, 11857,
+    10635, 43501, 11964, 11330, 11761, 43156, 12120, 9724, 34949, 11495, 44099, 10059, 43193, 10367, 4913, 44125,
+    10621, 40725, 43066, 43592, 40516, 10597, 43572, 10910, 10440, 43784, 9437, 8503, 11536, 10611, 44144, 44202,
+    11601, 44192, 11211, 10267, 43353, 10606, 44195, 41357, 10366, 42863, 42555, 43597, 11610, 43214, 11162, 10792,
+    40116, 10807, 11328, 10531, 42366, 6615, 10861, 39497, 41054, 11284, 9294, 44397, 43134, 9632, 44001, 41219,
+    44345, 10703, 42728, 43670, 11356, 42525, 41149, 41810, 6341, 10406, 10241, 10435, 44021, 43796, 44095, 8507,
+    44190, 41716, 44332, 40097, 44821, 42472, 10332, 42472, 41322, 7449, 11708, 42875, 43520, 38237, 40866, 7472,
+    42503, 44051, 8336, 43300, 10481, 41574, 11322, 44196, 10257, 9932, 44066, 43197, 43084, 44253, 44553, 39986,
+    44161, 10552, 44892, 40768, 8658, 11419, 42910, 43468, 11285, 11212, 43273, 42828, 11415, 9574, 10551, 42343,
+    43036, 43193, 40366, 42956, 43034, 42527, 11153, 9613, 43729, 43382, 43066, 44255, 10248, 44211, 11015, 43630,
+    10751, 7357, 9618, 35373, 11270, 10507, 43261, 45315, 40378, 9630, 44096, 43785, 6972, 10405, 10326, 10794,
+    10469, 43044, 38542, 43654, 41490, 44033, 43213, 11238, 42701, 9376, 41030, 10654, 43655, 10465, 10778, 44137,
+    43570, 9712, 8934, 9535, 41453, 11248, 9654, 10393, 11209, 8156, 11304, 39903, 11044, 10941, 11765, 43115,
+    12224, 10870, 43704, 42242, 9481, 43037, 42437, 8832, 43817, 42062, 44006, 9885, 44122, 42380, 9776, 44023,
+    11154, 10073, 41123, 12068, 41982, 11622, 7621, 44141, 6560, 11380, 43809, 43894, 42189, 42873, 43737, 43496,
+    9437, 44267, 10294, 43511, 39611, 9982, 39517, 36302, 41047, 36941, 10658, 9713, 42605, 9838, 8472, 10176,
+    9914, 11571, 11291, 37921, 10191, 10896, 42412, 43333, 10340, 11499, 43346, 42312, 10404, 43444, 8872, 43800,
+    42752, 6890, 42999, 2727, 10972, 41460, 10199, 42398, 45148, 10306, 11096, 11786, 40048, 10925, 42877, 11587,
+    9851, 42818, 33951, 41845, 41321, 43294, 11562, 41850, 43494, 6135, 39360, 40827, 44642, 43948, 33984, 10977,
+    9655, 10960, 10107, 44465, 44602, 44944, 11634, 11310, 11362, 8287, 44376, 40758, 11267, 41337, 44635, 9705,
+    9680, 11926, 43308, 11795, 11248, 8420, 44369, 44393, 10399, 43278, 10291, 9527, 44121, 11317, 11041, 44072,
+    43665, 42007, 43408, 43367, 10935, 43296, 44289, 42412, 9727, 44269, 10309, 44153, 40130, 9261, 11763, 44148,
+    11367, 42309, 44247, 11781, 38951, 7745, 9032, 8903, 12178, 9224, 42594, 43899, 43905, 44700, 43786, 9354,
+    44209, 10753, 10797, 8043, 40349, 10392, 9317, 9977, 43052, 10284, 10841, 40137, 43575, 41170, 11170, 9792,
+    8295, 42984, 10902, 11263, 42286, 11499, 42714, 41806, 10319, 41666, 44860, 42125, 39462, 42565, 11515, 41852,
+    9330, 10483, 43035, 11502, 8704, 9933, 44101, 42652, 11766, 10275, 40354, 41902, 11307, 5339, 43159, 43144,
+    41588, 44356, 43298, 9116, 9771, 43444, 43093, 11521, 43022, 43353, 41492, 11272, 43396, 42998, 10796, 9423,
+    43416, 44529, 9373, 42364, 41890, 11268, 11774, 41228, 11856, 42968, 44347, 34248, 43028, 44124, 37330, 43339,
+    11254, 43488, 43131, 44297, 43332, 44180, 10502, 42368, 40916, 11254, 9717, 45087, 44582, 42127, 43920, 9014,
+    42883, 9337, 43092, 42690, 10899, 43627, 7833, 40181, 40961, 10906, 10765, 10606, 10555, 11199, 11587, 42247,
+    43525, 42702, 11422, 11105, 43587, 44766, 44120, 42122, 10121, 37192, 44075, 11277, 10670, 10832, 11016, 42508,
+    8789, 43579, 43966, 44110, 10486, 44348, 44534, 11058, 42850, 10386, 11466, 44078, 44054, 43991, 42327, 44515,
+    42271, 44490, 44973, 11220, 7219, 10495, 11685, 7260, 9335, 41296, 40578, 44461, 10693, 10200, 4653, 10406,
+    44532, 41127, 44565, 10123, 41350, 43155, 10969, 10881, 40170, 11539, 9697, 43073, 42946, 43799, 45319, 44053,
+    10997, 43143, 41240, 11377, 8716, 8138, 40827, 42001, 43665, 44471, 43136, 10606, 41564, 42525, 11281, 44693,
+    44411, 43706, 40541, 11610, 10220, 41464, 42195, 42420, 43280, 44604, 44254, 41636, 10970, 9793, 11720, 10784,
+    10707, 44343, 38030, 40755, 10428, 8677, 43027, 44204, 11264, 40964, 43911, 41386, 43400, 42774, 4896, 11273,
+    11074, 43115, 10578, 43164, 44269, 41325, 36894, 38655, 9552, 42208, 43178, 42613, 40284, 44429, 42349, 42357,
+    43090, 10458, 42566, 10547, 42869, 9843, 44288, 44212, 11293, 10382, 41472, 43400, 44406, 9637, 11519, 44551,
+    44377, 9904, 11009, 9963, 9863, 44036, 7379, 9290, 43052, 6457, 42094, 42990, 43162, 11214, 42796, 40969,
+    41997, 8791, 44693, 42790, 10403, 42225, 9369, 9262, 43284, 10549, 10289, 10754, 9850, 44226, 43311, 41977,
+    43652, 10032, 41352, 43436, 11225, 42342, 8505, 9369, 44384, 44384, 43215, 10259, 43206, 10961, 44554, 10804,
+    9339, 44202, 44145, 11551, 42784, 43789, 11336, 5417, 44564, 44275, 43320, 44579, 43431, 42126, 10208, 9338,
+    36854, 7915, 9906, 10442, 11021, 11647, 44232, 8104, 11440, 11321, 41133, 44863, 43140, 42783, 11386, 10406,
+    11120, 43616, 11337, 44735, 38564, 43329, 44133, 44034, 40208, 44267, 10521, 5338, 10494, 9530, 38483, 44089,
+    41112, 11255, 10350, 41125, 9981, 9633, 40026, 8516, 11288, 10872, 9926, 43111, 11598, 44179, 43716, 44266,
+    10053, 41989, 9544, 10116, 45161, 45094, 45006, 44180, 44351, 41750, 41810, 5810, 8202, 39506, 42851, 44457,
+    44102, 11014, 42870, 43496, 39898, 42236, 8501, 42179, 44087, 11125, 9570, 43661, 42501, 9319, 44303, 44318,
+    40959, 42398, 10321, 7639, 45121, 42191, 45160, 41477, 9512, 43626, 44607, 44259, 44761, 41033, 9572, 6533,
+    11376, 11010, 8266, 43802, 44283, 40145, 11399, 10424, 44362, 9105, 9903, 38678, 11286, 44099, 10610, 9700,
+    42274, 44703, 44461, 10293, 11007, 42835, 42150, 41087, 8716, 10585, 8734, 44324, 42064, 9790, 9879, 9955,
+};
+
+static const uint16_t TEST_MODEL_fc_fp16_1_weights[256] __attribute__((aligned(4))) = {
+    13289, 44448, 11935, 12077, 12319, 11992, 13468, 46595, 44711, 46648, 46126, 45895, 44295, 10815, 13252, 12793,
+    46194, 12037, 47112, 12878, 13652, 46248, 46592, 46227, 46383, 13501, 46790, 13864, 46081, 44300, 45073, 11933,
+    45152, 13354, 11718, 46727, 13410, 12353, 41950, 10979, 42665, 46271, 13730, 13645, 45774, 13465, 43420, 45593,
+    13077, 13363, 46730, 13456, 46705, 13395, 13406, 13010, 12868, 45414, 45923, 12814, 45737, 42791, 10935, 43386,
+    44606, 46175, 12300, 46627, 45243, 13618, 45254, 46625, 46156, 45370, 46413, 46416, 11550, 13856, 13213, 46094,
+    14098, 13669, 45505, 46092, 13403, 45710, 46364, 41431, 11773, 13713, 45532, 13187, 12176, 45361, 10773, 45644,
+    13600, 13373, 45243, 44443, 12633, 13804, 11874, 13879, 13823, 10802, 45975, 36379, 45109, 45955, 46604, 10679,
+    13531, 46605, 13360, 46181, 45676, 12888, 11010, 44216, 46432, 39449, 11708, 14051, 13557, 46156, 46594, 13918,
+    11994, 46241, 11314, 12690, 12973, 45127, 42027, 46671, 12631, 10899, 10421, 46826, 12195, 45079, 13014, 13216,
+    13482, 46303, 6302, 45982, 38518, 44200, 13268, 45302, 45476, 45915, 46409, 12969, 43903, 14039, 45991, 45519,
+    45523, 13583, 43816, 45921, 46522, 41770, 43451, 46480, 13281, 12799, 44095, 7312, 8363, 12266, 46578, 12696,
+    45767, 13527, 46170, 46750, 45487, 12871, 46855, 13761, 45184, 8693, 44075, 45635, 12971, 43638, 13606, 43727,
+    12298, 46511, 10477, 13248, 13106, 46846, 46673, 12942, 12124, 45522, 12481, 43399, 46551, 13941, 13705, 44337,
+    45995, 44154, 13805, 45738, 13774, 13040, 13656, 44946, 45744, 13588, 45008, 12997, 7627, 44847, 46660, 5904,
+    46755, 45622, 45893, 46117, 12933, 13808, 13823, 13821, 10944, 45164, 13333, 42161, 44795, 12884, 43203, 10565,
+    11332, 44253, 13396, 44347, 12481, 13685, 13724, 13421, 46702, 33039, 46440, 13412, 12723, 11673, 45171, 46288,
+};
+
+static const uint16_t TEST_MODEL_fc_fp16_2_weights[160] __attribute__((aligned(4))) = {
+    45522, 46396, 13369, 46748, 46435, 12460, 13945, 46985, 46877, 46319, 46519, 11736, 45203, 45590, 46973, 44705,
+    44342, 45819, 46946, 45823, 46095, 43369, 13594, 10677, 44240, 12466, 13183, 46693, 13290, 12825, 13406, 46324,
+    46145, 9457, 44609, 45898, 12325, 11494, 44695, 12332, 44778, 46617, 12232, 44435, 11914, 13399, 12800, 46095,
+    9735, 14250, 46390, 13877, 12370, 46155, 45729, 45313, 46533, 14286, 41610, 43196, 44373, 13143, 14040, 10277,
+    12412, 13438, 45964, 46792, 42677, 46397, 44436, 13575, 45295, 12305, 46725, 10376, 46824, 13551, 44069, 45506,
+    46876, 42170, 45463, 12572, 11825, 44554, 45129, 13375, 45707, 14466, 8231, 44054, 13371, 46216, 46261, 46643,
+    46555, 43195, 12311, 46185, 8565, 46241, 11574, 45505, 43883, 46154, 40979, 44770, 12624, 13253, 14240, 44044,
+    13691, 14054, 46120, 45983, 46383, 45632, 46335, 45550, 12882, 47433, 46741, 13529, 46675, 13867, 13396, 11721,
+    44931, 13992, 8881, 46249, 46842, 47075, 45701, 44311, 13759, 13641, 13462, 45673, 12564, 46856, 41438, 13597,
+    46488, 47105, 47148, 14092, 12204, 11775, 46306, 12208, 11410, 46737, 13809, 45130, 43160, 46992, 46520, 43060,
+};
+
+static const ml_fc_f32_layer_t TEST_MODEL_fc_fp16_layers[3] = {
+    {16, 784, ML_FC_F32_WEIGHTS_F16, ML_FC_F32_ACT_RELU, TEST_MODEL_fc_fp16_0_weights, TEST_MODEL_fc_bias_0},
+    {16, 16, ML_FC_F32_WEIGHTS_F16, ML_FC_F32_ACT_RELU, TEST_MODEL_fc_fp16_1_weights, TEST_MODEL_fc_bias_1},
+    {10, 16, ML_FC_F32_WEIGHTS_F16, ML_FC_F32_ACT_NONE, TEST_MODEL_fc_fp16_2_weights, TEST_MODEL_fc_bias_2},
+};
+
+const ml_fc_f32_model_t TEST_MODEL_fc_fp16 = {3, TEST_MODEL_fc_fp16_layers, 784, 26088, 1.000000000e+00f};
+
@@ -0,0 +1,20 @@
+/***************************************************************************//**
+* \file TEST_MODEL_fc_float.h
+*
+* \brief
+* Generated with scripts/ml_fc_float_gen.py, this file contains the fully
+* connected layers of the TEST_MODEL model (float) with float32 weights and with
+* half precision weights.
+******************************************************************************/
+
+
+#ifndef TEST_MODEL_FC_FLOAT_H
+#define TEST_MODEL_FC_FLOAT_H
+
+#include "ml_fc_f32.h"
+
+
+extern const ml_fc_f32_model_t TEST_MODEL_fc_float;
+extern const ml_fc_f32_model_t TEST_MODEL_fc_fp16;
+
+#endif // TEST_MODEL_FC_FLOAT_H
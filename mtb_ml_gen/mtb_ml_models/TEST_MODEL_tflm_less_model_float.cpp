@@ -21,6 +21,14 @@ namespace tflite {
 #include "ifx_common/offline_prepare_utils.h" 
 #endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
 
+// Startup phases of TEST_MODEL_init(), timed with ML_BOOT_PROFILE, and cycles
+// of each node invoke, with ML_LAYER_PROFILE, marked by
+// scripts/ml_profile_hooks_gen.py
+extern "C" {
+#include "ml_boot_profile.h"
+#include "ml_layer_profile.h"
+}
+
 
 #if defined __GNUC__
 #define ALIGN(X) __attribute__((aligned(X)))
@@ -82,17 +90,49 @@ TfLiteContext ctx{};
 
 // Tensor table with space for -1-th element used
 // designate missing optional inputs/outputs.
+#if defined(ML_TFLM_LESS_COMPACT_TENSORS)
+extern TfLiteTensor ioTensors[2];
+#elif defined(ML_TFLM_LESS_STATIC_INIT)
+extern TfLiteTensor tflTensorsWithMinus1[12];
+#else
 TfLiteTensor tflTensorsWithMinus1[12];
+#endif  // ML_TFLM_LESS_STATIC_INIT
      
+#if defined(ML_TFLM_LESS_COMPACT_TENSORS)
+extern const TfLiteEvalTensor evalTensorsConst[11];
+TfLiteEvalTensor * const evalTensors = const_cast<TfLiteEvalTensor *>(evalTensorsConst);
+#elif defined(ML_TFLM_LESS_STATIC_INIT)
+extern TfLiteEvalTensor evalTensors[11];
+#else
 TfLiteEvalTensor evalTensors[11];
+#endif  // ML_TFLM_LESS_STATIC_INIT
 
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+#ifndef ML_TFLM_LESS_STATIC_INIT
+#error "ML_TFLM_LESS_COMPACT_TENSORS needs ML_TFLM_LESS_STATIC_INIT"
+#endif
+TfLiteTensor * const tflTensors = nullptr;
+#else
 TfLiteTensor * const tflTensors = tflTensorsWithMinus1+1;
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
 
 TFLMRegistration registrations[OP_LAST];
 constexpr size_t kOpNodesCount = 4;
-
-
+// Nodes run by the classify invoke, found by scripts/ml_classify_gen.py. The
+// trailing nodes (OP_SOFTMAX) keep the order of the output scores, and the
+// scores are read from the input tensor of the first of them.
+constexpr size_t kClassifyNodesCount = 3;
+constexpr int kClassifyTensorIndex = 9;
+
+
+#if defined(ML_TFLM_LESS_COMPACT_TENSORS)
+extern const TfLiteNode tflNodesConst[kOpNodesCount];
+TfLiteNode * const tflNodes = const_cast<TfLiteNode *>(tflNodesConst);
+#elif defined(ML_TFLM_LESS_STATIC_INIT)
+extern TfLiteNode tflNodes[kOpNodesCount];
+#else
 TfLiteNode tflNodes[kOpNodesCount];
+#endif  // ML_TFLM_LESS_STATIC_INIT
 
 const TfArray<2, int> tensor_dimension0 = { 2, { 1, 784, } };
 const ALIGN(8) float tensor_data1[16] = { 
@@ -356,6 +396,71 @@ void *precomputed_op_user_data[] = {
 } // namespace tflite
 #endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
 
+#ifdef ML_TFLM_LESS_STATIC_INIT
+#if !TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+#error "ML_TFLM_LESS_STATIC_INIT needs the op user data precomputed offline (TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA)"
+#endif
+// Tensor and node tables resolved by scripts/ml_static_init_gen.py, with the
+// precomputed OpData of each node in place of its init and prepare.
+namespace {
+
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+// The eval tensors and the nodes are fixed by the memory plan and read by the
+// kernels from flash. Only the input and output tensors are kept as
+// TfLiteTensor, for TEST_MODEL_input() and TEST_MODEL_output().
+TfLiteTensor ioTensors[2] = {
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension0, .bytes = 3136, .type = kTfLiteFloat32, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension10, .bytes = 40, .type = kTfLiteFloat32, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+};
+#else
+TfLiteTensor tflTensorsWithMinus1[12] = {
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .raw = nullptr }, .dims = (TfLiteIntArray*)&emptyIntArray, .bytes = 0, .type = kTfLiteNoType, .allocation_type = kTfLiteMemNone, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension0, .bytes = 3136, .type = kTfLiteFloat32, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = (void*)tensor_data1 }, .dims = (TfLiteIntArray*)&tensor_dimension1, .bytes = 64, .type = kTfLiteFloat32, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = (void*)tensor_data2 }, .dims = (TfLiteIntArray*)&tensor_dimension2, .bytes = 40, .type = kTfLiteFloat32, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = (void*)tensor_data3 }, .dims = (TfLiteIntArray*)&tensor_dimension3, .bytes = 64, .type = kTfLiteFloat32, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = (void*)tensor_data4 }, .dims = (TfLiteIntArray*)&tensor_dimension4, .bytes = 50176, .type = kTfLiteFloat32, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = (void*)tensor_data5 }, .dims = (TfLiteIntArray*)&tensor_dimension5, .bytes = 1024, .type = kTfLiteFloat32, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = (void*)tensor_data6 }, .dims = (TfLiteIntArray*)&tensor_dimension6, .bytes = 640, .type = kTfLiteFloat32, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = tensor_arena + 3136 }, .dims = (TfLiteIntArray*)&tensor_dimension7, .bytes = 64, .type = kTfLiteFloat32, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension8, .bytes = 64, .type = kTfLiteFloat32, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = tensor_arena + 64 }, .dims = (TfLiteIntArray*)&tensor_dimension9, .bytes = 40, .type = kTfLiteFloat32, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension10, .bytes = 40, .type = kTfLiteFloat32, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+};
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
+
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+const TfLiteEvalTensor evalTensorsConst[11] = {
+#else
+TfLiteEvalTensor evalTensors[11] = {
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
+  { .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension0, .type = kTfLiteFloat32, },
+  { .data = { .data = (void*)tensor_data1 }, .dims = (TfLiteIntArray*)&tensor_dimension1, .type = kTfLiteFloat32, },
+  { .data = { .data = (void*)tensor_data2 }, .dims = (TfLiteIntArray*)&tensor_dimension2, .type = kTfLiteFloat32, },
+  { .data = { .data = (void*)tensor_data3 }, .dims = (TfLiteIntArray*)&tensor_dimension3, .type = kTfLiteFloat32, },
+  { .data = { .data = (void*)tensor_data4 }, .dims = (TfLiteIntArray*)&tensor_dimension4, .type = kTfLiteFloat32, },
+  { .data = { .data = (void*)tensor_data5 }, .dims = (TfLiteIntArray*)&tensor_dimension5, .type = kTfLiteFloat32, },
+  { .data = { .data = (void*)tensor_data6 }, .dims = (TfLiteIntArray*)&tensor_dimension6, .type = kTfLiteFloat32, },
+  { .data = { .data = tensor_arena + 3136 }, .dims = (TfLiteIntArray*)&tensor_dimension7, .type = kTfLiteFloat32, },
+  { .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension8, .type = kTfLiteFloat32, },
+  { .data = { .data = tensor_arena + 64 }, .dims = (TfLiteIntArray*)&tensor_dimension9, .type = kTfLiteFloat32, },
+  { .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension10, .type = kTfLiteFloat32, },
+};
+
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+const TfLiteNode tflNodesConst[kOpNodesCount] = {
+#else
+TfLiteNode tflNodes[kOpNodesCount] = {
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
+  { .inputs = (TfLiteIntArray *)&inputs0, .outputs = (TfLiteIntArray *)&outputs0, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::fully_connected::TEST_MODEL_op_user_data[0], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata0)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+  { .inputs = (TfLiteIntArray *)&inputs1, .outputs = (TfLiteIntArray *)&outputs1, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::fully_connected::TEST_MODEL_op_user_data[1], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata1)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+  { .inputs = (TfLiteIntArray *)&inputs2, .outputs = (TfLiteIntArray *)&outputs2, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::fully_connected::TEST_MODEL_op_user_data[2], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata2)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+  { .inputs = (TfLiteIntArray *)&inputs3, .outputs = (TfLiteIntArray *)&outputs3, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::softmax::TEST_MODEL_op_user_data[0], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata3)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+};
+
+} // namespace
+#endif  // ML_TFLM_LESS_STATIC_INIT
+
 class TEST_MODEL_PreinterpretedMicroContext : public tflite::MicroContext {
  public:
    TEST_MODEL_PreinterpretedMicroContext() : 
@@ -394,7 +499,11 @@ class TEST_MODEL_PreinterpretedMicroContext : public tflite::MicroContext {
   // Returns a temporary TfLiteTensor struct for a given index.
   // Virtual so that it can be faked for kernel tests.
   virtual TfLiteTensor* AllocateTempTfLiteTensor(int tensor_idx) {
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+    return nullptr;
+#else
     return tensor_idx >= 0 ? &tflTensors[tensor_idx] : nullptr;
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
   }
 
 
@@ -445,6 +554,7 @@ protected:
 };
 
 extern "C" TfLiteStatus TEST_MODEL_init() {
+  ML_BOOT_PHASE_BEGIN("tensor tables", ML_BOOT_PROFILE_NO_INDEX);
   head_ptr = tensor_arena ;
   tail_ptr = tensor_arena + sizeof(tensor_arena);
   ctx.AllocatePersistentBuffer = &AllocatePersistentBuffer;
@@ -457,6 +567,7 @@ extern "C" TfLiteStatus TEST_MODEL_init() {
   static TEST_MODEL_PreinterpretedMicroContext u_ctx;
   ctx.impl_ = static_cast<void *>(&u_ctx);
 
+#ifndef ML_TFLM_LESS_STATIC_INIT
   TfLiteIntArray dimsEmptyTensor = {0};
   tflTensors[-1].dims = &dimsEmptyTensor;
   tflTensors[-1].data.raw = nullptr;
@@ -472,10 +583,15 @@ extern "C" TfLiteStatus TEST_MODEL_init() {
     evalTensors[i].dims = tensorData[i].dims;
     tflTensors[i].quantization.type = kTfLiteNoQuantization;
   }
+#endif  // ML_TFLM_LESS_STATIC_INIT
+  ML_BOOT_PHASE_END();
+  ML_BOOT_PHASE_BEGIN("op registrations", ML_BOOT_PROFILE_NO_INDEX);
   registrations[OP_FULLY_CONNECTED] = tflite::Register_FULLY_CONNECTED();
   registrations[OP_SOFTMAX] = tflite::Register_SOFTMAX();
+  ML_BOOT_PHASE_END();
 
 
+#ifndef ML_TFLM_LESS_STATIC_INIT
 #if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
 tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precomputed_op_user_data);
 #endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
@@ -487,7 +603,9 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
     tflNodes[i].custom_initial_data = nullptr;
     tflNodes[i].custom_initial_data_size = 0;
     if (registrations[nodeData[i].used_op_index].init) {
+      ML_BOOT_PHASE_BEGIN("node init", (int32_t)i);
       tflNodes[i].user_data = registrations[nodeData[i].used_op_index].init(&ctx, (const char*)tflNodes[i].builtin_data, 0);
+      ML_BOOT_PHASE_END();
     }
   }
 
@@ -499,28 +617,39 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
   for(size_t i = 0; i < kOpNodesCount; ++i) {
     next_scratch_buffer_idx = precomputed_sb_idx_ctr;
     if (registrations[nodeData[i].used_op_index].prepare) {
+      ML_BOOT_PHASE_BEGIN("node prepare", (int32_t)i);
       TfLiteStatus status = registrations[nodeData[i].used_op_index].prepare(&ctx, &tflNodes[i]);
+      ML_BOOT_PHASE_END();
       if (status != kTfLiteOk) {
         return status;
       }
     }
     precomputed_sb_idx_ctr += node_scratch_buffer_requests[i];
   }
+#endif  // ML_TFLM_LESS_STATIC_INIT
   return kTfLiteOk;
 }
 
 extern "C" TfLiteTensor* TEST_MODEL_input(int index) {  
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+    return &ioTensors[index];
+#else
     static const int inTensorIndices[] = {
     0, 
     };
     return &ctx.tensors[inTensorIndices[index]];
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
   }
 
 extern "C" TfLiteTensor* TEST_MODEL_output(int index) {
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+    return &ioTensors[1 + index];
+#else
     static const int outTensorIndices[] = {
     10, 
     };
     return &ctx.tensors[outTensorIndices[index]];
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
   }
   
 
@@ -571,7 +700,9 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
 #if LOG_OP_INPUTS
     tflite::logOpInvoke(&ctx,  &tflNodes[i]);
 #endif
+    ML_LAYER_PROFILE_BEGIN();
     TfLiteStatus status = registrations[nodeData[i].used_op_index].invoke(&ctx, &tflNodes[i]);
+    ML_LAYER_PROFILE_END(i);
     if (status != kTfLiteOk) {
       return status;
     }
@@ -580,6 +711,40 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
 }
 
 
+extern "C" TfLiteStatus TEST_MODEL_invoke_classify(int *predicted_class) {
+
+#if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precomputed_op_user_data);
+#endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+
+  for(size_t i = 0; i < kClassifyNodesCount; ++i) {
+#if LOG_OP_INPUTS
+    tflite::logOpInvoke(&ctx,  &tflNodes[i]);
+#endif
+    TfLiteStatus status = registrations[nodeData[i].used_op_index].invoke(&ctx, &tflNodes[i]);
+    if (status != kTfLiteOk) {
+      return status;
+    }
+  }
+
+  // First index of the largest score, as mtb_ml_utils_find_max()
+  const float *scores = evalTensors[kClassifyTensorIndex].data.f;
+  const int count = evalTensors[kClassifyTensorIndex].dims->data[evalTensors[kClassifyTensorIndex].dims->size - 1];
+  int best = 0;
+  for(int i = 1; i < count; ++i) {
+    if (scores[i] > scores[best]) {
+      best = i;
+    }
+  }
+  *predicted_class = best;
+  return kTfLiteOk;
+}
+
+extern "C" void *TEST_MODEL_classify_scores() {
+  return evalTensors[kClassifyTensorIndex].data.data;
+}
+
+
 extern "C" TfLiteStatus TEST_MODEL_reset() {
 
   return kTfLiteOk;
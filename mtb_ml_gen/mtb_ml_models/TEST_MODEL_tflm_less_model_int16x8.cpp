@@ -21,6 +21,14 @@ namespace tflite {
 #include "ifx_common/offline_prepare_utils.h" 
 #endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
 
+// Startup phases of TEST_MODEL_init(), timed with ML_BOOT_PROFILE, and cycles
+// of each node invoke, with ML_LAYER_PROFILE, marked by
+// scripts/ml_profile_hooks_gen.py
+extern "C" {
+#include "ml_boot_profile.h"
+#include "ml_layer_profile.h"
+}
+
 
 #if defined __GNUC__
 #define ALIGN(X) __attribute__((aligned(X)))
@@ -84,17 +92,49 @@ TfLiteContext ctx{};
 
 // Tensor table with space for -1-th element used
 // designate missing optional inputs/outputs.
+#if defined(ML_TFLM_LESS_COMPACT_TENSORS)
+extern TfLiteTensor ioTensors[2];
+#elif defined(ML_TFLM_LESS_STATIC_INIT)
+extern TfLiteTensor tflTensorsWithMinus1[12];
+#else
 TfLiteTensor tflTensorsWithMinus1[12];
+#endif  // ML_TFLM_LESS_STATIC_INIT
      
+#if defined(ML_TFLM_LESS_COMPACT_TENSORS)
+extern const TfLiteEvalTensor evalTensorsConst[11];
+TfLiteEvalTensor * const evalTensors = const_cast<TfLiteEvalTensor *>(evalTensorsConst);
+#elif defined(ML_TFLM_LESS_STATIC_INIT)
+extern TfLiteEvalTensor evalTensors[11];
+#else
 TfLiteEvalTensor evalTensors[11];
+#endif  // ML_TFLM_LESS_STATIC_INIT
 
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+#ifndef ML_TFLM_LESS_STATIC_INIT
+#error "ML_TFLM_LESS_COMPACT_TENSORS needs ML_TFLM_LESS_STATIC_INIT"
+#endif
+TfLiteTensor * const tflTensors = nullptr;
+#else
 TfLiteTensor * const tflTensors = tflTensorsWithMinus1+1;
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
 
 TFLMRegistration registrations[OP_LAST];
 constexpr size_t kOpNodesCount = 4;
-
-
+// Nodes run by the classify invoke, found by scripts/ml_classify_gen.py. The
+// trailing nodes (OP_SOFTMAX) keep the order of the output scores, and the
+// scores are read from the input tensor of the first of them.
+constexpr size_t kClassifyNodesCount = 3;
+constexpr int kClassifyTensorIndex = 9;
+
+
+#if defined(ML_TFLM_LESS_COMPACT_TENSORS)
+extern const TfLiteNode tflNodesConst[kOpNodesCount];
+TfLiteNode * const tflNodes = const_cast<TfLiteNode *>(tflNodesConst);
+#elif defined(ML_TFLM_LESS_STATIC_INIT)
+extern TfLiteNode tflNodes[kOpNodesCount];
+#else
 TfLiteNode tflNodes[kOpNodesCount];
+#endif  // ML_TFLM_LESS_STATIC_INIT
 
 const TfArray<2, int> tensor_dimension0 = { 2, { 1, 784, } };
 const TfArray<1, float> quant0_scale = { 1, { 0.0077822199091315269, } };
@@ -358,16 +398,16 @@ OpData TEST_MODEL_op_user_data[] = {
 namespace softmax {
 
 constexpr float *TEST_MODEL_op_user_data0_table = nullptr;
-int16_t TEST_MODEL_op_user_data0_exp_lut[] = {
+const int16_t TEST_MODEL_op_user_data0_exp_lut[] = {
 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 32, 32, 33, 34, 34, 35, 36, 36, 37, 37, 38, 39, 40, 40, 42, 42, 43, 44, 45, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 59, 60, 60, 62, 63, 65, 65, 67, 68, 69, 71, 73, 74, 75, 77, 78, 80, 81, 83, 85, 86, 88, 90, 92, 93, 95, 97, 99, 101, 103, 105, 107, 109, 112, 114, 116, 118, 121, 123, 126, 128, 131, 133, 135, 139, 141, 144, 147, 149, 152, 155, 158, 162, 165, 168, 171, 174, 178, 181, 185, 189, 192, 196, 200, 204, 208, 212, 217, 221, 225, 230, 234, 239, 243, 248, 253, 258, 263, 268, 273, 279, 284, 290, 296, 302, 308, 314, 320, 327, 333, 340, 346, 353, 360, 366, 374, 381, 389, 397, 404, 413, 421, 429, 437, 446, 455, 464, 473, 482, 492, 501, 511, 522, 532, 543, 553, 564, 575, 586, 598, 610, 622, 634, 646, 659, 672, 685, 699, 713, 727, 741, 756, 771, 786, 801, 817, 833, 850, 866, 884, 901, 919, 937, 955, 974, 993, 1013, 1033, 1053, 1074, 1095, 1117, 1139, 1161, 1184, 1207, 1232, 1256, 1281, 1306, 1332, 1358, 1385, 1412, 1440, 1468, 1497, 1527, 1557, 1587, 1619, 1651, 1683, 1716, 1750, 1785, 1820, 1856, 1892, 1930, 1968, 2006, 2046, 2087, 2128, 2170, 2212, 2256, 2300, 2346, 2392, 2439, 2488, 2537, 2587, 2638, 2690, 2743, 2796, 2852, 2908, 2966, 3024, 3084, 3145, 3207, 3270, 3334, 3400, 3467, 3535, 3605, 3677, 3749, 3822, 3898, 3975, 4053, 4133, 4214, 4297, 4383, 4469, 4557, 4647, 4739, 4833, 4927, 5024, 5124, 5225, 5328, 5433, 5541, 5649, 5761, 5875, 5991, 6109, 6230, 6352, 6477, 6605, 6736, 6868, 7004, 7141, 7282, 7427, 7572, 7722, 7874, 8030, 8188, 8350, 8514, 8683, 8854, 9028, 9206, 9387, 9572, 9762, 9954, 10151, 10351, 10555, 10763, 10976, 11191, 11412, 11637, 11867, 12102, 12341, 12583, 12831, 13085, 13342, 13606, 13874, 14148, 14427, 14711, 15002, 15297, 15599, 15907, 16221, 16541, 16867, 17199, 17539, 17884, 18237, 18597, 18964, 19338, 19719, 20108, 20505, 20909, 21322, 21742, 22171, 22608, 23054, 23509, 23973, 24445, 24928, 25419, 25921, 26432, 26953, 27485, 28027, 28580, 29143, 29718, 30304, 30902, 31512, 32133, 32767, 
 };
-int16_t TEST_MODEL_op_user_data0_one_over_one_plus_x_lut[] = {
+const int16_t TEST_MODEL_op_user_data0_one_over_one_plus_x_lut[] = {
 32767, 32704, 32640, 32578, 32514, 32451, 32388, 32326, 32264, 32202, 32141, 32079, 32018, 31957, 31896, 31835, 31775, 31715, 31655, 31596, 31537, 31476, 31418, 31359, 31301, 31242, 31184, 31127, 31069, 31011, 30954, 30897, 30840, 30784, 30727, 30671, 30615, 30560, 30504, 30449, 30394, 30339, 30283, 30229, 30175, 30121, 30067, 30013, 29960, 29906, 29853, 29800, 29746, 29694, 29642, 29589, 29537, 29486, 29434, 29382, 29331, 29280, 29229, 29177, 29127, 29076, 29026, 28976, 28926, 28877, 28827, 28777, 28728, 28679, 28630, 28581, 28532, 28484, 28436, 28388, 28340, 28292, 28244, 28197, 28150, 28103, 28056, 28008, 27962, 27915, 27869, 27823, 27777, 27731, 27685, 27640, 27594, 27549, 27504, 27459, 27413, 27369, 27324, 27280, 27236, 27192, 27148, 27104, 27060, 27016, 26973, 26930, 26887, 26844, 26801, 26758, 26715, 26673, 26630, 26588, 26546, 26504, 26463, 26421, 26380, 26338, 26297, 26255, 26214, 26174, 26132, 26092, 26051, 26011, 25971, 25931, 25891, 25851, 25811, 25772, 25732, 25693, 25653, 25614, 25575, 25536, 25497, 25458, 25420, 25381, 25343, 25305, 25267, 25229, 25191, 25153, 25116, 25078, 25041, 25003, 24966, 24928, 24892, 24855, 24818, 24781, 24745, 24709, 24672, 24636, 24600, 24564, 24528, 24492, 24457, 24421, 24385, 24350, 24315, 24280, 24245, 24210, 24175, 24140, 24105, 24070, 24036, 24002, 23967, 23933, 23899, 23865, 23831, 23798, 23764, 23730, 23697, 23664, 23630, 23597, 23564, 23530, 23498, 23465, 23432, 23399, 23366, 23334, 23302, 23269, 23237, 23205, 23173, 23141, 23109, 23077, 23046, 23014, 22982, 22951, 22920, 22888, 22857, 22826, 22795, 22764, 22733, 22703, 22672, 22641, 22611, 22580, 22550, 22520, 22490, 22459, 22429, 22400, 22370, 22340, 22310, 22281, 22251, 22221, 22192, 22163, 22134, 22104, 22075, 22046, 22017, 21988, 21959, 21931, 21902, 21874, 21845, 21817, 21788, 21760, 21732, 21704, 21676, 21648, 21620, 21592, 21565, 21537, 21509, 21482, 21455, 21427, 21400, 21372, 21345, 21318, 21291, 21264, 21237, 21210, 21183, 21157, 21130, 21103, 21077, 21050, 21024, 20998, 20971, 20945, 20919, 20893, 20867, 20841, 20816, 20790, 20764, 20738, 20713, 20687, 20662, 20636, 20611, 20586, 20560, 20535, 20510, 20485, 20460, 20435, 20410, 20385, 20360, 20336, 20311, 20287, 20262, 20238, 20213, 20189, 20165, 20141, 20117, 20092, 20068, 20044, 20021, 19997, 19973, 19949, 19926, 19902, 19878, 19855, 19832, 19808, 19784, 19762, 19738, 19715, 19692, 19668, 19645, 19622, 19600, 19577, 19553, 19531, 19508, 19485, 19463, 19440, 19418, 19395, 19373, 19351, 19328, 19306, 19284, 19262, 19240, 19218, 19196, 19174, 19152, 19130, 19109, 19087, 19065, 19044, 19022, 19000, 18979, 18958, 18936, 18915, 18893, 18872, 18851, 18830, 18809, 18787, 18766, 18745, 18725, 18704, 18682, 18662, 18641, 18620, 18600, 18579, 18559, 18538, 18518, 18497, 18477, 18457, 18436, 18416, 18396, 18376, 18356, 18336, 18316, 18296, 18276, 18256, 18236, 18216, 18197, 18177, 18157, 18138, 18118, 18099, 18079, 18059, 18040, 18021, 18001, 17982, 17963, 17944, 17924, 17905, 17886, 17867, 17848, 17829, 17810, 17791, 17772, 17754, 17735, 17716, 17697, 17679, 17660, 17641, 17623, 17604, 17586, 17568, 17549, 17531, 17513, 17494, 17476, 17458, 17440, 17422, 17404, 17386, 17368, 17350, 17332, 17314, 17296, 17278, 17261, 17243, 17225, 17208, 17190, 17172, 17155, 17137, 17120, 17102, 17085, 17067, 17050, 17033, 17015, 16999, 16981, 16964, 16947, 16930, 16913, 16895, 16878, 16862, 16845, 16828, 16810, 16794, 16777, 16760, 16743, 16727, 16710, 16693, 16677, 16660, 16644, 16627, 16611, 16594, 16578, 16562, 16545, 16529, 16513, 16497, 16480, 16464, 16448, 16432, 16416, 16400, 16384, 
 };
 constexpr uint8_t *TEST_MODEL_op_user_data0_uint8_table1 = nullptr;
 constexpr uint8_t *TEST_MODEL_op_user_data0_uint8_table2 = nullptr;
 OpData TEST_MODEL_op_user_data[] = {
-  {{0.000000000000e+00, 1724922364, 5, 0, 0, 0, 0, 3.051757812500e-05, TEST_MODEL_op_user_data0_table, TEST_MODEL_op_user_data0_exp_lut, TEST_MODEL_op_user_data0_one_over_one_plus_x_lut, TEST_MODEL_op_user_data0_uint8_table1, TEST_MODEL_op_user_data0_uint8_table2}, 1, 10, SoftmaxQuantizedInt16}
+  {{0.000000000000e+00, 1724922364, 5, 0, 0, 0, 0, 3.051757812500e-05, TEST_MODEL_op_user_data0_table, const_cast<int16_t*>(TEST_MODEL_op_user_data0_exp_lut), const_cast<int16_t*>(TEST_MODEL_op_user_data0_one_over_one_plus_x_lut), TEST_MODEL_op_user_data0_uint8_table1, TEST_MODEL_op_user_data0_uint8_table2}, 1, 10, SoftmaxQuantizedInt16}
 };
 } // namespace softmax
 
@@ -400,6 +440,71 @@ void *precomputed_op_user_data[] = {
 } // namespace tflite
 #endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
 
+#ifdef ML_TFLM_LESS_STATIC_INIT
+#if !TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+#error "ML_TFLM_LESS_STATIC_INIT needs the op user data precomputed offline (TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA)"
+#endif
+// Tensor and node tables resolved by scripts/ml_static_init_gen.py, with the
+// precomputed OpData of each node in place of its init and prepare.
+namespace {
+
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+// The eval tensors and the nodes are fixed by the memory plan and read by the
+// kernels from flash. Only the input and output tensors are kept as
+// TfLiteTensor, for TEST_MODEL_input() and TEST_MODEL_output().
+TfLiteTensor ioTensors[2] = {
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant0)) }, .params = { 0.0077822199091315269f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension0, .bytes = 1568, .type = kTfLiteInt16, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant10)) }, .params = { 3.0517578125e-05f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension10, .bytes = 20, .type = kTfLiteInt16, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+};
+#else
+TfLiteTensor tflTensorsWithMinus1[12] = {
+  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, .data = { .raw = nullptr }, .dims = (TfLiteIntArray*)&emptyIntArray, .bytes = 0, .type = kTfLiteNoType, .allocation_type = kTfLiteMemNone, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant0)) }, .params = { 0.0077822199091315269f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension0, .bytes = 1568, .type = kTfLiteInt16, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant1)) }, .params = { 5.4153835662873462e-05f, 0 }, .data = { .data = (void*)tensor_data1 }, .dims = (TfLiteIntArray*)&tensor_dimension1, .bytes = 128, .type = kTfLiteInt64, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant2)) }, .params = { 2.4669863705639727e-05f, 0 }, .data = { .data = (void*)tensor_data2 }, .dims = (TfLiteIntArray*)&tensor_dimension2, .bytes = 80, .type = kTfLiteInt64, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant3)) }, .params = { 1.3146465789759532e-05f, 0 }, .data = { .data = (void*)tensor_data3 }, .dims = (TfLiteIntArray*)&tensor_dimension3, .bytes = 128, .type = kTfLiteInt64, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant4)) }, .params = { 0.0016892950516194105f, 0 }, .data = { .data = (void*)tensor_data4 }, .dims = (TfLiteIntArray*)&tensor_dimension4, .bytes = 12544, .type = kTfLiteInt8, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant5)) }, .params = { 0.0039675491861999035f, 0 }, .data = { .data = (void*)tensor_data5 }, .dims = (TfLiteIntArray*)&tensor_dimension5, .bytes = 256, .type = kTfLiteInt8, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant6)) }, .params = { 0.0052004586905241013f, 0 }, .data = { .data = (void*)tensor_data6 }, .dims = (TfLiteIntArray*)&tensor_dimension6, .bytes = 160, .type = kTfLiteInt8, .allocation_type = kTfLiteMmapRo, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant7)) }, .params = { 0.013649190776050091f, 0 }, .data = { .data = tensor_arena + 1568 }, .dims = (TfLiteIntArray*)&tensor_dimension7, .bytes = 32, .type = kTfLiteInt16, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant8)) }, .params = { 0.0047437860630452633f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension8, .bytes = 32, .type = kTfLiteInt16, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant9)) }, .params = { 0.003922079224139452f, 0 }, .data = { .data = tensor_arena + 32 }, .dims = (TfLiteIntArray*)&tensor_dimension9, .bytes = 20, .type = kTfLiteInt16, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+  { .quantization = { kTfLiteAffineQuantization, const_cast<void*>(static_cast<const void*>(&quant10)) }, .params = { 3.0517578125e-05f, 0 }, .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension10, .bytes = 20, .type = kTfLiteInt16, .allocation_type = kTfLiteArenaRw, .is_variable = false, },
+};
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
+
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+const TfLiteEvalTensor evalTensorsConst[11] = {
+#else
+TfLiteEvalTensor evalTensors[11] = {
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
+  { .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension0, .type = kTfLiteInt16, },
+  { .data = { .data = (void*)tensor_data1 }, .dims = (TfLiteIntArray*)&tensor_dimension1, .type = kTfLiteInt64, },
+  { .data = { .data = (void*)tensor_data2 }, .dims = (TfLiteIntArray*)&tensor_dimension2, .type = kTfLiteInt64, },
+  { .data = { .data = (void*)tensor_data3 }, .dims = (TfLiteIntArray*)&tensor_dimension3, .type = kTfLiteInt64, },
+  { .data = { .data = (void*)tensor_data4 }, .dims = (TfLiteIntArray*)&tensor_dimension4, .type = kTfLiteInt8, },
+  { .data = { .data = (void*)tensor_data5 }, .dims = (TfLiteIntArray*)&tensor_dimension5, .type = kTfLiteInt8, },
+  { .data = { .data = (void*)tensor_data6 }, .dims = (TfLiteIntArray*)&tensor_dimension6, .type = kTfLiteInt8, },
+  { .data = { .data = tensor_arena + 1568 }, .dims = (TfLiteIntArray*)&tensor_dimension7, .type = kTfLiteInt16, },
+  { .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension8, .type = kTfLiteInt16, },
+  { .data = { .data = tensor_arena + 32 }, .dims = (TfLiteIntArray*)&tensor_dimension9, .type = kTfLiteInt16, },
+  { .data = { .data = tensor_arena + 0 }, .dims = (TfLiteIntArray*)&tensor_dimension10, .type = kTfLiteInt16, },
+};
+
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+const TfLiteNode tflNodesConst[kOpNodesCount] = {
+#else
+TfLiteNode tflNodes[kOpNodesCount] = {
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
+  { .inputs = (TfLiteIntArray *)&inputs0, .outputs = (TfLiteIntArray *)&outputs0, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::fully_connected::TEST_MODEL_op_user_data[0], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata0)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+  { .inputs = (TfLiteIntArray *)&inputs1, .outputs = (TfLiteIntArray *)&outputs1, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::fully_connected::TEST_MODEL_op_user_data[1], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata1)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+  { .inputs = (TfLiteIntArray *)&inputs2, .outputs = (TfLiteIntArray *)&outputs2, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::fully_connected::TEST_MODEL_op_user_data[2], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata2)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+  { .inputs = (TfLiteIntArray *)&inputs3, .outputs = (TfLiteIntArray *)&outputs3, .intermediates = (TfLiteIntArray *)&emptyIntArray, .user_data = &tflite::ops::micro::softmax::TEST_MODEL_op_user_data[0], .builtin_data = const_cast<void*>(static_cast<const void*>(&opdata3)), .custom_initial_data = nullptr, .custom_initial_data_size = 0, },
+};
+
+} // namespace
+#endif  // ML_TFLM_LESS_STATIC_INIT
+
 class TEST_MODEL_PreinterpretedMicroContext : public tflite::MicroContext {
  public:
    TEST_MODEL_PreinterpretedMicroContext() : 
@@ -438,7 +543,11 @@ class TEST_MODEL_PreinterpretedMicroContext : public tflite::MicroContext {
   // Returns a temporary TfLiteTensor struct for a given index.
   // Virtual so that it can be faked for kernel tests.
   virtual TfLiteTensor* AllocateTempTfLiteTensor(int tensor_idx) {
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+    return nullptr;
+#else
     return tensor_idx >= 0 ? &tflTensors[tensor_idx] : nullptr;
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
   }
 
 
@@ -489,6 +598,7 @@ protected:
 };
 
 extern "C" TfLiteStatus TEST_MODEL_init() {
+  ML_BOOT_PHASE_BEGIN("tensor tables", ML_BOOT_PROFILE_NO_INDEX);
   head_ptr = tensor_arena ;
   tail_ptr = tensor_arena + sizeof(tensor_arena);
   ctx.AllocatePersistentBuffer = &AllocatePersistentBuffer;
@@ -501,6 +611,7 @@ extern "C" TfLiteStatus TEST_MODEL_init() {
   static TEST_MODEL_PreinterpretedMicroContext u_ctx;
   ctx.impl_ = static_cast<void *>(&u_ctx);
 
+#ifndef ML_TFLM_LESS_STATIC_INIT
   TfLiteIntArray dimsEmptyTensor = {0};
   tflTensors[-1].dims = &dimsEmptyTensor;
   tflTensors[-1].data.raw = nullptr;
@@ -525,10 +636,15 @@ extern "C" TfLiteStatus TEST_MODEL_init() {
       tflTensors[i].params.zero_point = quant->affine.zero_point->data[0];
     }
   }
+#endif  // ML_TFLM_LESS_STATIC_INIT
+  ML_BOOT_PHASE_END();
+  ML_BOOT_PHASE_BEGIN("op registrations", ML_BOOT_PROFILE_NO_INDEX);
   registrations[OP_FULLY_CONNECTED] = tflite::Register_FULLY_CONNECTED();
   registrations[OP_SOFTMAX] = tflite::Register_SOFTMAX();
+  ML_BOOT_PHASE_END();
 
 
+#ifndef ML_TFLM_LESS_STATIC_INIT
 #if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
 tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precomputed_op_user_data);
 #endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
@@ -540,7 +656,9 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
     tflNodes[i].custom_initial_data = nullptr;
     tflNodes[i].custom_initial_data_size = 0;
     if (registrations[nodeData[i].used_op_index].init) {
+      ML_BOOT_PHASE_BEGIN("node init", (int32_t)i);
       tflNodes[i].user_data = registrations[nodeData[i].used_op_index].init(&ctx, (const char*)tflNodes[i].builtin_data, 0);
+      ML_BOOT_PHASE_END();
     }
   }
 
@@ -552,28 +670,39 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
   for(size_t i = 0; i < kOpNodesCount; ++i) {
     next_scratch_buffer_idx = precomputed_sb_idx_ctr;
     if (registrations[nodeData[i].used_op_index].prepare) {
+      ML_BOOT_PHASE_BEGIN("node prepare", (int32_t)i);
       TfLiteStatus status = registrations[nodeData[i].used_op_index].prepare(&ctx, &tflNodes[i]);
+      ML_BOOT_PHASE_END();
       if (status != kTfLiteOk) {
         return status;
       }
     }
     precomputed_sb_idx_ctr += node_scratch_buffer_requests[i];
   }
+#endif  // ML_TFLM_LESS_STATIC_INIT
   return kTfLiteOk;
 }
 
 extern "C" TfLiteTensor* TEST_MODEL_input(int index) {  
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+    return &ioTensors[index];
+#else
     static const int inTensorIndices[] = {
     0, 
     };
     return &ctx.tensors[inTensorIndices[index]];
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
   }
 
 extern "C" TfLiteTensor* TEST_MODEL_output(int index) {
+#ifdef ML_TFLM_LESS_COMPACT_TENSORS
+    return &ioTensors[1 + index];
+#else
     static const int outTensorIndices[] = {
     10, 
     };
     return &ctx.tensors[outTensorIndices[index]];
+#endif  // ML_TFLM_LESS_COMPACT_TENSORS
   }
   
 
@@ -624,7 +753,9 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
 #if LOG_OP_INPUTS
     tflite::logOpInvoke(&ctx,  &tflNodes[i]);
 #endif
+    ML_LAYER_PROFILE_BEGIN();
     TfLiteStatus status = registrations[nodeData[i].used_op_index].invoke(&ctx, &tflNodes[i]);
+    ML_LAYER_PROFILE_END(i);
     if (status != kTfLiteOk) {
       return status;
     }
@@ -633,6 +764,40 @@ tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precompu
 }
 
 
+extern "C" TfLiteStatus TEST_MODEL_invoke_classify(int *predicted_class) {
+
+#if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+tflite::micro::resetOfflineOpUserData( tflite::micro::TEST_MODEL_model::precomputed_op_user_data);
+#endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA
+
+  for(size_t i = 0; i < kClassifyNodesCount; ++i) {
+#if LOG_OP_INPUTS
+    tflite::logOpInvoke(&ctx,  &tflNodes[i]);
+#endif
+    TfLiteStatus status = registrations[nodeData[i].used_op_index].invoke(&ctx, &tflNodes[i]);
+    if (status != kTfLiteOk) {
+      return status;
+    }
+  }
+
+  // First index of the largest score, as mtb_ml_utils_find_max()
+  const int16_t *scores = evalTensors[kClassifyTensorIndex].data.i16;
+  const int count = evalTensors[kClassifyTensorIndex].dims->data[evalTensors[kClassifyTensorIndex].dims->size - 1];
+  int best = 0;
+  for(int i = 1; i < count; ++i) {
+    if (scores[i] > scores[best]) {
+      best = i;
+    }
+  }
+  *predicted_class = best;
+  return kTfLiteOk;
+}
+
+extern "C" void *TEST_MODEL_classify_scores() {
+  return evalTensors[kClassifyTensorIndex].data.data;
+}
+
+
 extern "C" TfLiteStatus TEST_MODEL_reset() {
 
   return kTfLiteOk;
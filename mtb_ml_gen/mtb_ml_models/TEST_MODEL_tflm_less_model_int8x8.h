@@ -24,6 +24,13 @@ TfLiteTensor *TEST_MODEL_input(int index);
 TfLiteTensor *TEST_MODEL_output(int index);
 // Runs inference for the model.
 TfLiteStatus TEST_MODEL_invoke();
+// Runs inference up to the last node that can change the order of the output
+// scores, and returns the index of the largest score. The output tensor is
+// not updated.
+TfLiteStatus TEST_MODEL_invoke_classify(int *predicted_class);
+// Returns the scores read by TEST_MODEL_invoke_classify(), which are the
+// input of the trailing nodes after TEST_MODEL_invoke().
+void *TEST_MODEL_classify_scores();
 // Resets all variable tensors
 TfLiteStatus TEST_MODEL_reset();
 
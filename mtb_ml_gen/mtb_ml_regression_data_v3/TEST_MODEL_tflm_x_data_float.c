@@ -0,0 +1,6471 @@
+/***************************************************************************//**
+* \file TEST_MODEL_tflm_x_data_float.c
+*
+* \brief
+* Generated with scripts/ml_regression_convert.py, this file contains input
+* data for the TEST_MODEL model in float representation (v3 regression container).
+******************************************************************************/
+
+
+#include "TEST_MODEL_tflm_x_data_float.h"
+
+
+const uint8_t TEST_MODEL_x_data_bin[TEST_MODEL_X_DATA_BIN_LEN] __attribute__((aligned(4))) = {
+  0x4d, 0x4c, 0x52, 0x33, 0x03, 0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x10, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x2c, 0x02, 0x00, 0x00, 0xa8, 0x2e, 0x01, 0x00, 0xf4, 0x02, 0x00, 0x00,
+  0x40, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0x34, 0x30, 0x00, 0x00, 0x68, 0x2d, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0x9c, 0x5d, 0x00, 0x00, 0xc0, 0x2d, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x5c, 0x8b, 0x00, 0x00,
+  0x1c, 0x2f, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0x78, 0xba, 0x00, 0x00, 0x28, 0x36, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0xa0, 0xf0, 0x00, 0x00, 0x98, 0x32, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x38, 0x23, 0x01, 0x00,
+  0x70, 0x0b, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
+  0xf4, 0x02, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00, 0xf4, 0x08, 0x00, 0x00,
+  0xb4, 0x0a, 0x00, 0x00, 0x78, 0x0c, 0x00, 0x00, 0xd4, 0x0f, 0x00, 0x00,
+  0x1c, 0x12, 0x00, 0x00, 0xe0, 0x15, 0x00, 0x00, 0x60, 0x19, 0x00, 0x00,
+  0xbc, 0x1c, 0x00, 0x00, 0xdc, 0x1f, 0x00, 0x00, 0x68, 0x23, 0x00, 0x00,
+  0x08, 0x26, 0x00, 0x00, 0x60, 0x28, 0x00, 0x00, 0xfc, 0x29, 0x00, 0x00,
+  0x70, 0x2d, 0x00, 0x00, 0x34, 0x30, 0x00, 0x00, 0xd0, 0x32, 0x00, 0x00,
+  0xe0, 0x34, 0x00, 0x00, 0xc0, 0x37, 0x00, 0x00, 0xc0, 0x3a, 0x00, 0x00,
+  0x54, 0x3e, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x18, 0x45, 0x00, 0x00,
+  0x5c, 0x48, 0x00, 0x00, 0x5c, 0x4b, 0x00, 0x00, 0x08, 0x4d, 0x00, 0x00,
+  0x58, 0x50, 0x00, 0x00, 0x50, 0x53, 0x00, 0x00, 0x0c, 0x56, 0x00, 0x00,
+  0xb0, 0x59, 0x00, 0x00, 0x44, 0x5b, 0x00, 0x00, 0x9c, 0x5d, 0x00, 0x00,
+  0x44, 0x61, 0x00, 0x00, 0xf4, 0x63, 0x00, 0x00, 0xa8, 0x66, 0x00, 0x00,
+  0x4c, 0x68, 0x00, 0x00, 0xd4, 0x6a, 0x00, 0x00, 0x08, 0x6e, 0x00, 0x00,
+  0xf4, 0x70, 0x00, 0x00, 0xe8, 0x72, 0x00, 0x00, 0x0c, 0x76, 0x00, 0x00,
+  0x4c, 0x79, 0x00, 0x00, 0x6c, 0x7c, 0x00, 0x00, 0xa8, 0x7f, 0x00, 0x00,
+  0x88, 0x82, 0x00, 0x00, 0x4c, 0x85, 0x00, 0x00, 0xb8, 0x88, 0x00, 0x00,
+  0x5c, 0x8b, 0x00, 0x00, 0x54, 0x8e, 0x00, 0x00, 0x20, 0x90, 0x00, 0x00,
+  0xf8, 0x92, 0x00, 0x00, 0xcc, 0x94, 0x00, 0x00, 0x74, 0x99, 0x00, 0x00,
+  0x8c, 0x9c, 0x00, 0x00, 0xb4, 0x9e, 0x00, 0x00, 0x34, 0xa2, 0x00, 0x00,
+  0x54, 0xa5, 0x00, 0x00, 0x08, 0xa8, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00,
+  0xa0, 0xad, 0x00, 0x00, 0x04, 0xb2, 0x00, 0x00, 0x28, 0xb4, 0x00, 0x00,
+  0x64, 0xb7, 0x00, 0x00, 0x78, 0xba, 0x00, 0x00, 0xac, 0xbd, 0x00, 0x00,
+  0x08, 0xc1, 0x00, 0x00, 0x64, 0xc4, 0x00, 0x00, 0x60, 0xc7, 0x00, 0x00,
+  0x40, 0xcb, 0x00, 0x00, 0x54, 0xce, 0x00, 0x00, 0xe8, 0xd1, 0x00, 0x00,
+  0x90, 0xd4, 0x00, 0x00, 0x34, 0xd8, 0x00, 0x00, 0x14, 0xdb, 0x00, 0x00,
+  0xac, 0xde, 0x00, 0x00, 0x3c, 0xe2, 0x00, 0x00, 0xf8, 0xe5, 0x00, 0x00,
+  0x30, 0xe9, 0x00, 0x00, 0x9c, 0xed, 0x00, 0x00, 0xa0, 0xf0, 0x00, 0x00,
+  0xa0, 0xf4, 0x00, 0x00, 0x98, 0xf6, 0x00, 0x00, 0x74, 0xf9, 0x00, 0x00,
+  0x08, 0xfd, 0x00, 0x00, 0x44, 0x00, 0x01, 0x00, 0xb8, 0x04, 0x01, 0x00,
+  0x70, 0x08, 0x01, 0x00, 0x58, 0x0b, 0x01, 0x00, 0x1c, 0x0f, 0x01, 0x00,
+  0x9c, 0x11, 0x01, 0x00, 0x4c, 0x13, 0x01, 0x00, 0x70, 0x16, 0x01, 0x00,
+  0x0c, 0x1a, 0x01, 0x00, 0x00, 0x1d, 0x01, 0x00, 0xdc, 0x1f, 0x01, 0x00,
+  0x38, 0x23, 0x01, 0x00, 0x08, 0x25, 0x01, 0x00, 0x3c, 0x28, 0x01, 0x00,
+  0x50, 0x2b, 0x01, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x09, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x02, 0x00,
+  0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x06, 0x00,
+  0x03, 0x00, 0x09, 0x00, 0x02, 0x00, 0x01, 0x00, 0x09, 0x00, 0x05, 0x00,
+  0x09, 0x00, 0x06, 0x00, 0x01, 0x00, 0x07, 0x00, 0x02, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x08, 0x00, 0x03, 0x00, 0x09, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00,
+  0x08, 0x00, 0x09, 0x00, 0x01, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0x05, 0x00, 0x00, 0x5c, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00,
+  0x00, 0xb0, 0x42, 0x00, 0x00, 0x00, 0x40, 0x94, 0x10, 0x00, 0x00, 0x80,
+  0x41, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x38,
+  0x42, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xc8,
+  0x41, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xc8,
+  0x41, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xa6, 0x42, 0x00, 0x00, 0xc8,
+  0x41, 0x00, 0x00, 0x40, 0x40, 0x89, 0x11, 0x00, 0x00, 0x80, 0x40, 0x00,
+  0x00, 0x2b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x24, 0x42, 0x89, 0x11, 0x00, 0x00, 0xd4,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x3c,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf4, 0x42, 0x88, 0x04, 0x00,
+  0x00, 0x10, 0x41, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x82, 0x0a, 0x00, 0x00, 0x84,
+  0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x90,
+  0x42, 0x00, 0x00, 0xc4, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0xb2,
+  0x42, 0x00, 0x00, 0xe0, 0x40, 0x88, 0x03, 0x00, 0x00, 0x10, 0x41, 0x00,
+  0x00, 0x5e, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x44, 0x42, 0x86,
+  0x05, 0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x20,
+  0x42, 0x8b, 0x01, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x24, 0x42, 0x86,
+  0x05, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x7c,
+  0x42, 0x94, 0x04, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x23, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x96,
+  0x04, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x00, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0x54, 0x42, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x2c, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x96, 0x03, 0x00, 0x00, 0x2d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x50,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0xfc, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x21, 0x43, 0x95, 0x04, 0x00, 0x00, 0x30,
+  0x41, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x96, 0x04, 0x00, 0x00, 0xc2, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x44, 0x42, 0x94, 0x05, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x13,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x49,
+  0x43, 0x00, 0x00, 0x50, 0x42, 0x94, 0x05, 0x00, 0x00, 0x30, 0x41, 0x00,
+  0x00, 0xd8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3c, 0x43, 0x00, 0x00, 0x10, 0x41, 0x94, 0x05, 0x00, 0x00, 0x10,
+  0x41, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x14, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x15, 0x43, 0x00, 0x00, 0x80, 0x40, 0xac, 0x00, 0x00, 0x00, 0x00,
+  0xc6, 0x03, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x96, 0x04, 0x00, 0x00, 0xc0, 0x41,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x23, 0x43,
+  0x00, 0x00, 0x10, 0x42, 0x96, 0x03, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x96, 0x04,
+  0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x95, 0x04, 0x00, 0x00,
+  0x8c, 0x42, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x76, 0x43, 0x00, 0x00, 0x82, 0x42, 0x95, 0x04, 0x00, 0x00, 0x84, 0x42,
+  0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5a, 0x43,
+  0x00, 0x00, 0xe8, 0x42, 0x94, 0x05, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00,
+  0xaa, 0x42, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x30, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x95, 0x04, 0x00, 0x00, 0x25, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf8, 0x42,
+  0x00, 0x00, 0x80, 0x40, 0x95, 0x04, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00,
+  0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00,
+  0x80, 0x40, 0x95, 0x04, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x7a, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0xc8, 0x41,
+  0x96, 0x04, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0xd0, 0x42, 0x85, 0x03,
+  0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x24, 0x42,
+  0x00, 0x00, 0x10, 0x41, 0x8b, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00,
+  0x54, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00,
+  0x58, 0x42, 0x84, 0x08, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xc8, 0x42,
+  0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x10, 0x42,
+  0x00, 0x00, 0x00, 0x40, 0x88, 0x03, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x82, 0x0b,
+  0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x1e, 0x43,
+  0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x76, 0x43,
+  0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xae, 0x42,
+  0x87, 0x03, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x4d, 0x43, 0x81, 0x0d, 0x00, 0x00, 0x88, 0x41,
+  0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x01, 0x43,
+  0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x42,
+  0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x1b, 0x43, 0x87, 0x0b, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00,
+  0x30, 0x42, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00,
+  0x90, 0x42, 0x00, 0x00, 0xf8, 0x41, 0x84, 0x02, 0x00, 0x00, 0x38, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x26, 0x43, 0x87, 0x08, 0x00, 0x00,
+  0xc6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00,
+  0x42, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0xd0, 0x42, 0x85, 0x04,
+  0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x64, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x04, 0x43, 0x87, 0x08, 0x00, 0x00,
+  0x40, 0x40, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x44, 0x42, 0x81, 0x08,
+  0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0xac, 0x42,
+  0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0xf0, 0x41,
+  0x88, 0x11, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00,
+  0x2f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00,
+  0x5a, 0x43, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x20, 0x42, 0x8b, 0x0f, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x54, 0x42,
+  0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0xd0, 0x42,
+  0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x40, 0x40, 0x8e, 0x08, 0x00, 0x00,
+  0x10, 0x41, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00,
+  0x96, 0x42, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00,
+  0x30, 0x41, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x10, 0x41, 0xff, 0xaf,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x82, 0x03, 0x00, 0x00, 0xe8, 0x41, 0x00,
+  0x00, 0x58, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x4c, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x95, 0x05, 0x00,
+  0x00, 0xf0, 0x41, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x30, 0x41, 0x95,
+  0x04, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x70, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0xc8, 0x41, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xd6, 0x42, 0x95, 0x05, 0x00, 0x00, 0xb8,
+  0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x95, 0x03, 0x00,
+  0x00, 0xd6, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x39, 0x43, 0x96, 0x04, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x40,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x39,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x9c, 0x42, 0x95, 0x04, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x98,
+  0x41, 0x95, 0x04, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x60, 0x41, 0x95,
+  0x04, 0x00, 0x00, 0xa4, 0x42, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x60, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0x14, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x60, 0x41, 0x96, 0x03, 0x00, 0x00, 0xa6,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x48, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00,
+  0x00, 0x54, 0x42, 0x95, 0x03, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x61, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x9a, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x60, 0x43, 0x00, 0x00, 0xf0, 0x42, 0x94, 0x05, 0x00, 0x00, 0x40,
+  0x41, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x95, 0x04, 0x00,
+  0x00, 0xcc, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x59, 0x43, 0x00, 0x00, 0xae, 0x42, 0x97, 0x03, 0x00, 0x00, 0x1c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0xf8,
+  0x41, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x82, 0x03, 0x00,
+  0x00, 0xe8, 0x41, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00,
+  0x00, 0x4c, 0x42, 0x97, 0x03, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x96, 0x03, 0x00,
+  0x00, 0x34, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xd4, 0x42, 0x96, 0x04, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x74,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xba,
+  0x42, 0x96, 0x04, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0xa0, 0x41, 0x94,
+  0x05, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xa8,
+  0x41, 0x95, 0x04, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x60, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x25, 0x43, 0x95, 0x04, 0x00,
+  0x00, 0x8e, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xbe, 0x42, 0x96, 0x04, 0x00, 0x00, 0x8e,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x1c, 0x42, 0x94, 0x05, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x45, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x0b, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x94, 0x05, 0x00, 0x00, 0x88,
+  0x41, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x95, 0x04, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x95, 0x04, 0x00, 0x00, 0x70,
+  0x42, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0x2c, 0x43, 0x95, 0x04, 0x00, 0x00, 0xb2, 0x42, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x48, 0x42, 0x95, 0x04, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x1a,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x32, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00,
+  0x00, 0x8e, 0x42, 0x94, 0x05, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4c,
+  0x43, 0x00, 0x00, 0xe8, 0x41, 0x95, 0x04, 0x00, 0x00, 0xd6, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00,
+  0x00, 0xe0, 0x41, 0x96, 0x03, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0xc8, 0x41, 0xff, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x9d, 0x04, 0x00, 0x00, 0x10, 0x41, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x00,
+  0x00, 0xe0, 0x40, 0x94, 0x07, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x9e,
+  0x42, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0xf0,
+  0x41, 0x91, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x8c, 0x42, 0x00,
+  0x00, 0xd0, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x8c, 0x42, 0x8f,
+  0x0b, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x21,
+  0x43, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xec,
+  0x42, 0x8d, 0x06, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0x65, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x80, 0x41, 0x81, 0x04, 0x00, 0x00, 0x40,
+  0x40, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x73, 0x43, 0x8c, 0x05, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0xea, 0x42, 0x84, 0x03, 0x00, 0x00, 0x18,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x0a,
+  0x43, 0x8c, 0x05, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00,
+  0x00, 0x28, 0x42, 0x83, 0x04, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x32,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x8b, 0x05, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xac, 0x42, 0x84, 0x04, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0xc0,
+  0x40, 0x8a, 0x06, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x65, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00,
+  0x00, 0x84, 0x42, 0x00, 0x00, 0xc8, 0x41, 0x83, 0x04, 0x00, 0x00, 0xc0,
+  0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x00, 0x00, 0x10, 0x41, 0x8a, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00,
+  0x00, 0x5b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x85, 0x03, 0x00, 0x00, 0x5d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x9e,
+  0x42, 0x8a, 0x05, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x40, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00,
+  0x00, 0x28, 0x42, 0x84, 0x04, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa8,
+  0x42, 0x8b, 0x04, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x28, 0x42, 0x83,
+  0x05, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x65,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa8,
+  0x42, 0x8b, 0x04, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0x65, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x58, 0x42, 0x84,
+  0x04, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x03, 0x43, 0x8c, 0x04, 0x00,
+  0x00, 0xee, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x07, 0x43, 0x00, 0x00, 0x80, 0x40, 0x82, 0x05, 0x00, 0x00, 0x9a,
+  0x42, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xee, 0x42, 0x8d, 0x03, 0x00,
+  0x00, 0x0b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00,
+  0x00, 0x80, 0x40, 0x81, 0x07, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x13,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0x80,
+  0x40, 0x8d, 0x0b, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x04, 0x43, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x9a, 0x42, 0x00,
+  0x00, 0x0b, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0xea, 0x42, 0x00,
+  0x00, 0x28, 0x42, 0x8f, 0x09, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x48, 0x42, 0x91, 0x08, 0x00,
+  0x00, 0x40, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00,
+  0x00, 0x23, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x50, 0x41, 0x92,
+  0x05, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x28,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xb8, 0x41, 0x00,
+  0x00, 0xb8, 0x41, 0x00, 0x00, 0x00, 0x40, 0xe5, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x9d, 0x05, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0xa0, 0x42, 0x00,
+  0x00, 0xd0, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00,
+  0x00, 0x44, 0x42, 0x95, 0x05, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x1c, 0x43, 0x94, 0x06, 0x00, 0x00, 0x14, 0x42, 0x00,
+  0x00, 0x5f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xee, 0x42, 0x93,
+  0x06, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x09, 0x43, 0x93, 0x07, 0x00, 0x00, 0xf0, 0x41, 0x00,
+  0x00, 0x60, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0x48, 0x42, 0x92, 0x07, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x50,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x90,
+  0x42, 0x92, 0x07, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xd4, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x94, 0x42, 0x92,
+  0x07, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x92, 0x07, 0x00,
+  0x00, 0x80, 0x3f, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x78, 0x43, 0x00, 0x00, 0x90, 0x42, 0x93, 0x06, 0x00, 0x00, 0xb0,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x88,
+  0x42, 0x93, 0x06, 0x00, 0x00, 0xa4, 0x42, 0x00, 0x00, 0x6b, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x36, 0x43, 0x93, 0x07, 0x00, 0x00, 0x50,
+  0x41, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x86,
+  0x42, 0x00, 0x00, 0xc0, 0x40, 0x92, 0x06, 0x00, 0x00, 0xa8, 0x42, 0x00,
+  0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x88, 0x42, 0x94,
+  0x05, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4f,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00,
+  0x00, 0x04, 0x42, 0x94, 0x05, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0xc8, 0x41, 0x95, 0x04, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x45, 0x43, 0x00,
+  0x00, 0xfa, 0x42, 0x94, 0x05, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0xf4, 0x42, 0x95, 0x04, 0x00, 0x00, 0xa0, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x0e, 0x43, 0x96, 0x04, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x3b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x08,
+  0x42, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x98, 0x08, 0x00,
+  0x00, 0x54, 0x42, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00,
+  0x00, 0xca, 0x42, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0xc4, 0x42, 0x8e,
+  0x0d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0xc6,
+  0x42, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0xe8, 0x42, 0x8d, 0x0d, 0x00,
+  0x00, 0x1c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43, 0x8c, 0x0e, 0x00, 0x00, 0x13,
+  0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43, 0x8c, 0x0e, 0x00,
+  0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0x56, 0x43, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x74, 0x42, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x8c,
+  0x05, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0xe6, 0x42, 0x00, 0x00, 0x60,
+  0x42, 0x81, 0x05, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5b, 0x43, 0x00,
+  0x00, 0x28, 0x42, 0x8d, 0x03, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x60,
+  0x41, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x20, 0x41, 0x82, 0x05, 0x00,
+  0x00, 0x70, 0x42, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0b, 0x43, 0x93,
+  0x07, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0x9e, 0x42, 0x00, 0x00, 0x69,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x20, 0x41, 0x93, 0x05, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0xe6, 0x42, 0x93,
+  0x06, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x57,
+  0x43, 0x00, 0x00, 0x08, 0x42, 0x94, 0x05, 0x00, 0x00, 0xc8, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x5f, 0x43, 0x00, 0x00, 0x1c, 0x42, 0x94, 0x05, 0x00, 0x00, 0x88,
+  0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x1c, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0x9a, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x08, 0x42, 0x84,
+  0x04, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x07,
+  0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x8a, 0x05, 0x00,
+  0x00, 0x25, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x24, 0x42, 0x82,
+  0x07, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0xae,
+  0x42, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xba, 0x42, 0x89, 0x10, 0x00,
+  0x00, 0x88, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x14, 0x42, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0xe8, 0x42, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x4b, 0x43, 0x00, 0x00, 0xda, 0x42, 0x89, 0x10, 0x00, 0x00, 0x9c,
+  0x42, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0xa2,
+  0x42, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0xba,
+  0x42, 0x00, 0x00, 0xb0, 0x41, 0x89, 0x0f, 0x00, 0x00, 0x80, 0x40, 0x00,
+  0x00, 0x4a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00,
+  0x00, 0x0e, 0x43, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x60, 0x41, 0x8b,
+  0x0b, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x96,
+  0x42, 0x8f, 0x0a, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00,
+  0x00, 0xf0, 0x42, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x60, 0x41, 0x90,
+  0x06, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0xc6,
+  0x42, 0x00, 0x00, 0x84, 0x42, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x9b, 0x07, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0x01, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x8d,
+  0x0d, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x92,
+  0x42, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x89, 0x11, 0x00,
+  0x00, 0xd8, 0x41, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x35, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x14, 0x43, 0x88,
+  0x12, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xd8, 0x42, 0x88, 0x08, 0x00, 0x00, 0x28, 0x42, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0xce, 0x42, 0x82, 0x05, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0xf6, 0x42, 0x8a, 0x05, 0x00,
+  0x00, 0x01, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x70, 0x41, 0x83,
+  0x05, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x93, 0x06, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0x24, 0x42, 0x93, 0x05, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x93, 0x06, 0x00,
+  0x00, 0x7c, 0x42, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00,
+  0x00, 0xa0, 0x41, 0x92, 0x07, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0xbc,
+  0x42, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0xa0,
+  0x41, 0x92, 0x08, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0xa8, 0x41, 0x92, 0x09, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x68,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0xd0, 0x42, 0x92, 0x09, 0x00,
+  0x00, 0x1c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x90, 0x42, 0x91, 0x09, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x0c,
+  0x42, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x0c,
+  0x42, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x43, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x14, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x57, 0x43, 0x95, 0x05, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x57, 0x43, 0x8e, 0x0c, 0x00,
+  0x00, 0x9e, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0xda, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x90, 0x42, 0x8c, 0x0e, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x5c,
+  0x42, 0x00, 0x00, 0x20, 0x41, 0x8c, 0x0c, 0x00, 0x00, 0x05, 0x43, 0x00,
+  0x00, 0x62, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00,
+  0x00, 0xe0, 0x42, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x24, 0x42, 0x8f,
+  0x05, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0xd8,
+  0x42, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0xb8,
+  0x42, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a, 0x02, 0x00,
+  0x00, 0x04, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x18, 0x43, 0x85,
+  0x01, 0x00, 0x00, 0x94, 0x42, 0x00, 0x00, 0x58, 0x42, 0x8f, 0x03, 0x00,
+  0x00, 0x0c, 0x42, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x2d, 0x43, 0x83, 0x03, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xee,
+  0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0xe8, 0x42, 0x8f, 0x03, 0x00,
+  0x00, 0x4d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xb2, 0x42, 0x82, 0x04, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x42,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe8,
+  0x42, 0x8d, 0x05, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x3d, 0x43, 0x00,
+  0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x00,
+  0x00, 0xb0, 0x41, 0x81, 0x05, 0x00, 0x00, 0x9e, 0x42, 0x00, 0x00, 0x75,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x3b,
+  0x43, 0x00, 0x00, 0xe0, 0x41, 0x8c, 0x0c, 0x00, 0x00, 0xe8, 0x41, 0x00,
+  0x00, 0x56, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x3f, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x46, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x41, 0x43, 0x8d,
+  0x05, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x98,
+  0x41, 0x81, 0x05, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00,
+  0x00, 0xf0, 0x41, 0x8c, 0x05, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x56,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x00, 0x00, 0x50, 0x41, 0x81, 0x05, 0x00, 0x00, 0x70, 0x41, 0x00,
+  0x00, 0x48, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x52, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x8c, 0x05, 0x00, 0x00, 0x04,
+  0x42, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x82, 0x04, 0x00,
+  0x00, 0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x50, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x8c, 0x05, 0x00, 0x00, 0x0c,
+  0x42, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x50, 0x41, 0x82, 0x04, 0x00,
+  0x00, 0xb8, 0x42, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xcc, 0x42, 0x8d, 0x04, 0x00, 0x00, 0x05,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3c,
+  0x43, 0x00, 0x00, 0x98, 0x41, 0x82, 0x05, 0x00, 0x00, 0x64, 0x42, 0x00,
+  0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00,
+  0x00, 0x3c, 0x42, 0x00, 0x00, 0x40, 0x40, 0x8c, 0x04, 0x00, 0x00, 0xe2,
+  0x42, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a,
+  0x43, 0x00, 0x00, 0xb0, 0x41, 0x82, 0x08, 0x00, 0x00, 0x90, 0x41, 0x00,
+  0x00, 0x32, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x78, 0x43, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0xd2, 0x42, 0x00,
+  0x00, 0x2a, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x8a, 0x0f, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74,
+  0x42, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0xe0,
+  0x41, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x9c,
+  0x42, 0x8b, 0x0e, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x1f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0xc0, 0x40, 0x8c, 0x0b, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x66,
+  0x43, 0x00, 0x00, 0x38, 0x42, 0x8f, 0x0a, 0x00, 0x00, 0x9a, 0x42, 0x00,
+  0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00,
+  0x00, 0x3c, 0x42, 0x91, 0x08, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x08,
+  0x42, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x38,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x82, 0x42, 0x96, 0x04, 0x00, 0x00, 0x40, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x15, 0x43, 0x00,
+  0x00, 0x20, 0x41, 0x96, 0x03, 0x00, 0x00, 0x17, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x97, 0x03, 0x00,
+  0x00, 0x17, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xd8, 0x41, 0x97, 0x03, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xd8, 0x41, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x96, 0x09, 0x00, 0x00, 0xe6, 0x42, 0x00,
+  0x00, 0x70, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00,
+  0x00, 0x24, 0x42, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0xec, 0x42, 0x00,
+  0x00, 0xec, 0x42, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0xc8, 0x41, 0x8f,
+  0x0c, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4c,
+  0x43, 0x00, 0x00, 0xe8, 0x41, 0x8e, 0x0c, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0x58, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x96, 0x42, 0x8f,
+  0x0b, 0x00, 0x00, 0xce, 0x42, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x46,
+  0x43, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x76,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x96,
+  0x42, 0x91, 0x01, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x70, 0x42, 0x81,
+  0x05, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0xc0,
+  0x41, 0x94, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x58, 0x42, 0x95, 0x05, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x52,
+  0x43, 0x00, 0x00, 0xd8, 0x41, 0x94, 0x05, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0x4b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x18, 0x43, 0x00, 0x00, 0x80, 0x40, 0x94, 0x05, 0x00, 0x00, 0xc8,
+  0x41, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0xb8, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0xd6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x78, 0x43, 0x00, 0x00, 0xc0, 0x41, 0x95, 0x04, 0x00, 0x00, 0x30,
+  0x42, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0xfa, 0x42, 0x90, 0x11, 0x00, 0x00, 0x10, 0x41, 0x00,
+  0x00, 0xe0, 0x41, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0xe0, 0x41, 0x00,
+  0x00, 0xe0, 0x41, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x25, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00,
+  0x00, 0x25, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00,
+  0x00, 0x25, 0x43, 0x00, 0x00, 0x98, 0x42, 0x88, 0x12, 0x00, 0x00, 0x6c,
+  0x42, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0xe2,
+  0x42, 0x87, 0x10, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0xc4, 0x42, 0x8a,
+  0x0f, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50,
+  0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50,
+  0x41, 0x00, 0x00, 0x00, 0x40, 0x8b, 0x08, 0x00, 0x00, 0x52, 0x43, 0x00,
+  0x00, 0x5e, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x86, 0x42, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x34, 0x42, 0x92, 0x08, 0x00, 0x00, 0xc8,
+  0x41, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0x41, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5d,
+  0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x95, 0x03, 0x00,
+  0x00, 0x9c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xf6, 0x42, 0x97, 0x03, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00, 0x3c, 0x42, 0x97, 0x01, 0x00,
+  0x00, 0x40, 0x43, 0x00, 0x00, 0x5b, 0x43, 0xe6, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x98, 0x0a, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0xd2, 0x42, 0x00,
+  0x00, 0xd4, 0x42, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x49, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0xac, 0x42, 0x8d,
+  0x0e, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x48,
+  0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0xac,
+  0x42, 0x89, 0x11, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x70, 0x41, 0x00,
+  0x00, 0x13, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0x6d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xce, 0x42, 0x89, 0x09, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0xcc, 0x42, 0x82, 0x04, 0x00,
+  0x00, 0xf0, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xce, 0x42, 0x89, 0x07, 0x00, 0x00, 0x24,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0xe8,
+  0x41, 0x00, 0x00, 0xe8, 0x41, 0x83, 0x05, 0x00, 0x00, 0xb8, 0x41, 0x00,
+  0x00, 0x37, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x92, 0x42, 0x89, 0x04, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x94,
+  0x42, 0x00, 0x00, 0x0c, 0x42, 0x85, 0x05, 0x00, 0x00, 0x70, 0x41, 0x00,
+  0x00, 0x37, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x71, 0x43, 0x00, 0x00, 0xbe, 0x42, 0x94, 0x05, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x93, 0x07, 0x00,
+  0x00, 0x18, 0x42, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0x6f, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00,
+  0x00, 0xa8, 0x42, 0x00, 0x00, 0x80, 0x3f, 0x93, 0x05, 0x00, 0x00, 0x5b,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0xbe, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0xb2, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x40, 0x41, 0x93,
+  0x05, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x54,
+  0x42, 0x93, 0x06, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x50, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0x08, 0x42, 0x92, 0x06, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0xb0,
+  0x42, 0x93, 0x06, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x36, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x51, 0x43, 0x00, 0x00, 0xdc, 0x42, 0x93, 0x06, 0x00, 0x00, 0x90,
+  0x41, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0xd8,
+  0x41, 0x82, 0x04, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0xa8, 0x42, 0x00,
+  0x00, 0x5f, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x45, 0x43, 0x8b,
+  0x0f, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0xd8, 0x42, 0x8b, 0x0e, 0x00, 0x00, 0x37, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x44, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0xec, 0x42, 0x00, 0x00, 0xa6, 0x42, 0x8c, 0x0c, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x82,
+  0x42, 0x8e, 0x0b, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00,
+  0x00, 0x4f, 0x43, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00,
+  0x00, 0x20, 0x41, 0x8f, 0x07, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x62,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0xce, 0x42, 0x00, 0x00, 0xc0,
+  0x40, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb8, 0x04, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x80, 0x42, 0x90, 0x0b, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8d, 0x0d, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x8d, 0x05, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x81, 0x05, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8d,
+  0x01, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x80, 0x42, 0x85, 0x03, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x95, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x93, 0x05, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x94, 0x04, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x94, 0x06, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x93, 0x0a, 0x00, 0x00, 0x80,
+  0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x80, 0x42, 0x82, 0x00, 0x00, 0x00, 0x80, 0x42, 0x8c,
+  0x0b, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x93, 0x07, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x97,
+  0x03, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x96, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x8a, 0x01, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x3f,
+  0x43, 0x86, 0x07, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8a,
+  0x0e, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x8c, 0x0c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x80, 0x42, 0x90, 0x03, 0x00, 0x00, 0x80,
+  0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xda, 0x02, 0x00,
+  0x00, 0x60, 0x41, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x0b, 0x43, 0x8d,
+  0x01, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0xe0, 0x40, 0x87, 0x03, 0x00,
+  0x00, 0x20, 0x42, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x4c, 0x42, 0x8c, 0x03, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x6f,
+  0x43, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0xc0, 0x40, 0x84, 0x05, 0x00,
+  0x00, 0xe8, 0x41, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x80, 0x40, 0x8b,
+  0x04, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0xc0, 0x40, 0x83, 0x05, 0x00,
+  0x00, 0x90, 0x42, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0x08, 0x42, 0x8b,
+  0x04, 0x00, 0x00, 0xa0, 0x42, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x64,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x82, 0x06, 0x00,
+  0x00, 0x10, 0x41, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0xe0, 0x40, 0x8a, 0x04, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x98,
+  0x42, 0x83, 0x06, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x5c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0xe0, 0x40, 0x8b, 0x04, 0x00, 0x00, 0x06,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x0b,
+  0x43, 0x00, 0x00, 0xc0, 0x40, 0x83, 0x04, 0x00, 0x00, 0x72, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x50, 0x42, 0x8c, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0x10,
+  0x41, 0x82, 0x06, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00,
+  0x00, 0xd6, 0x42, 0x00, 0x00, 0x68, 0x42, 0x8c, 0x0c, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x50,
+  0x42, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50,
+  0x41, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4f,
+  0x43, 0x8e, 0x0b, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00,
+  0x00, 0xc4, 0x42, 0x8f, 0x09, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0xe2, 0x42, 0x91, 0x08, 0x00,
+  0x00, 0x80, 0x40, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0xa8, 0x42, 0x00,
+  0x00, 0xa8, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x98, 0x41, 0x95,
+  0x04, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x74, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0xd0, 0x41, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x08, 0x42, 0x97, 0x03, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0x5a,
+  0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0xb8, 0x41, 0x97, 0x02, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0xc8, 0x41, 0xff,
+  0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xa3, 0x0e,
+  0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0xf2, 0x42,
+  0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x1c, 0x43,
+  0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x2f, 0x43,
+  0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x2f, 0x43,
+  0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x08, 0x43,
+  0x8a, 0x10, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00,
+  0x60, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x77, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00,
+  0x60, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00,
+  0x60, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x8a, 0x08,
+  0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3d, 0x43,
+  0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x54, 0x42,
+  0x90, 0x07, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x23, 0x43, 0x00, 0x00,
+  0x28, 0x42, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x80, 0x40, 0x93, 0x03,
+  0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6f, 0x43,
+  0x00, 0x00, 0x28, 0x42, 0x96, 0x04, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00,
+  0x75, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00,
+  0x80, 0x41, 0x97, 0x05, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0xbc, 0x42,
+  0x00, 0x00, 0x80, 0x40, 0x96, 0x05, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00,
+  0x5f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x5f, 0x43, 0x00, 0x00, 0x04, 0x42, 0x96, 0x04, 0x00, 0x00, 0xd8, 0x41,
+  0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0xf2, 0x42, 0x95, 0x05, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00,
+  0x9e, 0x42, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x93, 0x07, 0x00, 0x00, 0x3b, 0x43,
+  0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x65, 0x43,
+  0x00, 0x00, 0x80, 0x42, 0x93, 0x05, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00,
+  0x1d, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00,
+  0x11, 0x43, 0x00, 0x00, 0x84, 0x42, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x81, 0x04, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x19, 0x43, 0x00,
+  0x00, 0x6b, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0xf4, 0x42, 0x94,
+  0x06, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x21,
+  0x43, 0x00, 0x00, 0x08, 0x42, 0x93, 0x06, 0x00, 0x00, 0xe2, 0x42, 0x00,
+  0x00, 0x48, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x2f, 0x43, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x50, 0x41, 0x93,
+  0x05, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0xa4, 0x42, 0x00, 0x00, 0x44,
+  0x42, 0x92, 0x06, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x96, 0x42, 0x00,
+  0x00, 0x18, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x62, 0x43, 0x00, 0x00, 0x34, 0x42, 0x93, 0x05, 0x00, 0x00, 0x9e,
+  0x42, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0x98, 0x42, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0xd2, 0x42, 0x94,
+  0x05, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0xba,
+  0x42, 0x81, 0x06, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0xb6, 0x42, 0x00,
+  0x00, 0xb6, 0x42, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0xb6, 0x42, 0x00,
+  0x00, 0xf8, 0x42, 0x00, 0x00, 0xea, 0x42, 0x8b, 0x11, 0x00, 0x00, 0xa8,
+  0x41, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x7c,
+  0x42, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x00, 0x42, 0x89, 0x11, 0x00,
+  0x00, 0xce, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3c, 0x43, 0x00,
+  0x00, 0x77, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x88,
+  0x12, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x14,
+  0x43, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x0e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x88, 0x09, 0x00, 0x00, 0xca, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00,
+  0x00, 0x78, 0x43, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x83,
+  0x04, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3c, 0x43, 0x88, 0x06, 0x00,
+  0x00, 0x6b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x02, 0x43, 0x00,
+  0x00, 0x40, 0x40, 0x85, 0x04, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6a,
+  0x43, 0x88, 0x05, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00,
+  0x00, 0x40, 0x41, 0x84, 0x07, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xd8,
+  0x42, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x88, 0x11, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x00,
+  0x00, 0xa8, 0x42, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0xa8, 0x42, 0x00,
+  0x00, 0xa8, 0x42, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x5d, 0x43, 0x00,
+  0x00, 0x61, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x00,
+  0x00, 0xe0, 0x41, 0x89, 0x0f, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x58,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x60,
+  0x43, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x00, 0x41, 0x8c, 0x0c, 0x00,
+  0x00, 0xa4, 0x42, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x77, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00,
+  0x00, 0x1c, 0x42, 0x90, 0x07, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0xc0,
+  0x42, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0xc0,
+  0x42, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0x9c,
+  0x42, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb7, 0x03, 0x00,
+  0x00, 0x80, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x40, 0x40, 0x8f, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x98,
+  0x41, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x78,
+  0x42, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x0f,
+  0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x40, 0x40, 0x8e, 0x0c, 0x00,
+  0x00, 0xba, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x14, 0x42, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x5f,
+  0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x14, 0x42, 0x8e, 0x0c, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0xba, 0x42, 0x00,
+  0x00, 0xba, 0x42, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x96, 0x42, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x1d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x34, 0x43, 0x00,
+  0x00, 0x60, 0x41, 0x95, 0x04, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x70,
+  0x41, 0x95, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x95, 0x04, 0x00,
+  0x00, 0x30, 0x41, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x96, 0x04, 0x00, 0x00, 0x9c,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x4f,
+  0x43, 0x00, 0x00, 0x70, 0x41, 0x82, 0x05, 0x00, 0x00, 0xd0, 0x41, 0x00,
+  0x00, 0x28, 0x42, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x00,
+  0x00, 0x8a, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x88, 0x12, 0x00, 0x00, 0x80,
+  0x40, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x96,
+  0x42, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x47,
+  0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x79,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5a,
+  0x43, 0x87, 0x13, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x50, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x61, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00,
+  0x00, 0x2d, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0xc8, 0x41, 0x87,
+  0x0e, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x40,
+  0x43, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x27,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0xd8,
+  0x41, 0x8c, 0x08, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x4c, 0x43, 0x00,
+  0x00, 0x18, 0x43, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x98, 0x42, 0x00,
+  0x00, 0x30, 0x41, 0x92, 0x06, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x60,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x53, 0x43, 0x97, 0x03, 0x00,
+  0x00, 0x70, 0x41, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x53, 0x43, 0x98, 0x02, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x56,
+  0x43, 0x00, 0x00, 0x53, 0x43, 0x99, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00,
+  0x00, 0x20, 0x41, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd6, 0x05, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x4f, 0x43, 0x00,
+  0x00, 0x4f, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x10, 0x41, 0x91,
+  0x09, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x47,
+  0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0x98, 0x41, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00,
+  0x00, 0xe8, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x19, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x8d, 0x07, 0x00, 0x00, 0x10,
+  0x41, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3b,
+  0x43, 0x00, 0x00, 0x88, 0x41, 0x82, 0x02, 0x00, 0x00, 0x8c, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x8c, 0x07, 0x00, 0x00, 0x18,
+  0x42, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0xdc,
+  0x42, 0x00, 0x00, 0x98, 0x41, 0x83, 0x02, 0x00, 0x00, 0x19, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x28, 0x43, 0x8b, 0x06, 0x00, 0x00, 0x2c,
+  0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0xbc,
+  0x42, 0x84, 0x03, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x8a, 0x06, 0x00, 0x00, 0x2c,
+  0x42, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0xb0,
+  0x41, 0x84, 0x04, 0x00, 0x00, 0xfe, 0x42, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x00, 0x40, 0x89,
+  0x06, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x47,
+  0x43, 0x00, 0x00, 0x28, 0x42, 0x83, 0x04, 0x00, 0x00, 0x4c, 0x42, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00,
+  0x00, 0xe6, 0x42, 0x8a, 0x04, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0x1b,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x28,
+  0x42, 0x84, 0x05, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x02, 0x43, 0x00,
+  0x00, 0x42, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00,
+  0x00, 0xea, 0x42, 0x8a, 0x04, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x3a,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x58,
+  0x42, 0x83, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x04, 0x43, 0x00,
+  0x00, 0x45, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x8b, 0x04, 0x00, 0x00, 0x84,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x30,
+  0x43, 0x00, 0x00, 0x80, 0x40, 0x81, 0x07, 0x00, 0x00, 0x88, 0x42, 0x00,
+  0x00, 0x06, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00,
+  0x00, 0xc8, 0x41, 0x8c, 0x0d, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0xe8,
+  0x42, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x76,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x80,
+  0x40, 0x8d, 0x09, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6a, 0x43, 0x00, 0x00, 0xfc, 0x42, 0x91, 0x08, 0x00, 0x00, 0x48,
+  0x42, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x4e,
+  0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x04,
+  0x43, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x88, 0x41, 0xff, 0xd1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0x04, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0x31, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0xf8, 0x42, 0x96, 0x04, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14,
+  0x43, 0x94, 0x06, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x5a, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6d, 0x43, 0x00, 0x00, 0x74, 0x42, 0x93, 0x06, 0x00, 0x00, 0x80,
+  0x41, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0xa4,
+  0x42, 0x94, 0x05, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xac, 0x42, 0x93, 0x06, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x31,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x36, 0x43, 0x93,
+  0x07, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0xc8, 0x41, 0x92, 0x06, 0x00,
+  0x00, 0x80, 0x41, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0xa4, 0x42, 0x94, 0x05, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x14,
+  0x43, 0x00, 0x00, 0x74, 0x42, 0x93, 0x06, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0x31, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x94,
+  0x05, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x9c,
+  0x42, 0x92, 0x07, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x14, 0x42, 0x00,
+  0x00, 0x27, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x74, 0x42, 0x93,
+  0x06, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1e,
+  0x43, 0x00, 0x00, 0xa4, 0x42, 0x94, 0x05, 0x00, 0x00, 0x27, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x14, 0x43, 0x00, 0x00, 0x20, 0x41, 0x93, 0x05, 0x00, 0x00, 0xa8,
+  0x41, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x03, 0x43, 0x95, 0x04, 0x00,
+  0x00, 0x92, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x96, 0x04, 0x00, 0x00, 0x66,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x0a,
+  0x43, 0x00, 0x00, 0x20, 0x41, 0x96, 0x02, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x58, 0x43, 0x98, 0x02, 0x00, 0x00, 0x90,
+  0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x74, 0x42, 0xe7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb3, 0x07, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0x14, 0x42, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x68, 0x42, 0x00,
+  0x00, 0x35, 0x43, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x90, 0x42, 0x8f, 0x0c, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x7c,
+  0x42, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x4e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x78, 0x42, 0x8d, 0x0d, 0x00,
+  0x00, 0x80, 0x41, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x8d, 0x0d, 0x00, 0x00, 0x14,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x34,
+  0x43, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x0c,
+  0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x8d, 0x05, 0x00, 0x00, 0x30, 0x41, 0x00,
+  0x00, 0x1a, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00,
+  0x00, 0x8e, 0x42, 0x00, 0x00, 0xf8, 0x41, 0x83, 0x03, 0x00, 0x00, 0x01,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x14,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x38, 0x42, 0x94,
+  0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x90,
+  0x42, 0x94, 0x06, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x20, 0x41, 0x91, 0x07, 0x00, 0x00, 0x30,
+  0x41, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x57,
+  0x43, 0x00, 0x00, 0x24, 0x42, 0x93, 0x05, 0x00, 0x00, 0x1b, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x93, 0x06, 0x00, 0x00, 0x7c,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0xa0,
+  0x41, 0x81, 0x07, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0xda, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x53, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x88,
+  0x12, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x69,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x48,
+  0x43, 0x00, 0x00, 0xc2, 0x42, 0x87, 0x12, 0x00, 0x00, 0xc6, 0x42, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00,
+  0x00, 0x59, 0x43, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0xa0, 0x41, 0x88,
+  0x0e, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0xd8,
+  0x42, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0xf8,
+  0x41, 0x8c, 0x07, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x5e, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x10, 0x43, 0x93,
+  0x05, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x0c,
+  0x42, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0xc8,
+  0x41, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0x01, 0x00,
+  0x00, 0xb8, 0x41, 0x00, 0x00, 0x08, 0x42, 0x82, 0x06, 0x00, 0x00, 0x4c,
+  0x42, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x15,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0xb4,
+  0x42, 0x8d, 0x0e, 0x00, 0x00, 0xa0, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x68, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x00,
+  0x00, 0x62, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00,
+  0x00, 0xa6, 0x42, 0x8b, 0x0f, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0x61,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x2c,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x8b, 0x0e, 0x00,
+  0x00, 0xa0, 0x41, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00,
+  0x00, 0x39, 0x43, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0xe0, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x19, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x30, 0x43, 0x8d,
+  0x04, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x84,
+  0x42, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x83, 0x04, 0x00,
+  0x00, 0xf4, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x54, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x94, 0x05, 0x00, 0x00, 0xa0,
+  0x41, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x95, 0x04, 0x00,
+  0x00, 0x06, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x54, 0x42, 0x94, 0x06, 0x00, 0x00, 0x80,
+  0x3f, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0xfc, 0x42, 0x00, 0x00, 0xb0,
+  0x41, 0x94, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x95,
+  0x05, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x60,
+  0x41, 0x84, 0x01, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x64, 0x42, 0x89,
+  0x11, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x54,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x71,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x75,
+  0x43, 0x88, 0x12, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x40, 0x43, 0x00,
+  0x00, 0x1e, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x87, 0x11, 0x00, 0x00, 0xcc,
+  0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x51,
+  0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x1c,
+  0x42, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x1c,
+  0x42, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x70, 0x41, 0x89, 0x09, 0x00,
+  0x00, 0x1b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00,
+  0x00, 0x92, 0x42, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x59, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x00,
+  0x00, 0xc8, 0x41, 0x91, 0x07, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x08,
+  0x43, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xf2,
+  0x42, 0x97, 0x03, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x05, 0x43, 0x97, 0x03, 0x00, 0x00, 0x17,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x08,
+  0x42, 0x97, 0x02, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x11, 0x43, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a, 0x09, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xd6, 0x42, 0x00,
+  0x00, 0x2d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x4b, 0x43, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0xe0, 0x40, 0x00,
+  0x00, 0x80, 0x3f, 0x90, 0x0a, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x28,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x40,
+  0x40, 0x8e, 0x0c, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x60, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x23, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x40, 0x40, 0x8d, 0x0c, 0x00, 0x00, 0xc6,
+  0x42, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0xa0,
+  0x41, 0x00, 0x00, 0x50, 0x42, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x78,
+  0x42, 0x8c, 0x0d, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0xde, 0x42, 0x00,
+  0x00, 0x5c, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0x8e, 0x42, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8c,
+  0x04, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x81, 0x06, 0x00,
+  0x00, 0x30, 0x41, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2c, 0x43, 0x00,
+  0x00, 0x10, 0x41, 0x8d, 0x04, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0xd8,
+  0x41, 0x81, 0x05, 0x00, 0x00, 0xb4, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0xd0, 0x42, 0x00,
+  0x00, 0x30, 0x41, 0x8d, 0x0b, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x48,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x9a,
+  0x42, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2d,
+  0x43, 0x00, 0x00, 0x54, 0x42, 0x8f, 0x0a, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0x48, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x34, 0x43, 0x00,
+  0x00, 0x6a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00,
+  0x00, 0x70, 0x41, 0x91, 0x08, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x17,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c,
+  0x43, 0x00, 0x00, 0x96, 0x42, 0x93, 0x07, 0x00, 0x00, 0x00, 0x41, 0x00,
+  0x00, 0x74, 0x42, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0x28, 0x42, 0x8f, 0x02, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x47,
+  0x43, 0x00, 0x00, 0x13, 0x43, 0x81, 0x07, 0x00, 0x00, 0xf0, 0x41, 0x00,
+  0x00, 0x6b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00,
+  0x00, 0x70, 0x41, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x44,
+  0x42, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x41, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x65,
+  0x43, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x92, 0x08, 0x00,
+  0x00, 0x01, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xda, 0x42, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x24, 0x42, 0x00,
+  0x00, 0x68, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x90,
+  0x0a, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x6f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x40,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x75,
+  0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x44, 0x42, 0x90, 0x09, 0x00,
+  0x00, 0x98, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x5c, 0x43, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb0, 0x41, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x33, 0x43, 0x91, 0x09, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x30, 0x42, 0x90, 0x09, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x21, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x43, 0x00,
+  0x00, 0x6f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x8c, 0x42, 0x91, 0x09, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x0b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x40, 0x40, 0x92, 0x07, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x40, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0xad, 0x02, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00,
+  0x1e, 0x43, 0x96, 0x04, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xde, 0x42,
+  0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x14, 0x42,
+  0x95, 0x05, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00,
+  0x80, 0x41, 0x94, 0x04, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x0e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x21, 0x43,
+  0x94, 0x06, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00,
+  0x62, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x04, 0x43, 0x00, 0x00, 0x98, 0x41, 0x94, 0x05, 0x00, 0x00, 0x7c, 0x42,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x75, 0x43,
+  0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0xa0, 0x41, 0x94, 0x04, 0x00, 0x00,
+  0x3c, 0x42, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x75, 0x43, 0x00, 0x00, 0xc6, 0x42, 0x95, 0x04, 0x00, 0x00, 0xe0, 0x40,
+  0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0xe2, 0x42, 0x95, 0x05, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+  0x0d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x3f, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x95, 0x04, 0x00, 0x00, 0x60, 0x42,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5e, 0x43,
+  0x00, 0x00, 0xb0, 0x41, 0x95, 0x04, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00,
+  0x65, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00,
+  0xbc, 0x42, 0x95, 0x04, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x30, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xf0, 0x42,
+  0x96, 0x04, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x90, 0x41, 0x85, 0x06,
+  0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0xa4, 0x42, 0x00, 0x00, 0x3c, 0x43,
+  0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0xb4, 0x42,
+  0x00, 0x00, 0x30, 0x42, 0x88, 0x04, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+  0x31, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00,
+  0x88, 0x41, 0x83, 0x09, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0xf4, 0x42,
+  0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x08, 0x43, 0x88, 0x03, 0x00, 0x00,
+  0xe0, 0x40, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x65, 0x43, 0x81, 0x0c, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0xbc, 0x42,
+  0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x08, 0x43, 0x88, 0x12, 0x00, 0x00,
+  0xe0, 0x40, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x65, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00,
+  0x3b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00,
+  0xa6, 0x42, 0x88, 0x11, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0xf4, 0x42,
+  0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x1e, 0x43,
+  0x00, 0x00, 0xb0, 0x41, 0x89, 0x10, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00,
+  0x4b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00,
+  0x00, 0x40, 0x8b, 0x0d, 0x00, 0x00, 0xa0, 0x42, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5c, 0x43,
+  0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x00, 0x40,
+  0x8d, 0x0a, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00,
+  0x0e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00,
+  0xc8, 0x42, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x40, 0xff, 0xcd,
+  0x00, 0x00, 0x00, 0x00, 0xfc, 0x0a, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00,
+  0xc0, 0x42, 0x00, 0x00, 0xb4, 0x42, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00,
+  0xfa, 0x42, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00,
+  0x74, 0x42, 0x8d, 0x0d, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x1e, 0x43,
+  0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a, 0x43,
+  0x8c, 0x0e, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00,
+  0x0e, 0x43, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x8c, 0x07, 0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x6e, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2c, 0x43,
+  0x00, 0x00, 0x50, 0x42, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0xc0, 0x40,
+  0x81, 0x04, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xa4, 0x42, 0x8d, 0x03,
+  0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xc8, 0x41,
+  0x00, 0x00, 0xc0, 0x40, 0x82, 0x05, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00,
+  0x64, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x3f, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x94, 0x05, 0x00, 0x00, 0xb0, 0x42,
+  0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x93, 0x06, 0x00, 0x00,
+  0xa0, 0x41, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00,
+  0x0c, 0x42, 0x93, 0x05, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x5b, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x34, 0x43,
+  0x00, 0x00, 0x1c, 0x42, 0x93, 0x06, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00,
+  0x30, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x53, 0x43, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x88, 0x41, 0x93, 0x05,
+  0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x38, 0x42,
+  0x93, 0x0b, 0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00,
+  0x74, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00,
+  0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00,
+  0x54, 0x42, 0x8e, 0x0d, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x76, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x28, 0x43,
+  0x8c, 0x0f, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x77, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x8b, 0x10, 0x00, 0x00, 0x14, 0x42,
+  0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x56, 0x43,
+  0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0xa8, 0x42,
+  0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0xa8, 0x42,
+  0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0xd4, 0x42,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43,
+  0x00, 0x00, 0x9c, 0x42, 0x94, 0x06, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+  0x04, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x28, 0x42, 0x91, 0x08,
+  0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x58, 0x42,
+  0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x14, 0x43,
+  0x89, 0x10, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00,
+  0xaa, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00,
+  0x20, 0x41, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00,
+  0x16, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x71, 0x43, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00, 0xc0, 0x42, 0x8a, 0x0e,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4d, 0x43,
+  0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x45, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x20, 0x42,
+  0x8c, 0x0c, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x77, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00,
+  0xea, 0x42, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00,
+  0xea, 0x42, 0x00, 0x00, 0x10, 0x42, 0x8e, 0x05, 0x00, 0x00, 0xf8, 0x42,
+  0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0xf6, 0x42,
+  0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0x80, 0x41, 0xff, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0x08, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x05, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x38, 0x42, 0x00, 0x00, 0x00, 0x40, 0x90, 0x0a, 0x00, 0x00, 0x96,
+  0x42, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x4f,
+  0x43, 0x00, 0x00, 0xc0, 0x41, 0x8e, 0x0c, 0x00, 0x00, 0x54, 0x42, 0x00,
+  0x00, 0x1d, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00,
+  0x00, 0x42, 0x43, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0x68, 0x42, 0x00,
+  0x00, 0x65, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xae, 0x42, 0x8d,
+  0x06, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f,
+  0x43, 0x00, 0x00, 0x98, 0x42, 0x82, 0x04, 0x00, 0x00, 0x44, 0x42, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x00,
+  0x00, 0xd0, 0x41, 0x8a, 0x07, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x13,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x0c,
+  0x42, 0x82, 0x05, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x2e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x21, 0x43, 0x89, 0x06, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x4d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0x08, 0x42, 0x81, 0x08, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x42, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x20, 0x43, 0x88,
+  0x12, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x40,
+  0x42, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x0f,
+  0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x08, 0x42, 0x87, 0x13, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x60, 0x43, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0x09, 0x43, 0x00,
+  0x00, 0x5a, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xcc, 0x42, 0x00,
+  0x00, 0x00, 0x40, 0x87, 0x12, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x45,
+  0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x3c,
+  0x42, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x60, 0x41, 0x88, 0x0a, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x55, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x00,
+  0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x40, 0x81, 0x04, 0x00, 0x00, 0x3c,
+  0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x55,
+  0x43, 0x00, 0x00, 0xc0, 0x41, 0x89, 0x04, 0x00, 0x00, 0x39, 0x43, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0xf4, 0x42, 0x00,
+  0x00, 0x0c, 0x42, 0x86, 0x04, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x38,
+  0x42, 0x95, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x27, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x58, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x95, 0x04, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x76, 0x43, 0x00, 0x00, 0x25, 0x43, 0x96, 0x03, 0x00, 0x00, 0xba,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x25,
+  0x43, 0x96, 0x03, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x75, 0x43, 0x00,
+  0x00, 0x7b, 0x43, 0x00, 0x00, 0x23, 0x43, 0x97, 0x03, 0x00, 0x00, 0x15,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x50,
+  0x42, 0x97, 0x02, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x15, 0x43, 0x98, 0x02, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x28, 0x43, 0x98, 0x02, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0xf4, 0x42, 0xa8, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x97, 0x0a, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xdc, 0x42, 0x00,
+  0x00, 0x02, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x40, 0x40, 0x8d,
+  0x0d, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x08,
+  0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x8c, 0x0e, 0x00,
+  0x00, 0xb0, 0x41, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00,
+  0x00, 0x6b, 0x43, 0x00, 0x00, 0xfc, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x8c,
+  0x07, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0xd2,
+  0x42, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0xa0, 0x41, 0x81, 0x04, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x2c, 0x43, 0x00, 0x00, 0x40, 0x40, 0x8c, 0x02, 0x00, 0x00, 0x70,
+  0x41, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x9e, 0x42, 0x86, 0x03, 0x00,
+  0x00, 0xe6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x40, 0x41, 0x96, 0x04, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0xa0,
+  0x40, 0x95, 0x04, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x64, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x96, 0x04, 0x00,
+  0x00, 0x29, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x4c, 0x43, 0x00, 0x00, 0x98, 0x41, 0x95, 0x04, 0x00, 0x00, 0x5c,
+  0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x66,
+  0x43, 0x00, 0x00, 0xb8, 0x41, 0x95, 0x08, 0x00, 0x00, 0x98, 0x41, 0x00,
+  0x00, 0x37, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xfe, 0x42, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x8a, 0x42, 0x00,
+  0x00, 0x8a, 0x42, 0x00, 0x00, 0x14, 0x42, 0x90, 0x0a, 0x00, 0x00, 0x88,
+  0x41, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e,
+  0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x1c, 0x42, 0x8c, 0x0e, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0xa2, 0x42, 0x00, 0x00, 0xce, 0x42, 0x00, 0x00, 0x4d, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x34, 0x43, 0x00,
+  0x00, 0x68, 0x42, 0x00, 0x00, 0x40, 0x40, 0x8a, 0x0e, 0x00, 0x00, 0x48,
+  0x42, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0xf2,
+  0x42, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x80, 0x40, 0x8a, 0x0c, 0x00,
+  0x00, 0x44, 0x42, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x00,
+  0x00, 0xe0, 0x40, 0x8e, 0x0a, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x71,
+  0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x37,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x50,
+  0x42, 0x90, 0x09, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x14, 0x43, 0x00,
+  0x00, 0x14, 0x43, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x97, 0x03, 0x00, 0x00, 0x27,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x18,
+  0x42, 0x97, 0x02, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x0b, 0x43, 0x98, 0x02, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x94, 0x42, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x9e, 0x03, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x1e, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x14, 0x43, 0x96, 0x04, 0x00, 0x00, 0x48,
+  0x42, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x05,
+  0x43, 0x00, 0x00, 0x8a, 0x42, 0x94, 0x05, 0x00, 0x00, 0xc0, 0x40, 0x00,
+  0x00, 0xea, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x40, 0x43, 0x00, 0x00, 0x60, 0x41, 0x95, 0x04, 0x00, 0x00, 0xa2,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4a,
+  0x43, 0x00, 0x00, 0x70, 0x41, 0x95, 0x04, 0x00, 0x00, 0x58, 0x42, 0x00,
+  0x00, 0x66, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00,
+  0x00, 0xac, 0x42, 0x96, 0x03, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xbc, 0x42, 0x95, 0x05, 0x00,
+  0x00, 0xf0, 0x41, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x88, 0x41, 0x93,
+  0x05, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x64,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x39,
+  0x43, 0x94, 0x06, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x2b, 0x43, 0x00,
+  0x00, 0x12, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x70, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x96, 0x03, 0x00, 0x00, 0x06,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xca,
+  0x42, 0x96, 0x04, 0x00, 0x00, 0x78, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x88, 0x41, 0x95,
+  0x04, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0x8e, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x24, 0x43, 0x96, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x54,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xac, 0x42, 0x97, 0x03, 0x00, 0x00, 0x15,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x30,
+  0x41, 0x97, 0x02, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x58, 0x43, 0x98, 0x02, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x58, 0x43, 0x98, 0x04, 0x00, 0x00, 0xb8, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00,
+  0x00, 0xbe, 0x42, 0x96, 0x04, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xa4,
+  0x42, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0f,
+  0x43, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb8, 0x05, 0x00,
+  0x00, 0xd0, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0xf4, 0x42, 0x93,
+  0x08, 0x00, 0x00, 0xe0, 0x42, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xec,
+  0x42, 0x90, 0x0a, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0xb0, 0x41, 0x00,
+  0x00, 0x14, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x8e,
+  0x0c, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x79,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x78, 0x42, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0xe0,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x4d,
+  0x43, 0x00, 0x00, 0x04, 0x43, 0x8c, 0x07, 0x00, 0x00, 0x10, 0x42, 0x00,
+  0x00, 0x51, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x00,
+  0x00, 0xa8, 0x41, 0x83, 0x02, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0xda,
+  0x42, 0x00, 0x00, 0x50, 0x41, 0x8b, 0x06, 0x00, 0x00, 0xac, 0x42, 0x00,
+  0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xa4, 0x42, 0x00, 0x00, 0xc8, 0x41, 0x83,
+  0x03, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0x33, 0x43, 0x8b, 0x06, 0x00, 0x00, 0xb2, 0x42, 0x00,
+  0x00, 0x66, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3a, 0x43, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x10, 0x41, 0x82,
+  0x05, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x6f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x07,
+  0x43, 0x8a, 0x05, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x98, 0x42, 0x00,
+  0x00, 0xf8, 0x41, 0x82, 0x07, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x29,
+  0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0xa8,
+  0x41, 0x89, 0x05, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x70, 0x42, 0x00,
+  0x00, 0x00, 0x41, 0x81, 0x08, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x29,
+  0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0xa0, 0x42, 0x89, 0x11, 0x00, 0x00, 0xc2, 0x42, 0x00,
+  0x00, 0x5e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00,
+  0x00, 0xf6, 0x42, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x84, 0x42, 0x00,
+  0x00, 0xd4, 0x42, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5b, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x09, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x89, 0x10, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0x22,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x26,
+  0x43, 0x00, 0x00, 0xd8, 0x41, 0x8a, 0x0f, 0x00, 0x00, 0x26, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x52, 0x43, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x00,
+  0x00, 0x90, 0x41, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8c,
+  0x06, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x4f,
+  0x43, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x9c,
+  0x42, 0x00, 0x00, 0x60, 0x41, 0x81, 0x04, 0x00, 0x00, 0x24, 0x42, 0x00,
+  0x00, 0x68, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0xa8, 0x42, 0x95, 0x05, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x3d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0xa8,
+  0x42, 0x00, 0x00, 0xf0, 0x41, 0x94, 0x04, 0x00, 0x00, 0x18, 0x42, 0x00,
+  0x00, 0x33, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xf8, 0x42, 0x96, 0x04, 0x00, 0x00, 0xfc, 0x42, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0xf0,
+  0x41, 0x95, 0x04, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x17, 0x43, 0x00, 0x00, 0xe8, 0x41, 0x96,
+  0x03, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x58,
+  0x43, 0x00, 0x00, 0xaa, 0x42, 0x97, 0x02, 0x00, 0x00, 0x11, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xf2, 0x42, 0x98, 0x02, 0x00, 0x00, 0x9e,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf2, 0x42, 0xc5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x97, 0x0a, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xd8, 0x42, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00,
+  0x00, 0xc0, 0x40, 0x8f, 0x0b, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x26,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x45, 0x43, 0x8e, 0x0c, 0x00, 0x00, 0xc8, 0x41, 0x00,
+  0x00, 0x59, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x8f,
+  0x04, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x81, 0x04, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x29, 0x43, 0x8f, 0x02, 0x00, 0x00, 0xb0,
+  0x41, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x92, 0x42, 0x82, 0x05, 0x00,
+  0x00, 0xd8, 0x41, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x93,
+  0x06, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x71,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x22,
+  0x43, 0x00, 0x00, 0xa0, 0x40, 0x92, 0x06, 0x00, 0x00, 0x08, 0x42, 0x00,
+  0x00, 0x0d, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x78, 0x42, 0x92,
+  0x07, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x6b,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x20, 0x41, 0x91, 0x07, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x45, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x1e, 0x43, 0x00, 0x00, 0x44, 0x42, 0x92, 0x06, 0x00, 0x00, 0xe0,
+  0x41, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xee,
+  0x42, 0x94, 0x08, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x19, 0x43, 0x00,
+  0x00, 0x40, 0x41, 0x92, 0x09, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x09,
+  0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x30, 0x41, 0x94, 0x06, 0x00,
+  0x00, 0x0c, 0x42, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0xa6, 0x42, 0x00,
+  0x00, 0x45, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x14, 0x42, 0x97, 0x03, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x14, 0x42, 0x96, 0x04, 0x00,
+  0x00, 0x90, 0x42, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x14, 0x42, 0x94, 0x06, 0x00, 0x00, 0xb8,
+  0x41, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0xb8,
+  0x41, 0x8f, 0x0a, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xd6, 0x42, 0x00,
+  0x00, 0xfa, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x14, 0x42, 0x8d,
+  0x0c, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0xd4,
+  0x42, 0x00, 0x00, 0x40, 0x41, 0x8e, 0x0a, 0x00, 0x00, 0x75, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x2d, 0x43, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x40, 0x41, 0x00,
+  0x00, 0x40, 0x40, 0x90, 0x07, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x02,
+  0x43, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0xc0,
+  0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x00,
+  0x40, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0x08, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x34, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x68, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x80, 0x40, 0x8f,
+  0x0b, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x1a,
+  0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xfa,
+  0x42, 0x8e, 0x0c, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x4f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0xba, 0x42, 0x00,
+  0x00, 0xa4, 0x42, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43, 0x8c, 0x07, 0x00, 0x00, 0xa0,
+  0x41, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0xc8,
+  0x42, 0x00, 0x00, 0x34, 0x42, 0x82, 0x03, 0x00, 0x00, 0xf0, 0x41, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x54, 0x42, 0x8b,
+  0x06, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x3c,
+  0x42, 0x00, 0x00, 0x90, 0x41, 0x84, 0x03, 0x00, 0x00, 0xfe, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x20, 0x41, 0x8a,
+  0x05, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0xa0,
+  0x41, 0x86, 0x02, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x21, 0x43, 0x00,
+  0x00, 0x00, 0x41, 0x8b, 0x0e, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74,
+  0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x5c,
+  0x43, 0x00, 0x00, 0x80, 0x40, 0x8c, 0x0d, 0x00, 0x00, 0x80, 0x41, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x60, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0xbc,
+  0x42, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0xbc,
+  0x42, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0xbc,
+  0x42, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x60, 0x43, 0x96, 0x04, 0x00, 0x00, 0x98, 0x41, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x0d, 0x43, 0x96, 0x04, 0x00, 0x00, 0xe4, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0xc8,
+  0x41, 0x95, 0x04, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa0, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x80, 0x3f, 0x94, 0x05, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x30, 0x41, 0x94,
+  0x05, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x88,
+  0x41, 0x95, 0x04, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0xb4, 0x42, 0x95, 0x04, 0x00,
+  0x00, 0xf0, 0x41, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x76, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x96, 0x03, 0x00, 0x00, 0x08,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0xa8,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xa4, 0x42, 0xab, 0x00, 0x00, 0x00, 0x00,
+  0xcb, 0x03, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00,
+  0x59, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x94, 0x05, 0x00, 0x00, 0x80, 0x40,
+  0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x70, 0x43,
+  0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x14, 0x42, 0x94, 0x05, 0x00, 0x00,
+  0x80, 0x40, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x95, 0x04,
+  0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x18, 0x43, 0x94, 0x06, 0x00, 0x00,
+  0x34, 0x42, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00,
+  0x10, 0x41, 0x93, 0x06, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x5f, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x18, 0x43, 0x00, 0x00, 0x10, 0x41, 0x93, 0x05, 0x00, 0x00,
+  0x40, 0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x94, 0x06,
+  0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5c, 0x42,
+  0x00, 0x00, 0xa0, 0x40, 0x93, 0x06, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00,
+  0x62, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x62, 0x43, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x30, 0x41, 0x93, 0x05,
+  0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x2c, 0x42,
+  0x95, 0x0e, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00,
+  0x4a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00,
+  0xae, 0x42, 0x8a, 0x11, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x70, 0x42,
+  0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x51, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6b, 0x43,
+  0x00, 0x00, 0x78, 0x42, 0x89, 0x11, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00,
+  0x6e, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x6b, 0x43, 0x00, 0x00, 0x78, 0x42, 0x88, 0x0a, 0x00, 0x00, 0xe8, 0x41,
+  0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x06, 0x43,
+  0x00, 0x00, 0xb8, 0x41, 0x81, 0x04, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x50, 0x43, 0x88, 0x08, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xec, 0x42,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0xfc, 0x42,
+  0x00, 0x00, 0xe0, 0x40, 0x82, 0x06, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00,
+  0x12, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x24, 0x43, 0x88, 0x06,
+  0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x71, 0x43,
+  0x00, 0x00, 0x8e, 0x42, 0x81, 0x09, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00,
+  0xf8, 0x41, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x50, 0x42, 0x88, 0x11,
+  0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6f, 0x43,
+  0x00, 0x00, 0x06, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00, 0x06, 0x43,
+  0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0xe0, 0x40,
+  0x89, 0x0f, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00,
+  0xf0, 0x42, 0x00, 0x00, 0x40, 0x41, 0x8b, 0x0d, 0x00, 0x00, 0x51, 0x43,
+  0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x47, 0x43,
+  0x00, 0x00, 0xf8, 0x41, 0x8d, 0x0a, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00,
+  0x6b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x48, 0x43, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00,
+  0x78, 0x42, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x03, 0x00,
+  0x00, 0xc0, 0x40, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0xf0, 0x41, 0x97, 0x03, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x96, 0x04, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x95, 0x05, 0x00, 0x00, 0xe0,
+  0x40, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x50, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0x8a, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x73, 0x43, 0x00, 0x00, 0xa0, 0x42, 0x96, 0x03, 0x00, 0x00, 0xae,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x26,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x96,
+  0x03, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xb0, 0x42, 0x96, 0x04, 0x00, 0x00, 0x88, 0x42, 0x00,
+  0x00, 0x6a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0x18, 0x42, 0x95, 0x04, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x60, 0x41, 0x95,
+  0x04, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x8c, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xb6, 0x42, 0x96, 0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x6f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x34,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x18, 0x43, 0x96, 0x04, 0x00, 0x00, 0xe0,
+  0x41, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x51,
+  0x43, 0x00, 0x00, 0x10, 0x41, 0x96, 0x03, 0x00, 0x00, 0x00, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xb8, 0x42, 0x97,
+  0x03, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1e,
+  0x43, 0x00, 0x00, 0xc0, 0x40, 0x97, 0x02, 0x00, 0x00, 0xc4, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xac, 0x42, 0x98, 0x02, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xac, 0x42, 0xe3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb3, 0x01, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x80, 0x42, 0x81, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x8f, 0x0b, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x97, 0x02, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x97, 0x03, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x97, 0x03, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x97, 0x03, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x81, 0x02, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x92, 0x08, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8b, 0x0c, 0x00, 0x00, 0x80,
+  0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x8d, 0x0b, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x8e, 0x0a, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x90, 0x03, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x80, 0x42, 0x82, 0x03, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x97, 0x02, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x97, 0x02, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x98, 0x02, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x98, 0x02, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x98, 0x02, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0xc5,
+  0x00, 0x00, 0x00, 0x00, 0xfb, 0x0b, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00,
+  0xd2, 0x42, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x0a, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x8b, 0x0f, 0x00, 0x00, 0x54, 0x42,
+  0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x50, 0x43,
+  0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xce, 0x42,
+  0x89, 0x11, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00,
+  0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x6e, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00,
+  0xb0, 0x42, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00,
+  0x75, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0xce, 0x42, 0x89, 0x07, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x44, 0x43,
+  0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x04, 0x43,
+  0x84, 0x04, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xce, 0x42, 0x89, 0x05,
+  0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x38, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x98, 0x41,
+  0x85, 0x05, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00,
+  0x40, 0x41, 0x89, 0x02, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x94, 0x42,
+  0x00, 0x00, 0x10, 0x41, 0x88, 0x04, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00,
+  0x50, 0x42, 0x94, 0x05, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x06, 0x43,
+  0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0xa8, 0x42, 0x95, 0x05, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00,
+  0xa8, 0x42, 0x00, 0x00, 0x80, 0x3f, 0x94, 0x04, 0x00, 0x00, 0x92, 0x42,
+  0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x42, 0x43,
+  0x00, 0x00, 0x50, 0x42, 0x95, 0x04, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00,
+  0x6a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00,
+  0x92, 0x42, 0x94, 0x04, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x40, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x0c, 0x43,
+  0x94, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00,
+  0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00,
+  0x6c, 0x42, 0x94, 0x05, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x52, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x73, 0x43,
+  0x00, 0x00, 0x54, 0x42, 0x84, 0x03, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x70, 0x41, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x86, 0x42, 0x8b, 0x05,
+  0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x5c, 0x42,
+  0x84, 0x04, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x89, 0x06,
+  0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x78, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x00, 0x43,
+  0x00, 0x00, 0xe0, 0x40, 0x82, 0x06, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00,
+  0x11, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x96, 0x42, 0x89, 0x11,
+  0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x94, 0x42,
+  0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xf0, 0x41,
+  0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x62, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x88, 0x41,
+  0x88, 0x10, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x6e, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00,
+  0x1b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0x60, 0x42, 0x8a, 0x0f,
+  0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0xee, 0x42,
+  0x00, 0x00, 0x80, 0x40, 0x8b, 0x0c, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x6c, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00,
+  0x50, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x5c, 0x42, 0x8e, 0x07,
+  0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x86, 0x42, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x00, 0x40, 0x86, 0x03, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x2a,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x08, 0x43, 0x8c, 0x03, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x1c, 0x43, 0x00,
+  0x00, 0xa0, 0x42, 0x85, 0x04, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x28,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x88,
+  0x42, 0x8b, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x94, 0x42, 0x85,
+  0x03, 0x00, 0x00, 0xce, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x04, 0x43, 0x8b, 0x04, 0x00, 0x00, 0x30, 0x41, 0x00,
+  0x00, 0x1f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x85, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x80,
+  0x41, 0x8a, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x49, 0x43, 0x85,
+  0x04, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x8b, 0x04, 0x00,
+  0x00, 0xb8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0x08, 0x42, 0x84, 0x04, 0x00, 0x00, 0x30,
+  0x41, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x07, 0x43, 0x8c, 0x03, 0x00, 0x00, 0x08, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xc6, 0x42, 0x85,
+  0x07, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x27,
+  0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x89, 0x10, 0x00,
+  0x00, 0x08, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x48, 0x42, 0x00,
+  0x00, 0x48, 0x42, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x48, 0x42, 0x00,
+  0x00, 0xa8, 0x42, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x50, 0x43, 0x00, 0x00, 0x58, 0x42, 0x8a, 0x0f, 0x00, 0x00, 0x08,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0xe0,
+  0x40, 0x8b, 0x0d, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x44, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x69, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x2c, 0x42, 0x8e,
+  0x0a, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0xf4,
+  0x42, 0x00, 0x00, 0xa0, 0x42, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0xc8,
+  0x42, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x84, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0xba, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x0e, 0x43, 0x96, 0x04, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x4b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x18,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x42, 0x97, 0x03, 0x00, 0x00, 0x2e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x10,
+  0x41, 0x96, 0x03, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x4d, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x60, 0x42, 0x97, 0x02, 0x00, 0x00, 0x30,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x45, 0x43, 0x98, 0x02, 0x00,
+  0x00, 0x30, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x45, 0x43, 0x98,
+  0x02, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0b,
+  0x43, 0x98, 0x02, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x94, 0x42, 0xc5, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9d, 0x02, 0x00,
+  0x00, 0x43, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x90,
+  0x02, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x0c,
+  0x43, 0x83, 0x02, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x61, 0x43, 0x91, 0x02, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x67, 0x43, 0x83, 0x02, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x61, 0x43, 0x90, 0x03, 0x00, 0x00, 0xca,
+  0x42, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x67,
+  0x43, 0x82, 0x03, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x08, 0x43, 0x8f, 0x04, 0x00, 0x00, 0x6c,
+  0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xbe, 0x42, 0x82, 0x03, 0x00, 0x00, 0x09, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x8f,
+  0x03, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x0f, 0x43, 0x82, 0x03, 0x00, 0x00, 0x8a, 0x42, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x40, 0x43, 0x8f,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x90, 0x42, 0x82, 0x07, 0x00,
+  0x00, 0x9c, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0xf8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00,
+  0x00, 0xba, 0x42, 0x00, 0x00, 0x0b, 0x43, 0x8b, 0x04, 0x00, 0x00, 0xf2,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x37,
+  0x43, 0x00, 0x00, 0xa0, 0x40, 0x82, 0x07, 0x00, 0x00, 0x10, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa2, 0x42, 0x00,
+  0x00, 0xbc, 0x42, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x20, 0x43, 0x8b, 0x03, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xe8, 0x41, 0x82, 0x08, 0x00,
+  0x00, 0x68, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0xa0, 0x41, 0x8b,
+  0x0e, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x32,
+  0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0xb0,
+  0x41, 0x8c, 0x0c, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x19, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x8e, 0x0b, 0x00, 0x00, 0x10,
+  0x41, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5b,
+  0x43, 0x00, 0x00, 0x50, 0x42, 0x00, 0x00, 0xa0, 0x41, 0x90, 0x08, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0x0d, 0x43, 0x00,
+  0x00, 0x0d, 0x43, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xd6, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0xa0, 0x41, 0x96, 0x03, 0x00,
+  0x00, 0xbc, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x23, 0x43, 0x96, 0x04, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x58,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x40,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x24, 0x43, 0x97, 0x03, 0x00, 0x00, 0xae,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x9a,
+  0x42, 0x97, 0x03, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x52, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x98, 0x02, 0x00, 0x00, 0xb0,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3b, 0x43, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x07, 0x00, 0x00, 0x10, 0x42, 0x00,
+  0x00, 0x48, 0x42, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00,
+  0x00, 0x64, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00,
+  0x00, 0x53, 0x43, 0x90, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xde,
+  0x42, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x4c,
+  0x43, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x78, 0x42, 0x00, 0x00, 0xd0,
+  0x41, 0x8d, 0x09, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xde, 0x42, 0x00,
+  0x00, 0x44, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x6d, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x0e, 0x43, 0x00,
+  0x00, 0x60, 0x42, 0x00, 0x00, 0x28, 0x42, 0x8f, 0x07, 0x00, 0x00, 0x40,
+  0x41, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0xa4,
+  0x42, 0x00, 0x00, 0x70, 0x41, 0x91, 0x06, 0x00, 0x00, 0x88, 0x41, 0x00,
+  0x00, 0xc4, 0x42, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x88, 0x42, 0x92,
+  0x07, 0x00, 0x00, 0x94, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0xea,
+  0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0x3f, 0x93, 0x04, 0x00,
+  0x00, 0x26, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0xd6, 0x42, 0x00, 0x00, 0x80, 0x40, 0x96, 0x04, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x56,
+  0x43, 0x00, 0x00, 0x20, 0x41, 0x96, 0x04, 0x00, 0x00, 0xf8, 0x41, 0x00,
+  0x00, 0xae, 0x42, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x29, 0x43, 0x98, 0x03, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0xb4, 0x42, 0x98, 0x02, 0x00,
+  0x00, 0xec, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x1d, 0x43, 0x98,
+  0x02, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x39,
+  0x43, 0x97, 0x03, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x96, 0x04, 0x00, 0x00, 0x50,
+  0x42, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x14, 0x42, 0x95, 0x04, 0x00, 0x00, 0x4e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00,
+  0x00, 0xa6, 0x42, 0x96, 0x03, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x0a,
+  0x43, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x00, 0x41, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0x0b, 0x00, 0x00, 0xf8, 0x41, 0x00,
+  0x00, 0x08, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x49, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0xee, 0x42, 0x8e, 0x0c, 0x00, 0x00, 0x78,
+  0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x50,
+  0x43, 0x8e, 0x0c, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x19, 0x43, 0x00,
+  0x00, 0x19, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x25, 0x43, 0x8e, 0x0c, 0x00, 0x00, 0x80,
+  0x40, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x1c,
+  0x42, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x53,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0x80,
+  0x40, 0x95, 0x04, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x4e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x96,
+  0x03, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x9c, 0x42, 0x96, 0x04, 0x00, 0x00, 0x21, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x00,
+  0x00, 0xa0, 0x40, 0x95, 0x03, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x5f,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x53, 0x43, 0x97, 0x03, 0x00,
+  0x00, 0x61, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00,
+  0x00, 0x00, 0x42, 0x96, 0x03, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x92, 0x08, 0x00,
+  0x00, 0xb0, 0x41, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x08, 0x42, 0x00,
+  0x00, 0x08, 0x42, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x91,
+  0x0c, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x86,
+  0x42, 0x00, 0x00, 0x70, 0x41, 0x8d, 0x0e, 0x00, 0x00, 0xfc, 0x42, 0x00,
+  0x00, 0x7b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x5a, 0x43, 0x00, 0x00, 0xda, 0x42, 0x8c, 0x0e, 0x00, 0x00, 0x51,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x66,
+  0x43, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x20,
+  0x41, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x44,
+  0x42, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x70, 0x41, 0x8c, 0x01, 0x00,
+  0x00, 0x23, 0x43, 0x00, 0x00, 0x04, 0x43, 0x81, 0x03, 0x00, 0x00, 0x10,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x40,
+  0x41, 0x97, 0x02, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x2f, 0x43, 0x98, 0x02, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x96, 0x42, 0x98, 0x02, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x98, 0x02, 0x00, 0x00, 0xea,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x98, 0x02, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x2f, 0x43, 0xc6,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb5, 0x06, 0x00, 0x00, 0xf0, 0x42, 0x00,
+  0x00, 0x71, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x92,
+  0x0a, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x79,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0x38, 0x42, 0x8f, 0x0c, 0x00,
+  0x00, 0x9a, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00,
+  0x00, 0x1b, 0x43, 0x8d, 0x0d, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x55,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x2b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x8c, 0x08, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x18, 0x42, 0x00,
+  0x00, 0x00, 0x42, 0x81, 0x04, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x2f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd2,
+  0x42, 0x8a, 0x06, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0x62, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x19, 0x43, 0x00, 0x00, 0x08, 0x42, 0x85, 0x03, 0x00, 0x00, 0xa0,
+  0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3e,
+  0x43, 0x89, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x56, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00,
+  0x00, 0x94, 0x42, 0x00, 0x00, 0x30, 0x41, 0x86, 0x03, 0x00, 0x00, 0xa0,
+  0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf6,
+  0x42, 0x89, 0x04, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0x87,
+  0x04, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xb8, 0x42, 0x88, 0x05, 0x00,
+  0x00, 0xb0, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x20, 0x41, 0x87,
+  0x03, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x77, 0x43, 0x88, 0x05, 0x00, 0x00, 0xd0, 0x41, 0x00,
+  0x00, 0x55, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x36, 0x43, 0x00, 0x00, 0x10, 0x41, 0x87, 0x04, 0x00, 0x00, 0x4c,
+  0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x77, 0x43, 0x88, 0x04, 0x00, 0x00, 0xfa, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x04, 0x43, 0x85, 0x07, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x8c,
+  0x42, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x4a,
+  0x43, 0x88, 0x04, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x23, 0x43, 0x00, 0x00, 0x10, 0x41, 0x83,
+  0x08, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x66,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x14,
+  0x42, 0x89, 0x0f, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0x04, 0x42, 0x00,
+  0x00, 0x04, 0x42, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x04, 0x42, 0x00,
+  0x00, 0x09, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0xa2, 0x42, 0x8b, 0x0e, 0x00, 0x00, 0x71,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x4b,
+  0x43, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x0c, 0x42, 0x8c, 0x0b, 0x00,
+  0x00, 0xe6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00,
+  0x00, 0x74, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0xee, 0x42, 0x90,
+  0x08, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+  0x42, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x0a, 0x00,
+  0x00, 0x80, 0x3f, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x10, 0x43, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x78, 0x42, 0x00,
+  0x00, 0x80, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x8f, 0x0b, 0x00, 0x00, 0x9e,
+  0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xc4, 0x42, 0x8c, 0x0f, 0x00,
+  0x00, 0x80, 0x3f, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00,
+  0x00, 0xce, 0x42, 0x8a, 0x11, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x35,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0xb6,
+  0x42, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x90,
+  0x42, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x57,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x71,
+  0x43, 0x00, 0x00, 0x9c, 0x42, 0x89, 0x05, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x28, 0x43, 0x87, 0x03, 0x00, 0x00, 0x2a,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3e,
+  0x43, 0x88, 0x05, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x1a, 0x43, 0x88, 0x03, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x69,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x88, 0x05, 0x00,
+  0x00, 0x59, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x4c, 0x42, 0x88,
+  0x03, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x87, 0x05, 0x00, 0x00, 0x80, 0x41, 0x00,
+  0x00, 0x5e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x2e, 0x43, 0x00, 0x00, 0x4c, 0x42, 0x87, 0x05, 0x00, 0x00, 0xd8,
+  0x41, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x14, 0x43, 0x87, 0x04, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x78, 0x42, 0x87, 0x06, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x38,
+  0x42, 0x87, 0x03, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x83, 0x0a, 0x00, 0x00, 0xdc,
+  0x42, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x5e,
+  0x43, 0x00, 0x00, 0x24, 0x42, 0x88, 0x11, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x59, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00,
+  0x00, 0x59, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00,
+  0x00, 0xee, 0x42, 0x00, 0x00, 0xc8, 0x41, 0x89, 0x0e, 0x00, 0x00, 0x15,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0x74, 0x42, 0x8c, 0x0a, 0x00,
+  0x00, 0x3c, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0xd8, 0x42, 0x00, 0x00, 0xb8, 0x42, 0x92, 0x04, 0x00, 0x00, 0xd2,
+  0x42, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x10,
+  0x43, 0x00, 0x00, 0x24, 0x42, 0xff, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x9d, 0x03, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xae, 0x42, 0x96, 0x04, 0x00, 0x00, 0x7c,
+  0x42, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x57, 0x43, 0x94, 0x06, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0x7c, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x94,
+  0x05, 0x00, 0x00, 0xa6, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x3c,
+  0x42, 0x95, 0x05, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x71, 0x43, 0x00,
+  0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xd6, 0x42, 0x94, 0x05, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x02, 0x43, 0x94, 0x05, 0x00, 0x00, 0xd2, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x3c, 0x43, 0x00, 0x00, 0xd6, 0x42, 0x94, 0x06, 0x00, 0x00, 0x80,
+  0x41, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x4c,
+  0x42, 0x93, 0x06, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0x2a, 0x43, 0x00,
+  0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x6b, 0x43, 0x00, 0x00, 0xa4, 0x42, 0x94, 0x05, 0x00, 0x00, 0xae,
+  0x42, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x57, 0x43, 0x94, 0x06, 0x00,
+  0x00, 0x28, 0x42, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00,
+  0x00, 0xc8, 0x41, 0x93, 0x06, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x4e,
+  0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x38, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0x92, 0x42, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x7b, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x95,
+  0x04, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x24, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x0e, 0x43, 0x95, 0x04, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x24,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x95,
+  0x05, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0xa0,
+  0x40, 0x96, 0x03, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x74, 0x42, 0x96, 0x03, 0x00, 0x00, 0x1c,
+  0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x4c,
+  0x42, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x03, 0x00, 0x00,
+  0x1c, 0x42, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x6a, 0x43, 0x95, 0x05, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x63, 0x43,
+  0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43,
+  0x00, 0x00, 0x8c, 0x42, 0x94, 0x05, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00,
+  0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x41, 0x43, 0x00, 0x00, 0x94, 0x42, 0x93, 0x06, 0x00, 0x00, 0x24, 0x42,
+  0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x50, 0x41,
+  0x93, 0x06, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00,
+  0xb2, 0x42, 0x00, 0x00, 0x30, 0x41, 0x92, 0x06, 0x00, 0x00, 0xc0, 0x40,
+  0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x54, 0x42,
+  0x94, 0x05, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00,
+  0x54, 0x42, 0x93, 0x06, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xde, 0x42,
+  0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x00, 0x40, 0x94, 0x05, 0x00, 0x00,
+  0x7c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x94, 0x05,
+  0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x10, 0x41,
+  0x94, 0x05, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00,
+  0xe0, 0x40, 0x94, 0x0d, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x17, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x25, 0x43,
+  0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x25, 0x43,
+  0x00, 0x00, 0xc4, 0x42, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x80, 0x40,
+  0x8d, 0x0d, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x8d, 0x0e,
+  0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0xd8, 0x41,
+  0x8b, 0x0f, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00,
+  0x16, 0x43, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00,
+  0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00,
+  0xbc, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x58, 0x42, 0x8b, 0x04, 0x00, 0x00, 0x0d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0xf0, 0x42, 0x84, 0x05, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+  0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x35, 0x43, 0x00, 0x00, 0x00, 0x41, 0x8b, 0x0e, 0x00, 0x00, 0x6a, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0xd8, 0x41,
+  0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0xb2, 0x42,
+  0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x01, 0x43, 0x8c, 0x0d, 0x00, 0x00,
+  0x6a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00,
+  0x53, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x69, 0x43, 0x00, 0x00, 0x4c, 0x42, 0x8d, 0x0c, 0x00, 0x00, 0x0c, 0x43,
+  0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x79, 0x43,
+  0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0x44, 0x42,
+  0x8f, 0x08, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00,
+  0xe8, 0x42, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00,
+  0xbc, 0x42, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x03, 0x00, 0x00,
+  0xd0, 0x41, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x31, 0x43, 0x97, 0x03, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xd6, 0x42, 0x95, 0x05, 0x00, 0x00,
+  0xf0, 0x41, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x30, 0x41, 0x94, 0x05,
+  0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x70, 0x41,
+  0x94, 0x05, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x00, 0x00,
+  0x88, 0x41, 0x94, 0x05, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x7a, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x24, 0x43,
+  0x00, 0x00, 0x90, 0x41, 0x93, 0x05, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00,
+  0x2e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x6e, 0x43, 0x00, 0x00, 0x96, 0x42, 0x94, 0x05, 0x00, 0x00, 0x90, 0x41,
+  0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x90, 0x42, 0x93, 0x06, 0x00, 0x00,
+  0x40, 0x40, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00,
+  0x78, 0x42, 0x94, 0x04, 0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x95, 0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x71, 0x43, 0x82, 0x03,
+  0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0xf2, 0x42,
+  0x00, 0x00, 0x00, 0x42, 0x8e, 0x0d, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00,
+  0x59, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0xca, 0x42, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0x42, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00,
+  0x04, 0x43, 0x8c, 0x05, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x57, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x27, 0x43,
+  0x00, 0x00, 0x20, 0x41, 0x81, 0x07, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00,
+  0xa8, 0x42, 0x8a, 0x10, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x57, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x25, 0x43,
+  0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x0f, 0x43,
+  0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x30, 0x43,
+  0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x42, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xba, 0x42,
+  0x8a, 0x10, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00,
+  0x51, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x5a, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x8a, 0x0f,
+  0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0xf8, 0x41,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x2e, 0x43,
+  0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x72, 0x43,
+  0x00, 0x00, 0xc4, 0x42, 0x8b, 0x0e, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00,
+  0x24, 0x42, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x2f, 0x43, 0x00, 0x00,
+  0x4f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x73, 0x43, 0x00, 0x00, 0xc4, 0x42, 0x8b, 0x0e, 0x00, 0x00, 0x80, 0x42,
+  0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x8d, 0x0c, 0x00, 0x00,
+  0x34, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x78, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00,
+  0x88, 0x41, 0x8f, 0x08, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0xf0, 0x42,
+  0x00, 0x00, 0x80, 0x42, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x9b, 0x07, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xde, 0x42, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x36, 0x43, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0xe0, 0x41, 0x91,
+  0x0a, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0xe6, 0x42, 0x00, 0x00, 0x3c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x8e, 0x0c, 0x00,
+  0x00, 0x40, 0x42, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00,
+  0x00, 0x1a, 0x43, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x30, 0x42, 0x00,
+  0x00, 0x02, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xaa, 0x42, 0x8c, 0x07, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x74,
+  0x42, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x80,
+  0x40, 0x83, 0x02, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0x52, 0x43, 0x00,
+  0x00, 0x2b, 0x43, 0x8b, 0x05, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x13,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x46,
+  0x43, 0x00, 0x00, 0xb4, 0x42, 0x83, 0x05, 0x00, 0x00, 0xa0, 0x40, 0x00,
+  0x00, 0x60, 0x42, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x18, 0x43, 0x8b, 0x03, 0x00, 0x00, 0x74,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4c,
+  0x43, 0x85, 0x05, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00,
+  0x00, 0x2c, 0x42, 0x8a, 0x04, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x6b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x30,
+  0x41, 0x82, 0x07, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x24, 0x42, 0x00,
+  0x00, 0x55, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x10, 0x41, 0x8b,
+  0x04, 0x00, 0x00, 0xa6, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xb4, 0x42, 0x00, 0x00, 0xc0, 0x41, 0x82, 0x04, 0x00,
+  0x00, 0x23, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x70, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x8f, 0x03, 0x00, 0x00, 0x30,
+  0x42, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x56,
+  0x43, 0x81, 0x04, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0xe2, 0x42, 0x90,
+  0x09, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x5d,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x13,
+  0x43, 0x00, 0x00, 0xa0, 0x41, 0x93, 0x05, 0x00, 0x00, 0x1c, 0x42, 0x00,
+  0x00, 0x73, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x11, 0x43, 0x94, 0x05, 0x00, 0x00, 0x70,
+  0x41, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x13, 0x43, 0x95, 0x05, 0x00,
+  0x00, 0x13, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x58, 0x43, 0x93,
+  0x08, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xb4, 0x42, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x60,
+  0x41, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x44,
+  0x42, 0x92, 0x08, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x42, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x27, 0x43, 0x00,
+  0x00, 0xc8, 0x41, 0x91, 0x04, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x4a,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x70,
+  0x42, 0x81, 0x02, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x92, 0x42, 0x91, 0x08, 0x00, 0x00, 0x23, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0xd0, 0x42, 0x92, 0x08, 0x00, 0x00, 0x86, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x34, 0x42, 0x00,
+  0x00, 0xa8, 0x42, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x92, 0x08, 0x00, 0x00, 0xca,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x10, 0x41, 0x92, 0x06, 0x00,
+  0x00, 0xb8, 0x41, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0x79, 0x43, 0x00,
+  0x00, 0x65, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x8c, 0x42, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x09, 0x00, 0x00,
+  0x80, 0x42, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x29, 0x43, 0x88, 0x00, 0x00, 0x00, 0x64, 0x42, 0x84, 0x0d, 0x00, 0x00,
+  0x88, 0x41, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00,
+  0x76, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0xe4, 0x42, 0x87, 0x00, 0x00, 0x00, 0x60, 0x41,
+  0x82, 0x0f, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00,
+  0x66, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00,
+  0x1e, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0xee, 0x42, 0x8b, 0x0f, 0x00, 0x00, 0x86, 0x42,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0xdc, 0x42,
+  0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0xc0, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x70, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xa4, 0x42,
+  0x8b, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00,
+  0x54, 0x42, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0xb0, 0x41, 0x84, 0x04,
+  0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x95, 0x04, 0x00, 0x00,
+  0x38, 0x42, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x95, 0x05, 0x00, 0x00, 0x70, 0x41,
+  0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x73, 0x43,
+  0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0xe8, 0x41, 0x94, 0x04, 0x00, 0x00,
+  0x40, 0x41, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x75, 0x43, 0x00, 0x00, 0x31, 0x43, 0x95, 0x04, 0x00, 0x00, 0x60, 0x41,
+  0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x78, 0x43,
+  0x00, 0x00, 0xd4, 0x42, 0x96, 0x03, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xcc, 0x42, 0x95, 0x04,
+  0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x94, 0x05, 0x00, 0x00,
+  0x88, 0x41, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x94, 0x05,
+  0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x60, 0x41,
+  0x94, 0x05, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00,
+  0x98, 0x41, 0x94, 0x05, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x3a, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x2b, 0x43,
+  0x00, 0x00, 0xb0, 0x41, 0x89, 0x00, 0x00, 0x00, 0x10, 0x42, 0x8a, 0x03,
+  0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x38, 0x43, 0x87, 0x04, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00,
+  0x58, 0x42, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00,
+  0xf6, 0x42, 0x89, 0x11, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0x70, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xac, 0x42,
+  0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x24, 0x42,
+  0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x24, 0x42,
+  0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x3e, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5d, 0x43,
+  0x00, 0x00, 0x18, 0x42, 0x89, 0x10, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x4b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00,
+  0x1c, 0x42, 0x8a, 0x0e, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x7a, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0xd4, 0x42,
+  0x00, 0x00, 0x04, 0x42, 0x8d, 0x0a, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0xf0, 0x42, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00,
+  0xa4, 0x42, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb2, 0x09, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0xec, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x29, 0x43, 0x00,
+  0x00, 0x40, 0x40, 0x8d, 0x0d, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0x3c,
+  0x42, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0,
+  0x41, 0x8c, 0x0e, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0x64, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x43, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00,
+  0x00, 0x63, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00,
+  0x00, 0x80, 0x41, 0x8c, 0x0d, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x52,
+  0x43, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0x34,
+  0x42, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x41, 0x00, 0x00, 0x42, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x8d, 0x04, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x96, 0x42, 0x00,
+  0x00, 0xb0, 0x41, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x40, 0x41, 0x84,
+  0x03, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xd8, 0x42, 0x97, 0x03, 0x00, 0x00, 0x15, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x28, 0x42, 0x96,
+  0x03, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x22, 0x43, 0x97, 0x03, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x97,
+  0x03, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x56,
+  0x43, 0x00, 0x00, 0x50, 0x41, 0x96, 0x0b, 0x00, 0x00, 0x08, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00,
+  0x00, 0xaa, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0xfe, 0x42, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00,
+  0x00, 0x52, 0x43, 0x00, 0x00, 0x92, 0x42, 0x89, 0x11, 0x00, 0x00, 0xe0,
+  0x40, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x15,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x66,
+  0x43, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x88, 0x0f, 0x00,
+  0x00, 0x10, 0x41, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00,
+  0x00, 0x4e, 0x43, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0xb8, 0x42, 0x00,
+  0x00, 0x04, 0x42, 0x8b, 0x0a, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x57,
+  0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0xc8,
+  0x41, 0x90, 0x08, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x5a, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0xd0, 0x41, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x1d, 0x43, 0x92, 0x02, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x3d,
+  0x43, 0x00, 0x00, 0x0c, 0x42, 0x81, 0x03, 0x00, 0x00, 0x3c, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x09, 0x43, 0x97,
+  0x03, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xb8, 0x41, 0x97, 0x03, 0x00, 0x00, 0x3c, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x97,
+  0x03, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xb0, 0x41, 0x97, 0x03, 0x00, 0x00, 0x3c, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x82, 0x42, 0x97,
+  0x03, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xaa, 0x42, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xae, 0x0d, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xd8, 0x42, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x0b, 0x43, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x10, 0x41, 0x8d,
+  0x0d, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x24, 0x43, 0x8d, 0x0d, 0x00,
+  0x00, 0x4f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00,
+  0x00, 0x37, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00,
+  0x00, 0x37, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x8d, 0x04, 0x00, 0x00, 0x14,
+  0x42, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x34,
+  0x42, 0x00, 0x00, 0x50, 0x41, 0x85, 0x03, 0x00, 0x00, 0xa8, 0x41, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x60, 0x42, 0x97,
+  0x03, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x8a, 0x42, 0x97, 0x03, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0x98, 0x41, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x4d, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x96, 0x03, 0x00, 0x00, 0x8c,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xe8,
+  0x42, 0x96, 0x04, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x4d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x30, 0x41, 0x81,
+  0x00, 0x00, 0x00, 0x54, 0x42, 0x8c, 0x00, 0x00, 0x00, 0x30, 0x41, 0x85,
+  0x07, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x16, 0x43, 0x88, 0x12, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x21, 0x43, 0x00,
+  0x00, 0x21, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00,
+  0x00, 0x21, 0x43, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x21, 0x43, 0x00,
+  0x00, 0x21, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0xf6, 0x42, 0x00,
+  0x00, 0x88, 0x41, 0x88, 0x10, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0xc8,
+  0x41, 0x8a, 0x0e, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x4a, 0x43, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00,
+  0x00, 0x29, 0x43, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00,
+  0x00, 0x0c, 0x42, 0x8d, 0x00, 0x00, 0x00, 0x30, 0x41, 0x81, 0x02, 0x00,
+  0x00, 0x30, 0x41, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x41, 0x82,
+  0x03, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d,
+  0x43, 0x00, 0x00, 0x60, 0x41, 0x97, 0x02, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x97, 0x03, 0x00, 0x00, 0xb0,
+  0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x8a,
+  0x42, 0x97, 0x03, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x14, 0x42, 0x98, 0x02, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x50, 0x41, 0x98, 0x01, 0x00,
+  0x00, 0x14, 0x43, 0x00, 0x00, 0x4e, 0x43, 0xc3, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x97, 0x0c, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0xdc, 0x42, 0x00,
+  0x00, 0xda, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x15, 0x43, 0x00, 0x00, 0x3c, 0x42, 0x89, 0x11, 0x00, 0x00, 0x54,
+  0x42, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x14, 0x43, 0x89, 0x11, 0x00,
+  0x00, 0x35, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x14, 0x43, 0x89,
+  0x07, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x28,
+  0x43, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x9a, 0x42, 0x85, 0x03, 0x00,
+  0x00, 0xda, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xd8, 0x42, 0x89, 0x03, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x0f,
+  0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0xa0, 0x41, 0x88, 0x04, 0x00,
+  0x00, 0x7c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0x78, 0x42, 0x94, 0x05, 0x00, 0x00, 0xa8,
+  0x41, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0x9e, 0x42, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x94,
+  0x04, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x95, 0x04, 0x00,
+  0x00, 0xc6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x95, 0x05, 0x00, 0x00, 0xd2,
+  0x42, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x20, 0x41, 0x93, 0x06, 0x00,
+  0x00, 0xd2, 0x42, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00,
+  0x00, 0x20, 0x41, 0x93, 0x05, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x4e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0x38, 0x42, 0x92, 0x06, 0x00, 0x00, 0x80, 0x3f, 0x00,
+  0x00, 0xda, 0x42, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0xee, 0x42, 0x85,
+  0x02, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00, 0x05,
+  0x43, 0x8b, 0x06, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00,
+  0x00, 0x0c, 0x42, 0x00, 0x00, 0xa0, 0x40, 0x81, 0x06, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0xe6, 0x42, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0xf0,
+  0x41, 0x89, 0x10, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x0c, 0x43, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00,
+  0x00, 0x43, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x54, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0x20, 0x41, 0x8a,
+  0x04, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x33, 0x43, 0x81, 0x07, 0x00,
+  0x00, 0x7c, 0x42, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x14, 0x43, 0x00, 0x00, 0x38, 0x42, 0x8b, 0x0b, 0x00, 0x00, 0xdc,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x10, 0x43, 0x8f, 0x0a, 0x00,
+  0x00, 0x69, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3d, 0x43, 0x00, 0x00, 0x19, 0x43, 0x90, 0x09, 0x00, 0x00, 0x68,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x76,
+  0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x20,
+  0x41, 0x91, 0x06, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x52, 0x43, 0x00, 0x00, 0xb8, 0x42, 0xe3, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xa1, 0x02, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xfc, 0x42, 0x00,
+  0x00, 0x03, 0x43, 0x96, 0x04, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x82,
+  0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x35,
+  0x43, 0x96, 0x03, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8a, 0x02, 0x00, 0x00, 0x70,
+  0x41, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x8e, 0x42, 0x88, 0x04, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0xe8, 0x42, 0x00, 0x00, 0xa0, 0x40, 0x8a, 0x02, 0x00, 0x00, 0x0f,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x50, 0x43, 0x86, 0x05, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x89,
+  0x04, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x56,
+  0x43, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x10, 0x42, 0x86, 0x04, 0x00,
+  0x00, 0xc8, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x2c, 0x43, 0x00, 0x00, 0x10, 0x41, 0x8a, 0x03, 0x00, 0x00, 0xe0,
+  0x40, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x50,
+  0x43, 0x86, 0x04, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x30, 0x41, 0x8b,
+  0x03, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0xaa, 0x42, 0x85, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00,
+  0x00, 0x52, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0xf0, 0x41, 0x8c, 0x02, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x85, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00,
+  0x00, 0x2b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0x8c, 0x42, 0x8d, 0x03, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x84, 0x07, 0x00,
+  0x00, 0xbc, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x2d, 0x43, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x29, 0x43, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x44, 0x42, 0x8a, 0x10, 0x00, 0x00, 0x14,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x4d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6b,
+  0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x11,
+  0x43, 0x00, 0x00, 0x10, 0x42, 0x8a, 0x0f, 0x00, 0x00, 0xa0, 0x40, 0x00,
+  0x00, 0x5c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00,
+  0x00, 0x47, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x40, 0x43, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0xe0, 0x40, 0x8c,
+  0x0c, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x5d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x92,
+  0x42, 0x00, 0x00, 0x10, 0x41, 0x90, 0x08, 0x00, 0x00, 0xc8, 0x41, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x9e, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x1a, 0x43, 0x00, 0x00, 0x20, 0x41, 0x95, 0x04, 0x00, 0x00, 0x30,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x49,
+  0x43, 0x00, 0x00, 0x10, 0x41, 0x96, 0x03, 0x00, 0x00, 0x30, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x97,
+  0x03, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0x20, 0x42, 0x97, 0x02, 0x00, 0x00, 0x30, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x98, 0x02, 0x00, 0x00, 0x30,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x03, 0x43, 0x98, 0x02, 0x00,
+  0x00, 0xb8, 0x41, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0xcc, 0x42, 0xe1,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00,
+  0xb6, 0x42, 0x00, 0x00, 0x78, 0x42, 0x96, 0x05, 0x00, 0x00, 0x10, 0x42,
+  0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x94, 0x07, 0x00, 0x00,
+  0x54, 0x42, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x78, 0x43, 0x00, 0x00, 0x84, 0x42, 0x92, 0x08, 0x00, 0x00, 0x40, 0x42,
+  0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x92, 0x09, 0x00, 0x00,
+  0x45, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00,
+  0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00,
+  0x00, 0x42, 0x91, 0x09, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x4b, 0x43,
+  0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x80, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x82, 0x42, 0x97, 0x03, 0x00, 0x00,
+  0xa6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x82, 0x42, 0x97, 0x03, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x55, 0x43, 0x97, 0x03, 0x00, 0x00,
+  0x76, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x00, 0x43, 0x95, 0x05, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x37, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1d, 0x43,
+  0x00, 0x00, 0x00, 0x40, 0x95, 0x04, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x15, 0x43, 0x95, 0x04, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0x6f, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x35, 0x43,
+  0x94, 0x06, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00,
+  0x60, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x3f, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x93, 0x06, 0x00, 0x00, 0x70, 0x41,
+  0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xc2, 0x42,
+  0x81, 0x04, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00,
+  0xe8, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x8b, 0x12,
+  0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x2f, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43,
+  0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x52, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x4d, 0x43,
+  0x00, 0x00, 0xc6, 0x42, 0x88, 0x12, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x87, 0x13,
+  0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x43, 0x43,
+  0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x43, 0x43,
+  0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x87, 0x0c, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0xdc, 0x42, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00,
+  0xc0, 0x42, 0x8e, 0x09, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x33, 0x43,
+  0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x70, 0x41,
+  0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x80, 0x3f, 0x91, 0x03, 0x00, 0x00,
+  0xb4, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00,
+  0x9c, 0x42, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x02, 0x00,
+  0x00, 0xa8, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x0a, 0x43, 0x97,
+  0x03, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xaa, 0x42, 0x96, 0x04, 0x00, 0x00, 0x18, 0x42, 0x00,
+  0x00, 0x2a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00,
+  0x00, 0x54, 0x42, 0x95, 0x04, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x5e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xea,
+  0x42, 0x95, 0x05, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x45, 0x43, 0x00,
+  0x00, 0x78, 0x42, 0x94, 0x05, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe6,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x23, 0x43, 0x95, 0x05, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0x50, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x08, 0x42, 0x94, 0x06, 0x00, 0x00, 0xf0,
+  0x41, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x80,
+  0x3f, 0x94, 0x05, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0xc2, 0x42, 0x00,
+  0x00, 0x00, 0x40, 0x94, 0x04, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x74,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00,
+  0x00, 0xe8, 0x41, 0x94, 0x04, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x48,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4d,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x48, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00,
+  0x00, 0xb2, 0x42, 0x95, 0x04, 0x00, 0x00, 0x17, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3c,
+  0x42, 0x95, 0x05, 0x00, 0x00, 0x23, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x00,
+  0x00, 0x40, 0x40, 0x94, 0x04, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xc6,
+  0x42, 0x96, 0x04, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x95,
+  0x04, 0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x14, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0xb0, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00,
+  0x00, 0x1c, 0x42, 0x97, 0x02, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xa4, 0x42, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc9, 0x03, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x90, 0x41, 0x96, 0x04, 0x00, 0x00, 0x30, 0x41,
+  0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x78, 0x43,
+  0x00, 0x00, 0x88, 0x41, 0x95, 0x04, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00,
+  0x56, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x9c, 0x42, 0x95, 0x05, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x1e, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x34, 0x43,
+  0x00, 0x00, 0x20, 0x41, 0x94, 0x04, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+  0x1d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x11, 0x43, 0x95, 0x05, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x1c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x33, 0x43,
+  0x00, 0x00, 0x60, 0x41, 0x94, 0x05, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00,
+  0x67, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x32, 0x43, 0x00, 0x00, 0x70, 0x41, 0x94, 0x05, 0x00, 0x00, 0x6c, 0x42,
+  0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x80, 0x41, 0x94, 0x05, 0x00, 0x00,
+  0x20, 0x41, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x70, 0x43, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x80, 0x41, 0x94, 0x04,
+  0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x96, 0x03, 0x00, 0x00,
+  0x8e, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x24, 0x43, 0x96, 0x0a, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x69, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x04, 0x42,
+  0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x96, 0x42,
+  0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x40, 0x42,
+  0x8f, 0x0c, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00,
+  0x57, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x6b, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x8d, 0x0e, 0x00, 0x00, 0x80, 0x41,
+  0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x6a, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0xa0, 0x41, 0x8c, 0x0e, 0x00, 0x00,
+  0x98, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x5d, 0x43, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00,
+  0x14, 0x42, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x41, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x02, 0x43, 0x8c, 0x03,
+  0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x1b, 0x43, 0x86, 0x03, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x8c, 0x04,
+  0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x84, 0x04, 0x00, 0x00,
+  0x08, 0x42, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xc2, 0x42, 0x8c, 0x0e, 0x00, 0x00, 0x30, 0x41,
+  0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x6c, 0x43,
+  0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x6c, 0x43,
+  0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x60, 0x41, 0x8d, 0x0c, 0x00, 0x00,
+  0x98, 0x41, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00,
+  0xb0, 0x41, 0x8f, 0x0a, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc0, 0x41,
+  0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x1c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x01, 0x43,
+  0x00, 0x00, 0xb4, 0x42, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x80, 0x3f,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x98, 0x03,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x97, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x96, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x96, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x95, 0x04,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x95, 0x05, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x94, 0x05,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x95, 0x05, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x95, 0x05, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x95, 0x05, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x94, 0x06, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x94, 0x05, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x94, 0x06, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x94, 0x05, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x95, 0x04,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x96, 0x04, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x96, 0x04, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x96, 0x03, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x97, 0x02,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x95, 0x05, 0x00,
+  0x00, 0x00, 0x41, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x14, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x54, 0x43, 0x95,
+  0x09, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x52,
+  0x43, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x60, 0x41, 0x8f, 0x0d, 0x00, 0x00, 0xaa, 0x42, 0x00,
+  0x00, 0xfe, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x3c, 0x43, 0x00,
+  0x00, 0x52, 0x43, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0xa8, 0x42, 0x8d, 0x0e, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5f,
+  0x43, 0x00, 0x00, 0xa8, 0x42, 0x8b, 0x10, 0x00, 0x00, 0xd6, 0x42, 0x00,
+  0x00, 0x6d, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00,
+  0x00, 0x8c, 0x42, 0x88, 0x13, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xe2,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x00, 0x00, 0xe0,
+  0x40, 0x87, 0x13, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x27, 0x43, 0x00,
+  0x00, 0x26, 0x43, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xde, 0x42, 0x87,
+  0x09, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0xfa, 0x42, 0x82, 0x06, 0x00, 0x00, 0x28, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x87,
+  0x06, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x60,
+  0x43, 0x00, 0x00, 0x5c, 0x42, 0x85, 0x06, 0x00, 0x00, 0x60, 0x42, 0x00,
+  0x00, 0x5f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x87,
+  0x05, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x52,
+  0x43, 0x87, 0x05, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x87, 0x04, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x87, 0x06, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x24, 0x42, 0x87, 0x04, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x85, 0x08, 0x00, 0x00, 0xe8, 0x41, 0x00,
+  0x00, 0xaa, 0x42, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x42, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x87, 0x04, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x84, 0x08, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x28, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x88, 0x12, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x28,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xa6,
+  0x42, 0x88, 0x12, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x76, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x60, 0x41, 0x88, 0x0f, 0x00, 0x00, 0x5b,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x31,
+  0x43, 0x8b, 0x0e, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x42, 0x43, 0x00,
+  0x00, 0x26, 0x43, 0x8c, 0x0d, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0x24,
+  0x42, 0x8f, 0x08, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x43, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x00,
+  0x00, 0x8c, 0x42, 0x93, 0x05, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x24,
+  0x42, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x24,
+  0x42, 0x00, 0x00, 0x60, 0x41, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0x04, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00,
+  0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x95, 0x05,
+  0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xd8, 0x41,
+  0x94, 0x06, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00,
+  0x05, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x92, 0x06, 0x00, 0x00, 0x80, 0x40,
+  0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x14, 0x42,
+  0x93, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x43, 0x43, 0x95, 0x04, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0xd4, 0x42,
+  0x95, 0x05, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00,
+  0x90, 0x41, 0x94, 0x05, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0x67, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x0d, 0x43,
+  0x00, 0x00, 0xf8, 0x41, 0x94, 0x05, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00,
+  0x4f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x59, 0x43, 0x00, 0x00, 0x14, 0x42, 0x95, 0x04, 0x00, 0x00, 0x0c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5c, 0x43,
+  0x00, 0x00, 0x14, 0x42, 0x95, 0x04, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x05, 0x43, 0x95, 0x05, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x35, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x01, 0x43,
+  0x00, 0x00, 0xc0, 0x40, 0x95, 0x04, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0xd8, 0x41, 0x82, 0x06, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0x64, 0x42,
+  0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x64, 0x42,
+  0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x18, 0x42, 0x8c, 0x0f, 0x00, 0x00,
+  0x92, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x70, 0x43, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00,
+  0xf6, 0x42, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00,
+  0x03, 0x43, 0x8b, 0x0f, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x32, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x43, 0x43, 0x8b, 0x0f, 0x00, 0x00,
+  0x46, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x57, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x44, 0x43, 0x8b, 0x0f, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x2d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x76, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x8c, 0x42, 0x8b, 0x0f, 0x00, 0x00,
+  0xb0, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00,
+  0x40, 0x41, 0x8b, 0x0e, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x31, 0x43,
+  0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x75, 0x43,
+  0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0xa8, 0x42,
+  0x00, 0x00, 0x10, 0x41, 0x8e, 0x08, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00,
+  0x2e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0xfe, 0x42, 0x00, 0x00, 0xae, 0x42, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xd0, 0x06, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0xa4, 0x42, 0x00,
+  0x00, 0x49, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x91, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x48, 0x42, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x74,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6f,
+  0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x43,
+  0x43, 0x90, 0x0a, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x01, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x18, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0x26, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8f,
+  0x0b, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x24,
+  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xc8,
+  0x42, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x00,
+  0x41, 0x8e, 0x0b, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x43, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xec, 0x42, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0xc6, 0x42, 0x00,
+  0x00, 0x39, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x2a, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0xc0, 0x40, 0x00,
+  0x00, 0x17, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0x69, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00,
+  0x00, 0xe4, 0x42, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x9e, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x94, 0x00, 0x00, 0x00, 0x70,
+  0x42, 0x81, 0x03, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x29, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x39, 0x43, 0x97, 0x03, 0x00, 0x00, 0xde,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0xbc,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x4f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x55, 0x43, 0x97, 0x03, 0x00, 0x00, 0x1c,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x54,
+  0x42, 0x96, 0x03, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x6f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x01, 0x43, 0x97, 0x03, 0x00, 0x00, 0x43,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0xc0,
+  0x41, 0x96, 0x03, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x62, 0x43, 0x00,
+  0x00, 0x74, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x97, 0x02, 0x00, 0x00, 0x54,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1d, 0x43, 0x97, 0x03, 0x00,
+  0x00, 0x44, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x18, 0x42, 0x96, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x97, 0x03, 0x00,
+  0x00, 0xa0, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00,
+  0x00, 0x90, 0x41, 0x97, 0x02, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xda, 0x42, 0x98, 0x02, 0x00, 0x00, 0xa0, 0x41, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x98, 0x41, 0xaa, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x96, 0x09, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0x53, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4c, 0x43, 0x00,
+  0x00, 0xf2, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x90, 0x0c, 0x00, 0x00, 0xf2,
+  0x42, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0xb4,
+  0x42, 0x8d, 0x0d, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0x5b, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x40, 0x43, 0x00,
+  0x00, 0x1e, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x1f, 0x43, 0x00,
+  0x00, 0x1e, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00,
+  0x00, 0x69, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x54, 0x43, 0x8d,
+  0x04, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x70, 0x41, 0x85, 0x02, 0x00,
+  0x00, 0xb0, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x54, 0x43, 0x8d,
+  0x04, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x85, 0x05, 0x00,
+  0x00, 0x86, 0x42, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x86, 0x42, 0x8a,
+  0x04, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xf2, 0x42, 0x83, 0x07, 0x00,
+  0x00, 0xa0, 0x41, 0x00, 0x00, 0x26, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x00,
+  0x00, 0x3e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x8b, 0x04, 0x00, 0x00, 0xc4,
+  0x42, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x65,
+  0x43, 0x00, 0x00, 0x18, 0x42, 0x81, 0x08, 0x00, 0x00, 0x1c, 0x42, 0x00,
+  0x00, 0xee, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00,
+  0x00, 0x4d, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x8c, 0x0c, 0x00, 0x00, 0xc2,
+  0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x08,
+  0x42, 0x8f, 0x08, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6f, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x00,
+  0x00, 0xb0, 0x41, 0x91, 0x06, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x57,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x92, 0x07, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0x91, 0x0a, 0x00, 0x00, 0x38,
+  0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0xda,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x38,
+  0x43, 0x00, 0x00, 0xc0, 0x40, 0x8f, 0x0b, 0x00, 0x00, 0x34, 0x42, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x0e, 0x43, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xd8, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x41, 0x8f, 0x04, 0x00, 0x00, 0x69,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x0e,
+  0x43, 0x00, 0x00, 0x00, 0x41, 0x81, 0x04, 0x00, 0x00, 0xa0, 0x40, 0x00,
+  0x00, 0x23, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x50, 0x41, 0x8f, 0x03, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0xe8, 0x41, 0x82, 0x04, 0x00,
+  0x00, 0xb0, 0x41, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x41, 0x8f, 0x02, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x83, 0x04, 0x00,
+  0x00, 0xd8, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x41, 0x8f, 0x03, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0xe0,
+  0x41, 0x81, 0x05, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x2b, 0x43, 0x00,
+  0x00, 0x80, 0x40, 0x8f, 0x0a, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x44,
+  0x42, 0x90, 0x09, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x48, 0x42, 0x92, 0x06, 0x00, 0x00, 0x4c,
+  0x42, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0xd6,
+  0x42, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00,
+  0x30, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00,
+  0x4e, 0x43, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00,
+  0xe2, 0x42, 0x00, 0x00, 0xe4, 0x42, 0x00, 0x00, 0x40, 0x41, 0x8e, 0x0d,
+  0x00, 0x00, 0x9e, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x8e, 0x0d, 0x00, 0x00,
+  0x5e, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00,
+  0x5c, 0x42, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00,
+  0x14, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00,
+  0x43, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x6f, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x8d, 0x01, 0x00, 0x00, 0x18, 0x42,
+  0x00, 0x00, 0x10, 0x41, 0x87, 0x03, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x01, 0x43, 0x95, 0x05,
+  0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x14, 0x42,
+  0x88, 0x01, 0x00, 0x00, 0xe4, 0x42, 0x00, 0x00, 0xd8, 0x41, 0x88, 0x06,
+  0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x4f, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x57, 0x43,
+  0x00, 0x00, 0xdc, 0x42, 0x89, 0x01, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00,
+  0x40, 0x40, 0x85, 0x08, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xaa, 0x42,
+  0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x76, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x28, 0x43,
+  0x00, 0x00, 0x04, 0x42, 0x90, 0x08, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00,
+  0x26, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00,
+  0xcc, 0x42, 0x00, 0x00, 0x5c, 0x42, 0x91, 0x06, 0x00, 0x00, 0x29, 0x43,
+  0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x6c, 0x42,
+  0x94, 0x07, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x93, 0x08,
+  0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0xca, 0x42,
+  0x93, 0x08, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00,
+  0x27, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00,
+  0xc8, 0x42, 0x95, 0x06, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x60, 0x42,
+  0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x00, 0x42, 0x96, 0x04, 0x00, 0x00,
+  0xe0, 0x41, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x97, 0x03, 0x00, 0x00, 0x64, 0x42,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x0c, 0x43,
+  0x8c, 0x01, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x26, 0x43, 0x87, 0x04,
+  0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x8c, 0x02, 0x00, 0x00,
+  0x61, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0xe0, 0x41, 0x84, 0x06,
+  0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x6a, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4c, 0x43,
+  0x00, 0x00, 0x70, 0x41, 0x8c, 0x0d, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00,
+  0x07, 0x43, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00,
+  0x45, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0xe0, 0x42, 0x8d, 0x0d, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x76, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x14, 0x42,
+  0x8e, 0x0a, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x3e, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x00, 0x00, 0xae, 0x42, 0xfa, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb3, 0x09, 0x00, 0x00, 0x30, 0x41, 0x00,
+  0x00, 0xf4, 0x42, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00,
+  0x00, 0x04, 0x43, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x40, 0x40, 0x8f,
+  0x0b, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xea,
+  0x42, 0x8e, 0x0c, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x49, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5b, 0x43, 0x00,
+  0x00, 0x1e, 0x43, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0xc0, 0x42, 0x00,
+  0x00, 0xc0, 0x42, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0x3e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x27, 0x43, 0x8d, 0x05, 0x00, 0x00, 0x04,
+  0x42, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6c,
+  0x43, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0x00, 0x41, 0x84, 0x02, 0x00,
+  0x00, 0x74, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x27, 0x43, 0x8d,
+  0x03, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x0b, 0x43, 0x86, 0x02, 0x00, 0x00, 0x13, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x0b, 0x43, 0x8c, 0x04, 0x00, 0x00, 0xe0,
+  0x41, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x22,
+  0x43, 0x00, 0x00, 0x40, 0x41, 0x85, 0x03, 0x00, 0x00, 0x18, 0x42, 0x00,
+  0x00, 0x6b, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x40, 0x41, 0x8c,
+  0x04, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x64, 0x42, 0x84, 0x03, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x20, 0x42, 0x8e, 0x0b, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0xe4,
+  0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+  0x40, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x96,
+  0x42, 0x00, 0x00, 0x20, 0x41, 0x8f, 0x0a, 0x00, 0x00, 0x1c, 0x42, 0x00,
+  0x00, 0x29, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x91, 0x0a, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xd0,
+  0x42, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x37,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x10, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x01, 0x43, 0x96,
+  0x04, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0x90, 0x41, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x01, 0x43, 0x95, 0x05, 0x00, 0x00, 0xa8,
+  0x41, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0xe0, 0x41, 0x94, 0x05, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x94,
+  0x05, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0xd0,
+  0x41, 0x94, 0x05, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00,
+  0x00, 0xb8, 0x41, 0x93, 0x06, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x37,
+  0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0xc0, 0x41, 0x94, 0x05, 0x00,
+  0x00, 0x1e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x58, 0x43, 0x00, 0x00, 0xc4, 0x42, 0x00, 0x00, 0x40, 0x40, 0x95,
+  0x03, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0xf0, 0x41, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc9, 0x03, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x66, 0x43, 0x00, 0x00, 0x30, 0x42, 0x96, 0x04, 0x00, 0x00, 0xbc, 0x42,
+  0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x67, 0x43,
+  0x00, 0x00, 0x54, 0x42, 0x94, 0x05, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00,
+  0x68, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x94, 0x06, 0x00, 0x00, 0x44, 0x42,
+  0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x98, 0x41,
+  0x93, 0x06, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x30, 0x43, 0x00, 0x00, 0x88, 0x41, 0x93, 0x06, 0x00, 0x00, 0x50, 0x42,
+  0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x50, 0x41,
+  0x93, 0x06, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x32, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x94, 0x05, 0x00, 0x00, 0xc8, 0x42,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x94, 0x05, 0x00, 0x00,
+  0xb4, 0x42, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0xc0, 0x41, 0x94, 0x05,
+  0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xd8, 0x42,
+  0x95, 0x04, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x95, 0x04,
+  0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x13, 0x43, 0x96, 0x04, 0x00, 0x00,
+  0x0c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x6d, 0x43, 0x00, 0x00, 0x74, 0x42, 0x83, 0x03, 0x00, 0x00, 0xb2, 0x42,
+  0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x00, 0x43,
+  0x8d, 0x0f, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00,
+  0x54, 0x42, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00,
+  0x64, 0x43, 0x00, 0x00, 0x58, 0x42, 0x8b, 0x0f, 0x00, 0x00, 0x19, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x50, 0x42, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0x08, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x70, 0x42,
+  0x8b, 0x0f, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00,
+  0x64, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x6d, 0x43, 0x00, 0x00, 0x50, 0x42, 0x8b, 0x0e, 0x00, 0x00, 0x78, 0x42,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x8c, 0x0d, 0x00, 0x00,
+  0x78, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00,
+  0x6b, 0x43, 0x00, 0x00, 0xa2, 0x42, 0x8d, 0x0b, 0x00, 0x00, 0x1c, 0x42,
+  0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x62, 0x43,
+  0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x90, 0x08, 0x00, 0x00,
+  0x0c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00,
+  0x9c, 0x42, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00,
+  0x9c, 0x42, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x60, 0x42, 0xff, 0xb2,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0x0d, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x8c, 0x0e, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x8d, 0x05, 0x00, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x83, 0x03, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x80, 0x42, 0x93, 0x05, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x94, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x94, 0x05, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x94, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x96, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x96, 0x06, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x95, 0x07, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x80, 0x42, 0x95, 0x06, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x97,
+  0x03, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x98, 0x02, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x98, 0x02, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x8b, 0x0e, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x8c, 0x0e, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8e,
+  0x0a, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x93, 0x05, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x09, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+  0x01, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00,
+  0x1c, 0x42, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0xa0, 0x40, 0x91, 0x0b,
+  0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x55, 0x43,
+  0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x1c, 0x42,
+  0x8d, 0x0e, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00,
+  0x73, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00,
+  0x19, 0x43, 0x8b, 0x10, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x00, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x1c, 0x42,
+  0x8a, 0x11, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00,
+  0xe0, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00,
+  0x10, 0x42, 0x88, 0x12, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x4a, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43,
+  0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x42,
+  0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x6a, 0x43,
+  0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x88, 0x04, 0x00, 0x00,
+  0x04, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x4d, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x86, 0x06, 0x00, 0x00, 0xe2, 0x42,
+  0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x87, 0x04, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x88, 0x05,
+  0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x87, 0x04, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x88, 0x05,
+  0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x87, 0x04, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe0, 0x42, 0x88, 0x05,
+  0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x87, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x24, 0x42, 0x88, 0x05,
+  0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x87, 0x03, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x31, 0x43, 0x89, 0x05, 0x00, 0x00, 0x40, 0x42,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x60, 0x43, 0x87, 0x03, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x31, 0x43, 0x89, 0x05, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x82, 0x42, 0x87, 0x03, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x31, 0x43, 0x89, 0x05,
+  0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0xb0, 0x41,
+  0x87, 0x04, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x85, 0x07,
+  0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x2e, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x10, 0x41, 0x88, 0x05, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0xd2, 0x42, 0x83, 0x07,
+  0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x89, 0x11, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00,
+  0x33, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00,
+  0x33, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xfc, 0x42, 0x00, 0x00, 0x68, 0x42, 0x89, 0x10,
+  0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x44, 0x43,
+  0x00, 0x00, 0xe0, 0x42, 0x00, 0x00, 0x40, 0x40, 0x8a, 0x0d, 0x00, 0x00,
+  0x0c, 0x42, 0x00, 0x00, 0x42, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00,
+  0x02, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x8e, 0x0a, 0x00, 0x00, 0x08, 0x42,
+  0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x05, 0x43,
+  0x00, 0x00, 0x5c, 0x42, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x04, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x96, 0x04,
+  0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x42, 0x43, 0x96, 0x05, 0x00, 0x00,
+  0x56, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0xbc, 0x42, 0x95, 0x05,
+  0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43,
+  0x95, 0x05, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x06, 0x43, 0x95, 0x05, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x06, 0x43, 0x95, 0x05, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0x95, 0x05, 0x00, 0x00, 0xa0, 0x41,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0x95, 0x05, 0x00, 0x00,
+  0xa0, 0x41, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0x95, 0x05,
+  0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43,
+  0x95, 0x05, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x07, 0x43, 0x95, 0x05, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x06, 0x43, 0x95, 0x05, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0x95, 0x06, 0x00, 0x00, 0xa0, 0x41,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00, 0x40, 0x41,
+  0x94, 0x07, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x93, 0x07,
+  0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x90, 0x41, 0x93, 0x07, 0x00, 0x00,
+  0xa0, 0x41, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x6d, 0x43, 0x00, 0x00, 0x88, 0x41, 0x93, 0x06, 0x00, 0x00, 0xa0, 0x41,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x54, 0x42,
+  0x94, 0x05, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x06, 0x43, 0x96, 0x04, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7b, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0xf8, 0x41,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x95, 0x08, 0x00,
+  0x00, 0x54, 0x42, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00,
+  0x00, 0x50, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00,
+  0x00, 0x51, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x90,
+  0x0a, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x39, 0x43, 0x8f, 0x0c, 0x00,
+  0x00, 0xc6, 0x42, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x7c, 0x42, 0x8d, 0x0d, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0xe8,
+  0x41, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x04,
+  0x43, 0x8d, 0x05, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0xb4, 0x42, 0x00,
+  0x00, 0xb0, 0x41, 0x82, 0x04, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x04,
+  0x43, 0x8d, 0x03, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x84, 0x04, 0x00, 0x00, 0x15,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x04, 0x43, 0x8d, 0x03, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x84,
+  0x04, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x8d, 0x03, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x04, 0x43, 0x83, 0x05, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x27,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0xf8, 0x41, 0x8d, 0x03, 0x00, 0x00, 0xd2, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x04, 0x43, 0x83,
+  0x04, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x8f, 0x01, 0x00,
+  0x00, 0xf8, 0x42, 0x00, 0x00, 0x54, 0x42, 0x83, 0x05, 0x00, 0x00, 0xb6,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x54, 0x42, 0x94, 0x05, 0x00,
+  0x00, 0x00, 0x42, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x08, 0x42, 0x94,
+  0x05, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x54,
+  0x42, 0x95, 0x04, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xce, 0x42, 0x95,
+  0x07, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x13,
+  0x43, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x64, 0x42, 0x82, 0x01, 0x00,
+  0x00, 0x10, 0x41, 0x00, 0x00, 0x0c, 0x42, 0x8e, 0x0f, 0x00, 0x00, 0x34,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x32,
+  0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x55,
+  0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0xb6,
+  0x42, 0x8b, 0x0f, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x8b, 0x0f, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x96,
+  0x42, 0x8c, 0x0d, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00,
+  0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00,
+  0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00,
+  0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00,
+  0x00, 0x6c, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x40, 0x42, 0xff,
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xae, 0x0a, 0x00,
+  0x00, 0xc0, 0x40, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0xc8, 0x41, 0x00,
+  0x00, 0xc8, 0x41, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x11, 0x43, 0x00,
+  0x00, 0x11, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00,
+  0x00, 0x82, 0x42, 0x00, 0x00, 0x98, 0x41, 0x8e, 0x0d, 0x00, 0x00, 0xb8,
+  0x41, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x65,
+  0x43, 0x00, 0x00, 0x5c, 0x42, 0x8b, 0x0f, 0x00, 0x00, 0x40, 0x40, 0x00,
+  0x00, 0xec, 0x42, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x34, 0x43, 0x8b,
+  0x0f, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x1d,
+  0x43, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x90,
+  0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0xb2,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x34, 0x43, 0x8b, 0x04, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x00,
+  0x00, 0x88, 0x41, 0x85, 0x04, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0,
+  0x42, 0x8b, 0x02, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x0f, 0x43, 0x86, 0x05, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x35,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x22,
+  0x43, 0x00, 0x00, 0x40, 0x41, 0x8b, 0x01, 0x00, 0x00, 0x10, 0x42, 0x00,
+  0x00, 0x00, 0x42, 0x87, 0x04, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x90,
+  0x42, 0x95, 0x05, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x00,
+  0x00, 0xe0, 0x40, 0x94, 0x05, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x80, 0x40, 0x95, 0x06, 0x00, 0x00, 0x27, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x20, 0x41, 0x94,
+  0x09, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x6f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0xd2,
+  0x42, 0x00, 0x00, 0x70, 0x41, 0x92, 0x0a, 0x00, 0x00, 0x38, 0x42, 0x00,
+  0x00, 0xcc, 0x42, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x00,
+  0x00, 0x00, 0x40, 0x92, 0x08, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0xca,
+  0x42, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xe6, 0x42, 0x95, 0x05, 0x00, 0x00, 0x50, 0x42, 0x00,
+  0x00, 0xf8, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x91, 0x09, 0x00, 0x00, 0x92,
+  0x42, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x92,
+  0x42, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x8e, 0x0c, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x42, 0x43, 0x00,
+  0x00, 0x4d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xe4, 0x42, 0x8e, 0x0c, 0x00, 0x00, 0x48,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x00,
+  0x40, 0x8e, 0x0a, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x0f, 0x43, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x0f, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x68, 0x42, 0x00,
+  0x00, 0xb8, 0x41, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x80, 0x40, 0xf6,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x9b, 0x03, 0x00, 0x00, 0x4c, 0x42, 0x00,
+  0x00, 0x74, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x61, 0x43, 0x8e,
+  0x03, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x10,
+  0x42, 0x00, 0x00, 0x80, 0x40, 0x84, 0x03, 0x00, 0x00, 0xe0, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x60, 0x43, 0x8e,
+  0x03, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xe8, 0x41, 0x83, 0x04, 0x00, 0x00, 0x88, 0x41, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x60, 0x43, 0x8d, 0x04, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x69,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe8,
+  0x41, 0x83, 0x04, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x07, 0x43, 0x8d,
+  0x04, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x98, 0x41, 0x83, 0x04, 0x00,
+  0x00, 0x9c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x8c, 0x04, 0x00, 0x00, 0x80,
+  0x41, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x24, 0x43, 0x84, 0x03, 0x00, 0x00, 0x9c, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x71, 0x43, 0x8d,
+  0x04, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x24, 0x43, 0x84, 0x03, 0x00,
+  0x00, 0x3e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x8d, 0x04, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xc6,
+  0x42, 0x83, 0x04, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x64, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x82,
+  0x00, 0x00, 0x00, 0x40, 0x41, 0x89, 0x04, 0x00, 0x00, 0x90, 0x41, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3c, 0x42, 0x83, 0x0a, 0x00, 0x00, 0x9e, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x10,
+  0x43, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x30,
+  0x41, 0x87, 0x13, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x16, 0x43, 0x00,
+  0x00, 0x70, 0x42, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x70, 0x42, 0x00,
+  0x00, 0x9e, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x88, 0x41, 0x87,
+  0x13, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x64,
+  0x43, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x80, 0x40, 0x87, 0x11, 0x00,
+  0x00, 0x40, 0x40, 0x00, 0x00, 0xfc, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00,
+  0x00, 0xa4, 0x42, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0xe0, 0x41, 0x8a,
+  0x0c, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0xe0,
+  0x42, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0xa6,
+  0x42, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0x5c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x17,
+  0x43, 0x00, 0x00, 0x80, 0x3f, 0x96, 0x03, 0x00, 0x00, 0x31, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x97,
+  0x03, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x0d, 0x43, 0x97, 0x03, 0x00, 0x00, 0x31, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x97,
+  0x04, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x80, 0x40, 0x96, 0x04, 0x00,
+  0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x96, 0x04, 0x00, 0x00, 0x98,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xd8, 0x42, 0x96, 0x04, 0x00, 0x00, 0x80, 0x40, 0x00,
+  0x00, 0x10, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xf8, 0x42, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xff, 0x94, 0x0e, 0x00,
+  0x00, 0x30, 0x41, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x09, 0x43, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0x84, 0x42, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x0b, 0x43, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x8c,
+  0x0e, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x34,
+  0x42, 0x8c, 0x0e, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00,
+  0x00, 0x50, 0x41, 0x8c, 0x0d, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x60,
+  0x42, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x50,
+  0x41, 0x8d, 0x03, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x96, 0x03, 0x00, 0x00, 0x4c,
+  0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x4f,
+  0x43, 0x97, 0x03, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x97, 0x08, 0x00, 0x00, 0xf8,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5b,
+  0x43, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0xf4,
+  0x42, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x64, 0x42, 0x91, 0x0b, 0x00,
+  0x00, 0x64, 0x42, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x74, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0x88, 0x41, 0x8f,
+  0x0c, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x40,
+  0x43, 0x00, 0x00, 0x30, 0x41, 0x8f, 0x0b, 0x00, 0x00, 0x08, 0x43, 0x00,
+  0x00, 0x7b, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x1d, 0x43, 0x00,
+  0x00, 0x00, 0x42, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x49, 0x43, 0x90, 0x01, 0x00, 0x00, 0xa8,
+  0x42, 0x00, 0x00, 0x28, 0x42, 0x83, 0x05, 0x00, 0x00, 0x10, 0x41, 0x00,
+  0x00, 0x2d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x96, 0x04, 0x00, 0x00, 0x08,
+  0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x12, 0x43, 0x97, 0x03, 0x00, 0x00, 0x38, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x66, 0x43, 0x97,
+  0x04, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x28, 0x42, 0x8b, 0x04, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x0a, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x30, 0x41, 0x84, 0x05, 0x00, 0x00, 0x70,
+  0x41, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x8b, 0x05, 0x00,
+  0x00, 0xc6, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x88, 0x41, 0x81,
+  0x06, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x5b,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x51, 0x43, 0x8c, 0x0e, 0x00, 0x00, 0x08, 0x42, 0x00,
+  0x00, 0x6a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00,
+  0x00, 0x38, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x00, 0x42, 0x8d, 0x0c, 0x00, 0x00, 0x0e,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0xc8,
+  0x41, 0x8e, 0x0a, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xb0, 0x41, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00,
+  0x00, 0x09, 0x43, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00, 0x80, 0x41, 0xdd,
+  0x00, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00,
+  0xec, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x96, 0x04, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x32, 0x43,
+  0x95, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00,
+  0x40, 0x42, 0x95, 0x04, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x48, 0x42,
+  0x95, 0x04, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x02, 0x43, 0x96, 0x04,
+  0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x00, 0x42, 0x95, 0x04, 0x00, 0x00,
+  0x84, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x04, 0x43, 0x96, 0x04, 0x00, 0x00, 0x38, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0xb8, 0x42, 0x96, 0x04, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00,
+  0x88, 0x41, 0x95, 0x04, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x57, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xfc, 0x42,
+  0x81, 0x07, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00,
+  0xe8, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00,
+  0xe8, 0x42, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x54, 0x42, 0x8c, 0x10,
+  0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x54, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43,
+  0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0xe0, 0x40, 0x8a, 0x11, 0x00, 0x00,
+  0xf0, 0x41, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x79, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00,
+  0x74, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0xe8, 0x41, 0x89, 0x09,
+  0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x02, 0x43,
+  0x00, 0x00, 0x7c, 0x42, 0x81, 0x05, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00,
+  0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x34, 0x42, 0x89, 0x07, 0x00, 0x00, 0x3c, 0x42,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x19, 0x43,
+  0x00, 0x00, 0x10, 0x41, 0x83, 0x05, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00,
+  0x6e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x43, 0x43, 0x00, 0x00, 0x10, 0x41, 0x89, 0x06, 0x00, 0x00, 0x3c, 0x42,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x8a, 0x42,
+  0x83, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x9e, 0x42, 0x8b, 0x0e, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x5e, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x07, 0x43, 0x8c, 0x0d, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x00, 0x00,
+  0x3c, 0x42, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00,
+  0x3c, 0x43, 0x8d, 0x0c, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x8e, 0x0b, 0x00, 0x00,
+  0x50, 0x41, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x48, 0x42, 0x90, 0x09,
+  0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0xb0, 0x41,
+  0x00, 0x00, 0xc0, 0x40, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xac, 0x04, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x56, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x96,
+  0x05, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x00,
+  0x42, 0x84, 0x03, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0xc8, 0x41, 0x00,
+  0x00, 0xc8, 0x41, 0x00, 0x00, 0x88, 0x41, 0x8c, 0x0f, 0x00, 0x00, 0xa6,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x40,
+  0x42, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0xd6,
+  0x42, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0xc4,
+  0x42, 0x8b, 0x0f, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x8b, 0x0f, 0x00, 0x00, 0x14,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1c,
+  0x43, 0x8b, 0x0f, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x55, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x42, 0x43, 0x00,
+  0x00, 0x34, 0x43, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x34, 0x43, 0x00,
+  0x00, 0xec, 0x42, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x70, 0x42, 0x00,
+  0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x8b, 0x04, 0x00, 0x00, 0x14,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x40, 0x42, 0x85, 0x04, 0x00, 0x00, 0x29, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x1c, 0x43, 0x8b, 0x04, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xbc,
+  0x42, 0x84, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x72, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xde, 0x42, 0x8b, 0x04, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x31,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xde,
+  0x42, 0x84, 0x05, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x10, 0x42, 0x8c, 0x03, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x21,
+  0x43, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x84, 0x05, 0x00,
+  0x00, 0xbe, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x98, 0x41, 0x94,
+  0x05, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xd4,
+  0x42, 0x95, 0x05, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x40, 0x42, 0x95, 0x05, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x40, 0x42, 0x95, 0x05, 0x00, 0x00, 0xc8, 0x41, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6f, 0x43, 0x00, 0x00, 0x1c, 0x42, 0x95, 0x04, 0x00, 0x00, 0x58,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x34, 0x43, 0x96, 0x04, 0x00, 0x00, 0x11, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x34, 0x43, 0x96, 0x04, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa6,
+  0x42, 0x95, 0x05, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x6e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x70, 0x42, 0x95, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xec, 0x42, 0x96, 0x04, 0x00, 0x00, 0xb0, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x43, 0x43, 0x00,
+  0x00, 0x40, 0x40, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x95, 0x0b, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00,
+  0x00, 0xf0, 0x41, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x04, 0x43, 0x00,
+  0x00, 0x04, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x00, 0x00, 0x00, 0x41, 0x8d,
+  0x0d, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x51,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x8c, 0x0e, 0x00,
+  0x00, 0xc8, 0x41, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x8b,
+  0x0f, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x6c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x1b, 0x43, 0x8b, 0x05, 0x00, 0x00, 0xf6, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x68, 0x43, 0x00, 0x00, 0x74, 0x42, 0x81, 0x07, 0x00, 0x00, 0x90,
+  0x42, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x1b, 0x43, 0x8a, 0x05, 0x00, 0x00, 0x98, 0x41, 0x00,
+  0x00, 0x66, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x98, 0x42, 0x83, 0x06, 0x00, 0x00, 0xe0,
+  0x40, 0x00, 0x00, 0xb4, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x58,
+  0x42, 0x8a, 0x05, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x2e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x11, 0x43, 0x83, 0x05, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x8c, 0x42, 0x8c, 0x05, 0x00, 0x00, 0x58, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x70, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x81, 0x06, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0xe0,
+  0x40, 0x8c, 0x0d, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x58, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x73, 0x43, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x26, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x88, 0x41, 0x8e,
+  0x0b, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x9a,
+  0x42, 0x90, 0x09, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x55, 0x43, 0x00,
+  0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x93, 0x08, 0x00, 0x00, 0xb0,
+  0x42, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x93, 0x08, 0x00,
+  0x00, 0xc2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x92,
+  0x09, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x64,
+  0x43, 0x00, 0x00, 0x00, 0x42, 0x91, 0x09, 0x00, 0x00, 0xc2, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x91,
+  0x0a, 0x00, 0x00, 0xc2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0xae,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x90, 0x0a, 0x00,
+  0x00, 0xc2, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x10, 0x42, 0x90, 0x0a, 0x00, 0x00, 0x60,
+  0x41, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x10, 0x42, 0x91, 0x09, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0x72, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0x80, 0x40, 0x92,
+  0x07, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0xce,
+  0x42, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x40, 0x40, 0xda, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0x07, 0x00, 0x00, 0x34, 0x42, 0x00,
+  0x00, 0x0d, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00,
+  0x00, 0x7c, 0x42, 0x82, 0x01, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x45,
+  0x43, 0x8d, 0x08, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x61, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xe2, 0x42, 0x82, 0x01, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x82,
+  0x42, 0x8d, 0x08, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xe2, 0x42, 0x91, 0x09, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4a,
+  0x43, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xe2, 0x42, 0x90, 0x0b, 0x00,
+  0x00, 0x40, 0x42, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x77, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0x50, 0x41, 0x8f,
+  0x03, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x44, 0x43, 0x82, 0x05, 0x00, 0x00, 0x98, 0x41, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x4e, 0x43, 0x00, 0x00, 0xe2, 0x42, 0x8e, 0x03, 0x00, 0x00, 0x45,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x82, 0x05, 0x00, 0x00, 0xa4, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x28, 0x43, 0x8e, 0x0f, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x61,
+  0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd0, 0x41, 0x00, 0x00, 0xfa, 0x42, 0x8b, 0x0f, 0x00,
+  0x00, 0x18, 0x42, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00,
+  0x00, 0xc8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x41, 0x00,
+  0x00, 0x45, 0x43, 0x8c, 0x0a, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x12,
+  0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x81, 0x01, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x44, 0x43, 0x8e,
+  0x08, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x60,
+  0x42, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x81, 0x01, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x44, 0x43, 0x92,
+  0x04, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x81, 0x01, 0x00,
+  0x00, 0xe8, 0x41, 0x00, 0x00, 0x44, 0x43, 0x92, 0x04, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x45, 0x43, 0x81, 0x01, 0x00, 0x00, 0xe8, 0x41, 0x00,
+  0x00, 0x38, 0x43, 0x92, 0x04, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x81, 0x01, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xe0, 0x41, 0x92,
+  0x04, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x64, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x96, 0x04, 0x00, 0x00, 0x64,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x45, 0x43, 0x96, 0x05, 0x00, 0x00, 0x30, 0x42, 0x00,
+  0x00, 0x70, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x50, 0x43, 0x00, 0x00, 0x50, 0x41, 0x96, 0x05, 0x00, 0x00, 0xa2,
+  0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x20, 0x41, 0x96, 0x04, 0x00,
+  0x00, 0xfa, 0x42, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xfe, 0x42, 0x00, 0x00, 0x40, 0x40, 0xbe, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xb5, 0x06, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0xec, 0x42, 0x00,
+  0x00, 0xec, 0x42, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0xec, 0x42, 0x00,
+  0x00, 0x68, 0x42, 0x00, 0x00, 0x34, 0x42, 0x8f, 0x0d, 0x00, 0x00, 0x2c,
+  0x42, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x71,
+  0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x67,
+  0x43, 0x00, 0x00, 0x44, 0x42, 0x8c, 0x0f, 0x00, 0x00, 0xc4, 0x42, 0x00,
+  0x00, 0x65, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x40, 0x42, 0x89,
+  0x11, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x10,
+  0x43, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0x1b,
+  0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x26,
+  0x43, 0x89, 0x08, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00,
+  0x00, 0x4c, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00,
+  0x00, 0x00, 0x41, 0x82, 0x06, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x87, 0x05, 0x00,
+  0x00, 0x15, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x24, 0x42, 0x87,
+  0x05, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf6,
+  0x42, 0x87, 0x04, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1b, 0x43, 0x89,
+  0x04, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x23, 0x43, 0x87, 0x04, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x42, 0x89, 0x04, 0x00, 0x00, 0x54,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x87, 0x04, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xc8, 0x41, 0x89, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x87, 0x04, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x60, 0x42, 0x87,
+  0x06, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x65,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x1b, 0x43, 0x87, 0x04, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x1b, 0x43, 0x87, 0x06, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x87, 0x05, 0x00,
+  0x00, 0x0d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x38, 0x42, 0x83,
+  0x08, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x08,
+  0x43, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x10,
+  0x42, 0x89, 0x0f, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0x38, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41, 0x00,
+  0x00, 0x92, 0x42, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0x45, 0x43, 0x8b, 0x0e, 0x00, 0x00, 0x24,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x23,
+  0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x02, 0x43, 0x8c, 0x0d, 0x00,
+  0x00, 0x34, 0x42, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00,
+  0x00, 0x4f, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x8f, 0x09, 0x00, 0x00, 0x15,
+  0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x00,
+  0x42, 0x92, 0x06, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0xdc, 0x42, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00,
+  0x00, 0xdc, 0x42, 0x00, 0x00, 0xaa, 0x42, 0xff, 0x97, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x96, 0x06, 0x00, 0x00, 0xaa, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x5b, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0xa8, 0x41, 0x93,
+  0x07, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x93, 0x07, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x93, 0x07, 0x00, 0x00, 0x2c,
+  0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0xfa, 0x42, 0x93, 0x07, 0x00, 0x00, 0x2c, 0x42, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0xfa, 0x42, 0x93, 0x07, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xfc,
+  0x42, 0x93, 0x08, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x26, 0x43, 0x00,
+  0x00, 0xe0, 0x41, 0x92, 0x08, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0xa6, 0x42, 0x92, 0x08, 0x00, 0x00, 0x2c, 0x42, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x25, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x92, 0x07, 0x00, 0x00, 0xe0,
+  0x40, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0xfa, 0x42, 0x93, 0x08, 0x00, 0x00, 0x10, 0x42, 0x00,
+  0x00, 0x60, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x12, 0x43, 0x00, 0x00, 0x60, 0x41, 0x93, 0x07, 0x00, 0x00, 0xaa,
+  0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0xa6, 0x42, 0x93, 0x07, 0x00, 0x00, 0xaa, 0x42, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0xa6, 0x42, 0x93, 0x07, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0xd8,
+  0x41, 0x93, 0x06, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x95, 0x06, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa6,
+  0x42, 0x94, 0x07, 0x00, 0x00, 0xfe, 0x42, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x60, 0x41, 0x93,
+  0x07, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x24, 0x42, 0x94, 0x06, 0x00,
+  0x00, 0x60, 0x42, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x24, 0x42, 0x95, 0x05, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xdc,
+  0x42, 0x00, 0x00, 0xe0, 0x40, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf6, 0x07, 0x00, 0x00, 0x9e, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00,
+  0x3f, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x9c, 0x42, 0x91, 0x0c,
+  0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x45, 0x43, 0x00, 0x00, 0x72, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x92, 0x42,
+  0x00, 0x00, 0x28, 0x42, 0x8e, 0x0e, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00,
+  0x35, 0x43, 0x00, 0x00, 0x90, 0x42, 0x8c, 0x0f, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x9c, 0x42,
+  0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x80, 0x3f,
+  0x8b, 0x04, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa4, 0x42, 0x83, 0x06,
+  0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0xd8, 0x42, 0x8b, 0x03, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00,
+  0x33, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x85, 0x05,
+  0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd8, 0x42,
+  0x94, 0x06, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x76, 0x43, 0x00, 0x00, 0xb8, 0x42, 0x93, 0x06, 0x00, 0x00, 0x7c, 0x42,
+  0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x57, 0x43,
+  0x93, 0x07, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x92, 0x08,
+  0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x2f, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x20, 0x41,
+  0x92, 0x07, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x92, 0x07,
+  0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x78, 0x42, 0x92, 0x07, 0x00, 0x00,
+  0x3c, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x93, 0x07, 0x00, 0x00, 0xda, 0x42,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x33, 0x43,
+  0x00, 0x00, 0x70, 0x41, 0x93, 0x09, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xc4, 0x42, 0x00, 0x00,
+  0x14, 0x42, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0xa0, 0x40, 0x90, 0x10,
+  0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x10, 0x43,
+  0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x10, 0x43,
+  0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x10, 0x43, 0x8a, 0x10, 0x00, 0x00,
+  0x80, 0x3f, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x8a, 0x10, 0x00, 0x00, 0x80, 0x3f,
+  0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x8b, 0x0f, 0x00, 0x00, 0xf8, 0x41, 0x00, 0x00,
+  0x43, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00,
+  0x59, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00,
+  0x57, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00,
+  0x71, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00,
+  0x77, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x67, 0x43, 0x95, 0x05,
+  0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x78, 0x42,
+  0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x38, 0x42,
+  0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x0f, 0x00,
+  0x00, 0x5e, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0x5f, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0x1b, 0x43, 0x00, 0x00, 0xe6, 0x42, 0x00, 0x00, 0xe6, 0x42, 0x00,
+  0x00, 0xe6, 0x42, 0x00, 0x00, 0xe6, 0x42, 0x00, 0x00, 0xf8, 0x42, 0x00,
+  0x00, 0x5f, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00,
+  0x00, 0x1c, 0x42, 0x8b, 0x0f, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x8b, 0x0f, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00,
+  0x00, 0x2d, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00,
+  0x00, 0x5f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x91, 0x09, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0xd8,
+  0x41, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x68,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x0c, 0x42, 0x92, 0x07, 0x00,
+  0x00, 0x18, 0x42, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x5c, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0xc0, 0x42, 0x91, 0x08, 0x00, 0x00, 0x80,
+  0x40, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x00, 0x42, 0x92, 0x08, 0x00,
+  0x00, 0x54, 0x42, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x75, 0x43, 0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x80, 0x40, 0x92,
+  0x0a, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x72,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x34,
+  0x43, 0x00, 0x00, 0x17, 0x43, 0x00, 0x00, 0x24, 0x42, 0x92, 0x09, 0x00,
+  0x00, 0x9e, 0x42, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00,
+  0x00, 0x6b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x71, 0x43, 0x00,
+  0x00, 0x94, 0x42, 0x94, 0x08, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xc8,
+  0x41, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x53,
+  0x43, 0x00, 0x00, 0x80, 0x41, 0x96, 0x05, 0x00, 0x00, 0x0c, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x8f, 0x02, 0x00, 0x00, 0x44,
+  0x42, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x7c, 0x42, 0x83, 0x04, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x56, 0x43, 0x8e, 0x0c, 0x00, 0x00, 0xa8,
+  0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x08,
+  0x43, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x39,
+  0x43, 0x8e, 0x0c, 0x00, 0x00, 0xe0, 0x41, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x50, 0x43, 0x00, 0x00, 0x96, 0x42, 0x8f, 0x0a, 0x00, 0x00, 0xba,
+  0x42, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0xb6,
+  0x42, 0x00, 0x00, 0x50, 0x41, 0x91, 0x07, 0x00, 0x00, 0x40, 0x40, 0x00,
+  0x00, 0x30, 0x42, 0x00, 0x00, 0xe4, 0x42, 0x00, 0x00, 0xe4, 0x42, 0x00,
+  0x00, 0xe4, 0x42, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0xa0, 0x40, 0x00,
+  0x00, 0x40, 0x40, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x91, 0x04, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0xec, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x84,
+  0x03, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x5c,
+  0x42, 0x00, 0x00, 0xa0, 0x40, 0x8d, 0x04, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x84, 0x03, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xee, 0x42, 0x8d, 0x04, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x28, 0x43, 0x83, 0x04, 0x00, 0x00, 0xaa,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x8d, 0x04, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x09, 0x43, 0x83, 0x04, 0x00, 0x00, 0x1d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x34,
+  0x42, 0x8d, 0x04, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x09, 0x43, 0x82,
+  0x05, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0xc8,
+  0x41, 0x8d, 0x04, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x00, 0x43, 0x82,
+  0x04, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x8e, 0x04, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x81, 0x05, 0x00, 0x00, 0x50,
+  0x41, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x8e, 0x04, 0x00,
+  0x00, 0x5c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x81, 0x05, 0x00, 0x00, 0x8c,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x8e, 0x04, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x81, 0x0b, 0x00, 0x00, 0x18,
+  0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0xba,
+  0x42, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x88, 0x04, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x81, 0x0c, 0x00, 0x00, 0xf4,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x66,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0xfc,
+  0x42, 0x87, 0x13, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x96, 0x42, 0x87,
+  0x13, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x4e,
+  0x43, 0x00, 0x00, 0xe0, 0x42, 0x00, 0x00, 0x00, 0x41, 0x87, 0x0f, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x37, 0x43, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x00,
+  0x00, 0x7c, 0x42, 0x8d, 0x09, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x34,
+  0x42, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x38, 0x42, 0x00, 0x00, 0x34,
+  0x42, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x8c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x96, 0x04, 0x00, 0x00, 0x8c,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x4f, 0x43, 0x96, 0x04, 0x00, 0x00, 0x8c, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x4e, 0x43, 0x96, 0x05, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x5b,
+  0x43, 0x00, 0x00, 0x98, 0x41, 0x96, 0x04, 0x00, 0x00, 0xe2, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x22, 0x43, 0x96, 0x04, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x3d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x40,
+  0x42, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0x03, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x87, 0x03, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8a, 0x10, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8a, 0x10, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x8a, 0x0f, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8b,
+  0x0b, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x8f, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x96, 0x0b, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8f,
+  0x0d, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x8d, 0x0f, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x8c, 0x0f, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8c, 0x01, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x43, 0x87, 0x04, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x96, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x95, 0x05, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x94, 0x06, 0x00, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x92,
+  0x07, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x8c, 0x0d, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x8d, 0x0c, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x8f, 0x09, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x91, 0x06, 0x00, 0x00, 0x80,
+  0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00,
+  0x50, 0x41, 0x00, 0x00, 0x1b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x94, 0x06,
+  0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xe0, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0xb8, 0x41, 0x94, 0x06, 0x00, 0x00, 0xe0, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x00, 0x41, 0x93, 0x06,
+  0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x22, 0x43,
+  0x00, 0x00, 0x30, 0x41, 0x93, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+  0x6b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x30, 0x41, 0x93, 0x06,
+  0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x27, 0x43,
+  0x00, 0x00, 0x10, 0x41, 0x94, 0x05, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x67, 0x43, 0x00, 0x00, 0x80, 0x40, 0x95, 0x04, 0x00, 0x00, 0x90, 0x42,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x23, 0x43, 0x95, 0x05, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+  0x1c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x66, 0x43, 0x00, 0x00, 0x28, 0x42, 0x95, 0x04, 0x00, 0x00, 0x08, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x01, 0x43, 0x82, 0x07, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00,
+  0x70, 0x42, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00,
+  0x31, 0x43, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00,
+  0x50, 0x41, 0x8a, 0x11, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x6b, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x9c, 0x42,
+  0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x28, 0x43,
+  0x00, 0x00, 0x3c, 0x42, 0x88, 0x12, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
+  0x3f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00,
+  0x25, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x18, 0x43, 0x88, 0x12,
+  0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x4e, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x18, 0x43, 0x88, 0x12, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+  0x4a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x50, 0x43, 0x00, 0x00, 0xa0, 0x42, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+  0x9e, 0x42, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0xb6, 0x42, 0x89, 0x10,
+  0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0xdc, 0x42,
+  0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x44, 0x43,
+  0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x09, 0x43,
+  0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1c, 0x43, 0x8a, 0x05, 0x00, 0x00,
+  0xe8, 0x41, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x82, 0x07,
+  0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x98, 0x41, 0x8b, 0x0e, 0x00, 0x00,
+  0x2b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00,
+  0x84, 0x42, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x76, 0x43, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0xa0, 0x41, 0x8c, 0x0c,
+  0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x53, 0x43,
+  0x00, 0x00, 0xc0, 0x42, 0x8e, 0x0b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x17, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00,
+  0xca, 0x42, 0x00, 0x00, 0x88, 0x41, 0x90, 0x08, 0x00, 0x00, 0xa0, 0x40,
+  0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2a, 0x43,
+  0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x30, 0x41, 0xff, 0x95, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x12, 0x00, 0x00, 0x06, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x05, 0x43, 0x00,
+  0x00, 0x05, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00,
+  0x00, 0x05, 0x43, 0x00, 0x00, 0xe8, 0x41, 0x00, 0x00, 0x00, 0x40, 0x88,
+  0x12, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2b,
+  0x43, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xba, 0x42, 0x88, 0x13, 0x00, 0x00, 0x6c, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x54, 0x43, 0x00,
+  0x00, 0xe0, 0x40, 0x87, 0x13, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x35,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0xd8,
+  0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x30,
+  0x41, 0x88, 0x0a, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x66, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x49, 0x43, 0x00,
+  0x00, 0x90, 0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0x36, 0x43, 0x00,
+  0x00, 0x9a, 0x42, 0x00, 0x00, 0x90, 0x42, 0x00, 0x00, 0xf8, 0x41, 0x81,
+  0x05, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x30,
+  0x41, 0x89, 0x03, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0x34, 0x43, 0x00,
+  0x00, 0x17, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x86, 0x06, 0x00, 0x00, 0x18,
+  0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x40,
+  0x40, 0x94, 0x05, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x38, 0x42, 0x95, 0x05, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xc0, 0x41, 0x95, 0x05, 0x00, 0x00, 0x29, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x25, 0x43, 0x00, 0x00, 0x40, 0x40, 0x94, 0x05, 0x00, 0x00, 0x90,
+  0x41, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xc6, 0x42, 0x95, 0x05, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x08, 0x42, 0x94,
+  0x05, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x28,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x17, 0x43, 0x95, 0x05, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x40, 0x42, 0x95, 0x05, 0x00, 0x00, 0xe0, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x40, 0x42, 0x94, 0x06, 0x00, 0x00, 0x80,
+  0x40, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0c,
+  0x43, 0x94, 0x06, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x28, 0x43, 0x94, 0x06, 0x00, 0x00, 0x50,
+  0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x82,
+  0x42, 0x94, 0x06, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x4f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x07, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x95, 0x04, 0x00, 0x00, 0xf0,
+  0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x09,
+  0x43, 0x00, 0x00, 0x40, 0x40, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x96, 0x0c, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x40, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xea, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00,
+  0x00, 0xb0, 0x42, 0x00, 0x00, 0x00, 0x40, 0x8b, 0x0f, 0x00, 0x00, 0xa0,
+  0x40, 0x00, 0x00, 0x58, 0x42, 0x00, 0x00, 0x11, 0x43, 0x00, 0x00, 0x69,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0xd6,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xba,
+  0x42, 0x8a, 0x11, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x08, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x70, 0x42, 0x00,
+  0x00, 0x31, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00,
+  0x00, 0x00, 0x40, 0x88, 0x12, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x5e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x65,
+  0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xc4,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x80, 0x40, 0x87, 0x12, 0x00,
+  0x00, 0x10, 0x41, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x41, 0x43, 0x00,
+  0x00, 0x06, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00,
+  0x00, 0x9e, 0x42, 0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x68, 0x42, 0x88, 0x07, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x10,
+  0x41, 0x81, 0x08, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00,
+  0x00, 0xc0, 0x40, 0x88, 0x05, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xf6, 0x42, 0x81, 0x08, 0x00, 0x00, 0x9c, 0x42, 0x00,
+  0x00, 0xaa, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3c, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x8a, 0x0f, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x10,
+  0x41, 0x8c, 0x0c, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x54, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x28, 0x43, 0x00, 0x00, 0x98, 0x41, 0x8f, 0x0a, 0x00, 0x00, 0xc8,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0xf2,
+  0x42, 0x00, 0x00, 0xa0, 0x40, 0x91, 0x08, 0x00, 0x00, 0x2a, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x3a, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x91, 0x0a, 0x00, 0x00, 0xa8,
+  0x41, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x34,
+  0x43, 0x00, 0x00, 0x20, 0x41, 0x90, 0x0a, 0x00, 0x00, 0x14, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xe4, 0x42, 0x90, 0x0b, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44,
+  0x43, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x42, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x71,
+  0x43, 0x00, 0x00, 0x09, 0x43, 0x8f, 0x0c, 0x00, 0x00, 0x30, 0x41, 0x00,
+  0x00, 0x41, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x65, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xfe, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x0a, 0x43, 0x8f,
+  0x0c, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x54,
+  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x52,
+  0x43, 0x00, 0x00, 0x90, 0x41, 0x8e, 0x0c, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0x1a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00,
+  0x00, 0x2e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x70, 0x42, 0x8f,
+  0x0b, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x14,
+  0x42, 0x90, 0x09, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x0c, 0x43, 0x92, 0x08, 0x00, 0x00, 0x80,
+  0x40, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x78,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x32,
+  0x43, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x80, 0x40, 0xdb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x98, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x80, 0x42, 0x93, 0x07, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x92, 0x09, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8f, 0x0a, 0x00, 0x00, 0x80,
+  0x42, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x90, 0x05, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x82, 0x01, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x90, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x85, 0x02, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x8c, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x80, 0x42, 0x85, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x8b, 0x03, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x86, 0x04, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x8b, 0x02, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x85, 0x06, 0x00, 0x00, 0x80,
+  0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x8a, 0x10, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8a,
+  0x10, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8b, 0x0f, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x8c, 0x0e, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x90, 0x00, 0x00, 0x00, 0x80, 0x42, 0x84,
+  0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x96, 0x04, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x96, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x96, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x97, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x97,
+  0x02, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f,
+  0x43, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x07, 0x00,
+  0x00, 0x30, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0xd8, 0x42, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x08, 0x42, 0x00,
+  0x00, 0xc0, 0x41, 0x00, 0x00, 0x10, 0x41, 0x8f, 0x0c, 0x00, 0x00, 0xa0,
+  0x40, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x21,
+  0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x42, 0x43, 0x00, 0x00, 0x82,
+  0x42, 0x8e, 0x0d, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x82, 0x42, 0x8c,
+  0x0f, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6c,
+  0x43, 0x00, 0x00, 0x98, 0x41, 0x8a, 0x10, 0x00, 0x00, 0xaa, 0x42, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x73, 0x43, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00, 0xb0, 0x41, 0x00,
+  0x00, 0x80, 0x40, 0x00, 0x00, 0xa8, 0x41, 0x00, 0x00, 0x49, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x96, 0x42, 0x89, 0x08, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3e,
+  0x43, 0x00, 0x00, 0x54, 0x42, 0x83, 0x04, 0x00, 0x00, 0x30, 0x41, 0x00,
+  0x00, 0x4b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x89, 0x07, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x19,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x09,
+  0x43, 0x85, 0x03, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x88, 0x08, 0x00, 0x00, 0x08,
+  0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+  0x42, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x85, 0x03, 0x00,
+  0x00, 0x21, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x88, 0x04, 0x00, 0x00, 0x3c, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xe8,
+  0x42, 0x88, 0x04, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x42, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x1d, 0x43, 0x88,
+  0x04, 0x00, 0x00, 0xc6, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x30, 0x41, 0x88, 0x04, 0x00,
+  0x00, 0x35, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x87, 0x04, 0x00, 0x00, 0x40,
+  0x40, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x34, 0x43, 0x87, 0x06, 0x00, 0x00, 0x10, 0x41, 0x00,
+  0x00, 0x35, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x30, 0x41, 0x87,
+  0x04, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x86, 0x06, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0x14, 0x42, 0x88, 0x04, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x80,
+  0x41, 0x85, 0x06, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x2c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x17, 0x43, 0x89, 0x03, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x20,
+  0x43, 0x85, 0x07, 0x00, 0x00, 0x78, 0x42, 0x00, 0x00, 0x57, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x50, 0x41, 0x89,
+  0x03, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x20, 0x43, 0x84, 0x07, 0x00, 0x00, 0x1e, 0x43, 0x00,
+  0x00, 0x73, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x96, 0x42, 0x00,
+  0x00, 0x00, 0x41, 0x8a, 0x0e, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x08,
+  0x42, 0x00, 0x00, 0xae, 0x42, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x2a,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x07,
+  0x43, 0x00, 0x00, 0x30, 0x41, 0x8c, 0x0c, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x8e,
+  0x0a, 0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x7c, 0x42, 0x91, 0x08, 0x00,
+  0x00, 0xce, 0x42, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x80, 0x40, 0x93,
+  0x03, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0xb0,
+  0x41, 0x00, 0x00, 0xa8, 0x41, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x98, 0x04, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1f, 0x43, 0x96,
+  0x05, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x46, 0x43, 0x00, 0x00, 0x88,
+  0x41, 0x94, 0x06, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x71, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x1c, 0x42, 0x94, 0x06, 0x00, 0x00, 0xa0,
+  0x40, 0x00, 0x00, 0x23, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x2d, 0x43, 0x00, 0x00, 0xc0,
+  0x40, 0x94, 0x05, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x66, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x1e, 0x43, 0x95, 0x05, 0x00, 0x00, 0xd8, 0x41, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x70, 0x42, 0x95, 0x05, 0x00, 0x00, 0xd8, 0x41, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x95, 0x05, 0x00, 0x00, 0x24,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0x20, 0x41, 0x95, 0x04, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43, 0x96, 0x04, 0x00, 0x00, 0x20,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x11, 0x43, 0x96, 0x04, 0x00, 0x00, 0x21, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x12, 0x43, 0x96, 0x04, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x11,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43, 0x95,
+  0x05, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x11,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x11, 0x43, 0x95, 0x05, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x68,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x11, 0x43, 0x96, 0x04, 0x00, 0x00, 0x20, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x11, 0x43, 0x96, 0x05, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x55,
+  0x43, 0x00, 0x00, 0x88, 0x41, 0x95, 0x05, 0x00, 0x00, 0xa6, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x76, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x95, 0x04, 0x00, 0x00, 0x50,
+  0x41, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x96, 0x42, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf7, 0x08, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00,
+  0xc8, 0x41, 0x91, 0x0a, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x7a, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x40, 0x41,
+  0x90, 0x0c, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00,
+  0x1a, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00,
+  0x54, 0x42, 0x00, 0x00, 0x0c, 0x42, 0x8f, 0x02, 0x00, 0x00, 0xc0, 0x40,
+  0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x81, 0x07, 0x00, 0x00,
+  0x80, 0x40, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00,
+  0x46, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x95, 0x05, 0x00, 0x00, 0x82, 0x42,
+  0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x95, 0x05, 0x00, 0x00,
+  0x4c, 0x42, 0x00, 0x00, 0x4c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x25, 0x43, 0x94, 0x06,
+  0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x20, 0x43, 0x93, 0x07, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00,
+  0x63, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00,
+  0xb0, 0x41, 0x92, 0x07, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x33, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0xb8, 0x41,
+  0x93, 0x06, 0x00, 0x00, 0xba, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00,
+  0x50, 0x42, 0x00, 0x00, 0x00, 0x40, 0x93, 0x05, 0x00, 0x00, 0xd0, 0x41,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x08, 0x42, 0x95, 0x04, 0x00, 0x00,
+  0x17, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xa4, 0x42, 0x96, 0x03, 0x00, 0x00, 0x68, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x52, 0x43,
+  0x96, 0x04, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x95, 0x05,
+  0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x04, 0x42,
+  0x95, 0x0c, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0xdc, 0x42, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00,
+  0xb2, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00,
+  0xb2, 0x42, 0x00, 0x00, 0x3c, 0x42, 0x8d, 0x0d, 0x00, 0x00, 0xd0, 0x41,
+  0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x34, 0x43, 0x8d, 0x0d, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00,
+  0x74, 0x42, 0x8d, 0x0c, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x70, 0x43,
+  0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x31, 0x43,
+  0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x30, 0x43,
+  0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x2c, 0x42, 0x8e, 0x04, 0x00, 0x00,
+  0xd8, 0x41, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x48, 0x43, 0x00, 0x00, 0x8c, 0x42, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf3, 0x0d, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00,
+  0x68, 0x42, 0x00, 0x00, 0xa6, 0x42, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00,
+  0xe0, 0x41, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00,
+  0xf0, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x80, 0x3f, 0x8c, 0x0e,
+  0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xd0, 0x42,
+  0x8c, 0x0f, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00,
+  0x6b, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x27, 0x43, 0x00, 0x00, 0x40, 0x40, 0x8b, 0x05, 0x00, 0x00, 0x40, 0x40,
+  0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0xe4, 0x42, 0x00, 0x00, 0x64, 0x43,
+  0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0xb4, 0x42, 0x83, 0x05, 0x00, 0x00,
+  0xf0, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x95, 0x05,
+  0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf0, 0x41,
+  0x95, 0x05, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0xf0, 0x41, 0x94, 0x06, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x4b, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x30, 0x41, 0x93, 0x06, 0x00, 0x00,
+  0x1c, 0x42, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x20, 0x43, 0x92, 0x08, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xa2, 0x42,
+  0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x92, 0x42, 0x92, 0x0a, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00,
+  0xc0, 0x40, 0x90, 0x0b, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x12, 0x43,
+  0x00, 0x00, 0x1c, 0x42, 0x8f, 0x0c, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00,
+  0x1a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00, 0x00, 0x80, 0x40, 0x8f, 0x0b,
+  0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x2c, 0x43,
+  0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x2c, 0x43,
+  0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xe0, 0x42,
+  0x95, 0x06, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x35, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x6a, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x95, 0x05, 0x00, 0x00, 0x0b, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x94, 0x06, 0x00, 0x00,
+  0x0c, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00,
+  0x80, 0x3f, 0x8a, 0x0f, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x35, 0x43,
+  0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x66, 0x43,
+  0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0xd4, 0x42,
+  0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x59, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x98, 0x41, 0x8b, 0x0e, 0x00, 0x00,
+  0xc8, 0x41, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x98, 0x41, 0x8c, 0x0d,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x41, 0x43,
+  0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xf0, 0x41, 0x8f, 0x0b, 0x00, 0x00,
+  0x40, 0x40, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00,
+  0x1c, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00,
+  0x25, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x22, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x80, 0x3f, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x99, 0x04, 0x00, 0x00, 0x30, 0x41, 0x00,
+  0x00, 0x61, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00,
+  0x00, 0xb0, 0x42, 0x96, 0x04, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x19,
+  0x43, 0x91, 0x00, 0x00, 0x00, 0x30, 0x42, 0x83, 0x04, 0x00, 0x00, 0x9c,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x19, 0x43, 0x90, 0x0a, 0x00, 0x00, 0xc0, 0x42, 0x00,
+  0x00, 0x77, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00,
+  0x00, 0xa8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x42, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x19, 0x43, 0x90, 0x0a, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa8,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x75,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x19,
+  0x43, 0x8f, 0x05, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5d, 0x43, 0x00,
+  0x00, 0x60, 0x41, 0x81, 0x03, 0x00, 0x00, 0x5c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x19, 0x43, 0x8e, 0x05, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0xdc, 0x42, 0x81,
+  0x04, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x14, 0x43, 0x8e, 0x04, 0x00,
+  0x00, 0x08, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x82, 0x04, 0x00, 0x00, 0x3b,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x30, 0x42, 0x8e, 0x04, 0x00, 0x00, 0x08, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xe8, 0x42, 0x82, 0x0a, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x94,
+  0x42, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x3b,
+  0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x28, 0x43, 0x00, 0x00, 0x58,
+  0x42, 0x88, 0x04, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x81,
+  0x0b, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0xc6,
+  0x42, 0x89, 0x11, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x65, 0x43, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x0f, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x76, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5c, 0x43, 0x00,
+  0x00, 0x64, 0x42, 0x89, 0x0f, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x82,
+  0x42, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x92, 0x42, 0x8b, 0x0c, 0x00,
+  0x00, 0x70, 0x42, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xfe, 0x42, 0x00,
+  0x00, 0x00, 0x40, 0x8f, 0x0a, 0x00, 0x00, 0x50, 0x42, 0x00, 0x00, 0x62,
+  0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x31,
+  0x43, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x20,
+  0x42, 0x95, 0x04, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x96,
+  0x04, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0a, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x97, 0x04, 0x00, 0x00, 0x28,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x63,
+  0x43, 0x00, 0x00, 0x38, 0x42, 0x96, 0x05, 0x00, 0x00, 0x9c, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x63, 0x43, 0x00, 0x00, 0x00, 0x41, 0x95, 0x05, 0x00, 0x00, 0x20,
+  0x41, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4c,
+  0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0xc0, 0x40, 0xdb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x91, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00,
+  0x00, 0x05, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x22, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x56, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00,
+  0x00, 0x90, 0x41, 0x8a, 0x11, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x35,
+  0x43, 0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1a,
+  0x43, 0x00, 0x00, 0x00, 0x40, 0x89, 0x11, 0x00, 0x00, 0x58, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x30, 0x41, 0x89, 0x11, 0x00, 0x00, 0x1d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x4d,
+  0x43, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x53,
+  0x43, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00, 0x80, 0x40, 0x89, 0x0b, 0x00,
+  0x00, 0x1d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x41, 0x43, 0x00,
+  0x00, 0x41, 0x43, 0x00, 0x00, 0x41, 0x43, 0x00, 0x00, 0x41, 0x43, 0x00,
+  0x00, 0x41, 0x43, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x68, 0x42, 0x81,
+  0x01, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x20, 0x41, 0x8a, 0x05, 0x00,
+  0x00, 0xe0, 0x40, 0x00, 0x00, 0x39, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x98, 0x42, 0x95,
+  0x05, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00, 0x10,
+  0x41, 0x82, 0x03, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0x34, 0x42, 0x00,
+  0x00, 0xaa, 0x42, 0x00, 0x00, 0xe8, 0x41, 0x8d, 0x10, 0x00, 0x00, 0xa0,
+  0x40, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0xc4,
+  0x42, 0x00, 0x00, 0xc4, 0x42, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x5a,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0xfc,
+  0x42, 0x00, 0x00, 0x98, 0x41, 0x8a, 0x10, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xc8, 0x42, 0x8a, 0x12, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a,
+  0x43, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x40, 0x41, 0x88, 0x09, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00,
+  0x00, 0xf4, 0x42, 0x82, 0x05, 0x00, 0x00, 0xa4, 0x42, 0x00, 0x00, 0x59,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0xc0, 0x41, 0x88, 0x06, 0x00, 0x00, 0x50, 0x41, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x18, 0x43, 0x86,
+  0x04, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xba, 0x42, 0x88, 0x05, 0x00,
+  0x00, 0xa0, 0x40, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0x5e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0xc2, 0x42, 0x87,
+  0x04, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x10, 0x43, 0x8a, 0x02, 0x00,
+  0x00, 0x50, 0x41, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x80, 0x42, 0x88,
+  0x04, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x80, 0x42, 0x95, 0x05, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x38, 0x43, 0x00, 0x00, 0xe0, 0x40, 0x8c,
+  0x05, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x2b,
+  0x43, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x92, 0x42, 0x00, 0x00, 0x80,
+  0x40, 0x81, 0x05, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x6a, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x1c, 0x43, 0x8c, 0x0e, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x50, 0x43, 0x00, 0x00, 0x4f,
+  0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x68, 0x42, 0x8c, 0x0e, 0x00, 0x00, 0xc0, 0x41, 0x00,
+  0x00, 0x82, 0x42, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0xb0, 0x41, 0x8e, 0x0b, 0x00, 0x00, 0x40,
+  0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x8c, 0x42, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x42, 0x92, 0x08, 0x00,
+  0x00, 0x20, 0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x44, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x26, 0x43, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x40, 0x40, 0xda,
+  0x00, 0x00, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00,
+  0x06, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00,
+  0x64, 0x43, 0x00, 0x00, 0x20, 0x42, 0x94, 0x06, 0x00, 0x00, 0x50, 0x41,
+  0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x31, 0x43,
+  0x94, 0x06, 0x00, 0x00, 0x2a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x72, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x93, 0x06, 0x00, 0x00, 0xa8, 0x41,
+  0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x48, 0x42,
+  0x93, 0x06, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x76, 0x43, 0x00, 0x00, 0x78, 0x42, 0x94, 0x05, 0x00, 0x00, 0x58, 0x42,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x9e, 0x42, 0x95, 0x04, 0x00, 0x00,
+  0x64, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x76, 0x43, 0x95, 0x05, 0x00, 0x00, 0x80, 0x40,
+  0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x80, 0x42, 0x95, 0x05, 0x00, 0x00,
+  0x60, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x80, 0x40, 0x95, 0x04,
+  0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x13, 0x43, 0x96, 0x10, 0x00, 0x00,
+  0x1a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00,
+  0xb2, 0x42, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00,
+  0x9c, 0x42, 0x00, 0x00, 0xf4, 0x42, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00,
+  0xac, 0x42, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00,
+  0x9c, 0x42, 0x00, 0x00, 0x80, 0x41, 0x89, 0x12, 0x00, 0x00, 0xe0, 0x40,
+  0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0xf0, 0x41,
+  0x88, 0x13, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x00, 0x41, 0x87, 0x13,
+  0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x27, 0x43,
+  0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x48, 0x42,
+  0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x4d, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x88, 0x41, 0x87, 0x06, 0x00, 0x00,
+  0x80, 0x41, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x01, 0x43, 0x84, 0x07, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x24, 0x42,
+  0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x70, 0x41,
+  0x88, 0x05, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x01, 0x43, 0x82, 0x08, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0x40, 0x42,
+  0x00, 0x00, 0x43, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x98, 0x42, 0x89, 0x11, 0x00, 0x00, 0xfa, 0x42, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00,
+  0x84, 0x42, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00,
+  0xbe, 0x42, 0x00, 0x00, 0x20, 0x41, 0x89, 0x0f, 0x00, 0x00, 0x00, 0x41,
+  0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x90, 0x42,
+  0x8c, 0x0d, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00,
+  0x19, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x4a, 0x43, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x40, 0x41, 0x90, 0x08,
+  0x00, 0x00, 0xe8, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x1a, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x00, 0x00, 0x10, 0x41,
+  0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc5, 0x05, 0x00,
+  0x00, 0x68, 0x42, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x5b, 0x43, 0x00, 0x00, 0x00, 0x42, 0x86,
+  0x04, 0x00, 0x00, 0xce, 0x42, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0xf2,
+  0x42, 0x00, 0x00, 0xf2, 0x42, 0x00, 0x00, 0xda, 0x42, 0x89, 0x08, 0x00,
+  0x00, 0x8c, 0x42, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00,
+  0x00, 0x15, 0x43, 0x00, 0x00, 0xd8, 0x42, 0x00, 0x00, 0xcc, 0x42, 0x81,
+  0x07, 0x00, 0x00, 0xce, 0x42, 0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7b,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xca, 0x42, 0x89, 0x11, 0x00,
+  0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x64, 0x43, 0x00,
+  0x00, 0x1e, 0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x62, 0x43, 0x89,
+  0x11, 0x00, 0x00, 0xbc, 0x42, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x70,
+  0x43, 0x8a, 0x10, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0xbe, 0x42, 0x00,
+  0x00, 0x86, 0x42, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0x84, 0x42, 0x00,
+  0x00, 0x54, 0x42, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x70, 0x43, 0x8a,
+  0x03, 0x00, 0x00, 0xda, 0x42, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x84, 0x42, 0x82, 0x00, 0x00, 0x00, 0x0c, 0x42, 0x82,
+  0x05, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x53,
+  0x43, 0x8b, 0x02, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x55, 0x43, 0x00,
+  0x00, 0x60, 0x42, 0x86, 0x05, 0x00, 0x00, 0xa2, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xd6, 0x42, 0x95, 0x05, 0x00, 0x00, 0x25, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x6c, 0x43, 0x00, 0x00, 0x1c, 0x42, 0x95, 0x04, 0x00, 0x00, 0x56,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x62, 0x43, 0x96, 0x04, 0x00, 0x00, 0x56, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x62, 0x43, 0x96, 0x04, 0x00, 0x00, 0x57, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x64,
+  0x43, 0x95, 0x05, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x2a, 0x43, 0x95, 0x05, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xba, 0x42, 0x95, 0x05, 0x00, 0x00, 0x64, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x70, 0x43, 0x00, 0x00, 0x80, 0x42, 0x95, 0x04, 0x00, 0x00, 0x64,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x31, 0x43, 0x95, 0x05, 0x00, 0x00, 0xa0, 0x42, 0x00,
+  0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xa0, 0x42, 0x95, 0x05, 0x00, 0x00, 0xd8,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa0, 0x42, 0x95, 0x05, 0x00,
+  0x00, 0xd8, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x8e, 0x42, 0x95,
+  0x04, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x40, 0x43, 0x97, 0x03, 0x00,
+  0x00, 0xd8, 0x42, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00,
+  0x00, 0xf8, 0x41, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xff, 0x94, 0x0b, 0x00,
+  0x00, 0x80, 0x3f, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xf8, 0x41, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x03, 0x43, 0x00,
+  0x00, 0x03, 0x43, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x48, 0x42, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x9a, 0x42, 0x8d,
+  0x0d, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0xdc,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x8c, 0x0d, 0x00,
+  0x00, 0x30, 0x41, 0x00, 0x00, 0xd0, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x11, 0x43, 0x8d, 0x0d, 0x00, 0x00, 0x0f,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x75,
+  0x43, 0x00, 0x00, 0xe0, 0x41, 0x8d, 0x0c, 0x00, 0x00, 0x0f, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0x09, 0x43, 0x00, 0x00, 0xe8, 0x41, 0x00,
+  0x00, 0x00, 0x41, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xaa, 0x42, 0x8e,
+  0x04, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x53, 0x43, 0x81, 0x05, 0x00,
+  0x00, 0x7c, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x60, 0x41, 0x8e,
+  0x0b, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x10,
+  0x43, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x7c, 0x42, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x27,
+  0x43, 0x90, 0x0a, 0x00, 0x00, 0x82, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x2a, 0x43, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa4, 0x42, 0x90,
+  0x0a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xc0, 0x42, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x91, 0x09, 0x00,
+  0x00, 0x10, 0x41, 0x00, 0x00, 0x13, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x94, 0x42, 0x93, 0x08, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x42,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x69,
+  0x43, 0x00, 0x00, 0x78, 0x42, 0x92, 0x09, 0x00, 0x00, 0x0c, 0x42, 0x00,
+  0x00, 0x6d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x74, 0x42, 0x91,
+  0x0a, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x57,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x70, 0x42, 0x90, 0x0b, 0x00,
+  0x00, 0x30, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x44, 0x42, 0x00,
+  0x00, 0xde, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x70, 0x41, 0x8f,
+  0x0b, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa0, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x2c, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x90,
+  0x41, 0x8f, 0x0b, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x36,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x5a,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0xf0, 0x41, 0x90, 0x0a, 0x00, 0x00, 0x14, 0x42, 0x00,
+  0x00, 0x5e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x90, 0x41, 0x91, 0x09, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x8e,
+  0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x19, 0x43, 0x00, 0x00, 0x80, 0x3f, 0x92, 0x07, 0x00,
+  0x00, 0x00, 0x40, 0x00, 0x00, 0x1c, 0x42, 0x00, 0x00, 0x02, 0x43, 0x00,
+  0x00, 0x67, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x13, 0x43, 0x00,
+  0x00, 0x02, 0x43, 0x00, 0x00, 0x70, 0x41, 0xda, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xb2, 0x07, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe8, 0x42, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xb4, 0x42, 0x00, 0x00, 0xd0, 0x41, 0x92,
+  0x08, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x45,
+  0x43, 0x90, 0x0a, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x3a, 0x43, 0x00,
+  0x00, 0x23, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x51, 0x43, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x30, 0x42, 0x00,
+  0x00, 0x06, 0x43, 0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x45, 0x43, 0x90,
+  0x05, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x08,
+  0x42, 0x81, 0x02, 0x00, 0x00, 0x98, 0x41, 0x00, 0x00, 0xe0, 0x40, 0x00,
+  0x00, 0x00, 0x41, 0x90, 0x0a, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0xb8,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x04,
+  0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x29, 0x43, 0x00, 0x00, 0xa4,
+  0x42, 0x90, 0x03, 0x00, 0x00, 0x25, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x50, 0x43, 0x81, 0x05, 0x00, 0x00, 0x90,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x5d, 0x43, 0x00, 0x00, 0xc0, 0x41, 0x8f, 0x0a, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x79, 0x43, 0x00, 0x00, 0xcc, 0x42, 0x00, 0x00, 0x29, 0x43, 0x00,
+  0x00, 0x74, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x90, 0x0a, 0x00, 0x00, 0x38,
+  0x42, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x45, 0x43, 0x91, 0x09, 0x00, 0x00, 0x50, 0x42, 0x00,
+  0x00, 0x4b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x92,
+  0x08, 0x00, 0x00, 0x8a, 0x42, 0x00, 0x00, 0x0e, 0x43, 0x00, 0x00, 0x0e,
+  0x43, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x78, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x45,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x46, 0x43, 0x96,
+  0x04, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x08, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x96, 0x04, 0x00, 0x00, 0x80,
+  0x41, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x45, 0x43, 0x97, 0x03, 0x00, 0x00, 0x30, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x45, 0x43, 0x97,
+  0x04, 0x00, 0x00, 0x0a, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x70, 0x43, 0x00, 0x00, 0x2c, 0x42, 0x96, 0x04, 0x00,
+  0x00, 0x86, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x5c, 0x42, 0x96, 0x04, 0x00, 0x00, 0x86,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xce, 0x42, 0x96, 0x04, 0x00, 0x00, 0x90, 0x41, 0x00,
+  0x00, 0x5c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x5c, 0x42, 0x97, 0x03, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5c, 0x42, 0xbf, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x98, 0x04, 0x00, 0x00, 0x9c, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x30, 0x43, 0x00,
+  0x00, 0xc8, 0x41, 0x96, 0x04, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x30,
+  0x42, 0x96, 0x04, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x30, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x30, 0x42, 0x96, 0x04, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x30, 0x42, 0x96, 0x04, 0x00, 0x00, 0x3b,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x30, 0x42, 0x95, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x00, 0x3e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x40, 0x43, 0x00, 0x00, 0x80, 0x40, 0x95, 0x04, 0x00, 0x00, 0x34,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x3a, 0x43, 0x96, 0x04, 0x00, 0x00, 0x34, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3a, 0x43, 0x96, 0x04, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0a,
+  0x43, 0x96, 0x04, 0x00, 0x00, 0x6c, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0xb6, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0x9c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0x34, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x96, 0x04, 0x00, 0x00, 0x34,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x3a, 0x43, 0x96, 0x04, 0x00, 0x00, 0x0c, 0x42, 0x00,
+  0x00, 0x6e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3a, 0x43, 0x97, 0x03, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x97, 0x03, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3a, 0x43, 0x97, 0x03, 0x00, 0x00, 0x3b, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a, 0x43, 0x97, 0x03, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3a, 0x43, 0x97, 0x03, 0x00, 0x00, 0x68, 0x42, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0a, 0x43, 0xde, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x03, 0x00, 0x00, 0xe4, 0x42, 0x00, 0x00,
+  0x78, 0x43, 0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0x64, 0x42, 0x96, 0x04,
+  0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x96, 0x04, 0x00, 0x00,
+  0x1e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0xca, 0x42, 0x95, 0x05, 0x00, 0x00, 0x14, 0x42,
+  0x00, 0x00, 0x62, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x30, 0x41, 0x95, 0x04, 0x00, 0x00,
+  0x01, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x95, 0x04, 0x00, 0x00, 0xa0, 0x41,
+  0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x6b, 0x43, 0x96, 0x04, 0x00, 0x00, 0xe6, 0x42, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0xf6, 0x42, 0x96, 0x04, 0x00, 0x00, 0x21, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0xc0, 0x41,
+  0x96, 0x03, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x49, 0x43, 0x82, 0x02, 0x00, 0x00, 0x10, 0x42,
+  0x00, 0x00, 0xa6, 0x42, 0x00, 0x00, 0x8a, 0x42, 0x91, 0x03, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0xde, 0x42, 0x81, 0x06, 0x00, 0x00, 0xee, 0x42, 0x00, 0x00, 0x77, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x49, 0x43,
+  0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0xb8, 0x41, 0x8d, 0x0e, 0x00, 0x00,
+  0x96, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x38, 0x42, 0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x80, 0x40, 0x8c, 0x0e,
+  0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0xe6, 0x42,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x31, 0x43, 0x00, 0x00, 0x6f, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xf6, 0x42,
+  0x8c, 0x0e, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x1a, 0x43, 0x00, 0x00,
+  0x7b, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x53, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x73, 0x43, 0x8c, 0x0e, 0x00, 0x00, 0xb2, 0x42, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x46, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x42,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7a, 0x43, 0x8d, 0x0d, 0x00, 0x00, 0x7b, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x40, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x3a, 0x43, 0x8d, 0x0d, 0x00, 0x00, 0x47, 0x43, 0x00, 0x00, 0x7f, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0xe0, 0x40,
+  0x00, 0x00, 0x05, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x68, 0x42,
+  0x8d, 0x0c, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x2f, 0x43, 0x8e, 0x0b, 0x00, 0x00, 0xa8, 0x41,
+  0x00, 0x00, 0x4d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x06, 0x43, 0x90, 0x09, 0x00, 0x00,
+  0x6c, 0x42, 0x00, 0x00, 0x42, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00,
+  0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00,
+  0xd0, 0x42, 0x93, 0x06, 0x00, 0x00, 0xa0, 0x42, 0x00, 0x00, 0x1e, 0x43,
+  0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7e, 0x43,
+  0x00, 0x00, 0x1f, 0x43, 0x00, 0x00, 0xe0, 0x41, 0xff, 0x94, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x95, 0x02, 0x00, 0x00, 0x40, 0x40, 0x00,
+  0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x41, 0x81, 0x04, 0x00, 0x00, 0xd6,
+  0x42, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x9a,
+  0x42, 0x00, 0x00, 0xc0, 0x41, 0x8f, 0x0c, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0xbe, 0x42, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x4d, 0x43, 0x00, 0x00, 0x96, 0x42, 0x00, 0x00, 0x14, 0x42, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x8d,
+  0x0d, 0x00, 0x00, 0x78, 0x42, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6f,
+  0x43, 0x00, 0x00, 0x18, 0x43, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x8c, 0x0e, 0x00,
+  0x00, 0x78, 0x42, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x2e, 0x43, 0x00,
+  0x00, 0x1c, 0x42, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x1d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xa6, 0x42, 0x8c,
+  0x05, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0xe0,
+  0x40, 0x82, 0x05, 0x00, 0x00, 0xf6, 0x42, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0xa6, 0x42, 0x8c, 0x03, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x35, 0x43, 0x85, 0x04, 0x00,
+  0x00, 0x41, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x70, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x8c, 0x04, 0x00, 0x00, 0x3c,
+  0x42, 0x00, 0x00, 0x7a, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x58,
+  0x43, 0x00, 0x00, 0xe0, 0x41, 0x83, 0x04, 0x00, 0x00, 0x40, 0x40, 0x00,
+  0x00, 0x45, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x6a, 0x43, 0x8e, 0x05, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x60,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0xc6,
+  0x42, 0x00, 0x00, 0x30, 0x41, 0x81, 0x04, 0x00, 0x00, 0x88, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x50, 0x43, 0x8f, 0x0b, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x5a,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x5c,
+  0x43, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0xdc, 0x42, 0x00, 0x00, 0x6b,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x91, 0x09, 0x00, 0x00, 0xba, 0x42, 0x00,
+  0x00, 0x4a, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x20, 0x41, 0x93,
+  0x06, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x30, 0x43, 0x94, 0x08, 0x00, 0x00, 0xfe, 0x42, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3e, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x91, 0x0a, 0x00, 0x00, 0x6c,
+  0x42, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x17, 0x43, 0x00, 0x00, 0x24,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6e,
+  0x43, 0x00, 0x00, 0xd8, 0x41, 0x8f, 0x0b, 0x00, 0x00, 0x10, 0x41, 0x00,
+  0x00, 0x55, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0xe8, 0x41, 0x00,
+  0x00, 0xa8, 0x41, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x10, 0x42, 0x8f, 0x0b, 0x00, 0x00, 0x25,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x60, 0x43, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0x6a, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0xde, 0x42, 0x8f, 0x0b, 0x00,
+  0x00, 0x60, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x65, 0x43, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x41, 0x00, 0x00, 0x3c, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x03, 0x43, 0x8f,
+  0x0b, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x86,
+  0x42, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x10,
+  0x42, 0x8f, 0x0b, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x57, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x62, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x75, 0x43, 0x00, 0x00, 0x8c, 0x42, 0x00,
+  0x00, 0xa0, 0x40, 0x90, 0x08, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x4d,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e,
+  0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00, 0x00, 0x6d,
+  0x43, 0x00, 0x00, 0x0a, 0x43, 0x93, 0x06, 0x00, 0x00, 0xa0, 0x41, 0x00,
+  0x00, 0x88, 0x42, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x2f, 0x43, 0x00, 0x00, 0xbe, 0x42, 0x00, 0x00, 0x00, 0x42, 0xdc,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb1, 0x06, 0x00, 0x00, 0x00, 0x41, 0x00,
+  0x00, 0xf4, 0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x57, 0x43, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0x50, 0x41, 0x93,
+  0x07, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x1c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x24, 0x43, 0x93, 0x08, 0x00,
+  0x00, 0x78, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x08, 0x43, 0x91,
+  0x09, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0xa8, 0x42, 0x90, 0x0a, 0x00, 0x00, 0x60, 0x41, 0x00,
+  0x00, 0x37, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x60, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x1d, 0x43, 0x00,
+  0x00, 0x10, 0x42, 0x90, 0x0c, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x55,
+  0x43, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x78, 0x43, 0x00, 0x00, 0xea, 0x42, 0x00, 0x00, 0xfa,
+  0x42, 0x00, 0x00, 0x78, 0x42, 0x00, 0x00, 0x80, 0x40, 0x8e, 0x0d, 0x00,
+  0x00, 0xde, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0xe0, 0x40, 0x00,
+  0x00, 0xc2, 0x42, 0x00, 0x00, 0x07, 0x43, 0x00, 0x00, 0xc8, 0x42, 0x00,
+  0x00, 0xa2, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x3b, 0x43, 0x00, 0x00, 0x40, 0x42, 0x8d, 0x04, 0x00, 0x00, 0x17,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x58,
+  0x43, 0x00, 0x00, 0x60, 0x41, 0x83, 0x04, 0x00, 0x00, 0x28, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x16, 0x43, 0x8d, 0x03, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x17, 0x43, 0x82, 0x06, 0x00,
+  0x00, 0xc6, 0x42, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00, 0x76, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x0f, 0x43, 0x8d, 0x0d, 0x00, 0x00, 0x30, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00, 0x5c,
+  0x42, 0x00, 0x00, 0x5c, 0x42, 0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2c,
+  0x42, 0x8d, 0x0d, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x23, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x66, 0x43, 0x00, 0x00, 0xd8, 0x41, 0x8e,
+  0x0b, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xec, 0x42, 0x00, 0x00, 0x6c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x33,
+  0x43, 0x91, 0x09, 0x00, 0x00, 0x88, 0x41, 0x00, 0x00, 0xac, 0x42, 0x00,
+  0x00, 0xac, 0x42, 0x00, 0x00, 0xac, 0x42, 0x00, 0x00, 0x90, 0x41, 0x00,
+  0x00, 0x02, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0xa2, 0x42, 0x96, 0x04, 0x00, 0x00, 0x02,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0xa2, 0x42, 0x96, 0x04, 0x00, 0x00, 0x02, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0xa2, 0x42, 0x96, 0x04, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa2,
+  0x42, 0x96, 0x04, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0xa2, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6e, 0x43, 0x00, 0x00, 0x10, 0x42, 0x96, 0x03, 0x00,
+  0x00, 0xca, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x62, 0x43, 0x97, 0x03, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x06,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xb2, 0x05, 0x00, 0x00, 0x20, 0x41, 0x00,
+  0x00, 0xe2, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7e, 0x43, 0x00,
+  0x00, 0x52, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x94, 0x07, 0x00, 0x00, 0xba,
+  0x42, 0x00, 0x00, 0x52, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x51,
+  0x43, 0x00, 0x00, 0xa0, 0x41, 0x92, 0x08, 0x00, 0x00, 0xc4, 0x42, 0x00,
+  0x00, 0x7a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x91, 0x09, 0x00, 0x00, 0xc8,
+  0x42, 0x00, 0x00, 0x76, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00, 0x4c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3a,
+  0x43, 0x90, 0x0c, 0x00, 0x00, 0xc8, 0x41, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x32, 0x43, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x9c, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7b, 0x43, 0x00,
+  0x00, 0x0a, 0x43, 0x00, 0x00, 0xf8, 0x41, 0x8e, 0x0d, 0x00, 0x00, 0x30,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x30, 0x41, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x55,
+  0x43, 0x00, 0x00, 0xf0, 0x41, 0x8d, 0x04, 0x00, 0x00, 0x3d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7a, 0x43, 0x00,
+  0x00, 0x64, 0x42, 0x81, 0x06, 0x00, 0x00, 0x40, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x34, 0x43, 0x8d, 0x03, 0x00,
+  0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x35, 0x43, 0x82, 0x06, 0x00, 0x00, 0x54, 0x42, 0x00, 0x00, 0x6a,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8d, 0x0c, 0x00,
+  0x00, 0x3d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x4d, 0x43, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x28, 0x42, 0x00,
+  0x00, 0x8c, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x4e, 0x43, 0x8e, 0x0c, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0x73,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x8f, 0x0b, 0x00,
+  0x00, 0xea, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x8f,
+  0x0b, 0x00, 0x00, 0x70, 0x41, 0x00, 0x00, 0xb6, 0x42, 0x00, 0x00, 0x4d,
+  0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x1e,
+  0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x1e, 0x43, 0x00, 0x00, 0x75,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e,
+  0x43, 0x91, 0x01, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x20, 0x41, 0x83,
+  0x03, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x4e, 0x43, 0x97, 0x03, 0x00, 0x00, 0x67, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x97,
+  0x03, 0x00, 0x00, 0x59, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x4e, 0x43, 0x97, 0x04, 0x00, 0x00, 0xe2, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00,
+  0x00, 0x38, 0x42, 0x96, 0x04, 0x00, 0x00, 0xe2, 0x42, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x8c,
+  0x42, 0x96, 0x04, 0x00, 0x00, 0x98, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x8c, 0x42, 0x97,
+  0x03, 0x00, 0x00, 0x79, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x8c, 0x42, 0x97, 0x03, 0x00, 0x00, 0x41, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0xa0, 0x40, 0xbe,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x94, 0x02, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x97, 0x0a, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x80, 0x42, 0x8f, 0x0c, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x8d,
+  0x0f, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x80, 0x42, 0x8b, 0x10, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x3f, 0x43, 0x8a, 0x07, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x85, 0x03, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x88, 0x04, 0x00, 0x00, 0x80,
+  0x42, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x89, 0x03, 0x00, 0x00, 0x80, 0x42, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x88,
+  0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x8a, 0x03, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x87, 0x04, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x8a, 0x03, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x87, 0x03, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x8b, 0x03, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x87, 0x03, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x8a, 0x04, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00, 0x43, 0x87,
+  0x03, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x8a, 0x04, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x87, 0x03, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x88, 0x06, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x80, 0x42, 0x87, 0x03, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x87, 0x06, 0x00,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x00, 0x43, 0x89, 0x04, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x80,
+  0x42, 0x83, 0x07, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x8a,
+  0x0f, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x3f, 0x43, 0x8d, 0x0c, 0x00, 0x00, 0x00, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x80, 0x42, 0x8f,
+  0x09, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x80, 0x42, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfb, 0x02, 0x00, 0x00, 0x9a, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x06, 0x43, 0x98, 0x04, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00, 0x30, 0x41,
+  0x96, 0x04, 0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x96, 0x04,
+  0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x96, 0x04, 0x00, 0x00,
+  0x12, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x96, 0x04, 0x00, 0x00, 0x40, 0x42,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0xd0, 0x41, 0x96, 0x04, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0xd0, 0x41, 0x96, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41,
+  0x96, 0x04, 0x00, 0x00, 0xb8, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x96, 0x04,
+  0x00, 0x00, 0x12, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x96, 0x04, 0x00, 0x00,
+  0x13, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x95, 0x05, 0x00, 0x00, 0xd0, 0x41,
+  0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x95, 0x05, 0x00, 0x00,
+  0xd8, 0x41, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41, 0x95, 0x05,
+  0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41,
+  0x95, 0x05, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x27, 0x43, 0x00, 0x00,
+  0xc0, 0x40, 0x95, 0x04, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43,
+  0x96, 0x04, 0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x96, 0x42, 0x96, 0x05,
+  0x00, 0x00, 0x20, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x55, 0x43, 0x00, 0x00, 0x88, 0x41,
+  0x95, 0x05, 0x00, 0x00, 0x86, 0x42, 0x00, 0x00, 0x37, 0x43, 0x00, 0x00,
+  0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00,
+  0xd0, 0x41, 0x96, 0x04, 0x00, 0x00, 0x60, 0x41, 0x00, 0x00, 0x7c, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xd0, 0x41,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x06, 0x00, 0x00,
+  0x50, 0x41, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00,
+  0x7f, 0x43, 0x00, 0x00, 0x69, 0x43, 0x00, 0x00, 0xd6, 0x42, 0x00, 0x00,
+  0xa0, 0x40, 0x94, 0x08, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x38, 0x42,
+  0x00, 0x00, 0x40, 0x40, 0x92, 0x09, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00,
+  0x76, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x08, 0x43, 0x00, 0x00, 0xa0, 0x40, 0x92, 0x09,
+  0x00, 0x00, 0x94, 0x42, 0x00, 0x00, 0x64, 0x43, 0x00, 0x00, 0x15, 0x43,
+  0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0xd2, 0x42, 0x00, 0x00, 0x40, 0x43,
+  0x00, 0x00, 0x77, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2b, 0x43,
+  0x00, 0x00, 0xe8, 0x41, 0x97, 0x04, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00, 0x00,
+  0xc0, 0x40, 0x95, 0x05, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x44, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x74, 0x42, 0x94, 0x06, 0x00, 0x00, 0x10, 0x41, 0x00, 0x00,
+  0x16, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x26, 0x43, 0x93, 0x07,
+  0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x0e, 0x43, 0x93, 0x07, 0x00, 0x00,
+  0x03, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6d, 0x43, 0x00, 0x00,
+  0xc4, 0x42, 0x00, 0x00, 0x50, 0x41, 0x92, 0x06, 0x00, 0x00, 0x68, 0x42,
+  0x00, 0x00, 0x67, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x4b, 0x43, 0x00, 0x00, 0x40, 0x42,
+  0x93, 0x06, 0x00, 0x00, 0xc0, 0x41, 0x00, 0x00, 0x67, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x4b, 0x43, 0x00, 0x00, 0x96, 0x42, 0x94, 0x05, 0x00, 0x00, 0x88, 0x42,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x88, 0x42, 0x94, 0x06, 0x00, 0x00,
+  0x00, 0x41, 0x00, 0x00, 0x3a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00,
+  0x38, 0x42, 0x94, 0x07, 0x00, 0x00, 0x88, 0x42, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0xb0, 0x42, 0x00, 0x00, 0x80, 0x42,
+  0x93, 0x09, 0x00, 0x00, 0x15, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x74, 0x43, 0x00, 0x00,
+  0x35, 0x43, 0x00, 0x00, 0x80, 0x42, 0x90, 0x0e, 0x00, 0x00, 0x88, 0x41,
+  0x00, 0x00, 0x71, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x74, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00, 0x00, 0xec, 0x42,
+  0x00, 0x00, 0xc8, 0x42, 0x00, 0x00, 0x6c, 0x42, 0x8c, 0x0f, 0x00, 0x00,
+  0x8e, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x73, 0x43, 0x00, 0x00,
+  0x88, 0x42, 0x8a, 0x11, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x76, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x2b, 0x43, 0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x2e, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43,
+  0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3f, 0x43,
+  0x00, 0x00, 0xa0, 0x40, 0x89, 0x11, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00,
+  0x13, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00,
+  0x40, 0x41, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x40, 0x00, 0x00, 0x4c, 0x42, 0x00, 0x00, 0x30, 0x43, 0x00, 0x00,
+  0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00,
+  0x49, 0x43, 0x00, 0x00, 0xc0, 0x40, 0x8a, 0x05, 0x00, 0x00, 0x40, 0x41,
+  0x00, 0x00, 0x0d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x2e, 0x43,
+  0x00, 0x00, 0x40, 0x42, 0x00, 0x00, 0x00, 0x40, 0x84, 0x04, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xa0, 0x40, 0x00, 0x00,
+  0xa0, 0x40, 0x00, 0x00, 0x40, 0x40, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x9b, 0x02, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x5a, 0x43, 0x00,
+  0x00, 0xb8, 0x42, 0x8f, 0x03, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x3e,
+  0x43, 0x00, 0x00, 0x23, 0x43, 0x00, 0x00, 0x60, 0x41, 0x84, 0x03, 0x00,
+  0x00, 0x14, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00,
+  0x00, 0xc6, 0x42, 0x8e, 0x04, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x10,
+  0x41, 0x83, 0x03, 0x00, 0x00, 0x49, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x8e, 0x04, 0x00, 0x00, 0xaa,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xd4, 0x42, 0x82, 0x04, 0x00, 0x00, 0x8e, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xee, 0x42, 0x8e, 0x04, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x90,
+  0x41, 0x82, 0x04, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00, 0x00, 0x60, 0x41, 0x8e,
+  0x03, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x83, 0x03, 0x00, 0x00, 0x54, 0x43, 0x00,
+  0x00, 0x7e, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x68, 0x43, 0x8f,
+  0x03, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x83, 0x03, 0x00, 0x00, 0x53, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x67, 0x43, 0x8f,
+  0x03, 0x00, 0x00, 0x36, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x83, 0x03, 0x00, 0x00, 0x53, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x8f,
+  0x03, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x82, 0x04, 0x00, 0x00, 0x80, 0x41, 0x00,
+  0x00, 0x5d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0xfc, 0x42, 0x8f, 0x03, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x24, 0x43, 0x82, 0x04, 0x00,
+  0x00, 0x80, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xfc, 0x42, 0x8f, 0x11, 0x00, 0x00, 0x2d,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x51,
+  0x43, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x2c,
+  0x42, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x48, 0x43, 0x00, 0x00, 0x14,
+  0x43, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x00, 0x42, 0x89, 0x11, 0x00,
+  0x00, 0xaa, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x89,
+  0x11, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x5e, 0x43, 0x00, 0x00, 0xbe,
+  0x42, 0x8a, 0x0e, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xa8, 0x42, 0x00,
+  0x00, 0x2c, 0x43, 0x00, 0x00, 0x3e, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00,
+  0x00, 0x42, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x77, 0x43, 0x00,
+  0x00, 0x3d, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x00,
+  0x00, 0xa8, 0x41, 0x91, 0x05, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x36,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xc6, 0x42, 0x96, 0x04, 0x00, 0x00, 0xda, 0x42, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x4c, 0x43, 0x00,
+  0x00, 0x10, 0x41, 0x96, 0x04, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0xe0,
+  0x40, 0x96, 0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa8, 0x41, 0x97,
+  0x03, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xb6, 0x42, 0x97, 0x04, 0x00, 0x00, 0x0c, 0x42, 0x00,
+  0x00, 0x51, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x06, 0x43, 0x00,
+  0x00, 0x0c, 0x42, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xff, 0x91, 0x01, 0x00,
+  0x00, 0x70, 0x41, 0x00, 0x00, 0x1c, 0x42, 0x86, 0x03, 0x00, 0x00, 0xc8,
+  0x41, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x3f, 0x43, 0x00, 0x00, 0x60,
+  0x41, 0x8e, 0x03, 0x00, 0x00, 0x64, 0x42, 0x00, 0x00, 0x70, 0x43, 0x00,
+  0x00, 0xf0, 0x42, 0x00, 0x00, 0x48, 0x42, 0x84, 0x04, 0x00, 0x00, 0x9c,
+  0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x0c,
+  0x43, 0x00, 0x00, 0x60, 0x41, 0x8e, 0x02, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x48, 0x43, 0x84, 0x04, 0x00, 0x00, 0x14,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0xa6, 0x42, 0x8e, 0x02, 0x00, 0x00, 0x68, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x62, 0x43, 0x84, 0x03, 0x00, 0x00, 0x14,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d,
+  0x43, 0x8e, 0x03, 0x00, 0x00, 0x8e, 0x42, 0x00, 0x00, 0x79, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x13, 0x43, 0x84, 0x03, 0x00, 0x00, 0x14,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d,
+  0x43, 0x8e, 0x03, 0x00, 0x00, 0xaa, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x13, 0x43, 0x84, 0x03, 0x00, 0x00, 0x52,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x3e,
+  0x43, 0x8e, 0x03, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x13, 0x43, 0x83, 0x04, 0x00, 0x00, 0x10,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xdc, 0x42, 0x8e, 0x03, 0x00, 0x00, 0x3e, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x13, 0x43, 0x83,
+  0x04, 0x00, 0x00, 0xd4, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x8d, 0x04, 0x00,
+  0x00, 0xe8, 0x41, 0x00, 0x00, 0x68, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x13, 0x43, 0x83, 0x08, 0x00, 0x00, 0xd4,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+  0x41, 0x00, 0x00, 0x80, 0x42, 0x00, 0x00, 0xc0, 0x40, 0x89, 0x04, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x13, 0x43, 0x83, 0x09, 0x00, 0x00, 0xd4,
+  0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0xa8, 0x42, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x2f,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x4e, 0x43, 0x00, 0x00, 0x0c,
+  0x42, 0x88, 0x12, 0x00, 0x00, 0x10, 0x42, 0x00, 0x00, 0x73, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x25, 0x43, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x2c, 0x42, 0x00, 0x00, 0x1c, 0x42, 0x00,
+  0x00, 0x90, 0x41, 0x00, 0x00, 0xf8, 0x42, 0x00, 0x00, 0x7f, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7f, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x11, 0x43, 0x89, 0x11, 0x00, 0x00, 0x1b,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x77,
+  0x43, 0x00, 0x00, 0x58, 0x43, 0x00, 0x00, 0x72, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3d, 0x43, 0x89, 0x11, 0x00,
+  0x00, 0x2c, 0x42, 0x00, 0x00, 0x61, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x5f, 0x43, 0x00,
+  0x00, 0xfc, 0x42, 0x00, 0x00, 0xfc, 0x42, 0x00, 0x00, 0x4c, 0x42, 0x8a,
+  0x0d, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xde, 0x42, 0x00, 0x00, 0x57,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7d,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x52,
+  0x43, 0x00, 0x00, 0xca, 0x42, 0x00, 0x00, 0x0c, 0x42, 0x8f, 0x09, 0x00,
+  0x00, 0x90, 0x41, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x28, 0x42, 0x00,
+  0x00, 0x28, 0x42, 0x00, 0x00, 0x28, 0x42, 0x00, 0x00, 0x2e, 0x43, 0x00,
+  0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x6b, 0x43, 0x00,
+  0x00, 0x60, 0x41, 0x96, 0x04, 0x00, 0x00, 0x54, 0x43, 0x00, 0x00, 0x7f,
+  0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x6c, 0x43, 0x00, 0x00, 0x60,
+  0x41, 0x96, 0x04, 0x00, 0x00, 0x53, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0xa8, 0x42, 0x96,
+  0x04, 0x00, 0x00, 0x4a, 0x43, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c,
+  0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x08, 0x43, 0x96, 0x04, 0x00,
+  0x00, 0xd4, 0x42, 0x00, 0x00, 0x7d, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00,
+  0x00, 0x7c, 0x43, 0x00, 0x00, 0xee, 0x42, 0x96, 0x04, 0x00, 0x00, 0x90,
+  0x41, 0x00, 0x00, 0x51, 0x43, 0x00, 0x00, 0x7c, 0x43, 0x00, 0x00, 0x3e,
+  0x43, 0x00, 0x00, 0x60, 0x41, 0xdc, 0x00, 0x00,
+};
@@ -0,0 +1,3481 @@
+/***************************************************************************//**
+* \file TEST_MODEL_tflm_x_data_int16x8.c
+*
+* \brief
+* Generated with scripts/ml_regression_convert.py, this file contains input
+* data for the TEST_MODEL model in int16x8 representation (v3 regression container).
+******************************************************************************/
+
+
+#include "TEST_MODEL_tflm_x_data_int16x8.h"
+
+
+const uint8_t TEST_MODEL_x_data_bin[TEST_MODEL_X_DATA_BIN_LEN] __attribute__((aligned(4))) = {
+  0x4d, 0x4c, 0x52, 0x33, 0x03, 0x00, 0x03, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x10, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x2c, 0x02, 0x00, 0x00, 0x84, 0xa2, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
+  0x2c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0x20, 0x1b, 0x00, 0x00, 0x38, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0x58, 0x33, 0x00, 0x00, 0x74, 0x18, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xcc, 0x4b, 0x00, 0x00,
+  0x1c, 0x19, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0xe8, 0x64, 0x00, 0x00, 0xa4, 0x1c, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0x8c, 0x81, 0x00, 0x00, 0xd8, 0x1a, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x64, 0x9c, 0x00, 0x00,
+  0x20, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
+  0xf4, 0x02, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00,
+  0x24, 0x07, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x00, 0xec, 0x09, 0x00, 0x00,
+  0x24, 0x0b, 0x00, 0x00, 0x20, 0x0d, 0x00, 0x00, 0xf8, 0x0e, 0x00, 0x00,
+  0xc4, 0x10, 0x00, 0x00, 0x6c, 0x12, 0x00, 0x00, 0x4c, 0x14, 0x00, 0x00,
+  0xb4, 0x15, 0x00, 0x00, 0xf8, 0x16, 0x00, 0x00, 0xd4, 0x17, 0x00, 0x00,
+  0xa8, 0x19, 0x00, 0x00, 0x20, 0x1b, 0x00, 0x00, 0x88, 0x1c, 0x00, 0x00,
+  0xa4, 0x1d, 0x00, 0x00, 0x28, 0x1f, 0x00, 0x00, 0xc0, 0x20, 0x00, 0x00,
+  0xa4, 0x22, 0x00, 0x00, 0x4c, 0x24, 0x00, 0x00, 0x38, 0x26, 0x00, 0x00,
+  0xf4, 0x27, 0x00, 0x00, 0x8c, 0x29, 0x00, 0x00, 0x78, 0x2a, 0x00, 0x00,
+  0x3c, 0x2c, 0x00, 0x00, 0xd0, 0x2d, 0x00, 0x00, 0x48, 0x2f, 0x00, 0x00,
+  0x34, 0x31, 0x00, 0x00, 0x14, 0x32, 0x00, 0x00, 0x58, 0x33, 0x00, 0x00,
+  0x48, 0x35, 0x00, 0x00, 0xbc, 0x36, 0x00, 0x00, 0x34, 0x38, 0x00, 0x00,
+  0x18, 0x39, 0x00, 0x00, 0x74, 0x3a, 0x00, 0x00, 0x28, 0x3c, 0x00, 0x00,
+  0xb4, 0x3d, 0x00, 0x00, 0xc4, 0x3e, 0x00, 0x00, 0x6c, 0x40, 0x00, 0x00,
+  0x24, 0x42, 0x00, 0x00, 0xd0, 0x43, 0x00, 0x00, 0x88, 0x45, 0x00, 0x00,
+  0x10, 0x47, 0x00, 0x00, 0x8c, 0x48, 0x00, 0x00, 0x5c, 0x4a, 0x00, 0x00,
+  0xcc, 0x4b, 0x00, 0x00, 0x60, 0x4d, 0x00, 0x00, 0x5c, 0x4e, 0x00, 0x00,
+  0xe0, 0x4f, 0x00, 0x00, 0xe0, 0x50, 0x00, 0x00, 0x50, 0x53, 0x00, 0x00,
+  0xf4, 0x54, 0x00, 0x00, 0x20, 0x56, 0x00, 0x00, 0xfc, 0x57, 0x00, 0x00,
+  0xa8, 0x59, 0x00, 0x00, 0x1c, 0x5b, 0x00, 0x00, 0xb0, 0x5c, 0x00, 0x00,
+  0x18, 0x5e, 0x00, 0x00, 0x68, 0x60, 0x00, 0x00, 0x90, 0x61, 0x00, 0x00,
+  0x48, 0x63, 0x00, 0x00, 0xe8, 0x64, 0x00, 0x00, 0xa0, 0x66, 0x00, 0x00,
+  0x68, 0x68, 0x00, 0x00, 0x30, 0x6a, 0x00, 0x00, 0xc8, 0x6b, 0x00, 0x00,
+  0xd0, 0x6d, 0x00, 0x00, 0x78, 0x6f, 0x00, 0x00, 0x5c, 0x71, 0x00, 0x00,
+  0xc4, 0x72, 0x00, 0x00, 0xac, 0x74, 0x00, 0x00, 0x30, 0x76, 0x00, 0x00,
+  0x1c, 0x78, 0x00, 0x00, 0xfc, 0x79, 0x00, 0x00, 0xf0, 0x7b, 0x00, 0x00,
+  0xa4, 0x7d, 0x00, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0x8c, 0x81, 0x00, 0x00,
+  0xac, 0x83, 0x00, 0x00, 0xbc, 0x84, 0x00, 0x00, 0x40, 0x86, 0x00, 0x00,
+  0x20, 0x88, 0x00, 0x00, 0xd8, 0x89, 0x00, 0x00, 0x30, 0x8c, 0x00, 0x00,
+  0x24, 0x8e, 0x00, 0x00, 0xb4, 0x8f, 0x00, 0x00, 0xac, 0x91, 0x00, 0x00,
+  0x04, 0x93, 0x00, 0x00, 0xf0, 0x93, 0x00, 0x00, 0x98, 0x95, 0x00, 0x00,
+  0x80, 0x97, 0x00, 0x00, 0x10, 0x99, 0x00, 0x00, 0x98, 0x9a, 0x00, 0x00,
+  0x64, 0x9c, 0x00, 0x00, 0x60, 0x9d, 0x00, 0x00, 0x10, 0x9f, 0x00, 0x00,
+  0xb8, 0xa0, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x09, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x02, 0x00,
+  0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x06, 0x00,
+  0x03, 0x00, 0x09, 0x00, 0x02, 0x00, 0x01, 0x00, 0x09, 0x00, 0x05, 0x00,
+  0x09, 0x00, 0x06, 0x00, 0x01, 0x00, 0x07, 0x00, 0x02, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x08, 0x00, 0x03, 0x00, 0x09, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00,
+  0x08, 0x00, 0x09, 0x00, 0x01, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0xff, 0xcc, 0x05, 0x9b, 0x1b, 0x7e, 0x7f, 0x7e, 0x7f, 0x6a,
+  0x6b, 0x2b, 0x2c, 0x00, 0x01, 0x94, 0x10, 0x07, 0x08, 0x58, 0x59, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x16, 0x17, 0x8c, 0x0c, 0x8c,
+  0x0c, 0x8c, 0x0c, 0x8c, 0x0c, 0x8c, 0x0c, 0x8c, 0x0c, 0x8c, 0x0c, 0xa9,
+  0x29, 0x8c, 0x0c, 0x81, 0x01, 0x89, 0x11, 0x01, 0x02, 0xd5, 0x55, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x94, 0x14, 0x89, 0x11, 0x34, 0x35, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x78, 0x79, 0xb8, 0x38, 0x15, 0x16, 0x5d, 0x5e, 0xfc,
+  0x7c, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x3c, 0x3d, 0x88, 0x04, 0x84,
+  0x04, 0xef, 0x6f, 0xfe, 0x7e, 0x78, 0x79, 0xac, 0x2c, 0x82, 0x0a, 0x20,
+  0x21, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0x30, 0x31, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf4, 0x74, 0xac, 0x2c, 0x83, 0x03, 0x88, 0x03, 0x84,
+  0x04, 0x6e, 0x6f, 0xf0, 0x70, 0x98, 0x18, 0x86, 0x05, 0x1a, 0x1b, 0x64,
+  0x65, 0xfe, 0x7e, 0xfe, 0x7e, 0x62, 0x63, 0x13, 0x14, 0x8b, 0x01, 0x0d,
+  0x0e, 0x94, 0x14, 0x86, 0x05, 0x82, 0x02, 0xda, 0x5a, 0xfe, 0x7e, 0xf6,
+  0x76, 0x53, 0x54, 0x9f, 0x1f, 0x94, 0x04, 0x97, 0x17, 0xd1, 0x51, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x4e, 0x4f, 0x96, 0x04, 0x3c, 0x3d, 0x7e, 0x7f, 0xfe,
+  0x7e, 0x53, 0x54, 0x03, 0x04, 0x95, 0x04, 0x9a, 0x1a, 0x78, 0x79, 0x7e,
+  0x7f, 0x55, 0x56, 0x82, 0x02, 0x96, 0x03, 0xd6, 0x56, 0x7e, 0x7f, 0xfc,
+  0x7c, 0x19, 0x1a, 0x96, 0x03, 0x3e, 0x3f, 0xf9, 0x79, 0xfe, 0x7e, 0xd0,
+  0x50, 0x95, 0x04, 0x85, 0x05, 0x26, 0x27, 0x77, 0x78, 0xfe, 0x7e, 0x75,
+  0x76, 0x96, 0x04, 0xb0, 0x30, 0xfe, 0x7e, 0xfe, 0x7e, 0x73, 0x74, 0x98,
+  0x18, 0x94, 0x05, 0x05, 0x06, 0xc9, 0x49, 0x75, 0x76, 0xfe, 0x7e, 0xe4,
+  0x64, 0x19, 0x1a, 0x94, 0x05, 0x85, 0x05, 0x35, 0x36, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x5d, 0x5e, 0x84, 0x04, 0x94, 0x05, 0x84, 0x04, 0xd3, 0x53, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x5d, 0x5e, 0x9b, 0x1b, 0x94, 0x05, 0x82, 0x02, 0x54,
+  0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0x72, 0x73, 0x92, 0x12, 0x95, 0x04, 0x86,
+  0x06, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x45, 0x46, 0x96, 0x04, 0x83,
+  0x03, 0x64, 0x65, 0xfe, 0x7e, 0xca, 0x4a, 0x01, 0x02, 0xac, 0x00, 0x00,
+  0x00, 0x00, 0xc6, 0x03, 0x89, 0x09, 0xe5, 0x65, 0x7e, 0x7f, 0xaa, 0x2a,
+  0x96, 0x04, 0x0b, 0x0c, 0x7e, 0x7f, 0xfe, 0x7e, 0xd1, 0x51, 0x11, 0x12,
+  0x96, 0x03, 0x5b, 0x5c, 0x7e, 0x7f, 0xfe, 0x7e, 0x4c, 0x4d, 0x96, 0x04,
+  0xb0, 0x30, 0x7c, 0x7d, 0x7e, 0x7f, 0xfc, 0x7c, 0x26, 0x27, 0x95, 0x04,
+  0x22, 0x23, 0xfb, 0x7b, 0xfe, 0x7e, 0x7a, 0x7b, 0xa0, 0x20, 0x95, 0x04,
+  0x20, 0x21, 0xec, 0x6c, 0xfe, 0x7e, 0x6c, 0x6d, 0x39, 0x3a, 0x94, 0x05,
+  0x8a, 0x0a, 0xaa, 0x2a, 0xe3, 0x63, 0xfe, 0x7e, 0x57, 0x58, 0xac, 0x2c,
+  0x95, 0x04, 0xd2, 0x52, 0xfe, 0x7e, 0xfe, 0x7e, 0x3d, 0x3e, 0x01, 0x02,
+  0x95, 0x04, 0xb0, 0x30, 0xfb, 0x7b, 0xfe, 0x7e, 0xbe, 0x3e, 0x01, 0x02,
+  0x95, 0x04, 0xae, 0x2e, 0x7c, 0x7d, 0xfe, 0x7e, 0x6c, 0x6d, 0x8c, 0x0c,
+  0x96, 0x04, 0x29, 0x2a, 0x6a, 0x6b, 0x7e, 0x7f, 0xfa, 0x7a, 0x33, 0x34,
+  0x85, 0x03, 0x84, 0x04, 0x14, 0x15, 0x94, 0x14, 0x84, 0x04, 0x8b, 0x04,
+  0x06, 0x07, 0x69, 0x6a, 0xfe, 0x7e, 0xfb, 0x7b, 0x1a, 0x1b, 0x84, 0x08,
+  0x81, 0x01, 0x31, 0x32, 0x6c, 0x6d, 0xfe, 0x7e, 0xfe, 0x7e, 0xec, 0x6c,
+  0xc8, 0x48, 0x11, 0x12, 0x00, 0x01, 0x88, 0x03, 0x31, 0x32, 0xfe, 0x7e,
+  0x7a, 0x7b, 0x35, 0x36, 0x82, 0x0b, 0x07, 0x08, 0xaf, 0x2f, 0x4e, 0x4f,
+  0xd3, 0x53, 0xfe, 0x7e, 0x7a, 0x7b, 0xec, 0x6c, 0xfa, 0x7a, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xab, 0x2b, 0x87, 0x03, 0x84, 0x04, 0x6c, 0x6d,
+  0xfe, 0x7e, 0xe6, 0x66, 0x81, 0x0d, 0x88, 0x08, 0x98, 0x18, 0xe1, 0x61,
+  0xfe, 0x7e, 0x7e, 0x7f, 0xf0, 0x70, 0xc0, 0x40, 0x21, 0x22, 0x00, 0x00,
+  0xa0, 0x20, 0x5a, 0x5b, 0xef, 0x6f, 0xfe, 0x7e, 0xcd, 0x4d, 0x87, 0x0b,
+  0xce, 0x4e, 0xfe, 0x7e, 0xf1, 0x71, 0x1c, 0x1d, 0x15, 0x16, 0xcc, 0x4c,
+  0x66, 0x67, 0xfe, 0x7e, 0xf1, 0x71, 0x42, 0x43, 0x23, 0x24, 0x8f, 0x0f,
+  0x84, 0x02, 0x5b, 0x5c, 0xfe, 0x7e, 0x52, 0x53, 0x87, 0x08, 0xb1, 0x31,
+  0xfe, 0x7e, 0xfa, 0x7a, 0x60, 0x61, 0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xf0, 0x70, 0x33, 0x34, 0x85, 0x04, 0x8a, 0x0a, 0xa4, 0x24, 0x71, 0x72,
+  0xfe, 0x7e, 0x41, 0x42, 0x87, 0x08, 0x81, 0x01, 0xd2, 0x52, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc1, 0x41, 0x98, 0x18,
+  0x81, 0x08, 0x98, 0x18, 0x2a, 0x2b, 0x2a, 0x2b, 0x55, 0x56, 0x6d, 0x6e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xec, 0x6c, 0x0e, 0x0f, 0x88, 0x11, 0x0f, 0x10,
+  0x4d, 0x4e, 0xd7, 0x57, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x76, 0x77, 0x6c, 0x6d, 0xed, 0x6d, 0x76, 0x77, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x13, 0x14, 0x8b, 0x0f,
+  0x82, 0x02, 0x9a, 0x1a, 0x47, 0x48, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf1, 0x71,
+  0x47, 0x48, 0x33, 0x34, 0x0b, 0x0c, 0x81, 0x01, 0x8e, 0x08, 0x84, 0x04,
+  0x1c, 0x1d, 0xa5, 0x25, 0xa5, 0x25, 0x85, 0x05, 0x85, 0x05, 0x85, 0x05,
+  0x85, 0x05, 0x84, 0x04, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xff, 0x82,
+  0x03, 0x8e, 0x0e, 0x6b, 0x6c, 0x53, 0x54, 0x99, 0x19, 0x96, 0x04, 0x8e,
+  0x0e, 0xc3, 0x43, 0x7b, 0x7c, 0x7d, 0x7e, 0x34, 0x35, 0x95, 0x05, 0x0e,
+  0x0f, 0xc3, 0x43, 0x7d, 0x7e, 0x7d, 0x7e, 0x58, 0x59, 0x85, 0x05, 0x95,
+  0x04, 0xbd, 0x3d, 0x7d, 0x7e, 0x7d, 0x7e, 0x6c, 0x6d, 0x87, 0x07, 0x95,
+  0x04, 0x8c, 0x0c, 0xef, 0x6f, 0x7d, 0x7e, 0x7d, 0x7e, 0xb5, 0x35, 0x95,
+  0x05, 0x8b, 0x0b, 0x3f, 0x40, 0x7d, 0x7e, 0x76, 0x77, 0x54, 0x55, 0x8a,
+  0x0a, 0x95, 0x03, 0xb5, 0x35, 0x7d, 0x7e, 0x7d, 0x7e, 0xdc, 0x5c, 0x96,
+  0x04, 0x8d, 0x0d, 0x5f, 0x60, 0x7d, 0x7e, 0x7d, 0x7e, 0xdc, 0x5c, 0x95,
+  0x05, 0x26, 0x27, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x3f, 0x40, 0x26,
+  0x27, 0x95, 0x04, 0xc2, 0x42, 0xfe, 0x7e, 0x7d, 0x7e, 0x64, 0x65, 0x89,
+  0x09, 0x95, 0x04, 0xa6, 0x26, 0xfe, 0x7e, 0xff, 0x7f, 0x64, 0x65, 0x06,
+  0x07, 0x95, 0x04, 0x28, 0x29, 0xfb, 0x7b, 0x7d, 0x7e, 0x64, 0x65, 0x06,
+  0x07, 0x95, 0x04, 0x92, 0x12, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x06,
+  0x07, 0x96, 0x03, 0xa9, 0x29, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x95,
+  0x05, 0x9a, 0x1a, 0x63, 0x64, 0x75, 0x76, 0xfa, 0x7a, 0x58, 0x59, 0x9a,
+  0x1a, 0x95, 0x03, 0xd2, 0x52, 0x7d, 0x7e, 0x7d, 0x7e, 0xf0, 0x70, 0x96,
+  0x04, 0xa6, 0x26, 0x75, 0x76, 0x7d, 0x7e, 0x6f, 0x70, 0x3b, 0x3c, 0x94,
+  0x05, 0x05, 0x06, 0x48, 0x49, 0x76, 0x77, 0x7d, 0x7e, 0x7a, 0x7b, 0xa3,
+  0x23, 0x95, 0x04, 0x32, 0x33, 0x7c, 0x7d, 0x7d, 0x7e, 0xec, 0x6c, 0xab,
+  0x2b, 0x97, 0x03, 0x4d, 0x4e, 0x7d, 0x7e, 0x48, 0x49, 0x8f, 0x0f, 0xff,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x82, 0x03, 0x8e, 0x0e, 0x6b,
+  0x6c, 0xf7, 0x77, 0x99, 0x19, 0x97, 0x03, 0x99, 0x19, 0x7b, 0x7c, 0x70,
+  0x71, 0x02, 0x03, 0x96, 0x03, 0x59, 0x5a, 0x73, 0x74, 0x7d, 0x7e, 0x34,
+  0x35, 0x96, 0x04, 0x21, 0x22, 0x79, 0x7a, 0x7d, 0x7e, 0x7d, 0x7e, 0xae,
+  0x2e, 0x96, 0x04, 0x5c, 0x5d, 0x7d, 0x7e, 0x7d, 0x7e, 0xdc, 0x5c, 0x09,
+  0x0a, 0x94, 0x05, 0x8b, 0x0b, 0xd6, 0x56, 0x78, 0x79, 0x7d, 0x7e, 0x5b,
+  0x5c, 0x8a, 0x0a, 0x95, 0x04, 0xb5, 0x35, 0x7d, 0x7e, 0x7d, 0x7e, 0xf8,
+  0x78, 0x1b, 0x1c, 0x95, 0x04, 0x8d, 0x0d, 0x5f, 0x60, 0x7d, 0x7e, 0xf9,
+  0x79, 0xd2, 0x52, 0x95, 0x04, 0xa3, 0x23, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xaf, 0x2f, 0x96, 0x04, 0xa3, 0x23, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x93, 0x13, 0x94, 0x05, 0x86, 0x06, 0xe2, 0x62, 0xfe, 0x7e, 0xff,
+  0x7f, 0xc5, 0x45, 0xaa, 0x2a, 0x94, 0x05, 0x88, 0x08, 0x5f, 0x60, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x64, 0x65, 0x83, 0x03, 0x95, 0x04, 0x4f, 0x50, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xaa, 0x2a, 0x95, 0x04, 0x1d, 0x1e, 0x62,
+  0x63, 0x7d, 0x7e, 0x7b, 0x7c, 0x55, 0x56, 0x95, 0x04, 0xac, 0x2c, 0x76,
+  0x77, 0x7d, 0x7e, 0xf3, 0x73, 0x18, 0x19, 0x95, 0x04, 0x1d, 0x1e, 0x76,
+  0x77, 0x7d, 0x7e, 0x7d, 0x7e, 0x4c, 0x4d, 0x95, 0x05, 0x92, 0x12, 0x58,
+  0x59, 0x7d, 0x7e, 0x7d, 0x7e, 0x41, 0x42, 0xa3, 0x23, 0x94, 0x05, 0x21,
+  0x22, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x65, 0x66, 0x8e, 0x0e, 0x95,
+  0x04, 0xb5, 0x35, 0x7d, 0x7e, 0x7d, 0x7e, 0x66, 0x67, 0x0d, 0x0e, 0x96,
+  0x03, 0x99, 0x19, 0x76, 0x77, 0xe8, 0x68, 0x8c, 0x0c, 0xff, 0x82, 0x00,
+  0x00, 0x00, 0xff, 0x9d, 0x04, 0x84, 0x04, 0x0b, 0x0c, 0xc0, 0x40, 0xa6,
+  0x26, 0x83, 0x03, 0x94, 0x07, 0x84, 0x04, 0xa7, 0x27, 0xe1, 0x61, 0xfe,
+  0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xcd, 0x4d, 0x0e, 0x0f, 0x91, 0x0a, 0x0f,
+  0x10, 0x22, 0x23, 0x33, 0x34, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0x71, 0x72, 0x22, 0x23, 0x8f, 0x0b, 0xa6,
+  0x26, 0xed, 0x6d, 0x7e, 0x7f, 0xfe, 0x7e, 0x71, 0x72, 0xd0, 0x50, 0xd0,
+  0x50, 0x54, 0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x3a, 0x3b, 0x8d,
+  0x06, 0x0a, 0x0b, 0x39, 0x3a, 0xf2, 0x72, 0xfe, 0x7e, 0xdf, 0x5f, 0x1f,
+  0x20, 0x07, 0x08, 0x81, 0x04, 0x81, 0x01, 0x3a, 0x3b, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xf9, 0x79, 0x8c, 0x05, 0x86, 0x06, 0x4f, 0x50, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xba, 0x3a, 0x84, 0x03, 0x4b, 0x4c, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x44, 0x45, 0x8c, 0x05, 0xbb, 0x3b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xd9, 0x59, 0x14, 0x15, 0x83, 0x04, 0x87, 0x07, 0x58, 0x59, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x1f, 0x20, 0x8b, 0x05, 0xc4, 0x44, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x2a, 0x2b, 0x84, 0x04, 0x4f, 0x50, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x4c, 0x4d, 0x02, 0x03, 0x8a, 0x06, 0xa6, 0x26, 0xf2,
+  0x72, 0x7e, 0x7f, 0xfe, 0x7e, 0x71, 0x72, 0x20, 0x21, 0x8c, 0x0c, 0x83,
+  0x04, 0x2f, 0x30, 0x74, 0x75, 0xfe, 0x7e, 0x61, 0x62, 0x84, 0x04, 0x8a,
+  0x05, 0x0f, 0x10, 0xed, 0x6d, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xa7,
+  0x27, 0x85, 0x03, 0xee, 0x6e, 0x7e, 0x7f, 0xfe, 0x7e, 0xa7, 0x27, 0x8a,
+  0x05, 0x87, 0x07, 0x5f, 0x60, 0x7e, 0x7f, 0x7e, 0x7f, 0xd9, 0x59, 0x14,
+  0x15, 0x84, 0x04, 0x32, 0x33, 0x74, 0x75, 0x7e, 0x7f, 0x7e, 0x7f, 0x29,
+  0x2a, 0x8b, 0x04, 0x50, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0x73, 0x74, 0x14,
+  0x15, 0x83, 0x05, 0x82, 0x02, 0xbc, 0x3c, 0xf2, 0x72, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x29, 0x2a, 0x8b, 0x04, 0x88, 0x08, 0xf2, 0x72, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x1a, 0x1b, 0x84, 0x04, 0xc5, 0x45, 0xfe, 0x7e, 0xfe, 0x7e, 0x71,
+  0x72, 0xc1, 0x41, 0x8c, 0x04, 0xbb, 0x3b, 0xfe, 0x7e, 0xfe, 0x7e, 0xc3,
+  0x43, 0x01, 0x02, 0x82, 0x05, 0xa6, 0x26, 0xc8, 0x48, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xbb, 0x3b, 0x8d, 0x03, 0xc5, 0x45, 0xfe, 0x7e, 0x5e,
+  0x5f, 0x01, 0x02, 0x81, 0x07, 0x0a, 0x0b, 0xc9, 0x49, 0xfc, 0x7c, 0xfe,
+  0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xc4, 0x44, 0x01, 0x02, 0x8d, 0x0b, 0x5f,
+  0x60, 0x7e, 0x7f, 0x41, 0x42, 0x09, 0x0a, 0xa6, 0x26, 0xc5, 0x45, 0xea,
+  0x6a, 0x7e, 0x7f, 0x7e, 0x7f, 0x79, 0x7a, 0xba, 0x3a, 0x14, 0x15, 0x8f,
+  0x09, 0xc5, 0x45, 0xfe, 0x7e, 0x71, 0x72, 0xf6, 0x76, 0xfe, 0x7e, 0x7e,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xd6, 0x56, 0x18, 0x19, 0x91, 0x08, 0x5f,
+  0x60, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7b, 0x7c, 0xd1,
+  0x51, 0xa2, 0x22, 0x86, 0x06, 0x92, 0x05, 0xac, 0x2c, 0x6d, 0x6e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xd4, 0x54, 0x14, 0x15, 0x96, 0x03, 0x87, 0x07, 0x8b,
+  0x0b, 0x8b, 0x0b, 0x00, 0x01, 0xe5, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9d,
+  0x05, 0x88, 0x08, 0x27, 0x28, 0x33, 0x34, 0xff, 0x7f, 0x78, 0x79, 0x98,
+  0x18, 0x95, 0x05, 0x9a, 0x1a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x4d, 0x4e, 0x94, 0x06, 0x92, 0x12, 0xef, 0x6f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7b, 0x7c, 0xbb, 0x3b, 0x93, 0x06, 0x13, 0x14, 0xe7,
+  0x67, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc4, 0x44, 0x93,
+  0x07, 0x0e, 0x0f, 0x6f, 0x70, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xf4, 0x74, 0x18, 0x19, 0x92, 0x07, 0x95, 0x15, 0x67, 0x68, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x75, 0x76, 0x23, 0x24, 0x92,
+  0x07, 0x80, 0x00, 0x34, 0x35, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xf7, 0x77, 0x24, 0x25, 0x92, 0x07, 0x15, 0x16, 0xb7, 0x37, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf3, 0x73, 0xa3, 0x23, 0x92,
+  0x07, 0x80, 0x00, 0xb7, 0x37, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x7b, 0x7c, 0x23, 0x24, 0x93, 0x06, 0x2b, 0x2c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x71, 0x72, 0x21, 0x22, 0x93, 0x06, 0x28,
+  0x29, 0xf5, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x5a,
+  0x5b, 0x93, 0x07, 0x86, 0x06, 0xcf, 0x4f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x71, 0x72, 0xa1, 0x21, 0x02, 0x03, 0x92, 0x06, 0x29, 0x2a, 0xd3,
+  0x53, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7b, 0x7c, 0x21, 0x22, 0x94,
+  0x05, 0x45, 0x46, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe7,
+  0x67, 0x95, 0x05, 0x45, 0x46, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x62,
+  0x63, 0x90, 0x10, 0x94, 0x05, 0xe2, 0x62, 0x74, 0x75, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xf3, 0x73, 0x8c, 0x0c, 0x95, 0x04, 0xf6, 0x76, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xe2, 0x62, 0xbe, 0x3e, 0x94, 0x05, 0x02, 0x03, 0x3f, 0x40, 0xfc,
+  0x7c, 0xfe, 0x7e, 0x7c, 0x7d, 0x3c, 0x3d, 0x95, 0x04, 0x27, 0x28, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x46, 0x47, 0x96, 0x04, 0x8c, 0x0c, 0xdd,
+  0x5d, 0xfe, 0x7e, 0xfe, 0x7e, 0x10, 0x11, 0xe5, 0x00, 0x00, 0xff, 0x98,
+  0x08, 0x9a, 0x1a, 0xc9, 0x49, 0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0xfa,
+  0x7a, 0xb2, 0x32, 0xb2, 0x32, 0x30, 0x31, 0x8e, 0x0d, 0x03, 0x04, 0x97,
+  0x17, 0xb1, 0x31, 0x63, 0x64, 0x71, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfd, 0x7d, 0x39,
+  0x3a, 0x8d, 0x0d, 0x93, 0x13, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x8c, 0x0e, 0xc9, 0x49, 0x7b,
+  0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xc8, 0x48, 0x8c, 0x0e, 0xfb, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf4, 0x74, 0x6a, 0x6b, 0xb5, 0x35, 0x9e, 0x1e, 0xf3,
+  0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6f, 0x70, 0x91, 0x11, 0x8c,
+  0x05, 0x50, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0xb9, 0x39, 0x1b,
+  0x1c, 0x81, 0x05, 0x21, 0x22, 0x77, 0x78, 0xfe, 0x7e, 0xfe, 0x7e, 0xed,
+  0x6d, 0x14, 0x15, 0x8d, 0x03, 0x02, 0x03, 0x06, 0x07, 0x06, 0x07, 0x04,
+  0x05, 0x82, 0x05, 0x1d, 0x1e, 0xd3, 0x53, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xc5, 0x45, 0x93, 0x07, 0x88, 0x08, 0xa7, 0x27, 0xf4, 0x74, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x78, 0x79, 0x21, 0x22, 0x04, 0x05, 0x93, 0x05, 0xc1,
+  0x41, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xec, 0x6c, 0xb9, 0x39, 0x93,
+  0x06, 0x0c, 0x0d, 0xb0, 0x30, 0xf9, 0x79, 0xfe, 0x7e, 0xfe, 0x7e, 0xeb,
+  0x6b, 0x10, 0x11, 0x94, 0x05, 0x31, 0x32, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xef, 0x6f, 0x93, 0x13, 0x94, 0x05, 0x21, 0x22, 0x7a, 0x7b, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xeb, 0x6b, 0x93, 0x13, 0x94, 0x05, 0xa6, 0x26, 0x77,
+  0x78, 0xfe, 0x7e, 0xfe, 0x7e, 0xec, 0x6c, 0x10, 0x11, 0x84, 0x04, 0x88,
+  0x08, 0x22, 0x23, 0xc3, 0x43, 0x6f, 0x70, 0x2b, 0x2c, 0x8a, 0x05, 0xd2,
+  0x52, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xef, 0x6f, 0x94, 0x14, 0x82,
+  0x07, 0x06, 0x07, 0x07, 0x08, 0xab, 0x2b, 0x5e, 0x5f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x7c, 0x7d, 0xae, 0x2e, 0x89, 0x10, 0x21, 0x22, 0x7c, 0x7d, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x6a, 0x6b, 0x92, 0x12, 0x00, 0x00, 0x11, 0x12, 0x39,
+  0x3a, 0x39, 0x3a, 0xf6, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xe5, 0x65, 0xb6, 0x36, 0x89, 0x10, 0x26, 0x27, 0xf6, 0x76, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xde, 0x5e, 0xa8, 0x28, 0x6b, 0x6c, 0xf1,
+  0x71, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x63,
+  0x64, 0xae, 0x2e, 0x0a, 0x0b, 0x89, 0x0f, 0x01, 0x02, 0x64, 0x65, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc, 0x7c, 0xfa, 0x7a, 0x46, 0x47, 0x2d,
+  0x2e, 0x06, 0x07, 0x8b, 0x0b, 0xb2, 0x32, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xd8, 0x58, 0xa5, 0x25, 0x8f, 0x0a, 0xb2, 0x32, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf5, 0x75, 0xe3, 0x63, 0x3b,
+  0x3c, 0x96, 0x16, 0x06, 0x07, 0x90, 0x06, 0x13, 0x14, 0xee, 0x6e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf2, 0x72, 0xb1, 0x31, 0x20, 0x21, 0xe3, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x9b, 0x07, 0x36, 0x37, 0xb6, 0x36, 0xc0, 0x40, 0xfe,
+  0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0x54, 0x55, 0x8d, 0x0d, 0x9a,
+  0x1a, 0xa4, 0x24, 0xa4, 0x24, 0xe2, 0x62, 0xec, 0x6c, 0xec, 0x6c, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x89, 0x11, 0x8d, 0x0d, 0x92, 0x12, 0xda, 0x5a, 0xda,
+  0x5a, 0x73, 0x74, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x49, 0x4a, 0x88, 0x12, 0x80, 0x00, 0xda, 0x5a, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xdf, 0x5f, 0x35, 0x36, 0x3f, 0x40, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x35, 0x36, 0x88, 0x08, 0x14,
+  0x15, 0xee, 0x6e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xde,
+  0x5e, 0x47, 0x48, 0xb3, 0x33, 0x82, 0x05, 0x0f, 0x10, 0xe9, 0x69, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x6d, 0x6e, 0xbd, 0x3d, 0x8a, 0x05, 0xc0, 0x40, 0xd9,
+  0x59, 0xd9, 0x59, 0x44, 0x45, 0x91, 0x11, 0x87, 0x07, 0x83, 0x05, 0xc3,
+  0x43, 0xf1, 0x71, 0x7d, 0x7e, 0x7d, 0x7e, 0x6e, 0x6f, 0x3f, 0x40, 0x93,
+  0x06, 0x97, 0x17, 0xda, 0x5a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7a, 0x7b, 0xeb,
+  0x6b, 0x94, 0x14, 0x93, 0x05, 0xbe, 0x3e, 0xee, 0x6e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x41, 0x42, 0x93, 0x06, 0x9f, 0x1f, 0xd5, 0x55, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0x09, 0x0a, 0x92, 0x07, 0x8a,
+  0x0a, 0x2e, 0x2f, 0xf6, 0x76, 0xfe, 0x7e, 0x7d, 0x7e, 0x6d, 0x6e, 0x91,
+  0x11, 0x09, 0x0a, 0x92, 0x08, 0x07, 0x08, 0xda, 0x5a, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xf8, 0x78, 0xda, 0x5a, 0x8a, 0x0a, 0x92,
+  0x09, 0x97, 0x17, 0x73, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe7, 0x67, 0x33, 0x34, 0x92, 0x09, 0x4d,
+  0x4e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x23, 0x24, 0x91, 0x09, 0x04, 0x05, 0x91,
+  0x11, 0x91, 0x11, 0x91, 0x11, 0x91, 0x11, 0xca, 0x4a, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xe1, 0x61, 0x96, 0x04, 0x92, 0x12, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xeb, 0x6b, 0x95, 0x05, 0xbe, 0x3e, 0x4f, 0x50, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xeb, 0x6b, 0x8e, 0x0c, 0xa7, 0x27, 0xb6,
+  0x36, 0xb6, 0x36, 0xb6, 0x36, 0xb6, 0x36, 0xdf, 0x5f, 0xff, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x23, 0x24, 0x8c,
+  0x0e, 0x6c, 0x6d, 0xec, 0x6c, 0x78, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x6e, 0x6f, 0x9b, 0x1b, 0x04, 0x05, 0x8c, 0x0c, 0xc2, 0x42, 0x70,
+  0x71, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7a, 0x7b, 0xeb,
+  0x6b, 0xec, 0x6c, 0xeb, 0x6b, 0x37, 0x38, 0xa3, 0x23, 0x94, 0x14, 0x8f,
+  0x05, 0x8f, 0x0f, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x2d,
+  0x2e, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a, 0x02, 0x41, 0x42, 0x7e,
+  0x7f, 0x4b, 0x4c, 0x85, 0x01, 0x24, 0x25, 0x1a, 0x1b, 0x8f, 0x03, 0x91,
+  0x11, 0x6f, 0x70, 0xfe, 0x7e, 0xd6, 0x56, 0x83, 0x03, 0x0b, 0x0c, 0xbb,
+  0x3b, 0x7a, 0x7b, 0x39, 0x3a, 0x8f, 0x03, 0xe6, 0x66, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xac, 0x2c, 0x82, 0x04, 0x20, 0x21, 0x60, 0x61, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x39, 0x3a, 0x8d, 0x05, 0x8e, 0x0e, 0xde, 0x5e, 0xfb, 0x7b, 0xfe,
+  0x7e, 0x5c, 0x5d, 0x0a, 0x0b, 0x81, 0x05, 0xa7, 0x27, 0xfa, 0x7a, 0xfe,
+  0x7e, 0x79, 0x7a, 0xdd, 0x5d, 0x0d, 0x0e, 0x8c, 0x0c, 0x8e, 0x0e, 0x6a,
+  0x6b, 0xfe, 0x7e, 0xfe, 0x7e, 0x5d, 0x5e, 0x0a, 0x0b, 0x00, 0x00, 0x80,
+  0x00, 0x91, 0x11, 0x62, 0x63, 0xfe, 0x7e, 0xfe, 0x7e, 0xe0, 0x60, 0x8d,
+  0x05, 0x8e, 0x0e, 0x69, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0x5f, 0x60, 0x89,
+  0x09, 0x81, 0x05, 0x87, 0x07, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe8,
+  0x68, 0x0e, 0x0f, 0x8c, 0x05, 0x31, 0x32, 0x6a, 0x6b, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x61, 0x62, 0x86, 0x06, 0x81, 0x05, 0x87, 0x07, 0x63, 0x64, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x68, 0x69, 0x8d, 0x0d, 0x8c, 0x05, 0x90, 0x10, 0xed,
+  0x6d, 0xfe, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x83, 0x03, 0x82, 0x04, 0x50,
+  0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0x0a, 0x0b, 0x8c, 0x05, 0x91,
+  0x11, 0xea, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0x5f, 0x60, 0x86, 0x06, 0x82,
+  0x04, 0x2d, 0x2e, 0x79, 0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0x32, 0x33, 0x8d,
+  0x04, 0xc2, 0x42, 0xfe, 0x7e, 0xfe, 0x7e, 0x5d, 0x5e, 0x89, 0x09, 0x82,
+  0x05, 0x9c, 0x1c, 0xf8, 0x78, 0xfe, 0x7e, 0x7b, 0x7c, 0x97, 0x17, 0x81,
+  0x01, 0x8c, 0x04, 0xb8, 0x38, 0x7b, 0x7c, 0xfe, 0x7e, 0x5c, 0x5d, 0x0a,
+  0x0b, 0x82, 0x08, 0x08, 0x09, 0x58, 0x59, 0xfe, 0x7e, 0xfe, 0x7e, 0x7b,
+  0x7c, 0x98, 0x18, 0xb4, 0x34, 0x54, 0x55, 0x0e, 0x0f, 0x8a, 0x0f, 0x7e,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0x9e, 0x1e, 0x01, 0x02, 0x0d, 0x0e, 0x0d,
+  0x0e, 0x0d, 0x0e, 0x5a, 0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf1, 0x71, 0x26, 0x27, 0x8b, 0x0e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x54, 0x55, 0xcf, 0x4f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc, 0x7c, 0x53, 0x54, 0xb6,
+  0x36, 0x02, 0x03, 0x8c, 0x0b, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x72, 0x73, 0x16, 0x17, 0x8f, 0x0a, 0xa6, 0x26, 0xde, 0x5e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xf0, 0x70, 0x97, 0x17, 0x91, 0x08, 0x86, 0x06, 0x10, 0x11, 0x10,
+  0x11, 0x10, 0x11, 0x16, 0x17, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa0,
+  0x20, 0x96, 0x04, 0x17, 0x18, 0xfe, 0x7e, 0xfe, 0x7e, 0xca, 0x4a, 0x04,
+  0x05, 0x96, 0x03, 0xcb, 0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0x8d, 0x0d, 0x97,
+  0x03, 0xcb, 0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0x8d, 0x0d, 0x97, 0x03, 0xa6,
+  0x26, 0xfe, 0x7e, 0xfe, 0x7e, 0x8d, 0x0d, 0xe0, 0x00, 0x00, 0xff, 0x96,
+  0x09, 0xb9, 0x39, 0x77, 0x78, 0xff, 0x7f, 0x71, 0x72, 0x94, 0x14, 0xa1,
+  0x21, 0x3a, 0x3b, 0x3a, 0x3b, 0x3a, 0x3b, 0x8c, 0x0c, 0x8f, 0x0c, 0x02,
+  0x03, 0xd3, 0x53, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf8,
+  0x78, 0xfa, 0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x65, 0x66, 0x8e,
+  0x0e, 0x8e, 0x0c, 0x04, 0x05, 0x6b, 0x6c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xa5, 0x25, 0x8f, 0x0b, 0xb3, 0x33, 0x62, 0x63, 0xfb,
+  0x7b, 0x76, 0x77, 0x62, 0x63, 0x62, 0x63, 0x3b, 0x3c, 0x2b, 0x2c, 0x7a,
+  0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xa5, 0x25, 0x91, 0x01, 0xa4, 0x24, 0x1d,
+  0x1e, 0x81, 0x05, 0x82, 0x02, 0x69, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0x5f,
+  0x60, 0x0b, 0x0c, 0x94, 0x05, 0x00, 0x01, 0x2f, 0x30, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x1a, 0x1b, 0x95, 0x05, 0xb1, 0x31, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x68, 0x69, 0x8d, 0x0d, 0x94, 0x05, 0x8a, 0x0a, 0xe5,
+  0x65, 0xfe, 0x7e, 0xfe, 0x7e, 0x4b, 0x4c, 0x01, 0x02, 0x94, 0x05, 0x8c,
+  0x0c, 0xe1, 0x61, 0xfe, 0x7e, 0xfe, 0x7e, 0xe8, 0x68, 0x8b, 0x0b, 0x95,
+  0x04, 0xb5, 0x35, 0xfe, 0x7e, 0xfe, 0x7e, 0x7b, 0x7c, 0x0b, 0x0c, 0x95,
+  0x04, 0x15, 0x16, 0xeb, 0x6b, 0xfe, 0x7e, 0x7b, 0x7c, 0xbe, 0x3e, 0x90,
+  0x11, 0x84, 0x04, 0x0d, 0x0e, 0x0d, 0x0e, 0x0d, 0x0e, 0x0d, 0x0e, 0x2b,
+  0x2c, 0x79, 0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0xd2, 0x52, 0xd2,
+  0x52, 0xd2, 0x52, 0xd2, 0x52, 0xd2, 0x52, 0xd2, 0x52, 0xd2, 0x52, 0x25,
+  0x26, 0x88, 0x12, 0x9d, 0x1d, 0xd8, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfd, 0x7d, 0x7a,
+  0x7b, 0x7a, 0x7b, 0xb8, 0x38, 0x87, 0x10, 0x1c, 0x1d, 0xf9, 0x79, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xc8, 0x48, 0x30, 0x31, 0x8a, 0x0f, 0x7b, 0x7c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xec,
+  0x6c, 0xb8, 0x38, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x00, 0x01, 0x8b, 0x08, 0x68, 0x69, 0x6e, 0x6f, 0x54, 0x55, 0xa1,
+  0x21, 0x1f, 0x20, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x96, 0x16, 0x92,
+  0x08, 0x8c, 0x0c, 0x10, 0x11, 0x00, 0x00, 0x06, 0x07, 0x50, 0x51, 0xfe,
+  0x7e, 0xee, 0x6e, 0xc1, 0x41, 0x02, 0x03, 0x95, 0x03, 0x26, 0x27, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xbd, 0x3d, 0x97, 0x03, 0x5f, 0x60, 0x7c, 0x7d, 0x4a,
+  0x4b, 0x97, 0x17, 0x97, 0x01, 0x5f, 0x60, 0xed, 0x6d, 0xe6, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x98, 0x0a, 0x89, 0x09, 0xb4, 0x34, 0x34, 0x35, 0xb4,
+  0x34, 0xe4, 0x64, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x63,
+  0x64, 0x2a, 0x2b, 0x8d, 0x0e, 0x95, 0x15, 0x1d, 0x1e, 0x63, 0x64, 0x6b,
+  0x6c, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x79, 0x7a, 0x2a, 0x2b, 0x89,
+  0x11, 0x80, 0x00, 0x87, 0x07, 0xc9, 0x49, 0x70, 0x71, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7b, 0x7c, 0xf6, 0x76, 0xf6,
+  0x76, 0xf6, 0x76, 0x76, 0x77, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xb3,
+  0x33, 0x89, 0x09, 0x2a, 0x2b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xc2, 0x42, 0x32, 0x33, 0x82,
+  0x04, 0x0e, 0x0f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xb3, 0x33, 0x89,
+  0x07, 0x51, 0x52, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x69, 0x6a, 0x92,
+  0x12, 0x8e, 0x0e, 0x8e, 0x0e, 0x83, 0x05, 0x8b, 0x0b, 0xdb, 0x5b, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x76, 0x77, 0xa4, 0x24, 0x89, 0x04, 0x9c, 0x1c, 0x6e,
+  0x6f, 0x58, 0x59, 0x24, 0x25, 0x91, 0x11, 0x85, 0x05, 0x87, 0x07, 0xdb,
+  0x5b, 0x7d, 0x7e, 0x7d, 0x7e, 0xf8, 0x78, 0xaf, 0x2f, 0x94, 0x05, 0x03,
+  0x04, 0xde, 0x5e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x29, 0x2a, 0x93,
+  0x07, 0x12, 0x13, 0xbe, 0x3e, 0xf7, 0x77, 0x7d, 0x7e, 0x7d, 0x7e, 0xf8,
+  0x78, 0x29, 0x2a, 0x80, 0x00, 0x93, 0x05, 0xed, 0x6d, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x69, 0x6a, 0xaf, 0x2f, 0x94, 0x05, 0xac, 0x2c, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xda, 0x5a, 0x05, 0x06, 0x93, 0x05, 0xb1,
+  0x31, 0xed, 0x6d, 0xfe, 0x7e, 0xff, 0x7f, 0x71, 0x72, 0x9a, 0x1a, 0x93,
+  0x06, 0x9e, 0x1e, 0x67, 0x68, 0xfc, 0x7c, 0x7d, 0x7e, 0x7d, 0x7e, 0xc1,
+  0x41, 0x10, 0x11, 0x92, 0x06, 0x03, 0x04, 0x1d, 0x1e, 0x70, 0x71, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x6e, 0x6f, 0x2b, 0x2c, 0x93, 0x06, 0x03, 0x04, 0x5a,
+  0x5b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe8, 0x68, 0x36, 0x37, 0x93,
+  0x06, 0x08, 0x09, 0xd6, 0x56, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x69,
+  0x6a, 0x8d, 0x0d, 0x82, 0x04, 0x08, 0x09, 0x29, 0x2a, 0xef, 0x6f, 0xef,
+  0x6f, 0xe2, 0x62, 0x8b, 0x0f, 0x86, 0x06, 0x54, 0x55, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xbe, 0x3e, 0x99, 0x19, 0x0e, 0x0f, 0x9c, 0x1c, 0x58,
+  0x59, 0xd9, 0x59, 0x61, 0x62, 0x7d, 0x7e, 0x7d, 0x7e, 0xf9, 0x79, 0x35,
+  0x36, 0x8b, 0x0e, 0xdb, 0x5b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x53, 0x54, 0x61, 0x62, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x79, 0x7a, 0x3a, 0x3b, 0xa9, 0x29, 0x8c, 0x0c, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xd8, 0x58, 0xa0,
+  0x20, 0x8e, 0x0b, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe8, 0x68, 0xe7, 0x67, 0x3b, 0x3c, 0x9d,
+  0x1d, 0x04, 0x05, 0x8f, 0x07, 0x33, 0x34, 0x70, 0x71, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x48, 0x49, 0xb3, 0x33, 0x02, 0x03, 0xe2, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xb8, 0x04, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40, 0x3f,
+  0x40, 0x1f, 0x20, 0x90, 0x0b, 0x3f, 0x40, 0x3f, 0x40, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x8d, 0x0d, 0x3f, 0x40, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8d,
+  0x05, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x3f, 0x40, 0x3f,
+  0x40, 0x81, 0x05, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x8d, 0x01, 0x3f, 0x40, 0x1f, 0x20, 0x85, 0x03, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x95, 0x04, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x93, 0x05, 0x1f, 0x20, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x94, 0x04, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x94, 0x06, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x1f,
+  0x20, 0x93, 0x0a, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x1f,
+  0x20, 0x82, 0x00, 0x1f, 0x20, 0x8c, 0x0b, 0x1f, 0x20, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x1f, 0x20, 0x93, 0x07, 0x1f, 0x20, 0x3f,
+  0x40, 0x3f, 0x40, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x97, 0x03, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x96,
+  0x04, 0x1f, 0x20, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8a,
+  0x01, 0x1f, 0x20, 0xdf, 0x5f, 0x86, 0x07, 0x1f, 0x20, 0x3f, 0x40, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x8a,
+  0x0e, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8c, 0x0c, 0x3f, 0x40, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x1f, 0x20, 0x90,
+  0x03, 0x1f, 0x20, 0x3f, 0x40, 0x3f, 0x40, 0x1f, 0x20, 0xff, 0x82, 0x00,
+  0x00, 0x00, 0xff, 0xda, 0x02, 0x06, 0x07, 0x48, 0x49, 0xc5, 0x45, 0x8d,
+  0x01, 0x13, 0x14, 0x83, 0x03, 0x87, 0x03, 0x13, 0x14, 0x5b, 0x5c, 0x7d,
+  0x7e, 0x99, 0x19, 0x8c, 0x03, 0x9a, 0x1a, 0xf7, 0x77, 0x2b, 0x2c, 0x02,
+  0x03, 0x84, 0x05, 0x8e, 0x0e, 0xd3, 0x53, 0xf7, 0x77, 0x7d, 0x7e, 0x56,
+  0x57, 0x01, 0x02, 0x8b, 0x04, 0x44, 0x45, 0x68, 0x69, 0x7d, 0x7e, 0xab,
+  0x2b, 0x02, 0x03, 0x83, 0x05, 0x23, 0x24, 0xe0, 0x60, 0x76, 0x77, 0x7d,
+  0x7e, 0xab, 0x2b, 0x10, 0x11, 0x8b, 0x04, 0x27, 0x28, 0xf7, 0x77, 0x71,
+  0x72, 0x3f, 0x40, 0x83, 0x03, 0x82, 0x06, 0x84, 0x04, 0x32, 0x33, 0xf6,
+  0x76, 0x7d, 0x7e, 0x7d, 0x7e, 0xc7, 0x47, 0x83, 0x03, 0x8a, 0x04, 0x8a,
+  0x0a, 0xec, 0x6c, 0xf8, 0x78, 0x7d, 0x7e, 0x25, 0x26, 0x83, 0x06, 0x9c,
+  0x1c, 0x6d, 0x6e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf2, 0x72, 0x1f, 0x20, 0x83,
+  0x03, 0x8b, 0x04, 0x42, 0x43, 0x7d, 0x7e, 0x7d, 0x7e, 0xc5, 0x45, 0x02,
+  0x03, 0x83, 0x04, 0x78, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0xf3, 0x73, 0x19,
+  0x1a, 0x8c, 0x04, 0x3f, 0x40, 0xfb, 0x7b, 0x7d, 0x7e, 0xad, 0x2d, 0x84,
+  0x04, 0x82, 0x06, 0x9a, 0x1a, 0x75, 0x76, 0xfe, 0x7e, 0x7d, 0x7e, 0xf5,
+  0x75, 0xb5, 0x35, 0x1c, 0x1d, 0x8c, 0x0c, 0xdf, 0x5f, 0xfe, 0x7e, 0x75,
+  0x76, 0x19, 0x1a, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x9d, 0x1d, 0x78,
+  0x79, 0xfe, 0x7e, 0xff, 0x7f, 0x7d, 0x7e, 0xe7, 0x67, 0x8e, 0x0b, 0x47,
+  0x48, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf8, 0x78, 0xd2, 0x52, 0x30, 0x31, 0x8f,
+  0x09, 0x33, 0x34, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xed, 0x6d, 0xb8, 0x38, 0x91, 0x08, 0x01,
+  0x02, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0xda, 0x5a, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x74, 0x75, 0x89, 0x09, 0x95, 0x04, 0x05, 0x06, 0x51, 0x52, 0x7d,
+  0x7e, 0xe5, 0x65, 0x9e, 0x1e, 0x96, 0x03, 0x0c, 0x0d, 0x6c, 0x6d, 0xf3,
+  0x73, 0x10, 0x11, 0x97, 0x03, 0x0c, 0x0d, 0x6c, 0x6d, 0x6a, 0x6b, 0x8b,
+  0x0b, 0x97, 0x02, 0x83, 0x03, 0x11, 0x12, 0x8c, 0x0c, 0xff, 0x9b, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xa3, 0x0e, 0x84, 0x04, 0xb6, 0x36, 0xbc, 0x3c,
+  0x25, 0x26, 0x25, 0x26, 0x4d, 0x4e, 0xd7, 0x57, 0xd7, 0x57, 0xd7, 0x57,
+  0xd7, 0x57, 0xd7, 0x57, 0xd7, 0x57, 0xd7, 0x57, 0xd7, 0x57, 0x43, 0x44,
+  0x8a, 0x10, 0x81, 0x01, 0x1d, 0x1e, 0x6f, 0x70, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfb, 0x7b, 0x6f, 0x70, 0x6f, 0x70,
+  0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0x6f, 0x70, 0xe7, 0x67, 0xaa, 0x2a,
+  0x8a, 0x08, 0x52, 0x53, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xde, 0x5e, 0xa3, 0x23, 0x22, 0x23, 0x9a, 0x1a, 0x90, 0x07, 0x00, 0x01,
+  0x54, 0x55, 0xfe, 0x7e, 0xf9, 0x79, 0xd1, 0x51, 0x14, 0x15, 0x87, 0x07,
+  0x01, 0x02, 0x93, 0x03, 0x51, 0x52, 0x7e, 0x7f, 0xf7, 0x77, 0x14, 0x15,
+  0x96, 0x04, 0x15, 0x16, 0xfa, 0x7a, 0x7e, 0x7f, 0xa8, 0x28, 0x07, 0x08,
+  0x97, 0x05, 0x3f, 0x40, 0xfe, 0x7e, 0x7e, 0x7f, 0xdf, 0x5f, 0x2e, 0x2f,
+  0x01, 0x02, 0x96, 0x05, 0xab, 0x2b, 0xef, 0x6f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xef, 0x6f, 0x90, 0x10, 0x96, 0x04, 0x8d, 0x0d, 0xd6, 0x56, 0x7e, 0x7f,
+  0x7e, 0x7f, 0xbc, 0x3c, 0x95, 0x05, 0x08, 0x09, 0xa7, 0x27, 0xe1, 0x61,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xdd, 0x5d, 0x93, 0x07, 0xdd, 0x5d, 0xf0, 0x70,
+  0xf4, 0x74, 0x7e, 0x7f, 0x7e, 0x7f, 0x7d, 0x7e, 0xf2, 0x72, 0x1f, 0x20,
+  0x93, 0x05, 0xa5, 0x25, 0xce, 0x4e, 0x56, 0x57, 0x56, 0x57, 0xc8, 0x48,
+  0x20, 0x21, 0xff, 0xb6, 0x00, 0x00, 0xff, 0x81, 0x04, 0x17, 0x18, 0xcc,
+  0x4c, 0xf5, 0x75, 0xf5, 0x75, 0x3c, 0x3d, 0x94, 0x06, 0x0b, 0x0c, 0x6a,
+  0x6b, 0x74, 0x75, 0x7e, 0x7f, 0x7e, 0x7f, 0xd0, 0x50, 0x10, 0x11, 0x93,
+  0x06, 0xb8, 0x38, 0x63, 0x64, 0x7e, 0x7f, 0x7e, 0x7f, 0xd7, 0x57, 0x9e,
+  0x1e, 0x86, 0x06, 0x93, 0x05, 0xc6, 0x46, 0x5d, 0x5e, 0x7e, 0x7f, 0xf3,
+  0x73, 0x28, 0x29, 0x98, 0x18, 0x92, 0x06, 0x03, 0x04, 0xa5, 0x25, 0x4b,
+  0x4c, 0x75, 0x76, 0x7d, 0x7e, 0x70, 0x71, 0x96, 0x16, 0x93, 0x05, 0xa7,
+  0x27, 0xe1, 0x61, 0x7e, 0x7f, 0x7e, 0x7f, 0xed, 0x6d, 0x31, 0x32, 0x94,
+  0x05, 0x25, 0x26, 0xe2, 0x62, 0x7e, 0x7f, 0x7e, 0x7f, 0xcd, 0x4d, 0xb4,
+  0x34, 0x94, 0x05, 0xa2, 0x22, 0x64, 0x65, 0x7e, 0x7f, 0x7e, 0x7f, 0xeb,
+  0x6b, 0xae, 0x2e, 0x81, 0x06, 0x9d, 0x1d, 0xad, 0x2d, 0xad, 0x2d, 0xad,
+  0x2d, 0xad, 0x2d, 0x3d, 0x3e, 0xba, 0x3a, 0x8b, 0x11, 0x8a, 0x0a, 0xc3,
+  0x43, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x0f, 0x10, 0x9f, 0x1f, 0x22,
+  0x23, 0x54, 0x55, 0x76, 0x77, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xfb, 0x7b, 0x61, 0x62, 0x0f, 0x10, 0x89, 0x11, 0xb3,
+  0x33, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x5d, 0x5e, 0xfb,
+  0x7b, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xdf, 0x5f, 0x88,
+  0x12, 0x85, 0x05, 0xed, 0x6d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0x74, 0x75, 0xf1, 0x71, 0x49,
+  0x4a, 0xac, 0x2c, 0xac, 0x2c, 0x46, 0x47, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xdf, 0x5f, 0x88, 0x09, 0xb2, 0x32, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7b, 0x7c, 0x7b, 0x7c, 0xc3, 0x43, 0x0e,
+  0x0f, 0x83, 0x04, 0xab, 0x2b, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x5d,
+  0x5e, 0x88, 0x06, 0xf5, 0x75, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7b,
+  0x7c, 0x40, 0x41, 0x81, 0x01, 0x85, 0x04, 0xbb, 0x3b, 0x76, 0x77, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x74, 0x75, 0x88, 0x05, 0xb8, 0x38, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x73, 0x74, 0x41, 0x42, 0x05, 0x06, 0x84, 0x07, 0x05, 0x06, 0x35,
+  0x36, 0x78, 0x79, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x76, 0x77, 0x1f,
+  0x20, 0x88, 0x11, 0xe0, 0x60, 0x7e, 0x7f, 0x7e, 0x7f, 0xec, 0x6c, 0x29,
+  0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0xbc, 0x3c, 0xee,
+  0x6e, 0xf0, 0x70, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x5a, 0x5b, 0x9f,
+  0x1f, 0x0d, 0x0e, 0x89, 0x0f, 0x51, 0x52, 0x6b, 0x6c, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x6f, 0x70, 0x43, 0x44, 0x03,
+  0x04, 0x8c, 0x0c, 0x28, 0x29, 0xea, 0x6a, 0xfa, 0x7a, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfb, 0x7b, 0xea,
+  0x6a, 0x42, 0x43, 0x93, 0x13, 0x90, 0x07, 0xa4, 0x24, 0x2f, 0x30, 0x2f,
+  0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x26, 0x27, 0xff,
+  0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb7, 0x03, 0x01, 0x02, 0x86,
+  0x06, 0x86, 0x06, 0x81, 0x01, 0x8f, 0x0c, 0x00, 0x01, 0x89, 0x09, 0x89,
+  0x09, 0xb1, 0x31, 0x1e, 0x1f, 0x15, 0x16, 0xc7, 0x47, 0xc7, 0x47, 0xd6,
+  0x56, 0x7e, 0x7f, 0x7e, 0x7f, 0x3b, 0x3c, 0x81, 0x01, 0x8e, 0x0c, 0xae,
+  0x2e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x92,
+  0x12, 0x8e, 0x0c, 0x3f, 0x40, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7b, 0x7c, 0xef, 0x6f, 0xef, 0x6f, 0x73, 0x74, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x92, 0x12, 0x8e, 0x0c, 0x83, 0x03, 0xae, 0x2e, 0xae,
+  0x2e, 0xae, 0x2e, 0xae, 0x2e, 0xa5, 0x25, 0x00, 0x00, 0x04, 0x05, 0xce,
+  0x4e, 0x7e, 0x7f, 0x7e, 0x7f, 0x59, 0x5a, 0x06, 0x07, 0x95, 0x04, 0x29,
+  0x2a, 0x7e, 0x7f, 0x7e, 0x7f, 0xe4, 0x64, 0x87, 0x07, 0x95, 0x04, 0x1f,
+  0x20, 0xf4, 0x74, 0x7e, 0x7f, 0xeb, 0x6b, 0xa7, 0x27, 0x95, 0x04, 0x11,
+  0x12, 0xf4, 0x74, 0x7e, 0x7f, 0xf7, 0x77, 0x95, 0x15, 0x95, 0x04, 0x85,
+  0x05, 0xd0, 0x50, 0x7e, 0x7f, 0x7e, 0x7f, 0xcd, 0x4d, 0x96, 0x04, 0x26,
+  0x27, 0x7e, 0x7f, 0x7e, 0x7f, 0xe7, 0x67, 0x87, 0x07, 0x82, 0x05, 0x0c,
+  0x0d, 0x14, 0x15, 0x9f, 0x1f, 0xa2, 0x22, 0xa2, 0x22, 0xa2, 0x22, 0x88,
+  0x12, 0x01, 0x02, 0xa5, 0x25, 0xa5, 0x25, 0xa5, 0x25, 0x2e, 0x2f, 0x75,
+  0x76, 0x7e, 0x7f, 0x7e, 0x7f, 0xc1, 0x41, 0x9c, 0x1c, 0xd6, 0x56, 0xe3,
+  0x63, 0xe3, 0x63, 0x6d, 0x6e, 0xf4, 0x74, 0xfc, 0x7c, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x6c, 0x6d, 0x87, 0x13, 0x96, 0x16, 0x67, 0x68, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf9,
+  0x79, 0xf9, 0x79, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf0, 0x70, 0xd6,
+  0x56, 0xd6, 0x56, 0xd6, 0x56, 0x9b, 0x1b, 0x8c, 0x0c, 0x87, 0x0e, 0xf5,
+  0x75, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x5f, 0x60, 0xd3, 0x53, 0xd3, 0x53, 0xd3, 0x53, 0x3f,
+  0x40, 0x95, 0x15, 0x8d, 0x0d, 0x8c, 0x08, 0x68, 0x69, 0x65, 0x66, 0x4b,
+  0x4c, 0x1c, 0x1d, 0x7e, 0x7f, 0x7e, 0x7f, 0x76, 0x77, 0x25, 0x26, 0x85,
+  0x05, 0x92, 0x06, 0x07, 0x08, 0x06, 0x07, 0x00, 0x00, 0x8c, 0x0c, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xe9, 0x69, 0x97, 0x03, 0x87, 0x07, 0xea, 0x6a, 0xff,
+  0x7f, 0xe9, 0x69, 0x98, 0x02, 0x8d, 0x0d, 0x6a, 0x6b, 0xe9, 0x69, 0x99,
+  0x01, 0x03, 0x04, 0x04, 0x05, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd6,
+  0x05, 0x95, 0x15, 0x33, 0x34, 0xe7, 0x67, 0xe7, 0x67, 0xd2, 0x52, 0x84,
+  0x04, 0x91, 0x09, 0x85, 0x05, 0x39, 0x3a, 0xe3, 0x63, 0x72, 0x73, 0x77,
+  0x78, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x3f, 0x40, 0x8f,
+  0x0b, 0x89, 0x09, 0x3f, 0x40, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0x74,
+  0x75, 0x72, 0x73, 0x39, 0x3a, 0x39, 0x3a, 0xcc, 0x4c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x8d, 0x07, 0x84, 0x04, 0x26, 0x27, 0x75, 0x76, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xdd, 0x5d, 0x88, 0x08, 0x82, 0x02, 0x22, 0x23, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x8c, 0x07, 0x12, 0x13, 0xcd, 0x4d, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfb, 0x7b, 0x36, 0x37, 0x89, 0x09, 0x83, 0x02, 0xcc,
+  0x4c, 0x7d, 0x7e, 0x53, 0x54, 0x8b, 0x06, 0x95, 0x15, 0xf4, 0x74, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x68, 0x69, 0x2e, 0x2f, 0x84, 0x03, 0x41,
+  0x42, 0x77, 0x78, 0x7d, 0x7e, 0x95, 0x15, 0x8a, 0x06, 0x95, 0x15, 0x72,
+  0x73, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x68, 0x69, 0x0a, 0x0b, 0x84,
+  0x04, 0xbf, 0x3f, 0x79, 0x7a, 0x7d, 0x7e, 0x39, 0x3a, 0x00, 0x01, 0x89,
+  0x06, 0x12, 0x13, 0xf4, 0x74, 0xfe, 0x7e, 0xf3, 0x73, 0x9f, 0x1f, 0xe3,
+  0x63, 0x14, 0x15, 0x83, 0x04, 0x99, 0x19, 0xdf, 0x5f, 0xff, 0x7f, 0xfc,
+  0x7c, 0xb9, 0x39, 0x8a, 0x04, 0x0e, 0x0f, 0xcd, 0x4d, 0x7d, 0x7e, 0xf3,
+  0x73, 0x14, 0x15, 0x84, 0x05, 0x84, 0x04, 0x40, 0x41, 0x60, 0x61, 0x7d,
+  0x7e, 0xfc, 0x7c, 0xba, 0x3a, 0x8a, 0x04, 0x83, 0x03, 0x5c, 0x5d, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x1a, 0x1b, 0x83, 0x06, 0x0f, 0x10, 0x41, 0x42, 0xe2,
+  0x62, 0x7d, 0x7e, 0x7d, 0x7e, 0xee, 0x6e, 0x9f, 0x1f, 0x8b, 0x04, 0x20,
+  0x21, 0x7d, 0x7e, 0x7d, 0x7e, 0x57, 0x58, 0x01, 0x02, 0x81, 0x07, 0x21,
+  0x22, 0x42, 0x43, 0x71, 0x72, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x42,
+  0x43, 0x8c, 0x0c, 0x8c, 0x0d, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0xca,
+  0x4a, 0x39, 0x3a, 0xd9, 0x59, 0x72, 0x73, 0x7a, 0x7b, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xf9, 0x79, 0xc4, 0x44, 0x1a, 0x1b, 0x01, 0x02, 0x8d, 0x09, 0x79,
+  0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x74, 0x75, 0x3e, 0x3f, 0x91, 0x08, 0x18, 0x19, 0x51,
+  0x52, 0x66, 0x67, 0x66, 0x67, 0x66, 0x67, 0xe7, 0x67, 0x41, 0x42, 0x2d,
+  0x2e, 0x88, 0x08, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f,
+  0x04, 0x8a, 0x0a, 0xd8, 0x58, 0x7e, 0x7f, 0xff, 0x7f, 0x3d, 0x3e, 0x96,
+  0x04, 0xd8, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x94,
+  0x06, 0xaf, 0x2f, 0x6c, 0x6d, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6,
+  0x76, 0x9e, 0x1e, 0x93, 0x06, 0x07, 0x08, 0xd5, 0x55, 0xfe, 0x7e, 0x7e,
+  0x7f, 0xfe, 0x7e, 0xf6, 0x76, 0x28, 0x29, 0x94, 0x05, 0xd3, 0x53, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0x2a, 0x2b, 0x93, 0x06, 0x8a,
+  0x0a, 0xd8, 0x58, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf5, 0x75, 0x26,
+  0x27, 0x94, 0x05, 0xd8, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x5a, 0x5b, 0x93, 0x07, 0x07, 0x08, 0xd3, 0x53, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0x2a, 0x2b, 0x8c, 0x0c, 0x92, 0x06, 0x07,
+  0x08, 0xd5, 0x55, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xf6, 0x76, 0x28,
+  0x29, 0x94, 0x05, 0xd3, 0x53, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0x49,
+  0x4a, 0x9e, 0x1e, 0x93, 0x06, 0x8a, 0x0a, 0xd8, 0x58, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xf5, 0x75, 0x26, 0x27, 0x94, 0x05, 0xd8, 0x58, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x26, 0x27, 0x92, 0x07, 0x02,
+  0x03, 0x92, 0x12, 0xd3, 0x53, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6,
+  0x76, 0x9e, 0x1e, 0x93, 0x06, 0x92, 0x12, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e,
+  0x7f, 0xfe, 0x7e, 0x4e, 0x4f, 0x28, 0x29, 0x94, 0x05, 0xd3, 0x53, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0x49, 0x4a, 0x04, 0x05, 0x93, 0x05, 0x8a,
+  0x0a, 0xd8, 0x58, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xc1, 0x41, 0x95,
+  0x04, 0xa4, 0x24, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x96,
+  0x04, 0x72, 0x73, 0xfe, 0x7e, 0xfb, 0x7b, 0x44, 0x45, 0x04, 0x05, 0x96,
+  0x02, 0xff, 0x7f, 0xfe, 0x7e, 0x6b, 0x6c, 0x98, 0x02, 0x23, 0x24, 0x23,
+  0x24, 0x9e, 0x1e, 0xe7, 0x00, 0x00, 0xff, 0xb3, 0x07, 0x8a, 0x0a, 0x92,
+  0x12, 0x3b, 0x3c, 0x1c, 0x1d, 0xda, 0x5a, 0x5a, 0x5b, 0xda, 0x5a, 0x23,
+  0x24, 0x8f, 0x0c, 0x80, 0x00, 0x9f, 0x1f, 0x47, 0x48, 0x47, 0x48, 0x66,
+  0x67, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x75, 0x76, 0x1e, 0x1f, 0x8d, 0x0d, 0x07, 0x08, 0xdf, 0x5f, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x8d,
+  0x0d, 0x92, 0x12, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x68,
+  0x69, 0x59, 0x5a, 0x9b, 0x1b, 0x91, 0x11, 0x91, 0x11, 0x3f, 0x40, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x8d, 0x05, 0x85, 0x05, 0x4c, 0x4d, 0xeb,
+  0x6b, 0x56, 0x57, 0xa3, 0x23, 0x8f, 0x0f, 0x83, 0x03, 0xc0, 0x40, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x49, 0x4a, 0x96, 0x04, 0x29, 0x2a, 0xfe, 0x7e, 0x7d,
+  0x7e, 0xf3, 0x73, 0x16, 0x17, 0x94, 0x05, 0x0f, 0x10, 0xc0, 0x40, 0xfe,
+  0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x23, 0x24, 0x94, 0x06, 0xc3, 0x43, 0xf1,
+  0x71, 0x7d, 0x7e, 0x7d, 0x7e, 0x6e, 0x6f, 0x44, 0x45, 0x04, 0x05, 0x91,
+  0x07, 0x85, 0x05, 0x1c, 0x1d, 0xda, 0x5a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7a,
+  0x7b, 0xeb, 0x6b, 0x94, 0x14, 0x93, 0x05, 0xcd, 0x4d, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x41, 0x42, 0x93, 0x06, 0x9f, 0x1f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0x09, 0x0a, 0x81,
+  0x07, 0x97, 0x17, 0xb6, 0x36, 0xb6, 0x36, 0xb6, 0x36, 0xff, 0x7f, 0xe9,
+  0x69, 0x69, 0x6a, 0xfe, 0x7e, 0x88, 0x12, 0x9f, 0x1f, 0x57, 0x58, 0xf6,
+  0x76, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x76, 0x77, 0xec,
+  0x6c, 0xec, 0x6c, 0xec, 0x6c, 0xf4, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x63, 0x64, 0xb0, 0x30, 0x87, 0x12, 0xb1,
+  0x31, 0x78, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x70, 0x71, 0xeb, 0x6b, 0xec, 0x6c, 0xad, 0x2d, 0x09,
+  0x0a, 0x88, 0x0e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xf3,
+  0x73, 0x35, 0x36, 0x35, 0x36, 0x35, 0x36, 0x8f, 0x0f, 0x8c, 0x07, 0xff,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6e, 0x6f, 0x47,
+  0x48, 0x47, 0x48, 0x93, 0x05, 0x91, 0x11, 0x91, 0x11, 0x91, 0x11, 0x91,
+  0x11, 0x91, 0x11, 0x8c, 0x0c, 0xff, 0xb8, 0x00, 0x00, 0x00, 0xff, 0xb1,
+  0x01, 0x8b, 0x0b, 0x10, 0x11, 0x82, 0x06, 0x99, 0x19, 0xb5, 0x35, 0xb5,
+  0x35, 0xca, 0x4a, 0x77, 0x78, 0xc6, 0x46, 0x2c, 0x2d, 0x8d, 0x0e, 0x27,
+  0x28, 0x3f, 0x40, 0x73, 0x74, 0x74, 0x75, 0x4d, 0x4e, 0x70, 0x71, 0x70,
+  0x71, 0x77, 0x78, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7b, 0x7c, 0xa9, 0x29, 0x8b, 0x0f, 0x0e, 0x0f, 0xf0, 0x70, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xeb,
+  0x6b, 0x55, 0x56, 0x55, 0x56, 0x77, 0x78, 0x7d, 0x7e, 0x7d, 0x7e, 0xf7,
+  0x77, 0x9f, 0x1f, 0x8b, 0x0e, 0x09, 0x0a, 0xee, 0x6e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfa, 0x7a, 0xdc, 0x5c, 0xdc, 0x5c, 0x0d, 0x0e, 0x00,
+  0x00, 0x8c, 0x0c, 0xcc, 0x4c, 0x7d, 0x7e, 0x7d, 0x7e, 0x57, 0x58, 0x8d,
+  0x04, 0x1b, 0x1c, 0x20, 0x21, 0x20, 0x21, 0x20, 0x21, 0x9d, 0x1d, 0x83,
+  0x04, 0x3c, 0x3d, 0x7d, 0x7e, 0x7d, 0x7e, 0x69, 0x6a, 0x8a, 0x0a, 0x94,
+  0x05, 0x09, 0x0a, 0xd3, 0x53, 0x79, 0x7a, 0x7d, 0x7e, 0xdc, 0x5c, 0x9f,
+  0x1f, 0x95, 0x04, 0x42, 0x43, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x9a,
+  0x1a, 0x94, 0x06, 0x80, 0x00, 0x29, 0x2a, 0xfe, 0x7e, 0x7d, 0x7e, 0x77,
+  0x78, 0x3e, 0x3f, 0x0a, 0x0b, 0x94, 0x04, 0x06, 0x07, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x0c, 0x0d, 0x95, 0x05, 0x86, 0x06, 0xe2, 0x62, 0xfe,
+  0x7e, 0xff, 0x7f, 0x64, 0x65, 0x06, 0x07, 0x84, 0x01, 0x22, 0x23, 0x9c,
+  0x1c, 0x89, 0x11, 0x13, 0x14, 0xb5, 0x35, 0x69, 0x6a, 0x77, 0x78, 0x77,
+  0x78, 0xf8, 0x78, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x5e, 0x5f, 0x4d,
+  0x4e, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0xfb,
+  0x7b, 0xfa, 0x7a, 0x88, 0x12, 0x6b, 0x6c, 0x75, 0x76, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x5f, 0x60, 0x4e, 0x4f, 0xac, 0x2c, 0x87, 0x11, 0x32, 0x33, 0x7c,
+  0x7d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xe8, 0x68, 0xd6, 0x56, 0x16, 0x17, 0x93, 0x13, 0x93,
+  0x13, 0x93, 0x13, 0x93, 0x13, 0x93, 0x13, 0x87, 0x07, 0x89, 0x09, 0xcd,
+  0x4d, 0x7d, 0x7e, 0xf1, 0x71, 0xa4, 0x24, 0x22, 0x23, 0xec, 0x6c, 0x7d,
+  0x7e, 0xe8, 0x68, 0x35, 0x36, 0x8c, 0x0c, 0x91, 0x07, 0x20, 0x21, 0x43,
+  0x44, 0x14, 0x15, 0x00, 0x00, 0xc4, 0x44, 0x7d, 0x7e, 0x7d, 0x7e, 0xbc,
+  0x3c, 0x97, 0x03, 0xa1, 0x21, 0x7d, 0x7e, 0x7d, 0x7e, 0xc2, 0x42, 0x97,
+  0x03, 0xcb, 0x4b, 0x7d, 0x7e, 0x69, 0x6a, 0x10, 0x11, 0x97, 0x02, 0x3b,
+  0x3c, 0x76, 0x77, 0xc8, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9a,
+  0x09, 0x00, 0x01, 0x83, 0x03, 0xb5, 0x35, 0xd6, 0x56, 0xff, 0x7f, 0xff,
+  0x7f, 0xe5, 0x65, 0x25, 0x26, 0x83, 0x03, 0x80, 0x00, 0x90, 0x0a, 0xb2,
+  0x32, 0x53, 0x54, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe1, 0x61, 0x81, 0x01, 0x8e, 0x0c, 0x8e,
+  0x0e, 0xc7, 0x47, 0x6f, 0x70, 0xfe, 0x7e, 0xfe, 0x7e, 0x76, 0x77, 0xc1,
+  0x41, 0xd1, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xdd, 0x5d, 0x81,
+  0x01, 0x8d, 0x0c, 0xb1, 0x31, 0xd4, 0x54, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb,
+  0x7b, 0xc1, 0x41, 0x09, 0x0a, 0x19, 0x1a, 0xdd, 0x5d, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x78, 0x79, 0x1e, 0x1f, 0x8c, 0x0d, 0x09, 0x0a, 0xb7, 0x37, 0x6d,
+  0x6e, 0x73, 0x74, 0x6e, 0x6f, 0xc1, 0x41, 0x23, 0x24, 0x04, 0x05, 0xa3,
+  0x23, 0xde, 0x5e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf0, 0x70, 0x1f, 0x20, 0x8c,
+  0x04, 0x0a, 0x0b, 0xd4, 0x54, 0xfe, 0x7e, 0xfe, 0x7e, 0x45, 0x46, 0x81,
+  0x06, 0x85, 0x05, 0xb2, 0x32, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x55,
+  0x56, 0x84, 0x04, 0x8d, 0x04, 0xca, 0x4a, 0xfe, 0x7e, 0xfe, 0x7e, 0x46,
+  0x47, 0x8d, 0x0d, 0x81, 0x05, 0x2c, 0x2d, 0xfe, 0x7e, 0xfe, 0x7e, 0x76,
+  0x77, 0x33, 0x34, 0x85, 0x05, 0x8d, 0x0b, 0x04, 0x05, 0x63, 0x64, 0xfe,
+  0x7e, 0xf5, 0x75, 0xa6, 0x26, 0x07, 0x08, 0x0d, 0x0e, 0x4f, 0x50, 0x74,
+  0x75, 0xfe, 0x7e, 0xd6, 0x56, 0x9a, 0x1a, 0x8f, 0x0a, 0x04, 0x05, 0x63,
+  0x64, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe5, 0x65, 0x59, 0x5a, 0x74,
+  0x75, 0xfe, 0x7e, 0x63, 0x64, 0x87, 0x07, 0x91, 0x08, 0x13, 0x14, 0xcb,
+  0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x75,
+  0x76, 0xa5, 0x25, 0x93, 0x07, 0x03, 0x04, 0x9e, 0x1e, 0x5d, 0x5e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0x14, 0x15, 0x8f, 0x02, 0x20,
+  0x21, 0xe3, 0x63, 0xc9, 0x49, 0x81, 0x07, 0x0e, 0x0f, 0xf5, 0x75, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x56, 0x57, 0x87, 0x07, 0x8e,
+  0x0c, 0x00, 0x01, 0x98, 0x18, 0x0a, 0x0b, 0x00, 0x00, 0x07, 0x08, 0xdb,
+  0x5b, 0xfe, 0x7e, 0xf2, 0x72, 0x23, 0x24, 0xcf, 0x4f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xac, 0x2c, 0x92, 0x08, 0xc0, 0x40, 0x76, 0x77, 0xfe, 0x7e, 0xb6,
+  0x36, 0x86, 0x06, 0x94, 0x14, 0x73, 0x74, 0xfe, 0x7e, 0x37, 0x38, 0x90,
+  0x0a, 0x83, 0x03, 0x52, 0x53, 0xf7, 0x77, 0xfe, 0x7e, 0x36, 0x37, 0x05,
+  0x06, 0x00, 0x00, 0x4f, 0x50, 0xfa, 0x7a, 0x70, 0x71, 0x98, 0x18, 0x90,
+  0x09, 0x89, 0x09, 0xfe, 0x7e, 0xfe, 0x7e, 0x6d, 0x6e, 0x85, 0x05, 0x00,
+  0x00, 0x0a, 0x0b, 0x69, 0x6a, 0xfe, 0x7e, 0xd9, 0x59, 0x91, 0x09, 0xc1,
+  0x41, 0xfe, 0x7e, 0xf0, 0x70, 0x8a, 0x0a, 0x00, 0x00, 0x8a, 0x0a, 0xe3,
+  0x63, 0xfe, 0x7e, 0xf0, 0x70, 0x15, 0x16, 0x90, 0x09, 0x83, 0x03, 0xe2,
+  0x62, 0xfe, 0x7e, 0xd0, 0x50, 0x00, 0x00, 0x4d, 0x4e, 0xf7, 0x77, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x22, 0x23, 0x91, 0x09, 0x83, 0x03, 0xc5, 0x45, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x78, 0x79, 0xfc, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0x25,
+  0x26, 0x81, 0x01, 0x92, 0x07, 0x04, 0x05, 0x64, 0x65, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x47, 0x48, 0x82, 0x02, 0x00, 0x01, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0xad, 0x02, 0x96, 0x16, 0xf5, 0x75, 0x4e, 0x4f, 0x96, 0x04,
+  0x01, 0x02, 0xb7, 0x37, 0x73, 0x74, 0x7e, 0x7f, 0x92, 0x12, 0x95, 0x05,
+  0x11, 0x12, 0xd6, 0x56, 0x7e, 0x7f, 0xfc, 0x7c, 0xe0, 0x60, 0x07, 0x08,
+  0x94, 0x04, 0x08, 0x09, 0x46, 0x47, 0x7e, 0x7f, 0x7e, 0x7f, 0xd0, 0x50,
+  0x94, 0x06, 0x02, 0x03, 0x1b, 0x1c, 0x70, 0x71, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x41, 0x42, 0x89, 0x09, 0x94, 0x05, 0x9f, 0x1f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xfa, 0x7a, 0xbd, 0x3d, 0x09, 0x0a, 0x94, 0x04, 0x97, 0x17, 0xf0, 0x70,
+  0x7e, 0x7f, 0xfa, 0x7a, 0xb1, 0x31, 0x95, 0x04, 0x83, 0x03, 0x59, 0x5a,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xb8, 0x38, 0x95, 0x05, 0x02, 0x03, 0xc6, 0x46,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xdf, 0x5f, 0x0a, 0x0b, 0x95, 0x04, 0x1b, 0x1c,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x6e, 0x6f, 0x0a, 0x0b, 0x95, 0x04, 0x36, 0x37,
+  0xf2, 0x72, 0x7e, 0x7f, 0x79, 0x7a, 0x2e, 0x2f, 0x95, 0x04, 0x01, 0x02,
+  0x57, 0x58, 0x7e, 0x7f, 0x7e, 0x7f, 0x3b, 0x3c, 0x96, 0x04, 0x9a, 0x1a,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xde, 0x5e, 0x08, 0x09, 0x85, 0x06, 0x0c, 0x0d,
+  0x28, 0x29, 0x5d, 0x5e, 0x66, 0x67, 0x66, 0x67, 0x2c, 0x2d, 0x15, 0x16,
+  0x88, 0x04, 0x81, 0x01, 0xd8, 0x58, 0x7e, 0x7f, 0x74, 0x75, 0x88, 0x08,
+  0x83, 0x09, 0xa0, 0x20, 0x3c, 0x3d, 0x69, 0x6a, 0x70, 0x71, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x43, 0x44, 0x88, 0x03,
+  0x83, 0x03, 0x7e, 0x7f, 0x7e, 0x7f, 0xf2, 0x72, 0x81, 0x0c, 0x88, 0x08,
+  0x2e, 0x2f, 0x5a, 0x5b, 0xfa, 0x7a, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x43, 0x44,
+  0x88, 0x12, 0x83, 0x03, 0x7e, 0x7f, 0x7e, 0x7f, 0xf2, 0x72, 0x00, 0x00,
+  0x1f, 0x20, 0xdd, 0x5d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x68, 0x69, 0xa9, 0x29, 0x88, 0x11, 0x83, 0x03, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x77, 0x78, 0x3c, 0x3d, 0x7a, 0x7b, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x4e, 0x4f, 0x0a, 0x0b, 0x89, 0x10, 0x01, 0x02, 0xe5, 0x65,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x4e, 0x4f, 0x90, 0x10, 0x00, 0x01, 0x8b, 0x0d, 0x27, 0x28, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x6d, 0x6e, 0x43, 0x44, 0x90, 0x10, 0x00, 0x01,
+  0x8d, 0x0a, 0x80, 0x00, 0x25, 0x26, 0x46, 0x47, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xd4, 0x54, 0x40, 0x41, 0x31, 0x32, 0x02, 0x03, 0x01, 0x02,
+  0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0a, 0x90, 0x10, 0x2f, 0x30,
+  0x2c, 0x2d, 0xbe, 0x3e, 0xbe, 0x3e, 0xc6, 0x46, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x5b, 0x5c, 0x9e, 0x1e, 0x8d, 0x0d, 0x13, 0x14, 0x4e, 0x4f,
+  0x7b, 0x7c, 0xfc, 0x7c, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7c, 0x7d,
+  0x8c, 0x0e, 0x94, 0x14, 0x70, 0x71, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x57, 0x58, 0x46, 0x47, 0x46, 0x47, 0xcc, 0x4c,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x8c, 0x07, 0x1a, 0x1b,
+  0x76, 0x77, 0xfe, 0x7e, 0xfe, 0x7e, 0x55, 0x56, 0x19, 0x1a, 0x89, 0x09,
+  0x02, 0x03, 0x81, 0x04, 0xc9, 0x49, 0xfe, 0x7e, 0xfe, 0x7e, 0x7c, 0x7d,
+  0x28, 0x29, 0x8d, 0x03, 0x0a, 0x0b, 0x8c, 0x0c, 0x8c, 0x0c, 0x02, 0x03,
+  0x82, 0x05, 0x2a, 0x2b, 0x71, 0x72, 0x79, 0x7a, 0xfe, 0x7e, 0xdf, 0x5f,
+  0x8c, 0x0c, 0x94, 0x05, 0x2b, 0x2c, 0xf9, 0x79, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x7a, 0x7b, 0xa3, 0x23, 0x93, 0x06, 0x09, 0x0a, 0xd9, 0x59, 0x78, 0x79,
+  0xfe, 0x7e, 0x78, 0x79, 0xcd, 0x4d, 0x91, 0x11, 0x93, 0x05, 0xaf, 0x2f,
+  0xed, 0x6d, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a, 0x93, 0x13, 0x93, 0x06,
+  0x1d, 0x1e, 0x57, 0x58, 0x78, 0x79, 0xfe, 0x7e, 0xe9, 0x69, 0x99, 0x19,
+  0x88, 0x08, 0x93, 0x05, 0x31, 0x32, 0xf9, 0x79, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x56, 0x57, 0x16, 0x17, 0x93, 0x0b, 0x1a, 0x1b, 0xd6, 0x56, 0x79, 0x7a,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xb6, 0x36, 0x9d, 0x1d, 0x9d, 0x1d,
+  0x9d, 0x1d, 0x9d, 0x1d, 0x9a, 0x1a, 0x8e, 0x0d, 0xd4, 0x54, 0x7a, 0x7b,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7a, 0x7b, 0x53, 0x54,
+  0x8c, 0x0f, 0x26, 0x27, 0x7b, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0xa6, 0x26, 0x8b, 0x10,
+  0x92, 0x12, 0xe6, 0x66, 0x6a, 0x6b, 0x6a, 0x6b, 0x33, 0x34, 0x29, 0x2a,
+  0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a, 0x29, 0x2a,
+  0x34, 0x35, 0xfe, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x26, 0x27, 0x94, 0x06,
+  0x02, 0x03, 0x90, 0x10, 0x3f, 0x40, 0xfe, 0x7e, 0xfe, 0x7e, 0xfa, 0x7a,
+  0x14, 0x15, 0x91, 0x08, 0x8a, 0x0a, 0x8d, 0x0d, 0x1a, 0x1b, 0x56, 0x57,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfd, 0x7d, 0x49, 0x4a, 0x89, 0x10,
+  0x09, 0x0a, 0xc9, 0x49, 0xaa, 0x2a, 0x00, 0x00, 0x08, 0x09, 0x04, 0x05,
+  0x1f, 0x20, 0x4a, 0x4b, 0x4a, 0x4b, 0x72, 0x73, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf8, 0x78, 0xcc, 0x4c, 0x2f, 0x30, 0x8a, 0x0e,
+  0x7e, 0x7f, 0xfe, 0x7e, 0xe6, 0x66, 0xc7, 0x47, 0x78, 0x79, 0xe2, 0x62,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x79, 0x7a, 0x6d, 0x6e, 0x13, 0x14, 0x8c, 0x0c, 0x7e, 0x7f, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0xfb, 0x7b, 0x66, 0x67,
+  0xba, 0x3a, 0xba, 0x3a, 0xba, 0x3a, 0xba, 0x3a, 0x11, 0x12, 0x8e, 0x05,
+  0x3d, 0x3e, 0xbd, 0x3d, 0xbd, 0x3d, 0xbd, 0x3d, 0xbd, 0x3d, 0x07, 0x08,
+  0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0x08, 0x86, 0x06, 0xc2,
+  0x42, 0xc2, 0x42, 0x6a, 0x6b, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x16,
+  0x17, 0x00, 0x01, 0x90, 0x0a, 0xa5, 0x25, 0xc8, 0x48, 0xe5, 0x65, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf5, 0x75, 0xfc, 0x7c, 0xe7,
+  0x67, 0x0b, 0x0c, 0x8e, 0x0c, 0x9a, 0x1a, 0xce, 0x4e, 0xfa, 0x7a, 0xfe,
+  0x7e, 0x7e, 0x7f, 0x7c, 0x7d, 0xec, 0x6c, 0x60, 0x61, 0x2f, 0x30, 0x1c,
+  0x1d, 0xf2, 0x72, 0xfe, 0x7e, 0xab, 0x2b, 0x8d, 0x06, 0x40, 0x41, 0x62,
+  0x63, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xef, 0x6f, 0x25, 0x26, 0x82,
+  0x04, 0x98, 0x18, 0x76, 0x77, 0xfe, 0x7e, 0x35, 0x36, 0x0c, 0x0d, 0x8a,
+  0x07, 0x05, 0x06, 0xc9, 0x49, 0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xf1,
+  0x71, 0xa6, 0x26, 0x91, 0x11, 0x82, 0x05, 0x15, 0x16, 0x56, 0x57, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd0, 0x50, 0x89, 0x06, 0x0d, 0x0e, 0xe6,
+  0x66, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xab, 0x2b, 0x10, 0x11, 0x81,
+  0x08, 0x83, 0x03, 0x49, 0x4a, 0x60, 0x61, 0x75, 0x76, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4f, 0x50, 0x88, 0x12, 0x9e, 0x1e, 0xea,
+  0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0x43, 0x44, 0x17, 0x18, 0x83, 0x03, 0x92,
+  0x12, 0xc7, 0x47, 0xe7, 0x67, 0x68, 0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x10, 0x11, 0x87,
+  0x13, 0x39, 0x3a, 0x76, 0x77, 0xfe, 0x7e, 0xfe, 0x7e, 0x6f, 0x70, 0xbd,
+  0x3d, 0xc4, 0x44, 0x6c, 0x6d, 0xf4, 0x74, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x32, 0x33, 0x00, 0x01, 0x87, 0x12, 0xdf, 0x5f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xe2, 0x62, 0x47, 0x48, 0xa2, 0x22, 0x97, 0x17, 0x6e,
+  0x6f, 0xfe, 0x7e, 0xfe, 0x7e, 0xd2, 0x52, 0x06, 0x07, 0x88, 0x0a, 0xdf,
+  0x5f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xea,
+  0x6a, 0x41, 0x42, 0x0a, 0x0b, 0x85, 0x05, 0x02, 0x03, 0x81, 0x04, 0x97,
+  0x17, 0x7c, 0x7d, 0xfe, 0x7e, 0xea, 0x6a, 0x0b, 0x0c, 0x89, 0x04, 0xdc,
+  0x5c, 0x78, 0x79, 0xf0, 0x70, 0x3c, 0x3d, 0x91, 0x11, 0x86, 0x04, 0x95,
+  0x15, 0x7e, 0x7f, 0x7e, 0x7f, 0xfa, 0x7a, 0x16, 0x17, 0x95, 0x04, 0x06,
+  0x07, 0xd3, 0x53, 0xfe, 0x7e, 0xfb, 0x7b, 0x1a, 0x1b, 0x95, 0x04, 0x09,
+  0x0a, 0xd0, 0x50, 0xfe, 0x7e, 0x7a, 0x7b, 0x35, 0x36, 0x95, 0x04, 0x0b,
+  0x0c, 0xb1, 0x31, 0xfe, 0x7e, 0x7a, 0x7b, 0xd2, 0x52, 0x96, 0x03, 0xae,
+  0x2e, 0x7e, 0x7f, 0xfb, 0x7b, 0xd2, 0x52, 0x96, 0x03, 0x0f, 0x10, 0xfa,
+  0x7a, 0xfd, 0x7d, 0xd1, 0x51, 0x97, 0x03, 0xca, 0x4a, 0xfe, 0x7e, 0x7b,
+  0x7c, 0x19, 0x1a, 0x97, 0x02, 0x55, 0x56, 0xfe, 0x7e, 0xca, 0x4a, 0x98,
+  0x02, 0x55, 0x56, 0xfe, 0x7e, 0x53, 0x54, 0x98, 0x02, 0x04, 0x05, 0x3f,
+  0x40, 0x3c, 0x3d, 0xa8, 0x00, 0x00, 0xff, 0x97, 0x0a, 0x82, 0x02, 0x83,
+  0x03, 0x83, 0x03, 0x83, 0x03, 0x36, 0x37, 0x40, 0x41, 0x77, 0x78, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xe2, 0x62, 0x81, 0x01, 0x8d, 0x0d, 0x84, 0x04, 0x92,
+  0x12, 0x43, 0x44, 0x6e, 0x6f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x82,
+  0x02, 0x8c, 0x0e, 0x0a, 0x0b, 0x6b, 0x6c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x76, 0x77, 0xf5, 0x75, 0xf5, 0x75, 0x3e,
+  0x3f, 0x77, 0x78, 0xfe, 0x7e, 0xfe, 0x7e, 0x82, 0x02, 0x8c, 0x07, 0x12,
+  0x13, 0xfe, 0x7e, 0x7b, 0x7c, 0x71, 0x72, 0x62, 0x63, 0xb4, 0x34, 0xb4,
+  0x34, 0x09, 0x0a, 0x81, 0x04, 0x04, 0x05, 0x73, 0x74, 0xfe, 0x7e, 0x55,
+  0x56, 0x81, 0x01, 0x8c, 0x02, 0x87, 0x07, 0xb1, 0x31, 0xa7, 0x27, 0x86,
+  0x03, 0xb9, 0x39, 0xfe, 0x7e, 0xfe, 0x7e, 0x05, 0x06, 0x96, 0x04, 0x1d,
+  0x1e, 0x78, 0x79, 0xfe, 0x7e, 0x5a, 0x5b, 0x82, 0x02, 0x95, 0x04, 0x87,
+  0x07, 0xda, 0x5a, 0xfe, 0x7e, 0xf5, 0x75, 0x9c, 0x1c, 0x95, 0x04, 0x07,
+  0x08, 0x59, 0x5a, 0xfe, 0x7e, 0xfe, 0x7e, 0x3d, 0x3e, 0x96, 0x04, 0xd4,
+  0x54, 0xfe, 0x7e, 0xfe, 0x7e, 0x65, 0x66, 0x89, 0x09, 0x95, 0x04, 0x9b,
+  0x1b, 0x77, 0x78, 0xfe, 0x7e, 0x72, 0x73, 0x8b, 0x0b, 0x95, 0x08, 0x89,
+  0x09, 0xdb, 0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xbf, 0x3f, 0x8d, 0x0d, 0xa2,
+  0x22, 0xa2, 0x22, 0x92, 0x12, 0x90, 0x0a, 0x88, 0x08, 0xa5, 0x25, 0xdb,
+  0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x6d, 0x6e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x93, 0x13, 0x8c, 0x0e, 0x04, 0x05, 0xa8, 0x28, 0xb3,
+  0x33, 0xe6, 0x66, 0xeb, 0x6b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a, 0x1c, 0x1d, 0x81,
+  0x01, 0x8a, 0x0e, 0x18, 0x19, 0x4f, 0x50, 0x6b, 0x6c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xdb,
+  0x5b, 0x52, 0x53, 0xbc, 0x3c, 0x95, 0x15, 0x01, 0x02, 0x8a, 0x0c, 0x98,
+  0x18, 0x4f, 0x50, 0x76, 0x77, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x71, 0x72, 0x9f, 0x1f, 0x83,
+  0x03, 0x8e, 0x0a, 0x40, 0x41, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf8,
+  0x78, 0x4c, 0x4d, 0x23, 0x24, 0xdb, 0x5b, 0xfe, 0x7e, 0xf2, 0x72, 0x19,
+  0x1a, 0x90, 0x09, 0xa6, 0x26, 0x49, 0x4a, 0x49, 0x4a, 0xa5, 0x25, 0x8a,
+  0x0a, 0x00, 0x00, 0x2d, 0x2e, 0x7a, 0x7b, 0xfe, 0x7e, 0xa7, 0x27, 0x97,
+  0x03, 0xd3, 0x53, 0xfe, 0x7e, 0xf2, 0x72, 0x12, 0x13, 0x97, 0x02, 0xd3,
+  0x53, 0xfe, 0x7e, 0xc5, 0x45, 0x98, 0x02, 0xd3, 0x53, 0xfe, 0x7e, 0x24,
+  0x25, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x03, 0x81, 0x01, 0x4e,
+  0x4f, 0xff, 0x7f, 0x49, 0x4a, 0x96, 0x04, 0x18, 0x19, 0x57, 0x58, 0xfe,
+  0x7e, 0xc2, 0x42, 0xa2, 0x22, 0x94, 0x05, 0x02, 0x03, 0xba, 0x3a, 0x73,
+  0x74, 0xfe, 0x7e, 0x5f, 0x60, 0x06, 0x07, 0x95, 0x04, 0xa8, 0x28, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x64, 0x65, 0x87, 0x07, 0x95, 0x04, 0x1a, 0x1b, 0x72,
+  0x73, 0xfe, 0x7e, 0xf9, 0x79, 0x2a, 0x2b, 0x96, 0x03, 0x5c, 0x5d, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x2e, 0x2f, 0x95, 0x05, 0x0e, 0x0f, 0xa3, 0x23, 0xf3,
+  0x73, 0x78, 0x79, 0xd6, 0x56, 0x88, 0x08, 0x93, 0x05, 0x18, 0x19, 0x56,
+  0x57, 0x71, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xdc, 0x5c, 0x94, 0x06, 0x07,
+  0x08, 0xd5, 0x55, 0x48, 0x49, 0xfe, 0x7e, 0xfe, 0x7e, 0x77, 0x78, 0x29,
+  0x2a, 0x96, 0x03, 0x42, 0x43, 0xfe, 0x7e, 0xfe, 0x7e, 0xb2, 0x32, 0x96,
+  0x04, 0x1e, 0x1f, 0xf4, 0x74, 0xfe, 0x7e, 0xe9, 0x69, 0x88, 0x08, 0x95,
+  0x04, 0x8c, 0x0c, 0xf4, 0x74, 0xfe, 0x7e, 0x6a, 0x6b, 0x95, 0x15, 0x96,
+  0x03, 0xa3, 0x23, 0xfe, 0x7e, 0xfe, 0x7e, 0x51, 0x52, 0x96, 0x04, 0x1f,
+  0x20, 0xf6, 0x76, 0xfe, 0x7e, 0x61, 0x62, 0x9a, 0x1a, 0x96, 0x03, 0xca,
+  0x4a, 0xfe, 0x7e, 0xfe, 0x7e, 0x2a, 0x2b, 0x97, 0x03, 0xca, 0x4a, 0xfe,
+  0x7e, 0x6d, 0x6e, 0x85, 0x05, 0x97, 0x02, 0xca, 0x4a, 0xfe, 0x7e, 0x6b,
+  0x6c, 0x98, 0x02, 0xca, 0x4a, 0xfe, 0x7e, 0x6b, 0x6c, 0x98, 0x04, 0x2d,
+  0x2e, 0xfe, 0x7e, 0x7d, 0x7e, 0x4f, 0x50, 0xaf, 0x2f, 0x96, 0x04, 0x80,
+  0x00, 0x28, 0x29, 0x67, 0x68, 0xfe, 0x7e, 0xc7, 0x47, 0xe1, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xb8, 0x05, 0x33, 0x34, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x59, 0x5a, 0x3c, 0x3d, 0x93, 0x08, 0x37, 0x38, 0x7b, 0x7c, 0xfd,
+  0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7c, 0x7d, 0x3a,
+  0x3b, 0x90, 0x0a, 0xdd, 0x5d, 0xf8, 0x78, 0x7c, 0x7d, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xb4, 0x34, 0x0a, 0x0b, 0x49, 0x4a, 0xfe, 0x7e, 0x5c,
+  0x5d, 0x8e, 0x0c, 0x90, 0x10, 0xe8, 0x68, 0xfc, 0x7c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x74, 0x75, 0x1e, 0x1f, 0x89, 0x09, 0x83, 0x03, 0x00, 0x00, 0x25,
+  0x26, 0xe6, 0x66, 0x41, 0x42, 0x8c, 0x07, 0x11, 0x12, 0xe8, 0x68, 0x75,
+  0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0x63, 0x64, 0x8c, 0x0c, 0x8a, 0x0a, 0x83,
+  0x02, 0x1b, 0x1c, 0xb6, 0x36, 0x86, 0x06, 0x8b, 0x06, 0x2a, 0x2b, 0xf4,
+  0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x28, 0x29, 0x8c, 0x0c, 0x83,
+  0x03, 0xc4, 0x44, 0x6e, 0x6f, 0x77, 0x78, 0xd9, 0x59, 0x8b, 0x06, 0xac,
+  0x2c, 0x72, 0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x12, 0x13, 0x84,
+  0x04, 0x82, 0x05, 0x10, 0x11, 0xeb, 0x6b, 0xf7, 0x77, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xc3, 0x43, 0x8a, 0x05, 0xe3, 0x63, 0xf1, 0x71, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x25, 0x26, 0x8f, 0x0f, 0x82, 0x07, 0x9c, 0x1c, 0xd4, 0x54, 0x6b,
+  0x6c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x78, 0x79, 0x8a, 0x0a, 0x89,
+  0x05, 0xaf, 0x2f, 0xfd, 0x7d, 0xfe, 0x7e, 0xe5, 0x65, 0x1d, 0x1e, 0x03,
+  0x04, 0x81, 0x08, 0x89, 0x09, 0xd4, 0x54, 0xf7, 0x77, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf9, 0x79, 0x27, 0x28, 0x89, 0x11, 0xb0,
+  0x30, 0x6e, 0x6f, 0xfe, 0x7e, 0xe3, 0x63, 0xbd, 0x3d, 0xa4, 0x24, 0x20,
+  0x21, 0x34, 0x35, 0x61, 0x62, 0x68, 0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xed,
+  0x6d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc4, 0x44, 0x8c, 0x0c, 0x89,
+  0x10, 0xdf, 0x5f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd9, 0x59, 0xa0,
+  0x20, 0x50, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0x52, 0x53, 0x8d, 0x0d, 0x8a,
+  0x0f, 0x52, 0x53, 0x7d, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x68, 0x69, 0x51, 0x52, 0xa3, 0x23, 0x08, 0x09, 0x41,
+  0x42, 0x73, 0x74, 0xfe, 0x7e, 0x72, 0x73, 0x1f, 0x20, 0x8c, 0x06, 0x43,
+  0x44, 0xe7, 0x67, 0xe7, 0x67, 0xce, 0x4e, 0x26, 0x27, 0x26, 0x27, 0x06,
+  0x07, 0x81, 0x04, 0x94, 0x14, 0x73, 0x74, 0xfe, 0x7e, 0xf4, 0x74, 0x29,
+  0x2a, 0x95, 0x05, 0x15, 0x16, 0xde, 0x5e, 0xfe, 0x7e, 0xef, 0x6f, 0x29,
+  0x2a, 0x0e, 0x0f, 0x94, 0x04, 0x12, 0x13, 0xd9, 0x59, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x3d, 0x3e, 0x96, 0x04, 0x3e, 0x3f, 0xf3, 0x73, 0xfe, 0x7e, 0x45,
+  0x46, 0x0e, 0x0f, 0x95, 0x04, 0x97, 0x17, 0x73, 0x74, 0xfe, 0x7e, 0xcb,
+  0x4b, 0x8e, 0x0e, 0x96, 0x03, 0xc8, 0x48, 0xfe, 0x7e, 0x6b, 0x6c, 0xaa,
+  0x2a, 0x97, 0x02, 0xc8, 0x48, 0xfe, 0x7e, 0xbc, 0x3c, 0x98, 0x02, 0xa7,
+  0x27, 0xfe, 0x7e, 0xbc, 0x3c, 0xc5, 0x00, 0x00, 0x00, 0x00, 0xff, 0x97,
+  0x0a, 0x00, 0x01, 0x83, 0x03, 0x83, 0x03, 0x35, 0x36, 0xc1, 0x41, 0xc1,
+  0x41, 0xc1, 0x41, 0xc1, 0x41, 0xc1, 0x41, 0xc1, 0x41, 0x02, 0x03, 0x8f,
+  0x0b, 0x92, 0x12, 0x52, 0x53, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xe2,
+  0x62, 0x8e, 0x0c, 0x8c, 0x0c, 0xec, 0x6c, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xf7, 0x77, 0x75, 0x76, 0x75, 0x76, 0x75, 0x76, 0x75, 0x76, 0xfe,
+  0x7e, 0x7e, 0x7f, 0xff, 0x7f, 0x8f, 0x04, 0x53, 0x54, 0x7e, 0x7f, 0x7b,
+  0x7c, 0xe0, 0x60, 0x8a, 0x0a, 0x81, 0x04, 0x04, 0x05, 0x44, 0x45, 0xfb,
+  0x7b, 0x7e, 0x7f, 0xd4, 0x54, 0x8f, 0x02, 0x0a, 0x0b, 0xb1, 0x31, 0xa4,
+  0x24, 0x82, 0x05, 0x8d, 0x0d, 0x59, 0x5a, 0x7e, 0x7f, 0x7e, 0x7f, 0xf0,
+  0x70, 0x82, 0x02, 0x93, 0x06, 0x8f, 0x0f, 0xc6, 0x46, 0xf8, 0x78, 0x7e,
+  0x7f, 0xf7, 0x77, 0x50, 0x51, 0x82, 0x02, 0x92, 0x06, 0x10, 0x11, 0xc6,
+  0x46, 0x76, 0x77, 0x7e, 0x7f, 0x7e, 0x7f, 0x6b, 0x6c, 0x1e, 0x1f, 0x92,
+  0x07, 0x05, 0x06, 0xa8, 0x28, 0xf5, 0x75, 0x7e, 0x7f, 0x7e, 0x7f, 0xf6,
+  0x76, 0xcf, 0x4f, 0x04, 0x05, 0x91, 0x07, 0x04, 0x05, 0xa8, 0x28, 0xe2,
+  0x62, 0x7e, 0x7f, 0x7e, 0x7f, 0x76, 0x77, 0x4e, 0x4f, 0x98, 0x18, 0x92,
+  0x06, 0x0d, 0x0e, 0xe3, 0x63, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xbb, 0x3b, 0x94, 0x08, 0x12, 0x13, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x75, 0x76, 0xcc, 0x4c, 0x05, 0x06, 0x92,
+  0x09, 0x84, 0x04, 0xc4, 0x44, 0xd9, 0x59, 0xf4, 0x74, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x52, 0x53, 0x85, 0x05, 0x94, 0x06, 0x91,
+  0x11, 0x98, 0x18, 0xa9, 0x29, 0xe2, 0x62, 0x7e, 0x7f, 0x7e, 0x7f, 0x92,
+  0x12, 0x97, 0x03, 0x3a, 0x3b, 0x7e, 0x7f, 0x7e, 0x7f, 0x92, 0x12, 0x96,
+  0x04, 0x23, 0x24, 0x6d, 0x6e, 0x7e, 0x7f, 0x7e, 0x7f, 0x92, 0x12, 0x94,
+  0x06, 0x8b, 0x0b, 0x40, 0x41, 0xfb, 0x7b, 0x7e, 0x7f, 0x7e, 0x7f, 0x6d,
+  0x6e, 0x8b, 0x0b, 0x8f, 0x0a, 0x85, 0x05, 0xb5, 0x35, 0xbe, 0x3e, 0xf3,
+  0x73, 0xf3, 0x73, 0x75, 0x76, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xee,
+  0x6e, 0x92, 0x12, 0x8d, 0x0c, 0x81, 0x01, 0xbb, 0x3b, 0xf6, 0x76, 0xf7,
+  0x77, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xd4, 0x54, 0x34, 0x35, 0x05, 0x06, 0x8e, 0x0a, 0xfa, 0x7a, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xd6,
+  0x56, 0xb6, 0x36, 0x05, 0x06, 0x81, 0x01, 0x90, 0x07, 0x40, 0x41, 0x40,
+  0x41, 0x40, 0x41, 0x3a, 0x3b, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x00,
+  0x01, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0x08, 0x86, 0x06, 0x36,
+  0x37, 0x59, 0x5a, 0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0x73, 0x74, 0x34,
+  0x35, 0x01, 0x02, 0x8f, 0x0b, 0x08, 0x09, 0x97, 0x17, 0x4c, 0x4d, 0x6f,
+  0x70, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xbe, 0x3e, 0x8e, 0x0c, 0x17, 0x18, 0xe7, 0x67, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0x63, 0x64, 0xae, 0x2e, 0x28,
+  0x29, 0x32, 0x33, 0xfe, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x8c, 0x07, 0x09,
+  0x0a, 0xb8, 0x38, 0x7a, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0x31,
+  0x32, 0x96, 0x16, 0x82, 0x03, 0x0e, 0x0f, 0xfe, 0x7e, 0xfe, 0x7e, 0x9a,
+  0x1a, 0x8b, 0x06, 0x9e, 0x1e, 0x5e, 0x5f, 0xfe, 0x7e, 0xfe, 0x7e, 0xe7,
+  0x67, 0x97, 0x17, 0x08, 0x09, 0x84, 0x03, 0xbf, 0x3f, 0xfe, 0x7e, 0x4e,
+  0x4f, 0x04, 0x05, 0x8a, 0x05, 0x87, 0x07, 0x66, 0x67, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xcf, 0x4f, 0x09, 0x0a, 0x86, 0x02, 0x49, 0x4a, 0xd0, 0x50, 0x03,
+  0x04, 0x8b, 0x0e, 0x11, 0x12, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x79,
+  0x7a, 0xf9, 0x79, 0x73, 0x74, 0xbe, 0x3e, 0xe7, 0x67, 0xf9, 0x79, 0xf9,
+  0x79, 0xf9, 0x79, 0xf9, 0x79, 0x6d, 0x6e, 0x01, 0x02, 0x8c, 0x0d, 0x07,
+  0x08, 0xdf, 0x5f, 0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x6f, 0x70, 0x8f, 0x0b, 0x8d, 0x0d, 0x2e, 0x2f, 0x2e, 0x2f, 0x2e,
+  0x2f, 0x2e, 0x2f, 0x2e, 0x2f, 0x2e, 0x2f, 0x2e, 0x2f, 0x36, 0x37, 0xf9,
+  0x79, 0xfe, 0x7e, 0x6f, 0x70, 0x96, 0x04, 0x89, 0x09, 0xdd, 0x5d, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xc6, 0x46, 0x96, 0x04, 0x38, 0x39, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x67, 0x68, 0x8c, 0x0c, 0x95, 0x04, 0xaf, 0x2f, 0x79, 0x7a, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x27, 0x28, 0x96, 0x04, 0xd8, 0x58, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xb1, 0x31, 0x80, 0x00, 0x94, 0x05, 0x86, 0x06, 0xca, 0x4a, 0x7d,
+  0x7e, 0xfe, 0x7e, 0xe3, 0x63, 0x85, 0x05, 0x94, 0x05, 0x80, 0x00, 0xb5,
+  0x35, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0x88, 0x08, 0x95, 0x04, 0x8e,
+  0x0e, 0xfe, 0x7e, 0xfe, 0x7e, 0x78, 0x79, 0xac, 0x2c, 0x95, 0x04, 0x0d,
+  0x0e, 0xea, 0x6a, 0xfe, 0x7e, 0xf9, 0x79, 0x2c, 0x2d, 0x95, 0x04, 0x0e,
+  0x0f, 0x68, 0x69, 0xfe, 0x7e, 0x7a, 0x7b, 0x2b, 0x2c, 0x96, 0x03, 0x43,
+  0x44, 0xfe, 0x7e, 0xfd, 0x7d, 0x29, 0x2a, 0x96, 0x03, 0xa1, 0x21, 0x7c,
+  0x7d, 0xfe, 0x7e, 0x28, 0x29, 0xab, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x03,
+  0xa5, 0x25, 0x5b, 0x5c, 0xec, 0x6c, 0x91, 0x11, 0x94, 0x05, 0x01, 0x02,
+  0x1d, 0x1e, 0xb4, 0x34, 0x77, 0x78, 0xee, 0x6e, 0x92, 0x12, 0x94, 0x05,
+  0x01, 0x02, 0x3a, 0x3b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfd, 0x7d, 0x37, 0x38,
+  0x95, 0x04, 0xc1, 0x41, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4b, 0x4c,
+  0x94, 0x06, 0x96, 0x16, 0xc4, 0x44, 0x7b, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x46, 0x47, 0x84, 0x04, 0x93, 0x06, 0x18, 0x19, 0xef, 0x6f, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfd, 0x7d, 0x4b, 0x4c, 0x84, 0x04, 0x93, 0x05, 0x17, 0x18,
+  0x70, 0x71, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0x4e, 0x4f, 0x94, 0x06,
+  0x17, 0x18, 0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0x9b, 0x1b,
+  0x82, 0x02, 0x93, 0x06, 0x18, 0x19, 0x70, 0x71, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x70, 0x71, 0x9d, 0x1d, 0x85, 0x05, 0x93, 0x05, 0x96, 0x16, 0xef, 0x6f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x70, 0x71, 0x95, 0x15, 0x95, 0x0e, 0x51, 0x52,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xbc, 0x3c, 0x00, 0x00, 0x34, 0x35,
+  0xb4, 0x34, 0x64, 0x65, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xe4, 0x64, 0xab, 0x2b, 0x8a, 0x11, 0x01, 0x02, 0x1d, 0x1e, 0x66, 0x67,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfa, 0x7a, 0xe8, 0x68, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xf5, 0x75, 0x1e, 0x1f, 0x89, 0x11, 0x0b, 0x0c, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x7e, 0x7f, 0xf8, 0x78, 0x76, 0x77, 0x76, 0x77, 0x78, 0x79, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf5, 0x75, 0x1e, 0x1f, 0x88, 0x0a, 0x8e, 0x0e,
+  0x66, 0x67, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xd0, 0x50, 0xc2, 0x42, 0x42, 0x43, 0x8b, 0x0b, 0x81, 0x04, 0x48, 0x49,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0x88, 0x08, 0x0f, 0x10,
+  0x3a, 0x3b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0x58, 0x59,
+  0x3e, 0x3f, 0x83, 0x03, 0x82, 0x06, 0x98, 0x18, 0x48, 0x49, 0x7c, 0x7d,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x51, 0x52, 0x88, 0x06, 0x8f, 0x0f,
+  0x6e, 0x6f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf8, 0x78, 0xa3, 0x23,
+  0x81, 0x09, 0x08, 0x09, 0x8f, 0x0f, 0x20, 0x21, 0xf1, 0x71, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf0, 0x70, 0x19, 0x1a, 0x88, 0x11,
+  0xc3, 0x43, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf7, 0x77,
+  0x42, 0x43, 0x42, 0x43, 0x42, 0x43, 0xe6, 0x66, 0x7e, 0x7f, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0xbb, 0x3b, 0x83, 0x03,
+  0x89, 0x0f, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x68, 0x69, 0x3b, 0x3c, 0x05, 0x06, 0x8b, 0x0d,
+  0xe8, 0x68, 0xfa, 0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x75, 0x76, 0x67, 0x68,
+  0xe3, 0x63, 0x8f, 0x0f, 0x8d, 0x0a, 0x9f, 0x1f, 0xf5, 0x75, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x63, 0x64, 0x33, 0x34,
+  0x33, 0x34, 0x1e, 0x1f, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c,
+  0x03, 0x02, 0x03, 0xea, 0x6a, 0xff, 0x7f, 0x0e, 0x0f, 0x97, 0x03, 0xe6,
+  0x66, 0xfe, 0x7e, 0xfe, 0x7e, 0x0e, 0x0f, 0x96, 0x04, 0x95, 0x15, 0x73,
+  0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0x0e, 0x0f, 0x95, 0x05, 0x83, 0x03, 0xcc,
+  0x4c, 0xfe, 0x7e, 0xfe, 0x7e, 0x62, 0x63, 0x86, 0x06, 0x95, 0x04, 0xa2,
+  0x22, 0xfe, 0x7e, 0xfe, 0x7e, 0xf9, 0x79, 0x27, 0x28, 0x96, 0x03, 0xab,
+  0x2b, 0xfe, 0x7e, 0xfe, 0x7e, 0x52, 0x53, 0x96, 0x04, 0x9f, 0x1f, 0xf4,
+  0x74, 0xfe, 0x7e, 0xf7, 0x77, 0x26, 0x27, 0x96, 0x03, 0x5c, 0x5d, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x2b, 0x2c, 0x96, 0x04, 0x21, 0x22, 0x74, 0x75, 0xfe,
+  0x7e, 0xf6, 0x76, 0x12, 0x13, 0x95, 0x04, 0x92, 0x12, 0x74, 0x75, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x96, 0x04, 0x29, 0x2a, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xe4, 0x64, 0x06, 0x07, 0x95, 0x04, 0xa3, 0x23, 0x75, 0x76, 0xfe,
+  0x7e, 0xf5, 0x75, 0x22, 0x23, 0x96, 0x03, 0xd3, 0x53, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xad, 0x2d, 0x96, 0x04, 0x0f, 0x10, 0xf7, 0x77, 0xfe, 0x7e, 0x74,
+  0x75, 0x96, 0x16, 0x96, 0x03, 0x29, 0x2a, 0xfe, 0x7e, 0xfe, 0x7e, 0x4b,
+  0x4c, 0x96, 0x04, 0x0d, 0x0e, 0x78, 0x79, 0xfe, 0x7e, 0xe8, 0x68, 0x84,
+  0x04, 0x96, 0x03, 0x0f, 0x10, 0xfe, 0x7e, 0xfe, 0x7e, 0x2d, 0x2e, 0x97,
+  0x03, 0x2a, 0x2b, 0xfe, 0x7e, 0x4e, 0x4f, 0x02, 0x03, 0x97, 0x02, 0x30,
+  0x31, 0xfe, 0x7e, 0x2a, 0x2b, 0x98, 0x02, 0x0f, 0x10, 0xfe, 0x7e, 0x2a,
+  0x2b, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb3, 0x01, 0x3f, 0x40, 0x1f,
+  0x20, 0x81, 0x04, 0x1f, 0x20, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0x1f,
+  0x20, 0x8f, 0x0b, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x8f, 0x0b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x8f, 0x0b, 0xdf, 0x5f, 0xff, 0x7f, 0x3f,
+  0x40, 0xdf, 0x5f, 0x3f, 0x40, 0x3f, 0x40, 0x1f, 0x20, 0x00, 0x00, 0x3f,
+  0x40, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x97, 0x02, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x97, 0x03, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x97, 0x03, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x96,
+  0x03, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x97, 0x03, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x96, 0x03, 0x1f, 0x20, 0xff,
+  0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x81, 0x02, 0x3f, 0x40, 0x3f, 0x40, 0x3f,
+  0x40, 0x92, 0x08, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x3f, 0x40, 0x8b, 0x0c, 0x1f,
+  0x20, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x8d, 0x0b, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x3f, 0x40, 0x8e, 0x0a, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x90, 0x03, 0x1f, 0x20, 0xff, 0x7f, 0x3f, 0x40, 0x1f,
+  0x20, 0x82, 0x03, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x97,
+  0x02, 0xdf, 0x5f, 0xff, 0x7f, 0x3f, 0x40, 0x97, 0x02, 0x1f, 0x20, 0xff,
+  0x7f, 0xff, 0x7f, 0x98, 0x02, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0x98,
+  0x02, 0xdf, 0x5f, 0xff, 0x7f, 0x3f, 0x40, 0x98, 0x02, 0x1f, 0x20, 0xff,
+  0x7f, 0x3f, 0x40, 0xc5, 0x00, 0x00, 0xfb, 0x0b, 0xa8, 0x28, 0xb4, 0x34,
+  0x34, 0x35, 0xf1, 0x71, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x44, 0x45, 0x95, 0x15, 0x8b, 0x0f, 0x9a, 0x1a,
+  0x26, 0x27, 0x67, 0x68, 0x67, 0x68, 0x78, 0x79, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xb3, 0x33, 0x89, 0x11, 0x89, 0x09, 0x51, 0x52,
+  0x78, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x76, 0x77, 0xf6, 0x76, 0x45, 0x46, 0x2b, 0x2c, 0x41, 0x42, 0x49, 0x4a,
+  0xfa, 0x7a, 0x7d, 0x7e, 0x7d, 0x7e, 0xb3, 0x33, 0x89, 0x07, 0x51, 0x52,
+  0x7d, 0x7e, 0x6b, 0x6c, 0x41, 0x42, 0x61, 0x62, 0xe8, 0x68, 0x41, 0x42,
+  0x41, 0x42, 0x84, 0x04, 0x87, 0x07, 0xde, 0x5e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xb3, 0x33, 0x89, 0x05, 0x3b, 0x3c, 0x7d, 0x7e, 0x16, 0x17, 0x00, 0x00,
+  0x07, 0x08, 0x89, 0x09, 0x85, 0x05, 0x8b, 0x0b, 0xdb, 0x5b, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x53, 0x54, 0x05, 0x06, 0x89, 0x02, 0x82, 0x02, 0x24, 0x25,
+  0x84, 0x04, 0x88, 0x04, 0xae, 0x2e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf8, 0x78,
+  0x19, 0x1a, 0x94, 0x05, 0x03, 0x04, 0x42, 0x43, 0x76, 0x77, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x29, 0x2a, 0x95, 0x05, 0x4d, 0x4e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xf8, 0x78, 0x29, 0x2a, 0x80, 0x00, 0x94, 0x04, 0xa4, 0x24, 0xf3, 0x73,
+  0x7d, 0x7e, 0x60, 0x61, 0x19, 0x1a, 0x95, 0x04, 0xca, 0x4a, 0x74, 0x75,
+  0x7d, 0x7e, 0xda, 0x5a, 0xa4, 0x24, 0x94, 0x04, 0xa8, 0x28, 0x5f, 0x60,
+  0xff, 0x7f, 0x71, 0x72, 0x45, 0x46, 0x94, 0x05, 0x0f, 0x10, 0xb8, 0x38,
+  0x78, 0x79, 0x7d, 0x7e, 0x71, 0x72, 0x9d, 0x1d, 0x94, 0x05, 0x8e, 0x0e,
+  0x68, 0x69, 0x7d, 0x7e, 0x7d, 0x7e, 0xf9, 0x79, 0x9a, 0x1a, 0x84, 0x03,
+  0x03, 0x04, 0x87, 0x07, 0xc0, 0x40, 0xa1, 0x21, 0x8b, 0x05, 0x34, 0x35,
+  0xea, 0x6a, 0x7d, 0x7e, 0x7d, 0x7e, 0x4f, 0x50, 0x9b, 0x1b, 0x84, 0x04,
+  0xaa, 0x2a, 0xde, 0x5e, 0x7d, 0x7e, 0x72, 0x73, 0x9b, 0x1b, 0x89, 0x06,
+  0x82, 0x02, 0xc8, 0x48, 0x7b, 0x7c, 0x7d, 0x7e, 0x7d, 0x7e, 0x3f, 0x40,
+  0x83, 0x03, 0x82, 0x06, 0x98, 0x18, 0xc8, 0x48, 0xef, 0x6f, 0xf9, 0x79,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xa5, 0x25, 0x89, 0x11, 0x03, 0x04, 0xc1, 0x41,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x72, 0x73, 0x24, 0x25, 0x01, 0x02, 0x02, 0x03,
+  0x0e, 0x0f, 0x2d, 0x2e, 0x58, 0x59, 0x70, 0x71, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x75, 0x76, 0xd4, 0x54, 0x88, 0x08, 0x88, 0x10, 0x1b, 0x1c,
+  0x50, 0x51, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x76, 0x77, 0x42, 0x43,
+  0x42, 0x43, 0xcd, 0x4d, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x4d, 0x4e, 0x1b, 0x1c, 0x8a, 0x0f, 0xb4, 0x34,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7a, 0x7b,
+  0x50, 0x51, 0xbb, 0x3b, 0x01, 0x02, 0x8b, 0x0c, 0xb4, 0x34, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x75, 0x76,
+  0xe7, 0x67, 0xe7, 0x67, 0x67, 0x68, 0x29, 0x2a, 0x9b, 0x1b, 0x8e, 0x07,
+  0xb4, 0x34, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x55, 0x56, 0xa1, 0x21, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb2,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x86, 0x03, 0x81, 0x01, 0x54, 0x55, 0xff,
+  0x7f, 0x43, 0x44, 0x8c, 0x03, 0x00, 0x01, 0x8f, 0x0f, 0x4d, 0x4e, 0x27,
+  0x28, 0x85, 0x04, 0x82, 0x02, 0x53, 0x54, 0xfe, 0x7e, 0x7b, 0x7c, 0x21,
+  0x22, 0x8b, 0x04, 0x00, 0x01, 0xb6, 0x36, 0xfe, 0x7e, 0x7c, 0x7d, 0x24,
+  0x25, 0x85, 0x03, 0xb3, 0x33, 0xfe, 0x7e, 0xfe, 0x7e, 0x41, 0x42, 0x8b,
+  0x04, 0x85, 0x05, 0xcf, 0x4f, 0xfe, 0x7e, 0x7c, 0x7d, 0x3f, 0x40, 0x85,
+  0x04, 0x1f, 0x20, 0x76, 0x77, 0xfe, 0x7e, 0xf3, 0x73, 0x07, 0x08, 0x8a,
+  0x04, 0x00, 0x01, 0xb6, 0x36, 0xfe, 0x7e, 0xfe, 0x7e, 0xe4, 0x64, 0x85,
+  0x04, 0x04, 0x05, 0x6b, 0x6c, 0xfe, 0x7e, 0xf8, 0x78, 0x8a, 0x0a, 0x8b,
+  0x04, 0x2d, 0x2e, 0xfe, 0x7e, 0xfe, 0x7e, 0xeb, 0x6b, 0x10, 0x11, 0x84,
+  0x04, 0x85, 0x05, 0xd3, 0x53, 0xfe, 0x7e, 0xfe, 0x7e, 0xc3, 0x43, 0x8c,
+  0x03, 0x43, 0x44, 0xfe, 0x7e, 0xfe, 0x7e, 0xb1, 0x31, 0x85, 0x07, 0xa5,
+  0x25, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x58, 0x59, 0xd3, 0x53, 0x49,
+  0x4a, 0x02, 0x03, 0x89, 0x10, 0x43, 0x44, 0xfe, 0x7e, 0xfe, 0x7e, 0x3f,
+  0x40, 0x18, 0x19, 0x18, 0x19, 0x18, 0x19, 0x18, 0x19, 0x18, 0x19, 0x29,
+  0x2a, 0xe2, 0x62, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x67,
+  0x68, 0x1a, 0x1b, 0x8a, 0x0f, 0x43, 0x44, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf4, 0x74, 0x49, 0x4a, 0x83,
+  0x03, 0x8b, 0x0d, 0x95, 0x15, 0x61, 0x62, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xf4, 0x74, 0x2b, 0x2c, 0x95, 0x15, 0x8e, 0x0a, 0x82, 0x02, 0x9e,
+  0x1e, 0x3c, 0x3d, 0x27, 0x28, 0xdc, 0x5c, 0x31, 0x32, 0x33, 0x34, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf4, 0x74, 0x20, 0x21, 0x96, 0x03, 0xae, 0x2e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x46, 0x47, 0x96, 0x04, 0x07, 0x08, 0xe5, 0x65, 0xfe,
+  0x7e, 0x5f, 0x60, 0x12, 0x13, 0x96, 0x03, 0xcc, 0x4c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x9e, 0x1e, 0x97, 0x03, 0x56, 0x57, 0xfe, 0x7e, 0x63, 0x64, 0x84,
+  0x04, 0x96, 0x03, 0x08, 0x09, 0xe6, 0x66, 0xf3, 0x73, 0x1b, 0x1c, 0x97,
+  0x02, 0x15, 0x16, 0xfe, 0x7e, 0xe2, 0x62, 0x98, 0x02, 0x15, 0x16, 0xfe,
+  0x7e, 0xe2, 0x62, 0x98, 0x02, 0x15, 0x16, 0xfe, 0x7e, 0xc5, 0x45, 0x98,
+  0x02, 0x15, 0x16, 0xfe, 0x7e, 0x24, 0x25, 0xc5, 0x00, 0x00, 0xff, 0x9d,
+  0x02, 0xe1, 0x61, 0x7e, 0x7f, 0xa9, 0x29, 0x90, 0x02, 0x07, 0x08, 0xca,
+  0x4a, 0x45, 0x46, 0x83, 0x02, 0x2a, 0x2b, 0xfe, 0x7e, 0xf0, 0x70, 0x91,
+  0x02, 0xdd, 0x5d, 0x7e, 0x7f, 0xf3, 0x73, 0x83, 0x02, 0x73, 0x74, 0x7e,
+  0x7f, 0xf0, 0x70, 0x90, 0x03, 0xb2, 0x32, 0xfb, 0x7b, 0x7e, 0x7f, 0xf3,
+  0x73, 0x82, 0x03, 0x8d, 0x0d, 0x76, 0x77, 0x7e, 0x7f, 0x43, 0x44, 0x8f,
+  0x04, 0x9d, 0x1d, 0x7a, 0x7b, 0x7e, 0x7f, 0x7d, 0x7e, 0xaf, 0x2f, 0x82,
+  0x03, 0xc4, 0x44, 0x7e, 0x7f, 0x7c, 0x7d, 0xa2, 0x22, 0x8f, 0x03, 0x3c,
+  0x3d, 0x7e, 0x7f, 0x7e, 0x7f, 0xc7, 0x47, 0x82, 0x03, 0xa2, 0x22, 0x7c,
+  0x7d, 0x7e, 0x7f, 0x5f, 0x60, 0x8f, 0x04, 0x00, 0x01, 0x5f, 0x60, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x23, 0x24, 0x82, 0x07, 0x26, 0x27, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x3d, 0x3e, 0x00, 0x00, 0x01, 0x02, 0xae, 0x2e, 0xc5, 0x45, 0x8b,
+  0x04, 0xbc, 0x3c, 0x7e, 0x7f, 0x7e, 0x7f, 0xdb, 0x5b, 0x82, 0x02, 0x82,
+  0x07, 0x47, 0x48, 0x7e, 0x7f, 0x7e, 0x7f, 0xa8, 0x28, 0x2e, 0x2f, 0x6b,
+  0x6c, 0x7e, 0x7f, 0x4f, 0x50, 0x8b, 0x03, 0x55, 0x56, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x8e, 0x0e, 0x82, 0x08, 0x1c, 0x1d, 0xf4, 0x74, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x44, 0x45, 0x09, 0x0a, 0x8b,
+  0x0e, 0x55, 0x56, 0x7e, 0x7f, 0x7e, 0x7f, 0xdd, 0x5d, 0x58, 0x59, 0x58,
+  0x59, 0x58, 0x59, 0x73, 0x74, 0x7e, 0x7f, 0xff, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x6d, 0x6e, 0x3a, 0x3b, 0x0a, 0x0b, 0x8c, 0x0c, 0x43, 0x44, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xcc, 0x4c, 0x8c, 0x0c, 0x8e,
+  0x0b, 0x84, 0x04, 0x4d, 0x4e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0x7e, 0x7f, 0xed, 0x6d, 0x19, 0x1a, 0x09,
+  0x0a, 0x90, 0x08, 0x83, 0x03, 0xa0, 0x20, 0xc6, 0x46, 0xc6, 0x46, 0xb0,
+  0x30, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xb5, 0x35, 0x96, 0x04, 0x0b,
+  0x0c, 0x7e, 0x7f, 0x7e, 0x7f, 0xeb, 0x6b, 0x09, 0x0a, 0x96, 0x03, 0x2e,
+  0x2f, 0x7e, 0x7f, 0xff, 0x7f, 0xd1, 0x51, 0x96, 0x04, 0x01, 0x02, 0x6b,
+  0x6c, 0x7e, 0x7f, 0xf9, 0x79, 0x17, 0x18, 0x96, 0x03, 0x92, 0x12, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x51, 0x52, 0x97, 0x03, 0xab, 0x2b, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xa6, 0x26, 0x97, 0x03, 0x01, 0x02, 0x68, 0x69, 0x7e, 0x7f, 0xa6,
+  0x26, 0x98, 0x02, 0x2b, 0x2c, 0x7e, 0x7f, 0xdd, 0x5d, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xf3, 0x07, 0x11, 0x12, 0x18, 0x19, 0x43, 0x44, 0x4e,
+  0x4f, 0x71, 0x72, 0x71, 0x72, 0x71, 0x72, 0xe9, 0x69, 0x90, 0x0a, 0x0f,
+  0x10, 0xb7, 0x37, 0xe1, 0x61, 0x79, 0x7a, 0x7e, 0x7f, 0x7e, 0x7f, 0xfb,
+  0x7b, 0x65, 0x66, 0xc0, 0x40, 0x1e, 0x1f, 0x0c, 0x0d, 0x8d, 0x09, 0x03,
+  0x04, 0xb7, 0x37, 0x61, 0x62, 0x7b, 0x7c, 0x7e, 0x7f, 0xf6, 0x76, 0xe3,
+  0x63, 0x46, 0x47, 0x1b, 0x1c, 0x14, 0x15, 0x8f, 0x07, 0x05, 0x06, 0x32,
+  0x33, 0x68, 0x69, 0x7e, 0x7f, 0x7d, 0x7e, 0x62, 0x63, 0x28, 0x29, 0x87,
+  0x07, 0x91, 0x06, 0x88, 0x08, 0x30, 0x31, 0x68, 0x69, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x54, 0x55, 0x21, 0x22, 0x92, 0x07, 0x24, 0x25, 0x7a, 0x7b, 0x7d,
+  0x7e, 0x7e, 0x7f, 0x62, 0x63, 0xba, 0x3a, 0x0f, 0x10, 0x80, 0x00, 0x93,
+  0x04, 0x52, 0x53, 0x7e, 0x7f, 0x7e, 0x7f, 0xb5, 0x35, 0x01, 0x02, 0x96,
+  0x04, 0xf3, 0x73, 0x7d, 0x7e, 0xff, 0x7f, 0x6a, 0x6b, 0x04, 0x05, 0x96,
+  0x04, 0x8f, 0x0f, 0xab, 0x2b, 0xfd, 0x7d, 0x7e, 0x7f, 0xd4, 0x54, 0x98,
+  0x03, 0xab, 0x2b, 0x7d, 0x7e, 0xfc, 0x7c, 0x2c, 0x2d, 0x98, 0x02, 0x3a,
+  0x3b, 0x7e, 0x7f, 0xce, 0x4e, 0x98, 0x02, 0xa0, 0x20, 0x7e, 0x7f, 0xdc,
+  0x5c, 0x97, 0x03, 0x06, 0x07, 0xdf, 0x5f, 0x7e, 0x7f, 0x4d, 0x4e, 0x96,
+  0x04, 0x19, 0x1a, 0x4d, 0x4e, 0x7e, 0x7f, 0x78, 0x79, 0x92, 0x12, 0x95,
+  0x04, 0x66, 0x67, 0xfe, 0x7e, 0x7e, 0x7f, 0x67, 0x68, 0xa9, 0x29, 0x96,
+  0x03, 0x9d, 0x1d, 0x44, 0x45, 0xbc, 0x3c, 0x03, 0x04, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xb1, 0x0b, 0x8f, 0x0f, 0x10, 0x11, 0x39, 0x3a, 0xc7,
+  0x47, 0x47, 0x48, 0xc7, 0x47, 0xc7, 0x47, 0xe4, 0x64, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfc, 0x7c, 0xbb, 0x3b, 0x8e, 0x0c, 0x1e, 0x1f, 0x7a, 0x7b, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x67, 0x68, 0x8e, 0x0c, 0xac,
+  0x2c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x70,
+  0x71, 0xcc, 0x4c, 0xcc, 0x4c, 0x6c, 0x6d, 0x7d, 0x7e, 0x7d, 0x7e, 0xd2,
+  0x52, 0x8e, 0x0c, 0x01, 0x02, 0x87, 0x07, 0xbc, 0x3c, 0x93, 0x13, 0x04,
+  0x05, 0x04, 0x05, 0x03, 0x04, 0x00, 0x00, 0x0a, 0x0b, 0xe9, 0x69, 0x7d,
+  0x7e, 0x5b, 0x5c, 0x01, 0x02, 0x95, 0x04, 0x0a, 0x0b, 0x66, 0x67, 0x7d,
+  0x7e, 0xf4, 0x74, 0x9b, 0x1b, 0x96, 0x03, 0xc4, 0x44, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x26, 0x27, 0x96, 0x04, 0xd0, 0x50, 0xfc, 0x7c, 0x78, 0x79, 0x35,
+  0x36, 0x82, 0x02, 0x95, 0x03, 0x13, 0x14, 0xef, 0x6f, 0x7d, 0x7e, 0xe9,
+  0x69, 0x97, 0x03, 0xf0, 0x70, 0x7d, 0x7e, 0xd9, 0x59, 0x0f, 0x10, 0x96,
+  0x03, 0xb0, 0x30, 0xfe, 0x7e, 0x7d, 0x7e, 0x34, 0x35, 0x92, 0x08, 0x0a,
+  0x0b, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11, 0xb2, 0x32, 0xfe, 0x7e, 0xff,
+  0x7f, 0xc9, 0x49, 0x02, 0x03, 0x91, 0x0c, 0x3c, 0x3d, 0x70, 0x71, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0xde, 0x5e, 0x52, 0x53, 0xa1, 0x21, 0x87, 0x07, 0x8d, 0x0e, 0x3e,
+  0x3f, 0xfd, 0x7d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x6c, 0x6d, 0xb6, 0x36, 0x8c, 0x0e, 0xe8, 0x68, 0x7c, 0x7d, 0x72,
+  0x73, 0x72, 0x73, 0xc3, 0x43, 0x7d, 0x7e, 0x7d, 0x7e, 0xdc, 0x5c, 0x04,
+  0x05, 0x04, 0x05, 0x04, 0x05, 0x39, 0x3a, 0x98, 0x18, 0xb0, 0x30, 0x87,
+  0x07, 0x8c, 0x01, 0xd1, 0x51, 0x41, 0x42, 0x81, 0x03, 0x11, 0x12, 0x7d,
+  0x7e, 0x64, 0x65, 0x05, 0x06, 0x97, 0x02, 0xcf, 0x4f, 0x7d, 0x7e, 0xd7,
+  0x57, 0x98, 0x02, 0xf3, 0x73, 0x7d, 0x7e, 0xa5, 0x25, 0x98, 0x02, 0xf3,
+  0x73, 0x7d, 0x7e, 0xaa, 0x2a, 0x98, 0x02, 0xba, 0x3a, 0x7d, 0x7e, 0xd7,
+  0x57, 0x98, 0x02, 0x00, 0x01, 0x52, 0x53, 0xd7, 0x57, 0xc6, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xb5, 0x06, 0x3b, 0x3c, 0xf8, 0x78, 0xf8, 0x78, 0x6c,
+  0x6d, 0xc1, 0x41, 0xf0, 0x70, 0x95, 0x15, 0x92, 0x0a, 0x90, 0x10, 0xe8,
+  0x68, 0xfc, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x78, 0x79, 0xce, 0x4e, 0x16, 0x17, 0x8f, 0x0c, 0xa6, 0x26, 0x75,
+  0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf7, 0x77, 0xcd, 0x4d, 0x8d,
+  0x0d, 0xa8, 0x28, 0xea, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0xa5, 0x25, 0x39, 0x3a, 0xd5, 0x55, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0x8c, 0x08, 0x90, 0x10, 0x73, 0x74, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf3, 0x73, 0xa3, 0x23, 0x12, 0x13, 0x0f,
+  0x10, 0x81, 0x04, 0x08, 0x09, 0xd7, 0x57, 0xfe, 0x7e, 0x7d, 0x7e, 0xb4,
+  0x34, 0x8a, 0x06, 0xab, 0x2b, 0x70, 0x71, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xcc, 0x4c, 0x10, 0x11, 0x85, 0x03, 0x09, 0x0a, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x5e, 0x5f, 0x89, 0x06, 0x0f, 0x10, 0x6a, 0x6b, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xf2, 0x72, 0x24, 0x25, 0x85, 0x05, 0x86, 0x03, 0x09, 0x0a, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xbd, 0x3d, 0x89, 0x04, 0x69, 0x6a, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x42, 0x43, 0x87, 0x04, 0x83, 0x03, 0xc9, 0x49, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x2d, 0x2e, 0x88, 0x05, 0x2b, 0x2c, 0x7c, 0x7d, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x2b, 0x2c, 0x04, 0x05, 0x87, 0x03, 0x9c, 0x1c, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0x88, 0x05, 0x0c, 0x0d, 0xea, 0x6a, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x5a, 0x5b, 0x84, 0x04, 0x87, 0x04, 0x99, 0x19, 0x70,
+  0x71, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0x88, 0x04, 0xbe, 0x3e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x41, 0x42, 0x85, 0x07, 0x10, 0x11, 0x22,
+  0x23, 0x57, 0x58, 0x70, 0x71, 0xfe, 0x7e, 0xfe, 0x7e, 0xf1, 0x71, 0x64,
+  0x65, 0x88, 0x04, 0xe9, 0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xd1, 0x51, 0x84,
+  0x04, 0x83, 0x08, 0x8f, 0x0f, 0x22, 0x23, 0x72, 0x73, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfc, 0x7c, 0x65, 0x66, 0x92, 0x12, 0x89, 0x0f, 0xff,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0x98, 0x18, 0x90, 0x10, 0x90, 0x10, 0x90,
+  0x10, 0x90, 0x10, 0xc4, 0x44, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xeb, 0x6b, 0xa8, 0x28, 0x8b, 0x0e, 0xf8, 0x78, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7b, 0x7c, 0xe5, 0x65, 0xb0,
+  0x30, 0x91, 0x11, 0x8c, 0x0b, 0xb9, 0x39, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0x74, 0x75, 0x79,
+  0x7a, 0x74, 0x75, 0xbb, 0x3b, 0x90, 0x08, 0x35, 0x36, 0x74, 0x75, 0x77,
+  0x78, 0x77, 0x78, 0x77, 0x78, 0x77, 0x78, 0xb1, 0x31, 0x00, 0x00, 0x9c,
+  0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x0a, 0x80, 0x00, 0x9f,
+  0x1f, 0x47, 0x48, 0x47, 0x48, 0x47, 0x48, 0xc8, 0x48, 0x47, 0x48, 0x47,
+  0x48, 0x1e, 0x1f, 0x80, 0x00, 0x80, 0x00, 0x8f, 0x0b, 0xa7, 0x27, 0xdf,
+  0x5f, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x30, 0x31, 0x8c, 0x0f, 0x80,
+  0x00, 0x42, 0x43, 0xec, 0x6c, 0x78, 0x79, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x78, 0x79, 0xb3, 0x33, 0x8a, 0x11, 0x97, 0x17, 0xda,
+  0x5a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xec, 0x6c, 0xad,
+  0x2d, 0xa3, 0x23, 0xa3, 0x23, 0x23, 0x24, 0xa3, 0x23, 0x2d, 0x2e, 0xeb,
+  0x6b, 0xfe, 0x7e, 0x7d, 0x7e, 0xf8, 0x78, 0x26, 0x27, 0x89, 0x05, 0xda,
+  0x5a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x53, 0x54, 0x87,
+  0x03, 0x54, 0x55, 0x7d, 0x7e, 0x7d, 0x7e, 0x5e, 0x5f, 0x88, 0x05, 0xc3,
+  0x43, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4c, 0x4d, 0x88,
+  0x03, 0x97, 0x17, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0x88, 0x05, 0xec,
+  0x6c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf3, 0x73, 0x99, 0x19, 0x88,
+  0x03, 0xb6, 0x36, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x87, 0x05, 0x07,
+  0x08, 0x6e, 0x6f, 0x7d, 0x7e, 0x7d, 0x7e, 0x56, 0x57, 0x99, 0x19, 0x87,
+  0x05, 0x8d, 0x0d, 0x3b, 0x3c, 0x69, 0x6a, 0x7d, 0x7e, 0x7d, 0x7e, 0x49,
+  0x4a, 0x87, 0x04, 0xdf, 0x5f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x1e,
+  0x1f, 0x87, 0x06, 0xbe, 0x3e, 0xee, 0x6e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x49, 0x4a, 0x16, 0x17, 0x87, 0x03, 0xff, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x35, 0x36, 0x83, 0x0a, 0x36, 0x37, 0xb6, 0x36, 0xc0, 0x40, 0xfe,
+  0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0x6e,
+  0x6f, 0x94, 0x14, 0x88, 0x11, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x73,
+  0x74, 0xec, 0x6c, 0xec, 0x6c, 0xec, 0x6c, 0xec, 0x6c, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xf8, 0x78, 0xd9,
+  0x59, 0xbb, 0x3b, 0x8c, 0x0c, 0x89, 0x0e, 0xca, 0x4a, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7a, 0x7b, 0xeb, 0x6b, 0xec, 0x6c, 0xad, 0x2d, 0x9e,
+  0x1e, 0x8c, 0x0a, 0x97, 0x17, 0x73, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xdf, 0x5f, 0x35, 0x36, 0x2d,
+  0x2e, 0x92, 0x04, 0xb4, 0x34, 0x47, 0x48, 0x47, 0x48, 0x47, 0x48, 0x94,
+  0x14, 0xff, 0xb7, 0x00, 0x00, 0x00, 0xff, 0x9d, 0x03, 0x9a, 0x1a, 0xff,
+  0x7f, 0xfe, 0x7e, 0xab, 0x2b, 0x96, 0x04, 0x9f, 0x1f, 0xee, 0x6e, 0xfe,
+  0x7e, 0xfd, 0x7d, 0xeb, 0x6b, 0x94, 0x06, 0x8a, 0x0a, 0x9f, 0x1f, 0xf3,
+  0x73, 0xfd, 0x7d, 0x78, 0x79, 0xeb, 0x6b, 0x9b, 0x1b, 0x94, 0x05, 0xa9,
+  0x29, 0x75, 0x76, 0xfd, 0x7d, 0xfd, 0x7d, 0x69, 0x6a, 0x97, 0x17, 0x95,
+  0x05, 0xb4, 0x34, 0xf8, 0x78, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0xb5,
+  0x35, 0x94, 0x05, 0xbe, 0x3e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x40, 0x41, 0x94, 0x05, 0xb4, 0x34, 0xfe, 0x7e, 0xfd, 0x7d, 0xfd,
+  0x7d, 0x5d, 0x5e, 0xb5, 0x35, 0x94, 0x06, 0x07, 0x08, 0x5e, 0x5f, 0xfe,
+  0x7e, 0xfd, 0x7d, 0xfd, 0x7d, 0x6d, 0x6e, 0x99, 0x19, 0x93, 0x06, 0x2e,
+  0x2f, 0x54, 0x55, 0xfd, 0x7d, 0xfe, 0x7e, 0xfd, 0x7d, 0xf5, 0x75, 0x28,
+  0x29, 0x94, 0x05, 0xab, 0x2b, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0xfd,
+  0x7d, 0xeb, 0x6b, 0x94, 0x06, 0x14, 0x15, 0x71, 0x72, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xff, 0x7f, 0xe9, 0x69, 0x8c, 0x0c, 0x93, 0x06, 0x14, 0x15, 0x66,
+  0x67, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xe9, 0x69, 0x16, 0x17, 0x94,
+  0x05, 0xa4, 0x24, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xf0, 0x70, 0x8c,
+  0x0c, 0x95, 0x04, 0x4a, 0x4b, 0xfd, 0x7d, 0xfd, 0x7d, 0x65, 0x66, 0x94,
+  0x14, 0x96, 0x03, 0xfe, 0x7e, 0xfd, 0x7d, 0xfd, 0x7d, 0x46, 0x47, 0x95,
+  0x04, 0x36, 0x37, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x51, 0x52, 0x96,
+  0x04, 0xb6, 0x36, 0xfd, 0x7d, 0xfe, 0x7e, 0xfd, 0x7d, 0x91, 0x11, 0x95,
+  0x05, 0x8d, 0x0d, 0xe9, 0x69, 0xfd, 0x7d, 0xe4, 0x64, 0x18, 0x19, 0x82,
+  0x02, 0x96, 0x03, 0xb6, 0x36, 0xfd, 0x7d, 0xee, 0x6e, 0x9e, 0x1e, 0x96,
+  0x03, 0x4d, 0x4e, 0xe9, 0x69, 0x3c, 0x3d, 0x99, 0x19, 0xe5, 0x00, 0x00,
+  0x00, 0x00, 0xcb, 0x03, 0x93, 0x13, 0xf0, 0x70, 0xff, 0x7f, 0x74, 0x75,
+  0x95, 0x05, 0x17, 0x18, 0xf1, 0x71, 0x77, 0x78, 0xfe, 0x7e, 0xf6, 0x76,
+  0x22, 0x23, 0x94, 0x05, 0x17, 0x18, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xe0, 0x60, 0x24, 0x25, 0x93, 0x06, 0x94, 0x14, 0xc8, 0x48, 0xf1, 0x71,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x4f, 0x50, 0x86, 0x06, 0x93, 0x06, 0x20, 0x21,
+  0xf3, 0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0x75, 0x76, 0xac, 0x2c, 0x85, 0x05,
+  0x92, 0x06, 0x02, 0x03, 0x9f, 0x1f, 0x74, 0x75, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x78, 0x79, 0x9a, 0x1a, 0x94, 0x05, 0xb7, 0x37, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x53, 0x54, 0x9a, 0x1a, 0x93, 0x06, 0x02, 0x03, 0xb7, 0x37,
+  0xfb, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0x48, 0x49, 0x00, 0x01, 0x94, 0x05,
+  0x9f, 0x1f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc7, 0x47, 0x83, 0x03,
+  0x94, 0x05, 0x20, 0x21, 0x74, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xc7, 0x47,
+  0x84, 0x04, 0x94, 0x05, 0x85, 0x05, 0xdd, 0x5d, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x55, 0x56, 0x83, 0x03, 0x94, 0x0d, 0x84, 0x04, 0xcb, 0x4b, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xeb, 0x6b, 0xd2, 0x52, 0xd2, 0x52, 0xd2, 0x52,
+  0xd2, 0x52, 0xd2, 0x52, 0x30, 0x31, 0x0d, 0x0e, 0x01, 0x02, 0x8d, 0x0d,
+  0x25, 0x26, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x37, 0x38, 0x8d, 0x0e, 0x25, 0x26, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe9, 0x69, 0x8d, 0x0d,
+  0x8b, 0x0f, 0x13, 0x14, 0xef, 0x6f, 0xfe, 0x7e, 0xfe, 0x7e, 0x7b, 0x7c,
+  0x4a, 0x4b, 0x07, 0x08, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06,
+  0x2e, 0x2f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x1a, 0x1b, 0x8b, 0x04,
+  0xc6, 0x46, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x3b, 0x3c, 0x84, 0x05,
+  0x84, 0x04, 0x50, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0xda, 0x5a, 0x03, 0x04,
+  0x8b, 0x0e, 0x74, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc5, 0x45,
+  0x8f, 0x0f, 0x8d, 0x0d, 0x9f, 0x1f, 0x9f, 0x1f, 0xac, 0x2c, 0xe6, 0x66,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x71, 0x72, 0xc0, 0x40, 0x8c, 0x0d, 0x74, 0x75,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xeb, 0x6b, 0xe9, 0x69,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf4, 0x74,
+  0x99, 0x19, 0x8d, 0x0c, 0x45, 0x46, 0x79, 0x7a, 0xf6, 0x76, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc, 0x7c,
+  0x73, 0x74, 0x4c, 0x4d, 0x98, 0x18, 0x8f, 0x08, 0x9f, 0x1f, 0x0c, 0x0d,
+  0x39, 0x3a, 0x62, 0x63, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6b, 0x6c,
+  0x2e, 0x2f, 0xff, 0xb3, 0x00, 0x00, 0xcb, 0x03, 0x0c, 0x0d, 0x46, 0x47,
+  0xff, 0x7f, 0xd8, 0x58, 0x97, 0x03, 0xda, 0x5a, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xb5, 0x35, 0x95, 0x05, 0x0e, 0x0f, 0x63, 0x64, 0xfb, 0x7b, 0xfe, 0x7e,
+  0xd9, 0x59, 0x85, 0x05, 0x94, 0x05, 0xa4, 0x24, 0x66, 0x67, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x57, 0x58, 0x87, 0x07, 0x94, 0x05, 0xbc, 0x3c, 0x7b, 0x7c,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xd7, 0x57, 0x88, 0x08, 0x94, 0x05, 0x3a, 0x3b,
+  0x7c, 0x7d, 0xfe, 0x7e, 0x75, 0x76, 0x51, 0x52, 0x08, 0x09, 0x93, 0x05,
+  0x04, 0x05, 0x56, 0x57, 0x7e, 0x7f, 0xfe, 0x7e, 0x76, 0x77, 0xa5, 0x25,
+  0x94, 0x05, 0x08, 0x09, 0x36, 0x37, 0xfe, 0x7e, 0x7e, 0x7f, 0x78, 0x79,
+  0x23, 0x24, 0x93, 0x06, 0x81, 0x01, 0x06, 0x07, 0xd2, 0x52, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xd8, 0x58, 0x1e, 0x1f, 0x94, 0x04, 0x1a, 0x1b, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x95, 0x04, 0x0f, 0x10, 0x6d, 0x6e,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xf8, 0x78, 0x82, 0x03, 0x96, 0x16, 0xbc, 0x3c,
+  0xbc, 0x3c, 0x0f, 0x10, 0x8e, 0x0d, 0x91, 0x11, 0xec, 0x6c, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xb2, 0x32, 0x05, 0x06, 0x00, 0x00, 0x19, 0x1a, 0xf5, 0x75,
+  0x7a, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0x41, 0x42, 0x8c, 0x05,
+  0x91, 0x11, 0xeb, 0x6b, 0xfe, 0x7e, 0xfe, 0x7e, 0xd3, 0x53, 0x04, 0x05,
+  0x81, 0x07, 0xf8, 0x78, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfc, 0x7c, 0x29, 0x2a, 0x8a, 0x10, 0xa6, 0x26, 0xeb, 0x6b,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xd2, 0x52, 0x8c, 0x0c, 0xaf, 0x2f, 0xc7, 0x47,
+  0x6a, 0x6b, 0x7e, 0x7f, 0x57, 0x58, 0xd6, 0x56, 0xd6, 0x56, 0x60, 0x61,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xae, 0x2e, 0x8a, 0x10, 0xf8, 0x78, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xc7, 0x47, 0xe8, 0x68, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x6c, 0x6d, 0x3d, 0x3e, 0x81, 0x01, 0x00, 0x00, 0x31, 0x32, 0xeb, 0x6b,
+  0xfe, 0x7e, 0xf9, 0x79, 0xa2, 0x22, 0x8a, 0x0f, 0xf8, 0x78, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xed, 0x6d, 0x3c, 0x3d,
+  0x8f, 0x0f, 0x00, 0x00, 0x8b, 0x0b, 0x56, 0x57, 0xf9, 0x79, 0xfe, 0x7e,
+  0x78, 0x79, 0x30, 0x31, 0x8b, 0x0e, 0xf8, 0x78, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x73, 0x74, 0x17, 0x18, 0x94, 0x14, 0x94, 0x14,
+  0xd7, 0x57, 0xe7, 0x67, 0xfe, 0x7e, 0xfe, 0x7e, 0xf9, 0x79, 0x30, 0x31,
+  0x8b, 0x0e, 0x1f, 0x20, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x65, 0x66, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x3a, 0x3b, 0xa2, 0x22, 0x8d, 0x0c, 0x96, 0x16,
+  0xf3, 0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x7b, 0x7c, 0x77, 0x78, 0x3b, 0x3c, 0x88, 0x08,
+  0x8f, 0x08, 0x2e, 0x2f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xf7, 0x77, 0x3b, 0x3c, 0x3b, 0x3c, 0x1f, 0x20, 0xff, 0xb3, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x9b, 0x07, 0x82, 0x02, 0xb7, 0x37, 0x47, 0x48, 0x7c,
+  0x7d, 0x5a, 0x5b, 0x47, 0x48, 0x95, 0x15, 0x0d, 0x0e, 0x91, 0x0a, 0x8a,
+  0x0a, 0xb9, 0x39, 0x5d, 0x5e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x77, 0x78, 0x3d, 0x3e, 0x8e, 0x0c, 0x17,
+  0x18, 0xd3, 0x53, 0xef, 0x6f, 0xfe, 0x7e, 0x7e, 0x7f, 0x5b, 0x5c, 0x4c,
+  0x4d, 0xb0, 0x30, 0x15, 0x16, 0x40, 0x41, 0x64, 0x65, 0xfe, 0x7e, 0xaa,
+  0x2a, 0x8c, 0x07, 0x82, 0x02, 0x9e, 0x1e, 0xf7, 0x77, 0xfe, 0x7e, 0xfb,
+  0x7b, 0xdb, 0x5b, 0x9d, 0x1d, 0x01, 0x02, 0x83, 0x02, 0x0e, 0x0f, 0x68,
+  0x69, 0xd5, 0x55, 0x8b, 0x05, 0x82, 0x02, 0xc9, 0x49, 0xfe, 0x7e, 0xfd,
+  0x7d, 0x62, 0x63, 0x2c, 0x2d, 0x83, 0x05, 0x82, 0x02, 0x1b, 0x1c, 0x46,
+  0x47, 0x7a, 0x7b, 0xfe, 0x7e, 0x4b, 0x4c, 0x8b, 0x03, 0x9e, 0x1e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x65, 0x66, 0x85, 0x05, 0x49, 0x4a, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xe3, 0x63, 0x95, 0x15, 0x8a, 0x04, 0x82, 0x02, 0xf5,
+  0x75, 0xfe, 0x7e, 0xd3, 0x53, 0x85, 0x05, 0x82, 0x07, 0x83, 0x03, 0x94,
+  0x14, 0xea, 0x6a, 0xfe, 0x7e, 0x7a, 0x7b, 0x78, 0x79, 0x2b, 0x2c, 0x84,
+  0x04, 0x8b, 0x04, 0xa9, 0x29, 0x73, 0x74, 0xfe, 0x7e, 0x2c, 0x2d, 0x0b,
+  0x0c, 0x82, 0x04, 0xd1, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0x77, 0x78, 0x91,
+  0x11, 0x8f, 0x03, 0x15, 0x16, 0xf1, 0x71, 0xfe, 0x7e, 0x6a, 0x6b, 0x81,
+  0x04, 0xba, 0x3a, 0xff, 0x7f, 0xfe, 0x7e, 0xef, 0x6f, 0xb8, 0x38, 0x90,
+  0x09, 0x04, 0x05, 0x4d, 0x4e, 0xfe, 0x7e, 0x7d, 0x7e, 0xd6, 0x56, 0xee,
+  0x6e, 0xfc, 0x7c, 0x7e, 0x7f, 0xc9, 0x49, 0x09, 0x0a, 0x93, 0x05, 0x93,
+  0x13, 0xf9, 0x79, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xc8, 0x48, 0x94,
+  0x05, 0x87, 0x07, 0x34, 0x35, 0xfb, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xc9,
+  0x49, 0x95, 0x05, 0xc9, 0x49, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x6b, 0x6c, 0x93, 0x08, 0x84, 0x04, 0x2c, 0x2d, 0x7c, 0x7d, 0x7a,
+  0x7b, 0xd6, 0x56, 0x06, 0x07, 0x61, 0x62, 0x79, 0x7a, 0x98, 0x18, 0x92,
+  0x08, 0x31, 0x32, 0xfe, 0x7e, 0xfe, 0x7e, 0xba, 0x3a, 0x00, 0x00, 0x91,
+  0x11, 0xf7, 0x77, 0xd3, 0x53, 0x8c, 0x0c, 0x91, 0x04, 0x0b, 0x0c, 0x64,
+  0x65, 0xfe, 0x7e, 0xe1, 0x61, 0x1d, 0x1e, 0x81, 0x02, 0x5d, 0x5e, 0xfe,
+  0x7e, 0xa4, 0x24, 0x91, 0x08, 0xd1, 0x51, 0xfe, 0x7e, 0xf4, 0x74, 0x03,
+  0x04, 0x00, 0x00, 0x02, 0x03, 0xde, 0x5e, 0x7b, 0x7c, 0x33, 0x34, 0x92,
+  0x08, 0xa1, 0x21, 0xfe, 0x7e, 0xdd, 0x5d, 0x96, 0x16, 0x29, 0x2a, 0xcf,
+  0x4f, 0xfe, 0x7e, 0xfe, 0x7e, 0x3d, 0x3e, 0x92, 0x08, 0xb2, 0x32, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x77, 0x78, 0x46,
+  0x47, 0x84, 0x04, 0x92, 0x06, 0x8b, 0x0b, 0xbe, 0x3e, 0xfc, 0x7c, 0xf2,
+  0x72, 0xc7, 0x47, 0xc7, 0x47, 0x22, 0x23, 0xe1, 0x00, 0x00, 0xfb, 0x09,
+  0x1f, 0x20, 0xbc, 0x3c, 0x57, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd4, 0x54, 0x88, 0x00, 0x9c, 0x1c,
+  0x84, 0x0d, 0x88, 0x08, 0xbc, 0x3c, 0x77, 0x78, 0x7a, 0x7b, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfd, 0x7d, 0x38, 0x39, 0x87, 0x00, 0x06, 0x07, 0x82, 0x0f,
+  0x8c, 0x0c, 0x5f, 0x60, 0x72, 0x73, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xd6, 0x56, 0x4e, 0x4f, 0x4e, 0x4f,
+  0xef, 0x6f, 0x7d, 0x7e, 0x7d, 0x7e, 0xbb, 0x3b, 0x8b, 0x0f, 0xa1, 0x21,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe6, 0x66, 0x55, 0x56, 0x36, 0x37,
+  0x93, 0x13, 0x93, 0x13, 0x02, 0x03, 0x00, 0x00, 0x16, 0x17, 0x77, 0x78,
+  0x7d, 0x7e, 0x7b, 0x7c, 0x28, 0x29, 0x8b, 0x04, 0x06, 0x07, 0xbd, 0x3d,
+  0x9a, 0x1a, 0x9a, 0x1a, 0x0a, 0x0b, 0x84, 0x04, 0x9a, 0x1a, 0xe9, 0x69,
+  0x7d, 0x7e, 0xfa, 0x7a, 0x34, 0x35, 0x95, 0x04, 0x16, 0x17, 0x57, 0x58,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x95, 0x05, 0x87, 0x07, 0xed, 0x6d,
+  0x7d, 0x7e, 0xf9, 0x79, 0xbc, 0x3c, 0x8e, 0x0e, 0x94, 0x04, 0x05, 0x06,
+  0x59, 0x5a, 0x7d, 0x7e, 0xfa, 0x7a, 0xd8, 0x58, 0x95, 0x04, 0x06, 0x07,
+  0xdc, 0x5c, 0x7d, 0x7e, 0x7b, 0x7c, 0x34, 0x35, 0x96, 0x03, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x32, 0x33, 0x95, 0x04, 0xa6, 0x26, 0xfe, 0x7e,
+  0xff, 0x7f, 0x64, 0x65, 0xaa, 0x2a, 0x94, 0x05, 0x88, 0x08, 0xbc, 0x3c,
+  0xfb, 0x7b, 0x7d, 0x7e, 0x64, 0x65, 0x29, 0x2a, 0x94, 0x05, 0x09, 0x0a,
+  0xbb, 0x3b, 0x7d, 0x7e, 0x7d, 0x7e, 0x64, 0x65, 0x06, 0x07, 0x94, 0x05,
+  0x0a, 0x0b, 0xdd, 0x5d, 0x7d, 0x7e, 0x7d, 0x7e, 0x3f, 0x40, 0x89, 0x09,
+  0x94, 0x05, 0x0a, 0x0b, 0x5c, 0x5d, 0x7d, 0x7e, 0xf8, 0x78, 0xd5, 0x55,
+  0x0a, 0x0b, 0x89, 0x00, 0x11, 0x12, 0x8a, 0x03, 0xb6, 0x36, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x5b, 0x5c, 0x87, 0x04, 0x05, 0x06, 0x1a, 0x1b, 0x44, 0x45,
+  0x5c, 0x5d, 0xbd, 0x3d, 0x89, 0x11, 0xa0, 0x20, 0x77, 0x78, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x2a, 0x2b, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14,
+  0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x25, 0x26, 0x5e, 0x5f, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xee, 0x6e, 0x12, 0x13, 0x89, 0x10, 0x2e, 0x2f, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xe5, 0x65, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xf4, 0x74, 0xe9, 0x69, 0x93, 0x13, 0x8a, 0x0e, 0xac, 0x2c, 0x7c, 0x7d,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7b, 0x7c, 0xe5, 0x65, 0x34, 0x35,
+  0x90, 0x10, 0x8d, 0x0a, 0x46, 0x47, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x3b, 0x3c, 0xde, 0x5e, 0xbb, 0x3b,
+  0x28, 0x29, 0xfa, 0x00, 0x00, 0x00, 0xff, 0xb2, 0x09, 0x0b, 0x0c, 0x0b,
+  0x0c, 0x0b, 0x0c, 0x3a, 0x3b, 0xdf, 0x5f, 0xff, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xd4, 0x54, 0x81, 0x01, 0x8d, 0x0d, 0x0e, 0x0f, 0x97, 0x17, 0x45,
+  0x46, 0xd0, 0x50, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x0a, 0x0b, 0x8c,
+  0x0e, 0x98, 0x18, 0x71, 0x72, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe1, 0x61, 0xdb, 0x5b, 0xc1, 0x41, 0xf1,
+  0x71, 0x7d, 0x7e, 0xf1, 0x71, 0x07, 0x08, 0x8c, 0x0d, 0x15, 0x16, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x68, 0x69, 0xd0, 0x50, 0xab, 0x2b, 0x96,
+  0x16, 0x84, 0x04, 0x00, 0x00, 0x84, 0x04, 0x60, 0x61, 0x7d, 0x7e, 0x4f,
+  0x50, 0x8d, 0x04, 0x81, 0x01, 0xa5, 0x25, 0x0a, 0x0b, 0x0a, 0x0b, 0x05,
+  0x06, 0x84, 0x03, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d, 0x7e, 0x35, 0x36, 0x97,
+  0x03, 0xca, 0x4a, 0xfe, 0x7e, 0xfb, 0x7b, 0x14, 0x15, 0x96, 0x03, 0x0a,
+  0x0b, 0xfe, 0x7e, 0x7d, 0x7e, 0x50, 0x51, 0x97, 0x03, 0x39, 0x3a, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xa2, 0x22, 0x97, 0x03, 0x68, 0x69, 0xfe, 0x7e, 0x6a,
+  0x6b, 0x86, 0x06, 0x96, 0x0b, 0x43, 0x44, 0x7c, 0x7d, 0xfe, 0x7e, 0x66,
+  0x67, 0xaa, 0x2a, 0x39, 0x3a, 0x39, 0x3a, 0xbf, 0x3f, 0x72, 0x73, 0xe3,
+  0x63, 0x68, 0x69, 0xa4, 0x24, 0x89, 0x11, 0x83, 0x03, 0x0b, 0x0c, 0x3f,
+  0x40, 0xca, 0x4a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xf7,
+  0x77, 0x72, 0x73, 0x5d, 0x5e, 0x9f, 0x1f, 0x88, 0x0f, 0x84, 0x04, 0xcd,
+  0x4d, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xef, 0x6f, 0x66, 0x67, 0x66, 0x67, 0x32,
+  0x33, 0x2d, 0x2e, 0x90, 0x10, 0x8b, 0x0a, 0x40, 0x41, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xeb, 0x6b, 0x61, 0x62, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x3c, 0x3d, 0x8c, 0x0c, 0x90, 0x08, 0xd0, 0x50, 0x7d, 0x7e, 0x6c,
+  0x6d, 0x35, 0x36, 0x8a, 0x0a, 0x0c, 0x0d, 0xee, 0x6e, 0x7d, 0x7e, 0xce,
+  0x4e, 0x92, 0x02, 0x2b, 0x2c, 0xde, 0x5e, 0x91, 0x11, 0x81, 0x03, 0x97,
+  0x17, 0x7d, 0x7e, 0x7d, 0x7e, 0xc4, 0x44, 0x97, 0x03, 0x97, 0x17, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x8b, 0x0b, 0x97, 0x03, 0x97, 0x17, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x0a, 0x0b, 0x97, 0x03, 0x97, 0x17, 0x7d, 0x7e, 0x7d, 0x7e, 0x0a,
+  0x0b, 0x97, 0x03, 0x97, 0x17, 0x7d, 0x7e, 0x7d, 0x7e, 0xa0, 0x20, 0x97,
+  0x03, 0x0c, 0x0d, 0x53, 0x54, 0x7d, 0x7e, 0xaa, 0x2a, 0xc3, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xae, 0x0d, 0x89, 0x09, 0x86, 0x06, 0x0b, 0x0c, 0x0b,
+  0x0c, 0x35, 0x36, 0x44, 0x45, 0x44, 0x45, 0xc5, 0x45, 0x44, 0x45, 0x54,
+  0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0x3f, 0x40, 0x84, 0x04, 0x8d, 0x0d, 0xe7,
+  0x67, 0xe9, 0x69, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x51, 0x52, 0x8d, 0x0d, 0xe7, 0x67, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x64, 0x65, 0xdb, 0x5b, 0xdb, 0x5b, 0x5b, 0x5c, 0xdb, 0x5b, 0xdb,
+  0x5b, 0xdb, 0x5b, 0xeb, 0x6b, 0xfe, 0x7e, 0x66, 0x67, 0x8d, 0x04, 0x92,
+  0x12, 0x96, 0x16, 0x16, 0x17, 0x96, 0x16, 0x86, 0x06, 0x85, 0x03, 0x8a,
+  0x0a, 0xfe, 0x7e, 0x79, 0x7a, 0x1b, 0x1c, 0x97, 0x03, 0x34, 0x35, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xa2, 0x22, 0x97, 0x03, 0x39, 0x3a, 0xff, 0x7f, 0xfe,
+  0x7e, 0xa2, 0x22, 0x96, 0x04, 0x88, 0x08, 0xe0, 0x60, 0xfe, 0x7e, 0x64,
+  0x65, 0x8c, 0x0c, 0x95, 0x04, 0x89, 0x09, 0x5d, 0x5e, 0x7d, 0x7e, 0xe6,
+  0x66, 0x8c, 0x0c, 0x96, 0x03, 0x22, 0x23, 0x7d, 0x7e, 0x7d, 0x7e, 0x39,
+  0x3a, 0x96, 0x04, 0x0a, 0x0b, 0xe6, 0x66, 0x7d, 0x7e, 0x7d, 0x7e, 0x85,
+  0x05, 0x81, 0x00, 0x9a, 0x1a, 0x8c, 0x00, 0x85, 0x05, 0x85, 0x07, 0x97,
+  0x17, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xca, 0x4a, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x4a, 0x4b, 0x88, 0x12, 0x82, 0x02, 0x21, 0x22, 0xd0, 0x50, 0xd0,
+  0x50, 0xe5, 0x65, 0x50, 0x51, 0xd0, 0x50, 0xd0, 0x50, 0xd0, 0x50, 0xd0,
+  0x50, 0x50, 0x51, 0x58, 0x59, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0xef, 0x6f, 0xbd, 0x3d, 0x88, 0x08, 0x88, 0x10, 0x0b, 0x0c, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xee, 0x6e, 0xd6, 0x56, 0x8c, 0x0c, 0x8a, 0x0e, 0x87, 0x07, 0x64,
+  0x65, 0x4f, 0x50, 0x4f, 0x50, 0x64, 0x65, 0xd4, 0x54, 0xe0, 0x60, 0x4f,
+  0x50, 0x4f, 0x50, 0x4f, 0x50, 0xe9, 0x69, 0x7d, 0x7e, 0x7d, 0x7e, 0x6c,
+  0x6d, 0x91, 0x11, 0x8d, 0x00, 0x85, 0x05, 0x81, 0x02, 0x85, 0x05, 0x81,
+  0x01, 0x03, 0x04, 0x82, 0x03, 0xf9, 0x79, 0x7d, 0x7e, 0xde, 0x5e, 0x06,
+  0x07, 0x97, 0x02, 0xff, 0x7f, 0xfe, 0x7e, 0xd6, 0x56, 0x97, 0x03, 0x0a,
+  0x0b, 0xfe, 0x7e, 0x7d, 0x7e, 0xa2, 0x22, 0x97, 0x03, 0x29, 0x2a, 0xfe,
+  0x7e, 0xf3, 0x73, 0x92, 0x12, 0x98, 0x02, 0xfe, 0x7e, 0x6a, 0x6b, 0x86,
+  0x06, 0x98, 0x01, 0x49, 0x4a, 0x66, 0x67, 0xc3, 0x00, 0x00, 0xff, 0x97,
+  0x0c, 0x9f, 0x1f, 0x36, 0x37, 0xb6, 0x36, 0xb6, 0x36, 0xb6, 0x36, 0xff,
+  0x7f, 0x3f, 0x40, 0x69, 0x6a, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xca,
+  0x4a, 0x97, 0x17, 0x89, 0x11, 0x9a, 0x1a, 0xa4, 0x24, 0xec, 0x6c, 0xec,
+  0x6c, 0xec, 0x6c, 0xf6, 0x76, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x49, 0x4a, 0x89, 0x11, 0xda, 0x5a, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xf8, 0x78, 0xeb,
+  0x6b, 0xeb, 0x6b, 0xec, 0x6c, 0xeb, 0x6b, 0xeb, 0x6b, 0xeb, 0x6b, 0x73,
+  0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x49, 0x4a, 0x89, 0x07, 0xda, 0x5a, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x53, 0x54, 0x35, 0x36, 0xa6,
+  0x26, 0x85, 0x03, 0xb6, 0x36, 0x7d, 0x7e, 0x7d, 0x7e, 0x35, 0x36, 0x89,
+  0x03, 0x33, 0x34, 0xc7, 0x47, 0xc7, 0x47, 0x09, 0x0a, 0x88, 0x04, 0x9f,
+  0x1f, 0xfe, 0x7e, 0x7d, 0x7e, 0x75, 0x76, 0x1e, 0x1f, 0x94, 0x05, 0x8a,
+  0x0a, 0x57, 0x58, 0xf6, 0x76, 0xfe, 0x7e, 0xf3, 0x73, 0xa3, 0x23, 0x94,
+  0x05, 0xa7, 0x27, 0xe4, 0x64, 0x7d, 0x7e, 0x7d, 0x7e, 0xec, 0x6c, 0xa3,
+  0x23, 0x94, 0x04, 0x29, 0x2a, 0xdf, 0x5f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x95, 0x04, 0xb1, 0x31, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x4c,
+  0x4d, 0x95, 0x05, 0xb4, 0x34, 0x78, 0x79, 0x7d, 0x7e, 0xfe, 0x7e, 0x49,
+  0x4a, 0x04, 0x05, 0x93, 0x06, 0xb4, 0x34, 0x5a, 0x5b, 0x78, 0x79, 0x7d,
+  0x7e, 0xf3, 0x73, 0x4c, 0x4d, 0x04, 0x05, 0x93, 0x05, 0xb4, 0x34, 0x66,
+  0x67, 0xfe, 0x7e, 0x7d, 0x7e, 0xf3, 0x73, 0x16, 0x17, 0x92, 0x06, 0x80,
+  0x00, 0xb6, 0x36, 0x4a, 0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xbb,
+  0x3b, 0x85, 0x02, 0x36, 0x37, 0x4a, 0x4b, 0xc2, 0x42, 0x8b, 0x06, 0x14,
+  0x15, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x68, 0x69, 0x91, 0x11, 0x82,
+  0x02, 0x81, 0x06, 0x0f, 0x10, 0xb9, 0x39, 0xec, 0x6c, 0xec, 0x6c, 0xfe,
+  0x7e, 0x49, 0x4a, 0x0e, 0x0f, 0x89, 0x10, 0x85, 0x05, 0x45, 0x46, 0xee,
+  0x6e, 0x7d, 0x7e, 0xf8, 0x78, 0xe1, 0x61, 0x8f, 0x0f, 0x00, 0x00, 0x0f,
+  0x10, 0x1c, 0x1d, 0xda, 0x5a, 0x69, 0x6a, 0x7d, 0x7e, 0x7d, 0x7e, 0xf3,
+  0x73, 0x4c, 0x4d, 0x04, 0x05, 0x8a, 0x04, 0xcd, 0x4d, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xd9, 0x59, 0x81, 0x07, 0x9f, 0x1f, 0xf6, 0x76, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x49, 0x4a, 0x16, 0x17, 0x8b,
+  0x0b, 0x36, 0x37, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xf6, 0x76, 0x47,
+  0x48, 0x8f, 0x0a, 0xf4, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xde, 0x5e, 0xcc,
+  0x4c, 0x90, 0x09, 0x73, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7a, 0x7b, 0xeb, 0x6b, 0x23, 0x24, 0x04, 0x05, 0x91,
+  0x06, 0xb6, 0x36, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x68,
+  0x69, 0x2d, 0x2e, 0xe3, 0x00, 0x00, 0xff, 0xa1, 0x02, 0x02, 0x03, 0x3e,
+  0x3f, 0xc1, 0x41, 0x96, 0x04, 0x82, 0x02, 0xa0, 0x20, 0x7a, 0x7b, 0xfc,
+  0x7c, 0xda, 0x5a, 0x96, 0x03, 0x36, 0x37, 0xff, 0x7f, 0x7e, 0x7f, 0x3f,
+  0x40, 0x8a, 0x02, 0x87, 0x07, 0xb1, 0x31, 0xa3, 0x23, 0x88, 0x04, 0x3f,
+  0x40, 0x78, 0x79, 0xff, 0x7f, 0x39, 0x3a, 0x82, 0x02, 0x8a, 0x02, 0xc7,
+  0x47, 0x7e, 0x7f, 0x67, 0x68, 0x86, 0x05, 0x04, 0x05, 0xa5, 0x25, 0x77,
+  0x78, 0x7e, 0x7f, 0x56, 0x57, 0x83, 0x03, 0x89, 0x04, 0x80, 0x00, 0x15,
+  0x16, 0x6a, 0x6b, 0xf7, 0x77, 0x11, 0x12, 0x86, 0x04, 0x31, 0x32, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x55, 0x56, 0x84, 0x04, 0x8a, 0x03, 0x83, 0x03, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x67, 0x68, 0x86, 0x04, 0x23, 0x24, 0x76, 0x77, 0x7e,
+  0x7f, 0xd5, 0x55, 0x85, 0x05, 0x8b, 0x03, 0xae, 0x2e, 0x7e, 0x7f, 0xfd,
+  0x7d, 0xaa, 0x2a, 0x85, 0x04, 0x06, 0x07, 0x68, 0x69, 0x7e, 0x7f, 0xf6,
+  0x76, 0x0e, 0x0f, 0x8c, 0x02, 0x4e, 0x4f, 0x7e, 0x7f, 0x75, 0x76, 0x85,
+  0x04, 0x06, 0x07, 0xd5, 0x55, 0x7e, 0x7f, 0xf6, 0x76, 0x22, 0x23, 0x8d,
+  0x03, 0x51, 0x52, 0x7e, 0x7f, 0x7c, 0x7d, 0x35, 0x36, 0x84, 0x07, 0x2e,
+  0x2f, 0x7e, 0x7f, 0x7e, 0x7f, 0xd6, 0x56, 0x9a, 0x1a, 0xd4, 0x54, 0xdd,
+  0x5d, 0x98, 0x18, 0x8a, 0x10, 0x92, 0x12, 0x7e, 0x7f, 0x7e, 0x7f, 0x7b,
+  0x7c, 0x58, 0x59, 0xa2, 0x22, 0x9c, 0x1c, 0x00, 0x00, 0x07, 0x08, 0xe6,
+  0x66, 0x7e, 0x7f, 0x7e, 0x7f, 0xf5, 0x75, 0x79, 0x7a, 0x7e, 0x7f, 0xc8,
+  0x48, 0x11, 0x12, 0x8a, 0x0f, 0x82, 0x02, 0x6d, 0x6e, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfa, 0x7a, 0xe3, 0x63, 0x69, 0x6a, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x5f, 0x60, 0xa4, 0x24, 0x83,
+  0x03, 0x8c, 0x0c, 0x8d, 0x0d, 0x3b, 0x3c, 0xee, 0x6e, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xdf,
+  0x5f, 0xa4, 0x24, 0x84, 0x04, 0x90, 0x08, 0x8c, 0x0c, 0x95, 0x15, 0x95,
+  0x15, 0xa7, 0x27, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x4c, 0x4d, 0x04,
+  0x05, 0x95, 0x04, 0x15, 0x16, 0x7e, 0x7f, 0x7e, 0x7f, 0xe4, 0x64, 0x84,
+  0x04, 0x96, 0x03, 0x15, 0x16, 0x7e, 0x7f, 0x7e, 0x7f, 0xc7, 0x47, 0x97,
+  0x03, 0x15, 0x16, 0xff, 0x7f, 0xf3, 0x73, 0x13, 0x14, 0x97, 0x02, 0x15,
+  0x16, 0x7e, 0x7f, 0xa9, 0x29, 0x98, 0x02, 0x15, 0x16, 0x7e, 0x7f, 0xc1,
+  0x41, 0x98, 0x02, 0x8b, 0x0b, 0x40, 0x41, 0x32, 0x33, 0xe1, 0x00, 0x00,
+  0x00, 0x00, 0xe0, 0x02, 0x0b, 0x0c, 0xad, 0x2d, 0x1e, 0x1f, 0x96, 0x05,
+  0x11, 0x12, 0x59, 0x5a, 0xe3, 0x63, 0xfe, 0x7e, 0xf2, 0x72, 0xd7, 0x57,
+  0x94, 0x07, 0x9a, 0x1a, 0xc3, 0x43, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x7b, 0x7c, 0x20, 0x21, 0x92, 0x08, 0x17, 0x18, 0x6f, 0x70,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x4c, 0x4d, 0x92, 0x09, 0xe2, 0x62, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xc6, 0x46, 0xc0, 0x40, 0x7c, 0x7d, 0xfe, 0x7e, 0x64, 0x65, 0x0f, 0x10,
+  0x91, 0x09, 0x9a, 0x1a, 0xe5, 0x65, 0xd5, 0x55, 0x13, 0x14, 0x01, 0x02,
+  0x00, 0x00, 0x6a, 0x6b, 0xfe, 0x7e, 0xfe, 0x7e, 0xa0, 0x20, 0x97, 0x03,
+  0xa9, 0x29, 0xfe, 0x7e, 0xfe, 0x7e, 0xa0, 0x20, 0x97, 0x03, 0xbe, 0x3e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xea, 0x6a, 0x97, 0x03, 0x7a, 0x7b, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x3f, 0x40, 0x95, 0x05, 0x0a, 0x0b, 0xdb, 0x5b, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xce, 0x4e, 0x00, 0x01, 0x95, 0x04, 0x23, 0x24, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xca, 0x4a, 0x95, 0x04, 0x9b, 0x1b, 0xf7, 0x77,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xda, 0x5a, 0x94, 0x06, 0x86, 0x06, 0x9c, 0x1c,
+  0x6f, 0x70, 0xfe, 0x7e, 0xfe, 0x7e, 0xdf, 0x5f, 0x8a, 0x0a, 0x93, 0x06,
+  0x87, 0x07, 0x5a, 0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xb0, 0x30, 0x81, 0x04, 0x05, 0x06, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a,
+  0xac, 0x2c, 0x8b, 0x12, 0x81, 0x01, 0x14, 0x15, 0xd7, 0x57, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0xe6, 0x66,
+  0xe6, 0x66, 0x68, 0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x78, 0x79,
+  0xe6, 0x66, 0xe6, 0x66, 0xb1, 0x31, 0x88, 0x12, 0x32, 0x33, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x87, 0x13,
+  0xef, 0x6f, 0x79, 0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfb, 0x7b, 0xe1, 0x61, 0xe1, 0x61, 0xe1, 0x61, 0xe1, 0x61, 0xe1, 0x61,
+  0xe1, 0x61, 0xac, 0x2c, 0x87, 0x0c, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x36, 0x37, 0x34, 0x35, 0x34, 0x35, 0x2f, 0x30, 0x8e, 0x09, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf9, 0x79, 0xd9, 0x59, 0xd9, 0x59, 0xac, 0x2c,
+  0x87, 0x07, 0x87, 0x07, 0x80, 0x00, 0x91, 0x03, 0x2c, 0x2d, 0xac, 0x2c,
+  0xac, 0x2c, 0x26, 0x27, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9e,
+  0x02, 0x29, 0x2a, 0xff, 0x7f, 0x44, 0x45, 0x97, 0x03, 0xc9, 0x49, 0x77,
+  0x78, 0xfe, 0x7e, 0xaa, 0x2a, 0x96, 0x04, 0x12, 0x13, 0x54, 0x55, 0xfe,
+  0x7e, 0xf5, 0x75, 0x9a, 0x1a, 0x95, 0x04, 0x02, 0x03, 0x6e, 0x6f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xba, 0x3a, 0x95, 0x05, 0x01, 0x02, 0x39, 0x3a, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xe2, 0x62, 0x1e, 0x1f, 0x94, 0x05, 0x81, 0x01, 0xb9,
+  0x39, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd1, 0x51, 0x95, 0x05, 0x0b,
+  0x0c, 0x67, 0x68, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x10, 0x11, 0x94,
+  0x06, 0x0e, 0x0f, 0xe9, 0x69, 0xfd, 0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0x08,
+  0x09, 0x80, 0x00, 0x94, 0x05, 0x5f, 0x60, 0xfe, 0x7e, 0xfe, 0x7e, 0xfd,
+  0x7d, 0xb0, 0x30, 0x00, 0x01, 0x94, 0x04, 0xb7, 0x37, 0x79, 0x7a, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x42, 0x43, 0x95, 0x05, 0xa8, 0x28, 0x7a, 0x7b, 0xfe,
+  0x7e, 0x79, 0x7a, 0x5e, 0x5f, 0x8e, 0x0e, 0x94, 0x04, 0x87, 0x07, 0x63,
+  0x64, 0xfe, 0x7e, 0xfe, 0x7e, 0xe6, 0x66, 0x95, 0x05, 0x05, 0x06, 0x63,
+  0x64, 0xfe, 0x7e, 0xfe, 0x7e, 0x68, 0x69, 0xac, 0x2c, 0x95, 0x04, 0xcb,
+  0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x97, 0x17, 0x95, 0x05, 0xd1,
+  0x51, 0x7b, 0x7c, 0xfe, 0x7e, 0x67, 0x68, 0x8d, 0x0d, 0x81, 0x01, 0x94,
+  0x04, 0xae, 0x2e, 0xf9, 0x79, 0xfe, 0x7e, 0xfe, 0x7e, 0xb1, 0x31, 0x96,
+  0x04, 0x5f, 0x60, 0xfe, 0x7e, 0xfe, 0x7e, 0xee, 0x6e, 0x82, 0x02, 0x95,
+  0x04, 0x1a, 0x1b, 0xf5, 0x75, 0xfe, 0x7e, 0x48, 0x49, 0x92, 0x12, 0x96,
+  0x03, 0x2b, 0x2c, 0xfe, 0x7e, 0x6d, 0x6e, 0x93, 0x13, 0x97, 0x02, 0x44,
+  0x45, 0xfe, 0x7e, 0x28, 0x29, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x03,
+  0x2e, 0x2f, 0x7e, 0x7f, 0x7e, 0x7f, 0x08, 0x09, 0x96, 0x04, 0x85, 0x05,
+  0x50, 0x51, 0xfe, 0x7e, 0x7b, 0x7c, 0x88, 0x08, 0x95, 0x04, 0x02, 0x03,
+  0x6a, 0x6b, 0xfe, 0x7e, 0xfe, 0x7e, 0x26, 0x27, 0x95, 0x05, 0x03, 0x04,
+  0x4e, 0x4f, 0xfe, 0x7e, 0x79, 0x7a, 0x59, 0x5a, 0x04, 0x05, 0x94, 0x04,
+  0x84, 0x04, 0xce, 0x4e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x95, 0x05,
+  0x0d, 0x0e, 0x4d, 0x4e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd9, 0x59, 0x06, 0x07,
+  0x94, 0x05, 0x9d, 0x1d, 0xf3, 0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0x58, 0x59,
+  0x87, 0x07, 0x94, 0x05, 0x9d, 0x1d, 0x72, 0x73, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x58, 0x59, 0x07, 0x08, 0x94, 0x05, 0x04, 0x05, 0xdf, 0x5f, 0xfe, 0x7e,
+  0x77, 0x78, 0x33, 0x34, 0x07, 0x08, 0x94, 0x04, 0x0d, 0x0e, 0x62, 0x63,
+  0xfe, 0x7e, 0x77, 0x78, 0x29, 0x2a, 0x96, 0x03, 0xa3, 0x23, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x51, 0x52, 0x96, 0x0a, 0x3c, 0x3d, 0xf4, 0x74, 0xfe, 0x7e,
+  0x58, 0x59, 0x90, 0x10, 0xa5, 0x25, 0xa5, 0x25, 0xa5, 0x25, 0xa5, 0x25,
+  0xa5, 0x25, 0x17, 0x18, 0x8f, 0x0c, 0x1d, 0x1e, 0x74, 0x75, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x6d, 0x6e, 0xeb, 0x6b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf5, 0x75, 0xbe, 0x3e, 0x8d, 0x0e, 0x07, 0x08,
+  0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe9, 0x69, 0xfe, 0x7e,
+  0x73, 0x74, 0x52, 0x53, 0x74, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xf6, 0x76, 0x09, 0x0a, 0x8c, 0x0e, 0x89, 0x09, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xee, 0x6e, 0x92, 0x12, 0x89, 0x09, 0x92, 0x12, 0x0d, 0x0e, 0x00, 0x00,
+  0x8e, 0x0e, 0x92, 0x12, 0xd5, 0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0x40, 0x41,
+  0x8c, 0x03, 0x89, 0x09, 0xfe, 0x7e, 0xfe, 0x7e, 0xcd, 0x4d, 0x86, 0x03,
+  0x2b, 0x2c, 0xfe, 0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x8c, 0x04, 0x89, 0x09,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf3, 0x73, 0x2b, 0x2c, 0x84, 0x04, 0x10, 0x11,
+  0xec, 0x6c, 0xfe, 0x7e, 0xfe, 0x7e, 0xb0, 0x30, 0x8c, 0x0e, 0x85, 0x05,
+  0xe7, 0x67, 0xfe, 0x7e, 0xfe, 0x7e, 0x7c, 0x7d, 0x75, 0x76, 0x75, 0x76,
+  0x75, 0x76, 0x75, 0x76, 0x75, 0x76, 0xf8, 0x78, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xe8, 0x68, 0x06, 0x07, 0x8d, 0x0c, 0x89, 0x09, 0xe7, 0x67, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x4b, 0x4c, 0x0a, 0x0b, 0x8f, 0x0a, 0x01, 0x02,
+  0x0b, 0x0c, 0xc0, 0x40, 0xc0, 0x40, 0x4d, 0x4e, 0xfe, 0x7e, 0x6d, 0x6e,
+  0xc0, 0x40, 0x2c, 0x2d, 0x82, 0x02, 0x80, 0x00, 0xff, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0xfe, 0x02, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x98, 0x03,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x97, 0x04, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x96, 0x04, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x96, 0x04, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x95, 0x04, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x95, 0x05, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x94, 0x05,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0x95, 0x05, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0x95, 0x05, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0x95, 0x05, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x94, 0x06, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x94, 0x05,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0x94, 0x06, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0x94, 0x05, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x95, 0x04, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x96, 0x04, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x96, 0x04, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x96, 0x03, 0xff, 0x7f, 0xff, 0x7f,
+  0xff, 0x7f, 0xff, 0x7f, 0x97, 0x02, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x95, 0x05, 0x03, 0x04, 0x95,
+  0x15, 0x49, 0x4a, 0x7d, 0x7e, 0x7d, 0x7e, 0x69, 0x6a, 0x95, 0x09, 0xb8,
+  0x38, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x68, 0x69, 0x8e,
+  0x0e, 0x14, 0x15, 0x9c, 0x1c, 0x06, 0x07, 0x8f, 0x0d, 0xaa, 0x2a, 0xbf,
+  0x3f, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0xf3,
+  0x73, 0x53, 0x54, 0x5d, 0x5e, 0x68, 0x69, 0x48, 0x49, 0x3f, 0x40, 0x29,
+  0x2a, 0x8d, 0x0e, 0x53, 0x54, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0xef, 0x6f, 0x29, 0x2a, 0x8b, 0x10, 0xb5,
+  0x35, 0xf6, 0x76, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x72, 0x73, 0x22, 0x23, 0x88, 0x13, 0x03,
+  0x04, 0xb8, 0x38, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x37,
+  0x38, 0x83, 0x03, 0x87, 0x13, 0x95, 0x15, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0xd3, 0x53, 0x52, 0x53, 0x52, 0x53, 0xef, 0x6f, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0xb7, 0x37, 0x87, 0x09, 0x95,
+  0x15, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x67,
+  0x68, 0xbe, 0x3e, 0xbe, 0x3e, 0xbe, 0x3e, 0x82, 0x06, 0x53, 0x54, 0x7c,
+  0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x87,
+  0x06, 0x95, 0x15, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x6f,
+  0x70, 0x9b, 0x1b, 0x85, 0x06, 0x1b, 0x1c, 0xef, 0x6f, 0x7d, 0x7e, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x87, 0x05, 0xed, 0x6d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x68, 0x69, 0x87, 0x05, 0x68,
+  0x69, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x87,
+  0x04, 0x7e, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x87,
+  0x06, 0x54, 0x55, 0x7d, 0x7e, 0xff, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x94, 0x14, 0x87, 0x04, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x85, 0x08, 0x8e, 0x0e, 0xaa, 0x2a, 0x61, 0x62, 0x7c,
+  0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x60, 0x61, 0x8d, 0x0d, 0x87,
+  0x04, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x84,
+  0x08, 0x3f, 0x40, 0x53, 0x54, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0xa9, 0x29, 0x88, 0x12, 0x7d, 0x7e, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0xc6, 0x46, 0x00, 0x00, 0xaa,
+  0x2a, 0x53, 0x54, 0x53, 0x54, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0xa9, 0x29, 0x88,
+  0x12, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7a,
+  0x7b, 0x68, 0x69, 0x72, 0x73, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x47,
+  0x48, 0x06, 0x07, 0x88, 0x0f, 0xed, 0x6d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xff, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xd8,
+  0x58, 0x8b, 0x0e, 0x95, 0x15, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x60, 0x61, 0x52, 0x53, 0x8c, 0x0d, 0x8a,
+  0x0a, 0xbe, 0x3e, 0x5d, 0x5e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0xf3, 0x73, 0xbe, 0x3e, 0xbe,
+  0x3e, 0x94, 0x14, 0x8f, 0x08, 0x14, 0x15, 0xe1, 0x61, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0xc4, 0x44, 0xa9, 0x29, 0x22, 0x23, 0x93,
+  0x05, 0x8d, 0x0d, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x94, 0x14, 0x06,
+  0x07, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x0c, 0x0d, 0xb8, 0x38,
+  0xdf, 0x5f, 0xff, 0x7f, 0x8d, 0x0d, 0x95, 0x05, 0x8e, 0x0e, 0x63, 0x64,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x8d, 0x0d, 0x94, 0x06, 0x9c, 0x1c,
+  0x63, 0x64, 0x7d, 0x7e, 0x7d, 0x7e, 0x6d, 0x6e, 0xc2, 0x42, 0x02, 0x03,
+  0x92, 0x06, 0x01, 0x02, 0xb5, 0x35, 0xfe, 0x7e, 0x7d, 0x7e, 0xfa, 0x7a,
+  0x67, 0x68, 0x92, 0x12, 0x93, 0x05, 0x0f, 0x10, 0xcc, 0x4c, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0xe1, 0x61, 0x95, 0x04, 0x3b, 0x3c, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xff, 0x7f, 0x34, 0x35, 0x95, 0x05, 0xbd, 0x3d, 0x7a, 0x7b,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xeb, 0x6b, 0x08, 0x09, 0x94, 0x05, 0x0c, 0x0d,
+  0xf3, 0x73, 0x7d, 0x7e, 0x7d, 0x7e, 0xc6, 0x46, 0x8f, 0x0f, 0x94, 0x05,
+  0x07, 0x08, 0xe7, 0x67, 0x7d, 0x7e, 0x7d, 0x7e, 0xec, 0x6c, 0x92, 0x12,
+  0x95, 0x04, 0x45, 0x46, 0xfe, 0x7e, 0x7d, 0x7e, 0x6d, 0x6e, 0x92, 0x12,
+  0x95, 0x04, 0x8e, 0x0e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xc2, 0x42,
+  0x95, 0x05, 0x89, 0x09, 0xda, 0x5a, 0x7d, 0x7e, 0xfe, 0x7e, 0xc0, 0x40,
+  0x02, 0x03, 0x95, 0x04, 0x9c, 0x1c, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x8d, 0x0d, 0x82, 0x06, 0x0c, 0x0d, 0x9c, 0x1c, 0x9c, 0x1c, 0x9c, 0x1c,
+  0x9c, 0x1c, 0x9c, 0x1c, 0x12, 0x13, 0x8c, 0x0f, 0xa4, 0x24, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x77, 0x78, 0x10, 0x11, 0x8e, 0x0e, 0xbd, 0x3d, 0xd4, 0x54,
+  0xe7, 0x67, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x6f, 0x70, 0xc1, 0x41, 0x8b, 0x0f, 0xe2, 0x62, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xe5, 0x65, 0x58, 0x59, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0xe1, 0x61, 0x8b, 0x0f, 0x62, 0x63, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xeb, 0x6b,
+  0xf2, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x61, 0x62,
+  0x8b, 0x0f, 0xe2, 0x62, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xd6, 0x56, 0xfe, 0x7e, 0xf9, 0x79, 0x7a, 0x7b,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x22, 0x23, 0x8b, 0x0f,
+  0x2b, 0x2c, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x4c, 0x4d, 0x05, 0x06, 0x8b, 0x0e, 0x89, 0x09,
+  0xd8, 0x58, 0xf7, 0x77, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xfa, 0x7a, 0xef, 0x6f, 0xc8, 0x48,
+  0x29, 0x2a, 0x84, 0x04, 0x8e, 0x08, 0x9f, 0x1f, 0x56, 0x57, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xbf, 0x3f, 0xab, 0x2b,
+  0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x06, 0x16, 0x17, 0x28,
+  0x29, 0xe4, 0x64, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xa9, 0x29, 0x91,
+  0x09, 0x00, 0x01, 0x18, 0x19, 0x54, 0x55, 0x79, 0x7a, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xf7, 0x77, 0x79, 0x7a, 0xfe, 0x7e, 0xe1, 0x61, 0x90, 0x0a, 0x89,
+  0x09, 0xc0, 0x40, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4b, 0x4c, 0x26,
+  0x27, 0x0b, 0x0c, 0x52, 0x53, 0xfe, 0x7e, 0x3f, 0x40, 0x8f, 0x0b, 0x9a,
+  0x1a, 0xe4, 0x64, 0xfe, 0x7e, 0xfe, 0x7e, 0x51, 0x52, 0x94, 0x14, 0x00,
+  0x00, 0x01, 0x02, 0x31, 0x32, 0xfd, 0x7d, 0xdc, 0x5c, 0x03, 0x04, 0x8e,
+  0x0b, 0x07, 0x08, 0xe1, 0x61, 0x7e, 0x7f, 0xfe, 0x7e, 0x3a, 0x3b, 0x82,
+  0x02, 0x25, 0x26, 0xb1, 0x31, 0xdc, 0x5c, 0xfe, 0x7e, 0xfe, 0x7e, 0x54,
+  0x55, 0x8f, 0x0b, 0x13, 0x14, 0x7e, 0x7f, 0xff, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0xfc, 0x7c, 0xea, 0x6a, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x8f, 0x0b, 0x02, 0x03, 0xcb, 0x4b, 0x74, 0x75, 0xf4,
+  0x74, 0xf4, 0x74, 0x7b, 0x7c, 0xf4, 0x74, 0x38, 0x39, 0x11, 0x12, 0xa7,
+  0x27, 0xfe, 0x7e, 0xfe, 0x7e, 0x94, 0x00, 0x1d, 0x1e, 0x81, 0x03, 0x83,
+  0x03, 0xd4, 0x54, 0xfe, 0x7e, 0xdc, 0x5c, 0x97, 0x03, 0xb7, 0x37, 0xfe,
+  0x7e, 0xfb, 0x7b, 0x2e, 0x2f, 0x96, 0x03, 0x8b, 0x0b, 0xe7, 0x67, 0xfe,
+  0x7e, 0xea, 0x6a, 0x97, 0x03, 0x4d, 0x4e, 0x7e, 0x7f, 0xf5, 0x75, 0x9a,
+  0x1a, 0x96, 0x03, 0x07, 0x08, 0xf7, 0x77, 0xfe, 0x7e, 0xc0, 0x40, 0x97,
+  0x03, 0xe1, 0x61, 0x7e, 0x7f, 0xe8, 0x68, 0x0b, 0x0c, 0x96, 0x03, 0x92,
+  0x12, 0x70, 0x71, 0x79, 0x7a, 0x26, 0x27, 0x97, 0x02, 0x69, 0x6a, 0xfe,
+  0x7e, 0xce, 0x4e, 0x97, 0x03, 0x98, 0x18, 0x7a, 0x7b, 0x7e, 0x7f, 0x12,
+  0x13, 0x96, 0x03, 0x00, 0x01, 0xc0, 0x40, 0xfe, 0x7e, 0xbe, 0x3e, 0x97,
+  0x03, 0x09, 0x0a, 0xfe, 0x7e, 0xf0, 0x70, 0x08, 0x09, 0x97, 0x02, 0x09,
+  0x0a, 0xfe, 0x7e, 0xb6, 0x36, 0x98, 0x02, 0x09, 0x0a, 0xfe, 0x7e, 0x89,
+  0x09, 0xaa, 0x00, 0x00, 0x00, 0x00, 0xff, 0x96, 0x09, 0x0c, 0x0d, 0xe9,
+  0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x65,
+  0x66, 0xbc, 0x3c, 0xac, 0x2c, 0x90, 0x0c, 0xbc, 0x3c, 0x78, 0x79, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfc, 0x7c, 0x69, 0x6a, 0x2c, 0x2d, 0x8d, 0x0d, 0x0e,
+  0x0f, 0xed, 0x6d, 0x7d, 0x7e, 0x7d, 0x7e, 0x5f, 0x60, 0x4e, 0x4f, 0x4e,
+  0x4f, 0xcf, 0x4f, 0x4e, 0x4f, 0x4e, 0x4f, 0x4e, 0x4f, 0xf4, 0x74, 0x7d,
+  0x7e, 0x69, 0x6a, 0x8d, 0x04, 0xa8, 0x28, 0x7d, 0x7e, 0x7d, 0x7e, 0x34,
+  0x35, 0x87, 0x07, 0x85, 0x02, 0x2b, 0x2c, 0x7d, 0x7e, 0x69, 0x6a, 0x8d,
+  0x04, 0xa8, 0x28, 0x7d, 0x7e, 0x7d, 0x7e, 0xe1, 0x61, 0x8c, 0x0c, 0x85,
+  0x05, 0xa1, 0x21, 0xec, 0x6c, 0x69, 0x6a, 0x00, 0x00, 0x01, 0x02, 0xa1,
+  0x21, 0x8a, 0x04, 0x8a, 0x0a, 0xea, 0x6a, 0x7d, 0x7e, 0x7d, 0x7e, 0xbc,
+  0x3c, 0x83, 0x07, 0x09, 0x0a, 0x52, 0x53, 0x76, 0x77, 0x7d, 0x7e, 0xf8,
+  0x78, 0x5c, 0x5d, 0x5e, 0x5f, 0x7d, 0x7e, 0x8b, 0x04, 0x30, 0x31, 0xf8,
+  0x78, 0x7d, 0x7e, 0xf2, 0x72, 0x12, 0x13, 0x81, 0x08, 0x93, 0x13, 0xbb,
+  0x3b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x70, 0x71, 0xe6,
+  0x66, 0xa7, 0x27, 0x8c, 0x0c, 0xb0, 0x30, 0xf9, 0x79, 0x7d, 0x7e, 0xfb,
+  0x7b, 0x4f, 0x50, 0xd0, 0x50, 0xfb, 0x7b, 0x7d, 0x7e, 0x7d, 0x7e, 0xf3,
+  0x73, 0xe2, 0x62, 0xae, 0x2e, 0x10, 0x11, 0x8f, 0x08, 0xd6, 0x56, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xf7, 0x77, 0xde, 0x5e, 0x34,
+  0x35, 0x0a, 0x0b, 0x91, 0x06, 0x8e, 0x0e, 0xeb, 0x6b, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x5e, 0x5f, 0x02, 0x03, 0x92, 0x07, 0x47, 0x48, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x42,
+  0x43, 0x91, 0x0a, 0x16, 0x17, 0x70, 0x71, 0x7c, 0x7d, 0x7d, 0x7e, 0xf2,
+  0x72, 0xbe, 0x3e, 0xb6, 0x36, 0x7d, 0x7e, 0x7d, 0x7e, 0x5b, 0x5c, 0x02,
+  0x03, 0x8f, 0x0b, 0x96, 0x16, 0xf3, 0x73, 0x7d, 0x7e, 0x7d, 0x7e, 0x46,
+  0x47, 0x09, 0x0a, 0x00, 0x00, 0x8d, 0x0d, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x86, 0x06, 0x8f, 0x04, 0xf4, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x46,
+  0x47, 0x03, 0x04, 0x81, 0x04, 0x82, 0x02, 0xd1, 0x51, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x86, 0x06, 0x8f, 0x03, 0xfe, 0x7e, 0x7d, 0x7e, 0xf1, 0x71, 0x8e,
+  0x0e, 0x82, 0x04, 0x0a, 0x0b, 0x72, 0x73, 0x7d, 0x7e, 0xfe, 0x7e, 0x86,
+  0x06, 0x8f, 0x02, 0xfe, 0x7e, 0xf2, 0x72, 0x9b, 0x1b, 0x83, 0x04, 0x8d,
+  0x0d, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x86, 0x06, 0x8f, 0x03, 0xfe,
+  0x7e, 0x50, 0x51, 0x94, 0x14, 0x0d, 0x0e, 0x81, 0x05, 0x98, 0x18, 0xda,
+  0x5a, 0x7d, 0x7e, 0x7d, 0x7e, 0xd5, 0x55, 0x01, 0x02, 0x8f, 0x0a, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xef, 0x6f, 0x4f, 0x50, 0x4f, 0x50, 0xef,
+  0x6f, 0x7d, 0x7e, 0x7d, 0x7e, 0x76, 0x77, 0x98, 0x18, 0x90, 0x09, 0xb5,
+  0x35, 0x76, 0x77, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7c, 0x7d, 0xf3, 0x73, 0x18, 0x19, 0x92, 0x06, 0x99, 0x19, 0xbb,
+  0x3b, 0xd0, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0x4f, 0x50, 0xb5, 0x35, 0xe1,
+  0x00, 0x00, 0xf8, 0x0b, 0x57, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x56, 0x57, 0x57, 0x58, 0x66, 0x67, 0xb8, 0x38, 0xb8, 0x38, 0xb8, 0x38,
+  0x38, 0x39, 0x05, 0x06, 0x8e, 0x0d, 0xa7, 0x27, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x71, 0x72, 0xd7, 0x57, 0x8e, 0x0d,
+  0x6e, 0x6f, 0x4c, 0x4d, 0x9b, 0x1b, 0x9b, 0x1b, 0x9b, 0x1b, 0xbb, 0x3b,
+  0x49, 0x4a, 0xd2, 0x52, 0xe1, 0x61, 0xe1, 0x61, 0xfe, 0x7e, 0x7d, 0x7e,
+  0xf7, 0x77, 0xd7, 0x57, 0x8d, 0x01, 0x12, 0x13, 0x84, 0x04, 0x87, 0x03,
+  0x56, 0x57, 0x7d, 0x7e, 0x7d, 0x7e, 0xc0, 0x40, 0x95, 0x05, 0x07, 0x08,
+  0x45, 0x46, 0xfe, 0x7e, 0x7d, 0x7e, 0x6d, 0x6e, 0x92, 0x12, 0x88, 0x01,
+  0x38, 0x39, 0x8d, 0x0d, 0x88, 0x06, 0x9f, 0x1f, 0xac, 0x2c, 0xe7, 0x67,
+  0xfe, 0x7e, 0xff, 0x7f, 0xeb, 0x6b, 0x36, 0x37, 0x89, 0x01, 0x05, 0x06,
+  0x81, 0x01, 0x85, 0x08, 0x04, 0x05, 0xaa, 0x2a, 0xc9, 0x49, 0x77, 0x78,
+  0x7a, 0x7b, 0x7d, 0x7e, 0x7d, 0x7e, 0x53, 0x54, 0x90, 0x10, 0x90, 0x08,
+  0x99, 0x19, 0x52, 0x53, 0xe5, 0x65, 0x7d, 0x7e, 0xfe, 0x7e, 0xf4, 0x74,
+  0xe1, 0x61, 0x32, 0x33, 0x9b, 0x1b, 0x91, 0x06, 0xd4, 0x54, 0xf9, 0x79,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x5e, 0x5f, 0x9d, 0x1d, 0x94, 0x07,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x4b, 0x4c, 0x8f, 0x0f, 0x93, 0x08, 0x9f, 0x1f, 0xf8, 0x78, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x6e, 0x6f, 0xb2, 0x32,
+  0x93, 0x08, 0x0b, 0x0c, 0x9d, 0x1d, 0xd3, 0x53, 0x6a, 0x6b, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfc, 0x7c, 0x31, 0x32, 0x95, 0x06, 0x8f, 0x0f,
+  0x1b, 0x1c, 0xe3, 0x63, 0x7d, 0x7e, 0x7d, 0x7e, 0xee, 0x6e, 0x0f, 0x10,
+  0x96, 0x04, 0x0d, 0x0e, 0xe3, 0x63, 0x7d, 0x7e, 0x7d, 0x7e, 0x45, 0x46,
+  0x97, 0x03, 0x9c, 0x1c, 0x7d, 0x7e, 0x7d, 0x7e, 0x45, 0x46, 0x8c, 0x01,
+  0xb2, 0x32, 0x52, 0x53, 0x87, 0x04, 0x12, 0x13, 0x6e, 0x6f, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xc6, 0x46, 0x8c, 0x02, 0xf0, 0x70, 0x6a, 0x6b, 0x0d, 0x0e,
+  0x84, 0x06, 0x17, 0x18, 0xc9, 0x49, 0x74, 0x75, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x65, 0x66, 0x87, 0x07, 0x8c, 0x0d, 0xf0, 0x70, 0x7d, 0x7e, 0xeb, 0x6b,
+  0xe2, 0x62, 0xc3, 0x43, 0x33, 0x34, 0xe2, 0x62, 0xe2, 0x62, 0xf1, 0x71,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x37, 0x38, 0x8d, 0x0d,
+  0x3c, 0x3d, 0x7a, 0x7b, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xfa, 0x7a,
+  0xc0, 0x40, 0x92, 0x12, 0x8e, 0x0a, 0x2b, 0x2c, 0x3f, 0x40, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x5e, 0x5f,
+  0x37, 0x38, 0xab, 0x2b, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb3,
+  0x09, 0x85, 0x05, 0x3c, 0x3d, 0x41, 0x42, 0xff, 0x7f, 0xfe, 0x7e, 0x75,
+  0x76, 0x41, 0x42, 0x41, 0x42, 0x94, 0x14, 0x81, 0x01, 0x8f, 0x0b, 0x89,
+  0x09, 0xbd, 0x3d, 0xf6, 0x76, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xba, 0x3a, 0x8e,
+  0x0c, 0x84, 0x04, 0xe4, 0x64, 0x7d, 0x7e, 0x7d, 0x7e, 0xed, 0x6d, 0x4e,
+  0x4f, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x2f, 0x30, 0x5e, 0x5f, 0x7d,
+  0x7e, 0xd3, 0x53, 0x8d, 0x05, 0x90, 0x10, 0xde, 0x5e, 0x7d, 0x7e, 0x75,
+  0x76, 0xce, 0x4e, 0x03, 0x04, 0x84, 0x02, 0x9e, 0x1e, 0x7d, 0x7e, 0xd3,
+  0x53, 0x8d, 0x03, 0xc3, 0x43, 0x7d, 0x7e, 0x7d, 0x7e, 0xc5, 0x45, 0x86,
+  0x02, 0xc9, 0x49, 0x7d, 0x7e, 0xc5, 0x45, 0x8c, 0x04, 0x0d, 0x0e, 0xf4,
+  0x74, 0x7d, 0x7e, 0x50, 0x51, 0x05, 0x06, 0x85, 0x03, 0x12, 0x13, 0xf5,
+  0x75, 0x50, 0x51, 0x05, 0x06, 0x8c, 0x04, 0x8c, 0x0c, 0x6f, 0x70, 0x7d,
+  0x7e, 0xda, 0x5a, 0x9c, 0x1c, 0x84, 0x03, 0x3f, 0x40, 0x6a, 0x6b, 0xdf,
+  0x5f, 0x13, 0x14, 0x8e, 0x0b, 0xd4, 0x54, 0x7d, 0x7e, 0x7d, 0x7e, 0x77,
+  0x78, 0x38, 0x39, 0x1b, 0x1c, 0x00, 0x00, 0x82, 0x02, 0xb6, 0x36, 0xf0,
+  0x70, 0xa5, 0x25, 0x04, 0x05, 0x8f, 0x0a, 0x93, 0x13, 0xd4, 0x54, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x78, 0x79, 0xf2, 0x72, 0xf3, 0x73, 0x7d,
+  0x7e, 0xfc, 0x7c, 0x3f, 0x40, 0x91, 0x0a, 0x81, 0x01, 0x33, 0x34, 0xc1,
+  0x41, 0xd8, 0x58, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7c, 0x7d, 0xdb, 0x5b, 0x96, 0x04, 0x83, 0x03, 0x47, 0x48, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xc0, 0x40, 0x96, 0x04, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x6f, 0x70, 0x8f, 0x0f, 0x95, 0x04, 0x08, 0x09, 0x67, 0x68, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xc0, 0x40, 0x95, 0x05, 0x8a, 0x0a, 0xe5, 0x65, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xc9, 0x49, 0x0d, 0x0e, 0x94, 0x05, 0x0b, 0x0c, 0x63,
+  0x64, 0x7d, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x8d, 0x0d, 0x94, 0x05, 0x31,
+  0x32, 0x6b, 0x6c, 0x7d, 0x7e, 0x7d, 0x7e, 0xe8, 0x68, 0x0c, 0x0d, 0x94,
+  0x05, 0x31, 0x32, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x4c, 0x4d, 0x8b,
+  0x0b, 0x93, 0x06, 0x89, 0x09, 0xdb, 0x5b, 0x79, 0x7a, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x51, 0x52, 0x0b, 0x0c, 0x94, 0x05, 0x4e, 0x4f, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x6b, 0x6c, 0x30, 0x31, 0x81, 0x01, 0x95, 0x03, 0xd4, 0x54, 0x7d,
+  0x7e, 0x4f, 0x50, 0x0e, 0x0f, 0xc7, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x03,
+  0xb6, 0x36, 0xff, 0x7f, 0x72, 0x73, 0x15, 0x16, 0x96, 0x04, 0x2e, 0x2f,
+  0x79, 0x7a, 0xfe, 0x7e, 0xf3, 0x73, 0x9a, 0x1a, 0x94, 0x05, 0x94, 0x14,
+  0x73, 0x74, 0x7a, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xd7, 0x57, 0x94, 0x06,
+  0x98, 0x18, 0x6a, 0x6b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd9, 0x59,
+  0x89, 0x09, 0x93, 0x06, 0x90, 0x10, 0xba, 0x3a, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x57, 0x58, 0x88, 0x08, 0x93, 0x06, 0x19, 0x1a, 0xec, 0x6c,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a, 0x86, 0x06, 0x93, 0x06,
+  0x81, 0x01, 0xbc, 0x3c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x58, 0x59,
+  0x8a, 0x0a, 0x94, 0x05, 0x31, 0x32, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xdb, 0x5b, 0x82, 0x02, 0x94, 0x05, 0x2c, 0x2d, 0xf7, 0x77, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xde, 0x5e, 0x0b, 0x0c, 0x94, 0x05, 0x07, 0x08, 0x53, 0x54,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x7c, 0x7d, 0x35, 0x36, 0x95, 0x04, 0xcf, 0x4f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xdb, 0x5b, 0x29, 0x2a, 0x95, 0x04, 0x43, 0x44,
+  0x7d, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc9, 0x49, 0x96, 0x04, 0x45, 0x46,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0x9e, 0x1e, 0x83, 0x03, 0xac, 0x2c,
+  0xca, 0x4a, 0xca, 0x4a, 0x3f, 0x40, 0x8d, 0x0f, 0x1b, 0x1c, 0x78, 0x79,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x5e, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x9a, 0x1a,
+  0x9a, 0x1a, 0xef, 0x6f, 0xf9, 0x79, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc, 0x7c,
+  0x71, 0x72, 0x1a, 0x1b, 0x8b, 0x0f, 0xcc, 0x4c, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x19, 0x1a, 0x9b, 0x1b, 0x43, 0x44, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x1d, 0x1e, 0x8b, 0x0f, 0x69, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xed, 0x6d, 0x71, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0x19, 0x1a,
+  0x8b, 0x0e, 0x1e, 0x1f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0xa6, 0x26, 0x8c, 0x0d, 0x1e, 0x1f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc, 0x7c, 0xf5, 0x75,
+  0xa8, 0x28, 0x8d, 0x0b, 0x93, 0x13, 0x68, 0x69, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x70, 0x71,
+  0x4d, 0x4e, 0x3d, 0x3e, 0x90, 0x08, 0x45, 0x46, 0xfe, 0x7e, 0xd3, 0x53,
+  0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x1b, 0x1c,
+  0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0x0d, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x8c, 0x0e, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x8d, 0x05, 0x1f,
+  0x20, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40, 0x83,
+  0x03, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x95, 0x05, 0x3f,
+  0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x1f, 0x20, 0x93,
+  0x05, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x94, 0x04, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x94, 0x05, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x94, 0x04, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x96, 0x04, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x1f, 0x20, 0x96, 0x06, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x1f, 0x20, 0x95, 0x07, 0x3f, 0x40, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x1f,
+  0x20, 0x95, 0x06, 0x3f, 0x40, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x97, 0x03, 0x3f, 0x40, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x98, 0x02, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0x98,
+  0x02, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0x96, 0x04, 0x1f, 0x20, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8b, 0x0e, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x3f, 0x40, 0x3f, 0x40, 0x00,
+  0x00, 0x1f, 0x20, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x8c, 0x0e, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x1f, 0x20, 0x8e,
+  0x0a, 0x1f, 0x20, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x93,
+  0x05, 0x1f, 0x20, 0xff, 0x7f, 0xdf, 0x5f, 0x3f, 0x40, 0x3f, 0x40, 0xdf,
+  0x5f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x09, 0x82, 0x02, 0xc0, 0x40,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0x2a, 0x2b, 0x93, 0x13,
+  0x96, 0x16, 0x82, 0x02, 0x91, 0x0b, 0x3a, 0x3b, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe5, 0x65, 0xea, 0x6a,
+  0x45, 0x46, 0x41, 0x42, 0x93, 0x13, 0x8d, 0x0e, 0x81, 0x01, 0x39, 0x3a,
+  0xf9, 0x79, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6a, 0x6b,
+  0xcc, 0x4c, 0x8b, 0x10, 0x1d, 0x1e, 0x3f, 0x40, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xea, 0x6a,
+  0x93, 0x13, 0x8a, 0x11, 0x62, 0x63, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xe6, 0x66, 0x37, 0x38, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xe3, 0x63, 0x11, 0x12, 0x88, 0x12, 0x04, 0x05, 0x64, 0x65, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xef, 0x6f, 0x8f, 0x0f, 0x00, 0x00, 0x9e, 0x1e, 0x74, 0x75,
+  0x74, 0x75, 0x74, 0x75, 0x74, 0x75, 0x7a, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa7, 0x27, 0x88, 0x04, 0x41, 0x42,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xe6, 0x66, 0x8f, 0x0f, 0x86, 0x06, 0xb8, 0x38,
+  0xfb, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x87, 0x04, 0x13, 0x14, 0x65, 0x66, 0xfe, 0x7e, 0xfe, 0x7e, 0x37, 0x38,
+  0x88, 0x05, 0x3d, 0x3e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x87, 0x04, 0x2b, 0x2c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x37, 0x38, 0x88, 0x05, 0x17, 0x18, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x87, 0x04, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x37, 0x38, 0x88, 0x05, 0x17, 0x18, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x87, 0x04, 0xff, 0x7f, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xe6, 0x66, 0x94, 0x14, 0x88, 0x05, 0x17, 0x18, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x87, 0x03, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xd8, 0x58, 0x89, 0x05, 0x17, 0x18, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6f, 0x70, 0x87, 0x03, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xd8, 0x58, 0x89, 0x05, 0x17, 0x18, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa0, 0x20, 0x87, 0x03, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xd8, 0x58, 0x89, 0x05, 0x56, 0x57, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x54, 0x55, 0x0a, 0x0b, 0x87, 0x04, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xdf, 0x5f, 0x8a, 0x0a, 0x85, 0x07, 0x03, 0x04,
+  0x17, 0x18, 0x56, 0x57, 0xfd, 0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0x63, 0x64,
+  0x84, 0x04, 0x88, 0x05, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x56, 0x57, 0xb4, 0x34, 0x83, 0x07, 0x23, 0x24, 0x42, 0x43, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x89, 0x11,
+  0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb, 0x7b,
+  0xd9, 0x59, 0xd9, 0x59, 0xd9, 0x59, 0xd9, 0x59, 0x70, 0x71, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x3e, 0x3f, 0x1c, 0x1d,
+  0x89, 0x10, 0x69, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xeb, 0x6b, 0x61, 0x62, 0x37, 0x38, 0x81, 0x01,
+  0x8a, 0x0d, 0x91, 0x11, 0x60, 0x61, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x74, 0x75, 0x40, 0x41, 0x95, 0x15, 0x8e, 0x0a, 0x10, 0x11, 0x23, 0x24,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xc2, 0x42, 0x9b, 0x1b, 0xfa, 0x00, 0x00, 0x00, 0xfa, 0x04,
+  0x09, 0x0a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x96, 0x04,
+  0x36, 0x37, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0x60, 0x61, 0x96, 0x05,
+  0x6a, 0x6b, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xf5, 0x75, 0x2e, 0x2f,
+  0x95, 0x05, 0x6a, 0x6b, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e,
+  0x42, 0x43, 0x95, 0x05, 0x44, 0x45, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d,
+  0xfe, 0x7e, 0x42, 0x43, 0x95, 0x05, 0x09, 0x0a, 0xfd, 0x7d, 0xfd, 0x7d,
+  0xfd, 0x7d, 0xfe, 0x7e, 0x42, 0x43, 0x95, 0x05, 0x09, 0x0a, 0xfd, 0x7d,
+  0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0x42, 0x43, 0x95, 0x05, 0x09, 0x0a,
+  0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0x42, 0x43, 0x95, 0x05,
+  0x09, 0x0a, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0x42, 0x43,
+  0x95, 0x05, 0x09, 0x0a, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e,
+  0x42, 0x43, 0x95, 0x05, 0x09, 0x0a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xff, 0x7f, 0xc3, 0x43, 0x95, 0x05, 0x09, 0x0a, 0xfd, 0x7d, 0xfd, 0x7d,
+  0xfd, 0x7d, 0xfe, 0x7e, 0x42, 0x43, 0x95, 0x05, 0x09, 0x0a, 0xfd, 0x7d,
+  0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0x42, 0x43, 0x95, 0x06, 0x09, 0x0a,
+  0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0x4b, 0x4c, 0x05, 0x06,
+  0x94, 0x07, 0x09, 0x0a, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e,
+  0xfd, 0x7d, 0xc7, 0x47, 0x83, 0x03, 0x93, 0x07, 0x09, 0x0a, 0xfd, 0x7d,
+  0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0xfd, 0x7d, 0xfd, 0x7d, 0x08, 0x09,
+  0x93, 0x07, 0x09, 0x0a, 0xfd, 0x7d, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e,
+  0xfd, 0x7d, 0xf6, 0x76, 0x88, 0x08, 0x93, 0x06, 0x09, 0x0a, 0xfd, 0x7d,
+  0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0x6a, 0x6b, 0x9a, 0x1a, 0x94, 0x05,
+  0x84, 0x04, 0xce, 0x4e, 0xfd, 0x7d, 0xfd, 0x7d, 0xfe, 0x7e, 0x42, 0x43,
+  0x96, 0x04, 0x26, 0x27, 0xfd, 0x7d, 0xfd, 0x7d, 0xe7, 0x67, 0x8f, 0x0f,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x95, 0x08, 0x9a, 0x1a, 0xd2,
+  0x52, 0x67, 0x68, 0x67, 0x68, 0x67, 0x68, 0x67, 0x68, 0xe8, 0x68, 0xd6,
+  0x56, 0x8a, 0x0a, 0x90, 0x0a, 0x04, 0x05, 0x2a, 0x2b, 0x78, 0x79, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0xdc, 0x5c, 0x8f, 0x0c, 0xb1, 0x31, 0xe6, 0x66, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x79, 0x7a, 0x9f, 0x1f, 0x8d, 0x0d, 0xae, 0x2e, 0xfb,
+  0x7b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe3, 0x63, 0xb1, 0x31, 0x8e,
+  0x0e, 0x9b, 0x1b, 0xee, 0x6e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x41,
+  0x42, 0x8d, 0x05, 0x68, 0x69, 0x7d, 0x7e, 0x7d, 0x7e, 0xf6, 0x76, 0x2c,
+  0x2d, 0x0a, 0x0b, 0x82, 0x04, 0xca, 0x4a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x41, 0x42, 0x8d, 0x03, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x41,
+  0x42, 0x84, 0x04, 0xca, 0x4a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x41,
+  0x42, 0x8d, 0x03, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x41, 0x42, 0x84,
+  0x04, 0xca, 0x4a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x41, 0x42, 0x8d,
+  0x03, 0x44, 0x45, 0x7d, 0x7e, 0x7d, 0x7e, 0x41, 0x42, 0x83, 0x05, 0x03,
+  0x04, 0xd3, 0x53, 0xfe, 0x7e, 0x7d, 0x7e, 0x77, 0x78, 0x8f, 0x0f, 0x8d,
+  0x03, 0xb4, 0x34, 0x7d, 0x7e, 0x7d, 0x7e, 0x41, 0x42, 0x83, 0x04, 0x41,
+  0x42, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xf6, 0x76, 0x8f, 0x01, 0x3d,
+  0x3e, 0x9a, 0x1a, 0x83, 0x05, 0xad, 0x2d, 0xfe, 0x7e, 0xfe, 0x7e, 0xff,
+  0x7f, 0xd3, 0x53, 0x9a, 0x1a, 0x94, 0x05, 0x0f, 0x10, 0x6b, 0x6c, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x71, 0x72, 0x10, 0x11, 0x94, 0x05, 0x8e, 0x0e, 0x68,
+  0x69, 0x7d, 0x7e, 0x7d, 0x7e, 0xf9, 0x79, 0x9a, 0x1a, 0x95, 0x04, 0x58,
+  0x59, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xb3, 0x33, 0x95, 0x07, 0xa1,
+  0x21, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xc9, 0x49, 0xa5,
+  0x25, 0x9c, 0x1c, 0x82, 0x01, 0x84, 0x04, 0x91, 0x11, 0x8e, 0x0f, 0x59,
+  0x5a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x74, 0x75, 0x58, 0x59, 0x58, 0x59, 0x58, 0x59, 0xdd, 0x5d, 0xea,
+  0x6a, 0x58, 0x59, 0x58, 0x59, 0xad, 0x2d, 0x8b, 0x0f, 0xef, 0x6f, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x8b, 0x0f, 0x9c, 0x1c, 0x70, 0x71, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x75,
+  0x76, 0xa5, 0x25, 0x8c, 0x0d, 0x14, 0x15, 0x9d, 0x1d, 0x9d, 0x1d, 0x9d,
+  0x1d, 0x9d, 0x1d, 0x9d, 0x1d, 0x9d, 0x1d, 0x9d, 0x1d, 0x9d, 0x1d, 0x9d,
+  0x1d, 0x9d, 0x1d, 0x9d, 0x1d, 0x9d, 0x1d, 0x17, 0x18, 0xff, 0x8e, 0x00,
+  0x00, 0x00, 0xff, 0xae, 0x0a, 0x02, 0x03, 0x8c, 0x0c, 0x8c, 0x0c, 0x8c,
+  0x0c, 0xa6, 0x26, 0xc8, 0x48, 0xc8, 0x48, 0xc8, 0x48, 0xc8, 0x48, 0xa0,
+  0x20, 0x89, 0x09, 0x8e, 0x0d, 0x8b, 0x0b, 0x3a, 0x3b, 0xd9, 0x59, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf2, 0x72, 0x9b, 0x1b, 0x8b, 0x0f, 0x81,
+  0x01, 0x3a, 0x3b, 0xee, 0x6e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x59, 0x5a, 0x8b, 0x0f, 0xdc, 0x5c, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe8, 0x68, 0xce, 0x4e, 0x23, 0x24, 0x23,
+  0x24, 0x23, 0x24, 0x23, 0x24, 0x23, 0x24, 0xac, 0x2c, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x59, 0x5a, 0x8b, 0x04, 0xfe, 0x7e, 0x7d, 0x7e, 0x78,
+  0x79, 0x31, 0x32, 0x88, 0x08, 0x85, 0x04, 0x9d, 0x1d, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x2b, 0x2c, 0x8b, 0x02, 0xfe, 0x7e, 0x79, 0x7a, 0xc7,
+  0x47, 0x86, 0x05, 0x82, 0x02, 0xda, 0x5a, 0x7d, 0x7e, 0x7d, 0x7e, 0x50,
+  0x51, 0x05, 0x06, 0x8b, 0x01, 0x11, 0x12, 0x0f, 0x10, 0x87, 0x04, 0x50,
+  0x51, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x23, 0x24, 0x95, 0x05, 0xb4,
+  0x34, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x4d, 0x4e, 0x83, 0x03, 0x94,
+  0x05, 0xb4, 0x34, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xec, 0x6c, 0x01,
+  0x02, 0x95, 0x06, 0xd3, 0x53, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x75,
+  0x76, 0x36, 0x37, 0x04, 0x05, 0x94, 0x09, 0xb1, 0x31, 0xf7, 0x77, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x70, 0x71, 0xc8, 0x48, 0xb4,
+  0x34, 0x87, 0x07, 0x92, 0x0a, 0x16, 0x17, 0x32, 0x33, 0xf6, 0x76, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x6b, 0x6c, 0x34,
+  0x35, 0x00, 0x01, 0x92, 0x08, 0x17, 0x18, 0xb2, 0x32, 0x65, 0x66, 0x76,
+  0x77, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xb9, 0x39, 0x95,
+  0x05, 0x19, 0x1a, 0x3d, 0x3e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x91, 0x09, 0xa4, 0x24, 0xa4, 0x24, 0xa4, 0x24, 0xa4, 0x24, 0xcf,
+  0x4f, 0x68, 0x69, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x8e,
+  0x0c, 0x90, 0x10, 0x60, 0x61, 0xe6, 0x66, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x38, 0x39, 0x8e, 0x0c, 0x63, 0x64, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xd4, 0x54, 0x97, 0x17, 0x00, 0x01, 0x8e, 0x0a, 0xa1, 0x21, 0xc7,
+  0x47, 0xc7, 0x47, 0x47, 0x48, 0xc7, 0x47, 0xc7, 0x47, 0xc7, 0x47, 0x1c,
+  0x1d, 0x8b, 0x0b, 0x8b, 0x0b, 0x01, 0x02, 0xf6, 0x00, 0x00, 0xff, 0x9b,
+  0x03, 0x99, 0x19, 0x79, 0x7a, 0xff, 0x7f, 0xf0, 0x70, 0x8e, 0x03, 0x8c,
+  0x0c, 0x11, 0x12, 0x11, 0x12, 0x01, 0x02, 0x84, 0x03, 0x37, 0x38, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x6f, 0x70, 0x8e, 0x03, 0xd5, 0x55, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x8e, 0x0e, 0x83, 0x04, 0x88, 0x08, 0xee, 0x6e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x6f, 0x70, 0x8d, 0x04, 0x8d, 0x0d, 0xf4, 0x74, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x8e, 0x0e, 0x83, 0x04, 0x26, 0x27, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xc3, 0x43, 0x8d, 0x04, 0x41, 0x42, 0xfe, 0x7e, 0xfe, 0x7e, 0x6e,
+  0x6f, 0x89, 0x09, 0x83, 0x04, 0x26, 0x27, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc,
+  0x7c, 0xa2, 0x22, 0x8c, 0x04, 0x07, 0x08, 0x78, 0x79, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x51, 0x52, 0x84, 0x03, 0x26, 0x27, 0xfe, 0x7e, 0xfe, 0x7e, 0xf8,
+  0x78, 0x8d, 0x04, 0x08, 0x09, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x51,
+  0x52, 0x84, 0x03, 0x5e, 0x5f, 0xfe, 0x7e, 0xfe, 0x7e, 0x3f, 0x40, 0x8d,
+  0x04, 0x08, 0x09, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xb1, 0x31, 0x83,
+  0x04, 0x10, 0x11, 0x71, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0x3d, 0x3e, 0x82,
+  0x00, 0x05, 0x06, 0x89, 0x04, 0x08, 0x09, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x97, 0x17, 0x83, 0x0a, 0xa7, 0x27, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x47, 0x48, 0xb7, 0x37, 0x4f, 0x50, 0x4f, 0x50, 0xe5, 0x65, 0x4f,
+  0x50, 0x85, 0x05, 0x87, 0x13, 0x08, 0x09, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x4a, 0x4b, 0x1d, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0xa7, 0x27, 0xf3,
+  0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x88, 0x08, 0x87, 0x13, 0x08,
+  0x09, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x71, 0x72, 0xc0,
+  0x40, 0x01, 0x02, 0x87, 0x11, 0x81, 0x01, 0x3e, 0x3f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4f, 0x50, 0x4e, 0x4f, 0x28,
+  0x29, 0x94, 0x14, 0x0d, 0x0e, 0x8a, 0x0c, 0x01, 0x02, 0x8b, 0x0b, 0x37,
+  0x38, 0xc6, 0x46, 0xc6, 0x46, 0xa9, 0x29, 0x10, 0x11, 0x2a, 0x2b, 0x6d,
+  0x6e, 0xfe, 0x7e, 0xfe, 0x7e, 0xcb, 0x4b, 0x80, 0x00, 0x96, 0x03, 0xd8,
+  0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xc6, 0x46, 0x97, 0x03, 0xd8, 0x58, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xc6, 0x46, 0x97, 0x03, 0xd8, 0x58, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xc6, 0x46, 0x97, 0x04, 0xd8, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0x6e,
+  0x6f, 0x01, 0x02, 0x96, 0x04, 0xd8, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x82, 0x02, 0x96, 0x04, 0x25, 0x26, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x35, 0x36, 0x96, 0x04, 0x01, 0x02, 0x47, 0x48, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x3d, 0x3e, 0xdc, 0x00, 0x00, 0xff, 0x94, 0x0e, 0x85, 0x05, 0x64,
+  0x65, 0xfe, 0x7e, 0xc4, 0x44, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b,
+  0x0c, 0x0b, 0x0c, 0x20, 0x21, 0x44, 0x45, 0xc5, 0x45, 0x44, 0x45, 0x44,
+  0x45, 0x8c, 0x0c, 0x8c, 0x0e, 0x39, 0x3a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x96, 0x16, 0x8c,
+  0x0e, 0x48, 0x49, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x54, 0x55, 0x86, 0x06, 0x8c, 0x0d, 0x72, 0x73, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xf1, 0x71, 0x4f, 0x50, 0x4f, 0x50, 0xd0, 0x50, 0x4f,
+  0x50, 0x4f, 0x50, 0x4f, 0x50, 0x1b, 0x1c, 0x16, 0x17, 0x96, 0x16, 0x86,
+  0x06, 0x8d, 0x03, 0x72, 0x73, 0xfe, 0x7e, 0x7d, 0x7e, 0xa7, 0x27, 0x96,
+  0x03, 0x99, 0x19, 0xf9, 0x79, 0xff, 0x7f, 0xe7, 0x67, 0x97, 0x03, 0xae,
+  0x2e, 0x7d, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x97, 0x08, 0x3d, 0x3e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0xed, 0x6d, 0x22, 0x23, 0x22, 0x23, 0x3c, 0x3d, 0x22,
+  0x23, 0x9c, 0x1c, 0x91, 0x0b, 0x9c, 0x1c, 0x79, 0x7a, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x79,
+  0x7a, 0x3d, 0x3e, 0x88, 0x08, 0x8f, 0x0c, 0x22, 0x23, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x5f, 0x60, 0x85, 0x05, 0x8f, 0x0b, 0x43,
+  0x44, 0xfd, 0x7d, 0x78, 0x79, 0xce, 0x4e, 0x0f, 0x10, 0xaf, 0x2f, 0x39,
+  0x3a, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe4, 0x64, 0x90,
+  0x01, 0x29, 0x2a, 0x14, 0x15, 0x83, 0x05, 0x84, 0x04, 0xd6, 0x56, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x0a, 0x0b, 0x96, 0x04, 0x10, 0x11, 0x74,
+  0x75, 0x7d, 0x7e, 0x7d, 0x7e, 0x48, 0x49, 0x97, 0x03, 0x5b, 0x5c, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x72, 0x73, 0x97, 0x04, 0x5b, 0x5c, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xf8, 0x78, 0x14, 0x15, 0x8b, 0x04, 0x82, 0x02, 0x35, 0x36, 0x44,
+  0x45, 0xdf, 0x5f, 0x85, 0x05, 0x84, 0x05, 0x87, 0x07, 0xdf, 0x5f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x29, 0x2a, 0x8b, 0x05, 0xb1, 0x31, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x45, 0x46, 0x88, 0x08, 0x81, 0x06, 0x0a,
+  0x0b, 0x36, 0x37, 0xed, 0x6d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe8,
+  0x68, 0x8c, 0x0e, 0x10, 0x11, 0x74, 0x75, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0xe8, 0x68, 0x5b, 0x5c, 0x5b, 0x5c, 0xeb, 0x6b, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xee, 0x6e, 0x0f, 0x10, 0x8d, 0x0c, 0x46,
+  0x47, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xf1, 0x71, 0xbb, 0x3b, 0x8c,
+  0x0c, 0x8e, 0x0a, 0x83, 0x03, 0x0a, 0x0b, 0x3f, 0x40, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x63, 0x64, 0xc4, 0x44, 0xba, 0x3a, 0x07,
+  0x08, 0xdd, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x04, 0x81, 0x01, 0x3a, 0x3b,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x96, 0x04, 0x3a, 0x3b, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x58, 0x59, 0x95, 0x05, 0x0f, 0x10, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xf1, 0x71, 0x17, 0x18, 0x95, 0x04, 0xce, 0x4e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0xf1, 0x71, 0x18, 0x19, 0x95, 0x04, 0xaa, 0x2a,
+  0x7c, 0x7d, 0xfe, 0x7e, 0x7d, 0x7e, 0x40, 0x41, 0x96, 0x04, 0xcd, 0x4d,
+  0xfe, 0x7e, 0xff, 0x7f, 0x71, 0x72, 0x0f, 0x10, 0x95, 0x04, 0x20, 0x21,
+  0x75, 0x76, 0x7d, 0x7e, 0xfe, 0x7e, 0x41, 0x42, 0x96, 0x04, 0x5b, 0x5c,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x2d, 0x2e, 0x96, 0x04, 0x5b, 0x5c,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x74, 0x75, 0x88, 0x08, 0x95, 0x04, 0x0a, 0x0b,
+  0xeb, 0x6b, 0x7d, 0x7e, 0x7d, 0x7e, 0x3e, 0x3f, 0x81, 0x07, 0x95, 0x15,
+  0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a, 0x39, 0x3a,
+  0x9a, 0x1a, 0x8c, 0x10, 0x95, 0x15, 0xfb, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xdf, 0x5f, 0x69, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0x3a, 0x3b,
+  0x83, 0x03, 0x8a, 0x11, 0x0e, 0x0f, 0x71, 0x72, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfc, 0x7c,
+  0x66, 0x67, 0x66, 0x67, 0x79, 0x7a, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x5c, 0x5d, 0x8e, 0x0e, 0x89, 0x09, 0x97, 0x17, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe1, 0x61, 0x40, 0x41,
+  0x9f, 0x1f, 0x81, 0x05, 0x1b, 0x1c, 0x75, 0x76, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x96, 0x16, 0x89, 0x07, 0x97, 0x17, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xcc, 0x4c, 0x84, 0x04, 0x83, 0x05,
+  0x10, 0x11, 0x76, 0x77, 0xfe, 0x7e, 0x7d, 0x7e, 0xe1, 0x61, 0x84, 0x04,
+  0x89, 0x06, 0x97, 0x17, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0xa2, 0x22, 0x83, 0x05, 0x0f, 0x10, 0x6c, 0x6d, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0xa7, 0x27, 0x8b, 0x0e, 0xdc, 0x5c, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x5e, 0x5f, 0x82, 0x02, 0x00, 0x00,
+  0x81, 0x01, 0x96, 0x16, 0x6e, 0x6f, 0xfe, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0xc3, 0x43, 0x8c, 0x0d, 0x5b, 0x5c, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xa9, 0x29, 0x97, 0x17, 0x54, 0x55, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xf3, 0x73, 0x5d, 0x5e, 0x8d, 0x0c, 0xcc, 0x4c,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf1, 0x71, 0x31, 0x32,
+  0x8e, 0x0b, 0x86, 0x06, 0xd6, 0x56, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xdc, 0x5c,
+  0x18, 0x19, 0x90, 0x09, 0x99, 0x19, 0xde, 0x5e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x63, 0x64, 0x3f, 0x40, 0x0a, 0x0b, 0x02, 0x03,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xac, 0x04, 0x29, 0x2a, 0x6a,
+  0x6b, 0x7e, 0x7f, 0x50, 0x51, 0x8c, 0x0c, 0x96, 0x05, 0xce, 0x4e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd2, 0x52, 0x0f, 0x10, 0x84, 0x03, 0x88,
+  0x08, 0x8c, 0x0c, 0x8c, 0x0c, 0x88, 0x08, 0x8c, 0x0f, 0xa9, 0x29, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xec, 0x6c, 0x17, 0x18, 0x92,
+  0x12, 0x92, 0x12, 0xb5, 0x35, 0xce, 0x4e, 0x6e, 0x6f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xee, 0x6e, 0x30, 0x31, 0x8b, 0x0f, 0x92, 0x12, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x4d, 0x4e, 0x8b, 0x0f, 0x92, 0x12, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4d,
+  0x4e, 0x8b, 0x0f, 0x89, 0x09, 0xea, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0x60,
+  0x61, 0x59, 0x5a, 0x59, 0x5a, 0x59, 0x5a, 0x3a, 0x3b, 0x1d, 0x1e, 0x1d,
+  0x1e, 0xde, 0x5e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4d, 0x4e, 0x8b,
+  0x04, 0x92, 0x12, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x17, 0x18, 0x85,
+  0x04, 0xd4, 0x54, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4d, 0x4e, 0x8b,
+  0x04, 0x92, 0x12, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x2e, 0x2f, 0x84,
+  0x05, 0x0f, 0x10, 0x78, 0x79, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xb7,
+  0x37, 0x8b, 0x04, 0x01, 0x02, 0xd8, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xb7,
+  0x37, 0x84, 0x05, 0x92, 0x12, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x11, 0x12, 0x8c, 0x03, 0xac, 0x2c, 0xd0, 0x50, 0x6c, 0x6d, 0x0e,
+  0x0f, 0x84, 0x05, 0xaf, 0x2f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xea,
+  0x6a, 0x89, 0x09, 0x94, 0x05, 0x86, 0x06, 0xe8, 0x68, 0xff, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x34, 0x35, 0x95, 0x05, 0x8c, 0x0c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x17, 0x18, 0x95, 0x05, 0x8c, 0x0c, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x17, 0x18, 0x95, 0x05, 0x8c,
+  0x0c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf7, 0x77, 0x93, 0x13, 0x95,
+  0x04, 0x1a, 0x1b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a, 0x96,
+  0x04, 0xc8, 0x48, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a, 0x96,
+  0x04, 0xc8, 0x48, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa9, 0x29, 0x95,
+  0x05, 0x85, 0x05, 0x76, 0x77, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x1d,
+  0x1e, 0x95, 0x05, 0x00, 0x01, 0xcd, 0x4d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x3a, 0x3b, 0x96, 0x04, 0x2b, 0x2c, 0xfe, 0x7e, 0xfe, 0x7e, 0xe1,
+  0x61, 0x81, 0x01, 0xc0, 0x00, 0x00, 0xff, 0x95, 0x0b, 0x04, 0x05, 0x50,
+  0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0x72, 0x73, 0x0e, 0x0f, 0x41,
+  0x42, 0x41, 0x42, 0x41, 0x42, 0x91, 0x11, 0x03, 0x04, 0x8d, 0x0d, 0x02,
+  0x03, 0x8c, 0x0c, 0xe8, 0x68, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xcd, 0x4d, 0x8c, 0x0e, 0x8c, 0x0c, 0xc8, 0x48, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xcd, 0x4d, 0x8b,
+  0x0f, 0x83, 0x03, 0xdc, 0x5c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x74,
+  0x75, 0x4b, 0x4c, 0xe3, 0x63, 0xfe, 0x7e, 0x6f, 0x70, 0x65, 0x66, 0x75,
+  0x76, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xcd, 0x4d, 0x8b, 0x05, 0xbd,
+  0x3d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x73, 0x74, 0x9e, 0x1e, 0x81,
+  0x07, 0x23, 0x24, 0x8f, 0x0f, 0x00, 0x00, 0xd4, 0x54, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xcd, 0x4d, 0x8a, 0x05, 0x89, 0x09, 0x72, 0x73, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x25, 0x26, 0x83, 0x06, 0x83, 0x03, 0x2c,
+  0x2d, 0xf4, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x71, 0x72, 0x1a, 0x1b, 0x8a,
+  0x05, 0x82, 0x02, 0x56, 0x57, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xc8,
+  0x48, 0x83, 0x05, 0xa0, 0x20, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x22, 0x23, 0x8c, 0x05, 0x1a, 0x1b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x77, 0x78, 0xa6, 0x26, 0x81, 0x06, 0x4f, 0x50, 0xf6, 0x76, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x5e, 0x5f, 0x83, 0x03, 0x8c, 0x0d, 0x8a,
+  0x0a, 0x6b, 0x6c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf9, 0x79, 0x3b,
+  0x3c, 0x52, 0x53, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe2,
+  0x62, 0x88, 0x08, 0x8e, 0x0b, 0xac, 0x2c, 0x6c, 0x6d, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xa6, 0x26, 0x90, 0x09, 0x8e, 0x0e, 0xea, 0x6a, 0xfd,
+  0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xc6, 0x46, 0x93, 0x08, 0x2b, 0x2c, 0x6d, 0x6e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xce, 0x4e, 0x83, 0x03, 0x93,
+  0x08, 0xb0, 0x30, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xcd, 0x4d, 0x0c, 0x0d, 0x92, 0x09, 0xb0, 0x30, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x71, 0x72, 0x0f, 0x10, 0x91, 0x09, 0xb0, 0x30, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xa6, 0x26, 0x91, 0x0a, 0xb0, 0x30, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x74, 0x75, 0xab, 0x2b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x73,
+  0x74, 0x8d, 0x0d, 0x90, 0x0a, 0xb0, 0x30, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x75, 0x76, 0xb6, 0x36, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x11, 0x12, 0x90, 0x0a, 0x06, 0x07, 0x5c, 0x5d, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x11, 0x12, 0x91, 0x09, 0x04, 0x05, 0x78, 0x79, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x3d, 0x3e, 0x01,
+  0x02, 0x92, 0x07, 0xa2, 0x22, 0xe1, 0x61, 0x7d, 0x7e, 0x7d, 0x7e, 0xf2,
+  0x72, 0xb3, 0x33, 0x85, 0x05, 0x81, 0x01, 0xda, 0x00, 0x00, 0xff, 0xb1,
+  0x07, 0x96, 0x16, 0xc6, 0x46, 0xf8, 0x78, 0xff, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xe5, 0x65, 0x9f, 0x1f, 0x82, 0x01, 0x8e, 0x0e, 0xe2, 0x62, 0x8d,
+  0x08, 0xaf, 0x2f, 0xf0, 0x70, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xb8, 0x38, 0x82, 0x01, 0x04, 0x05, 0xa0,
+  0x20, 0x8d, 0x08, 0xf2, 0x72, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xb8, 0x38, 0x91, 0x09, 0xe4,
+  0x64, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x64, 0x65, 0x0d, 0x0e, 0x58,
+  0x59, 0x7d, 0x7e, 0x7d, 0x7e, 0xb8, 0x38, 0x90, 0x0b, 0x17, 0x18, 0xf8,
+  0x78, 0xff, 0x7f, 0xfb, 0x7b, 0xdd, 0x5d, 0x86, 0x06, 0x00, 0x00, 0x9c,
+  0x1c, 0xfe, 0x7e, 0xfe, 0x7e, 0x0c, 0x0d, 0x86, 0x06, 0x8f, 0x03, 0x4f,
+  0x50, 0x7d, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x82, 0x05, 0x89, 0x09, 0xeb,
+  0x6b, 0x7d, 0x7e, 0x79, 0x7a, 0x66, 0x67, 0xb8, 0x38, 0x8e, 0x03, 0xe2,
+  0x62, 0x7d, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x82, 0x05, 0x28, 0x29, 0x77,
+  0x78, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x53, 0x54, 0x8e, 0x0f, 0xc9,
+  0x49, 0x7d, 0x7e, 0xfe, 0x7e, 0x7a, 0x7b, 0xf0, 0x70, 0xf0, 0x70, 0x70,
+  0x71, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x3a,
+  0x3b, 0x00, 0x00, 0x0c, 0x0d, 0xbe, 0x3e, 0x8b, 0x0f, 0x12, 0x13, 0x70,
+  0x71, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0x6e, 0x6f, 0x8c, 0x0c, 0x00,
+  0x00, 0x8e, 0x0e, 0xe2, 0x62, 0x8c, 0x0a, 0x12, 0x13, 0x48, 0x49, 0x67,
+  0x68, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x81, 0x01, 0x8e, 0x0e, 0x61, 0x62, 0x8e,
+  0x08, 0x86, 0x06, 0x1b, 0x1c, 0x1b, 0x1c, 0x1b, 0x1c, 0x31, 0x32, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x81, 0x01, 0x8e, 0x0e, 0x61,
+  0x62, 0x92, 0x04, 0x9c, 0x1c, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x61,
+  0x62, 0x81, 0x01, 0x8e, 0x0e, 0x61, 0x62, 0x92, 0x04, 0x9c, 0x1c, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xe2, 0x62, 0x81, 0x01, 0x8e, 0x0e, 0x5b,
+  0x5c, 0x92, 0x04, 0x9c, 0x1c, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x61,
+  0x62, 0x81, 0x01, 0x04, 0x05, 0x0d, 0x0e, 0x92, 0x04, 0x9c, 0x1c, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x96, 0x04, 0x9c, 0x1c, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x96, 0x04, 0x9c, 0x1c, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xe2, 0x62, 0x96, 0x05, 0x15, 0x16, 0x77,
+  0x78, 0x7d, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0x86, 0x06, 0x96, 0x05, 0xa8,
+  0x28, 0xf9, 0x79, 0xfe, 0x7e, 0x7d, 0x7e, 0xd5, 0x55, 0x04, 0x05, 0x96,
+  0x04, 0xbe, 0x3e, 0xe5, 0x65, 0x7d, 0x7e, 0xbf, 0x3f, 0x81, 0x01, 0xbe,
+  0x00, 0x00, 0xff, 0xb5, 0x06, 0xad, 0x2d, 0x3a, 0x3b, 0x3a, 0x3b, 0x3a,
+  0x3b, 0x3a, 0x3b, 0x1c, 0x1d, 0x96, 0x16, 0x8f, 0x0d, 0x95, 0x15, 0x4e,
+  0x4f, 0xf8, 0x78, 0xf8, 0x78, 0xf8, 0x78, 0xfd, 0x7d, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0x7a, 0x7b, 0xf3, 0x73, 0x98,
+  0x18, 0x8c, 0x0f, 0x30, 0x31, 0xf2, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x75, 0x76, 0x17, 0x18, 0x89,
+  0x11, 0x16, 0x17, 0xcd, 0x4d, 0xfd, 0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x47, 0x48, 0x1b, 0x1c, 0xcd, 0x4d, 0xcd,
+  0x4d, 0x54, 0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x52,
+  0x53, 0x89, 0x08, 0x51, 0x52, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6d,
+  0x6e, 0x99, 0x19, 0x0f, 0x10, 0x0f, 0x10, 0x03, 0x04, 0x82, 0x06, 0x82,
+  0x02, 0x3f, 0x40, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x35,
+  0x36, 0x87, 0x05, 0xca, 0x4a, 0x7d, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6d,
+  0x6e, 0x94, 0x14, 0x87, 0x05, 0x82, 0x02, 0xd5, 0x55, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xbd, 0x3d, 0x87, 0x04, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xcd, 0x4d, 0x89, 0x04, 0x4d, 0x4e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xd1, 0x51, 0x87, 0x04, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x19, 0x1a, 0x89, 0x04, 0x9a, 0x1a, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x87, 0x04, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x8c, 0x0c, 0x89, 0x04, 0x3f, 0x40, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x87, 0x04, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x1b, 0x1c, 0x87, 0x06, 0x04, 0x05, 0xc7, 0x47, 0xf2,
+  0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xcd, 0x4d, 0x87, 0x04, 0x7e,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xcd, 0x4d, 0x87, 0x06, 0xa1,
+  0x21, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6e, 0x6f, 0x91,
+  0x11, 0x87, 0x05, 0xc6, 0x46, 0x7d, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xef,
+  0x6f, 0x16, 0x17, 0x83, 0x08, 0x85, 0x05, 0x16, 0x17, 0x43, 0x44, 0x71,
+  0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0x7c, 0x7d, 0xe4, 0x64, 0x11, 0x12, 0x89,
+  0x0f, 0x7b, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xef, 0x6f, 0x16,
+  0x17, 0x00, 0x00, 0x05, 0x06, 0xa4, 0x24, 0xde, 0x5e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc, 0x7c, 0xe2, 0x62, 0x8b, 0x0e, 0x51,
+  0x52, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xef, 0x6f, 0xd1,
+  0x51, 0xde, 0x5e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x73, 0x74, 0x40, 0x41, 0x8c, 0x0d, 0x96, 0x16, 0x4c, 0x4d, 0xfd,
+  0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf5, 0x75, 0xe7, 0x67, 0x91, 0x11, 0x8f,
+  0x09, 0xca, 0x4a, 0xf8, 0x78, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfc, 0x7c, 0xe7, 0x67, 0x0f, 0x10, 0x92, 0x06, 0x95,
+  0x15, 0x36, 0x37, 0xee, 0x6e, 0x77, 0x78, 0xe5, 0x65, 0x36, 0x37, 0xaa,
+  0x2a, 0xff, 0x97, 0x00, 0x00, 0x00, 0xff, 0x96, 0x06, 0xaa, 0x2a, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xed, 0x6d, 0x95, 0x15, 0x8a, 0x0a, 0x93,
+  0x07, 0x87, 0x07, 0x45, 0x46, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0xbe, 0x3e, 0x93, 0x07, 0x95, 0x15, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0xbe, 0x3e, 0x93,
+  0x07, 0x95, 0x15, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0xbe, 0x3e, 0x93, 0x07, 0x95, 0x15, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0xbe, 0x3e, 0x93,
+  0x07, 0x95, 0x15, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e,
+  0x7f, 0x7d, 0x7e, 0x3e, 0x3f, 0x93, 0x08, 0x95, 0x15, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x52, 0x53, 0x0d,
+  0x0e, 0x92, 0x08, 0x95, 0x15, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
+  0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0xa9, 0x29, 0x92, 0x08, 0x95,
+  0x15, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c,
+  0x7d, 0xd2, 0x52, 0x8d, 0x0d, 0x92, 0x07, 0x83, 0x03, 0xb7, 0x37, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0xbe, 0x3e, 0x93,
+  0x08, 0x11, 0x12, 0x6f, 0x70, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xff,
+  0x7f, 0x7d, 0x7e, 0x48, 0x49, 0x06, 0x07, 0x93, 0x07, 0xaa, 0x2a, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0xa9,
+  0x29, 0x93, 0x07, 0xaa, 0x2a, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0xa9, 0x29, 0x93, 0x07, 0xaa, 0x2a, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0xd2, 0x52, 0x8d,
+  0x0d, 0x93, 0x06, 0xaa, 0x2a, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0xbe, 0x3e, 0x95, 0x06, 0x3f, 0x40, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xff, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0xa9, 0x29, 0x94, 0x07, 0xbf,
+  0x3f, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x44,
+  0x45, 0x06, 0x07, 0x93, 0x07, 0x9f, 0x1f, 0xe8, 0x68, 0x7c, 0x7d, 0x7d,
+  0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x94, 0x14, 0x94, 0x06, 0x1b,
+  0x1c, 0xef, 0x6f, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x94,
+  0x14, 0x95, 0x05, 0x10, 0x11, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x36,
+  0x37, 0x83, 0x03, 0xdb, 0x00, 0x00, 0xf6, 0x07, 0xa7, 0x27, 0xdf, 0x5f,
+  0xdf, 0x5f, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0x36, 0x37, 0x26, 0x27,
+  0x91, 0x0c, 0x0f, 0x10, 0xe2, 0x62, 0x78, 0x79, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x63, 0x64, 0xa4, 0x24,
+  0xa4, 0x24, 0x14, 0x15, 0x8e, 0x0e, 0x69, 0x6a, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xf8, 0x78, 0xf8, 0x78, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x6e, 0x6f, 0xda, 0x5a, 0x23, 0x24,
+  0x8c, 0x0f, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xde, 0x5e,
+  0xa6, 0x26, 0x26, 0x27, 0x35, 0x36, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xeb, 0x6b, 0x80, 0x00, 0x8b, 0x04,
+  0xdf, 0x5f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x28, 0x29, 0x83, 0x06,
+  0x14, 0x15, 0xcf, 0x4f, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x35, 0x36, 0x8b, 0x03, 0x26, 0x27, 0xd9, 0x59, 0x4e, 0x4f, 0x91, 0x11,
+  0x85, 0x05, 0x26, 0x27, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x35, 0x36, 0x94, 0x06, 0x9a, 0x1a, 0x73, 0x74, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7a, 0x7b, 0x2d, 0x2e, 0x93, 0x06, 0x9f, 0x1f, 0xd7, 0x57,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xeb, 0x6b, 0x93, 0x07,
+  0x9f, 0x1f, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f,
+  0xfe, 0x7e, 0x4c, 0x4d, 0x92, 0x08, 0x9a, 0x1a, 0xd7, 0x57, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x04, 0x05,
+  0x92, 0x07, 0xda, 0x5a, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xf6, 0x76, 0x0e, 0x0f, 0x92, 0x07, 0x14, 0x15, 0xee, 0x6e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x53, 0x54, 0x1e, 0x1f,
+  0x92, 0x07, 0x97, 0x17, 0xf4, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x35, 0x36, 0x93, 0x07, 0xb6, 0x36, 0x7d, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xd9, 0x59, 0x87, 0x07,
+  0x93, 0x09, 0xb6, 0x36, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x30, 0x31, 0x92, 0x12, 0x92, 0x12, 0x82, 0x02, 0x90, 0x10,
+  0x80, 0x00, 0xdf, 0x5f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xcf, 0x4f, 0x47, 0x48,
+  0x47, 0x48, 0xc8, 0x48, 0x47, 0x48, 0x47, 0x48, 0x47, 0x48, 0x8a, 0x10,
+  0x80, 0x00, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x8a, 0x10,
+  0x80, 0x00, 0x3f, 0x40, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x8b, 0x0f,
+  0x8f, 0x0f, 0xe1, 0x61, 0xeb, 0x6b, 0xeb, 0x6b, 0xec, 0x6c, 0xeb, 0x6b,
+  0xeb, 0x6b, 0xeb, 0x6b, 0xec, 0x6c, 0xeb, 0x6b, 0xf8, 0x78, 0x7d, 0x7e,
+  0xf6, 0x76, 0xfb, 0x7b, 0xf3, 0x73, 0xf3, 0x73, 0x95, 0x05, 0x26, 0x27,
+  0x35, 0x36, 0x1e, 0x1f, 0xae, 0x2e, 0x16, 0x17, 0x16, 0x17, 0xf2, 0x00,
+  0x00, 0x00, 0xff, 0xc6, 0x0f, 0x6e, 0x6f, 0xef, 0x6f, 0xef, 0x6f, 0xef,
+  0x6f, 0xef, 0x6f, 0xef, 0x6f, 0xcd, 0x4d, 0xb9, 0x39, 0xb9, 0x39, 0xb9,
+  0x39, 0xb9, 0x39, 0x3d, 0x3e, 0xef, 0x6f, 0xef, 0x6f, 0xd2, 0x52, 0x93,
+  0x13, 0x8b, 0x0f, 0x3f, 0x40, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xde, 0x5e, 0x8b,
+  0x0f, 0x04, 0x05, 0xc7, 0x47, 0xd6, 0x56, 0xd6, 0x56, 0xd6, 0x56, 0xd6,
+  0x56, 0xef, 0x6f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7a, 0x7b, 0x3f, 0x40, 0x91, 0x09, 0x88,
+  0x08, 0x8d, 0x0d, 0x8d, 0x0d, 0x9c, 0x1c, 0x73, 0x74, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x74, 0x75, 0x91, 0x11, 0x92, 0x07, 0x12, 0x13, 0x9c,
+  0x1c, 0x6d, 0x6e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xeb, 0x6b, 0x2f,
+  0x30, 0x91, 0x08, 0x01, 0x02, 0xb6, 0x36, 0xf8, 0x78, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x74, 0x75, 0x0f, 0x10, 0x92, 0x08, 0x9a,
+  0x1a, 0xea, 0x6a, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfa,
+  0x7a, 0x39, 0x3a, 0x01, 0x02, 0x92, 0x0a, 0x01, 0x02, 0xb8, 0x38, 0x78,
+  0x79, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x59,
+  0x5a, 0xcb, 0x4b, 0x94, 0x14, 0x92, 0x09, 0xa7, 0x27, 0x50, 0x51, 0x50,
+  0x51, 0xf5, 0x75, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf8,
+  0x78, 0x24, 0x25, 0x94, 0x08, 0x86, 0x06, 0x8c, 0x0c, 0xca, 0x4a, 0xf4,
+  0x74, 0x7e, 0x7f, 0x7e, 0x7f, 0x7b, 0x7c, 0xe9, 0x69, 0x07, 0x08, 0x96,
+  0x05, 0x45, 0x46, 0x75, 0x76, 0x7e, 0x7f, 0x7e, 0x7f, 0xf3, 0x73, 0x8c,
+  0x0c, 0x8f, 0x02, 0x98, 0x18, 0xb1, 0x31, 0x9f, 0x1f, 0x83, 0x04, 0x3f,
+  0x40, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x6a, 0x6b, 0x8e, 0x0c, 0x29,
+  0x2a, 0x7c, 0x7d, 0x7e, 0x7f, 0xfd, 0x7d, 0x46, 0x47, 0x43, 0x44, 0x43,
+  0x44, 0xf8, 0x78, 0xfd, 0x7d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xdc,
+  0x5c, 0x8e, 0x0c, 0x0d, 0x0e, 0x77, 0x78, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x67, 0x68, 0xa5, 0x25, 0x8f, 0x0a, 0xae, 0x2e, 0xec, 0x6c, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x69,
+  0x6a, 0xad, 0x2d, 0x86, 0x06, 0x91, 0x07, 0x81, 0x01, 0x15, 0x16, 0x38,
+  0x39, 0x38, 0x39, 0x38, 0x39, 0x84, 0x04, 0x82, 0x02, 0x81, 0x01, 0xff,
+  0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x91, 0x04, 0x81, 0x01, 0x3a,
+  0x3b, 0xfe, 0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x84, 0x03, 0x0b, 0x0c, 0x96,
+  0x16, 0x9b, 0x1b, 0x82, 0x02, 0x8d, 0x04, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x84, 0x03, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xbb, 0x3b, 0x8d, 0x04, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x53, 0x54, 0x83, 0x04, 0xaa, 0x2a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x3f, 0x40, 0x8d, 0x04, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xc4, 0x44, 0x83, 0x04, 0xce, 0x4e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x96, 0x16, 0x8d, 0x04, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xc4, 0x44, 0x82, 0x05, 0x95, 0x15, 0x77, 0x78, 0xfe, 0x7e, 0x7d,
+  0x7e, 0xee, 0x6e, 0x8c, 0x0c, 0x8d, 0x04, 0x0b, 0x0c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x3f, 0x40, 0x82, 0x04, 0x33, 0x34, 0xfe, 0x7e, 0xff,
+  0x7f, 0xfe, 0x7e, 0xd6, 0x56, 0x8e, 0x04, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x0a, 0x0b, 0x81, 0x05, 0x86, 0x06, 0xeb, 0x6b, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xa2, 0x22, 0x8e, 0x04, 0x9b, 0x1b, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x0a, 0x0b, 0x81, 0x05, 0x22, 0x23, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xa2, 0x22, 0x8e, 0x04, 0x44,
+  0x45, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x0a, 0x0b, 0x81, 0x0b, 0x12,
+  0x13, 0x73, 0x74, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xa2, 0x22, 0x00,
+  0x00, 0x95, 0x15, 0x99, 0x19, 0xae, 0x2e, 0xae, 0x2e, 0x9d, 0x1d, 0x88,
+  0x04, 0x44, 0x45, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x0a, 0x0b, 0x81,
+  0x0c, 0x3c, 0x3d, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x75,
+  0x76, 0x72, 0x73, 0x77, 0x78, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x79,
+  0x7a, 0x3e, 0x3f, 0x87, 0x13, 0xc5, 0x45, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff,
+  0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa5, 0x25, 0x87, 0x13, 0x3a,
+  0x3b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfc, 0x7c, 0x66, 0x67, 0x66, 0x67, 0x37,
+  0x38, 0x03, 0x04, 0x87, 0x0f, 0x83, 0x03, 0xc6, 0x46, 0x74, 0x75, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x77, 0x78, 0xdb, 0x5b, 0xac, 0x2c, 0xa2, 0x22, 0x9f,
+  0x1f, 0x8d, 0x09, 0x90, 0x10, 0x96, 0x16, 0x96, 0x16, 0x16, 0x17, 0x96,
+  0x16, 0x32, 0x33, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x96,
+  0x04, 0x22, 0x23, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x96,
+  0x04, 0x22, 0x23, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xe7, 0x67, 0x96,
+  0x04, 0x22, 0x23, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x96,
+  0x05, 0x99, 0x19, 0x77, 0x78, 0x7d, 0x7e, 0xfe, 0x7e, 0xed, 0x6d, 0x89,
+  0x09, 0x96, 0x04, 0xb8, 0x38, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x50,
+  0x51, 0x96, 0x04, 0x99, 0x19, 0xde, 0x5e, 0xfe, 0x7e, 0xf3, 0x73, 0x17,
+  0x18, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xff, 0x93, 0x03, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x87, 0x03, 0x3f, 0x40, 0x3f, 0x40, 0x3f,
+  0x40, 0x1f, 0x20, 0x8a, 0x10, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xdf, 0x5f, 0x1f, 0x20, 0x1f, 0x20, 0x3f, 0x40, 0x3f, 0x40, 0x3f,
+  0x40, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x8a, 0x10, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x8a, 0x0f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x3f,
+  0x40, 0x8b, 0x0b, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x3f, 0x40, 0x8f, 0x04, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x1f, 0x20, 0x95, 0x04, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x96, 0x0b, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x3f, 0x40, 0x3f, 0x40, 0x8f, 0x0d, 0x3f, 0x40, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8d,
+  0x0f, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8c, 0x0f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x3f, 0x40, 0x3f,
+  0x40, 0x3f, 0x40, 0x3f, 0x40, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x8c, 0x01, 0x1f, 0x20, 0x3f,
+  0x40, 0x87, 0x04, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x96, 0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x95, 0x05, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xdf, 0x5f, 0x94, 0x06, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x92, 0x07, 0x1f, 0x20, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x8c, 0x0d, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x3f,
+  0x40, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8d, 0x0c, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x8f,
+  0x09, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x91, 0x06, 0x1f,
+  0x20, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x3f,
+  0x40, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x05, 0x86, 0x06, 0xcd, 0x4d,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0xa7, 0x27, 0x94, 0x06, 0x80, 0x00,
+  0x37, 0x38, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x8b, 0x0b,
+  0x94, 0x06, 0x37, 0x38, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x51, 0x52, 0x03, 0x04, 0x93, 0x06, 0x1f, 0x20, 0x7a, 0x7b, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x50, 0x51, 0x85, 0x05, 0x93, 0x06, 0x0f, 0x10,
+  0xf5, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xb6, 0x36, 0x85, 0x05,
+  0x93, 0x06, 0x1f, 0x20, 0xf5, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xd3, 0x53, 0x84, 0x04, 0x94, 0x05, 0x23, 0x24, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xf3, 0x73, 0x01, 0x02, 0x95, 0x04, 0x23, 0x24, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xd1, 0x51, 0x95, 0x05, 0x84, 0x04, 0x4d, 0x4e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x72, 0x73, 0x14, 0x15, 0x95, 0x04, 0x43, 0x44,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc0, 0x40, 0x82, 0x07, 0x89, 0x09,
+  0x1d, 0x1e, 0x1d, 0x1e, 0xbc, 0x3c, 0xd8, 0x58, 0xd8, 0x58, 0xae, 0x2e,
+  0x86, 0x06, 0x8a, 0x11, 0x1f, 0x20, 0xf5, 0x75, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xc0, 0x40, 0x03, 0x04, 0x26, 0x27, 0x4f, 0x50, 0xea, 0x6a,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x53, 0x54, 0x97, 0x17, 0x88, 0x12, 0x83, 0x03, 0xdf, 0x5f, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xbc, 0x3c, 0xd2, 0x52, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4b, 0x4c, 0x88, 0x12, 0x08, 0x09,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xc7, 0x47, 0x66, 0x67, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4b, 0x4c,
+  0x88, 0x12, 0x84, 0x04, 0x64, 0x65, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x62, 0x63, 0xdd, 0x5d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68,
+  0x27, 0x28, 0x82, 0x02, 0xa7, 0x27, 0xfd, 0x7d, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfc, 0x7c, 0xad, 0x2d, 0x89, 0x10, 0x45, 0x46, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xc9, 0x49, 0x36, 0x37, 0x6f, 0x70, 0x6f, 0x70, 0x61, 0x62,
+  0x8c, 0x0c, 0x05, 0x06, 0xc4, 0x44, 0xfd, 0x7d, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x4d, 0x4e, 0x8a, 0x05, 0x8e, 0x0e, 0x76, 0x77, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x6b, 0x6c, 0x83, 0x03, 0x82, 0x07, 0xa4, 0x24, 0x62, 0x63,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc2, 0x42, 0x89, 0x09,
+  0x8b, 0x0e, 0xd5, 0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x3f, 0x40,
+  0x20, 0x21, 0x20, 0x21, 0x49, 0x4a, 0xf6, 0x76, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x7a, 0x7b, 0xb7, 0x37, 0x09, 0x0a, 0x8c, 0x0c, 0xc2, 0x42,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe9, 0x69, 0x2f, 0x30,
+  0x8e, 0x0b, 0x03, 0x04, 0xcb, 0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6b, 0x6c, 0xb2, 0x32,
+  0x88, 0x08, 0x90, 0x08, 0x82, 0x02, 0x9d, 0x1d, 0x77, 0x78, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x54, 0x55, 0x31, 0x32, 0x85, 0x05, 0xff, 0x95,
+  0x00, 0x00, 0xff, 0xc6, 0x12, 0x42, 0x43, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x44, 0x45, 0x81, 0x01, 0x00, 0x00, 0x82, 0x02, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x0b, 0x0c, 0xc2, 0x42, 0xc2, 0x42, 0xc2, 0x42, 0xc2,
+  0x42, 0xc2, 0x42, 0x8e, 0x0e, 0x00, 0x01, 0x88, 0x12, 0xc2, 0x42, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd5, 0x55, 0xc8, 0x48, 0xdd,
+  0x5d, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xae, 0x2e, 0x88,
+  0x13, 0x9d, 0x1d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x69, 0x6a, 0x83, 0x03, 0x87, 0x13, 0x82, 0x02, 0xda, 0x5a, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xf0, 0x70, 0xdd, 0x5d, 0x35, 0x36, 0x77,
+  0x78, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x85, 0x05, 0x88,
+  0x0a, 0x9a, 0x1a, 0x72, 0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xe4, 0x64, 0x23,
+  0x24, 0x23, 0x24, 0x5a, 0x5b, 0xa6, 0x26, 0x23, 0x24, 0x8f, 0x0f, 0x81,
+  0x05, 0x5a, 0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x85,
+  0x05, 0x89, 0x03, 0x9b, 0x1b, 0x59, 0x5a, 0xcb, 0x4b, 0x95, 0x15, 0x86,
+  0x06, 0x12, 0x13, 0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x54,
+  0x55, 0x81, 0x01, 0x94, 0x05, 0xc9, 0x49, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x16, 0x17, 0x95, 0x05, 0xd4, 0x54, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x0b, 0x0c, 0x95, 0x05, 0xd4, 0x54, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd2, 0x52, 0x81, 0x01, 0x94, 0x05, 0x08,
+  0x09, 0x68, 0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xb1, 0x31, 0x95,
+  0x05, 0x95, 0x15, 0xff, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7c, 0x7d, 0x10,
+  0x11, 0x94, 0x05, 0x81, 0x01, 0xd3, 0x53, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x53, 0x54, 0x95, 0x05, 0x8c, 0x0c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xcb, 0x4b, 0x95, 0x05, 0x8c, 0x0c, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x17, 0x18, 0x95, 0x05, 0x37, 0x38, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x17, 0x18, 0x94, 0x06, 0x01,
+  0x02, 0x57, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x45,
+  0x46, 0x94, 0x06, 0x86, 0x06, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x53, 0x54, 0x94, 0x06, 0x86, 0x06, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa0, 0x20, 0x94, 0x06, 0x83,
+  0x03, 0xe7, 0x67, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc3, 0x43, 0x82,
+  0x02, 0x95, 0x04, 0x0e, 0x0f, 0xfe, 0x7e, 0xfe, 0x7e, 0xc4, 0x44, 0x81,
+  0x01, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xff, 0x96, 0x0c, 0x04, 0x05, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x05, 0x06, 0x00, 0x00, 0x00, 0x01, 0xba,
+  0x3a, 0x7e, 0x7f, 0x61, 0x62, 0x6a, 0x6b, 0x2b, 0x2c, 0x00, 0x01, 0x8b,
+  0x0f, 0x82, 0x02, 0x1a, 0x1b, 0xc8, 0x48, 0xf4, 0x74, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0x85, 0x05, 0xb5, 0x35, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xae, 0x2e, 0x8a, 0x11, 0x8b,
+  0x0b, 0x43, 0x44, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xdb, 0x5b, 0x1d, 0x1e, 0xd8, 0x58, 0x70,
+  0x71, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4f, 0x50, 0x00, 0x01, 0x88,
+  0x12, 0x13, 0x14, 0x6e, 0x6f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xf2, 0x72, 0x00,
+  0x00, 0x04, 0x05, 0x30, 0x31, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x59,
+  0x5a, 0x01, 0x02, 0x87, 0x12, 0x84, 0x04, 0xef, 0x6f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe4, 0x64, 0xe0, 0x60, 0x42,
+  0x43, 0xdf, 0x5f, 0xdb, 0x5b, 0xa7, 0x27, 0xe1, 0x61, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x1c, 0x1d, 0x88, 0x07, 0x86, 0x06, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x73, 0x74, 0x45, 0x46, 0x84,
+  0x04, 0x81, 0x08, 0x17, 0x18, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf2, 0x72, 0x42, 0x43, 0x02, 0x03, 0x88, 0x05, 0x86,
+  0x06, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xbd, 0x3d, 0x81,
+  0x08, 0x26, 0x27, 0xaa, 0x2a, 0x73, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x5d, 0x5e, 0x9b, 0x1b, 0x8a, 0x0f, 0x00, 0x01, 0x4f,
+  0x50, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf9, 0x79, 0x4f, 0x50, 0x6c,
+  0x6d, 0x7c, 0x7d, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xf5,
+  0x75, 0x3f, 0x40, 0x84, 0x04, 0x8c, 0x0c, 0x8c, 0x0c, 0x69, 0x6a, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0x53, 0x54, 0x89, 0x09, 0x8f, 0x0a, 0x31,
+  0x32, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xdf, 0x5f, 0xbc, 0x3c, 0x82, 0x02, 0x91, 0x08, 0x54,
+  0x55, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x5c, 0x5d, 0x02, 0x03, 0x91, 0x0a, 0x8a, 0x0a, 0x6c, 0x6d, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e,
+  0x7f, 0x59, 0x5a, 0x04, 0x05, 0x90, 0x0a, 0x92, 0x12, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e,
+  0x7f, 0xfe, 0x7e, 0x38, 0x39, 0x90, 0x0b, 0x92, 0x12, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x29, 0x2a, 0x60, 0x61, 0xfd, 0x7d, 0x7e,
+  0x7f, 0xfe, 0x7e, 0xf8, 0x78, 0xc4, 0x44, 0x8f, 0x0c, 0x85, 0x05, 0xe0,
+  0x60, 0xfe, 0x7e, 0xfe, 0x7e, 0xf2, 0x72, 0x9b, 0x1b, 0x00, 0x00, 0xbf,
+  0x3f, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0x77, 0x78, 0x44, 0x45, 0x8f,
+  0x0c, 0xc3, 0x43, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf3, 0x73, 0x9a,
+  0x1a, 0x00, 0x00, 0x50, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x68,
+  0x69, 0x08, 0x09, 0x8e, 0x0c, 0x04, 0x05, 0x4c, 0x4d, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf4, 0x74, 0x49, 0x4a, 0x56, 0x57, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x1d, 0x1e, 0x8f, 0x0b, 0x12, 0x13, 0xf3,
+  0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x72, 0x73, 0x92, 0x12, 0x90, 0x09, 0x9a,
+  0x1a, 0xda, 0x5a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x45, 0x46, 0x92, 0x08, 0x01, 0x02, 0x1c,
+  0x1d, 0x41, 0x42, 0x7b, 0x7c, 0x7e, 0x7f, 0xfe, 0x7e, 0x58, 0x59, 0x36,
+  0x37, 0x01, 0x02, 0xdb, 0x00, 0x00, 0xff, 0x98, 0x04, 0x1f, 0x20, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x93, 0x07, 0x3f, 0x40, 0xdf,
+  0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x92, 0x09, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x8f,
+  0x0a, 0x1f, 0x20, 0x1f, 0x20, 0xff, 0x7f, 0xdf, 0x5f, 0xff, 0x7f, 0xff,
+  0x7f, 0xdf, 0x5f, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0x90,
+  0x05, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x82, 0x01, 0x3f, 0x40, 0xdf, 0x5f, 0x90, 0x04, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x85, 0x02, 0x3f, 0x40, 0x3f,
+  0x40, 0x3f, 0x40, 0x8c, 0x04, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x1f, 0x20, 0x85, 0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x8b, 0x03, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x86, 0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x8b, 0x02, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x85, 0x06, 0x1f,
+  0x20, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x8a, 0x10, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x00, 0x00, 0x1f, 0x20, 0x3f, 0x40, 0x3f, 0x40, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x8a, 0x10, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x8b, 0x0f, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x8c,
+  0x0e, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x1f, 0x20, 0x00, 0x00, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x90, 0x00, 0x1f, 0x20, 0x84,
+  0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x96,
+  0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x96,
+  0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x96,
+  0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x96,
+  0x04, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x97,
+  0x04, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x97,
+  0x02, 0xdf, 0x5f, 0xff, 0x7f, 0xdf, 0x5f, 0xd9, 0x00, 0x00, 0xff, 0x99,
+  0x07, 0x85, 0x05, 0x0b, 0x0c, 0x0b, 0x0c, 0x35, 0x36, 0x44, 0x45, 0x10,
+  0x11, 0x0b, 0x0c, 0x84, 0x04, 0x8f, 0x0c, 0x82, 0x02, 0x21, 0x22, 0xd0,
+  0x50, 0xd0, 0x50, 0xe5, 0x65, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x60, 0x61, 0xa0, 0x20, 0x8e, 0x0d, 0x44,
+  0x45, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x74,
+  0x75, 0xa0, 0x20, 0x8c, 0x0f, 0x43, 0x44, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x57,
+  0x58, 0x79, 0x7a, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x75, 0x76, 0x89,
+  0x09, 0x8a, 0x10, 0xaa, 0x2a, 0x7c, 0x7d, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf9, 0x79, 0xba, 0x3a, 0x0a, 0x0b, 0x01,
+  0x02, 0x8a, 0x0a, 0xe4, 0x64, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xa5,
+  0x25, 0x89, 0x08, 0x22, 0x23, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x5e, 0x5f, 0x9a, 0x1a, 0x83, 0x04, 0x85,
+  0x05, 0xe5, 0x65, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x89, 0x07, 0x46,
+  0x47, 0x7d, 0x7e, 0x7d, 0x7e, 0xfc, 0x7c, 0xcc, 0x4c, 0x77, 0x78, 0x7d,
+  0x7e, 0xc4, 0x44, 0x85, 0x03, 0xd0, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x88, 0x08, 0x10, 0x11, 0x74, 0x75, 0x7d, 0x7e, 0x7d, 0x7e, 0xe3,
+  0x63, 0x00, 0x00, 0x18, 0x19, 0x50, 0x51, 0x31, 0x32, 0x85, 0x03, 0xd0,
+  0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x88, 0x04, 0x97, 0x17, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x39, 0x3a, 0x88, 0x04, 0x84, 0x04, 0x60,
+  0x61, 0x7d, 0x7e, 0x7d, 0x7e, 0xce, 0x4e, 0x88, 0x04, 0xb1, 0x31, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x85, 0x05, 0x88, 0x04, 0xda, 0x5a, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xaa, 0x2a, 0x87, 0x04, 0x81, 0x01, 0x54,
+  0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a, 0x87, 0x06, 0x84, 0x04, 0xda,
+  0x5a, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0x5f, 0x60, 0x85, 0x05, 0x87,
+  0x04, 0x0b, 0x0c, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x0a, 0x0b, 0x86,
+  0x06, 0x86, 0x06, 0x56, 0x57, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x77,
+  0x78, 0x92, 0x12, 0x88, 0x04, 0x44, 0x45, 0x7d, 0x7e, 0x7d, 0x7e, 0xf1,
+  0x71, 0x07, 0x08, 0x85, 0x06, 0x86, 0x06, 0x55, 0x56, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xcb, 0x4b, 0x89, 0x03, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x4f, 0x50, 0x85, 0x07, 0x1e, 0x1f, 0xeb, 0x6b, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x3b, 0x3c, 0x86, 0x06, 0x89,
+  0x03, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x4f, 0x50, 0x84, 0x07, 0x4e,
+  0x4f, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x63, 0x64, 0xa5,
+  0x25, 0x03, 0x04, 0x8a, 0x0e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xe9,
+  0x69, 0x10, 0x11, 0xab, 0x2b, 0x44, 0x45, 0x54, 0x55, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x75, 0x76, 0xc3, 0x43, 0x85, 0x05, 0x8c,
+  0x0c, 0x73, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfc, 0x7c, 0xdc,
+  0x5c, 0x8c, 0x0c, 0x8e, 0x0a, 0x17, 0x18, 0xf1, 0x71, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x43,
+  0x44, 0x9f, 0x1f, 0x91, 0x08, 0xb3, 0x33, 0xdc, 0x5c, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfa, 0x7a, 0x4f, 0x50, 0x4f, 0x50, 0x20, 0x21, 0x01, 0x02, 0x93,
+  0x03, 0x83, 0x03, 0x0a, 0x0b, 0x0a, 0x0b, 0x8a, 0x0a, 0xe4, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x98, 0x04, 0xa6, 0x26, 0xfe, 0x7e, 0xff, 0x7f, 0xfe,
+  0x7e, 0xcf, 0x4f, 0x96, 0x05, 0x48, 0x49, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x62, 0x63, 0x88, 0x08, 0x94, 0x06, 0x8c, 0x0c, 0xf8, 0x78, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x93, 0x13, 0x94, 0x06, 0x82,
+  0x02, 0xd1, 0x51, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xd6, 0x56, 0x02,
+  0x03, 0x94, 0x05, 0x0a, 0x0b, 0x72, 0x73, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x4e, 0x4f, 0x95, 0x05, 0x8d, 0x0d, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x1d, 0x1e, 0x95, 0x05, 0x8d, 0x0d, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x0c, 0x0d, 0x95, 0x05, 0x94, 0x14, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x5b, 0x5c, 0x04, 0x05, 0x95, 0x04, 0x4f,
+  0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x96, 0x04, 0x4f,
+  0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x96, 0x04, 0xd0,
+  0x50, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0x48, 0x49, 0x96, 0x04, 0x33,
+  0x34, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x96, 0x04, 0x48,
+  0x49, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x95, 0x05, 0x10,
+  0x11, 0x76, 0x77, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x95,
+  0x05, 0x94, 0x14, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xc8,
+  0x48, 0x95, 0x05, 0x0f, 0x10, 0x73, 0x74, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0xc8, 0x48, 0x96, 0x04, 0x4f, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0xc8, 0x48, 0x96, 0x05, 0x4f, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0xea, 0x6a, 0x88, 0x08, 0x95, 0x05, 0xa9, 0x29, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7a, 0x7b, 0x8c, 0x0c, 0x95, 0x04, 0x86, 0x06, 0x61,
+  0x62, 0x7d, 0x7e, 0xfe, 0x7e, 0xa5, 0x25, 0xde, 0x00, 0x00, 0xf7, 0x08,
+  0xad, 0x2d, 0x6b, 0x6c, 0x7e, 0x7f, 0x66, 0x67, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x66, 0x67, 0x10, 0x11, 0x8c, 0x0c, 0x91, 0x0a, 0x22, 0x23, 0x7c, 0x7d,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x7e, 0x7f, 0x65, 0x66, 0x05, 0x06, 0x90, 0x0c, 0x88, 0x08, 0x64, 0x65,
+  0xfe, 0x7e, 0xed, 0x6d, 0x4c, 0x4d, 0x4c, 0x4d, 0x5b, 0x5c, 0xfe, 0x7e,
+  0x7e, 0x7f, 0x6f, 0x70, 0x8c, 0x0c, 0x9a, 0x1a, 0x91, 0x11, 0x8f, 0x02,
+  0x02, 0x03, 0x04, 0x05, 0x83, 0x03, 0x81, 0x07, 0x01, 0x02, 0xb5, 0x35,
+  0xfa, 0x7a, 0xfe, 0x7e, 0xfa, 0x7a, 0xfc, 0x7c, 0x62, 0x63, 0x82, 0x02,
+  0x95, 0x05, 0xa0, 0x20, 0xf6, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xa7, 0x27, 0x95, 0x05, 0x99, 0x19, 0x65, 0x66, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xd2, 0x52, 0x94, 0x06, 0x9d, 0x1d, 0xfa, 0x7a, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4f, 0x50, 0x93, 0x07, 0x06, 0x07,
+  0xf1, 0x71, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x63, 0x64,
+  0x0a, 0x0b, 0x92, 0x07, 0x06, 0x07, 0xd9, 0x59, 0xfe, 0x7e, 0x7e, 0x7f,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xa4, 0x24, 0x8b, 0x0b, 0x93, 0x06, 0xae, 0x2e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0x6f, 0x70, 0x19, 0x1a, 0x00, 0x01,
+  0x93, 0x05, 0x0c, 0x0d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x6e, 0x6f,
+  0x10, 0x11, 0x95, 0x04, 0xcb, 0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x28, 0x29, 0x96, 0x03, 0x73, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0x68, 0x69,
+  0x96, 0x04, 0xc7, 0x47, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xaa, 0x2a,
+  0x95, 0x05, 0x86, 0x06, 0xe9, 0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x90, 0x10, 0x95, 0x0c, 0x46, 0x47, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x36, 0x37, 0x99, 0x19, 0xac, 0x2c, 0xac, 0x2c, 0xac, 0x2c,
+  0xac, 0x2c, 0xac, 0x2c, 0x97, 0x17, 0x8d, 0x0d, 0x0c, 0x0d, 0x7a, 0x7b,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfa, 0x7a,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a,
+  0x8d, 0x0d, 0x4b, 0x4c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x76, 0x77, 0x9e, 0x1e, 0x8d, 0x0c, 0x68, 0x69, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x77, 0x78, 0x46, 0x47, 0x50, 0x51, 0xd8, 0x58,
+  0xc9, 0x49, 0xb6, 0x36, 0x57, 0x58, 0x33, 0x34, 0x95, 0x15, 0x8e, 0x04,
+  0x8d, 0x0d, 0xeb, 0x6b, 0xfe, 0x7e, 0x63, 0x64, 0x22, 0x23, 0xfe, 0x00,
+  0x00, 0x00, 0xf3, 0x0d, 0x01, 0x02, 0x07, 0x08, 0x1c, 0x1d, 0xa9, 0x29,
+  0xb8, 0x38, 0x0d, 0x0e, 0x40, 0x41, 0x4e, 0x4f, 0x7e, 0x7f, 0x4f, 0x50,
+  0x40, 0x41, 0x0e, 0x0f, 0x83, 0x03, 0x80, 0x00, 0x8c, 0x0e, 0x04, 0x05,
+  0xe3, 0x63, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x33, 0x34, 0x8c, 0x0f, 0x3c, 0x3d, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfd, 0x7d, 0xf5, 0x75, 0xf5, 0x75, 0xf5, 0x75,
+  0xf5, 0x75, 0xfc, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd3, 0x53,
+  0x81, 0x01, 0x8b, 0x05, 0x81, 0x01, 0xb4, 0x34, 0x38, 0x39, 0x71, 0x72,
+  0xea, 0x6a, 0x2c, 0x2d, 0x83, 0x05, 0x3b, 0x3c, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x0e, 0x0f, 0x95, 0x05, 0x29, 0x2a, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x0e, 0x0f, 0x95, 0x05, 0x5f, 0x60,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x0e, 0x0f, 0x94, 0x06,
+  0x85, 0x05, 0xe5, 0x65, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x5f, 0x60,
+  0x85, 0x05, 0x93, 0x06, 0x93, 0x13, 0xe0, 0x60, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x4f, 0x50, 0x92, 0x08, 0x04, 0x05, 0xa8, 0x28,
+  0x61, 0x62, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xa4, 0x24, 0x92, 0x0a, 0x15, 0x16, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0xa6, 0x26,
+  0x02, 0x03, 0x90, 0x0b, 0x15, 0x16, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x48, 0x49, 0x93, 0x13, 0x8f, 0x0c, 0x04, 0x05, 0x4c, 0x4d, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x56, 0x57, 0x01, 0x02, 0x8f, 0x0b, 0x04, 0x05,
+  0x25, 0x26, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x77, 0x78,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x37, 0x38, 0x95, 0x06,
+  0x11, 0x12, 0xda, 0x5a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x74, 0x75,
+  0x82, 0x02, 0x95, 0x05, 0xc5, 0x45, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x82, 0x02, 0x94, 0x06, 0x91, 0x11, 0xf3, 0x73, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xca, 0x4a, 0x80, 0x00, 0x8a, 0x0f, 0x85, 0x05,
+  0xda, 0x5a, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0x72, 0x73, 0xe3, 0x63,
+  0x34, 0x35, 0x34, 0x35, 0x34, 0x35, 0xec, 0x6c, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xe7, 0x67, 0x89, 0x09, 0x8b, 0x0e, 0x8c, 0x0c, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe7, 0x67,
+  0x89, 0x09, 0x8c, 0x0d, 0x00, 0x01, 0x2b, 0x2c, 0xe0, 0x60, 0xea, 0x6a,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x0e, 0x0f, 0x8f, 0x0b, 0x81, 0x01,
+  0x01, 0x02, 0xad, 0x2d, 0x4d, 0x4e, 0x50, 0x51, 0xc0, 0x40, 0xd2, 0x52,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x50, 0x51, 0x82, 0x02, 0x80, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0xff, 0x99, 0x04, 0x85, 0x05, 0xf0, 0x70, 0x66, 0x67, 0x6f,
+  0x70, 0x2b, 0x2c, 0x96, 0x04, 0x26, 0x27, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0xcc, 0x4c, 0x91, 0x00, 0x15, 0x16, 0x83, 0x04, 0x26, 0x27, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xcc, 0x4c, 0x90, 0x0a, 0x2f, 0x30, 0xfb,
+  0x7b, 0x78, 0x79, 0x78, 0x79, 0x8a, 0x0a, 0x00, 0x00, 0x15, 0x16, 0x76,
+  0x77, 0xfe, 0x7e, 0x7d, 0x7e, 0xcc, 0x4c, 0x90, 0x0a, 0xd5, 0x55, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x8a, 0x0a, 0x00, 0x00, 0x9e, 0x1e, 0xfa,
+  0x7a, 0xfe, 0x7e, 0x7d, 0x7e, 0xcc, 0x4c, 0x8f, 0x05, 0x9a, 0x1a, 0xf9,
+  0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0xee, 0x6e, 0x06, 0x07, 0x81, 0x03, 0x6d,
+  0x6e, 0xfe, 0x7e, 0x7d, 0x7e, 0xcc, 0x4c, 0x8e, 0x05, 0x00, 0x01, 0xbd,
+  0x3d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7c, 0x7d, 0x36, 0x37, 0x81, 0x04, 0x84,
+  0x04, 0x6e, 0x6f, 0xfe, 0x7e, 0x7d, 0x7e, 0x49, 0x4a, 0x8e, 0x04, 0x10,
+  0x11, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x82, 0x04, 0xdd,
+  0x5d, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x15, 0x16, 0x8e, 0x04, 0x10,
+  0x11, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x39, 0x3a, 0x82, 0x0a, 0xdd,
+  0x5d, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x24, 0x25, 0x26, 0x27, 0xca,
+  0x4a, 0xdd, 0x5d, 0xdd, 0x5d, 0x53, 0x54, 0x1a, 0x1b, 0x88, 0x04, 0x10,
+  0x11, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x2b, 0x2c, 0x81, 0x0b, 0x09,
+  0x0a, 0x6b, 0x6c, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x76, 0x77, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xf4, 0x74, 0xb1, 0x31, 0x89,
+  0x11, 0xd8, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xf2, 0x72, 0xc7, 0x47, 0xc7,
+  0x47, 0x50, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x73, 0x74, 0x7a, 0x7b, 0x7d, 0x7e, 0x6d, 0x6e, 0x9c,
+  0x1c, 0x89, 0x0f, 0x57, 0x58, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xde, 0x5e, 0xa0, 0x20, 0x1d, 0x1e, 0xa4, 0x24, 0x8b,
+  0x0c, 0x1d, 0x1e, 0xf5, 0x75, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xbf,
+  0x3f, 0x00, 0x01, 0x8f, 0x0a, 0x19, 0x1a, 0x70, 0x71, 0x72, 0x73, 0x72,
+  0x73, 0xd8, 0x58, 0xbe, 0x3e, 0x6f, 0x70, 0x7d, 0x7e, 0xfe, 0x7e, 0xfb,
+  0x7b, 0x13, 0x14, 0x95, 0x04, 0x96, 0x16, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x5c, 0x5d, 0x96, 0x04, 0x96, 0x16, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x44, 0x45, 0x96, 0x04, 0x95, 0x15, 0xfc, 0x7c, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x5c, 0x5d, 0x97, 0x04, 0x53, 0x54, 0x7d, 0x7e, 0xfe, 0x7e, 0xf1,
+  0x71, 0x16, 0x17, 0x96, 0x05, 0x26, 0x27, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d,
+  0x7e, 0xf1, 0x71, 0x03, 0x04, 0x95, 0x05, 0x04, 0x05, 0x6f, 0x70, 0xfe,
+  0x7e, 0x65, 0x66, 0xe8, 0x68, 0x02, 0x03, 0xdb, 0x00, 0x00, 0xff, 0x91,
+  0x10, 0x00, 0x01, 0x82, 0x02, 0x81, 0x01, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x42, 0x43, 0xc2, 0x42, 0xc2, 0x42, 0xc2,
+  0x42, 0x50, 0x51, 0x7e, 0x7f, 0x6a, 0x6b, 0xc2, 0x42, 0x08, 0x09, 0x8a,
+  0x11, 0xaf, 0x2f, 0xda, 0x5a, 0xd5, 0x55, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x4c, 0x4d, 0x00,
+  0x01, 0x89, 0x11, 0x1a, 0x1b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x85, 0x05, 0x89, 0x11, 0xce, 0x4e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0xe6, 0x66, 0xe6, 0x66, 0xee, 0x6e, 0xe9,
+  0x69, 0x4b, 0x4c, 0x01, 0x02, 0x89, 0x0b, 0xce, 0x4e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf4, 0x74, 0xe0, 0x60, 0xe0, 0x60, 0xe0, 0x60, 0xe0,
+  0x60, 0xe0, 0x60, 0x3a, 0x3b, 0x1c, 0x1d, 0x81, 0x01, 0x0b, 0x0c, 0x04,
+  0x05, 0x8a, 0x05, 0x83, 0x03, 0xdc, 0x5c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x25, 0x26, 0x95, 0x05, 0xa0, 0x20, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xcc, 0x4c, 0x84, 0x04, 0x82, 0x03, 0x2a, 0x2b, 0x96, 0x16, 0xaa,
+  0x2a, 0x8e, 0x0e, 0x8d, 0x10, 0x82, 0x02, 0xdd, 0x5d, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xc2, 0x42, 0x30, 0x31, 0x30, 0x31, 0xe7, 0x67, 0x6c,
+  0x6d, 0x7e, 0x7f, 0x75, 0x76, 0xfe, 0x7e, 0x72, 0x73, 0x6c, 0x6d, 0x3e,
+  0x3f, 0x89, 0x09, 0x8a, 0x10, 0x86, 0x06, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x31, 0x32, 0x8a, 0x12, 0x86, 0x06, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x7c, 0x7d, 0x44, 0x45, 0x05, 0x06, 0x88, 0x09, 0x86, 0x06, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7c, 0x7d, 0x78,
+  0x79, 0x5e, 0x5f, 0x3c, 0x3d, 0x82, 0x05, 0x28, 0x29, 0xec, 0x6c, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x0b, 0x0c, 0x88, 0x06, 0x86, 0x06, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7a, 0x7b, 0x4b, 0x4c, 0x86,
+  0x04, 0x5a, 0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xae, 0x2e, 0x88,
+  0x05, 0x82, 0x02, 0x35, 0x36, 0x6e, 0x6f, 0xfe, 0x7e, 0xfa, 0x7a, 0xb0,
+  0x30, 0x87, 0x04, 0x5a, 0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x47,
+  0x48, 0x8a, 0x02, 0x86, 0x06, 0x29, 0x2a, 0x1f, 0x20, 0x88, 0x04, 0x4e,
+  0x4f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x1f, 0x20, 0x95, 0x05, 0x1f,
+  0x20, 0xe3, 0x63, 0xfe, 0x7e, 0xfe, 0x7e, 0x5b, 0x5c, 0x83, 0x03, 0x8c,
+  0x05, 0x9a, 0x1a, 0xa4, 0x24, 0xd5, 0x55, 0xc9, 0x49, 0xa4, 0x24, 0x01,
+  0x02, 0x81, 0x05, 0x9f, 0x1f, 0x74, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x4d, 0x4e, 0x8c, 0x0e, 0x44, 0x45, 0x77, 0x78, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x67, 0x68, 0xe7, 0x67, 0x49, 0x4a, 0xf5,
+  0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x1c, 0x1d, 0x8c,
+  0x0e, 0x0b, 0x0c, 0xa0, 0x20, 0xe5, 0x65, 0xde, 0x5e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xee, 0x6e, 0x0a, 0x0b, 0x8e, 0x0b, 0x05, 0x06, 0x03,
+  0x04, 0x22, 0x23, 0xf9, 0x79, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x9d, 0x1d, 0x92, 0x08, 0x04,
+  0x05, 0x3f, 0x40, 0x61, 0x62, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x52,
+  0x53, 0x13, 0x14, 0x81, 0x01, 0xda, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x05,
+  0x1c, 0x1d, 0x42, 0x43, 0xaa, 0x2a, 0x69, 0x6a, 0x71, 0x72, 0x13, 0x14,
+  0x94, 0x06, 0x86, 0x06, 0x3f, 0x40, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0xd8, 0x58, 0x94, 0x06, 0x54, 0x55, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x78, 0x79, 0xaa, 0x2a, 0x93, 0x06, 0x8a, 0x0a,
+  0xee, 0x6e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x5e, 0x5f, 0x18, 0x19,
+  0x93, 0x06, 0x89, 0x09, 0xdf, 0x5f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7a, 0x7b, 0x1e, 0x1f, 0x94, 0x05, 0x1a, 0x1b, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7d, 0x7e, 0xa7, 0x27, 0x95, 0x04, 0x9c, 0x1c, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7a, 0x7b, 0x95, 0x05, 0x01, 0x02, 0x59, 0x5a,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x1f, 0x20, 0x95, 0x05, 0x1b, 0x1c,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xdd, 0x5d, 0x01, 0x02, 0x95, 0x04,
+  0x4c, 0x4d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xc9, 0x49, 0x96, 0x10,
+  0x4c, 0x4d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xbe, 0x3e, 0x26, 0x27,
+  0xac, 0x2c, 0x3c, 0x3d, 0x26, 0x27, 0x26, 0x27, 0x3c, 0x3d, 0x45, 0x46,
+  0x2a, 0x2b, 0x5a, 0x5b, 0x26, 0x27, 0x26, 0x27, 0x07, 0x08, 0x89, 0x12,
+  0x83, 0x03, 0x5f, 0x60, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0x7e, 0x7f, 0xff, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x6e, 0x6f,
+  0x0e, 0x0f, 0x88, 0x13, 0x08, 0x09, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x5d, 0x5e, 0x03, 0x04, 0x87, 0x13, 0x08, 0x09,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfc, 0x7c,
+  0xf9, 0x79, 0xd3, 0x53, 0x3d, 0x3e, 0x2b, 0x2c, 0x18, 0x19, 0x3d, 0x3e,
+  0xa2, 0x22, 0xe6, 0x66, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x88, 0x08, 0x87, 0x06, 0x07, 0x08, 0xf9, 0x79, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xc0, 0x40, 0x84, 0x07, 0x06, 0x07, 0x94, 0x14,
+  0xff, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf9, 0x79, 0x87, 0x07,
+  0x88, 0x05, 0x4c, 0x4d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xc0, 0x40, 0x82, 0x08, 0x87, 0x07, 0x17, 0x18, 0xe1, 0x61, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x25, 0x26, 0x89, 0x11,
+  0xbe, 0x3e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xec, 0x6c,
+  0x20, 0x21, 0x20, 0x21, 0x2e, 0x2f, 0x66, 0x67, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x76, 0x77, 0xaf, 0x2f, 0x04, 0x05,
+  0x89, 0x0f, 0x03, 0x04, 0xde, 0x5e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x63, 0x64, 0x23, 0x24, 0x8c, 0x0d,
+  0x98, 0x18, 0xcc, 0x4c, 0xcc, 0x4c, 0xf9, 0x79, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x64, 0x65,
+  0xc5, 0x45, 0x05, 0x06, 0x90, 0x08, 0x39, 0x3a, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x4c, 0x4d, 0xa9, 0x29, 0x84, 0x04,
+  0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc5, 0x05, 0x1c, 0x1d, 0x7b,
+  0x7c, 0x7e, 0x7f, 0x7e, 0x7f, 0xed, 0x6d, 0x0f, 0x10, 0x86, 0x04, 0xb3,
+  0x33, 0xbc, 0x3c, 0xbc, 0x3c, 0xbc, 0x3c, 0xb6, 0x36, 0x89, 0x08, 0x22,
+  0x23, 0x7b, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0xca,
+  0x4a, 0x35, 0x36, 0x32, 0x33, 0x81, 0x07, 0xb3, 0x33, 0xf8, 0x78, 0xfd,
+  0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xb2, 0x32, 0x89,
+  0x11, 0xf8, 0x78, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x71, 0x72, 0x4e, 0x4f, 0x76, 0x77, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x70,
+  0x71, 0x89, 0x11, 0x2e, 0x2f, 0xfa, 0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7e, 0x7f, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x77, 0x78, 0x8a, 0x10, 0x71, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xe5,
+  0x65, 0xaf, 0x2f, 0xa1, 0x21, 0x5c, 0x5d, 0x6e, 0x6f, 0xdd, 0x5d, 0x5c,
+  0x5d, 0x20, 0x21, 0x9a, 0x1a, 0x69, 0x6a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x77, 0x78, 0x8a, 0x03, 0xb6, 0x36, 0xfa, 0x7a, 0xfe, 0x7e, 0x20,
+  0x21, 0x82, 0x00, 0x91, 0x11, 0x82, 0x05, 0x1d, 0x1e, 0x77, 0x78, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe9, 0x69, 0x8b, 0x02, 0x36, 0x37, 0xea,
+  0x6a, 0x1b, 0x1c, 0x86, 0x05, 0xa8, 0x28, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xb5, 0x35, 0x95, 0x05, 0xd2, 0x52, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x75, 0x76, 0x93, 0x13, 0x95, 0x04, 0x6a, 0x6b, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x70, 0x71, 0x96, 0x04, 0x6a, 0x6b, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x70, 0x71, 0x96, 0x04, 0xeb, 0x6b, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xff, 0x7f, 0x71, 0x72, 0x95, 0x05, 0x13, 0x14, 0xf3,
+  0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x54, 0x55, 0x95, 0x05, 0xc7,
+  0x47, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xae, 0x2e, 0x95,
+  0x05, 0x71, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x77, 0x78, 0x1f,
+  0x20, 0x95, 0x04, 0x71, 0x72, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd8,
+  0x58, 0x95, 0x05, 0x27, 0x28, 0xfb, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x27, 0x28, 0x95, 0x05, 0x35, 0x36, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x27, 0x28, 0x95, 0x05, 0x35, 0x36, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfb, 0x7b, 0xa3, 0x23, 0x95, 0x04, 0x32, 0x33, 0x7d,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x5f, 0x60, 0x97, 0x03, 0x35, 0x36, 0xf4,
+  0x74, 0x6c, 0x6d, 0x8f, 0x0f, 0xa5, 0x00, 0x00, 0x00, 0x00, 0xff, 0x94,
+  0x0b, 0x80, 0x00, 0x83, 0x03, 0x8f, 0x0f, 0xc1, 0x41, 0xc1, 0x41, 0xc1,
+  0x41, 0xc1, 0x41, 0x2d, 0x2e, 0x18, 0x19, 0x76, 0x77, 0xe7, 0x67, 0xa6,
+  0x26, 0x8d, 0x0d, 0x00, 0x01, 0x86, 0x06, 0x36, 0x37, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7c, 0x7d, 0xc6, 0x46, 0x8c, 0x0d, 0x85, 0x05, 0x33,
+  0x34, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7c,
+  0x7d, 0x7c, 0x7d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xc8,
+  0x48, 0x8d, 0x0d, 0xc7, 0x47, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xf6, 0x76, 0xb8, 0x38, 0x41, 0x42, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xfa, 0x7a, 0x0d, 0x0e, 0x8d, 0x0c, 0xc7, 0x47, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfc, 0x7c, 0xc4, 0x44, 0x8e, 0x0e, 0x03,
+  0x04, 0xe4, 0x64, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xaa, 0x2a, 0x8e,
+  0x04, 0xc7, 0x47, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xe9, 0x69, 0x81,
+  0x05, 0x9f, 0x1f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xe3, 0x63, 0x06,
+  0x07, 0x8e, 0x0b, 0x1c, 0x1d, 0x75, 0x76, 0x7e, 0x7f, 0x7e, 0x7f, 0x77,
+  0x78, 0x47, 0x48, 0x86, 0x06, 0x9f, 0x1f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xd3, 0x53, 0x90, 0x0a, 0xa0, 0x20, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x54, 0x55, 0xb2, 0x32, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x28, 0x29, 0x90, 0x0a, 0x03, 0x04, 0x2f, 0x30, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x95, 0x15, 0x91, 0x09, 0x84, 0x04, 0xc9, 0x49, 0xe5, 0x65, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x24,
+  0x25, 0x93, 0x08, 0x85, 0x05, 0x60, 0x61, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf4, 0x74, 0x1e, 0x1f, 0x92, 0x09, 0x91,
+  0x11, 0xf6, 0x76, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x74, 0x75, 0x9e, 0x1e, 0x91, 0x0a, 0x15, 0x16, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xeb, 0x6b, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xf5, 0x75, 0x1d, 0x1e, 0x90, 0x0b, 0x15, 0x16, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf3, 0x73, 0x98, 0x18, 0xb7, 0x37, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf6, 0x76, 0x87, 0x07, 0x8f, 0x0b, 0x15,
+  0x16, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x27, 0x28, 0x00, 0x00, 0x05,
+  0x06, 0x55, 0x56, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x08, 0x09, 0x8f,
+  0x0b, 0x15, 0x16, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x73, 0x74, 0x98,
+  0x18, 0x00, 0x00, 0x2b, 0x2c, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x3f,
+  0x40, 0x8f, 0x0b, 0x82, 0x02, 0x5a, 0x5b, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x75, 0x76, 0xdf, 0x5f, 0x6c, 0x6d, 0x7e, 0x7f, 0x7e, 0x7f, 0xff,
+  0x7f, 0x0e, 0x0f, 0x90, 0x0a, 0x92, 0x12, 0x6e, 0x6f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x08, 0x09, 0x91, 0x09, 0x03, 0x04, 0xa3, 0x23, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xcc, 0x4c, 0x80,
+  0x00, 0x92, 0x07, 0x00, 0x01, 0x93, 0x13, 0x40, 0x41, 0xf3, 0x73, 0x7e,
+  0x7f, 0xc9, 0x49, 0x40, 0x41, 0x87, 0x07, 0xda, 0x00, 0x00, 0xff, 0xb2,
+  0x07, 0x02, 0x03, 0x39, 0x3a, 0xdf, 0x5f, 0xff, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x2c, 0x2d, 0x0c, 0x0d, 0x92, 0x08, 0x03, 0x04, 0xde, 0x5e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe2,
+  0x62, 0x90, 0x0a, 0x0a, 0x0b, 0x5c, 0x5d, 0xd1, 0x51, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xe8, 0x68, 0xc5, 0x45, 0x15, 0x16, 0x42, 0x43, 0xe6, 0x66, 0xe2,
+  0x62, 0x90, 0x05, 0xd0, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x75,
+  0x76, 0x10, 0x11, 0x81, 0x02, 0x89, 0x09, 0x83, 0x03, 0x03, 0x04, 0x90,
+  0x0a, 0xd2, 0x52, 0x7d, 0x7e, 0x7d, 0x7e, 0xef, 0x6f, 0x8b, 0x0b, 0x00,
+  0x00, 0x03, 0x04, 0x41, 0x42, 0xf6, 0x76, 0xd4, 0x54, 0x28, 0x29, 0x90,
+  0x03, 0xd2, 0x52, 0x7d, 0x7e, 0x7d, 0x7e, 0x67, 0x68, 0x81, 0x05, 0x23,
+  0x24, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xee, 0x6e, 0x0b, 0x0c, 0x8f,
+  0x0a, 0x4f, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfc, 0x7c, 0x32, 0x33, 0xd4,
+  0x54, 0x79, 0x7a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x90,
+  0x0a, 0x16, 0x17, 0xf9, 0x79, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x91,
+  0x09, 0x19, 0x1a, 0xe5, 0x65, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x92, 0x08, 0xa2,
+  0x22, 0x46, 0x47, 0x46, 0x47, 0xaf, 0x2f, 0x1e, 0x1f, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x96, 0x04, 0x10, 0x11, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x62, 0x63, 0x96, 0x04, 0x10, 0x11, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x96, 0x04, 0x10, 0x11, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x96, 0x04, 0x07, 0x08, 0x69, 0x6a, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xe2, 0x62, 0x97, 0x03, 0x57, 0x58, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xe2, 0x62, 0x97, 0x04, 0x44, 0x45, 0x7d, 0x7e, 0x7d, 0x7e, 0x77,
+  0x78, 0x95, 0x15, 0x96, 0x04, 0xa1, 0x21, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x9b, 0x1b, 0x96, 0x04, 0xa1, 0x21, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xb3, 0x33, 0x96, 0x04, 0x08, 0x09, 0x6d, 0x6e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x9b, 0x1b, 0x97, 0x03, 0xe8, 0x68, 0x7d, 0x7e, 0x7d, 0x7e, 0x9b,
+  0x1b, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0x98, 0x04, 0x26, 0x27, 0xfe,
+  0x7e, 0x7e, 0x7f, 0x57, 0x58, 0x8c, 0x0c, 0x96, 0x04, 0x26, 0x27, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x15, 0x16, 0x96, 0x04, 0x26, 0x27, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x15, 0x16, 0x96, 0x04, 0xdb, 0x5b, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x15, 0x16, 0x96, 0x04, 0xdd, 0x5d, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x15, 0x16, 0x96, 0x04, 0xdd, 0x5d, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x15, 0x16, 0x95, 0x05, 0x00, 0x01, 0x5e,
+  0x5f, 0x7d, 0x7e, 0xfe, 0x7e, 0x5f, 0x60, 0x01, 0x02, 0x95, 0x04, 0x96,
+  0x16, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x96, 0x04, 0x96,
+  0x16, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x96, 0x04, 0x96,
+  0x16, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x44, 0x45, 0x96, 0x04, 0x9d,
+  0x1d, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xad, 0x2d, 0x96, 0x04, 0x26,
+  0x27, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x96, 0x04, 0x96,
+  0x16, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x96, 0x04, 0x96,
+  0x16, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x96, 0x04, 0x91,
+  0x11, 0x76, 0x77, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x97, 0x03, 0xdd,
+  0x5d, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x97, 0x03, 0xdd, 0x5d, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x97, 0x03, 0xdd, 0x5d, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x5c, 0x5d, 0x97, 0x03, 0xdd, 0x5d, 0x7d, 0x7e, 0xfe, 0x7e, 0x5c,
+  0x5d, 0x97, 0x03, 0x1c, 0x1d, 0x76, 0x77, 0xfe, 0x7e, 0x44, 0x45, 0xde,
+  0x00, 0x00, 0xdf, 0x03, 0x38, 0x39, 0x7b, 0x7c, 0xcf, 0x4f, 0x9c, 0x1c,
+  0x96, 0x04, 0x95, 0x15, 0x76, 0x77, 0x7e, 0x7f, 0x7e, 0x7f, 0x66, 0x67,
+  0x96, 0x04, 0x4e, 0x4f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xb2, 0x32,
+  0x95, 0x05, 0x92, 0x12, 0x70, 0x71, 0x7e, 0x7f, 0x7e, 0x7f, 0x75, 0x76,
+  0x85, 0x05, 0x95, 0x04, 0xc0, 0x40, 0x7e, 0x7f, 0x7e, 0x7f, 0xfe, 0x7e,
+  0x29, 0x2a, 0x95, 0x04, 0x09, 0x0a, 0x72, 0x73, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xf5, 0x75, 0x96, 0x04, 0xb9, 0x39, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xbd, 0x3d, 0x96, 0x04, 0xd0, 0x50, 0x7e, 0x7f, 0x7e, 0x7f, 0x72, 0x73,
+  0x0b, 0x0c, 0x96, 0x03, 0xfd, 0x7d, 0x7e, 0x7f, 0x7e, 0x7f, 0xe4, 0x64,
+  0x82, 0x02, 0x11, 0x12, 0xa9, 0x29, 0xa2, 0x22, 0x91, 0x03, 0xfd, 0x7d,
+  0x7e, 0x7f, 0x7e, 0x7f, 0xb7, 0x37, 0x81, 0x06, 0xbb, 0x3b, 0xfb, 0x7b,
+  0x7e, 0x7f, 0x7d, 0x7e, 0xe4, 0x64, 0x3a, 0x3b, 0x8b, 0x0b, 0x8d, 0x0e,
+  0xa5, 0x25, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x34, 0x35, 0x00, 0x01,
+  0x16, 0x17, 0xfb, 0x7b, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x63, 0x64, 0x01, 0x02, 0x8c, 0x0e, 0x2d, 0x2e, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x34, 0x35, 0xb9, 0x39, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0xf3, 0x73, 0xd8, 0x58, 0xf7, 0x77, 0x7e, 0x7f, 0x7e, 0x7f,
+  0xbd, 0x3d, 0x8c, 0x0e, 0x2d, 0x2e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x4c, 0x4d, 0xfd, 0x7d, 0x7e, 0x7f, 0x7e, 0x7f, 0x7d, 0x7e, 0xa5, 0x25,
+  0x03, 0x04, 0xe9, 0x69, 0x7e, 0x7f, 0x7e, 0x7f, 0xf9, 0x79, 0x8c, 0x0e,
+  0xac, 0x2c, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x62, 0x63, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x4f, 0x50, 0x00, 0x00, 0x17, 0x18, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7c, 0x7d, 0x8d, 0x0d, 0xfd, 0x7d, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x17, 0x18,
+  0x00, 0x00, 0xd3, 0x53, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x5c, 0x5d,
+  0x8d, 0x0d, 0xe3, 0x63, 0xff, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0xe9, 0x69, 0x83, 0x03, 0xc2, 0x42, 0xfe, 0x7e, 0x7e, 0x7f,
+  0x7e, 0x7f, 0xfc, 0x7c, 0x1c, 0x1d, 0x8d, 0x0c, 0x4b, 0x4c, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf0, 0x70, 0xdb, 0x5b,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfe, 0x7e, 0xd7, 0x57, 0x8e, 0x0b,
+  0x8a, 0x0a, 0xe6, 0x66, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7d, 0x7e, 0x42, 0x43,
+  0x90, 0x09, 0x9d, 0x1d, 0x60, 0x61, 0xfe, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x75, 0x76, 0x33, 0x34, 0x93, 0x06,
+  0x27, 0x28, 0x4e, 0x4f, 0x4e, 0x4f, 0xfc, 0x7c, 0x7e, 0x7f, 0xcf, 0x4f,
+  0x0d, 0x0e, 0xff, 0x94, 0x00, 0x00, 0xff, 0x95, 0x02, 0x81, 0x01, 0x17,
+  0x18, 0x03, 0x04, 0x81, 0x04, 0xb5, 0x35, 0x72, 0x73, 0x63, 0x64, 0xa6,
+  0x26, 0x0b, 0x0c, 0x8f, 0x0c, 0x04, 0x05, 0xaf, 0x2f, 0xde, 0x5e, 0x7e,
+  0x7f, 0xe6, 0x66, 0xa5, 0x25, 0x92, 0x12, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x6c, 0x6d, 0x8f, 0x0f, 0x8d, 0x0d, 0x1e, 0x1f, 0x76,
+  0x77, 0xff, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xf7, 0x77, 0x4b, 0x4c, 0x58,
+  0x59, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xa9,
+  0x29, 0x8c, 0x0e, 0x1e, 0x1f, 0xf6, 0x76, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x56, 0x57, 0x93, 0x13, 0x0a, 0x0b, 0xce, 0x4e, 0xfe, 0x7e, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xa9, 0x29, 0x8c, 0x05, 0xc6,
+  0x46, 0x7e, 0x7f, 0x7e, 0x7f, 0xec, 0x6c, 0x90, 0x10, 0x83, 0x03, 0x82,
+  0x05, 0xbd, 0x3d, 0xef, 0x6f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xa9,
+  0x29, 0x8c, 0x03, 0xc6, 0x46, 0x7e, 0x7f, 0x7e, 0x7f, 0xda, 0x5a, 0x85,
+  0x04, 0xe0, 0x60, 0x7e, 0x7f, 0x7e, 0x7f, 0x77, 0x78, 0x0c, 0x0d, 0x8c,
+  0x04, 0x97, 0x17, 0x7c, 0x7d, 0x7e, 0x7f, 0x6b, 0x6c, 0x0d, 0x0e, 0x83,
+  0x04, 0x81, 0x01, 0xe2, 0x62, 0x7e, 0x7f, 0x7e, 0x7f, 0x74, 0x75, 0x8e,
+  0x05, 0x31, 0x32, 0x6f, 0x70, 0x7e, 0x7f, 0xfc, 0x7c, 0xb1, 0x31, 0x85,
+  0x05, 0x81, 0x04, 0x21, 0x22, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x67,
+  0x68, 0x8f, 0x0b, 0x0f, 0x10, 0x6c, 0x6d, 0x7e, 0x7f, 0x7e, 0x7f, 0x6d,
+  0x6e, 0xca, 0x4a, 0x36, 0x37, 0xf5, 0x75, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x3f, 0x40, 0x91, 0x09, 0xae, 0x2e, 0x64, 0x65, 0x7a, 0x7b, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x66, 0x67, 0x04,
+  0x05, 0x93, 0x06, 0x40, 0x41, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x57, 0x58, 0x94, 0x08, 0xbf, 0x3f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfe, 0x7e, 0x5e, 0x5f, 0x8f,
+  0x0f, 0x91, 0x0a, 0x9d, 0x1d, 0x71, 0x72, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xcb, 0x4b, 0x51, 0x52, 0x7e, 0x7f, 0x7e, 0x7f, 0x76, 0x77, 0x8d,
+  0x0d, 0x8f, 0x0b, 0x84, 0x04, 0xea, 0x6a, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xe7, 0x67, 0x8e, 0x0e, 0x8a, 0x0a, 0x6b, 0x6c, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x11, 0x12, 0x8f, 0x0b, 0xd2, 0x52, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x6f, 0x70, 0x81, 0x01, 0x00, 0x00, 0x9b, 0x1b, 0x74, 0x75, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xb7, 0x37, 0x8f, 0x0b, 0x6f, 0x70, 0x7e, 0x7f, 0x7e,
+  0x7f, 0xf2, 0x72, 0x92, 0x12, 0x00, 0x00, 0x07, 0x08, 0x5d, 0x5e, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xc1, 0x41, 0x8f, 0x0b, 0x61, 0x62, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x6b, 0x6c, 0x06, 0x07, 0xa1, 0x21, 0xe8, 0x68, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x11, 0x12, 0x8f, 0x0b, 0x0b,
+  0x0c, 0xeb, 0x6b, 0x7e, 0x7f, 0x7e, 0x7f, 0x70, 0x71, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xfa, 0x7a, 0x22, 0x23, 0x82, 0x02, 0x90,
+  0x08, 0x9e, 0x1e, 0xe6, 0x66, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
+  0x7f, 0x7e, 0x7f, 0xf6, 0x76, 0x44, 0x45, 0x93, 0x06, 0x09, 0x0a, 0x21,
+  0x22, 0x4a, 0x4b, 0xfe, 0x7e, 0xd7, 0x57, 0xaf, 0x2f, 0x0f, 0x10, 0xdc,
+  0x00, 0x00, 0xff, 0xb1, 0x06, 0x03, 0x04, 0x3c, 0x3d, 0x7a, 0x7b, 0xff,
+  0x7f, 0xeb, 0x6b, 0xad, 0x2d, 0x86, 0x06, 0x93, 0x07, 0x01, 0x02, 0x4d,
+  0x4e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x51,
+  0x52, 0x93, 0x08, 0x1e, 0x1f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x7a, 0x7b, 0x43, 0x44, 0x91, 0x09, 0x06,
+  0x07, 0x73, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xf9, 0x79, 0x29, 0x2a, 0x90, 0x0a, 0x06, 0x07, 0xdb,
+  0x5b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xea, 0x6a, 0x6f, 0x70, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xce, 0x4e, 0x11, 0x12, 0x90, 0x0c, 0x15, 0x16, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xea, 0x6a, 0x92, 0x12, 0x79, 0x7a, 0xfe,
+  0x7e, 0x7b, 0x7c, 0xba, 0x3a, 0xbe, 0x3e, 0x1e, 0x1f, 0x01, 0x02, 0x8e,
+  0x0d, 0xb7, 0x37, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x31, 0x32, 0x83,
+  0x03, 0xb0, 0x30, 0xc3, 0x43, 0x31, 0x32, 0xa8, 0x28, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xdd, 0x5d, 0x17, 0x18, 0x8d, 0x04, 0xcb, 0x4b, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x6b, 0x6c, 0x06, 0x07, 0x83, 0x04, 0x53, 0x54, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x4a, 0x4b, 0x8d, 0x03, 0x47, 0x48, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xcb, 0x4b, 0x82, 0x06, 0xb1, 0x31, 0x42, 0x43, 0x7a, 0x7b, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xc7, 0x47, 0x8d, 0x0d, 0x15, 0x16, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x57, 0x58, 0x9b, 0x1b, 0x9b, 0x1b, 0x3d, 0x3e, 0x74,
+  0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x95,
+  0x15, 0x8d, 0x0d, 0x04, 0x05, 0xd1, 0x51, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x72, 0x73, 0x8d, 0x0d, 0x8e, 0x0b, 0x82, 0x02, 0x3a,
+  0x3b, 0x75, 0x76, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x75, 0x76, 0x61,
+  0x62, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xd9, 0x59, 0x91, 0x09, 0x88,
+  0x08, 0x2a, 0x2b, 0x2a, 0x2b, 0x2a, 0x2b, 0x08, 0x09, 0x40, 0x41, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa8, 0x28, 0x96, 0x04, 0x40, 0x41, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa8, 0x28, 0x96, 0x04, 0x40, 0x41, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa8, 0x28, 0x96, 0x04, 0x40, 0x41, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa8, 0x28, 0x96, 0x04, 0x40, 0x41, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xa8, 0x28, 0x96, 0x04, 0x40, 0x41, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x76, 0x77, 0x11, 0x12, 0x96, 0x03, 0xb2, 0x32, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x70, 0x71, 0x97, 0x03, 0x01, 0x02, 0x42, 0x43, 0xfe,
+  0x7e, 0x42, 0x43, 0xc0, 0x00, 0x00, 0xff, 0xb2, 0x05, 0x04, 0x05, 0xb8,
+  0x38, 0xff, 0x7f, 0x7e, 0x7f, 0x68, 0x69, 0x8a, 0x0a, 0x94, 0x07, 0xae,
+  0x2e, 0x68, 0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe8,
+  0x68, 0x09, 0x0a, 0x92, 0x08, 0x30, 0x31, 0x7c, 0x7d, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x49, 0x4a, 0x91,
+  0x09, 0x31, 0x32, 0x7a, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6,
+  0x76, 0x65, 0x66, 0xfe, 0x7e, 0xfe, 0x7e, 0x5c, 0x5d, 0x90, 0x0c, 0x8c,
+  0x0c, 0xef, 0x6f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x58, 0x59, 0x11,
+  0x12, 0x26, 0x27, 0xfe, 0x7e, 0xfe, 0x7e, 0xfd, 0x7d, 0x44, 0x45, 0x8f,
+  0x0f, 0x8e, 0x0d, 0x57, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x3f,
+  0x40, 0x85, 0x05, 0x00, 0x00, 0xbf, 0x3f, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xea, 0x6a, 0x0e, 0x0f, 0x8d, 0x04, 0xde, 0x5e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x7c, 0x7d, 0x9c, 0x1c, 0x81, 0x06, 0x5f, 0x60, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x59, 0x5a, 0x8d,
+  0x03, 0xde, 0x5e, 0xfe, 0x7e, 0xfe, 0x7e, 0xda, 0x5a, 0x82, 0x06, 0x9a,
+  0x1a, 0x74, 0x75, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfc, 0x7c, 0x1f,
+  0x20, 0x8d, 0x0c, 0xde, 0x5e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe6, 0x66, 0x14,
+  0x15, 0x14, 0x15, 0x22, 0x23, 0x73, 0x74, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x8e, 0x0c, 0xad, 0x2d, 0xf9, 0x79, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x8f, 0x0b, 0xba,
+  0x3a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x8f,
+  0x0b, 0x87, 0x07, 0xad, 0x2d, 0xe6, 0x66, 0x63, 0x64, 0x4e, 0x4f, 0x4e,
+  0x4f, 0x4e, 0x4f, 0x4e, 0x4f, 0xfa, 0x7a, 0xfe, 0x7e, 0xfe, 0x7e, 0x66,
+  0x67, 0x91, 0x01, 0x05, 0x06, 0x04, 0x05, 0x83, 0x03, 0xf3, 0x73, 0xfe,
+  0x7e, 0xfe, 0x7e, 0x66, 0x67, 0x97, 0x03, 0xf3, 0x73, 0xfe, 0x7e, 0xfe,
+  0x7e, 0x66, 0x67, 0x97, 0x03, 0xec, 0x6c, 0xfe, 0x7e, 0xfe, 0x7e, 0x66,
+  0x67, 0x97, 0x04, 0xb8, 0x38, 0xfe, 0x7e, 0xfe, 0x7e, 0xf6, 0x76, 0x16,
+  0x17, 0x96, 0x04, 0xb8, 0x38, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x22,
+  0x23, 0x96, 0x04, 0x25, 0x26, 0x7d, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x22,
+  0x23, 0x97, 0x03, 0xfc, 0x7c, 0xfe, 0x7e, 0xfe, 0x7e, 0x22, 0x23, 0x97,
+  0x03, 0xe0, 0x60, 0xfe, 0x7e, 0xe8, 0x68, 0x82, 0x02, 0xbe, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x94, 0x02, 0x3f, 0x40, 0xff, 0x7f, 0x3f, 0x40, 0x97,
+  0x0a, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x1f, 0x20, 0x8f,
+  0x0c, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x8d, 0x0f, 0x1f, 0x20, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x1f,
+  0x20, 0x8b, 0x10, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x3f, 0x40, 0x3f,
+  0x40, 0x3f, 0x40, 0x3f, 0x40, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x8a, 0x07, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x00, 0x00, 0xdf, 0x5f, 0x1f, 0x20, 0x85, 0x03, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x88, 0x04, 0x1f, 0x20, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x89, 0x03, 0x1f, 0x20, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x88, 0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x8a, 0x03, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x87, 0x04, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f,
+  0x40, 0x8a, 0x03, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x87,
+  0x03, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x8b, 0x03, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x87, 0x03, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x8a, 0x04, 0x3f, 0x40, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x87, 0x03, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x8a, 0x04, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x3f, 0x40, 0x87, 0x03, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x88, 0x06, 0x1f, 0x20, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x1f, 0x20, 0x87, 0x03, 0x1f, 0x20, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0x87, 0x06, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x89, 0x04, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x1f, 0x20, 0x83, 0x07, 0xdf, 0x5f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf,
+  0x5f, 0x8a, 0x0f, 0x1f, 0x20, 0xdf, 0x5f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0x5f, 0x8d,
+  0x0c, 0x3f, 0x40, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff,
+  0x7f, 0x1f, 0x20, 0x8f, 0x09, 0x1f, 0x20, 0x3f, 0x40, 0x3f, 0x40, 0xff,
+  0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0x3f, 0x40, 0x1f,
+  0x20, 0xff, 0x94, 0x00, 0x00, 0x00, 0xfb, 0x02, 0xa6, 0x26, 0xfe, 0x7e,
+  0x42, 0x43, 0x98, 0x04, 0x48, 0x49, 0x7d, 0x7e, 0xfb, 0x7b, 0xdb, 0x5b,
+  0x85, 0x05, 0x96, 0x04, 0x48, 0x49, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x48, 0x49, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x48, 0x49, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x17, 0x18, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x29, 0x2a, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x06, 0x07, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x2d, 0x2e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x48, 0x49, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0xc9, 0x49, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e,
+  0x0c, 0x0d, 0x95, 0x05, 0x0c, 0x0d, 0xfb, 0x7b, 0x7d, 0x7e, 0xfe, 0x7e,
+  0x7d, 0x7e, 0x0c, 0x0d, 0x95, 0x05, 0x8d, 0x0d, 0x7d, 0x7e, 0x7d, 0x7e,
+  0xfe, 0x7e, 0x7d, 0x7e, 0x0c, 0x0d, 0x95, 0x05, 0xc5, 0x45, 0x7d, 0x7e,
+  0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x0c, 0x0d, 0x95, 0x05, 0x4f, 0x50,
+  0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xd3, 0x53, 0x02, 0x03, 0x95, 0x04,
+  0x4f, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xc8, 0x48, 0x96, 0x04,
+  0x4f, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xa5, 0x25, 0x96, 0x05,
+  0x4f, 0x50, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0xea, 0x6a, 0x88, 0x08,
+  0x95, 0x05, 0xa1, 0x21, 0xdb, 0x5b, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0x96, 0x04, 0x06, 0x07, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e,
+  0x0c, 0x0d, 0xfa, 0x00, 0x00, 0x00, 0xdb, 0x06, 0x86, 0x06, 0xe5, 0x65,
+  0xff, 0x7f, 0xff, 0x7f, 0xf4, 0x74, 0xb5, 0x35, 0x82, 0x02, 0x94, 0x08,
+  0x43, 0x44, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xf1, 0x71, 0x16, 0x17, 0x81, 0x01, 0x92, 0x09, 0x08, 0x09, 0x7a, 0x7b,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x43, 0x44, 0x82, 0x02, 0x92, 0x09, 0x24, 0x25, 0x71, 0x72, 0xca, 0x4a,
+  0xb4, 0x34, 0xb4, 0x34, 0x5f, 0x60, 0xfb, 0x7b, 0xfe, 0x7e, 0xd5, 0x55,
+  0x8e, 0x0e, 0x97, 0x04, 0x5c, 0x5d, 0xfe, 0x7e, 0xfe, 0x7e, 0x42, 0x43,
+  0x02, 0x03, 0x95, 0x05, 0x84, 0x04, 0x61, 0x62, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0x9e, 0x1e, 0x94, 0x06, 0x84, 0x04, 0x4a, 0x4b, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x52, 0x53, 0x93, 0x07, 0x84, 0x04,
+  0x4a, 0x4b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x46, 0x47, 0x93, 0x07, 0xc1, 0x41, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xf6, 0x76, 0x30, 0x31, 0x86, 0x06, 0x92, 0x06, 0x1c, 0x1d,
+  0xf3, 0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe5, 0x65, 0x17, 0x18,
+  0x93, 0x06, 0x0b, 0x0c, 0xf3, 0x73, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xe5, 0x65, 0xa5, 0x25, 0x94, 0x05, 0x21, 0x22, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0x21, 0x22, 0x94, 0x06, 0x03, 0x04, 0x5c, 0x5d,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xf5, 0x75, 0x16, 0x17, 0x94, 0x07,
+  0x21, 0x22, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x6b, 0x6c,
+  0x2b, 0x2c, 0x1f, 0x20, 0x93, 0x09, 0xca, 0x4a, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x79, 0x7a, 0xda, 0x5a,
+  0x1f, 0x20, 0x90, 0x0e, 0x88, 0x08, 0xf8, 0x78, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x79, 0x7a, 0xef, 0x6f, 0x3a, 0x3b, 0x31, 0x32, 0x9d, 0x1d, 0x8c, 0x0f,
+  0xa3, 0x23, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xf9, 0x79, 0x21, 0x22, 0x8a, 0x11, 0x05, 0x06,
+  0x7a, 0x7b, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xd5, 0x55, 0xc6, 0x46, 0x56, 0x57, 0xfe, 0x7e, 0xfe, 0x7e,
+  0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xdf, 0x5f, 0x82, 0x02, 0x89, 0x11,
+  0x80, 0x00, 0xc9, 0x49, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e,
+  0x49, 0x4a, 0x05, 0x06, 0x81, 0x01, 0x00, 0x00, 0x01, 0x02, 0x99, 0x19,
+  0x57, 0x58, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xe4, 0x64, 0x02, 0x03,
+  0x8a, 0x05, 0x05, 0x06, 0xc6, 0x46, 0xfe, 0x7e, 0x56, 0x57, 0x17, 0x18,
+  0x00, 0x01, 0x84, 0x04, 0x00, 0x01, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02,
+  0x81, 0x01, 0xff, 0x8f, 0x00, 0x00, 0xff, 0x9b, 0x02, 0x49, 0x4a, 0x6c,
+  0x6d, 0x2d, 0x2e, 0x8f, 0x03, 0x1f, 0x20, 0x5e, 0x5f, 0xd1, 0x51, 0x06,
+  0x07, 0x84, 0x03, 0x49, 0x4a, 0x7d, 0x7e, 0xfb, 0x7b, 0xb1, 0x31, 0x8e,
+  0x04, 0xaa, 0x2a, 0x7d, 0x7e, 0x7d, 0x7e, 0xdf, 0x5f, 0x84, 0x04, 0x83,
+  0x03, 0xe4, 0x64, 0x7d, 0x7e, 0x7d, 0x7e, 0xde, 0x5e, 0x8e, 0x04, 0xaa,
+  0x2a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x34, 0x35, 0x82, 0x04, 0xa3,
+  0x23, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xbb, 0x3b, 0x8e, 0x04, 0xaa,
+  0x2a, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x08, 0x09, 0x82, 0x04, 0x34,
+  0x35, 0xfe, 0x7e, 0x7d, 0x7e, 0xf5, 0x75, 0x06, 0x07, 0x8e, 0x03, 0xaa,
+  0x2a, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0x83, 0x03, 0x69, 0x6a, 0x7e,
+  0x7f, 0xfe, 0x7e, 0x73, 0x74, 0x8f, 0x03, 0xaa, 0x2a, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x83, 0x03, 0xe9, 0x69, 0xfe, 0x7e, 0x7d, 0x7e, 0xf3,
+  0x73, 0x8f, 0x03, 0x5a, 0x5b, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x83,
+  0x03, 0xe9, 0x69, 0xfe, 0x7e, 0x7d, 0x7e, 0x6e, 0x6f, 0x8f, 0x03, 0x5e,
+  0x5f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x82, 0x04, 0x07, 0x08, 0xee,
+  0x6e, 0xfe, 0x7e, 0x7d, 0x7e, 0x3e, 0x3f, 0x8f, 0x03, 0x5e, 0x5f, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x51, 0x52, 0x82, 0x04, 0x1f, 0x20, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x3e, 0x3f, 0x8f, 0x11, 0xd6, 0x56, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xe8, 0x68, 0x95, 0x15, 0x95, 0x15, 0x95, 0x15, 0xc5, 0x45, 0xfe,
+  0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0x63, 0x64, 0x49, 0x4a, 0x49, 0x4a, 0xff,
+  0x7f, 0xfe, 0x7e, 0x75, 0x76, 0x0f, 0x10, 0x89, 0x11, 0xaa, 0x2a, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xde, 0x5e, 0x89, 0x11, 0x95,
+  0x15, 0x59, 0x5a, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x75, 0x76, 0x6e, 0x6f, 0xaf, 0x2f, 0x8a,
+  0x0e, 0x83, 0x03, 0x29, 0x2a, 0x55, 0x56, 0x5e, 0x5f, 0xde, 0x5e, 0x60,
+  0x61, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xfb, 0x7b, 0xde,
+  0x5e, 0xde, 0x5e, 0x29, 0x2a, 0x8a, 0x0a, 0x91, 0x05, 0x01, 0x02, 0x5a,
+  0x5b, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0xb1, 0x31, 0x96, 0x04, 0xb6,
+  0x36, 0xfe, 0x7e, 0xff, 0x7f, 0x65, 0x66, 0x84, 0x04, 0x96, 0x04, 0x1f,
+  0x20, 0x7d, 0x7e, 0xfe, 0x7e, 0x61, 0x62, 0x83, 0x03, 0x96, 0x04, 0x0f,
+  0x10, 0x73, 0x74, 0xfe, 0x7e, 0x7d, 0x7e, 0x8a, 0x0a, 0x97, 0x03, 0xe9,
+  0x69, 0xfe, 0x7e, 0x7d, 0x7e, 0xad, 0x2d, 0x97, 0x04, 0x91, 0x11, 0xe8,
+  0x68, 0x7d, 0x7e, 0x42, 0x43, 0x91, 0x11, 0xdb, 0x00, 0x00, 0xff, 0x91,
+  0x01, 0x87, 0x07, 0x93, 0x13, 0x86, 0x03, 0x8c, 0x0c, 0xf1, 0x71, 0xdf,
+  0x5f, 0x06, 0x07, 0x8e, 0x03, 0x9c, 0x1c, 0x77, 0x78, 0x3b, 0x3c, 0x18,
+  0x19, 0x84, 0x04, 0x26, 0x27, 0x7d, 0x7e, 0x7d, 0x7e, 0x45, 0x46, 0x06,
+  0x07, 0x8e, 0x02, 0x73, 0x74, 0x7d, 0x7e, 0x63, 0x64, 0x84, 0x04, 0x49,
+  0x4a, 0x7d, 0x7e, 0x7d, 0x7e, 0xfb, 0x7b, 0xa9, 0x29, 0x8e, 0x02, 0x73,
+  0x74, 0x7d, 0x7e, 0x70, 0x71, 0x84, 0x03, 0x49, 0x4a, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xde, 0x5e, 0x8e, 0x03, 0xa3, 0x23, 0xfc, 0x7c, 0x7d, 0x7e, 0xc9,
+  0x49, 0x84, 0x03, 0x49, 0x4a, 0x7d, 0x7e, 0x7d, 0x7e, 0xde, 0x5e, 0x8e,
+  0x03, 0xaa, 0x2a, 0xfe, 0x7e, 0xfe, 0x7e, 0xc9, 0x49, 0x84, 0x03, 0x68,
+  0x69, 0xfe, 0x7e, 0xfe, 0x7e, 0x5e, 0x5f, 0x8e, 0x03, 0x51, 0x52, 0x7d,
+  0x7e, 0x7d, 0x7e, 0xc9, 0x49, 0x83, 0x04, 0x11, 0x12, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x36, 0x37, 0x8e, 0x03, 0x5e, 0x5f, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xc9, 0x49, 0x83, 0x04, 0x34, 0x35, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x29, 0x2a, 0x8d, 0x04, 0x8e, 0x0e, 0x73, 0x74, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xc9, 0x49, 0x83, 0x08, 0x34, 0x35, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0x29, 0x2a, 0x00, 0x00, 0x85, 0x05, 0x1f, 0x20, 0x02, 0x03, 0x89,
+  0x04, 0x95, 0x15, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xc9, 0x49, 0x83,
+  0x09, 0x34, 0x35, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x29, 0x2a, 0x96,
+  0x16, 0xd7, 0x57, 0x7d, 0x7e, 0x66, 0x67, 0x91, 0x11, 0x88, 0x12, 0x11,
+  0x12, 0xf9, 0x79, 0xfe, 0x7e, 0xfe, 0x7e, 0xd2, 0x52, 0x95, 0x15, 0x95,
+  0x15, 0x93, 0x13, 0x08, 0x09, 0x3d, 0x3e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe,
+  0x7e, 0xfe, 0x7e, 0xfe, 0x7e, 0xff, 0x7f, 0xfe, 0x7e, 0xfe, 0x7e, 0xc8,
+  0x48, 0x89, 0x11, 0xcd, 0x4d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0xfb, 0x7b, 0x6b, 0x6c, 0x78, 0x79, 0xfe, 0x7e, 0x7d,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xde, 0x5e, 0x89, 0x11, 0x95, 0x15, 0xf0, 0x70, 0x7d, 0x7e, 0x7d,
+  0x7e, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xef, 0x6f, 0x3e,
+  0x3f, 0x3e, 0x3f, 0x99, 0x19, 0x8a, 0x0d, 0x83, 0x03, 0xb7, 0x37, 0xeb,
+  0x6b, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xfe,
+  0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x68, 0x69, 0xb2, 0x32, 0x91, 0x11, 0x8f,
+  0x09, 0x08, 0x09, 0x14, 0x15, 0x14, 0x15, 0x14, 0x15, 0x14, 0x15, 0x56,
+  0x57, 0xfe, 0x7e, 0x7d, 0x7e, 0xf5, 0x75, 0x06, 0x07, 0x96, 0x04, 0x69,
+  0x6a, 0xff, 0x7f, 0xfe, 0x7e, 0x75, 0x76, 0x06, 0x07, 0x96, 0x04, 0xe9,
+  0x69, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x29, 0x2a, 0x96, 0x04, 0x64,
+  0x65, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x43, 0x44, 0x96, 0x04, 0x34,
+  0x35, 0xfe, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0xbb, 0x3b, 0x96, 0x04, 0x08,
+  0x09, 0xe8, 0x68, 0x7d, 0x7e, 0x5e, 0x5f, 0x06, 0x07, 0xdc, 0x00, 0x00,
+};
@@ -0,0 +1,1988 @@
+/***************************************************************************//**
+* \file TEST_MODEL_tflm_x_data_int8x8.c
+*
+* \brief
+* Generated with scripts/ml_regression_convert.py, this file contains input
+* data for the TEST_MODEL model in int8x8 representation (v3 regression container).
+******************************************************************************/
+
+
+#include "TEST_MODEL_tflm_x_data_int8x8.h"
+
+
+const uint8_t TEST_MODEL_x_data_bin[TEST_MODEL_X_DATA_BIN_LEN] __attribute__((aligned(4))) = {
+  0x4d, 0x4c, 0x52, 0x33, 0x03, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0x10, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
+  0x2c, 0x02, 0x00, 0x00, 0x84, 0x5c, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
+  0xa0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0x94, 0x10, 0x00, 0x00, 0x98, 0x0d, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0x2c, 0x1e, 0x00, 0x00, 0xd0, 0x0d, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0xfc, 0x2b, 0x00, 0x00,
+  0x14, 0x0e, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0x10, 0x3a, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x01, 0x00, 0x04, 0x4a, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0x59, 0x00, 0x00,
+  0x7c, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
+  0xf4, 0x02, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00,
+  0x58, 0x05, 0x00, 0x00, 0xec, 0x05, 0x00, 0x00, 0xf4, 0x06, 0x00, 0x00,
+  0xa8, 0x07, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00, 0xc4, 0x09, 0x00, 0x00,
+  0xcc, 0x0a, 0x00, 0x00, 0xb8, 0x0b, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00,
+  0x8c, 0x0d, 0x00, 0x00, 0x48, 0x0e, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00,
+  0xc4, 0x0f, 0x00, 0x00, 0x94, 0x10, 0x00, 0x00, 0x60, 0x11, 0x00, 0x00,
+  0x04, 0x12, 0x00, 0x00, 0xdc, 0x12, 0x00, 0x00, 0xc0, 0x13, 0x00, 0x00,
+  0xcc, 0x14, 0x00, 0x00, 0xb8, 0x15, 0x00, 0x00, 0xc4, 0x16, 0x00, 0x00,
+  0xbc, 0x17, 0x00, 0x00, 0xa0, 0x18, 0x00, 0x00, 0x2c, 0x19, 0x00, 0x00,
+  0x28, 0x1a, 0x00, 0x00, 0x08, 0x1b, 0x00, 0x00, 0xdc, 0x1b, 0x00, 0x00,
+  0xec, 0x1c, 0x00, 0x00, 0x70, 0x1d, 0x00, 0x00, 0x2c, 0x1e, 0x00, 0x00,
+  0x40, 0x1f, 0x00, 0x00, 0x18, 0x20, 0x00, 0x00, 0xf0, 0x20, 0x00, 0x00,
+  0x74, 0x21, 0x00, 0x00, 0x38, 0x22, 0x00, 0x00, 0x2c, 0x23, 0x00, 0x00,
+  0x08, 0x24, 0x00, 0x00, 0xa4, 0x24, 0x00, 0x00, 0x90, 0x25, 0x00, 0x00,
+  0x84, 0x26, 0x00, 0x00, 0x78, 0x27, 0x00, 0x00, 0x70, 0x28, 0x00, 0x00,
+  0x4c, 0x29, 0x00, 0x00, 0x24, 0x2a, 0x00, 0x00, 0x28, 0x2b, 0x00, 0x00,
+  0xfc, 0x2b, 0x00, 0x00, 0xdc, 0x2c, 0x00, 0x00, 0x70, 0x2d, 0x00, 0x00,
+  0x48, 0x2e, 0x00, 0x00, 0xdc, 0x2e, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00,
+  0x18, 0x31, 0x00, 0x00, 0xc4, 0x31, 0x00, 0x00, 0xd0, 0x32, 0x00, 0x00,
+  0xc0, 0x33, 0x00, 0x00, 0x94, 0x34, 0x00, 0x00, 0x74, 0x35, 0x00, 0x00,
+  0x40, 0x36, 0x00, 0x00, 0x88, 0x37, 0x00, 0x00, 0x30, 0x38, 0x00, 0x00,
+  0x28, 0x39, 0x00, 0x00, 0x10, 0x3a, 0x00, 0x00, 0x0c, 0x3b, 0x00, 0x00,
+  0x08, 0x3c, 0x00, 0x00, 0x04, 0x3d, 0x00, 0x00, 0xec, 0x3d, 0x00, 0x00,
+  0x0c, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0c, 0x41, 0x00, 0x00,
+  0xd8, 0x41, 0x00, 0x00, 0xe4, 0x42, 0x00, 0x00, 0xb8, 0x43, 0x00, 0x00,
+  0xcc, 0x44, 0x00, 0x00, 0xd4, 0x45, 0x00, 0x00, 0xe8, 0x46, 0x00, 0x00,
+  0xd8, 0x47, 0x00, 0x00, 0x18, 0x49, 0x00, 0x00, 0x04, 0x4a, 0x00, 0x00,
+  0x34, 0x4b, 0x00, 0x00, 0xd4, 0x4b, 0x00, 0x00, 0xac, 0x4c, 0x00, 0x00,
+  0xb4, 0x4d, 0x00, 0x00, 0xac, 0x4e, 0x00, 0x00, 0xf4, 0x4f, 0x00, 0x00,
+  0x04, 0x51, 0x00, 0x00, 0xe8, 0x51, 0x00, 0x00, 0xfc, 0x52, 0x00, 0x00,
+  0xc0, 0x53, 0x00, 0x00, 0x4c, 0x54, 0x00, 0x00, 0x38, 0x55, 0x00, 0x00,
+  0x48, 0x56, 0x00, 0x00, 0x28, 0x57, 0x00, 0x00, 0x04, 0x58, 0x00, 0x00,
+  0x08, 0x59, 0x00, 0x00, 0x9c, 0x59, 0x00, 0x00, 0x8c, 0x5a, 0x00, 0x00,
+  0x80, 0x5b, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x09, 0x00, 0x02, 0x00,
+  0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x02, 0x00,
+  0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x06, 0x00,
+  0x02, 0x00, 0x09, 0x00, 0x02, 0x00, 0x01, 0x00, 0x09, 0x00, 0x05, 0x00,
+  0x09, 0x00, 0x06, 0x00, 0x01, 0x00, 0x07, 0x00, 0x02, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x08, 0x00, 0x02, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x08, 0x00, 0x03, 0x00, 0x09, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x05, 0x00,
+  0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00,
+  0x08, 0x00, 0x09, 0x00, 0x01, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00,
+  0x80, 0xff, 0xcc, 0x05, 0xb7, 0x7e, 0x7e, 0x56, 0xd8, 0x82, 0x94, 0x10,
+  0x90, 0x32, 0x7d, 0x7d, 0x7d, 0x7d, 0xae, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0xd3, 0x99, 0x83, 0x89, 0x11, 0x84, 0x2b, 0x7d, 0x7d, 0x7d,
+  0x6c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xa9, 0x89, 0x11, 0xea, 0x7d, 0x7d, 0x72, 0xf1, 0xac, 0x3c, 0x79, 0x7d,
+  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfa, 0x88, 0x04, 0x89,
+  0x5f, 0x7d, 0x72, 0xd9, 0x82, 0x0a, 0xc2, 0xc8, 0xc8, 0xc8, 0xe2, 0x7d,
+  0x7d, 0x7d, 0x69, 0xd9, 0x87, 0x88, 0x03, 0x89, 0x5e, 0x61, 0xb1, 0x86,
+  0x05, 0xb6, 0x4a, 0x7d, 0x7d, 0x46, 0xa8, 0x8b, 0x01, 0x9c, 0xa9, 0x86,
+  0x05, 0x85, 0x35, 0x7d, 0x6d, 0x28, 0xbf, 0x94, 0x04, 0xaf, 0x23, 0x7d,
+  0x7d, 0x1e, 0x96, 0x04, 0xfa, 0x7e, 0x7d, 0x28, 0x88, 0x95, 0x04, 0xb5,
+  0x72, 0x7e, 0x2c, 0x85, 0x96, 0x03, 0x2d, 0x7e, 0x79, 0xb4, 0x96, 0x03,
+  0xfe, 0x73, 0x7d, 0x21, 0x95, 0x04, 0x8b, 0xce, 0x70, 0x7d, 0x6c, 0x96,
+  0x04, 0xe1, 0x7d, 0x7d, 0x68, 0xb1, 0x94, 0x05, 0x8c, 0x13, 0x6c, 0x7d,
+  0x49, 0xb4, 0x94, 0x05, 0x8b, 0xec, 0x7d, 0x7d, 0x3c, 0x89, 0x94, 0x05,
+  0x89, 0x27, 0x7d, 0x7d, 0x3c, 0xb7, 0x94, 0x05, 0x85, 0x2a, 0x7d, 0x7d,
+  0x66, 0xa5, 0x95, 0x04, 0x8d, 0x7d, 0x7d, 0x7d, 0x0c, 0x96, 0x04, 0x87,
+  0x4a, 0x7d, 0x15, 0x84, 0xac, 0x00, 0x00, 0x00, 0x80, 0xc6, 0x03, 0x93,
+  0x4b, 0x7e, 0xd5, 0x96, 0x04, 0x98, 0x7e, 0x7d, 0x23, 0xa4, 0x96, 0x03,
+  0x38, 0x7e, 0x7d, 0x1a, 0x96, 0x04, 0xe1, 0x7a, 0x7e, 0x79, 0xce, 0x95,
+  0x04, 0xc6, 0x77, 0x7d, 0x76, 0xc1, 0x95, 0x04, 0xc2, 0x59, 0x7d, 0x5a,
+  0xf4, 0x94, 0x05, 0x95, 0xd5, 0x47, 0x7d, 0x30, 0xd9, 0x95, 0x04, 0x25,
+  0x7d, 0x7d, 0xfc, 0x84, 0x95, 0x04, 0xe1, 0x77, 0x7d, 0xfd, 0x84, 0x95,
+  0x04, 0xdd, 0x7a, 0x7d, 0x5a, 0x99, 0x96, 0x04, 0xd4, 0x56, 0x7e, 0x75,
+  0xe8, 0x85, 0x03, 0x89, 0xaa, 0xa9, 0x89, 0x8b, 0x04, 0x8e, 0x54, 0x7d,
+  0x77, 0xb6, 0x84, 0x08, 0x83, 0xe4, 0x5a, 0x7d, 0x7d, 0x59, 0x11, 0xa4,
+  0x82, 0x88, 0x03, 0xe4, 0x7d, 0x76, 0xec, 0x82, 0x0b, 0x90, 0xdf, 0x1e,
+  0x27, 0x7d, 0x76, 0x59, 0x75, 0x7d, 0x7d, 0x7d, 0xd7, 0x87, 0x03, 0x89,
+  0x5a, 0x7d, 0x4d, 0x81, 0x0d, 0x91, 0xb1, 0x43, 0x7d, 0x7e, 0x61, 0x01,
+  0xc4, 0x80, 0xc1, 0x36, 0x5f, 0x7d, 0x1b, 0x87, 0x0b, 0x1d, 0x7d, 0x63,
+  0xba, 0xac, 0x19, 0x4e, 0x7d, 0x63, 0x06, 0xc8, 0x9f, 0x84, 0x02, 0x38,
+  0x7d, 0x26, 0x87, 0x08, 0xe3, 0x7d, 0x75, 0x42, 0x6c, 0x7d, 0x7d, 0x61,
+  0xe8, 0x85, 0x04, 0x95, 0xc9, 0x64, 0x7d, 0x04, 0x87, 0x08, 0x83, 0x25,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x03, 0xb1, 0x81, 0x08, 0xb1, 0xd6, 0xd6,
+  0x2c, 0x5c, 0x7d, 0x7d, 0x59, 0x9e, 0x88, 0x11, 0xa0, 0x1c, 0x2f, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x6e, 0x5a, 0x5b, 0x6e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0xa8, 0x8b, 0x0f, 0x85, 0xb5, 0x10, 0x69, 0x7d, 0x7d, 0x7d, 0x7e,
+  0x7d, 0x7d, 0x7d, 0x63, 0x10, 0xe8, 0x98, 0x83, 0x8e, 0x08, 0x89, 0xba,
+  0xcb, 0xcb, 0x8b, 0x8b, 0x8b, 0x8b, 0x89, 0xff, 0xaf, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0x82, 0x03, 0x9d, 0x58, 0x28, 0xb3, 0x96, 0x04, 0x9d, 0x07,
+  0x78, 0x7c, 0xea, 0x95, 0x05, 0x9e, 0x07, 0x7c, 0x7c, 0x32, 0x8b, 0x95,
+  0x04, 0xfb, 0x7c, 0x7c, 0x5a, 0x8f, 0x95, 0x04, 0x99, 0x5f, 0x7c, 0x7c,
+  0xeb, 0x95, 0x05, 0x97, 0x00, 0x7c, 0x6e, 0x2a, 0x95, 0x95, 0x03, 0xeb,
+  0x7c, 0x7c, 0x39, 0x96, 0x04, 0x9b, 0x40, 0x7c, 0x7c, 0x39, 0x95, 0x05,
+  0xce, 0x7d, 0x7c, 0x7c, 0x00, 0xce, 0x95, 0x04, 0x05, 0x7d, 0x7c, 0x4a,
+  0x93, 0x95, 0x04, 0xcd, 0x7d, 0x7f, 0x4a, 0x8e, 0x95, 0x04, 0xd2, 0x77,
+  0x7c, 0x4a, 0x8e, 0x95, 0x04, 0xa5, 0x73, 0x7c, 0x7c, 0x8e, 0x96, 0x03,
+  0xd3, 0x7c, 0x7c, 0x7c, 0x95, 0x05, 0xb5, 0x48, 0x6c, 0x75, 0x32, 0xb5,
+  0x95, 0x03, 0x25, 0x7c, 0x7c, 0x61, 0x96, 0x04, 0xcd, 0x6c, 0x7c, 0x60,
+  0xf8, 0x94, 0x05, 0x8c, 0x12, 0x6e, 0x7c, 0x76, 0xc7, 0x95, 0x04, 0xe6,
+  0x7a, 0x7c, 0x59, 0xd7, 0x97, 0x03, 0x1c, 0x7c, 0x12, 0x9f, 0xff, 0x81,
+  0x80, 0xff, 0x82, 0x03, 0x9d, 0x58, 0x6f, 0xb3, 0x97, 0x03, 0xb3, 0x78,
+  0x62, 0x86, 0x96, 0x03, 0x34, 0x68, 0x7c, 0xea, 0x96, 0x04, 0xc4, 0x74,
+  0x7c, 0x7c, 0xdd, 0x96, 0x04, 0x3a, 0x7c, 0x7c, 0x39, 0x94, 0x94, 0x05,
+  0x97, 0x2d, 0x72, 0x7c, 0x38, 0x95, 0x95, 0x04, 0xeb, 0x7c, 0x7c, 0x71,
+  0xb8, 0x95, 0x04, 0x9b, 0x40, 0x7c, 0x73, 0x25, 0x95, 0x04, 0xc7, 0x7d,
+  0x7c, 0x7c, 0xdf, 0x96, 0x04, 0xc7, 0x7d, 0x7c, 0x7c, 0xa7, 0x94, 0x05,
+  0x8d, 0x45, 0x7d, 0x7f, 0x0b, 0xd5, 0x94, 0x05, 0x91, 0x40, 0x7c, 0x7c,
+  0x4a, 0x87, 0x95, 0x04, 0x20, 0x7c, 0x7c, 0x7c, 0xd5, 0x95, 0x04, 0xbc,
+  0x46, 0x7c, 0x78, 0x2c, 0x95, 0x04, 0xd9, 0x6e, 0x7c, 0x67, 0xb2, 0x95,
+  0x04, 0xbc, 0x6e, 0x7c, 0x7c, 0x1a, 0x95, 0x05, 0xa5, 0x32, 0x7c, 0x7c,
+  0x04, 0xc7, 0x94, 0x05, 0xc4, 0x73, 0x7c, 0x7c, 0x4c, 0x9d, 0x95, 0x04,
+  0xeb, 0x7c, 0x7c, 0x4e, 0x9c, 0x96, 0x03, 0xb3, 0x6e, 0x51, 0x99, 0xff,
+  0x82, 0x00, 0x00, 0x00, 0x80, 0xff, 0x9d, 0x04, 0x89, 0x98, 0x01, 0xcd,
+  0x87, 0x94, 0x07, 0x89, 0xcf, 0x43, 0x7d, 0x7e, 0x7d, 0x1b, 0x9e, 0x91,
+  0x0a, 0xa0, 0xc6, 0xe8, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x64, 0xc6,
+  0x8f, 0x0b, 0xcd, 0x5b, 0x7e, 0x7d, 0x64, 0x21, 0x21, 0x2a, 0x7d, 0x7d,
+  0x7d, 0xf6, 0x8d, 0x06, 0x96, 0xf4, 0x65, 0x7d, 0x3f, 0xc0, 0x90, 0x81,
+  0x04, 0x83, 0xf6, 0x7d, 0x7d, 0x73, 0x8c, 0x05, 0x8d, 0x20, 0x7e, 0x7e,
+  0x7e, 0xf5, 0x84, 0x03, 0x18, 0x7e, 0x7e, 0x0a, 0x8c, 0x05, 0xf7, 0x7d,
+  0x7d, 0x7d, 0x33, 0xaa, 0x83, 0x04, 0x8f, 0x32, 0x7d, 0x7d, 0xc0, 0x8b,
+  0x05, 0x09, 0x7e, 0x7d, 0x7d, 0x7d, 0xd6, 0x84, 0x04, 0x20, 0x7d, 0x7d,
+  0x1a, 0x86, 0x8a, 0x06, 0xcd, 0x65, 0x7e, 0x7d, 0x64, 0xc2, 0x99, 0x83,
+  0x04, 0xe0, 0x6a, 0x7d, 0x44, 0x89, 0x8a, 0x05, 0xa0, 0x5b, 0x7d, 0x7e,
+  0x7d, 0xcf, 0x85, 0x03, 0x5d, 0x7e, 0x7d, 0xcf, 0x8a, 0x05, 0x8f, 0x40,
+  0x7e, 0x7e, 0x33, 0xaa, 0x84, 0x04, 0xe6, 0x6a, 0x7e, 0x7e, 0xd4, 0x8b,
+  0x04, 0x22, 0x7d, 0x7d, 0x68, 0xaa, 0x83, 0x05, 0x85, 0xf9, 0x65, 0x7d,
+  0x7d, 0xd4, 0x8b, 0x04, 0x91, 0x65, 0x7d, 0x7d, 0xb6, 0x84, 0x04, 0x0b,
+  0x7d, 0x7d, 0x64, 0x03, 0x8c, 0x04, 0xf7, 0x7d, 0x7d, 0x07, 0x84, 0x82,
+  0x05, 0xcd, 0x11, 0x7e, 0x7d, 0x7d, 0xf7, 0x8d, 0x03, 0x0b, 0x7d, 0x3e,
+  0x84, 0x81, 0x07, 0x96, 0x13, 0x79, 0x7d, 0x7e, 0x7d, 0x09, 0x84, 0x8d,
+  0x0b, 0x40, 0x7e, 0x04, 0x94, 0xcd, 0x0b, 0x55, 0x7e, 0x7e, 0x74, 0xf5,
+  0xaa, 0x8f, 0x09, 0x0b, 0x7d, 0x64, 0x6d, 0x7d, 0x7e, 0x7d, 0x7d, 0x2d,
+  0xb2, 0x91, 0x08, 0x40, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x23, 0xc5, 0x8d,
+  0x92, 0x05, 0xd9, 0x5c, 0x7d, 0x7d, 0x29, 0xaa, 0x96, 0x03, 0x8f, 0x97,
+  0x97, 0x82, 0xe5, 0x00, 0x80, 0xff, 0x9d, 0x05, 0x91, 0xd0, 0xe8, 0x7f,
+  0x72, 0xb1, 0x95, 0x05, 0xb5, 0x7d, 0x7d, 0x7d, 0x7d, 0x1c, 0x94, 0x06,
+  0xa5, 0x5f, 0x7d, 0x7d, 0x7d, 0x78, 0xf7, 0x93, 0x06, 0xa8, 0x4f, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x09, 0x93, 0x07, 0x9e, 0x60, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x69, 0xb2, 0x92, 0x07, 0xab, 0x50, 0x7d, 0x7d, 0x7d, 0x7d, 0x6c, 0xc8,
+  0x92, 0x07, 0x81, 0xea, 0x7d, 0x7d, 0x7d, 0x7d, 0x6f, 0xca, 0x92, 0x07,
+  0xac, 0xef, 0x7d, 0x7d, 0x7d, 0x7d, 0x67, 0xc7, 0x92, 0x07, 0x81, 0xef,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0xc8, 0x93, 0x06, 0xd8, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x64, 0xc4, 0x93, 0x06, 0xd2, 0x6b, 0x7d, 0x7d, 0x7d, 0x7d, 0x36,
+  0x93, 0x07, 0x8d, 0x1f, 0x7d, 0x7d, 0x7d, 0x64, 0xc3, 0x86, 0x92, 0x06,
+  0xd4, 0x27, 0x7d, 0x7d, 0x7d, 0x78, 0xc4, 0x94, 0x05, 0x0c, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x4f, 0x95, 0x05, 0x0c, 0x7d, 0x7d, 0x7d, 0x46, 0xa1, 0x94,
+  0x05, 0x45, 0x6a, 0x7d, 0x7d, 0x67, 0x99, 0x95, 0x04, 0x6d, 0x7d, 0x7d,
+  0x45, 0xfd, 0x94, 0x05, 0x86, 0x00, 0x79, 0x7d, 0x7a, 0xfa, 0x95, 0x04,
+  0xd0, 0x7d, 0x7d, 0x7d, 0x0e, 0x96, 0x04, 0x99, 0x3b, 0x7d, 0x7d, 0xa2,
+  0xe5, 0x00, 0x00, 0x00, 0x80, 0xff, 0x98, 0x08, 0xb5, 0x13, 0x7e, 0x7e,
+  0x7f, 0x75, 0xe5, 0xe5, 0xe2, 0x8e, 0x0d, 0x88, 0xaf, 0xe3, 0x48, 0x64,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7b, 0xf4, 0x8d, 0x0d, 0xa7,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x11, 0x8c, 0x0e, 0x13, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x11, 0x8c, 0x0e, 0x77, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x69, 0x56, 0xeb, 0xbd, 0x67, 0x7d, 0x7d, 0x7d, 0x60, 0xa3, 0x8c,
+  0x05, 0x22, 0x7d, 0x7d, 0x4e, 0xf3, 0xb8, 0x81, 0x05, 0xc4, 0x70, 0x7d,
+  0x7d, 0x5b, 0xaa, 0x8d, 0x03, 0x86, 0x8e, 0x8e, 0x8a, 0x82, 0x05, 0xbc,
+  0x27, 0x7d, 0x7d, 0x7d, 0x0b, 0x93, 0x07, 0x91, 0xcf, 0x69, 0x7d, 0x7d,
+  0x72, 0xc4, 0x8a, 0x93, 0x05, 0x03, 0x7d, 0x7d, 0x7d, 0x59, 0xf3, 0x93,
+  0x06, 0x9a, 0xe1, 0x73, 0x7d, 0x7d, 0x57, 0xa2, 0x94, 0x05, 0xe4, 0x7d,
+  0x7d, 0x7d, 0x5f, 0xa7, 0x94, 0x05, 0xc4, 0x76, 0x7d, 0x7d, 0x57, 0xa7,
+  0x94, 0x05, 0xcd, 0x70, 0x7d, 0x7d, 0x59, 0xa2, 0x84, 0x04, 0x91, 0xc6,
+  0x07, 0x60, 0xd8, 0x8a, 0x05, 0x25, 0x69, 0x7d, 0x7d, 0x5f, 0xa9, 0x82,
+  0x07, 0x8e, 0x90, 0xd7, 0x3e, 0x7d, 0x7d, 0x7a, 0xdd, 0x89, 0x10, 0xc4,
+  0x7a, 0x7d, 0x7d, 0x56, 0xa5, 0x80, 0xa4, 0xf4, 0xf4, 0x6d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x4b, 0xed, 0x89, 0x10, 0xce, 0x6d, 0x7d, 0x7d, 0x7d, 0x3d,
+  0xd1, 0x58, 0x63, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x48, 0xdd, 0x96, 0x89,
+  0x0f, 0x84, 0x4a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x79, 0x75, 0x0e, 0xdc, 0x8e, 0x8b, 0x0b, 0xe5, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x31, 0xcb, 0x8f, 0x0a, 0xe5, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x6b, 0x47, 0xf8, 0xad, 0x8e, 0x90, 0x06, 0xa8, 0x5d,
+  0x7d, 0x7d, 0x65, 0xe3, 0xc2, 0xe3, 0x00, 0x00, 0x80, 0xff, 0x9b, 0x07,
+  0xee, 0xed, 0x01, 0x7d, 0x7f, 0x7d, 0x7d, 0x2a, 0x8d, 0x0d, 0xb5, 0xc9,
+  0xc9, 0x45, 0x59, 0x59, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x89, 0x11, 0x9b, 0xa5, 0x35, 0x35, 0x68, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x14, 0x88, 0x12, 0x81, 0x35,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x3f, 0xec, 0x00,
+  0x7c, 0x7d, 0x7c, 0x7c, 0xec, 0x88, 0x08, 0xaa, 0x5d, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x3d, 0x10, 0xe7, 0x82, 0x05, 0xa0, 0x53, 0x7c, 0x7d, 0x5c, 0xfb,
+  0x8a, 0x05, 0x01, 0x33, 0x33, 0x0a, 0xa3, 0x8f, 0x83, 0x05, 0x07, 0x63,
+  0x7c, 0x7c, 0x5e, 0x00, 0x93, 0x06, 0xaf, 0x35, 0x7d, 0x7c, 0x76, 0x57,
+  0xa9, 0x93, 0x05, 0xfd, 0x5d, 0x7c, 0x7d, 0x7c, 0x04, 0x93, 0x06, 0xbf,
+  0x2b, 0x7d, 0x7d, 0x7d, 0x50, 0x94, 0x92, 0x07, 0x95, 0xde, 0x6d, 0x7d,
+  0x7c, 0x5c, 0xa3, 0x94, 0x92, 0x08, 0x90, 0x35, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x71, 0x35, 0x95, 0x92, 0x09, 0xaf, 0x68, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c,
+  0x7c, 0x4f, 0xe8, 0x92, 0x09, 0x1c, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d,
+  0x7f, 0x7d, 0xc8, 0x91, 0x09, 0x8a, 0xa3, 0xa3, 0xa3, 0xa3, 0x15, 0x7c,
+  0x7d, 0x7c, 0x43, 0x96, 0x04, 0xa5, 0x7c, 0x7d, 0x7c, 0x57, 0x95, 0x05,
+  0xfd, 0x20, 0x7c, 0x7d, 0x7c, 0x57, 0x8e, 0x0c, 0xcf, 0xed, 0xed, 0xed,
+  0xed, 0x3f, 0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0xc8, 0x8c, 0x0e, 0x5a,
+  0x59, 0x72, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x5e,
+  0xb7, 0x8a, 0x8c, 0x0c, 0x05, 0x62, 0x7c, 0x7c, 0x7c, 0x7c, 0x76, 0x57,
+  0x59, 0x57, 0xf0, 0xc7, 0xa9, 0x8f, 0x05, 0x9f, 0xec, 0xec, 0xec, 0xec,
+  0xdc, 0xe4, 0x00, 0x00, 0x80, 0xff, 0x9a, 0x02, 0x04, 0x7e, 0x18, 0x85,
+  0x01, 0xca, 0xb6, 0x8f, 0x03, 0xa3, 0x60, 0x7d, 0x2d, 0x83, 0x03, 0x98,
+  0xf7, 0x76, 0xf4, 0x8f, 0x03, 0x4d, 0x7d, 0x7d, 0xd9, 0x82, 0x04, 0xc2,
+  0x42, 0x7d, 0x7d, 0xf4, 0x8d, 0x05, 0x9d, 0x3d, 0x77, 0x7d, 0x3a, 0x96,
+  0x81, 0x05, 0xcf, 0x75, 0x7d, 0x74, 0x3b, 0x9c, 0x8c, 0x0c, 0x9d, 0x56,
+  0x7d, 0x7d, 0x3c, 0x96, 0x80, 0x81, 0xa3, 0x46, 0x7d, 0x7d, 0x41, 0x8d,
+  0x05, 0x9d, 0x54, 0x7d, 0x7d, 0x40, 0x93, 0x81, 0x05, 0x8f, 0x7d, 0x7d,
+  0x7d, 0x51, 0x9e, 0x8c, 0x05, 0xe4, 0x56, 0x7d, 0x7d, 0x44, 0x8d, 0x81,
+  0x05, 0x8f, 0x48, 0x7d, 0x7d, 0x52, 0x9b, 0x8c, 0x05, 0xa1, 0x5b, 0x7d,
+  0x7d, 0x44, 0x87, 0x82, 0x04, 0x22, 0x7d, 0x7d, 0x50, 0x96, 0x8c, 0x05,
+  0xa3, 0x55, 0x7d, 0x7d, 0x40, 0x8d, 0x82, 0x04, 0xdc, 0x74, 0x7d, 0x7d,
+  0xe6, 0x8d, 0x04, 0x05, 0x7d, 0x7d, 0x3c, 0x93, 0x82, 0x05, 0xb9, 0x71,
+  0x7d, 0x78, 0xaf, 0x83, 0x8c, 0x04, 0xf1, 0x78, 0x7d, 0x3a, 0x96, 0x82,
+  0x08, 0x92, 0x32, 0x7d, 0x7d, 0x78, 0xb1, 0xe9, 0x2a, 0x9e, 0x8a, 0x0f,
+  0x7e, 0x7d, 0x7d, 0xbd, 0x84, 0x9c, 0x9c, 0x9c, 0x36, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x63, 0xce, 0x8b, 0x0e, 0x7e, 0x7d, 0x7d, 0x2a, 0x1f, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0x28, 0xed, 0x86, 0x8c, 0x0b, 0x7e,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x66, 0xae, 0x8f,
+  0x0a, 0xcd, 0x3d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x61, 0xaf,
+  0x91, 0x08, 0x8d, 0xa2, 0xa2, 0xa2, 0xae, 0x7d, 0x7d, 0x7d, 0xc1, 0x96,
+  0x04, 0xb0, 0x7d, 0x7d, 0x15, 0x8a, 0x96, 0x03, 0x17, 0x7d, 0x7d, 0x9b,
+  0x97, 0x03, 0x17, 0x7d, 0x7d, 0x9b, 0x97, 0x03, 0xcd, 0x7d, 0x7d, 0x9b,
+  0xe0, 0x00, 0x00, 0x00, 0x80, 0xff, 0x96, 0x09, 0xf3, 0x70, 0x7f, 0x64,
+  0xa9, 0xc3, 0xf6, 0xf6, 0xf6, 0x99, 0x8f, 0x0c, 0x86, 0x27, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x71, 0x75, 0x7d, 0x7d, 0x7d, 0x4c, 0x9d, 0x8e, 0x0c, 0x8a,
+  0x58, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xcb,
+  0x8f, 0x0b, 0xe7, 0x46, 0x77, 0x6e, 0x46, 0x46, 0xf8, 0xd8, 0x76, 0x7d,
+  0x7d, 0xcb, 0x91, 0x01, 0xc9, 0xbc, 0x81, 0x05, 0x85, 0x54, 0x7d, 0x7d,
+  0x40, 0x98, 0x94, 0x05, 0x82, 0xe0, 0x7d, 0x7d, 0x7d, 0xb6, 0x95, 0x05,
+  0xe3, 0x7d, 0x7d, 0x7d, 0x52, 0x9b, 0x94, 0x05, 0x95, 0x4b, 0x7d, 0x7d,
+  0x18, 0x84, 0x94, 0x05, 0x99, 0x43, 0x7d, 0x7d, 0x51, 0x97, 0x95, 0x04,
+  0xeb, 0x7d, 0x7d, 0x78, 0x98, 0x95, 0x04, 0xac, 0x57, 0x7d, 0x78, 0xfd,
+  0x90, 0x11, 0x89, 0x9c, 0x9c, 0x9c, 0x9c, 0xd8, 0x74, 0x7d, 0x7d, 0x74,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xcc, 0x88, 0x12, 0xbb, 0x31,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7b, 0x76, 0x76, 0xf1, 0x87, 0x10, 0xba, 0x73, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x11, 0xe2,
+  0x8a, 0x0f, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x59, 0xf1,
+  0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x82, 0x8b, 0x08, 0x52, 0x5e, 0x2a, 0xc3,
+  0xc0, 0x7d, 0x7d, 0x7d, 0xad, 0x92, 0x08, 0x99, 0xa2, 0x80, 0x8e, 0x22,
+  0x7d, 0x5d, 0x03, 0x86, 0x95, 0x03, 0xce, 0x7d, 0x7d, 0xfb, 0x97, 0x03,
+  0x40, 0x7a, 0x16, 0xaf, 0x97, 0x01, 0x40, 0x5b, 0xe6, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0x98, 0x0a, 0x93, 0xe9, 0xea, 0xe9, 0x49, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x48, 0xd6, 0x8d, 0x0e, 0xab, 0xbc, 0x48, 0x58, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x74, 0xd6, 0x89, 0x11, 0x81, 0x8f,
+  0x13, 0x62, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x78, 0x6d, 0x6d, 0x6d, 0x6e,
+  0x7c, 0x7c, 0x7c, 0xe7, 0x89, 0x09, 0xd6, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x05, 0xe6, 0x82, 0x04, 0x9e, 0x7c, 0x7c, 0x7c, 0xe7, 0x89,
+  0x07, 0x24, 0x7c, 0x7c, 0x7c, 0x54, 0xa5, 0x9d, 0x9d, 0x83, 0x05, 0x97,
+  0x37, 0x7c, 0x7c, 0x6e, 0xc9, 0x89, 0x04, 0xb9, 0x5e, 0x32, 0xca, 0xa3,
+  0x85, 0x05, 0x8f, 0x37, 0x7c, 0x7c, 0x71, 0xdf, 0x94, 0x05, 0x88, 0x3d,
+  0x7c, 0x7c, 0x7c, 0xd4, 0x93, 0x07, 0xa6, 0xfd, 0x6f, 0x7c, 0x7c, 0x71,
+  0xd4, 0x81, 0x93, 0x05, 0x5b, 0x7c, 0x7c, 0x7c, 0x54, 0xdf, 0x94, 0x05,
+  0xd9, 0x7d, 0x7c, 0x7c, 0x35, 0x8c, 0x93, 0x05, 0xe3, 0x5b, 0x7d, 0x7f,
+  0x64, 0xb5, 0x93, 0x06, 0xbd, 0x50, 0x79, 0x7c, 0x7c, 0x03, 0xa2, 0x92,
+  0x06, 0x88, 0xbc, 0x62, 0x7c, 0x7c, 0x5e, 0xd8, 0x93, 0x06, 0x88, 0x36,
+  0x7c, 0x7c, 0x7c, 0x51, 0xee, 0x93, 0x06, 0x92, 0x2d, 0x7c, 0x7c, 0x7c,
+  0x54, 0x9b, 0x82, 0x04, 0x92, 0xd4, 0x5f, 0x5f, 0x45, 0x8b, 0x0f, 0x8d,
+  0x2a, 0x7c, 0x7c, 0x7c, 0xfd, 0xb3, 0x9e, 0xb9, 0x32, 0x33, 0x44, 0x7c,
+  0x7c, 0x73, 0xec, 0x8b, 0x0e, 0x37, 0x7c, 0x7c, 0x7c, 0x7c, 0x28, 0x44,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x74, 0xf6, 0xd3, 0x8c, 0x0c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x31, 0xc1, 0x8e,
+  0x0b, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x51, 0x4f, 0xf8, 0xbb,
+  0x8a, 0x8f, 0x07, 0xe8, 0x62, 0x7c, 0x7c, 0x7c, 0x12, 0xe7, 0x86, 0xe2,
+  0x80, 0xff, 0xb8, 0x04, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x0b, 0x00,
+  0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x8d,
+  0x0d, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x3f, 0x8d, 0x05, 0x3f, 0x7f, 0x7f, 0x3f, 0x00, 0x00, 0x81,
+  0x05, 0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x8d, 0x01, 0x00, 0xc0, 0x85,
+  0x03, 0x7f, 0x7f, 0x7f, 0x7f, 0x95, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f,
+  0x93, 0x05, 0xc0, 0x3f, 0x7f, 0x7f, 0x7f, 0x3f, 0x94, 0x04, 0x3f, 0x7f,
+  0x7f, 0x7f, 0x3f, 0x94, 0x06, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0xc0,
+  0x93, 0x0a, 0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00,
+  0xc0, 0x82, 0x00, 0xc0, 0x8c, 0x0b, 0xc0, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0xc0, 0x93, 0x07, 0xc0, 0x00, 0x00, 0x00,
+  0x3f, 0x7f, 0x7f, 0x3f, 0x97, 0x03, 0xc0, 0x7f, 0x7f, 0x3f, 0x96, 0x04,
+  0xc0, 0x3f, 0x7f, 0x7f, 0x3f, 0x8a, 0x01, 0xc0, 0x3f, 0x86, 0x07, 0xc0,
+  0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xc0, 0x8a, 0x0e, 0x3f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f,
+  0x8c, 0x0c, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x00, 0xc0, 0x90, 0x03, 0xc0, 0x00, 0x00, 0xc0, 0xff, 0x82, 0x00,
+  0x80, 0xff, 0xda, 0x02, 0x8e, 0x12, 0x0b, 0x8d, 0x01, 0xa8, 0x87, 0x87,
+  0x03, 0xa8, 0x38, 0x7c, 0xb3, 0x8c, 0x03, 0xb5, 0x6f, 0xd8, 0x86, 0x84,
+  0x05, 0x9d, 0x27, 0x6f, 0x7c, 0x2e, 0x84, 0x8b, 0x04, 0x0a, 0x52, 0x7c,
+  0xd7, 0x86, 0x83, 0x05, 0xc8, 0x41, 0x6e, 0x7c, 0xd7, 0xa2, 0x8b, 0x04,
+  0xd0, 0x6f, 0x64, 0x00, 0x87, 0x82, 0x06, 0x89, 0xe6, 0x6d, 0x7c, 0x7c,
+  0x0f, 0x87, 0x8a, 0x04, 0x95, 0x59, 0x71, 0x7c, 0xcc, 0x83, 0x06, 0xb9,
+  0x5c, 0x7c, 0x7c, 0x65, 0xc0, 0x87, 0x8b, 0x04, 0x06, 0x7c, 0x7c, 0x0b,
+  0x86, 0x83, 0x04, 0x72, 0x7c, 0x7c, 0x67, 0xb4, 0x8c, 0x04, 0x00, 0x77,
+  0x7c, 0xdb, 0x89, 0x82, 0x06, 0xb5, 0x6c, 0x7d, 0x7c, 0x6b, 0xeb, 0xba,
+  0x8c, 0x0c, 0x3f, 0x7d, 0x6c, 0xb4, 0x8d, 0x8d, 0x8d, 0xbb, 0x72, 0x7d,
+  0x7f, 0x7c, 0x4f, 0x8e, 0x0b, 0x10, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x71, 0x25, 0xe2, 0x8f, 0x09, 0xe8, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x5b, 0xf1, 0x91, 0x08, 0x84, 0xd4, 0xd4, 0xd4, 0x35,
+  0x7c, 0x7c, 0x6a, 0x93, 0x95, 0x04, 0x8c, 0x24, 0x7c, 0x4b, 0xbd, 0x96,
+  0x03, 0x9a, 0x5a, 0x67, 0xa2, 0x97, 0x03, 0x9a, 0x5a, 0x56, 0x97, 0x97,
+  0x02, 0x87, 0xa4, 0x99, 0xff, 0x9b, 0x00, 0x00, 0x80, 0xff, 0xff, 0xa3,
+  0x0e, 0x89, 0xed, 0xf9, 0xcc, 0xcc, 0x1c, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x08, 0x8a, 0x10, 0x83, 0xbc, 0x60, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x77, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x4f, 0xd5, 0x8a,
+  0x08, 0x26, 0x7e, 0x7e, 0x7e, 0x7e, 0x3d, 0xc7, 0xc6, 0xb5, 0x90, 0x07,
+  0x82, 0x2a, 0x7d, 0x73, 0x23, 0xaa, 0x8f, 0x84, 0x93, 0x03, 0x24, 0x7e,
+  0x6f, 0xaa, 0x96, 0x04, 0xac, 0x75, 0x7e, 0xd1, 0x90, 0x97, 0x05, 0x00,
+  0x7d, 0x7e, 0x3f, 0xde, 0x84, 0x96, 0x05, 0xd7, 0x5f, 0x7e, 0x7e, 0x5f,
+  0xa1, 0x96, 0x04, 0x9b, 0x2d, 0x7e, 0x7e, 0xf9, 0x95, 0x05, 0x92, 0xcf,
+  0x43, 0x7e, 0x7e, 0x3b, 0x93, 0x07, 0x3b, 0x61, 0x69, 0x7e, 0x7e, 0x7c,
+  0x65, 0xc0, 0x93, 0x05, 0xcb, 0x1d, 0x2e, 0x2e, 0x11, 0xc2, 0xff, 0xb6,
+  0x80, 0xff, 0x81, 0x04, 0xb0, 0x19, 0x6b, 0x6b, 0xfa, 0x94, 0x06, 0x98,
+  0x56, 0x6a, 0x7e, 0x7e, 0x21, 0xa2, 0x93, 0x06, 0xf1, 0x48, 0x7e, 0x7e,
+  0x2f, 0xbd, 0x8d, 0x93, 0x05, 0x0d, 0x3c, 0x7e, 0x67, 0xd2, 0xb1, 0x92,
+  0x06, 0x88, 0xcb, 0x18, 0x6c, 0x7c, 0x62, 0xad, 0x93, 0x05, 0xcf, 0x43,
+  0x7e, 0x7e, 0x5b, 0xe4, 0x94, 0x05, 0xcc, 0x45, 0x7e, 0x7e, 0x1b, 0xe9,
+  0x94, 0x05, 0xc5, 0x4a, 0x7e, 0x7e, 0x57, 0xdd, 0x81, 0x06, 0xbb, 0xdb,
+  0xdb, 0xdb, 0xdb, 0xfc, 0xf5, 0x8b, 0x11, 0x95, 0x07, 0x7e, 0x7e, 0x7e,
+  0xa0, 0xbf, 0xc6, 0x2a, 0x6e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x77, 0x44,
+  0xa0, 0x89, 0x11, 0xe7, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x77, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x3f, 0x88, 0x12, 0x8b,
+  0x5b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x6a, 0x63, 0x14, 0xd9,
+  0xd9, 0x0e, 0x7e, 0x7e, 0x7e, 0x3f, 0x88, 0x09, 0xe5, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x78, 0x78, 0x07, 0x9e, 0x83, 0x04, 0xd7, 0x7e, 0x7e, 0x7e,
+  0x3c, 0x88, 0x06, 0x6b, 0x7e, 0x7e, 0x7e, 0x78, 0x02, 0x83, 0x85, 0x04,
+  0xf7, 0x6e, 0x7e, 0x7e, 0x6a, 0x88, 0x05, 0xf1, 0x7e, 0x7e, 0x68, 0x04,
+  0x8c, 0x84, 0x07, 0x8c, 0xec, 0x72, 0x7e, 0x7e, 0x7e, 0x6e, 0xc0, 0x88,
+  0x11, 0x41, 0x7e, 0x7e, 0x59, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xf9, 0x5d,
+  0x61, 0x7e, 0x7e, 0x7e, 0x36, 0xbf, 0x9c, 0x89, 0x0f, 0x24, 0x58, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x60, 0x08,
+  0x88, 0x8c, 0x0c, 0xd2, 0x55, 0x75, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x77, 0x55, 0x06, 0xa7, 0x90, 0x07, 0xc9, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+  0xe0, 0xce, 0xff, 0xb3, 0x80, 0xff, 0xb7, 0x03, 0x84, 0x8d, 0x8d, 0x83,
+  0x8f, 0x0c, 0x82, 0x93, 0x93, 0xe3, 0xbe, 0xac, 0x0f, 0x0f, 0x2d, 0x7e,
+  0x7e, 0xf8, 0x83, 0x8e, 0x0c, 0xdd, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xa5, 0x8e, 0x0c, 0x00, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x78, 0x5f, 0x5f, 0x68, 0x7e, 0x7e, 0x7e, 0xa5, 0x8e, 0x0c, 0x87,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xcb, 0x80, 0x8a, 0x1d, 0x7e, 0x7e, 0x34, 0x8e,
+  0x95, 0x04, 0xd4, 0x7e, 0x7e, 0x49, 0x8f, 0x95, 0x04, 0xc0, 0x69, 0x7e,
+  0x57, 0xcf, 0x95, 0x04, 0xa4, 0x69, 0x7e, 0x6f, 0xab, 0x95, 0x04, 0x8b,
+  0x21, 0x7e, 0x7e, 0x1b, 0x96, 0x04, 0xce, 0x7e, 0x7e, 0x4f, 0x8f, 0x82,
+  0x05, 0x9a, 0xaa, 0xbf, 0xc5, 0xc5, 0xc5, 0x88, 0x12, 0x84, 0xcb, 0xcb,
+  0xcb, 0xde, 0x6c, 0x7e, 0x7e, 0x03, 0xb9, 0x2d, 0x47, 0x47, 0x5c, 0x69,
+  0x79, 0x7e, 0x7e, 0x5a, 0x87, 0x13, 0xad, 0x50, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x73, 0x73, 0x7e, 0x7e, 0x7e, 0x61, 0x2d, 0x2d, 0x2d,
+  0xb7, 0x99, 0x87, 0x0e, 0x6b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x40, 0x27, 0x27, 0x27, 0x00, 0xab, 0x9b, 0x8c, 0x08, 0x52, 0x4c, 0x18,
+  0xba, 0x7e, 0x7e, 0x6e, 0xcc, 0x8b, 0x92, 0x06, 0x90, 0x8e, 0x80, 0x99,
+  0x7e, 0x7e, 0x53, 0x97, 0x03, 0x8f, 0x55, 0x7f, 0x53, 0x98, 0x02, 0x9b,
+  0x56, 0x53, 0x99, 0x01, 0x88, 0x8a, 0xfe, 0x00, 0x80, 0xff, 0xd6, 0x05,
+  0xab, 0xe8, 0x4f, 0x4f, 0x25, 0x89, 0x91, 0x09, 0x8b, 0xf4, 0x47, 0x66,
+  0x70, 0x7d, 0x7c, 0x7c, 0x7c, 0x00, 0x8f, 0x0b, 0x93, 0x00, 0x7f, 0x7d,
+  0x7d, 0x6a, 0x66, 0xf4, 0xf4, 0x19, 0x7d, 0x7d, 0x8d, 0x07, 0x89, 0xce,
+  0x6c, 0x7c, 0x7d, 0x7c, 0x3b, 0x91, 0x82, 0x02, 0xc6, 0x7c, 0x7c, 0x8c,
+  0x07, 0xa6, 0x1b, 0x7c, 0x7c, 0x7c, 0x77, 0xee, 0x93, 0x83, 0x02, 0x19,
+  0x7c, 0x28, 0x8b, 0x06, 0xab, 0x69, 0x7c, 0x7c, 0x7c, 0x52, 0xde, 0x84,
+  0x03, 0x04, 0x70, 0x7c, 0xab, 0x8a, 0x06, 0xab, 0x66, 0x7d, 0x7c, 0x7c,
+  0x52, 0x96, 0x84, 0x04, 0xff, 0x74, 0x7c, 0xf4, 0x82, 0x89, 0x06, 0xa6,
+  0x69, 0x7d, 0x67, 0xbf, 0x47, 0xaa, 0x83, 0x04, 0xb3, 0x3f, 0x7f, 0x79,
+  0xf3, 0x8a, 0x04, 0x9e, 0x1b, 0x7c, 0x67, 0xaa, 0x84, 0x05, 0x89, 0x02,
+  0x42, 0x7c, 0x79, 0xf5, 0x8a, 0x04, 0x87, 0x3a, 0x7c, 0x7c, 0xb6, 0x83,
+  0x06, 0xa0, 0x04, 0x45, 0x7c, 0x7c, 0x5d, 0xbf, 0x8b, 0x04, 0xc2, 0x7c,
+  0x7c, 0x30, 0x84, 0x81, 0x07, 0xc4, 0x06, 0x64, 0x7d, 0x7c, 0x7c, 0x06,
+  0x99, 0x8c, 0x0d, 0x73, 0x7c, 0x7c, 0x15, 0xf4, 0x33, 0x66, 0x76, 0x7c,
+  0x7c, 0x73, 0x09, 0xb6, 0x84, 0x8d, 0x09, 0x74, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7f, 0x7d, 0x7d, 0x6a, 0xfe, 0x91, 0x08, 0xb2, 0x24, 0x4e, 0x4e, 0x4e,
+  0x4f, 0x04, 0xdc, 0x91, 0xff, 0xd1, 0x00, 0x00, 0x80, 0xff, 0x9f, 0x04,
+  0x95, 0x31, 0x7e, 0x7f, 0xfc, 0x96, 0x04, 0x31, 0x7d, 0x7d, 0x7d, 0x14,
+  0x94, 0x06, 0xdf, 0x5a, 0x7e, 0x7d, 0x7d, 0x6d, 0xbd, 0x93, 0x06, 0x90,
+  0x2b, 0x7d, 0x7e, 0x7d, 0x6d, 0xd2, 0x94, 0x05, 0x27, 0x7d, 0x7d, 0x7e,
+  0x7d, 0xd6, 0x93, 0x06, 0x95, 0x31, 0x7e, 0x7e, 0x7e, 0x6b, 0xce, 0x94,
+  0x05, 0x31, 0x7d, 0x7d, 0x7d, 0x7d, 0x36, 0x93, 0x07, 0x90, 0x27, 0x7e,
+  0x7d, 0x7d, 0x6d, 0xd6, 0x99, 0x92, 0x06, 0x90, 0x2b, 0x7d, 0x7e, 0x7d,
+  0x6d, 0xd2, 0x94, 0x05, 0x27, 0x7d, 0x7d, 0x7e, 0x14, 0xbd, 0x93, 0x06,
+  0x95, 0x31, 0x7e, 0x7e, 0x7e, 0x6b, 0xce, 0x94, 0x05, 0x31, 0x7d, 0x7d,
+  0x7d, 0x14, 0xce, 0x92, 0x07, 0x86, 0xa5, 0x27, 0x7e, 0x7d, 0x7d, 0x6d,
+  0xbd, 0x93, 0x06, 0xa5, 0x7d, 0x7d, 0x7e, 0x7d, 0x1e, 0xd2, 0x94, 0x05,
+  0x27, 0x7d, 0x7d, 0x7e, 0x14, 0x8a, 0x93, 0x05, 0x95, 0x31, 0x7e, 0x7e,
+  0x7e, 0x03, 0x95, 0x04, 0xc9, 0x7d, 0x7d, 0x7d, 0x14, 0x96, 0x04, 0x66,
+  0x7d, 0x77, 0x0a, 0x8a, 0x96, 0x02, 0x7f, 0x7d, 0x58, 0x98, 0x02, 0xc8,
+  0xc8, 0xbd, 0xe7, 0x00, 0x80, 0xff, 0xb3, 0x07, 0x95, 0xa5, 0xf8, 0xba,
+  0x35, 0x36, 0x35, 0xc8, 0x8f, 0x0c, 0x81, 0xbf, 0x10, 0x10, 0x4e, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x6c, 0xbe, 0x8d, 0x0d, 0x90, 0x3f, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x8d,
+  0x0d, 0xa5, 0x7c, 0x7c, 0x7c, 0x7c, 0x52, 0x34, 0xb7, 0xa3, 0xa3, 0x00,
+  0x7c, 0x7c, 0x7c, 0x8d, 0x05, 0x8b, 0x1a, 0x57, 0x2e, 0xc7, 0x9f, 0x83,
+  0x03, 0x01, 0x7c, 0x7c, 0x14, 0x96, 0x04, 0xd4, 0x7d, 0x7c, 0x67, 0xae,
+  0x94, 0x05, 0xa0, 0x01, 0x7d, 0x7f, 0x7d, 0xc8, 0x94, 0x06, 0x07, 0x63,
+  0x7c, 0x7c, 0x5e, 0x0a, 0x8a, 0x91, 0x07, 0x8b, 0xba, 0x35, 0x7d, 0x7c,
+  0x76, 0x57, 0xa9, 0x93, 0x05, 0x1b, 0x7c, 0x7c, 0x7d, 0x7c, 0x04, 0x93,
+  0x06, 0xbf, 0x7d, 0x7d, 0x7d, 0x7d, 0x50, 0x94, 0x81, 0x07, 0xaf, 0xed,
+  0xed, 0xed, 0x7f, 0x53, 0x54, 0x7d, 0x88, 0x12, 0xbf, 0x30, 0x6d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x6e, 0x59, 0x59, 0x59, 0x69, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x48, 0xe1, 0x87, 0x12, 0xe3, 0x72, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x62, 0x57, 0x59, 0xdb, 0x94,
+  0x88, 0x0e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x67, 0xec, 0xec, 0xec, 0x9f, 0x8c, 0x07, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x5e, 0x10, 0x10, 0x93, 0x05, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0x99, 0xff,
+  0xb8, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb1, 0x01, 0x97, 0xa2, 0x82, 0x06,
+  0xb3, 0xeb, 0xeb, 0x15, 0x70, 0x0d, 0xda, 0x8d, 0x0e, 0xd0, 0x00, 0x68,
+  0x6a, 0x1c, 0x62, 0x62, 0x70, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0xd3,
+  0x8b, 0x0f, 0x9e, 0x61, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x57, 0x2c,
+  0x2c, 0x70, 0x7c, 0x7c, 0x6f, 0xbf, 0x8b, 0x0e, 0x94, 0x5d, 0x7c, 0x7c,
+  0x7c, 0x75, 0x39, 0x39, 0x9c, 0x80, 0x99, 0x19, 0x7c, 0x7c, 0x30, 0x8d,
+  0x04, 0xb8, 0xc2, 0xc2, 0xc2, 0xbb, 0x83, 0x04, 0xfa, 0x7c, 0x7c, 0x54,
+  0x95, 0x94, 0x05, 0x94, 0x27, 0x74, 0x7c, 0x39, 0xbf, 0x95, 0x04, 0x06,
+  0x7c, 0x7c, 0x7c, 0xb5, 0x94, 0x06, 0x81, 0xd4, 0x7d, 0x7c, 0x70, 0xfe,
+  0x96, 0x94, 0x04, 0x8e, 0x7c, 0x7d, 0x7c, 0x9a, 0x95, 0x05, 0x8d, 0x45,
+  0x7d, 0x7f, 0x4a, 0x8e, 0x84, 0x01, 0xc6, 0xb9, 0x89, 0x11, 0xa8, 0xeb,
+  0x54, 0x70, 0x70, 0x71, 0x7c, 0x7c, 0x7d, 0x3e, 0x1c, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x77, 0x75, 0x88, 0x12, 0x58, 0x6c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x40, 0x1e,
+  0xd9, 0x87, 0x11, 0xe6, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x51, 0x2d, 0xae, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x8f, 0x89, 0x09, 0x1b,
+  0x7c, 0x63, 0xc9, 0xc6, 0x59, 0x7c, 0x51, 0xec, 0x99, 0x91, 0x07, 0xc2,
+  0x08, 0xaa, 0x80, 0x09, 0x7c, 0x7c, 0xf9, 0x97, 0x03, 0xc3, 0x7c, 0x7c,
+  0x05, 0x97, 0x03, 0x17, 0x7c, 0x54, 0xa2, 0x97, 0x02, 0xf8, 0x6e, 0x11,
+  0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x9a, 0x09, 0x82, 0x87, 0xeb, 0x2d,
+  0x7f, 0x7f, 0x4b, 0xcc, 0x87, 0x81, 0x90, 0x0a, 0xe5, 0x28, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x43, 0x83, 0x8e, 0x0c, 0x9d, 0x0f, 0x60,
+  0x7d, 0x7d, 0x6e, 0x03, 0x23, 0x7d, 0x7d, 0x7d, 0x3b, 0x83, 0x8d, 0x0c,
+  0xe3, 0x29, 0x7d, 0x7d, 0x77, 0x03, 0x94, 0xb4, 0x3b, 0x7d, 0x7d, 0x72,
+  0xbe, 0x8c, 0x0d, 0x94, 0xef, 0x5c, 0x68, 0x5e, 0x03, 0xc8, 0x8a, 0xc7,
+  0x3d, 0x7d, 0x7d, 0x61, 0xc0, 0x8c, 0x04, 0x96, 0x29, 0x7d, 0x7d, 0x0c,
+  0x81, 0x06, 0x8b, 0xe5, 0x7d, 0x7d, 0x7d, 0x2c, 0x89, 0x8d, 0x04, 0x15,
+  0x7d, 0x7d, 0x0e, 0x9b, 0x81, 0x05, 0xda, 0x7d, 0x7d, 0x6e, 0xe8, 0x8b,
+  0x8d, 0x0b, 0x8a, 0x48, 0x7d, 0x6b, 0xcd, 0x90, 0x9c, 0x20, 0x6a, 0x7d,
+  0x2d, 0xb5, 0x8f, 0x0a, 0x8a, 0x48, 0x7d, 0x7d, 0x7d, 0x4b, 0x34, 0x6a,
+  0x7d, 0x48, 0x8f, 0x91, 0x08, 0xa8, 0x17, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x6c, 0xcb, 0x93, 0x07, 0x88, 0xbd, 0x3c, 0x7d, 0x7d, 0x7d, 0x6d, 0xaa,
+  0x8f, 0x02, 0xc2, 0x47, 0x13, 0x81, 0x07, 0x9e, 0x6b, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x2e, 0x8f, 0x8e, 0x0c, 0x82, 0xb1, 0x96, 0x80, 0x90, 0x37, 0x7d,
+  0x65, 0xc8, 0x1f, 0x7d, 0x7d, 0xd9, 0x92, 0x08, 0x01, 0x6e, 0x7d, 0xed,
+  0x8d, 0xa9, 0x68, 0x7d, 0xf0, 0x90, 0x0a, 0x87, 0x26, 0x6f, 0x7d, 0xee,
+  0x8c, 0x80, 0x20, 0x75, 0x62, 0xb1, 0x90, 0x09, 0x93, 0x7d, 0x7d, 0x5c,
+  0x8b, 0x80, 0x96, 0x54, 0x7d, 0x33, 0x91, 0x09, 0x03, 0x7d, 0x61, 0x95,
+  0x80, 0x95, 0x47, 0x7d, 0x61, 0xac, 0x90, 0x09, 0x87, 0x45, 0x7d, 0x21,
+  0x80, 0x1c, 0x6f, 0x7d, 0x7d, 0xc6, 0x91, 0x09, 0x87, 0x0b, 0x7d, 0x7c,
+  0x72, 0x79, 0x7d, 0x7d, 0xcc, 0x83, 0x92, 0x07, 0x8a, 0x4a, 0x7d, 0x7d,
+  0x7d, 0x10, 0x85, 0x82, 0xe0, 0x00, 0x00, 0x00, 0x80, 0xad, 0x02, 0xad,
+  0x6b, 0x1e, 0x96, 0x04, 0x84, 0xef, 0x68, 0x7e, 0xa5, 0x95, 0x05, 0xa4,
+  0x2d, 0x7e, 0x79, 0x41, 0x90, 0x94, 0x04, 0x92, 0x0e, 0x7e, 0x7e, 0x21,
+  0x94, 0x06, 0x86, 0xb8, 0x62, 0x7e, 0x7e, 0x04, 0x93, 0x94, 0x05, 0xbf,
+  0x7e, 0x7e, 0x75, 0xfb, 0x94, 0x94, 0x04, 0xaf, 0x61, 0x7e, 0x75, 0xe3,
+  0x95, 0x04, 0x87, 0x34, 0x7e, 0x7e, 0xf1, 0x95, 0x05, 0x86, 0x0d, 0x7e,
+  0x7e, 0x3f, 0x96, 0x95, 0x04, 0xb8, 0x7e, 0x7e, 0x5e, 0x96, 0x95, 0x04,
+  0xee, 0x65, 0x7e, 0x74, 0xde, 0x95, 0x04, 0x84, 0x30, 0x7e, 0x7e, 0xf8,
+  0x96, 0x04, 0xb5, 0x7e, 0x7e, 0x3d, 0x92, 0x85, 0x06, 0x9a, 0xd2, 0x3c,
+  0x4e, 0x4e, 0xda, 0xac, 0x88, 0x04, 0x83, 0x31, 0x7e, 0x6a, 0x91, 0x83,
+  0x09, 0xc1, 0xfa, 0x54, 0x62, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x08, 0x88,
+  0x03, 0x87, 0x7e, 0x7e, 0x65, 0x81, 0x0c, 0x91, 0xde, 0x36, 0x75, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x08, 0x88, 0x12, 0x87, 0x7e,
+  0x7e, 0x65, 0x80, 0xc0, 0x3b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x52, 0xd3, 0x88, 0x11, 0x87, 0x7e, 0x7e, 0x70, 0xfa,
+  0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x1e,
+  0x96, 0x89, 0x10, 0x84, 0x4b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x1e, 0xa1, 0x82, 0x8b, 0x0d, 0xd0, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x5c, 0x08, 0xa1, 0x82,
+  0x8d, 0x0a, 0x81, 0xcc, 0x0e, 0x7f, 0x7f, 0x7f, 0x29, 0x02, 0xe4, 0x86,
+  0x84, 0xff, 0xcd, 0x00, 0x80, 0xfc, 0x0a, 0xa1, 0xe0, 0xda, 0xfd, 0xfd,
+  0x0d, 0x7e, 0x7e, 0x7e, 0x38, 0xbd, 0x8d, 0x0d, 0xa8, 0x1e, 0x78, 0x79,
+  0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0x8c, 0x0e,
+  0xa9, 0x62, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x30, 0x0e, 0x0e, 0x19, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x8c, 0x07, 0xb6, 0x6e, 0x7d, 0x7d, 0x2c, 0xb4, 0x93,
+  0x86, 0x81, 0x04, 0x13, 0x7d, 0x7d, 0x7a, 0xd2, 0x8d, 0x03, 0x96, 0x99,
+  0x99, 0x86, 0x82, 0x05, 0xd6, 0x64, 0x74, 0x7d, 0x3f, 0x99, 0x94, 0x05,
+  0xd8, 0x73, 0x7d, 0x7d, 0x76, 0xc7, 0x93, 0x06, 0x94, 0x33, 0x72, 0x7d,
+  0x72, 0x1b, 0xa3, 0x93, 0x05, 0xdf, 0x5b, 0x7d, 0x7d, 0x34, 0xa7, 0x93,
+  0x06, 0xbc, 0x30, 0x72, 0x7d, 0x53, 0xb3, 0x91, 0x93, 0x05, 0xe4, 0x73,
+  0x7d, 0x7d, 0x2e, 0xae, 0x93, 0x0b, 0xb6, 0x2d, 0x74, 0x7d, 0x7d, 0x7d,
+  0xed, 0xbb, 0xbb, 0xbb, 0xbb, 0xb5, 0x8e, 0x0d, 0x29, 0x76, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x28, 0x8c, 0x0f,
+  0xce, 0x78, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x77, 0xcd, 0x8b, 0x10, 0xa5, 0x4d, 0x56, 0x56, 0xe8, 0xd4,
+  0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xea, 0x7d, 0x7d, 0x4e, 0xce, 0x94,
+  0x06, 0x86, 0xa1, 0x00, 0x7d, 0x7d, 0x75, 0xaa, 0x91, 0x08, 0x95, 0x9b,
+  0xb6, 0x2e, 0x7d, 0x7d, 0x7d, 0x7b, 0x14, 0x89, 0x10, 0x94, 0x13, 0xd5,
+  0x80, 0x92, 0x8a, 0xc0, 0x16, 0x16, 0x66, 0x7d, 0x7d, 0x7d, 0x7d, 0x71,
+  0x19, 0xe0, 0x8a, 0x0e, 0x7e, 0x7d, 0x4d, 0x0f, 0x72, 0x45, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x5c, 0xa8, 0x8c, 0x0c, 0x7e, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x77, 0x77, 0x4e, 0xf5, 0xf5, 0xf5, 0xf5, 0xa4, 0x8e, 0x05,
+  0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0x90, 0xff, 0x81, 0x80, 0xff, 0xd1, 0x08,
+  0x8d, 0x05, 0x05, 0x56, 0x7e, 0x7e, 0x7e, 0xae, 0x82, 0x90, 0x0a, 0xcb,
+  0x11, 0x4b, 0x7d, 0x7d, 0x7d, 0x7d, 0x6b, 0x79, 0x4f, 0x98, 0x8e, 0x0c,
+  0xb5, 0x1d, 0x75, 0x7d, 0x7e, 0x7a, 0x59, 0x42, 0xe0, 0xba, 0x65, 0x7d,
+  0xd7, 0x8d, 0x06, 0x02, 0x46, 0x7d, 0x7d, 0x7d, 0x5f, 0xcc, 0x82, 0x04,
+  0xb1, 0x6e, 0x7d, 0xec, 0x9a, 0x8a, 0x07, 0x8c, 0x13, 0x6c, 0x7d, 0x7d,
+  0x63, 0xcd, 0xa3, 0x82, 0x05, 0xac, 0x2e, 0x7d, 0x7d, 0x7d, 0x21, 0x89,
+  0x06, 0x9c, 0x4d, 0x7d, 0x7d, 0x7d, 0xd7, 0xa2, 0x81, 0x08, 0x87, 0x14,
+  0x42, 0x6c, 0x7d, 0x7d, 0x7d, 0x7d, 0x20, 0x88, 0x12, 0xbd, 0x55, 0x7d,
+  0x7d, 0x08, 0xb0, 0x87, 0xa5, 0x0f, 0x4f, 0x52, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xa2, 0x87, 0x13, 0xf4, 0x6e, 0x7d, 0x7d, 0x60, 0xfb,
+  0x09, 0x5a, 0x69, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xe6, 0x82, 0x87, 0x12, 0x3f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x45, 0x10, 0xc5, 0xaf, 0x5e, 0x7d, 0x7d, 0x25, 0x8e, 0x88,
+  0x0a, 0x3f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x55, 0x04, 0x96, 0x8b, 0x86,
+  0x81, 0x04, 0xaf, 0x7a, 0x7d, 0x55, 0x98, 0x89, 0x04, 0x39, 0x72, 0x61,
+  0xfa, 0xa3, 0x86, 0x04, 0xab, 0x7e, 0x7e, 0x75, 0xae, 0x95, 0x04, 0x8e,
+  0x27, 0x7d, 0x77, 0xb6, 0x95, 0x04, 0x94, 0x21, 0x7d, 0x76, 0xec, 0x95,
+  0x04, 0x98, 0xe3, 0x7d, 0x76, 0x25, 0x96, 0x03, 0xdd, 0x7e, 0x77, 0x25,
+  0x96, 0x03, 0xa0, 0x75, 0x7b, 0x23, 0x97, 0x03, 0x15, 0x7d, 0x78, 0xb4,
+  0x97, 0x02, 0x2c, 0x7d, 0x15, 0x98, 0x02, 0x2c, 0x7d, 0x28, 0x98, 0x02,
+  0x8a, 0x00, 0xfa, 0xa8, 0x80, 0xff, 0x97, 0x0a, 0x85, 0x87, 0x87, 0x87,
+  0xee, 0x02, 0x70, 0x7e, 0x7e, 0x45, 0x83, 0x8d, 0x0d, 0x89, 0xa5, 0x08,
+  0x5e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x85, 0x8c,
+  0x0e, 0x96, 0x58, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x6e, 0x6b, 0x6b, 0xfe,
+  0x70, 0x7d, 0x7d, 0x85, 0x8c, 0x07, 0xa6, 0x7d, 0x78, 0x64, 0x46, 0xe9,
+  0xe9, 0x94, 0x81, 0x04, 0x8a, 0x68, 0x7d, 0x2c, 0x83, 0x8c, 0x02, 0x8f,
+  0xe3, 0xcf, 0x86, 0x03, 0xf3, 0x7d, 0x7d, 0x8c, 0x96, 0x04, 0xbc, 0x72,
+  0x7d, 0x36, 0x85, 0x95, 0x04, 0x8f, 0x35, 0x7d, 0x6b, 0xb9, 0x95, 0x04,
+  0x90, 0x34, 0x7d, 0x7d, 0xfc, 0x96, 0x04, 0x29, 0x7d, 0x7d, 0x4c, 0x93,
+  0x95, 0x04, 0xb7, 0x70, 0x7d, 0x66, 0x97, 0x95, 0x08, 0x93, 0x37, 0x7d,
+  0x7d, 0xff, 0x9b, 0xc5, 0xc5, 0xa5, 0x90, 0x0a, 0x91, 0xcb, 0x37, 0x7d,
+  0x7d, 0x7d, 0x4e, 0x5c, 0x7d, 0x7d, 0xa7, 0x8c, 0x0e, 0x8a, 0xd1, 0xe7,
+  0x4d, 0x57, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x34, 0xba, 0x83,
+  0x8a, 0x0e, 0xb2, 0x20, 0x58, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x37, 0x26, 0xf9, 0xab, 0x84, 0x8a, 0x0c, 0xb1, 0x20, 0x6e, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x64, 0xbf, 0x87, 0x8e, 0x0a, 0x02, 0x7d,
+  0x7d, 0x7d, 0x71, 0x1a, 0xc8, 0x37, 0x7d, 0x65, 0xb4, 0x90, 0x09, 0xcd,
+  0x14, 0x14, 0xcb, 0x95, 0x80, 0xdc, 0x76, 0x7d, 0xcf, 0x97, 0x03, 0x27,
+  0x7d, 0x65, 0xa6, 0x97, 0x02, 0x27, 0x7d, 0x0b, 0x98, 0x02, 0x27, 0x7d,
+  0xca, 0xe3, 0x00, 0x00, 0x80, 0xff, 0x9e, 0x03, 0x83, 0x1e, 0x7f, 0x14,
+  0x96, 0x04, 0xb2, 0x30, 0x7d, 0x05, 0xc5, 0x94, 0x05, 0x86, 0xf5, 0x68,
+  0x7d, 0x40, 0x8e, 0x95, 0x04, 0xd1, 0x7d, 0x7d, 0x4a, 0x8f, 0x95, 0x04,
+  0xb6, 0x66, 0x7d, 0x73, 0xd6, 0x96, 0x03, 0x3a, 0x7d, 0x7d, 0xde, 0x95,
+  0x05, 0x9e, 0xc7, 0x67, 0x72, 0x2d, 0x91, 0x93, 0x05, 0xb2, 0x2e, 0x64,
+  0x7d, 0x7d, 0x39, 0x94, 0x06, 0x90, 0x2b, 0x12, 0x7d, 0x7d, 0x70, 0xd4,
+  0x96, 0x03, 0x06, 0x7d, 0x7d, 0xe5, 0x96, 0x04, 0xbe, 0x69, 0x7d, 0x53,
+  0x91, 0x95, 0x04, 0x99, 0x69, 0x7d, 0x56, 0xab, 0x96, 0x03, 0xc7, 0x7d,
+  0x7d, 0x24, 0x96, 0x04, 0xc0, 0x6d, 0x7d, 0x44, 0xb5, 0x96, 0x03, 0x15,
+  0x7d, 0x7d, 0xd6, 0x97, 0x03, 0x15, 0x7d, 0x5c, 0x8b, 0x97, 0x02, 0x15,
+  0x7d, 0x58, 0x98, 0x02, 0x15, 0x7d, 0x58, 0x98, 0x04, 0xdc, 0x7d, 0x7c,
+  0x20, 0xdf, 0x96, 0x04, 0x81, 0xd2, 0x50, 0x7d, 0x0f, 0xe1, 0x00, 0x00,
+  0x80, 0xff, 0xb8, 0x05, 0xe8, 0x7e, 0x7e, 0x7e, 0x34, 0xfa, 0x93, 0x08,
+  0xf0, 0x78, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7a, 0xf6, 0x90, 0x0a, 0x3b,
+  0x71, 0x7a, 0x7d, 0x7d, 0x7d, 0xe9, 0x96, 0x14, 0x7d, 0x3a, 0x8e, 0x0c,
+  0xa1, 0x51, 0x79, 0x7d, 0x7d, 0x6a, 0xbe, 0x93, 0x87, 0x80, 0xcc, 0x4d,
+  0x04, 0x8c, 0x07, 0xa4, 0x51, 0x6c, 0x7d, 0x7d, 0x48, 0x99, 0x95, 0x83,
+  0x02, 0xb8, 0xed, 0x8d, 0x8b, 0x06, 0xd6, 0x69, 0x7d, 0x7d, 0x7d, 0xd2,
+  0x99, 0x83, 0x03, 0x09, 0x5e, 0x70, 0x33, 0x8b, 0x06, 0xd9, 0x66, 0x7d,
+  0x7d, 0x3a, 0xa6, 0x89, 0x82, 0x05, 0xa2, 0x57, 0x6f, 0x7d, 0x7d, 0x07,
+  0x8a, 0x05, 0x47, 0x63, 0x7d, 0x7d, 0xcc, 0x9f, 0x82, 0x07, 0xb9, 0x29,
+  0x58, 0x7d, 0x7d, 0x7d, 0x72, 0x95, 0x89, 0x05, 0xdf, 0x7b, 0x7d, 0x4b,
+  0xbc, 0x88, 0x81, 0x08, 0x93, 0x29, 0x6f, 0x7d, 0x7d, 0x7d, 0x7d, 0x73,
+  0xd0, 0x89, 0x11, 0xe1, 0x5e, 0x7d, 0x47, 0xfb, 0xc9, 0xc2, 0xea, 0x44,
+  0x52, 0x7d, 0x7d, 0x5b, 0x7d, 0x7d, 0x7d, 0x09, 0x99, 0x89, 0x10, 0x3f,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x33, 0xc1, 0x22,
+  0x7d, 0x7d, 0x26, 0x9b, 0x8a, 0x0f, 0x26, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x52, 0x24, 0xc7, 0x92, 0x04, 0x68, 0x7d, 0x66, 0xc0, 0x8c, 0x06,
+  0x08, 0x4f, 0x4f, 0x1d, 0xce, 0xce, 0x8e, 0x81, 0x04, 0xa9, 0x68, 0x7d,
+  0x69, 0xd4, 0x95, 0x05, 0xac, 0x3d, 0x7d, 0x5f, 0xd4, 0x9e, 0x94, 0x04,
+  0xa6, 0x33, 0x7d, 0x7d, 0xfc, 0x96, 0x04, 0xfe, 0x67, 0x7d, 0x0c, 0x9e,
+  0x95, 0x04, 0xaf, 0x68, 0x7d, 0x17, 0x9d, 0x96, 0x03, 0x11, 0x7d, 0x58,
+  0xd5, 0x97, 0x02, 0x11, 0x7d, 0xf9, 0x98, 0x02, 0xcf, 0x7d, 0xf9, 0xc5,
+  0x80, 0xff, 0x97, 0x0a, 0x82, 0x87, 0x87, 0xec, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x86, 0x8f, 0x0b, 0xa5, 0x26, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x45, 0x8e, 0x0c, 0x99, 0x59, 0x7e, 0x7e, 0x7e,
+  0x6f, 0x6c, 0x6c, 0x6c, 0x6c, 0x7d, 0x7e, 0x7f, 0x8f, 0x04, 0x28, 0x7e,
+  0x78, 0x41, 0x95, 0x81, 0x04, 0x8a, 0x0a, 0x77, 0x7e, 0x29, 0x8f, 0x02,
+  0x96, 0xe3, 0xc9, 0x82, 0x05, 0x9b, 0x34, 0x7e, 0x7e, 0x61, 0x85, 0x93,
+  0x06, 0x9f, 0x0d, 0x71, 0x7e, 0x6f, 0x22, 0x85, 0x92, 0x06, 0xa2, 0x0d,
+  0x6e, 0x7e, 0x7e, 0x58, 0xbe, 0x92, 0x07, 0x8c, 0xd1, 0x6b, 0x7e, 0x7e,
+  0x6d, 0x1f, 0x8a, 0x91, 0x07, 0x8a, 0xd1, 0x45, 0x7e, 0x7e, 0x6e, 0x1e,
+  0xb1, 0x92, 0x06, 0x9c, 0x47, 0x7e, 0x7e, 0x7e, 0x7e, 0xf7, 0x94, 0x08,
+  0xa6, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x6c, 0x19, 0x8c, 0x92, 0x09, 0x89,
+  0x09, 0x33, 0x69, 0x7e, 0x7e, 0x7e, 0x7e, 0x26, 0x8b, 0x94, 0x06, 0xa3,
+  0xb1, 0xd3, 0x45, 0x7e, 0x7e, 0xa5, 0x97, 0x03, 0xf6, 0x7e, 0x7e, 0xa5,
+  0x96, 0x04, 0xc8, 0x5c, 0x7e, 0x7e, 0xa5, 0x94, 0x06, 0x97, 0x02, 0x77,
+  0x7e, 0x7e, 0x5c, 0x97, 0x8f, 0x0a, 0x8b, 0xeb, 0xfd, 0x67, 0x67, 0x6c,
+  0x7e, 0x7e, 0x7e, 0x5d, 0xa5, 0x8d, 0x0c, 0x83, 0xf7, 0x6d, 0x6f, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x29, 0xea, 0x8c, 0x8e, 0x0a, 0x75, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x2d, 0xed, 0x8c, 0x83, 0x90, 0x07, 0x02,
+  0x02, 0x02, 0xf6, 0x86, 0x86, 0x86, 0x82, 0xe4, 0x80, 0xff, 0xd1, 0x08,
+  0x8d, 0xee, 0x34, 0x7e, 0x7e, 0x7f, 0x68, 0xea, 0x84, 0x8f, 0x0b, 0x92,
+  0xaf, 0x1a, 0x60, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xfd, 0x8e,
+  0x0c, 0xb0, 0x4f, 0x7d, 0x7d, 0x7d, 0x6d, 0x48, 0xdd, 0xd2, 0xe6, 0x7d,
+  0x7d, 0x11, 0x8c, 0x07, 0x94, 0xf1, 0x76, 0x7d, 0x7d, 0x50, 0xe4, 0xad,
+  0x82, 0x03, 0x9e, 0x7d, 0x7d, 0xb5, 0x8b, 0x06, 0xbd, 0x3e, 0x7d, 0x7d,
+  0x4f, 0xaf, 0x92, 0x84, 0x03, 0xff, 0x7d, 0x1e, 0x8a, 0x8a, 0x05, 0x8f,
+  0x4e, 0x7d, 0x7d, 0x1f, 0x94, 0x86, 0x02, 0x14, 0x21, 0x88, 0x8b, 0x0e,
+  0xa4, 0x7d, 0x7d, 0x7d, 0x74, 0x73, 0x68, 0xfd, 0x4f, 0x73, 0x73, 0x73,
+  0x73, 0x5c, 0x84, 0x8c, 0x0d, 0x90, 0x3f, 0x6c, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x60, 0x8f, 0x0b, 0x9b, 0xde, 0xde,
+  0xde, 0xde, 0xde, 0xde, 0xde, 0xee, 0x73, 0x7d, 0x60, 0x96, 0x04, 0x93,
+  0x3b, 0x7d, 0x7d, 0x0d, 0x96, 0x04, 0xf2, 0x7d, 0x7d, 0x50, 0x99, 0x95,
+  0x04, 0xdf, 0x74, 0x7d, 0x7d, 0xd0, 0x96, 0x04, 0x31, 0x7d, 0x7d, 0xe3,
+  0x81, 0x94, 0x05, 0x8d, 0x15, 0x7c, 0x7d, 0x47, 0x8b, 0x94, 0x05, 0x81,
+  0xeb, 0x7d, 0x7d, 0x50, 0x91, 0x95, 0x04, 0x9d, 0x7d, 0x7d, 0x72, 0xd9,
+  0x95, 0x04, 0x9c, 0x55, 0x7d, 0x73, 0xda, 0x95, 0x04, 0x9e, 0x52, 0x7d,
+  0x76, 0xd8, 0x96, 0x03, 0x08, 0x7d, 0x7b, 0xd4, 0x96, 0x03, 0xc3, 0x7a,
+  0x7d, 0xd2, 0xab, 0x00, 0x80, 0xcb, 0x03, 0xcb, 0x38, 0x59, 0xa3, 0x94,
+  0x05, 0x84, 0xbc, 0xe9, 0x70, 0x5d, 0xa5, 0x94, 0x05, 0x84, 0xf6, 0x7d,
+  0x7d, 0x7b, 0xf0, 0x95, 0x04, 0x03, 0x7d, 0x7d, 0x7d, 0x18, 0x94, 0x06,
+  0xad, 0x09, 0x78, 0x7d, 0x7d, 0x0e, 0x89, 0x93, 0x06, 0xb2, 0x5f, 0x7e,
+  0x7d, 0x7b, 0x18, 0x89, 0x93, 0x05, 0xb0, 0x62, 0x7d, 0x7e, 0x7d, 0x1e,
+  0x94, 0x06, 0xb0, 0x6c, 0x7d, 0x7d, 0x7e, 0xb7, 0x85, 0x93, 0x06, 0xb2,
+  0x62, 0x7d, 0x7d, 0x62, 0xbb, 0x8b, 0x93, 0x05, 0xad, 0x5f, 0x7d, 0x7d,
+  0x62, 0xab, 0x95, 0x0e, 0x24, 0x7e, 0x7e, 0x7e, 0xf9, 0x80, 0xea, 0xe9,
+  0x4a, 0x7e, 0x7e, 0x7e, 0x7e, 0x49, 0xd7, 0x8a, 0x11, 0x84, 0xbc, 0x4e,
+  0x7d, 0x7d, 0x7d, 0x75, 0x51, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x6b, 0xbe, 0x89, 0x11, 0x98, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7e, 0x71, 0x6e, 0x6e, 0x72, 0x7d, 0x7d, 0x7d, 0x6b, 0xbe, 0x88,
+  0x0a, 0x9d, 0x4e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x21, 0x05, 0x06, 0x97,
+  0x81, 0x04, 0x12, 0x7d, 0x7d, 0x7d, 0x50, 0x88, 0x08, 0xa0, 0xf6, 0x7d,
+  0x7d, 0x7d, 0x74, 0x32, 0xfe, 0x87, 0x82, 0x06, 0xb1, 0x12, 0x7a, 0x7d,
+  0x7d, 0x7d, 0x24, 0x88, 0x06, 0x9f, 0x5e, 0x7d, 0x7d, 0x7d, 0x71, 0xc7,
+  0x81, 0x09, 0x92, 0x9f, 0xc2, 0x63, 0x7d, 0x7d, 0x7d, 0x7d, 0x61, 0xb4,
+  0x88, 0x11, 0x07, 0x69, 0x7d, 0x7d, 0x7d, 0x6f, 0x06, 0x06, 0x06, 0x4d,
+  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x6d, 0xf7, 0x87, 0x89, 0x0f, 0x7f, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x52,
+  0xf8, 0x8c, 0x8b, 0x0d, 0x51, 0x75, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x6c, 0x50, 0x47, 0x9f, 0x8d, 0x0a, 0xbf, 0x6b, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x48, 0xe8, 0xe8, 0xbe, 0xff, 0xb3, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0x9c, 0x03, 0x86, 0x55, 0x7f, 0x9e, 0x97, 0x03, 0x4d, 0x7d,
+  0x7d, 0x9e, 0x96, 0x04, 0xab, 0x68, 0x7d, 0x7d, 0x9e, 0x95, 0x05, 0x87,
+  0x19, 0x7d, 0x7d, 0x46, 0x8d, 0x95, 0x04, 0xc5, 0x7d, 0x7d, 0x73, 0xd0,
+  0x96, 0x03, 0xd7, 0x7d, 0x7d, 0x26, 0x96, 0x04, 0xbf, 0x69, 0x7d, 0x6f,
+  0xce, 0x96, 0x03, 0x3a, 0x7d, 0x7d, 0xd8, 0x96, 0x04, 0xc4, 0x6a, 0x7d,
+  0x6d, 0xa6, 0x95, 0x04, 0xa5, 0x6a, 0x7d, 0x7d, 0x14, 0x96, 0x04, 0xd4,
+  0x7d, 0x7d, 0x49, 0x8e, 0x95, 0x04, 0xc7, 0x6c, 0x7d, 0x6b, 0xc6, 0x96,
+  0x03, 0x27, 0x7d, 0x7d, 0xdb, 0x96, 0x04, 0xa0, 0x6f, 0x7d, 0x6a, 0xad,
+  0x96, 0x03, 0xd4, 0x7d, 0x7d, 0x18, 0x96, 0x04, 0x9c, 0x72, 0x7d, 0x51,
+  0x89, 0x96, 0x03, 0xa0, 0x7d, 0x7d, 0xdc, 0x97, 0x03, 0xd6, 0x7d, 0x1e,
+  0x86, 0x97, 0x02, 0xe2, 0x7d, 0xd6, 0x98, 0x02, 0xa0, 0x7d, 0xd6, 0xe3,
+  0x80, 0xff, 0xb3, 0x01, 0x00, 0xc0, 0x81, 0x04, 0xc0, 0x00, 0x3f, 0x7f,
+  0xc0, 0x8f, 0x0b, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x8f, 0x0b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8f, 0x0b, 0x3f, 0x7f, 0x00, 0x3f, 0x00,
+  0x00, 0xc0, 0x80, 0x00, 0x7f, 0x7f, 0x00, 0x97, 0x02, 0x7f, 0x7f, 0x7f,
+  0x97, 0x03, 0xc0, 0x7f, 0x7f, 0x3f, 0x97, 0x03, 0x3f, 0x7f, 0x7f, 0xc0,
+  0x96, 0x03, 0x00, 0x7f, 0x7f, 0x00, 0x97, 0x03, 0x3f, 0x7f, 0x7f, 0xc0,
+  0x96, 0x03, 0xc0, 0x7f, 0x7f, 0x3f, 0x81, 0x02, 0x00, 0x00, 0x00, 0x92,
+  0x08, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x00, 0x8b, 0x0c,
+  0xc0, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x3f, 0x8d, 0x0b, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x3f, 0x00, 0x8e, 0x0a, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x00,
+  0x3f, 0x7f, 0x7f, 0x00, 0x90, 0x03, 0xc0, 0x7f, 0x00, 0xc0, 0x82, 0x03,
+  0x00, 0x7f, 0x7f, 0xc0, 0x97, 0x02, 0x3f, 0x7f, 0x00, 0x97, 0x02, 0xc0,
+  0x7f, 0x7f, 0x98, 0x02, 0x3f, 0x7f, 0x7f, 0x98, 0x02, 0x3f, 0x7f, 0x00,
+  0x98, 0x02, 0xc0, 0x7f, 0x00, 0xc5, 0x00, 0x00, 0x80, 0xfb, 0x0b, 0xd1,
+  0xe9, 0xea, 0x63, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x0a, 0xab, 0x8b,
+  0x0f, 0xb5, 0xce, 0x50, 0x50, 0x72, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0xe7, 0x89, 0x11, 0x93, 0x24, 0x72, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x6e, 0x6d, 0x0c, 0xd8, 0x04, 0x14, 0x75, 0x7c, 0x7c,
+  0xe7, 0x89, 0x07, 0x24, 0x7c, 0x58, 0x04, 0x44, 0x51, 0x04, 0x04, 0x84,
+  0x04, 0x8f, 0x3d, 0x7c, 0x7c, 0xe7, 0x89, 0x05, 0xf8, 0x7c, 0xae, 0x80,
+  0x90, 0x93, 0x85, 0x05, 0x97, 0x37, 0x7c, 0x7c, 0x28, 0x8c, 0x89, 0x02,
+  0x85, 0xca, 0x89, 0x88, 0x04, 0xdd, 0x7c, 0x7c, 0x71, 0xb4, 0x94, 0x05,
+  0x88, 0x06, 0x6e, 0x7c, 0x7c, 0xd4, 0x95, 0x05, 0x1c, 0x7c, 0x7c, 0x71,
+  0xd4, 0x81, 0x94, 0x04, 0xc9, 0x67, 0x7c, 0x42, 0xb4, 0x95, 0x04, 0x15,
+  0x6a, 0x7c, 0x35, 0xc9, 0x94, 0x04, 0xd1, 0x40, 0x7f, 0x64, 0x0c, 0x94,
+  0x05, 0xa0, 0xf1, 0x72, 0x7c, 0x64, 0xbb, 0x94, 0x05, 0x9d, 0x52, 0x7c,
+  0x7c, 0x73, 0xb5, 0x84, 0x03, 0x88, 0x8f, 0x01, 0xc3, 0x8b, 0x05, 0xea,
+  0x55, 0x7c, 0x7c, 0x20, 0xb7, 0x84, 0x04, 0xd5, 0x3d, 0x7c, 0x66, 0xb7,
+  0x89, 0x06, 0x85, 0x11, 0x78, 0x7c, 0x7c, 0x00, 0x87, 0x82, 0x06, 0xb1,
+  0x11, 0x5f, 0x73, 0x7c, 0x7c, 0xcb, 0x89, 0x11, 0x88, 0x03, 0x7c, 0x7c,
+  0x66, 0xca, 0x84, 0x86, 0x9e, 0xdc, 0x32, 0x62, 0x7c, 0x7c, 0x7c, 0x6c,
+  0x29, 0x91, 0x88, 0x10, 0xb8, 0x22, 0x7c, 0x7c, 0x7c, 0x6e, 0x06, 0x06,
+  0x1b, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x1c, 0xb8, 0x8a, 0x0f, 0xe9,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x76,
+  0x22, 0xf7, 0x84, 0x8b, 0x0c, 0xe9, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x6c, 0x4f, 0x4f, 0x50, 0xd4, 0xb7, 0x8e, 0x07, 0xe9, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x2c, 0xc3, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb2, 0x01,
+  0x82, 0x82, 0x86, 0x03, 0x83, 0x2a, 0x7f, 0x08, 0x8c, 0x03, 0x82, 0x9f,
+  0x1c, 0xd0, 0x85, 0x04, 0x85, 0x28, 0x7d, 0x78, 0xc4, 0x8b, 0x04, 0x82,
+  0xed, 0x7d, 0x7a, 0xca, 0x85, 0x03, 0xe7, 0x7d, 0x7d, 0x04, 0x8b, 0x04,
+  0x8b, 0x1f, 0x7d, 0x7a, 0x00, 0x85, 0x04, 0xc0, 0x6e, 0x7d, 0x67, 0x90,
+  0x8a, 0x04, 0x82, 0xed, 0x7d, 0x7d, 0x49, 0x85, 0x04, 0x8a, 0x58, 0x7d,
+  0x71, 0x95, 0x8b, 0x04, 0xdc, 0x7d, 0x7d, 0x57, 0xa2, 0x84, 0x04, 0x8b,
+  0x27, 0x7d, 0x7d, 0x07, 0x8c, 0x03, 0x08, 0x7d, 0x7d, 0xe3, 0x85, 0x07,
+  0xcb, 0x7d, 0x7d, 0x7d, 0x32, 0x27, 0x14, 0x86, 0x89, 0x10, 0x08, 0x7d,
+  0x7d, 0x00, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xd4, 0x45, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x50, 0xb6, 0x8a, 0x0f, 0x08, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x69, 0x14, 0x87, 0x8b, 0x0d, 0xab,
+  0x44, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x69, 0xd8,
+  0xab, 0x8e, 0x0a, 0x85, 0xbd, 0xfa, 0xd0, 0x39, 0xe4, 0xe8, 0x7d, 0x7d,
+  0x69, 0xc2, 0x96, 0x03, 0xdd, 0x7d, 0x7d, 0x0e, 0x96, 0x04, 0x90, 0x4b,
+  0x7d, 0x40, 0xa6, 0x96, 0x03, 0x19, 0x7d, 0x7d, 0xbd, 0x97, 0x03, 0x2e,
+  0x7d, 0x48, 0x89, 0x96, 0x03, 0x92, 0x4d, 0x67, 0xb8, 0x97, 0x02, 0xac,
+  0x7d, 0x45, 0x98, 0x02, 0xac, 0x7d, 0x45, 0x98, 0x02, 0xac, 0x7d, 0x0b,
+  0x98, 0x02, 0xac, 0x7d, 0xca, 0xc5, 0x00, 0x00, 0x80, 0xff, 0x9d, 0x02,
+  0x43, 0x7e, 0xd3, 0x90, 0x02, 0x90, 0x15, 0x0c, 0x83, 0x02, 0xd6, 0x7d,
+  0x61, 0x91, 0x02, 0x3b, 0x7e, 0x67, 0x83, 0x02, 0x68, 0x7e, 0x61, 0x90,
+  0x03, 0xe5, 0x77, 0x7e, 0x67, 0x82, 0x03, 0x9b, 0x6e, 0x7e, 0x08, 0x8f,
+  0x04, 0xbb, 0x76, 0x7e, 0x7c, 0xdf, 0x82, 0x03, 0x09, 0x7e, 0x7a, 0xc5,
+  0x8f, 0x03, 0xfa, 0x7e, 0x7e, 0x0f, 0x82, 0x03, 0xc5, 0x7a, 0x7e, 0x40,
+  0x8f, 0x04, 0x82, 0x40, 0x7e, 0x7e, 0xc8, 0x82, 0x07, 0xce, 0x7e, 0x7e,
+  0xfc, 0x80, 0x84, 0xdd, 0x0b, 0x8b, 0x04, 0xf9, 0x7e, 0x7e, 0x37, 0x85,
+  0x82, 0x07, 0x10, 0x7e, 0x7e, 0xd1, 0xde, 0x58, 0x7e, 0x20, 0x8b, 0x03,
+  0x2c, 0x7e, 0x7e, 0x9d, 0x82, 0x08, 0xba, 0x69, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x0a, 0x94, 0x8b, 0x0e, 0x2c, 0x7e, 0x7e, 0x3b, 0x32, 0x32, 0x32,
+  0x68, 0x7e, 0x7f, 0x7e, 0x7e, 0x5c, 0xf6, 0x96, 0x8c, 0x0c, 0x08, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x19, 0x99, 0x8e,
+  0x0b, 0x89, 0x1c, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x5b, 0xb4,
+  0x94, 0x90, 0x08, 0x87, 0xc1, 0x0d, 0x0d, 0xe1, 0x7e, 0x7e, 0x7e, 0xeb,
+  0x96, 0x04, 0x98, 0x7e, 0x7e, 0x57, 0x94, 0x96, 0x03, 0xde, 0x7e, 0x7f,
+  0x23, 0x96, 0x04, 0x84, 0x58, 0x7e, 0x73, 0xb0, 0x96, 0x03, 0xa5, 0x7e,
+  0x7e, 0x24, 0x97, 0x03, 0xd7, 0x7e, 0x7e, 0xcd, 0x97, 0x03, 0x84, 0x52,
+  0x7e, 0xcd, 0x98, 0x02, 0xd8, 0x7e, 0x3b, 0xe0, 0x80, 0xff, 0xf3, 0x07,
+  0xa4, 0xb2, 0x08, 0x1e, 0x64, 0x64, 0x64, 0x53, 0x90, 0x0a, 0xa0, 0xef,
+  0x43, 0x74, 0x7e, 0x7e, 0x77, 0x4c, 0x01, 0xbe, 0x9a, 0x8d, 0x09, 0x88,
+  0xef, 0x44, 0x78, 0x7e, 0x6d, 0x47, 0x0e, 0xb8, 0xaa, 0x8f, 0x07, 0x8c,
+  0xe6, 0x52, 0x7e, 0x7c, 0x46, 0xd2, 0x8f, 0x91, 0x06, 0x91, 0xe2, 0x52,
+  0x7e, 0x7e, 0x2a, 0xc4, 0x92, 0x07, 0xca, 0x76, 0x7c, 0x7e, 0x46, 0xf5,
+  0xa0, 0x81, 0x93, 0x04, 0x26, 0x7e, 0x7e, 0xeb, 0x84, 0x96, 0x04, 0x67,
+  0x7c, 0x7f, 0x56, 0x8a, 0x96, 0x04, 0x9f, 0xd7, 0x7b, 0x7e, 0x29, 0x98,
+  0x03, 0xd7, 0x7c, 0x79, 0xda, 0x98, 0x02, 0xf6, 0x7e, 0x1d, 0x98, 0x02,
+  0xc1, 0x7e, 0x39, 0x97, 0x03, 0x8e, 0x3f, 0x7e, 0x1c, 0x96, 0x04, 0xb4,
+  0x1c, 0x7e, 0x72, 0xa5, 0x95, 0x04, 0x4e, 0x7d, 0x7e, 0x50, 0xd3, 0x96,
+  0x03, 0xbb, 0x0a, 0xf9, 0x88, 0xff, 0x00, 0x00, 0x80, 0xff, 0xb1, 0x0b,
+  0x9f, 0xa2, 0xf4, 0x0f, 0x10, 0x0f, 0x0f, 0x49, 0x7d, 0x7d, 0x79, 0xf7,
+  0x8e, 0x0c, 0xbe, 0x76, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x50, 0x8e, 0x0c, 0xd9, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x62,
+  0x19, 0x19, 0x5a, 0x7c, 0x7c, 0x25, 0x8e, 0x0c, 0x84, 0x8f, 0xf9, 0xa7,
+  0x8a, 0x8a, 0x88, 0x80, 0x96, 0x53, 0x7c, 0x38, 0x84, 0x95, 0x04, 0x96,
+  0x4e, 0x7c, 0x69, 0xb7, 0x96, 0x03, 0x09, 0x7c, 0x7c, 0xce, 0x96, 0x04,
+  0x21, 0x79, 0x72, 0xec, 0x85, 0x95, 0x03, 0xa8, 0x5f, 0x7c, 0x53, 0x97,
+  0x03, 0x61, 0x7c, 0x33, 0xa0, 0x96, 0x03, 0xe1, 0x7d, 0x7c, 0xea, 0x92,
+  0x08, 0x96, 0xa2, 0xa2, 0xa2, 0xe5, 0x7d, 0x7f, 0x13, 0x86, 0x91, 0x0c,
+  0xfa, 0x62, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x3d, 0x26, 0xc3,
+  0x8f, 0x8d, 0x0e, 0xfe, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x5a, 0xed, 0x8c, 0x0e, 0x51, 0x7a, 0x66, 0x66,
+  0x07, 0x7c, 0x7c, 0x39, 0x8a, 0x8a, 0x8a, 0xf4, 0xb1, 0xe1, 0x8f, 0x8c,
+  0x01, 0x23, 0x04, 0x81, 0x03, 0xa4, 0x7c, 0x4a, 0x8c, 0x97, 0x02, 0x1f,
+  0x7c, 0x2f, 0x98, 0x02, 0x67, 0x7c, 0xcb, 0x98, 0x02, 0x67, 0x7c, 0xd5,
+  0x98, 0x02, 0xf5, 0x7c, 0x2f, 0x98, 0x02, 0x82, 0x26, 0x2f, 0xc6, 0x00,
+  0x80, 0xff, 0xb5, 0x06, 0xf8, 0x71, 0x71, 0x5a, 0x03, 0x61, 0xab, 0x92,
+  0x0a, 0xa1, 0x51, 0x79, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x72, 0x1d, 0xae,
+  0x8f, 0x0c, 0xcd, 0x6c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x6f, 0x1b, 0x8d, 0x0d, 0xd1, 0x55, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x6d, 0xcb, 0xf4, 0x2b, 0x7d, 0x7d, 0x77, 0x8c, 0x08, 0xa1, 0x68, 0x7d,
+  0x7d, 0x7d, 0x67, 0xc7, 0xa6, 0xa0, 0x81, 0x04, 0x92, 0x2f, 0x7d, 0x7c,
+  0xe9, 0x8a, 0x06, 0xd7, 0x62, 0x7d, 0x7d, 0x7d, 0x19, 0xa2, 0x85, 0x03,
+  0x94, 0x7d, 0x7d, 0x3e, 0x89, 0x06, 0xa0, 0x56, 0x7d, 0x7d, 0x65, 0xca,
+  0x8b, 0x86, 0x03, 0x94, 0x7d, 0x7d, 0xfb, 0x89, 0x04, 0x54, 0x7d, 0x7d,
+  0x7d, 0x06, 0x87, 0x04, 0x87, 0x13, 0x7d, 0x7c, 0xdc, 0x88, 0x05, 0xd8,
+  0x7a, 0x7d, 0x7d, 0xd8, 0x8a, 0x87, 0x03, 0xb9, 0x7d, 0x7d, 0x77, 0x88,
+  0x05, 0x9a, 0x55, 0x7d, 0x7d, 0x36, 0x89, 0x87, 0x04, 0xb3, 0x62, 0x7d,
+  0x7d, 0x77, 0x88, 0x04, 0xfd, 0x7d, 0x7d, 0x7d, 0x04, 0x85, 0x07, 0xa2,
+  0xc6, 0x30, 0x62, 0x7d, 0x7d, 0x63, 0x4a, 0x88, 0x04, 0x53, 0x7d, 0x7d,
+  0x23, 0x89, 0x83, 0x08, 0x9f, 0xc6, 0x66, 0x7d, 0x7d, 0x7d, 0x79, 0x4c,
+  0xa5, 0x89, 0x0f, 0x7f, 0x7d, 0x7d, 0xb1, 0xa1, 0xa1, 0xa1, 0xa1, 0x09,
+  0x69, 0x7d, 0x7d, 0x7d, 0x7d, 0x57, 0xd1, 0x8b, 0x0e, 0x71, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x78, 0x4b, 0xe1, 0xa3,
+  0x8c, 0x0b, 0xf3, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x77, 0x6a, 0x74,
+  0x6a, 0xf7, 0x90, 0x08, 0xec, 0x6a, 0x70, 0x70, 0x70, 0x70, 0xe3, 0x80,
+  0xb9, 0xff, 0xb4, 0x00, 0x80, 0xff, 0xeb, 0x0a, 0x81, 0xbf, 0x10, 0x10,
+  0x10, 0x11, 0x10, 0x10, 0xbe, 0x81, 0x81, 0x8f, 0x0b, 0xcf, 0x3f, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0xe2, 0x8c, 0x0f, 0x81,
+  0x06, 0x59, 0x72, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x72, 0xe7, 0x8a, 0x11, 0xaf, 0x35, 0x7c, 0x7c, 0x7c, 0x7c, 0x59,
+  0xdb, 0xc7, 0xc7, 0xc8, 0xc7, 0xdc, 0x57, 0x7d, 0x7c, 0x71, 0xce, 0x89,
+  0x05, 0x35, 0x7c, 0x7c, 0x7c, 0x7c, 0x28, 0x87, 0x03, 0x2a, 0x7c, 0x7c,
+  0x3e, 0x88, 0x05, 0x07, 0x7d, 0x7d, 0x7d, 0x7d, 0x1a, 0x88, 0x03, 0xaf,
+  0x69, 0x7d, 0x7d, 0x88, 0x05, 0x59, 0x7c, 0x7c, 0x7c, 0x67, 0xb3, 0x88,
+  0x03, 0xed, 0x7c, 0x7c, 0x7c, 0x87, 0x05, 0x90, 0x5e, 0x7c, 0x7c, 0x2e,
+  0xb3, 0x87, 0x05, 0x9b, 0xf8, 0x54, 0x7c, 0x7c, 0x14, 0x87, 0x04, 0x3f,
+  0x7c, 0x7c, 0x7c, 0xbe, 0x87, 0x06, 0xfd, 0x5d, 0x7c, 0x7d, 0x7c, 0x14,
+  0xae, 0x87, 0x03, 0x7f, 0x7d, 0x7d, 0xec, 0x83, 0x0a, 0xee, 0xed, 0x01,
+  0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x5e, 0xa9, 0x88, 0x11, 0x7d, 0x7c,
+  0x7c, 0x68, 0x59, 0x59, 0x59, 0x59, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x71, 0x33, 0xf7, 0x99, 0x89, 0x0e, 0x15, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x76, 0x57, 0x59, 0xdb, 0xbd, 0x8c, 0x0a, 0xaf,
+  0x68, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x3f, 0xec, 0xdc, 0x92, 0x04,
+  0xe9, 0x10, 0x10, 0x10, 0xa9, 0xff, 0xb7, 0x00, 0x80, 0xff, 0x9d, 0x03,
+  0xb5, 0x7f, 0x7d, 0xd7, 0x96, 0x04, 0xbf, 0x5d, 0x7d, 0x7b, 0x57, 0x94,
+  0x06, 0x95, 0xbf, 0x67, 0x7b, 0x72, 0x57, 0xb7, 0x94, 0x05, 0xd3, 0x6c,
+  0x7b, 0x7b, 0x54, 0xaf, 0x95, 0x05, 0xe9, 0x71, 0x7b, 0x7b, 0x7d, 0xeb,
+  0x94, 0x05, 0xfd, 0x7d, 0x7d, 0x7d, 0x7d, 0x02, 0x94, 0x05, 0xe9, 0x7d,
+  0x7b, 0x7b, 0x3c, 0xeb, 0x94, 0x06, 0x90, 0x3e, 0x7d, 0x7b, 0x7b, 0x5c,
+  0xb3, 0x93, 0x06, 0xde, 0x2a, 0x7b, 0x7d, 0x7b, 0x6b, 0xd2, 0x94, 0x05,
+  0xd7, 0x7b, 0x7b, 0x7d, 0x7b, 0x57, 0x94, 0x06, 0xaa, 0x64, 0x7d, 0x7d,
+  0x7f, 0x53, 0x99, 0x93, 0x06, 0xaa, 0x4e, 0x7b, 0x7b, 0x7b, 0x53, 0xae,
+  0x94, 0x05, 0xc9, 0x7b, 0x7b, 0x7b, 0x61, 0x99, 0x95, 0x04, 0x16, 0x7b,
+  0x7b, 0x4c, 0xa9, 0x96, 0x03, 0x7d, 0x7b, 0x7b, 0x0e, 0x95, 0x04, 0xee,
+  0x7d, 0x7f, 0x7d, 0x24, 0x96, 0x04, 0xed, 0x7b, 0x7d, 0x7b, 0xa3, 0x95,
+  0x05, 0x9b, 0x53, 0x7b, 0x49, 0xb2, 0x85, 0x96, 0x03, 0xed, 0x7b, 0x5d,
+  0xbd, 0x96, 0x03, 0x1c, 0x53, 0xfa, 0xb3, 0xe5, 0x80, 0xcb, 0x03, 0xa7,
+  0x61, 0x7f, 0x6a, 0x95, 0x05, 0xb0, 0x63, 0x70, 0x7d, 0x6d, 0xc6, 0x94,
+  0x05, 0xb0, 0x69, 0x7d, 0x7d, 0x41, 0xca, 0x93, 0x06, 0xa9, 0x11, 0x63,
+  0x7d, 0x7d, 0x20, 0x8d, 0x93, 0x06, 0xc2, 0x67, 0x7d, 0x7d, 0x6c, 0xd9,
+  0x8b, 0x92, 0x06, 0x86, 0xbf, 0x6a, 0x7d, 0x7d, 0x72, 0xb5, 0x94, 0x05,
+  0xef, 0x7d, 0x7d, 0x7d, 0x28, 0xb5, 0x93, 0x06, 0x86, 0xef, 0x77, 0x7d,
+  0x7d, 0x12, 0x82, 0x94, 0x05, 0xbf, 0x7d, 0x7d, 0x7d, 0x0f, 0x87, 0x94,
+  0x05, 0xc2, 0x6a, 0x7d, 0x7d, 0x0f, 0x89, 0x94, 0x05, 0x8b, 0x3b, 0x7d,
+  0x7d, 0x2c, 0x87, 0x94, 0x0d, 0x89, 0x17, 0x7d, 0x7d, 0x7d, 0x57, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0xe2, 0x9c, 0x84, 0x8d, 0x0d, 0xcc, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xf0, 0x8d,
+  0x0e, 0xcc, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x53, 0x9b, 0x8b, 0x0f, 0xa8, 0x5f, 0x7d, 0x7d, 0x78, 0x16,
+  0x90, 0x8d, 0x8d, 0x8d, 0x8d, 0xde, 0x7d, 0x7d, 0x7d, 0xb6, 0x8b, 0x04,
+  0x0d, 0x7d, 0x7d, 0x7d, 0xf8, 0x84, 0x05, 0x89, 0x22, 0x7d, 0x7d, 0x35,
+  0x88, 0x8b, 0x0e, 0x6a, 0x7d, 0x7d, 0x7d, 0x0b, 0x9f, 0x9b, 0xbf, 0xbf,
+  0xd9, 0x4d, 0x7d, 0x7d, 0x64, 0x01, 0x8c, 0x0d, 0x6a, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x57, 0x53, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x69, 0xb3, 0x8d, 0x0c,
+  0x0c, 0x74, 0x6d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0x68, 0x1a,
+  0xb1, 0x8f, 0x08, 0xbf, 0x9a, 0xf4, 0x46, 0x7d, 0x7d, 0x7d, 0x58, 0xde,
+  0xff, 0xb3, 0x00, 0x00, 0x80, 0xcb, 0x03, 0x9a, 0x0e, 0x7f, 0x31, 0x97,
+  0x03, 0x35, 0x7d, 0x7d, 0xeb, 0x95, 0x05, 0x9e, 0x48, 0x77, 0x7d, 0x33,
+  0x8b, 0x94, 0x05, 0xc9, 0x4e, 0x7d, 0x7d, 0x30, 0x8f, 0x94, 0x05, 0xf9,
+  0x78, 0x7d, 0x7d, 0x2f, 0x91, 0x94, 0x05, 0xf6, 0x7a, 0x7d, 0x6c, 0x24,
+  0x92, 0x93, 0x05, 0x8a, 0x2e, 0x7e, 0x7d, 0x6e, 0xcb, 0x94, 0x05, 0x92,
+  0xee, 0x7d, 0x7e, 0x72, 0xc8, 0x93, 0x06, 0x83, 0x8e, 0x25, 0x7d, 0x7d,
+  0x31, 0xbe, 0x94, 0x04, 0xb6, 0x7d, 0x7d, 0x7d, 0x7d, 0x95, 0x04, 0xa0,
+  0x5c, 0x7e, 0x7e, 0x71, 0x82, 0x03, 0xad, 0xf9, 0xf9, 0xa0, 0x8e, 0x0d,
+  0xa3, 0x59, 0x7d, 0x7d, 0xe5, 0x8c, 0x80, 0xb4, 0x6b, 0x76, 0x7d, 0x7d,
+  0x74, 0x04, 0x8c, 0x05, 0xa3, 0x57, 0x7d, 0x7d, 0x27, 0x8a, 0x81, 0x07,
+  0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0xd4, 0x8a, 0x10, 0xcd, 0x57,
+  0x7d, 0x7d, 0x25, 0x99, 0xdf, 0x0f, 0x56, 0x7e, 0x30, 0x2d, 0x2d, 0x42,
+  0x7d, 0x7d, 0xdd, 0x8a, 0x10, 0x71, 0x7d, 0x7d, 0x7d, 0x0f, 0x51, 0x7d,
+  0x7d, 0x5a, 0xfc, 0x83, 0x80, 0xe4, 0x57, 0x7d, 0x73, 0xc5, 0x8a, 0x0f,
+  0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x5b, 0xfa, 0x9f, 0x80, 0x97, 0x2e,
+  0x73, 0x7d, 0x72, 0xe2, 0x8b, 0x0e, 0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x68,
+  0xb0, 0xa9, 0xa9, 0x2f, 0x4f, 0x7d, 0x7d, 0x73, 0xe2, 0x8b, 0x0e, 0xc0,
+  0x69, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x4c, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d,
+  0xf6, 0xc5, 0x8d, 0x0c, 0xad, 0x67, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x78, 0x70, 0xf8, 0x91, 0x8f, 0x08, 0xde, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x6f, 0xf8, 0xf8, 0xc0, 0xff, 0xb3, 0x00, 0x00, 0x80, 0xff, 0x9b, 0x07,
+  0x85, 0xef, 0x10, 0x7a, 0x36, 0x10, 0xab, 0x9c, 0x91, 0x0a, 0x95, 0xf3,
+  0x3c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x70, 0xfc, 0x8e, 0x0c, 0xb0,
+  0x27, 0x5f, 0x7d, 0x7e, 0x38, 0x1a, 0xe1, 0xac, 0x02, 0x4a, 0x7d, 0xd5,
+  0x8c, 0x07, 0x85, 0xbd, 0x6f, 0x7d, 0x77, 0x37, 0xbb, 0x84, 0x83, 0x02,
+  0x9e, 0x52, 0x2b, 0x8b, 0x05, 0x85, 0x13, 0x7d, 0x7b, 0x46, 0xda, 0x83,
+  0x05, 0x85, 0xb8, 0x0e, 0x76, 0x7d, 0x18, 0x8b, 0x03, 0xbd, 0x7d, 0x7d,
+  0x4c, 0x85, 0x05, 0x14, 0x7d, 0x7d, 0x7d, 0x47, 0xab, 0x8a, 0x04, 0x85,
+  0x6b, 0x7d, 0x27, 0x8b, 0x82, 0x07, 0x87, 0xa9, 0x55, 0x7d, 0x76, 0x72,
+  0xd8, 0x89, 0x8b, 0x04, 0xd3, 0x68, 0x7d, 0xda, 0x98, 0x82, 0x04, 0x23,
+  0x7d, 0x7d, 0x70, 0xa3, 0x8f, 0x03, 0xac, 0x63, 0x7d, 0x56, 0x81, 0x04,
+  0xf5, 0x7f, 0x7d, 0x5f, 0xf1, 0x90, 0x09, 0x8a, 0x1c, 0x7d, 0x7c, 0x2d,
+  0x5d, 0x79, 0x7e, 0x13, 0x94, 0x93, 0x05, 0xa7, 0x73, 0x7e, 0x7e, 0x7e,
+  0x11, 0x94, 0x05, 0x8f, 0xea, 0x77, 0x7d, 0x7d, 0x13, 0x95, 0x05, 0x13,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x58, 0x93, 0x08, 0x89, 0xda, 0x7a, 0x76, 0x2d,
+  0x8e, 0x44, 0x74, 0xb1, 0x92, 0x08, 0xe4, 0x7d, 0x7d, 0xf5, 0x80, 0xa3,
+  0x6f, 0x27, 0x99, 0x91, 0x04, 0x98, 0x4a, 0x7d, 0x43, 0xbc, 0x81, 0x02,
+  0x3c, 0x7d, 0xc9, 0x91, 0x08, 0x23, 0x7d, 0x69, 0x88, 0x80, 0x86, 0x3d,
+  0x78, 0xe8, 0x92, 0x08, 0xc3, 0x7d, 0x3b, 0xad, 0xd4, 0x1f, 0x7d, 0x7d,
+  0xfc, 0x92, 0x08, 0xe5, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x70, 0x0e, 0x89,
+  0x92, 0x06, 0x97, 0xfd, 0x79, 0x65, 0x0f, 0x0f, 0xc6, 0xe1, 0x00, 0x00,
+  0x80, 0xfb, 0x09, 0xc0, 0xf9, 0x30, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x29, 0x88, 0x00, 0xb9, 0x84, 0x0d, 0x91, 0xf9, 0x70, 0x76, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0xf2, 0x87, 0x00, 0x8e, 0x82,
+  0x0f, 0x99, 0x40, 0x66, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x2d, 0x1e,
+  0x1e, 0x5f, 0x7c, 0x7c, 0xf7, 0x8b, 0x0f, 0xc3, 0x7c, 0x7c, 0x7c, 0x4d,
+  0x2c, 0xee, 0xa7, 0xa7, 0x86, 0x80, 0xae, 0x70, 0x7c, 0x78, 0xd2, 0x8b,
+  0x04, 0x8e, 0xfb, 0xb5, 0xb5, 0x96, 0x84, 0x04, 0xb5, 0x53, 0x7c, 0x75,
+  0xea, 0x95, 0x04, 0xae, 0x30, 0x7c, 0x7c, 0x45, 0x95, 0x05, 0x8f, 0x5b,
+  0x7c, 0x73, 0xf9, 0x9d, 0x94, 0x04, 0x8c, 0x34, 0x7c, 0x75, 0x31, 0x95,
+  0x04, 0x8e, 0x39, 0x7c, 0x78, 0xea, 0x96, 0x03, 0x7d, 0x7c, 0x7c, 0xe6,
+  0x95, 0x04, 0xcd, 0x7d, 0x7f, 0x4a, 0xd5, 0x94, 0x05, 0x91, 0xf9, 0x77,
+  0x7c, 0x4a, 0xd4, 0x94, 0x05, 0x94, 0xf7, 0x7c, 0x7c, 0x4a, 0x8e, 0x94,
+  0x05, 0x96, 0x3b, 0x7c, 0x7c, 0x00, 0x93, 0x94, 0x05, 0x96, 0x3a, 0x7c,
+  0x71, 0x2b, 0x96, 0x89, 0x00, 0xa4, 0x8a, 0x03, 0xed, 0x7c, 0x7c, 0x38,
+  0x87, 0x04, 0x8c, 0xb6, 0x0a, 0x3a, 0xfb, 0x89, 0x11, 0xc1, 0x70, 0x7c,
+  0x7c, 0xd6, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xcc, 0x3e, 0x7c,
+  0x7c, 0x5d, 0xa6, 0x89, 0x10, 0xde, 0x7c, 0x7c, 0x7c, 0x4b, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x69, 0x53, 0xa7, 0x8a, 0x0e,
+  0xd9, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x78,
+  0x4b, 0xea, 0xa1, 0x8d, 0x0a, 0x0e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0xf8, 0x3d, 0xf7, 0xd2, 0xfa, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb2, 0x09,
+  0x98, 0x98, 0x98, 0xf6, 0x3f, 0x7f, 0x7d, 0x7d, 0x29, 0x83, 0x8d, 0x0d,
+  0x9e, 0xaf, 0x0c, 0x21, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c,
+  0x7c, 0x96, 0x8c, 0x0e, 0xb1, 0x64, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c,
+  0x43, 0x37, 0x03, 0x63, 0x7c, 0x63, 0x90, 0x8c, 0x0d, 0xac, 0x7c, 0x7c,
+  0x7c, 0x52, 0x21, 0xd7, 0xad, 0x89, 0x80, 0x89, 0x42, 0x7c, 0x20, 0x8d,
+  0x04, 0x83, 0xcb, 0x96, 0x96, 0x8c, 0x84, 0x03, 0x98, 0x7c, 0x7c, 0xec,
+  0x97, 0x03, 0x15, 0x7d, 0x77, 0xaa, 0x96, 0x03, 0x96, 0x7d, 0x7c, 0x22,
+  0x97, 0x03, 0xf4, 0x7d, 0x7c, 0xc5, 0x97, 0x03, 0x52, 0x7d, 0x56, 0x8d,
+  0x96, 0x0b, 0x08, 0x7a, 0x7d, 0x4e, 0xd5, 0xf4, 0xf4, 0xff, 0x66, 0x47,
+  0x52, 0xc9, 0x89, 0x11, 0x87, 0x98, 0x00, 0x15, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x6f, 0x66, 0x3c, 0xbf, 0x88, 0x0f,
+  0x89, 0x1b, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x5f, 0x4e,
+  0x4e, 0xe6, 0xdc, 0xa1, 0x8b, 0x0a, 0x02, 0x7c, 0x7c, 0x7c, 0x57, 0x44,
+  0x7c, 0x7c, 0x7c, 0xfa, 0x99, 0x90, 0x08, 0x21, 0x7c, 0x5a, 0xec, 0x95,
+  0x9a, 0x5d, 0x7c, 0x1d, 0x92, 0x02, 0xd8, 0x3d, 0xa3, 0x81, 0x03, 0xaf,
+  0x7c, 0x7c, 0x09, 0x97, 0x03, 0xaf, 0x7d, 0x7d, 0x97, 0x97, 0x03, 0xaf,
+  0x7c, 0x7c, 0x96, 0x97, 0x03, 0xaf, 0x7c, 0x7c, 0x96, 0x97, 0x03, 0xaf,
+  0x7c, 0x7c, 0xc1, 0x97, 0x03, 0x9a, 0x28, 0x7c, 0xd5, 0xc3, 0x00, 0x00,
+  0x80, 0xff, 0xae, 0x0d, 0x93, 0x8d, 0x98, 0x98, 0xec, 0x0a, 0x0a, 0x0b,
+  0x0a, 0x2a, 0x7d, 0x7d, 0x00, 0x89, 0x8d, 0x0d, 0x4f, 0x53, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x24, 0x8d, 0x0d,
+  0x4f, 0x7c, 0x7d, 0x7c, 0x4a, 0x37, 0x37, 0x38, 0x37, 0x37, 0x37, 0x57,
+  0x7d, 0x4e, 0x8d, 0x04, 0xa5, 0xad, 0xae, 0xad, 0x8d, 0x85, 0x03, 0x95,
+  0x7d, 0x74, 0xb8, 0x97, 0x03, 0xea, 0x7d, 0x7c, 0xc5, 0x97, 0x03, 0xf4,
+  0x7f, 0x7d, 0xc5, 0x96, 0x04, 0x91, 0x41, 0x7d, 0x4a, 0x99, 0x95, 0x04,
+  0x93, 0x3c, 0x7c, 0x4d, 0x99, 0x96, 0x03, 0xc6, 0x7c, 0x7c, 0xf4, 0x96,
+  0x04, 0x96, 0x4d, 0x7c, 0x7c, 0x8b, 0x81, 0x00, 0xb5, 0x8c, 0x00, 0x8b,
+  0x85, 0x07, 0xaf, 0x7d, 0x7d, 0x7d, 0x15, 0x7d, 0x7d, 0x16, 0x88, 0x12,
+  0x85, 0xc4, 0x21, 0x21, 0x4b, 0x22, 0x21, 0x21, 0x21, 0x21, 0x22, 0x32,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x5f, 0xfb, 0x91, 0x88, 0x10, 0x98, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x5d,
+  0x2d, 0x99, 0x8a, 0x0e, 0x8f, 0x4a, 0x20, 0x20, 0x4a, 0x29, 0x41, 0x20,
+  0x20, 0x20, 0x53, 0x7c, 0x7c, 0x5a, 0xa3, 0x8d, 0x00, 0x8b, 0x81, 0x02,
+  0x8b, 0x83, 0x88, 0x82, 0x03, 0x73, 0x7c, 0x3d, 0x8e, 0x97, 0x02, 0x7f,
+  0x7d, 0x2d, 0x97, 0x03, 0x96, 0x7d, 0x7c, 0xc5, 0x97, 0x03, 0xd4, 0x7d,
+  0x67, 0xa5, 0x98, 0x02, 0x7d, 0x56, 0x8d, 0x98, 0x01, 0x14, 0x4e, 0xc3,
+  0x80, 0xff, 0x97, 0x0c, 0xbf, 0xee, 0xed, 0xed, 0xed, 0x7f, 0x00, 0x54,
+  0x7d, 0x7f, 0x7d, 0x15, 0xaf, 0x89, 0x11, 0xb5, 0xc9, 0x59, 0x59, 0x59,
+  0x6d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c,
+  0x14, 0x89, 0x11, 0x35, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x71, 0x57,
+  0x57, 0x59, 0x57, 0x57, 0x57, 0x68, 0x7c, 0x7c, 0x14, 0x89, 0x07, 0x35,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x28, 0xec, 0xcd, 0x85, 0x03, 0xed, 0x7c, 0x7c,
+  0xec, 0x89, 0x03, 0xe8, 0x0f, 0x0f, 0x94, 0x88, 0x04, 0xbf, 0x7d, 0x7c,
+  0x6c, 0xbe, 0x94, 0x05, 0x95, 0x30, 0x6d, 0x7d, 0x67, 0xc7, 0x94, 0x05,
+  0xcf, 0x49, 0x7c, 0x7c, 0x59, 0xc7, 0x94, 0x04, 0xd4, 0x3f, 0x7c, 0x7c,
+  0x7c, 0x95, 0x04, 0xe3, 0x7d, 0x7f, 0x7d, 0x1a, 0x95, 0x05, 0xe9, 0x72,
+  0x7c, 0x7d, 0x14, 0x8a, 0x93, 0x06, 0xe9, 0x36, 0x72, 0x7c, 0x67, 0x1a,
+  0x8a, 0x93, 0x05, 0xe9, 0x4e, 0x7d, 0x7c, 0x67, 0xae, 0x92, 0x06, 0x81,
+  0xed, 0x16, 0x7d, 0x7d, 0x7f, 0xf7, 0x85, 0x02, 0xee, 0x16, 0x05, 0x8b,
+  0x06, 0xaa, 0x7c, 0x7c, 0x7c, 0x52, 0xa3, 0x85, 0x81, 0x06, 0xa0, 0xf3,
+  0x59, 0x59, 0x7d, 0x14, 0x9e, 0x89, 0x10, 0x8b, 0x0c, 0x5d, 0x7c, 0x71,
+  0x43, 0x9f, 0x80, 0xa0, 0xba, 0x35, 0x54, 0x7c, 0x7c, 0x67, 0x1a, 0x8a,
+  0x8a, 0x04, 0x1b, 0x7c, 0x7c, 0x7c, 0x33, 0x81, 0x07, 0xbf, 0x6d, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x14, 0xae, 0x8b, 0x0b, 0xee, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x6d, 0x10, 0x8f, 0x0a, 0x69, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x3d, 0x19, 0x90, 0x09, 0x68, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x76, 0x57, 0xc8, 0x8a, 0x91, 0x06, 0xed, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x52, 0xdc, 0xe3, 0x00, 0x00, 0x80, 0xff, 0xa1, 0x02,
+  0x86, 0xfe, 0x03, 0x96, 0x04, 0x85, 0xc1, 0x76, 0x79, 0x35, 0x96, 0x03,
+  0xee, 0x7f, 0x7e, 0x00, 0x8a, 0x02, 0x8f, 0xe3, 0xc7, 0x88, 0x04, 0x00,
+  0x72, 0x7f, 0xf4, 0x85, 0x8a, 0x02, 0x0f, 0x7e, 0x50, 0x86, 0x05, 0x8a,
+  0xcb, 0x70, 0x7e, 0x2e, 0x87, 0x89, 0x04, 0x81, 0xac, 0x56, 0x6f, 0xa4,
+  0x86, 0x04, 0xe4, 0x7e, 0x7e, 0x2c, 0x89, 0x8a, 0x03, 0x87, 0x7e, 0x7e,
+  0x50, 0x86, 0x04, 0xc8, 0x6e, 0x7e, 0x2b, 0x8b, 0x8b, 0x03, 0xdd, 0x7e,
+  0x7b, 0xd5, 0x85, 0x04, 0x8e, 0x52, 0x7e, 0x6d, 0x9e, 0x8c, 0x02, 0x1e,
+  0x7e, 0x6c, 0x85, 0x04, 0x8e, 0x2b, 0x7e, 0x6d, 0xc6, 0x8d, 0x03, 0x24,
+  0x7e, 0x7a, 0xec, 0x84, 0x07, 0xde, 0x7e, 0x7e, 0x2d, 0xb5, 0x29, 0x3b,
+  0xb1, 0x8a, 0x10, 0xa5, 0x7e, 0x7e, 0x78, 0x32, 0xc5, 0xb9, 0x80, 0x90,
+  0x4d, 0x7e, 0x7e, 0x6b, 0x74, 0x7e, 0x11, 0xa4, 0x8a, 0x0f, 0x85, 0x5c,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x75, 0x47, 0x54, 0x7e, 0x7e, 0x7e, 0x7e, 0x40,
+  0xc9, 0x87, 0x8c, 0x0c, 0x9b, 0xf8, 0x5d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x3f, 0xc9, 0x89, 0x90, 0x08, 0x99, 0xab, 0xab, 0xcf, 0x7e,
+  0x7e, 0x7e, 0x1a, 0x8a, 0x95, 0x04, 0xac, 0x7e, 0x7e, 0x49, 0x89, 0x96,
+  0x03, 0xac, 0x7e, 0x7e, 0x0f, 0x97, 0x03, 0xac, 0x7f, 0x67, 0xa8, 0x97,
+  0x02, 0xac, 0x7e, 0xd3, 0x98, 0x02, 0xac, 0x7e, 0x03, 0x98, 0x02, 0x97,
+  0x02, 0xe6, 0xe1, 0x00, 0x80, 0xe0, 0x02, 0x98, 0xdb, 0xbe, 0x96, 0x05,
+  0xa4, 0x34, 0x47, 0x7d, 0x65, 0x2f, 0x94, 0x07, 0xb5, 0x07, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x78, 0xc2, 0x92, 0x08, 0xb0, 0x60, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x1a, 0x92, 0x09, 0x45, 0x7d, 0x7d, 0x7d, 0x0d, 0x01, 0x7a,
+  0x7d, 0x4a, 0xa0, 0x91, 0x09, 0xb5, 0x4b, 0x2b, 0xa8, 0x84, 0x80, 0x56,
+  0x7d, 0x7d, 0xc1, 0x97, 0x03, 0xd3, 0x7d, 0x7d, 0xc1, 0x97, 0x03, 0xfd,
+  0x7d, 0x7d, 0x55, 0x97, 0x03, 0x76, 0x7d, 0x7d, 0x00, 0x95, 0x05, 0x96,
+  0x37, 0x7d, 0x7d, 0x1d, 0x82, 0x95, 0x04, 0xc8, 0x7d, 0x7d, 0x7d, 0x15,
+  0x95, 0x04, 0xb7, 0x6f, 0x7d, 0x7d, 0x35, 0x94, 0x06, 0x8d, 0xb9, 0x60,
+  0x7d, 0x7d, 0x3f, 0x95, 0x93, 0x06, 0x8f, 0x36, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xe1, 0x81, 0x04, 0x8c, 0xf4, 0xf4, 0xf4, 0xd9, 0x8b, 0x12, 0x83, 0xaa,
+  0x2f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x4e, 0x4d, 0x4d, 0x52, 0x7d, 0x7d,
+  0x7d, 0x72, 0x4d, 0x4d, 0xe3, 0x88, 0x12, 0xe6, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x87, 0x13, 0x5f, 0x74, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x77, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0xd9,
+  0x87, 0x0c, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xee,
+  0xea, 0xea, 0xe0, 0x8e, 0x09, 0x7e, 0x7d, 0x7d, 0x73, 0x33, 0x33, 0xd9,
+  0x8f, 0x8f, 0x81, 0x91, 0x03, 0xda, 0xd9, 0xd9, 0xce, 0xff, 0x9d, 0x00,
+  0x80, 0xff, 0x9e, 0x02, 0xd4, 0x7f, 0x0a, 0x97, 0x03, 0x13, 0x70, 0x7d,
+  0xd5, 0x96, 0x04, 0xa6, 0x2a, 0x7d, 0x6b, 0xb5, 0x95, 0x04, 0x86, 0x5e,
+  0x7d, 0x7d, 0xf5, 0x95, 0x05, 0x84, 0xf4, 0x7d, 0x7d, 0x45, 0xbe, 0x94,
+  0x05, 0x83, 0xf3, 0x7d, 0x7d, 0x7d, 0x23, 0x95, 0x05, 0x98, 0x50, 0x7d,
+  0x7d, 0x7d, 0xa2, 0x94, 0x06, 0x9e, 0x53, 0x7b, 0x7d, 0x7d, 0x92, 0x81,
+  0x94, 0x05, 0x40, 0x7d, 0x7d, 0x7b, 0xe1, 0x82, 0x94, 0x04, 0xef, 0x74,
+  0x7d, 0x7d, 0x06, 0x95, 0x05, 0xd1, 0x76, 0x7d, 0x74, 0x3e, 0x9d, 0x94,
+  0x04, 0x8f, 0x48, 0x7d, 0x7d, 0x4d, 0x95, 0x05, 0x8c, 0x48, 0x7d, 0x7d,
+  0x52, 0xd9, 0x95, 0x04, 0x17, 0x7d, 0x7d, 0x7d, 0xaf, 0x95, 0x05, 0x23,
+  0x78, 0x7d, 0x50, 0x9b, 0x83, 0x94, 0x04, 0xdd, 0x73, 0x7d, 0x7d, 0xe3,
+  0x96, 0x04, 0x40, 0x7d, 0x7d, 0x5d, 0x85, 0x95, 0x04, 0xb6, 0x6b, 0x7d,
+  0x12, 0xa5, 0x96, 0x03, 0xd8, 0x7d, 0x5c, 0xa7, 0x97, 0x02, 0x0a, 0x7d,
+  0xd2, 0xe6, 0x00, 0x00, 0x80, 0xc9, 0x03, 0xde, 0x7e, 0x7e, 0x92, 0x96,
+  0x04, 0x8b, 0x22, 0x7d, 0x78, 0x91, 0x95, 0x04, 0x86, 0x56, 0x7d, 0x7d,
+  0xce, 0x95, 0x05, 0x88, 0x1e, 0x7d, 0x74, 0x34, 0x8a, 0x94, 0x04, 0x89,
+  0x1d, 0x7d, 0x7d, 0x11, 0x95, 0x05, 0x9c, 0x1c, 0x7d, 0x7d, 0x33, 0x8e,
+  0x94, 0x05, 0xbb, 0x67, 0x7d, 0x7d, 0x32, 0x8f, 0x94, 0x05, 0xbb, 0x66,
+  0x7d, 0x7d, 0x32, 0x90, 0x94, 0x05, 0x8a, 0x3f, 0x7d, 0x70, 0xe8, 0x90,
+  0x94, 0x04, 0x9c, 0x46, 0x7d, 0x70, 0xd4, 0x96, 0x03, 0xc7, 0x7d, 0x7d,
+  0x24, 0x96, 0x0a, 0xfa, 0x69, 0x7d, 0x32, 0xa1, 0xcb, 0xcb, 0xcb, 0xcb,
+  0xcb, 0xb0, 0x8f, 0x0c, 0xbc, 0x6a, 0x7d, 0x7d, 0x5c, 0x57, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x6b, 0xfd, 0x8d, 0x0e, 0x90, 0x6c, 0x7d, 0x7d, 0x7d,
+  0x53, 0x7d, 0x68, 0x26, 0x6a, 0x7d, 0x7d, 0x7d, 0x6d, 0x94, 0x8c, 0x0e,
+  0x93, 0x7d, 0x7d, 0x5d, 0xa5, 0x93, 0xa5, 0x9c, 0x80, 0x9d, 0xa5, 0x2b,
+  0x7d, 0x7d, 0x02, 0x8c, 0x03, 0x93, 0x7d, 0x7d, 0x1b, 0x86, 0x03, 0xd8,
+  0x7d, 0x7d, 0x14, 0x8c, 0x04, 0x93, 0x7d, 0x7d, 0x67, 0xd8, 0x84, 0x04,
+  0xa2, 0x59, 0x7d, 0x7d, 0xe1, 0x8c, 0x0e, 0x8b, 0x4f, 0x7d, 0x7d, 0x7a,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x71, 0x7d, 0x7d, 0x51, 0x8e, 0x8d, 0x0c,
+  0x93, 0x4f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x18,
+  0x96, 0x8f, 0x0a, 0x84, 0x98, 0x01, 0x01, 0x1c, 0x7d, 0x5c, 0x01, 0xda,
+  0x85, 0x81, 0xff, 0xb0, 0x80, 0xfe, 0x02, 0x7f, 0x7f, 0x7f, 0x98, 0x03,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x97, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x96,
+  0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x96, 0x04, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x95, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x95, 0x05, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x94, 0x05, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x95, 0x05, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x95, 0x05, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x95, 0x05, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x94, 0x06, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x94, 0x05, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x94, 0x06, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x94, 0x05, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x95, 0x04,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x96, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x96, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x96, 0x03, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x97, 0x02, 0x7f, 0x7f, 0x7f, 0xfe, 0x00, 0x80, 0xff, 0x95, 0x05,
+  0x88, 0xab, 0x14, 0x7c, 0x7c, 0x54, 0x95, 0x09, 0xf1, 0x7a, 0x7a, 0x7a,
+  0x7a, 0x52, 0x9d, 0xaa, 0xb9, 0x8e, 0x8f, 0x0d, 0xd5, 0xff, 0x7c, 0x7a,
+  0x7a, 0x7a, 0x7a, 0x67, 0x28, 0x3c, 0x52, 0x12, 0x00, 0xd4, 0x8d, 0x0e,
+  0x28, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a,
+  0x7c, 0x5f, 0xd4, 0x8b, 0x10, 0xeb, 0x6d, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a,
+  0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x66, 0xc6, 0x88, 0x13,
+  0x88, 0xf1, 0x7c, 0x7c, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7e, 0x7c, 0x7c, 0xf0, 0x87, 0x87, 0x13, 0xab, 0x7a,
+  0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x27, 0x26, 0x26, 0x5f,
+  0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0xef, 0x87, 0x09, 0xab, 0x7a, 0x7a, 0x7a,
+  0x7a, 0x7c, 0x50, 0xfd, 0xfd, 0xfd, 0x82, 0x06, 0x28, 0x7a, 0x7c, 0x7a,
+  0x7a, 0x7a, 0x7a, 0x87, 0x06, 0xab, 0x7a, 0x7a, 0x7a, 0x7a, 0x60, 0xb7,
+  0x85, 0x06, 0xb8, 0x5f, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x87, 0x05, 0x5b,
+  0x7a, 0x7a, 0x7a, 0x7a, 0x52, 0x87, 0x05, 0x52, 0x7c, 0x7a, 0x7a, 0x7a,
+  0x7a, 0x87, 0x04, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x87, 0x06, 0x2a, 0x7c,
+  0x7f, 0x7c, 0x7c, 0x7c, 0xa9, 0x87, 0x04, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a,
+  0x85, 0x08, 0x9d, 0xd5, 0x44, 0x7a, 0x7c, 0x7a, 0x7a, 0x42, 0x9b, 0x87,
+  0x04, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x84, 0x08, 0x00, 0x28, 0x7a, 0x7a,
+  0x7a, 0x7c, 0x7a, 0x7a, 0xd3, 0x88, 0x12, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a,
+  0x0d, 0x80, 0xd5, 0x28, 0x28, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a,
+  0x7a, 0xd3, 0x88, 0x12, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x76, 0x52, 0x66,
+  0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x10, 0x8e, 0x88,
+  0x0f, 0x5b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7f,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x31, 0x8b, 0x0e, 0xab, 0x7a, 0x7a, 0x7a, 0x7a,
+  0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x42, 0x26, 0x8c, 0x0d,
+  0x95, 0xfd, 0x3c, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x67, 0xfd,
+  0xfd, 0xa9, 0x8f, 0x08, 0xaa, 0x43, 0x7a, 0x7c, 0x7a, 0x7a, 0x09, 0xd3,
+  0xc6, 0x93, 0x05, 0x9b, 0xa9, 0xa9, 0xa9, 0xa9, 0x8e, 0xe1, 0x00, 0x00,
+  0x80, 0xc8, 0x04, 0x9a, 0xf1, 0x3f, 0x7f, 0x9b, 0x95, 0x05, 0x9d, 0x48,
+  0x7c, 0x7c, 0x7d, 0x9b, 0x94, 0x06, 0xb9, 0x48, 0x7c, 0x7c, 0x5c, 0x05,
+  0x86, 0x92, 0x06, 0x84, 0xeb, 0x7d, 0x7c, 0x75, 0x50, 0xa5, 0x93, 0x05,
+  0xa0, 0x19, 0x7c, 0x7d, 0x7c, 0x43, 0x95, 0x04, 0xf8, 0x7d, 0x7d, 0x7f,
+  0xea, 0x95, 0x05, 0xfb, 0x76, 0x7c, 0x7c, 0x57, 0x92, 0x94, 0x05, 0x9a,
+  0x67, 0x7c, 0x7c, 0x0d, 0x9f, 0x94, 0x05, 0x90, 0x4f, 0x7c, 0x7c, 0x59,
+  0xa5, 0x95, 0x04, 0x0c, 0x7d, 0x7c, 0x5c, 0xa5, 0x95, 0x04, 0x9d, 0x7d,
+  0x7f, 0x7d, 0x05, 0x95, 0x05, 0x93, 0x35, 0x7c, 0x7d, 0x01, 0x86, 0x95,
+  0x04, 0xb9, 0x7c, 0x7c, 0x7d, 0x9b, 0x82, 0x06, 0x9a, 0xb9, 0xb9, 0xb9,
+  0xb9, 0xb9, 0xa6, 0x8c, 0x0f, 0xc9, 0x7c, 0x7c, 0x70, 0xa2, 0x9d, 0xfb,
+  0x29, 0x4f, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x60, 0x03, 0x8b, 0x0f, 0x45,
+  0x7c, 0x7c, 0x4b, 0x32, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x43, 0x8b, 0x0f, 0x46, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7f, 0x57, 0x65, 0x7d, 0x7d, 0x7f, 0x7d, 0x44, 0x8b, 0x0f, 0x45,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x2d, 0x7d, 0x73, 0x76, 0x7c, 0x7c,
+  0x7d, 0x7c, 0xc6, 0x8b, 0x0f, 0xd8, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x1a, 0x8c, 0x8b, 0x0e, 0x93,
+  0x31, 0x6f, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x75, 0x5f, 0x11,
+  0xd4, 0x89, 0x8e, 0x08, 0xbf, 0x2e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0xff,
+  0xd7, 0xff, 0xb1, 0x00, 0x80, 0xff, 0xd0, 0x06, 0xae, 0xd2, 0x49, 0x7e,
+  0x7e, 0x7e, 0xd3, 0x91, 0x09, 0x82, 0xb2, 0x2a, 0x74, 0x7e, 0x7d, 0x6f,
+  0x74, 0x7d, 0x43, 0x90, 0x0a, 0x93, 0x01, 0x7d, 0x7d, 0x7d, 0x18, 0xce,
+  0x98, 0x26, 0x7d, 0x00, 0x8f, 0x0b, 0xb5, 0x49, 0x7d, 0x7d, 0x24, 0xa9,
+  0x80, 0x84, 0xe4, 0x7b, 0x39, 0x88, 0x8e, 0x0b, 0x90, 0x43, 0x7e, 0x7d,
+  0xf6, 0x85, 0xcc, 0xe3, 0x39, 0x7d, 0x7d, 0x2a, 0x8f, 0x0b, 0xa8, 0x7e,
+  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x79, 0x55, 0x7e, 0x7e, 0x8f, 0x0b,
+  0x86, 0x17, 0x6a, 0x69, 0x69, 0x78, 0x69, 0xf2, 0xa4, 0xcf, 0x7d, 0x7d,
+  0x94, 0x00, 0xbc, 0x81, 0x03, 0x87, 0x29, 0x7d, 0x39, 0x97, 0x03, 0xef,
+  0x7d, 0x77, 0xde, 0x96, 0x03, 0x97, 0x4f, 0x7d, 0x55, 0x97, 0x03, 0x1c,
+  0x7e, 0x6b, 0xb5, 0x96, 0x03, 0x90, 0x6f, 0x7d, 0x01, 0x97, 0x03, 0x43,
+  0x7e, 0x51, 0x98, 0x96, 0x03, 0xa5, 0x62, 0x74, 0xce, 0x97, 0x02, 0x54,
+  0x7d, 0x1d, 0x97, 0x03, 0xb1, 0x76, 0x7e, 0xa6, 0x96, 0x03, 0x82, 0x01,
+  0x7d, 0xfd, 0x97, 0x03, 0x94, 0x7d, 0x61, 0x92, 0x97, 0x02, 0x94, 0x7d,
+  0xed, 0x98, 0x02, 0x94, 0x7d, 0x93, 0xaa, 0x00, 0x80, 0xff, 0x96, 0x09,
+  0x9a, 0x53, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x4c, 0xf9, 0xd9, 0x90, 0x0c,
+  0xf9, 0x72, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x79, 0x54,
+  0xda, 0x8d, 0x0d, 0x9e, 0x5b, 0x7c, 0x7c, 0x40, 0x1e, 0x1e, 0x1f, 0x1e,
+  0x1e, 0x1e, 0x69, 0x7c, 0x54, 0x8d, 0x04, 0xd1, 0x7c, 0x7c, 0xea, 0x8f,
+  0x85, 0x02, 0xd8, 0x7c, 0x54, 0x8d, 0x04, 0xd1, 0x7c, 0x7c, 0x43, 0x99,
+  0x85, 0x05, 0xc3, 0x59, 0x54, 0x80, 0x84, 0xc3, 0x8a, 0x04, 0x95, 0x55,
+  0x7c, 0x7c, 0xf9, 0x83, 0x07, 0x94, 0x26, 0x6e, 0x7c, 0x71, 0x3a, 0x3e,
+  0x7c, 0x8b, 0x04, 0xe2, 0x71, 0x7c, 0x65, 0xa6, 0x81, 0x08, 0xa7, 0xf7,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x62, 0x4d, 0xcf, 0x8c, 0x0c, 0xe1, 0x73, 0x7c,
+  0x77, 0x20, 0x21, 0x77, 0x7c, 0x7c, 0x67, 0x45, 0xdd, 0xa2, 0x8f, 0x08,
+  0x2d, 0x7c, 0x7c, 0x7c, 0x7d, 0x6f, 0x3d, 0xea, 0x96, 0x91, 0x06, 0x9d,
+  0x57, 0x7c, 0x7c, 0x7c, 0x3e, 0x86, 0x92, 0x07, 0x10, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x06, 0x91, 0x0a, 0xae, 0x62, 0x7a, 0x7c, 0x65, 0xfd,
+  0xed, 0x7c, 0x7c, 0x38, 0x86, 0x8f, 0x0b, 0xad, 0x67, 0x7c, 0x7c, 0x0e,
+  0x94, 0x80, 0x9b, 0x7c, 0x7c, 0x7d, 0x8d, 0x8f, 0x04, 0x69, 0x7c, 0x7c,
+  0x0e, 0x88, 0x81, 0x04, 0x85, 0x23, 0x7c, 0x7d, 0x8d, 0x8f, 0x03, 0x7d,
+  0x7c, 0x63, 0x9d, 0x82, 0x04, 0x96, 0x66, 0x7c, 0x7d, 0x8d, 0x8f, 0x02,
+  0x7d, 0x65, 0xb7, 0x83, 0x04, 0x9b, 0x7c, 0x7c, 0x7d, 0x8d, 0x8f, 0x03,
+  0x7d, 0x22, 0xa9, 0x9c, 0x81, 0x05, 0xb1, 0x35, 0x7c, 0x7c, 0x2b, 0x84,
+  0x8f, 0x0a, 0x7d, 0x7c, 0x7c, 0x5f, 0x20, 0x20, 0x5f, 0x7c, 0x7c, 0x6e,
+  0xb1, 0x90, 0x09, 0xeb, 0x6e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x67,
+  0xb2, 0x92, 0x06, 0xb3, 0xf7, 0x21, 0x7c, 0x7c, 0x20, 0xeb, 0xe1, 0x00,
+  0x80, 0xf8, 0x0b, 0x30, 0x7d, 0x7d, 0x7d, 0x2e, 0x30, 0x4e, 0xf1, 0xf1,
+  0xf1, 0xf2, 0x8c, 0x8e, 0x0d, 0xcf, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x64, 0x2f, 0x8e, 0x0d, 0x5e, 0x1a, 0xb7,
+  0xb7, 0xb7, 0xf7, 0x14, 0x25, 0x43, 0x43, 0x7d, 0x7c, 0x6f, 0x2f, 0x8d,
+  0x01, 0xa6, 0x89, 0x87, 0x03, 0x2e, 0x7c, 0x7c, 0x01, 0x95, 0x05, 0x90,
+  0x0c, 0x7d, 0x7c, 0x5c, 0xa5, 0x88, 0x01, 0xf2, 0x9b, 0x88, 0x06, 0xbf,
+  0xd9, 0x4f, 0x7d, 0x7f, 0x57, 0xee, 0x89, 0x01, 0x8c, 0x83, 0x85, 0x08,
+  0x8a, 0xd5, 0x13, 0x70, 0x76, 0x7c, 0x7c, 0x28, 0xa1, 0x90, 0x08, 0xb3,
+  0x26, 0x4b, 0x7c, 0x7d, 0x69, 0x43, 0xe6, 0xb7, 0x91, 0x06, 0x29, 0x73,
+  0x7c, 0x7c, 0x7c, 0x3e, 0xbb, 0x94, 0x07, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x18, 0x9f, 0x93, 0x08, 0xbf, 0x71, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d,
+  0x5e, 0xe5, 0x93, 0x08, 0x98, 0xbb, 0x27, 0x56, 0x7d, 0x7c, 0x7c, 0x79,
+  0xe4, 0x95, 0x06, 0x9f, 0xb8, 0x47, 0x7c, 0x7c, 0x5d, 0xa0, 0x96, 0x04,
+  0x9c, 0x47, 0x7c, 0x7c, 0x0c, 0x97, 0x03, 0xb9, 0x7c, 0x7c, 0x0c, 0x8c,
+  0x01, 0xe5, 0x26, 0x87, 0x04, 0xa6, 0x5e, 0x7d, 0x7d, 0x0d, 0x8c, 0x02,
+  0x61, 0x56, 0x9c, 0x84, 0x06, 0xb0, 0x13, 0x6a, 0x7c, 0x7c, 0x4c, 0x8f,
+  0x8c, 0x0d, 0x61, 0x7c, 0x57, 0x45, 0x07, 0xe8, 0x45, 0x45, 0x63, 0x7d,
+  0x7c, 0x7c, 0x7c, 0xf0, 0x8d, 0x0d, 0xfa, 0x76, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x75, 0x01, 0xa5, 0x8e, 0x0a, 0xd8, 0x00,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x3e, 0xf0, 0xd7, 0xfa, 0x00, 0x00,
+  0x80, 0xff, 0xb3, 0x09, 0x8b, 0xfa, 0x04, 0x7f, 0x7d, 0x6c, 0x04, 0x04,
+  0xa9, 0x83, 0x8f, 0x0b, 0x93, 0xfb, 0x6d, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0xf5, 0x8e, 0x0c, 0x89, 0x49, 0x7c, 0x7c, 0x5b, 0x1e,
+  0xe0, 0xe0, 0xe0, 0xe0, 0x3e, 0x7c, 0x27, 0x8d, 0x05, 0xa1, 0x3d, 0x7c,
+  0x6c, 0x1d, 0x88, 0x84, 0x02, 0xbd, 0x7c, 0x27, 0x8d, 0x03, 0x07, 0x7c,
+  0x7c, 0x0b, 0x86, 0x02, 0x13, 0x7c, 0x0b, 0x8c, 0x04, 0x9c, 0x69, 0x7c,
+  0x22, 0x8c, 0x85, 0x03, 0xa6, 0x6b, 0x22, 0x8c, 0x8c, 0x04, 0x99, 0x60,
+  0x7c, 0x35, 0xb9, 0x84, 0x03, 0x00, 0x56, 0x3f, 0xa8, 0x8e, 0x0b, 0x29,
+  0x7c, 0x7c, 0x70, 0xf2, 0xb8, 0x80, 0x85, 0xed, 0x61, 0xcb, 0x8a, 0x8f,
+  0x0a, 0xa7, 0x29, 0x7c, 0x7c, 0x7c, 0x72, 0x65, 0x67, 0x7c, 0x79, 0x00,
+  0x91, 0x0a, 0x83, 0xe8, 0x03, 0x31, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7a,
+  0x37, 0x96, 0x04, 0x87, 0x10, 0x7d, 0x7d, 0x01, 0x96, 0x04, 0x98, 0x7c,
+  0x7c, 0x60, 0x9f, 0x95, 0x04, 0x92, 0x50, 0x7c, 0x7c, 0x01, 0x95, 0x05,
+  0x95, 0x4b, 0x7d, 0x7c, 0x13, 0x9c, 0x94, 0x05, 0x98, 0x48, 0x7c, 0x7d,
+  0x4e, 0x9b, 0x94, 0x05, 0xe4, 0x58, 0x7c, 0x7c, 0x51, 0x9a, 0x94, 0x05,
+  0xe4, 0x73, 0x7c, 0x7c, 0x1a, 0x97, 0x93, 0x06, 0x93, 0x37, 0x74, 0x7c,
+  0x7c, 0x24, 0x98, 0x94, 0x05, 0x1e, 0x7c, 0x7c, 0x58, 0xe2, 0x83, 0x95,
+  0x03, 0x29, 0x7c, 0x20, 0x9e, 0xc7, 0x00, 0x00, 0x80, 0xc9, 0x03, 0xed,
+  0x7f, 0x66, 0xac, 0x96, 0x04, 0xde, 0x74, 0x7d, 0x67, 0xb5, 0x94, 0x05,
+  0xa9, 0x68, 0x76, 0x7d, 0x7d, 0x2f, 0x94, 0x06, 0xb1, 0x56, 0x7d, 0x7d,
+  0x7d, 0x33, 0x93, 0x93, 0x06, 0xa1, 0xf5, 0x7d, 0x7d, 0x7d, 0x30, 0x91,
+  0x93, 0x06, 0xb4, 0x59, 0x7d, 0x7d, 0x7d, 0x34, 0x8d, 0x93, 0x06, 0x83,
+  0xf9, 0x7d, 0x7d, 0x7d, 0x32, 0x95, 0x94, 0x05, 0xe4, 0x7d, 0x7d, 0x7d,
+  0x37, 0x85, 0x94, 0x05, 0xda, 0x6f, 0x7d, 0x7d, 0x3d, 0x98, 0x94, 0x05,
+  0x90, 0x28, 0x7d, 0x7d, 0x7a, 0xec, 0x95, 0x04, 0x1f, 0x7d, 0x7d, 0x37,
+  0xd4, 0x95, 0x04, 0x08, 0x7c, 0x7d, 0x7d, 0x13, 0x96, 0x04, 0x0c, 0x7d,
+  0x7d, 0x6d, 0xbd, 0x83, 0x03, 0xd9, 0x15, 0x15, 0x00, 0x8d, 0x0f, 0xb8,
+  0x72, 0x7d, 0x7d, 0x3e, 0x80, 0x82, 0xb5, 0xb5, 0x5f, 0x73, 0x7d, 0x7d,
+  0x79, 0x64, 0xb6, 0x8b, 0x0f, 0x19, 0x7d, 0x7d, 0x7d, 0xb4, 0xb7, 0x08,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xbc, 0x8b, 0x0f, 0x54,
+  0x7d, 0x7d, 0x7d, 0x5b, 0x64, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x6d, 0xb4, 0x8b, 0x0e, 0xbe, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x6d, 0xcd, 0x8c, 0x0d, 0xbe, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0x6b, 0xd1,
+  0x8d, 0x0b, 0xa7, 0x52, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x62,
+  0x1c, 0xfc, 0x90, 0x08, 0x0c, 0x7d, 0x27, 0xce, 0xce, 0xce, 0xce, 0xce,
+  0xb8, 0xff, 0xb2, 0x00, 0x80, 0xff, 0x93, 0x0d, 0x3f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x8c, 0x0e,
+  0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x8d, 0x05, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83,
+  0x03, 0x3f, 0x7f, 0x7f, 0x7f, 0x95, 0x05, 0x00, 0x3f, 0x7f, 0x7f, 0x3f,
+  0xc0, 0x93, 0x05, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x94, 0x04, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x3f, 0x94, 0x05, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00,
+  0x94, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x96, 0x04, 0x7f, 0x7f, 0x7f,
+  0x3f, 0xc0, 0x96, 0x06, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0xc0, 0x95,
+  0x07, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0xc0, 0x95, 0x06, 0x00,
+  0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0xc0, 0x97, 0x03, 0x00, 0x7f, 0x7f, 0x7f,
+  0x98, 0x02, 0x00, 0x7f, 0x7f, 0x98, 0x02, 0x3f, 0x7f, 0x7f, 0x96, 0x04,
+  0xc0, 0x7f, 0x7f, 0x7f, 0x3f, 0x8b, 0x0e, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f,
+  0x00, 0x00, 0x80, 0xc0, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8c, 0x0e,
+  0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x3f, 0xc0, 0x8e, 0x0a, 0xc0, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x00, 0x93, 0x05, 0xc0, 0x7f, 0x3f, 0x00, 0x00, 0x3f,
+  0xe0, 0x00, 0x00, 0x00, 0x80, 0xf9, 0x09, 0x85, 0x01, 0x7e, 0x7e, 0x7e,
+  0x7f, 0xd6, 0xa7, 0xad, 0x85, 0x91, 0x0b, 0xf6, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x4b, 0x55, 0x0c, 0x04, 0xa7, 0x8d, 0x0e, 0x83, 0xf4, 0x73,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x56, 0x19,
+  0x8b, 0x10, 0xbc, 0x00, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x55, 0xa7, 0x8a, 0x11, 0x46, 0x7d, 0x7d,
+  0x7d, 0x4d, 0xf0, 0x69, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x47, 0xa4, 0x88, 0x12, 0x8a, 0x4a, 0x7d, 0x7d, 0x5f, 0x9f, 0x80,
+  0xbd, 0x6a, 0x6a, 0x6a, 0x6a, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xcf,
+  0x88, 0x04, 0x04, 0x7d, 0x7d, 0x4d, 0x9f, 0x86, 0x06, 0xf1, 0x77, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x87, 0x04, 0xa8, 0x4c, 0x7d, 0x7d, 0xf0, 0x88,
+  0x05, 0xfc, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x87, 0x04, 0xd8, 0x7d, 0x7d,
+  0x7d, 0xf0, 0x88, 0x05, 0xb0, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x87, 0x04,
+  0x7e, 0x7d, 0x7d, 0x7d, 0xf0, 0x88, 0x05, 0xb0, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x87, 0x04, 0x7f, 0x7d, 0x7d, 0x4d, 0xa9, 0x88, 0x05, 0xb0, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x87, 0x03, 0x7e, 0x7d, 0x7d, 0x31, 0x89, 0x05,
+  0xb0, 0x7d, 0x7d, 0x7d, 0x7d, 0x60, 0x87, 0x03, 0x7e, 0x7d, 0x7d, 0x31,
+  0x89, 0x05, 0xb0, 0x7d, 0x7d, 0x7d, 0x7d, 0xc1, 0x87, 0x03, 0x7e, 0x7d,
+  0x7d, 0x31, 0x89, 0x05, 0x2e, 0x7d, 0x7d, 0x7d, 0x2a, 0x96, 0x87, 0x04,
+  0x7e, 0x7d, 0x7d, 0x3f, 0x95, 0x85, 0x07, 0x88, 0xb0, 0x2e, 0x7b, 0x7d,
+  0x7d, 0x48, 0x89, 0x88, 0x05, 0x7e, 0x7d, 0x7d, 0x7d, 0x2e, 0xe9, 0x83,
+  0x07, 0xc8, 0x06, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x44, 0x89, 0x11, 0x7f,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x77, 0x33, 0x33, 0x33, 0x33, 0x62, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xfe, 0xba, 0x89, 0x10, 0x54, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x57, 0x44, 0xf0, 0x83,
+  0x8a, 0x0d, 0xa3, 0x42, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x6a, 0x02, 0xab, 0x8e, 0x0a, 0xa2, 0xc8, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x05, 0xb7, 0xfa, 0x00, 0x00, 0x80, 0xfa, 0x04, 0x94,
+  0x7d, 0x7d, 0x7d, 0x44, 0x96, 0x04, 0xee, 0x7b, 0x7b, 0x7b, 0x42, 0x96,
+  0x05, 0x56, 0x7b, 0x7b, 0x7b, 0x6b, 0xde, 0x95, 0x05, 0x56, 0x7b, 0x7b,
+  0x7b, 0x7d, 0x06, 0x95, 0x05, 0x0a, 0x7b, 0x7b, 0x7b, 0x7d, 0x06, 0x95,
+  0x05, 0x94, 0x7b, 0x7b, 0x7b, 0x7d, 0x06, 0x95, 0x05, 0x94, 0x7b, 0x7b,
+  0x7b, 0x7d, 0x06, 0x95, 0x05, 0x94, 0x7b, 0x7b, 0x7b, 0x7d, 0x06, 0x95,
+  0x05, 0x94, 0x7b, 0x7b, 0x7b, 0x7d, 0x06, 0x95, 0x05, 0x94, 0x7b, 0x7b,
+  0x7b, 0x7d, 0x06, 0x95, 0x05, 0x94, 0x7d, 0x7d, 0x7d, 0x7f, 0x07, 0x95,
+  0x05, 0x94, 0x7b, 0x7b, 0x7b, 0x7d, 0x06, 0x95, 0x05, 0x94, 0x7b, 0x7b,
+  0x7b, 0x7d, 0x06, 0x95, 0x06, 0x94, 0x7b, 0x7b, 0x7b, 0x7d, 0x18, 0x8c,
+  0x94, 0x07, 0x94, 0x7b, 0x7b, 0x7b, 0x7d, 0x7b, 0x0f, 0x87, 0x93, 0x07,
+  0x94, 0x7b, 0x7b, 0x7b, 0x7d, 0x7b, 0x7b, 0x92, 0x93, 0x07, 0x94, 0x7b,
+  0x7b, 0x7b, 0x7d, 0x7b, 0x6d, 0x91, 0x93, 0x06, 0x94, 0x7b, 0x7b, 0x7b,
+  0x7d, 0x56, 0xb5, 0x94, 0x05, 0x89, 0x1d, 0x7b, 0x7b, 0x7d, 0x06, 0x96,
+  0x04, 0xce, 0x7b, 0x7b, 0x4f, 0x9f, 0xfa, 0x00, 0x80, 0xff, 0x95, 0x08,
+  0xb5, 0x25, 0x50, 0x50, 0x50, 0x50, 0x51, 0x2d, 0x95, 0x90, 0x0a, 0x8a,
+  0xd6, 0x72, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x39, 0x8f, 0x0c,
+  0xe3, 0x4d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x74,
+  0xbf, 0x8d, 0x0d, 0xdd, 0x77, 0x7c, 0x7c, 0x7c, 0x47, 0xe3, 0x9d, 0xb7,
+  0x5d, 0x7d, 0x7c, 0x7c, 0x04, 0x8d, 0x05, 0x52, 0x7c, 0x7c, 0x6d, 0xda,
+  0x96, 0x82, 0x04, 0x15, 0x7d, 0x7c, 0x7c, 0x04, 0x8d, 0x03, 0x7d, 0x7c,
+  0x7c, 0x04, 0x84, 0x04, 0x15, 0x7d, 0x7c, 0x7c, 0x04, 0x8d, 0x03, 0x7d,
+  0x7c, 0x7c, 0x04, 0x84, 0x04, 0x15, 0x7d, 0x7c, 0x7c, 0x04, 0x8d, 0x03,
+  0x0a, 0x7c, 0x7c, 0x04, 0x83, 0x05, 0x88, 0x27, 0x7d, 0x7c, 0x70, 0x9f,
+  0x8d, 0x03, 0xe9, 0x7c, 0x7c, 0x04, 0x83, 0x04, 0x04, 0x7c, 0x7d, 0x7c,
+  0x6d, 0x8f, 0x01, 0xfc, 0xb5, 0x83, 0x05, 0xdb, 0x7d, 0x7d, 0x7f, 0x27,
+  0xb5, 0x94, 0x05, 0xa0, 0x58, 0x7c, 0x7c, 0x64, 0xa2, 0x94, 0x05, 0x9d,
+  0x52, 0x7c, 0x7c, 0x73, 0xb5, 0x95, 0x04, 0x32, 0x7c, 0x7c, 0x7c, 0xe7,
+  0x95, 0x07, 0xc3, 0x73, 0x7c, 0x7c, 0x7c, 0x13, 0xcb, 0xb9, 0x82, 0x01,
+  0x89, 0xa3, 0x8e, 0x0f, 0x34, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x6a,
+  0x32, 0x32, 0x32, 0x3b, 0x55, 0x32, 0x32, 0xdb, 0x8b, 0x0f, 0x5f, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x8b, 0x0f, 0xb9, 0x62, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6c, 0xcb, 0x8c, 0x0d, 0xaa, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb0,
+  0xff, 0x8e, 0x00, 0x00, 0x80, 0xff, 0xae, 0x0a, 0x86, 0x99, 0x99, 0x99,
+  0xcd, 0x11, 0x11, 0x11, 0x11, 0xc1, 0x93, 0x8e, 0x0d, 0x97, 0xf6, 0x33,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x65, 0xb7, 0x8b,
+  0x0f, 0x83, 0xf6, 0x5d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x34, 0x8b, 0x0f, 0x39, 0x7c, 0x7c, 0x7c, 0x51,
+  0x1d, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xd9, 0x7c, 0x7c, 0x7c, 0x34, 0x8b,
+  0x04, 0x7d, 0x7c, 0x72, 0xe4, 0x91, 0x85, 0x04, 0xbb, 0x7c, 0x7c, 0x7c,
+  0xd8, 0x8b, 0x02, 0x7d, 0x74, 0x0f, 0x86, 0x05, 0x85, 0x35, 0x7c, 0x7c,
+  0x22, 0x8c, 0x8b, 0x01, 0xa4, 0xa0, 0x87, 0x04, 0x22, 0x7c, 0x7c, 0x7c,
+  0xc8, 0x95, 0x05, 0xe9, 0x7d, 0x7c, 0x7c, 0x1c, 0x87, 0x94, 0x05, 0xe9,
+  0x7c, 0x7d, 0x7c, 0x59, 0x84, 0x95, 0x06, 0x27, 0x7d, 0x7f, 0x7d, 0x6c,
+  0xee, 0x8a, 0x94, 0x09, 0xe3, 0x6f, 0x7d, 0x7c, 0x7c, 0x7c, 0x62, 0x11,
+  0xe9, 0x8f, 0x92, 0x0a, 0xae, 0xe6, 0x6d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x58, 0xea, 0x82, 0x92, 0x08, 0xb0, 0xe5, 0x4c, 0x6e, 0x7c, 0x7c, 0x7c,
+  0x7c, 0xf3, 0x95, 0x05, 0xb4, 0xfc, 0x7c, 0x7c, 0x7c, 0x7c, 0x91, 0x09,
+  0xc9, 0xc9, 0xc9, 0xc9, 0x1f, 0x52, 0x7c, 0x7c, 0x7c, 0x7c, 0x8e, 0x0c,
+  0xa1, 0x42, 0x4d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0xf2, 0x8e, 0x0c, 0x48, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x29, 0xaf, 0x82, 0x8e, 0x0a, 0xc3, 0x0f, 0x0f, 0x10, 0x0f, 0x0f,
+  0x0f, 0xba, 0x97, 0x97, 0x84, 0xf6, 0x00, 0x00, 0x80, 0xff, 0x9b, 0x03,
+  0xb3, 0x74, 0x7f, 0x61, 0x8e, 0x03, 0x99, 0xa4, 0xa4, 0x84, 0x84, 0x03,
+  0xf0, 0x7d, 0x7d, 0x60, 0x8e, 0x03, 0x2b, 0x7d, 0x7d, 0x9d, 0x83, 0x04,
+  0x91, 0x5d, 0x7d, 0x7d, 0x60, 0x8d, 0x04, 0x9b, 0x69, 0x7d, 0x7d, 0x9d,
+  0x83, 0x04, 0xce, 0x7d, 0x7d, 0x7d, 0x07, 0x8d, 0x04, 0x04, 0x7d, 0x7d,
+  0x5e, 0x93, 0x83, 0x04, 0xce, 0x7d, 0x7d, 0x79, 0xc5, 0x8c, 0x04, 0x90,
+  0x72, 0x7d, 0x7d, 0x24, 0x84, 0x03, 0xce, 0x7d, 0x7d, 0x71, 0x8d, 0x04,
+  0x92, 0x7d, 0x7d, 0x7d, 0x24, 0x84, 0x03, 0x3e, 0x7d, 0x7d, 0x00, 0x8d,
+  0x04, 0x92, 0x7d, 0x7d, 0x7d, 0xe3, 0x83, 0x04, 0xa2, 0x64, 0x7d, 0x7d,
+  0xfc, 0x82, 0x00, 0x8c, 0x89, 0x04, 0x92, 0x7d, 0x7d, 0x7d, 0xaf, 0x83,
+  0x0a, 0xcf, 0x7d, 0x7d, 0x7d, 0x10, 0xef, 0x20, 0x20, 0x4b, 0x20, 0x8b,
+  0x87, 0x13, 0x92, 0x7d, 0x7d, 0x7d, 0x16, 0xbc, 0xbc, 0xbc, 0xcf, 0x67,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x91, 0x87, 0x13,
+  0x92, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x64, 0x01, 0x84, 0x87, 0x11, 0x83, 0xfe,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x20,
+  0x1e, 0xd2, 0xa9, 0x9c, 0x8a, 0x0c, 0x84, 0x97, 0xf0, 0x0d, 0x0d, 0xd3,
+  0xa2, 0xd6, 0x5c, 0x7d, 0x7d, 0x17, 0x81, 0x96, 0x03, 0x31, 0x7d, 0x7d,
+  0x0d, 0x97, 0x03, 0x31, 0x7d, 0x7d, 0x0d, 0x97, 0x03, 0x31, 0x7d, 0x7d,
+  0x0d, 0x97, 0x04, 0x31, 0x7d, 0x7d, 0x5e, 0x84, 0x96, 0x04, 0x31, 0x7d,
+  0x7d, 0x7d, 0x85, 0x96, 0x04, 0xcc, 0x7d, 0x7d, 0x7d, 0xec, 0x96, 0x04,
+  0x84, 0x10, 0x7d, 0x7d, 0xfc, 0xdc, 0x00, 0x00, 0x80, 0xff, 0x94, 0x0e,
+  0x8b, 0x4a, 0x7d, 0x09, 0x98, 0x98, 0x98, 0x98, 0x98, 0xc2, 0x0a, 0x0b,
+  0x0a, 0x0a, 0x99, 0x8c, 0x0e, 0xf4, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0xad, 0x8c, 0x0e, 0x12, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x2a,
+  0x8d, 0x8c, 0x0d, 0x66, 0x7d, 0x7c, 0x63, 0x20, 0x20, 0x21, 0x20, 0x20,
+  0x20, 0xb8, 0xae, 0xad, 0x8d, 0x8d, 0x03, 0x66, 0x7d, 0x7c, 0xcf, 0x96,
+  0x03, 0xb3, 0x73, 0x7f, 0x4f, 0x97, 0x03, 0xdd, 0x7c, 0x7d, 0x4e, 0x97,
+  0x08, 0xfc, 0x7c, 0x7d, 0x5b, 0xc6, 0xc6, 0xfa, 0xc6, 0xb9, 0x91, 0x0b,
+  0xb9, 0x74, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x74, 0xfc, 0x91,
+  0x8f, 0x0c, 0xc6, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x40, 0x8b, 0x8f, 0x0b, 0x08, 0x7b, 0x72, 0x1d, 0xa0, 0xdf, 0xf4,
+  0x69, 0x7d, 0x7d, 0x7d, 0x49, 0x90, 0x01, 0xd4, 0xaa, 0x83, 0x05, 0x89,
+  0x2d, 0x7c, 0x7c, 0x7c, 0x96, 0x96, 0x04, 0xa2, 0x6a, 0x7c, 0x7c, 0x12,
+  0x97, 0x03, 0x38, 0x7c, 0x7c, 0x66, 0x97, 0x04, 0x38, 0x7c, 0x7c, 0x71,
+  0xaa, 0x8b, 0x04, 0x85, 0xec, 0x0a, 0x3f, 0x8b, 0x84, 0x05, 0x8f, 0x3f,
+  0x7d, 0x7d, 0x7c, 0xd4, 0x8b, 0x05, 0xe3, 0x7c, 0x7c, 0x7c, 0x0c, 0x91,
+  0x81, 0x06, 0x96, 0xee, 0x5b, 0x7c, 0x7c, 0x7c, 0x51, 0x8c, 0x0e, 0xa2,
+  0x6a, 0x7c, 0x7c, 0x7d, 0x51, 0x38, 0x38, 0x57, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x5d, 0xa0, 0x8d, 0x0c, 0x0e, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x63, 0xf7, 0x99, 0x8e, 0x0a, 0x87, 0x96, 0x00, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x48, 0x09, 0xf5, 0x90, 0xdd, 0x00, 0x80, 0xc2, 0x04, 0x83,
+  0xf6, 0x7d, 0x7d, 0x7d, 0x96, 0x04, 0xf6, 0x7c, 0x7c, 0x7c, 0x32, 0x95,
+  0x05, 0xa0, 0x7d, 0x7c, 0x7c, 0x63, 0xb0, 0x95, 0x04, 0x1d, 0x7d, 0x7c,
+  0x63, 0xb2, 0x95, 0x04, 0xd5, 0x7a, 0x7d, 0x7c, 0x02, 0x96, 0x04, 0x1b,
+  0x7d, 0x7f, 0x64, 0xa0, 0x95, 0x04, 0xc2, 0x6c, 0x7c, 0x7d, 0x04, 0x96,
+  0x04, 0x38, 0x7c, 0x7c, 0x7d, 0xdc, 0x96, 0x04, 0x38, 0x7c, 0x7c, 0x6a,
+  0x91, 0x95, 0x04, 0x96, 0x57, 0x7c, 0x7c, 0xfe, 0x81, 0x07, 0xab, 0xf4,
+  0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xb5, 0x8c, 0x10, 0xab, 0x77, 0x7d, 0x7d,
+  0x3f, 0x54, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0xf6,
+  0x87, 0x8a, 0x11, 0x9e, 0x64, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x79, 0x4e, 0x4e, 0x74, 0x7c, 0x7d, 0x7c, 0x3a, 0x9d, 0x89, 0x09, 0xaf,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x43, 0x02, 0xbf, 0x81, 0x05, 0xb8,
+  0x6c, 0x7d, 0x7c, 0x7c, 0xad, 0x89, 0x07, 0xaf, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x19, 0x89, 0x83, 0x05, 0xa2, 0x6e, 0x7d, 0x7c, 0x43, 0x89, 0x89,
+  0x06, 0xaf, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0xc5, 0x83, 0x05, 0xa0, 0x5a,
+  0x7c, 0x7d, 0x7c, 0xcf, 0x8b, 0x0e, 0x39, 0x7d, 0x7d, 0x7f, 0x7d, 0x3e,
+  0x85, 0x80, 0x83, 0xad, 0x5e, 0x7d, 0x7d, 0x7c, 0x07, 0x8c, 0x0d, 0x38,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0xd3, 0xaf, 0x2a, 0x7c, 0x7c, 0x7c, 0x67,
+  0x3c, 0x8d, 0x0c, 0x19, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x7c, 0x63, 0xe4, 0x8e, 0x0b, 0x8d, 0x2d, 0x7c, 0x7d, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x39, 0xb2, 0x90, 0x09, 0xb3, 0x3d, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x48, 0x00, 0x96, 0x86, 0xff, 0xb0, 0x80, 0xff, 0xac, 0x04,
+  0xd4, 0x56, 0x7e, 0x22, 0x99, 0x96, 0x05, 0x1d, 0x7d, 0x7d, 0x7d, 0x25,
+  0xa0, 0x84, 0x03, 0x91, 0x99, 0x99, 0x91, 0x8c, 0x0f, 0xd3, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x59, 0xb0, 0xa5, 0xa5, 0xeb, 0x1d, 0x5e, 0x7d, 0x7d, 0x5d,
+  0xe2, 0x8b, 0x0f, 0xa5, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x1c, 0x8b, 0x0f, 0xa5, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x1c, 0x8b, 0x0f, 0x93, 0x55, 0x7d, 0x7d, 0x42, 0x34, 0x34, 0x34, 0xf6,
+  0xbc, 0xbc, 0x3d, 0x7d, 0x7d, 0x7d, 0x1c, 0x8b, 0x04, 0xa5, 0x7d, 0x7d,
+  0x7d, 0xb0, 0x85, 0x04, 0x29, 0x7d, 0x7d, 0x7d, 0x1c, 0x8b, 0x04, 0xa5,
+  0x7d, 0x7d, 0x7d, 0xde, 0x84, 0x05, 0xa0, 0x72, 0x7d, 0x7d, 0x7d, 0xef,
+  0x8b, 0x04, 0x84, 0x31, 0x7d, 0x7d, 0xef, 0x84, 0x05, 0xa5, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xa4, 0x8c, 0x03, 0xd9, 0x21, 0x5a, 0x9e, 0x84, 0x05, 0xdf,
+  0x7d, 0x7d, 0x7d, 0x55, 0x93, 0x94, 0x05, 0x8d, 0x51, 0x7f, 0x7e, 0x7e,
+  0xea, 0x95, 0x05, 0x99, 0x7d, 0x7d, 0x7d, 0x7d, 0xb0, 0x95, 0x05, 0x99,
+  0x7d, 0x7d, 0x7d, 0x7d, 0xb0, 0x95, 0x05, 0x99, 0x7d, 0x7d, 0x7d, 0x6f,
+  0xa7, 0x95, 0x04, 0xb6, 0x7d, 0x7d, 0x7d, 0x34, 0x96, 0x04, 0x11, 0x7d,
+  0x7d, 0x7d, 0x34, 0x96, 0x04, 0x11, 0x7d, 0x7d, 0x7d, 0xd3, 0x95, 0x05,
+  0x8b, 0x6e, 0x7d, 0x7d, 0x7d, 0xbc, 0x95, 0x05, 0x82, 0x1b, 0x7d, 0x7d,
+  0x7d, 0xf6, 0x96, 0x04, 0xd8, 0x7d, 0x7d, 0x43, 0x83, 0xc0, 0x00, 0x00,
+  0x80, 0xff, 0x95, 0x0b, 0x8a, 0x22, 0x7d, 0x7d, 0x7f, 0x66, 0x9e, 0x04,
+  0x04, 0x04, 0xa3, 0x88, 0x8d, 0x0d, 0x86, 0x99, 0x51, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x1b, 0x8c, 0x0e, 0x99, 0x11,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x1b, 0x8b, 0x0f, 0x87, 0x39, 0x7c, 0x7c, 0x7c, 0x6a, 0x18, 0x47, 0x7d,
+  0x60, 0x4c, 0x6c, 0x7c, 0x7c, 0x7c, 0x1b, 0x8b, 0x05, 0xfb, 0x7c, 0x7c,
+  0x7c, 0x68, 0xbd, 0x81, 0x07, 0xc8, 0x9f, 0x80, 0x29, 0x7c, 0x7c, 0x7c,
+  0x1b, 0x8a, 0x05, 0x93, 0x66, 0x7c, 0x7c, 0x7c, 0xcc, 0x83, 0x06, 0x87,
+  0xda, 0x69, 0x7c, 0x7c, 0x64, 0xb6, 0x8a, 0x05, 0x85, 0x2e, 0x7c, 0x7c,
+  0x7c, 0x11, 0x83, 0x05, 0xc1, 0x7c, 0x7c, 0x7c, 0x7c, 0xc6, 0x8c, 0x05,
+  0xb6, 0x7c, 0x7c, 0x7c, 0x70, 0xcd, 0x81, 0x06, 0x20, 0x6d, 0x7c, 0x7c,
+  0x7c, 0x3e, 0x87, 0x8c, 0x0d, 0x95, 0x58, 0x7c, 0x7c, 0x7c, 0x73, 0xf8,
+  0x26, 0x7d, 0x7c, 0x7c, 0x7c, 0x45, 0x91, 0x8e, 0x0b, 0xd9, 0x5a, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0xcd, 0x90, 0x09, 0x9d,
+  0x55, 0x7b, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x0d, 0x93, 0x08, 0xd8,
+  0x5c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x1d, 0x87, 0x93, 0x08, 0xe1, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x1b, 0x9a, 0x92, 0x09, 0xe1, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0xa0, 0x91, 0x09, 0xe1, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xcd, 0x91, 0x0a, 0xe1, 0x7c, 0x7c,
+  0x7d, 0x6a, 0xd7, 0x7c, 0x7c, 0x7c, 0x68, 0x9b, 0x90, 0x0a, 0xe1, 0x7c,
+  0x7c, 0x7d, 0x6c, 0xed, 0x7c, 0x7c, 0x7c, 0x7c, 0xa4, 0x90, 0x0a, 0x8e,
+  0x3a, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xa4, 0x91, 0x09,
+  0x8a, 0x72, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xfc, 0x84, 0x92, 0x07,
+  0xc5, 0x43, 0x7c, 0x7c, 0x65, 0xe7, 0x8b, 0x83, 0xda, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xb1, 0x07, 0xad, 0x0d, 0x71, 0x7f, 0x7d, 0x7d, 0x4b, 0xbf,
+  0x82, 0x01, 0x9d, 0x45, 0x8d, 0x08, 0xdf, 0x61, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0xf1, 0x82, 0x01, 0x8a, 0xc1, 0x8d, 0x08, 0x65, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0xf1, 0x91, 0x09, 0x49, 0x7d, 0x7c, 0x7c,
+  0x4a, 0x9c, 0x32, 0x7c, 0x7c, 0xf1, 0x90, 0x0b, 0xb0, 0x71, 0x7f, 0x77,
+  0x3b, 0x8d, 0x80, 0xb9, 0x7d, 0x7d, 0x9a, 0x8d, 0x8f, 0x03, 0x20, 0x7c,
+  0x7d, 0x44, 0x82, 0x05, 0x93, 0x57, 0x7c, 0x74, 0x4e, 0xf1, 0x8e, 0x03,
+  0x45, 0x7c, 0x7d, 0x44, 0x82, 0x05, 0xd2, 0x70, 0x7c, 0x7d, 0x7c, 0x28,
+  0x8e, 0x0f, 0x13, 0x7c, 0x7d, 0x76, 0x61, 0x61, 0x62, 0x73, 0x7c, 0x7c,
+  0x7d, 0x7c, 0xf6, 0x80, 0x9a, 0xfd, 0x8b, 0x0f, 0xa6, 0x62, 0x7e, 0x7d,
+  0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x5e, 0x99, 0x80, 0x9d, 0x45,
+  0x8c, 0x0a, 0xa6, 0x12, 0x50, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x44, 0x81, 0x01, 0x9d, 0x44, 0x8e, 0x08, 0x8d, 0xb8, 0xb8, 0xb8, 0xe4,
+  0x7c, 0x7c, 0x7d, 0x44, 0x81, 0x01, 0x9d, 0x44, 0x92, 0x04, 0xb9, 0x7c,
+  0x7c, 0x7d, 0x44, 0x81, 0x01, 0x9d, 0x44, 0x92, 0x04, 0xb9, 0x7d, 0x7d,
+  0x7e, 0x45, 0x81, 0x01, 0x9d, 0x38, 0x92, 0x04, 0xb9, 0x7c, 0x7c, 0x7d,
+  0x44, 0x81, 0x01, 0x8a, 0x9c, 0x92, 0x04, 0xb9, 0x7c, 0x7c, 0x7d, 0x44,
+  0x96, 0x04, 0xb9, 0x7c, 0x7c, 0x7d, 0x44, 0x96, 0x04, 0xb9, 0x7d, 0x7d,
+  0x7e, 0x45, 0x96, 0x05, 0xac, 0x70, 0x7c, 0x7d, 0x50, 0x8d, 0x96, 0x05,
+  0xd1, 0x73, 0x7d, 0x7c, 0x2b, 0x8a, 0x96, 0x04, 0xfd, 0x4b, 0x7c, 0xff,
+  0x83, 0xbe, 0x00, 0x00, 0x80, 0xff, 0xb5, 0x06, 0xdb, 0xf6, 0xf6, 0xf6,
+  0xf6, 0xba, 0xad, 0x8f, 0x0d, 0xab, 0x1e, 0x71, 0x71, 0x71, 0x7b, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x77, 0x76, 0x67, 0xb1, 0x8c, 0x0f, 0xe2, 0x65, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x6c,
+  0xb0, 0x89, 0x11, 0xae, 0x1b, 0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x10,
+  0xb8, 0x1b, 0x1b, 0x2a, 0x7d, 0x7d, 0x7d, 0x7d, 0x26, 0x89, 0x08, 0x24,
+  0x7d, 0x7d, 0x7d, 0x5c, 0xb3, 0xa0, 0xa0, 0x88, 0x82, 0x06, 0x85, 0x00,
+  0x7d, 0x7d, 0x7d, 0x7c, 0xec, 0x87, 0x05, 0x15, 0x7c, 0x7d, 0x7d, 0x5c,
+  0xa9, 0x87, 0x05, 0x85, 0x2b, 0x7d, 0x7d, 0x7d, 0xfb, 0x87, 0x04, 0x7e,
+  0x7d, 0x7d, 0x7d, 0x1b, 0x89, 0x04, 0x1c, 0x7d, 0x7d, 0x7d, 0x23, 0x87,
+  0x04, 0x7e, 0x7d, 0x7d, 0x7d, 0xb4, 0x89, 0x04, 0xb5, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x87, 0x04, 0x7e, 0x7d, 0x7d, 0x7d, 0x99, 0x89, 0x04, 0x00, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x87, 0x04, 0x7e, 0x7d, 0x7d, 0x7d, 0xb8, 0x87, 0x06,
+  0x8a, 0x0f, 0x65, 0x7d, 0x7d, 0x7d, 0x1b, 0x87, 0x04, 0x7e, 0x7d, 0x7d,
+  0x7d, 0x1b, 0x87, 0x06, 0xc3, 0x7d, 0x7d, 0x7d, 0x7d, 0x5e, 0xa3, 0x87,
+  0x05, 0x0d, 0x7c, 0x7d, 0x7d, 0x5f, 0xae, 0x83, 0x08, 0x8b, 0xae, 0x08,
+  0x64, 0x7d, 0x7d, 0x7a, 0x49, 0xa4, 0x89, 0x0f, 0x78, 0x7d, 0x7d, 0x7d,
+  0x5f, 0xae, 0x80, 0x8c, 0xc9, 0x3d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0x45,
+  0x8b, 0x0e, 0x24, 0x7d, 0x7d, 0x7d, 0x7d, 0x5f, 0x23, 0x3d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x68, 0x02, 0x8c, 0x0d, 0xad, 0x1a, 0x7b, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x6b, 0x4f, 0xa3, 0x8f, 0x09, 0x15,
+  0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0x4f, 0xa0, 0x92, 0x06, 0xab,
+  0xee, 0x5d, 0x70, 0x4b, 0xee, 0xd5, 0xff, 0x97, 0x80, 0xff, 0x96, 0x06,
+  0xd5, 0x7c, 0x7c, 0x7c, 0x5b, 0xab, 0x95, 0x93, 0x07, 0x8f, 0x0c, 0x7a,
+  0x7a, 0x7a, 0x7c, 0x7a, 0xfd, 0x93, 0x07, 0xab, 0x7a, 0x7a, 0x7a, 0x7a,
+  0x7c, 0x7a, 0xfd, 0x93, 0x07, 0xab, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a,
+  0xfd, 0x93, 0x07, 0xab, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0xfd, 0x93,
+  0x07, 0xab, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x7c, 0xfe, 0x93, 0x08, 0xab,
+  0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x26, 0x9c, 0x92, 0x08, 0xab, 0x7a,
+  0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0xd3, 0x92, 0x08, 0xab, 0x7a, 0x7a,
+  0x7a, 0x7a, 0x7c, 0x7a, 0x25, 0x9b, 0x92, 0x07, 0x87, 0xef, 0x7a, 0x7a,
+  0x7a, 0x7c, 0x7a, 0xfd, 0x93, 0x08, 0xa4, 0x60, 0x7c, 0x7c, 0x7c, 0x7f,
+  0x7c, 0x12, 0x8e, 0x93, 0x07, 0xd5, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a,
+  0xd3, 0x93, 0x07, 0xd5, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0xd3, 0x93,
+  0x07, 0xd5, 0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0x25, 0x9b, 0x93, 0x06, 0xd5,
+  0x7a, 0x7a, 0x7a, 0x7c, 0x7a, 0xfd, 0x95, 0x06, 0x00, 0x7c, 0x7c, 0x7f,
+  0x7c, 0x7c, 0xd3, 0x94, 0x07, 0xff, 0x7a, 0x7a, 0x7c, 0x7a, 0x7a, 0x0a,
+  0x8e, 0x93, 0x07, 0xbf, 0x51, 0x7a, 0x7c, 0x7a, 0x7a, 0x7a, 0xa9, 0x94,
+  0x06, 0xb8, 0x5f, 0x7c, 0x7a, 0x7a, 0x7a, 0xa9, 0x95, 0x05, 0xa2, 0x7c,
+  0x7a, 0x7a, 0xee, 0x87, 0xdb, 0x00, 0x00, 0x00, 0x80, 0xf6, 0x07, 0xcf,
+  0x3f, 0x3f, 0x69, 0x7d, 0x7d, 0xee, 0xce, 0x91, 0x0c, 0xa0, 0x45, 0x72,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x48, 0xc9, 0xc9, 0xaa, 0x8e, 0x0e,
+  0x54, 0x7c, 0x7c, 0x7c, 0x7c, 0x71, 0x71, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x5e, 0x35, 0xc8, 0x8c, 0x0f, 0x7d, 0x7c, 0x7c, 0x7c, 0x3d, 0xcd, 0xce,
+  0xec, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x57, 0x81, 0x8b, 0x04, 0x3f,
+  0x7c, 0x7c, 0x7c, 0xd2, 0x83, 0x06, 0xaa, 0x1f, 0x7c, 0x7d, 0x7c, 0x7c,
+  0xec, 0x8b, 0x03, 0xce, 0x33, 0x1e, 0xa3, 0x85, 0x05, 0xce, 0x7c, 0x7d,
+  0x7c, 0x7c, 0xec, 0x94, 0x06, 0xb5, 0x68, 0x7c, 0x7d, 0x7c, 0x76, 0xdc,
+  0x93, 0x06, 0xbf, 0x2f, 0x7c, 0x7c, 0x7d, 0x7c, 0x57, 0x93, 0x07, 0xbf,
+  0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x1a, 0x92, 0x08, 0xb5, 0x2f, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x14, 0x8a, 0x92, 0x07, 0x35, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x6d, 0x9e, 0x92, 0x07, 0xaa, 0x5d, 0x7c, 0x7d, 0x7c, 0x7c,
+  0x28, 0xbe, 0x92, 0x07, 0xaf, 0x69, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0xec,
+  0x93, 0x07, 0xed, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x33, 0x8f, 0x93, 0x09,
+  0xed, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0xe2, 0xa5, 0xa5, 0x85, 0x90, 0x10,
+  0x81, 0x3f, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x1f, 0x10,
+  0x10, 0x11, 0x10, 0x10, 0x10, 0x8a, 0x10, 0x81, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d,
+  0x8a, 0x10, 0x81, 0x00, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x8b, 0x0f, 0x9f, 0x43, 0x57,
+  0x57, 0x59, 0x57, 0x57, 0x57, 0x59, 0x57, 0x71, 0x7c, 0x6d, 0x77, 0x67,
+  0x67, 0x95, 0x05, 0xce, 0xec, 0xbe, 0xdd, 0xae, 0xae, 0xf2, 0x00, 0x00,
+  0x80, 0xff, 0xc6, 0x0f, 0x5e, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x1b, 0xf3,
+  0xf3, 0xf3, 0xf3, 0xfc, 0x5f, 0x5f, 0x25, 0xa7, 0x8b, 0x0f, 0x00, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x3d, 0x8b, 0x0f, 0x8a, 0x0f, 0x2d, 0x2d, 0x2d, 0x2d, 0x5f, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x76, 0x00, 0x91, 0x09, 0x91, 0x9b,
+  0x9b, 0xb9, 0x68, 0x7e, 0x7e, 0x7e, 0x6a, 0xa3, 0x92, 0x07, 0xa6, 0xb9,
+  0x5c, 0x7e, 0x7e, 0x7e, 0x57, 0xe0, 0x91, 0x08, 0x84, 0xed, 0x71, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x6a, 0xa0, 0x92, 0x08, 0xb5, 0x55, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x75, 0xf4, 0x84, 0x92, 0x0a, 0x84, 0xf1, 0x72, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x34, 0x17, 0xa9, 0x92, 0x09, 0xcf, 0x22, 0x22, 0x6b, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x71, 0xca, 0x94, 0x08, 0x8d, 0x99, 0x15, 0x69, 0x7e,
+  0x7e, 0x78, 0x53, 0x90, 0x96, 0x05, 0x0c, 0x6c, 0x7e, 0x7e, 0x67, 0x99,
+  0x8f, 0x02, 0xb1, 0xe3, 0xbf, 0x83, 0x04, 0x00, 0x7e, 0x7e, 0x7e, 0x56,
+  0x8e, 0x0c, 0xd4, 0x7a, 0x7e, 0x7b, 0x0e, 0x08, 0x08, 0x71, 0x7b, 0x7e,
+  0x7e, 0x7e, 0x39, 0x8e, 0x0c, 0x9c, 0x70, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7f, 0x7e, 0x7e, 0x50, 0xcb, 0x8f, 0x0a, 0xdd, 0x59, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x54, 0xdb, 0x8d, 0x91, 0x07, 0x83, 0xac, 0xf2,
+  0xf2, 0xf2, 0x89, 0x85, 0x83, 0xff, 0x93, 0x00, 0x80, 0xff, 0x91, 0x04,
+  0x83, 0xf6, 0x7d, 0x7d, 0x14, 0x84, 0x03, 0x98, 0xad, 0xb7, 0x85, 0x8d,
+  0x04, 0x98, 0x7c, 0x7c, 0x7c, 0x7c, 0x84, 0x03, 0x7d, 0x7c, 0x7c, 0xf7,
+  0x8d, 0x04, 0x98, 0x7c, 0x7c, 0x7c, 0x28, 0x83, 0x04, 0xd5, 0x7d, 0x7c,
+  0x7c, 0x00, 0x8d, 0x04, 0x98, 0x7c, 0x7c, 0x7c, 0x09, 0x83, 0x04, 0x1d,
+  0x7d, 0x7c, 0x7c, 0xad, 0x8d, 0x04, 0x98, 0x7c, 0x7c, 0x7c, 0x09, 0x82,
+  0x05, 0xab, 0x70, 0x7d, 0x7c, 0x5d, 0x99, 0x8d, 0x04, 0x98, 0x7d, 0x7d,
+  0x7d, 0x00, 0x82, 0x04, 0xe8, 0x7d, 0x7f, 0x7d, 0x2d, 0x8e, 0x04, 0x98,
+  0x7c, 0x7c, 0x7c, 0x96, 0x81, 0x05, 0x8d, 0x57, 0x7c, 0x7d, 0x7c, 0xc5,
+  0x8e, 0x04, 0xb7, 0x7c, 0x7c, 0x7c, 0x96, 0x81, 0x05, 0xc6, 0x7c, 0x7c,
+  0x7d, 0x7c, 0xc5, 0x8e, 0x04, 0x0a, 0x7c, 0x7c, 0x7c, 0x96, 0x81, 0x0b,
+  0xa6, 0x68, 0x7c, 0x7d, 0x7c, 0xc5, 0x80, 0xab, 0xb3, 0xdd, 0xdd, 0xbb,
+  0x88, 0x04, 0x0a, 0x7c, 0x7c, 0x7c, 0x96, 0x81, 0x0c, 0xfa, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x6c, 0x66, 0x70, 0x73, 0x7c, 0x7c, 0x74, 0xfe, 0x87, 0x13,
+  0x0b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0xcb, 0x87, 0x13, 0xf6, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x79, 0x4e, 0x4e, 0xf0, 0x88, 0x87, 0x0f, 0x87, 0x0d, 0x6a, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x70, 0x37, 0xd9, 0xc5, 0xbf,
+  0x8d, 0x09, 0xa1, 0xad, 0xad, 0xae, 0xad, 0xe6, 0x7c, 0x7c, 0x7d, 0x4e,
+  0x96, 0x04, 0xc6, 0x7c, 0x7c, 0x7d, 0x4e, 0x96, 0x04, 0xc6, 0x7d, 0x7d,
+  0x7f, 0x4f, 0x96, 0x04, 0xc6, 0x7c, 0x7c, 0x7d, 0x4e, 0x96, 0x05, 0xb3,
+  0x70, 0x7c, 0x7d, 0x5b, 0x93, 0x96, 0x04, 0xf1, 0x7c, 0x7d, 0x7c, 0x22,
+  0x96, 0x04, 0xb3, 0x3d, 0x7d, 0x67, 0xb0, 0xdc, 0x80, 0xff, 0x93, 0x03,
+  0x3f, 0x7f, 0x7f, 0x00, 0x87, 0x03, 0x00, 0x00, 0x00, 0xc0, 0x8a, 0x10,
+  0x00, 0x7f, 0x7f, 0x7f, 0x3f, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x8a, 0x10, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00,
+  0x8a, 0x0f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x00, 0x8b, 0x0b, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x00, 0x8f, 0x04, 0x7f, 0x7f,
+  0x7f, 0x7f, 0xc0, 0x95, 0x04, 0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x96, 0x0b,
+  0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x00, 0x00,
+  0x8f, 0x0d, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x3f, 0x8d, 0x0f, 0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x8c, 0x0f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0xc0, 0x8c, 0x01, 0xc0, 0x00, 0x87, 0x04, 0x3f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x96, 0x04, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x95, 0x05,
+  0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x94, 0x06, 0xc0, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0xc0, 0x92, 0x07, 0xc0, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x3f, 0x8c, 0x0d, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x8d, 0x0c, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xc0, 0x8f, 0x09, 0x3f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x91, 0x06, 0xc0, 0x00,
+  0x3f, 0x7f, 0x7f, 0x3f, 0x00, 0xe0, 0x00, 0x00, 0x80, 0xe0, 0x05, 0x8d,
+  0x1b, 0x7e, 0x7e, 0x7f, 0xcf, 0x94, 0x06, 0x81, 0xf0, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x97, 0x94, 0x06, 0xf0, 0x7d, 0x7d, 0x7d, 0x7d, 0x24, 0x88, 0x93,
+  0x06, 0xc0, 0x76, 0x7d, 0x7d, 0x7d, 0x22, 0x8b, 0x93, 0x06, 0xa0, 0x6b,
+  0x7d, 0x7d, 0x7d, 0xed, 0x8b, 0x93, 0x06, 0xc0, 0x6b, 0x7d, 0x7d, 0x7d,
+  0x27, 0x89, 0x94, 0x05, 0xc8, 0x7d, 0x7d, 0x7d, 0x67, 0x84, 0x95, 0x04,
+  0xc8, 0x7d, 0x7d, 0x7d, 0x23, 0x95, 0x05, 0x89, 0x1c, 0x7d, 0x7d, 0x66,
+  0xaa, 0x95, 0x04, 0x08, 0x7d, 0x7d, 0x7d, 0x01, 0x82, 0x07, 0x93, 0xbc,
+  0xbc, 0xf9, 0x31, 0x31, 0xdd, 0x8d, 0x8a, 0x11, 0xc0, 0x6b, 0x7d, 0x7d,
+  0x7d, 0x01, 0x88, 0xce, 0x20, 0x55, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x28, 0xaf, 0x88, 0x12, 0x87, 0x3f, 0x7d, 0x7d, 0x7d, 0x7d, 0xf9, 0x25,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x18, 0x88,
+  0x12, 0x92, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x0f, 0x4e, 0x7d, 0x7d, 0x7d, 0x18, 0x88, 0x12, 0x89, 0x4a,
+  0x7d, 0x7d, 0x7d, 0x46, 0x3b, 0x7d, 0x7d, 0x7d, 0x50, 0xd0, 0x85, 0xcf,
+  0x7b, 0x7d, 0x7d, 0x79, 0xdb, 0x89, 0x10, 0x0c, 0x7d, 0x7d, 0x7d, 0x13,
+  0xee, 0x60, 0x60, 0x44, 0x99, 0x8c, 0x09, 0x7b, 0x7d, 0x7d, 0x7d, 0x1c,
+  0x8a, 0x05, 0x9d, 0x6e, 0x7d, 0x7d, 0x58, 0x87, 0x82, 0x07, 0xc9, 0x46,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x05, 0x93, 0x8b, 0x0e, 0x2b, 0x7d, 0x7d, 0x7d,
+  0x00, 0xc2, 0xc2, 0x14, 0x6d, 0x7d, 0x7d, 0x7d, 0x76, 0xef, 0x94, 0x8c,
+  0x0c, 0x05, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x53, 0xe0, 0x8e, 0x0b, 0x88, 0x17, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x58, 0xe5, 0x91, 0x90, 0x08, 0x85, 0xbb, 0x70, 0x7d, 0x7d, 0x7d,
+  0x2a, 0xe4, 0x8b, 0xff, 0x95, 0x00, 0x00, 0x00, 0x80, 0xff, 0xc6, 0x12,
+  0x06, 0x7e, 0x7e, 0x7e, 0x0a, 0x83, 0x80, 0x85, 0x8d, 0x8d, 0x8d, 0x98,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x9d, 0x82, 0x88, 0x12, 0x05, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x2b, 0x11, 0x3b, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xdd, 0x88, 0x13, 0xbb, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x54, 0x87, 0x87, 0x13, 0x85, 0x35, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7e, 0x61, 0x3b, 0xec, 0x70, 0x7d, 0x7d, 0x7d, 0x7d, 0x8b,
+  0x88, 0x0a, 0xb5, 0x66, 0x7d, 0x7d, 0x49, 0xc8, 0xc8, 0x36, 0xcd, 0xc8,
+  0x9f, 0x81, 0x05, 0x36, 0x7d, 0x7d, 0x7d, 0x7d, 0x8b, 0x89, 0x03, 0xb7,
+  0x34, 0x17, 0xab, 0x86, 0x06, 0xa6, 0x6c, 0x7d, 0x7d, 0x7d, 0x2a, 0x83,
+  0x94, 0x05, 0x13, 0x7d, 0x7d, 0x7d, 0x7d, 0xae, 0x95, 0x05, 0x29, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x98, 0x95, 0x05, 0x29, 0x7d, 0x7d, 0x7d, 0x25, 0x83,
+  0x94, 0x05, 0x92, 0x52, 0x7d, 0x7d, 0x7d, 0xe3, 0x95, 0x05, 0xab, 0x7f,
+  0x7e, 0x7e, 0x7a, 0xa2, 0x94, 0x05, 0x83, 0x27, 0x7d, 0x7d, 0x7d, 0x28,
+  0x95, 0x05, 0x99, 0x7d, 0x7d, 0x7d, 0x7d, 0x17, 0x95, 0x05, 0x99, 0x7d,
+  0x7d, 0x7d, 0x7d, 0xb0, 0x95, 0x05, 0xf0, 0x7d, 0x7d, 0x7d, 0x7d, 0xb0,
+  0x94, 0x06, 0x84, 0x30, 0x7d, 0x7d, 0x7d, 0x7d, 0x0c, 0x94, 0x06, 0x8d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x28, 0x94, 0x06, 0x8d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xc1, 0x94, 0x06, 0x87, 0x4f, 0x7d, 0x7d, 0x7d, 0x07, 0x85,
+  0x95, 0x04, 0x9e, 0x7d, 0x7d, 0x09, 0x83, 0xa4, 0x80, 0xff, 0x96, 0x0c,
+  0x8a, 0x8d, 0x8d, 0x8d, 0x8c, 0x80, 0x82, 0xf5, 0x7e, 0x44, 0x56, 0xd8,
+  0x82, 0x8b, 0x0f, 0x85, 0xb6, 0x11, 0x69, 0x7d, 0x7d, 0x7d, 0x74, 0x8b,
+  0xeb, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xdd, 0x8a, 0x11, 0x97, 0x08, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x37, 0xbc, 0x31, 0x62, 0x7d, 0x7d,
+  0x7d, 0x20, 0x82, 0x88, 0x12, 0xa8, 0x5e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7e, 0x65, 0x80, 0x8a, 0xe2, 0x7d, 0x7d, 0x7d, 0x34, 0x84,
+  0x87, 0x12, 0x89, 0x5f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x49, 0x41, 0x06,
+  0x3f, 0x37, 0xcf, 0x43, 0x7d, 0x7d, 0x7d, 0x7d, 0xba, 0x88, 0x07, 0x8d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x68, 0x0c, 0x89, 0x81, 0x08, 0xb0, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x65, 0x06, 0x86, 0x88, 0x05, 0x8d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0xfb, 0x81, 0x08, 0xce, 0xd5, 0x68, 0x7d, 0x7d, 0x7d, 0x7d, 0x3c,
+  0xb7, 0x8a, 0x0f, 0x82, 0x20, 0x7d, 0x7d, 0x7d, 0x73, 0x20, 0x5a, 0x7a,
+  0x7d, 0x7e, 0x7d, 0x7d, 0x6b, 0x00, 0x89, 0x8c, 0x0c, 0x99, 0x54, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x28, 0x93, 0x8f, 0x0a,
+  0xe4, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x3f, 0xf9, 0x85, 0x91,
+  0x08, 0x2a, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x3a, 0x86, 0x91, 0x0a,
+  0x95, 0x5a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x34, 0x8a, 0x90,
+  0x0a, 0xa5, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0xf2,
+  0x90, 0x0b, 0xa5, 0x7d, 0x7d, 0x7d, 0x44, 0xd4, 0x42, 0x7b, 0x7e, 0x7d,
+  0x71, 0x09, 0x8f, 0x0c, 0x8b, 0x41, 0x7d, 0x7d, 0x65, 0xb7, 0x80, 0xff,
+  0x7e, 0x7d, 0x7d, 0x70, 0x0a, 0x8f, 0x0c, 0x07, 0x7d, 0x7d, 0x7d, 0x67,
+  0xb5, 0x80, 0x22, 0x7d, 0x7d, 0x7d, 0x52, 0x92, 0x8e, 0x0c, 0x8a, 0x1a,
+  0x7d, 0x7d, 0x7d, 0x69, 0x14, 0x2e, 0x7d, 0x7d, 0x7d, 0x7d, 0xbc, 0x8f,
+  0x0b, 0xa6, 0x67, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x66,
+  0xa5, 0x90, 0x09, 0xb5, 0x35, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d,
+  0x0c, 0x92, 0x08, 0x84, 0xba, 0x04, 0x78, 0x7e, 0x7d, 0x32, 0xee, 0x84,
+  0xdb, 0x00, 0x00, 0x00, 0x80, 0xff, 0x98, 0x04, 0xc0, 0x3f, 0x7f, 0x7f,
+  0xc0, 0x93, 0x07, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x92,
+  0x09, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0xc0, 0x8f,
+  0x0a, 0xc0, 0xc0, 0x7f, 0x3f, 0x7f, 0x7f, 0x3f, 0x00, 0x3f, 0x7f, 0x7f,
+  0x90, 0x05, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x82, 0x01, 0x00, 0x3f,
+  0x90, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x85, 0x02, 0x00, 0x00, 0x00,
+  0x8c, 0x04, 0x7f, 0x7f, 0x7f, 0x7f, 0xc0, 0x85, 0x04, 0x00, 0x7f, 0x7f,
+  0x7f, 0x00, 0x8b, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x86, 0x04, 0x00, 0x7f,
+  0x7f, 0x7f, 0x00, 0x8b, 0x02, 0x7f, 0x7f, 0x7f, 0x85, 0x06, 0xc0, 0x3f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x8a, 0x10, 0xc0, 0x7f, 0x7f, 0x7f, 0x00,
+  0x80, 0xc0, 0x00, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00,
+  0x8a, 0x10, 0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x8b, 0x0f, 0x3f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x00, 0x8c, 0x0e, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0xc0,
+  0x80, 0x3f, 0x7f, 0x7f, 0x7f, 0x00, 0x90, 0x00, 0xc0, 0x84, 0x04, 0x00,
+  0x7f, 0x7f, 0x7f, 0x3f, 0x96, 0x04, 0x00, 0x7f, 0x7f, 0x7f, 0x3f, 0x96,
+  0x04, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x96, 0x04, 0x00, 0x7f, 0x7f, 0x7f,
+  0x00, 0x96, 0x04, 0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x97, 0x04, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x00, 0x97, 0x02, 0x3f, 0x7f, 0x3f, 0xd9, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0x99, 0x07, 0x8b, 0x98, 0x98, 0xec, 0x0a, 0xa2, 0x98, 0x89,
+  0x8f, 0x0c, 0x85, 0xc4, 0x21, 0x21, 0x4b, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x42, 0xc1, 0x8e, 0x0d, 0x0a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x6a, 0xc1, 0x8c, 0x0f, 0x08, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x30, 0x74, 0x7d, 0x7c, 0x7c, 0x6c,
+  0x93, 0x8a, 0x10, 0xd5, 0x7a, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0xf5,
+  0x96, 0x84, 0x95, 0x49, 0x7c, 0x7c, 0x7c, 0xcb, 0x89, 0x08, 0xc6, 0x7d,
+  0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x3e, 0xb5, 0x83, 0x04, 0x8b, 0x4b, 0x7d,
+  0x7d, 0x7d, 0x89, 0x07, 0x0e, 0x7c, 0x7c, 0x79, 0x19, 0x70, 0x7c, 0x09,
+  0x85, 0x03, 0x21, 0x7c, 0x7c, 0x7c, 0x88, 0x08, 0xa2, 0x6a, 0x7c, 0x7c,
+  0x47, 0x80, 0xb2, 0x22, 0xe4, 0x85, 0x03, 0x21, 0x7c, 0x7c, 0x7c, 0x88,
+  0x04, 0xaf, 0x7c, 0x7c, 0x7c, 0xf4, 0x88, 0x04, 0x89, 0x42, 0x7c, 0x7c,
+  0x1d, 0x88, 0x04, 0xe3, 0x7c, 0x7c, 0x7c, 0x8b, 0x88, 0x04, 0x35, 0x7c,
+  0x7c, 0x7c, 0xd5, 0x87, 0x04, 0x83, 0x2a, 0x7d, 0x7d, 0x34, 0x87, 0x06,
+  0x89, 0x35, 0x7f, 0x7d, 0x7d, 0x40, 0x8b, 0x87, 0x04, 0x98, 0x7c, 0x7c,
+  0x7c, 0x96, 0x86, 0x06, 0x8d, 0x2e, 0x7c, 0x7d, 0x7c, 0x70, 0xa5, 0x88,
+  0x04, 0x0a, 0x7c, 0x7c, 0x63, 0x90, 0x85, 0x06, 0x8d, 0x2c, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x17, 0x89, 0x03, 0x7d, 0x7c, 0x7c, 0x20, 0x85, 0x07, 0xbe,
+  0x57, 0x7c, 0x7c, 0x7c, 0x7d, 0xf8, 0x8d, 0x89, 0x03, 0x7d, 0x7c, 0x7c,
+  0x20, 0x84, 0x07, 0x1e, 0x73, 0x7c, 0x7c, 0x7c, 0x48, 0xcb, 0x88, 0x8a,
+  0x0e, 0x7f, 0x7d, 0x7d, 0x53, 0xa2, 0xd7, 0x0a, 0x2a, 0x7d, 0x7d, 0x7f,
+  0x7d, 0x6c, 0x07, 0x8b, 0x8c, 0x0c, 0x68, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x79, 0x39, 0x99, 0x8e, 0x0a, 0xb0, 0x63, 0x7c,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x08, 0xbf, 0x91, 0x08, 0xe7, 0x39,
+  0x7c, 0x7c, 0x75, 0x20, 0x20, 0xc2, 0x84, 0x93, 0x03, 0x87, 0x96, 0x96,
+  0x95, 0xe4, 0x00, 0x00, 0x80, 0xff, 0x98, 0x04, 0xcd, 0x7d, 0x7f, 0x7d,
+  0x1f, 0x96, 0x05, 0x12, 0x7c, 0x7d, 0x7c, 0x46, 0x91, 0x94, 0x06, 0x99,
+  0x71, 0x7c, 0x7d, 0x7c, 0x7c, 0xa7, 0x94, 0x06, 0x85, 0x23, 0x7c, 0x7d,
+  0x7c, 0x2d, 0x86, 0x94, 0x05, 0x96, 0x66, 0x7c, 0x7d, 0x7c, 0x1e, 0x95,
+  0x05, 0x9b, 0x7c, 0x7c, 0x7d, 0x7c, 0xbc, 0x95, 0x05, 0x9b, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x9a, 0x95, 0x05, 0xa9, 0x7c, 0x7c, 0x7d, 0x38, 0x8a, 0x95,
+  0x04, 0x20, 0x7c, 0x7c, 0x7d, 0x11, 0x96, 0x04, 0x20, 0x7c, 0x7c, 0x7d,
+  0x11, 0x96, 0x04, 0x21, 0x7d, 0x7d, 0x7f, 0x12, 0x96, 0x04, 0xe8, 0x7c,
+  0x7c, 0x7d, 0x11, 0x96, 0x04, 0x12, 0x7c, 0x7c, 0x7d, 0x11, 0x95, 0x05,
+  0xa2, 0x6e, 0x7c, 0x7c, 0x7d, 0x11, 0x95, 0x05, 0xa9, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x11, 0x95, 0x05, 0xa0, 0x68, 0x7c, 0x7c, 0x7d, 0x11, 0x96, 0x04,
+  0x20, 0x7c, 0x7c, 0x7d, 0x11, 0x96, 0x05, 0x20, 0x7c, 0x7c, 0x7d, 0x55,
+  0x91, 0x95, 0x05, 0xd3, 0x7c, 0x7c, 0x7d, 0x76, 0x99, 0x95, 0x04, 0x8d,
+  0x44, 0x7c, 0x7d, 0xcb, 0xde, 0x00, 0x00, 0x00, 0x80, 0xf7, 0x08, 0xdb,
+  0x58, 0x7e, 0x4e, 0x7e, 0x7e, 0x4e, 0xa2, 0x99, 0x91, 0x0a, 0xc6, 0x7a,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x4c, 0x8c, 0x90, 0x0c, 0x91,
+  0x4a, 0x7d, 0x5b, 0x1a, 0x1a, 0x38, 0x7d, 0x7e, 0x60, 0x99, 0xb5, 0xa3,
+  0x8f, 0x02, 0x86, 0x8a, 0x87, 0x81, 0x07, 0x84, 0xeb, 0x75, 0x7d, 0x75,
+  0x79, 0x46, 0x85, 0x95, 0x05, 0xc1, 0x6d, 0x7d, 0x7d, 0x7d, 0xcf, 0x95,
+  0x05, 0xb3, 0x4c, 0x7d, 0x7d, 0x7d, 0x25, 0x94, 0x06, 0xbb, 0x75, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x20, 0x93, 0x07, 0x8e, 0x63, 0x7e, 0x7d, 0x7d, 0x7d,
+  0x48, 0x96, 0x92, 0x07, 0x8e, 0x33, 0x7d, 0x7e, 0x7d, 0x7d, 0xc9, 0x97,
+  0x93, 0x06, 0xdd, 0x7d, 0x7d, 0x7e, 0x60, 0xb4, 0x82, 0x93, 0x05, 0x9a,
+  0x7e, 0x7e, 0x7e, 0x5e, 0xa2, 0x95, 0x04, 0x17, 0x7d, 0x7d, 0x7d, 0xd2,
+  0x96, 0x03, 0x68, 0x7d, 0x7d, 0x52, 0x96, 0x04, 0x0f, 0x7d, 0x7d, 0x7d,
+  0xd5, 0x95, 0x05, 0x8d, 0x53, 0x7d, 0x7d, 0x7d, 0xa1, 0x95, 0x0c, 0x0e,
+  0x7d, 0x7d, 0x7d, 0x7d, 0xee, 0xb3, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xaf,
+  0x8d, 0x0d, 0x9a, 0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x75, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x34, 0x8d, 0x0d, 0x18, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x6e, 0xbd, 0x8d, 0x0c, 0x52, 0x7d,
+  0x7d, 0x7d, 0x70, 0x0e, 0x22, 0x31, 0x13, 0xed, 0x30, 0xe8, 0xab, 0x8e,
+  0x04, 0x9b, 0x57, 0x7d, 0x48, 0xc6, 0xfe, 0x00, 0x80, 0xf3, 0x0d, 0x84,
+  0x90, 0xba, 0xd3, 0xf1, 0x9c, 0x02, 0x1e, 0x7e, 0x20, 0x02, 0x9e, 0x87,
+  0x81, 0x8c, 0x0e, 0x8a, 0x47, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xe8, 0x8c, 0x0f, 0xfa, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7b, 0x6b, 0x6b, 0x6b, 0x6b, 0x79, 0x7d, 0x7d, 0x7d, 0x27, 0x83,
+  0x8b, 0x05, 0x83, 0xe9, 0xf2, 0x64, 0x55, 0xda, 0x83, 0x05, 0xf8, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x9e, 0x95, 0x05, 0xd4, 0x7d, 0x7d, 0x7d, 0x7d, 0x9e,
+  0x95, 0x05, 0x40, 0x7d, 0x7d, 0x7d, 0x7d, 0x9e, 0x94, 0x06, 0x8b, 0x4b,
+  0x7d, 0x7d, 0x7d, 0x40, 0x8b, 0x93, 0x06, 0xa7, 0x41, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x20, 0x92, 0x08, 0x8a, 0xd1, 0x44, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0xc9, 0x92, 0x0a, 0xac, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x44,
+  0xcd, 0x86, 0x90, 0x0b, 0xac, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x12, 0xa7, 0x8f, 0x0c, 0x8a, 0x1a, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x2e, 0x84, 0x8f, 0x0b, 0x8a, 0xcc, 0x2c,
+  0x2c, 0x2c, 0x2c, 0x70, 0x7d, 0x7d, 0x7d, 0x7d, 0xf0, 0x95, 0x06, 0xa4,
+  0x35, 0x7d, 0x7d, 0x7d, 0x6a, 0x85, 0x95, 0x05, 0x0b, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x85, 0x94, 0x06, 0xa3, 0x67, 0x7d, 0x7d, 0x7d, 0x15, 0x81, 0x8a,
+  0x0f, 0x8b, 0x35, 0x66, 0x66, 0x66, 0x66, 0x47, 0xea, 0xea, 0xea, 0x59,
+  0x7d, 0x7d, 0x7d, 0x4f, 0x93, 0x8b, 0x0e, 0x99, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x4f, 0x93, 0x8c, 0x0d,
+  0x82, 0xd8, 0x41, 0x55, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x9e, 0x8f, 0x0b, 0x83, 0x84, 0xdb, 0x1c, 0x22, 0x01, 0x25, 0x7d,
+  0x7d, 0x22, 0x85, 0x81, 0xf7, 0x00, 0x00, 0x00, 0x80, 0xff, 0x99, 0x04,
+  0x8b, 0x61, 0x4e, 0x60, 0xd8, 0x96, 0x04, 0xce, 0x7c, 0x7d, 0x7c, 0x19,
+  0x91, 0x00, 0xac, 0x83, 0x04, 0xce, 0x7c, 0x7d, 0x7c, 0x19, 0x90, 0x0a,
+  0xe0, 0x77, 0x72, 0x72, 0x95, 0x80, 0xac, 0x6e, 0x7d, 0x7c, 0x19, 0x90,
+  0x0a, 0x2b, 0x7c, 0x7c, 0x7c, 0x95, 0x80, 0xbd, 0x75, 0x7d, 0x7c, 0x19,
+  0x8f, 0x05, 0xb5, 0x73, 0x7c, 0x7c, 0x5d, 0x8e, 0x81, 0x03, 0x5c, 0x7d,
+  0x7c, 0x19, 0x8e, 0x05, 0x82, 0xfb, 0x7c, 0x7c, 0x7a, 0xee, 0x81, 0x04,
+  0x89, 0x5e, 0x7d, 0x7c, 0x14, 0x8e, 0x04, 0xa2, 0x7c, 0x7c, 0x7c, 0x45,
+  0x82, 0x04, 0x3b, 0x7c, 0x7d, 0x7c, 0xac, 0x8e, 0x04, 0xa2, 0x7c, 0x7c,
+  0x7c, 0xf4, 0x82, 0x0a, 0x3b, 0x7c, 0x7d, 0x7c, 0xca, 0xce, 0x15, 0x3b,
+  0x3b, 0x28, 0xb6, 0x88, 0x04, 0xa2, 0x7c, 0x7c, 0x7c, 0xd8, 0x81, 0x0b,
+  0x94, 0x58, 0x7c, 0x7d, 0x7c, 0x6e, 0x7c, 0x7c, 0x7c, 0x7c, 0x69, 0xe3,
+  0x89, 0x11, 0x31, 0x7d, 0x7d, 0x65, 0x0f, 0x0f, 0x22, 0x7d, 0x7d, 0x7f,
+  0x7d, 0x7d, 0x7d, 0x68, 0x76, 0x7c, 0x5c, 0xb9, 0x89, 0x0f, 0x30, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x3d, 0xc1,
+  0xbc, 0xc9, 0x8b, 0x0c, 0xbc, 0x6b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x7c, 0xff, 0x82, 0x8f, 0x0a, 0xb4, 0x62, 0x66, 0x66, 0x31,
+  0xfd, 0x60, 0x7c, 0x7d, 0x77, 0xa8, 0x95, 0x04, 0xad, 0x7c, 0x7c, 0x7d,
+  0x3a, 0x96, 0x04, 0xad, 0x7c, 0x7c, 0x7d, 0x0a, 0x96, 0x04, 0xab, 0x79,
+  0x7c, 0x7d, 0x3a, 0x97, 0x04, 0x28, 0x7c, 0x7d, 0x63, 0xae, 0x96, 0x05,
+  0xce, 0x7c, 0x7d, 0x7c, 0x63, 0x88, 0x95, 0x05, 0x8a, 0x60, 0x7d, 0x4c,
+  0x51, 0x86, 0xdb, 0x00, 0x80, 0xff, 0x91, 0x10, 0x82, 0x85, 0x83, 0x8d,
+  0x8d, 0x8d, 0x8d, 0x8d, 0x06, 0x05, 0x05, 0x05, 0x22, 0x7e, 0x56, 0x05,
+  0x92, 0x8a, 0x11, 0xdf, 0x35, 0x2b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x1a, 0x82, 0x89, 0x11, 0xb6,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x8b, 0x89, 0x11, 0x1d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x74, 0x4d, 0x4d, 0x5d, 0x53, 0x18,
+  0x84, 0x89, 0x0b, 0x1d, 0x7d, 0x7d, 0x7d, 0x69, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0xf6, 0xba, 0x81, 0x01, 0x98, 0x8a, 0x8a, 0x05, 0x87, 0x39, 0x7d,
+  0x7d, 0x7d, 0xcc, 0x95, 0x05, 0xc1, 0x7d, 0x7d, 0x7d, 0x19, 0x89, 0x82,
+  0x03, 0xd6, 0xad, 0xd5, 0x9d, 0x8d, 0x10, 0x85, 0x3b, 0x7d, 0x7d, 0x7d,
+  0x05, 0xe2, 0xe2, 0x4f, 0x5a, 0x7e, 0x6c, 0x7d, 0x66, 0x5a, 0xfe, 0x93,
+  0x8a, 0x10, 0x8d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xe4, 0x8a, 0x12, 0x8d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7a, 0x0a, 0x8c, 0x88, 0x09, 0x8d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7a, 0x72, 0x3e, 0xfa, 0x82, 0x05, 0xd2, 0x59, 0x7e, 0x7e, 0x7e, 0x98,
+  0x88, 0x06, 0x8d, 0x7d, 0x7d, 0x7d, 0x7d, 0x76, 0x18, 0x86, 0x04, 0x36,
+  0x7d, 0x7d, 0x7d, 0xdd, 0x88, 0x05, 0x85, 0xec, 0x5e, 0x7d, 0x75, 0xe1,
+  0x87, 0x04, 0x36, 0x7d, 0x7d, 0x7d, 0x10, 0x8a, 0x02, 0x8d, 0xd4, 0xc0,
+  0x88, 0x04, 0x1e, 0x7d, 0x7d, 0x7d, 0xc0, 0x95, 0x05, 0xc0, 0x47, 0x7d,
+  0x7d, 0x38, 0x87, 0x8c, 0x05, 0xb5, 0xc9, 0x2b, 0x13, 0xc9, 0x84, 0x81,
+  0x05, 0xbf, 0x6a, 0x7d, 0x7d, 0x7d, 0x1c, 0x8c, 0x0e, 0x0a, 0x70, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x50, 0x4f, 0x14, 0x6b, 0x7d, 0x7d, 0x7d, 0x7d, 0xba,
+  0x8c, 0x0e, 0x98, 0xc1, 0x4b, 0x3d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x5d, 0x96, 0x8e, 0x0b, 0x8c, 0x88, 0xc6, 0x73, 0x7d,
+  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xbb, 0x92, 0x08, 0x8a, 0x00, 0x44,
+  0x7d, 0x7d, 0x7d, 0x26, 0xa8, 0x83, 0xda, 0x00, 0x80, 0xc2, 0x05, 0xba,
+  0x06, 0xd5, 0x54, 0x64, 0xa8, 0x94, 0x06, 0x8d, 0x00, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x31, 0x94, 0x06, 0x2a, 0x7e, 0x7e, 0x7e, 0x7e, 0x72, 0xd5, 0x93,
+  0x06, 0x95, 0x5d, 0x7e, 0x7e, 0x7e, 0x3e, 0xb2, 0x93, 0x06, 0x93, 0x3f,
+  0x7e, 0x7e, 0x7e, 0x76, 0xbe, 0x94, 0x05, 0xb6, 0x7e, 0x7e, 0x7e, 0x7c,
+  0xcf, 0x95, 0x04, 0xb9, 0x7e, 0x7e, 0x7e, 0x76, 0x95, 0x05, 0x84, 0x34,
+  0x7e, 0x7e, 0x7e, 0xc0, 0x95, 0x05, 0xb8, 0x7e, 0x7e, 0x7e, 0x3b, 0x84,
+  0x95, 0x04, 0x1a, 0x7e, 0x7e, 0x7e, 0x13, 0x96, 0x10, 0x1a, 0x7e, 0x7e,
+  0x7e, 0xfd, 0xce, 0xd9, 0xfa, 0xce, 0xce, 0xfa, 0x0c, 0xd6, 0x36, 0xce,
+  0xce, 0x90, 0x89, 0x12, 0x87, 0x40, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x5e, 0x9e, 0x88,
+  0x13, 0x92, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x88, 0x87, 0x13, 0x92,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x79, 0x73, 0x27, 0xfc, 0xd8, 0xb2, 0xfc,
+  0xc5, 0x4d, 0x7e, 0x7e, 0x7e, 0x7e, 0x91, 0x87, 0x06, 0x90, 0x73, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x01, 0x84, 0x07, 0x8e, 0xa9, 0x7f, 0x7e, 0x7e, 0x7e,
+  0x73, 0x8f, 0x88, 0x05, 0x1a, 0x7e, 0x7e, 0x7e, 0x7e, 0x01, 0x82, 0x08,
+  0x8f, 0xb0, 0x43, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xcc, 0x89, 0x11, 0xfd,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x59, 0xc2, 0xc2, 0xde, 0x4e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x6e, 0xdf, 0x8a, 0x89, 0x0f, 0x88, 0x3d, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x48, 0xc8, 0x8c,
+  0x0d, 0xb1, 0x19, 0x19, 0x73, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x4a, 0x0b, 0x8c, 0x90, 0x08, 0xf4, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x1a,
+  0xd3, 0x89, 0xff, 0xaf, 0x80, 0xff, 0xc5, 0x05, 0xba, 0x78, 0x7e, 0x7e,
+  0x5b, 0xa0, 0x86, 0x04, 0xe7, 0xf9, 0xf9, 0xf9, 0xed, 0x89, 0x08, 0xc6,
+  0x78, 0x7d, 0x7d, 0x7d, 0x74, 0x15, 0xec, 0xe6, 0x81, 0x07, 0xe7, 0x71,
+  0x7b, 0x7d, 0x7d, 0x7d, 0x7c, 0xe5, 0x89, 0x11, 0x71, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7c, 0x64, 0x1e, 0x6e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x62, 0x89, 0x11, 0xde, 0x75, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x70, 0x8a, 0x10,
+  0x64, 0x7d, 0x7d, 0x4b, 0xdf, 0xc3, 0x3a, 0x5e, 0x3b, 0x3a, 0xc2, 0xb5,
+  0x54, 0x7d, 0x7d, 0x7d, 0x70, 0x8a, 0x03, 0xed, 0x75, 0x7d, 0xc2, 0x82,
+  0x00, 0xa3, 0x82, 0x05, 0xbc, 0x70, 0x7d, 0x7d, 0x7d, 0x53, 0x8b, 0x02,
+  0xee, 0x55, 0xb8, 0x86, 0x05, 0xd1, 0x7d, 0x7d, 0x7d, 0x7d, 0xeb, 0x95,
+  0x05, 0x25, 0x7d, 0x7d, 0x7d, 0x6c, 0xa7, 0x95, 0x04, 0x56, 0x7d, 0x7d,
+  0x7d, 0x62, 0x96, 0x04, 0x56, 0x7d, 0x7d, 0x7d, 0x62, 0x96, 0x04, 0x57,
+  0x7e, 0x7e, 0x7f, 0x64, 0x95, 0x05, 0xa8, 0x67, 0x7d, 0x7d, 0x7d, 0x2a,
+  0x95, 0x05, 0x0f, 0x7d, 0x7d, 0x7d, 0x7d, 0xdd, 0x95, 0x05, 0x64, 0x7d,
+  0x7d, 0x7d, 0x70, 0xc0, 0x95, 0x04, 0x64, 0x7d, 0x7d, 0x7d, 0x31, 0x95,
+  0x05, 0xd0, 0x77, 0x7d, 0x7d, 0x7d, 0xd0, 0x95, 0x05, 0xec, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xd0, 0x95, 0x05, 0xec, 0x7d, 0x7d, 0x7d, 0x77, 0xc7, 0x95,
+  0x04, 0xe6, 0x7c, 0x7d, 0x7d, 0x40, 0x97, 0x03, 0xec, 0x69, 0x5a, 0x9f,
+  0xa5, 0x00, 0x00, 0x00, 0x80, 0xff, 0x94, 0x0b, 0x81, 0x87, 0x9f, 0x03,
+  0x03, 0x03, 0x03, 0xdc, 0xb2, 0x6e, 0x4f, 0xcd, 0x8d, 0x0d, 0x82, 0x8d,
+  0xee, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7a, 0x0d,
+  0x8c, 0x0d, 0x8b, 0xe8, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7a, 0x7a, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x11, 0x8d, 0x0d, 0x0f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x6d, 0xf1, 0x04, 0x7e, 0x7e, 0x7e, 0x75, 0x9c, 0x8d, 0x0c, 0x0f, 0x7e,
+  0x7e, 0x7e, 0x79, 0x09, 0x9d, 0x88, 0x49, 0x7e, 0x7e, 0x7e, 0xd5, 0x8e,
+  0x04, 0x0f, 0x7e, 0x7e, 0x7e, 0x53, 0x81, 0x05, 0xbf, 0x7e, 0x7e, 0x7e,
+  0x47, 0x8e, 0x8e, 0x0b, 0xba, 0x6c, 0x7e, 0x7e, 0x70, 0x10, 0x8d, 0xbf,
+  0x7e, 0x7e, 0x7e, 0x27, 0x90, 0x0a, 0xc1, 0x7e, 0x7e, 0x7e, 0x7e, 0x2a,
+  0xe5, 0x7e, 0x7e, 0x7e, 0xd2, 0x90, 0x0a, 0x88, 0xe0, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xab, 0x91, 0x09, 0x89, 0x13, 0x4b, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xca, 0x93, 0x08, 0x8b, 0x42, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x69, 0xbe, 0x92, 0x09, 0xa3, 0x6d, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x6a, 0xbd, 0x91, 0x0a, 0xac, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x57, 0x7e, 0x7e, 0x7e, 0x6b, 0xbc, 0x90, 0x0b, 0xac, 0x7e, 0x7e, 0x7e,
+  0x67, 0xb1, 0xef, 0x7e, 0x7e, 0x7e, 0x6d, 0x8f, 0x8f, 0x0b, 0xac, 0x7e,
+  0x7e, 0x7e, 0xd0, 0x80, 0x8c, 0x2c, 0x7e, 0x7e, 0x7e, 0x92, 0x8f, 0x0b,
+  0xac, 0x7e, 0x7e, 0x7e, 0x68, 0xb1, 0x80, 0xd8, 0x7e, 0x7e, 0x7e, 0x00,
+  0x8f, 0x0b, 0x85, 0x36, 0x7e, 0x7e, 0x7e, 0x6c, 0x3f, 0x5a, 0x7e, 0x7e,
+  0x7f, 0x9e, 0x90, 0x0a, 0xa5, 0x5e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x92, 0x91, 0x09, 0x88, 0xc7, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x7e, 0x19, 0x81, 0x92, 0x07, 0x82, 0xa7, 0x02, 0x67, 0x7e, 0x13, 0x02,
+  0x8f, 0xda, 0x00, 0x00, 0x80, 0xff, 0xb2, 0x07, 0x86, 0xf4, 0x3f, 0x7f,
+  0x7d, 0x7d, 0xda, 0x9a, 0x92, 0x08, 0x88, 0x3d, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x7c, 0x45, 0x90, 0x0a, 0x96, 0x3a, 0x23, 0x7c, 0x7c, 0x51, 0x0b,
+  0xac, 0x06, 0x4d, 0x45, 0x90, 0x05, 0x21, 0x7c, 0x7c, 0x7c, 0x6c, 0xa2,
+  0x81, 0x02, 0x93, 0x87, 0x88, 0x90, 0x0a, 0x25, 0x7c, 0x7c, 0x5f, 0x97,
+  0x80, 0x88, 0x04, 0x6d, 0x29, 0xd2, 0x90, 0x03, 0x25, 0x7c, 0x7c, 0x50,
+  0x81, 0x05, 0xc8, 0x7c, 0x7c, 0x7c, 0x5d, 0x98, 0x8f, 0x0a, 0x20, 0x7c,
+  0x7c, 0x79, 0xe6, 0x29, 0x74, 0x7c, 0x7c, 0x7c, 0x45, 0x90, 0x0a, 0xae,
+  0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x45, 0x91, 0x09,
+  0xb4, 0x4b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x45, 0x92, 0x08,
+  0xc5, 0x0e, 0x0e, 0xdf, 0xbe, 0x7c, 0x7c, 0x7c, 0x45, 0x96, 0x04, 0xa2,
+  0x7d, 0x7d, 0x7d, 0x46, 0x96, 0x04, 0xa2, 0x7c, 0x7c, 0x7c, 0x45, 0x96,
+  0x04, 0xa2, 0x7c, 0x7c, 0x7c, 0x45, 0x96, 0x04, 0x90, 0x54, 0x7c, 0x7c,
+  0x45, 0x97, 0x03, 0x30, 0x7c, 0x7c, 0x45, 0x97, 0x04, 0x0a, 0x7c, 0x7c,
+  0x70, 0xab, 0x96, 0x04, 0xc3, 0x7c, 0x7c, 0x7c, 0xb7, 0x96, 0x04, 0xc3,
+  0x7c, 0x7c, 0x7c, 0xe7, 0x96, 0x04, 0x92, 0x5c, 0x7c, 0x7c, 0xb7, 0x97,
+  0x03, 0x51, 0x7c, 0x7c, 0xb7, 0xbf, 0x00, 0x00, 0x80, 0xff, 0x98, 0x04,
+  0xce, 0x7d, 0x7e, 0x30, 0x99, 0x96, 0x04, 0xce, 0x7c, 0x7d, 0x7c, 0xac,
+  0x96, 0x04, 0xce, 0x7c, 0x7d, 0x7c, 0xac, 0x96, 0x04, 0x37, 0x7c, 0x7d,
+  0x7c, 0xac, 0x96, 0x04, 0x3b, 0x7c, 0x7d, 0x7c, 0xac, 0x96, 0x04, 0x3b,
+  0x7c, 0x7d, 0x7c, 0xac, 0x95, 0x05, 0x82, 0x3e, 0x7c, 0x7d, 0x40, 0x84,
+  0x95, 0x04, 0xad, 0x7c, 0x7c, 0x7d, 0x3a, 0x96, 0x04, 0xad, 0x7c, 0x7c,
+  0x7d, 0x3a, 0x96, 0x04, 0xad, 0x7c, 0x7c, 0x7d, 0x0a, 0x96, 0x04, 0xbb,
+  0x7d, 0x7d, 0x7f, 0xdb, 0x96, 0x04, 0xce, 0x7c, 0x7c, 0x7d, 0x3a, 0x96,
+  0x04, 0xad, 0x7c, 0x7c, 0x7d, 0x3a, 0x96, 0x04, 0xad, 0x7c, 0x7c, 0x7d,
+  0x3a, 0x96, 0x04, 0xa3, 0x6e, 0x7c, 0x7d, 0x3a, 0x97, 0x03, 0x3b, 0x7c,
+  0x7d, 0x3a, 0x97, 0x03, 0x3b, 0x7c, 0x7d, 0x3a, 0x97, 0x03, 0x3b, 0x7c,
+  0x7d, 0x3a, 0x97, 0x03, 0x3b, 0x7c, 0x7d, 0x3a, 0x97, 0x03, 0xba, 0x6e,
+  0x7d, 0x0a, 0xde, 0x00, 0x80, 0xdf, 0x03, 0xf2, 0x78, 0x1f, 0xb9, 0x96,
+  0x04, 0xab, 0x6e, 0x7e, 0x7e, 0x4e, 0x96, 0x04, 0x1e, 0x7e, 0x7e, 0x7e,
+  0xe5, 0x95, 0x05, 0xa5, 0x62, 0x7e, 0x7e, 0x6c, 0x8b, 0x95, 0x04, 0x01,
+  0x7e, 0x7e, 0x7d, 0xd4, 0x95, 0x04, 0x94, 0x66, 0x7e, 0x7e, 0x6b, 0x96,
+  0x04, 0xf3, 0x7e, 0x7e, 0x7e, 0xfb, 0x96, 0x04, 0x21, 0x7e, 0x7e, 0x66,
+  0x98, 0x96, 0x03, 0x7b, 0x7e, 0x7e, 0x49, 0x82, 0x02, 0xa4, 0xd3, 0xc5,
+  0x91, 0x03, 0x7b, 0x7e, 0x7e, 0xef, 0x81, 0x06, 0xf7, 0x77, 0x7e, 0x7c,
+  0x49, 0xf6, 0x97, 0x8d, 0x0e, 0xcb, 0x7e, 0x7e, 0x7e, 0xea, 0x82, 0xae,
+  0x77, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x48, 0x84, 0x8c, 0x0e, 0xdc, 0x7e,
+  0x7e, 0x7e, 0xea, 0xf3, 0x7e, 0x7e, 0x7e, 0x67, 0x31, 0x6f, 0x7e, 0x7e,
+  0xfb, 0x8c, 0x0e, 0xdc, 0x7e, 0x7e, 0x7e, 0x1a, 0x7b, 0x7e, 0x7e, 0x7c,
+  0xcb, 0x88, 0x53, 0x7e, 0x7e, 0x73, 0x8c, 0x0e, 0xd9, 0x7e, 0x7e, 0x7e,
+  0x46, 0x7e, 0x7e, 0x7e, 0x20, 0x80, 0xb0, 0x7e, 0x7e, 0x7e, 0x7a, 0x8d,
+  0x0d, 0x7b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xb0, 0x80, 0x27, 0x7e,
+  0x7e, 0x7e, 0x3a, 0x8d, 0x0d, 0x47, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x53,
+  0x87, 0x05, 0x7d, 0x7e, 0x7e, 0x79, 0xba, 0x8d, 0x0c, 0x18, 0x7e, 0x7e,
+  0x7e, 0x7e, 0x7e, 0x61, 0x37, 0x7e, 0x7e, 0x7e, 0x7d, 0x2f, 0x8e, 0x0b,
+  0x95, 0x4d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7c, 0x06,
+  0x90, 0x09, 0xbb, 0x42, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x6c, 0xe8,
+  0x93, 0x06, 0xd0, 0x1e, 0x1e, 0x79, 0x7e, 0x1f, 0x9c, 0xff, 0x94, 0x00,
+  0x80, 0xff, 0x95, 0x02, 0x83, 0xb0, 0x88, 0x81, 0x04, 0xeb, 0x66, 0x48,
+  0xcd, 0x98, 0x8f, 0x0c, 0x8a, 0xdf, 0x3d, 0x7e, 0x4d, 0xcb, 0xa5, 0x7c,
+  0x7e, 0x7e, 0x7e, 0x5a, 0x9f, 0x8d, 0x0d, 0xbe, 0x6e, 0x7f, 0x7e, 0x7e,
+  0x6f, 0x18, 0x32, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xd3, 0x8c, 0x0e, 0xbe,
+  0x6d, 0x7e, 0x7e, 0x7e, 0x2e, 0xa7, 0x96, 0x1d, 0x7d, 0x7e, 0x7e, 0x7e,
+  0x7e, 0xd3, 0x8c, 0x05, 0x0d, 0x7e, 0x7e, 0x59, 0xa1, 0x87, 0x82, 0x05,
+  0xfb, 0x5f, 0x7e, 0x7e, 0x7e, 0xd3, 0x8c, 0x03, 0x0d, 0x7e, 0x7e, 0x35,
+  0x85, 0x04, 0x41, 0x7e, 0x7e, 0x70, 0x9a, 0x8c, 0x04, 0xaf, 0x7a, 0x7e,
+  0x58, 0x9c, 0x83, 0x04, 0x83, 0x45, 0x7e, 0x7e, 0x6a, 0x8e, 0x05, 0xe4,
+  0x60, 0x7e, 0x79, 0xe3, 0x8b, 0x81, 0x04, 0xc4, 0x7e, 0x7e, 0x7e, 0x50,
+  0x8f, 0x0b, 0xa0, 0x5a, 0x7e, 0x7e, 0x5c, 0x15, 0xee, 0x6b, 0x7e, 0x7e,
+  0x7e, 0x00, 0x91, 0x09, 0xdd, 0x4a, 0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+  0x4e, 0x8a, 0x93, 0x06, 0x02, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x30, 0x94,
+  0x08, 0xff, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x3e, 0x9f, 0x91, 0x0a,
+  0xbb, 0x64, 0x7e, 0x7e, 0x7e, 0x17, 0x24, 0x7e, 0x7e, 0x6e, 0x9b, 0x8f,
+  0x0b, 0x89, 0x55, 0x7e, 0x7e, 0x7e, 0x4f, 0x9d, 0x95, 0x58, 0x7e, 0x7e,
+  0xa4, 0x8f, 0x0b, 0x25, 0x7e, 0x7e, 0x7e, 0x60, 0x83, 0x80, 0xb7, 0x6a,
+  0x7e, 0x7e, 0xef, 0x8f, 0x0b, 0x60, 0x7e, 0x7e, 0x65, 0xa5, 0x80, 0x90,
+  0x3c, 0x7e, 0x7e, 0x7e, 0x03, 0x8f, 0x0b, 0x44, 0x7e, 0x7e, 0x58, 0x8e,
+  0xc3, 0x51, 0x7e, 0x7e, 0x7e, 0x7e, 0xa4, 0x8f, 0x0b, 0x98, 0x57, 0x7e,
+  0x7e, 0x62, 0x7e, 0x7e, 0x7e, 0x7e, 0x75, 0xc6, 0x85, 0x90, 0x08, 0xbd,
+  0x4d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x6d, 0x0a, 0x93, 0x06, 0x94, 0xc4,
+  0x16, 0x7d, 0x2f, 0xdf, 0xa0, 0xdc, 0x00, 0x00, 0x80, 0xff, 0xb1, 0x06,
+  0x88, 0xfa, 0x76, 0x7f, 0x57, 0xdb, 0x8d, 0x93, 0x07, 0x84, 0x1c, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x24, 0x93, 0x08, 0xbe, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x76, 0x08, 0x91, 0x09, 0x8e, 0x68, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x73, 0xd4, 0x90, 0x0a, 0x8e, 0x37, 0x7d, 0x7d, 0x7d, 0x55,
+  0x60, 0x7d, 0x7d, 0x1d, 0xa4, 0x90, 0x0c, 0xac, 0x7d, 0x7d, 0x7d, 0x55,
+  0xa5, 0x74, 0x7d, 0x78, 0xf5, 0xfd, 0xbe, 0x84, 0x8e, 0x0d, 0xef, 0x7d,
+  0x7d, 0x7d, 0xe4, 0x87, 0xe1, 0x07, 0xe4, 0xd1, 0x7d, 0x7d, 0x3b, 0xb0,
+  0x8d, 0x04, 0x17, 0x7d, 0x7d, 0x58, 0x8e, 0x83, 0x04, 0x28, 0x7d, 0x7d,
+  0x7d, 0x16, 0x8d, 0x03, 0x10, 0x7d, 0x7d, 0x17, 0x82, 0x06, 0xe3, 0x06,
+  0x76, 0x7d, 0x7d, 0x7d, 0x0f, 0x8d, 0x0d, 0xac, 0x7d, 0x7d, 0x30, 0xb7,
+  0xb7, 0xfc, 0x6a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xab, 0x8d, 0x0d, 0x8a,
+  0x23, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x66,
+  0x9b, 0x8e, 0x0b, 0x85, 0xf6, 0x6c, 0x7d, 0x7d, 0x7d, 0x6c, 0x44, 0x7d,
+  0x7d, 0x7d, 0x33, 0x91, 0x09, 0x91, 0xd6, 0xd6, 0xd6, 0x92, 0x02, 0x7d,
+  0x7d, 0x7d, 0xd1, 0x96, 0x04, 0x02, 0x7d, 0x7d, 0x7d, 0xd1, 0x96, 0x04,
+  0x02, 0x7d, 0x7d, 0x7d, 0xd1, 0x96, 0x04, 0x02, 0x7d, 0x7d, 0x7d, 0xd1,
+  0x96, 0x04, 0x02, 0x7d, 0x7d, 0x7d, 0xd1, 0x96, 0x04, 0x02, 0x7d, 0x7d,
+  0x6e, 0xa4, 0x96, 0x03, 0xe5, 0x7d, 0x7d, 0x62, 0x97, 0x03, 0x84, 0x06,
+  0x7d, 0x06, 0xc0, 0x00, 0x80, 0xff, 0xb2, 0x05, 0x8a, 0xf1, 0x7f, 0x7e,
+  0x52, 0x95, 0x94, 0x07, 0xdd, 0x52, 0x7d, 0x7d, 0x7d, 0x7d, 0x51, 0x94,
+  0x92, 0x08, 0xe2, 0x7a, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x14, 0x91,
+  0x09, 0xe4, 0x76, 0x7d, 0x7d, 0x7d, 0x6d, 0x4c, 0x7d, 0x7d, 0x3a, 0x90,
+  0x0c, 0x99, 0x5f, 0x7d, 0x7d, 0x7d, 0x32, 0xa4, 0xce, 0x7d, 0x7d, 0x7b,
+  0x0a, 0x9f, 0x8e, 0x0d, 0x30, 0x7d, 0x7d, 0x7d, 0x00, 0x8b, 0x80, 0xff,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x55, 0x9e, 0x8d, 0x04, 0x3d, 0x7d, 0x7d, 0x7a,
+  0xb9, 0x81, 0x06, 0x40, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x34, 0x8d, 0x03,
+  0x3d, 0x7d, 0x7d, 0x35, 0x82, 0x06, 0xb5, 0x6a, 0x7d, 0x7d, 0x7d, 0x79,
+  0xc0, 0x8d, 0x0c, 0x3d, 0x7d, 0x7d, 0x4d, 0xaa, 0xaa, 0xc6, 0x68, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x4e, 0x8e, 0x0c, 0xdb, 0x73, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x4e, 0x8f, 0x0b, 0xf5, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x4e, 0x8f, 0x0b, 0x8f,
+  0xdb, 0x4d, 0x48, 0x1e, 0x1e, 0x1e, 0x1e, 0x75, 0x7d, 0x7d, 0x4e, 0x91,
+  0x01, 0x8c, 0x8a, 0x83, 0x03, 0x67, 0x7d, 0x7d, 0x4e, 0x97, 0x03, 0x67,
+  0x7d, 0x7d, 0x4e, 0x97, 0x03, 0x59, 0x7d, 0x7d, 0x4e, 0x97, 0x04, 0xf1,
+  0x7d, 0x7d, 0x6d, 0xae, 0x96, 0x04, 0xf1, 0x7d, 0x7d, 0x7d, 0xc6, 0x96,
+  0x04, 0xcc, 0x7c, 0x7d, 0x7d, 0xc6, 0x97, 0x03, 0x79, 0x7d, 0x7d, 0xc6,
+  0x97, 0x03, 0x41, 0x7d, 0x51, 0x85, 0xbe, 0x00, 0x80, 0xff, 0x94, 0x02,
+  0x00, 0x7f, 0x00, 0x97, 0x0a, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00,
+  0x7f, 0x7f, 0x00, 0xc0, 0x8f, 0x0c, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x8d, 0x0f, 0xc0, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0xc0, 0x8b, 0x10, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x7f, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x7f, 0x3f, 0x8a, 0x07, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x00, 0x80, 0x3f, 0xc0, 0x85, 0x03, 0x7f, 0x7f, 0x7f, 0xc0,
+  0x88, 0x04, 0xc0, 0x7f, 0x7f, 0x7f, 0x7f, 0x89, 0x03, 0xc0, 0x7f, 0x7f,
+  0x7f, 0x88, 0x04, 0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x8a, 0x03, 0x7f, 0x7f,
+  0x7f, 0x00, 0x87, 0x04, 0x3f, 0x7f, 0x7f, 0x7f, 0x00, 0x8a, 0x03, 0x7f,
+  0x7f, 0x7f, 0x00, 0x87, 0x03, 0x7f, 0x7f, 0x7f, 0x7f, 0x8b, 0x03, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x87, 0x03, 0x7f, 0x7f, 0x7f, 0x7f, 0x8a, 0x04, 0x00,
+  0x7f, 0x7f, 0x7f, 0x00, 0x87, 0x03, 0x7f, 0x7f, 0x7f, 0x7f, 0x8a, 0x04,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x87, 0x03, 0x3f, 0x7f, 0x7f, 0x3f, 0x88,
+  0x06, 0xc0, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0xc0, 0x87, 0x03, 0xc0, 0x7f,
+  0x7f, 0x7f, 0x87, 0x06, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x89,
+  0x04, 0x3f, 0x7f, 0x7f, 0x3f, 0xc0, 0x83, 0x07, 0x3f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x3f, 0x8a, 0x0f, 0xc0, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x8d, 0x0c,
+  0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0xc0, 0x8f, 0x09, 0xc0, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00,
+  0xc0, 0xff, 0x94, 0x00, 0x80, 0xfb, 0x02, 0xcd, 0x7d, 0x06, 0x98, 0x04,
+  0x12, 0x7c, 0x77, 0x37, 0x8b, 0x96, 0x04, 0x12, 0x7c, 0x7d, 0x7c, 0x9a,
+  0x96, 0x04, 0x12, 0x7c, 0x7d, 0x7c, 0x9a, 0x96, 0x04, 0x12, 0x7c, 0x7d,
+  0x7c, 0x9a, 0x96, 0x04, 0xb0, 0x7c, 0x7d, 0x7c, 0x9a, 0x96, 0x04, 0xd4,
+  0x7c, 0x7d, 0x7c, 0x9a, 0x96, 0x04, 0x8e, 0x7c, 0x7d, 0x7c, 0x9a, 0x96,
+  0x04, 0xdc, 0x7c, 0x7d, 0x7c, 0x9a, 0x96, 0x04, 0x12, 0x7c, 0x7d, 0x7c,
+  0x9a, 0x96, 0x04, 0x13, 0x7d, 0x7f, 0x7d, 0x9a, 0x95, 0x05, 0x9a, 0x77,
+  0x7c, 0x7d, 0x7c, 0x9a, 0x95, 0x05, 0x9b, 0x7c, 0x7c, 0x7d, 0x7c, 0x9a,
+  0x95, 0x05, 0x0b, 0x7c, 0x7c, 0x7d, 0x7c, 0x9a, 0x95, 0x05, 0x20, 0x7c,
+  0x7c, 0x7d, 0x27, 0x86, 0x95, 0x04, 0x20, 0x7c, 0x7c, 0x7d, 0x11, 0x96,
+  0x04, 0x20, 0x7c, 0x7c, 0x7d, 0xcb, 0x96, 0x05, 0x20, 0x7c, 0x7c, 0x7d,
+  0x55, 0x91, 0x95, 0x05, 0xc3, 0x37, 0x7c, 0x7d, 0x7c, 0x9a, 0x96, 0x04,
+  0x8e, 0x7c, 0x7d, 0x7c, 0x9a, 0xfa, 0x00, 0x00, 0x80, 0xdb, 0x06, 0x8d,
+  0x4b, 0x7f, 0x7f, 0x69, 0xeb, 0x85, 0x94, 0x08, 0x08, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x63, 0xae, 0x83, 0x92, 0x09, 0x92, 0x76, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x08, 0x85, 0x92, 0x09, 0xca, 0x64, 0x15, 0xe9, 0xe9,
+  0x40, 0x77, 0x7d, 0x2b, 0x9d, 0x97, 0x04, 0x3a, 0x7d, 0x7d, 0x06, 0x86,
+  0x95, 0x05, 0x89, 0x44, 0x7d, 0x7d, 0x7d, 0xbd, 0x94, 0x06, 0x89, 0x16,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x26, 0x93, 0x07, 0x89, 0x16, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x0e, 0x93, 0x07, 0x03, 0x7d, 0x7d, 0x7d, 0x7d, 0x6d, 0xe2,
+  0x8d, 0x92, 0x06, 0xba, 0x67, 0x7d, 0x7d, 0x7d, 0x4b, 0xb0, 0x93, 0x06,
+  0x98, 0x67, 0x7d, 0x7d, 0x7d, 0x4b, 0xcb, 0x94, 0x05, 0xc4, 0x7d, 0x7d,
+  0x7d, 0x7d, 0xc4, 0x94, 0x06, 0x88, 0x3a, 0x7d, 0x7d, 0x7d, 0x6b, 0xae,
+  0x94, 0x07, 0xc4, 0x7d, 0x7d, 0x7d, 0x7d, 0x58, 0xd8, 0xc0, 0x93, 0x09,
+  0x15, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x35, 0xc0, 0x90, 0x0e,
+  0x91, 0x71, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x74, 0x5f,
+  0xf6, 0xe4, 0xbb, 0x8c, 0x0f, 0xc7, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x73, 0xc4, 0x8a, 0x11, 0x8c,
+  0x76, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x2b, 0x0d, 0x2e, 0x7d, 0x7d,
+  0x7d, 0x7d, 0x7d, 0x3f, 0x85, 0x89, 0x11, 0x81, 0x13, 0x7d, 0x7d, 0x7d,
+  0x7d, 0x14, 0x8c, 0x83, 0x80, 0x84, 0xb3, 0x30, 0x7d, 0x7d, 0x7d, 0x49,
+  0x86, 0x8a, 0x05, 0x8c, 0x0d, 0x7d, 0x2e, 0xb0, 0x82, 0x84, 0x04, 0x82,
+  0x85, 0x85, 0x85, 0x83, 0xff, 0x8f, 0x00, 0x00, 0x80, 0xff, 0x9b, 0x02,
+  0x14, 0x5a, 0xdc, 0x8f, 0x03, 0xc0, 0x3e, 0x23, 0x8e, 0x84, 0x03, 0x14,
+  0x7c, 0x77, 0xe3, 0x8e, 0x04, 0xd5, 0x7c, 0x7c, 0x3f, 0x89, 0x83, 0x03,
+  0x49, 0x7c, 0x7c, 0x3d, 0x8e, 0x04, 0xd5, 0x7c, 0x7c, 0x7c, 0xea, 0x82,
+  0x04, 0xc7, 0x7d, 0x7c, 0x7c, 0xf7, 0x8e, 0x04, 0xd5, 0x7c, 0x7c, 0x7c,
+  0x92, 0x82, 0x04, 0xea, 0x7d, 0x7c, 0x6b, 0x8e, 0x8e, 0x03, 0xd5, 0x7d,
+  0x7d, 0x7d, 0x83, 0x03, 0x54, 0x7e, 0x7d, 0x68, 0x8f, 0x03, 0xd5, 0x7c,
+  0x7c, 0x7c, 0x83, 0x03, 0x53, 0x7d, 0x7c, 0x67, 0x8f, 0x03, 0x36, 0x7c,
+  0x7c, 0x7c, 0x83, 0x03, 0x53, 0x7d, 0x7c, 0x5e, 0x8f, 0x03, 0x3e, 0x7c,
+  0x7c, 0x7c, 0x82, 0x04, 0x90, 0x5d, 0x7d, 0x7c, 0xfe, 0x8f, 0x03, 0x3e,
+  0x7c, 0x7c, 0x24, 0x82, 0x04, 0xc0, 0x7c, 0x7d, 0x7c, 0xfe, 0x8f, 0x11,
+  0x2d, 0x7d, 0x7d, 0x51, 0xab, 0xab, 0xab, 0x0b, 0x7d, 0x7f, 0x7d, 0x48,
+  0x14, 0x14, 0x7f, 0x7d, 0x6c, 0xa0, 0x89, 0x11, 0xd5, 0x7c, 0x7c, 0x7c,
+  0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c,
+  0x7c, 0x3d, 0x89, 0x11, 0xab, 0x34, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x6c, 0x5e, 0xdf, 0x8a, 0x0e,
+  0x87, 0xd4, 0x2c, 0x3e, 0x3d, 0x42, 0x7c, 0x7c, 0x7d, 0x7c, 0x77, 0x3d,
+  0x3d, 0xd4, 0x95, 0x91, 0x05, 0x84, 0x36, 0x7c, 0x7d, 0x7c, 0xe3, 0x96,
+  0x04, 0xed, 0x7d, 0x7f, 0x4c, 0x89, 0x96, 0x04, 0xc0, 0x7c, 0x7d, 0x44,
+  0x87, 0x96, 0x04, 0xa0, 0x68, 0x7d, 0x7c, 0x95, 0x97, 0x03, 0x53, 0x7d,
+  0x7c, 0xdb, 0x97, 0x04, 0xa3, 0x51, 0x7c, 0x06, 0xa3, 0xdb, 0x00, 0x00,
+  0x80, 0xff, 0x91, 0x01, 0x8f, 0xa7, 0x86, 0x03, 0x99, 0x63, 0x3f, 0x8e,
+  0x8e, 0x03, 0xb9, 0x70, 0xf8, 0xb2, 0x84, 0x04, 0xce, 0x7c, 0x7c, 0x0c,
+  0x8e, 0x8e, 0x02, 0x68, 0x7c, 0x48, 0x84, 0x04, 0x14, 0x7c, 0x7c, 0x77,
+  0xd3, 0x8e, 0x02, 0x68, 0x7c, 0x62, 0x84, 0x03, 0x14, 0x7c, 0x7c, 0x3d,
+  0x8e, 0x03, 0xc7, 0x79, 0x7c, 0x13, 0x84, 0x03, 0x14, 0x7c, 0x7c, 0x3d,
+  0x8e, 0x03, 0xd5, 0x7d, 0x7d, 0x13, 0x84, 0x03, 0x52, 0x7d, 0x7d, 0x3e,
+  0x8e, 0x03, 0x24, 0x7c, 0x7c, 0x13, 0x83, 0x04, 0xa4, 0x7d, 0x7c, 0x7c,
+  0xee, 0x8e, 0x03, 0x3e, 0x7c, 0x7c, 0x13, 0x83, 0x04, 0xea, 0x7d, 0x7c,
+  0x7c, 0xd4, 0x8d, 0x04, 0x9d, 0x68, 0x7c, 0x7c, 0x13, 0x83, 0x08, 0xea,
+  0x7d, 0x7c, 0x7c, 0xd4, 0x80, 0x8b, 0xc0, 0x86, 0x89, 0x04, 0xab, 0x7c,
+  0x7c, 0x7c, 0x13, 0x83, 0x09, 0xea, 0x7d, 0x7c, 0x7c, 0xd4, 0xad, 0x2f,
+  0x7c, 0x4e, 0xa3, 0x88, 0x12, 0xa4, 0x73, 0x7d, 0x7d, 0x25, 0xab, 0xab,
+  0xa7, 0x92, 0xfc, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7d, 0x11,
+  0x89, 0x11, 0x1b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x77, 0x58, 0x72, 0x7d,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x3d, 0x89, 0x11, 0xab, 0x61,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x5f, 0xfe, 0xfe, 0xb3, 0x8a, 0x0d, 0x87, 0xef, 0x57, 0x7d, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x52, 0xe5, 0xa3, 0x8f, 0x09, 0x92, 0xaa,
+  0xaa, 0xaa, 0xaa, 0x2e, 0x7d, 0x7c, 0x6b, 0x8e, 0x96, 0x04, 0x54, 0x7f,
+  0x7d, 0x6c, 0x8e, 0x96, 0x04, 0x53, 0x7d, 0x7c, 0x7c, 0xd4, 0x96, 0x04,
+  0x4a, 0x7d, 0x7c, 0x7c, 0x08, 0x96, 0x04, 0xea, 0x7d, 0x7c, 0x7c, 0xf7,
+  0x96, 0x04, 0x92, 0x51, 0x7c, 0x3e, 0x8e, 0xdc,
+};
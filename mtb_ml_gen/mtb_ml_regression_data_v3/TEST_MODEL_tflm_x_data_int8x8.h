@@ -0,0 +1,19 @@
+/***************************************************************************//**
+* \file TEST_MODEL_tflm_x_data_int8x8.h
+*
+* \brief
+* Generated with scripts/ml_regression_convert.py, this file contains input
+* data for the TEST_MODEL model in int8x8 representation (v3 regression container).
+******************************************************************************/
+
+
+#ifndef TEST_MODEL_TFLM_X_DATA_INT8X8_H
+#define TEST_MODEL_TFLM_X_DATA_INT8X8_H
+
+#include <stdint.h>
+
+
+extern const uint8_t TEST_MODEL_x_data_bin[];
+#define TEST_MODEL_X_DATA_BIN_LEN (23684)
+
+#endif // TEST_MODEL_TFLM_X_DATA_INT8X8_H
@@ -0,0 +1,19 @@
+/***************************************************************************//**
+* \file TEST_MODEL_softmax_lut_int16x8.h
+*
+* \brief
+* Generated with scripts/ml_softmax_lut_gen.py, this file contains the exp
+* and reciprocal lookup tables and the parameters of the softmax of the TEST_MODEL
+* model (int16x8).
+******************************************************************************/
+
+
+#ifndef TEST_MODEL_SOFTMAX_LUT_INT16X8_H
+#define TEST_MODEL_SOFTMAX_LUT_INT16X8_H
+
+#include "ml_softmax_s16.h"
+
+
+extern const ml_softmax_s16_t TEST_MODEL_softmax;
+
+#endif // TEST_MODEL_SOFTMAX_LUT_INT16X8_H
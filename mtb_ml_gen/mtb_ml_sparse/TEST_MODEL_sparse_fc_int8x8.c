@@ -0,0 +1,2696 @@
+/***************************************************************************//**
+* \file TEST_MODEL_sparse_fc_int8x8.c
+*
+* \brief
+* Generated with scripts/ml_sparse_gen.py, this file contains the fully
+* connected layers of the TEST_MODEL model (int8x8) with the original weights in dense
+* format, with the weights in block-CSR format (pruning 50%), and with the
+* weights quantized per channel to int8 and, for the first layers, to int4.
+******************************************************************************/
+
+
+#include "TEST_MODEL_sparse_fc_int8x8.h"
+
+#include <stddef.h>
+
+
+static const int8_t TEST_MODEL_fc_dense_0_blocks[12544] __attribute__((aligned(4))) = {
+    -46, -10, 45, 32, 22, -40, -36, -26, 40, 44, -20, -19, 33, 37, 5, 1,
+    -37, 5, -19, -12, 50, -47, 2, -39, 38, 29, -9, -1, 37, -13, 13, 37,
+    -13, -25, 28, 11, 2, -20, -40, -45, -31, -28, 32, -34, 46, -42, -16, -25,
+    14, 5, 48, -47, 40, -39, 38, 5, -47, -25, -22, 28, -44, 20, -16, 42,
+    48, -8, -20, 37, -55, 1, 29, -30, -31, -39, 47, -27, 10, -43, 1, 28,
+    6, 40, -43, -3, 22, -51, 41, -39, 22, 27, -37, 37, -54, -46, 20, -49,
+    -43, -52, 13, -54, -55, -28, -59, 22, -7, -41, -40, 8, -22, -27, -9, 46,
+    -13, 47, 6, 32, -49, 33, 24, -9, -4, 34, 18, -47, 45, 38, 10, -39,
+    -46, -18, -28, 54, 27, 27, -28, -17, -21, -30, 44, -33, 12, -7, 45, -20,
+    29, -25, -7, 43, -44, -26, 24, 31, 25, -54, -44, -11, 7, -7, -25, 27,
+    2, 35, 21, 30, -13, -23, -39, -43, -6, -42, 12, -24, 20, -5, 18, -38,
+    -6, 37, 1, -35, 22, -34, 14, -73, -67, -11, -30, -12, 16, 68, 6, -5,
+    -23, -33, -13, 16, -44, 44, -22, -48, 38, 9, 39, -12, -45, -39, -3, -7,
+    -28, -60, 7, -26, -32, -49, -31, -23, 32, 32, 29, -4, -7, -21, -48, -36,
+    -30, 47, -13, 37, 13, -46, -23, 30, -34, -18, 34, -21, -56, -45, -51, 21,
+    -34, 47, -5, -9, -24, -29, -30, -29, -52, -41, -6, -5, 41, 15, -21, -39,
+    40, -44, -29, -37, 39, -47, -65, 32, 10, -58, -31, 7, 31, 48, -15, 11,
+    -48, -38, -14, -4, 18, 16, 6, -48, 32, -35, -45, -2, -5, -20, -8, 35,
+    23, -66, -7, -36, 26, 3, 17, -31, 9, 17, -32, 22, 24, -3, 18, 39,
+    24, 46, 36, -48, -15, 21, -34, -24, 56, -49, 41, 36, -44, -1, -61, -49,
+    -14, 38, -34, -17, 49, 16, 6, 35, -51, 32, 30, 47, 17, 14, 24, -21,
+    -21, -42, 18, 23, 38, -50, 35, -8, -35, -6, 9, -27, 9, -30, -18, 45,
+    3, 30, 0, 9, -35, -46, -8, 11, -34, -26, 19, -46, -23, -16, -13, -13,
+    45, -42, 0, -14, 13, -23, 12, -10, 8, -29, 34, -2, -21, 46, 5, -5,
+    -42, -36, -36, 38, 9, 28, -47, -46, 47, 20, -42, 10, -40, -42, 15, -46,
+    -44, -62, -50, -2, 13, 26, 41, 15, -16, -5, -7, -3, -21, -53, -38, -50,
+    -4, -14, 12, -11, -48, 7, -31, -50, 45, -16, 20, 36, -8, 9, -26, 21,
+    -1, -29, 13, -12, -37, -6, -3, -15, -54, -21, 32, -33, -20, -39, -24, -50,
+    -39, 27, -30, -39, 3, -64, 8, 20, 25, 4, -27, 30, 27, -46, 42, -6,
+    11, -20, 21, -53, 4, -41, 18, -30, 6, -6, 30, -19, -41, 21, -43, -46,
+    34, 34, 21, 5, 5, 33, 41, 40, 37, 19, 22, 38, 12, 5, -46, -39,
+    10, -8, -44, -39, 27, 9, -13, 40, 49, -29, -34, -50, -54, -6, 47, -41,
+    31, -46, 2, -17, 41, -39, -33, -38, -32, -9, 38, -37, 0, 29, -52, -68,
+    -30, -50, -26, 37, -39, -13, 0, -4, -11, 38, -13, -31, 49, 5, 48, 19,
+    46, -41, -46, -7, -17, 25, -15, -34, -34, -13, -21, 32, 8, 40, -14, 14,
+    30, 8, -38, -10, 14, -22, -3, -13, -11, -19, 47, 27, -48, 1, 11, -39,
+    -66, -3, 7, 47, -27, 28, -46, -14, 43, 20, -45, -11, 36, -11, -13, -44,
+    13, -18, -18, 4, -5, -52, 41, -37, 5, -31, -51, -4, 11, 16, 19, 28,
+    -36, -58, -18, 39, -14, 15, -52, -50, 9, 36, 25, 10, -44, -11, -40, -37,
+    -6, -10, 0, 24, 6, 7, -15, 38, -53, 54, -45, 9, -10, -42, 27, 48,
+    -50, -16, -26, -29, 31, 45, -34, 7, 43, -15, 16, 25, 24, -35, 8, -43,
+    -24, 13, -9, -16, -8, -25, 4, 20, -2, 56, -37, -27, -36, 46, 8, 37,
+    40, -1, -25, -20, -60, -50, 29, -44, 15, 32, 11, 7, 32, 49, -16, 3,
+    -54, 1, 19, -42, 36, -43, 15, -22, -27, 48, -9, 1, -7, 0, -37, 15,
+    13, 27, 39, -47, -30, -30, -18, -41, -33, 29, -5, -48, -9, 42, -15, -28,
+    -43, 8, 18, 11, 14, 6, 27, -46, 17, -28, 13, 30, 5, 26, -28, 20,
+    -36, 30, -31, -27, 34, -23, -42, 18, -37, -15, 11, 28, -17, 19, -45, 32,
+    -45, 15, 27, 47, -34, 10, -13, 41, 19, 40, -5, -26, 51, 18, -13, -17,
+    48, -19, -19, -34, -40, -46, -37, 27, 22, 1, -25, 19, 29, 24, -3, -17,
+    35, -48, -41, 40, 50, -8, 31, 22, 22, -25, 27, -42, -11, -14, 21, 27,
+    -50, -17, -11, -28, 22, 12, -6, 27, -28, 42, 2, -21, 47, 40, -11, 1,
+    19, -21, 44, 33, -7, 37, -39, 43, -2, 25, 31, 7, 46, 22, -33, 42,
+    -39, 8, -11, 17, -1, 42, -48, -5, 10, -3, -45, -9, 28, 50, -36, 12,
+    57, -10, -42, 4, -52, -24, 13, -52, 18, -30, -41, 15, -16, 33, 22, -20,
+    16, -29, -48, -7, -29, 7, 13, 12, 24, 56, -29, -22, -46, 16, -19, -55,
+    -89, -8, -30, -4, 10, -13, -26, -47, 1, -2, 3, -14, -45, 12, -13, -5,
+    21, 26, 43, 17, 1, -37, -27, 11, -16, 12, 19, 3, 14, 8, -43, 52,
+    -8, 9, -16, -24, -28, 26, -26, -64, -60, -14, 30, -47, -19, 31, -51, -51,
+    -29, -43, 0, -75, -56, 0, -7, -3, -3, 27, 29, -26, 20, -6, -23, 1,
+    32, -22, 27, -14, 8, -35, 54, -21, -42, 23, -14, 0, 51, -22, -5, 24,
+    14, -8, -69, 6, -8, 45, 32, -27, 48, 53, -37, -41, 0, 7, -30, -46,
+    13, -12, -21, 26, 15, -47, -25, -7, -1, -22, -38, 28, -2, -20, -20, -8,
+    -34, -23, -1, 53, -35, -3, 47, 10, 29, -17, 0, -25, 16, -84, -28, -29,
+    -17, 3, 5, -50, -41, -25, 21, 32, -53, 7, -23, 29, 13, -8, -11, 39,
+    25, 20, 34, -7, 32, -28, 15, 20, -48, -18, -74, 37, -14, 46, 48, -51,
+    17, 14, -62, 15, -8, -41, 8, 12, 49, -31, -9, 18, 28, -27, 41, 22,
+    39, 29, -69, -29, -21, -16, -73, 26, 18, 36, 6, 9, -47, -49, 6, 21,
+    -53, -36, 0, -15, 8, -36, 4, 9, -80, 10, 7, 25, 15, 28, -13, -3,
+    9, -24, -75, 1, -49, -9, 5, 7, -47, 2, -27, -18, 14, -52, 16, 8,
+    37, -60, -16, -49, -33, 23, -23, -54, 43, -30, 40, -32, -41, 8, -7, -46,
+    -11, -5, 46, -15, 23, 22, 14, -5, -11, 15, -6, 2, -40, -58, -32, -61,
+    -5, -6, -23, 32, -46, 30, -22, 15, 67, -45, 3, 29, -34, 48, 38, 2,
+    4, 5, 20, -26, 15, -20, 21, -5, 3, -69, -15, 3, -24, -41, -22, 17,
+    40, -12, 52, 58, 86, 42, -58, -33, -13, -40, -10, -47, -29, 47, 70, 2,
+    32, 1, 14, 9, 10, -15, -49, -60, -12, -1, -3, -17, 7, -25, 15, -16,
+    -11, 13, 31, 17, 0, 41, 19, 33, -9, 23, 29, -4, 4, -35, -7, 34,
+    6, 10, -56, -84, -21, -23, -13, -10, 1, 32, -23, -2, 36, 22, -25, -22,
+    -2, -27, 8, -34, 27, 3, -13, 43, 38, 31, -13, 12, -46, -47, -11, -77,
+    -73, -15, 19, 7, 45, 40, 39, 53, 31, -10, 36, -21, -47, -17, -32, -30,
+    44, -40, 38, 20, 7, -39, 61, -5, -74, -5, -84, 18, 14, -9, -12, -10,
+    14, 21, -32, -38, -30, -18, 51, 9, -43, -51, -19, -21, -23, 30, -30, 16,
+    33, -14, 9, 11, -42, 16, -24, 18, -13, 49, -15, 29, -6, -19, -29, 9,
+    -47, 16, 22, 54, 26, -24, -4, 5, 46, 9, -17, -45, -30, 33, 54, -17,
+    -36, -29, -16, -5, 0, -25, -17, -19, -31, -45, 13, 29, -70, 39, -3, -4,
+    -11, -39, -23, -23, -62, 17, 31, 38, -6, 31, 43, 41, 40, 4, 24, -14,
+    -10, -12, -11, -40, 34, -2, 13, 3, -29, 22, -39, 18, -26, 25, -33, 5,
+    10, -9, -1, 29, 29, 6, -13, -22, 51, -10, -13, -10, -7, 29, -26, -41,
+    -2, 12, -29, -19, 10, -12, -47, -25, -24, 41, 43, -41, -44, -6, 18, 42,
+    -31, 46, -32, -27, 19, -16, 31, -34, -2, 1, 0, -21, 8, -43, -19, -14,
+    -46, 5, -6, 22, 44, 21, -26, -41, -55, -44, 31, 46, -29, -27, 38, 14,
+    15, 38, 44, 28, 2, -5, -4, -2, 7, 30, 5, 22, -54, -47, 22, -4,
+    12, 47, -20, 4, -23, 24, -62, 43, 43, -60, 12, 8, -7, -7, -11, 8,
+    -4, -3, 19, 14, -63, 16, 1, -66, -34, -40, 23, 23, 2, 2, -23, 26,
+    -37, 45, 12, -14, 14, -53, -20, -33, -29, -23, -24, -9, 7, -48, 3, -43,
+    18, -39, -44, -45, -37, -26, 21, -33, 4, 41, 38, -8, -29, -47, -9, -48,
+    -17, 22, -52, 10, -39, -53, -55, -31, 51, 13, 55, -4, -58, -55, -61, -9,
+    -18, -32, 30, -3, 3, 17, -20, -21, 2, 41, 8, -41, 1, 41, 28, 45,
+    8, -23, -37, 13, 26, 33, 17, -49, -1, 9, -29, 19, 51, -39, 38, -7,
+    16, -20, 32, -9, -16, -27, -25, 16, -17, 41, 19, 45, -49, -27, 32, -24,
+    -34, 34, 26, -3, 39, -11, -51, 27, 26, 31, 5, 24, 35, 37, -5, -7,
+    -7, 33, -54, 32, -49, -35, -14, 13, -46, -3, -16, -32, -31, 31, -30, 15,
+    -19, -48, 45, 42, -16, 19, -14, 22, 44, -36, 38, 36, 21, -12, 22, 39,
+    -61, -14, -46, -22, -18, -24, 35, -34, -27, -32, 28, -31, -49, -11, -31, -11,
+    15, -35, -46, -36, -38, 20, -8, -11, -38, 9, -41, -1, -52, -52, -73, -23,
+    -58, 2, -72, -9, 20, -36, -53, 13, -26, 52, 1, -14, 1, 1, -32, -33,
+    24, 51, -6, 1, -12, 17, -16, -47, 10, -40, 7, -12, -13, -44, 7, -51,
+    25, -28, -18, 6, -53, 10, 16, -49, 15, -19, 26, -4, -13, -34, -10, -31,
+    26, -6, 31, -39, 0, 12, -40, -2, -4, -80, 18, 28, 8, -24, 25, 21,
+    39, 26, 19, 21, 30, -49, -27, 9, 21, -6, -3, 46, -25, 15, 18, 54,
+    26, -13, 2, -28, -63, -44, -31, -23, -17, -32, 9, 0, -32, 7, 32, 33,
+    -29, -17, 24, 45, -23, -43, 15, 6, -32, 9, -25, 8, 32, -34, -21, -10,
+    -33, -46, 1, -40, -56, 34, -20, -22, 38, -6, 52, 45, -29, -24, -31, 30,
+    35, 26, -27, 25, 18, 4, 23, -19, 25, 15, -27, -44, -3, -62, -38, -51,
+    -27, 1, -32, -3, -30, 22, 13, 25, 11, 17, -45, -6, -10, 0, 8, -42,
+    -23, -30, 15, 5, 8, -33, 20, 2, 6, -4, -48, -24, -13, -28, 15, 14,
+    4, -2, -2, -46, -5, -11, -23, -13, 39, 60, 43, -75, -40, -10, 10, -27,
+    -42, -3, -27, 1, -39, -52, -5, -31, -25, 12, 26, -9, -38, -1, -16, -41,
+    -14, 56, -5, -37, 24, 13, 39, -51, 35, -32, 17, 20, 2, 36, 5, -29,
+    24, 21, -35, -12, 32, 24, -2, 32, 7, -37, -22, 12, 59, -10, 60, 33,
+    41, -16, 48, -70, -13, -19, -48, 19, 8, 21, 26, 41, -60, 25, -77, -46,
+    -20, -34, -11, -41, -38, -15, 2, -43, 35, -27, 64, 21, 22, -35, -22, 16,
+    39, -12, -4, 6, 26, 34, -1, 39, -7, -9, 12, 10, -16, 2, 46, -12,
+    38, -41, 3, -18, -70, 0, 50, -48, -11, -66, 18, 18, 10, -11, 18, 46,
+    -7, 25, 43, 56, -19, -16, -29, 12, 10, -30, 23, 5, 23, -15, -20, -44,
+    -30, 57, 24, -23, 34, -35, -10, 52, 34, -12, 0, 42, -2, 44, 28, -20,
+    3, 25, 23, -43, 43, 58, 17, 41, 60, 21, 42, -45, -42, 69, 14, -8,
+    18, 26, -5, 13, 32, 45, -38, 31, 23, -22, 49, 5, -8, -18, -22, 38,
+    -5, -14, -13, 15, 44, 17, -35, 44, 34, -9, 26, 21, -43, -50, 41, -17,
+    -29, 30, 19, -27, 16, -23, 5, -11, -20, 59, -13, 16, 43, -23, 22, 40,
+    19, -11, -44, -24, -24, 9, 37, -43, -15, -45, -24, -37, 53, 26, -31, 0,
+    16, 30, -32, -31, 11, 34, -11, -18, 23, 10, 25, -15, -7, -41, 21, 13,
+    -40, 17, -54, 9, -35, 18, 33, 19, 34, -64, -26, -16, -23, -75, 9, -27,
+    -46, -21, 39, -23, 2, -64, 32, -2, -35, -18, -35, 54, 21, -42, 20, -29,
+    48, -3, -27, -17, 9, 28, 16, -11, -96, 17, 5, -35, -2, -19, 22, -7,
+    27, 29, 0, -76, -42, 27, -13, 27, 36, -16, 55, -24, -7, 10, -19, -24,
+    -18, -2, 16, -59, -29, -50, 5, -11, 41, 35, 21, -26, 9, -10, 34, -27,
+    34, 3, -31, -17, -35, 50, 17, -11, -44, 38, 34, -61, -1, -22, 12, -22,
+    -7, -34, -39, -33, -43, 16, -59, -28, -34, 25, -60, 4, 32, 14, -19, 16,
+    -12, 30, -49, 39, -46, -2, -6, 21, 61, -4, -17, 11, 12, -39, 45, -43,
+    -25, 9, -24, 0, -21, 8, 33, -37, -1, 22, 72, 27, -20, 1, -38, 21,
+    -22, -46, 50, 29, -27, -1, 8, -26, -33, -23, 12, 8, 0, 18, -28, -4,
+    25, -28, -23, 40, -15, -16, 42, 7, -40, -26, 25, 29, -1, 42, 28, 39,
+    -22, -1, 4, 15, -14, 22, 29, 8, 4, -5, -74, -42, -19, -16, -28, 38,
+    -21, 18, 33, 47, -25, -51, 25, -6, -2, 26, -48, -39, 26, 20, -43, 27,
+    -39, -29, -65, -8, -51, -26, -20, -47, 12, -9, -47, -7, -30, -24, -42, 15,
+    28, 15, 6, 34, -32, 16, -43, -42, 43, -11, 24, 2, 5, -40, 50, -16,
+    -26, 2, -24, -62, -59, 12, -35, -18, 15, 25, 30, -14, 31, -29, 46, 13,
+    22, 32, 17, 39, -42, -50, -4, 25, 40, 50, 33, 32, 14, -25, -34, 40,
+    50, -21, -39, -15, -29, 50, 30, -41, 47, 26, -8, -32, -28, -36, 23, -37,
+    5, -20, 36, 44, 25, 26, -35, -14, -2, 26, -29, -19, -21, 21, 20, 28,
+    2, 3, 3, -14, -1, 9, 3, -29, 25, 39, -9, 51, 35, 34, 15, -42,
+    -10, 22, 23, 9, -58, 25, -34, 0, 46, 20, 33, -4, 18, 45, -7, -52,
+    50, -32, 43, 20, -12, -5, 29, -40, -32, -35, 17, -7, -41, -4, 2, -42,
+    17, -18, -15, 12, -45, -31, -43, -34, -15, -26, 27, -31, 19, -12, -51, -4,
+    6, -50, 19, -4, 0, -24, -29, -43, 20, -2, -14, 35, 19, -8, -57, -41,
+    30, -48, -61, 0, -49, -24, 0, -15, -19, 7, -11, -29, -28, -42, 2, 6,
+    -12, -45, 49, -5, -46, -11, -17, -27, 7, -34, -45, -19, 4, -50, -16, 5,
+    11, -42, -55, 39, 44, -17, 27, 9, -19, -38, 46, -50, -20, -49, -28, 8,
+    5, 17, -54, 18, -35, -56, -51, -20, 4, -23, 21, 15, 22, 38, 33, -29,
+    -29, -18, -35, -47, -37, 16, 36, 33, 34, 37, -13, 24, 38, 30, 22, 19,
+    12, -57, 30, 9, 16, 17, 26, 8, 24, -9, -16, -41, -48, 39, 17, 26,
+    -20, 23, -24, 46, -26, 9, -33, -49, 22, -19, -17, 7, 36, 10, -25, 2,
+    -16, -62, -16, -56, -15, 5, 23, 13, 31, -30, 6, -42, 8, -23, -6, 0,
+    0, 41, -26, 13, 22, -21, 0, -52, -58, -27, 11, 35, -8, -61, 1, 4,
+    -3, -7, -6, 16, 29, 46, -40, -30, -14, 28, 14, -49, 40, 35, -51, 7,
+    -48, 7, 33, 14, -47, -18, 22, -30, -42, -2, -8, -6, -50, -45, 11, 26,
+    -21, 8, 25, -2, 21, 30, -7, -37, 2, -11, 3, -30, -16, -5, 5, 28,
+    -45, -52, 8, -46, 23, -58, -63, -3, -14, -35, -10, 3, 17, 14, -15, -11,
+    12, 11, 12, -34, -45, -21, 47, 11, 34, 40, 33, -22, -29, -12, -31, -39,
+    25, -10, 32, 30, -16, -36, -20, -26, 9, -20, -21, 21, 34, 40, -44, 12,
+    27, 41, -22, -35, -20, -11, -62, -18, -7, 28, -58, -65, 25, 27, 22, -34,
+    40, -15, -18, 45, -25, 44, 36, -12, -31, 28, -2, 33, -38, -20, -10, -50,
+    -32, -22, 25, 11, -27, -54, -64, 18, 29, -15, -27, 36, -12, -53, -38, 44,
+    7, 5, 20, 17, 50, -2, -8, -25, 38, -25, -14, -41, 3, 17, -25, 8,
+    20, 23, 28, 19, 20, -6, 4, -17, 40, -18, -55, -36, -37, -19, -39, -40,
+    -47, -21, 25, 33, -29, 9, -11, -9, -33, -23, -37, -25, 30, 24, 4, -24,
+    -23, -10, -33, -30, 23, -31, 32, -42, -45, -49, 11, 45, -47, 30, 20, 30,
+    35, 4, -20, -42, -55, 4, 40, 35, -29, -18, 28, 8, -22, -32, -50, -41,
+    -20, -50, -55, 14, -8, -46, 14, 3, -46, -3, -48, -40, 34, 16, 36, 44,
+    -8, -58, -22, -6, 10, -22, 19, -45, -43, 22, 0, -8, 29, 39, -1, -8,
+    -22, -18, 3, -6, -45, -27, -24, -17, 14, -33, 35, -38, 18, 1, 19, 19,
+    28, 2, -36, -51, -19, -52, 9, -9, -58, 13, -48, -53, -35, 24, 0, -4,
+    12, 4, 8, 13, 3, -53, 20, -22, 44, 8, 25, 16, 0, -2, 10, -31,
+    -13, 17, 18, -55, 33, -29, -53, -41, -43, -51, 10, 31, 12, 22, -17, -17,
+    -11, -22, -33, -39, 42, 14, -50, 17, 32, -48, 22, -37, 7, 14, 12, 18,
+    6, 33, 26, -25, -38, -12, -13, 6, 15, -32, -47, 45, -46, -53, 8, -3,
+    31, -36, -28, 11, -56, -50, -32, -33, -31, -56, 20, -57, 21, -55, -18, 5,
+    3, 12, -34, -1, 4, 34, -1, 16, 43, -13, -14, -37, 1, 1, 13, -6,
+    -50, 38, 3, -24, -48, 0, -9, 22, -15, -4, -29, 20, -38, 35, 16, -39,
+    -32, 50, 7, -24, -41, 9, -29, 13, 7, -45, -55, -54, 41, -26, -39, 5,
+    2, 14, -16, 20, -30, 43, 46, 28, -27, -27, 41, -35, 50, 51, -31, 28,
+    -43, -15, -15, 34, -53, -12, -51, -28, 34, -13, 36, -25, -12, -19, -47, -57,
+    -14, -1, 44, 7, 51, -1, 44, -25, 45, -2, -28, -44, 8, -27, -29, -23,
+    -46, 36, -1, -38, -32, -34, 14, 49, 27, -22, -5, -26, -18, 23, -9, -5,
+    -14, 21, 40, -48, -49, -8, 2, 1, -2, -46, 6, -35, 0, -24, 9, -30,
+    23, -46, -41, -10, 10, -51, -47, 42, 27, 22, 30, -18, -49, -30, -29, -21,
+    -20, -14, -37, -50, -24, 42, -50, -2, -31, -3, 18, 32, -39, -8, 48, 40,
+    -36, -4, -18, -17, 21, 22, -12, -48, -25, -44, -27, -39, 40, -33, -43, -43,
+    17, -33, 34, -41, 19, 4, 43, -18, -47, 35, 26, 7, 28, -26, 39, -37,
+    48, -34, -7, -14, 20, 26, -9, -5, 28, 37, 32, 28, 16, 27, -46, 52,
+    -23, -44, 9, -32, -12, -6, 44, -13, -19, 38, 11, 42, 55, 41, -21, -42,
+    41, -48, 10, 7, -19, 29, 20, -33, -48, -34, -41, 30, -37, -5, 7, 37,
+    -1, 9, -4, 36, 35, 3, -6, -6, 28, -25, 28, -2, 26, -48, 25, -4,
+    5, -13, -49, -8, -51, -38, -51, 34, -10, -7, 7, -17, 30, -25, -40, 0,
+    -12, -41, 46, -26, 21, -30, -35, -43, 47, -36, -25, 32, 4, 30, 44, -19,
+    45, 35, 7, -39, 46, -21, 35, -32, 10, 27, -55, -24, -3, 34, -42, -30,
+    -42, 27, 33, 4, 27, 20, -38, 0, -26, -12, 9, -27, -33, -14, -22, -44,
+    -4, -55, -13, 44, 14, -35, -9, 24, 0, -31, 16, -21, 2, -35, -1, -30,
+    38, -59, 39, -26, 36, -35, -48, -29, -33, 33, -2, 13, -38, -10, -14, 10,
+    4, 22, -10, -36, -11, -23, -8, 10, -19, 19, 16, 9, -40, 24, -6, -13,
+    29, 6, 15, 18, -46, 3, 28, -44, -24, -54, 33, 5, -26, 27, -19, 20,
+    -48, 19, -3, -60, 9, -38, 15, -52, -43, 2, -55, 24, 33, -5, -24, -32,
+    -35, -47, 14, -26, -17, 31, -26, 30, -12, -59, 40, 8, 6, 26, -18, -3,
+    -56, 10, -2, 4, -52, -53, -40, -1, 42, -40, -23, 6, 9, -1, 44, 37,
+    15, 8, -26, 2, -60, 44, -9, -49, -2, -23, 27, 21, -50, -16, 35, -12,
+    38, 19, -19, -7, 44, 3, -25, 27, -18, -29, 4, 13, 30, 12, -1, -16,
+    -35, -19, 31, -13, 23, -57, -22, -21, -3, 8, -4, -6, -28, -15, 6, 12,
+    -41, 42, 37, -47, 41, 17, -35, -6, 44, -24, -23, 18, 30, -23, 9, -43,
+    0, 31, 23, 20, -51, 2, 45, -29, 12, -4, -15, -5, -37, 15, 0, 17,
+    45, -37, -33, -45, -35, -33, 21, -33, -55, -6, -22, 27, -46, -36, -26, 33,
+    -10, 14, -40, 47, 11, -6, -7, -29, -28, -26, -8, 23, 48, 16, -19, -4,
+    14, 14, -44, 19, -41, 17, -2, -23, -5, -3, 20, 19, -41, 13, -25, -31,
+    -12, 37, 40, 17, -34, -15, 45, -1, 31, 24, -14, 42, 32, -25, -21, -4,
+    26, 6, 21, 30, -51, -16, -1, -14, -7, 31, -47, -33, 10, 22, 26, -48,
+    -15, 9, 10, -10, -33, -38, -23, -12, -42, -5, 38, -23, 4, -15, -10, -30,
+    20, -34, -35, -36, 13, 5, -3, -36, -54, -1, 31, 5, -28, 6, -46, -6,
+    32, 37, 34, 35, 37, -47, 21, 43, -1, 6, 1, 19, -15, -43, 32, -36,
+    41, 2, -35, -56, 4, -8, 25, -47, -50, 24, 20, 11, -12, -3, -23, -25,
+    -22, -21, -40, -28, 45, -23, 50, -10, -46, -36, 42, 28, -34, -23, 23, 30,
+    41, -45, -5, 15, 7, -33, 49, 34, -38, -53, 5, 6, -32, -21, -22, 14,
+    -42, 1, 26, 38, -2, -19, 25, -41, -4, 23, -56, -6, 1, 28, -50, -6,
+    13, -48, 39, -18, -17, 14, -39, -20, -41, 16, 29, 19, 14, -14, -1, 13,
+    35, -49, -17, 21, 36, -49, -9, 14, 45, 9, 40, 4, -42, -46, 10, -43,
+    23, -6, 41, 23, 36, -3, -36, 41, -2, -7, -12, -1, -22, 0, -11, -32,
+    35, -17, 34, -27, 49, -16, -44, 7, -51, -40, 36, -3, 24, -52, -27, -15,
+    14, -16, -29, 25, -7, 36, 8, 27, -10, 25, -32, -9, -38, 1, 19, -34,
+    -49, 7, -16, -12, 11, -24, 11, 10, -17, 32, -20, 2, -25, 27, 5, -31,
+    -5, -52, 12, -20, 39, -35, -24, 14, 30, 27, 27, -44, -6, 24, -44, 36,
+    29, -48, 27, -20, -29, 31, -6, 6, -30, 30, -26, -34, 1, -30, -36, -33,
+    -2, -51, 35, 41, -47, -8, -39, 45, 34, -8, 8, -42, -36, 28, 47, 4,
+    -23, 40, -11, 39, 27, 12, -34, -24, -22, -11, 18, 2, 18, 18, -17, -6,
+    49, 12, -12, 26, 34, -36, -4, -39, 37, 32, -16, -25, 17, 38, 9, -49,
+    -2, 45, -9, 42, 23, -12, -25, -11, 34, -49, -52, -35, 12, -4, 45, -42,
+    0, -15, -12, -9, -51, -41, 23, 49, 9, -50, -10, 14, -25, 6, -42, 4,
+    -14, -34, 32, -50, 33, 51, -29, -42, -10, -8, 18, 23, -51, -7, 12, 11,
+    -13, 38, -28, 25, 30, 20, -16, 24, -49, 41, -29, -30, 51, -47, -51, -10,
+    41, 4, -31, -4, 38, 31, 24, -45, 14, 38, -18, 49, -2, 9, 1, 38,
+    19, -31, -32, 4, -39, 11, 22, -15, -52, -40, 41, 5, 40, -42, 42, -12,
+    40, 7, -8, -50, 18, 45, 33, -26, 44, 26, -13, 43, 27, 55, 54, -1,
+    23, 32, -21, 37, 46, -14, 29, 13, -41, 47, -33, -26, 9, 30, 32, -44,
+    17, -39, 18, 8, 8, 0, 42, 11, 33, 18, -31, -43, 6, 4, -8, 2,
+    62, -37, -4, -56, 8, 16, -65, 19, -2, -16, 3, -34, 25, 13, -27, 38,
+    49, 37, -32, 20, 24, -32, -20, 34, 44, 39, -12, -9, 50, 23, -45, -26,
+    -36, -46, 31, 33, -21, -63, -4, -55, 52, 50, 14, 15, -50, 41, -29, 9,
+    28, 57, -10, 29, -29, 25, 11, 9, -5, 14, 37, 2, -32, 4, -6, 19,
+    -24, 18, -23, -35, -7, -42, -46, -47, -50, 16, 15, -20, 44, 36, 16, -15,
+    39, 2, -14, 55, 25, 9, -34, 30, -35, 11, -17, 46, 25, -45, -20, -62,
+    22, 8, -10, -23, -3, -51, 12, -21, -23, 13, 23, 20, -30, -30, -6, -7,
+    10, -34, -35, -13, 15, -23, -6, -6, -29, -38, 25, -12, -44, 34, -22, -26,
+    -40, -4, 40, 29, 9, -47, -59, 12, -16, -39, -52, -4, -42, -29, -48, -33,
+    41, 29, 61, -10, -33, -34, 10, 25, -49, -19, -20, -23, -10, -48, -42, -24,
+    -37, -23, 9, -22, 36, -80, -26, -24, -57, 36, 8, 29, 35, 0, 0, -19,
+    5, 28, -35, -44, 6, 12, -45, -21, -30, -2, -31, 38, 20, -31, -4, -44,
+    0, -52, 14, 12, -8, 41, -8, -29, 39, 24, 43, 13, 10, -35, -25, 24,
+    9, 27, -44, -2, 27, -6, 21, -37, 44, -46, 34, -42, -67, -26, -56, -9,
+    -37, 10, -18, 33, 16, -9, -52, 9, -14, -48, 7, -32, -33, 27, -29, -30,
+    -38, -52, 4, -45, -11, 30, 12, -2, 35, -22, -8, 21, 55, 0, 3, 39,
+    -54, 27, 33, -10, -8, 32, -37, -59, -24, 49, 7, 33, 35, 26, 38, 27,
+    -34, -51, 12, -55, 32, 2, -2, 9, 21, 19, -10, -13, 50, 5, -32, 12,
+    21, 24, 34, -44, -20, 12, 48, -1, 27, 20, -25, 6, -43, -6, 11, -25,
+    -41, 22, 19, -9, -54, 25, 13, -2, -24, -28, 26, 17, -29, -46, 33, -29,
+    12, 4, -18, -8, 40, 9, -50, -15, -15, 18, 26, 8, -30, -59, -16, -49,
+    28, -20, 15, -1, 23, 30, -32, -38, 12, 1, -20, -36, -9, 8, 54, 45,
+    -25, -39, -44, 24, 24, -22, 45, -44, -64, -65, 1, -19, -11, 2, 17, 6,
+    -41, 42, -48, -44, -20, -32, -16, -31, -31, 14, 2, 1, 20, -32, 39, 2,
+    -26, 0, -53, -5, -56, -45, -51, -33, -13, -18, -68, -36, -5, 31, 2, 16,
+    41, 52, 29, 5, -29, -24, -33, 2, 19, 31, 47, -22, -37, -22, -45, -37,
+    -60, -8, 6, 2, -31, -25, 37, -43, 27, -30, 44, -18, 6, -34, 1, -34,
+    -42, 27, -34, -36, -44, 12, -49, 28, 21, 8, -40, 24, 17, -27, 30, -38,
+    -30, 14, -50, -12, 21, -15, -15, 34, -42, 17, 55, 5, -55, -6, 8, 29,
+    -13, 19, -10, 1, 29, -57, -33, 44, -40, -3, 22, -36, -5, -43, 7, -27,
+    21, 8, 10, 11, -2, -33, 49, -1, -53, 35, 9, -13, -47, 5, -2, -11,
+    13, -8, -23, -19, 9, -3, -4, 10, -44, 32, -6, 18, 11, -16, 16, 7,
+    -51, -39, 9, -13, 39, -46, 9, -7, 49, -50, -9, -32, 18, 13, 42, 46,
+    32, -9, 14, 40, -32, 43, 20, -42, -25, 1, -14, -32, 26, 5, 33, -30,
+    -38, -43, 20, -3, 10, 25, 46, 58, -18, -50, 6, 38, -16, -10, 21, -11,
+    10, -2, -24, 27, -26, -38, 12, -22, 9, -35, 12, -27, 10, 26, -13, 3,
+    18, -11, -30, 20, 0, 21, 9, -26, 40, 51, -2, -38, -28, 47, -24, -43,
+    -31, 23, -31, -28, 10, -2, 34, 39, 15, 13, -38, -42, 28, -6, -23, 19,
+    -37, 20, 4, -22, -14, 14, -18, -5, 32, 42, 32, 52, -49, 16, 34, -9,
+    -31, 28, -13, -26, -10, -1, -6, -47, 14, -47, -23, 49, -45, 38, -7, -28,
+    41, -25, 10, -10, 30, -23, -43, 25, 12, 24, -19, 1, 14, -46, -15, -50,
+    22, -27, 45, -16, 16, -38, 35, 22, 32, 20, 33, -29, 41, 46, 0, 11,
+    -5, 4, -35, 43, -2, -48, 33, -41, 22, -13, -14, -41, -22, 35, 9, -20,
+    -38, 23, 50, -19, 25, 10, 50, 24, 36, -44, -42, 43, -33, -9, 5, -13,
+    -15, 33, -24, 36, -50, -5, 16, -22, -32, -48, -47, -21, -31, 49, 21, -41,
+    37, -8, -25, -24, -14, -12, -33, 25, 44, -44, -2, 13, 0, 36, 51, 32,
+    -40, -18, 36, 15, 22, 45, -44, -11, -10, -9, -6, -41, -27, 14, 44, 45,
+    -3, -20, 36, -39, 0, 30, -19, -41, -14, 38, 36, 25, 8, 4, -6, -41,
+    22, 38, -3, -41, 19, 14, 0, -38, -43, -36, -24, -23, -13, 0, 19, -40,
+    -25, -26, 8, 14, 31, 23, 41, -1, 42, 44, 42, -37, -43, 49, 12, 10,
+    25, -13, -9, 43, 3, -35, 47, -1, -1, -3, -41, 14, 34, 18, -49, -1,
+    -34, -40, -37, -20, 23, 38, 1, -18, -6, -16, -15, 28, 21, -15, 22, 26,
+    38, 40, -44, 26, -46, 1, -12, -48, 46, 45, -27, -48, -24, -11, 34, -4,
+    -8, 17, 4, -18, 11, 48, 35, 4, 19, -4, 33, 41, -17, 42, -13, -24,
+    -12, 9, 21, -12, -18, -17, 19, -9, 23, -19, -22, 38, 2, -53, 10, -19,
+    32, -30, -34, -36, -35, 15, 23, 37, -20, -20, -17, 35, -20, -42, 47, -24,
+    33, -35, -53, 1, -44, -12, -11, -4, -51, -46, -48, 21, 43, -15, -16, -11,
+    -46, 16, 29, -5, 46, -5, -13, -23, 16, -45, -15, 26, -11, -7, -9, -16,
+    -27, -51, -3, -15, 41, -19, 39, -51, -42, 48, -31, 26, 30, -39, -2, 34,
+    2, 19, 26, 19, -23, -41, -12, -4, -2, -49, 14, -55, 8, 28, 36, 1,
+    5, -24, 27, -19, -27, -26, 47, 2, 41, -40, 5, 23, 45, -2, 42, -30,
+    -2, 7, 7, 33, -16, -1, 28, 11, -10, -28, 1, 0, 18, -37, -27, -20,
+    -30, 11, 34, -12, -18, -50, 17, -10, 33, 14, 23, -8, -16, 14, 32, -44,
+    21, -35, -45, -8, 34, -11, 22, -9, 20, -29, 0, 37, -45, 33, 13, -49,
+    49, -31, -39, -16, 20, 35, -9, -50, 12, 10, -33, -8, -47, -28, -23, 11,
+    -4, -51, -18, -47, 39, 10, -3, -10, 0, -30, 1, 33, 35, 6, -7, 13,
+    26, 14, 25, -21, -12, -58, -6, -38, -5, 31, -8, -14, 31, -55, 33, 5,
+    8, 44, -41, -18, 20, -49, 37, 12, 13, 29, -45, 34, 10, -35, 4, -9,
+    6, -31, 33, 18, 4, 29, -38, 33, 6, -37, -1, -48, -39, 7, -1, -28,
+    -26, 33, 21, 3, 46, 10, -34, 24, -25, 8, -42, 14, -39, -30, -7, 30,
+    28, 22, -18, -14, -22, -1, -32, -49, 38, -9, 47, 2, 32, 2, -24, -3,
+    26, 16, 14, -47, -14, 21, 26, -10, 10, -21, -14, -56, -43, -41, -14, -57,
+    -12, -12, -15, -34, -44, 9, -51, -50, -13, -25, 39, 15, 50, -44, -43, 15,
+    1, 28, 33, -32, 46, 33, 11, 3, -43, 34, 23, 21, -41, 41, 34, -16,
+    -11, 16, -18, 16, 22, -50, -12, 6, 51, 8, 29, -16, 14, -2, 27, -16,
+    42, -23, -7, -46, -24, 28, 31, -54, 26, -42, 6, 39, -32, 31, -30, 45,
+    44, -18, -15, 28, -37, 2, -1, -45, -33, -36, -27, -49, -44, 17, -20, 39,
+    -3, -21, -57, -21, 11, 3, -42, 39, -15, 6, -5, 30, -10, 38, 29, -45,
+    -44, 16, 30, 35, 51, -1, 1, -1, -18, 10, -30, -50, 23, 30, -35, 36,
+    -11, -28, -53, -18, -47, -9, 41, -7, 20, 32, -19, -6, -2, -22, 38, -9,
+    2, 42, 47, -48, -6, 13, -29, -38, -38, 38, 18, 13, 20, -33, 17, 16,
+    -16, -29, 12, 20, 23, 47, -48, -46, 25, -30, -44, 29, -48, 39, -8, -42,
+    48, -36, 18, -25, -16, -20, -35, 31, -23, -15, -20, -41, -51, -32, -45, -37,
+    34, -28, -42, -32, -50, 46, 38, 18, -1, 40, 50, 26, 43, 20, 15, 36,
+    36, 25, -21, -30, 40, -36, -4, 11, -3, -26, -16, 6, 9, 10, -30, -46,
+    2, 25, -42, -9, 51, 42, -8, -34, 32, -12, -5, 27, -10, 32, -51, -10,
+    2, -16, -2, -34, 8, 20, 1, -10, 1, -45, 3, 29, 34, -29, 45, 30,
+    21, 1, 10, 15, 1, -43, -19, -27, 41, -19, 19, -4, -31, -25, -5, -8,
+    3, 14, -6, -45, -9, 33, -41, 43, 12, 16, -5, 28, -44, 9, -12, -3,
+    44, -7, 21, -51, -3, 38, -21, -31, 6, 45, 42, -22, -31, -11, 16, 42,
+    14, -39, -26, 44, 46, 26, -30, 40, 13, -2, -43, 8, -4, -39, -5, 34,
+    -37, 7, -10, -1, -15, 19, 12, 39, -1, 6, 46, -17, 20, 5, -31, -5,
+    17, 12, 34, 43, -38, -27, 46, -18, -30, 36, 23, -17, 41, 48, 41, -17,
+    3, -17, -34, 4, -21, 51, -32, -35, -19, -37, 14, -18, 33, 9, 22, 6,
+    11, 17, -3, 28, -21, -44, -1, -37, 28, -33, -24, 17, -28, 37, -17, 14,
+    -35, 27, -22, 31, -42, 37, 50, -7, 25, 28, 12, 1, 36, -31, -21, -44,
+    11, -27, 17, -23, 7, 40, -10, 10, 20, 38, -19, 44, 19, 46, 12, 6,
+    -20, 46, -31, 49, -42, -21, -14, -32, -15, -7, -20, -14, -48, 9, 8, 15,
+    -48, 2, -13, 56, -4, -16, 33, -1, 7, 12, -27, 33, -16, 19, 29, -9,
+    31, 38, -30, 46, 27, -25, 40, -24, 21, 39, 18, 27, -54, 16, -26, 15,
+    -40, -41, 30, -2, -50, -13, 30, 22, 7, 33, -51, 22, -18, 26, 33, 29,
+    -32, -37, -30, -29, 27, -23, -39, 15, 24, -17, 34, 32, -5, 18, -18, 13,
+    -48, 32, 6, -37, 47, -10, -47, 48, -14, -32, -14, 43, 35, -42, 48, 5,
+    -50, -51, -24, -32, 17, -31, 16, -54, 12, 38, 7, 20, -41, -48, 2, -13,
+    -15, -3, -23, -28, 15, -28, 22, -9, 3, 37, 42, 4, -51, -38, -51, 30,
+    -6, 12, 7, -11, -30, -13, 9, 20, -52, 21, 33, -45, -8, -1, -15, 17,
+    14, 44, -7, -51, 41, 34, -39, 27, 41, -7, -57, 30, -24, 14, -52, -10,
+    -34, -2, 31, -54, -43, -11, 21, 39, 40, -10, 15, -47, 22, 50, -7, 5,
+    -53, -21, 12, -8, -5, -29, 24, -13, -42, -49, -33, 24, -40, -14, 26, -38,
+    -53, -6, -12, 35, -25, 8, -36, -2, 15, -24, 45, -43, 48, -34, 25, -44,
+    -30, 37, 30, 25, -15, 22, 15, -59, -18, -8, -42, 23, 2, -35, 43, -29,
+    -6, -50, 13, 9, -2, 18, -22, 1, 55, 17, 26, 33, 23, 25, -37, 8,
+    29, 37, 14, 6, 19, -54, 42, -9, 39, -26, -26, 40, 6, -4, -21, 32,
+    34, 47, -14, 65, -24, 18, 21, 18, -11, 30, 39, -2, -4, -37, -12, 35,
+    -9, 44, -47, 34, 32, -47, 44, 19, -45, -26, 31, 36, 18, 27, 47, 47,
+    4, -49, 12, -29, 32, -14, -55, -5, 28, -48, -56, -14, 48, -28, -47, 35,
+    26, -53, -40, -29, -46, 49, -13, 34, 42, -40, 38, 28, 51, 29, -10, -29,
+    40, -38, 14, 21, 19, 27, -17, -47, -21, -62, -8, -8, 45, 13, 7, 4,
+    -6, 2, -5, 44, 50, 42, -45, 7, 48, -29, 1, 13, 27, -48, 39, -32,
+    25, -25, -39, -49, -46, 18, 31, 38, 14, -34, -41, -1, -25, -48, -9, -36,
+    15, -45, -50, 34, 9, 14, -49, -15, -34, 35, 17, -49, 22, -54, -57, 18,
+    36, -42, 2, 44, 6, 41, -38, -30, -48, -44, -14, 29, -15, -4, 29, 18,
+    -34, 25, -43, -1, 27, -16, 36, 9, -16, -42, 43, 15, -54, -25, -48, 33,
+    19, -15, -43, -2, 3, -24, 12, 19, 36, 22, 12, 25, 45, 45, -45, 22,
+    13, -34, 3, 28, -49, -54, 22, 39, 1, -49, -39, -30, -28, 38, -46, -5,
+    -3, 43, -37, 36, 38, 1, -14, 46, -41, -12, -26, -26, -42, -34, -42, 40,
+    -13, 38, 10, -27, 15, 19, -37, -46, 40, -22, -31, -10, -30, -12, -40, -17,
+    -47, -21, -21, -42, 50, 42, -25, -52, -22, -22, 31, 34, -29, -31, 4, 2,
+    -30, -56, -13, -42, 11, -5, -49, -1, 13, 29, 1, 3, -1, 9, 44, -49,
+    37, -38, 44, 30, -16, 25, 21, 0, 10, -3, 39, 15, -57, -54, 15, 38,
+    17, -3, 23, 4, -35, 31, 45, -3, -21, -10, 25, -23, -46, 27, -20, -16,
+    -27, 18, 28, -36, -39, -46, -40, -30, -20, 29, -50, -37, 28, -7, -9, 5,
+    26, -15, 36, 41, -17, -36, 34, -6, -32, -25, -12, -29, -48, -17, 30, -29,
+    6, -46, -7, 3, 12, 23, -24, 33, 25, 10, 4, -1, -18, 22, -31, 28,
+    -23, -16, -35, 8, 24, -46, -16, 37, -59, -53, 16, 21, 10, -54, 10, 20,
+    -27, 22, 13, 17, -29, -37, -46, -43, -38, 33, -39, 49, 34, 13, -29, 41,
+    2, 20, -14, 31, 5, -47, 0, -43, 43, -48, 45, -36, 15, 20, -35, -44,
+    2, 32, -1, 10, 1, -2, 49, 22, -1, 37, 15, 3, -49, -26, 40, -29,
+    -42, -17, 21, -12, -33, 19, -46, -37, 4, -27, 24, -27, 36, -14, 28, 43,
+    18, 23, -24, 39, -18, -39, 8, -20, -34, 10, 36, -42, -37, 45, 5, -37,
+    -41, 10, 19, 4, -49, 25, 38, 37, 48, -49, 8, -8, 24, -13, -9, 32,
+    -18, 2, -22, -45, -19, 7, -36, -36, -27, 0, 7, 33, -10, -19, 0, 7,
+    -49, -17, 39, -44, 4, -16, 37, -13, -43, -11, -11, -21, 38, 30, 8, -38,
+    46, -50, -14, -33, -48, -18, -39, -10, -17, 23, -3, 22, -29, 35, -2, -13,
+    50, 35, 21, -25, -23, 15, 19, 1, -10, 42, 33, -4, -14, -44, -40, 47,
+    -48, 17, -29, 22, 43, -33, -22, -11, 11, 16, -46, 39, -16, -31, -51, 32,
+    -30, -30, 7, -20, -43, -1, 32, -10, 48, 15, 41, -3, 35, 13, 25, -56,
+    4, 39, -7, -2, 15, -12, -7, -55, -29, -79, -22, 28, 27, -20, -48, -11,
+    41, 1, -47, -33, -35, -32, -1, -46, 30, -54, 35, 40, 7, -25, 20, 17,
+    -45, 19, 29, -31, -13, 1, -54, 4, 40, -11, -17, 46, -20, -40, 12, 40,
+    6, 7, -39, -23, 11, -92, -1, -80, -6, -6, 4, -24, -20, -26, 45, -11,
+    -54, -26, -60, -51, 26, -49, 2, -16, -40, -1, -51, 37, -51, -6, 43, -28,
+    10, -12, -11, 8, 0, -14, -48, -22, -34, 32, -24, 3, 23, -39, -40, 19,
+    -13, 25, -23, -19, -7, 38, -33, 4, -29, -25, -34, 15, -55, -57, -45, -41,
+    17, 23, -23, -3, -24, -10, -21, -34, -11, -45, -33, -42, -18, -45, 21, 4,
+    7, -31, 20, 54, -20, 18, -6, -14, -44, 9, -66, 14, -12, -5, -17, 25,
+    -1, 1, -2, 5, -23, 12, -38, -7, 6, -36, -27, -18, -30, -37, 14, -17,
+    12, -18, -16, -15, -4, -17, -25, -46, -25, 4, 18, -47, 10, -21, -23, 22,
+    19, -1, -20, -54, -25, -16, -18, 36, 9, 31, 13, -10, 23, -25, 17, 17,
+    -40, -15, 9, -57, -9, 65, 7, 20, 45, -38, -51, -49, 12, -57, -60, -34,
+    7, 26, -68, -6, -17, 16, -41, -30, -50, 28, -50, -31, -68, 4, -8, -2,
+    27, 23, 3, 22, 31, 13, 26, -13, 7, -40, -32, -12, 1, 23, 30, -35,
+    -6, 8, 14, 12, -33, -14, 35, 59, -57, 3, 5, -35, 12, 63, 12, 15,
+    -43, 4, 15, -29, -12, -48, -22, -2, 26, 11, -46, 35, -30, -49, -30, -17,
+    -42, -25, -6, -52, 4, -68, -27, -54, -30, -11, 32, -2, -21, -14, -11, 8,
+    34, -17, 9, -61, 28, -26, 12, -10, 25, -16, -32, 34, -45, 1, -44, -35,
+    10, 5, -4, 17, 24, 49, -17, 24, 20, -48, -8, -31, -2, 41, -45, -46,
+    -16, 41, 37, 4, 38, 1, -48, 31, -39, 8, -51, -58, -66, 14, -39, -4,
+    -12, 42, 11, -7, 5, -63, -29, -87, 25, -2, 18, -4, 28, 12, -50, -40,
+    2, 16, 1, -22, -23, 28, -36, -16, 19, -27, -44, -47, 21, 21, 8, 9,
+    25, -44, -43, -71, 57, -12, -21, -22, 2, 4, -30, -39, 4, 29, 8, 19,
+    18, -60, -11, -68, -6, -16, 26, 23, 29, 10, 14, 7, -7, -78, 7, -6,
+    -30, -38, -43, -2, 37, 29, -39, 45, 14, -11, -32, -14, -6, 18, -28, 2,
+    -51, 20, -7, -18, 34, 24, -5, 11, -49, -7, -15, -6, 9, 27, -20, 25,
+    -14, -27, 48, 8, 42, 51, -36, 42, -10, -22, -5, -28, 5, 21, -35, -17,
+    -30, 8, 29, -3, -2, 5, -10, -16, -6, -45, -51, -44, -3, -14, 1, 22,
+    7, 33, 26, -46, -3, -9, -20, 20, 11, -36, 42, -22, 15, -20, 22, -32,
+    1, -28, 10, -31, -58, 28, -69, 0, -48, 66, 18, -23, 22, 13, 44, -37,
+    -49, 49, -26, -43, 19, 12, 13, 29, 3, 29, -35, -14, 21, 52, 18, -29,
+    -16, -2, 14, 14, -21, 46, -28, -21, -45, 3, 6, -22, -8, -7, -43, 18,
+    15, 6, -22, -52, 2, -16, 28, -19, 1, -23, -12, 34, -12, 23, 9, 40,
+    43, 33, 42, 27, 3, 23, 48, -27, 19, -27, -30, -64, -49, 12, 35, -30,
+    -23, -34, 5, 34, 14, 52, -32, -25, -7, 8, -1, 25, 41, 25, 28, 23,
+    -14, -30, -49, 46, 25, 39, -41, 21, -5, 8, -19, 10, -53, -29, 6, -33,
+    -17, -5, 68, 21, 0, 31, 26, -32, 17, -6, -11, -32, 0, -50, 18, 10,
+    -38, -6, 17, -41, -78, -47, 2, -67, -14, 27, -70, 0, 34, -30, -36, -47,
+    22, -18, -1, 41, -37, -44, 33, -6, -9, -33, -51, 27, -11, 16, -4, 0,
+    17, -22, 36, -20, 10, 26, -3, 16, -40, -44, -9, -27, 7, -32, 6, -46,
+    30, -41, 5, 46, 34, 6, 28, -3, 21, 45, 9, -10, 45, -59, -1, 4,
+    15, -50, -39, -47, -33, 33, -15, 27, 46, 42, -48, 5, -5, 26, -41, 23,
+    -32, -31, 14, 35, -16, 32, -44, 25, -8, -5, 6, 32, -24, 7, -32, 12,
+    -5, 44, 0, -49, -12, -51, -8, -23, -49, 9, -43, -28, -11, 26, -40, 37,
+    51, 65, 20, 64, -15, -49, 28, -16, -30, -4, -14, 8, -60, -60, -20, -31,
+    11, -13, 35, 18, -14, -19, 45, 0, -38, -51, 22, -35, -30, -11, 19, 24,
+    12, -2, 17, 48, 2, 32, 42, 52, 0, 29, -35, -11, 34, -35, -35, -48,
+    13, 23, 14, 34, 11, 21, -47, -13, 2, 46, 56, 25, -16, -25, 34, -16,
+    58, 55, -20, -7, -13, -7, 8, 36, -28, 4, 15, -28, 14, -51, -36, 21,
+    -3, -43, -16, -19, -42, -18, -52, 13, 18, 65, 0, 7, -9, -23, 29, 31,
+    69, 26, -1, -41, -17, -40, -39, -68, 22, -2, 19, 44, -49, -18, -2, 0,
+    -24, 18, -6, -8, -25, 11, 31, 23, 36, 34, 22, 1, 22, 20, 50, 6,
+    28, 22, -57, 19, -10, 19, -8, 38, -48, -13, -36, 32, -5, -33, -6, 22,
+    32, -21, 4, 32, 20, -4, 23, -38, 45, 29, -33, 22, -26, 5, -14, 5,
+    -51, 49, -20, -19, -51, -29, -3, -40, 62, 21, -30, -24, 7, 18, -9, -14,
+    -37, 29, 32, -4, -19, 17, 11, 15, 21, -3, 18, 26, -15, 39, -18, 49,
+    13, 45, 32, 26, 14, -32, 5, 25, 0, 15, 9, 8, 19, -8, 14, 43,
+    -14, -34, 40, 35, -9, -8, -50, 20, -19, -13, -15, 45, -18, 45, 6, -41,
+    12, -10, 39, 15, 17, -6, -52, 12, -48, -34, 23, -19, 51, -4, -15, -20,
+    2, 2, -21, -6, -7, 30, 13, 39, -35, 43, -7, 24, -34, -18, -61, -37,
+    -51, -54, 18, 5, -28, -12, -53, -9, 0, 12, 8, 49, 46, 10, 8, -15,
+    0, 56, -22, -9, 9, -18, -50, 22, -56, -56, -26, -53, -68, -5, -13, -69,
+    -46, -44, -4, -75, 39, -29, 8, -24, -20, -33, 20, -49, -9, -36, -12, 19,
+    -31, -3, -36, -8, -3, -65, 18, -20, -89, -43, -63, -62, -87, -12, -60, -46,
+    -42, -14, -24, -43, 38, -11, -8, -76, -17, 6, 24, 37, -41, 4, 13, 20,
+    -20, -53, -48, -76, -30, 0, -41, -60, -19, -4, -10, -15, 2, 5, 5, -36,
+    20, -31, -39, -13, 1, -36, -8, 37, -42, -25, 47, 6, -12, -5, -57, 15,
+    -25, -40, -1, 20, -21, 27, -32, -60, -6, -54, 4, 34, -1, -59, -29, 20,
+    18, -38, -51, 31, 32, -45, -40, 61, -3, 39, -18, 16, 17, -22, -14, 10,
+    13, -10, 24, 17, 7, 14, -6, 6, -52, -33, 18, -51, -34, 37, 20, -50,
+    -7, 32, -13, 33, -11, 38, -1, -26, 19, -29, 21, 5, -18, 40, 45, -14,
+    -57, -35, 24, 16, -22, 14, -59, -26, 21, 91, 38, 29, 2, -24, -5, -30,
+    57, -14, 10, 46, 31, 39, -31, 44, 30, -26, 43, -38, 39, 4, 27, -45,
+    19, 11, 38, 41, 29, 44, 88, -8, 31, 9, 34, 8, 55, -6, -9, 17,
+    27, -26, 15, 27, -16, 37, 38, 40, -26, -29, -43, 56, -2, -13, 17, 58,
+    26, 60, 57, 39, 4, -14, 36, 2, -13, -26, 26, -15, -18, 35, -20, 50,
+    -10, -31, -20, -18, 20, -10, 27, -47, 30, 46, -36, -4, 12, 18, 109, -15,
+    -23, -20, 0, -36, -30, 52, -25, 25, -14, 24, 48, -31, 35, 31, 23, -27,
+    -26, 49, -8, 20, 24, -1, 40, 46, 9, 75, 53, -42, -10, -28, 21, 7,
+    -9, 53, 46, -23, 29, 19, -13, -11, 28, 1, 8, 20, 48, 18, -37, -10,
+    -22, 76, 16, 83, 6, 31, 11, -24, 1, -37, -25, -56, 30, -44, 7, 20,
+    16, 15, 10, -21, -43, -50, -17, -46, -34, -47, 12, 4, 16, -32, 36, 26,
+    84, 7, 85, -12, -29, 4, -46, 58, -4, -19, 20, -44, -14, -30, 2, 5,
+    -21, 11, 22, -42, 33, 39, 7, 17, 17, -35, 3, 35, 65, 54, 67, 48,
+    -31, -20, 29, -4, -55, -13, -13, -4, -68, -35, 15, 20, -22, 2, -3, -18,
+    6, -15, -23, 15, 2, 31, 21, 50, 34, -10, 0, 5, 28, -38, -4, 11,
+    -72, -8, -65, -65, -64, -10, -20, -61, -11, -65, 14, -18, -31, 8, 43, 1,
+    -41, -18, 10, 46, -4, 34, -12, 3, 19, -38, -23, 23, -23, 32, -29, -45,
+    45, 13, 44, -44, -3, -37, -69, 19, -51, 18, -28, 44, 7, -9, 24, 2,
+    25, -39, 11, 42, -14, -7, 16, -3, 49, -34, -31, 32, -17, -9, -48, 22,
+    19, 23, 30, -8, -28, -34, -46, -45, -42, -6, 17, 39, 19, -46, 26, 14,
+    23, -10, -41, 37, 1, -13, 46, -17, 22, 29, -22, 27, 22, -31, 36, -22,
+    46, -27, -22, -47, -33, -19, -51, 2, -11, -12, 2, -26, -26, -43, -22, -45,
+    40, -9, -5, -62, 42, 51, 14, -14, 36, 38, 22, 11, 33, 38, 64, -33,
+    7, 19, 28, -35, 25, -28, -24, -21, 39, -45, -51, -30, -44, -26, 38, 47,
+    -2, 22, 6, 28, 30, 46, 68, 10, 5, 21, 6, 21, -23, 19, 43, 28,
+    36, 32, -13, -35, 35, -48, 43, 24, 48, -26, -38, 20, 37, -46, -54, 49,
+    12, 3, 8, 2, 10, -37, 18, 4, 47, 11, 30, -14, 62, -7, 35, -4,
+    31, -2, -22, -35, -62, -56, 54, 23, -30, -67, 10, 32, -33, 7, -47, -13,
+    -16, 9, 68, 18, 0, 12, -13, 15, 14, 1, -16, 24, 23, 12, 48, 41,
+    -34, -38, -9, -3, 1, 5, 10, -27, 15, 0, -7, 10, 0, 19, -17, 22,
+    42, -53, 40, -19, -26, -46, -53, 28, 48, -11, -38, -47, 31, 16, 2, 27,
+    -15, -46, -1, 13, -37, -46, -50, -12, -51, -60, 30, 4, -50, -59, -7, -30,
+    -82, -30, 17, 19, -50, -37, -8, -45, -50, -23, -41, 10, -22, -22, 4, -37,
+    -41, 29, -13, -11, -26, -3, -3, -58, -63, 20, -44, 3, -21, -40, 12, -5,
+    6, 17, 37, 33, 34, -22, -41, 0, 22, 14, -42, -50, 5, -20, 18, 9,
+    -14, 3, -43, 8, -12, 22, 3, -12, -9, -6, 0, -21, -19, 48, -24, 35,
+    -1, -12, -31, -47, -42, 1, -2, 41, -33, -41, -34, 14, -35, -48, -2, -25,
+    -30, -58, -18, -82, -32, -10, -73, -8, -5, 8, -5, 20, 10, 23, -14, 43,
+    -25, -2, -18, 9, -14, -49, 44, -50, -22, -39, -17, -23, 16, -28, -16, -45,
+    15, -22, -5, 27, -4, -14, -14, 8, -51, -44, -73, 7, 7, 24, 34, 36,
+    -14, 4, -49, 2, 19, -6, -18, -22, 6, 0, 1, 24, -11, 11, -2, 45,
+    49, -28, 21, 20, -1, -6, 4, 42, 2, -51, 19, -34, 5, -59, 29, -14,
+    0, -39, 6, -58, 26, 38, -12, 30, 47, -16, 11, 36, 9, -25, 10, -24,
+    5, -44, 35, -14, -36, 30, 11, -18, 21, -37, -6, 28, 37, 10, -26, 19,
+    7, -2, -33, 56, 39, 40, -40, 12, -40, -27, 28, 44, -59, 15, 22, 66,
+    6, 62, 47, -17, -14, -31, 30, 35, 4, -26, -10, 16, -25, -16, 49, 27,
+    -51, 4, -75, 9, -4, -12, -19, 11, -34, -21, -21, 48, 32, 21, -27, 10,
+    -32, -21, 29, -46, 13, 1, 16, 8, 18, 21, -9, 4, -4, -45, -46, -52,
+    -36, 5, -29, 10, -5, 2, 49, -26, 42, 37, 39, 78, 64, 33, -33, 8,
+    21, 2, -28, -16, 39, 23, 2, 32, 24, -8, 23, 32, -4, -40, -33, -40,
+    -74, 15, 4, -15, 34, -9, -15, 12, -11, 42, 29, -20, -46, -15, 35, -27,
+    49, 29, -25, 23, -45, -15, -44, -29, 10, -29, 30, 17, -41, -23, 6, 2,
+    37, 56, 9, -11, -17, -28, -1, 18, 27, -12, -35, 35, -51, -20, -18, -31,
+    21, 8, 17, -34, -40, -24, -2, 7, -12, 11, 10, -50, -11, -25, 21, 16,
+    -14, 0, 51, 18, -25, 28, -15, 27, -41, 26, -15, 5, 7, -20, -30, 12,
+    -32, -18, -45, 26, 5, -30, 28, -46, 0, -11, 37, 52, 21, -7, 47, 11,
+    50, -2, 3, 8, 30, 2, -16, 34, 31, 10, -23, 10, -42, -17, -49, 28,
+    47, -61, -46, -25, -44, 29, -4, 27, 15, 26, 8, 20, 30, 4, -48, 9,
+    14, 1, 10, -23, -73, 4, -14, 3, -47, -21, 18, 11, -12, -46, -20, -52,
+    18, -4, 35, -44, -5, 24, -26, -3, -14, -54, 13, -19, -67, -5, 9, 8,
+    -72, 6, -57, 41, 12, -37, -34, 43, -3, -21, 43, 56, -58, -29, 24, -17,
+    -46, -72, 3, 8, -31, -72, 7, -25, 7, 24, -47, -38, 38, -7, 6, -45,
+    20, 7, 18, 12, 48, -12, 44, -14, 2, 12, -44, -15, -52, -24, -20, -85,
+    -8, -21, 9, -40, -52, 45, -10, 3, -17, -3, 3, 24, 16, 29, 37, -28,
+    -20, -11, -22, -55, 9, -2, -84, -48, 12, -56, -82, 16, -38, 3, -48, 26,
+    -18, -15, 26, 26, 21, 11, -39, 6, -15, 22, 44, 47, 22, -63, -23, 36,
+    -60, 25, 11, 33, -51, -70, -32, -10, -13, -62, 23, -34, -64, 32, -57, -60,
+    21, -29, -21, -23, 7, 8, 26, -8, -10, 3, 13, 21, -37, 1, -19, 14,
+    12, -24, 10, 30, 5, -5, -33, -42, 9, -51, 29, 10, 6, 39, -20, 39,
+    19, 7, -10, 19, -20, 31, -28, -31, -8, 47, -40, 13, -41, 13, 48, 4,
+    -5, -31, -9, 14, 19, -7, -4, 5, 51, 46, -18, -36, -23, 21, 23, 44,
+    -28, -23, -50, 38, -51, -24, 35, 49, -4, -31, 38, -40, -19, -28, -20, 50,
+    -47, 50, 5, 19, 46, -19, -1, 24, 8, 34, -51, -51, 2, -25, -49, 16,
+    -51, -37, 34, -27, -15, 6, 21, 33, 21, 30, -18, 20, -8, 7, 47, -17,
+    4, -14, 43, 3, -5, -1, 50, 35, 44, -24, 10, 6, -36, 40, -8, -24,
+    -22, -40, 48, 37, 18, -3, 14, -28, 32, -36, 47, -20, 2, -9, -33, 10,
+    -40, 47, 45, 10, 25, -54, 14, 38, -36, -49, 41, -41, -18, -35, -28, 41,
+    -44, -21, 22, 27, 20, -28, -46, 10, 23, -25, 32, 27, -9, 1, 23, 19,
+    -19, 45, 30, 22, 27, -22, -25, -32, 32, 30, -15, 33, -56, 44, -40, -37,
+    -2, -49, 47, -25, -16, 37, -21, 3, -4, 5, -17, -2, -5, 50, 44, 31,
+    45, -1, -13, 29, 20, -8, 27, 11, -48, 1, -30, 43, 38, 42, 15, -32,
+    47, -2, 20, -8, -21, 49, 5, -47, 18, 34, -22, -26, 40, -15, 40, 6,
+    13, -37, -34, -54, 43, -46, 45, -33, 16, -56, -46, -34, 30, 25, -52, 31,
+    38, -49, -9, -15, 29, -14, -9, -41, 14, 29, -4, -38, -56, -37, 14, -18,
+    40, 6, 20, 13, -13, 0, -40, 26, 44, 13, 13, 24, -41, 9, 8, -39,
+    51, 34, -15, 17, -45, 10, -47, -37, -26, 37, 31, -6, -49, -22, -52, 31,
+    -30, -22, 33, 0, 34, -24, 18, 20, -42, 48, -49, -40, 42, -17, -15, 12,
+    28, -28, -35, 40, 31, -38, -30, -8, -23, 31, -1, 4, -16, -5, 16, -35,
+    8, -40, -8, 42, 6, -19, 49, -31, -14, 3, 22, 42, -27, -38, -30, 34,
+    22, -18, -49, -3, -29, -25, -10, -42, -11, 15, 33, 22, -23, 32, 4, 5,
+    45, -19, -1, -51, -32, 34, -11, 17, 5, -36, 31, -34, -23, 17, -6, -49,
+    -53, -7, 23, 1, 38, -28, -24, -21, 42, 45, -27, 15, 27, 0, -22, 32,
+    15, -26, -32, -40, -17, 16, -34, 10, 1, 44, -26, -3, 41, 45, 9, -40,
+    32, 8, -39, 30, 6, -26, -41, -48, 33, -40, -1, 41, 40, 33, -9, 2,
+    -33, 4, -53, 13, -30, -38, 23, -38, 45, -31, -14, 1, 34, 27, -55, -19,
+    35, 19, 9, 0, 22, -46, 3, -16, -18, 33, 3, -47, 8, 6, -41, 20,
+    47, -39, 33, 34, 6, 1, -43, -9, 38, 25, -45, -34, -7, -27, -2, -35,
+    2, 24, -41, 33, 11, 43, -52, -5, 35, 35, -1, -24, 23, -49, -32, -9,
+    -40, -11, -42, -40, -17, -2, 38, -49, -44, -42, 38, -20, 1, -36, -43, 40,
+    -43, 9, -56, 35, -37, -7, -19, -8, 8, -39, 20, -47, 6, -30, -51, 3,
+    35, -31, -36, -2, -42, -27, 16, 48, -24, -40, 4, 29, -23, 22, 27, -30,
+    -36, -56, -38, 24, -14, 5, 25, -43, -42, -36, -6, 39, -16, 22, -19, -25,
+    42, -36, 32, -4, 27, 8, 35, -50, 1, -22, 42, 34, -46, -35, -27, 30,
+    -58, 17, 27, -29, -43, -54, 26, -28, -4, -51, -47, 37, 21, 4, 38, 32,
+    -43, -45, 37, -36, -19, -16, -16, -36, -19, -37, 45, -25, -38, -20, 28, -3,
+    -13, -7, 23, 22, -2, 13, 29, 20, 1, 23, -14, -14, 19, 33, 9, 8,
+    -47, 40, 13, 31, -8, 20, -5, -9, -15, -26, 23, -6, 23, -49, 36, 27,
+    -15, -27, -24, -15, -46, 49, -51, 28, 18, 14, -49, -31, 32, 18, 41, 32,
+    23, 44, 24, -42, 33, -6, -44, -13, 25, -4, 45, -44, 3, -46, 2, 9,
+    -9, 26, 51, -28, -22, 46, -39, 4, 9, 29, 23, -24, 32, -55, -45, -27,
+    -40, -28, -53, 8, 21, -44, 2, -13, 34, 1, -13, -10, 6, 28, 42, -24,
+    39, 47, 4, -12, -48, 49, -15, 6, -12, 0, -34, -4, 1, -51, 14, 10,
+    33, 6, -54, 44, 1, -32, -22, -31, 30, -42, -1, -33, 29, 34, 1, 50,
+    -4, 36, 44, -25, -50, -41, 34, 29, -42, -5, -37, -28, -25, -9, 11, -35,
+    12, -39, 23, 37, -39, 16, -21, 36, 13, -10, 33, -5, 11, 23, 23, 17,
+    3, -45, -26, -24, 15, 40, 51, -1, -28, -5, -4, 47, -40, -12, -17, -11,
+    26, -15, -1, 25, 47, -15, -41, 27, 22, 7, 45, 20, -32, 43, -11, -32,
+    18, 39, -32, 8, -3, -9, -19, -11, 32, -18, -12, 45, 0, 3, 0, 10,
+    -8, 24, -35, -38, 3, -13, -39, -37, 19, -3, 18, -39, -10, 12, 45, 27,
+    -23, -47, -37, -17, 23, -37, -13, 37, -26, -21, 7, 17, 12, -35, 1, -37,
+    45, -10, 24, 48, 25, -20, 48, -5, 7, -76, -21, -43, 0, 29, -43, -1,
+    9, -29, 39, -49, 40, -2, 43, -47, 4, -14, 22, -18, 38, -3, 65, -30,
+    -36, 18, 28, -83, -50, -62, -55, -61, 29, -8, -11, 8, -28, -19, -6, -15,
+    12, 9, 49, -9, 50, -43, -1, 41, 4, -51, 34, 30, -43, -77, -59, -13,
+    -63, -50, -5, -10, -63, -40, -47, 17, -8, -52, -49, 24, -16, -16, 35, -4,
+    -27, 33, -22, 44, 58, -37, 22, 19, -5, 10, -67, 64, -74, 7, -24, -28,
+    9, -15, -34, -11, -67, -10, 13, -20, 43, 33, 14, -6, -36, -41, 45, -47,
+    1, -27, -57, 23, -37, 9, -42, -23, -41, -25, -27, -25, -42, -39, 0, -44,
+    17, 4, 4, 24, 36, 32, 23, -40, 4, -23, -25, 8, -24, 19, 4, 41,
+    4, -9, -38, -27, 36, -11, -15, 66, -12, -13, 22, -3, 2, -39, -16, 6,
+    6, -3, 31, 8, -2, 34, -43, 31, -23, -35, 9, 29, -39, -10, -23, 11,
+    -16, 36, -6, -31, 34, 31, 37, -20, 6, -15, -14, -11, -50, -15, -15, -43,
+    -45, 42, 8, -38, -4, -40, -22, 10, -15, -26, 40, 10, -28, 7, 21, -4,
+    -1, -23, 21, -15, 5, -26, -6, -29, -24, -30, -12, -20, -35, -22, 16, -51,
+    23, 20, -31, -36, -43, -36, -39, 43, 25, 25, -33, 7, -18, -12, -36, -51,
+    -54, 16, -28, -20, 7, -34, -41, -38, 48, -11, 36, -39, 25, 6, 16, 25,
+    -5, 36, 5, -13, -18, -3, 11, -28, 47, 39, 0, 34, -22, -27, 38, -41,
+    -31, 32, 37, 19, -3, 9, -54, 41, 31, 31, -1, -1, 3, 2, 54, 3,
+    40, -6, -39, -26, -7, -8, 45, 49, 10, -3, -48, 43, 15, -13, -29, -26,
+    -38, -12, -37, 25, 72, -4, -12, 72, 37, -19, 39, -3, -18, 24, -10, 25,
+    11, 73, 1, -18, 42, 22, -21, 18, -16, -15, 9, 29, -6, -15, -26, -78,
+    8, 39, 32, -12, 16, 45, -9, -20, -24, -3, -12, 42, 5, -2, 45, -4,
+    22, -54, -40, -59, -39, 0, 7, -35, 15, -64, 28, -24, -20, 21, -29, 8,
+    -22, -8, -18, 32, 17, 0, 13, 34, 13, 13, -3, 55, 23, -3, -16, -64,
+    -71, -19, -68, -5, 43, 8, -13, -17, 18, -26, 29, 48, 37, 17, 48, -8,
+    -28, -38, -29, 37, 16, 51, 53, -35, -5, 22, 6, -16, -13, 9, -54, 10,
+    -14, 49, -64, -61, -51, 11, 10, 30, 0, 8, -45, -21, 63, -22, -27, 48,
+    -4, 38, 50, -33, -34, -41, -3, -48, -8, 2, 2, -4, 18, -8, 41, -65,
+    -32, -52, -15, 40, 7, 1, 54, -3, -2, -28, 18, 37, 19, -34, -23, 33,
+    29, 23, -12, -62, -82, 69, -19, 36, 27, -36, -22, -2, -28, -14, -57, 15,
+    38, 14, -34, -21, -37, 21, -4, -2, 40, -16, -59, -28, -27, 13, -54, -15,
+    -27, -41, 36, -22, 16, -47, -29, -73, 38, 26, -21, -64, -24, -41, -25, 6,
+    -1, -8, -8, -26, -12, 15, -36, 14, -14, -10, -33, -28, -49, 9, -27, -50,
+    44, -24, -27, 9, 37, -24, 18, -63, -22, 5, -54, -47, -26, -20, -34, -24,
+    5, -29, -11, -74, 16, -7, -19, 22, -45, -16, 4, -28, 3, -8, 51, -50,
+    6, -67, -18, -44, 26, 0, 4, -44, -2, 12, 23, -14, 17, -36, -15, 5,
+    20, 11, 26, 37, -35, 41, 36, 16, 26, -49, -41, -59, 3, 10, -1, -57,
+    -36, 23, -32, -1, -1, -14, -27, -40, -21, -47, 4, -53, -17, -26, -45, 0,
+    37, -43, 59, 20, 46, 27, -21, 9, -11, -45, 16, -31, -4, -20, 20, -1,
+    -62, -28, -3, 11, -65, -14, -2, 30, -25, 75, -45, 40, 41, -7, 14, -33,
+    29, -2, -1, 27, -28, 34, 1, -39, 12, -48, -62, 20, -44, -47, 2, -16,
+    -11, 12, 13, 23, 92, 127, -23, 92, -8, 9, -21, 15, -34, -50, 39, 15,
+    -28, -18, 5, 24, 31, 23, -3, -15, 26, 39, -29, 29, 25, -7, 43, 22,
+    17, 47, 104, 71, 78, 10, 42, 31, 47, 2, -43, 1, -1, 36, -35, -24,
+    3, 45, 18, 46, 20, 28, 25, -70, 30, 40, 28, 89, -3, 10, 70, 84,
+    95, 15, 7, 4, 38, -37, 4, -47, -21, 4, -18, 32, 2, -47, -49, -13,
+    -3, -80, 41, -23, 12, 38, 60, -55, 0, -26, 74, -48, -11, -42, -41, -8,
+    -37, -9, 10, -21, 32, -49, 46, -46, -19, -17, -44, -45, -12, 17, 31, -10,
+    27, 30, -8, 11, -37, -51, 42, -19, 0, 0, 26, -10, 15, -26, -7, 9,
+    42, -50, 31, 13, -29, 29, -38, 10, 38, 8, -18, -25, -32, 46, -3, 13,
+    -22, 49, -21, 44, 19, -45, -22, -28, 8, -43, 38, -44, 7, 29, -5, 29,
+    -17, 7, -11, 10, -19, -9, -35, 29, 35, -46, -41, 44, -23, -21, 1, 33,
+    -28, 11, -33, 43, 51, -1, 34, -29, 26, -54, -11, -51, -50, 9, 19, 43,
+    -17, 36, 42, 36, 28, -43, -14, -66, 5, 39, 39, 12, 6, 45, 16, 39,
+    -37, 32, 9, 6, 18, 22, -20, 42, -22, -27, 25, -30, -16, 52, -20, 15,
+    -47, -33, 39, 3, 50, 18, -19, 18, 33, -4, 15, -15, 41, 11, 45, 9,
+    4, -10, 5, -2, 4, -40, 37, -36, 28, -20, -21, -25, -35, 16, 15, -37,
+    0, -28, 7, 2, -15, 34, 12, 12, 37, 2, -37, 41, 43, 41, 23, 34,
+    22, 24, 19, -27, 26, -28, 38, -18, 41, 34, -46, 11, -4, 22, 32, -6,
+    -20, 58, 26, 14, 19, 20, 9, 15, 30, -21, -41, 27, -30, 11, 21, -21,
+    3, 35, -21, -6, 6, -23, -2, 36, -4, 36, -2, 49, -1, 35, -18, 6,
+    24, 26, 28, -27, -3, 5, 8, 39, -27, 21, 17, 15, 13, -32, 1, 30,
+    -36, -8, 14, -38, 37, 31, -24, 54, 31, 53, 79, 35, 11, 32, -11, 28,
+    35, 30, -32, -48, -25, -16, -3, -13, 24, -8, -15, -17, 16, 40, 21, -26,
+    4, -22, 16, 5, -16, 32, 35, -30, -36, -27, -17, 43, 6, 55, -13, -41,
+    31, -45, -19, -22, -15, 42, 42, 6, -31, -38, -3, -8, 10, -17, 2, -5,
+    -40, -33, 80, 42, -14, -38, -41, 32, -24, 51, -17, -51, -44, 1, 24, 20,
+    23, 15, 7, -44, -22, 14, -37, -1, -3, -50, -92, -60, -60, -14, -47, 45,
+    -22, 51, -33, 25, -6, 6, 12, 14, 24, 9, -28, 30, -6, 1, -9, 41,
+    2, -49, -3, -45, -60, -22, 1, 17, -9, 30, -32, 5, 30, -30, 1, 8,
+    12, -34, 12, 32, -11, -16, 45, 20, 6, 32, 17, -48, 16, 10, -13, 24,
+    -34, 15, -51, -64, -57, -10, 27, 48, 17, -31, -25, -48, 30, 32, -46, 23,
+    27, 9, 30, -6, 26, 3, 10, -2, 1, -26, -32, 36, 22, 25, 11, 35,
+    52, -23, -45, 28, 43, 7, -11, -9, -46, -48, -51, -57, -46, 9, -55, 22,
+    -11, 4, 1, -46, -43, 15, -3, -25, -11, -30, -18, -23, 44, -28, 14, -7,
+    47, 40, -22, 47, -10, -21, -5, -61, -21, 14, -46, -26, -30, -3, 46, 15,
+    -15, -3, 45, -5, -16, -18, 12, -35, -30, 13, 29, -41, 42, -27, 40, 65,
+    33, 14, -20, 6, -24, -72, -101, -58, -50, -48, -27, -2, -7, -18, -19, 37,
+    -27, -30, -1, -5, 48, 36, -5, 42, 13, -15, 16, 55, -11, -15, -37, -1,
+    -42, -68, -63, -44, -39, -61, -44, -37, 28, 15, -13, -23, 51, -22, 24, -5,
+    14, -8, -32, 37, -9, 44, -28, 11, 22, 6, 41, 36, 9, 13, 31, -15,
+    4, 23, -59, -40, -19, 47, 0, 18, 8, 9, 34, 23, 4, -57, -7, -30,
+    21, -20, 47, 56, 33, -14, 64, 20, -12, 3, -24, 10, 3, 41, 8, -3,
+    -21, 28, -37, -23, 7, 16, 36, -19, 37, -66, 10, -21, 11, -24, 25, 85,
+    47, -39, -31, 27, 54, 27, 41, 37, 19, -18, 16, 37, -37, -26, 20, -23,
+    25, 1, 23, 20, 16, -21, -8, 25, -16, 39, -39, -22, -34, -5, 38, 30,
+    -22, 4, 6, -28, -3, 28, -6, -31, 47, 13, 19, -48, -18, 16, 24, 9,
+    -23, -32, -6, 9, -45, -30, 16, 35, -23, 43, 8, -25, 39, 63, -17, 31,
+    19, 7, 40, -27, 15, -54, 26, 10, 20, -45, -22, -53, -40, -9, 0, -16,
+    -29, -9, -33, 14, 37, 4, 5, 7, -24, -14, 34, 18, -33, 7, 31, 5,
+    10, 6, 0, 37, -44, 43, -37, -54, 31, 39, -17, -21, 6, -30, -44, 11,
+    32, 35, 44, 48, -17, -4, 42, -31, 35, -44, -31, -27, -42, -20, 35, 24,
+    26, -5, 12, 11, 7, 33, 38, 18, 5, 22, 45, -27, 25, -27, 45, -34,
+    -17, -41, 26, -7, 40, -12, -3, 55, -18, 21, 23, 38, -11, -53, -41, 10,
+    -43, -35, -1, 22, 0, -46, -31, 32, -48, 25, 1, -26, -51, 24, 23, 33,
+    -1, 35, -29, 27, 0, -44, -18, -25, -8, -11, -22, 3, -11, -16, -42, -35,
+    -27, -23, 12, -1, -35, -19, -21, 46, -13, 5, -16, 49, 11, -38, 36, -6,
+    -24, 42, 16, 46, 24, -48, 43, -6, 29, 21, 45, -9, -20, -1, 37, -36,
+    -8, 18, -47, -2, 13, -42, -23, 9, 5, 45, 34, -20, 23, 28, -13, -27,
+    44, -4, -5, -32, 31, 36, -46, 24, 19, -28, -6, -47, -34, 49, 35, 26,
+    34, -47, -41, -27, -16, -38, 6, 35, -18, 28, 23, 3, -24, -6, 24, -51,
+    31, -25, -22, 44, 17, 45, 40, 36, 32, -45, 17, -49, -11, 14, -5, -30,
+    -38, 16, -19, -27, -19, -17, -28, -33, -17, 20, -30, 33, 46, 5, -42, 9,
+    5, 50, 20, 31, 33, -11, -24, 18, 45, -15, -30, 0, -20, 8, 14, 1,
+    -45, 1, 17, -17, -47, 42, 24, -26, -10, 4, 36, -18, -20, -15, -37, 36,
+    -11, 6, -29, 50, -24, 26, 10, -52, 0, -21, -7, -41, -36, -37, 14, -15,
+    23, -36, 39, -4, -52, 20, -35, -21, -49, -9, 50, 17, 43, -15, 24, 18,
+    -27, -5, 25, 28, 17, -1, -27, -37, 12, 3, -7, -2, -37, 5, 4, -20,
+    -1, 29, -4, -11, 0, 79, -3, 70, 31, 20, 25, 60, 13, 1, 26, -3,
+    20, 2, -22, -45, 58, 13, -37, -23, 13, 15, -11, 45, 49, 10, 52, 42,
+    -9, 18, 60, 33, 63, 14, -10, 27, -11, 4, 33, 36, 11, 48, 31, -11,
+    4, 14, 43, 9, 21, 15, 16, -3, 59, 1, 2, 76, 14, 7, -10, 62,
+    30, 53, 8, 3, 3, 0, 42, 33, -39, 33, 41, 19, 12, 29, 7, 29,
+    -28, -3, 20, 6, -27, -8, 18, -16, 2, 47, -32, 37, 4, 16, 22, 24,
+    -40, -24, 21, 27, -23, 15, -11, 27, 74, 39, -16, -6, 4, 0, 23, 5,
+    23, 9, -25, 29, -8, 34, 12, -19, 52, -18, 34, -3, -12, 0, 26, 15,
+    13, 3, -26, 12, -9, -2, 44, 21, 25, 5, -61, 7, -31, 32, 10, 5,
+    -41, 20, 51, 2, -3, -6, -54, 23, -40, 0, 1, -4, -34, -35, -17, -38,
+    -11, 5, 10, -61, 5, -5, -70, 28, 45, -51, 4, -51, -18, 13, 70, -12,
+    -32, 47, -6, -4, 44, -11, 7, -10, -35, -11, -91, 14, -31, -21, -47, 13,
+    32, 14, -39, -7, 10, -47, -56, 38, 38, 33, -21, -5, 29, 43, -2, -2,
+    -13, -30, -26, -28, -69, -8, -34, -35, 18, -10, -15, 30, -28, 32, 13, -38,
+    -18, 24, 38, -46, -36, -25, 49, -53, -17, 29, 0, -51, 11, 5, -17, -19,
+    -61, -4, -12, 6, 40, 7, 24, -12, 26, -27, 16, -9, -16, 59, -13, 18,
+    47, 43, 17, 18, 36, -45, -15, -25, -61, 5, -18, -77, -4, -38, -24, 22,
+    40, 4, 19, -22, 8, -30, 20, -29, -8, 18, 37, -33, 11, 33, 6, -12,
+    27, 1, 31, 28, 18, -10, 26, -53, -21, -34, 33, 27, -54, -31, 34, 33,
+    -2, 11, -12, 28, -9, 34, -12, 50, -44, -2, 35, 2, 24, -45, 26, 11,
+    -5, -28, -24, -30, 32, -14, 6, 20, -11, -2, -29, -19, -42, -54, -75, -46,
+    2, -35, -48, 10, 30, -52, 2, 21, 25, -56, 13, -7, 27, -22, -47, -35,
+    -1, -22, 2, -4, -33, 8, -12, 33, -8, -6, -26, -21, -58, -21, -5, -10,
+    -13, 0, 6, 1, -53, -2, -21, 26, 29, -5, -27, 12, 6, -28, 63, 11,
+    16, -26, -12, -34, -42, -58, 9, 32, -50, -9, 20, 20, -21, -27, 11, 26,
+    26, -40, -66, -42, -44, -32, -24, 6, -6, -22, 25, -14, -19, -55, -53, -20,
+    -28, 37, -2, 3, 24, -19, -30, 1, -28, 50, 34, 40, 14, -1, -65, 27,
+    22, 23, 36, -29, -55, -38, 22, 27, -55, -25, -5, -49, 12, 7, -51, 34,
+    -35, 9, 15, -4, 0, -44, 6, -36, -41, -6, -8, 23, 40, -34, -3, 10,
+    -39, 35, 23, 1, -33, 1, -20, -14, -23, 20, -43, 25, 33, -38, -27, 33,
+    12, -12, -35, 15, -49, 47, -18, -5, 6, -4, 15, -4, 1, -31, -11, 17,
+    11, 22, -6, -51, -11, -61, 23, -62, -12, 48, -23, 33, -7, -47, 34, 27,
+    6, 17, 27, 18, -12, 12, -14, -7, 37, -4, 25, 35, 16, 35, -2, 43,
+    56, -2, 16, -41, 34, 33, 0, 17, 8, -29, 9, -24, -14, 22, -8, -27,
+    -44, -18, -2, 1, -62, 32, -41, -54, 35, 22, 63, -1, 19, -37, -46, 44,
+    -22, 8, 7, 27, 27, 17, 25, -24, -47, 10, 33, 56, 17, -9, 14, 58,
+    26, 62, -27, 39, 55, 68, -21, 14, 0, -39, 45, 17, -22, 1, 21, -40,
+    25, -20, -4, -29, -4, -29, 25, 31, 22, 11, -33, 6, 47, -41, 25, -43,
+    49, 36, -43, 19, -25, -43, 25, -6, 21, -14, -17, -29, 49, 35, -22, 28,
+    -3, 39, 29, 24, -13, 30, 2, -2, -5, 10, 38, -50, -21, -36, 13, -6,
+    -48, -16, 27, -30, 40, -5, -14, -8, 1, 19, 21, 22, -37, -39, -33, 6,
+    -43, -48, -8, -3, -66, 20, -14, -14, -6, 53, 3, -17, -28, -4, -1, 3,
+    -14, 5, -38, -24, 23, 39, -7, -43, 19, -38, 16, -22, -20, -56, -45, -2,
+    -42, -68, 24, -4, 7, -18, 43, -27, 38, -23, 36, -17, 42, 24, 12, -12,
+    -19, -3, -22, -18, -19, 35, -14, 13, -32, -20, -25, -45, 19, 32, -43, -30,
+    28, 13, 3, 0, 37, -23, 23, -93, -3, -39, 13, -33, 2, 20, 21, 29,
+    23, -1, -19, -30, -7, -22, -37, 37, -16, -5, 11, 26, -30, 28, 23, -41,
+    -29, 8, 14, 12, -7, 13, 37, 21, 36, 38, 5, -2, 33, 55, 31, -20,
+    72, -31, 30, -12, 12, -13, -19, 8, -33, -37, -10, 15, -40, 14, -13, -37,
+    35, -5, 17, 66, -9, 3, 50, -41, 2, -33, 41, -34, -11, -32, -17, -27,
+    11, 19, -45, -28, -2, -2, 16, 0, -5, 26, 0, 14, -15, 6, 15, 18,
+    16, 38, 48, -1, 18, -13, 30, -24, 20, -25, 45, -12, 21, 8, -26, -33,
+    -16, -18, 2, 0, 32, 18, -7, -13, -81, 34, 20, 56, -3, -17, 31, 49,
+    15, 0, -17, -9, -6, 48, -24, -9, -27, -2, 1, -4, -59, 0, -35, 32,
+    13, 17, 32, -53, -58, 50, -70, 39, 41, -49, 5, -4, 37, -59, -6, 14,
+    13, -24, 61, 56, 37, -49, 6, -50, 21, 19, -23, 12, -40, 33, 39, -38,
+    -30, -26, -9, -25, 31, -46, -24, -13, 14, 20, -46, -41, -3, 55, 10, -41,
+    41, -45, -12, 56, -1, 8, 4, 8, 70, -15, 9, -35, -35, -33, -61, 10,
+    -43, 29, 28, 4, -3, 10, 21, 16, -19, 29, 19, -3, -29, 35, -6, 14,
+    5, 30, -18, 37, -12, -16, 46, -8, 20, -67, -8, -11, -2, 46, -14, -9,
+    10, -19, 23, 46, 7, -39, 16, -15, 55, -3, 19, -9, 39, -21, 1, -21,
+    -7, -24, -49, 9, 14, -20, -26, 46, -19, -7, -25, 37, -26, 29, -18, 11,
+    -26, 11, -55, -13, -9, 55, 37, -6, 58, -48, -18, 0, -19, 0, -40, -24,
+    37, -21, -27, -47, -24, 23, -42, -13, -5, 14, 37, -76, -57, -35, -11, 8,
+    -17, -20, 10, -16, 30, 4, -30, -3, -5, 28, 31, 25, 24, 49, 36, -12,
+    -28, 43, -16, 34, -29, -40, -64, -10, 17, -39, 0, 37, 26, 33, 29, -14,
+    7, -36, -29, -40, 23, -55, -48, 33, -17, 44, 21, -39, -38, -12, -36, -54,
+    -12, -71, -54, 36, 2, 52, 23, 3, 10, -4, -6, -52, 27, 0, 18, 21,
+    -55, -56, -5, 17, -6, 32, -21, 30, -3, 14, 47, -20, -18, -93, -33, -38,
+    32, -6, -21, 41, 7, -4, 5, -9, -30, -21, -53, 25, -7, 38, -14, -61,
+    -51, -4, -31, 50, 18, -11, -7, -13, -23, -45, -58, -8, 32, 53, 14, 28,
+    27, -1, -48, -4, 22, -19, 7, -43, 37, -35, -5, -7, -26, 1, -16, 37,
+    34, 25, -20, -21, -46, 0, -6, -1, 12, -22, -11, -15, -3, -13, -51, -13,
+    -20, -15, 22, 24, -17, -46, 15, -43, 38, -7, 21, -26, -51, 46, 13, -56,
+    -49, 32, 15, 16, 15, 3, -37, 10, -19, -10, 2, -18, -21, -17, 36, -5,
+    -9, -61, 7, -17, 21, 11, -11, 10, -23, 19, 24, 28, 15, -24, -44, -9,
+    -30, -6, 17, -26, 36, 6, -12, 11, -50, -22, -50, 19, -22, -56, 32, 29,
+    10, -41, -43, 47, -16, 40, -33, 1, -56, -24, -46, -57, -26, 18, -11, 10,
+    0, 15, 4, 22, 33, -44, 51, 4, 43, -5, 39, -67, -21, 41, -16, 22,
+    34, 40, -29, -62, -1, -41, -24, -37, -3, 24, -46, 1, 23, -1, 12, -39,
+    -5, 20, 37, -5, 16, -3, 13, 6, 38, 16, 30, -20, 49, -31, -42, -45,
+    17, 12, -9, 17, -82, -72, -77, -42, -49, -8, -8, 1, 5, -17, -2, -52,
+    -40, -17, 32, -27, -2, 6, -12, -11, -39, 12, 34, -30, -14, -47, 10, -47,
+    -5, 20, -13, 3, -79, -81, -11, -7, 12, -58, -30, -45, -63, 12, -5, 2,
+    41, 5, 32, -33, -46, 42, -3, 22, -49, 15, 9, -1, 38, 25, -39, 14,
+    -12, -52, -61, 19, 32, -11, -17, -5, 7, 7, 25, -48, -10, 15, 14, 16,
+};
+
+static const int32_t TEST_MODEL_fc_dense_0_bias[16] __attribute__((aligned(4))) = {
+    -17, -15, -15, -20, -9, -22, -11, -13, -20, -2, -21, -8, -10, -13, -5, -78,
+};
+
+static const int8_t TEST_MODEL_fc_dense_1_blocks[256] __attribute__((aligned(4))) = {
+    62, 26, -22, 28, 32, 73, 27, -95, -26, -66, -98, -57, -20, 61, 12, 47,
+    -70, -127, 28, 50, 84, -94, -73, -72, -82, -107, 75, 97, -63, -32, -20, 26,
+    -34, 23, 66, -103, 69, -4, 34, 14, -7, 89, -75, 84, -54, -11, 72, -48,
+    56, -103, 66, 72, -101, 69, 68, 54, 49, -58, -43, 48, -52, 13, -7, -11,
+    -25, 32, -69, -97, -37, -38, 82, -97, -68, -84, -41, -84, 20, 60, 97, -64,
+    111, -45, 85, -64, 69, -80, -52, -3, 24, -46, 88, 59, 30, 12, -41, -50,
+    81, -37, 67, -22, 42, 25, 93, 98, 94, -60, 12, 0, -33, -95, -59, 11,
+    77, 66, -95, -69, -51, 14, 50, -19, -85, 23, -1, 108, 78, -95, -68, 100,
+    27, 17, -73, 44, 53, -4, -34, -99, 42, 9, 13, -109, 30, 54, -32, 60,
+    73, 1, -77, -60, 0, 62, -18, -39, -44, -83, -58, 52, -15, -60, 108, -46,
+    -46, -14, 80, -58, -90, -11, -4, -88, 62, -17, 47, 1, 2, -94, 31, 44,
+    -53, -69, 76, -104, -45, -111, 49, 91, -35, -16, 3, -49, 53, 81, -13, -13,
+    32, 10, -90, 61, 57, -99, -110, 52, 29, 37, -46, -11, -92, 87, 102, -20,
+    -60, 93, -18, -52, 91, 84, 55, -30, -53, -31, 80, 53, 1, -99, -28, 0,
+    -105, -57, -49, -65, 51, 94, 94, 94, 13, 64, -35, -5, -27, -9, 50, 10,
+    17, 68, -19, -21, 37, 88, 86, 70, -101, -85, 0, 69, 45, -35, 22, -76,
+};
+
+static const int32_t TEST_MODEL_fc_dense_1_bias[16] __attribute__((aligned(4))) = {
+    -25, 91, 55, -4, -1, -22, -8, 2, -5, 96, -21, 0, -6, 0, -31, -17,
+};
+
+static const int8_t TEST_MODEL_fc_dense_2_blocks[160] __attribute__((aligned(4))) = {
+    -35, 51, -63, -79, -65, 78, 28, -91, -86, -69, -59, 18, -27, -90, -37, -20,
+    -16, -89, -42, -42, -49, 61, -8, 9, -14, 45, 28, -77, 48, 52, 37, -60,
+    -51, -19, 4, -44, 25, -20, 15, 25, -21, 23, -73, -17, 20, 36, 52, -49,
+    5, -63, 92, 75, 26, -40, -52, -30, -69, -2, 94, -7, -16, 82, 44, 6,
+    27, -45, 54, -81, -5, -17, -63, 60, -30, -78, 24, 7, -83, -12, 59, -35,
+    -85, -34, -4, 31, 19, -26, -18, 51, -39, 2, 108, -12, 51, -57, -54, -74,
+    -70, 25, -7, -53, 2, 16, -56, -35, -11, -2, -52, -21, 32, 92, 47, -12,
+    66, -50, 83, -46, -62, -60, -38, -36, 38, -79, -127, 58, -76, 52, 74, 17,
+    -23, 3, 80, -56, -84, -39, -95, -15, 69, 55, 64, -39, 31, -2, -85, 61,
+    -67, -100, -96, 85, 23, -59, 18, 23, 14, 71, -79, -26, -7, -69, -91, -6,
+};
+
+static const int32_t TEST_MODEL_fc_dense_2_bias[10] __attribute__((aligned(4))) = {
+    -159, -220, -55, 88, -105, 133, -64, -170, 265, -74,
+};
+
+static const ml_fc_s8_layer_t TEST_MODEL_fc_dense_layers[3] = {
+    {16, 784, 8, 3136, NULL, NULL, TEST_MODEL_fc_dense_0_blocks, TEST_MODEL_fc_dense_0_bias, 128, -128, 2118029030, -10, NULL, NULL, -128, 127},
+    {16, 16, 8, 64, NULL, NULL, TEST_MODEL_fc_dense_1_blocks, TEST_MODEL_fc_dense_1_bias, 128, -128, 1568967610, -6, NULL, NULL, -128, 127},
+    {10, 16, 8, 40, NULL, NULL, TEST_MODEL_fc_dense_2_blocks, TEST_MODEL_fc_dense_2_bias, 128, 48, 1192445541, -7, NULL, NULL, -128, 127},
+};
+
+const ml_fc_s8_model_t TEST_MODEL_fc_dense = {3, TEST_MODEL_fc_dense_layers, 784, 13128};
+
+static const int8_t TEST_MODEL_fc_sparse_0_blocks[6272] __attribute__((aligned(4))) = {
+    -43, -52, 13, -54, -55, -28, -59, 22, -4, 34, 18, -47, 45, 38, 10, -39,
+    -46, -18, -28, 54, 27, 27, -28, -17, -44, -26, 24, 31, 25, -54, -44, -11,
+    7, -7, -25, 27, 2, 35, 21, 30, -6, 37, 1, -35, 22, -34, 14, -73,
+    -67, -11, -30, -12, 16, 68, 6, -5, 38, 9, 39, -12, -45, -39, -3, -7,
+    -28, -60, 7, -26, -32, -49, -31, -23, 32, 32, 29, -4, 13, -46, -23, 30,
+    -34, -18, 34, -21, -56, -45, -51, 21, -34, 47, -5, -9, -24, -29, -30, -29,
+    40, -44, -29, -37, 39, -47, -65, 32, 10, -58, -31, 7, 31, 48, -15, 11,
+    -48, -38, -14, -4, -5, -20, -8, 35, 23, -66, -7, -36, 26, 3, 17, -31,
+    9, 17, -32, 22, 24, -3, 18, 39, 56, -49, 41, 36, -44, -1, -61, -49,
+    -14, 38, -34, -17, 49, 16, 6, 35, -51, 32, 30, 47, 38, -50, 35, -8,
+    -35, -6, 9, -27, 9, -30, -18, 45, 3, 30, 0, 9, -35, -46, -8, 11,
+    45, -42, 0, -14, 13, -23, 12, -10, 8, -29, 34, -2, -21, 46, 5, -5,
+    -42, -36, -36, 38, -40, -42, 15, -46, -44, -62, -50, -2, 13, 26, 41, 15,
+    -16, -5, -7, -3, -21, -53, -38, -50, 45, -16, 20, 36, -8, 9, -26, 21,
+    -1, -29, 13, -12, -37, -6, -3, -15, -54, -21, 32, -33, 3, -64, 8, 20,
+    25, 4, -27, 30, 27, -46, 42, -6, 11, -20, 21, -53, 4, -41, 18, -30,
+    34, 34, 21, 5, 5, 33, 41, 40, 37, 19, 22, 38, 12, 5, -46, -39,
+    10, -8, -44, -39, -54, -6, 47, -41, 31, -46, 2, -17, 41, -39, -33, -38,
+    -32, -9, 38, -37, 0, 29, -52, -68, -11, 38, -13, -31, 49, 5, 48, 19,
+    46, -41, -46, -7, -17, 25, -15, -34, -34, -13, -21, 32, 14, -22, -3, -13,
+    -11, -19, 47, 27, -48, 1, 11, -39, -66, -3, 7, 47, -27, 28, -46, -14,
+    13, -18, -18, 4, -5, -52, 41, -37, 5, -31, -51, -4, 11, 16, 19, 28,
+    -36, -58, -18, 39, -44, -11, -40, -37, -6, -10, 0, 24, 6, 7, -15, 38,
+    -53, 54, -45, 9, 43, -15, 16, 25, 24, -35, 8, -43, -24, 13, -9, -16,
+    -8, -25, 4, 20, -60, -50, 29, -44, 15, 32, 11, 7, 32, 49, -16, 3,
+    -54, 1, 19, -42, -33, 29, -5, -48, 14, 8, -43, 52, -8, 9, -16, -24,
+    -28, 26, -26, -64, -3, 27, 29, -26, 20, -6, -23, 1, 32, -22, 27, -14,
+    14, -8, -69, 6, -8, 45, 32, -27, 48, 53, -37, -41, 0, 7, -30, -46,
+    -1, -22, -38, 28, -2, -20, -20, -8, -34, -23, -1, 53, -35, -3, 47, 10,
+    29, -17, 0, -25, -41, -25, 21, 32, -53, 7, -23, 29, 13, -8, -11, 39,
+    25, 20, 34, -7, 32, -28, 15, 20, 17, 14, -62, 15, -8, -41, 8, 12,
+    49, -31, -9, 18, 28, -27, 41, 22, 39, 29, -69, -29, -47, -49, 6, 21,
+    -53, -36, 0, -15, 8, -36, 4, 9, -80, 10, 7, 25, 15, 28, -13, -3,
+    -47, 2, -27, -18, 14, -52, 16, 8, 37, -60, -16, -49, -33, 23, -23, -54,
+    43, -30, 40, -32, 23, 22, 14, -5, -11, 15, -6, 2, -40, -58, -32, -61,
+    -5, -6, -23, 32, -46, 30, -22, 15, 4, 5, 20, -26, 15, -20, 21, -5,
+    3, -69, -15, 3, -24, -41, -22, 17, 40, -12, 52, 58, 86, 42, -58, -33,
+    -29, 47, 70, 2, 32, 1, 14, 9, 10, -15, -49, -60, -12, -1, -3, -17,
+    7, -25, 15, -16, -9, 23, 29, -4, 4, -35, -7, 34, 6, 10, -56, -84,
+    -21, -23, -13, -10, 1, 32, -23, -2, 27, 3, -13, 43, 38, 31, -13, 12,
+    -46, -47, -11, -77, -73, -15, 19, 7, 45, 40, 39, 53, 44, -40, 38, 20,
+    7, -39, 61, -5, -74, -5, -84, 18, 14, -9, -12, -10, 14, 21, -32, -38,
+    -23, 30, -30, 16, 33, -14, 9, 11, -42, 16, -24, 18, -13, 49, -15, 29,
+    -6, -19, -29, 9, 46, 9, -17, -45, -30, 33, 54, -17, -36, -29, -16, -5,
+    0, -25, -17, -19, -31, -45, 13, 29, -62, 17, 31, 38, -6, 31, 43, 41,
+    40, 4, 24, -14, -10, -12, -11, -40, 34, -2, 13, 3, 10, -9, -1, 29,
+    29, 6, -13, -22, 51, -10, -13, -10, -7, 29, -26, -41, -44, -6, 18, 42,
+    -31, 46, -32, -27, 19, -16, 31, -34, -55, -44, 31, 46, -29, -27, 38, 14,
+    15, 38, 44, 28, -23, 24, -62, 43, 43, -60, 12, 8, 20, -36, -53, 13,
+    -13, -44, 7, -51, 25, -28, -18, 6, -53, 10, 16, -49, 0, 12, -40, -2,
+    -4, -80, 18, 28, 8, -24, 25, 21, 39, 26, 19, 21, -25, 15, 18, 54,
+    26, -13, 2, -28, -63, -44, -31, -23, -17, -32, 9, 0, -32, 7, 32, 33,
+    32, -34, -21, -10, -33, -46, 1, -40, -56, 34, -20, -22, 38, -6, 52, 45,
+    18, 4, 23, -19, 25, 15, -27, -44, -3, -62, -38, -51, -27, 1, -32, -3,
+    -30, 22, 13, 25, -23, -30, 15, 5, 8, -33, 20, 2, 6, -4, -48, -24,
+    -13, -28, 15, 14, 4, -2, -2, -46, -40, -10, 10, -27, -42, -3, -27, 1,
+    -39, -52, -5, -31, -25, 12, 26, -9, -38, -1, -16, -41, 35, -32, 17, 20,
+    2, 36, 5, -29, 24, 21, -35, -12, 32, 24, -2, 32, 7, -37, -22, 12,
+    -13, -19, -48, 19, 8, 21, 26, 41, -60, 25, -77, -46, -20, -34, -11, -41,
+    -38, -15, 2, -43, 26, 34, -1, 39, -7, -9, 12, 10, -16, 2, 46, -12,
+    38, -41, 3, -18, -70, 0, 50, -48, 10, -11, 18, 46, -7, 25, 43, 56,
+    -19, -16, -29, 12, 10, -30, 23, 5, 23, -15, -20, -44, 34, -12, 0, 42,
+    -2, 44, 28, -20, 3, 25, 23, -43, 43, 58, 17, 41, 60, 21, 42, -45,
+    32, 45, -38, 31, 23, -22, 49, 5, -8, -18, -22, 38, -5, -14, -13, 15,
+    44, 17, -35, 44, -29, 30, 19, -27, 16, -23, 5, -11, -20, 59, -13, 16,
+    43, -23, 22, 40, 19, -11, -44, -24, 53, 26, -31, 0, 16, 30, -32, -31,
+    11, 34, -11, -18, 23, 10, 25, -15, -7, -41, 21, 13, 34, -64, -26, -16,
+    -23, -75, 9, -27, -46, -21, 39, -23, 2, -64, 32, -2, -35, -18, -35, 54,
+    9, 28, 16, -11, -96, 17, 5, -35, -2, -19, 22, -7, 27, 29, 0, -76,
+    -42, 27, -13, 27, -18, -2, 16, -59, -29, -50, 5, -11, 41, 35, 21, -26,
+    9, -10, 34, -27, 34, 3, -31, -17, -1, -22, 12, -22, -7, -34, -39, -33,
+    -43, 16, -59, -28, -34, 25, -60, 4, 61, -4, -17, 11, 12, -39, 45, -43,
+    -25, 9, -24, 0, -21, 8, 33, -37, -33, -23, 12, 8, 0, 18, -28, -4,
+    25, -28, -23, 40, -45, -31, -43, -34, 19, -8, -57, -41, 30, -48, -61, 0,
+    -49, -24, 0, -15, -46, -11, -17, -27, 7, -34, -45, -19, 4, -50, -16, 5,
+    11, -42, -55, 39, 5, 17, -54, 18, -35, -56, -51, -20, 4, -23, 21, 15,
+    22, 38, 33, -29, 34, 37, -13, 24, 38, 30, 22, 19, 12, -57, 30, 9,
+    16, 17, 26, 8, 24, -9, -16, -41, -26, 9, -33, -49, 22, -19, -17, 7,
+    36, 10, -25, 2, -16, -62, -16, -56, -15, 5, 23, 13, 0, 41, -26, 13,
+    22, -21, 0, -52, -58, -27, 11, 35, -8, -61, 1, 4, -3, -7, -6, 16,
+    40, 35, -51, 7, -48, 7, 33, 14, -47, -18, 22, -30, -42, -2, -8, -6,
+    -50, -45, 11, 26, 2, -11, 3, -30, -16, -5, 5, 28, -45, -52, 8, -46,
+    23, -58, -63, -3, -14, -35, -10, 3, -45, -21, 47, 11, 34, 40, 33, -22,
+    -29, -12, -31, -39, 25, -10, 32, 30, -16, -36, -20, -26, 27, 41, -22, -35,
+    -20, -11, -62, -18, -7, 28, -58, -65, 25, 27, 22, -34, 40, -15, -18, 45,
+    -38, -20, -10, -50, -32, -22, 25, 11, -27, -54, -64, 18, 29, -15, -27, 36,
+    -12, -53, -38, 44, 38, -25, -14, -41, 3, 17, -25, 8, 20, 23, 28, 19,
+    20, -6, 4, -17, 40, -18, -55, -36, -29, 9, -11, -9, -33, -23, -37, -25,
+    30, 24, 4, -24, -23, -10, -33, -30, 23, -31, 32, -42, 35, 4, -20, -42,
+    -55, 4, 40, 35, -29, -18, 28, 8, -22, -32, -50, -41, -20, -50, -55, 14,
+    34, 16, 36, 44, -8, -58, -22, -6, 10, -22, 19, -45, -43, 22, 0, -8,
+    29, 39, -1, -8, 14, -33, 35, -38, 18, 1, 19, 19, 28, 2, -36, -51,
+    -19, -52, 9, -9, -58, 13, -48, -53, 3, -53, 20, -22, 44, 8, 25, 16,
+    0, -2, 10, -31, -13, 17, 18, -55, 33, -29, -53, -41, -11, -22, -33, -39,
+    42, 14, -50, 17, 32, -48, 22, -37, 7, 14, 12, 18, -46, -53, 8, -3,
+    31, -36, -28, 11, -56, -50, -32, -33, -31, -56, 20, -57, 43, -13, -14, -37,
+    1, 1, 13, -6, -50, 38, 3, -24, -48, 0, -9, 22, 7, -45, -55, -54,
+    41, -26, -39, 5, 2, 14, -16, 20, -12, -19, -47, -57, 30, -25, -40, 0,
+    -12, -41, 46, -26, 21, -30, -35, -43, 46, -21, 35, -32, 10, 27, -55, -24,
+    -3, 34, -42, -30, -42, 27, 33, 4, -4, -55, -13, 44, 14, -35, -9, 24,
+    0, -31, 16, -21, 2, -35, -1, -30, -33, 33, -2, 13, -38, -10, -14, 10,
+    4, 22, -10, -36, -11, -23, -8, 10, -19, 19, 16, 9, -46, 3, 28, -44,
+    -24, -54, 33, 5, -26, 27, -19, 20, -48, 19, -3, -60, 9, -38, 15, -52,
+    -35, -47, 14, -26, -17, 31, -26, 30, -12, -59, 40, 8, 6, 26, -18, -3,
+    -56, 10, -2, 4, 9, -1, 44, 37, 15, 8, -26, 2, -60, 44, -9, -49,
+    -2, -23, 27, 21, -50, -16, 35, -12, -18, -29, 4, 13, 30, 12, -1, -16,
+    -35, -19, 31, -13, 23, -57, -22, -21, 41, 17, -35, -6, 44, -24, -23, 18,
+    30, -23, 9, -43, 0, 31, 23, 20, -51, 2, 45, -29, 45, -37, -33, -45,
+    -35, -33, 21, -33, -55, -6, -22, 27, -46, -36, -26, 33, -10, 14, -40, 47,
+    48, 16, -19, -4, 14, 14, -44, 19, -41, 17, -2, -23, -5, -3, 20, 19,
+    -41, 13, -25, -31, 31, 24, -14, 42, 32, -25, -21, -4, 26, 6, 21, 30,
+    -51, -16, -1, -14, -7, 31, -47, -33, -33, -38, -23, -12, -42, -5, 38, -23,
+    4, -15, -10, -30, 20, -34, -35, -36, 13, 5, -3, -36, 32, 37, 34, 35,
+    37, -47, 21, 43, -1, 6, 1, 19, -15, -43, 32, -36, 41, 2, -35, -56,
+    -12, -3, -23, -25, -22, -21, -40, -28, 45, -23, 50, -10, -46, -36, 42, 28,
+    -34, -23, 23, 30, -38, -53, 5, 6, -32, -21, -22, 14, -42, 1, 26, 38,
+    -2, -19, 25, -41, -4, 23, -56, -6, -17, 14, -39, -20, -41, 16, 29, 19,
+    14, -14, -1, 13, 35, -49, -17, 21, 36, -49, -9, 14, 23, -6, 41, 23,
+    36, -3, -36, 41, -2, -7, -12, -1, -22, 0, -11, -32, 35, -17, 34, -27,
+    24, -52, -27, -15, 14, -16, -29, 25, -7, 36, 8, 27, -10, 25, -32, -9,
+    -17, 32, -20, 2, -25, 27, 5, -31, -5, -52, 12, -20, 39, -35, -24, 14,
+    -30, 30, -26, -34, 1, -30, -36, -33, -2, -51, 35, 41, 62, -37, -4, -56,
+    50, 23, -45, -26, -36, -46, 31, 33, -29, 25, 11, 9, -5, 14, 37, 2,
+    -32, 4, -6, 19, -24, 18, -23, -35, 39, 2, -14, 55, 25, 9, -34, 30,
+    -35, 11, -17, 46, 25, -45, -20, -62, -23, 13, 23, 20, -30, -30, -6, -7,
+    10, -34, -35, -13, 15, -23, -6, -6, -29, -38, 25, -12, 9, -47, -59, 12,
+    -16, -39, -52, -4, -42, -29, -48, -33, 41, 29, 61, -10, -33, -34, 10, 25,
+    -37, -23, 9, -22, 36, -80, -26, -24, -57, 36, 8, 29, 35, 0, 0, -19,
+    5, 28, -35, -44, 20, -31, -4, -44, 0, -52, 14, 12, -8, 41, -8, -29,
+    39, 24, 43, 13, 10, -35, -25, 24, 44, -46, 34, -42, -67, -26, -56, -9,
+    -37, 10, -18, 33, 16, -9, -52, 9, -14, -48, 7, -32, -11, 30, 12, -2,
+    35, -22, -8, 21, 55, 0, 3, 39, -54, 27, 33, -10, -8, 32, -37, -59,
+    -34, -51, 12, -55, 32, 2, -2, 9, 21, 19, -10, -13, 50, 5, -32, 12,
+    21, 24, 34, -44, -43, -6, 11, -25, -41, 22, 19, -9, -54, 25, 13, -2,
+    -24, -28, 26, 17, -29, -46, 33, -29, -15, 18, 26, 8, -30, -59, -16, -49,
+    28, -20, 15, -1, 23, 30, -32, -38, 12, 1, -20, -36, 24, -22, 45, -44,
+    -64, -65, 1, -19, -11, 2, 17, 6, -41, 42, -48, -44, -20, -32, -16, -31,
+    -26, 0, -53, -5, -56, -45, -51, -33, -13, -18, -68, -36, -5, 31, 2, 16,
+    41, 52, 29, 5, -37, -22, -45, -37, -60, -8, 6, 2, -31, -25, 37, -43,
+    27, -30, 44, -18, 6, -34, 1, -34, 21, 8, -40, 24, 17, -27, 30, -38,
+    -30, 14, -50, -12, 21, -15, -15, 34, -42, 17, 55, 5, 29, -57, -33, 44,
+    -40, -3, 22, -36, -5, -43, 7, -27, 21, 8, 10, 11, -2, -33, 49, -1,
+    13, -8, -23, -19, 9, -3, -4, 10, -44, 32, -6, 18, 11, -16, 16, 7,
+    -51, -39, 9, -13, 18, 13, 42, 46, 32, -9, 14, 40, -32, 43, 20, -42,
+    -25, 1, -14, -32, -18, -50, 6, 38, -16, -10, 21, -11, 10, -2, -24, 27,
+    -26, -38, 12, -22, 40, 51, -2, -38, -28, 47, -24, -43, -31, 23, -31, -28,
+    32, 42, 32, 52, -49, 16, 34, -9, 34, 18, -49, -1, -34, -40, -37, -20,
+    -46, 1, -12, -48, 46, 45, -27, -48, -24, -11, 34, -4, -8, 17, 4, -18,
+    -12, 9, 21, -12, -18, -17, 19, -9, 23, -19, -22, 38, 2, -53, 10, -19,
+    -20, -20, -17, 35, -20, -42, 47, -24, 33, -35, -53, 1, -44, -12, -11, -4,
+    -51, -46, -48, 21, 46, -5, -13, -23, 16, -45, -15, 26, -11, -7, -9, -16,
+    -27, -51, -3, -15, 41, -19, 39, -51, 2, 19, 26, 19, -23, -41, -12, -4,
+    -2, -49, 14, -55, 8, 28, 36, 1, 5, -24, 27, -19, 45, -2, 42, -30,
+    -2, 7, 7, 33, -16, -1, 28, 11, -10, -28, 1, 0, 18, -37, -27, -20,
+    33, 14, 23, -8, -16, 14, 32, -44, 21, -35, -45, -8, 34, -11, 22, -9,
+    20, -29, 0, 37, 20, 35, -9, -50, 12, 10, -33, -8, -47, -28, -23, 11,
+    -4, -51, -18, -47, 39, 10, -3, -10, 26, 14, 25, -21, -12, -58, -6, -38,
+    -5, 31, -8, -14, 31, -55, 33, 5, 8, 44, -41, -18, 10, -35, 4, -9,
+    6, -31, 33, 18, 4, 29, -38, 33, 6, -37, -1, -48, -39, 7, -1, -28,
+    -25, 8, -42, 14, -39, -30, -7, 30, 28, 22, -18, -14, -22, -1, -32, -49,
+    38, -9, 47, 2, -14, 21, 26, -10, 10, -21, -14, -56, -43, -41, -14, -57,
+    -12, -12, -15, -34, -44, 9, -51, -50, 1, 28, 33, -32, 46, 33, 11, 3,
+    -43, 34, 23, 21, -41, 41, 34, -16, -11, 16, -18, 16, 14, -2, 27, -16,
+    42, -23, -7, -46, -24, 28, 31, -54, 26, -42, 6, 39, -32, 31, -30, 45,
+    -33, -36, -27, -49, -44, 17, -20, 39, -3, -21, -57, -21, 11, 3, -42, 39,
+    -15, 6, -5, 30, -18, 10, -30, -50, 23, 30, -35, 36, -11, -28, -53, -18,
+    -47, -9, 41, -7, 2, 42, 47, -48, -6, 13, -29, -38, -38, 38, 18, 13,
+    20, -33, 17, 16, -48, 39, -8, -42, 48, -36, 18, -25, -16, -20, -35, 31,
+    -23, -15, -20, -41, -51, -32, -45, -37, -1, 40, 50, 26, 43, 20, 15, 36,
+    36, 25, -21, -30, 40, -36, -4, 11, 51, 42, -8, -34, 32, -12, -5, 27,
+    -10, 32, -51, -10, 21, 39, 18, 27, -54, 16, -26, 15, -40, -41, 30, -2,
+    -50, -13, 30, 22, 27, -23, -39, 15, 24, -17, 34, 32, -5, 18, -18, 13,
+    -48, 32, 6, -37, -50, -51, -24, -32, 17, -31, 16, -54, 12, 38, 7, 20,
+    -41, -48, 2, -13, 3, 37, 42, 4, -51, -38, -51, 30, -6, 12, 7, -11,
+    -30, -13, 9, 20, -52, 21, 33, -45, 41, 34, -39, 27, 41, -7, -57, 30,
+    -24, 14, -52, -10, -34, -2, 31, -54, -43, -11, 21, 39, -53, -21, 12, -8,
+    -5, -29, 24, -13, -42, -49, -33, 24, -40, -14, 26, -38, -53, -6, -12, 35,
+    48, -34, 25, -44, -30, 37, 30, 25, -15, 22, 15, -59, -18, -8, -42, 23,
+    2, -35, 43, -29, 55, 17, 26, 33, 23, 25, -37, 8, 29, 37, 14, 6,
+    19, -54, 42, -9, 39, -26, -26, 40, -24, 18, 21, 18, -11, 30, 39, -2,
+    -4, -37, -12, 35, -9, 44, -47, 34, 32, -47, 44, 19, 4, -49, 12, -29,
+    32, -14, -55, -5, 28, -48, -56, -14, 48, -28, -47, 35, 26, -53, -40, -29,
+    51, 29, -10, -29, 40, -38, 14, 21, 19, 27, -17, -47, -21, -62, -8, -8,
+    45, 13, 7, 4, 48, -29, 1, 13, 27, -48, 39, -32, 25, -25, -39, -49,
+    -46, 18, 31, 38, 14, -34, -41, -1, 9, 14, -49, -15, -34, 35, 17, -49,
+    22, -54, -57, 18, 36, -42, 2, 44, 6, 41, -38, -30, -34, 25, -43, -1,
+    27, -16, 36, 9, -16, -42, 43, 15, -54, -25, -48, 33, 19, -15, -43, -2,
+    45, 45, -45, 22, 13, -34, 3, 28, -49, -54, 22, 39, 1, -49, -39, -30,
+    -28, 38, -46, -5, -41, -12, -26, -26, -42, -34, -42, 40, -13, 38, 10, -27,
+    15, 19, -37, -46, 40, -22, -31, -10, 50, 42, -25, -52, -22, -22, 31, 34,
+    -29, -31, 4, 2, -30, -56, -13, -42, 11, -5, -49, -1, 37, -38, 44, 30,
+    -16, 25, 21, 0, 10, -3, 39, 15, -57, -54, 15, 38, -46, 27, -20, -16,
+    -27, 18, 28, -36, -39, -46, -40, -30, -20, 29, -50, -37, -32, -25, -12, -29,
+    -48, -17, 30, -29, 6, -46, -7, 3, 12, 23, -24, 33, 24, -46, -16, 37,
+    -59, -53, 16, 21, 10, -54, 10, 20, -27, 22, 13, 17, 43, -48, 45, -36,
+    30, -54, 35, 40, 7, -25, 20, 17, -45, 19, 29, -31, -13, 1, -54, 4,
+    11, -92, -1, -80, -6, -6, 4, -24, -20, -26, 45, -11, -54, -26, -60, -51,
+    10, -12, -11, 8, 0, -14, -48, -22, -34, 32, -24, 3, 23, -39, -40, 19,
+    -29, -25, -34, 15, -55, -57, -45, -41, 17, 23, -23, -3, -24, -10, -21, -34,
+    -11, -45, -33, -42, -20, 18, -6, -14, -44, 9, -66, 14, -12, -5, -17, 25,
+    -23, 12, -38, -7, 12, -18, -16, -15, -4, -17, -25, -46, -25, 4, 18, -47,
+    10, -21, -23, 22, 19, -1, -20, -54, 23, -25, 17, 17, -40, -15, 9, -57,
+    -9, 65, 7, 20, 45, -38, -51, -49, 12, -57, -60, -34, -50, 28, -50, -31,
+    -68, 4, -8, -2, 27, 23, 3, 22, 31, 13, 26, -13, 7, -40, -32, -12,
+    -33, -14, 35, 59, -57, 3, 5, -35, 12, 63, 12, 15, -43, 4, 15, -29,
+    -12, -48, -22, -2, -42, -25, -6, -52, 4, -68, -27, -54, -30, -11, 32, -2,
+    -21, -14, -11, 8, 34, -17, 9, -61, -45, 1, -44, -35, 10, 5, -4, 17,
+    24, 49, -17, 24, 20, -48, -8, -31, -2, 41, -45, -46, -39, 8, -51, -58,
+    -66, 14, -39, -4, -12, 42, 11, -7, 5, -63, -29, -87, 25, -2, 18, -4,
+    -23, 28, -36, -16, 19, -27, -44, -47, 21, 21, 8, 9, 25, -44, -43, -71,
+    57, -12, -21, -22, 18, -60, -11, -68, -6, -16, 26, 23, 29, 10, 14, 7,
+    -7, -78, 7, -6, -30, -38, -43, -2, -6, 18, -28, 2, -51, 20, -7, -18,
+    34, 24, -5, 11, -49, -7, -15, -6, 9, 27, -20, 25, -10, -22, -5, -28,
+    5, 21, -35, -17, -30, 8, 29, -3, -2, 5, -10, -16, -6, -45, -51, -44,
+    -3, -9, -20, 20, 11, -36, 42, -22, 15, -20, 22, -32, 1, -28, 10, -31,
+    -58, 28, -69, 0, -49, 49, -26, -43, 19, 12, 13, 29, 3, 29, -35, -14,
+    21, 52, 18, -29, -8, -7, -43, 18, 15, 6, -22, -52, 2, -16, 28, -19,
+    1, -23, -12, 34, 19, -27, -30, -64, -49, 12, 35, -30, -23, -34, 5, 34,
+    14, 52, -32, -25, 25, 39, -41, 21, -5, 8, -19, 10, -53, -29, 6, -33,
+    -17, -5, 68, 21, 34, -30, -36, -47, 58, 55, -20, -7, -9, -23, 29, 31,
+    69, 26, -1, -41, -17, -40, -39, -68, -25, 11, 31, 23, 36, 34, 22, 1,
+    22, 20, 50, 6, 28, 22, -57, 19, 32, -21, 4, 32, 20, -4, 23, -38,
+    45, 29, -33, 22, -26, 5, -14, 5, 62, 21, -30, -24, 7, 18, -9, -14,
+    -37, 29, 32, -4, -19, 17, 11, 15, 21, -3, 18, 26, 14, -32, 5, 25,
+    0, 15, 9, 8, 19, -8, 14, 43, -14, -34, 40, 35, -9, -8, -50, 20,
+    12, -10, 39, 15, 17, -6, -52, 12, -48, -34, 23, -19, 51, -4, -15, -20,
+    2, 2, -21, -6, -34, -18, -61, -37, -51, -54, 18, 5, -28, -12, -53, -9,
+    0, 12, 8, 49, 46, 10, 8, -15, -56, -56, -26, -53, -68, -5, -13, -69,
+    -46, -44, -4, -75, 39, -29, 8, -24, -20, -33, 20, -49, -3, -65, 18, -20,
+    -89, -43, -63, -62, -87, -12, -60, -46, -42, -14, -24, -43, 38, -11, -8, -76,
+    -20, -53, -48, -76, -30, 0, -41, -60, -19, -4, -10, -15, 2, 5, 5, -36,
+    20, -31, -39, -13, -12, -5, -57, 15, -25, -40, -1, 20, -21, 27, -32, -60,
+    -6, -54, 4, 34, -1, -59, -29, 20, -3, 39, -18, 16, 17, -22, -14, 10,
+    13, -10, 24, 17, 7, 14, -6, 6, -52, -33, 18, -51, -11, 38, -1, -26,
+    19, -29, 21, 5, -18, 40, 45, -14, -57, -35, 24, 16, -22, 14, -59, -26,
+    57, -14, 10, 46, 31, 39, -31, 44, 30, -26, 43, -38, 39, 4, 27, -45,
+    19, 11, 38, 41, 55, -6, -9, 17, 27, -26, 15, 27, -16, 37, 38, 40,
+    -26, -29, -43, 56, -2, -13, 17, 58, -13, -26, 26, -15, -18, 35, -20, 50,
+    -10, -31, -20, -18, 20, -10, 27, -47, 30, 46, -36, -4, -30, 52, -25, 25,
+    -14, 24, 48, -31, 35, 31, 23, -27, -26, 49, -8, 20, 24, -1, 40, 46,
+    -9, 53, 46, -23, 29, 19, -13, -11, 28, 1, 8, 20, 48, 18, -37, -10,
+    -22, 76, 16, 83, 30, -44, 7, 20, 16, 15, 10, -21, -43, -50, -17, -46,
+    -34, -47, 12, 4, -4, -19, 20, -44, -14, -30, 2, 5, -21, 11, 22, -42,
+    33, 39, 7, 17, -68, -35, 15, 20, -22, 2, -3, -18, 6, -15, -23, 15,
+    -30, -67, 10, 32, -33, 7, -47, -13, -16, 9, 68, 18, 1, 5, 10, -27,
+    15, 0, -7, 10, 0, 19, -17, 22, 42, -53, 40, -19, -15, -46, -1, 13,
+    -37, -46, -50, -12, -51, -60, 30, 4, -50, -59, -7, -30, -50, -23, -41, 10,
+    -22, -22, 4, -37, -41, 29, -13, -11, -26, -3, -3, -58, -63, 20, -44, 3,
+    34, -22, -41, 0, 22, 14, -42, -50, 5, -20, 18, 9, -14, 3, -43, 8,
+    -12, 22, 3, -12, -1, -12, -31, -47, -42, 1, -2, 41, -33, -41, -34, 14,
+    -35, -48, -2, -25, -30, -58, -18, -82, 10, 23, -14, 43, -25, -2, -18, 9,
+    -14, -49, 44, -50, -22, -39, -17, -23, 16, -28, -16, -45, -51, -44, -73, 7,
+    7, 24, 34, 36, -14, 4, -49, 2, 19, -6, -18, -22, -1, -6, 4, 42,
+    2, -51, 19, -34, 5, -59, 29, -14, 0, -39, 6, -58, 26, 38, -12, 30,
+    5, -44, 35, -14, -36, 30, 11, -18, 21, -37, -6, 28, 37, 10, -26, 19,
+    7, -2, -33, 56, -59, 15, 22, 66, 6, 62, 47, -17, -14, -31, 30, 35,
+    4, -26, -10, 16, -25, -16, 49, 27, -51, 4, -75, 9, -34, -21, -21, 48,
+    32, 21, -27, 10, -32, -21, 29, -46, 13, 1, 16, 8, 18, 21, -9, 4,
+    -5, 2, 49, -26, 42, 37, 39, 78, 64, 33, -33, 8, 21, 2, -28, -16,
+    39, 23, 2, 32, -74, 15, 4, -15, 34, -9, -15, 12, -11, 42, 29, -20,
+    -46, -15, 35, -27, 49, 29, -25, 23, -41, -23, 6, 2, 37, 56, 9, -11,
+    -17, -28, -1, 18, 27, -12, -35, 35, -51, -20, -18, -31, -12, 11, 10, -50,
+    -11, -25, 21, 16, -14, 0, 51, 18, -25, 28, -15, 27, -41, 26, -15, 5,
+    5, -30, 28, -46, 0, -11, 37, 52, 21, -7, 47, 11, 50, -2, 3, 8,
+    30, 2, -16, 34, 47, -61, -46, -25, -44, 29, -4, 27, 15, 26, 8, 20,
+    30, 4, -48, 9, -12, -46, -20, -52, 18, -4, 35, -44, -5, 24, -26, -3,
+    -14, -54, 13, -19, -3, -21, 43, 56, -58, -29, 24, -17, -46, -72, 3, 8,
+    -31, -72, 7, -25, 2, 12, -44, -15, -52, -24, -20, -85, -8, -21, 9, -40,
+    12, -56, -82, 16, -38, 3, -48, 26, -22, -40, 48, 37, -36, -49, 41, -41,
+    -18, -35, -28, 41, -44, -21, 22, 27, 20, -28, -46, 10, 27, -22, -25, -32,
+    32, 30, -15, 33, -56, 44, -40, -37, -2, -49, 47, -25, -5, 50, 44, 31,
+    45, -1, -13, 29, 20, -8, 27, 11, -48, 1, -30, 43, 38, 42, 15, -32,
+    18, 34, -22, -26, 40, -15, 40, 6, 13, -37, -34, -54, 43, -46, 45, -33,
+    16, -56, -46, -34, 29, -14, -9, -41, 14, 29, -4, -38, -56, -37, 14, -18,
+    40, 6, 20, 13, -13, 0, -40, 26, 51, 34, -15, 17, -45, 10, -47, -37,
+    -26, 37, 31, -6, -49, -22, -52, 31, -30, -22, 33, 0, 42, -17, -15, 12,
+    28, -28, -35, 40, 31, -38, -30, -8, -23, 31, -1, 4, -16, -5, 16, -35,
+    -14, 3, 22, 42, -27, -38, -30, 34, 22, -18, -49, -3, -29, -25, -10, -42,
+    -11, 15, 33, 22, -32, 34, -11, 17, 5, -36, 31, -34, -23, 17, -6, -49,
+    -53, -7, 23, 1, 38, -28, -24, -21, 15, -26, -32, -40, -17, 16, -34, 10,
+    1, 44, -26, -3, 41, 45, 9, -40, 32, 8, -39, 30, 40, 33, -9, 2,
+    -33, 4, -53, 13, -30, -38, 23, -38, 45, -31, -14, 1, 34, 27, -55, -19,
+    -18, 33, 3, -47, 8, 6, -41, 20, 47, -39, 33, 34, 6, 1, -43, -9,
+    38, 25, -45, -34, 11, 43, -52, -5, 35, 35, -1, -24, 23, -49, -32, -9,
+    -40, -11, -42, -40, -17, -2, 38, -49, -43, 9, -56, 35, -37, -7, -19, -8,
+    8, -39, 20, -47, 6, -30, -51, 3, 35, -31, -36, -2, -23, 22, 27, -30,
+    -36, -56, -38, 24, -14, 5, 25, -43, -42, -36, -6, 39, -16, 22, -19, -25,
+    1, -22, 42, 34, -46, -35, -27, 30, -58, 17, 27, -29, -43, -54, 26, -28,
+    -4, -51, -47, 37, -19, -16, -16, -36, -19, -37, 45, -25, -38, -20, 28, -3,
+    -13, -7, 23, 22, -2, 13, 29, 20, -47, 40, 13, 31, -8, 20, -5, -9,
+    -15, -26, 23, -6, 23, -49, 36, 27, 32, 18, 41, 32, 23, 44, 24, -42,
+    33, -6, -44, -13, 25, -4, 45, -44, 9, 29, 23, -24, 32, -55, -45, -27,
+    -40, -28, -53, 8, 21, -44, 2, -13, -12, 0, -34, -4, 1, -51, 14, 10,
+    33, 6, -54, 44, -63, -40, -47, 17, -5, 10, -67, 64, -74, 7, -24, -28,
+    9, -15, -34, -11, -67, -10, 13, -20, -37, 9, -42, -23, -41, -25, -27, -25,
+    -42, -39, 0, -44, 17, 4, 4, 24, 4, -9, -38, -27, 36, -11, -15, 66,
+    -12, -13, 22, -3, 2, -39, -16, 6, -23, -35, 9, 29, -39, -10, -23, 11,
+    -16, 36, -6, -31, 34, 31, 37, -20, 6, -15, -14, -11, -4, -40, -22, 10,
+    -15, -26, 40, 10, -28, 7, 21, -4, -1, -23, 21, -15, 5, -26, -6, -29,
+    23, 20, -31, -36, -43, -36, -39, 43, 25, 25, -33, 7, -18, -12, -36, -51,
+    -54, 16, -28, -20, 25, 6, 16, 25, -5, 36, 5, -13, -18, -3, 11, -28,
+    47, 39, 0, 34, -22, -27, 38, -41, 31, 31, -1, -1, 3, 2, 54, 3,
+    40, -6, -39, -26, -7, -8, 45, 49, 10, -3, -48, 43, 72, -4, -12, 72,
+    37, -19, 39, -3, -18, 24, -10, 25, 11, 73, 1, -18, 42, 22, -21, 18,
+    8, 39, 32, -12, 16, 45, -9, -20, -24, -3, -12, 42, 5, -2, 45, -4,
+    22, -54, -40, -59, -20, 21, -29, 8, -22, -8, -18, 32, 17, 0, 13, 34,
+    13, 13, -3, 55, 23, -3, -16, -64, -71, -19, -68, -5, 18, -26, 29, 48,
+    37, 17, 48, -8, -28, -38, -29, 37, 16, 51, 53, -35, -5, 22, 6, -16,
+    -51, 11, 10, 30, 0, 8, -45, -21, 63, -22, -27, 48, -4, 38, 50, -33,
+    -34, -41, -3, -48, -32, -52, -15, 40, 7, 1, 54, -3, -2, -28, 18, 37,
+    19, -34, -23, 33, 29, 23, -12, -62, -28, -14, -57, 15, 38, 14, -34, -21,
+    -37, 21, -4, -2, 40, -16, -59, -28, -27, 13, -54, -15, 38, 26, -21, -64,
+    -24, -41, -25, 6, -1, -8, -8, -26, -12, 15, -36, 14, -14, -10, -33, -28,
+    37, -24, 18, -63, -22, 5, -54, -47, -26, -20, -34, -24, 5, -29, -11, -74,
+    16, -7, -19, 22, 6, -67, -18, -44, 26, 0, 4, -44, -2, 12, 23, -14,
+    17, -36, -15, 5, 20, 11, 26, 37, 3, 10, -1, -57, -36, 23, -32, -1,
+    -1, -14, -27, -40, -21, -47, 4, -53, -11, -45, 16, -31, -4, -20, 20, -1,
+    -62, -28, -3, 11, -65, -14, -2, 30, -28, 34, 1, -39, 12, -48, -62, 20,
+    -44, -47, 2, -16, -11, 12, 13, 23, 26, 39, -29, 29, 28, -43, -14, -66,
+    -16, 52, -20, 15, -47, -33, 39, 3, 50, 18, -19, 18, 4, -40, 37, -36,
+    28, -20, -21, -25, -35, 16, 15, -37, 43, 41, 23, 34, 22, 24, 19, -27,
+    26, -28, 38, -18, 41, 34, -46, 11, -4, 22, 32, -6, 30, -21, -41, 27,
+    -30, 11, 21, -21, 3, 35, -21, -6, 6, -23, -2, 36, -4, 36, -2, 49,
+    -3, 5, 8, 39, -27, 21, 17, 15, 13, -32, 1, 30, -36, -8, 14, -38,
+    37, 31, -24, 54, 35, 30, -32, -48, -25, -16, -3, -13, 24, -8, -15, -17,
+    16, 40, 21, -26, 4, -22, 16, 5, 6, 55, -13, -41, 31, -45, -19, -22,
+    -15, 42, 42, 6, -31, -38, -3, -8, 10, -17, 2, -5, -24, 51, -17, -51,
+    -44, 1, 24, 20, 23, 15, 7, -44, -22, 14, -37, -1, -3, -50, -92, -60,
+    -6, 6, 12, 14, 24, 9, -28, 30, -6, 1, -9, 41, 2, -49, -3, -45,
+    -60, -22, 1, 17, 12, -34, 12, 32, -11, -16, 45, 20, 6, 32, 17, -48,
+    16, 10, -13, 24, -34, 15, -51, -64, 30, 32, -46, 23, 27, 9, 30, -6,
+    26, 3, 10, -2, 1, -26, -32, 36, 22, 25, 11, 35, 52, -23, -45, 28,
+    -46, -48, -51, -57, -46, 9, -55, 22, -11, 4, 1, -46, -43, 15, -3, -25,
+    -11, -30, -18, -23, -10, -21, -5, -61, -21, 14, -46, -26, -30, -3, 46, 15,
+    -15, -3, 45, -5, -16, -18, 12, -35, 33, 14, -20, 6, -24, -72, -101, -58,
+    -50, -48, -27, -2, -7, -18, -19, 37, -27, -30, -1, -5, -11, -15, -37, -1,
+    -42, -68, -63, -44, -39, -61, -44, -37, 28, 15, -13, -23, 51, -22, 24, -5,
+    22, 6, 41, 36, 9, 13, 31, -15, 4, 23, -59, -40, -19, 47, 0, 18,
+    8, 9, 34, 23, 33, -14, 64, 20, -12, 3, -24, 10, 3, 41, 8, -3,
+    -21, 28, -37, -23, 7, 16, 36, -19, 47, -39, -31, 27, 54, 27, 41, 37,
+    19, -18, 16, 37, -37, -26, 20, -23, 25, 1, 23, 20, -34, -5, 38, 30,
+    -22, 4, 6, -28, -3, 28, -6, -31, 47, 13, 19, -48, -23, 43, 8, -25,
+    39, 63, -17, 31, 19, 7, 40, -27, 15, -54, 26, 10, -24, -14, 34, 18,
+    -33, 7, 31, 5, 35, -44, -31, -27, -42, -20, 35, 24, -20, 8, 14, 1,
+    -45, 1, 17, -17, -47, 42, 24, -26, -24, 26, 10, -52, 0, -21, -7, -41,
+    -36, -37, 14, -15, 23, -36, 39, -4, -27, -5, 25, 28, 17, -1, -27, -37,
+    12, 3, -7, -2, -37, 5, 4, -20, 31, 20, 25, 60, 13, 1, 26, -3,
+    20, 2, -22, -45, 58, 13, -37, -23, 13, 15, -11, 45, 63, 14, -10, 27,
+    -11, 4, 33, 36, 11, 48, 31, -11, 4, 14, 43, 9, 21, 15, 16, -3,
+    30, 53, 8, 3, 3, 0, 42, 33, -39, 33, 41, 19, 12, 29, 7, 29,
+    -28, -3, 20, 6, 4, 16, 22, 24, -40, -24, 21, 27, -23, 15, -11, 27,
+    74, 39, -16, -6, 4, 0, 23, 5, 52, -18, 34, -3, -12, 0, 26, 15,
+    13, 3, -26, 12, -9, -2, 44, 21, 25, 5, -61, 7, -3, -6, -54, 23,
+    -40, 0, 1, -4, -34, -35, -17, -38, -11, 5, 10, -61, 5, -5, -70, 28,
+    -32, 47, -6, -4, 44, -11, 7, -10, -35, -11, -91, 14, -31, -21, -47, 13,
+    32, 14, -39, -7, 29, 43, -2, -2, -13, -30, -26, -28, -69, -8, -34, -35,
+    18, -10, -15, 30, -28, 32, 13, -38, -17, 29, 0, -51, 11, 5, -17, -19,
+    -61, -4, -12, 6, 40, 7, 24, -12, 26, -27, 16, -9, 36, -45, -15, -25,
+    -61, 5, -18, -77, -4, -38, -24, 22, 40, 4, 19, -22, 8, -30, 20, -29,
+    27, 1, 31, 28, 18, -10, 26, -53, -21, -34, 33, 27, -54, -31, 34, 33,
+    -2, 11, -12, 28, 24, -45, 26, 11, -5, -28, -24, -30, 32, -14, 6, 20,
+    -11, -2, -29, -19, -42, -54, -75, -46, 25, -56, 13, -7, 27, -22, -47, -35,
+    -1, -22, 2, -4, -33, 8, -12, 33, -8, -6, -26, -21, -53, -2, -21, 26,
+    29, -5, -27, 12, 6, -28, 63, 11, 16, -26, -12, -34, -42, -58, 9, 32,
+    26, -40, -66, -42, -44, -32, -24, 6, -6, -22, 25, -14, -19, -55, -53, -20,
+    -28, 37, -2, 3, 14, -1, -65, 27, 22, 23, 36, -29, -55, -38, 22, 27,
+    -55, -25, -5, -49, -41, -6, -8, 23, 40, -34, -3, 10, -39, 35, 23, 1,
+    -33, 1, -20, -14, 1, -31, -11, 17, 11, 22, -6, -51, -32, -20, -25, -45,
+    19, 32, -43, -30, 37, -23, 23, -93, -7, -22, -37, 37, -16, -5, 11, 26,
+    -30, 28, 23, -41, -29, 8, 14, 12, 72, -31, 30, -12, 12, -13, -19, 8,
+    -33, -37, -10, 15, -40, 14, -13, -37, 2, -33, 41, -34, -11, -32, -17, -27,
+    11, 19, -45, -28, -2, -2, 16, 0, -5, 26, 0, 14, 18, -13, 30, -24,
+    20, -25, 45, -12, 21, 8, -26, -33, -16, -18, 2, 0, 32, 18, -7, -13,
+    -81, 34, 20, 56, -6, 48, -24, -9, -27, -2, 1, -4, -59, 0, -35, 32,
+    13, 17, 32, -53, 37, -59, -6, 14, 13, -24, 61, 56, 37, -49, 6, -50,
+    21, 19, -23, 12, -40, 33, 39, -38, 14, 20, -46, -41, -3, 55, 10, -41,
+    41, -45, -12, 56, -1, 8, 4, 8, 70, -15, 9, -35, -3, 10, 21, 16,
+    -19, 29, 19, -3, -29, 35, -6, 14, 5, 30, -18, 37, -12, -16, 46, -8,
+    10, -19, 23, 46, 7, -39, 16, -15, 55, -3, 19, -9, 39, -21, 1, -21,
+    -7, -24, -49, 9, -26, 29, -18, 11, -26, 11, -55, -13, -9, 55, 37, -6,
+    58, -48, -18, 0, -19, 0, -40, -24, -5, 14, 37, -76, -57, -35, -11, 8,
+    -17, -20, 10, -16, 30, 4, -30, -3, -5, 28, 31, 25, -29, -40, -64, -10,
+    17, -39, 0, 37, 26, 33, 29, -14, 7, -36, -29, -40, 23, -55, -48, 33,
+    -12, -71, -54, 36, 2, 52, 23, 3, 10, -4, -6, -52, 27, 0, 18, 21,
+    -55, -56, -5, 17, -18, -93, -33, -38, 32, -6, -21, 41, 7, -4, 5, -9,
+    -30, -21, -53, 25, -7, 38, -14, -61, -23, -45, -58, -8, 32, 53, 14, 28,
+    27, -1, -48, -4, 22, -19, 7, -43, 37, -35, -5, -7, 12, -22, -11, -15,
+    -3, -13, -51, -13, -20, -15, 22, 24, -17, -46, 15, -43, -49, 32, 15, 16,
+    15, 3, -37, 10, -19, -10, 2, -18, -21, -17, 36, -5, 15, -24, -44, -9,
+    -30, -6, 17, -26, 36, 6, -12, 11, -50, -22, -50, 19, -56, -24, -46, -57,
+    -26, 18, -11, 10, 0, 15, 4, 22, 33, -44, 51, 4, -1, -41, -24, -37,
+    -3, 24, -46, 1, 23, -1, 12, -39, -5, 20, 37, -5, -82, -72, -77, -42,
+};
+
+static const uint16_t TEST_MODEL_fc_sparse_0_row_ptr[17] __attribute__((aligned(4))) = {
+    0, 102, 195, 293, 391, 487, 586, 681, 780, 878, 976, 1074, 1173, 1275, 1375, 1471,
+    1568,
+};
+
+static const uint8_t TEST_MODEL_fc_sparse_0_col_block[1568] __attribute__((aligned(4))) = {
+    24, 25, 30, 31, 32, 33, 37, 38, 39, 40, 44, 45, 46, 47, 50, 51,
+    52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67, 68, 71, 72, 73,
+    74, 75, 78, 79, 80, 81, 82, 85, 86, 87, 88, 89, 92, 93, 94, 95,
+    96, 99, 100, 101, 102, 103, 106, 107, 108, 109, 110, 113, 114, 115, 116, 117,
+    120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134, 135, 136, 137, 138, 141,
+    142, 143, 144, 145, 148, 149, 150, 151, 152, 155, 156, 157, 158, 162, 163, 164,
+    165, 169, 170, 171, 172, 178, 31, 32, 33, 38, 39, 40, 44, 45, 46, 47,
+    50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67, 68, 71,
+    72, 73, 74, 75, 78, 79, 80, 81, 82, 85, 86, 87, 88, 89, 92, 93,
+    94, 95, 96, 97, 99, 100, 101, 102, 103, 106, 107, 108, 109, 110, 113, 114,
+    115, 116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134, 135, 136,
+    137, 138, 141, 142, 143, 144, 145, 148, 149, 150, 151, 155, 156, 157, 162, 163,
+    164, 169, 170, 25, 31, 32, 33, 37, 38, 39, 40, 43, 44, 45, 46, 47,
+    51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67, 68, 71, 72,
+    73, 74, 75, 78, 79, 80, 81, 82, 85, 86, 87, 88, 89, 93, 94, 95,
+    96, 97, 99, 100, 101, 102, 103, 106, 107, 108, 109, 110, 113, 114, 115, 116,
+    117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134, 135, 136, 137, 138,
+    141, 142, 143, 144, 145, 148, 149, 150, 151, 152, 155, 156, 157, 158, 162, 163,
+    164, 165, 170, 171, 172, 25, 31, 32, 33, 37, 38, 39, 40, 44, 45, 46,
+    47, 50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67, 68,
+    71, 72, 73, 74, 75, 78, 79, 80, 81, 82, 85, 86, 87, 88, 89, 92,
+    93, 94, 95, 96, 99, 100, 101, 102, 103, 106, 107, 108, 109, 110, 113, 114,
+    115, 116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134, 135, 136,
+    137, 138, 141, 142, 143, 144, 145, 148, 149, 150, 151, 155, 156, 157, 158, 162,
+    163, 164, 165, 170, 171, 172, 179, 31, 32, 33, 37, 38, 39, 40, 44, 45,
+    46, 47, 50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67,
+    68, 71, 72, 73, 74, 75, 78, 79, 80, 81, 85, 86, 87, 88, 89, 92,
+    93, 94, 95, 96, 99, 100, 101, 102, 103, 106, 107, 108, 109, 110, 113, 114,
+    115, 116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134, 135, 136,
+    137, 138, 141, 142, 143, 144, 145, 148, 149, 150, 151, 152, 155, 156, 157, 158,
+    162, 163, 164, 165, 170, 171, 172, 24, 31, 32, 37, 38, 39, 40, 44, 45,
+    46, 47, 50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67,
+    68, 71, 72, 73, 74, 75, 78, 79, 80, 81, 82, 85, 86, 87, 88, 89,
+    92, 93, 94, 95, 96, 99, 100, 101, 102, 103, 106, 107, 108, 109, 110, 113,
+    114, 115, 116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134, 135,
+    136, 137, 138, 141, 142, 143, 144, 145, 148, 149, 150, 151, 152, 155, 156, 157,
+    158, 162, 163, 164, 165, 170, 171, 172, 178, 179, 31, 32, 37, 38, 39, 40,
+    44, 45, 46, 47, 50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65,
+    66, 67, 68, 71, 72, 73, 74, 75, 78, 79, 80, 81, 82, 85, 86, 87,
+    88, 89, 92, 93, 94, 95, 96, 99, 100, 101, 102, 103, 106, 107, 108, 109,
+    110, 113, 114, 115, 116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131,
+    134, 135, 136, 137, 138, 142, 143, 144, 145, 148, 149, 150, 151, 155, 156, 157,
+    158, 159, 162, 163, 164, 165, 169, 170, 171, 30, 31, 32, 33, 37, 38, 39,
+    40, 44, 45, 46, 47, 50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64,
+    65, 66, 67, 68, 71, 72, 73, 74, 75, 78, 79, 80, 81, 82, 85, 86,
+    87, 88, 89, 92, 93, 94, 95, 96, 99, 100, 101, 102, 103, 106, 107, 108,
+    109, 110, 113, 114, 115, 116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130,
+    131, 134, 135, 136, 137, 138, 141, 142, 143, 144, 145, 148, 149, 150, 151, 155,
+    156, 157, 158, 162, 163, 164, 165, 169, 170, 171, 172, 178, 30, 31, 32, 33,
+    37, 38, 39, 40, 44, 45, 46, 47, 50, 51, 52, 53, 54, 57, 58, 59,
+    61, 64, 65, 66, 67, 68, 71, 72, 73, 74, 75, 78, 79, 80, 81, 82,
+    85, 86, 87, 88, 89, 92, 93, 94, 95, 96, 99, 100, 101, 102, 103, 106,
+    107, 108, 109, 110, 113, 114, 115, 116, 117, 120, 121, 122, 123, 124, 127, 128,
+    129, 130, 131, 134, 135, 136, 137, 138, 141, 142, 143, 144, 145, 148, 149, 150,
+    151, 155, 156, 157, 158, 162, 163, 164, 165, 169, 170, 171, 172, 179, 24, 31,
+    32, 33, 37, 38, 39, 40, 44, 45, 46, 47, 50, 51, 52, 53, 54, 57,
+    58, 59, 60, 61, 64, 65, 66, 67, 68, 71, 72, 73, 74, 75, 78, 79,
+    80, 81, 82, 85, 86, 87, 88, 89, 92, 93, 94, 95, 96, 99, 100, 101,
+    102, 103, 106, 107, 108, 109, 110, 113, 114, 115, 116, 117, 120, 121, 122, 123,
+    124, 127, 128, 129, 130, 131, 134, 135, 136, 137, 138, 141, 142, 143, 144, 145,
+    148, 149, 150, 151, 152, 155, 156, 157, 158, 162, 163, 164, 165, 170, 171, 172,
+    30, 31, 32, 37, 38, 39, 40, 44, 45, 46, 47, 50, 51, 52, 53, 54,
+    57, 58, 59, 60, 61, 64, 65, 66, 67, 68, 71, 72, 73, 74, 75, 78,
+    79, 80, 81, 85, 86, 87, 88, 89, 92, 93, 94, 95, 96, 99, 100, 101,
+    102, 103, 104, 106, 107, 108, 109, 110, 113, 114, 115, 116, 117, 120, 121, 122,
+    123, 124, 127, 128, 129, 130, 131, 134, 135, 136, 137, 138, 141, 142, 143, 144,
+    145, 148, 149, 150, 151, 155, 156, 157, 158, 162, 163, 164, 165, 170, 171, 172,
+    178, 179, 24, 30, 31, 32, 33, 37, 38, 39, 40, 43, 44, 45, 46, 47,
+    50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67, 68, 71,
+    72, 73, 74, 75, 78, 79, 80, 81, 82, 85, 86, 87, 88, 89, 92, 93,
+    94, 95, 96, 99, 100, 101, 102, 103, 106, 107, 108, 109, 110, 113, 114, 115,
+    116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134, 135, 136, 137,
+    138, 141, 142, 143, 144, 145, 148, 149, 150, 151, 155, 156, 157, 158, 162, 163,
+    164, 165, 170, 171, 172, 25, 30, 31, 32, 33, 37, 38, 39, 40, 44, 45,
+    46, 47, 50, 51, 52, 53, 54, 57, 58, 59, 60, 61, 64, 65, 66, 67,
+    68, 71, 72, 73, 74, 75, 78, 79, 80, 81, 82, 85, 86, 87, 88, 89,
+    92, 93, 94, 95, 96, 99, 100, 101, 102, 103, 104, 106, 107, 108, 109, 110,
+    113, 114, 115, 116, 117, 120, 121, 122, 123, 124, 127, 128, 129, 130, 131, 134,
+    135, 136, 137, 138, 141, 142, 143, 144, 145, 148, 149, 150, 151, 152, 155, 156,
+    157, 158, 162, 163, 164, 165, 169, 170, 171, 172, 178, 25, 31, 32, 33, 37,
+    38, 39, 43, 44, 45, 46, 47, 50, 51, 52, 53, 54, 57, 58, 59, 60,
+    61, 64, 65, 66, 67, 68, 71, 72, 73, 74, 75, 78, 79, 80, 81, 82,
+    85, 86, 87, 88, 89, 92, 93, 94, 95, 96, 99, 100, 101, 102, 103, 104,
+    106, 107, 108, 109, 110, 113, 114, 115, 116, 117, 120, 121, 122, 123, 124, 127,
+    128, 129, 130, 131, 134, 135, 136, 137, 138, 141, 142, 143, 144, 145, 148, 149,
+    150, 151, 152, 155, 156, 157, 158, 162, 163, 164, 165, 170, 171, 178, 179, 31,
+    32, 33, 37, 38, 39, 40, 44, 45, 46, 47, 50, 51, 52, 53, 54, 57,
+    58, 59, 60, 61, 64, 65, 66, 67, 68, 71, 72, 73, 74, 75, 78, 79,
+    80, 81, 82, 85, 86, 87, 88, 89, 92, 93, 94, 95, 96, 99, 100, 101,
+    102, 103, 106, 107, 108, 109, 110, 113, 114, 115, 116, 117, 120, 121, 122, 123,
+    124, 127, 128, 129, 130, 131, 134, 135, 136, 137, 138, 141, 142, 143, 144, 145,
+    148, 149, 150, 151, 152, 155, 156, 157, 158, 162, 163, 164, 165, 171, 172, 30,
+    31, 33, 37, 38, 39, 40, 44, 45, 46, 47, 50, 51, 52, 53, 54, 57,
+    58, 59, 60, 61, 62, 65, 66, 67, 68, 71, 72, 73, 74, 75, 78, 79,
+    80, 81, 82, 85, 86, 87, 88, 89, 92, 93, 94, 95, 96, 99, 100, 101,
+    102, 103, 106, 107, 108, 109, 110, 113, 114, 115, 116, 117, 120, 121, 122, 123,
+    124, 127, 128, 129, 130, 131, 134, 135, 136, 137, 138, 142, 143, 144, 145, 148,
+    149, 150, 151, 155, 156, 157, 158, 162, 163, 164, 165, 169, 170, 171, 172, 177,
+};
+
+static const int8_t TEST_MODEL_fc_sparse_1_blocks[256] __attribute__((aligned(4))) = {
+    62, 26, -22, 28, 32, 73, 27, -95, -26, -66, -98, -57, -20, 61, 12, 47,
+    -70, -127, 28, 50, 84, -94, -73, -72, -82, -107, 75, 97, -63, -32, -20, 26,
+    -34, 23, 66, -103, 69, -4, 34, 14, -7, 89, -75, 84, -54, -11, 72, -48,
+    56, -103, 66, 72, -101, 69, 68, 54, 49, -58, -43, 48, -52, 13, -7, -11,
+    -25, 32, -69, -97, -37, -38, 82, -97, -68, -84, -41, -84, 20, 60, 97, -64,
+    111, -45, 85, -64, 69, -80, -52, -3, 24, -46, 88, 59, 30, 12, -41, -50,
+    81, -37, 67, -22, 42, 25, 93, 98, 94, -60, 12, 0, -33, -95, -59, 11,
+    77, 66, -95, -69, -51, 14, 50, -19, -85, 23, -1, 108, 78, -95, -68, 100,
+    27, 17, -73, 44, 53, -4, -34, -99, 42, 9, 13, -109, 30, 54, -32, 60,
+    73, 1, -77, -60, 0, 62, -18, -39, -44, -83, -58, 52, -15, -60, 108, -46,
+    -46, -14, 80, -58, -90, -11, -4, -88, 62, -17, 47, 1, 2, -94, 31, 44,
+    -53, -69, 76, -104, -45, -111, 49, 91, -35, -16, 3, -49, 53, 81, -13, -13,
+    32, 10, -90, 61, 57, -99, -110, 52, 29, 37, -46, -11, -92, 87, 102, -20,
+    -60, 93, -18, -52, 91, 84, 55, -30, -53, -31, 80, 53, 1, -99, -28, 0,
+    -105, -57, -49, -65, 51, 94, 94, 94, 13, 64, -35, -5, -27, -9, 50, 10,
+    17, 68, -19, -21, 37, 88, 86, 70, -101, -85, 0, 69, 45, -35, 22, -76,
+};
+
+static const uint16_t TEST_MODEL_fc_sparse_1_row_ptr[17] __attribute__((aligned(4))) = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+    64,
+};
+
+static const uint8_t TEST_MODEL_fc_sparse_1_col_block[64] __attribute__((aligned(4))) = {
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+};
+
+static const int8_t TEST_MODEL_fc_sparse_2_blocks[160] __attribute__((aligned(4))) = {
+    -35, 51, -63, -79, -65, 78, 28, -91, -86, -69, -59, 18, -27, -90, -37, -20,
+    -16, -89, -42, -42, -49, 61, -8, 9, -14, 45, 28, -77, 48, 52, 37, -60,
+    -51, -19, 4, -44, 25, -20, 15, 25, -21, 23, -73, -17, 20, 36, 52, -49,
+    5, -63, 92, 75, 26, -40, -52, -30, -69, -2, 94, -7, -16, 82, 44, 6,
+    27, -45, 54, -81, -5, -17, -63, 60, -30, -78, 24, 7, -83, -12, 59, -35,
+    -85, -34, -4, 31, 19, -26, -18, 51, -39, 2, 108, -12, 51, -57, -54, -74,
+    -70, 25, -7, -53, 2, 16, -56, -35, -11, -2, -52, -21, 32, 92, 47, -12,
+    66, -50, 83, -46, -62, -60, -38, -36, 38, -79, -127, 58, -76, 52, 74, 17,
+    -23, 3, 80, -56, -84, -39, -95, -15, 69, 55, 64, -39, 31, -2, -85, 61,
+    -67, -100, -96, 85, 23, -59, 18, 23, 14, 71, -79, -26, -7, -69, -91, -6,
+};
+
+static const uint16_t TEST_MODEL_fc_sparse_2_row_ptr[11] __attribute__((aligned(4))) = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40,
+};
+
+static const uint8_t TEST_MODEL_fc_sparse_2_col_block[40] __attribute__((aligned(4))) = {
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3,
+};
+
+static const ml_fc_s8_layer_t TEST_MODEL_fc_sparse_layers[3] = {
+    {16, 784, 8, 1568, TEST_MODEL_fc_sparse_0_row_ptr, TEST_MODEL_fc_sparse_0_col_block, TEST_MODEL_fc_sparse_0_blocks, TEST_MODEL_fc_dense_0_bias, 128, -128, 2118029030, -10, NULL, NULL, -128, 127},
+    {16, 16, 8, 64, TEST_MODEL_fc_sparse_1_row_ptr, TEST_MODEL_fc_sparse_1_col_block, TEST_MODEL_fc_sparse_1_blocks, TEST_MODEL_fc_dense_1_bias, 128, -128, 1568967610, -6, NULL, NULL, -128, 127},
+    {10, 16, 8, 40, TEST_MODEL_fc_sparse_2_row_ptr, TEST_MODEL_fc_sparse_2_col_block, TEST_MODEL_fc_sparse_2_blocks, TEST_MODEL_fc_dense_2_bias, 128, 48, 1192445541, -7, NULL, NULL, -128, 127},
+};
+
+const ml_fc_s8_model_t TEST_MODEL_fc_sparse = {3, TEST_MODEL_fc_sparse_layers, 784, 8618};
+
+static const int8_t TEST_MODEL_fc_perchannel_0_blocks[12544] __attribute__((aligned(4))) = {
+    -80, -18, 79, 56, 38, -70, -62, -45, 69, 76, -35, -34, 57, 64, 9, 1,
+    -66, 9, -33, -22, 88, -82, 3, -69, 66, 51, -15, -2, 65, -23, 22, 65,
+    -23, -45, 49, 20, 3, -34, -70, -79, -54, -48, 56, -60, 80, -73, -28, -44,
+    25, 9, 84, -83, 70, -68, 66, 8, -83, -43, -38, 49, -78, 34, -27, 73,
+    85, -13, -34, 65, -97, 2, 51, -53, -54, -68, 83, -48, 18, -75, 1, 49,
+    11, 70, -75, -6, 38, -90, 71, -69, 38, 47, -64, 65, -94, -81, 35, -86,
+    -75, -91, 22, -94, -96, -49, -103, 38, -12, -71, -69, 14, -39, -47, -15, 80,
+    -22, 82, 11, 57, -86, 58, 41, -15, -7, 60, 31, -82, 79, 66, 18, -68,
+    -80, -32, -49, 95, 47, 47, -49, -29, -37, -53, 76, -58, 21, -11, 78, -35,
+    51, -44, -11, 75, -77, -45, 42, 55, 44, -95, -77, -20, 12, -12, -44, 48,
+    3, 61, 36, 52, -23, -40, -68, -76, -11, -73, 21, -41, 35, -8, 32, -66,
+    -10, 65, 1, -60, 39, -60, 24, -127, -117, -20, -53, -20, 28, 119, 11, -9,
+    -40, -58, -24, 28, -78, 77, -39, -83, 67, 16, 69, -21, -78, -69, -6, -12,
+    -48, -106, 12, -45, -56, -85, -54, -40, 57, 56, 51, -7, -12, -37, -84, -64,
+    -53, 82, -23, 65, 22, -81, -41, 52, -60, -31, 60, -36, -97, -78, -88, 37,
+    -60, 82, -9, -15, -43, -51, -52, -50, -90, -72, -10, -8, 71, 26, -37, -68,
+    70, -76, -51, -65, 69, -81, -113, 56, 18, -102, -54, 12, 54, 83, -26, 20,
+    -85, -67, -25, -7, 32, 28, 11, -83, 56, -61, -79, -3, -9, -35, -15, 62,
+    40, -115, -12, -62, 45, 5, 29, -54, 16, 29, -56, 39, 42, -5, 32, 69,
+    42, 80, 63, -83, -27, 37, -60, -41, 98, -86, 71, 62, -76, -1, -106, -86,
+    -25, 67, -59, -30, 85, 29, 10, 61, -90, 55, 52, 82, 29, 24, 43, -37,
+    -36, -74, 32, 40, 66, -87, 62, -15, -62, -11, 16, -48, 15, -53, -32, 79,
+    6, 52, 1, 16, -62, -81, -13, 20, -59, -46, 34, -81, -40, -28, -23, -22,
+    78, -73, 1, -24, 23, -40, 21, -18, 14, -51, 59, -3, -36, 80, 9, -9,
+    -73, -63, -63, 67, 15, 49, -83, -81, 82, 35, -73, 17, -70, -73, 26, -81,
+    -76, -108, -88, -3, 22, 46, 72, 26, -29, -8, -12, -6, -37, -92, -67, -88,
+    -7, -25, 20, -19, -84, 12, -54, -87, 78, -28, 35, 62, -15, 16, -45, 36,
+    -2, -51, 23, -21, -64, -10, -6, -27, -94, -37, 56, -58, -34, -68, -42, -88,
+    -68, 47, -52, -69, 5, -112, 13, 35, 44, 7, -47, 52, 47, -80, 73, -11,
+    19, -35, 37, -93, 8, -71, 32, -52, 10, -11, 52, -33, -72, 37, -75, -80,
+    59, 59, 36, 8, 10, 58, 72, 71, 65, 33, 38, 67, 22, 9, -80, -68,
+    17, -15, -76, -69, 47, 15, -22, 70, 85, -51, -60, -88, -95, -10, 82, -71,
+    54, -80, 3, -29, 71, -67, -58, -67, -56, -16, 66, -65, -1, 51, -92, -119,
+    -52, -88, -45, 65, -67, -23, -1, -7, -20, 67, -24, -54, 85, 8, 85, 33,
+    81, -72, -81, -12, -29, 44, -27, -59, -60, -22, -37, 57, 14, 70, -24, 25,
+    53, 13, -67, -17, 24, -39, -5, -22, -19, -33, 82, 47, -84, 2, 19, -68,
+    -116, -4, 13, 82, -48, 49, -80, -25, 75, 36, -79, -18, 63, -20, -23, -78,
+    23, -32, -32, 7, -9, -91, 71, -65, 9, -54, -88, -6, 19, 27, 33, 50,
+    -63, -101, -31, 68, -24, 27, -91, -88, 15, 64, 43, 18, -77, -19, -70, -65,
+    -11, -17, 1, 43, 11, 12, -27, 67, -92, 95, -78, 16, -17, -73, 48, 85,
+    -87, -27, -46, -51, 54, 79, -60, 13, 75, -26, 28, 44, 42, -61, 15, -76,
+    -43, 23, -16, -28, -14, -44, 6, 35, -3, 98, -65, -48, -63, 80, 14, 65,
+    69, -2, -43, -36, -105, -88, 51, -77, 26, 55, 19, 13, 56, 85, -27, 5,
+    -94, 2, 33, -73, 63, -76, 27, -38, -47, 83, -15, 2, -11, 0, -64, 26,
+    23, 48, 69, -82, -53, -52, -31, -71, -59, 51, -9, -84, -16, 74, -27, -48,
+    -75, 14, 31, 19, 25, 10, 47, -80, 31, -49, 22, 52, 8, 45, -49, 35,
+    -64, 52, -54, -47, 59, -39, -73, 31, -65, -26, 20, 48, -30, 33, -78, 56,
+    -79, 27, 47, 83, -60, 17, -23, 72, 34, 69, -9, -46, 90, 32, -24, -29,
+    84, -33, -34, -59, -70, -80, -65, 48, 39, 1, -44, 33, 51, 41, -5, -30,
+    50, -68, -59, 58, 72, -11, 44, 31, 31, -35, 38, -60, -16, -21, 30, 38,
+    -72, -25, -15, -40, 31, 18, -9, 39, -41, 60, 3, -31, 67, 57, -16, 1,
+    27, -30, 63, 47, -10, 53, -56, 62, -2, 36, 45, 10, 65, 32, -47, 61,
+    -56, 12, -16, 25, -1, 60, -69, -8, 14, -5, -65, -13, 39, 72, -52, 17,
+    82, -14, -60, 6, -75, -34, 19, -74, 26, -43, -59, 21, -23, 48, 32, -28,
+    22, -42, -69, -10, -42, 9, 19, 17, 34, 80, -42, -32, -66, 23, -27, -79,
+    -127, -11, -43, -6, 14, -18, -38, -68, 2, -3, 5, -21, -64, 17, -19, -7,
+    31, 38, 62, 25, 1, -53, -38, 16, -23, 18, 27, 4, 19, 11, -61, 74,
+    -12, 13, -23, -34, -41, 38, -37, -92, -87, -20, 43, -68, -28, 44, -73, -73,
+    -42, -62, 0, -107, -81, 1, -10, -5, -5, 39, 42, -37, 29, -9, -33, 2,
+    46, -31, 39, -21, 12, -50, 78, -30, -61, 33, -20, 0, 73, -31, -6, 34,
+    20, -11, -99, 9, -11, 65, 45, -39, 69, 76, -53, -59, 0, 9, -43, -65,
+    18, -17, -29, 37, 21, -67, -36, -9, -1, -31, -54, 40, -4, -28, -28, -12,
+    -49, -33, -1, 76, -50, -4, 68, 14, 42, -25, 0, -36, 23, -120, -40, -42,
+    -24, 5, 7, -72, -59, -36, 30, 46, -75, 10, -33, 42, 19, -11, -15, 57,
+    36, 29, 49, -10, 46, -41, 22, 29, -68, -25, -105, 53, -19, 67, 69, -73,
+    25, 20, -89, 22, -12, -59, 12, 17, 70, -45, -13, 26, 40, -39, 59, 32,
+    56, 42, -99, -42, -30, -23, -105, 37, 26, 52, 8, 14, -68, -70, 9, 30,
+    -75, -52, 0, -21, 11, -51, 5, 13, -114, 14, 10, 36, 22, 41, -18, -4,
+    13, -35, -108, 2, -70, -13, 7, 10, -67, 3, -38, -26, 20, -74, 24, 12,
+    53, -86, -23, -70, -47, 33, -33, -78, 61, -43, 58, -46, -58, 12, -10, -67,
+    -16, -8, 65, -22, 33, 31, 21, -7, -16, 22, -9, 4, -57, -83, -46, -88,
+    -7, -8, -33, 46, -66, 43, -32, 21, 96, -64, 5, 42, -49, 69, 54, 2,
+    6, 7, 28, -37, 22, -29, 31, -7, 4, -99, -22, 5, -34, -59, -31, 24,
+    58, -17, 75, 83, 124, 60, -83, -47, -18, -57, -14, -68, -41, 67, 100, 3,
+    46, 2, 20, 13, 14, -21, -70, -87, -17, -2, -4, -24, 11, -36, 22, -23,
+    -16, 19, 44, 24, 0, 59, 27, 47, -14, 34, 42, -6, 6, -50, -10, 49,
+    9, 15, -80, -120, -30, -33, -18, -15, 2, 46, -33, -2, 52, 31, -36, -31,
+    -3, -38, 12, -49, 38, 4, -19, 62, 54, 45, -18, 17, -65, -67, -15, -110,
+    -105, -22, 28, 9, 64, 57, 56, 75, 45, -15, 52, -31, -68, -24, -46, -43,
+    63, -58, 55, 29, 10, -56, 88, -8, -106, -7, -120, 25, 20, -13, -17, -15,
+    19, 30, -46, -54, -43, -26, 73, 13, -62, -73, -27, -30, -33, 43, -43, 23,
+    47, -19, 13, 16, -60, 24, -34, 26, -18, 70, -21, 41, -9, -28, -42, 13,
+    -68, 24, 32, 77, 37, -35, -5, 7, 65, 13, -24, -64, -43, 47, 77, -25,
+    -52, -42, -23, -7, 0, -36, -24, -28, -45, -64, 18, 41, -100, 56, -5, -5,
+    -15, -56, -33, -33, -89, 24, 44, 54, -9, 44, 61, 58, 57, 5, 35, -20,
+    -14, -17, -15, -57, 49, -3, 18, 4, -41, 31, -55, 26, -37, 36, -47, 7,
+    14, -13, -1, 42, 41, 9, -19, -31, 73, -14, -19, -14, -10, 42, -37, -59,
+    -3, 18, -42, -27, 14, -17, -67, -36, -34, 58, 62, -59, -63, -8, 26, 60,
+    -45, 66, -46, -39, 28, -23, 44, -49, -3, 1, 0, -30, 11, -62, -27, -20,
+    -65, 8, -8, 31, 63, 30, -37, -59, -78, -63, 44, 66, -42, -39, 55, 20,
+    22, 55, 63, 41, 2, -8, -6, -2, 10, 43, 7, 31, -77, -68, 32, -6,
+    17, 68, -28, 6, -33, 34, -89, 62, 61, -86, 17, 12, -11, -11, -15, 11,
+    -6, -4, 27, 21, -90, 23, 2, -95, -49, -58, 33, 33, 3, 2, -34, 37,
+    -53, 64, 18, -20, 20, -77, -29, -47, -42, -32, -35, -12, 10, -69, 5, -62,
+    25, -56, -63, -64, -53, -38, 30, -48, 6, 58, 55, -11, -41, -68, -12, -69,
+    -24, 32, -75, 15, -56, -76, -79, -44, 73, 18, 78, -5, -83, -79, -87, -12,
+    -25, -46, 43, -5, 4, 24, -28, -30, 3, 59, 12, -59, 1, 58, 40, 64,
+    12, -33, -53, 18, 38, 48, 24, -70, -2, 13, -42, 28, 73, -56, 55, -9,
+    22, -26, 43, -12, -22, -36, -34, 21, -22, 55, 25, 60, -65, -36, 43, -32,
+    -45, 45, 34, -4, 52, -15, -68, 36, 34, 42, 7, 32, 47, 49, -6, -9,
+    -9, 43, -71, 43, -65, -47, -18, 17, -61, -4, -21, -42, -41, 42, -40, 21,
+    -25, -64, 60, 55, -22, 25, -19, 29, 59, -47, 51, 48, 28, -15, 29, 52,
+    -81, -19, -61, -29, -24, -32, 47, -46, -35, -42, 37, -42, -65, -14, -41, -14,
+    20, -46, -61, -48, -50, 27, -11, -15, -50, 12, -55, -1, -69, -69, -97, -30,
+    -77, 2, -96, -12, 26, -48, -71, 18, -35, 69, 1, -19, 1, 1, -43, -44,
+    32, 67, -9, 1, -15, 22, -21, -63, 13, -53, 10, -16, -18, -59, 9, -68,
+    34, -37, -24, 8, -70, 14, 21, -66, 20, -25, 35, -5, -17, -46, -13, -42,
+    35, -8, 41, -52, 0, 16, -53, -3, -6, -106, 24, 37, 11, -32, 33, 28,
+    52, 34, 25, 28, 40, -65, -36, 13, 27, -8, -4, 61, -33, 20, 25, 72,
+    34, -17, 3, -37, -84, -59, -41, -31, -23, -43, 12, 0, -42, 9, 42, 44,
+    -38, -23, 32, 60, -31, -57, 21, 8, -43, 12, -34, 10, 43, -45, -28, -13,
+    -43, -62, 2, -53, -75, 45, -26, -30, 50, -8, 70, 59, -39, -32, -41, 39,
+    46, 35, -35, 33, 24, 6, 30, -26, 34, 20, -36, -58, -4, -82, -50, -67,
+    -36, 1, -43, -3, -40, 29, 17, 33, 15, 23, -60, -8, -14, 1, 10, -55,
+    -30, -40, 20, 6, 10, -44, 27, 3, 9, -6, -63, -32, -17, -37, 20, 19,
+    5, -2, -3, -61, -7, -14, -31, -17, 51, 79, 58, -100, -54, -13, 14, -35,
+    -56, -4, -36, 1, -52, -69, -6, -41, -33, 16, 34, -11, -50, -1, -21, -54,
+    -19, 75, -7, -49, 32, 17, 52, -68, 46, -43, 22, 26, 2, 48, 7, -38,
+    31, 28, -47, -16, 43, 32, -3, 42, 9, -49, -29, 16, 79, -13, 79, 43,
+    54, -21, 64, -94, -18, -25, -64, 26, 11, 28, 35, 54, -80, 33, -102, -62,
+    -27, -45, -15, -55, -51, -20, 3, -58, 47, -35, 85, 28, 29, -46, -29, 21,
+    52, -17, -5, 8, 34, 45, -1, 52, -9, -13, 16, 13, -22, 2, 61, -16,
+    50, -55, 4, -24, -93, 0, 66, -63, -15, -88, 24, 24, 14, -15, 24, 62,
+    -10, 33, 57, 75, -25, -21, -39, 16, 13, -40, 31, 7, 30, -21, -27, -59,
+    -40, 76, 31, -31, 46, -46, -14, 69, 45, -16, 0, 55, -3, 58, 38, -26,
+    4, 34, 31, -57, 57, 77, 23, 54, 79, 28, 55, -59, -55, 92, 19, -11,
+    23, 35, -7, 17, 43, 60, -50, 42, 30, -29, 66, 7, -11, -24, -29, 51,
+    -7, -18, -17, 20, 58, 23, -46, 59, 45, -12, 34, 28, -57, -67, 55, -22,
+    -38, 39, 25, -37, 21, -30, 7, -15, -27, 79, -18, 21, 57, -30, 29, 53,
+    25, -15, -58, -32, -31, 13, 50, -57, -20, -60, -31, -49, 70, 34, -41, 1,
+    21, 40, -42, -41, 15, 46, -15, -24, 31, 14, 33, -20, -9, -54, 28, 17,
+    -54, 22, -72, 12, -46, 24, 44, 26, 45, -85, -34, -21, -31, -100, 12, -36,
+    -61, -28, 52, -30, 3, -85, 43, -2, -47, -24, -47, 72, 27, -56, 27, -39,
+    63, -4, -36, -23, 12, 37, 21, -14, -127, 23, 7, -46, -3, -26, 29, -10,
+    36, 38, 0, -101, -56, 36, -17, 36, 47, -22, 73, -32, -9, 13, -26, -32,
+    -24, -3, 21, -78, -38, -67, 6, -15, 54, 47, 28, -34, 12, -13, 45, -36,
+    46, 3, -41, -23, -47, 67, 23, -14, -58, 51, 45, -81, -1, -30, 16, -29,
+    -10, -45, -52, -43, -57, 22, -79, -38, -45, 34, -80, 5, 43, 18, -25, 21,
+    -16, 40, -65, 52, -62, -3, -8, 28, 81, -5, -23, 15, 16, -52, 59, -57,
+    -34, 12, -31, 0, -28, 11, 44, -49, -2, 30, 96, 37, -26, 1, -51, 28,
+    -29, -61, 67, 38, -36, -1, 10, -35, -44, -30, 16, 11, 1, 24, -37, -6,
+    33, -37, -31, 53, -20, -21, 56, 10, -53, -35, 33, 39, -2, 56, 37, 52,
+    -29, -1, 5, 20, -19, 29, 38, 10, 5, -7, -99, -56, -25, -22, -37, 50,
+    -28, 25, 44, 63, -34, -67, 33, -8, -3, 35, -64, -52, 34, 27, -57, 36,
+    -51, -39, -87, -10, -68, -35, -27, -63, 16, -11, -63, -9, -39, -32, -56, 20,
+    38, 20, 7, 45, -43, 21, -57, -55, 57, -15, 32, 3, 7, -53, 66, -21,
+    -35, 3, -33, -83, -78, 15, -47, -24, 20, 33, 40, -19, 42, -39, 61, 18,
+    42, 62, 33, 76, -82, -97, -7, 49, 78, 99, 65, 62, 27, -48, -66, 78,
+    98, -41, -76, -30, -57, 98, 58, -81, 93, 50, -15, -62, -55, -71, 44, -72,
+    9, -40, 71, 86, 49, 51, -68, -26, -5, 51, -57, -38, -41, 42, 38, 54,
+    4, 5, 6, -28, -1, 17, 6, -57, 49, 76, -18, 99, 69, 67, 29, -81,
+    -19, 44, 45, 17, -114, 49, -67, 0, 91, 39, 65, -8, 36, 89, -14, -102,
+    98, -63, 85, 39, -23, -10, 57, -78, -63, -68, 33, -13, -79, -9, 4, -82,
+    33, -36, -28, 24, -89, -60, -84, -66, -29, -51, 53, -61, 37, -23, -100, -8,
+    12, -97, 37, -8, 0, -47, -56, -84, 39, -5, -27, 68, 38, -15, -111, -81,
+    59, -95, -120, 1, -96, -47, 0, -28, -37, 15, -22, -57, -55, -81, 5, 11,
+    -23, -88, 95, -9, -89, -21, -33, -53, 14, -66, -88, -38, 7, -98, -30, 10,
+    21, -82, -107, 75, 86, -33, 52, 18, -36, -75, 90, -98, -38, -96, -54, 17,
+    9, 34, -105, 34, -69, -109, -99, -39, 8, -45, 41, 28, 44, 74, 65, -57,
+    -57, -34, -69, -92, -73, 31, 71, 64, 67, 73, -25, 47, 74, 59, 43, 37,
+    23, -112, 59, 17, 30, 33, 51, 15, 47, -17, -30, -79, -93, 76, 34, 51,
+    -39, 46, -46, 89, -50, 18, -65, -97, 43, -37, -34, 14, 70, 20, -49, 3,
+    -31, -122, -31, -110, -29, 10, 45, 25, 61, -58, 13, -82, 16, -45, -11, 0,
+    0, 80, -51, 26, 43, -41, 0, -102, -113, -52, 22, 68, -15, -119, 2, 9,
+    -6, -13, -11, 32, 56, 90, -79, -59, -27, 55, 27, -95, 78, 68, -100, 13,
+    -93, 13, 64, 28, -92, -35, 42, -59, -83, -5, -15, -11, -98, -88, 21, 52,
+    -42, 16, 50, -4, 41, 58, -14, -72, 4, -21, 6, -60, -32, -9, 10, 56,
+    -89, -102, 16, -90, 45, -113, -123, -6, -28, -68, -20, 6, 33, 28, -30, -21,
+    24, 22, 24, -66, -87, -41, 91, 22, 67, 77, 64, -43, -57, -24, -60, -76,
+    48, -20, 62, 58, -32, -71, -40, -50, 18, -39, -41, 41, 67, 77, -87, 23,
+    53, 81, -44, -69, -40, -21, -120, -36, -13, 55, -114, -127, 50, 52, 43, -66,
+    79, -29, -35, 87, -49, 87, 69, -24, -60, 54, -4, 65, -75, -39, -20, -98,
+    -63, -44, 49, 21, -53, -105, -125, 34, 57, -30, -53, 71, -23, -104, -75, 85,
+    14, 11, 39, 34, 98, -3, -16, -50, 74, -50, -27, -80, 7, 33, -49, 16,
+    40, 44, 55, 37, 38, -11, 7, -34, 78, -35, -108, -71, -72, -38, -77, -79,
+    -92, -42, 48, 64, -57, 17, -21, -18, -64, -44, -73, -48, 59, 47, 8, -47,
+    -45, -19, -64, -58, 45, -61, 63, -83, -88, -96, 21, 88, -91, 58, 40, 58,
+    68, 8, -39, -81, -107, 8, 79, 69, -57, -36, 55, 15, -42, -63, -98, -81,
+    -38, -98, -107, 27, -16, -90, 28, 6, -90, -5, -93, -79, 67, 31, 71, 86,
+    -15, -113, -44, -11, 19, -42, 37, -89, -84, 42, 0, -15, 56, 76, -2, -16,
+    -42, -36, 6, -12, -87, -52, -47, -33, 28, -64, 69, -74, 35, 3, 38, 37,
+    55, 5, -71, -99, -37, -101, 17, -17, -112, 26, -94, -103, -68, 47, -1, -9,
+    23, 8, 16, 25, 6, -103, 38, -43, 87, 16, 49, 32, 1, -4, 20, -60,
+    -25, 34, 36, -108, 65, -57, -104, -81, -83, -99, 20, 60, 23, 43, -33, -34,
+    -21, -43, -65, -76, 83, 27, -98, 34, 63, -93, 44, -73, 13, 26, 23, 36,
+    12, 65, 51, -48, -75, -24, -25, 11, 30, -63, -92, 89, -90, -104, 16, -5,
+    61, -71, -55, 22, -110, -98, -63, -64, -60, -110, 38, -112, 41, -107, -35, 10,
+    5, 24, -67, -1, 8, 66, -2, 32, 85, -26, -27, -73, 1, 3, 25, -11,
+    -98, 73, 7, -48, -95, 0, -18, 44, -29, -7, -57, 39, -74, 69, 31, -77,
+    -63, 98, 14, -46, -81, 17, -57, 26, 15, -89, -107, -105, 80, -50, -77, 9,
+    4, 27, -31, 39, -58, 84, 90, 55, -52, -54, 79, -69, 98, 99, -61, 54,
+    -84, -29, -30, 67, -103, -24, -100, -55, 67, -26, 71, -50, -23, -37, -93, -111,
+    -27, -2, 86, 13, 99, -2, 85, -49, 88, -3, -55, -86, 16, -54, -56, -44,
+    -90, 69, -1, -74, -63, -67, 27, 95, 53, -42, -10, -50, -35, 45, -18, -11,
+    -27, 42, 78, -93, -97, -15, 5, 1, -3, -90, 13, -67, 0, -47, 17, -59,
+    45, -89, -80, -19, 19, -99, -91, 82, 53, 43, 58, -35, -96, -59, -56, -41,
+    -42, -30, -79, -106, -51, 90, -105, -3, -66, -6, 39, 68, -82, -16, 100, 85,
+    -77, -8, -37, -35, 45, 47, -26, -102, -53, -92, -57, -82, 85, -69, -90, -91,
+    37, -69, 72, -86, 40, 9, 91, -38, -99, 75, 56, 15, 60, -56, 82, -79,
+    101, -71, -15, -30, 41, 56, -18, -11, 59, 77, 68, 60, 33, 56, -97, 110,
+    -49, -93, 19, -68, -25, -12, 92, -27, -40, 81, 22, 89, 117, 87, -44, -90,
+    86, -101, 21, 16, -40, 62, 42, -69, -101, -71, -86, 64, -78, -10, 15, 79,
+    -2, 19, -9, 77, 73, 6, -14, -14, 60, -54, 59, -5, 54, -102, 53, -8,
+    11, -28, -103, -16, -107, -80, -108, 72, -22, -15, 14, -36, 64, -53, -84, 0,
+    -25, -88, 98, -54, 44, -64, -75, -90, 98, -75, -52, 68, 9, 63, 93, -41,
+    94, 73, 14, -83, 98, -44, 73, -67, 22, 57, -116, -50, -7, 71, -88, -63,
+    -89, 57, 70, 9, 56, 42, -80, 0, -55, -26, 19, -56, -69, -29, -47, -92,
+    -8, -115, -27, 94, 29, -73, -19, 50, -1, -65, 35, -44, 5, -74, -2, -63,
+    80, -124, 81, -54, 76, -74, -102, -60, -69, 69, -5, 27, -80, -21, -29, 21,
+    8, 46, -21, -76, -24, -48, -17, 20, -40, 41, 34, 18, -85, 50, -13, -27,
+    60, 13, 32, 38, -96, 5, 59, -93, -52, -115, 70, 10, -55, 56, -40, 43,
+    -102, 40, -7, -127, 18, -79, 33, -111, -91, 5, -117, 51, 70, -11, -52, -68,
+    -74, -99, 30, -55, -36, 66, -55, 64, -26, -124, 84, 17, 13, 56, -39, -6,
+    -118, 21, -4, 9, -110, -111, -85, -2, 88, -85, -48, 12, 20, -3, 92, 79,
+    32, 18, -55, 4, -127, 93, -20, -103, -5, -50, 57, 44, -106, -33, 74, -26,
+    81, 40, -40, -15, 94, 7, -52, 57, -39, -60, 9, 28, 64, 25, -1, -35,
+    -74, -40, 66, -27, 49, -121, -47, -44, -6, 16, -9, -13, -60, -31, 12, 26,
+    -87, 88, 77, -100, 87, 36, -74, -13, 93, -51, -48, 38, 64, -48, 20, -90,
+    0, 65, 48, 43, -107, 4, 96, -62, 24, -8, -33, -11, -77, 31, 0, 36,
+    95, -79, -70, -95, -75, -69, 45, -70, -117, -14, -46, 58, -97, -75, -55, 70,
+    -21, 30, -84, 100, 23, -14, -15, -61, -59, -54, -16, 48, 102, 35, -40, -8,
+    29, 30, -93, 40, -87, 36, -4, -49, -10, -6, 42, 40, -87, 28, -52, -65,
+    -26, 77, 85, 37, -71, -31, 95, -2, 66, 50, -31, 90, 68, -53, -45, -7,
+    55, 12, 44, 63, -107, -33, -2, -30, -14, 66, -99, -69, 22, 46, 55, -100,
+    -31, 18, 22, -22, -70, -80, -49, -26, -89, -11, 81, -49, 8, -32, -21, -63,
+    43, -72, -74, -76, 27, 11, -7, -75, -113, -1, 66, 10, -60, 12, -98, -14,
+    68, 77, 72, 73, 79, -99, 45, 91, -3, 13, 1, 40, -32, -91, 68, -75,
+    86, 4, -75, -118, 9, -17, 53, -100, -106, 50, 43, 23, -26, -7, -48, -54,
+    -47, -44, -85, -59, 95, -49, 106, -20, -97, -76, 88, 58, -71, -49, 48, 64,
+    86, -95, -10, 32, 14, -71, 103, 72, -80, -111, 11, 12, -67, -45, -46, 29,
+    -88, 2, 54, 80, -5, -41, 53, -87, -8, 49, -119, -13, 2, 58, -106, -13,
+    27, -102, 83, -37, -36, 29, -81, -42, -87, 34, 60, 40, 29, -30, -2, 28,
+    73, -102, -36, 45, 76, -103, -19, 29, 94, 20, 85, 9, -88, -97, 22, -91,
+    48, -12, 86, 48, 76, -6, -77, 87, -4, -16, -25, -2, -47, 0, -24, -68,
+    73, -36, 71, -56, 103, -33, -94, 16, -107, -85, 76, -7, 51, -110, -57, -32,
+    30, -34, -61, 54, -14, 76, 16, 57, -22, 53, -68, -19, -81, 2, 40, -73,
+    -104, 14, -35, -24, 24, -52, 23, 20, -35, 68, -42, 5, -53, 56, 11, -65,
+    -11, -109, 25, -43, 81, -74, -51, 29, 64, 57, 56, -93, -12, 50, -92, 77,
+    60, -100, 58, -42, -62, 65, -13, 12, -63, 63, -54, -72, 3, -63, -76, -69,
+    -5, -107, 73, 87, -99, -16, -82, 96, 72, -18, 17, -88, -76, 58, 99, 9,
+    -49, 85, -23, 82, 56, 26, -71, -50, -47, -23, 39, 4, 37, 38, -37, -13,
+    103, 25, -24, 56, 71, -76, -8, -83, 79, 68, -34, -53, 35, 81, 20, -103,
+    -5, 96, -19, 88, 49, -24, -53, -24, 71, -104, -110, -74, 25, -8, 96, -88,
+    0, -31, -26, -19, -107, -87, 49, 103, 19, -106, -21, 29, -53, 13, -89, 9,
+    -29, -71, 67, -106, 70, 108, -61, -88, -21, -17, 38, 48, -107, -15, 25, 23,
+    -20, 60, -45, 40, 48, 32, -25, 39, -77, 66, -45, -47, 81, -74, -81, -16,
+    65, 7, -50, -6, 61, 50, 38, -72, 22, 60, -28, 78, -2, 15, 2, 60,
+    31, -49, -51, 6, -62, 17, 34, -23, -82, -64, 65, 8, 63, -67, 67, -18,
+    64, 11, -13, -79, 29, 71, 52, -42, 70, 41, -21, 68, 43, 88, 85, -2,
+    36, 51, -33, 59, 74, -23, 46, 21, -65, 75, -53, -42, 14, 48, 51, -70,
+    27, -63, 28, 13, 13, 0, 67, 17, 53, 28, -49, -69, 9, 6, -12, 3,
+    99, -59, -7, -88, 13, 26, -104, 31, -3, -25, 6, -53, 40, 21, -43, 61,
+    78, 59, -51, 31, 38, -52, -31, 53, 70, 62, -20, -14, 80, 36, -71, -41,
+    -57, -73, 50, 53, -33, -100, -6, -88, 83, 80, 22, 24, -79, 66, -45, 14,
+    45, 91, -17, 46, -46, 40, 17, 15, -7, 21, 59, 3, -50, 6, -10, 30,
+    -38, 29, -37, -55, -11, -67, -73, -75, -79, 25, 23, -32, 70, 58, 26, -24,
+    62, 3, -22, 88, 39, 14, -54, 47, -55, 18, -26, 73, 39, -71, -31, -99,
+    35, 13, -16, -36, -6, -81, 19, -33, -37, 21, 36, 32, -47, -47, -9, -10,
+    17, -53, -56, -21, 25, -37, -9, -10, -45, -61, 40, -19, -71, 54, -35, -41,
+    -63, -7, 63, 47, 15, -75, -94, 19, -25, -62, -83, -7, -67, -47, -77, -53,
+    66, 46, 97, -16, -53, -54, 16, 40, -78, -30, -31, -37, -17, -77, -67, -39,
+    -58, -37, 14, -35, 57, -127, -41, -38, -91, 57, 12, 47, 56, 1, 0, -30,
+    8, 44, -56, -71, 10, 19, -71, -34, -47, -4, -49, 61, 31, -49, -6, -70,
+    0, -83, 22, 18, -13, 65, -13, -46, 63, 39, 69, 20, 15, -56, -39, 38,
+    14, 43, -70, -3, 43, -9, 33, -59, 70, -74, 54, -67, -106, -42, -89, -14,
+    -59, 16, -29, 52, 26, -15, -83, 15, -22, -76, 11, -52, -53, 43, -46, -47,
+    -61, -83, 7, -72, -18, 48, 19, -4, 56, -36, -13, 33, 88, 0, 5, 62,
+    -86, 43, 52, -15, -13, 52, -59, -94, -38, 77, 12, 53, 56, 41, 61, 42,
+    -55, -81, 19, -88, 51, 3, -4, 14, 33, 31, -16, -20, 80, 8, -50, 19,
+    34, 39, 54, -70, -33, 19, 77, -2, 43, 32, -40, 9, -69, -9, 17, -40,
+    -65, 36, 30, -15, -86, 40, 21, -4, -38, -45, 41, 27, -46, -73, 53, -46,
+    19, 6, -28, -13, 63, 14, -79, -24, -24, 28, 42, 14, -48, -93, -26, -78,
+    45, -33, 23, -2, 37, 48, -51, -60, 19, 1, -31, -57, -15, 13, 87, 72,
+    -39, -63, -70, 38, 38, -35, 71, -71, -102, -103, 1, -30, -17, 3, 26, 10,
+    -65, 67, -77, -70, -32, -52, -25, -50, -50, 22, 3, 1, 32, -51, 63, 3,
+    -41, 0, -84, -7, -89, -72, -81, -52, -20, -29, -108, -57, -8, 50, 3, 26,
+    65, 82, 46, 7, -46, -38, -52, 3, 30, 49, 75, -35, -58, -34, -72, -59,
+    -95, -12, 10, 4, -49, -41, 58, -68, 43, -48, 70, -29, 10, -55, 2, -55,
+    -68, 43, -54, -57, -70, 19, -78, 45, 34, 12, -64, 38, 27, -43, 48, -61,
+    -47, 23, -79, -19, 33, -24, -23, 54, -67, 27, 87, 8, -87, -9, 12, 45,
+    -21, 31, -16, 1, 47, -91, -53, 69, -64, -4, 35, -57, -8, -69, 11, -43,
+    33, 13, 15, 17, -4, -52, 78, -1, -84, 56, 14, -21, -76, 8, -3, -18,
+    21, -14, -36, -31, 14, -6, -6, 16, -70, 51, -10, 29, 17, -25, 26, 12,
+    -81, -63, 14, -21, 62, -74, 15, -12, 77, -79, -14, -50, 29, 21, 67, 73,
+    51, -14, 23, 63, -50, 69, 32, -67, -40, 1, -23, -51, 41, 8, 52, -47,
+    -60, -69, 32, -4, 16, 40, 73, 92, -29, -79, 9, 61, -26, -15, 33, -18,
+    16, -4, -39, 43, -41, -60, 19, -35, 14, -56, 20, -43, 16, 41, -21, 5,
+    28, -17, -48, 33, 0, 33, 14, -42, 64, 81, -3, -61, -44, 75, -39, -69,
+    -49, 36, -49, -44, 15, -3, 55, 62, 24, 21, -61, -66, 45, -10, -36, 30,
+    -59, 32, 6, -36, -23, 22, -29, -8, 51, 66, 51, 82, -78, 25, 53, -15,
+    -49, 44, -20, -41, -16, -2, -10, -75, 23, -75, -36, 78, -72, 60, -12, -45,
+    65, -39, 15, -16, 48, -37, -68, 40, 20, 38, -31, 2, 23, -74, -23, -79,
+    34, -43, 72, -25, 26, -61, 56, 35, 52, 32, 53, -46, 65, 73, 0, 18,
+    -8, 7, -55, 68, -3, -76, 53, -65, 34, -21, -23, -65, -36, 55, 15, -32,
+    -83, 51, 109, -40, 55, 22, 108, 52, 79, -95, -92, 94, -72, -20, 11, -28,
+    -33, 72, -53, 78, -108, -12, 34, -47, -70, -105, -103, -45, -68, 107, 46, -88,
+    80, -16, -55, -53, -30, -26, -72, 54, 97, -95, -5, 27, 0, 79, 111, 70,
+    -88, -40, 79, 32, 47, 99, -97, -24, -23, -20, -12, -88, -58, 30, 96, 98,
+    -7, -43, 79, -86, 1, 65, -41, -90, -30, 84, 78, 55, 16, 8, -14, -90,
+    48, 83, -7, -90, 41, 31, -1, -84, -95, -78, -52, -49, -27, 0, 42, -88,
+    -55, -56, 17, 31, 67, 50, 90, -2, 92, 96, 93, -81, -94, 106, 27, 21,
+    54, -28, -19, 94, 6, -77, 102, -1, -2, -7, -90, 31, 74, 38, -106, -1,
+    -75, -86, -81, -43, 50, 83, 3, -40, -14, -35, -32, 62, 45, -32, 47, 57,
+    83, 87, -96, 57, -101, 2, -25, -104, 99, 99, -58, -105, -53, -24, 74, -9,
+    -18, 36, 8, -39, 25, 105, 77, 9, 41, -9, 72, 89, -37, 91, -27, -52,
+    -26, 20, 46, -26, -39, -36, 42, -20, 50, -41, -47, 82, 5, -115, 23, -41,
+    69, -66, -74, -79, -77, 32, 50, 80, -45, -45, -38, 77, -44, -91, 102, -52,
+    72, -77, -116, 3, -95, -26, -25, -8, -111, -100, -104, 47, 93, -32, -34, -23,
+    -99, 35, 63, -10, 101, -11, -29, -50, 35, -98, -33, 56, -24, -16, -20, -36,
+    -58, -110, -7, -33, 89, -41, 85, -110, -92, 104, -68, 57, 66, -85, -4, 75,
+    4, 41, 57, 41, -51, -89, -26, -8, -4, -107, 31, -120, 17, 60, 79, 1,
+    11, -53, 58, -41, -59, -56, 103, 5, 88, -88, 11, 51, 98, -4, 92, -65,
+    -5, 15, 14, 71, -36, -2, 60, 24, -22, -60, 3, 1, 40, -81, -59, -43,
+    -64, 24, 74, -27, -39, -108, 37, -22, 72, 31, 49, -18, -35, 30, 70, -96,
+    46, -77, -99, -18, 74, -24, 47, -20, 44, -62, -1, 80, -99, 72, 27, -107,
+    107, -68, -86, -35, 43, 75, -21, -109, 25, 21, -73, -18, -102, -60, -50, 23,
+    -8, -111, -39, -103, 85, 22, -7, -21, -1, -65, 2, 71, 77, 14, -15, 28,
+    56, 30, 55, -47, -27, -127, -12, -83, -11, 67, -18, -30, 68, -121, 72, 12,
+    18, 96, -89, -39, 44, -107, 80, 27, 28, 63, -98, 74, 22, -75, 10, -20,
+    14, -67, 72, 40, 8, 64, -84, 72, 12, -81, -1, -105, -85, 14, -1, -60,
+    -56, 72, 45, 7, 101, 22, -74, 52, -55, 17, -92, 30, -84, -66, -14, 66,
+    61, 48, -39, -31, -48, -2, -71, -107, 82, -19, 102, 4, 70, 4, -51, -7,
+    56, 35, 31, -102, -31, 46, 56, -21, 21, -46, -31, -123, -93, -89, -30, -124,
+    -27, -27, -33, -74, -97, 19, -112, -108, -29, -55, 85, 33, 109, -96, -94, 32,
+    1, 61, 72, -69, 100, 73, 24, 8, -95, 74, 50, 45, -90, 89, 74, -35,
+    -24, 34, -39, 34, 47, -108, -27, 14, 111, 17, 64, -35, 32, -3, 59, -34,
+    93, -50, -15, -101, -52, 62, 69, -119, 56, -91, 13, 85, -71, 68, -66, 98,
+    97, -40, -32, 62, -80, 4, -1, -97, -72, -78, -59, -106, -95, 37, -44, 85,
+    -7, -45, -125, -45, 24, 6, -92, 85, -32, 14, -12, 65, -21, 83, 63, -98,
+    -97, 35, 65, 77, 111, -2, 2, -2, -39, 22, -66, -108, 50, 66, -76, 78,
+    -24, -60, -115, -39, -103, -20, 89, -15, 43, 69, -41, -12, -5, -47, 83, -20,
+    5, 92, 101, -105, -13, 27, -64, -83, -84, 82, 39, 29, 44, -72, 37, 34,
+    -34, -63, 27, 44, 50, 103, -105, -100, 55, -65, -95, 63, -104, 86, -17, -93,
+    105, -78, 38, -54, -34, -44, -75, 68, -49, -33, -44, -89, -112, -69, -99, -80,
+    75, -60, -92, -70, -110, 100, 83, 39, -2, 87, 108, 56, 94, 44, 32, 78,
+    79, 55, -45, -65, 87, -79, -9, 25, -7, -57, -36, 13, 19, 22, -65, -99,
+    4, 54, -92, -19, 110, 91, -17, -75, 70, -25, -12, 60, -21, 69, -112, -23,
+    4, -34, -4, -75, 18, 45, 3, -22, 1, -99, 7, 62, 74, -63, 97, 66,
+    46, 3, 21, 32, 2, -93, -42, -59, 90, -41, 42, -10, -69, -55, -10, -16,
+    7, 30, -13, -98, -19, 73, -89, 95, 26, 34, -12, 62, -96, 21, -26, -7,
+    96, -15, 46, -111, -7, 82, -46, -67, 14, 99, 91, -49, -68, -23, 34, 91,
+    30, -85, -57, 96, 100, 56, -65, 88, 29, -3, -93, 17, -8, -86, -12, 74,
+    -81, 15, -23, -2, -34, 42, 27, 85, -3, 13, 101, -37, 43, 10, -67, -10,
+    33, 23, 67, 84, -75, -52, 89, -35, -58, 71, 45, -33, 80, 94, 80, -34,
+    6, -33, -66, 9, -42, 100, -62, -68, -37, -72, 28, -36, 65, 18, 43, 12,
+    21, 33, -5, 54, -41, -86, -2, -72, 55, -64, -47, 33, -56, 73, -33, 27,
+    -68, 53, -43, 61, -82, 73, 97, -14, 48, 55, 23, 2, 71, -61, -41, -86,
+    21, -53, 34, -46, 13, 79, -20, 20, 40, 75, -37, 87, 38, 90, 24, 13,
+    -38, 91, -60, 96, -82, -41, -26, -62, -29, -13, -40, -27, -94, 18, 15, 29,
+    -93, 4, -25, 110, -8, -31, 65, -2, 13, 24, -53, 65, -31, 37, 56, -17,
+    61, 74, -60, 91, 52, -49, 78, -47, 40, 76, 36, 52, -106, 31, -52, 29,
+    -78, -81, 59, -3, -99, -26, 59, 43, 14, 65, -100, 43, -35, 51, 64, 57,
+    -62, -73, -59, -58, 53, -44, -77, 29, 46, -34, 66, 62, -9, 36, -36, 25,
+    -93, 63, 13, -73, 93, -20, -93, 94, -27, -62, -26, 83, 68, -83, 94, 9,
+    -97, -99, -47, -63, 34, -61, 31, -105, 24, 74, 14, 39, -81, -93, 4, -25,
+    -29, -6, -46, -54, 30, -55, 43, -18, 5, 72, 81, 8, -101, -75, -100, 58,
+    -12, 24, 13, -22, -59, -26, 18, 40, -101, 41, 64, -87, -15, -2, -29, 33,
+    27, 86, -15, -99, 81, 67, -77, 52, 80, -14, -112, 58, -47, 27, -102, -20,
+    -67, -4, 60, -105, -84, -21, 42, 76, 78, -20, 30, -91, 44, 98, -14, 10,
+    -103, -42, 24, -16, -10, -58, 48, -25, -82, -95, -65, 47, -77, -28, 51, -74,
+    -104, -12, -23, 68, -50, 15, -71, -4, 30, -47, 87, -85, 95, -66, 48, -85,
+    -58, 73, 59, 48, -29, 43, 30, -116, -35, -15, -83, 44, 5, -69, 84, -57,
+    -12, -97, 26, 18, -4, 35, -44, 3, 107, 34, 50, 64, 46, 49, -72, 16,
+    57, 72, 27, 11, 37, -106, 82, -18, 77, -52, -50, 79, 13, -8, -42, 63,
+    67, 92, -28, 127, -48, 36, 41, 34, -21, 59, 76, -3, -8, -72, -23, 69,
+    -18, 86, -92, 67, 62, -92, 87, 36, -87, -50, 61, 70, 35, 52, 91, 92,
+    8, -95, 23, -56, 63, -28, -108, -9, 55, -95, -110, -27, 94, -54, -91, 69,
+    52, -103, -77, -56, -91, 97, -26, 66, 82, -79, 75, 55, 99, 56, -20, -56,
+    78, -74, 28, 41, 37, 53, -33, -92, -41, -121, -16, -15, 88, 25, 14, 7,
+    -11, 3, -11, 86, 98, 82, -88, 13, 94, -57, 3, 26, 52, -94, 77, -63,
+    49, -49, -76, -97, -91, 35, 61, 74, 28, -67, -80, -3, -48, -94, -17, -71,
+    30, -88, -99, 66, 18, 27, -96, -30, -66, 68, 34, -96, 44, -105, -111, 36,
+    70, -81, 4, 86, 12, 80, -75, -59, -93, -85, -28, 57, -30, -9, 57, 35,
+    -66, 48, -84, -2, 52, -30, 70, 18, -32, -83, 85, 30, -105, -49, -93, 65,
+    38, -30, -85, -4, 7, -46, 24, 37, 70, 44, 24, 48, 89, 89, -87, 44,
+    25, -66, 6, 56, -96, -106, 43, 77, 3, -95, -76, -58, -55, 74, -90, -9,
+    -5, 84, -73, 71, 75, 2, -27, 89, -81, -24, -51, -52, -82, -66, -82, 77,
+    -25, 74, 20, -52, 29, 36, -73, -91, 79, -42, -60, -19, -59, -23, -77, -32,
+    -93, -42, -41, -81, 98, 82, -49, -102, -44, -43, 61, 66, -58, -60, 8, 4,
+    -59, -109, -25, -82, 22, -9, -96, -1, 25, 56, 3, 7, -2, 18, 86, -96,
+    72, -74, 87, 59, -31, 49, 41, 1, 19, -6, 76, 30, -111, -106, 30, 74,
+    34, -5, 45, 8, -69, 61, 87, -6, -41, -20, 50, -45, -89, 52, -40, -31,
+    -52, 36, 56, -71, -76, -90, -79, -59, -40, 56, -97, -73, 54, -14, -18, 10,
+    50, -30, 70, 80, -33, -70, 66, -11, -62, -50, -24, -56, -94, -33, 58, -58,
+    11, -91, -13, 5, 23, 45, -46, 65, 49, 19, 8, -3, -36, 43, -60, 55,
+    -45, -31, -68, 16, 46, -91, -32, 73, -115, -104, 32, 40, 20, -107, 20, 38,
+    -54, 42, 25, 34, -56, -71, -90, -85, -74, 65, -77, 95, 67, 24, -57, 81,
+    4, 39, -27, 60, 10, -92, 1, -85, 84, -95, 89, -71, 29, 39, -68, -86,
+    4, 62, -1, 20, 2, -3, 96, 42, -2, 73, 30, 5, -96, -51, 78, -57,
+    -82, -33, 40, -23, -64, 37, -90, -72, 8, -53, 47, -53, 71, -27, 54, 84,
+    34, 46, -47, 77, -35, -76, 15, -40, -66, 19, 70, -83, -72, 87, 10, -73,
+    -80, 20, 37, 8, -95, 50, 74, 72, 94, -97, 16, -15, 48, -24, -18, 63,
+    -25, 3, -30, -63, -26, 10, -50, -49, -38, 0, 9, 45, -13, -26, 0, 10,
+    -67, -23, 54, -61, 5, -22, 52, -18, -59, -15, -15, -28, 52, 41, 11, -52,
+    64, -69, -19, -46, -67, -25, -53, -13, -24, 32, -4, 30, -40, 48, -3, -18,
+    68, 48, 29, -35, -31, 21, 27, 1, -14, 57, 45, -6, -19, -61, -55, 65,
+    -66, 23, -39, 30, 59, -45, -31, -15, 15, 22, -63, 54, -21, -42, -70, 45,
+    -42, -41, 9, -27, -59, -2, 44, -14, 66, 20, 56, -5, 48, 18, 35, -78,
+    6, 54, -10, -2, 21, -17, -10, -76, -40, -109, -31, 38, 37, -28, -66, -15,
+    56, 2, -64, -45, -48, -44, -1, -63, 41, -74, 48, 55, 9, -35, 27, 23,
+    -62, 26, 40, -42, -18, 1, -75, 6, 55, -15, -23, 63, -27, -55, 16, 55,
+    8, 9, -54, -32, 15, -127, -2, -110, -9, -8, 6, -33, -27, -35, 62, -15,
+    -75, -36, -83, -71, 36, -68, 2, -22, -55, -2, -70, 51, -70, -8, 60, -38,
+    13, -17, -16, 11, 0, -20, -66, -30, -47, 44, -33, 4, 31, -54, -55, 26,
+    -18, 34, -31, -26, -10, 53, -46, 6, -39, -34, -46, 21, -75, -78, -63, -56,
+    23, 31, -32, -4, -33, -14, -29, -47, -15, -63, -46, -58, -25, -62, 29, 6,
+    9, -42, 27, 74, -28, 25, -9, -19, -61, 12, -91, 20, -17, -8, -24, 35,
+    -1, 1, -3, 7, -32, 16, -52, -10, 9, -49, -37, -25, -41, -51, 20, -24,
+    16, -24, -22, -21, -5, -24, -35, -63, -34, 5, 25, -65, 14, -29, -31, 30,
+    26, -1, -28, -74, -34, -22, -24, 50, 13, 43, 18, -14, 32, -34, 23, 23,
+    -56, -21, 13, -78, -12, 89, 10, 28, 62, -53, -70, -67, 16, -79, -83, -46,
+    10, 35, -94, -8, -23, 22, -56, -41, -69, 38, -69, -43, -94, 6, -12, -3,
+    38, 31, 4, 30, 42, 17, 35, -18, 10, -55, -44, -16, 1, 31, 42, -48,
+    -8, 11, 20, 16, -45, -19, 48, 81, -79, 3, 7, -48, 16, 87, 17, 21,
+    -60, 6, 20, -40, -16, -66, -30, -3, 36, 15, -64, 48, -41, -68, -41, -23,
+    -58, -35, -9, -72, 6, -93, -37, -75, -42, -15, 45, -3, -28, -19, -15, 11,
+    46, -24, 12, -84, 39, -35, 16, -14, 35, -22, -44, 47, -61, 2, -61, -49,
+    14, 7, -5, 24, 33, 67, -23, 33, 27, -66, -10, -43, -3, 56, -62, -63,
+    -23, 57, 52, 5, 53, 1, -66, 43, -53, 11, -71, -80, -90, 19, -53, -6,
+    -16, 58, 16, -10, 7, -87, -40, -120, 35, -2, 24, -5, 38, 17, -69, -55,
+    3, 23, 2, -30, -31, 39, -50, -22, 26, -37, -61, -65, 29, 29, 11, 12,
+    35, -61, -60, -97, 78, -16, -29, -31, 3, 5, -41, -54, 5, 40, 11, 26,
+    25, -83, -15, -94, -8, -22, 35, 32, 40, 14, 20, 9, -10, -107, 9, -8,
+    -42, -52, -59, -3, 52, 40, -53, 62, 19, -15, -43, -19, -9, 25, -39, 3,
+    -70, 27, -9, -24, 47, 32, -7, 16, -68, -10, -20, -9, 12, 37, -27, 34,
+    -20, -37, 66, 10, 58, 70, -50, 57, -14, -30, -7, -38, 7, 29, -48, -24,
+    -42, 11, 40, -5, -2, 7, -14, -23, -8, -62, -70, -60, -5, -19, 1, 30,
+    10, 46, 36, -64, -4, -13, -27, 28, 15, -50, 58, -30, 21, -27, 31, -44,
+    1, -38, 14, -43, -80, 38, -95, 0, -66, 92, 25, -32, 30, 18, 61, -50,
+    -68, 68, -36, -59, 26, 16, 17, 39, 4, 41, -48, -19, 29, 72, 25, -40,
+    -22, -2, 19, 19, -29, 63, -39, -29, -62, 4, 9, -30, -11, -10, -60, 25,
+    21, 8, -31, -72, 2, -22, 38, -26, 1, -31, -16, 47, -16, 32, 12, 55,
+    59, 46, 57, 37, 4, 31, 66, -38, 26, -38, -41, -87, -67, 16, 48, -41,
+    -32, -47, 7, 46, 20, 71, -44, -34, -10, 10, -1, 35, 57, 34, 39, 32,
+    -20, -41, -67, 63, 34, 54, -57, 29, -6, 11, -27, 13, -73, -40, 9, -45,
+    -23, -7, 93, 29, 0, 43, 36, -45, 24, -8, -15, -44, 0, -68, 25, 14,
+    -52, -9, 24, -57, -108, -65, 2, -92, -20, 37, -96, 0, 47, -42, -49, -65,
+    31, -25, -2, 56, -51, -61, 45, -9, -12, -46, -70, 37, -15, 23, -5, 0,
+    23, -31, 50, -28, 14, 36, -5, 22, -56, -60, -12, -37, 10, -44, 8, -64,
+    41, -56, 6, 63, 47, 8, 39, -4, 29, 62, 13, -13, 62, -81, -2, 5,
+    21, -68, -54, -65, -45, 45, -20, 37, 63, 57, -67, 7, -6, 36, -57, 31,
+    -37, -37, 17, 41, -19, 37, -51, 29, -10, -6, 7, 37, -28, 8, -38, 14,
+    -6, 51, -1, -57, -14, -60, -10, -27, -57, 10, -50, -33, -12, 30, -47, 43,
+    59, 76, 23, 74, -17, -57, 32, -19, -35, -5, -16, 9, -70, -70, -24, -36,
+    13, -15, 41, 21, -17, -22, 53, 0, -44, -60, 26, -41, -35, -13, 22, 28,
+    14, -3, 20, 56, 2, 37, 49, 60, 0, 34, -41, -12, 40, -41, -40, -56,
+    15, 27, 17, 40, 13, 24, -54, -15, 2, 54, 65, 29, -19, -29, 39, -19,
+    68, 64, -24, -8, -16, -8, 9, 42, -33, 5, 17, -32, 16, -60, -42, 25,
+    -3, -51, -19, -22, -50, -21, -61, 15, 21, 76, 0, 8, -11, -27, 34, 36,
+    80, 30, -1, -48, -20, -47, -46, -79, 26, -3, 23, 51, -58, -21, -2, 0,
+    -28, 22, -7, -9, -29, 13, 36, 27, 42, 39, 25, 1, 26, 24, 58, 7,
+    33, 25, -67, 23, -12, 22, -9, 45, -56, -16, -43, 38, -6, -38, -7, 26,
+    38, -25, 5, 37, 23, -4, 27, -45, 53, 33, -39, 26, -30, 6, -17, 6,
+    -60, 57, -24, -23, -59, -34, -4, -47, 72, 25, -35, -28, 8, 21, -11, -16,
+    -43, 34, 38, -5, -22, 20, 13, 18, 24, -3, 21, 31, -18, 46, -21, 58,
+    15, 53, 38, 30, 17, -38, 6, 29, 1, 18, 10, 9, 22, -9, 16, 50,
+    -16, -40, 47, 41, -10, -9, -59, 23, -23, -15, -17, 52, -21, 53, 7, -47,
+    14, -11, 45, 18, 20, -6, -60, 14, -56, -40, 27, -22, 60, -5, -17, -23,
+    2, 2, -24, -8, -8, 35, 15, 46, -40, 50, -9, 28, -39, -21, -71, -43,
+    -59, -64, 21, 6, -32, -14, -62, -10, -1, 14, 10, 57, 53, 12, 9, -18,
+    0, 65, -26, -10, 11, -21, -58, 25, -66, -66, -30, -62, -80, -6, -15, -80,
+    -53, -51, -5, -88, 46, -33, 9, -28, -24, -38, 24, -57, -10, -42, -14, 22,
+    -36, -3, -42, -9, -4, -76, 21, -23, -104, -50, -74, -72, -102, -14, -71, -54,
+    -49, -17, -28, -51, 45, -13, -10, -89, -20, 6, 28, 43, -47, 5, 15, 23,
+    -24, -62, -56, -89, -35, 0, -47, -70, -22, -4, -12, -18, 2, 6, 6, -42,
+    24, -37, -46, -15, 1, -42, -10, 43, -49, -29, 55, 7, -14, -6, -66, 18,
+    -30, -47, -1, 23, -24, 32, -38, -70, -7, -63, 4, 40, -1, -69, -34, 23,
+    21, -44, -60, 36, 37, -52, -47, 71, -4, 45, -22, 18, 20, -26, -16, 12,
+    15, -12, 28, 20, 9, 17, -7, 8, -61, -38, 21, -59, -39, 43, 23, -59,
+    -9, 37, -16, 39, -13, 44, -2, -31, 22, -34, 24, 6, -22, 46, 52, -16,
+    -66, -41, 28, 19, -26, 16, -69, -30, 24, 107, 44, 33, 2, -28, -6, -35,
+    67, -16, 12, 54, 36, 45, -36, 52, 35, -30, 50, -44, 46, 4, 31, -53,
+    22, 13, 45, 48, 34, 51, 102, -10, 36, 10, 39, 9, 64, -7, -11, 20,
+    32, -31, 17, 32, -18, 43, 44, 47, -31, -34, -51, 66, -2, -15, 20, 67,
+    31, 70, 67, 46, 5, -16, 42, 2, -15, -30, 30, -17, -21, 41, -23, 58,
+    -12, -36, -23, -21, 24, -12, 31, -55, 35, 53, -42, -5, 14, 21, 127, -17,
+    -26, -23, 0, -42, -35, 61, -29, 29, -16, 28, 56, -36, 41, 36, 27, -31,
+    -31, 57, -9, 24, 28, -1, 46, 54, 11, 87, 62, -49, -11, -32, 25, 8,
+    -10, 62, 54, -27, 34, 22, -15, -13, 33, 2, 10, 23, 56, 21, -43, -11,
+    -26, 89, 19, 97, 7, 36, 13, -28, 1, -43, -29, -66, 35, -52, 8, 24,
+    19, 18, 11, -24, -50, -59, -20, -53, -39, -55, 14, 5, 18, -37, 42, 30,
+    98, 8, 99, -14, -34, 4, -53, 67, -5, -22, 24, -52, -16, -35, 3, 6,
+    -25, 13, 25, -49, 38, 46, 8, 19, 20, -41, 3, 41, 76, 64, 78, 57,
+    -37, -23, 34, -5, -65, -15, -15, -4, -79, -41, 18, 24, -25, 2, -4, -21,
+    7, -18, -27, 18, 2, 36, 25, 59, 40, -11, 0, 6, 33, -45, -5, 13,
+    -85, -9, -76, -75, -75, -12, -23, -71, -12, -76, 17, -21, -36, 9, 50, 2,
+    -48, -20, 12, 54, -4, 40, -14, 3, 23, -44, -27, 26, -27, 37, -34, -53,
+    53, 15, 52, -52, -4, -43, -80, 22, -60, 22, -33, 51, 8, -10, 28, 2,
+    29, -46, 13, 49, -16, -8, 19, -3, 58, -39, -36, 37, -20, -11, -56, 26,
+    22, 26, 36, -10, -32, -40, -53, -53, -50, -8, 20, 46, 22, -54, 31, 16,
+    34, -15, -61, 55, 2, -20, 68, -26, 32, 44, -33, 40, 33, -47, 54, -32,
+    68, -40, -32, -70, -49, -28, -76, 3, -16, -18, 3, -38, -38, -64, -33, -67,
+    59, -14, -7, -92, 63, 76, 21, -21, 54, 57, 33, 16, 50, 57, 95, -49,
+    10, 29, 41, -52, 37, -42, -36, -31, 58, -67, -76, -45, -66, -39, 57, 70,
+    -3, 33, 8, 42, 45, 68, 102, 15, 7, 32, 10, 31, -35, 28, 64, 42,
+    54, 47, -19, -52, 52, -72, 64, 36, 71, -39, -56, 30, 54, -69, -81, 73,
+    18, 4, 11, 3, 15, -55, 27, 6, 69, 16, 45, -20, 92, -11, 53, -5,
+    46, -2, -33, -52, -92, -84, 80, 34, -44, -100, 15, 48, -50, 11, -70, -20,
+    -24, 14, 102, 27, -1, 18, -19, 22, 21, 2, -24, 36, 34, 18, 71, 61,
+    -50, -56, -13, -4, 1, 8, 15, -40, 23, -1, -10, 15, 1, 28, -25, 32,
+    63, -79, 59, -29, -39, -69, -79, 42, 71, -16, -57, -70, 46, 24, 3, 41,
+    -22, -68, -2, 19, -55, -69, -74, -18, -77, -89, 45, 6, -74, -87, -10, -45,
+    -123, -44, 26, 28, -74, -55, -12, -66, -75, -35, -61, 14, -33, -33, 6, -55,
+    -61, 44, -20, -16, -38, -5, -5, -86, -93, 29, -65, 4, -31, -60, 17, -8,
+    8, 25, 55, 50, 50, -32, -60, 0, 32, 20, -63, -75, 7, -30, 26, 14,
+    -21, 4, -65, 12, -17, 33, 4, -18, -13, -9, 0, -31, -28, 71, -36, 52,
+    -2, -18, -46, -69, -62, 2, -2, 62, -49, -61, -50, 20, -53, -71, -3, -37,
+    -44, -86, -27, -123, -48, -14, -108, -12, -7, 13, -8, 30, 15, 34, -21, 64,
+    -37, -3, -27, 13, -21, -73, 65, -74, -33, -58, -26, -35, 23, -42, -25, -67,
+    23, -32, -8, 41, -5, -20, -21, 12, -76, -65, -109, 11, 11, 35, 50, 54,
+    -21, 6, -73, 3, 28, -9, -27, -33, 9, 0, 1, 36, -17, 17, -3, 67,
+    73, -42, 32, 30, -1, -8, 6, 63, 3, -76, 28, -51, 7, -87, 43, -21,
+    0, -58, 9, -86, 39, 57, -17, 44, 70, -24, 16, 53, 13, -37, 15, -35,
+    7, -66, 52, -21, -53, 44, 16, -27, 32, -55, -10, 42, 55, 15, -39, 28,
+    10, -3, -49, 83, 58, 59, -60, 18, -59, -40, 42, 65, -88, 22, 33, 99,
+    8, 93, 70, -25, -21, -46, 45, 52, 6, -39, -15, 23, -37, -23, 74, 40,
+    -76, 6, -112, 14, -6, -17, -28, 17, -51, -31, -31, 72, 47, 31, -41, 14,
+    -47, -32, 43, -68, 20, 2, 24, 13, 27, 32, -13, 6, -6, -68, -68, -77,
+    -54, 8, -43, 16, -8, 2, 73, -38, 63, 55, 59, 116, 95, 49, -49, 12,
+    31, 2, -42, -24, 59, 34, 3, 47, 35, -12, 35, 48, -6, -60, -49, -59,
+    -111, 22, 6, -22, 51, -13, -23, 18, -16, 63, 44, -30, -69, -22, 52, -40,
+    73, 43, -38, 34, -67, -22, -66, -43, 16, -43, 45, 25, -60, -34, 8, 3,
+    55, 83, 14, -17, -26, -42, -1, 26, 41, -18, -53, 52, -76, -29, -26, -47,
+    31, 12, 26, -50, -59, -35, -2, 10, -18, 17, 14, -75, -17, -38, 32, 24,
+    -20, -1, 75, 28, -37, 42, -22, 41, -61, 38, -22, 8, 10, -30, -45, 18,
+    -47, -27, -68, 38, 7, -44, 41, -68, 0, -16, 54, 77, 32, -10, 71, 16,
+    75, -3, 5, 12, 45, 3, -24, 51, 46, 15, -34, 14, -62, -26, -73, 42,
+    69, -91, -68, -37, -66, 43, -6, 40, 22, 39, 12, 30, 45, 7, -71, 14,
+    21, 2, 15, -34, -108, 6, -20, 5, -70, -32, 27, 16, -19, -68, -30, -77,
+    27, -6, 51, -65, -8, 36, -39, -4, -20, -80, 19, -29, -100, -8, 13, 12,
+    -107, 8, -85, 60, 18, -56, -51, 64, -5, -32, 64, 83, -87, -43, 36, -25,
+    -69, -108, 5, 13, -46, -107, 10, -38, 10, 36, -70, -56, 57, -11, 9, -66,
+    29, 11, 27, 18, 72, -18, 65, -21, 4, 18, -65, -22, -77, -35, -29, -127,
+    -11, -32, 13, -59, -77, 67, -14, 4, -25, -5, 5, 36, 24, 43, 56, -42,
+    -29, -16, -32, -82, 13, -3, -125, -72, 18, -84, -121, 24, -56, 4, -72, 39,
+    -27, -22, 39, 39, 31, 16, -58, 9, -23, 32, 65, 70, 32, -93, -34, 53,
+    -89, 38, 17, 49, -76, -104, -47, -14, -19, -93, 34, -51, -95, 47, -84, -89,
+    32, -44, -31, -34, 11, 13, 38, -13, -15, 5, 19, 31, -55, 1, -29, 21,
+    17, -36, 14, 45, 7, -7, -49, -62, 14, -75, 43, 14, 9, 58, -30, 58,
+    41, 15, -22, 42, -44, 68, -61, -68, -18, 102, -86, 28, -90, 29, 104, 10,
+    -10, -68, -19, 31, 40, -15, -8, 10, 111, 101, -39, -79, -49, 46, 50, 95,
+    -60, -51, -108, 83, -111, -53, 77, 108, -8, -68, 82, -87, -42, -62, -44, 109,
+    -102, 109, 12, 42, 99, -42, -3, 52, 18, 74, -110, -111, 4, -53, -106, 36,
+    -111, -80, 74, -60, -33, 13, 47, 73, 45, 66, -39, 43, -17, 16, 102, -36,
+    10, -30, 94, 6, -11, -3, 109, 76, 95, -53, 21, 14, -77, 88, -17, -52,
+    -48, -88, 105, 80, 40, -7, 29, -62, 69, -78, 103, -44, 5, -20, -72, 22,
+    -86, 102, 98, 22, 55, -118, 31, 82, -78, -106, 90, -90, -40, -75, -61, 90,
+    -95, -46, 49, 59, 44, -61, -101, 21, 50, -55, 70, 58, -20, 3, 50, 42,
+    -42, 98, 64, 47, 59, -49, -55, -69, 71, 66, -32, 73, -121, 96, -88, -81,
+    -5, -106, 103, -54, -34, 80, -46, 7, -8, 11, -36, -5, -11, 109, 96, 66,
+    97, -2, -29, 62, 43, -17, 59, 23, -105, 1, -66, 93, 82, 92, 33, -69,
+    103, -5, 44, -17, -46, 107, 12, -102, 40, 75, -48, -56, 88, -32, 87, 13,
+    28, -81, -73, -117, 94, -101, 98, -71, 34, -122, -100, -74, 65, 54, -113, 66,
+    83, -106, -19, -34, 63, -30, -21, -88, 31, 64, -10, -83, -122, -81, 31, -39,
+    87, 13, 43, 28, -28, 0, -87, 56, 96, 28, 28, 51, -89, 20, 17, -85,
+    111, 74, -34, 37, -99, 23, -103, -81, -56, 80, 68, -14, -106, -49, -114, 68,
+    -66, -49, 73, 1, 75, -52, 38, 44, -91, 104, -107, -88, 91, -38, -32, 26,
+    60, -61, -76, 88, 67, -83, -66, -17, -49, 68, -2, 9, -35, -10, 36, -75,
+    17, -87, -18, 90, 14, -42, 107, -67, -31, 8, 48, 92, -59, -83, -65, 74,
+    47, -38, -106, -6, -62, -54, -23, -92, -24, 33, 71, 48, -50, 70, 9, 10,
+    99, -40, -2, -111, -70, 75, -24, 38, 11, -78, 67, -74, -51, 37, -13, -108,
+    -116, -15, 50, 2, 82, -61, -51, -47, 91, 98, -60, 32, 58, -1, -49, 69,
+    32, -57, -71, -87, -37, 35, -74, 22, 3, 96, -56, -8, 90, 97, 19, -88,
+    69, 18, -84, 66, 13, -57, -89, -104, 72, -86, -3, 89, 86, 73, -20, 5,
+    -71, 9, -115, 29, -65, -82, 50, -83, 97, -67, -30, 2, 74, 59, -119, -40,
+    76, 42, 19, 1, 48, -100, 6, -36, -38, 72, 7, -102, 17, 14, -88, 44,
+    101, -85, 71, 75, 14, 3, -95, -19, 82, 54, -97, -73, -15, -59, -5, -76,
+    4, 53, -90, 72, 25, 93, -113, -12, 77, 76, -1, -52, 50, -107, -70, -19,
+    -88, -23, -92, -86, -36, -5, 82, -107, -95, -91, 83, -44, 3, -78, -94, 87,
+    -93, 19, -123, 75, -81, -15, -41, -17, 18, -86, 44, -102, 14, -66, -111, 5,
+    77, -67, -79, -4, -91, -58, 35, 104, -53, -87, 8, 62, -50, 47, 60, -64,
+    -77, -122, -83, 52, -29, 12, 55, -93, -92, -79, -14, 84, -36, 48, -42, -54,
+    92, -77, 70, -10, 59, 17, 75, -109, 3, -48, 92, 74, -100, -77, -58, 66,
+    -127, 38, 59, -62, -93, -117, 58, -62, -9, -111, -103, 81, 47, 8, 84, 70,
+    -94, -99, 80, -78, -41, -36, -35, -78, -42, -80, 98, -55, -82, -44, 60, -6,
+    -28, -16, 49, 47, -4, 28, 62, 43, 1, 51, -31, -31, 42, 71, 19, 17,
+    -102, 87, 28, 68, -18, 44, -10, -19, -32, -56, 49, -14, 50, -106, 78, 60,
+    -32, -60, -52, -33, -100, 108, -110, 61, 39, 30, -107, -68, 70, 40, 90, 69,
+    51, 95, 52, -91, 72, -13, -97, -29, 54, -10, 98, -95, 7, -100, 5, 20,
+    -20, 56, 111, -62, -49, 101, -84, 9, 20, 63, 51, -53, 69, -120, -97, -59,
+    -87, -61, -115, 17, 45, -96, 4, -29, 74, 2, -28, -23, 13, 60, 91, -51,
+    85, 103, 8, -26, -105, 107, -33, 13, -25, 1, -73, -8, 1, -111, 31, 21,
+    72, 13, -118, 97, 2, -70, -47, -67, 65, -91, -2, -71, 62, 75, 2, 109,
+    -9, 79, 96, -55, -108, -89, 75, 62, -92, -10, -81, -60, -54, -21, 24, -75,
+    27, -86, 50, 80, -85, 34, -46, 78, 28, -22, 73, -11, 24, 50, 51, 37,
+    7, -98, -57, -53, 33, 87, 111, -1, -62, -10, -9, 102, -88, -25, -37, -24,
+    57, -33, -3, 55, 102, -32, -89, 58, 48, 16, 98, 44, -70, 94, -25, -70,
+    40, 84, -69, 18, -6, -21, -40, -25, 69, -39, -26, 98, 1, 7, 0, 22,
+    -8, 24, -35, -38, 3, -13, -39, -37, 19, -3, 18, -39, -10, 12, 45, 27,
+    -23, -47, -37, -17, 23, -37, -13, 37, -26, -21, 7, 17, 12, -35, 1, -37,
+    45, -10, 24, 48, 25, -20, 48, -5, 7, -76, -21, -43, 0, 29, -43, -1,
+    9, -29, 39, -49, 40, -2, 43, -47, 4, -14, 22, -18, 38, -3, 65, -30,
+    -36, 18, 28, -83, -50, -62, -55, -61, 29, -8, -11, 8, -28, -19, -6, -15,
+    12, 9, 49, -9, 50, -43, -1, 41, 4, -51, 34, 30, -43, -77, -59, -13,
+    -63, -50, -5, -10, -63, -40, -47, 17, -8, -52, -49, 24, -16, -16, 35, -4,
+    -27, 33, -22, 44, 58, -37, 22, 19, -5, 10, -67, 64, -74, 7, -24, -28,
+    9, -15, -34, -11, -67, -10, 13, -20, 43, 33, 14, -6, -36, -41, 45, -47,
+    1, -27, -57, 23, -37, 9, -42, -23, -41, -25, -27, -25, -42, -39, 0, -44,
+    17, 4, 4, 24, 36, 32, 23, -40, 4, -23, -25, 8, -24, 19, 4, 41,
+    4, -9, -38, -27, 36, -11, -15, 66, -12, -13, 22, -3, 2, -39, -16, 6,
+    6, -3, 31, 8, -2, 34, -43, 31, -23, -35, 9, 29, -39, -10, -23, 11,
+    -16, 36, -6, -31, 34, 31, 37, -20, 6, -15, -14, -11, -50, -15, -15, -43,
+    -45, 42, 8, -38, -4, -40, -22, 10, -15, -26, 40, 10, -28, 7, 21, -4,
+    -1, -23, 21, -15, 5, -26, -6, -29, -24, -30, -12, -20, -35, -22, 16, -51,
+    23, 20, -31, -36, -43, -36, -39, 43, 25, 25, -33, 7, -18, -12, -36, -51,
+    -54, 16, -28, -20, 7, -34, -41, -38, 48, -11, 36, -39, 25, 6, 16, 25,
+    -5, 36, 5, -13, -18, -3, 11, -28, 47, 39, 0, 34, -22, -27, 38, -41,
+    -31, 32, 37, 19, -3, 9, -54, 41, 31, 31, -1, -1, 3, 2, 54, 3,
+    40, -6, -39, -26, -7, -8, 45, 49, 10, -3, -48, 43, 15, -13, -29, -26,
+    -38, -12, -37, 25, 72, -4, -12, 72, 37, -19, 39, -3, -18, 24, -10, 25,
+    11, 73, 1, -18, 42, 22, -21, 18, -16, -15, 9, 29, -6, -15, -26, -78,
+    8, 39, 32, -12, 16, 45, -9, -20, -24, -3, -12, 42, 5, -2, 45, -4,
+    22, -54, -40, -59, -39, 0, 7, -35, 15, -64, 28, -24, -20, 21, -29, 8,
+    -22, -8, -18, 32, 17, 0, 13, 34, 13, 13, -3, 55, 23, -3, -16, -64,
+    -71, -19, -68, -5, 43, 8, -13, -17, 18, -26, 29, 48, 37, 17, 48, -8,
+    -28, -38, -29, 37, 16, 51, 53, -35, -5, 22, 6, -16, -13, 9, -54, 10,
+    -14, 49, -64, -61, -51, 11, 10, 30, 0, 8, -45, -21, 63, -22, -27, 48,
+    -4, 38, 50, -33, -34, -41, -3, -48, -8, 2, 2, -4, 18, -8, 41, -65,
+    -32, -52, -15, 40, 7, 1, 54, -3, -2, -28, 18, 37, 19, -34, -23, 33,
+    29, 23, -12, -62, -82, 69, -19, 36, 27, -36, -22, -2, -28, -14, -57, 15,
+    38, 14, -34, -21, -37, 21, -4, -2, 40, -16, -59, -28, -27, 13, -54, -15,
+    -27, -41, 36, -22, 16, -47, -29, -73, 38, 26, -21, -64, -24, -41, -25, 6,
+    -1, -8, -8, -26, -12, 15, -36, 14, -14, -10, -33, -28, -49, 9, -27, -50,
+    44, -24, -27, 9, 37, -24, 18, -63, -22, 5, -54, -47, -26, -20, -34, -24,
+    5, -29, -11, -74, 16, -7, -19, 22, -45, -16, 4, -28, 3, -8, 51, -50,
+    6, -67, -18, -44, 26, 0, 4, -44, -2, 12, 23, -14, 17, -36, -15, 5,
+    20, 11, 26, 37, -35, 41, 36, 16, 26, -49, -41, -59, 3, 10, -1, -57,
+    -36, 23, -32, -1, -1, -14, -27, -40, -21, -47, 4, -53, -17, -26, -45, 0,
+    37, -43, 59, 20, 46, 27, -21, 9, -11, -45, 16, -31, -4, -20, 20, -1,
+    -62, -28, -3, 11, -65, -14, -2, 30, -25, 75, -45, 40, 41, -7, 14, -33,
+    29, -2, -1, 27, -28, 34, 1, -39, 12, -48, -62, 20, -44, -47, 2, -16,
+    -11, 12, 13, 23, 92, 127, -23, 92, -8, 9, -21, 15, -34, -50, 39, 15,
+    -28, -18, 5, 24, 31, 23, -3, -15, 26, 39, -29, 29, 25, -7, 43, 22,
+    17, 47, 104, 71, 78, 10, 42, 31, 47, 2, -43, 1, -1, 36, -35, -24,
+    3, 45, 18, 46, 20, 28, 25, -70, 30, 40, 28, 89, -3, 10, 70, 84,
+    95, 15, 7, 4, 38, -37, 4, -47, -21, 4, -18, 32, 2, -47, -49, -13,
+    -3, -80, 41, -23, 12, 38, 60, -55, 0, -26, 74, -48, -11, -42, -41, -8,
+    -46, -11, 13, -26, 41, -61, 57, -58, -24, -22, -55, -56, -15, 21, 39, -12,
+    33, 38, -10, 14, -46, -64, 53, -24, 0, 0, 33, -13, 19, -33, -9, 11,
+    53, -63, 40, 17, -37, 36, -47, 12, 47, 10, -23, -32, -40, 58, -3, 17,
+    -27, 62, -26, 56, 24, -57, -28, -35, 11, -54, 48, -55, 9, 37, -6, 36,
+    -22, 9, -14, 13, -25, -12, -44, 36, 44, -58, -51, 55, -29, -26, 1, 42,
+    -35, 14, -42, 54, 64, -1, 43, -37, 33, -67, -14, -64, -63, 11, 23, 55,
+    -21, 45, 53, 45, 35, -54, -18, -83, 6, 49, 50, 15, 8, 56, 21, 49,
+    -47, 40, 11, 8, 22, 28, -25, 53, -28, -34, 32, -38, -20, 65, -25, 19,
+    -59, -41, 50, 4, 63, 23, -24, 22, 41, -5, 19, -19, 51, 14, 56, 11,
+    5, -12, 7, -2, 4, -50, 47, -45, 35, -25, -26, -32, -44, 20, 18, -46,
+    0, -36, 9, 3, -19, 43, 16, 15, 46, 3, -46, 52, 54, 52, 28, 43,
+    28, 30, 24, -34, 33, -36, 47, -22, 51, 43, -58, 14, -5, 27, 40, -7,
+    -25, 73, 33, 18, 24, 25, 11, 19, 37, -27, -52, 34, -37, 13, 27, -27,
+    4, 44, -26, -7, 7, -29, -3, 45, -6, 46, -2, 62, -1, 44, -23, 8,
+    30, 32, 35, -34, -4, 6, 10, 49, -33, 27, 21, 19, 17, -40, 2, 38,
+    -45, -10, 17, -47, 46, 39, -30, 68, 39, 67, 99, 44, 14, 40, -14, 35,
+    44, 38, -40, -61, -31, -20, -3, -16, 31, -10, -19, -21, 20, 50, 27, -33,
+    6, -28, 20, 7, -20, 41, 44, -38, -45, -33, -21, 54, 7, 69, -16, -51,
+    39, -56, -24, -28, -19, 53, 53, 8, -39, -47, -4, -10, 12, -21, 3, -6,
+    -51, -42, 101, 52, -18, -48, -51, 40, -30, 65, -21, -64, -56, 1, 31, 25,
+    30, 19, 9, -56, -28, 18, -46, -1, -4, -62, -116, -75, -76, -18, -59, 57,
+    -28, 64, -41, 32, -8, 7, 15, 18, 30, 12, -35, 38, -8, 2, -11, 51,
+    2, -62, -3, -57, -75, -27, 1, 21, -12, 38, -40, 7, 38, -38, 1, 10,
+    15, -43, 15, 40, -14, -20, 56, 25, 8, 40, 22, -60, 19, 12, -16, 30,
+    -43, 19, -64, -80, -72, -13, 34, 61, 21, -39, -32, -60, 38, 40, -58, 28,
+    33, 11, 37, -7, 32, 4, 13, -2, 2, -33, -41, 45, 28, 31, 14, 44,
+    66, -29, -56, 35, 55, 9, -14, -11, -58, -61, -64, -72, -58, 11, -69, 27,
+    -14, 5, 1, -57, -55, 18, -4, -31, -14, -37, -22, -29, 56, -35, 17, -9,
+    59, 51, -27, 58, -13, -27, -6, -76, -26, 17, -57, -33, -38, -4, 58, 18,
+    -19, -3, 56, -7, -20, -23, 15, -44, -38, 16, 37, -52, 53, -34, 50, 82,
+    42, 18, -26, 7, -30, -90, -127, -73, -63, -61, -34, -2, -9, -22, -23, 47,
+    -34, -38, -1, -6, 61, 45, -7, 52, 17, -19, 20, 70, -14, -19, -47, -1,
+    -52, -86, -79, -55, -49, -76, -55, -46, 35, 19, -16, -29, 64, -28, 30, -7,
+    18, -10, -40, 46, -11, 55, -35, 14, 27, 8, 52, 45, 11, 16, 39, -19,
+    5, 29, -75, -50, -23, 59, 0, 22, 10, 11, 42, 29, 5, -71, -8, -38,
+    26, -25, 59, 70, 41, -17, 81, 25, -16, 4, -30, 13, 4, 51, 10, -3,
+    -26, 35, -46, -29, 8, 21, 46, -24, 47, -84, 12, -27, 14, -30, 31, 107,
+    59, -49, -39, 34, 68, 34, 51, 47, 23, -22, 20, 46, -46, -33, 25, -28,
+    32, 1, 29, 25, 20, -26, -10, 31, -20, 48, -49, -28, -43, -7, 48, 38,
+    -28, 5, 8, -35, -3, 35, -7, -39, 59, 16, 24, -60, -23, 20, 30, 12,
+    -29, -40, -7, 11, -57, -38, 20, 43, -29, 54, 10, -32, 49, 79, -21, 39,
+    24, 9, 50, -34, 19, -68, 33, 13, 25, -56, -27, -66, -50, -12, 0, -21,
+    -37, -11, -41, 18, 46, 5, 6, 8, -30, -18, 43, 23, -41, 9, 39, 7,
+    12, 8, 0, 47, -55, 54, -46, -68, 40, 49, -21, -26, 8, -38, -55, 14,
+    41, 43, 56, 61, -21, -5, 52, -39, 44, -56, -39, -34, -53, -25, 44, 30,
+    33, -7, 15, 14, 8, 42, 48, 22, 7, 27, 56, -33, 31, -34, 56, -42,
+    -21, -51, 33, -9, 51, -15, -4, 69, -22, 26, 29, 48, -14, -67, -51, 13,
+    -53, -44, -1, 28, 0, -57, -40, 40, -61, 32, 1, -33, -64, 30, 29, 42,
+    -1, 44, -37, 33, 0, -56, -23, -31, -10, -14, -28, 4, -14, -20, -53, -44,
+    -37, -33, 16, -1, -48, -27, -29, 64, -18, 7, -23, 68, 15, -54, 50, -9,
+    -34, 59, 22, 64, 33, -67, 59, -8, 40, 29, 63, -12, -28, -2, 51, -50,
+    -10, 25, -66, -3, 18, -59, -32, 12, 6, 63, 48, -28, 33, 40, -19, -38,
+    62, -5, -6, -45, 44, 50, -64, 33, 26, -39, -8, -65, -48, 68, 49, 36,
+    47, -66, -57, -38, -22, -53, 8, 49, -25, 39, 32, 4, -34, -8, 34, -72,
+    43, -35, -31, 62, 24, 63, 56, 51, 45, -63, 24, -69, -15, 20, -7, -42,
+    -53, 22, -26, -38, -26, -23, -39, -46, -24, 27, -42, 46, 64, 7, -58, 13,
+    7, 70, 28, 43, 46, -16, -33, 26, 62, -21, -42, 0, -28, 12, 20, 2,
+    -63, 1, 23, -23, -66, 58, 34, -36, -14, 6, 51, -26, -28, -21, -52, 50,
+    -16, 8, -41, 70, -33, 37, 14, -72, 0, -29, -9, -57, -50, -52, 20, -21,
+    32, -50, 54, -6, -72, 28, -49, -29, -68, -13, 70, 24, 61, -21, 34, 26,
+    -38, -6, 34, 39, 24, -2, -38, -52, 16, 5, -10, -3, -51, 8, 5, -28,
+    -1, 40, -5, -15, 0, 110, -4, 98, 43, 28, 35, 83, 18, 1, 37, -5,
+    28, 2, -31, -63, 81, 18, -52, -32, 19, 21, -16, 63, 69, 14, 72, 59,
+    -13, 25, 84, 46, 88, 19, -14, 38, -16, 6, 45, 50, 16, 67, 43, -15,
+    5, 20, 60, 13, 29, 21, 22, -4, 82, 2, 3, 107, 19, 10, -14, 87,
+    42, 74, 11, 4, 4, 0, 59, 46, -54, 46, 57, 26, 17, 41, 10, 40,
+    -39, -4, 28, 9, -37, -11, 25, -22, 3, 65, -44, 52, 6, 22, 31, 34,
+    -56, -34, 30, 38, -32, 21, -15, 37, 103, 55, -23, -8, 6, -1, 32, 7,
+    32, 12, -35, 40, -11, 48, 17, -26, 72, -25, 47, -4, -17, 1, 36, 21,
+    19, 4, -36, 17, -12, -3, 62, 30, 35, 7, -85, 9, -44, 45, 14, 7,
+    -58, 28, 72, 3, -4, -9, -75, 32, -56, 0, 1, -5, -47, -48, -23, -53,
+    -16, 7, 14, -85, 6, -7, -97, 39, 62, -70, 6, -71, -25, 18, 97, -16,
+    -45, 65, -8, -5, 61, -16, 10, -14, -48, -16, -127, 20, -43, -29, -65, 18,
+    45, 20, -54, -10, 14, -66, -79, 52, 54, 46, -30, -7, 41, 60, -3, -2,
+    -18, -41, -36, -39, -97, -11, -47, -49, 25, -14, -21, 42, -39, 45, 18, -53,
+    -25, 33, 53, -64, -50, -35, 68, -74, -23, 40, 0, -71, 15, 7, -24, -26,
+    -85, -5, -17, 8, 56, 10, 33, -17, 36, -38, 22, -13, -22, 82, -18, 25,
+    65, 61, 24, 24, 50, -62, -21, -35, -85, 8, -25, -107, -6, -53, -33, 30,
+    56, 6, 26, -30, 12, -43, 28, -41, -11, 25, 52, -46, 15, 47, 8, -16,
+    38, 1, 43, 40, 25, -14, 37, -73, -30, -48, 46, 38, -75, -44, 47, 46,
+    -3, 15, -16, 39, -13, 47, -17, 69, -62, -3, 48, 2, 33, -63, 36, 15,
+    -7, -40, -34, -41, 44, -20, 8, 29, -15, -3, -41, -26, -59, -75, -105, -64,
+    3, -49, -68, 14, 42, -72, 2, 30, 34, -78, 18, -10, 37, -31, -66, -48,
+    -1, -31, 2, -6, -46, 12, -16, 45, -12, -8, -36, -29, -81, -29, -7, -13,
+    -18, 0, 8, 1, -74, -3, -30, 36, 40, -7, -38, 16, 9, -39, 87, 16,
+    22, -36, -17, -48, -59, -81, 13, 45, -69, -12, 28, 28, -29, -38, 15, 36,
+    36, -57, -92, -58, -61, -45, -34, 9, -9, -30, 35, -20, -26, -76, -73, -28,
+    -39, 51, -3, 4, 33, -27, -42, 1, -39, 69, 48, 56, 20, -2, -91, 38,
+    30, 32, 50, -40, -77, -52, 31, 38, -77, -35, -8, -69, 17, 10, -71, 48,
+    -49, 13, 20, -5, 0, -62, 8, -50, -57, -9, -11, 33, 56, -47, -4, 14,
+    -54, 49, 32, 1, -46, 2, -28, -20, -32, 28, -60, 35, 47, -53, -37, 47,
+    16, -16, -49, 21, -69, 65, -24, -7, 8, -5, 21, -5, 1, -43, -16, 24,
+    15, 31, -8, -71, -15, -86, 32, -87, -17, 67, -32, 46, -10, -66, 48, 37,
+    9, 24, 38, 25, -16, 17, -20, -9, 52, -6, 34, 49, 22, 49, -3, 60,
+    78, -2, 22, -58, 48, 46, -1, 24, 11, -41, 13, -34, -20, 30, -11, -37,
+    -61, -25, -2, 1, -87, 45, -57, -75, 48, 30, 89, -2, 26, -51, -64, 62,
+    -31, 12, 10, 38, 37, 24, 35, -33, -65, 14, 46, 78, 24, -12, 19, 82,
+    36, 87, -38, 55, 77, 95, -30, 19, 0, -55, 63, 24, -30, 1, 29, -56,
+    35, -27, -6, -40, -5, -39, 34, 42, 30, 15, -44, 8, 64, -56, 34, -59,
+    67, 49, -58, 26, -34, -59, 34, -9, 28, -20, -23, -40, 68, 48, -30, 39,
+    -4, 54, 39, 32, -17, 41, 2, -2, -7, 14, 52, -69, -28, -50, 18, -8,
+    -66, -22, 37, -42, 55, -7, -19, -12, 2, 25, 29, 30, -50, -54, -45, 8,
+    -58, -65, -11, -4, -89, 28, -19, -19, -9, 72, 4, -24, -38, -6, -1, 4,
+    -19, 7, -51, -32, 31, 53, -10, -59, 26, -52, 21, -30, -27, -76, -61, -3,
+    -57, -93, 33, -6, 9, -24, 58, -37, 52, -32, 49, -23, 58, 33, 17, -17,
+    -26, -4, -30, -25, -26, 48, -19, 18, -43, -27, -34, -62, 25, 44, -59, -41,
+    38, 18, 4, 0, 51, -31, 32, -127, -5, -54, 18, -44, 3, 27, 29, 39,
+    31, -1, -26, -41, -10, -30, -51, 50, -21, -7, 15, 35, -41, 39, 31, -56,
+    -39, 11, 19, 17, -9, 18, 50, 29, 49, 52, 6, -3, 45, 75, 43, -28,
+    98, -42, 41, -16, 16, -18, -26, 10, -45, -50, -14, 21, -55, 20, -18, -50,
+    48, -7, 23, 90, -13, 5, 68, -56, 2, -45, 56, -47, -15, -43, -24, -37,
+    15, 27, -62, -38, -3, -3, 22, 0, -7, 36, 0, 19, -20, 8, 20, 24,
+    21, 52, 66, -1, 25, -18, 41, -33, 28, -34, 62, -17, 29, 11, -36, -45,
+    -22, -25, 3, 0, 43, 25, -9, -18, -110, 46, 27, 76, -4, -24, 42, 66,
+    20, 0, -23, -12, -9, 65, -32, -12, -37, -2, 2, -6, -81, 0, -48, 43,
+    18, 24, 43, -72, -79, 69, -96, 53, 55, -67, 7, -6, 51, -80, -9, 19,
+    18, -33, 83, 77, 50, -67, 8, -68, 29, 27, -32, 16, -55, 45, 53, -52,
+    -41, -35, -13, -34, 42, -63, -32, -18, 19, 27, -62, -56, -4, 75, 13, -56,
+    56, -61, -17, 76, -2, 11, 5, 11, 96, -20, 13, -47, -47, -44, -83, 14,
+    -59, 39, 38, 6, -4, 14, 29, 22, -26, 40, 26, -4, -39, 48, -8, 20,
+    7, 42, -25, 50, -16, -22, 62, -12, 27, -91, -11, -14, -2, 63, -20, -12,
+    14, -26, 31, 62, 9, -54, 21, -21, 75, -4, 26, -12, 53, -29, 1, -29,
+    -10, -32, -67, 12, 19, -27, -36, 63, -26, -10, -34, 51, -35, 39, -25, 15,
+    -35, 15, -75, -17, -12, 76, 51, -8, 80, -66, -25, 0, -26, -1, -55, -33,
+    50, -28, -37, -64, -33, 32, -58, -17, -6, 19, 50, -104, -78, -48, -14, 11,
+    -24, -27, 14, -21, 42, 5, -41, -4, -6, 38, 42, 34, 33, 66, 49, -16,
+    -38, 58, -21, 47, -40, -55, -87, -14, 24, -53, -1, 51, 36, 44, 40, -19,
+    10, -49, -39, -54, 31, -75, -66, 45, -23, 61, 29, -53, -52, -17, -50, -74,
+    -16, -97, -73, 49, 3, 71, 32, 3, 14, -5, -8, -72, 36, 1, 25, 29,
+    -75, -77, -7, 24, -9, 43, -29, 41, -4, 19, 64, -27, -25, -127, -45, -52,
+    44, -8, -29, 56, 10, -6, 6, -13, -41, -28, -72, 34, -10, 51, -19, -83,
+    -69, -5, -42, 68, 25, -15, -9, -18, -32, -61, -79, -10, 43, 73, 20, 39,
+    37, -1, -66, -6, 30, -26, 9, -59, 51, -48, -6, -9, -35, 1, -22, 51,
+    46, 34, -28, -29, -62, 0, -9, -1, 17, -29, -15, -20, -4, -17, -70, -17,
+    -27, -20, 31, 33, -24, -63, 20, -59, 52, -9, 29, -35, -69, 63, 18, -76,
+    -68, 44, 21, 22, 21, 4, -51, 14, -26, -14, 2, -25, -29, -23, 49, -6,
+    -13, -83, 10, -23, 29, 15, -16, 13, -32, 26, 33, 38, 20, -33, -60, -13,
+    -41, -9, 23, -36, 50, 8, -17, 15, -68, -30, -68, 26, -30, -76, 43, 39,
+    14, -56, -59, 65, -22, 54, -45, 1, -77, -33, -63, -78, -36, 25, -14, 14,
+    0, 21, 5, 30, 45, -60, 69, 6, 59, -7, 53, -92, -29, 57, -22, 29,
+    47, 54, -40, -85, -1, -56, -33, -51, -4, 32, -62, 1, 32, -1, 17, -53,
+    -7, 28, 50, -7, 22, -3, 18, 8, 52, 21, 41, -28, 67, -43, -58, -62,
+    23, 17, -13, 24, -111, -99, -105, -58, -66, -12, -11, 1, 6, -23, -2, -71,
+    -54, -24, 44, -37, -3, 8, -16, -15, -53, 17, 47, -41, -19, -64, 14, -65,
+    -6, 27, -18, 5, -107, -111, -15, -10, 16, -79, -41, -62, -86, 17, -7, 2,
+    56, 7, 44, -45, -63, 57, -4, 30, -67, 21, 12, -1, 52, 34, -54, 19,
+    -16, -72, -84, 27, 44, -15, -23, -7, 10, 10, 34, -65, -14, 21, 20, 22,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_0_bias[16] __attribute__((aligned(4))) = {
+    -30, -22, -20, -39, -18, -36, -24, -25, -28, -2, -31, -18, -10, -16, -7, -107,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_0_multipliers[16] __attribute__((aligned(4))) = {
+    1210678341, 1478433545, 1593032539, 1083629779, 2006802047, 1331296129, 1942109748, 1082465622, 1537700862, 1812830480, 1422299529, 1946486276, 2118028981, 1684019316, 1517853489, 1551085537,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_0_shifts[16] __attribute__((aligned(4))) = {
+    -10, -10, -10, -10, -11, -10, -11, -10, -10, -10, -10, -11, -10, -10, -10, -10,
+};
+
+static const int8_t TEST_MODEL_fc_perchannel_1_blocks[256] __attribute__((aligned(4))) = {
+    81, 34, -29, 37, 42, 94, 35, -123, -34, -85, -127, -74, -26, 79, 16, 61,
+    -70, -127, 28, 50, 84, -94, -73, -72, -82, -107, 75, 97, -63, -32, -20, 26,
+    -43, 28, 81, -127, 85, -5, 41, 17, -8, 110, -92, 103, -66, -14, 89, -59,
+    69, -127, 82, 89, -125, 85, 84, 66, 61, -72, -52, 59, -65, 16, -9, -13,
+    -32, 42, -90, -127, -49, -49, 108, -127, -89, -110, -54, -110, 26, 79, 127, -84,
+    127, -52, 97, -73, 78, -92, -59, -3, 27, -53, 100, 67, 34, 14, -47, -57,
+    105, -48, 87, -29, 55, 33, 121, 127, 123, -78, 16, 0, -43, -124, -77, 15,
+    90, 77, -112, -81, -59, 16, 59, -22, -99, 26, -1, 127, 91, -111, -79, 117,
+    31, 19, -85, 51, 61, -5, -39, -116, 49, 11, 15, -127, 35, 63, -38, 70,
+    87, 1, -90, -71, 0, 73, -22, -46, -52, -98, -68, 62, -17, -71, 127, -54,
+    -62, -19, 108, -79, -122, -15, -5, -119, 84, -23, 64, 2, 3, -127, 42, 60,
+    -61, -79, 87, -120, -51, -127, 57, 104, -41, -19, 3, -57, 60, 93, -15, -15,
+    37, 11, -103, 70, 65, -115, -127, 60, 33, 43, -53, -13, -106, 101, 117, -24,
+    -78, 120, -23, -68, 118, 108, 70, -38, -68, -40, 103, 69, 2, -127, -36, 1,
+    -127, -70, -59, -79, 62, 115, 114, 115, 16, 78, -42, -6, -33, -11, 61, 13,
+    21, 85, -24, -26, 47, 111, 108, 87, -127, -107, 0, 87, 56, -44, 28, -95,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_1_bias[16] __attribute__((aligned(4))) = {
+    -32, 91, 68, -5, -1, -25, -10, 2, -6, 114, -29, 0, -7, 0, -37, -21,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_1_multipliers[16] __attribute__((aligned(4))) = {
+    1210508409, 1568967679, 1270160647, 1272716394, 1194457717, 1376332277, 1209255266, 1339863268, 1345613859, 1331176551, 1157062028, 1367885628, 1360786683, 1219373483, 1291915903, 1251560798,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_1_shifts[16] __attribute__((aligned(4))) = {
+    -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6,
+};
+
+static const int8_t TEST_MODEL_fc_perchannel_2_blocks[160] __attribute__((aligned(4))) = {
+    -49, 71, -88, -111, -91, 109, 39, -127, -120, -96, -83, 25, -39, -126, -51, -28,
+    -22, -127, -60, -60, -70, 88, -12, 12, -21, 64, 40, -110, 68, 75, 52, -85,
+    -89, -33, 6, -76, 43, -34, 26, 43, -36, 41, -127, -29, 34, 62, 90, -84,
+    6, -85, 125, 101, 35, -54, -70, -41, -94, -3, 127, -10, -22, 111, 60, 8,
+    41, -69, 83, -125, -8, -26, -96, 92, -45, -120, 37, 10, -127, -19, 91, -53,
+    -100, -39, -4, 36, 22, -30, -21, 60, -46, 2, 127, -14, 60, -66, -64, -87,
+    -98, 34, -10, -73, 3, 22, -77, -48, -15, -2, -71, -29, 44, 127, 65, -17,
+    66, -50, 83, -46, -62, -60, -38, -36, 38, -79, -127, 58, -76, 52, 74, 17,
+    -30, 3, 107, -75, -112, -52, -127, -20, 92, 74, 85, -52, 41, -3, -113, 82,
+    -85, -127, -122, 107, 29, -74, 23, 29, 17, 90, -100, -33, -9, -87, -115, -8,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_2_bias[10] __attribute__((aligned(4))) = {
+    -223, -315, -95, 119, -160, 156, -88, -170, 355, -94,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_2_multipliers[10] __attribute__((aligned(4))) = {
+    1700269960, 1666302432, 1376427561, 1761131365, 1558492965, 2035511059, 1720857592, 1192445532, 1780223793, 1883467259,
+};
+
+static const int32_t TEST_MODEL_fc_perchannel_2_shifts[10] __attribute__((aligned(4))) = {
+    -8, -8, -8, -8, -8, -8, -8, -7, -8, -8,
+};
+
+static const ml_fc_s8_layer_t TEST_MODEL_fc_perchannel_layers[3] = {
+    {16, 784, 8, 3136, NULL, NULL, TEST_MODEL_fc_perchannel_0_blocks, TEST_MODEL_fc_perchannel_0_bias, 128, -128, 0, 0, TEST_MODEL_fc_perchannel_0_multipliers, TEST_MODEL_fc_perchannel_0_shifts, -128, 127},
+    {16, 16, 8, 64, NULL, NULL, TEST_MODEL_fc_perchannel_1_blocks, TEST_MODEL_fc_perchannel_1_bias, 128, -128, 0, 0, TEST_MODEL_fc_perchannel_1_multipliers, TEST_MODEL_fc_perchannel_1_shifts, -128, 127},
+    {10, 16, 8, 40, NULL, NULL, TEST_MODEL_fc_perchannel_2_blocks, TEST_MODEL_fc_perchannel_2_bias, 128, 48, 0, 0, TEST_MODEL_fc_perchannel_2_multipliers, TEST_MODEL_fc_perchannel_2_shifts, -128, 127},
+};
+
+const ml_fc_s8_model_t TEST_MODEL_fc_perchannel = {3, TEST_MODEL_fc_perchannel_layers, 784, 13464};
+
+static const int8_t TEST_MODEL_fc_int4x8_0_blocks[6272] __attribute__((aligned(4))) = {
+    44, -49, -44, -29, 52, 68, 14, 14, 92, -80, 14, -49, 68, -13, 31, 64,
+    15, -18, -61, -63, 77, -51, -29, -19, 65, -63, 69, 11, -53, 46, -18, 67,
+    -75, 15, 62, -44, 29, -52, 5, 61, 33, -76, 76, -64, -78, -61, 44, -76,
+    -68, -37, -95, 43, -17, -36, -4, 65, -65, 53, 33, -13, 64, 67, 18, -53,
+    60, 62, -35, -27, 30, -3, 68, -19, -61, -18, 47, 52, 18, -5, -20, 63,
+    -16, -29, -62, -61, 47, 12, 33, -50, 47, -44, 16, -99, 42, 127, 29, -1,
+    -50, 77, -17, -78, -60, -63, 4, -1, -35, -70, -47, -18, -13, -29, -77, -64,
+    29, -59, -17, 52, -67, -50, -77, 46, -19, -43, -48, -33, 75, 28, -17, -64,
+    68, -52, -83, 60, 49, 90, -3, 17, 43, 44, 31, -80, -13, -19, -4, 48,
+    34, 10, 47, -35, 33, 2, 45, 66, -14, 36, -45, -21, -59, 11, -92, -77,
+    95, 36, 29, 62, 43, 19, 35, -27, 78, -68, 50, -14, 29, -33, -31, 77,
+    -48, -61, -16, 17, -19, -19, -14, -4, 20, -20, 16, -1, -31, 77, 3, 0,
+    28, 61, -67, -60, -59, -62, 28, -63, 28, 58, 75, 16, -18, -80, -49, -80,
+    -80, 31, -47, -65, -12, 30, -30, 35, -64, -3, 1, -1, -21, -50, -29, -67,
+    12, -93, 29, 44, 50, -64, 77, -13, 1, -50, 34, -37, -63, 47, -61, -50,
+    19, 51, 66, 64, 20, 2, -62, -60, 49, 31, -4, 76, -75, -3, 93, -53,
+    67, -52, -48, -50, 13, 63, -76, -100, -51, -5, 14, 4, 95, 4, 95, 45,
+    -28, 44, -4, -33, 29, 79, -2, 19, 19, -31, 12, -1, -65, 14, 20, -61,
+    -38, 48, -63, -11, 52, -14, -4, -49, 1, -66, 78, -64, 17, 45, 43, 48,
+    -3, 26, -66, -76, -63, -12, -62, -63, 31, 31, -16, 66, -5, -59, 60, 81,
+    59, 78, -35, 29, 36, -33, 18, -62, -2, -31, 15, 46, -48, 69, 28, 77,
+    -92, -80, 62, -50, 49, 83, -31, 1, 59, -64, 18, -20, -3, 5, -49, 16,
+    -47, -45, -28, -53, -3, 67, -1, -37, 28, 17, 50, -63, 2, 61, -47, 35,
+    60, -29, -51, 45, -20, 47, -63, 51, -36, 17, -13, 69, 82, 36, -16, -19,
+    -59, -50, -50, 61, 50, 32, 14, -30, 67, -4, 45, 35, -14, -2, 34, 45,
+    44, 31, 15, 46, 78, 51, -16, 14, -15, 62, -45, 51, 64, 34, -46, 49,
+    13, 49, -49, 1, 33, 64, -36, 31, -60, -17, 29, -64, -15, 62, 45, -31,
+    -31, 30, 28, 31, -62, 20, -2, -50, 25, -1, -18, -64, -64, 16, -16, 15,
+    2, -46, -29, 17, 31, 17, -47, 64, -17, 33, -17, -66, -21, 47, -62, -52,
+    -50, 13, -16, 10, 32, 2, -30, 14, 19, -34, 66, -17, 77, -30, 15, 32,
+    -15, 79, 43, -31, 4, 20, -19, -51, 17, -49, -18, -14, 0, -18, -19, -14,
+    -35, 14, 64, 20, 18, -97, -32, -18, -33, -32, 32, 60, 28, -15, -2, 50,
+    50, -30, 19, 47, -4, 79, 74, -61, -15, -47, 27, 17, 36, -18, 63, 33,
+    -29, -14, -85, 46, -63, -61, 0, 33, 28, -35, 0, 31, 26, 33, -15, 2,
+    -63, -2, 10, 16, 28, -64, 30, 31, -45, 43, -17, -52, -45, 30, -13, -51,
+    47, 32, 20, 15, -33, -79, -33, -80, -64, 32, -18, 19, -43, 76, 48, 2,
+    16, -32, 34, 14, -32, -37, -17, 16, 115, 63, -76, -43, -17, 77, 111, 12,
+    19, -16, -63, -79, 31, -32, 16, -1, 15, 49, 18, 49, 15, -46, -14, 48,
+    -31, -31, -4, -7, 48, 35, -18, -32, 32, 14, -15, 61, -61, -62, -1, -95,
+    74, 63, 50, 65, -62, -1, -45, -18, 19, -35, 83, 2, 26, -16, -7, -15,
+    -31, -14, 77, 29, -19, 44, -18, 30, -45, 31, -31, 17, -1, -28, -17, 18,
+    44, -31, 2, 4, -28, 49, 79, -4, 13, -18, -1, -32, -82, 60, 1, 2,
+    -65, 29, 46, 62, 48, 2, 35, -13, 63, 15, 31, 13, -18, 34, -35, 1,
+    33, 15, -16, -30, -12, 47, -17, -33, 16, -15, -50, -18, -34, 3, 19, 61,
+    46, -12, 45, -34, 16, -48, -16, -2, 60, 32, -32, -46, -20, -19, 50, 20,
+    1, 3, 3, 2, -63, -62, 32, 2, -31, 36, -66, 48, -13, -5, -15, 17,
+    -80, 16, 1, -79, 13, 13, -30, 34, 29, -60, -31, -33, 30, -50, 14, -33,
+    -47, -19, 45, -36, -32, -61, -13, -49, -33, -62, -52, -31, -76, -63, -76, -16,
+    15, 29, -30, -32, 0, 51, 33, 77, 33, 62, 29, -63, 64, -47, 62, -14,
+    -15, -17, -30, 31, -49, -29, 33, -29, 62, -14, -62, 32, 50, 50, 0, 2,
+    -64, -46, -4, 18, -19, 32, -17, 30, -1, 28, -13, 35, 35, -3, 35, 51,
+    -4, -17, 61, -34, -50, -2, -30, -2, -47, 29, -3, -3, -51, -63, -67, -32,
+    28, -48, -53, 31, 14, 4, -32, -17, -14, 20, -16, -48, -15, -35, 1, -49,
+    -62, 30, 31, -64, -15, -33, -14, -32, 2, 16, -46, 13, 16, -22, 33, 34,
+    35, -62, -31, 18, -30, 16, 16, 67, -78, -33, -32, -18, -17, 14, 33, 32,
+    -18, -33, 18, 3, 46, -31, -18, -15, -50, 45, -16, -19, -29, -32, -28, 35,
+    19, 2, 46, -14, 2, -79, -34, -51, -18, 32, 30, 32, -15, 1, 29, -48,
+    30, -18, 17, 0, -16, -32, 29, 30, 0, -16, -32, -3, -45, -12, 19, -21,
+    -35, -64, 14, -32, -34, 1, -14, -33, 47, 20, 48, -51, 3, 62, 1, -31,
+    34, 34, 13, 47, 65, -3, 78, 33, -13, -1, -60, 27, -63, 34, -94, -45,
+    -33, -2, 15, -35, 35, -34, -27, 18, 35, 47, 0, 48, -1, 15, 49, -15,
+    -77, 13, 64, -33, 31, -5, 17, 49, -1, -14, -29, 20, 33, -2, -14, -48,
+    62, -44, -14, 78, 2, 63, 32, -13, 48, 66, 18, 61, -44, 82, 19, -3,
+    33, 50, -48, 33, -14, -2, -28, 48, 48, 31, -33, 49, -46, -49, 50, -14,
+    30, -30, 1, -2, 63, -28, 47, 49, -31, 31, 61, -34, 79, 45, -18, 13,
+    17, 50, -2, -2, -14, -47, 34, 31, -35, 17, 44, 17, -30, -85, 30, -17,
+    13, -66, 35, 14, 45, -33, 29, -28, 19, 32, 30, -1, 9, -15, 32, -3,
+    -46, 34, -16, 42, 3, 31, -12, -18, -17, -64, 1, -4, 19, -13, 34, -18,
+    -45, 64, 30, -1, 13, -29, 18, -20, -33, 30, -51, -18, 46, 18, -4, 16,
+    -33, 2, 12, 35, 20, -48, 63, -47, -18, 17, 46, -48, -16, 2, -43, 34,
+    -18, 13, 20, -30, 14, 30, -31, 1, -14, -2, 62, 19, 13, 62, 34, 50,
+    -2, 32, 32, 17, -16, -16, -21, 61, -18, -63, 34, 3, 32, 18, -36, 45,
+    -51, -18, -5, -33, -31, -17, -35, 16, -30, 17, -48, -46, 3, -33, 66, -16,
+    -50, 16, -34, -5, 33, -30, 50, 31, -78, -77, 2, 52, 36, -43, -60, 67,
+    -43, 94, 60, -50, -43, -61, 47, -51, 48, 62, -60, -11, -32, 35, 45, 62,
+    0, 16, 0, -34, 67, 68, 47, -59, -81, 50, -61, 1, 37, 82, -12, -96,
+    -11, -3, 53, -62, -51, 12, 2, -65, -78, -34, -66, -63, 46, -3, -93, 13,
+    1, -37, -46, -80, 34, -16, -82, -60, -77, -37, 9, -32, -34, -63, 15, 29,
+    -65, -5, -27, -33, 1, -68, -21, 30, 81, -21, 58, 20, -18, -68, -43, 27,
+    -63, -94, -70, -30, 32, 78, 66, -46, -51, 46, 76, 75, 68, 52, 47, 35,
+    33, 42, 51, 17, -77, 79, 46, 60, -34, 19, -51, -75, 66, 30, -34, 1,
+    -18, 25, 46, 26, 19, -19, -15, 12, 32, -28, 13, -95, -6, -99, 1, 4,
+    48, 95, -49, -46, 79, 67, -95, 27, -69, -31, 36, -46, -69, -80, 31, 63,
+    46, 49, -13, -64, -32, -1, 16, 61, 59, -86, -111, 11, 46, 44, -17, -16,
+    -79, -31, 81, 28, -44, -12, -44, -50, -29, -49, -29, -45, 65, 78, -66, 18,
+    -29, -12, -98, -20, 63, 51, 42, -55, -44, 94, 78, -11, -51, -29, -16, -76,
+    -35, -82, -109, 33, -13, -82, -51, 84, 81, 1, -14, -46, 4, 45, -34, 28,
+    34, -14, 3, -30, -60, -18, -54, -52, -37, 30, -13, -12, 60, 62, 12, -35,
+    46, -33, 60, -67, -69, 59, 33, 53, -92, 0, 78, 76, -19, -34, -77, -63,
+    -2, -69, 42, 1, 75, 32, 75, 92, 31, -22, 46, -65, 59, 66, 0, -1,
+    -66, -34, -48, -17, 34, 12, 36, 44, -29, -96, 28, -5, -54, 49, 11, 10,
+    1, -96, 33, -31, 5, 1, 19, -46, 79, -46, -94, -54, 27, 43, -31, -29,
+    95, 30, -68, 44, 19, 27, 18, 44, -63, -12, -13, 29, -78, -83, 27, 5,
+    -93, -68, -35, -63, 45, -86, -30, 26, 0, 65, 12, 32, 5, 15, 31, -4,
+    -69, 4, -16, 45, -50, 64, 45, -62, -51, 21, -47, 29, 65, -37, -54, 10,
+    -48, 81, 94, 50, 93, 93, -44, 60, -85, -2, -82, -44, -12, -17, -76, -83,
+    95, 0, 85, -47, 21, -48, -35, -21, -37, -60, 16, 92, -29, 46, -1, -3,
+    -65, -14, 4, 11, 0, -37, 17, -36, 18, -69, -68, 95, -77, -46, -45, -18,
+    -34, 94, -84, 10, -68, -16, 98, 84, 44, 48, -2, -82, 93, -53, -67, -69,
+    34, 12, 84, -21, 59, -44, 83, -63, 38, 60, -1, -2, 35, 52, -76, 99,
+    -3, -5, 81, -4, 110, 84, -31, -75, -27, 58, 33, -63, -54, -4, 27, 68,
+    64, 1, -16, -12, 51, -83, 51, 0, -95, -50, -86, 79, 79, -33, -79, 14,
+    47, -53, -59, -67, 5, 60, 93, -28, 85, -28, 65, -53, 1, 67, -70, -35,
+    59, 35, -60, 1, -51, -17, -47, -67, 32, -54, -2, 53, 0, -52, 2, -34,
+    68, -55, -92, -35, -52, -12, -32, 17, -16, -45, -1, 28, -66, 50, -14, -15,
+    -77, 1, 50, -78, -35, 58, -28, 33, 26, -62, 32, -87, 75, -16, -38, -61,
+    -20, 75, -46, 77, 31, 57, -27, 1, -87, -95, -80, 1, 21, 11, 93, 65,
+    -110, 81, -3, -96, -96, -19, 67, -14, 84, 2, -34, 63, 78, 29, 1, -30,
+    60, -98, -44, -17, -48, -31, 31, 31, 91, 37, -60, -6, 69, -35, 29, -78,
+    -96, 4, 83, -46, -63, 32, 14, 47, -59, -52, 44, -53, -70, -49, -35, 67,
+    31, -14, -5, -42, 109, 45, -17, 3, -78, 34, 11, -46, -65, 32, -46, -62,
+    -49, -28, 85, 2, 68, -45, -34, 5, -93, -31, 2, -29, 31, 52, 59, -84,
+    -50, -63, -47, -1, 11, -17, -12, -35, 18, 28, 12, -52, -38, 16, -76, -15,
+    68, -76, 36, 84, -32, -79, 64, -62, 5, -16, 60, -71, -6, 3, -46, -47,
+    93, -34, 107, -3, -53, -36, 53, 67, 21, -53, 111, 66, -52, -22, -47, 33,
+    11, -32, 51, -76, 0, 51, -87, -1, -31, 42, -59, -18, 43, -30, 3, 34,
+    68, -86, -2, 34, -75, -79, 21, -80, 67, 15, -59, 83, -48, 15, -1, -64,
+    100, -18, -76, 29, 58, -85, -44, -32, -14, 78, 29, 51, -49, 3, 44, -49,
+    26, -47, 30, 31, -34, 52, 30, -64, 79, -54, -47, 46, -12, 51, -77, 75,
+    -45, 74, -13, 30, 13, -45, -51, -52, -80, -6, -76, 85, -60, 63, 81, 27,
+    61, 21, -49, -43, 45, 47, -30, -16, 70, -63, 15, -77, 36, 68, 30, -83,
+    48, -11, -33, -11, 20, 10, 90, -68, -96, -66, 63, 111, -47, 26, -65, 18,
+    78, 108, -44, -70, -81, -1, 18, 19, 63, 35, -2, 34, 76, -60, -51, -3,
+    52, 48, 45, -64, 1, 19, 14, 52, -46, 29, 45, -16, 59, -52, 68, -16,
+    36, 65, 63, -20, 36, 82, 95, 4, 66, -13, 62, 19, 28, 52, 61, -50,
+    17, 13, 66, 17, 19, 2, -3, 12, 21, 29, -96, 43, 32, 31, -32, 61,
+    36, -45, -19, 50, 68, 35, -49, -17, -19, -84, 3, -77, -59, 68, -31, 17,
+    -46, 37, 31, 19, -48, 1, -13, 32, -2, -62, -50, -51, 76, 49, 17, -2,
+    35, 16, -33, 53, 45, -63, -17, -76, 2, -63, 31, -18, -34, -47, -14, -14,
+    17, -19, 13, -1, -51, 61, -30, -17, 29, -64, -77, 19, -49, -35, -53, -48,
+    -44, -45, 21, 47, -4, -50, -50, -18, 61, -98, -31, -18, 59, 3, 1, -29,
+    16, 18, -51, -20, 45, -48, 13, -61, -16, 75, -15, -47, 19, -46, -28, 33,
+    33, -14, 44, -48, -92, -20, -77, -4, 29, -15, -66, 19, -33, 44, -47, -35,
+    -3, 59, 16, 12, 83, 14, 15, 50, -5, 50, -45, -65, 62, 36, 49, 35,
+    61, 12, 1, 27, 66, 2, -33, 31, -30, 18, 67, 12, -62, 2, 30, -31,
+    -68, 34, 18, 15, -34, -50, 50, -47, 49, 16, -50, -1, -33, -78, -14, -63,
+    34, 62, -47, -48, -15, 16, 94, 77, 46, -19, 76, -62, -6, 10, 16, 30,
+    -20, -44, -4, -36, 45, -47, 48, 0, -66, -64, -53, -48, 15, 62, 10, 29,
+    -44, -27, -45, 0, -46, -29, -60, -34, -37, -17, 49, -64, 18, -35, 4, -34,
+    -52, 18, -51, 45, 18, -31, 60, -46, 45, -15, -4, 63, -68, 2, 21, 48,
+    63, -78, -33, 64, 12, -64, 18, -19, 2, -47, 65, 1, -53, 3, 1, -1,
+    17, 15, 14, 30, 28, -13, 31, 18, 60, -51, 17, -1, 36, 28, 79, 77,
+    -45, 79, 33, -61, 46, 0, 63, -35, 29, 44, 66, 80, -2, -4, 32, -13,
+    -31, -48, 30, -30, 17, 45, -15, 14, 2, 47, 29, -30, -28, 68, -32, -51,
+    29, 2, 61, 62, 33, -15, -19, 44, -3, 18, -32, 14, -61, 20, 51, -11,
+    -3, 2, -1, -50, -63, 60, -2, -28, 52, -18, -63, 47, 17, -62, -2, -64,
+    18, -34, 52, 47, 67, 66, 3, 29, 0, -64, 61, -60, -30, 63, 31, -20,
+    59, 19, 102, 62, -60, -5, 27, -27, -82, -12, 45, -44, -52, 106, 58, -67,
+    -28, -1, -51, 61, 5, 75, 96, 66, 59, 94, -76, -14, -33, 47, 95, 91,
+    0, 78, -28, -69, 30, 5, -12, -77, 35, 37, 0, -69, -21, 12, 45, -67,
+    77, 61, 81, 2, -75, 101, 21, 28, 3, -50, 111, 5, 64, 32, -85, 2,
+    60, 91, 12, -18, 47, -18, 62, 51, -91, 5, -5, -93, -43, -11, 77, -6,
+    31, 98, 64, 14, -30, 95, -28, -43, -17, -31, 35, -1, 3, -82, 29, -27,
+    -60, 44, 60, 76, -18, -66, 110, -44, -76, -4, -6, 0, 90, -22, -22, -13,
+    107, -14, -29, -33, -14, -5, -2, -29, 93, -22, 80, -82, 75, -74, 12, 67,
+    -48, -78, -13, 2, 16, 58, 66, 9, -47, -35, 99, 14, 85, 11, 81, -61,
+    -32, 1, 49, 20, 47, -51, -48, -32, -20, -95, 36, -1, -28, 34, 67, -65,
+    67, -4, 59, -1, -78, 77, 32, -92, 38, 76, -5, -82, -95, -47, -36, 31,
+    80, 26, 14, -6, 64, 28, -16, 36, -29, -110, -13, -67, 79, -108, 79, 30,
+    33, -91, 75, 30, 18, -61, 27, -12, 1, 76, -76, 66, -79, 28, 0, -38,
+    109, 20, -62, 48, -67, -63, -5, 66, -45, 3, -50, -82, 69, 15, -42, 0,
+    -29, 50, 50, -6, -79, -67, -18, -103, -65, 31, -82, -84, 110, -67, -75, 34,
+    96, 67, 20, 12, -69, 84, 67, -30, 63, -94, -2, 18, 38, 1, 52, -18,
+    -43, 61, 79, -102, -61, 75, -63, 85, -59, 14, 14, -77, -68, 44, -19, 90,
+    16, 14, -71, 94, -2, 81, 63, -76, 107, 2, 4, 4, 62, 65, -52, 74,
+    -81, -3, 90, -2, 2, -44, 94, -1, -16, 37, -58, -70, 43, -59, 34, 34,
+    62, 109, -95, -94, -93, 92, -5, -77, -26, -20, -62, 77, -83, -50, -66, -53,
+    -92, 93, 91, 44, 80, 37, 38, 67, 84, -61, -3, 28, 16, 29, -50, -79,
+    96, 83, -5, -49, -12, 79, -81, -13, 16, 46, 0, -4, 64, -37, 80, 67,
+    3, -80, -31, -46, -59, -34, -14, -1, -16, 66, -65, 91, -79, 18, -1, 3,
+    5, 95, -45, -54, -63, -11, 37, 93, 82, 59, -51, 85, 2, -80, -5, 65,
+    -20, 33, 31, 80, 32, 17, -58, -2, -62, -47, 84, -27, 77, 84, 66, -18,
+    -32, 94, -36, -64, 78, 28, 34, 30, -31, -78, 0, -61, -45, 76, -19, 18,
+    -68, 67, 94, -13, 67, -45, -31, -80, 17, 77, -14, 29, 34, 84, 30, 21,
+    -66, -27, -3, -43, -66, 31, 30, 47, 11, -32, 79, 6, -31, 33, 61, -12,
+    51, -44, 77, -43, -94, 36, -46, 35, -68, -4, 51, 32, -31, 52, 74, 50,
+    61, -20, -51, 45, -13, 46, -28, 19, 91, -13, -79, 92, 79, -67, 95, 5,
+    43, -37, 45, -83, -63, -76, 1, -14, 46, -48, 45, -3, -96, -60, -92, 48,
+    -33, -15, 17, 47, -6, 2, -28, 43, 66, 69, -49, 59, -44, 47, -86, -13,
+    -68, -16, 35, 74, 36, 95, -14, 27, -6, -34, 49, -1, -52, -21, 60, -61,
+    -38, 31, -49, 4, 82, -51, 53, -69, -19, 36, 35, -93, 14, -49, 91, -46,
+    15, 43, -31, 1, 54, 50, -61, 20, 35, -92, 65, -15, 20, 13, -19, 52,
+    -44, 37, 46, 39, 15, -61, -12, 64, 63, -75, 91, 36, 43, 61, 83, 84,
+    48, -21, -95, 13, 83, -37, -70, 79, -77, 90, -4, 77, 85, 60, -12, -45,
+    36, 60, -30, -78, 94, 25, 31, 15, 95, 80, -65, 21, 53, -67, 64, -47,
+    -77, 45, 60, 75, -46, -68, -4, -64, 18, 27, -69, -28, 44, -92, -94, 43,
+    20, 76, -64, -43, -21, 11, 62, 35, 60, -29, 75, 16, -82, -37, -75, 66,
+    2, -34, 27, 32, 84, 82, -79, 35, -79, -84, 32, 67, -48, 75, -68, 13,
+    64, 5, -4, 84, -68, -49, -51, 77, 47, 36, -63, -67, -44, -2, -51, -17,
+    91, 94, -34, -84, -34, -34, 3, 4, 29, -6, -65, 11, 1, 19, 80, -80,
+    -28, 60, 37, 3, -95, -96, 36, 66, -62, 48, 82, 0, -66, 63, -29, -18,
+    -51, -78, -61, -36, 62, -13, -5, 28, -29, -50, 68, -12, -67, -19, 63, -35,
+    17, 43, -33, 64, -29, 33, -48, 48, 62, -66, -20, 65, 26, -86, 18, 34,
+    -35, -62, -79, -78, 76, 20, -36, 69, 16, -78, 15, -77, 37, 43, -59, -68,
+    0, 3, 80, 33, -80, -44, 66, -48, -53, 46, -78, -49, 64, -3, 51, 93,
+    -30, -61, 29, -28, -52, 81, 20, -53, -68, 49, 66, 64, 53, -5, -15, 63,
+    -1, 16, -34, -35, -2, -16, 1, 19, 12, -1, 51, -3, 61, 47, 31, -34,
+    -60, -4, -33, -3, -17, 50, 0, -14, -28, 19, 18, 14, -1, -45, -46, 64,
+    60, -31, -18, -14, -15, -31, -51, 35, -34, 14, 32, -1, 52, 17, 35, -64,
+    16, -13, -1, -64, 46, -22, -50, -14, -45, -32, 12, -34, 2, -20, 19, 19,
+    -3, 1, -62, 14, -29, -33, 31, 51, 16, -111, 13, -82, -16, -32, 48, -2,
+    44, -50, 11, -4, -51, 0, 60, -29, 1, -1, -49, -31, 45, -46, -34, 16,
+    -1, 50, -34, 15, -50, -50, -35, -47, -31, -14, -18, -48, -1, -35, 45, 13,
+    -31, 30, 1, -12, -3, 1, -5, 33, -32, 16, -48, -16, -32, -35, 30, -1,
+    1, -1, -17, -33, 30, -32, -31, 44, -31, -16, -2, 60, 33, -30, 17, 31,
+    -3, 95, 17, 44, 19, -51, -68, -36, -15, 18, -37, -32, -68, 2, -4, 14,
+    34, 18, 32, -14, 1, 45, 46, -33, -32, -15, 49, 65, 28, 80, 16, 29,
+    -3, -64, -31, 14, -30, -63, -20, -13, 13, -66, -32, -52, -18, -1, -14, 16,
+    35, -17, 17, -5, -46, 15, -34, -45, 33, 64, -16, 33, 1, 60, -33, -34,
+    63, 3, -61, 32, -67, 17, -36, 12, 15, -77, -31, -97, 34, 16, -63, -48,
+    -32, 33, -48, -2, 33, 46, 29, 28, 66, -3, -19, -21, 0, 32, 30, 29,
+    1, -5, 47, 43, -14, -95, 17, 1, 62, 45, -35, 48, 1, 31, -18, 15,
+    60, 34, 15, 31, 28, 47, -1, 32, 63, 78, -44, 49, 15, 46, -48, -2,
+    14, 1, -14, -16, 0, -3, 12, 45, 1, -13, -30, 44, 17, -19, 35, -18,
+    -64, 46, -79, 14, 44, 21, 49, -34, 28, 20, 30, 45, 32, 66, 29, -17,
+    -17, 48, -31, -31, -3, -16, -48, 30, 1, -16, 46, -4, -16, 46, 31, 51,
+    3, 35, 67, -30, -63, 30, 62, -21, 30, 77, -32, -29, 63, 33, 32, 34,
+    47, 62, -36, 35, -64, -31, 15, -31, 15, 32, 37, -30, 1, -64, 31, 30,
+    -83, -64, 1, -67, 63, -30, -37, -64, -46, -33, 32, 3, -1, 29, 12, 2,
+    17, 46, 3, 30, 29, -19, 15, -50, 50, 13, 32, 3, 50, -61, 1, 15,
+    -31, 44, -3, 44, 3, 35, -36, 32, -2, 46, -47, 34, -17, 0, -32, 18,
+    -16, -45, -16, -3, -3, 33, -35, 46, -13, -44, 33, -12, -50, -64, -1, -32,
+    -15, -1, 50, 1, -18, -3, 17, 46, 1, 32, 49, 51, 32, -30, -18, -33,
+    17, 17, -47, -14, -16, -29, 36, -14, -12, 4, 31, 32, 30, -48, -31, 30,
+    -48, -3, -33, 31, -15, -28, 32, 32, -12, -46, -48, -51, -47, -16, 1, 3,
+    -18, 17, 32, 47, 18, 18, 49, 0, -14, 17, -4, 33, 13, -17, 14, 18,
+    18, 15, 16, -30, -29, 2, -2, 1, -35, -29, 15, -33, 4, 17, -2, -2,
+    -2, 18, 18, 16, -15, 48, -15, 50, 17, -29, 2, 34, 16, -15, 17, 48,
+    -1, 14, -45, 18, -1, 63, 15, -45, 17, 15, -45, 17, 61, 14, -15, -1,
+    0, 32, 31, 48, -18, -13, -64, -30, -19, -4, -47, -16, 48, 17, 17, -13,
+    16, -12, -33, 31, -52, 12, -2, -51, 61, -19, 0, -21, -1, -18, -15, 29,
+    14, -64, 30, -16, -86, -3, -52, -36, 45, -1, -2, -67, -33, 0, 18, 18,
+    -17, 13, -35, -53, 15, 0, 15, -17, 1, -18, -3, 47, -3, 14, -61, 16,
+    -2, 45, -32, -63, 0, -51, -32, 18, 33, -34, -35, 66, 16, -14, -1, 17,
+    1, 31, 2, 1, -19, 46, 17, -35, -16, 34, 15, -30, -15, 62, 49, -16,
+    -4, 30, -62, -31, 1, -26, 2, -30, 36, 47, -31, 51, 50, 14, 35, -34,
+    33, 49, 98, -13, 66, 1, -14, 17, -14, 46, 33, 50, 14, -2, 29, 68,
+    2, -12, 36, 3, -1, 46, -14, 63, 31, -2, 47, -33, 18, 19, 126, -16,
+    -17, 63, -32, 46, 47, 34, 19, -18, 46, 3, 63, 49, -15, -27, 19, 13,
+    47, 19, -13, -2, 50, 16, -31, -15, 15, 37, 17, -27, 32, -34, 14, 28,
+    -47, -47, -15, -33, 30, -19, 33, 32, -27, 0, -43, 79, -16, -17, 1, 13,
+    47, 49, 1, 29, 65, 78, 64, 50, -50, -1, -14, 0, -4, 14, 1, -15,
+    0, 47, 30, 49, 34, -17, 0, 16, -53, -16, -4, -52, -17, 28, 49, 15,
+    13, 47, -15, 3, -31, 46, -17, -47, 3, -31, -61, 29, 13, -15, 46, 3,
+    -14, 13, 17, 3, -13, -2, -34, 18, -31, -31, -46, -33, 29, -48, 33, 19,
+    2, -1, 77, -13, 34, -46, 62, -30, -44, -18, -50, 12, -17, -49, -32, -50,
+    51, 79, 16, -5, 51, 51, 82, -47, 33, -30, -30, -19, -61, -20, 60, 78,
+    32, 66, 96, 18, -32, 34, 65, 34, 51, -61, 79, 45, 52, -50, -51, 66,
+    17, -48, 17, 0, 84, -15, 50, 15, -77, -80, 78, 45, -34, 26, -63, -13,
+    15, 17, -10, 17, 33, 16, 79, 50, 13, 13, 31, -32, 1, 32, -1, 33,
+    -29, -52, -61, 46, 52, 31, 13, 44, -33, -52, -64, -15, -52, -69, -14, -32,
+    -55, -34, -15, -62, -20, -18, 13, -47, -19, 2, 15, -65, -21, -46, 28, 0,
+    48, -31, -45, 3, 2, -31, 29, 28, -1, 32, 12, -15, -17, 79, -32, 62,
+    -48, 15, 13, 60, -35, -51, 13, -31, -34, -5, -82, -7, 16, 33, -16, 66,
+    -2, -64, 79, -63, 30, -19, -1, -50, 1, -2, -16, 18, 28, 44, 58, 49,
+    47, 0, -4, -32, -16, 16, 0, 66, 4, 14, 2, 50, 0, -68, 34, -3,
+    32, 61, -16, 43, 20, -17, 17, -29, -48, 44, 19, -17, 50, 29, -17, 34,
+    49, 48, -35, 21, -67, 30, 34, 84, -16, -43, 36, 63, -32, -2, 79, 33,
+    12, -16, -22, 17, 61, 46, -18, 20, 29, 14, 18, 28, 1, -62, -49, -64,
+    13, 0, 78, -31, 83, 51, -45, 22, 50, 32, 14, 63, 2, -33, -46, -45,
+    58, -15, -16, 31, -49, -13, 50, -18, -60, -14, -50, -30, -47, -18, 2, 1,
+    -13, -27, 1, 31, -62, -17, -3, -45, -46, -31, 1, 29, -1, -31, 33, 28,
+    -17, 32, -12, 34, 29, -30, -17, 16, 13, -17, 44, -62, 32, -1, 67, 20,
+    36, 0, -16, 49, -45, -15, -50, 33, -60, 43, 12, 46, 33, 2, -63, 18,
+    -95, 0, -15, 14, -4, -50, -31, -63, 1, 32, -29, 12, -81, 12, 17, 30,
+    26, -48, -37, 67, -80, -18, 36, -11, -36, -86, 16, -31, 49, -14, 12, -51,
+    66, -15, 65, -15, -64, -31, -20, -97, -49, 78, -15, 13, 31, 32, 48, -30,
+    30, 15, -98, -53, -47, 11, -55, 33, 47, 31, -46, 2, 47, -78, -28, 52,
+    -53, -94, -47, -13, -65, 59, -78, -67, 18, 30, 46, -2, -33, 0, -31, 18,
+    1, 14, -47, -46, 17, 60, -30, 49, -30, 65, -33, -62, -65, 38, 107, 18,
+    47, -4, 15, 18, -42, 54, 62, 92, -83, -35, 74, 101, -32, -36, -27, 107,
+    90, -26, 1, 50, 1, -44, -86, 42, -22, 28, 52, 77, -13, 20, 110, -30,
+    -15, 14, 101, 64, -59, 93, -15, -47, 45, 11, 38, -44, 4, -4, -58, 30,
+    59, -106, 37, 81, -20, -54, -43, 91, 43, -35, -93, 19, -13, 13, 52, 35,
+    62, -43, -44, -61, -108, 84, -66, -60, -32, 74, -42, 13, -16, 97, 94, 64,
+    37, -16, 62, 19, 90, 80, 44, -59, -42, 96, 18, -81, 82, -28, 93, 29,
+    82, -84, 92, -54, 66, 57, -85, 76, 53, -22, -1, -66, -110, -60, 47, -21,
+    -27, 1, -78, 50, -75, 18, 18, -77, -74, 20, -82, -62, -83, -44, -92, 79,
+    76, -35, 36, 32, 91, -26, -22, 27, 67, -67, -52, -11, -19, -12, 32, -64,
+    17, -21, 111, -59, -34, -80, -61, 69, -45, -34, -6, -80, -33, 66, 4, 19,
+    -59, 78, -16, 42, -47, 44, -12, -84, 74, -33, -45, -48, 53, 5, -35, 66,
+    -30, 45, -52, 27, 80, 85, 29, -80, 20, -47, -69, -92, 84, 75, -16, 5,
+    -52, -80, 58, -78, 69, 60, -98, -32, 52, -94, 1, -32, 30, 20, -80, 42,
+    22, 11, -76, -12, -11, -45, 11, -52, 16, 83, -85, -12, 52, -92, -64, -3,
+    -21, 15, 75, -85, 11, -53, -75, 94, -53, -15, -23, -12, 17, -53, -94, 10,
+    -76, -36, 44, 96, -35, 59, 48, -61, -20, 25, 59, -77, -21, 60, -17, -43,
+    53, 28, 68, -81, -96, -51, -43, 68, -71, -94, 51, -35, 63, 10, 90, 68,
+    -21, -21, -28, -52, -66, -20, 53, 13, 14, 47, 51, 35, 32, 67, 30, 30,
+    -6, 37, -14, -12, 62, -83, 67, 63, -82, 109, -83, 62, 66, 34, 90, 76,
+    67, -11, -77, -21, 3, -81, 5, 27, -33, 99, -74, 29, 65, -109, -77, -35,
+    43, -67, 10, -31, 20, 48, 94, -33, -91, 102, -32, 31, 15, -96, 44, 16,
+    4, -63, -38, -59, 52, 75, 0, 108, -81, -76, 69, 61, -37, -1, 28, -51,
+    -79, 43, -45, 68, 18, 63, 52, 47, 32, 91, 109, 13, -67, -1, -32, -10,
+    99, -18, -80, 51, -61, 81, -11, -62, 2, -11, -20, -15, 4, 14, 15, 21,
+    0, -15, -18, -18, -15, 16, 33, 46, 31, -19, -2, 47, 31, -17, 0, -31,
+    18, -1, 49, 3, 0, 44, -17, 14, 32, 14, 34, -35, 32, 15, 65, -17,
+    -34, -47, -46, -37, -30, -16, 15, -16, 49, -31, 3, 32, -32, -51, -46, -14,
+    -35, -19, -48, 31, -16, -3, 45, 1, 63, -30, 31, 18, -64, 1, -4, -28,
+    -64, -1, 30, -1, -30, -30, 33, -48, -32, 31, -19, -15, -18, -17, 14, -17,
+    33, 32, 16, -31, -16, 31, 15, 32, 32, -16, -2, 78, 15, -17, -15, 0,
+    0, 32, -30, 32, -17, -2, -15, 18, 47, 34, 32, -2, -48, -1, -1, -17,
+    14, -30, -16, 30, -17, 15, 18, 1, 0, -1, 1, -17, -17, -2, 31, -33,
+    -31, -31, -18, 46, -15, -15, -18, -48, 13, -31, -18, -17, 19, 15, 18, 30,
+    -16, 2, 16, -17, -13, -30, 32, -30, 14, 2, -46, 33, 2, 2, 48, 0,
+    2, 0, 46, 63, 17, -16, -19, -14, 78, 15, -2, 65, -14, 31, -14, 16,
+    33, 20, -16, 31, 15, -1, -16, -62, 16, 34, 2, -1, 15, 0, 47, 2,
+    -31, 13, 14, -19, -15, 28, -30, 15, 31, 0, 31, 34, 17, 1, -16, -61,
+    44, 15, -4, -16, 33, 31, 50, 3, 30, 62, 62, -30, -16, 1, -48, 31,
+    -33, 19, 28, 45, 48, -16, -2, 63, -32, -30, 3, -34, 16, 0, 32, -64,
+    14, 13, 63, 2, 16, -18, -15, 34, -62, 65, -1, 45, -31, -2, -33, 16,
+    -30, 17, 14, 15, -30, 31, -35, -2, 31, -34, -30, -49, -14, -31, -1, 12,
+    -16, 16, -32, 31, -33, 31, -2, -34, 34, -1, 31, -48, -1, -16, -19, -3,
+    16, 14, -1, 28, 14, 15, 48, -34, 16, 12, 15, -18, 16, -31, -15, 15,
+    -31, 33, 33, 18, 1, 29, 14, -35, 14, -15, -18, -32, -1, -3, -32, 13,
+    50, 30, -13, 17, 15, -2, 17, 14, -51, -2, 0, 33, 47, 4, 30, -30,
+    -30, 32, 0, -31, -31, -35, 13, -15, 95, 113, -15, 81, -32, -48, 47, 17,
+    46, 31, 0, -15, 17, 2, 46, 18, 65, 19, 38, 36, 3, 32, -18, -16,
+    16, 35, 17, -61, 2, 18, 66, 85, 37, -31, 0, -48, 15, -48, -33, -14,
+    16, 44, 50, -33, -16, -17, -28, 13, 45, -33, 49, -33, -1, 31, 45, -3,
+    -46, -62, 63, -15, 16, -32, -14, 31, -29, 45, -46, 17, -29, 49, 15, 30,
+    30, -45, -17, -29, 1, 45, 3, 45, -1, -16, -17, 33, -30, -3, 13, 35,
+    78, 1, 46, -29, -46, 28, 31, 60, 47, -45, -13, -78, 0, 51, 19, 49,
+    29, 34, -15, 48, -2, 78, -14, 30, 61, 30, -13, 16, 50, 16, 49, 31,
+    0, -33, 48, -48, -30, 31, 31, -34, -16, 46, 16, 16, 51, 48, 45, 35,
+    34, -30, 49, -2, 3, 34, 45, 1, 31, 20, 18, 17, -30, 31, 29, -14,
+    0, -30, 15, 32, 0, 35, -16, 3, 2, 2, 18, 62, 30, -31, 1, 33,
+    62, 47, -31, 77, 18, 36, -11, 34, -30, -14, 14, -3, 18, 63, 31, -17,
+    -16, 46, 33, -32, 14, 78, -1, -45, -14, 61, 63, 14, 30, -3, 0, 15,
+    -3, -34, -42, 35, -34, 4, 47, 28, -30, 17, -48, 13, -64, -3, -38, 60,
+    14, 4, 30, 18, 2, 1, -2, 50, -64, -3, 0, 29, 47, -30, 14, 16,
+    -15, -2, 49, 18, 16, 18, -15, 45, -50, -15, 44, 60, 33, 46, -34, 45,
+    34, 1, 18, 0, 32, 46, 30, 34, 52, 14, -3, -14, -35, 29, -52, 44,
+    -33, 16, 0, -19, 63, -18, 31, 14, -13, -13, 14, -61, -17, 1, 61, 30,
+    -1, -16, 19, -32, 62, -31, 50, 77, -30, -79, -97, -64, -3, -3, -2, 48,
+    62, 46, 0, 48, -15, -1, -47, 4, -35, -53, -36, -35, 66, -31, 47, 14,
+    -15, 63, -18, 19, 18, 16, 35, -14, -16, 50, 12, 29, 1, -63, 2, -30,
+    33, -1, 67, 20, 15, 48, 30, 1, 15, 18, 61, -2, 19, -21, 33, 111,
+    67, 45, 62, 50, -47, -17, 17, -29, 18, -16, -14, 33, -17, 3, 61, 46,
+    14, 32, 0, -18, -13, 17, 33, 29, -34, -18, 16, 33, 62, 67, -15, 46,
+    17, -64, 35, 30, -47, -3, 14, -4, 62, 15, 14, 1, -18, 31, 34, 1,
+    -47, 48, -48, -61, 2, -29, -33, 31, -14, 2, 51, -29, -46, -3, 46, 46,
+    2, 32, 49, 17, 32, -31, 51, -18, 63, -3, 2, 64, -1, -63, -46, 19,
+    13, -34, -32, 34, -51, 34, 32, 46, 0, -46, -2, -30, -1, -1, -34, -32,
+    -34, -2, -31, 64, 31, -48, 63, 4, 46, -61, 49, 4, -30, 2, 51, -33,
+    31, -47, -20, 16, 32, 35, -13, -18, 35, 48, -64, 46, -47, 78, 48, 44,
+    -13, -36, 13, 62, -17, 2, 34, -64, 18, 62, 62, 51, -14, 29, 1, -20,
+    -3, -15, -17, -34, 79, 2, -34, 19, 48, -12, -30, 18, -29, 31, 30, 0,
+    -51, 48, 33, -17, -17, -16, -45, 63, -17, 32, 30, -60, -48, -34, 31, -3,
+    -62, 45, -45, -32, 60, -1, 36, 17, 30, 0, -30, -46, -47, 0, 15, -32,
+    0, 98, 0, 95, 18, 2, 34, 5, 66, 16, -34, -19, 65, 17, 79, 51,
+    95, 17, -11, 35, 31, 64, 35, -13, 32, 17, 19, 1, 21, 16, -16, 86,
+    2, 4, 49, 48, 29, 35, 19, 33, -18, -16, 18, -16, 0, 20, 46, 35,
+    -19, 30, -14, 34, 6, 3, 47, 0, -14, 49, 30, -14, -12, 15, 35, 16,
+    -15, 0, 62, 33, -30, 32, 27, 1, 13, 2, -60, 32, -35, -48, -16, -48,
+    15, 0, -79, 43, -13, 28, 80, -4, 62, -12, 16, -16, -19, -17, -55, 17,
+    18, -63, -51, 63, 35, 51, 14, 0, -65, -2, -34, -34, -31, 47, 31, -46,
+    -33, -30, 67, -52, 31, 2, -16, -4, 59, 16, 47, -16, -14, 94, -15, 31,
+    52, -45, -15, -31, 11, -48, -17, 42, 19, -32, 33, -18, 31, 49, 3, -3,
+    18, -16, 34, -62, -50, -19, 51, 50, -16, 49, -1, 66, 45, -48, 35, 16,
+    32, -2, 14, 46, -33, -64, -82, -49, 32, -51, 12, 33, 34, -20, -63, -33,
+    -48, 30, -16, 48, -49, -32, 14, -2, -49, 0, -32, 32, 2, -32, 94, 17,
+    -47, -50, 31, 45, -20, -17, 18, 34, -46, -19, -21, 13, -16, -50, -62, -17,
+    46, -13, -32, 0, 30, 4, -77, 35, -62, -46, 35, 46, 28, 30, -64, 60,
+    13, -47, 1, -48, 61, -48, 15, 18, -35, 3, -30, -16, 62, -46, -19, 50,
+    -63, 79, -3, 1, 0, -32, -15, 16, -15, -78, 32, -68, -1, -60, 62, 35,
+    -16, 17, -14, -15, 19, 48, 2, 51, 52, 48, 1, 29, -15, 46, -15, -18,
+    -67, 47, -48, -64, 19, -46, -59, 48, 46, 17, 33, -30, 28, -15, 19, 68,
+    66, 85, -18, 19, -32, 13, 35, -47, 2, -17, 32, 46, 66, -47, 46, -48,
+    -28, -45, 45, 1, 66, 63, -17, 46, -16, 35, 2, 2, -32, -47, 19, 12,
+    60, 15, -14, -2, -48, -47, -30, 2, -67, 44, -1, -16, -32, 4, 0, 15,
+    47, 48, -3, -34, -15, -51, -47, 14, 29, -5, 50, -32, 51, 46, 19, -1,
+    -1, 48, -2, 31, 30, 47, -34, -19, 50, -31, 32, -112, 0, 45, 33, 46,
+    -14, -32, -33, 62, -17, 32, 33, -46, -2, 17, 49, 33, 35, 67, 32, -32,
+    21, -2, -14, 31, -34, 29, -1, -47, -13, 0, 65, -43, -16, -18, -13, -19,
+    1, 1, 29, 14, -16, 2, 16, 17, 17, -13, 36, -32, 34, 30, -29, -17,
+    47, 31, -16, -16, 10, -13, 33, 68, 1, 64, -17, -1, -50, 0, -48, 32,
+    -63, 65, -78, 60, 51, -52, 0, 16, 49, -50, 5, -60, -46, 33, 62, -47,
+    46, -34, -17, -2, 1, 65, 29, -35, 3, 29, 15, 20, -43, -17, -79, 29,
+    13, 18, 34, 16, -17, 50, 1, 16, -16, -14, 63, -13, 1, 59, -1, -1,
+    17, -33, 18, -13, 52, -32, 1, -17, 31, -18, -20, 49, -17, 47, -2, 19,
+    -2, 65, 60, 15, -12, 12, -33, -32, -29, 46, -34, -4, -64, -47, -13, 26,
+    47, 14, -31, 15, 32, 66, 50, -14, -18, -45, -65, -13, 33, 45, 32, -13,
+    33, -51, -50, 61, -33, -13, -46, -51, 15, 75, 44, 3, 33, 0, 16, 44,
+    12, 44, -32, 33, -16, -111, -28, -33, 18, 0, 14, -13, -2, 62, -4, -78,
+    28, -16, -2, -12, 46, 77, 28, 47, 34, -16, 28, -48, -29, 13, -16, 48,
+    -45, 2, 14, 14, 1, -2, -49, -1, -2, -33, 18, -46, -61, 63, 18, -50,
+    28, 2, -47, 17, -17, -1, 48, 15, 47, 27, -15, 31, 30, -31, -46, -14,
+    62, 0, -15, 30, -20, -50, 44, 33, -15, 61, -19, 4, -20, 30, -3, 28,
+    32, -47, 64, 2, -29, 48, -13, 43, 3, -45, -18, -37, 32, 2, 29, -48,
+    16, 2, 19, 0, 67, -31, -46, -34, -95, -79, -81, -47, 12, -1, 15, -64,
+    13, 15, -14, -2, -3, -63, 19, -50, -96, -94, -1, -16, -79, 28, 14, 13,
+    -45, 48, 2, 46, 60, 33, -47, 16, 47, -4, -5, 1, -15, 17, 18, 28,
+};
+
+static const int32_t TEST_MODEL_fc_int4x8_0_bias[16] __attribute__((aligned(4))) = {
+    -32, -16, -16, -32, -16, -32, -16, -16, -32, 0, -32, -16, -16, -16, 0, -96,
+};
+
+static const int32_t TEST_MODEL_fc_int4x8_0_multipliers[16] __attribute__((aligned(4))) = {
+    1372822762, 1676438038, 1806385112, 1228758767, 1137785089, 1509594717, 1101106866, 1227438697, 1743642942, 2055620276, 1612786073, 1103588201, 1200846789, 1909557618, 1721137439, 1758820207,
+};
+
+static const int32_t TEST_MODEL_fc_int4x8_0_shifts[16] __attribute__((aligned(4))) = {
+    -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -9, -10, -10, -10,
+};
+
+static const ml_fc_s8_layer_t TEST_MODEL_fc_int4x8_layers[3] = {
+    {16, 784, 4, 1568, NULL, NULL, TEST_MODEL_fc_int4x8_0_blocks, TEST_MODEL_fc_int4x8_0_bias, 128, -128, 0, 0, TEST_MODEL_fc_int4x8_0_multipliers, TEST_MODEL_fc_int4x8_0_shifts, -128, 127},
+    {16, 16, 8, 64, NULL, NULL, TEST_MODEL_fc_perchannel_1_blocks, TEST_MODEL_fc_perchannel_1_bias, 128, -128, 0, 0, TEST_MODEL_fc_perchannel_1_multipliers, TEST_MODEL_fc_perchannel_1_shifts, -128, 127},
+    {10, 16, 8, 40, NULL, NULL, TEST_MODEL_fc_perchannel_2_blocks, TEST_MODEL_fc_perchannel_2_bias, 128, 48, 0, 0, TEST_MODEL_fc_perchannel_2_multipliers, TEST_MODEL_fc_perchannel_2_shifts, -128, 127},
+};
+
+const ml_fc_s8_model_t TEST_MODEL_fc_int4x8 = {3, TEST_MODEL_fc_int4x8_layers, 784, 7192};
+
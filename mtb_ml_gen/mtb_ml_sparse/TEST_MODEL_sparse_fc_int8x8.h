@@ -0,0 +1,23 @@
+/***************************************************************************//**
+* \file TEST_MODEL_sparse_fc_int8x8.h
+*
+* \brief
+* Generated with scripts/ml_sparse_gen.py, this file contains the fully
+* connected layers of the TEST_MODEL model (int8x8) with the original weights in dense
+* format, with the weights in block-CSR format (pruning 50%), and with the
+* weights quantized per channel to int8 and, for the first layers, to int4.
+******************************************************************************/
+
+
+#ifndef TEST_MODEL_SPARSE_FC_INT8X8_H
+#define TEST_MODEL_SPARSE_FC_INT8X8_H
+
+#include "ml_sparse_fc.h"
+
+
+extern const ml_fc_s8_model_t TEST_MODEL_fc_dense;
+extern const ml_fc_s8_model_t TEST_MODEL_fc_sparse;
+extern const ml_fc_s8_model_t TEST_MODEL_fc_perchannel;
+extern const ml_fc_s8_model_t TEST_MODEL_fc_int4x8;
+
+#endif // TEST_MODEL_SPARSE_FC_INT8X8_H
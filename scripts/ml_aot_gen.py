@@ -0,0 +1,334 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_aot_gen.py
+# \version 1.0
+#
+# \brief
+# Compiles the tflm_less models generated by the ML configurator ahead of
+# time into plain C, linked as variants of ML_BENCHMARK.
+#
+# The tflm_less model still builds the TFLM tensors and nodes at startup and
+# runs each node through its registration, which reads the shapes, the
+# quantization and the op data from the tables at every inference. This
+# script resolves all of that on the host. Each layer becomes a constant
+# descriptor of one of the application kernels, chosen for the NN_TYPE, and
+# the invoke function calls the kernels one after the other on fixed buffers
+# of a static arena, at the offsets planned for the tflm_less model. Nothing
+# is left of the TFLM context, the registrations or the tensor tables: the
+# input and output descriptors only describe the buffers to the benchmark.
+#
+# The model must be a stack of fully connected layers, optionally followed by
+# a softmax. The int8x8 layers run on ml_fc_s8_dense() of
+# source/ml_sparse_fc.c, with the weights reordered in blocks. This kernel
+# reads all the input blocks and does not scan the input for the blocks equal
+# to the zero point. The int16x8 layers run on source/ml_fc_s16.c, and the
+# float layers on source/ml_fc_f32.c. The softmax runs on
+# source/ml_softmax_s8.c, source/ml_softmax_s16.c or source/ml_fc_f32.c.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import math
+import os
+import re
+import sys
+
+from ml_fc_float_gen import ACTIVATIONS, float_array
+from ml_softmax_lut_gen import EXP_INPUT_RANGE, exp_lut, one_over_one_plus_x_lut, parse_softmax
+from ml_sparse_gen import BLOCK_SIZE, MAX_COL_BLOCKS, block_order, c_array, parse_graph, quantize_multiplier
+from ml_static_init_gen import table_entries
+
+NN_TYPES = ('int8x8', 'int16x8', 'float')
+
+# C type of the activations of each NN_TYPE
+ACTIVATION_TYPES = {'int8x8': ('int8_t', 'kTfLiteInt8', 1),
+                    'int16x8': ('int16_t', 'kTfLiteInt16', 2),
+                    'float': ('float', 'kTfLiteFloat32', 4)}
+
+# Alignment of the static arena
+ARENA_ALIGNMENT = 16
+
+
+def parse_arena(text):
+    """Arena offset and bytes of each tensor, None for the constant ones."""
+    tensors = []
+    for fields in table_entries(text, 'const TensorInfo_t tensorData[]'):
+        # Float models do not store the type and quantization per tensor
+        data, size = (fields[0], fields[2]) if len(fields) == 3 else (fields[1], fields[3])
+        m = re.match(r'tensor_arena \+ (\d+)$', data)
+        tensors.append((int(m.group(1)), int(size)) if m else None)
+    return tensors
+
+
+def parse_model(path, nn_type):
+    """Layers, softmax and buffers of a tflm_less model."""
+    graph = parse_graph(path)
+    text = graph['text']
+    arena = parse_arena(text)
+    ops = re.findall(r'&opdata\d+\)\), (OP_\w+)', text)
+    model = {'layers': [], 'softmax': None}
+
+    # int16x8 models have int64 bias, not read by parse_graph()
+    for m in re.finditer(r'int64_t tensor_data(\d+)\[[^\]]*\] = \{([^}]*)\}', text):
+        graph['data'][int(m.group(1))] = [int(v) for v in m.group(2).replace(',', ' ').split()]
+
+    params = []
+    if nn_type != 'float':
+        fc = text[text.index('namespace fully_connected'):]
+        fc = fc[:fc.index('} // namespace fully_connected')]
+        params = [tuple(int(v) for v in m.groups())
+                  for m in re.finditer(r'\{\{(-?\d+), (-?\d+), (-?\d+), (-?\d+),', fc)]
+
+    for i, node in enumerate(graph['fc_nodes']):
+        inp, weight, bias = graph['inputs'][node]
+        out = graph['outputs'][node][0]
+        rows, cols = graph['dims'][weight]
+        layer = {'rows': rows, 'cols': cols, 'input': inp, 'output': out,
+                 'weights': graph['data'][weight], 'bias': graph['data'][bias] if bias >= 0 else None}
+        if nn_type == 'float':
+            m = re.search(r'TfLiteFullyConnectedParams opdata%d = \{ (\w+),' % node, text)
+            if m.group(1) not in ACTIVATIONS:
+                sys.exit('error: node %d has an unsupported activation %s' % (node, m.group(1)))
+            layer['activation'] = ACTIVATIONS[m.group(1)]
+        else:
+            if any(graph['zeros'][weight]) or len(graph['scales'][weight]) > 1:
+                sys.exit('error: node %d is not quantized per tensor with symmetric weights' % node)
+            layer['multiplier'], layer['shift'], layer['act_min'], layer['act_max'] = params[i]
+            layer['input_offset'] = -graph['zeros'][inp][0]
+            layer['output_offset'] = graph['zeros'][out][0]
+        model['layers'].append(layer)
+
+    if len(ops) > len(graph['fc_nodes']):
+        node = len(ops) - 1
+        inp, out = graph['inputs'][node][0], graph['outputs'][node][0]
+        dims = graph['dims'][inp]
+        softmax = {'input': inp, 'output': out, 'row_size': dims[-1],
+                   'num_of_rows': math.prod(dims) // dims[-1]}
+        if nn_type == 'int8x8':
+            m = re.search(r'namespace softmax \{.*?\{\{[^,]+, (-?\d+), (-?\d+), -?\d+, -?\d+, (-?\d+),', text, re.S)
+            if m is None:
+                sys.exit('error: the model has no softmax op data')
+            softmax['multiplier'], softmax['shift'], softmax['diff_min'] = (int(v) for v in m.groups())
+            if graph['zeros'][out][0] != -128 or graph['scales'][out][0] != 1.0 / 256:
+                sys.exit('error: the softmax output is not quantized with zero point -128 and scale 1/256')
+        elif nn_type == 'int16x8':
+            scale, beta, _, precomputed = parse_softmax(path)
+            softmax['exp_lut'] = precomputed.get('exp_lut') or exp_lut()
+            softmax['one_over_one_plus_x_lut'] = (precomputed.get('one_over_one_plus_x_lut') or
+                                                  one_over_one_plus_x_lut())
+            softmax['multiplier'], softmax['shift'] = precomputed.get(
+                'input multiplier', quantize_multiplier(scale * beta / (EXP_INPUT_RANGE / 65535.0)))
+        else:
+            softmax['beta'] = float(re.search(r'TfLiteSoftmaxParams opdata%d = \{ ([^ }]+)' % node,
+                                              text).group(1))
+        model['softmax'] = softmax
+
+    first, last = model['layers'][0]['input'], (model['softmax'] or model['layers'][-1])['output']
+    model['input'], model['output'] = first, last
+    model['arena'] = arena
+    model['io'] = [(graph['scales'].get(t, [0.0])[0], graph['zeros'].get(t, [0])[0]) for t in (first, last)]
+    return model
+
+
+def check_layers(model, nn_type):
+    for i, layer in enumerate(model['layers']):
+        if nn_type == 'int8x8' and (layer['cols'] % BLOCK_SIZE or layer['cols'] > MAX_COL_BLOCKS * BLOCK_SIZE):
+            sys.exit('error: layer %d has %d inputs, must be a multiple of %d up to %d' % (
+                i, layer['cols'], BLOCK_SIZE, MAX_COL_BLOCKS * BLOCK_SIZE))
+        if nn_type == 'int16x8' and (layer['input_offset'] or layer['output_offset']):
+            sys.exit('error: layer %d has int16 activations with a zero point' % i)
+
+
+def reduce_multiplier(multiplier):
+    """Q15 multiplier of a Q31 one, as TFLM and CMSIS-NN for 64-bit accumulators."""
+    return (multiplier + (1 << 15)) >> 16 if multiplier < 0x7FFF0000 else 0x7FFF
+
+
+def write_c_files(out_dir, name, nn_type, model):
+    base = '%s_aot_%s' % (name, nn_type)
+    prefix = base
+    guard = base.upper() + '_H'
+    ctype, tflite_type, elem_bytes = ACTIVATION_TYPES[nn_type]
+    banner = ('/***************************************************************************//**\n'
+              '* \\file %s\n'
+              '*\n'
+              '* \\brief\n'
+              '* Generated with scripts/ml_aot_gen.py, this file contains the %s model\n'
+              '* (%s) compiled ahead of time: constant layers and a straight-line invoke\n'
+              '* of the kernels on a static arena, without the TFLM interpreter.\n'
+              '******************************************************************************/\n')
+
+    # Buffers of the activations, at the offsets of the tflm_less arena
+    buffers = {}
+    for tensor in [model['input']] + [layer['output'] for layer in model['layers']] + \
+            ([model['softmax']['output']] if model['softmax'] else []):
+        if model['arena'][tensor] is None:
+            sys.exit('error: tensor %d is not in the arena' % tensor)
+        offset, size = model['arena'][tensor]
+        if offset % elem_bytes:
+            sys.exit('error: tensor %d is not aligned in the arena' % tensor)
+        buffers[tensor] = (offset, size)
+    arena_size = max(offset + size for offset, size in buffers.values())
+    arena_size = (arena_size + ARENA_ALIGNMENT - 1) // ARENA_ALIGNMENT * ARENA_ALIGNMENT
+
+    def buf(tensor, const=False):
+        return '(%s%s *) &arena[%d]' % ('const ' if const else '', ctype, buffers[tensor][0])
+
+    includes = {'int8x8': ['ml_sparse_fc.h', 'ml_softmax_s8.h'],
+                'int16x8': ['ml_fc_s16.h', 'ml_softmax_s16.h'],
+                'float': ['ml_fc_f32.h']}[nn_type]
+    if not model['softmax']:
+        includes = includes[:1]
+
+    src = banner % (base + '.c', name, nn_type)
+    src += '\n\n#include "%s.h"\n\n#include <stddef.h>\n\n' % base
+    src += ''.join('#include "%s"\n' % include for include in includes) + '\n\n'
+
+    flash = 0
+    entries = ''
+    invoke = '    uint8_t *arena = %s_arena;\n\n' % prefix
+    scratch = 0
+    for i, layer in enumerate(model['layers']):
+        rows, cols = layer['rows'], layer['cols']
+        weights = '%s_%d_weights' % (prefix, i)
+        bias = '%s_%d_bias' % (prefix, i) if layer['bias'] is not None else 'NULL'
+        if nn_type == 'int8x8':
+            src += c_array('int8_t', weights, block_order(
+                [layer['weights'][r * cols:(r + 1) * cols] for r in range(rows)], cols))
+            if layer['bias'] is not None:
+                src += c_array('int32_t', bias, layer['bias'])
+            flash += rows * cols + (rows * 4 if layer['bias'] is not None else 0)
+            entries += '    {%d, %d, 8, %d, NULL, NULL, %s, %s, %d, %d, %d, %d, NULL, NULL, %d, %d},\n' % (
+                rows, cols, rows * cols // BLOCK_SIZE, weights, bias, layer['input_offset'],
+                layer['output_offset'], layer['multiplier'], layer['shift'], layer['act_min'], layer['act_max'])
+            # The input density is only known at run time, so every layer
+            # runs on the dense kernel and does the same work for each sample
+            invoke += ('    ml_fc_s8_dense(&%s_layers[%d], %s, %s,\n'
+                       '                   %s_scratch);\n' %
+                       (prefix, i, buf(layer['input'], True), buf(layer['output']), prefix))
+            scratch = max(scratch, 2 * cols)
+        elif nn_type == 'int16x8':
+            src += c_array('int8_t', weights, layer['weights'])
+            if layer['bias'] is not None:
+                src += c_array('int64_t', bias, layer['bias']).replace('aligned(4)', 'aligned(8)')
+            flash += rows * cols + (rows * 8 if layer['bias'] is not None else 0)
+            entries += '    {%d, %d, %s, %s, %d, %d, %d, %d},\n' % (
+                rows, cols, weights, bias, reduce_multiplier(layer['multiplier']), layer['shift'],
+                layer['act_min'], layer['act_max'])
+            invoke += '    ml_fc_s16(&%s_layers[%d], %s, %s);\n' % (
+                prefix, i, buf(layer['input'], True), buf(layer['output']))
+        else:
+            src += float_array(weights, layer['weights'])
+            if layer['bias'] is not None:
+                src += float_array(bias, layer['bias'])
+            flash += 4 * (rows * cols + (rows if layer['bias'] is not None else 0))
+            entries += '    {%d, %d, ML_FC_F32_WEIGHTS_F32, %s, %s, %s},\n' % (
+                rows, cols, layer['activation'], weights, bias)
+            invoke += '    ml_fc_f32(&%s_layers[%d], %s, %s);\n' % (
+                prefix, i, buf(layer['input'], True), buf(layer['output']))
+
+    layer_type = {'int8x8': 'ml_fc_s8_layer_t', 'int16x8': 'ml_fc_s16_layer_t',
+                  'float': 'ml_fc_f32_layer_t'}[nn_type]
+    src += 'static const %s %s_layers[%d] = {\n%s};\n\n' % (layer_type, prefix, len(model['layers']), entries)
+
+    softmax = model['softmax']
+    if softmax and nn_type == 'int8x8':
+        src += 'static const ml_softmax_s8_t %s_softmax = {%d, %d, %d, %d, %d};\n\n' % (
+            prefix, softmax['multiplier'], softmax['shift'], softmax['diff_min'], softmax['num_of_rows'],
+            softmax['row_size'])
+        invoke += '    ml_softmax_s8(&%s_softmax, %s, %s);\n' % (
+            prefix, buf(softmax['input'], True), buf(softmax['output']))
+    elif softmax and nn_type == 'int16x8':
+        for lut in ('exp_lut', 'one_over_one_plus_x_lut'):
+            src += c_array('int16_t', '%s_softmax_%s' % (prefix, lut), softmax[lut])
+            flash += 2 * len(softmax[lut])
+        src += ('static const ml_softmax_s16_t %s_softmax = {%d, %d, %d, %d, %s_softmax_exp_lut, '
+                '%s_softmax_one_over_one_plus_x_lut};\n\n' % (
+                    prefix, softmax['multiplier'], softmax['shift'], softmax['num_of_rows'],
+                    softmax['row_size'], prefix, prefix))
+        invoke += '    ml_softmax_s16(&%s_softmax, %s, %s);\n' % (
+            prefix, buf(softmax['input'], True), buf(softmax['output']))
+    elif softmax:
+        invoke += '    ml_softmax_f32(%s, %s, %du, %.9ef);\n' % (
+            buf(softmax['input'], True), buf(softmax['output']), softmax['row_size'] * softmax['num_of_rows'],
+            softmax['beta'])
+
+    src += '/* Activations, at the offsets planned for the tflm_less model */\n'
+    src += 'static uint8_t %s_arena[%d] __attribute__((aligned(%d)));\n' % (prefix, arena_size, ARENA_ALIGNMENT)
+    if scratch:
+        scratch = (scratch + 3) // 4 * 4
+        src += '/* Input of the fully connected kernel widened to 16 bits */\n'
+        src += 'static uint32_t %s_scratch[%d];\n' % (prefix, scratch // 4)
+    src += '\n/* Type, quantization and bytes of the input and the output, read by\n * source/ml_benchmark.c */\n'
+    src += 'static const TfLiteTensor %s_io[2] = {\n' % prefix
+    for tensor, (scale, zero) in zip((model['input'], model['output']), model['io']):
+        src += '    {.type = %s, .params = {%.9ef, %d}, .bytes = %d},\n' % (
+            tflite_type, scale, zero, buffers[tensor][1])
+    src += '};\n\n'
+
+    functions = (
+        ('TfLiteStatus %s_init(void)', '    return kTfLiteOk;'),
+        ('TfLiteTensor *%s_input(int index)',
+         '    (void) index;\n    return (TfLiteTensor *) &%s_io[0];' % prefix),
+        ('void *%s_input_ptr(int index)',
+         '    (void) index;\n    return &%s_arena[%d];' % (prefix, buffers[model['input']][0])),
+        ('TfLiteTensor *%s_output(int index)',
+         '    (void) index;\n    return (TfLiteTensor *) &%s_io[1];' % prefix),
+        ('void *%s_output_ptr(int index)',
+         '    (void) index;\n    return &%s_arena[%d];' % (prefix, buffers[model['output']][0])),
+        ('TfLiteStatus %s_invoke(void)', invoke + '    return kTfLiteOk;'))
+    for prototype, body in functions:
+        src += '%s\n{\n%s\n}\n\n' % (prototype % prefix, body)
+    with open(os.path.join(out_dir, base + '.c'), 'w') as out:
+        out.write(src.rstrip('\n') + '\n')
+
+    with open(os.path.join(out_dir, base + '.h'), 'w') as hdr:
+        hdr.write(banner % (base + '.h', name, nn_type))
+        hdr.write('\n\n#ifndef %s\n#define %s\n\n#include "tensorflow/lite/c/common.h"\n\n\n' % (guard, guard))
+        hdr.write('#define %s_ARENA_SIZE (%du)\n' % (base.upper(), arena_size))
+        hdr.write('#define %s_FLASH_SIZE (%du) /* Weights, bias and tables */\n' % (base.upper(), flash))
+        hdr.write('#define %s_RAM_SIZE (%du) /* Arena and scratch */\n\n' % (base.upper(), arena_size + scratch))
+        for prototype, _ in functions:
+            hdr.write(prototype % prefix + ';\n')
+        hdr.write('\n#endif // %s\n' % guard)
+
+    print('%s: %d layers%s, arena %d bytes, scratch %d bytes, flash %d bytes' % (
+        nn_type, len(model['layers']), ' and softmax' if softmax else '', arena_size, scratch, flash))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--models-dir', required=True, help='folder of KEY_tflm_less_model_NN_TYPE.cpp')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--types', default=','.join(NN_TYPES),
+                        help='comma-separated NN_TYPEs to compile (default: %(default)s)')
+    parser.add_argument('--out-dir', required=True, help='folder for the generated .c/.h files')
+    args = parser.parse_args()
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    for nn_type in args.types.split(','):
+        if nn_type not in NN_TYPES:
+            sys.exit('error: unsupported NN_TYPE %s' % nn_type)
+        model = parse_model(os.path.join(args.models_dir, '%s_tflm_less_model_%s.cpp' % (args.name, nn_type)),
+                            nn_type)
+        check_layers(model, nn_type)
+        write_c_files(args.out_dir, args.name, nn_type, model)
+
+
+if __name__ == '__main__':
+    main()
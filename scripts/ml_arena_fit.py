@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_arena_fit.py
+# \version 1.0
+#
+# \brief
+# Sets the tensor arena of a tflm model generated by the ML configurator to
+# the bytes used by the interpreter, measured with ML_ARENA_REPORT.
+#
+# The ML configurator sets KEY_ARENA_SIZE in KEY_tflm_model_NN_TYPE.h to a
+# fixed size. With ML_ARENA_REPORT, the firmware prints the bytes of the arena
+# used from each end after the inferences. This script reads the last of these
+# reports from the UART log, adds a margin for the bytes not written at the
+# edges of the used parts, rounds up to the alignment of the arena and
+# rewrites KEY_ARENA_SIZE in the header in place. When the model fails to
+# initialize with the fitted size, the firmware reports it and the script
+# stops with an error on that log. Measure again after any change of the
+# model, the NN_TYPE or the TFLM kernels.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import re
+import sys
+
+# Alignment of the arena and of its allocations in TFLM
+ARENA_ALIGNMENT = 16
+
+
+def parse_log(path):
+    """Bytes used and size of the arena, from the last report of the log."""
+    with open(path, 'r', errors='replace') as log:
+        reports = re.findall(r'Tensor arena (?:after the inferences: head=\d+, tail=\d+, used=(\d+) of (\d+) bytes|'
+                             r'of (\d+) bytes: initialization failed)', log.read())
+    if not reports:
+        sys.exit('error: %s has no tensor arena report, build with ML_ARENA_REPORT=yes' % path)
+    used, size, failed = reports[-1]
+    if failed:
+        sys.exit('error: the model does not initialize with an arena of %s bytes, set a larger arena size, '
+                 'measure again and fit it with a larger --margin' % failed)
+    used, size = int(used), int(size)
+    if used >= size:
+        sys.exit('error: the whole arena of %d bytes is used, make it larger and measure again' % size)
+    return used, size
+
+
+def fit(header, used, margin, align):
+    with open(header, 'r', newline='') as src:
+        text = src.read()
+    pattern = re.compile(r'#define (\w+_ARENA_SIZE) \((\d+)u\)[^\r\n]*')
+    m = pattern.search(text)
+    if m is None:
+        sys.exit('error: %s has no arena size' % header)
+    old = int(m.group(2))
+    new = (used + margin + align - 1) // align * align
+    text = pattern.sub('#define %s (%du) /* %d bytes used, set by scripts/ml_arena_fit.py */' %
+                       (m.group(1), new, used), text, count=1)
+    with open(header, 'w', newline='') as out:
+        out.write(text)
+    print('%s: %s %d bytes, %d used, set to %d bytes (%d bytes saved)' %
+          (header, m.group(1), old, used, new, old - new))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('header', help='KEY_tflm_model_NN_TYPE.h file, rewritten in place')
+    parser.add_argument('--log', required=True,
+                        help='UART log with the tensor arena report of this model (ML_ARENA_REPORT=yes)')
+    parser.add_argument('--margin', type=int,
+                        help='bytes added to the bytes used (default: two alignment units)')
+    parser.add_argument('--align', type=int, default=ARENA_ALIGNMENT,
+                        help='alignment of the arena size (default: %(default)s)')
+    args = parser.parse_args()
+    # The last allocation at each end of the arena can end in alignment padding
+    # that is never written, so the bytes used can be short by up to one
+    # alignment unit at each end
+    margin = 2 * args.align if args.margin is None else args.margin
+    used, _ = parse_log(args.log)
+    fit(args.header, used, margin, args.align)
+
+
+if __name__ == '__main__':
+    main()
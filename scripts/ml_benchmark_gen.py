@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_benchmark_gen.py
+# \version 1.0
+#
+# \brief
+# Generates the files that link the tflm_less models generated by the ML
+# configurator for several NN_TYPEs into one image, read by
+# source/ml_benchmark.c.
+#
+# The generated models of all the NN_TYPEs define the same functions, so each
+# one is compiled through a wrapper that renames its global symbols (the ones
+# starting with the model name) before including it. The table of variants
+# holds the renamed functions and the memory sizes of each model.
+#
+# With --aot-dir, the table also lists the models compiled ahead of time by
+# scripts/ml_aot_gen.py, which already have their own function names.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import re
+import sys
+
+NN_TYPES = ('int8x8', 'int16x8', 'float')
+
+# Functions of the generated models read through ml_benchmark_variant_t
+FUNCTIONS = (('init', 'TfLiteStatus %s(void)'),
+             ('input', 'TfLiteTensor *%s(int index)'),
+             ('input_ptr', 'void *%s(int index)'),
+             ('output', 'TfLiteTensor *%s(int index)'),
+             ('output_ptr', 'void *%s(int index)'),
+             ('invoke', 'TfLiteStatus %s(void)'))
+
+
+def parse_model(models_dir, name, nn_type):
+    """Global symbols and memory sizes of the tflm_less model of a type."""
+    base = os.path.join(models_dir, '%s_tflm_less_model_%s' % (name, nn_type))
+    with open(base + '.cpp', 'r') as src:
+        text = src.read()
+    with open(base + '.h', 'r') as hdr:
+        header = hdr.read()
+    symbols = sorted(set(re.findall(r'\b%s_\w+' % name, text)))
+    sizes = {}
+    for key in ('CONST', 'INIT', 'UNINIT'):
+        m = re.search(r'#define %s_MODEL_%s_DATA_SIZE (\d+)' % (name, key), header)
+        if m is None:
+            sys.exit('error: %s.h has no %s data size' % (base, key))
+        sizes[key] = int(m.group(1))
+    m = re.search(r'kTensorArenaSize = (\d+);', text)
+    if m is None:
+        sys.exit('error: %s.cpp has no tensor arena' % base)
+    return symbols, sizes, int(m.group(1))
+
+
+def parse_aot(aot_dir, name, nn_type):
+    """Memory sizes of the model of a type compiled ahead of time."""
+    path = os.path.join(aot_dir, '%s_aot_%s.h' % (name, nn_type))
+    with open(path, 'r') as hdr:
+        header = hdr.read()
+    sizes = {}
+    for key in ('ARENA', 'FLASH', 'RAM'):
+        m = re.search(r'#define %s_AOT_%s_%s_SIZE \((\d+)u\)' % (name, nn_type.upper(), key), header)
+        if m is None:
+            sys.exit('error: %s has no %s size' % (path, key.lower()))
+        sizes[key] = int(m.group(1))
+    return sizes
+
+
+def write_files(out_dir, name, models, aot_models):
+    banner = ('/***************************************************************************//**\n'
+              '* \\file %s\n'
+              '*\n'
+              '* \\brief\n'
+              '* Generated with scripts/ml_benchmark_gen.py, this file %s\n'
+              '******************************************************************************/\n')
+    base = '%s_benchmark' % name
+    guard = base.upper() + '_H'
+    num_of_variants = len(models) + len(aot_models)
+    os.makedirs(out_dir, exist_ok=True)
+
+    for nn_type, (symbols, _, _) in models.items():
+        wrapper = '%s_%s.cpp' % (base, nn_type)
+        src = banner % (wrapper, 'compiles the\n* tflm_less %s model of %s with its global symbols renamed,\n'
+                        '* so it links next to the other variants.' % (nn_type, name))
+        src += '\n'
+        for symbol in symbols:
+            src += '#define %s %s_%s%s\n' % (symbol, name, nn_type, symbol[len(name):])
+        src += ('\n// The layer breakdown and the startup phases are those of the model set in\n'
+                '// the Makefile, the markers of the variants are removed\n'
+                '#undef ML_LAYER_PROFILE\n#undef ML_BOOT_PROFILE\n'
+                '#include "%s_tflm_less_model_%s.cpp"\n' % (name, nn_type))
+        with open(os.path.join(out_dir, wrapper), 'w') as out:
+            out.write(src)
+
+    with open(os.path.join(out_dir, base + '.h'), 'w') as hdr:
+        hdr.write(banner % (base + '.h', 'lists the\n* tflm_less models of %s linked for the benchmark.' % name))
+        hdr.write('\n\n#ifndef %s\n#define %s\n\n#include "ml_benchmark.h"\n\n\n' % (guard, guard))
+        hdr.write('#define %s_BENCHMARK_NUM_OF_VARIANTS (%du)\n\n' % (name, num_of_variants))
+        hdr.write('extern const ml_benchmark_variant_t %s_benchmark_variants[%d];\n' % (name, num_of_variants))
+        hdr.write('\n#endif // %s\n' % guard)
+
+    src = banner % (base + '.c', 'lists the\n* tflm_less models of %s linked for the benchmark.' % name)
+    src += '\n\n#include "%s.h"\n\n\n' % base
+    entries = ''
+    for nn_type, (_, sizes, arena) in models.items():
+        for function, prototype in FUNCTIONS:
+            src += prototype % ('%s_%s_%s' % (name, nn_type, function)) + ';\n'
+        src += '\n'
+        entries += '    {"tflm_less %s", %s, %d, %d, %d},\n' % (
+            nn_type, ', '.join('%s_%s_%s' % (name, nn_type, f) for f, _ in FUNCTIONS),
+            arena, sizes['CONST'] + sizes['INIT'], sizes['INIT'] + sizes['UNINIT'])
+        print('%s: %d symbols renamed, arena %d bytes, flash %d bytes, RAM %d bytes' %
+              (nn_type, len(models[nn_type][0]), arena, sizes['CONST'] + sizes['INIT'],
+               sizes['INIT'] + sizes['UNINIT']))
+    for nn_type, sizes in aot_models.items():
+        prefix = '%s_aot_%s' % (name, nn_type)
+        for function, prototype in FUNCTIONS:
+            src += prototype % ('%s_%s' % (prefix, function)) + ';\n'
+        src += '\n'
+        entries += '    {"aot %s", %s, %d, %d, %d},\n' % (
+            nn_type, ', '.join('%s_%s' % (prefix, f) for f, _ in FUNCTIONS),
+            sizes['ARENA'], sizes['FLASH'], sizes['RAM'])
+        print('aot %s: arena %d bytes, flash %d bytes, RAM %d bytes' %
+              (nn_type, sizes['ARENA'], sizes['FLASH'], sizes['RAM']))
+    src += '\nconst ml_benchmark_variant_t %s_benchmark_variants[%d] = {\n%s};\n' % (
+        name, num_of_variants, entries)
+    with open(os.path.join(out_dir, base + '.c'), 'w') as out:
+        out.write(src)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--models-dir', required=True, help='folder of KEY_tflm_less_model_NN_TYPE.cpp/.h')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--types', default=','.join(NN_TYPES),
+                        help='comma-separated NN_TYPEs to link (default: %(default)s)')
+    parser.add_argument('--aot-dir', help='folder of KEY_aot_NN_TYPE.c/.h generated by scripts/ml_aot_gen.py, '
+                        'to also link the models compiled ahead of time')
+    parser.add_argument('--out-dir', required=True, help='folder for the generated files')
+    args = parser.parse_args()
+
+    models = {}
+    aot_models = {}
+    for nn_type in args.types.split(','):
+        if nn_type not in NN_TYPES:
+            sys.exit('error: unsupported NN_TYPE %s' % nn_type)
+        models[nn_type] = parse_model(args.models_dir, args.name, nn_type)
+        if args.aot_dir:
+            aot_models[nn_type] = parse_aot(args.aot_dir, args.name, nn_type)
+    write_files(args.out_dir, args.name, models, aot_models)
+
+
+if __name__ == '__main__':
+    main()
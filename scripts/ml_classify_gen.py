@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_classify_gen.py
+# \version 1.0
+#
+# \brief
+# Adds TEST_MODEL_invoke_classify() and TEST_MODEL_classify_scores() to a
+# tflm_less model generated by the ML configurator, used with
+# ML_PREDICT_MODE=argmax.
+#
+# The trailing nodes of a classification model, such as the softmax, keep the
+# order of the scores they are given. The index of the largest output is then
+# the index of the largest input of the first of them. This script walks the
+# nodeData[] table back from the output tensor over these nodes, as long as
+# each one takes the single output of the node before it. It sets
+# kClassifyNodesCount to the nodes left before them and kClassifyTensorIndex
+# to the tensor of the scores they read, and adds an invoke that only runs
+# these nodes and takes the first index of the largest score, and an accessor
+# of these scores, the input of the trailing nodes. The declarations are added
+# to the model header.
+#
+# The model files are rewritten in place and keep their line endings. Run it
+# again on the files generated again by the ML configurator.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import re
+import sys
+
+from ml_static_init_gen import replace_once, table_entries
+
+# Operators that keep the order of their input values in their output
+MONOTONIC_OPS = ('OP_SOFTMAX', 'OP_LOGISTIC')
+
+# Element type and TfLitePtrUnion member of the scores
+SCORE_TYPES = {
+    'kTfLiteInt8': ('int8_t', 'int8'),
+    'kTfLiteInt16': ('int16_t', 'i16'),
+    'kTfLiteFloat32': ('float', 'f'),
+}
+
+
+def int_array(text, name):
+    m = re.search(r'%s = \{ \d+, \{ ([^}]*)\} \};' % re.escape(name), text)
+    if m is None:
+        sys.exit('error: no %s array' % name)
+    return [int(i) for i in re.findall(r'-?\d+', m.group(1))]
+
+
+def parse_model(text):
+    """Operator, inputs and outputs of each node, type of each tensor, and the output tensor."""
+    ops, inputs, outputs = [], [], []
+    for fields in table_entries(text, 'const NodeInfo_t nodeData[kOpNodesCount]'):
+        inputs.append(int_array(text, re.search(r'&(\w+)$', fields[0]).group(1)))
+        outputs.append(int_array(text, re.search(r'&(\w+)$', fields[1]).group(1)))
+        ops.append(fields[4])
+
+    # Float models do not store the type per tensor
+    loop_type = re.search(r'tflTensors\[i\]\.type = (kTfLite\w+);', text)
+    types = []
+    for fields in table_entries(text, 'const TensorInfo_t tensorData[]'):
+        if len(fields) == 3:
+            if loop_type is None:
+                sys.exit('error: tensorData has no type and init has no common type')
+            types.append(loop_type.group(1))
+        else:
+            types.append(fields[0])
+
+    m = re.search(r'static const int outTensorIndices\[\] = \{\n(.*?)\n    \};', text, re.S)
+    if m is None:
+        sys.exit('error: cannot find the output tensors')
+    out_indices = [int(i) for i in re.findall(r'\d+', m.group(1))]
+    if len(out_indices) != 1:
+        sys.exit('error: %d output tensors, a classification model has one' % len(out_indices))
+    return ops, inputs, outputs, types, out_indices[0]
+
+
+def classify_nodes(ops, inputs, outputs, out_index):
+    """Nodes to run and tensor of the scores, skipping the monotonic tail."""
+    count, scores = len(ops), out_index
+    while count > 0 and ops[count - 1] in MONOTONIC_OPS:
+        node = count - 1
+        if [i for i in inputs[node] if i >= 0] != inputs[node][:1] or outputs[node] != [scores]:
+            break
+        count, scores = node, inputs[node][0]
+    return count, scores
+
+
+def convert(path):
+    with open(path, 'r', newline='') as src:
+        text = src.read()
+    if 'kClassifyNodesCount' in text:
+        print('%s: already holds the classify invoke' % path)
+        return
+    nl = '\r\n' if '\r\n' in text else '\n'
+    text = text.replace(nl, '\n')
+
+    ops, inputs, outputs, types, out_index = parse_model(text)
+    count, scores = classify_nodes(ops, inputs, outputs, out_index)
+    if types[scores] not in SCORE_TYPES:
+        sys.exit('error: unsupported score type %s' % types[scores])
+    ctype, member = SCORE_TYPES[types[scores]]
+    skipped = ops[count:]
+
+    m = re.search(r'constexpr size_t kOpNodesCount = \d+;\n', text)
+    if m is None:
+        sys.exit('error: cannot find kOpNodesCount')
+    if skipped:
+        reason = ('// trailing nodes (%s) keep the order of the output scores, and the\n'
+                  '// scores are read from the input tensor of the first of them.\n' %
+                  ', '.join(sorted(set(skipped))))
+    else:
+        reason = '// model has no trailing node that keeps the order of the output scores.\n'
+    text = text.replace(m.group(0), m.group(0) +
+                        '// Nodes run by the classify invoke, found by scripts/ml_classify_gen.py. The\n' +
+                        reason +
+                        'constexpr size_t kClassifyNodesCount = %d;\n'
+                        'constexpr int kClassifyTensorIndex = %d;\n' % (count, scores), 1)
+
+    # The classify invoke runs the loop of the invoke over the first nodes
+    m = re.search(r'\nextern "C" TfLiteStatus (\w+)_invoke\(\) \{\n(.*?\n  for\(size_t i = 0; i < kOpNodesCount; '
+                  r'\+\+i\) \{\n.*?\n  \}\n)  return kTfLiteOk;\n\}\n', text, re.S)
+    if m is None:
+        sys.exit('error: cannot find the invoke')
+    name, body = m.group(1), m.group(2)
+    body = body.replace('i < kOpNodesCount;', 'i < kClassifyNodesCount;')
+    body = ''.join(line for line in body.splitlines(True) if 'ML_LAYER_PROFILE_' not in line)
+    classify = ('\n\nextern "C" TfLiteStatus %s_invoke_classify(int *predicted_class) {\n%s\n'
+                '  // First index of the largest score, as mtb_ml_utils_find_max()\n'
+                '  const %s *scores = evalTensors[kClassifyTensorIndex].data.%s;\n'
+                '  const int count = evalTensors[kClassifyTensorIndex].dims->data['
+                'evalTensors[kClassifyTensorIndex].dims->size - 1];\n'
+                '  int best = 0;\n'
+                '  for(int i = 1; i < count; ++i) {\n'
+                '    if (scores[i] > scores[best]) {\n'
+                '      best = i;\n'
+                '    }\n'
+                '  }\n'
+                '  *predicted_class = best;\n'
+                '  return kTfLiteOk;\n'
+                '}\n'
+                '\n'
+                'extern "C" void *%s_classify_scores() {\n'
+                '  return evalTensors[kClassifyTensorIndex].data.data;\n'
+                '}\n' % (name, body, ctype, member, name))
+    text = text.replace(m.group(0), m.group(0) + classify, 1)
+
+    with open(path, 'w', newline='') as out:
+        out.write(text.replace('\n', nl))
+
+    header = os.path.splitext(path)[0] + '.h'
+    with open(header, 'r', newline='') as src:
+        text = src.read()
+    nl = '\r\n' if '\r\n' in text else '\n'
+    text = text.replace(nl, '\n')
+    line = 'TfLiteStatus %s_invoke();\n' % name
+    text = replace_once(text, line, line +
+                        '// Runs inference up to the last node that can change the order of the output\n'
+                        '// scores, and returns the index of the largest score. The output tensor is\n'
+                        '// not updated.\n'
+                        'TfLiteStatus %s_invoke_classify(int *predicted_class);\n'
+                        '// Returns the scores read by %s_invoke_classify(), which are the\n'
+                        '// input of the trailing nodes after %s_invoke().\n'
+                        'void *%s_classify_scores();\n' % (name, name, name, name),
+                        'the declaration of %s_invoke()' % name)
+    with open(header, 'w', newline='') as out:
+        out.write(text.replace('\n', nl))
+
+    print('%s: %d of %d nodes run to classify, scores in tensor %d%s' %
+          (path, count, len(ops), scores, ', %s skipped' % ' '.join(skipped) if skipped else ''))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('models', nargs='+', help='KEY_tflm_less_model_NN_TYPE.cpp files, rewritten in place '
+                                                  'with their .h')
+    args = parser.parse_args()
+    for path in args.models:
+        convert(path)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_fc_float_gen.py
+# \version 1.0
+#
+# \brief
+# Generates the float weight tables read by source/ml_fc_f32.c from the fully
+# connected layers and the softmax of a tflm_less float model generated by
+# the ML configurator, with the weights in float32 and in IEEE half precision
+# (fp16). The bias stays in float32 in both.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+from ml_sparse_gen import c_array, parse_graph
+
+# Fused activations, must match ML_FC_F32_ACT_* in source/ml_fc_f32.h
+ACTIVATIONS = {'kTfLiteActNone': 'ML_FC_F32_ACT_NONE',
+               'kTfLiteActRelu': 'ML_FC_F32_ACT_RELU',
+               'kTfLiteActRelu6': 'ML_FC_F32_ACT_RELU6'}
+
+
+# Weight bits of each variant, must match ML_FC_F32_WEIGHTS_* in source/ml_fc_f32.h
+VARIANTS = {'float': (32, 'ML_FC_F32_WEIGHTS_F32'), 'fp16': (16, 'ML_FC_F32_WEIGHTS_F16')}
+
+
+def half_bits(value):
+    """IEEE half bits of a float, rounded to nearest even."""
+    try:
+        return struct.unpack('<H', struct.pack('<e', value))[0]
+    except OverflowError:
+        sys.exit('error: weight %g does not fit in half precision' % value)
+
+
+def float_array(name, values, per_line=8):
+    # Nine significant digits give back the float32 value of the model
+    out = 'static const float %s[%d] __attribute__((aligned(4))) = {\n' % (name, len(values))
+    for i in range(0, len(values), per_line):
+        out += '    ' + ', '.join('%.9ef' % v for v in values[i:i + per_line]) + ',\n'
+    return out + '};\n\n'
+
+
+def parse_float_layers(path):
+    """Return the fully connected layers of a tflm_less float model, in
+    execution order, and the beta of its trailing softmax (0 if none)."""
+    graph = parse_graph(path)
+    text = graph['text']
+    layers = []
+    for node in graph['fc_nodes']:
+        _, weight, bias = graph['inputs'][node]
+        rows, cols = graph['dims'][weight]
+        m = re.search(r'TfLiteFullyConnectedParams opdata%d = \{ (\w+),' % node, text)
+        if m.group(1) not in ACTIVATIONS:
+            sys.exit('error: node %d has an unsupported activation %s' % (node, m.group(1)))
+        layers.append((rows, cols, ACTIVATIONS[m.group(1)], graph['data'][weight],
+                       graph['data'][bias] if bias >= 0 else None))
+    m = re.search(r'TfLiteSoftmaxParams opdata\d+ = \{ ([^ }]+)', text)
+    return layers, float(m.group(1)) if m else 0.0
+
+
+def write_c_files(out_dir, name, layers, beta):
+    base = '%s_fc_float' % name
+    guard = base.upper() + '_H'
+    banner = ('/***************************************************************************//**\n'
+              '* \\file %s\n'
+              '*\n'
+              '* \\brief\n'
+              '* Generated with scripts/ml_fc_float_gen.py, this file contains the fully\n'
+              '* connected layers of the %s model (float) with float32 weights and with\n'
+              '* half precision weights.\n'
+              '******************************************************************************/\n')
+    os.makedirs(out_dir, exist_ok=True)
+    with open(os.path.join(out_dir, base + '.h'), 'w') as hdr:
+        hdr.write(banner % (base + '.h', name))
+        hdr.write('\n\n#ifndef %s\n#define %s\n\n#include "ml_fc_f32.h"\n\n\n' % (guard, guard))
+        for variant in VARIANTS:
+            hdr.write('extern const ml_fc_f32_model_t %s_fc_%s;\n' % (name, variant))
+        hdr.write('\n#endif // %s\n' % guard)
+
+    src = banner % (base + '.c', name)
+    src += '\n\n#include "%s.h"\n\n#include <stddef.h>\n\n\n' % base
+    max_width = max(max(rows, cols) for rows, cols, _, _, _ in layers)
+    for variant, (bits, weight_format) in VARIANTS.items():
+        entries = ''
+        weight_bytes = 0
+        for i, (rows, cols, activation, weights, bias) in enumerate(layers):
+            prefix = '%s_fc_%s_%d' % (name, variant, i)
+            if bits == 16:
+                src += c_array('uint16_t', prefix + '_weights', [half_bits(w) for w in weights])
+            else:
+                src += float_array(prefix + '_weights', weights)
+            weight_bytes += len(weights) * bits // 8
+            # The bias is shared by the variants
+            bias_name = '%s_fc_bias_%d' % (name, i)
+            if bias is not None and variant == 'float':
+                src += float_array(bias_name, bias)
+            if bias is not None:
+                weight_bytes += len(bias) * 4
+            entries += '    {%d, %d, %s, %s, %s_weights, %s},\n' % (
+                rows, cols, weight_format, activation, prefix, bias_name if bias is not None else 'NULL')
+        src += 'static const ml_fc_f32_layer_t %s_fc_%s_layers[%d] = {\n%s};\n\n' % (
+            name, variant, len(layers), entries)
+        src += 'const ml_fc_f32_model_t %s_fc_%s = {%d, %s_fc_%s_layers, %d, %d, %.9ef};\n\n' % (
+            name, variant, len(layers), name, variant, max_width, weight_bytes, beta)
+        print('%s: %d layers, %d weight bytes, softmax beta=%g' % (variant, len(layers), weight_bytes, beta))
+    with open(os.path.join(out_dir, base + '.c'), 'w') as out:
+        out.write(src)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--model', required=True, help='KEY_tflm_less_model_float.cpp')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--out-dir', required=True, help='folder for the generated .c/.h files')
+    args = parser.parse_args()
+
+    layers, beta = parse_float_layers(args.model)
+    write_c_files(args.out_dir, args.name, layers, beta)
+
+
+if __name__ == '__main__':
+    main()
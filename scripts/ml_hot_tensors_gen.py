@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_hot_tensors_gen.py
+# \version 1.0
+#
+# \brief
+# Marks the weight tensors of the slowest nodes of a tflm_less model generated
+# by the ML configurator, copied to SRAM at startup when ML_HOT_TENSORS is
+# defined.
+#
+# The weights of a tflm_less model are constant arrays, read in place from
+# flash. The layer breakdown printed with ML_LAYER_PROFILE gives the average
+# cycles of each node. This script ranks the nodes by these cycles and takes
+# the constant input tensors of the slowest nodes first, until the SRAM budget
+# is used. The arrays taken are declared with ML_HOT_TENSOR_CONST, which drops
+# their const with ML_HOT_TENSORS, so they are initialized data copied from
+# flash to SRAM at reset. The tensor tables keep pointing to them, wherever
+# they are linked.
+#
+# The model file is rewritten in place and keeps its line endings. Run it again
+# with a new layer breakdown or budget, the previous marks are replaced.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import re
+import sys
+
+from ml_static_init_gen import split_fields, table_entries
+
+DEFINE = 'ML_HOT_TENSORS'
+MARK = 'ML_HOT_TENSOR_CONST'
+
+# Declared after the ALIGN() macro of the model
+ALIGN_END = '#define ALIGN(X) __align(X)\n#endif\n'
+MARK_BLOCK = ('\n// Weight tensors of the slowest nodes, taken by scripts/ml_hot_tensors_gen.py\n'
+              '// from the layer breakdown. With %s they are initialized data\n'
+              '// copied to SRAM at reset, the others are read in place from flash.\n'
+              '#ifdef %s\n#define %s\n#else\n#define %s const\n#endif  // %s\n' %
+              (DEFINE, DEFINE, MARK, MARK, DEFINE))
+
+
+def parse_profile(path):
+    """Average cycles of each node, from the last layer breakdown of the log."""
+    with open(path, 'r', errors='replace') as log:
+        lines = log.read().splitlines()
+    starts = [i for i, line in enumerate(lines) if line.strip() == 'node,calls,avg_cycles,percent']
+    if not starts:
+        sys.exit('error: %s has no layer breakdown, build with ML_LAYER_PROFILE=yes' % path)
+    cycles = {}
+    for line in lines[starts[-1] + 1:]:
+        m = re.match(r'(\d+),(\d+),(\d+),([\d.]+)$', line.strip())
+        if m is None:
+            break
+        cycles[int(m.group(1))] = (int(m.group(3)), float(m.group(4)))
+    return cycles
+
+
+def parse_model(text):
+    """Constant data array and bytes of each tensor, and inputs of each node."""
+    tensors = []
+    for fields in table_entries(text, 'const TensorInfo_t tensorData[]'):
+        # Float models do not store the type and quantization per tensor
+        data, size = (fields[0], fields[2]) if len(fields) == 3 else (fields[1], fields[3])
+        m = re.match(r'\(void\*\)(\w+)$', data)
+        tensors.append((m.group(1), int(size)) if m else (None, int(size)))
+
+    inputs = []
+    for fields in table_entries(text, 'const NodeInfo_t nodeData[kOpNodesCount]'):
+        name = re.search(r'&(\w+)$', fields[0]).group(1)
+        m = re.search(r'%s = \{ \d+, \{ ([^}]*)\} \};' % re.escape(name), text)
+        if m is None:
+            sys.exit('error: no %s array' % name)
+        inputs.append([int(i) for i in re.findall(r'-?\d+', m.group(1))])
+    return tensors, inputs
+
+
+def convert(path, profile, budget):
+    with open(path, 'r', newline='') as src:
+        text = src.read()
+    nl = '\r\n' if '\r\n' in text else '\n'
+    text = text.replace(nl, '\n')
+
+    # Replace the marks of a previous run
+    text = re.sub(r'\b%s ALIGN\(' % MARK, 'const ALIGN(', text)
+    if MARK_BLOCK not in text:
+        if text.count(ALIGN_END) != 1:
+            sys.exit('error: cannot find the ALIGN() macro')
+        text = text.replace(ALIGN_END, ALIGN_END + MARK_BLOCK)
+
+    tensors, inputs = parse_model(text)
+    ranked = sorted(profile, key=lambda node: profile[node][0], reverse=True)
+    if any(node >= len(inputs) for node in ranked):
+        sys.exit('error: the layer breakdown has %d nodes, the model %d' % (len(ranked), len(inputs)))
+
+    taken, used = [], 0
+    print('%s: SRAM budget %d bytes' % (path, budget))
+    for node in ranked:
+        avg, percent = profile[node]
+        for index in inputs[node]:
+            if index < 0:
+                continue
+            symbol, size = tensors[index]
+            if symbol is None or symbol in taken:
+                continue
+            fits = used + size <= budget
+            print('  node %d, %d cycles (%.1f%%): %s, %d bytes, %s' %
+                  (node, avg, percent, symbol, size, 'SRAM' if fits else 'flash, over the budget'))
+            if fits:
+                taken.append(symbol)
+                used += size
+                decl = re.compile(r'\nconst (ALIGN\(\d+\) \w+ %s\[)' % symbol)
+                if len(decl.findall(text)) != 1:
+                    sys.exit('error: cannot find the declaration of %s' % symbol)
+                text = decl.sub(r'\n%s \1' % MARK, text)
+
+    flash = sum(size for symbol, size in tensors if symbol is not None) - used
+    print('  %d weight tensors copied to SRAM at startup, %d bytes, %d bytes left in flash' %
+          (len(taken), used, flash))
+
+    with open(path, 'w', newline='') as out:
+        out.write(text.replace('\n', nl))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('model', help='KEY_tflm_less_model_NN_TYPE.cpp file, rewritten in place')
+    parser.add_argument('--profile', required=True,
+                        help='UART log with the layer breakdown of this model (ML_LAYER_PROFILE=yes)')
+    parser.add_argument('--budget', type=int, required=True, help='SRAM bytes for the weight tensors')
+    args = parser.parse_args()
+    convert(args.model, parse_profile(args.profile), args.budget)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_precision_sweep.py
+# \version 1.0
+#
+# \brief
+# Sweeps the precision of each fully connected layer of a tflm_less float
+# model generated by the ML configurator, and reports the accuracy/latency
+# Pareto frontier of the mixed-precision configurations.
+#
+# Each layer runs as one of the NN_TYPE quantizations: int8x8, int16x8,
+# int16x16 or float. The accuracy is simulated on the host over the regression
+# data: weights, bias and activations are rounded to the integer grid of the
+# layer, and a layer requantizes its input when the previous layer has another
+# precision. The activation grids are calibrated with the float model over
+# the same data, or taken from the tflm_less model of that NN_TYPE when given,
+# which was calibrated over the training data. The predicted classes are
+# compared with the reference classes, as the firmware does against
+# SUCCESS_RATE.
+#
+# The cycles of each layer come from the profiler_info_log.txt of the model
+# built with each NN_TYPE, with layer profiling enabled. Without logs, the
+# layers are ranked by an estimated relative cost per MAC instead.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import math
+import re
+import sys
+
+from ml_fc_float_gen import parse_float_layers
+from ml_regression_convert import argmax, load_from_c
+from ml_sparse_gen import parse_graph, round_half_away
+
+# Must match SUCCESS_RATE in source/ml_validation.c
+SUCCESS_RATE = 98.0
+
+# Activation and weight bits of each NN_TYPE, None for float
+PRECISIONS = {'int8x8': (8, 8), 'int16x8': (16, 8), 'int16x16': (16, 16), 'float': (None, None)}
+
+# Rough cost of one MAC relative to int8x8 on the Cortex-M4, only used to
+# rank the layers when no profiler log is given: two int8 MACs per SMLAD,
+# one int16 MAC per SMLA, one float MAC per VFMA plus its weight load
+RELATIVE_MAC_COST = {'int8x8': 1.0, 'int16x8': 2.0, 'int16x16': 2.0, 'float': 4.0}
+
+# Per-layer lines of profiler_info_log.txt: a layer (or node) index, then its
+# cycles. Lines naming the operator are matched against FC_OPERATOR.
+LAYER_LINE = re.compile(r'\b(?:layer|node)\D{0,4}(\d+)\b.*?\bcycles\D{0,4}(\d+)', re.IGNORECASE)
+FC_OPERATOR = re.compile(r'FULLY_?CONNECTED', re.IGNORECASE)
+OPERATOR = re.compile(r'\b[A-Z][A-Z0-9]*_[A-Z0-9_]+\b')
+
+
+class Grid:
+    """Integer grid of a tensor: value = (q - zero) * scale, q in [qmin, qmax]."""
+    def __init__(self, bits, scale, zero=0):
+        self.qmax = (1 << (bits - 1)) - 1
+        self.qmin = -self.qmax - 1
+        self.scale = scale if scale > 0 else 1.0
+        self.zero = zero
+
+    @classmethod
+    def calibrated(cls, bits, low, high, symmetric):
+        """Grid covering [low, high] and zero, as the TFLite converter."""
+        qmax = (1 << (bits - 1)) - 1
+        low, high = min(low, 0.0), max(high, 0.0)
+        if symmetric:
+            return cls(bits, max(-low, high) / qmax)
+        scale = (high - low) / (2 * qmax + 1)
+        return cls(bits, scale, round_half_away(-qmax - 1 - low / scale) if scale > 0 else 0)
+
+    def round(self, values):
+        out = []
+        for v in values:
+            q = min(max(round_half_away(v / self.scale) + self.zero, self.qmin), self.qmax)
+            out.append((q - self.zero) * self.scale)
+        return out
+
+
+class Layer:
+    def __init__(self, rows, cols, activation, weights, bias):
+        self.rows = rows
+        self.cols = cols
+        self.relu = {'ML_FC_F32_ACT_RELU': (0.0, math.inf),
+                     'ML_FC_F32_ACT_RELU6': (0.0, 6.0)}.get(activation)
+        self.weights = [weights[r * cols:(r + 1) * cols] for r in range(rows)]
+        self.bias = bias if bias is not None else [0.0] * rows
+        # Calibration ranges of the input and the output
+        self.input_range = [math.inf, -math.inf]
+        self.output_range = [math.inf, -math.inf]
+        # Input and output grids of the quantized models, per precision
+        self.model_grids = {}
+        self.quantized = {}
+
+    def quantize(self, precision):
+        """Weights and bias rounded to the grids of a precision, and the
+        grids of the input and the output (None for float)."""
+        if precision in self.quantized:
+            return self.quantized[precision]
+        activation_bits, weight_bits = PRECISIONS[precision]
+        if activation_bits is None:
+            self.quantized[precision] = (self.weights, self.bias, None, None)
+            return self.quantized[precision]
+        if precision in self.model_grids:
+            input_grid, output_grid = self.model_grids[precision]
+        else:
+            # int8 activations are asymmetric, int16 activations are symmetric
+            symmetric = activation_bits == 16
+            input_grid = Grid.calibrated(activation_bits, *self.input_range, symmetric)
+            output_grid = Grid.calibrated(activation_bits, *self.output_range, symmetric)
+        largest = max(abs(w) for row in self.weights for w in row)
+        weight_grid = Grid.calibrated(weight_bits, -largest, largest, True)
+        weights = [weight_grid.round(row) for row in self.weights]
+        # The bias is a 32-bit integer at the scale of the accumulator
+        bias_scale = input_grid.scale * weight_grid.scale
+        bias = [round_half_away(b / bias_scale) * bias_scale for b in self.bias]
+        self.quantized[precision] = (weights, bias, input_grid, output_grid)
+        return self.quantized[precision]
+
+    def run(self, values, precision=None):
+        """Outputs of the layer for one sample. Without precision, in float,
+        updating the calibration ranges."""
+        if precision is None:
+            weights, bias, input_grid, output_grid = self.weights, self.bias, None, None
+            self.input_range = [min(self.input_range[0], min(values)),
+                                max(self.input_range[1], max(values))]
+        else:
+            weights, bias, input_grid, output_grid = self.quantize(precision)
+        if input_grid is not None:
+            values = input_grid.round(values)
+        out = []
+        for row, b in zip(weights, bias):
+            acc = b + sum(w * x for w, x in zip(row, values) if x != 0.0)
+            if self.relu is not None:
+                acc = min(max(acc, self.relu[0]), self.relu[1])
+            out.append(acc)
+        if precision is None:
+            self.output_range = [min(self.output_range[0], min(out)),
+                                 max(self.output_range[1], max(out))]
+        if output_grid is not None:
+            out = output_grid.round(out)
+        return out
+
+
+def load_model_grids(layers, precision, path):
+    """Use the input and output grids of the fully connected layers of a
+    tflm_less model quantized with the precision."""
+    graph = parse_graph(path)
+    if len(graph['fc_nodes']) != len(layers):
+        sys.exit('error: %s has %d fully connected layers, the float model has %d' %
+                 (path, len(graph['fc_nodes']), len(layers)))
+    bits = PRECISIONS[precision][0]
+    for layer, node in zip(layers, graph['fc_nodes']):
+        tensors = (graph['inputs'][node][0], graph['outputs'][node][0])
+        layer.model_grids[precision] = tuple(Grid(bits, graph['scales'][t][0], graph['zeros'][t][0])
+                                             for t in tensors)
+
+
+def softmax_class(values, precision, beta):
+    """Predicted class of the softmax output, rounded to the output grid of
+    the precision, so ties pick the first class as in the firmware."""
+    top = max(values)
+    exps = [math.exp(beta * (v - top)) for v in values]
+    total = sum(exps)
+    probs = [e / total for e in exps]
+    activation_bits = PRECISIONS[precision][0]
+    if activation_bits is not None:
+        # TFLM softmax outputs: int8 scale 1/256 zero -128, int16 scale 1/32768 zero 0
+        steps = 256 if activation_bits == 8 else 32768
+        probs = [min(round_half_away(p * steps), steps - 1) for p in probs]
+    return argmax(probs)
+
+
+def parse_profile(path, num_of_layers):
+    """Cycles of each fully connected layer, in execution order, and the total
+    cycles of the other layers, from one profiler_info_log.txt. When the log
+    holds several runs, the last one is kept."""
+    layers = {}
+    with open(path, 'r') as log:
+        for line in log:
+            m = LAYER_LINE.search(line)
+            if m:
+                op = OPERATOR.search(line)
+                is_fc = bool(FC_OPERATOR.search(line)) if op else None
+                layers[int(m.group(1))] = (int(m.group(2)), is_fc)
+    if not layers:
+        sys.exit('error: no per-layer cycles in %s, enable layer profiling' % path)
+    # Without operator names, the fully connected layers are the first nodes
+    order = sorted(layers)
+    fc = [i for i in order if layers[i][1]] if any(layers[i][1] for i in order) else order[:num_of_layers]
+    if len(fc) != num_of_layers:
+        sys.exit('error: %s has %d fully connected layers, the model has %d' % (path, len(fc), num_of_layers))
+    other = sum(layers[i][0] for i in order if i not in fc)
+    return [layers[i][0] for i in fc], other
+
+
+def layer_costs(layers, logs):
+    """Cost of each layer per precision, and of the other layers per precision
+    of the last fully connected layer."""
+    costs = {}
+    others = {}
+    if logs:
+        for precision, path in logs.items():
+            costs[precision], others[precision] = parse_profile(path, len(layers))
+    else:
+        for precision, cost in RELATIVE_MAC_COST.items():
+            costs[precision] = [cost * layer.rows * layer.cols for layer in layers]
+            others[precision] = 0
+    return costs, others
+
+
+def sweep(layers, samples, reference, precisions, beta):
+    """Agreement with the reference classes of each configuration. The outputs
+    of a prefix of layers are shared by the configurations that start with it."""
+    results = {}
+
+    def visit(config, outputs):
+        if len(config) == len(layers):
+            classes = [softmax_class(out, config[-1], beta) for out in outputs]
+            agreed = sum(1 for c, ref in zip(classes, reference) if c == ref)
+            results[config] = 100.0 * agreed / len(reference)
+            return
+        layer = layers[len(config)]
+        for precision in precisions:
+            visit(config + (precision,), [layer.run(out, precision) for out in outputs])
+
+    visit((), samples)
+    return results
+
+
+def pareto(rows):
+    """Configurations that no faster configuration matches in accuracy."""
+    frontier = []
+    best = -1.0
+    for row in sorted(rows, key=lambda r: (r['cycles'], -r['accuracy'])):
+        if row['accuracy'] > best:
+            frontier.append(row)
+            best = row['accuracy']
+    return frontier
+
+
+def parse_pairs(option, entries, precisions):
+    pairs = {}
+    for entry in entries:
+        precision, _, path = entry.partition('=')
+        if precision not in precisions or not path:
+            sys.exit('error: %s expects NN_TYPE=PATH with NN_TYPE in %s' % (option, ', '.join(precisions)))
+        pairs[precision] = path
+    return pairs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--model', required=True, help='KEY_tflm_less_model_float.cpp')
+    parser.add_argument('--x', required=True, help='KEY_tflm_x_data_float.c')
+    parser.add_argument('--y', help='KEY_tflm_y_data_float.c, reference classes '
+                                    '(default: the float model on the host)')
+    parser.add_argument('--log', action='append', default=[], metavar='NN_TYPE=PATH',
+                        help='profiler_info_log.txt of the model built with NN_TYPE, '
+                             'with layer profiling, once per precision to sweep')
+    parser.add_argument('--quantized-model', action='append', default=[], metavar='NN_TYPE=PATH',
+                        help='KEY_tflm_less_model_NN_TYPE.cpp, activation grids of that precision '
+                             '(default: calibrated over the regression data)')
+    parser.add_argument('--success-rate', type=float, default=SUCCESS_RATE,
+                        help='accuracy required from the configuration (default: %(default)s)')
+    parser.add_argument('--csv', help='write all the configurations to this CSV file')
+    args = parser.parse_args()
+
+    logs = parse_pairs('--log', args.log, list(PRECISIONS))
+    quantized_models = parse_pairs('--quantized-model', args.quantized_model,
+                                   [p for p, bits in PRECISIONS.items() if bits[0] is not None])
+    precisions = [p for p in PRECISIONS if p in logs] if logs else list(PRECISIONS)
+
+    float_layers, beta = parse_float_layers(args.model)
+    layers = [Layer(*fl) for fl in float_layers]
+    for precision, path in quantized_models.items():
+        load_model_grids(layers, precision, path)
+    dataset = load_from_c(args.x, args.y, 'float')
+    samples = dataset.samples
+
+    # Float run, which also calibrates the activation ranges
+    reference = []
+    for sample in samples:
+        out = sample
+        for layer in layers:
+            out = layer.run(out)
+        reference.append(argmax(out))
+    if dataset.labels is not None:
+        reference = dataset.labels
+
+    costs, others = layer_costs(layers, logs)
+    unit = 'cycles' if logs else 'relative cost'
+    rows = []
+    for config, accuracy in sweep(layers, samples, reference, precisions, beta).items():
+        cycles = sum(costs[p][i] for i, p in enumerate(config)) + others[config[-1]]
+        weight_bytes = sum(layer.rows * layer.cols * (PRECISIONS[p][1] or 32) // 8
+                           for layer, p in zip(layers, config))
+        rows.append({'config': config, 'accuracy': accuracy, 'cycles': cycles,
+                     'weight_bytes': weight_bytes})
+
+    print('%d samples, %d layers, %d configurations, latency in %s' %
+          (len(samples), len(layers), len(rows), unit))
+    for i, layer in enumerate(layers):
+        print('  layer %d: %dx%d, %s' % (i, layer.rows, layer.cols,
+                                          ', '.join('%s %g' % (p, costs[p][i]) for p in precisions)))
+    print('\nPareto frontier:')
+    print('  %-40s %9s %14s %12s' % ('layers', 'accuracy', unit, 'weight bytes'))
+    for row in pareto(rows):
+        print('  %-40s %8.2f%% %14g %12d' % (' '.join(row['config']), row['accuracy'],
+                                             row['cycles'], row['weight_bytes']))
+
+    passing = [r for r in rows if r['accuracy'] >= args.success_rate]
+    if passing:
+        best = min(passing, key=lambda r: (r['cycles'], -r['accuracy']))
+        print('\nFastest configuration with accuracy >= %g%%: %s (%.2f%%, %g %s)' %
+              (args.success_rate, ' '.join(best['config']), best['accuracy'], best['cycles'], unit))
+    else:
+        print('\nNo configuration reaches %g%%' % args.success_rate)
+
+    if args.csv:
+        with open(args.csv, 'w') as out:
+            out.write('%s,accuracy,%s,weight_bytes,pareto\n' %
+                      (','.join('layer%d' % i for i in range(len(layers))), unit.replace(' ', '_')))
+            frontier = [id(r) for r in pareto(rows)]
+            for row in sorted(rows, key=lambda r: r['cycles']):
+                out.write('%s,%.2f,%g,%d,%d\n' % (','.join(row['config']), row['accuracy'], row['cycles'],
+                                                 row['weight_bytes'], id(row) in frontier))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,251 @@
+/******************************************************************************
+* File Name:   ml_prefetch_host.c
+*
+* Description: This file contains a host driver of the ping-pong prefetcher,
+*              built with ML_PREFETCH_HOST_SIM, which checks the order of the
+*              samples handed out and the counting of the stalls.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ml_prefetch.h"
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Samples small enough that the copy is done before the wait */
+#define SMALL_SAMPLE_SIZE   (4096u)
+#define SMALL_SAMPLE_COUNT  (8u)
+/* Sample large enough that an immediate wait finds the copy in flight */
+#define LARGE_SAMPLE_SIZE   (64u * 1024u * 1024u)
+/* Time left to the copy of a small sample before waiting for it */
+#define SETTLE_TIME_NS      (20000000L)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static int failures = 0;
+
+/*******************************************************************************
+* Function Name: check
+********************************************************************************
+* Summary:
+*   Report a failed condition.
+*
+* Parameters:
+*   cond: condition to check
+*   what: description of the condition
+*
+* Return:
+*   void
+*******************************************************************************/
+static void check(int cond, const char *what)
+{
+    if (!cond)
+    {
+        printf("FAIL: %s\r\n", what);
+        failures++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: is_filled
+********************************************************************************
+* Summary:
+*   Check that a buffer holds a single byte value.
+*
+* Parameters:
+*   buffer: buffer to check
+*   size: size in bytes
+*   value: expected byte value
+*
+* Return:
+*   int: 1 if all bytes are equal to value.
+*******************************************************************************/
+static int is_filled(const uint8_t *buffer, uint32_t size, uint8_t value)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        if (buffer[i] != value)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*******************************************************************************
+* Function Name: settle
+********************************************************************************
+* Summary:
+*   Sleep long enough for the copy of a small sample to complete.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+static void settle(void)
+{
+    struct timespec delay = { 0, SETTLE_TIME_NS };
+
+    nanosleep(&delay, NULL);
+}
+
+/*******************************************************************************
+* Function Name: test_ordering
+********************************************************************************
+* Summary:
+*   Prefetch the samples in sequence as the local regression does: the next
+*   sample is started while the current one is in use. Each wait must return
+*   the sample started last, in the other buffer, and must leave the sample
+*   handed out before it untouched. The copies are done before each wait, so
+*   no stall is counted.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+static void test_ordering(void)
+{
+    static uint8_t samples[SMALL_SAMPLE_COUNT][SMALL_SAMPLE_SIZE];
+    ml_prefetch_t pf;
+    const uint8_t *current;
+    const uint8_t *next;
+
+    for (uint32_t i = 0; i < SMALL_SAMPLE_COUNT; i++)
+    {
+        memset(samples[i], (int) (i + 1u), SMALL_SAMPLE_SIZE);
+    }
+
+    check(CY_RSLT_SUCCESS == ml_prefetch_init(&pf, SMALL_SAMPLE_SIZE), "init");
+    check(NULL == ml_prefetch_wait(&pf), "wait without a copy returns NULL");
+
+    check(CY_RSLT_SUCCESS == ml_prefetch_start(&pf, samples[0]), "start of sample 0");
+    check(MTB_ML_RESULT_BAD_ARG == ml_prefetch_start(&pf, samples[1]),
+          "second start with a copy in flight is rejected");
+    settle();
+    current = ml_prefetch_wait(&pf);
+    check((current != NULL) && is_filled(current, SMALL_SAMPLE_SIZE, 1u), "sample 0 copied");
+
+    for (uint32_t i = 1; i < SMALL_SAMPLE_COUNT; i++)
+    {
+        check(CY_RSLT_SUCCESS == ml_prefetch_start(&pf, samples[i]), "start of next sample");
+        settle();
+        next = ml_prefetch_wait(&pf);
+        check((next != NULL) && (next != current), "next sample in the other buffer");
+        check((next != NULL) && is_filled(next, SMALL_SAMPLE_SIZE, (uint8_t) (i + 1u)),
+              "next sample copied in order");
+        check(is_filled(current, SMALL_SAMPLE_SIZE, (uint8_t) i),
+              "current sample untouched by the next copy");
+        current = next;
+    }
+
+    check(0u == pf.stall_count, "no stall when the copies are done before the waits");
+    check(0u == pf.stall_cycles, "no stall time when the copies are done before the waits");
+    check(0u == pf.fallback_count, "no synchronous copy");
+
+    ml_prefetch_free(&pf);
+}
+
+/*******************************************************************************
+* Function Name: test_stall
+********************************************************************************
+* Summary:
+*   Wait right after starting the copy of a large sample: the wait finds the
+*   copy in flight, and must count one stall and the time spent waiting.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+static void test_stall(void)
+{
+    uint8_t *sample = (uint8_t *) malloc(LARGE_SAMPLE_SIZE);
+    ml_prefetch_t pf;
+    const uint8_t *buffer;
+
+    if (sample == NULL)
+    {
+        check(0, "allocation of the large sample");
+        return;
+    }
+    memset(sample, 0x5A, LARGE_SAMPLE_SIZE);
+
+    check(CY_RSLT_SUCCESS == ml_prefetch_init(&pf, LARGE_SAMPLE_SIZE), "init of the large sample");
+    check(CY_RSLT_SUCCESS == ml_prefetch_start(&pf, sample), "start of the large sample");
+    buffer = ml_prefetch_wait(&pf);
+    check((buffer != NULL) && is_filled(buffer, LARGE_SAMPLE_SIZE, 0x5Au), "large sample copied");
+    check(1u == pf.stall_count, "one stall for the wait on the copy in flight");
+    check(0u < pf.stall_cycles, "stall time accounted");
+    printf("Stall: %lu wait(s), %lu ns\r\n",
+           (unsigned long) pf.stall_count, (unsigned long) pf.stall_cycles);
+
+    ml_prefetch_free(&pf);
+    free(sample);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*   Run the host checks of the prefetcher.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   int: 0 if all checks passed.
+*******************************************************************************/
+int main(void)
+{
+    test_ordering();
+    test_stall();
+
+    printf("%s\r\n", (failures == 0) ? "PASS" : "FAIL");
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_profile_hooks_gen.py
+# \version 1.0
+#
+# \brief
+# Adds the startup phase markers of ML_BOOT_PROFILE and the node markers of
+# ML_LAYER_PROFILE to a tflm_less model generated by the ML configurator.
+#
+# TEST_MODEL_init() sets up the tensor tables, registers the operators and
+# runs the init and prepare of each node. This script marks each of these
+# phases with ML_BOOT_PHASE_BEGIN() and ML_BOOT_PHASE_END() of
+# source/ml_boot_profile.h, the init and prepare once per node with its index.
+# It also marks the invoke of each node in TEST_MODEL_invoke() with
+# ML_LAYER_PROFILE_BEGIN() and ML_LAYER_PROFILE_END() of
+# source/ml_layer_profile.h. The classify invoke is not marked, so the layer
+# breakdown only counts full inferences. Without ML_BOOT_PROFILE and
+# ML_LAYER_PROFILE, the markers are removed by the preprocessor.
+#
+# The model file is rewritten in place and keeps its line endings. Run it again
+# on the files generated again by the ML configurator, or after the other
+# scripts; the previous markers are replaced.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import re
+import sys
+
+from ml_static_init_gen import replace_once
+
+# Included after the offline op user data utilities of the model
+INCLUDE_AFTER = ('#if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA\n'
+                 '#include "ifx_common/offline_prepare_utils.h" \n'
+                 '#endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA\n')
+INCLUDE_BLOCK = ('\n// Startup phases of TEST_MODEL_init(), timed with ML_BOOT_PROFILE, and cycles\n'
+                 '// of each node invoke, with ML_LAYER_PROFILE, marked by\n'
+                 '// scripts/ml_profile_hooks_gen.py\n'
+                 'extern "C" {\n'
+                 '#include "ml_boot_profile.h"\n'
+                 '#include "ml_layer_profile.h"\n'
+                 '}\n')
+
+# Lines of a previous run
+HOOK_LINE = re.compile(r'^ *ML_(BOOT_PHASE|LAYER_PROFILE)_(BEGIN|END)\(.*\);\n', re.M)
+
+
+def function_body(text, signature):
+    """Span of the body of a generated function, up to its closing brace."""
+    start = text.find(signature)
+    if start < 0 or text.count(signature) != 1:
+        sys.exit('error: cannot find %s' % signature.strip())
+    start += len(signature)
+    end = text.find('\n}\n', start)
+    return start, end + 1
+
+
+def wrap_line(body, line, name, index, what):
+    """Marks a single statement as a phase, keeping its indentation."""
+    if body.count(line) != 1:
+        sys.exit('error: cannot find %s' % what)
+    indent = line[:len(line) - len(line.lstrip(' '))]
+    return body.replace(line, '%sML_BOOT_PHASE_BEGIN("%s", %s);\n%s%sML_BOOT_PHASE_END();\n' %
+                        (indent, name, index, line, indent))
+
+
+def mark_init(body):
+    """Phases of the init: tensor tables, op registrations, init and prepare of each node."""
+    body = '  ML_BOOT_PHASE_BEGIN("tensor tables", ML_BOOT_PROFILE_NO_INDEX);\n' + body
+
+    registrations = re.findall(r'^  registrations\[\w+\] = .*;\n', body, re.M)
+    if not registrations:
+        sys.exit('error: cannot find the op registrations')
+    first, last = registrations[0], registrations[-1]
+    body = body.replace(first, '  ML_BOOT_PHASE_END();\n'
+                        '  ML_BOOT_PHASE_BEGIN("op registrations", ML_BOOT_PROFILE_NO_INDEX);\n' + first, 1)
+    body = body.replace(last, last + '  ML_BOOT_PHASE_END();\n', 1)
+
+    body = wrap_line(body, '      tflNodes[i].user_data = registrations[nodeData[i].used_op_index]'
+                     '.init(&ctx, (const char*)tflNodes[i].builtin_data, 0);\n',
+                     'node init', '(int32_t)i', 'the init of the nodes')
+    body = wrap_line(body, '      TfLiteStatus status = registrations[nodeData[i].used_op_index]'
+                     '.prepare(&ctx, &tflNodes[i]);\n',
+                     'node prepare', '(int32_t)i', 'the prepare of the nodes')
+    return body
+
+
+def mark_invoke(body):
+    """Cycles of the invoke of each node."""
+    line = ('    TfLiteStatus status = registrations[nodeData[i].used_op_index]'
+            '.invoke(&ctx, &tflNodes[i]);\n')
+    if body.count(line) != 1:
+        sys.exit('error: cannot find the invoke of the nodes')
+    return body.replace(line, '    ML_LAYER_PROFILE_BEGIN();\n%s    ML_LAYER_PROFILE_END(i);\n' % line)
+
+
+def convert(path):
+    with open(path, 'r', newline='') as src:
+        text = src.read()
+    nl = '\r\n' if '\r\n' in text else '\n'
+    text = text.replace(nl, '\n')
+
+    # Replace the hooks of a previous run
+    text = HOOK_LINE.sub('', text.replace(INCLUDE_BLOCK, ''))
+    text = replace_once(text, INCLUDE_AFTER, INCLUDE_AFTER + INCLUDE_BLOCK, 'the offline op user data include')
+
+    m = re.search(r'\nextern "C" TfLiteStatus (\w+)_init\(\) \{\n', text)
+    if m is None:
+        sys.exit('error: cannot find the init')
+    start, end = function_body(text, m.group(0))
+    text = text[:start] + mark_init(text[start:end]) + text[end:]
+
+    start, end = function_body(text, '\nextern "C" TfLiteStatus %s_invoke() {\n' % m.group(1))
+    text = text[:start] + mark_invoke(text[start:end]) + text[end:]
+
+    with open(path, 'w', newline='') as out:
+        out.write(text.replace('\n', nl))
+
+    print('%s: startup phases marked in %s_init(), nodes in %s_invoke()' % (path, m.group(1), m.group(1)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('models', nargs='+', help='KEY_tflm_less_model_NN_TYPE.cpp files, rewritten in place')
+    args = parser.parse_args()
+    for path in args.models:
+        convert(path)
+
+
+if __name__ == '__main__':
+    main()
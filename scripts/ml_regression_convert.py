@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_regression_convert.py
+# \version 1.0
+#
+# \brief
+# Converts regression data to the chunked, indexed v3 regression container
+# read by source/ml_regression.c, and inspects existing containers.
+#
+# The input can be the C arrays generated by the ML configurator
+# (KEY_tflm_x_data_TYPE.c and KEY_tflm_y_data_TYPE.c) or a CSV file such as
+# sample_data/mnist_test_data.csv.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import mmap
+import os
+import re
+import struct
+import sys
+
+# Must match ml_reg_v3_header_t and ml_reg_v3_chunk_t in source/ml_regression.h
+V3_MAGIC = 0x33524C4D
+V3_VERSION = 3
+HEADER_FMT = '<IHHIIiHHIIIII'
+CHUNK_FMT = '<IIIHH'
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+CHUNK_SIZE = struct.calcsize(CHUNK_FMT)
+LEGACY_HEADER_FMT = '<iiii'
+LEGACY_HEADER_SIZE = struct.calcsize(LEGACY_HEADER_FMT)
+
+CODEC_NONE = 0
+CODEC_RLE = 1
+RLE_FILL_FLAG = 0x80
+RLE_MAX_RUN = 128
+
+# NN_TYPE -> (data type id, struct format of one element)
+DATA_TYPES = {
+    'float':   (1, 'f'),
+    'int8x8':  (2, 'b'),
+    'int16x8': (3, 'h'),
+    'int16x16': (3, 'h'),
+}
+TYPE_NAMES = {1: 'float32', 2: 'int8', 3: 'int16'}
+
+
+def align4(value):
+    return (value + 3) & ~3
+
+
+def encode_none(sample, elem_fmt):
+    return struct.pack('<%d%s' % (len(sample), elem_fmt), *sample)
+
+
+def encode_rle(sample, elem_fmt):
+    """Encode the runs of the most frequent value (e.g. the image background).
+    Must match ml_regression_decode_rle() in source/ml_regression.c."""
+    counts = {}
+    for value in sample:
+        counts[value] = counts.get(value, 0) + 1
+    fill = max(counts, key=counts.get) if sample else 0
+    out = bytearray(struct.pack('<' + elem_fmt, fill))
+    i = 0
+    while i < len(sample):
+        run = 0
+        while i + run < len(sample) and sample[i + run] == fill and run < RLE_MAX_RUN:
+            run += 1
+        if run:
+            out.append(RLE_FILL_FLAG | (run - 1))
+            i += run
+            continue
+        # Literal run up to the next pair of fill values
+        end = i
+        while (end < len(sample) and end - i < RLE_MAX_RUN and
+               not (sample[end] == fill and end + 1 < len(sample) and sample[end + 1] == fill)):
+            end += 1
+        out.append(end - i - 1)
+        out += struct.pack('<%d%s' % (end - i, elem_fmt), *sample[i:end])
+        i = end
+    return bytes(out)
+
+
+CODECS = {
+    'none': (CODEC_NONE, encode_none),
+    'rle': (CODEC_RLE, encode_rle),
+}
+
+
+class Dataset:
+    def __init__(self, nn_type, samples, labels, recurrent_ts_size=-1):
+        self.nn_type = nn_type
+        self.samples = samples
+        self.labels = labels
+        self.recurrent_ts_size = recurrent_ts_size
+
+
+def load_c_array(path):
+    """Return the bytes of the first array initializer found in a C file."""
+    with open(path, 'r') as src:
+        text = src.read()
+    start = text.index('{', text.index('_data_bin'))
+    end = text.index('};', start)
+    return bytes(int(h, 16) for h in re.findall(r'0x([0-9a-fA-F]{2})', text[start:end]))
+
+
+def argmax(values):
+    best = 0
+    for i, value in enumerate(values):
+        if value > values[best]:
+            best = i
+    return best
+
+
+def load_from_c(x_path, y_path, nn_type):
+    _, elem_fmt = DATA_TYPES[nn_type]
+    elem_size = struct.calcsize(elem_fmt)
+    x_blob = load_c_array(x_path)
+    _, num_of_samples, input_size, recurrent_ts_size = struct.unpack_from(LEGACY_HEADER_FMT, x_blob)
+
+    samples = []
+    for i in range(num_of_samples):
+        offset = LEGACY_HEADER_SIZE + i * input_size * elem_size
+        samples.append(list(struct.unpack_from('<%d%s' % (input_size, elem_fmt), x_blob, offset)))
+
+    labels = None
+    if y_path:
+        y_blob = load_c_array(y_path)
+        output_size = len(y_blob) // (elem_size * num_of_samples)
+        labels = []
+        for i in range(num_of_samples):
+            ref = struct.unpack_from('<%d%s' % (output_size, elem_fmt), y_blob, i * output_size * elem_size)
+            labels.append(argmax(ref))
+
+    return Dataset(nn_type, samples, labels, recurrent_ts_size)
+
+
+def quantize(value, scale, zero_point, elem_fmt):
+    if elem_fmt == 'f':
+        return float(value)
+    limit = 127 if elem_fmt == 'b' else 32767
+    q = int(round(value / scale)) + zero_point
+    return max(-limit - 1, min(limit, q))
+
+
+def load_from_csv(csv_path, nn_type, label_col, feat_first, feat_count,
+                  scale, zero_point, max_samples):
+    _, elem_fmt = DATA_TYPES[nn_type]
+    samples = []
+    labels = [] if label_col >= 0 else None
+    with open(csv_path, 'r') as src:
+        for line in src:
+            fields = line.strip().split(',')
+            if len(fields) < feat_first + feat_count:
+                continue
+            try:
+                values = [float(v) for v in fields[feat_first:feat_first + feat_count]]
+            except ValueError:
+                # Skip the header row, if any
+                continue
+            samples.append([quantize(v, scale, zero_point, elem_fmt) for v in values])
+            if labels is not None:
+                labels.append(int(float(fields[label_col])))
+            if max_samples and len(samples) >= max_samples:
+                break
+    return Dataset(nn_type, samples, labels)
+
+
+def build_container(dataset, samples_per_chunk, codec_name):
+    data_type, elem_fmt = DATA_TYPES[dataset.nn_type]
+    elem_size = struct.calcsize(elem_fmt)
+    num_of_samples = len(dataset.samples)
+    input_size = len(dataset.samples[0]) if num_of_samples else 0
+    num_of_chunks = (num_of_samples + samples_per_chunk - 1) // samples_per_chunk
+    codec_id, encode = CODECS[codec_name]
+
+    chunk_table_offset = align4(HEADER_SIZE)
+    sample_index_offset = align4(chunk_table_offset + num_of_chunks * CHUNK_SIZE)
+    label_offset = align4(sample_index_offset + num_of_samples * 4) if dataset.labels else 0
+    data_offset = align4((label_offset + num_of_samples * 2) if label_offset else
+                         (sample_index_offset + num_of_samples * 4))
+
+    chunks = []
+    sample_index = []
+    data = bytearray()
+    for c in range(num_of_chunks):
+        first = c * samples_per_chunk
+        last = min(first + samples_per_chunk, num_of_samples)
+        chunk_start = data_offset + len(data)
+        encoded = [encode(s, elem_fmt) for s in dataset.samples[first:last]]
+        chunk_codec = codec_id
+        # Store the chunk raw if the codec does not pay off
+        raw_size = sum(align4(len(s) * elem_size) for s in dataset.samples[first:last])
+        if sum(align4(len(e)) for e in encoded) >= raw_size and codec_id != CODEC_NONE:
+            encoded = [encode_none(s, elem_fmt) for s in dataset.samples[first:last]]
+            chunk_codec = CODEC_NONE
+        for blob in encoded:
+            sample_index.append(data_offset + len(data))
+            data += blob
+            data += bytes(align4(len(data)) - len(data))
+        chunks.append((chunk_start, data_offset + len(data) - chunk_start, first, last - first, chunk_codec))
+
+    total_size = data_offset + len(data)
+    out = bytearray(total_size)
+    struct.pack_into(HEADER_FMT, out, 0, V3_MAGIC, V3_VERSION, data_type, num_of_samples,
+                     input_size, dataset.recurrent_ts_size, elem_size, samples_per_chunk,
+                     num_of_chunks, chunk_table_offset, sample_index_offset, label_offset,
+                     total_size)
+    for i, chunk in enumerate(chunks):
+        struct.pack_into(CHUNK_FMT, out, chunk_table_offset + i * CHUNK_SIZE, *chunk)
+    struct.pack_into('<%dI' % num_of_samples, out, sample_index_offset, *sample_index)
+    if label_offset:
+        struct.pack_into('<%dh' % num_of_samples, out, label_offset, *dataset.labels)
+    out[data_offset:] = data
+    return bytes(out)
+
+
+def write_c_files(blob, out_dir, name, nn_type):
+    base = '%s_tflm_x_data_%s' % (name, nn_type)
+    guard = base.upper() + '_H'
+    symbol = '%s_x_data_bin' % name
+    length = '%s_X_DATA_BIN_LEN' % name.upper()
+    banner = ('/***************************************************************************//**\n'
+              '* \\file %s\n'
+              '*\n'
+              '* \\brief\n'
+              '* Generated with scripts/ml_regression_convert.py, this file contains input\n'
+              '* data for the %s model in %s representation (v3 regression container).\n'
+              '******************************************************************************/\n')
+    os.makedirs(out_dir, exist_ok=True)
+    with open(os.path.join(out_dir, base + '.h'), 'w') as hdr:
+        hdr.write(banner % (base + '.h', name, nn_type))
+        hdr.write('\n\n#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n\n' % (guard, guard))
+        hdr.write('extern const uint8_t %s[];\n#define %s (%d)\n\n' % (symbol, length, len(blob)))
+        hdr.write('#endif // %s\n' % guard)
+    with open(os.path.join(out_dir, base + '.c'), 'w') as src:
+        src.write(banner % (base + '.c', name, nn_type))
+        src.write('\n\n#include "%s.h"\n\n\n' % base)
+        src.write('const uint8_t %s[%s] __attribute__((aligned(4))) = {\n' % (symbol, length))
+        for i in range(0, len(blob), 12):
+            src.write('  ' + ', '.join('0x%02x' % b for b in blob[i:i + 12]) + ',\n')
+        src.write('};\n')
+
+
+def write_outputs(args, blob):
+    if args.bin:
+        with open(args.bin, 'wb') as out:
+            out.write(blob)
+    if args.out_dir:
+        write_c_files(blob, args.out_dir, args.name, args.type)
+    print('Container size: %d bytes' % len(blob))
+
+
+def cmd_from_c(args):
+    dataset = load_from_c(args.x, args.y, args.type)
+    write_outputs(args, build_container(dataset, args.samples_per_chunk, args.codec))
+
+
+def cmd_from_csv(args):
+    dataset = load_from_csv(args.csv, args.type, args.label_col, args.feat_first,
+                            args.feat_count, args.scale, args.zero_point, args.max_samples)
+    write_outputs(args, build_container(dataset, args.samples_per_chunk, args.codec))
+
+
+def cmd_info(args):
+    # The container is accessed in place, the same way the device does over XIP
+    with open(args.bin, 'rb') as src:
+        view = mmap.mmap(src.fileno(), 0, access=mmap.ACCESS_READ)
+        (magic, version, data_type, num_of_samples, input_size, recurrent_ts_size,
+         elem_size, samples_per_chunk, num_of_chunks, chunk_table_offset,
+         sample_index_offset, label_offset, total_size) = struct.unpack_from(HEADER_FMT, view)
+        if magic != V3_MAGIC or version != V3_VERSION:
+            sys.exit('%s is not a v3 regression container' % args.bin)
+        print('Samples: %d x %d %s, %d chunk(s) of %d, labels: %s, size: %d bytes' %
+              (num_of_samples, input_size, TYPE_NAMES.get(data_type, '?'), num_of_chunks,
+               samples_per_chunk, 'yes' if label_offset else 'no', total_size))
+        for i in range(num_of_chunks):
+            offset, size, first, count, codec = struct.unpack_from(
+                CHUNK_FMT, view, chunk_table_offset + i * CHUNK_SIZE)
+            print('  chunk %d: samples %d-%d, codec %d, %d bytes at 0x%x' %
+                  (i, first, first + count - 1, codec, size, offset))
+        for idx in args.sample or []:
+            offset, = struct.unpack_from('<I', view, sample_index_offset + idx * 4)
+            label = struct.unpack_from('<h', view, label_offset + idx * 2)[0] if label_offset else None
+            print('  sample %d: offset 0x%x, label %s' % (idx, offset, label))
+        view.close()
+
+
+def add_output_args(parser):
+    parser.add_argument('--type', required=True, choices=sorted(DATA_TYPES), help='NN_TYPE of the data')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--samples-per-chunk', type=int, default=16)
+    parser.add_argument('--codec', default='rle', choices=sorted(CODECS))
+    parser.add_argument('--out-dir', help='folder for the generated .c/.h files')
+    parser.add_argument('--bin', help='raw container file, for host access')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    from_c = sub.add_parser('from-c', help='convert the C arrays generated by the ML configurator')
+    from_c.add_argument('--x', required=True, help='KEY_tflm_x_data_TYPE.c')
+    from_c.add_argument('--y', help='KEY_tflm_y_data_TYPE.c, used to derive the labels')
+    add_output_args(from_c)
+    from_c.set_defaults(func=cmd_from_c)
+
+    from_csv = sub.add_parser('from-csv', help='convert a CSV file')
+    from_csv.add_argument('--csv', required=True)
+    from_csv.add_argument('--label-col', type=int, default=0, help='-1 if there are no labels')
+    from_csv.add_argument('--feat-first', type=int, default=1)
+    from_csv.add_argument('--feat-count', type=int, default=784)
+    from_csv.add_argument('--scale', type=float, default=1.0, help='input tensor scale')
+    from_csv.add_argument('--zero-point', type=int, default=0, help='input tensor zero point')
+    from_csv.add_argument('--max-samples', type=int, default=0)
+    add_output_args(from_csv)
+    from_csv.set_defaults(func=cmd_from_csv)
+
+    info = sub.add_parser('info', help='print the layout of a container file')
+    info.add_argument('bin')
+    info.add_argument('--sample', type=int, action='append')
+    info.set_defaults(func=cmd_info)
+
+    args = parser.parse_args()
+    if getattr(args, 'samples_per_chunk', 1) <= 0 or getattr(args, 'samples_per_chunk', 1) > 0xFFFF:
+        parser.error('--samples-per-chunk must be between 1 and 65535')
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_snapshot_check.py
+# \version 1.0
+#
+# \brief
+# Checks that the tflm_less models generated by the ML configurator are a
+# snapshot of the tflm models of the same NN_TYPE, used when ML_TFLM_SNAPSHOT
+# is set.
+#
+# At each startup, the tflm engine parses the model flatbuffer, plans the
+# tensor arena and runs the prepare of each operator. The tflm_less model holds
+# the result of these steps, resolved offline from the same flatbuffer: the
+# tensor offsets in the arena, the precomputed op data with the scratch buffer
+# indices, and with ML_TFLM_LESS_INIT=static or compact, the tensor and node
+# tables (scripts/ml_static_init_gen.py). This script reads the flatbuffer
+# back from KEY_tflm_model_NN_TYPE.c and checks that the tflm_less model has
+# the same tensors and operators and the same constant data, so a snapshot
+# left behind by a model update is caught before it is built. With --static,
+# it also checks that the model holds the static tables.
+#
+# The Makefile runs it as a pre-build step of the tflm_less builds, including
+# the snapshot builds, for the NN_TYPE built.
+#
+# The op registrations of the tflm_less model are its op resolver, listed at
+# compile time in used_operators_e. The script also checks that they are the
+# operators of the flatbuffer, node by node, with none missing or unused, and
+# prints them.
+#
+# With --map and --boot-log, the script also compares a build of the tflm
+# interpreter with a build of its snapshot (ML_TFLM_SNAPSHOT=yes): the size of
+# each output section from the two linker map files, and the cycles of each
+# startup phase from the two UART logs of ML_BOOT_PROFILE=yes.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+NN_TYPES = ('int8x8', 'int16x8', 'float')
+
+# Types of the constant arrays of the tflm_less models
+FORMATS = {'int8_t': 'b', 'uint8_t': 'B', 'int16_t': 'h', 'int32_t': 'i', 'int64_t': 'q', 'float': 'f'}
+
+# Fields of the TFLite schema tables that are read
+MODEL_OPERATOR_CODES, MODEL_SUBGRAPHS, MODEL_BUFFERS = 1, 2, 4
+SUBGRAPH_TENSORS, SUBGRAPH_OPERATORS = 0, 3
+OPERATOR_OPCODE_INDEX = 0
+OPERATOR_CODE_DEPRECATED_BUILTIN, OPERATOR_CODE_BUILTIN = 0, 3
+BUFFER_DATA = 0
+
+# Builtin operators of the TFLite schema supported by the tflm_less kernels
+BUILTIN_OPERATORS = {0: 'ADD', 1: 'AVERAGE_POOL_2D', 3: 'CONV_2D', 4: 'DEPTHWISE_CONV_2D',
+                     9: 'FULLY_CONNECTED', 17: 'MAX_POOL_2D', 18: 'MUL', 25: 'SOFTMAX', 27: 'SVDF',
+                     41: 'SUB', 44: 'UNIDIRECTIONAL_SEQUENCE_LSTM'}
+
+# Output sections of the linker map that are not loaded on the device
+UNLOADED_SECTIONS = ('.debug', '.comment', '.ARM.attributes', '.stab', '.gnu.attributes')
+
+# Model startup printed by the boot profile of the snapshot builds
+SNAPSHOT_START = 'snapshot of the tflm model'
+
+
+class FlatBuffer:
+    """Reads the tables and vectors of a flatbuffer."""
+
+    def __init__(self, data):
+        self.data = data
+
+    def uoffset(self, pos):
+        return pos + struct.unpack_from('<I', self.data, pos)[0]
+
+    def field(self, table, index):
+        """Position of a field of a table, or None when it is not set."""
+        vtable = table - struct.unpack_from('<i', self.data, table)[0]
+        vtable_bytes = struct.unpack_from('<H', self.data, vtable)[0]
+        if 4 + 2 * index >= vtable_bytes:
+            return None
+        offset = struct.unpack_from('<H', self.data, vtable + 4 + 2 * index)[0]
+        return table + offset if offset else None
+
+    def vector(self, pos):
+        """Position of the first element and length of a vector field."""
+        if pos is None:
+            return 0, 0
+        vec = self.uoffset(pos)
+        return vec + 4, struct.unpack_from('<I', self.data, vec)[0]
+
+    def scalar(self, table, index, fmt):
+        """Value of a scalar field of a table, 0 when it is not set."""
+        pos = self.field(table, index)
+        return struct.unpack_from('<' + fmt, self.data, pos)[0] if pos is not None else 0
+
+    def tables(self, pos):
+        start, count = self.vector(pos)
+        return [self.uoffset(start + 4 * i) for i in range(count)]
+
+
+def parse_flatbuffer(path):
+    """Tensors, operators and buffers of the first subgraph of the model."""
+    with open(path, 'r') as src:
+        text = src.read()
+    m = re.search(r'model_bin\[\w+\][^=]*= \{(.*?)\};', text, re.S)
+    if m is None:
+        sys.exit('error: %s has no model flatbuffer' % path)
+    fb = FlatBuffer(bytes(int(byte, 16) for byte in re.findall(r'0x[0-9a-fA-F]{2}', m.group(1))))
+
+    model = fb.uoffset(0)
+    subgraph = fb.tables(fb.field(model, MODEL_SUBGRAPHS))[0]
+    num_tensors = fb.vector(fb.field(subgraph, SUBGRAPH_TENSORS))[1]
+    # Codes above 127 are only in the builtin_code field
+    codes = [max(fb.scalar(code, OPERATOR_CODE_DEPRECATED_BUILTIN, 'b'), fb.scalar(code, OPERATOR_CODE_BUILTIN, 'i'))
+             for code in fb.tables(fb.field(model, MODEL_OPERATOR_CODES))]
+    operators = [BUILTIN_OPERATORS.get(codes[fb.scalar(op, OPERATOR_OPCODE_INDEX, 'I')], 'builtin %d' %
+                                       codes[fb.scalar(op, OPERATOR_OPCODE_INDEX, 'I')])
+                 for op in fb.tables(fb.field(subgraph, SUBGRAPH_OPERATORS))]
+    buffers = []
+    for buffer in fb.tables(fb.field(model, MODEL_BUFFERS)):
+        start, count = fb.vector(fb.field(buffer, BUFFER_DATA))
+        if count:
+            buffers.append(fb.data[start:start + count])
+    m = re.search(r'#define \w+_ARENA_SIZE \((\d+)u\)', open(os.path.splitext(path)[0] + '.h').read())
+    return num_tensors, operators, buffers, int(m.group(1)) if m else 0
+
+
+def parse_snapshot(path):
+    """Tensors, operators of the nodes, registrations and constant arrays of the tflm_less model."""
+    with open(path, 'r') as src:
+        text = src.read()
+    num_tensors = int(re.search(r'TfLiteEvalTensor evalTensors\[(\d+)\];', text).group(1))
+    m = re.search(r'const NodeInfo_t nodeData\[kOpNodesCount\] = \{\n(.*?)\n\};', text, re.S)
+    nodes = re.findall(r'\bOP_(\w+), \},', m.group(1)) if m else []
+    m = re.search(r'enum used_operators_e \{\s*(.*?)\s*\};', text, re.S)
+    registered = [op[3:] for op in re.findall(r'OP_\w+', m.group(1)) if op != 'OP_LAST'] if m else []
+    arena = int(re.search(r'kTensorArenaSize = (\d+);', text).group(1))
+    arrays = {}
+    for m in re.finditer(r'ALIGN\(\d+\) (\w+) (tensor_data\d+)\[[^\]]*\] = \{(.*?)\};', text, re.S):
+        ctype, name, values = m.groups()
+        if ctype not in FORMATS:
+            sys.exit('error: %s has an unsupported type %s' % (name, ctype))
+        fmt = FORMATS[ctype]
+        values = [v.strip() for v in values.split(',') if v.strip()]
+        values = [float(v) if fmt == 'f' else int(v) for v in values]
+        arrays[name] = struct.pack('<%d%s' % (len(values), fmt), *values)
+    return num_tensors, nodes, registered, arrays, arena, 'ML_TFLM_LESS_STATIC_INIT' in text
+
+
+def check(models_dir, name, nn_type, need_static):
+    base = os.path.join(models_dir, name)
+    num_tensors, operators, buffers, arena = parse_flatbuffer('%s_tflm_model_%s.c' % (base, nn_type))
+    snap_tensors, nodes, registered, arrays, snap_arena, static = parse_snapshot(
+        '%s_tflm_less_model_%s.cpp' % (base, nn_type))
+
+    errors = []
+    if snap_tensors != num_tensors:
+        errors.append('%d tensors, the flatbuffer has %d' % (snap_tensors, num_tensors))
+    if nodes != operators:
+        errors.append('nodes %s, the flatbuffer has the operators %s' % (', '.join(nodes), ', '.join(operators)))
+    if sorted(registered) != sorted(set(operators)):
+        errors.append('registrations %s, the flatbuffer uses %s' %
+                      (', '.join(registered), ', '.join(sorted(set(operators)))))
+    for array, data in sorted(arrays.items()):
+        if data not in buffers:
+            errors.append('%s (%d bytes) is not a buffer of the flatbuffer' % (array, len(data)))
+    if need_static and not static:
+        errors.append('no static tables, run scripts/ml_static_init_gen.py')
+
+    print('%s: %d tensors, %d nodes, %d constant arrays (%d bytes), arena %d bytes (interpreter %d bytes), '
+          'registrations %s: %s' %
+          (nn_type, snap_tensors, len(nodes), len(arrays), sum(len(d) for d in arrays.values()),
+           snap_arena, arena, ', '.join(registered), 'stale' if errors else 'ok'))
+    for error in errors:
+        print('  error: %s' % error)
+    return not errors
+
+
+def parse_map(path):
+    """Size of each loaded output section of a GNU linker map file."""
+    with open(path, 'r', errors='replace') as src:
+        text = src.read()
+    start = text.find('Linker script and memory map')
+    if start < 0:
+        sys.exit('error: %s is not a GNU linker map file' % path)
+    sections = {}
+    # Output sections start the line, a long name puts the address and the
+    # size on the next line. Input sections are indented.
+    for m in re.finditer(r'^(\.[\w.]+)\s+0x[0-9a-fA-F]+\s+0x([0-9a-fA-F]+)', text[start:], re.M):
+        name, size = m.group(1), int(m.group(2), 16)
+        if size and not name.startswith(UNLOADED_SECTIONS):
+            sections[name] = sections.get(name, 0) + size
+    return sections
+
+
+def parse_boot_log(path):
+    """Cycles of each phase and model startup, from the last startup breakdown of the log."""
+    with open(path, 'r', errors='replace') as log:
+        text = log.read()
+    start = text.rfind('Startup breakdown')
+    m = re.compile(r'Boot to ready: cycles=(\d+), us=\d+, model startup: ([^\r\n]*)').search(text, start)
+    if start < 0 or m is None:
+        sys.exit('error: %s has no startup breakdown, build with ML_BOOT_PROFILE=yes' % path)
+    phases = []
+    for name, index, depth, cycles in re.findall(r'^([^,\r\n]+),(-?\d+),(\d+),\d+,(\d*),\d*\r?$',
+                                                  text[start:m.start()], re.M):
+        if name != 'total':
+            label = '  ' * int(depth) + name + (' %s' % index if int(index) >= 0 else '')
+            phases.append((label, int(cycles) if cycles else None))
+    return phases, int(m.group(1)), m.group(2)
+
+
+def print_rows(title, rows):
+    """Rows of a value of the tflm build and of the snapshot build, None when it is not there."""
+    print('%s,tflm,snapshot,delta' % title)
+    for name, tflm, snapshot in rows:
+        delta = '%+d' % (snapshot - tflm) if tflm is not None and snapshot is not None else ''
+        print('%s,%s,%s,%s' % (name, '' if tflm is None else tflm, '' if snapshot is None else snapshot, delta))
+
+
+def compare_maps(tflm_path, snapshot_path):
+    tflm, snapshot = parse_map(tflm_path), parse_map(snapshot_path)
+    names = list(tflm) + [name for name in snapshot if name not in tflm]
+    print('\nCode size of the tflm build and of the snapshot build, bytes per output section:')
+    print_rows('section', [(name, tflm.get(name), snapshot.get(name)) for name in names] +
+               [('total', sum(tflm.values()), sum(snapshot.values()))])
+
+
+def compare_boot_logs(tflm_path, snapshot_path):
+    tflm, tflm_total, tflm_start = parse_boot_log(tflm_path)
+    snapshot, snapshot_total, snapshot_start = parse_boot_log(snapshot_path)
+    if SNAPSHOT_START in tflm_start or SNAPSHOT_START not in snapshot_start:
+        sys.exit('error: give the log of the tflm build, then the log of the ML_TFLM_SNAPSHOT=yes build '
+                 '(model startup: %s, %s)' % (tflm_start, snapshot_start))
+    # The phases of the model init differ, the others are matched by name. A
+    # phase of one build only is listed after the phase before it in that build.
+    tflm_cycles, snapshot_cycles = dict(tflm), dict(snapshot)
+    names, next_snapshot = [], 0
+    for name, _ in tflm:
+        if name in snapshot_cycles:
+            pos = [phase for phase, _ in snapshot].index(name)
+            names += [phase for phase, _ in snapshot[next_snapshot:pos] if phase not in tflm_cycles]
+            next_snapshot = max(next_snapshot, pos + 1)
+        names.append(name)
+    names += [phase for phase, _ in snapshot[next_snapshot:] if phase not in tflm_cycles]
+    rows = [(name, tflm_cycles.get(name), snapshot_cycles.get(name)) for name in names]
+    print('\nStartup of the tflm build (%s) and of the snapshot build, cycles per phase:' % tflm_start)
+    print_rows('phase', rows + [('boot to ready', tflm_total, snapshot_total)])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--models-dir', required=True, help='folder of KEY_tflm_model_NN_TYPE.c and '
+                        'KEY_tflm_less_model_NN_TYPE.cpp')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--types', default=','.join(NN_TYPES),
+                        help='comma-separated NN_TYPEs to check (default: %(default)s)')
+    parser.add_argument('--static', action='store_true',
+                        help='also require the static tables (ML_TFLM_LESS_INIT=static or compact)')
+    parser.add_argument('--map', nargs=2, metavar=('TFLM_MAP', 'SNAPSHOT_MAP'),
+                        help='linker map files of the tflm build and of the ML_TFLM_SNAPSHOT=yes build, '
+                        'to compare their code size')
+    parser.add_argument('--boot-log', nargs=2, metavar=('TFLM_LOG', 'SNAPSHOT_LOG'),
+                        help='UART logs of the same builds with ML_BOOT_PROFILE=yes, to compare their startup')
+    args = parser.parse_args()
+
+    ok = True
+    for nn_type in args.types.split(','):
+        if nn_type not in NN_TYPES:
+            sys.exit('error: unsupported NN_TYPE %s' % nn_type)
+        ok = check(args.models_dir, args.name, nn_type, args.static) and ok
+    if not ok:
+        sys.exit('error: generate the tflm_less models again with the ML configurator')
+    if args.map:
+        compare_maps(*args.map)
+    if args.boot_log:
+        compare_boot_logs(*args.boot_log)
+
+
+if __name__ == '__main__':
+    main()
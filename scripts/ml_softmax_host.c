@@ -0,0 +1,404 @@
+/******************************************************************************
+* File Name:   ml_softmax_host.c
+*
+* Description: This file contains a host driver of the int16 LUT softmax,
+*              which checks the outputs of source/ml_softmax_s16.c bit for bit
+*              against the TFLM reference softmax, with the tables and the
+*              input multiplier generated by scripts/ml_softmax_lut_gen.py.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ml_softmax_s16.h"
+#include "TEST_MODEL_softmax_lut_int16x8.h"
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Longest row checked */
+#define MAX_ROW_SIZE        (64u)
+/* Rows per call when checking several rows at once */
+#define MAX_NUM_OF_ROWS     (4u)
+/* Random rows checked for each row size and input scaling */
+#define RANDOM_ROW_COUNT    (5000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static int failures = 0;
+static uint32_t checked_values = 0;
+static uint32_t random_state = 12345u;
+
+/*******************************************************************************
+* Function Name: check
+********************************************************************************
+* Summary:
+*   Report a failed condition.
+*
+* Parameters:
+*   cond: condition to check
+*   what: description of the condition
+*
+* Return:
+*   void
+*******************************************************************************/
+static void check(int cond, const char *what)
+{
+    if (!cond)
+    {
+        printf("FAIL: %s\r\n", what);
+        failures++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: next_random
+********************************************************************************
+* Summary:
+*   Return the next value of a fixed sequence, so every run checks the same
+*   rows.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   uint32_t: pseudo-random value.
+*******************************************************************************/
+static uint32_t next_random(void)
+{
+    random_state = (random_state * 1103515245u) + 12345u;
+    return random_state >> 8;
+}
+
+/*******************************************************************************
+* Function Name: multiply_by_quantized_multiplier
+********************************************************************************
+* Summary:
+*   Scale a value as TFLM MultiplyByQuantizedMultiplier(): saturating rounding
+*   doubling high multiply, then rounding divide by a power of two.
+*
+* Parameters:
+*   x: value to scale
+*   multiplier: Q31 multiplier
+*   shift: power of two exponent
+*
+* Return:
+*   int32_t: scaled value.
+*******************************************************************************/
+static int32_t multiply_by_quantized_multiplier(int32_t x, int32_t multiplier, int32_t shift)
+{
+    int32_t left_shift = (shift > 0) ? shift : 0;
+    int32_t right_shift = (shift > 0) ? 0 : -shift;
+    int32_t a = x * (1 << left_shift);
+    int64_t ab_64 = (int64_t) a * (int64_t) multiplier;
+    int32_t nudge = (ab_64 >= 0) ? (1 << 30) : (1 - (1 << 30));
+    int32_t high = ((a == INT32_MIN) && (multiplier == INT32_MIN)) ? INT32_MAX :
+                   (int32_t) ((ab_64 + nudge) / (1LL << 31));
+    int32_t mask = (1 << right_shift) - 1;
+    int32_t remainder = high & mask;
+    int32_t threshold = (mask >> 1) + ((high < 0) ? 1 : 0);
+
+    return (high >> right_shift) + ((remainder > threshold) ? 1 : 0);
+}
+
+/*******************************************************************************
+* Function Name: generic_int16_table_lookup
+********************************************************************************
+* Summary:
+*   Read a 513 entry table as TFLM generic_int16_table_lookup().
+*
+* Parameters:
+*   value: position in Q0.15
+*   lut: lookup table
+*
+* Return:
+*   int16_t: interpolated value.
+*******************************************************************************/
+static int16_t generic_int16_table_lookup(int16_t value, const int16_t *lut)
+{
+    uint16_t index = (uint16_t) (256 + (value >> 7));
+    int16_t offset = (int16_t) (value & 0x7f);
+    int16_t base = lut[index];
+    int16_t slope = (int16_t) (lut[index + 1] - lut[index]);
+    int32_t delta = (((int32_t) slope * offset) + 64) >> 7;
+
+    return (int16_t) (base + delta);
+}
+
+/*******************************************************************************
+* Function Name: reference_softmax_s16
+********************************************************************************
+* Summary:
+*   Int16 softmax of one row, as the TFLM reference SoftmaxInt16().
+*
+* Parameters:
+*   softmax: softmax parameters and lookup tables
+*   input: row_size scores
+*   output: row_size probabilities
+*
+* Return:
+*   void
+*******************************************************************************/
+static void reference_softmax_s16(const ml_softmax_s16_t *softmax, const int16_t *input, int16_t *output)
+{
+    int16_t max_in_row = INT16_MIN;
+    int32_t sum_of_exps = 0;
+    int32_t headroom_plus_one;
+    int32_t shifted_sum;
+    int32_t symmetric_shifted_sum;
+    int16_t reciprocal_scale_q015;
+    int32_t right_shift;
+
+    for (uint32_t j = 0; j < softmax->row_size; j++)
+    {
+        max_in_row = (input[j] > max_in_row) ? input[j] : max_in_row;
+    }
+
+    for (uint32_t j = 0; j < softmax->row_size; j++)
+    {
+        int32_t input_diff = input[j] - max_in_row;
+        int32_t scaled_diff = multiply_by_quantized_multiplier(input_diff, softmax->input_multiplier,
+                                                               softmax->input_left_shift);
+        int32_t symmetric_scaled_diff = scaled_diff + 32767;
+        int16_t sat_sym_scaled_diff = (int16_t) ((symmetric_scaled_diff < -32768) ? -32768 :
+                                                 ((symmetric_scaled_diff > 32767) ? 32767 :
+                                                  symmetric_scaled_diff));
+
+        output[j] = generic_int16_table_lookup(sat_sym_scaled_diff, softmax->exp_lut);
+        sum_of_exps += output[j];
+    }
+
+    headroom_plus_one = __builtin_clz((uint32_t) sum_of_exps);
+    shifted_sum = (int32_t) ((((int64_t) sum_of_exps << (headroom_plus_one - 1)) + (1 << 13)) >> 14);
+    symmetric_shifted_sum = shifted_sum - 32768 - 65536;
+    symmetric_shifted_sum = (symmetric_shifted_sum < -32768) ? -32768 :
+                            ((symmetric_shifted_sum > 32767) ? 32767 : symmetric_shifted_sum);
+    reciprocal_scale_q015 = generic_int16_table_lookup((int16_t) symmetric_shifted_sum,
+                                                       softmax->one_over_one_plus_x_lut);
+
+    right_shift = 31 - headroom_plus_one;
+    for (uint32_t j = 0; j < softmax->row_size; j++)
+    {
+        int32_t result = (int32_t) ((((int64_t) output[j] * reciprocal_scale_q015) +
+                                     (1LL << (right_shift - 1))) >> right_shift);
+
+        output[j] = (int16_t) ((result > 32767) ? 32767 : ((result < 0) ? 0 : result));
+    }
+}
+
+/*******************************************************************************
+* Function Name: check_rows
+********************************************************************************
+* Summary:
+*   Run the LUT softmax on rows of scores in one call, and compare each row
+*   with the reference bit for bit.
+*
+* Parameters:
+*   softmax: softmax parameters, with the row size and the number of rows
+*   input: num_of_rows x row_size scores
+*   what: description of the rows
+*
+* Return:
+*   void
+*******************************************************************************/
+static void check_rows(const ml_softmax_s16_t *softmax, const int16_t *input, const char *what)
+{
+    int16_t output[MAX_NUM_OF_ROWS * MAX_ROW_SIZE];
+    int16_t expected[MAX_ROW_SIZE];
+    ml_softmax_s16_t row = *softmax;
+
+    ml_softmax_s16(softmax, input, output);
+
+    row.num_of_rows = 1u;
+    for (uint32_t r = 0; r < softmax->num_of_rows; r++)
+    {
+        reference_softmax_s16(&row, &input[r * softmax->row_size], expected);
+        if (0 != memcmp(expected, &output[r * softmax->row_size], softmax->row_size * sizeof(int16_t)))
+        {
+            check(0, what);
+            return;
+        }
+        checked_values += softmax->row_size;
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_equal_rows
+********************************************************************************
+* Summary:
+*   Rows of equal scores, at the ends and in the middle of the int16 range,
+*   give the same probability to each score.
+*
+* Parameters:
+*   softmax: softmax parameters
+*
+* Return:
+*   void
+*******************************************************************************/
+static void test_equal_rows(const ml_softmax_s16_t *softmax)
+{
+    static const int16_t values[] = {INT16_MIN, -1000, 0, 1, 1000, INT16_MAX};
+    int16_t input[MAX_ROW_SIZE];
+
+    for (uint32_t v = 0; v < (sizeof(values) / sizeof(values[0])); v++)
+    {
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            input[i] = values[v];
+        }
+        check_rows(softmax, input, "all-equal row");
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_saturation
+********************************************************************************
+* Summary:
+*   Rows whose differences with the largest score leave the exp table, so the
+*   table position saturates at its lower end, and rows where one score takes
+*   all the probability.
+*
+* Parameters:
+*   softmax: softmax parameters
+*
+* Return:
+*   void
+*******************************************************************************/
+static void test_saturation(const ml_softmax_s16_t *softmax)
+{
+    int16_t input[MAX_ROW_SIZE];
+
+    for (uint32_t hot = 0; hot < softmax->row_size; hot++)
+    {
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            input[i] = (i == hot) ? INT16_MAX : INT16_MIN;
+        }
+        check_rows(softmax, input, "one score at the top of the range, the others at the bottom");
+
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            input[i] = (int16_t) ((i == hot) ? 0 : ((i & 1u) ? INT16_MIN : -20000));
+        }
+        check_rows(softmax, input, "one score far above the others");
+
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            input[i] = (int16_t) ((i == hot) ? INT16_MIN : INT16_MAX);
+        }
+        check_rows(softmax, input, "one score at the bottom of the range, the others at the top");
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_random_rows
+********************************************************************************
+* Summary:
+*   Random rows over the whole int16 range and over narrow ranges, where the
+*   exp table is read between its entries, checked several rows per call.
+*
+* Parameters:
+*   softmax: softmax parameters
+*
+* Return:
+*   void
+*******************************************************************************/
+static void test_random_rows(const ml_softmax_s16_t *softmax)
+{
+    static const uint32_t spans[] = {65536u, 4096u, 256u, 16u};
+    int16_t input[MAX_NUM_OF_ROWS * MAX_ROW_SIZE];
+    ml_softmax_s16_t rows = *softmax;
+
+    rows.num_of_rows = MAX_NUM_OF_ROWS;
+    for (uint32_t s = 0; s < (sizeof(spans) / sizeof(spans[0])); s++)
+    {
+        for (uint32_t n = 0; n < (RANDOM_ROW_COUNT / MAX_NUM_OF_ROWS); n++)
+        {
+            int32_t low = (int32_t) (next_random() % (65537u - spans[s])) - 32768;
+
+            for (uint32_t i = 0; i < (rows.num_of_rows * rows.row_size); i++)
+            {
+                input[i] = (int16_t) (low + (int32_t) (next_random() % spans[s]));
+            }
+            check_rows(&rows, input, "random rows");
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*   Run the host checks of the LUT softmax with the parameters of the model,
+*   over several row sizes, and with larger input scalings that saturate the
+*   exp table sooner.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   int: 0 if all checks passed.
+*******************************************************************************/
+int main(void)
+{
+    static const uint32_t row_sizes[] = {1u, 2u, 10u, 33u, MAX_ROW_SIZE};
+    static const int32_t extra_shifts[] = {0, 3, 8};
+
+    for (uint32_t k = 0; k < (sizeof(extra_shifts) / sizeof(extra_shifts[0])); k++)
+    {
+        for (uint32_t r = 0; r < (sizeof(row_sizes) / sizeof(row_sizes[0])); r++)
+        {
+            ml_softmax_s16_t softmax = TEST_MODEL_softmax;
+
+            softmax.input_left_shift += extra_shifts[k];
+            softmax.num_of_rows = 1u;
+            softmax.row_size = row_sizes[r];
+
+            test_equal_rows(&softmax);
+            test_saturation(&softmax);
+            test_random_rows(&softmax);
+        }
+    }
+
+    printf("%lu outputs checked\r\n", (unsigned long) checked_values);
+    printf("%s\r\n", (failures == 0) ? "PASS" : "FAIL");
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_softmax_lut_gen.py
+# \version 1.0
+#
+# \brief
+# Generates the constant exp and reciprocal lookup tables, and the input
+# multiplier and shift, read by source/ml_softmax_s16.c to run the softmax of
+# a tflm_less int16x8 model generated by the ML configurator.
+#
+# The tables are computed as TFLM computes them when preparing the softmax:
+# 512 linear segments of exp(x) on [-10, 0] and of 1 / (1 + x) on [0, 1],
+# each entry biased to halve the interpolation error at the middle of its
+# segment. The float32 arithmetic of TFLM is reproduced, so the tables are
+# bit-exact; if the model holds its own tables, they are checked against the
+# generated ones.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import math
+import os
+import re
+import struct
+import sys
+
+from ml_sparse_gen import c_array, quantize_multiplier, round_half_away
+
+# Must match ML_SOFTMAX_S16_LUT_SIZE in source/ml_softmax_s16.h
+LUT_SEGMENTS = 512
+INT16_MIN = -32768
+INT16_MAX = 32767
+# Range of the scores read by the exp table
+EXP_INPUT_RANGE = 10.0
+
+
+def f32(value):
+    """Round to float32, as every operation of the TFLM table generation."""
+    return struct.unpack('f', struct.pack('f', value))[0]
+
+
+def populate_lut(input_scale, input_zero, output_scale, output_zero, func):
+    """Lookup table of func over the int16 range, as TFLM LUTPopulateInt16()."""
+    input_min = f32(input_scale * (INT16_MIN - input_zero))
+    input_max = f32(input_scale * (INT16_MAX - input_zero))
+    output_min = f32(output_scale * (INT16_MIN - output_zero))
+    output_max = f32(output_scale * (INT16_MAX - output_zero))
+    step = f32((input_max - input_min) / LUT_SEGMENTS)
+    half_step = f32(step / 2)
+    scaling = f32((INT16_MAX - INT16_MIN + 1) / f32(output_max - output_min))
+
+    def clamp(value):
+        return int(min(max(value, INT16_MIN), INT16_MAX))
+
+    lut = []
+    for i in range(LUT_SEGMENTS):
+        x = f32(input_min + f32(i * step))
+        value = func(x)
+        midpoint = func(f32(x + half_step))
+        value_next = func(f32(input_min + f32((i + 1) * step)))
+        sample = round_half_away(f32(value * scaling))
+        midpoint_interp = round_half_away(f32(f32(f32(value_next * scaling) + sample) / 2))
+        midpoint_err = midpoint_interp - round_half_away(f32(midpoint * scaling))
+        lut.append(clamp(sample - round_half_away(midpoint_err / 2)))
+    lut.append(clamp(round_half_away(f32(func(input_max) * scaling))))
+    return lut
+
+
+def exp_lut():
+    return populate_lut(f32(EXP_INPUT_RANGE / 65535.0), INT16_MAX, f32(2.0 / 65535.0), 0,
+                        lambda x: f32(math.exp(x)))
+
+
+def one_over_one_plus_x_lut():
+    return populate_lut(f32(1.0 / 65535.0), INT16_MIN, f32(2.0 / 65535.0), 0,
+                        lambda x: f32(1.0 / f32(1.0 + x)))
+
+
+def parse_softmax(path):
+    """Return the input scale, beta and input shape of the last node of a
+    tflm_less int16x8 model, which must be a softmax, and the precomputed
+    parameters of the model (lookup tables, input multiplier and shift) if it
+    holds them."""
+    with open(path, 'r') as src:
+        text = src.read()
+
+    ops = re.findall(r'&opdata\d+\)\), (OP_\w+)', text)
+    if not ops or ops[-1] != 'OP_SOFTMAX':
+        sys.exit('error: the last node of the model is not a softmax')
+    node = len(ops) - 1
+    inp = int(re.search(r'inputs%d = \{ \d+, \{ (\d+),' % node, text).group(1))
+    beta = float(re.search(r'TfLiteSoftmaxParams opdata%d = \{ ([^ }]+)' % node, text).group(1))
+    scale = float(re.search(r'quant%d_scale = \{ 1, \{ ([^,]+),' % inp, text).group(1))
+    dims = [int(v) for v in re.search(r'tensor_dimension%d = \{ \d+, \{ ([^}]*)\} \}' % inp,
+                                      text).group(1).replace(',', ' ').split()]
+    if not re.search(r'\{ kTfLiteInt16, [^,]+, \(TfLiteIntArray\*\)&tensor_dimension%d,' % inp, text):
+        sys.exit('error: the softmax input is not int16')
+
+    precomputed = {}
+    for lut in ('exp_lut', 'one_over_one_plus_x_lut'):
+        m = re.search(r'int16_t \w+_%s\[\] = \{([^}]*)\}' % lut, text)
+        if m:
+            precomputed[lut] = [int(v) for v in m.group(1).replace(',', ' ').split()]
+    m = re.search(r'namespace softmax \{.*?\{\{[^,]+, (-?\d+), (-?\d+),', text, re.S)
+    if m:
+        precomputed['input multiplier'] = (int(m.group(1)), int(m.group(2)))
+    return scale, beta, dims, precomputed
+
+
+def write_c_files(out_dir, name, softmax, luts):
+    base = '%s_softmax_lut_int16x8' % name
+    guard = base.upper() + '_H'
+    banner = ('/***************************************************************************//**\n'
+              '* \\file %s\n'
+              '*\n'
+              '* \\brief\n'
+              '* Generated with scripts/ml_softmax_lut_gen.py, this file contains the exp\n'
+              '* and reciprocal lookup tables and the parameters of the softmax of the %s\n'
+              '* model (int16x8).\n'
+              '******************************************************************************/\n')
+    os.makedirs(out_dir, exist_ok=True)
+    with open(os.path.join(out_dir, base + '.h'), 'w') as hdr:
+        hdr.write(banner % (base + '.h', name))
+        hdr.write('\n\n#ifndef %s\n#define %s\n\n#include "ml_softmax_s16.h"\n\n\n' % (guard, guard))
+        hdr.write('extern const ml_softmax_s16_t %s_softmax;\n' % name)
+        hdr.write('\n#endif // %s\n' % guard)
+
+    src = banner % (base + '.c', name)
+    src += '\n\n#include "%s.h"\n\n\n' % base
+    for lut, values in luts.items():
+        src += c_array('int16_t', '%s_softmax_%s' % (name, lut), values)
+    src += ('const ml_softmax_s16_t %s_softmax = {%d, %d, %d, %d, %s_softmax_exp_lut, '
+            '%s_softmax_one_over_one_plus_x_lut};\n' % ((name,) + softmax + (name, name)))
+    with open(os.path.join(out_dir, base + '.c'), 'w') as out:
+        out.write(src)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--model', required=True, help='KEY_tflm_less_model_int16x8.cpp')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--out-dir', required=True, help='folder for the generated .c/.h files')
+    args = parser.parse_args()
+
+    scale, beta, dims, precomputed = parse_softmax(args.model)
+    generated = {'exp_lut': exp_lut(), 'one_over_one_plus_x_lut': one_over_one_plus_x_lut()}
+
+    # The exp table covers [-10, 0], so the scores are scaled by
+    # scale * beta / (10 / 65535) before reading it
+    multiplier, shift = quantize_multiplier(scale * beta / (EXP_INPUT_RANGE / 65535.0))
+    generated['input multiplier'] = (multiplier, shift)
+    for key, values in precomputed.items():
+        if values != generated[key]:
+            sys.exit('error: the %s of the model differs from the generated one' % key)
+
+    row_size = dims[-1]
+    num_of_rows = math.prod(dims) // row_size
+    print('softmax: %d rows of %d, input multiplier=%d, shift=%d, checked against the model: %s' % (
+        num_of_rows, row_size, multiplier, shift, ', '.join(precomputed) or 'none'))
+    luts = {key: generated[key] for key in ('exp_lut', 'one_over_one_plus_x_lut')}
+    write_c_files(args.out_dir, args.name, (multiplier, shift, num_of_rows, row_size), luts)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,389 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_sparse_gen.py
+# \version 1.0
+#
+# \brief
+# Generates the dense and block-sparse (block-CSR) weight tables read by
+# source/ml_sparse_fc.c from the fully connected layers of a tflm_less int8x8
+# model generated by the ML configurator.
+#
+# Blocks are ML_FC_BLOCK_SIZE consecutive weights of a row, so a block fills one
+# SIMD word. All-zero blocks are dropped from the sparse tables. If the model
+# was not pruned at block granularity, --prune removes the blocks with the
+# smallest magnitude, to estimate the gain before retraining a pruned model.
+# With --x, the weights of the first layer are scaled by the mean magnitude of
+# their input, so the blocks that only see the image background go first.
+#
+# The per-channel and int4 tables use one weight scale per output, with the
+# multiplier and shift of each output precomputed. With --float-model, they
+# are quantized from the float weights instead of the int8 weights.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import math
+import os
+import re
+import sys
+
+# Must match ML_FC_BLOCK_SIZE and ML_FC_S4_BLOCK_SIZE in source/ml_sparse_fc.h
+BLOCK_SIZE = 4
+S4_BLOCK_SIZE = 8
+# Order of the weights of a block in memory, see source/ml_sparse_fc.h
+BLOCK_ORDER = (0, 2, 1, 3)
+# Limits of the uint16_t row_ptr and uint8_t col_block entries
+MAX_BLOCKS = 0xFFFF
+MAX_COL_BLOCKS = 0x100
+
+
+class Layer:
+    def __init__(self, weights, bias, input_offset, output_offset, params, scales):
+        self.weights = weights
+        self.pruned = [list(row) for row in weights]
+        self.bias = bias
+        self.rows = len(weights)
+        self.cols = len(weights[0])
+        self.input_offset = input_offset
+        self.output_offset = output_offset
+        self.multiplier, self.shift, self.act_min, self.act_max = params
+        self.input_scale, weight_scales, self.output_scale = scales
+        # Per-output scales of a per-channel model
+        self.multipliers = None
+        if len(weight_scales) > 1:
+            self.multipliers = [quantize_multiplier(self.input_scale * scale / self.output_scale)
+                                for scale in weight_scales]
+        else:
+            weight_scales = weight_scales * self.rows
+        # Real weights and bias, replaced by the float model if available
+        self.real_weights = [[w * weight_scales[r] for w in row] for r, row in enumerate(weights)]
+        self.real_bias = [b * self.input_scale * weight_scales[r] for r, b in enumerate(bias)]
+
+
+def parse_graph(path):
+    """Return the tensors and the nodes of a tflm_less model."""
+    with open(path, 'r') as src:
+        text = src.read()
+
+    def int_lists(pattern):
+        return {int(m.group(1)): [int(v) for v in m.group(2).replace(',', ' ').split()]
+                for m in re.finditer(pattern, text)}
+
+    graph = {'text': text, 'data': {}}
+    for m in re.finditer(r'(int8_t|int32_t|float) tensor_data(\d+)\[[^\]]*\] = \{([^}]*)\}', text):
+        convert = float if m.group(1) == 'float' else int
+        graph['data'][int(m.group(2))] = [convert(v) for v in m.group(3).replace(',', ' ').split()]
+    graph['dims'] = int_lists(r'tensor_dimension(\d+) = \{ \d+, \{ ([^}]*)\} \}')
+    graph['zeros'] = int_lists(r'quant(\d+)_zero = \{ \d+, \{ ([^}]*)\} \}')
+    graph['scales'] = {int(m.group(1)): [float(v) for v in m.group(2).replace(',', ' ').split()]
+                       for m in re.finditer(r'quant(\d+)_scale = \{ \d+, \{ ([^}]*)\} \}', text)}
+    graph['inputs'] = int_lists(r'inputs(\d+) = \{ \d+, \{ ([^}]*)\} \}')
+    graph['outputs'] = int_lists(r'outputs(\d+) = \{ \d+, \{ ([^}]*)\} \}')
+
+    # Fully connected nodes, in execution order
+    graph['fc_nodes'] = []
+    ops = re.findall(r'&opdata\d+\)\), (OP_\w+)', text)
+    for node, op in enumerate(ops):
+        if op == 'OP_SOFTMAX' and node == len(ops) - 1:
+            break
+        if op != 'OP_FULLY_CONNECTED':
+            sys.exit('error: node %d is %s, only fully connected layers are supported' % (node, op))
+        graph['fc_nodes'].append(node)
+    return graph
+
+
+def parse_model(path):
+    """Return the fully connected layers of a tflm_less int8x8 model, in
+    execution order."""
+    graph = parse_graph(path)
+    data = graph['data']
+    zeros = graph['zeros']
+    scales = graph['scales']
+
+    # Quantized parameters of the layers: multiplier, shift, activation min/max
+    fc = graph['text'][graph['text'].index('namespace fully_connected'):]
+    fc = fc[:fc.index('} // namespace fully_connected')]
+    params = [tuple(int(v) for v in m.groups())
+              for m in re.finditer(r'\{\{(-?\d+), (-?\d+), (-?\d+), (-?\d+),', fc)]
+
+    layers = []
+    for node in graph['fc_nodes']:
+        inp, weight, bias = graph['inputs'][node]
+        out = graph['outputs'][node][0]
+        rows, cols = graph['dims'][weight]
+        flat = data[weight]
+        weights = [flat[r * cols:(r + 1) * cols] for r in range(rows)]
+        if any(zeros[weight]):
+            sys.exit('error: node %d has asymmetric weights' % node)
+        layers.append(Layer(weights, data[bias], -zeros[inp][0], zeros[out][0], params[len(layers)],
+                            (scales[inp][0], scales[weight], scales[out][0])))
+    return layers
+
+
+def parse_float_model(path, layers):
+    """Take the real weights and bias of the layers from the tflm_less float
+    model of the same network."""
+    graph = parse_graph(path)
+    if len(graph['fc_nodes']) != len(layers):
+        sys.exit('error: the float model does not have the same layers')
+    for node, layer in zip(graph['fc_nodes'], layers):
+        _, weight, bias = graph['inputs'][node]
+        if graph['dims'][weight] != [layer.rows, layer.cols]:
+            sys.exit('error: the float model does not have the same layers')
+        flat = graph['data'][weight]
+        layer.real_weights = [flat[r * layer.cols:(r + 1) * layer.cols] for r in range(layer.rows)]
+        layer.real_bias = graph['data'][bias]
+
+
+def input_magnitude(x_path, layer):
+    """Mean magnitude of each input of the first layer, offset applied, over
+    the regression data generated by the ML configurator."""
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    from ml_regression_convert import load_from_c
+    dataset = load_from_c(x_path, None, 'int8x8')
+    total = [0] * layer.cols
+    for sample in dataset.samples:
+        for i, value in enumerate(sample):
+            total[i] += abs(value + layer.input_offset)
+    return [t / len(dataset.samples) for t in total]
+
+
+def prune(layer, ratio, magnitude=None):
+    """Zero the blocks with the smallest L1 norm, ratio of the blocks, each
+    weight scaled by the magnitude of its input if known."""
+    if magnitude is None:
+        magnitude = [1] * layer.cols
+    norms = []
+    for r in range(layer.rows):
+        for c in range(0, layer.cols, BLOCK_SIZE):
+            norms.append((sum(abs(layer.pruned[r][c + i]) * magnitude[c + i] for i in range(BLOCK_SIZE)), r, c))
+    norms.sort()
+    for _, r, c in norms[:int(len(norms) * ratio)]:
+        for i in range(BLOCK_SIZE):
+            layer.pruned[r][c + i] = 0
+
+
+def round_half_away(value):
+    return int(math.floor(abs(value) + 0.5)) * (1 if value >= 0 else -1)
+
+
+def quantize_multiplier(real):
+    """Q31 multiplier and power of two exponent of a positive scale, as TFLM
+    QuantizeMultiplier()."""
+    mantissa, exponent = math.frexp(real)
+    multiplier = round_half_away(mantissa * (1 << 31))
+    if multiplier == 1 << 31:
+        multiplier //= 2
+        exponent += 1
+    return multiplier, exponent
+
+
+class Table:
+    """A layer as stored in flash."""
+    def __init__(self, layer, blocks, bias, bits=8, row_ptr=None, col_block=None, multipliers=None):
+        self.layer = layer
+        self.blocks = blocks
+        self.bias = bias
+        self.bits = bits
+        self.row_ptr = row_ptr
+        self.col_block = col_block
+        # (multiplier, shift) per output, None to use the ones of the layer
+        self.multipliers = multipliers
+
+
+def block_order(weights, cols):
+    blocks = []
+    for row in weights:
+        for c in range(0, cols, BLOCK_SIZE):
+            blocks += [row[c + i] for i in BLOCK_ORDER]
+    return blocks
+
+
+def to_blocks(layer, weights, sparse):
+    if not sparse:
+        return Table(layer, block_order(weights, layer.cols), layer.bias, multipliers=layer.multipliers)
+    row_ptr = [0]
+    col_block = []
+    blocks = []
+    for row in weights:
+        for c in range(0, layer.cols, BLOCK_SIZE):
+            block = row[c:c + BLOCK_SIZE]
+            if not any(block):
+                continue
+            col_block.append(c // BLOCK_SIZE)
+            blocks += [block[i] for i in BLOCK_ORDER]
+        row_ptr.append(len(col_block))
+    if len(col_block) > MAX_BLOCKS:
+        sys.exit('error: a layer has too many blocks for 16-bit indices')
+    return Table(layer, blocks, layer.bias, row_ptr=row_ptr, col_block=col_block,
+                 multipliers=layer.multipliers)
+
+
+def to_per_channel(layer, bits):
+    """Quantize the real weights of the layer to symmetric int8 or int4, with
+    one scale per output. The int4 kernel multiplies the nibbles in place,
+    scaled by 16, so that factor is folded into the bias and the multipliers."""
+    limit = (1 << (bits - 1)) - 1
+    factor = 16 if bits == 4 else 1
+    weights = []
+    bias = []
+    multipliers = []
+    for row, real_bias in zip(layer.real_weights, layer.real_bias):
+        step = (max(abs(w) for w in row) / limit) or 1.0
+        weights.append([max(-limit, min(limit, round_half_away(w / step))) for w in row])
+        bias.append(round_half_away(real_bias / (layer.input_scale * step)) * factor)
+        multipliers.append(quantize_multiplier(layer.input_scale * step / (layer.output_scale * factor)))
+    if bits == 8:
+        return Table(layer, block_order(weights, layer.cols), bias, multipliers=multipliers)
+
+    # Byte k of a block holds the k'-th weight in its low nibble and the
+    # (k'+4)-th in its high nibble, k' in BLOCK_ORDER
+    blocks = []
+    for row in weights:
+        for c in range(0, layer.cols, S4_BLOCK_SIZE):
+            for k in BLOCK_ORDER:
+                byte = (row[c + k] & 0xF) | ((row[c + k + BLOCK_SIZE] & 0xF) << 4)
+                blocks.append(byte - 256 if byte > 127 else byte)
+    return Table(layer, blocks, bias, bits=4, multipliers=multipliers)
+
+
+def c_array(ctype, name, values, per_line=16):
+    out = 'static const %s %s[%d] __attribute__((aligned(4))) = {\n' % (ctype, name, len(values))
+    for i in range(0, len(values), per_line):
+        out += '    ' + ', '.join(str(v) for v in values[i:i + per_line]) + ',\n'
+    return out + '};\n\n'
+
+
+def write_c_files(variants, out_dir, name, nn_type, ratio):
+    base = '%s_sparse_fc_%s' % (name, nn_type)
+    guard = base.upper() + '_H'
+    banner = ('/***************************************************************************//**\n'
+              '* \\file %s\n'
+              '*\n'
+              '* \\brief\n'
+              '* Generated with scripts/ml_sparse_gen.py, this file contains the fully\n'
+              '* connected layers of the %s model (%s) with the original weights in dense\n'
+              '* format, with the weights in block-CSR format (pruning %d%%), and with the\n'
+              '* weights quantized per channel to int8 and, for the first layers, to int4.\n'
+              '******************************************************************************/\n')
+    os.makedirs(out_dir, exist_ok=True)
+    with open(os.path.join(out_dir, base + '.h'), 'w') as hdr:
+        hdr.write(banner % (base + '.h', name, nn_type, round(ratio * 100)))
+        hdr.write('\n\n#ifndef %s\n#define %s\n\n#include "ml_sparse_fc.h"\n\n\n' % (guard, guard))
+        for variant in variants:
+            hdr.write('extern const ml_fc_s8_model_t %s_fc_%s;\n' % (name, variant))
+        hdr.write('\n#endif // %s\n' % guard)
+
+    src = banner % (base + '.c', name, nn_type, round(ratio * 100))
+    src += '\n\n#include "%s.h"\n\n#include <stddef.h>\n\n\n' % base
+    max_width = max(max(table.layer.rows, table.layer.cols) for table in variants['dense'])
+
+    # Arrays shared by several variants, such as the bias of the model, are
+    # written once
+    symbols = {}
+
+    def array(ctype, symbol, values):
+        nonlocal src
+        if id(values) not in symbols:
+            symbols[id(values)] = symbol
+            src += c_array(ctype, symbol, values)
+        return symbols[id(values)]
+
+    for variant, tables in variants.items():
+        entries = ''
+        weight_bytes = 0
+        for i, table in enumerate(tables):
+            layer = table.layer
+            prefix = '%s_fc_%s_%d' % (name, variant, i)
+            blocks = array('int8_t', prefix + '_blocks', table.blocks)
+            bias = array('int32_t', prefix + '_bias', table.bias)
+            weight_bytes += len(table.blocks) + len(table.bias) * 4
+            if table.row_ptr is not None:
+                indices = '%s, %s' % (array('uint16_t', prefix + '_row_ptr', table.row_ptr),
+                                      array('uint8_t', prefix + '_col_block', table.col_block))
+                weight_bytes += len(table.row_ptr) * 2 + len(table.col_block)
+                num_of_blocks = len(table.col_block)
+            else:
+                indices = 'NULL, NULL'
+                num_of_blocks = len(table.blocks) // 4
+            if table.multipliers is not None:
+                if id(table.multipliers) not in symbols:
+                    symbols[id(table.multipliers)] = prefix
+                    src += c_array('int32_t', prefix + '_multipliers', [m for m, _ in table.multipliers])
+                    src += c_array('int32_t', prefix + '_shifts', [e for _, e in table.multipliers])
+                scaling = '0, 0, %s_multipliers, %s_shifts' % ((symbols[id(table.multipliers)],) * 2)
+                weight_bytes += len(table.multipliers) * 8
+            else:
+                scaling = '%d, %d, NULL, NULL' % (layer.multiplier, layer.shift)
+            entries += '    {%d, %d, %d, %d, %s, %s, %s, %d, %d, %s, %d, %d},\n' % (
+                layer.rows, layer.cols, table.bits, num_of_blocks, indices, blocks, bias,
+                layer.input_offset, layer.output_offset, scaling, layer.act_min, layer.act_max)
+        src += 'static const ml_fc_s8_layer_t %s_fc_%s_layers[%d] = {\n%s};\n\n' % (
+            name, variant, len(tables), entries)
+        src += 'const ml_fc_s8_model_t %s_fc_%s = {%d, %s_fc_%s_layers, %d, %d};\n\n' % (
+            name, variant, len(tables), name, variant, max_width, weight_bytes)
+        print('%s: %d weight bytes' % (variant, weight_bytes))
+    with open(os.path.join(out_dir, base + '.c'), 'w') as out:
+        out.write(src)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--model', required=True, help='KEY_tflm_less_model_int8x8.cpp')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--prune', type=float, default=0.0,
+                        help='ratio of the blocks to remove from each pruned layer, 0 to keep the model as is')
+    parser.add_argument('--prune-layers', type=int, default=1,
+                        help='number of layers to prune, starting from the first one, which holds most weights')
+    parser.add_argument('--x', help='KEY_tflm_x_data_int8x8.c, to weight the first layer blocks by their input')
+    parser.add_argument('--int4-layers', type=int, default=1,
+                        help='number of layers quantized to int4 in the int4x8 variant, starting from the first one')
+    parser.add_argument('--float-model', help='KEY_tflm_less_model_float.cpp, to quantize per channel from the '
+                        'float weights instead of the int8 weights')
+    parser.add_argument('--out-dir', required=True, help='folder for the generated .c/.h files')
+    args = parser.parse_args()
+    if not 0.0 <= args.prune < 1.0:
+        parser.error('--prune must be between 0 and 1')
+
+    layers = parse_model(args.model)
+    if args.float_model:
+        parse_float_model(args.float_model, layers)
+    for i, layer in enumerate(layers):
+        block_size = S4_BLOCK_SIZE if i < args.int4_layers else BLOCK_SIZE
+        if layer.cols % block_size or layer.cols > MAX_COL_BLOCKS * BLOCK_SIZE:
+            sys.exit('error: layer %d has %d inputs, must be a multiple of %d up to %d' % (
+                i, layer.cols, block_size, MAX_COL_BLOCKS * BLOCK_SIZE))
+        if args.prune and i < args.prune_layers:
+            prune(layer, args.prune, input_magnitude(args.x, layer) if (args.x and i == 0) else None)
+        zero = sum(not any(row[c:c + BLOCK_SIZE]) for row in layer.pruned
+                   for c in range(0, layer.cols, BLOCK_SIZE))
+        print('layer %d: %dx%d, %d%% zero blocks' % (
+            i, layer.rows, layer.cols, 100 * zero * BLOCK_SIZE // (layer.rows * layer.cols)))
+    dense = [to_blocks(layer, layer.weights, False) for layer in layers]
+    variants = {
+        'dense': dense,
+        'sparse': [to_blocks(layer, layer.pruned, True) for layer in layers],
+        'perchannel': [to_per_channel(layer, 8) for layer in layers],
+    }
+    variants['int4x8'] = [to_per_channel(layer, 4) if i < args.int4_layers else variants['perchannel'][i]
+                          for i, layer in enumerate(layers)]
+    write_c_files(variants, args.out_dir, args.name, 'int8x8', args.prune)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,293 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_static_init_gen.py
+# \version 1.0
+#
+# \brief
+# Adds constant-initialized tensor and node tables to a tflm_less model
+# generated by the ML configurator, used when ML_TFLM_LESS_STATIC_INIT is
+# defined.
+#
+# The generated TEST_MODEL_init() copies each tensor and node from the
+# tensorData[] and nodeData[] tables into the RAM tables tflTensors,
+# evalTensors and tflNodes, then calls the init and prepare of each kernel.
+# With the op user data precomputed offline, the init of a kernel returns its
+# precomputed OpData and the prepare results (quantized multipliers, scratch
+# buffer indices, eval function) are already in it. This script resolves the
+# RAM tables at build time, with each node pointing to its precomputed OpData,
+# and makes TEST_MODEL_init() skip the copies, the init and the prepare. The
+# tables are then loaded with the rest of the initialized data at reset.
+#
+# With ML_TFLM_LESS_COMPACT_TENSORS also defined, the eval tensors and the
+# nodes, which the memory plan fixes, are constant tables in flash, and only
+# the input and output tensors are kept in RAM as TfLiteTensor. The full
+# TfLiteTensor table is only read by the prepare of the kernels, and
+# AllocateTempTfLiteTensor() returns nullptr. The script reports the RAM of the
+# tensor metadata in both forms.
+#
+# The model file is rewritten in place and keeps its line endings. Run it again
+# on the files generated again by the ML configurator.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import re
+import sys
+
+DEFINE = 'ML_TFLM_LESS_STATIC_INIT'
+COMPACT = 'ML_TFLM_LESS_COMPACT_TENSORS'
+
+# Sizes on the CM4 of the TF_LITE_STATIC_MEMORY structs, for the RAM report
+TENSOR_BYTES = 40
+EVAL_TENSOR_BYTES = 12
+NODE_BYTES = 28
+
+
+def split_fields(entry):
+    """Top-level comma-separated fields of one initializer."""
+    fields, depth, start = [], 0, 0
+    for i, ch in enumerate(entry):
+        if ch in '({<':
+            depth += 1
+        elif ch in ')}>':
+            depth -= 1
+        elif ch == ',' and depth == 0:
+            fields.append(entry[start:i].strip())
+            start = i + 1
+    fields.append(entry[start:].strip())
+    return [f for f in fields if f]
+
+
+def table_entries(text, header):
+    """Initializers of a constant table, one per line."""
+    m = re.search(re.escape(header) + r' = \{\n(.*?)\n\};', text, re.S)
+    if m is None:
+        sys.exit('error: no %s table' % header)
+    entries = []
+    for line in m.group(1).split('\n'):
+        line = line.strip().rstrip(',')
+        if line.startswith('{') and line.endswith('}'):
+            entries.append(split_fields(line[1:-1]))
+    return entries
+
+
+def first_element(text, name):
+    m = re.search(r'%s = \{ \d+, \{ ([^,]+),' % re.escape(name), text)
+    if m is None:
+        sys.exit('error: no %s array' % name)
+    return m.group(1).strip()
+
+
+def parse_model(text):
+    """Tensors and nodes of the model, as initializers of the RAM tables."""
+    num_tensors = int(re.search(r'TfLiteEvalTensor evalTensors\[(\d+)\];', text).group(1))
+    num_nodes = int(re.search(r'constexpr size_t kOpNodesCount = (\d+);', text).group(1))
+
+    # Float models do not store the type and quantization per tensor
+    loop_type = re.search(r'tflTensors\[i\]\.type = (kTfLite\w+);', text)
+
+    tensors = []
+    for fields in table_entries(text, 'const TensorInfo_t tensorData[]'):
+        if len(fields) == 3:
+            if loop_type is None:
+                sys.exit('error: tensorData has no type and init has no common type')
+            ttype, (data, dims, size) = loop_type.group(1), fields
+            quant_type, quant, params = 'kTfLiteNoQuantization', 'nullptr', '0.0f, 0'
+        else:
+            ttype, data, dims, size, quantization = fields
+            quant_type, quant = split_fields(quantization.strip('{}'))
+            if quant_type != 'kTfLiteAffineQuantization':
+                sys.exit('error: unsupported quantization %s' % quant_type)
+            name = re.search(r'&(quant\d+)\)', quant).group(1)
+            scale = first_element(text, name + '_scale')
+            if not re.search(r'[.eE]', scale):
+                scale += '.0'
+            params = '%sf, %s' % (scale, first_element(text, name + '_zero'))
+        alloc = 'kTfLiteArenaRw' if data.startswith('tensor_arena') else 'kTfLiteMmapRo'
+        tensors.append((ttype, data, dims, size, quant_type, quant, params, alloc))
+    if len(tensors) != num_tensors:
+        sys.exit('error: %d tensors in tensorData, %d expected' % (len(tensors), num_tensors))
+
+    nodes = table_entries(text, 'const NodeInfo_t nodeData[kOpNodesCount]')
+    m = re.search(r'void \*precomputed_op_user_data\[\] = \{\n(.*?)\n\};', text, re.S)
+    if m is None:
+        sys.exit('error: no precomputed op user data')
+    user_data = [line.strip().rstrip(',') for line in m.group(1).split('\n') if line.strip()]
+    # The init of each node takes the next precomputed OpData
+    if not (len(nodes) == len(user_data) == num_nodes):
+        sys.exit('error: %d nodes, %d precomputed op user data, %d expected' %
+                 (len(nodes), len(user_data), num_nodes))
+    return tensors, nodes, user_data
+
+
+def tensor_row(tensor):
+    ttype, data, dims, size, quant_type, quant, params, alloc = tensor
+    return ('  { .quantization = { %s, %s }, .params = { %s }, .data = { .data = %s }, '
+            '.dims = %s, .bytes = %s, .type = %s, .allocation_type = %s, .is_variable = false, },' %
+            (quant_type, quant, params, data, dims, size, ttype, alloc))
+
+
+def static_tables(tensors, nodes, user_data, io_indices):
+    """Definitions of the RAM tables, initialized, and of their compact form."""
+    out = ['#ifdef %s' % DEFINE,
+           '#if !TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA',
+           '#error "%s needs the op user data precomputed offline (TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA)"' % DEFINE,
+           '#endif',
+           '// Tensor and node tables resolved by scripts/ml_static_init_gen.py, with the',
+           '// precomputed OpData of each node in place of its init and prepare.',
+           'namespace {',
+           '',
+           '#ifdef %s' % COMPACT,
+           '// The eval tensors and the nodes are fixed by the memory plan and read by the',
+           '// kernels from flash. Only the input and output tensors are kept as',
+           '// TfLiteTensor, for TEST_MODEL_input() and TEST_MODEL_output().',
+           'TfLiteTensor ioTensors[%d] = {' % len(io_indices)]
+    out += [tensor_row(tensors[i]) for i in io_indices]
+    out += ['};',
+            '#else',
+            'TfLiteTensor tflTensorsWithMinus1[%d] = {' % (len(tensors) + 1),
+            '  { .quantization = { kTfLiteNoQuantization, nullptr }, .params = { 0.0f, 0 }, '
+            '.data = { .raw = nullptr }, .dims = (TfLiteIntArray*)&emptyIntArray, .bytes = 0, '
+            '.type = kTfLiteNoType, .allocation_type = kTfLiteMemNone, .is_variable = false, },']
+    out += [tensor_row(tensor) for tensor in tensors]
+    out += ['};',
+            '#endif  // %s' % COMPACT,
+            '',
+            '#ifdef %s' % COMPACT,
+            'const TfLiteEvalTensor evalTensorsConst[%d] = {' % len(tensors),
+            '#else',
+            'TfLiteEvalTensor evalTensors[%d] = {' % len(tensors),
+            '#endif  // %s' % COMPACT]
+    for ttype, data, dims, _, _, _, _, _ in tensors:
+        out.append('  { .data = { .data = %s }, .dims = %s, .type = %s, },' % (data, dims, ttype))
+    out += ['};', '',
+            '#ifdef %s' % COMPACT,
+            'const TfLiteNode tflNodesConst[kOpNodesCount] = {',
+            '#else',
+            'TfLiteNode tflNodes[kOpNodesCount] = {',
+            '#endif  // %s' % COMPACT]
+    for (inputs, outputs, intermediates, builtin_data, _), data in zip(nodes, user_data):
+        out.append('  { .inputs = (TfLiteIntArray *)%s, .outputs = (TfLiteIntArray *)%s, '
+                   '.intermediates = %s, .user_data = %s, .builtin_data = %s, '
+                   '.custom_initial_data = nullptr, .custom_initial_data_size = 0, },' %
+                   (inputs.replace('(const TfLiteIntArray *)', ''), outputs.replace('(const TfLiteIntArray *)', ''),
+                    intermediates, data, builtin_data))
+    out += ['};', '',
+            '} // namespace',
+            '#endif  // %s' % DEFINE]
+    return '\n'.join(out) + '\n'
+
+
+def replace_once(text, old, new, what):
+    if text.count(old) != 1:
+        sys.exit('error: cannot find %s' % what)
+    return text.replace(old, new)
+
+
+def io_tensors(text, function, indices):
+    """Tensor indices returned by TEST_MODEL_input() or TEST_MODEL_output()."""
+    m = re.search(r'(TfLiteTensor\* \w+_%s\(int index\) \{ *\n)(    static const int %s\[\] = \{\n(.*?)\n    \};\n'
+                  r'    return &ctx\.tensors\[%s\[index\]\];\n)' % (function, indices, indices), text, re.S)
+    if m is None:
+        sys.exit('error: cannot find the tensors of %s' % function)
+    return m, [int(i) for i in re.findall(r'\d+', m.group(3))]
+
+
+def convert(path):
+    with open(path, 'r', newline='') as src:
+        text = src.read()
+    if DEFINE in text:
+        print('%s: already holds the static tables' % path)
+        return
+    nl = '\r\n' if '\r\n' in text else '\n'
+    text = text.replace(nl, '\n')
+
+    tensors, nodes, user_data = parse_model(text)
+    inputs, in_indices = io_tensors(text, 'input', 'inTensorIndices')
+    outputs, out_indices = io_tensors(text, 'output', 'outTensorIndices')
+    io_indices = in_indices + out_indices
+
+    # The RAM tables are declared before the constant tables and defined after
+    # the precomputed op user data they point to. The compact form replaces
+    # the eval tensors and the nodes with pointers to the constant tables.
+    num = len(tensors)
+    decls = (('TfLiteTensor tflTensorsWithMinus1[%d];' % (num + 1),
+              'extern TfLiteTensor ioTensors[%d];' % len(io_indices)),
+             ('TfLiteEvalTensor evalTensors[%d];' % num,
+              'extern const TfLiteEvalTensor evalTensorsConst[%d];\n'
+              'TfLiteEvalTensor * const evalTensors = const_cast<TfLiteEvalTensor *>(evalTensorsConst);' % num),
+             ('TfLiteNode tflNodes[kOpNodesCount];',
+              'extern const TfLiteNode tflNodesConst[kOpNodesCount];\n'
+              'TfLiteNode * const tflNodes = const_cast<TfLiteNode *>(tflNodesConst);'))
+    for line, compact in decls:
+        text = replace_once(text, '\n%s\n' % line,
+                            '\n#if defined(%s)\n%s\n#elif defined(%s)\nextern %s\n#else\n%s\n#endif  // %s\n' %
+                            (COMPACT, compact, DEFINE, line, line, DEFINE), line)
+    line = 'TfLiteTensor * const tflTensors = tflTensorsWithMinus1+1;'
+    text = replace_once(text, '\n%s\n' % line,
+                        '\n#ifdef %s\n#ifndef %s\n#error "%s needs %s"\n#endif\n'
+                        'TfLiteTensor * const tflTensors = nullptr;\n#else\n%s\n#endif  // %s\n' %
+                        (COMPACT, DEFINE, COMPACT, DEFINE, line, COMPACT), line)
+
+    end = '} // namespace tflite\n#endif  // TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA\n'
+    text = replace_once(text, end, end + '\n' + static_tables(tensors, nodes, user_data, io_indices),
+                        'the end of the precomputed op user data')
+
+    # TEST_MODEL_init() only sets the context and the registrations
+    m = re.search(r'\n  TfLiteIntArray dimsEmptyTensor = \{0\};\n.*?\n  \}\n', text, re.S)
+    if m is None:
+        sys.exit('error: cannot find the tensor loop of the init')
+    text = text.replace(m.group(0), '\n#ifndef %s%s#endif  // %s\n' % (DEFINE, m.group(0), DEFINE), 1)
+    m = re.search(r'\n\n(#if TF_LITE_MICRO_USE_OFFLINE_OP_USER_DATA\n'
+                  r'tflite::micro::resetOfflineOpUserData\(.*?)  return kTfLiteOk;\n\}\n', text, re.S)
+    if m is None or 'init(&ctx' not in m.group(1):
+        sys.exit('error: cannot find the init and prepare of the nodes')
+    text = text.replace(m.group(1), '#ifndef %s\n%s#endif  // %s\n' % (DEFINE, m.group(1), DEFINE), 1)
+
+    # The compact form has no TfLiteTensor table, so no temporary tensor
+    line = '    return tensor_idx >= 0 ? &tflTensors[tensor_idx] : nullptr;\n'
+    text = replace_once(text, line,
+                        '#ifdef %s\n    return nullptr;\n#else\n%s#endif  // %s\n' % (COMPACT, line, COMPACT),
+                        'the body of AllocateTempTfLiteTensor')
+
+    # The compact form returns the input and output tensors from ioTensors
+    for match, offset in ((inputs, 0), (outputs, len(in_indices))):
+        text = replace_once(text, match.group(2),
+                            '#ifdef %s\n    return &ioTensors[%sindex];\n#else\n%s#endif  // %s\n' %
+                            (COMPACT, '%d + ' % offset if offset else '', match.group(2), COMPACT),
+                            'the body of %s' % match.group(1).strip())
+
+    with open(path, 'w', newline='') as out:
+        out.write(text.replace('\n', nl))
+
+    runtime = (num + 1) * TENSOR_BYTES + num * EVAL_TENSOR_BYTES + len(nodes) * NODE_BYTES
+    compact = len(io_indices) * TENSOR_BYTES
+    print('%s: %d tensors, %d nodes resolved, tensor metadata RAM %d bytes, compact %d bytes (%d bytes saved)' %
+          (path, num, len(nodes), runtime, compact, runtime - compact))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('models', nargs='+', help='KEY_tflm_less_model_NN_TYPE.cpp files, rewritten in place')
+    args = parser.parse_args()
+    for path in args.models:
+        convert(path)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,410 @@
+#!/usr/bin/env python3
+################################################################################
+# \file ml_stream_window_host.py
+# \version 1.0
+#
+# \brief
+# Host side of the windowed streaming protocol implemented by
+# source/ml_stream_window.c (ML_STREAM_PROTOCOL=windowed in the Makefile).
+#
+# Streams the regression data to the device keeping up to WINDOW samples in
+# flight, collects the outputs sent back in multi-sample frames, and reports
+# the throughput and accuracy for each window size. The --simulate option
+# replaces the device with a model of the firmware and of the UART link, to
+# check the protocol and estimate the gains without a kit.
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import os
+import queue
+import struct
+import sys
+import threading
+import time
+
+from ml_regression_convert import DATA_TYPES, argmax, load_from_c
+
+# Must match source/ml_stream_window.h
+MAGIC = 0x574D
+MAX_WINDOW = 8
+MSG_CONFIG = 1
+MSG_ACK = 2
+MSG_SAMPLE = 3
+MSG_OUTPUT = 4
+MSG_DONE = 5
+HEADER_FMT = '<HBBHH'
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+CONFIG_FMT = '<IHHBBH'
+ACK_FMT = '<IIHHHBB'
+CHECKSUM_SIZE = 2
+OUTPUT_MODES = {'full': 0, 'topk': 1, 'label': 2}
+OUTPUT_FULL, OUTPUT_TOP_K, OUTPUT_LABEL = 0, 1, 2
+MAX_TOP_K = 16
+
+# Data type id announced by the device -> struct format of one element
+ELEM_FORMATS = {1: 'f', 2: 'b', 3: 'h'}
+
+# UART frame: start bit, 8 data bits and stop bit
+BITS_PER_BYTE = 10
+
+
+def checksum(data):
+    """Fletcher-16, must match ml_sw_checksum()."""
+    sum1 = sum2 = 0
+    for byte in data:
+        sum1 = (sum1 + byte) % 255
+        sum2 = (sum2 + sum1) % 255
+    return (sum2 << 8) | sum1
+
+
+def make_frame(msg_type, count, seq, payload):
+    frame = struct.pack(HEADER_FMT, MAGIC, msg_type, count, seq & 0xFFFF, len(payload)) + payload
+    return frame + struct.pack('<H', checksum(frame))
+
+
+def grant_output(mode, top_k, output_size):
+    """Output mode and k granted by the device, see ml_stream_window_open()."""
+    top_k = 1 if mode == OUTPUT_LABEL else top_k
+    top_k = min(top_k, MAX_TOP_K, output_size)
+    if mode > OUTPUT_LABEL or top_k == 0:
+        mode = OUTPUT_FULL
+    return mode, 0 if mode == OUTPUT_FULL else top_k
+
+
+def output_record_size(mode, top_k, output_size, elem_size):
+    if mode == OUTPUT_TOP_K:
+        return top_k * (2 + elem_size)
+    if mode == OUTPUT_LABEL:
+        return 2
+    return output_size * elem_size
+
+
+def encode_output(output, mode, top_k, elem_fmt):
+    """Same record as ml_sw_top_k(): the indices of the top_k scores in
+    decreasing order, ties to the lowest index, then the scores."""
+    if mode == OUTPUT_FULL:
+        return struct.pack('<%d%s' % (len(output), elem_fmt), *output)
+    order = sorted(range(len(output)), key=lambda i: -output[i])[:top_k]
+    record = struct.pack('<%dH' % top_k, *order)
+    if mode == OUTPUT_TOP_K:
+        record += struct.pack('<%d%s' % (top_k, elem_fmt), *(output[i] for i in order))
+    return record
+
+
+def decode_label(record, mode, top_k, output_size, elem_fmt):
+    """Return the predicted class of an output record."""
+    if mode == OUTPUT_FULL:
+        return argmax(struct.unpack('<%d%s' % (output_size, elem_fmt), record))
+    return struct.unpack_from('<H', record)[0]
+
+
+class FrameReader:
+    """Reads frames from a link, passing the text found between frames (for
+    example the profile log printed by the device) to a callback."""
+
+    def __init__(self, link, on_text=None):
+        self.link = link
+        self.on_text = on_text
+
+    def read_exact(self, size):
+        data = bytearray()
+        while len(data) < size:
+            chunk = self.link.read(size - len(data))
+            if not chunk:
+                raise TimeoutError('timeout waiting for the device')
+            data += chunk
+        return bytes(data)
+
+    def read(self):
+        text = bytearray()
+        sync = self.read_exact(2)
+        while struct.unpack('<H', sync)[0] != MAGIC:
+            text.append(sync[0])
+            sync = sync[1:] + self.read_exact(1)
+        if text and self.on_text:
+            self.on_text(text.decode('ascii', 'replace'))
+        rest = self.read_exact(HEADER_SIZE - 2)
+        _, msg_type, count, seq, length = struct.unpack(HEADER_FMT, sync + rest)
+        payload = self.read_exact(length)
+        expected, = struct.unpack('<H', self.read_exact(CHECKSUM_SIZE))
+        if checksum(sync + rest + payload) != expected:
+            raise ValueError('bad checksum in frame type %d' % msg_type)
+        return msg_type, count, seq, payload
+
+
+class SerialLink:
+    def __init__(self, port, baud, timeout):
+        try:
+            import serial
+        except ImportError:
+            sys.exit('pyserial is needed to talk to a kit: pip install pyserial')
+        self.port = serial.Serial(port, baud, timeout=timeout)
+
+    def write(self, data):
+        self.port.write(data)
+
+    def read(self, size):
+        return self.port.read(size)
+
+    def drain_text(self, idle):
+        """Return the text printed by the device until it is idle."""
+        timeout = self.port.timeout
+        self.port.timeout = idle
+        text = bytearray()
+        chunk = self.port.read(4096)
+        while chunk:
+            text += chunk
+            chunk = self.port.read(4096)
+        self.port.timeout = timeout
+        return text.decode('ascii', 'replace')
+
+
+class Wire:
+    """One direction of a simulated UART link: the bytes are delivered after
+    the bridge latency plus their time on the wire, in order."""
+
+    def __init__(self, baud, latency):
+        self.baud = baud
+        self.latency = latency
+        self.frames = queue.Queue()
+        self.busy_until = 0.0
+        self.pending = b''
+
+    def send(self, data):
+        now = time.perf_counter()
+        self.busy_until = max(now + self.latency, self.busy_until) + len(data) * BITS_PER_BYTE / self.baud
+        self.frames.put((self.busy_until, data))
+        return len(data) * BITS_PER_BYTE / self.baud
+
+    def read(self, size, timeout):
+        if not self.pending:
+            try:
+                deliver_at, self.pending = self.frames.get(timeout=timeout)
+            except queue.Empty:
+                return b''
+            delay = deliver_at - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+        data, self.pending = self.pending[:size], self.pending[size:]
+        return data
+
+
+class SimDevice(threading.Thread):
+    """Model of ml_validation_window_task(): same window and coalescing rules,
+    background reception, blocking transmission and a fixed inference time.
+    The output of sample i peaks at class i % output_size, so the host can
+    check that the outputs come back in order."""
+
+    def __init__(self, to_device, to_host, input_bytes, output_size, data_type, infer_time, timeout):
+        super().__init__(daemon=True)
+        self.rx = to_device
+        self.tx = to_host
+        self.input_bytes = input_bytes
+        self.output_size = output_size
+        self.data_type = data_type
+        self.infer_time = infer_time
+        self.timeout = timeout
+        self.error = None
+
+    def read(self, size):
+        return self.rx.read(size, self.timeout)
+
+    def send(self, frame):
+        # cyhal_uart_write() blocks the device until the bytes are out
+        time.sleep(self.tx.send(frame))
+
+    def run(self):
+        try:
+            self.session()
+        except Exception as exc:
+            self.error = exc
+
+    def session(self):
+        reader = FrameReader(self)
+        msg_type, _, _, payload = reader.read()
+        if msg_type != MSG_CONFIG:
+            raise ValueError('expected CONFIG, got %d' % msg_type)
+        num_of_samples, window, coalesce, mode, top_k, _ = struct.unpack(CONFIG_FMT, payload)
+        window = min(max(window, 1), MAX_WINDOW)
+        coalesce = min(max(coalesce, 1), window)
+        mode, top_k = grant_output(mode, top_k, self.output_size)
+        elem_fmt = ELEM_FORMATS[self.data_type]
+        elem_size = struct.calcsize(elem_fmt)
+        self.send(make_frame(MSG_ACK, 0, 0, struct.pack(
+            ACK_FMT, self.input_bytes // elem_size, self.output_size, self.data_type,
+            window, coalesce, mode, top_k)))
+
+        received = sent = 0
+        outputs = []
+        while received < num_of_samples:
+            msg_type, _, seq, payload = reader.read()
+            if msg_type != MSG_SAMPLE or seq != received & 0xFFFF or len(payload) != self.input_bytes:
+                raise ValueError('bad SAMPLE frame %d' % received)
+            received += 1
+            time.sleep(self.infer_time)
+            output = [self.output_size - (c - received + 1) % self.output_size
+                      for c in range(self.output_size)]
+            outputs.append(encode_output(output, mode, top_k, elem_fmt))
+            # Samples already in the receive ring, as seen by the firmware
+            now = time.perf_counter()
+            rx_count = sum(1 for deliver_at, _ in list(self.rx.frames.queue) if deliver_at <= now)
+            if (len(outputs) == coalesce or sent + len(outputs) == num_of_samples or
+                    (rx_count == 0 and received - sent >= window)):
+                self.send(make_frame(MSG_OUTPUT, len(outputs), sent, b''.join(outputs)))
+                sent += len(outputs)
+                outputs = []
+        self.send(make_frame(MSG_DONE, 0, sent, struct.pack('<I', sent)))
+
+
+class SimLink:
+    def __init__(self, baud, latency, infer_time, input_bytes, output_size, data_type, timeout):
+        self.baud = baud
+        self.latency = latency
+        self.infer_time = infer_time
+        self.input_bytes = input_bytes
+        self.output_size = output_size
+        self.data_type = data_type
+        self.timeout = timeout
+        self.device = None
+
+    def start_session(self):
+        self.to_device = Wire(self.baud, self.latency)
+        self.to_host = Wire(self.baud, self.latency)
+        self.device = SimDevice(self.to_device, self.to_host, self.input_bytes, self.output_size,
+                                self.data_type, self.infer_time, self.timeout)
+        self.device.start()
+
+    def write(self, data):
+        self.to_device.send(data)
+
+    def read(self, size):
+        return self.to_host.read(size, self.timeout)
+
+    def drain_text(self, idle):
+        self.device.join()
+        if self.device.error:
+            raise self.device.error
+        return ''
+
+
+def run_session(link, samples, labels, elem_fmt, window, coalesce, mode, top_k, check_order, on_text):
+    if hasattr(link, 'start_session'):
+        link.start_session()
+    reader = FrameReader(link, on_text)
+    link.write(make_frame(MSG_CONFIG, 0, 0, struct.pack(CONFIG_FMT, len(samples), window, coalesce,
+                                                        mode, top_k, 0)))
+    msg_type, _, _, payload = reader.read()
+    if msg_type != MSG_ACK:
+        raise ValueError('expected ACK, got %d' % msg_type)
+    input_size, output_size, data_type, window, coalesce, mode, top_k = struct.unpack(ACK_FMT, payload)
+    if ELEM_FORMATS.get(data_type) != elem_fmt or input_size != len(samples[0]):
+        raise ValueError('the device expects %d elements of type %d' % (input_size, data_type))
+    output_bytes = output_record_size(mode, top_k, output_size, struct.calcsize(elem_fmt))
+    rx_bytes = 0
+
+    encoded = [struct.pack('<%d%s' % (len(s), elem_fmt), *s) for s in samples]
+    start = time.perf_counter()
+    next_sample = done = correct = 0
+    while done < len(samples):
+        # Keep the window full
+        while next_sample < len(samples) and next_sample - done < window:
+            link.write(make_frame(MSG_SAMPLE, 1, next_sample, encoded[next_sample]))
+            next_sample += 1
+        msg_type, count, seq, payload = reader.read()
+        if msg_type != MSG_OUTPUT or seq != done & 0xFFFF or len(payload) != count * output_bytes:
+            raise ValueError('bad OUTPUT frame at sample %d' % done)
+        rx_bytes += HEADER_SIZE + len(payload) + CHECKSUM_SIZE
+        for i in range(count):
+            record = payload[i * output_bytes:(i + 1) * output_bytes]
+            if check_order:
+                expected = (done + i) % output_size
+            else:
+                expected = labels[done + i] if labels else None
+            correct += decode_label(record, mode, top_k, output_size, elem_fmt) == expected
+        done += count
+    msg_type, _, _, payload = reader.read()
+    if msg_type != MSG_DONE:
+        raise ValueError('expected DONE, got %d' % msg_type)
+    elapsed = time.perf_counter() - start
+    accuracy = 100.0 * correct / len(samples) if (labels or check_order) else None
+    return window, coalesce, elapsed, accuracy, rx_bytes / len(samples)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--type', default='int8x8', choices=sorted(DATA_TYPES), help='NN_TYPE of the firmware')
+    parser.add_argument('--name', default='TEST_MODEL', help='model name (NN_MODEL_NAME)')
+    parser.add_argument('--data-dir', default=os.path.join('mtb_ml_gen', 'mtb_ml_regression_data'),
+                        help='folder with the regression files generated by the ML configurator')
+    parser.add_argument('--samples', type=int, default=0, help='number of samples, 0 for all')
+    parser.add_argument('--windows', default='1,2,4,8', help='comma separated window sizes to sweep')
+    parser.add_argument('--coalesce', type=int, default=0,
+                        help='outputs per frame, 0 for half the window')
+    parser.add_argument('--output', default='full', choices=sorted(OUTPUT_MODES),
+                        help='full output tensor, top-k indices and scores, or label only')
+    parser.add_argument('--top-k', type=int, default=3, help='indices per output in topk mode')
+    parser.add_argument('--timeout', type=float, default=5.0, help='seconds')
+    parser.add_argument('--port', help='serial port of the kit')
+    parser.add_argument('--baud', type=int, default=1000000)
+    parser.add_argument('--simulate', action='store_true', help='use a simulated device')
+    parser.add_argument('--sim-infer-us', type=float, default=500.0, help='simulated inference time')
+    parser.add_argument('--sim-latency-us', type=float, default=1000.0,
+                        help='simulated USB-UART bridge latency, each way')
+    parser.add_argument('--sim-output-size', type=int, default=10)
+    args = parser.parse_args()
+
+    base = os.path.join(args.data_dir, '%s_tflm_%%s_data_%s.c' % (args.name, args.type))
+    dataset = load_from_c(base % 'x', base % 'y', args.type)
+    samples = dataset.samples[:args.samples] if args.samples else dataset.samples
+    labels = dataset.labels[:len(samples)] if dataset.labels else None
+    data_type, elem_fmt = DATA_TYPES[args.type]
+
+    if args.simulate:
+        link = SimLink(args.baud, args.sim_latency_us * 1e-6, args.sim_infer_us * 1e-6,
+                       len(samples[0]) * struct.calcsize(elem_fmt), args.sim_output_size,
+                       data_type, args.timeout)
+    elif args.port:
+        link = SerialLink(args.port, args.baud, args.timeout)
+    else:
+        sys.exit('Use --port to talk to a kit, or --simulate')
+
+    def on_text(text):
+        sys.stdout.write(text)
+
+    print('%d samples of %d elements, %s' % (len(samples), len(samples[0]), args.type))
+    mode = OUTPUT_MODES[args.output]
+    print('Output mode: %s%s' % (args.output, ' (k=%d)' % args.top_k if mode == OUTPUT_TOP_K else ''))
+    print('%8s %10s %10s %12s %10s %14s' % ('window', 'coalesce', 'time (s)', 'samples/s', 'accuracy',
+                                            'RX bytes/sample'))
+    for window in (int(w) for w in args.windows.split(',')):
+        coalesce = args.coalesce if args.coalesce else max(1, window // 2)
+        window, coalesce, elapsed, accuracy, rx_per_sample = run_session(
+            link, samples, labels, elem_fmt, window, coalesce, mode, args.top_k, args.simulate, on_text)
+        print('%8d %10d %10.3f %12.1f %10s %14.1f' % (window, coalesce, elapsed, len(samples) / elapsed,
+                                                      'n/a' if accuracy is None else '%.2f%%' % accuracy,
+                                                      rx_per_sample))
+        # The device prints its profile log after the DONE frame
+        text = link.drain_text(0.5)
+        if text.strip():
+            print(text.strip())
+
+
+if __name__ == '__main__':
+    main()
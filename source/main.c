@@ -45,6 +45,7 @@
 #include "ml_validation.h"
 
 #include "elapsed_timer.h"
+#include "ml_boot_profile.h"
 
 #include MTB_ML_INCLUDE_MODEL_FILE(MODEL_NAME)
 
@@ -106,9 +107,11 @@ static void cm4_ml_profiler_task(void * arg)
     mtb_ml_model_bin_t model_bin = {MTB_ML_MODEL_BIN_DATA(MODEL_NAME)};
 
     /* Initialize retarget-io to use the debug UART port */
+    ML_BOOT_PHASE_BEGIN("cy_retarget_io_init", ML_BOOT_PROFILE_NO_INDEX);
     cy_retarget_io_init(CYBSP_DEBUG_UART_TX, CYBSP_DEBUG_UART_RX, UART_DEFAULT_STREAM_BAUD_RATE);
+    ML_BOOT_PHASE_END();
 
-#ifdef USE_STREAM_DATA
+#if defined(USE_STREAM_DATA) && !defined(ML_STREAM_WINDOWED)
     /* Data streaming object */
     mtb_data_streaming_interface_t data_stream_obj;
     /* ML stream objects */
@@ -120,16 +123,22 @@ static void cm4_ml_profiler_task(void * arg)
 #endif /* USE_STREAM_DATA */
 
     /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
+    ML_BOOT_PHASE_BEGIN("welcome message", ML_BOOT_PROFILE_NO_INDEX);
     printf("\x1b[2J\x1b[;H");
 
     printf("****************** "
            "PSOC 6 MCU: Machine Learning Profiler on CM4 "
            "****************** \r\n\n");
+    ML_BOOT_PHASE_END();
 
     /* Initialize the ModusToolbox ML middleware */
+    ML_BOOT_PHASE_BEGIN("mtb_ml_init", ML_BOOT_PROFILE_NO_INDEX);
     mtb_ml_init(MTB_ML_PRIORITY);
+    ML_BOOT_PHASE_END();
 
+    ML_BOOT_PHASE_BEGIN("ml_validation_init", ML_BOOT_PROFILE_NO_INDEX);
     result = ml_validation_init(PROFILE_CONFIGURATION, &model_bin);
+    ML_BOOT_PHASE_END();
 
     if(CY_RSLT_SUCCESS != result)
     {
@@ -138,7 +147,9 @@ static void cm4_ml_profiler_task(void * arg)
     }
 
     /* Initialize the elapsed timer */
+    ML_BOOT_PHASE_BEGIN("elapsed_timer_init", ML_BOOT_PROFILE_NO_INDEX);
     result = elapsed_timer_init();
+    ML_BOOT_PHASE_END();
 
     if(CY_RSLT_SUCCESS != result)
     {
@@ -146,9 +157,17 @@ static void cm4_ml_profiler_task(void * arg)
         handle_error();
     }
 
+#ifdef ML_BOOT_PROFILE
+    /* Everything from main() up to here runs before the first inference */
+    ml_boot_profile_log();
+#endif /* ML_BOOT_PROFILE */
+
     for (;;)
     {
-#ifdef USE_STREAM_DATA
+#if defined(ML_STREAM_WINDOWED)
+        /* Windowed protocol over the debug UART */
+        result = ml_validation_window_task(&cy_retarget_io_uart_obj);
+#elif defined(USE_STREAM_DATA)
         result = ml_validation_stream_task(&stream_interface);
 #else
         result = ml_validation_local_task();
@@ -198,8 +217,15 @@ int main(void)
 {
     cy_rslt_t result;
 
+#ifdef ML_BOOT_PROFILE
+    /* Count the cycles of the startup phases from here */
+    ml_boot_profile_start();
+#endif /* ML_BOOT_PROFILE */
+
     /* Initialize the device and board peripherals */
+    ML_BOOT_PHASE_BEGIN("cybsp_init", ML_BOOT_PROFILE_NO_INDEX);
     result = cybsp_init() ;
+    ML_BOOT_PHASE_END();
     if (result != CY_RSLT_SUCCESS)
     {
         CY_ASSERT(0);
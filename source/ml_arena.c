@@ -0,0 +1,160 @@
+/******************************************************************************
+* File Name:   ml_arena.c
+*
+* Description: This file contains the measure of the tensor arena used by the
+*              inference engine, from the bytes it wrote.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_arena.h"
+
+#include <stdio.h>
+
+/*******************************************************************************
+* Function Name: ml_arena_fill
+********************************************************************************
+* Summary:
+*   Write ML_ARENA_FILL_WORD over the whole arena. Call it before the model
+*   initialization.
+*
+* Parameters:
+*   arena: tensor arena, word aligned
+*   size: size of the arena in bytes
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_arena_fill(uint32_t *arena, uint32_t size)
+{
+    for (uint32_t i = 0; i < (size / sizeof(uint32_t)); i++)
+    {
+        arena[i] = ML_ARENA_FILL_WORD;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_arena_get_usage
+********************************************************************************
+* Summary:
+*   Find the bytes of the arena used from each end. The longest run of words
+*   still holding ML_ARENA_FILL_WORD is the gap between the head and the tail.
+*   A used word that holds the fill word at the edge of the gap is counted as
+*   unused, so the usage can be a few words short.
+*
+* Parameters:
+*   arena: tensor arena filled by ml_arena_fill()
+*   size: size of the arena in bytes
+*   usage: bytes used from the start and from the end of the arena
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_arena_get_usage(const uint32_t *arena, uint32_t size, ml_arena_usage_t *usage)
+{
+    uint32_t words = size / sizeof(uint32_t);
+    uint32_t gap_start = 0u;
+    uint32_t gap_words = 0u;
+    uint32_t run_start = 0u;
+
+    for (uint32_t i = 0; i <= words; i++)
+    {
+        if ((i < words) && (arena[i] == ML_ARENA_FILL_WORD))
+        {
+            continue;
+        }
+        if ((i - run_start) > gap_words)
+        {
+            gap_start = run_start;
+            gap_words = i - run_start;
+        }
+        run_start = i + 1u;
+    }
+
+    usage->size = size;
+    if (gap_words == 0u)
+    {
+        usage->head = size;
+        usage->tail = 0u;
+    }
+    else
+    {
+        usage->head = gap_start * sizeof(uint32_t);
+        usage->tail = size - ((gap_start + gap_words) * sizeof(uint32_t));
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_arena_log
+********************************************************************************
+* Summary:
+*   Print the bytes of the arena used from each end and in total. The last
+*   line printed is read by scripts/ml_arena_fit.py.
+*
+* Parameters:
+*   when: point of the measure, such as "after prepare"
+*   usage: bytes used from each end of the arena
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_arena_log(const char *when, const ml_arena_usage_t *usage)
+{
+    uint32_t used = usage->head + usage->tail;
+
+    printf("Tensor arena %s: head=%lu, tail=%lu, used=%lu of %lu bytes (%lu bytes unused)\r\n", when,
+           (unsigned long) usage->head, (unsigned long) usage->tail, (unsigned long) used,
+           (unsigned long) usage->size, (unsigned long) (usage->size - used));
+}
+
+/*******************************************************************************
+* Function Name: ml_arena_log_init_failure
+********************************************************************************
+* Summary:
+*   Print that the model did not initialize with the arena, which is read by
+*   scripts/ml_arena_fit.py to report a fitted size that is too small.
+*
+* Parameters:
+*   size: size of the arena in bytes
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_arena_log_init_failure(uint32_t size)
+{
+    printf("Tensor arena of %lu bytes: initialization failed\r\n", (unsigned long) size);
+}
+
+/* [] END OF FILE */
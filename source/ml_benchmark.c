@@ -0,0 +1,160 @@
+/******************************************************************************
+* File Name:   ml_benchmark.c
+*
+* Description: This file contains the functions that feed a float sample to
+*              a model variant linked for the benchmark, in its input type, and
+*              read its predicted class.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_benchmark.h"
+#include "ml_quantize.h"
+
+#include <string.h>
+
+#include "mtb_ml.h"
+
+/*******************************************************************************
+* Function Name: ml_benchmark_set_input
+********************************************************************************
+* Summary:
+*   Copy a float sample to the input tensor of a variant, quantized with the
+*   parameters of the tensor if the variant is quantized.
+*
+* Parameters:
+*   variant: model variant
+*   sample: float sample
+*   size: number of values in the sample
+*
+* Return:
+*   cy_rslt_t: MTB_ML_RESULT_MISMATCH_DATA_TYPE if the input tensor has
+*   another size or an unsupported type.
+*******************************************************************************/
+cy_rslt_t ml_benchmark_set_input(const ml_benchmark_variant_t *variant, const float *sample,
+                                 uint32_t size)
+{
+    const TfLiteTensor *input = variant->input(0);
+    void *data = variant->input_ptr(0);
+
+    switch (input->type)
+    {
+        case kTfLiteInt8:
+            if (input->bytes != (size * sizeof(int8_t)))
+            {
+                return MTB_ML_RESULT_MISMATCH_DATA_TYPE;
+            }
+            ml_quantize_s8(sample, (int8_t *) data, size, input->params.scale, input->params.zero_point);
+            break;
+
+        case kTfLiteInt16:
+            if (input->bytes != (size * sizeof(int16_t)))
+            {
+                return MTB_ML_RESULT_MISMATCH_DATA_TYPE;
+            }
+            ml_quantize_s16(sample, (int16_t *) data, size, input->params.scale, input->params.zero_point);
+            break;
+
+        case kTfLiteFloat32:
+            if (input->bytes != (size * sizeof(float)))
+            {
+                return MTB_ML_RESULT_MISMATCH_DATA_TYPE;
+            }
+            memcpy(data, sample, size * sizeof(float));
+            break;
+
+        default:
+            return MTB_ML_RESULT_MISMATCH_DATA_TYPE;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_benchmark_classify
+********************************************************************************
+* Summary:
+*   Run a variant on its input tensor and return the index of its largest
+*   output. Quantized outputs are compared as integers, which keeps the order
+*   of the real values.
+*
+* Parameters:
+*   variant: model variant
+*   num_of_classes: number of outputs
+*   predicted_class: index of the largest output, the first one on ties
+*
+* Return:
+*   cy_rslt_t: MTB_ML_RESULT_INFERENCE_ERROR if the inference fails.
+*******************************************************************************/
+cy_rslt_t ml_benchmark_classify(const ml_benchmark_variant_t *variant, uint32_t num_of_classes,
+                                int *predicted_class)
+{
+    const TfLiteTensor *output;
+    const void *data;
+    uint32_t best = 0;
+
+    if (kTfLiteOk != variant->invoke())
+    {
+        return MTB_ML_RESULT_INFERENCE_ERROR;
+    }
+
+    output = variant->output(0);
+    data = variant->output_ptr(0);
+    for (uint32_t i = 1; i < num_of_classes; i++)
+    {
+        switch (output->type)
+        {
+            case kTfLiteInt8:
+                best = (((const int8_t *) data)[i] > ((const int8_t *) data)[best]) ? i : best;
+                break;
+
+            case kTfLiteInt16:
+                best = (((const int16_t *) data)[i] > ((const int16_t *) data)[best]) ? i : best;
+                break;
+
+            case kTfLiteFloat32:
+                best = (((const float *) data)[i] > ((const float *) data)[best]) ? i : best;
+                break;
+
+            default:
+                return MTB_ML_RESULT_MISMATCH_DATA_TYPE;
+        }
+    }
+
+    *predicted_class = (int) best;
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,81 @@
+/******************************************************************************
+* File Name:   ml_benchmark.h
+*
+* Description: This file contains the data types and function prototypes
+*   used in ml_benchmark.c to run several model variants linked in one
+*   image on the same samples.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_BENCHMARK_H
+#define ML_BENCHMARK_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+#include "tensorflow/lite/c/common.h"
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Interpreter-less model linked next to the configured model, with its
+ * functions renamed by scripts/ml_benchmark_gen.py, or model compiled ahead
+ * of time by scripts/ml_aot_gen.py */
+typedef struct
+{
+    const char      *name;
+    TfLiteStatus    (*init)(void);
+    TfLiteTensor    *(*input)(int index);
+    void            *(*input_ptr)(int index);
+    TfLiteTensor    *(*output)(int index);
+    void            *(*output_ptr)(int index);
+    TfLiteStatus    (*invoke)(void);
+    uint32_t        arena_bytes;    /* Tensor arena, peak of the activations */
+    uint32_t        flash_bytes;    /* Constant and initialized data */
+    uint32_t        ram_bytes;      /* Initialized and uninitialized data */
+} ml_benchmark_variant_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t ml_benchmark_set_input(const ml_benchmark_variant_t *variant, const float *sample,
+                                 uint32_t size);
+cy_rslt_t ml_benchmark_classify(const ml_benchmark_variant_t *variant, uint32_t num_of_classes,
+                                int *predicted_class);
+
+#endif /* ML_BENCHMARK_H */
+
+/* [] END OF FILE */
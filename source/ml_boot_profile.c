@@ -0,0 +1,267 @@
+/******************************************************************************
+* File Name:   ml_boot_profile.c
+*
+* Description: This file contains the timing of the startup phases, from main()
+*              to the first inference.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "cy_pdl.h"
+
+#include "ml_boot_profile.h"
+
+#include <stdio.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* How the model reaches the first inference, to compare the breakdowns */
+#if defined(COMPONENT_ML_TFLM_LESS) && defined(ML_TFLM_SNAPSHOT)
+#define ML_BOOT_PROFILE_MODEL_START "tflm_less compact tables, snapshot of the tflm model"
+#elif defined(COMPONENT_ML_TFLM_LESS) && defined(ML_TFLM_LESS_COMPACT_TENSORS)
+#define ML_BOOT_PROFILE_MODEL_START "tflm_less compact tables"
+#elif defined(COMPONENT_ML_TFLM_LESS) && defined(ML_TFLM_LESS_STATIC_INIT)
+#define ML_BOOT_PROFILE_MODEL_START "tflm_less static tables"
+#elif defined(COMPONENT_ML_TFLM_LESS)
+#define ML_BOOT_PROFILE_MODEL_START "tflm_less runtime init"
+#elif defined(COMPONENT_ML_TFLM)
+#define ML_BOOT_PROFILE_MODEL_START "tflm interpreter, flatbuffer parsed at startup"
+#else
+#define ML_BOOT_PROFILE_MODEL_START "unknown"
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Phases in the order they began */
+static ml_boot_profile_phase_t boot_phases[ML_BOOT_PROFILE_MAX_PHASES];
+static uint32_t boot_phase_count;
+static uint32_t boot_phase_dropped;
+
+/* Phases begun and not ended yet, innermost last */
+static int32_t boot_open[ML_BOOT_PROFILE_MAX_DEPTH];
+static uint32_t boot_depth;
+
+/* Phases begun deeper than ML_BOOT_PROFILE_MAX_DEPTH and not ended yet */
+static uint32_t boot_overflow_depth;
+
+/* Phases are no longer recorded once the breakdown is printed */
+static bool boot_closed;
+
+/*******************************************************************************
+* Function Name: ml_boot_profile_get_cycles
+********************************************************************************
+* Summary:
+*   Return the DWT cycle counter. It runs without interrupts, so it is usable
+*   before the system tick timer is initialized.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   uint32_t: cycles since ml_boot_profile_start().
+*******************************************************************************/
+static inline uint32_t ml_boot_profile_get_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: ml_boot_profile_start
+********************************************************************************
+* Summary:
+*   Start the DWT cycle counter from zero. Call it first in main().
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_boot_profile_start(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    boot_phase_count = 0u;
+    boot_phase_dropped = 0u;
+    boot_depth = 0u;
+    boot_overflow_depth = 0u;
+    boot_closed = false;
+}
+
+/*******************************************************************************
+* Function Name: ml_boot_profile_begin
+********************************************************************************
+* Summary:
+*   Begin a startup phase, nested in the phases begun and not ended yet.
+*
+* Parameters:
+*   name: name of the phase, a string literal
+*   index: node index, or ML_BOOT_PROFILE_NO_INDEX
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_boot_profile_begin(const char *name, int32_t index)
+{
+    ml_boot_profile_phase_t *phase;
+
+    if (boot_closed)
+    {
+        return;
+    }
+
+    /* Dropped phases still count in the nesting, so that their end does not
+     * close the parent */
+    if (boot_depth >= ML_BOOT_PROFILE_MAX_DEPTH)
+    {
+        boot_phase_dropped++;
+        boot_overflow_depth++;
+        return;
+    }
+    if (boot_phase_count >= ML_BOOT_PROFILE_MAX_PHASES)
+    {
+        boot_phase_dropped++;
+        boot_open[boot_depth++] = -1;
+        return;
+    }
+
+    phase = &boot_phases[boot_phase_count];
+    phase->name = name;
+    phase->index = index;
+    phase->depth = (uint8_t) boot_depth;
+    phase->finished = false;
+    phase->cycles = 0u;
+    boot_open[boot_depth++] = (int32_t) boot_phase_count;
+    boot_phase_count++;
+
+    phase->start = ml_boot_profile_get_cycles();
+}
+
+/*******************************************************************************
+* Function Name: ml_boot_profile_end
+********************************************************************************
+* Summary:
+*   End the innermost startup phase begun.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_boot_profile_end(void)
+{
+    uint32_t now = ml_boot_profile_get_cycles();
+    int32_t  open;
+
+    if (boot_closed || (boot_depth == 0u))
+    {
+        return;
+    }
+    if (boot_overflow_depth != 0u)
+    {
+        boot_overflow_depth--;
+        return;
+    }
+
+    open = boot_open[--boot_depth];
+    if (open >= 0)
+    {
+        boot_phases[open].cycles = now - boot_phases[open].start;
+        boot_phases[open].finished = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_boot_profile_log
+********************************************************************************
+* Summary:
+*   Print the startup breakdown, one CSV line per phase in the order they
+*   began, and stop recording. The phases still open, such as one that
+*   returned with an error, are printed without cycles.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_boot_profile_log(void)
+{
+    uint32_t now = ml_boot_profile_get_cycles();
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+
+    boot_closed = true;
+
+    if (cycles_per_us == 0u)
+    {
+        cycles_per_us = 1u;
+    }
+
+    printf("\r\nStartup breakdown, %lu cycles per us:\r\n", (unsigned long) cycles_per_us);
+    printf("phase,index,depth,start_cycles,cycles,us\r\n");
+    for (uint32_t i = 0; i < boot_phase_count; i++)
+    {
+        const ml_boot_profile_phase_t *phase = &boot_phases[i];
+
+        if (phase->finished)
+        {
+            printf("%s,%ld,%u,%lu,%lu,%lu\r\n", phase->name, (long) phase->index,
+                   (unsigned int) phase->depth, (unsigned long) phase->start,
+                   (unsigned long) phase->cycles, (unsigned long) (phase->cycles / cycles_per_us));
+        }
+        else
+        {
+            printf("%s,%ld,%u,%lu,,\r\n", phase->name, (long) phase->index,
+                   (unsigned int) phase->depth, (unsigned long) phase->start);
+        }
+    }
+    printf("total,%d,0,0,%lu,%lu\r\n", ML_BOOT_PROFILE_NO_INDEX,
+           (unsigned long) now, (unsigned long) (now / cycles_per_us));
+    printf("Boot to ready: cycles=%lu, us=%lu, model startup: %s\r\n", (unsigned long) now,
+           (unsigned long) (now / cycles_per_us), ML_BOOT_PROFILE_MODEL_START);
+
+    if (boot_phase_dropped != 0u)
+    {
+        printf("WARNING: %lu startup phases not recorded, over ML_BOOT_PROFILE_MAX_PHASES or ML_BOOT_PROFILE_MAX_DEPTH\r\n",
+               (unsigned long) boot_phase_dropped);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,95 @@
+/******************************************************************************
+* File Name:   ml_boot_profile.h
+*
+* Description: This file contains the data types and function prototypes used
+*   in ml_boot_profile.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_BOOT_PROFILE_H
+#define ML_BOOT_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Largest number of phases recorded, the next ones are counted as dropped */
+#ifndef ML_BOOT_PROFILE_MAX_PHASES
+#define ML_BOOT_PROFILE_MAX_PHASES  (32u)
+#endif
+
+/* Largest nesting of the phases */
+#define ML_BOOT_PROFILE_MAX_DEPTH   (4u)
+
+/* Index of the phases that are not repeated per node */
+#define ML_BOOT_PROFILE_NO_INDEX    (-1)
+
+/* Phase markers, removed from the build without ML_BOOT_PROFILE */
+#ifdef ML_BOOT_PROFILE
+#define ML_BOOT_PHASE_BEGIN(name, index)    ml_boot_profile_begin((name), (index))
+#define ML_BOOT_PHASE_END()                 ml_boot_profile_end()
+#else
+#define ML_BOOT_PHASE_BEGIN(name, index)
+#define ML_BOOT_PHASE_END()
+#endif /* ML_BOOT_PROFILE */
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* One startup phase, in cycles of the DWT counter started at main() */
+typedef struct
+{
+    const char  *name;
+    int32_t     index;          /* Node index, or ML_BOOT_PROFILE_NO_INDEX */
+    uint8_t     depth;          /* Number of phases it is nested in */
+    bool        finished;
+    uint32_t    start;
+    uint32_t    cycles;
+} ml_boot_profile_phase_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void ml_boot_profile_start(void);
+void ml_boot_profile_begin(const char *name, int32_t index);
+void ml_boot_profile_end(void);
+void ml_boot_profile_log(void);
+
+#endif /* ML_BOOT_PROFILE_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,425 @@
+/******************************************************************************
+* File Name:   ml_fc_f32.c
+*
+* Description: This file contains float fully connected and softmax
+*              kernels, unrolled for the Cortex-M4F FPU, with float32 or
+*              half precision weights.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_fc_f32.h"
+
+#include <math.h>
+#include <stddef.h>
+
+/* With an FPU that fuses multiply and add (Cortex-M4F VFMA), fmaf() compiles
+ * to one instruction. Otherwise it is a library call, so the product and the
+ * sum are kept apart. */
+#if defined(__ARM_FEATURE_FMA) || defined(__FMA__)
+#define ML_FC_F32_MAC(acc, a, b)    fmaf((a), (b), (acc))
+#else
+#define ML_FC_F32_MAC(acc, a, b)    ((acc) + ((a) * (b)))
+#endif
+
+/* With IEEE __fp16 support (GCC -mfp16-format=ieee, Arm Compiler 6), the FPU
+ * widens a half with one VCVTB instruction. Otherwise the bits are moved to
+ * their float32 position and the exponent is rebased. */
+#if defined(__ARM_FP16_FORMAT_IEEE)
+typedef __fp16 ml_fc_f16_t;
+#define ML_FC_F16_TO_F32(half)      ((float) (half))
+#else
+typedef uint16_t ml_fc_f16_t;
+#define ML_FC_F16_TO_F32(half)      ml_fc_f16_to_f32(half)
+#endif
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define F16_SIGN_MASK       (0x8000u)
+#define F16_MAGNITUDE_MASK  (0x7FFFu)
+/* Bits between the half and the float32 sign, and between their mantissas */
+#define F16_SIGN_SHIFT      (16u)
+#define F16_MANTISSA_SHIFT  (13u)
+/* 2^(127 - 15), difference of the exponent biases */
+#define F16_EXPONENT_SCALE  (0x1p112f)
+
+#if !defined(__ARM_FP16_FORMAT_IEEE)
+/*******************************************************************************
+* Function Name: ml_fc_f16_to_f32
+********************************************************************************
+* Summary:
+*   Widen an IEEE half to float32. The multiplication rebases the exponent,
+*   which also handles zeros and subnormals. Weights are finite, so infinities
+*   and NaNs are not handled.
+*
+* Parameters:
+*   half: IEEE half bits
+*
+* Return:
+*   float: same value in float32.
+*******************************************************************************/
+static inline float ml_fc_f16_to_f32(uint16_t half)
+{
+    union
+    {
+        uint32_t u;
+        float    f;
+    } bits;
+
+    bits.u = (((uint32_t) half & F16_SIGN_MASK) << F16_SIGN_SHIFT) |
+             (((uint32_t) half & F16_MAGNITUDE_MASK) << F16_MANTISSA_SHIFT);
+
+    return bits.f * F16_EXPONENT_SCALE;
+}
+#endif /* !__ARM_FP16_FORMAT_IEEE */
+
+/*******************************************************************************
+* Function Name: ml_fc_f32_activate
+********************************************************************************
+* Summary:
+*   Apply the fused activation of a layer to an output.
+*
+* Parameters:
+*   value: output before activation
+*   activation: ML_FC_F32_ACT_*
+*
+* Return:
+*   float: activated output.
+*******************************************************************************/
+static inline float ml_fc_f32_activate(float value, uint32_t activation)
+{
+    if (activation != ML_FC_F32_ACT_NONE)
+    {
+        value = (value < 0.0f) ? 0.0f : value;
+        if (activation == ML_FC_F32_ACT_RELU6)
+        {
+            value = (value > 6.0f) ? 6.0f : value;
+        }
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_f32_rows
+********************************************************************************
+* Summary:
+*   Run a fully connected layer with float32 weights. The rows are computed
+*   four at a time, so each input is loaded once for four weights and the
+*   four accumulators are independent. The remaining rows split their inputs
+*   over four accumulators instead.
+*
+* Parameters:
+*   layer: layer weights and parameters
+*   input: cols inputs
+*   output: rows outputs
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_fc_f32_rows(const ml_fc_f32_layer_t *layer, const float *input, float *output)
+{
+    const float *weights = (const float *) layer->weights;
+    const uint32_t cols = layer->cols;
+    uint32_t r = 0;
+
+    for (; (r + ML_FC_F32_ROWS_PER_PASS) <= layer->rows; r += ML_FC_F32_ROWS_PER_PASS)
+    {
+        const float *w0 = &weights[r * cols];
+        const float *w1 = &w0[cols];
+        const float *w2 = &w1[cols];
+        const float *w3 = &w2[cols];
+        float acc0 = 0.0f;
+        float acc1 = 0.0f;
+        float acc2 = 0.0f;
+        float acc3 = 0.0f;
+
+        for (uint32_t c = 0; c < cols; c++)
+        {
+            float x = input[c];
+
+            acc0 = ML_FC_F32_MAC(acc0, w0[c], x);
+            acc1 = ML_FC_F32_MAC(acc1, w1[c], x);
+            acc2 = ML_FC_F32_MAC(acc2, w2[c], x);
+            acc3 = ML_FC_F32_MAC(acc3, w3[c], x);
+        }
+
+        if (layer->bias != NULL)
+        {
+            acc0 += layer->bias[r];
+            acc1 += layer->bias[r + 1u];
+            acc2 += layer->bias[r + 2u];
+            acc3 += layer->bias[r + 3u];
+        }
+        output[r] = ml_fc_f32_activate(acc0, layer->activation);
+        output[r + 1u] = ml_fc_f32_activate(acc1, layer->activation);
+        output[r + 2u] = ml_fc_f32_activate(acc2, layer->activation);
+        output[r + 3u] = ml_fc_f32_activate(acc3, layer->activation);
+    }
+
+    for (; r < layer->rows; r++)
+    {
+        const float *w = &weights[r * cols];
+        float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        uint32_t c = 0;
+
+        for (; (c + 4u) <= cols; c += 4u)
+        {
+            acc[0] = ML_FC_F32_MAC(acc[0], w[c], input[c]);
+            acc[1] = ML_FC_F32_MAC(acc[1], w[c + 1u], input[c + 1u]);
+            acc[2] = ML_FC_F32_MAC(acc[2], w[c + 2u], input[c + 2u]);
+            acc[3] = ML_FC_F32_MAC(acc[3], w[c + 3u], input[c + 3u]);
+        }
+        for (; c < cols; c++)
+        {
+            acc[0] = ML_FC_F32_MAC(acc[0], w[c], input[c]);
+        }
+
+        acc[0] = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+        if (layer->bias != NULL)
+        {
+            acc[0] += layer->bias[r];
+        }
+        output[r] = ml_fc_f32_activate(acc[0], layer->activation);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_f16_rows
+********************************************************************************
+* Summary:
+*   Run a fully connected layer with half weights, widened to float32 after
+*   each load. Same order of operations as ml_fc_f32_rows().
+*
+* Parameters:
+*   layer: layer weights and parameters
+*   input: cols inputs
+*   output: rows outputs
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_fc_f16_rows(const ml_fc_f32_layer_t *layer, const float *input, float *output)
+{
+    const ml_fc_f16_t *weights = (const ml_fc_f16_t *) layer->weights;
+    const uint32_t cols = layer->cols;
+    uint32_t r = 0;
+
+    for (; (r + ML_FC_F32_ROWS_PER_PASS) <= layer->rows; r += ML_FC_F32_ROWS_PER_PASS)
+    {
+        const ml_fc_f16_t *w0 = &weights[r * cols];
+        const ml_fc_f16_t *w1 = &w0[cols];
+        const ml_fc_f16_t *w2 = &w1[cols];
+        const ml_fc_f16_t *w3 = &w2[cols];
+        float acc0 = 0.0f;
+        float acc1 = 0.0f;
+        float acc2 = 0.0f;
+        float acc3 = 0.0f;
+
+        for (uint32_t c = 0; c < cols; c++)
+        {
+            float x = input[c];
+
+            acc0 = ML_FC_F32_MAC(acc0, ML_FC_F16_TO_F32(w0[c]), x);
+            acc1 = ML_FC_F32_MAC(acc1, ML_FC_F16_TO_F32(w1[c]), x);
+            acc2 = ML_FC_F32_MAC(acc2, ML_FC_F16_TO_F32(w2[c]), x);
+            acc3 = ML_FC_F32_MAC(acc3, ML_FC_F16_TO_F32(w3[c]), x);
+        }
+
+        if (layer->bias != NULL)
+        {
+            acc0 += layer->bias[r];
+            acc1 += layer->bias[r + 1u];
+            acc2 += layer->bias[r + 2u];
+            acc3 += layer->bias[r + 3u];
+        }
+        output[r] = ml_fc_f32_activate(acc0, layer->activation);
+        output[r + 1u] = ml_fc_f32_activate(acc1, layer->activation);
+        output[r + 2u] = ml_fc_f32_activate(acc2, layer->activation);
+        output[r + 3u] = ml_fc_f32_activate(acc3, layer->activation);
+    }
+
+    for (; r < layer->rows; r++)
+    {
+        const ml_fc_f16_t *w = &weights[r * cols];
+        float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        uint32_t c = 0;
+
+        for (; (c + 4u) <= cols; c += 4u)
+        {
+            acc[0] = ML_FC_F32_MAC(acc[0], ML_FC_F16_TO_F32(w[c]), input[c]);
+            acc[1] = ML_FC_F32_MAC(acc[1], ML_FC_F16_TO_F32(w[c + 1u]), input[c + 1u]);
+            acc[2] = ML_FC_F32_MAC(acc[2], ML_FC_F16_TO_F32(w[c + 2u]), input[c + 2u]);
+            acc[3] = ML_FC_F32_MAC(acc[3], ML_FC_F16_TO_F32(w[c + 3u]), input[c + 3u]);
+        }
+        for (; c < cols; c++)
+        {
+            acc[0] = ML_FC_F32_MAC(acc[0], ML_FC_F16_TO_F32(w[c]), input[c]);
+        }
+
+        acc[0] = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+        if (layer->bias != NULL)
+        {
+            acc[0] += layer->bias[r];
+        }
+        output[r] = ml_fc_f32_activate(acc[0], layer->activation);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_f32
+********************************************************************************
+* Summary:
+*   Run a float fully connected layer, with float32 or half weights.
+*
+* Parameters:
+*   layer: layer weights and parameters
+*   input: cols inputs
+*   output: rows outputs
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_fc_f32(const ml_fc_f32_layer_t *layer, const float *input, float *output)
+{
+    if (layer->weight_bits == ML_FC_F32_WEIGHTS_F16)
+    {
+        ml_fc_f16_rows(layer, input, output);
+    }
+    else
+    {
+        ml_fc_f32_rows(layer, input, output);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_f32
+********************************************************************************
+* Summary:
+*   Run a float softmax. The largest input is subtracted before the exp, so
+*   the exp does not overflow, and the sum is inverted once.
+*
+* Parameters:
+*   input: size inputs
+*   output: size outputs, can be the input
+*   size: number of inputs
+*   beta: input scaling
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_softmax_f32(const float *input, float *output, uint32_t size, float beta)
+{
+    float max = input[0];
+    float sum = 0.0f;
+    float scale;
+
+    for (uint32_t i = 1; i < size; i++)
+    {
+        max = (input[i] > max) ? input[i] : max;
+    }
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        output[i] = expf((input[i] - max) * beta);
+        sum += output[i];
+    }
+
+    scale = 1.0f / sum;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        output[i] *= scale;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_f32_scratch_size
+********************************************************************************
+* Summary:
+*   Return the size of the scratch buffer needed by ml_fc_f32_run().
+*
+* Parameters:
+*   model: layer stack
+*
+* Return:
+*   uint32_t: size in bytes.
+*******************************************************************************/
+uint32_t ml_fc_f32_scratch_size(const ml_fc_f32_model_t *model)
+{
+    /* Two activation buffers */
+    return 2u * model->max_width * (uint32_t) sizeof(float);
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_f32_run
+********************************************************************************
+* Summary:
+*   Run the layer stack, then the softmax if the model has one.
+*
+* Parameters:
+*   model: layer stack
+*   input: model input
+*   scratch: ml_fc_f32_scratch_size() bytes, 4-byte aligned
+*
+* Return:
+*   const float *: model output, in the scratch buffer.
+*******************************************************************************/
+const float *ml_fc_f32_run(const ml_fc_f32_model_t *model, const float *input,
+                           void *scratch)
+{
+    float *act[2];
+    const float *layer_input = input;
+    const ml_fc_f32_layer_t *last = &model->layers[model->num_of_layers - 1u];
+
+    act[0] = (float *) scratch;
+    act[1] = &act[0][model->max_width];
+
+    for (uint32_t l = 0; l < model->num_of_layers; l++)
+    {
+        ml_fc_f32(&model->layers[l], layer_input, act[l & 1u]);
+        layer_input = act[l & 1u];
+    }
+
+    if (model->softmax_beta != 0.0f)
+    {
+        ml_softmax_f32(layer_input, act[0], last->rows, model->softmax_beta);
+        layer_input = act[0];
+    }
+
+    return layer_input;
+}
+
+/* [] END OF FILE */
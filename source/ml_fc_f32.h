@@ -0,0 +1,102 @@
+/******************************************************************************
+* File Name:   ml_fc_f32.h
+*
+* Description: This file contains the data types and function prototypes
+*   used in ml_fc_f32.c to run float fully connected layers.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_FC_F32_H
+#define ML_FC_F32_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Weight formats: float32, or IEEE half precision widened to float32 in
+ * registers, which halves the weight bytes read from flash */
+#define ML_FC_F32_WEIGHTS_F32   (32u)
+#define ML_FC_F32_WEIGHTS_F16   (16u)
+
+/* Fused activations */
+#define ML_FC_F32_ACT_NONE      (0u)
+#define ML_FC_F32_ACT_RELU      (1u)
+#define ML_FC_F32_ACT_RELU6     (2u)
+
+/* Outputs computed per pass over the input: each input is loaded once for
+ * this many rows, and the rows give independent accumulators that hide the
+ * latency of the multiply-accumulate instructions. */
+#define ML_FC_F32_ROWS_PER_PASS (4u)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Float fully connected layer, weights stored row by row (rows x cols) as
+ * float or as uint16_t IEEE half, bias and outputs in float */
+typedef struct
+{
+    uint16_t        rows;           /* Outputs */
+    uint16_t        cols;           /* Inputs */
+    uint16_t        weight_bits;    /* ML_FC_F32_WEIGHTS_* */
+    uint16_t        activation;     /* ML_FC_F32_ACT_* */
+    const void      *weights;
+    const float     *bias;
+} ml_fc_f32_layer_t;
+
+/* Stack of fully connected layers, run one after the other, followed by a
+ * softmax if softmax_beta is not 0 */
+typedef struct
+{
+    uint32_t                num_of_layers;
+    const ml_fc_f32_layer_t *layers;
+    uint32_t                max_width;      /* Largest layer input or output */
+    uint32_t                weight_bytes;   /* Weights and bias */
+    float                   softmax_beta;
+} ml_fc_f32_model_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void ml_fc_f32(const ml_fc_f32_layer_t *layer, const float *input, float *output);
+void ml_softmax_f32(const float *input, float *output, uint32_t size, float beta);
+uint32_t ml_fc_f32_scratch_size(const ml_fc_f32_model_t *model);
+const float *ml_fc_f32_run(const ml_fc_f32_model_t *model, const float *input,
+                           void *scratch);
+
+#endif /* ML_FC_F32_H */
+
+/* [] END OF FILE */
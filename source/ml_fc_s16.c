@@ -0,0 +1,105 @@
+/******************************************************************************
+* File Name:   ml_fc_s16.c
+*
+* Description: This file contains a fully connected kernel with int16
+*              activations, int8 weights and int64 bias.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_fc_s16.h"
+
+#include <stddef.h>
+
+/*******************************************************************************
+* Function Name: ml_fc_s16_requantize
+********************************************************************************
+* Summary:
+*   Scale a 64-bit accumulator by a Q15 multiplier and shift, rounded half
+*   up, with the same results as TFLM and CMSIS-NN.
+*
+* Parameters:
+*   acc: accumulator
+*   multiplier: Q15 multiplier
+*   shift: power of two exponent, below 8
+*
+* Return:
+*   int32_t: scaled value.
+*******************************************************************************/
+static inline int32_t ml_fc_s16_requantize(int64_t acc, int32_t multiplier, int32_t shift)
+{
+    int32_t total_shift = 15 - shift;
+
+    return (int32_t) (((acc * multiplier) + (1LL << (total_shift - 1))) >> total_shift);
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_s16
+********************************************************************************
+* Summary:
+*   Run a fully connected layer with int16 activations and int8 weights. The
+*   products are accumulated in 64 bits, which holds any number of inputs.
+*
+* Parameters:
+*   layer: layer weights and parameters
+*   input: layer->cols inputs
+*   output: layer->rows outputs
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_fc_s16(const ml_fc_s16_layer_t *layer, const int16_t *input, int16_t *output)
+{
+    const int8_t *row = layer->weights;
+
+    for (uint32_t r = 0; r < layer->rows; r++)
+    {
+        int64_t acc = (layer->bias != NULL) ? layer->bias[r] : 0;
+        int32_t out;
+
+        for (uint32_t c = 0; c < layer->cols; c++)
+        {
+            acc += (int32_t) input[c] * row[c];
+        }
+        row += layer->cols;
+
+        out = ml_fc_s16_requantize(acc, layer->multiplier, layer->shift);
+        out = (out < layer->act_min) ? layer->act_min : out;
+        out = (out > layer->act_max) ? layer->act_max : out;
+        output[r] = (int16_t) out;
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,74 @@
+/******************************************************************************
+* File Name:   ml_fc_s16.h
+*
+* Description: This file contains the data types and function prototypes
+*   used in ml_fc_s16.c to run a fully connected layer with int16
+*   activations and int8 weights.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_FC_S16_H
+#define ML_FC_S16_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Fully connected layer with int16 activations (zero point 0), int8 weights
+ * (zero point 0) stored row by row (rows x cols), and int64 bias. The Q31
+ * multiplier of the layer is rounded to Q15 by the generator, as TFLM and
+ * CMSIS-NN do at run time for 64-bit accumulators. */
+typedef struct
+{
+    uint16_t        rows;           /* Outputs */
+    uint16_t        cols;           /* Inputs */
+    const int8_t    *weights;
+    const int64_t   *bias;
+    int32_t         multiplier;     /* Q15 */
+    int32_t         shift;
+    int32_t         act_min;
+    int32_t         act_max;
+} ml_fc_s16_layer_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void ml_fc_s16(const ml_fc_s16_layer_t *layer, const int16_t *input, int16_t *output);
+
+#endif /* ML_FC_S16_H */
+
+/* [] END OF FILE */
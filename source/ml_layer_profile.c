@@ -0,0 +1,175 @@
+/******************************************************************************
+* File Name:   ml_layer_profile.c
+*
+* Description: This file contains the cycles of each node of the tflm_less
+*              model, averaged over the inferences.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "cy_pdl.h"
+
+#include "ml_layer_profile.h"
+
+#include <stdio.h>
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Cycles of the nodes, by node index */
+static ml_layer_profile_node_t layer_nodes[ML_LAYER_PROFILE_MAX_NODES];
+static uint32_t layer_node_count;
+static uint32_t layer_dropped;
+
+/* Counter value when the invoke of the current node began */
+static uint32_t layer_start;
+
+/*******************************************************************************
+* Function Name: ml_layer_profile_init
+********************************************************************************
+* Summary:
+*   Enable the DWT cycle counter and clear the cycles of all the nodes. Call it
+*   after the model initialization, before the first inference.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_layer_profile_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint32_t i = 0; i < ML_LAYER_PROFILE_MAX_NODES; i++)
+    {
+        layer_nodes[i].calls = 0u;
+        layer_nodes[i].cycles = 0u;
+    }
+    layer_node_count = 0u;
+    layer_dropped = 0u;
+}
+
+/*******************************************************************************
+* Function Name: ml_layer_profile_begin
+********************************************************************************
+* Summary:
+*   Begin the invoke of a node.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_layer_profile_begin(void)
+{
+    layer_start = DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: ml_layer_profile_end
+********************************************************************************
+* Summary:
+*   End the invoke of a node and add its cycles to the node.
+*
+* Parameters:
+*   node: index of the node in the model
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_layer_profile_end(uint32_t node)
+{
+    uint32_t cycles = DWT->CYCCNT - layer_start;
+
+    if (node >= ML_LAYER_PROFILE_MAX_NODES)
+    {
+        layer_dropped++;
+        return;
+    }
+
+    layer_nodes[node].calls++;
+    layer_nodes[node].cycles += cycles;
+    if (node >= layer_node_count)
+    {
+        layer_node_count = node + 1u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_layer_profile_log
+********************************************************************************
+* Summary:
+*   Print the cycles of each node, one CSV line per node, with the average per
+*   inference and the share of all the nodes. scripts/ml_hot_tensors_gen.py
+*   ranks the nodes with it.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_layer_profile_log(void)
+{
+    uint64_t total = 0u;
+
+    for (uint32_t i = 0; i < layer_node_count; i++)
+    {
+        total += layer_nodes[i].cycles;
+    }
+
+    printf("\r\nLayer breakdown:\r\n");
+    printf("node,calls,avg_cycles,percent\r\n");
+    for (uint32_t i = 0; i < layer_node_count; i++)
+    {
+        const ml_layer_profile_node_t *node = &layer_nodes[i];
+        uint32_t average = (node->calls == 0u) ? 0u : (uint32_t) (node->cycles / node->calls);
+        float percent = (total == 0u) ? 0.0f : ((float) node->cycles * 100.0f / (float) total);
+
+        printf("%lu,%lu,%lu,%3.1f\r\n", (unsigned long) i, (unsigned long) node->calls,
+               (unsigned long) average, percent);
+    }
+
+    if (layer_dropped != 0u)
+    {
+        printf("WARNING: %lu node invokes not recorded, over ML_LAYER_PROFILE_MAX_NODES\r\n",
+               (unsigned long) layer_dropped);
+    }
+}
+
+/* [] END OF FILE */
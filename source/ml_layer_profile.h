@@ -0,0 +1,85 @@
+/******************************************************************************
+* File Name:   ml_layer_profile.h
+*
+* Description: This file contains the data types and function prototypes used
+*   in ml_layer_profile.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_LAYER_PROFILE_H
+#define ML_LAYER_PROFILE_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Largest number of nodes recorded, the next ones are counted as dropped */
+#ifndef ML_LAYER_PROFILE_MAX_NODES
+#define ML_LAYER_PROFILE_MAX_NODES  (64u)
+#endif
+
+/* Node markers around the invoke of each node, removed from the build without
+ * ML_LAYER_PROFILE */
+#ifdef ML_LAYER_PROFILE
+#define ML_LAYER_PROFILE_BEGIN()        ml_layer_profile_begin()
+#define ML_LAYER_PROFILE_END(node)      ml_layer_profile_end(node)
+#else
+#define ML_LAYER_PROFILE_BEGIN()
+#define ML_LAYER_PROFILE_END(node)
+#endif /* ML_LAYER_PROFILE */
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Cycles of one node, summed over the inferences */
+typedef struct
+{
+    uint32_t    calls;
+    uint64_t    cycles;
+} ml_layer_profile_node_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void ml_layer_profile_init(void);
+void ml_layer_profile_begin(void);
+void ml_layer_profile_end(uint32_t node);
+void ml_layer_profile_log(void);
+
+#endif /* ML_LAYER_PROFILE_H */
+
+/* [] END OF FILE */
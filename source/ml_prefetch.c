@@ -0,0 +1,341 @@
+/******************************************************************************
+* File Name:   ml_prefetch.c
+*
+* Description: This file contains the implementation of a DMA-driven
+*              ping-pong prefetcher for the local regression samples.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_prefetch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ML_PREFETCH_HOST_SIM)
+#include <time.h>
+#else
+#include "elapsed_timer.h"
+#endif /* ML_PREFETCH_HOST_SIM */
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define WORD_SIZE           (4u)
+#define WORD_BITS           (32u)
+#define BYTE_BITS           (8u)
+
+#if defined(ML_PREFETCH_HOST_SIM)
+/*******************************************************************************
+* Function Name: ml_prefetch_get_tick
+********************************************************************************
+* Summary:
+*   Return a monotonic time stamp in nanoseconds (host simulation).
+*
+* Parameters:
+*   void
+*
+* Return:
+*   uint64_t: time stamp.
+*******************************************************************************/
+static uint64_t ml_prefetch_get_tick(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000000000u) + (uint64_t) now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: ml_prefetch_copy_thread
+********************************************************************************
+* Summary:
+*   Copy thread standing in for the DMA in the host simulation.
+*
+* Parameters:
+*   arg: prefetcher
+*
+* Return:
+*   void *: unused.
+*******************************************************************************/
+static void *ml_prefetch_copy_thread(void *arg)
+{
+    ml_prefetch_t *pf = (ml_prefetch_t *) arg;
+
+    pthread_mutex_lock(&pf->lock);
+    while (!pf->exit)
+    {
+        if (pf->src == NULL)
+        {
+            pthread_cond_wait(&pf->cond, &pf->lock);
+            continue;
+        }
+
+        pthread_mutex_unlock(&pf->lock);
+        memcpy(pf->buffer[pf->slot], pf->src, pf->size);
+        pthread_mutex_lock(&pf->lock);
+
+        pf->src = NULL;
+        pf->busy = false;
+        pthread_cond_broadcast(&pf->cond);
+    }
+    pthread_mutex_unlock(&pf->lock);
+
+    return NULL;
+}
+#else
+/*******************************************************************************
+* Function Name: ml_prefetch_get_tick
+********************************************************************************
+* Summary:
+*   Return the number of CPU cycles from the elapsed timer.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   uint64_t: time stamp.
+*******************************************************************************/
+static uint64_t ml_prefetch_get_tick(void)
+{
+    uint64_t tick;
+
+    elapsed_timer_get_tick(&tick);
+    return tick;
+}
+#endif /* ML_PREFETCH_HOST_SIM */
+
+/*******************************************************************************
+* Function Name: ml_prefetch_init
+********************************************************************************
+* Summary:
+*   Allocate the two SRAM buffers and reserve the copy engine.
+*
+* Parameters:
+*   pf: prefetcher
+*   size: size in bytes of each sample
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+cy_rslt_t ml_prefetch_init(ml_prefetch_t *pf, uint32_t size)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    memset(pf, 0, sizeof(*pf));
+    pf->size = size;
+
+    /* Word aligned buffers, so the DMA can move 32-bit words */
+    pf->buffer[0] = (uint8_t *) malloc(2u * (((size + WORD_SIZE - 1u) / WORD_SIZE) * WORD_SIZE));
+    if (pf->buffer[0] == NULL)
+    {
+        return MTB_ML_RESULT_ALLOC_ERR;
+    }
+    pf->buffer[1] = pf->buffer[0] + (((size + WORD_SIZE - 1u) / WORD_SIZE) * WORD_SIZE);
+
+#if defined(ML_PREFETCH_HOST_SIM)
+    pthread_mutex_init(&pf->lock, NULL);
+    pthread_cond_init(&pf->cond, NULL);
+    if (0 != pthread_create(&pf->thread, NULL, ml_prefetch_copy_thread, pf))
+    {
+        result = MTB_ML_RESULT_ALLOC_ERR;
+    }
+#else
+    result = cyhal_dma_init(&pf->dma, CYHAL_DMA_PRIORITY_DEFAULT, CYHAL_DMA_DIRECTION_MEM2MEM);
+#endif /* ML_PREFETCH_HOST_SIM */
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        free(pf->buffer[0]);
+        pf->buffer[0] = NULL;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ml_prefetch_start
+********************************************************************************
+* Summary:
+*   Start copying a sample into the buffer not handed out by the last call to
+*   ml_prefetch_wait(). Only one copy can be in flight.
+*
+* Parameters:
+*   pf: prefetcher
+*   src: sample to copy
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+cy_rslt_t ml_prefetch_start(ml_prefetch_t *pf, const void *src)
+{
+    if (pf->pending)
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    pf->slot ^= 1u;
+    pf->pending = true;
+
+#if defined(ML_PREFETCH_HOST_SIM)
+    pthread_mutex_lock(&pf->lock);
+    pf->src = src;
+    pf->busy = true;
+    pthread_cond_broadcast(&pf->cond);
+    pthread_mutex_unlock(&pf->lock);
+#else
+    cyhal_dma_cfg_t dma_cfg =
+    {
+        .src_addr       = (uint32_t) (uintptr_t) src,
+        .src_increment  = 1,
+        .dst_addr       = (uint32_t) (uintptr_t) pf->buffer[pf->slot],
+        .dst_increment  = 1,
+        .transfer_width = WORD_BITS,
+        .length         = pf->size / WORD_SIZE,
+        .burst_size     = 0,
+        .action         = CYHAL_DMA_TRANSFER_FULL,
+    };
+
+    /* Fall back to byte transfers for unaligned samples */
+    if (((((uint32_t) (uintptr_t) src) | pf->size) & (WORD_SIZE - 1u)) != 0u)
+    {
+        dma_cfg.transfer_width = BYTE_BITS;
+        dma_cfg.length         = pf->size;
+    }
+
+    if ((CY_RSLT_SUCCESS != cyhal_dma_configure(&pf->dma, &dma_cfg)) ||
+        (CY_RSLT_SUCCESS != cyhal_dma_start_transfer(&pf->dma)))
+    {
+        /* Copy synchronously if the DMA cannot take the transfer. Nothing
+         * overlaps the inference then, so the copy is counted apart. */
+        memcpy(pf->buffer[pf->slot], src, pf->size);
+        pf->fallback_count++;
+    }
+#endif /* ML_PREFETCH_HOST_SIM */
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_prefetch_wait
+********************************************************************************
+* Summary:
+*   Wait for the copy in flight and return its buffer. If the copy is not done
+*   yet, the prefetch lost the race against the inference and the cycles spent
+*   waiting are accounted as stall cycles.
+*
+* Parameters:
+*   pf: prefetcher
+*
+* Return:
+*   const void *: buffer holding the sample, or NULL if no copy was started.
+*******************************************************************************/
+const void *ml_prefetch_wait(ml_prefetch_t *pf)
+{
+    uint64_t start;
+    bool busy;
+
+    if (!pf->pending)
+    {
+        return NULL;
+    }
+
+#if defined(ML_PREFETCH_HOST_SIM)
+    pthread_mutex_lock(&pf->lock);
+    busy = pf->busy;
+    start = ml_prefetch_get_tick();
+    while (pf->busy)
+    {
+        pthread_cond_wait(&pf->cond, &pf->lock);
+    }
+    pthread_mutex_unlock(&pf->lock);
+#else
+    busy = cyhal_dma_is_busy(&pf->dma);
+    start = ml_prefetch_get_tick();
+    while (cyhal_dma_is_busy(&pf->dma))
+    {
+    }
+#endif /* ML_PREFETCH_HOST_SIM */
+
+    if (busy)
+    {
+        pf->stall_count++;
+        pf->stall_cycles += ml_prefetch_get_tick() - start;
+    }
+
+    pf->pending = false;
+
+    return pf->buffer[pf->slot];
+}
+
+/*******************************************************************************
+* Function Name: ml_prefetch_free
+********************************************************************************
+* Summary:
+*   Wait for any copy in flight and release the prefetcher resources.
+*
+* Parameters:
+*   pf: prefetcher
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_prefetch_free(ml_prefetch_t *pf)
+{
+    if (pf->buffer[0] == NULL)
+    {
+        return;
+    }
+
+    (void) ml_prefetch_wait(pf);
+
+#if defined(ML_PREFETCH_HOST_SIM)
+    pthread_mutex_lock(&pf->lock);
+    pf->exit = true;
+    pthread_cond_broadcast(&pf->cond);
+    pthread_mutex_unlock(&pf->lock);
+    pthread_join(pf->thread, NULL);
+    pthread_cond_destroy(&pf->cond);
+    pthread_mutex_destroy(&pf->lock);
+#else
+    cyhal_dma_free(&pf->dma);
+#endif /* ML_PREFETCH_HOST_SIM */
+
+    free(pf->buffer[0]);
+    pf->buffer[0] = NULL;
+    pf->buffer[1] = NULL;
+}
+
+/* [] END OF FILE */
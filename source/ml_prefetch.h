@@ -0,0 +1,105 @@
+/******************************************************************************
+* File Name:   ml_prefetch.h
+*
+* Description: This file contains the data types and function prototypes used
+*   in ml_prefetch.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_PREFETCH_H
+#define ML_PREFETCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(ML_PREFETCH_HOST_SIM)
+#include <pthread.h>
+#else
+#include "cyhal.h"
+#include "mtb_ml.h"
+#endif /* ML_PREFETCH_HOST_SIM */
+
+#if defined(ML_PREFETCH_HOST_SIM)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Result codes of the host simulation, which builds without the PDL and the
+ * ML middleware */
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS             (0u)
+#define MTB_ML_RESULT_BAD_ARG       (1u)
+#define MTB_ML_RESULT_ALLOC_ERR     (2u)
+#endif /* ML_PREFETCH_HOST_SIM */
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Ping-pong prefetcher: while the sample in one buffer is used, the next one
+ * is copied into the other buffer by DMA (or by a copy thread when simulated
+ * on the host). */
+typedef struct
+{
+    uint8_t         *buffer[2];
+    uint32_t        size;
+    uint32_t        slot;           /* Slot of the copy in flight */
+    bool            pending;
+    uint32_t        stall_count;    /* Waits that found the copy in flight */
+    uint64_t        stall_cycles;
+    uint32_t        fallback_count; /* Copies done synchronously, the DMA refused them */
+#if defined(ML_PREFETCH_HOST_SIM)
+    pthread_t       thread;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    const void      *src;
+    bool            busy;
+    bool            exit;
+#else
+    cyhal_dma_t     dma;
+#endif /* ML_PREFETCH_HOST_SIM */
+} ml_prefetch_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t ml_prefetch_init(ml_prefetch_t *pf, uint32_t size);
+cy_rslt_t ml_prefetch_start(ml_prefetch_t *pf, const void *src);
+const void *ml_prefetch_wait(ml_prefetch_t *pf);
+void ml_prefetch_free(ml_prefetch_t *pf);
+
+#endif /* ML_PREFETCH_H */
+
+/* [] END OF FILE */
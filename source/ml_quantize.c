@@ -0,0 +1,202 @@
+/******************************************************************************
+* File Name:   ml_quantize.c
+*
+* Description: This file contains the implementation of the quantization of
+*              float regression data into the input type of the model.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_quantize.h"
+
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cy_pdl.h"
+#define ML_QUANTIZE_USE_DSP
+#endif
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define S8_MIN      (-128)
+#define S8_MAX      (127)
+#define S16_MIN     (-32768)
+#define S16_MAX     (32767)
+/* 2^31, the first float above the int32 range */
+#define S32_LIMIT   (2147483648.0f)
+
+/*******************************************************************************
+* Function Name: ml_quantize_round
+********************************************************************************
+* Summary:
+*   Round to the nearest integer, ties away from zero (same as TFLM).
+*   The result saturates to the int32 range before the conversion, which is
+*   undefined for values out of range. A NaN gives INT32_MAX.
+*
+* Parameters:
+*   value: value to round
+*
+* Return:
+*   int32_t: rounded value.
+*******************************************************************************/
+static inline int32_t ml_quantize_round(float value)
+{
+    value = (value >= 0.0f) ? (value + 0.5f) : (value - 0.5f);
+    if (!(value < S32_LIMIT))
+    {
+        return INT32_MAX;
+    }
+    if (value < -S32_LIMIT)
+    {
+        return INT32_MIN;
+    }
+    return (int32_t) value;
+}
+
+/*******************************************************************************
+* Function Name: ml_quantize_clamp
+********************************************************************************
+* Summary:
+*   Saturate a value to the given range.
+*
+* Parameters:
+*   value: value to saturate, 64 bits wide so that adding the zero point to
+*          a rounded value cannot overflow
+*   min: lower bound
+*   max: upper bound
+*
+* Return:
+*   int32_t: saturated value.
+*******************************************************************************/
+static inline int32_t ml_quantize_clamp(int64_t value, int32_t min, int32_t max)
+{
+    return (value < min) ? min : ((value > max) ? max : (int32_t) value);
+}
+
+/*******************************************************************************
+* Function Name: ml_quantize_s8
+********************************************************************************
+* Summary:
+*   Quantize float values to int8: q = round(x / scale) + zero_point.
+*   On cores with the DSP extension, the zero point is added with a
+*   saturating add, and four values are saturated and packed into a single
+*   word store per iteration.
+*
+* Parameters:
+*   src: float values
+*   dst: quantized values
+*   size: number of values
+*   scale: quantization scale
+*   zero_point: quantization zero point
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_quantize_s8(const float *src, int8_t *dst, uint32_t size,
+                    float scale, int32_t zero_point)
+{
+    const float inv_scale = 1.0f / scale;
+
+#ifdef ML_QUANTIZE_USE_DSP
+    for (; size >= 4u; size -= 4u)
+    {
+        int32_t q0 = __SSAT(__QADD(ml_quantize_round(src[0] * inv_scale), zero_point), 8);
+        int32_t q1 = __SSAT(__QADD(ml_quantize_round(src[1] * inv_scale), zero_point), 8);
+        int32_t q2 = __SSAT(__QADD(ml_quantize_round(src[2] * inv_scale), zero_point), 8);
+        int32_t q3 = __SSAT(__QADD(ml_quantize_round(src[3] * inv_scale), zero_point), 8);
+        uint32_t word = __PKHBT((q0 & 0xFF) | ((q1 & 0xFF) << 8),
+                                (q2 & 0xFF) | ((q3 & 0xFF) << 8), 16);
+
+        memcpy(dst, &word, sizeof(word));
+        src += 4;
+        dst += 4;
+    }
+#endif /* ML_QUANTIZE_USE_DSP */
+
+    for (; size > 0u; size--)
+    {
+        int64_t q = (int64_t) ml_quantize_round(*src++ * inv_scale) + zero_point;
+
+        *dst++ = (int8_t) ml_quantize_clamp(q, S8_MIN, S8_MAX);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_quantize_s16
+********************************************************************************
+* Summary:
+*   Quantize float values to int16: q = round(x / scale) + zero_point.
+*   On cores with the DSP extension, the zero point is added with a
+*   saturating add, and two values are saturated and packed into a single
+*   word store per iteration.
+*
+* Parameters:
+*   src: float values
+*   dst: quantized values
+*   size: number of values
+*   scale: quantization scale
+*   zero_point: quantization zero point
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_quantize_s16(const float *src, int16_t *dst, uint32_t size,
+                     float scale, int32_t zero_point)
+{
+    const float inv_scale = 1.0f / scale;
+
+#ifdef ML_QUANTIZE_USE_DSP
+    for (; size >= 2u; size -= 2u)
+    {
+        int32_t q0 = __SSAT(__QADD(ml_quantize_round(src[0] * inv_scale), zero_point), 16);
+        int32_t q1 = __SSAT(__QADD(ml_quantize_round(src[1] * inv_scale), zero_point), 16);
+        uint32_t word = __PKHBT((uint32_t) q0 & 0xFFFFu, (uint32_t) q1 & 0xFFFFu, 16);
+
+        memcpy(dst, &word, sizeof(word));
+        src += 2;
+        dst += 2;
+    }
+#endif /* ML_QUANTIZE_USE_DSP */
+
+    for (; size > 0u; size--)
+    {
+        int64_t q = (int64_t) ml_quantize_round(*src++ * inv_scale) + zero_point;
+
+        *dst++ = (int16_t) ml_quantize_clamp(q, S16_MIN, S16_MAX);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,525 @@
+/******************************************************************************
+* File Name:   ml_regression.c
+*
+* Description: This file contains the implementation of the access to the
+*              local regression data, including the v3 regression container.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_regression.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define ML_REG_ALIGN_MASK   (3u)
+
+/*******************************************************************************
+* Function Name: ml_regression_decode_rle
+********************************************************************************
+* Summary:
+*   Decode one sample encoded with the RLE codec. Regression inputs such as
+*   images are dominated by a background value, which is stored as runs.
+*
+* Parameters:
+*   src: pointer to the encoded sample
+*   src_end: end of the encoded chunk, used to bound the decoding
+*   dst: buffer for the decoded sample
+*   elem_size: size in bytes of each element
+*   num_elems: number of elements of the sample
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+static cy_rslt_t ml_regression_decode_rle(const uint8_t *src, const uint8_t *src_end,
+                                          uint8_t *dst, uint32_t elem_size,
+                                          uint32_t num_elems)
+{
+    const uint8_t *fill = src;
+    uint8_t *dst_end = dst + (num_elems * elem_size);
+    uint32_t run_bytes;
+
+    /* The fill value must be in the chunk before it is read */
+    if ((src + elem_size) > src_end)
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+    src += elem_size;
+
+    while (dst < dst_end)
+    {
+        if (src >= src_end)
+        {
+            return MTB_ML_RESULT_BAD_ARG;
+        }
+
+        if ((*src & ML_REG_RLE_FILL_FLAG) != 0u)
+        {
+            run_bytes = ((uint32_t) (*src++ & ML_REG_RLE_COUNT_MASK) + 1u) * elem_size;
+            if ((dst + run_bytes) > dst_end)
+            {
+                return MTB_ML_RESULT_BAD_ARG;
+            }
+
+            if (elem_size == 1u)
+            {
+                memset(dst, *fill, run_bytes);
+                dst += run_bytes;
+            }
+            else
+            {
+                for (; run_bytes > 0u; run_bytes -= elem_size)
+                {
+                    memcpy(dst, fill, elem_size);
+                    dst += elem_size;
+                }
+            }
+        }
+        else
+        {
+            run_bytes = ((uint32_t) *src++ + 1u) * elem_size;
+            if (((dst + run_bytes) > dst_end) || ((src + run_bytes) > src_end))
+            {
+                return MTB_ML_RESULT_BAD_ARG;
+            }
+
+            memcpy(dst, src, run_bytes);
+            src += run_bytes;
+            dst += run_bytes;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_open_legacy
+********************************************************************************
+* Summary:
+*   Map the flat regression array generated by the ML configurator to a single
+*   uncompressed chunk without labels.
+*
+* Parameters:
+*   reg: regression data handle
+*   blob: pointer to the regression data
+*   elem_size: size in bytes of each element of the samples
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+static cy_rslt_t ml_regression_open_legacy(ml_regression_t *reg,
+                                           const uint8_t *blob,
+                                           uint32_t elem_size)
+{
+    const mtb_ml_x_file_header_t *x_file_header = (const mtb_ml_x_file_header_t *) blob;
+
+    /* The single chunk counts its samples on 16 bits, and the data size of
+     * the chunk must fit in 32 bits */
+    if ((x_file_header->num_of_samples < 0) || (x_file_header->input_size <= 0) ||
+        (x_file_header->num_of_samples > (int32_t) UINT16_MAX) ||
+        (((uint64_t) x_file_header->num_of_samples * (uint64_t) x_file_header->input_size * elem_size) >
+         (uint64_t) UINT32_MAX))
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    reg->num_of_samples    = (uint32_t) x_file_header->num_of_samples;
+    reg->input_size        = (uint32_t) x_file_header->input_size;
+    reg->recurrent_ts_size = x_file_header->recurrent_ts_size;
+    reg->data_type         = (uint32_t) x_file_header->version;
+    reg->elem_size         = elem_size;
+    reg->num_of_chunks     = 1;
+    reg->samples_per_chunk = reg->num_of_samples;
+    reg->sample_index      = NULL;
+    reg->labels            = NULL;
+
+    reg->legacy_chunk.data_offset    = sizeof(*x_file_header);
+    reg->legacy_chunk.data_size      = reg->num_of_samples * reg->input_size * elem_size;
+    reg->legacy_chunk.first_sample   = 0;
+    reg->legacy_chunk.num_of_samples = (uint16_t) reg->num_of_samples;
+    reg->legacy_chunk.codec          = ML_REG_CODEC_NONE;
+    reg->chunks                      = &reg->legacy_chunk;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_check_v3
+********************************************************************************
+* Summary:
+*   Check that the sections of a v3 container lie within its total size, that
+*   the chunks cover all the samples, and that each sample lies within its
+*   chunk, so a corrupt or truncated header cannot make the accesses leave
+*   the container.
+*
+* Parameters:
+*   header: header of the v3 container
+*   base: start of the container
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+static cy_rslt_t ml_regression_check_v3(const ml_reg_v3_header_t *header, const uint8_t *base)
+{
+    const uint64_t total_size = header->total_size;
+    const uint64_t sample_bytes = (uint64_t) header->input_size * header->elem_size;
+    const ml_reg_v3_chunk_t *chunks = (const ml_reg_v3_chunk_t *) (base + header->chunk_table_offset);
+    const uint32_t *sample_index = (const uint32_t *) (base + header->sample_index_offset);
+
+    if ((total_size < sizeof(*header)) ||
+        (((uint64_t) header->num_of_chunks * header->samples_per_chunk) < header->num_of_samples) ||
+        ((header->chunk_table_offset + ((uint64_t) header->num_of_chunks * sizeof(ml_reg_v3_chunk_t))) >
+         total_size) ||
+        ((header->sample_index_offset + ((uint64_t) header->num_of_samples * sizeof(uint32_t))) > total_size) ||
+        ((header->label_offset != 0u) &&
+         ((header->label_offset + ((uint64_t) header->num_of_samples * sizeof(int16_t))) > total_size)))
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    for (uint32_t c = 0; c < header->num_of_chunks; c++)
+    {
+        if (((uint64_t) chunks[c].data_offset + chunks[c].data_size) > total_size)
+        {
+            return MTB_ML_RESULT_BAD_ARG;
+        }
+    }
+
+    /* Raw samples are returned in place, encoded ones are decoded up to the
+     * end of their chunk */
+    for (uint32_t idx = 0; idx < header->num_of_samples; idx++)
+    {
+        const ml_reg_v3_chunk_t *chunk = &chunks[idx / header->samples_per_chunk];
+        uint64_t chunk_end = (uint64_t) chunk->data_offset + chunk->data_size;
+        uint64_t sample_end = (uint64_t) sample_index[idx] +
+                              ((chunk->codec == ML_REG_CODEC_NONE) ? sample_bytes : 0u);
+
+        if ((sample_index[idx] < chunk->data_offset) || (sample_end > chunk_end))
+        {
+            return MTB_ML_RESULT_BAD_ARG;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_open
+********************************************************************************
+* Summary:
+*   Parse the header of the regression data and setup the handle to access its
+*   samples. The data is accessed in place, so it can live in XIP memory.
+*
+* Parameters:
+*   reg: regression data handle
+*   blob: pointer to the regression data (v3 container or legacy array)
+*   elem_size: size in bytes of each element expected by the model
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+cy_rslt_t ml_regression_open(ml_regression_t *reg, const void *blob,
+                             uint32_t elem_size)
+{
+    const uint8_t *base = (const uint8_t *) blob;
+    const ml_reg_v3_header_t *header = (const ml_reg_v3_header_t *) blob;
+
+    if ((reg == NULL) || (base == NULL) || ((((uintptr_t) base) & ML_REG_ALIGN_MASK) != 0u))
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    memset(reg, 0, sizeof(*reg));
+    reg->base = base;
+
+    if (header->magic != ML_REG_V3_MAGIC)
+    {
+        return ml_regression_open_legacy(reg, base, elem_size);
+    }
+
+    if (header->version != ML_REG_V3_VERSION)
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    /* The container must hold the same data type the model was built for */
+    if (header->elem_size != elem_size)
+    {
+        return MTB_ML_RESULT_MISMATCH_DATA_TYPE;
+    }
+
+    if ((header->samples_per_chunk == 0u) ||
+        ((header->chunk_table_offset & ML_REG_ALIGN_MASK) != 0u) ||
+        ((header->sample_index_offset & ML_REG_ALIGN_MASK) != 0u) ||
+        ((header->label_offset & ML_REG_ALIGN_MASK) != 0u) ||
+        (CY_RSLT_SUCCESS != ml_regression_check_v3(header, base)))
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    reg->num_of_samples    = header->num_of_samples;
+    reg->input_size        = header->input_size;
+    reg->recurrent_ts_size = header->recurrent_ts_size;
+    reg->data_type         = header->data_type;
+    reg->elem_size         = header->elem_size;
+    reg->num_of_chunks     = header->num_of_chunks;
+    reg->samples_per_chunk = header->samples_per_chunk;
+    reg->chunks            = (const ml_reg_v3_chunk_t *) (base + header->chunk_table_offset);
+    reg->sample_index      = (const uint32_t *) (base + header->sample_index_offset);
+    reg->labels            = (header->label_offset != 0u) ?
+                             (const int16_t *) (base + header->label_offset) : NULL;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_sample_bytes
+********************************************************************************
+* Summary:
+*   Return the size in bytes of one decoded sample.
+*
+* Parameters:
+*   reg: regression data handle
+*
+* Return:
+*   uint32_t: size of the sample in bytes.
+*******************************************************************************/
+uint32_t ml_regression_sample_bytes(const ml_regression_t *reg)
+{
+    return reg->input_size * reg->elem_size;
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_get_sample
+********************************************************************************
+* Summary:
+*   Return a pointer to the given sample. Samples stored uncompressed are
+*   returned in place without any copy. Otherwise, the sample is decoded into
+*   the scratch buffer.
+*
+* Parameters:
+*   reg: regression data handle
+*   idx: index of the sample
+*   scratch: buffer used to decode compressed samples (can be NULL if the
+*            data is not compressed)
+*   scratch_size: size in bytes of the scratch buffer
+*
+* Return:
+*   const void *: pointer to the sample or NULL on error.
+*******************************************************************************/
+const void *ml_regression_get_sample(const ml_regression_t *reg, uint32_t idx,
+                                     void *scratch, uint32_t scratch_size)
+{
+    const ml_reg_v3_chunk_t *chunk;
+    uint32_t sample_bytes = ml_regression_sample_bytes(reg);
+    uint32_t offset;
+
+    if (idx >= reg->num_of_samples)
+    {
+        return NULL;
+    }
+
+    /* Chunks hold a fixed number of samples, so no scanning is needed */
+    chunk = &reg->chunks[idx / reg->samples_per_chunk];
+
+    if (reg->sample_index != NULL)
+    {
+        offset = reg->sample_index[idx];
+    }
+    else
+    {
+        offset = chunk->data_offset + ((idx - chunk->first_sample) * sample_bytes);
+    }
+
+    switch (chunk->codec)
+    {
+        case ML_REG_CODEC_NONE:
+            return reg->base + offset;
+
+        case ML_REG_CODEC_RLE:
+            if ((scratch == NULL) || (scratch_size < sample_bytes))
+            {
+                return NULL;
+            }
+
+            if (CY_RSLT_SUCCESS != ml_regression_decode_rle(reg->base + offset,
+                                                            reg->base + chunk->data_offset + chunk->data_size,
+                                                            (uint8_t *) scratch, reg->elem_size,
+                                                            reg->input_size))
+            {
+                return NULL;
+            }
+            return scratch;
+
+        default:
+            return NULL;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_is_compressed
+********************************************************************************
+* Summary:
+*   Check if any chunk of the regression data needs to be decoded, in which
+*   case ml_regression_get_sample() requires a scratch buffer.
+*
+* Parameters:
+*   reg: regression data handle
+*
+* Return:
+*   bool: true if the data is compressed.
+*******************************************************************************/
+bool ml_regression_is_compressed(const ml_regression_t *reg)
+{
+    for (uint32_t i = 0; i < reg->num_of_chunks; i++)
+    {
+        if (reg->chunks[i].codec != ML_REG_CODEC_NONE)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_has_labels
+********************************************************************************
+* Summary:
+*   Check if the regression data carries the expected label of each sample.
+*
+* Parameters:
+*   reg: regression data handle
+*
+* Return:
+*   bool: true if labels are available.
+*******************************************************************************/
+bool ml_regression_has_labels(const ml_regression_t *reg)
+{
+    return (reg->labels != NULL);
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_get_label
+********************************************************************************
+* Summary:
+*   Return the expected label (class index) of the given sample.
+*
+* Parameters:
+*   reg: regression data handle
+*   idx: index of the sample
+*
+* Return:
+*   int: label of the sample or ML_REG_NO_LABEL.
+*******************************************************************************/
+int ml_regression_get_label(const ml_regression_t *reg, uint32_t idx)
+{
+    if ((reg->labels == NULL) || (idx >= reg->num_of_samples))
+    {
+        return ML_REG_NO_LABEL;
+    }
+
+    return (int) reg->labels[idx];
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_iter_init
+********************************************************************************
+* Summary:
+*   Setup an iterator over a subset of the regression samples. The subset is
+*   clipped to the number of samples available.
+*
+* Parameters:
+*   iter: iterator to setup
+*   reg: regression data handle
+*   first: index of the first sample
+*   stride: distance between two consecutive samples (0 is handled as 1)
+*   count: maximum number of samples to visit (0 means all)
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_regression_iter_init(ml_regression_iter_t *iter,
+                             const ml_regression_t *reg,
+                             uint32_t first, uint32_t stride, uint32_t count)
+{
+    uint32_t available = 0;
+
+    if (stride == 0u)
+    {
+        stride = 1u;
+    }
+
+    if (first < reg->num_of_samples)
+    {
+        available = ((reg->num_of_samples - first - 1u) / stride) + 1u;
+    }
+
+    iter->reg       = reg;
+    iter->next      = first;
+    iter->stride    = stride;
+    iter->remaining = ((count == 0u) || (count > available)) ? available : count;
+}
+
+/*******************************************************************************
+* Function Name: ml_regression_iter_next
+********************************************************************************
+* Summary:
+*   Get the index of the next sample of the subset.
+*
+* Parameters:
+*   iter: iterator
+*   idx: index of the next sample
+*
+* Return:
+*   bool: false when the subset is exhausted.
+*******************************************************************************/
+bool ml_regression_iter_next(ml_regression_iter_t *iter, uint32_t *idx)
+{
+    if (iter->remaining == 0u)
+    {
+        return false;
+    }
+
+    *idx = iter->next;
+    iter->next += iter->stride;
+    iter->remaining--;
+
+    return true;
+}
+
+/* [] END OF FILE */
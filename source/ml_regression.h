@@ -0,0 +1,155 @@
+/******************************************************************************
+* File Name:   ml_regression.h
+*
+* Description: This file contains the data types, function prototypes and
+*   constants used in ml_regression.c to access the local regression data.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_REGRESSION_H
+#define ML_REGRESSION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mtb_ml.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* "MLR3" read as a little-endian word */
+#define ML_REG_V3_MAGIC         (0x33524C4Du)
+#define ML_REG_V3_VERSION       (3u)
+
+/* Data type identifiers, same values used by the legacy x data header */
+#define ML_REG_TYPE_FLOAT32     (1u)
+#define ML_REG_TYPE_INT8        (2u)
+#define ML_REG_TYPE_INT16       (3u)
+
+/* Chunk codecs */
+#define ML_REG_CODEC_NONE       (0u)
+#define ML_REG_CODEC_RLE        (1u)
+
+/* RLE codec tokens. Each encoded sample starts with its fill value (one
+ * element), followed by tokens until all the elements are decoded:
+ * - 0x00-0x7F: (token + 1) literal elements follow
+ * - 0x80-0xFF: (token - 0x7F) elements equal to the fill value */
+#define ML_REG_RLE_FILL_FLAG    (0x80u)
+#define ML_REG_RLE_COUNT_MASK   (0x7Fu)
+
+/* Returned by ml_regression_get_label() when the data has no labels */
+#define ML_REG_NO_LABEL         (-1)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Header of the v3 regression container. All offsets are in bytes from the
+ * start of the container and every section is 4-byte aligned. */
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t data_type;
+    uint32_t num_of_samples;
+    uint32_t input_size;            /* Elements per sample */
+    int32_t  recurrent_ts_size;
+    uint16_t elem_size;             /* Bytes per element */
+    uint16_t samples_per_chunk;
+    uint32_t num_of_chunks;
+    uint32_t chunk_table_offset;    /* ml_reg_v3_chunk_t[num_of_chunks] */
+    uint32_t sample_index_offset;   /* uint32_t[num_of_samples] */
+    uint32_t label_offset;          /* int16_t[num_of_samples], 0 if none */
+    uint32_t total_size;
+} ml_reg_v3_header_t;
+
+/* Entry of the chunk table */
+typedef struct
+{
+    uint32_t data_offset;
+    uint32_t data_size;
+    uint32_t first_sample;
+    uint16_t num_of_samples;
+    uint16_t codec;
+} ml_reg_v3_chunk_t;
+
+/* Regression data handle. Works for both the v3 container and the flat array
+ * generated by the ML configurator, which is seen as a single raw chunk. */
+typedef struct
+{
+    const uint8_t           *base;
+    const ml_reg_v3_chunk_t *chunks;
+    const uint32_t          *sample_index;
+    const int16_t           *labels;
+    ml_reg_v3_chunk_t       legacy_chunk;
+    uint32_t                num_of_samples;
+    uint32_t                num_of_chunks;
+    uint32_t                samples_per_chunk;
+    uint32_t                input_size;
+    uint32_t                elem_size;
+    uint32_t                data_type;
+    int32_t                 recurrent_ts_size;
+} ml_regression_t;
+
+/* Iterator over a subset of the samples: count samples starting at first,
+ * advancing stride samples at a time. */
+typedef struct
+{
+    const ml_regression_t   *reg;
+    uint32_t                next;
+    uint32_t                stride;
+    uint32_t                remaining;
+} ml_regression_iter_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t ml_regression_open(ml_regression_t *reg, const void *blob,
+                             uint32_t elem_size);
+const void *ml_regression_get_sample(const ml_regression_t *reg, uint32_t idx,
+                                     void *scratch, uint32_t scratch_size);
+int ml_regression_get_label(const ml_regression_t *reg, uint32_t idx);
+bool ml_regression_has_labels(const ml_regression_t *reg);
+bool ml_regression_is_compressed(const ml_regression_t *reg);
+uint32_t ml_regression_sample_bytes(const ml_regression_t *reg);
+
+void ml_regression_iter_init(ml_regression_iter_t *iter,
+                             const ml_regression_t *reg,
+                             uint32_t first, uint32_t stride, uint32_t count);
+bool ml_regression_iter_next(ml_regression_iter_t *iter, uint32_t *idx);
+
+#endif /* ML_REGRESSION_H */
+
+/* [] END OF FILE */
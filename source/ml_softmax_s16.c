@@ -0,0 +1,194 @@
+/******************************************************************************
+* File Name:   ml_softmax_s16.c
+*
+* Description: This file contains an int16 softmax kernel that interpolates
+*              constant exp and reciprocal lookup tables stored in flash.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_softmax_s16.h"
+
+#include <stddef.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define Q31_HALF            (1LL << 30)
+#define Q31_ONE             (1LL << 31)
+#define Q15_MIN             (-32768)
+#define Q15_MAX             (32767)
+
+/* The lookup tables are indexed by the upper 9 bits of a Q0.15 value and
+ * interpolated with the lower 7 bits */
+#define LUT_INDEX_SHIFT     (7)
+#define LUT_OFFSET_MASK     (0x7F)
+#define LUT_CENTER          (256)
+
+/* 1 + x in Q16.15 for x = 0, and the offset that maps [0, 1] on [-1, 1] */
+#define SUM_ONE             (1 << 16)
+#define SUM_CENTER          (1 << 15)
+
+/*******************************************************************************
+* Function Name: ml_softmax_requantize
+********************************************************************************
+* Summary:
+*   Scale a value by a quantized multiplier and shift, with the same rounding
+*   as TFLM (doubling high multiply, then rounding divide by a power of two).
+*
+* Parameters:
+*   value: value to scale
+*   multiplier: Q31 multiplier
+*   shift: power of two exponent
+*
+* Return:
+*   int32_t: scaled value.
+*******************************************************************************/
+static inline int32_t ml_softmax_requantize(int32_t value, int32_t multiplier, int32_t shift)
+{
+    int32_t left = (shift > 0) ? shift : 0;
+    int32_t right = (shift > 0) ? 0 : -shift;
+    int64_t prod = (int64_t) (value * (1 << left)) * multiplier;
+    int32_t high;
+    int32_t mask;
+    int32_t remainder;
+    int32_t threshold;
+
+    prod += ((prod < 0) ? (1 - Q31_HALF) : Q31_HALF);
+    high = (int32_t) (prod / Q31_ONE);
+
+    mask = (1 << right) - 1;
+    remainder = high & mask;
+    threshold = (mask >> 1) + ((high < 0) ? 1 : 0);
+
+    return (high >> right) + ((remainder > threshold) ? 1 : 0);
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_lut
+********************************************************************************
+* Summary:
+*   Read a lookup table at a Q0.15 position, interpolating linearly between
+*   the two nearest entries.
+*
+* Parameters:
+*   lut: lookup table of ML_SOFTMAX_S16_LUT_SIZE entries
+*   value: position, saturated to the int16 range
+*
+* Return:
+*   int32_t: interpolated value.
+*******************************************************************************/
+static inline int32_t ml_softmax_lut(const int16_t *lut, int32_t value)
+{
+    int32_t index;
+    int32_t base;
+    int32_t slope;
+
+    value = (value < Q15_MIN) ? Q15_MIN : value;
+    value = (value > Q15_MAX) ? Q15_MAX : value;
+
+    index = LUT_CENTER + (value >> LUT_INDEX_SHIFT);
+    base = lut[index];
+    slope = lut[index + 1] - base;
+
+    return base + (((slope * (value & LUT_OFFSET_MASK)) + (1 << (LUT_INDEX_SHIFT - 1))) >> LUT_INDEX_SHIFT);
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_s16
+********************************************************************************
+* Summary:
+*   Run an int16 softmax with the exp and reciprocal lookup tables, bit-exact
+*   with the TFLM reference. The exp of each score is staged in the output
+*   buffer, then scaled by the reciprocal of the sum of the row.
+*
+* Parameters:
+*   softmax: softmax parameters and lookup tables
+*   input: num_of_rows x row_size scores
+*   output: num_of_rows x row_size probabilities, scale 1/32768
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_softmax_s16(const ml_softmax_s16_t *softmax, const int16_t *input,
+                    int16_t *output)
+{
+    for (uint32_t row = 0; row < softmax->num_of_rows; row++)
+    {
+        int32_t max = Q15_MIN;
+        int32_t sum = 0;
+        int32_t headroom;
+        int32_t shifted_sum;
+        int32_t reciprocal;
+        int32_t right_shift;
+
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            max = (input[i] > max) ? input[i] : max;
+        }
+
+        /* exp(x - max) in Q0.15, with [-10, 0] mapped on the int16 range */
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            int32_t scaled = ml_softmax_requantize(input[i] - max, softmax->input_multiplier,
+                                                   softmax->input_left_shift);
+
+            output[i] = (int16_t) ml_softmax_lut(softmax->exp_lut, scaled + Q15_MAX);
+            sum += output[i];
+        }
+
+        /* The largest score gives exp(0), so the sum is at least one. Scale
+         * it to [1, 2) in Q16.15, then read 1/(1 + x) for x = sum - 1, with
+         * [0, 1] mapped on the int16 range. */
+        headroom = __builtin_clz((uint32_t) sum);
+        shifted_sum = (int32_t) ((((int64_t) sum << (headroom - 1)) + (1 << 13)) >> 14);
+        reciprocal = ml_softmax_lut(softmax->one_over_one_plus_x_lut,
+                                    shifted_sum - (SUM_ONE + SUM_CENTER));
+
+        right_shift = 31 - headroom;
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            int32_t result = (int32_t) ((((int64_t) output[i] * reciprocal) +
+                                         (1LL << (right_shift - 1))) >> right_shift);
+
+            output[i] = (int16_t) ((result > Q15_MAX) ? Q15_MAX : ((result < 0) ? 0 : result));
+        }
+
+        input += softmax->row_size;
+        output += softmax->row_size;
+    }
+}
+
+/* [] END OF FILE */
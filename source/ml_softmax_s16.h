@@ -0,0 +1,78 @@
+/******************************************************************************
+* File Name:   ml_softmax_s16.h
+*
+* Description: This file contains the data types and function prototypes
+*   used in ml_softmax_s16.c to run an int16 softmax with lookup tables.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_SOFTMAX_S16_H
+#define ML_SOFTMAX_S16_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Entries of each lookup table: 512 segments, plus the end of the last one,
+ * only read to compute its slope. Same tables as TFLM and CMSIS-NN. */
+#define ML_SOFTMAX_S16_LUT_SIZE     (513u)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Int16 softmax (zero point 0, output scale 1/32768) over rows of row_size
+ * scores. The scores are scaled so that [-10, 0] spans the exp table, so
+ * the multiplier and shift fold in the input scale and beta. */
+typedef struct
+{
+    int32_t         input_multiplier;
+    int32_t         input_left_shift;
+    uint32_t        num_of_rows;
+    uint32_t        row_size;
+    const int16_t   *exp_lut;                   /* exp(x), x in [-10, 0], Q0.15 */
+    const int16_t   *one_over_one_plus_x_lut;   /* 1 / (1 + x), x in [0, 1], Q0.15 */
+} ml_softmax_s16_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void ml_softmax_s16(const ml_softmax_s16_t *softmax, const int16_t *input,
+                    int16_t *output);
+
+#endif /* ML_SOFTMAX_S16_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,287 @@
+/******************************************************************************
+* File Name:   ml_softmax_s8.c
+*
+* Description: This file contains an int8 softmax kernel in fixed point,
+*              with the same results as the TFLM and CMSIS-NN kernels.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_softmax_s8.h"
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define Q31_MIN             (-2147483647 - 1)
+#define Q31_MAX             (2147483647)
+#define Q7_MIN              (-128)
+#define Q7_MAX              (127)
+
+/* Integer bits of the sum of the exponentials, Q12.19 */
+#define SUM_INTEGER_BITS    (12)
+
+/* Q5.26 of the scaled differences: the interval [-1/4, 0) of the exp is the
+ * low 24 bits, the higher bits select the factors of the barrel shifter */
+#define EXP_QUARTER_SHIFT   (24)
+
+/*******************************************************************************
+* Function Name: ml_softmax_s8_mul
+********************************************************************************
+* Summary:
+*   Multiply two Q31 values, rounded, with the product of two -1 saturated
+*   (doubling high multiply).
+*
+* Parameters:
+*   a: Q31 value
+*   b: Q31 value
+*
+* Return:
+*   int32_t: Q31 product.
+*******************************************************************************/
+static inline int32_t ml_softmax_s8_mul(int32_t a, int32_t b)
+{
+    int64_t prod = ((a < 0) != (b < 0)) ? (1 - (1LL << 30)) : (1LL << 30);
+
+    if ((a == Q31_MIN) && (b == Q31_MIN))
+    {
+        return Q31_MAX;
+    }
+    prod += (int64_t) a * b;
+    return (int32_t) (prod / (1LL << 31));
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_s8_div_pow2
+********************************************************************************
+* Summary:
+*   Divide by a power of two, rounded to nearest with ties away from zero.
+*
+* Parameters:
+*   value: dividend
+*   exponent: power of two exponent, 0 to 31
+*
+* Return:
+*   int32_t: quotient.
+*******************************************************************************/
+static inline int32_t ml_softmax_s8_div_pow2(int32_t value, int32_t exponent)
+{
+    int32_t mask = (int32_t) ((1LL << exponent) - 1);
+    int32_t remainder = value & mask;
+    int32_t result = value >> exponent;
+    int32_t threshold = (mask >> 1) + ((result < 0) ? 1 : 0);
+
+    return result + ((remainder > threshold) ? 1 : 0);
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_s8_mul_pow2
+********************************************************************************
+* Summary:
+*   Multiply by a power of two, saturated to the int32 range.
+*
+* Parameters:
+*   value: value to scale
+*   exponent: power of two exponent, 1 to 30
+*
+* Return:
+*   int32_t: scaled value.
+*******************************************************************************/
+static inline int32_t ml_softmax_s8_mul_pow2(int32_t value, int32_t exponent)
+{
+    int32_t threshold = (1 << (31 - exponent)) - 1;
+
+    if (value > threshold)
+    {
+        return Q31_MAX;
+    }
+    if (value < -threshold)
+    {
+        return Q31_MIN;
+    }
+    return (int32_t) ((uint32_t) value << exponent);
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_s8_exp
+********************************************************************************
+* Summary:
+*   Exponential of a negative Q5.26 value, in Q0.31. The value is split in a
+*   remainder in [-1/4, 0), where a polynomial gives the exp, and multiples of
+*   -1/4, -1/2, ..., -16, which multiply it by constant factors.
+*
+* Parameters:
+*   value: Q5.26 value, 0 or less
+*
+* Return:
+*   int32_t: Q0.31 exponential.
+*******************************************************************************/
+static inline int32_t ml_softmax_s8_exp(int32_t value)
+{
+    /* exp(-2^k / 4) in Q0.31, for k = 0 to 6 */
+    static const int32_t factors[] =
+    {
+        1672461947, 1302514674, 790015084, 290630308, 39332535, 720401, 242
+    };
+    const int32_t quarter = 1 << EXP_QUARTER_SHIFT;
+    int32_t remainder_minus_quarter = (value & (quarter - 1)) - quarter;
+    int32_t multiples = remainder_minus_quarter - value;
+    int32_t x;
+    int32_t x2;
+    int32_t terms;
+    int32_t result;
+
+    if (value == 0)
+    {
+        return Q31_MAX;
+    }
+
+    /* exp(r) = exp(-1/8) * exp(x) with x = r + 1/8 in [-1/8, 1/8), Taylor
+     * series up to x^4 */
+    x = (remainder_minus_quarter * (1 << 5)) + (1 << 28);
+    x2 = ml_softmax_s8_mul(x, x);
+    terms = ml_softmax_s8_div_pow2(ml_softmax_s8_mul(x2, x2), 2) + ml_softmax_s8_mul(x2, x);
+    terms = ml_softmax_s8_div_pow2(ml_softmax_s8_mul(terms, 715827883) + x2, 1);
+    result = 1895147668 + ml_softmax_s8_mul(1895147668, x + terms);
+
+    for (uint32_t k = 0; k < (sizeof(factors) / sizeof(factors[0])); k++)
+    {
+        if ((multiples & (1 << (EXP_QUARTER_SHIFT + k))) != 0)
+        {
+            result = ml_softmax_s8_mul(result, factors[k]);
+        }
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_s8_reciprocal
+********************************************************************************
+* Summary:
+*   Return 1 / (1 + x) for x in [0, 1), with three Newton-Raphson steps.
+*
+* Parameters:
+*   value: Q0.31 x
+*
+* Return:
+*   int32_t: Q0.31 reciprocal.
+*******************************************************************************/
+static inline int32_t ml_softmax_s8_reciprocal(int32_t value)
+{
+    int64_t sum = (int64_t) value + Q31_MAX;
+    int32_t half_denominator = (int32_t) ((sum + ((sum >= 0) ? 1 : -1)) / 2);
+    int32_t x = 1515870810 + ml_softmax_s8_mul(half_denominator, -1010580540);
+
+    for (uint32_t step = 0; step < 3u; step++)
+    {
+        int32_t error = (1 << 29) - ml_softmax_s8_mul(half_denominator, x);
+
+        x += ml_softmax_s8_mul_pow2(ml_softmax_s8_mul(x, error), 2);
+    }
+    return ml_softmax_s8_mul_pow2(x, 1);
+}
+
+/*******************************************************************************
+* Function Name: ml_softmax_s8
+********************************************************************************
+* Summary:
+*   Run an int8 softmax with the fixed-point exp and reciprocal of TFLM and
+*   CMSIS-NN, so the outputs match the interpreter bit for bit.
+*
+* Parameters:
+*   softmax: softmax parameters
+*   input: num_of_rows x row_size scores
+*   output: num_of_rows x row_size probabilities, zero point -128, scale 1/256
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_softmax_s8(const ml_softmax_s8_t *softmax, const int8_t *input,
+                   int8_t *output)
+{
+    const int32_t scale = 1 << softmax->input_left_shift;
+
+    for (uint32_t row = 0; row < softmax->num_of_rows; row++)
+    {
+        int32_t max = input[0];
+        int32_t sum = 0;
+        int32_t headroom;
+        int32_t reciprocal;
+        int32_t right_shift;
+
+        for (uint32_t i = 1; i < softmax->row_size; i++)
+        {
+            max = (input[i] > max) ? input[i] : max;
+        }
+
+        /* Sum of exp(x - max) in Q12.19 */
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            int32_t diff = input[i] - max;
+
+            if (diff >= softmax->diff_min)
+            {
+                sum += ml_softmax_s8_div_pow2(
+                    ml_softmax_s8_exp(ml_softmax_s8_mul(diff * scale, softmax->input_multiplier)),
+                    SUM_INTEGER_BITS);
+            }
+        }
+
+        /* The largest score gives exp(0), so the sum is not 0. Normalized to
+         * [1, 2), its reciprocal scales each exp. */
+        headroom = __builtin_clz((uint32_t) sum);
+        reciprocal = ml_softmax_s8_reciprocal((int32_t) (((uint32_t) sum << headroom) - 0x80000000u));
+
+        right_shift = SUM_INTEGER_BITS - headroom + 23;
+        for (uint32_t i = 0; i < softmax->row_size; i++)
+        {
+            int32_t diff = input[i] - max;
+            int32_t result = Q7_MIN;
+
+            if (diff >= softmax->diff_min)
+            {
+                result = ml_softmax_s8_div_pow2(
+                    ml_softmax_s8_mul(reciprocal, ml_softmax_s8_exp(
+                        ml_softmax_s8_mul(diff * scale, softmax->input_multiplier))),
+                    right_shift) + Q7_MIN;
+            }
+            output[i] = (int8_t) ((result > Q7_MAX) ? Q7_MAX : ((result < Q7_MIN) ? Q7_MIN : result));
+        }
+
+        input += softmax->row_size;
+        output += softmax->row_size;
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,71 @@
+/******************************************************************************
+* File Name:   ml_softmax_s8.h
+*
+* Description: This file contains the data types and function prototypes
+*   used in ml_softmax_s8.c to run an int8 softmax in fixed point.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_SOFTMAX_S8_H
+#define ML_SOFTMAX_S8_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Int8 softmax (output zero point -128, scale 1/256) over rows of row_size
+ * scores. The differences with the largest score of the row are scaled to
+ * Q5.26 by the multiplier and shift, which fold in the input scale and beta,
+ * and the scores more than diff_min below the largest one give 0. */
+typedef struct
+{
+    int32_t         input_multiplier;
+    int32_t         input_left_shift;
+    int32_t         diff_min;
+    uint32_t        num_of_rows;
+    uint32_t        row_size;
+} ml_softmax_s8_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void ml_softmax_s8(const ml_softmax_s8_t *softmax, const int8_t *input,
+                   int8_t *output);
+
+#endif /* ML_SOFTMAX_S8_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,440 @@
+/******************************************************************************
+* File Name:   ml_sparse_fc.c
+*
+* Description: This file contains dense and block-sparse (block-CSR)
+*              int8 fully connected kernels, used to profile pruned models.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_sparse_fc.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cy_pdl.h"
+#define ML_SPARSE_FC_USE_DSP
+#endif
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define Q31_HALF        (1LL << 30)
+#define Q31_ONE         (1LL << 31)
+
+/*******************************************************************************
+* Function Name: ml_fc_requantize
+********************************************************************************
+* Summary:
+*   Scale an accumulator by a quantized multiplier and shift, with the same
+*   rounding as TFLM and CMSIS-NN (doubling high multiply, then rounding
+*   divide by a power of two).
+*
+* Parameters:
+*   acc: accumulator
+*   multiplier: Q31 multiplier
+*   shift: power of two exponent
+*
+* Return:
+*   int32_t: scaled value.
+*******************************************************************************/
+static inline int32_t ml_fc_requantize(int32_t acc, int32_t multiplier, int32_t shift)
+{
+    int32_t left = (shift > 0) ? shift : 0;
+    int32_t right = (shift > 0) ? 0 : -shift;
+    int64_t prod = (int64_t) (acc * (1 << left)) * multiplier;
+    int32_t high;
+    int32_t mask;
+    int32_t remainder;
+    int32_t threshold;
+
+    prod += ((prod < 0) ? (1 - Q31_HALF) : Q31_HALF);
+    high = (int32_t) (prod / Q31_ONE);
+
+    mask = (1 << right) - 1;
+    remainder = high & mask;
+    threshold = (mask >> 1) + ((high < 0) ? 1 : 0);
+
+    return (high >> right) + ((remainder > threshold) ? 1 : 0);
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_block
+********************************************************************************
+* Summary:
+*   Multiply-accumulate one block of weights with the matching inputs.
+*
+* Parameters:
+*   acc: accumulator
+*   block: ML_FC_BLOCK_SIZE weights, in w0, w2, w1, w3 order
+*   input: ML_FC_BLOCK_SIZE inputs, offset applied, 4-byte aligned
+*
+* Return:
+*   int32_t: updated accumulator.
+*******************************************************************************/
+static inline int32_t ml_fc_block(int32_t acc, const int8_t *block, const int16_t *input)
+{
+#ifdef ML_SPARSE_FC_USE_DSP
+    uint32_t weights;
+    uint32_t x01;
+    uint32_t x23;
+
+    memcpy(&weights, block, sizeof(weights));
+    memcpy(&x01, &input[0], sizeof(x01));
+    memcpy(&x23, &input[2], sizeof(x23));
+
+    acc = (int32_t) __SMLAD(__SXTB16(weights), x01, (uint32_t) acc);
+    acc = (int32_t) __SMLAD(__SXTB16(__ROR(weights, 8)), x23, (uint32_t) acc);
+
+    return acc;
+#else
+    return acc + (input[0] * block[0]) + (input[1] * block[2]) +
+                 (input[2] * block[1]) + (input[3] * block[3]);
+#endif /* ML_SPARSE_FC_USE_DSP */
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_block_s4
+********************************************************************************
+* Summary:
+*   Multiply-accumulate one block of packed int4 weights with the matching
+*   inputs. The products are scaled by 16.
+*
+* Parameters:
+*   acc: accumulator
+*   block: ML_FC_S4_BLOCK_SIZE weights, packed as described in ml_sparse_fc.h
+*   input: ML_FC_S4_BLOCK_SIZE inputs, offset applied, 4-byte aligned
+*
+* Return:
+*   int32_t: updated accumulator.
+*******************************************************************************/
+static inline int32_t ml_fc_block_s4(int32_t acc, const int8_t *block, const int16_t *input)
+{
+#ifdef ML_SPARSE_FC_USE_DSP
+    uint32_t packed;
+    uint32_t low;
+    uint32_t high;
+    uint32_t x[4];
+
+    memcpy(&packed, block, sizeof(packed));
+    memcpy(x, input, sizeof(x));
+
+    /* Each nibble in the top of its byte is the weight times 16 */
+    low = (packed << 4) & 0xF0F0F0F0u;
+    high = packed & 0xF0F0F0F0u;
+
+    acc = (int32_t) __SMLAD(__SXTB16(low), x[0], (uint32_t) acc);
+    acc = (int32_t) __SMLAD(__SXTB16(__ROR(low, 8)), x[1], (uint32_t) acc);
+    acc = (int32_t) __SMLAD(__SXTB16(high), x[2], (uint32_t) acc);
+    acc = (int32_t) __SMLAD(__SXTB16(__ROR(high, 8)), x[3], (uint32_t) acc);
+
+    return acc;
+#else
+    const uint8_t *packed = (const uint8_t *) block;
+
+    return acc + (input[0] * (int8_t) (packed[0] << 4)) + (input[1] * (int8_t) (packed[2] << 4)) +
+                 (input[2] * (int8_t) (packed[1] << 4)) + (input[3] * (int8_t) (packed[3] << 4)) +
+                 (input[4] * (int8_t) (packed[0] & 0xF0u)) + (input[5] * (int8_t) (packed[2] & 0xF0u)) +
+                 (input[6] * (int8_t) (packed[1] & 0xF0u)) + (input[7] * (int8_t) (packed[3] & 0xF0u));
+#endif /* ML_SPARSE_FC_USE_DSP */
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_output
+********************************************************************************
+* Summary:
+*   Requantize the accumulator of one output of a layer, add the output zero
+*   point and clamp it to the activation range.
+*
+* Parameters:
+*   layer: layer
+*   r: output index
+*   acc: accumulator of the output
+*
+* Return:
+*   int8_t: output value.
+*******************************************************************************/
+static inline int8_t ml_fc_output(const ml_fc_s8_layer_t *layer, uint32_t r, int32_t acc)
+{
+    int32_t out;
+
+    if (layer->multipliers != NULL)
+    {
+        out = ml_fc_requantize(acc, layer->multipliers[r], layer->shifts[r]);
+    }
+    else
+    {
+        out = ml_fc_requantize(acc, layer->multiplier, layer->shift);
+    }
+    out += layer->output_offset;
+    out = (out < layer->act_min) ? layer->act_min : out;
+    out = (out > layer->act_max) ? layer->act_max : out;
+    return (int8_t) out;
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_s8
+********************************************************************************
+* Summary:
+*   Run a fully connected layer. The input offset is applied once, while
+*   widening the input to 16 bits, and the blocks missing from a block-CSR
+*   layer are skipped. In a dense int8 layer, the input blocks equal to the
+*   zero point are also skipped if few enough blocks differ from it.
+*
+* Parameters:
+*   layer: layer, dense or block-CSR
+*   input: layer->cols inputs
+*   output: layer->rows outputs
+*   scratch: ML_FC_S8_SCRATCH_SIZE(layer->cols) bytes, 4-byte aligned
+*   density_threshold: percentage of the input blocks that differ from the
+*     zero point below which they are skipped, 0 to never skip them
+*
+* Return:
+*   uint32_t: number of input blocks that differ from the zero point.
+*******************************************************************************/
+uint32_t ml_fc_s8(const ml_fc_s8_layer_t *layer, const int8_t *input,
+                  int8_t *output, void *scratch, uint32_t density_threshold)
+{
+    const uint32_t blocks_per_row = layer->cols / ML_FC_BLOCK_SIZE;
+    int16_t *widened = (int16_t *) scratch;
+    uint8_t *active = (uint8_t *) &widened[layer->cols];
+    uint32_t num_of_active = 0;
+    bool skip_inputs;
+
+    /* Widen the input and list the blocks holding an input other than the
+     * zero point, which is zero once the offset is applied */
+    for (uint32_t b = 0; b < blocks_per_row; b++)
+    {
+        int16_t *x = &widened[b * ML_FC_BLOCK_SIZE];
+
+        x[0] = (int16_t) (input[0] + layer->input_offset);
+        x[1] = (int16_t) (input[1] + layer->input_offset);
+        x[2] = (int16_t) (input[2] + layer->input_offset);
+        x[3] = (int16_t) (input[3] + layer->input_offset);
+        input += ML_FC_BLOCK_SIZE;
+
+        if ((x[0] | x[1] | x[2] | x[3]) != 0)
+        {
+            active[num_of_active++] = (uint8_t) b;
+        }
+    }
+
+    skip_inputs = (layer->row_ptr == NULL) && (layer->weight_bits == 8u) &&
+                  ((num_of_active * 100u) < (density_threshold * blocks_per_row));
+
+    for (uint32_t r = 0; r < layer->rows; r++)
+    {
+        int32_t acc = (layer->bias != NULL) ? layer->bias[r] : 0;
+
+        if (layer->row_ptr != NULL)
+        {
+            for (uint32_t b = layer->row_ptr[r]; b < layer->row_ptr[r + 1u]; b++)
+            {
+                acc = ml_fc_block(acc, &layer->blocks[b * ML_FC_BLOCK_SIZE],
+                                  &widened[layer->col_block[b] * ML_FC_BLOCK_SIZE]);
+            }
+        }
+        else if (layer->weight_bits == 4u)
+        {
+            const int8_t *row = &layer->blocks[(r * layer->cols) / 2u];
+
+            for (uint32_t offset = 0; offset < layer->cols; offset += ML_FC_S4_BLOCK_SIZE)
+            {
+                acc = ml_fc_block_s4(acc, &row[offset / 2u], &widened[offset]);
+            }
+        }
+        else if (skip_inputs)
+        {
+            const int8_t *row = &layer->blocks[r * layer->cols];
+
+            for (uint32_t i = 0; i < num_of_active; i++)
+            {
+                uint32_t offset = active[i] * ML_FC_BLOCK_SIZE;
+
+                acc = ml_fc_block(acc, &row[offset], &widened[offset]);
+            }
+        }
+        else
+        {
+            const int8_t *row = &layer->blocks[r * layer->cols];
+
+            for (uint32_t offset = 0; offset < layer->cols; offset += ML_FC_BLOCK_SIZE)
+            {
+                acc = ml_fc_block(acc, &row[offset], &widened[offset]);
+            }
+        }
+
+        output[r] = ml_fc_output(layer, r, acc);
+    }
+
+    return num_of_active;
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_s8_dense
+********************************************************************************
+* Summary:
+*   Run a dense int8 fully connected layer over all its input blocks. The
+*   input offset is applied once, while widening the input to 16 bits, and
+*   the input is not scanned for blocks equal to the zero point, so the work
+*   is the same for every input.
+*
+* Parameters:
+*   layer: dense layer with int8 weights
+*   input: layer->cols inputs
+*   output: layer->rows outputs
+*   scratch: ML_FC_S8_DENSE_SCRATCH_SIZE(layer->cols) bytes, 4-byte aligned
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_fc_s8_dense(const ml_fc_s8_layer_t *layer, const int8_t *input,
+                    int8_t *output, void *scratch)
+{
+    int16_t *widened = (int16_t *) scratch;
+
+    for (uint32_t i = 0; i < layer->cols; i++)
+    {
+        widened[i] = (int16_t) (input[i] + layer->input_offset);
+    }
+
+    for (uint32_t r = 0; r < layer->rows; r++)
+    {
+        const int8_t *row = &layer->blocks[r * layer->cols];
+        int32_t acc = (layer->bias != NULL) ? layer->bias[r] : 0;
+
+        for (uint32_t offset = 0; offset < layer->cols; offset += ML_FC_BLOCK_SIZE)
+        {
+            acc = ml_fc_block(acc, &row[offset], &widened[offset]);
+        }
+
+        output[r] = ml_fc_output(layer, r, acc);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_s8_scratch_size
+********************************************************************************
+* Summary:
+*   Return the size of the scratch buffer needed by ml_fc_s8_classify().
+*
+* Parameters:
+*   model: layer stack
+*
+* Return:
+*   uint32_t: size in bytes.
+*******************************************************************************/
+uint32_t ml_fc_s8_scratch_size(const ml_fc_s8_model_t *model)
+{
+    uint32_t width = (model->max_width + 3u) & ~3u;
+
+    /* Layer scratch, then two activation buffers */
+    return ((ML_FC_S8_SCRATCH_SIZE(width) + 3u) & ~3u) + (2u * width);
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_s8_num_of_blocks
+********************************************************************************
+* Summary:
+*   Return the number of weight blocks stored for the layer stack.
+*
+* Parameters:
+*   model: layer stack
+*
+* Return:
+*   uint32_t: number of blocks.
+*******************************************************************************/
+uint32_t ml_fc_s8_num_of_blocks(const ml_fc_s8_model_t *model)
+{
+    uint32_t count = 0;
+
+    for (uint32_t l = 0; l < model->num_of_layers; l++)
+    {
+        count += model->layers[l].num_of_blocks;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: ml_fc_s8_classify
+********************************************************************************
+* Summary:
+*   Run the layer stack and return the index of the largest output. A
+*   classifier's softmax does not change it, so it is not run.
+*
+* Parameters:
+*   model: layer stack
+*   input: model input
+*   scratch: ml_fc_s8_scratch_size() bytes, 4-byte aligned
+*   density_threshold: see ml_fc_s8()
+*
+* Return:
+*   int: predicted class.
+*******************************************************************************/
+int ml_fc_s8_classify(const ml_fc_s8_model_t *model, const int8_t *input,
+                      void *scratch, uint32_t density_threshold)
+{
+    uint32_t width = (model->max_width + 3u) & ~3u;
+    uint8_t *layer_scratch = (uint8_t *) scratch;
+    int8_t *act[2];
+    const int8_t *layer_input = input;
+    const ml_fc_s8_layer_t *last = &model->layers[model->num_of_layers - 1u];
+    int best = 0;
+
+    act[0] = (int8_t *) &layer_scratch[(ML_FC_S8_SCRATCH_SIZE(width) + 3u) & ~3u];
+    act[1] = &act[0][width];
+
+    for (uint32_t l = 0; l < model->num_of_layers; l++)
+    {
+        (void) ml_fc_s8(&model->layers[l], layer_input, act[l & 1u], layer_scratch,
+                        density_threshold);
+        layer_input = act[l & 1u];
+    }
+
+    for (int i = 1; i < last->rows; i++)
+    {
+        if (layer_input[i] > layer_input[best])
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/* [] END OF FILE */
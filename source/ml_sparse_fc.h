@@ -0,0 +1,132 @@
+/******************************************************************************
+* File Name:   ml_sparse_fc.h
+*
+* Description: This file contains the data types and function prototypes
+*   of the dense and block-sparse int8 fully connected kernels implemented in
+*   ml_sparse_fc.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_SPARSE_FC_H
+#define ML_SPARSE_FC_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* Weights per block: four int8 weights fill one SIMD word. Within a block the
+ * weights are stored in the order w0, w2, w1, w3, so a sign extension of the
+ * even and odd bytes gives the pairs that match the (x0, x1) and (x2, x3)
+ * input pairs. */
+#define ML_FC_BLOCK_SIZE        (4u)
+
+/* Weights per int4 block: eight 4-bit weights, packed two per byte, fill one
+ * SIMD word. Byte k holds w(k') in its low nibble and w(k'+4) in its high
+ * nibble, with k' = 0, 2, 1, 3 for k = 0, 1, 2, 3, so masking the low or the
+ * high nibbles gives the same layout as an int8 block. The nibbles are used
+ * in place, scaled by 16, which the generator folds into the bias and the
+ * multipliers of the layer. */
+#define ML_FC_S4_BLOCK_SIZE     (8u)
+
+/* Scratch buffer of ml_fc_s8(): the input widened to 16 bits, then the list
+ * of the input blocks that differ from the zero point */
+#define ML_FC_S8_SCRATCH_SIZE(cols)     (((cols) * 2u) + ((cols) / ML_FC_BLOCK_SIZE))
+
+/* Scratch buffer of ml_fc_s8_dense(): the input widened to 16 bits */
+#define ML_FC_S8_DENSE_SCRATCH_SIZE(cols)   ((cols) * 2u)
+
+/* Dense layers skip the input blocks equal to the zero point when less than
+ * this percentage of the blocks differ from it. Each block left then costs an
+ * extra index load, so skipping pays off well before the input is empty. */
+#ifndef ML_FC_INPUT_DENSITY_THRESHOLD
+#define ML_FC_INPUT_DENSITY_THRESHOLD   (50u)
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Fully connected layer with int8 or int4 weights, int8 activations, and
+ * int32 bias. In block-CSR format (int8 only), the non-zero blocks of row r are the blocks
+ * row_ptr[r] to row_ptr[r+1]-1, and col_block holds the input position of
+ * each one divided by ML_FC_BLOCK_SIZE. In dense format, row_ptr and
+ * col_block are NULL and every row holds cols / ML_FC_BLOCK_SIZE blocks.
+ * Layers quantized per channel have one multiplier and shift per output,
+ * precomputed by the generator, so nothing is derived at inference time. */
+typedef struct
+{
+    uint16_t        rows;           /* Outputs */
+    uint16_t        cols;           /* Inputs, a multiple of the block size, up to 1024 */
+    uint16_t        weight_bits;    /* 8 or 4 */
+    uint32_t        num_of_blocks;
+    const uint16_t  *row_ptr;
+    const uint8_t   *col_block;
+    const int8_t    *blocks;
+    const int32_t   *bias;
+    int32_t         input_offset;   /* -input zero point */
+    int32_t         output_offset;  /* Output zero point */
+    int32_t         multiplier;
+    int32_t         shift;
+    const int32_t   *multipliers;   /* Per output, NULL to use multiplier */
+    const int32_t   *shifts;        /* Per output, NULL to use shift */
+    int32_t         act_min;
+    int32_t         act_max;
+} ml_fc_s8_layer_t;
+
+/* Stack of fully connected layers, run one after the other */
+typedef struct
+{
+    uint32_t                num_of_layers;
+    const ml_fc_s8_layer_t  *layers;
+    uint32_t                max_width;      /* Largest layer input or output */
+    uint32_t                weight_bytes;   /* Blocks, indices, bias and multipliers */
+} ml_fc_s8_model_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+uint32_t ml_fc_s8(const ml_fc_s8_layer_t *layer, const int8_t *input,
+                  int8_t *output, void *scratch, uint32_t density_threshold);
+void ml_fc_s8_dense(const ml_fc_s8_layer_t *layer, const int8_t *input,
+                    int8_t *output, void *scratch);
+uint32_t ml_fc_s8_scratch_size(const ml_fc_s8_model_t *model);
+uint32_t ml_fc_s8_num_of_blocks(const ml_fc_s8_model_t *model);
+int ml_fc_s8_classify(const ml_fc_s8_model_t *model, const int8_t *input,
+                      void *scratch, uint32_t density_threshold);
+
+#endif /* ML_SPARSE_FC_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,686 @@
+/******************************************************************************
+* File Name:   ml_stream_window.c
+*
+* Description: This file contains the device side of the windowed
+*              streaming protocol: the samples are received in the background while the
+*              previous ones are inferred, and the outputs are sent in multi-sample frames.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_stream_window.h"
+#include "ml_regression.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define POLL_PERIOD_US          (10u)
+#define POLLS_PER_MS            (1000u / POLL_PERIOD_US)
+
+#define RX_EVENT_PRIORITY       (3u)
+
+/*******************************************************************************
+* Function Name: ml_sw_checksum
+********************************************************************************
+* Summary:
+*   Compute the Fletcher-16 checksum of a frame.
+*
+* Parameters:
+*   data: frame header and payload
+*   size: number of bytes
+*
+* Return:
+*   uint16_t: checksum.
+*******************************************************************************/
+static uint16_t ml_sw_checksum(const uint8_t *data, uint32_t size)
+{
+    uint32_t sum1 = 0;
+    uint32_t sum2 = 0;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        sum1 = (sum1 + data[i]) % 255u;
+        sum2 = (sum2 + sum1) % 255u;
+    }
+
+    return (uint16_t) ((sum2 << 8) | sum1);
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_write
+********************************************************************************
+* Summary:
+*   Write a buffer to the UART, waiting until all the bytes are taken.
+*
+* Parameters:
+*   sw: windowed session
+*   data: bytes to write
+*   size: number of bytes
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+static cy_rslt_t ml_sw_write(ml_stream_window_t *sw, const uint8_t *data, uint32_t size)
+{
+    uint32_t polls = sw->timeout_ms * POLLS_PER_MS;
+
+    while (size > 0)
+    {
+        size_t length = size;
+        cy_rslt_t result = cyhal_uart_write(sw->uart, (void *) data, &length);
+
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        data += length;
+        size -= length;
+
+        if ((length == 0) && (polls-- == 0))
+        {
+            return MTB_ML_RESULT_BAD_ARG;
+        }
+        else if (length == 0)
+        {
+            cyhal_system_delay_us(POLL_PERIOD_US);
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_read
+********************************************************************************
+* Summary:
+*   Read a given number of bytes from the UART, in the foreground.
+*
+* Parameters:
+*   sw: windowed session
+*   data: buffer for the bytes read
+*   size: number of bytes
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+static cy_rslt_t ml_sw_read(ml_stream_window_t *sw, uint8_t *data, uint32_t size)
+{
+    uint32_t polls = sw->timeout_ms * POLLS_PER_MS;
+
+    while (size > 0)
+    {
+        size_t length = size;
+        cy_rslt_t result = cyhal_uart_read(sw->uart, data, &length);
+
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        data += length;
+        size -= length;
+
+        if ((length == 0) && (polls-- == 0))
+        {
+            return MTB_ML_RESULT_BAD_ARG;
+        }
+        else if (length == 0)
+        {
+            cyhal_system_delay_us(POLL_PERIOD_US);
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_send_frame
+********************************************************************************
+* Summary:
+*   Fill the header and checksum of a frame whose payload is already in place,
+*   and send it.
+*
+* Parameters:
+*   sw: windowed session
+*   frame: header, payload and room for the checksum
+*   type: message type
+*   count: samples in the frame
+*   seq: index of the first sample
+*   length: payload bytes
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+static cy_rslt_t ml_sw_send_frame(ml_stream_window_t *sw, uint8_t *frame, uint8_t type,
+                                  uint8_t count, uint32_t seq, uint16_t length)
+{
+    ml_sw_frame_header_t header =
+    {
+        .magic  = ML_SW_MAGIC,
+        .type   = type,
+        .count  = count,
+        .seq    = (uint16_t) seq,
+        .length = length,
+    };
+    uint16_t checksum;
+
+    memcpy(frame, &header, sizeof(header));
+    checksum = ml_sw_checksum(frame, sizeof(header) + length);
+    memcpy(&frame[sizeof(header) + length], &checksum, sizeof(checksum));
+
+    return ml_sw_write(sw, frame, sizeof(header) + length + ML_SW_CHECKSUM_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_post_rx
+********************************************************************************
+* Summary:
+*   Start receiving the next SAMPLE frame in the background if a slot is free.
+*   Called from the UART interrupt or inside a critical section.
+*
+* Parameters:
+*   sw: windowed session
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_sw_post_rx(ml_stream_window_t *sw)
+{
+    uint32_t stride = (sw->rx_frame_size + 3u) & ~3u;
+
+    if (sw->rx_posted || (sw->rx_count >= sw->window) ||
+        (sw->rx_requested >= sw->num_of_samples))
+    {
+        return;
+    }
+
+    if (CY_RSLT_SUCCESS == cyhal_uart_read_async(sw->uart, &sw->rx_slots[sw->rx_head * stride],
+                                                 sw->rx_frame_size))
+    {
+        sw->rx_posted = true;
+        sw->rx_requested++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_uart_event
+********************************************************************************
+* Summary:
+*   UART event callback: a SAMPLE frame was received into its slot.
+*
+* Parameters:
+*   arg: windowed session
+*   event: UART events
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_sw_uart_event(void *arg, cyhal_uart_event_t event)
+{
+    ml_stream_window_t *sw = (ml_stream_window_t *) arg;
+
+    if ((event & CYHAL_UART_IRQ_RX_DONE) != 0)
+    {
+        sw->rx_posted = false;
+        sw->rx_head = (sw->rx_head + 1u) % sw->window;
+        sw->rx_count++;
+        ml_sw_post_rx(sw);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_score
+********************************************************************************
+* Summary:
+*   Read an element of the output tensor. int8 and int16 scores are exact as
+*   float.
+*
+* Parameters:
+*   sw: windowed session
+*   output: output tensor
+*   idx: element index
+*
+* Return:
+*   float: score.
+*******************************************************************************/
+static inline float ml_sw_score(const ml_stream_window_t *sw, const void *output, uint32_t idx)
+{
+    switch (sw->data_type)
+    {
+        case ML_REG_TYPE_INT8:
+            return (float) ((const int8_t *) output)[idx];
+        case ML_REG_TYPE_INT16:
+            return (float) ((const int16_t *) output)[idx];
+        default:
+            return ((const float *) output)[idx];
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_top_k
+********************************************************************************
+* Summary:
+*   Write the top-k record of an output in a single pass over the tensor,
+*   instead of copying the whole tensor to the frame. Ties keep the lowest
+*   index, as mtb_ml_utils_find_max() does.
+*
+* Parameters:
+*   sw: windowed session
+*   output: output tensor
+*   record: destination in the OUTPUT frame
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_sw_top_k(const ml_stream_window_t *sw, const void *output, uint8_t *record)
+{
+    uint16_t index[ML_SW_MAX_TOP_K];
+    float score[ML_SW_MAX_TOP_K];
+    uint32_t found = 0;
+
+    for (uint32_t i = 0; i < sw->output_size; i++)
+    {
+        float value = ml_sw_score(sw, output, i);
+        uint32_t pos = found;
+
+        /* Insertion into the sorted list, skipped for most elements */
+        if ((found == sw->top_k) && (value <= score[found - 1u]))
+        {
+            continue;
+        }
+        if (found < sw->top_k)
+        {
+            found++;
+        }
+        else
+        {
+            pos--;
+        }
+        while ((pos > 0) && (value > score[pos - 1u]))
+        {
+            index[pos] = index[pos - 1u];
+            score[pos] = score[pos - 1u];
+            pos--;
+        }
+        index[pos] = (uint16_t) i;
+        score[pos] = value;
+    }
+
+    memcpy(record, index, sw->top_k * sizeof(uint16_t));
+    if (sw->output_mode == ML_SW_OUTPUT_TOP_K)
+    {
+        record += sw->top_k * sizeof(uint16_t);
+        for (uint32_t k = 0; k < sw->top_k; k++)
+        {
+            memcpy(&record[k * sw->elem_size], (const uint8_t *) output + (index[k] * sw->elem_size),
+                   sw->elem_size);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_sw_flush
+********************************************************************************
+* Summary:
+*   Send the outputs gathered so far in a single OUTPUT frame.
+*
+* Parameters:
+*   sw: windowed session
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+static cy_rslt_t ml_sw_flush(ml_stream_window_t *sw)
+{
+    cy_rslt_t result;
+
+    if (sw->tx_count == 0)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    result = ml_sw_send_frame(sw, sw->tx_frame, ML_SW_MSG_OUTPUT, (uint8_t) sw->tx_count,
+                              sw->sent, (uint16_t) (sw->tx_count * sw->output_bytes));
+    sw->sent += sw->tx_count;
+    sw->tx_count = 0;
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ml_stream_window_open
+********************************************************************************
+* Summary:
+*   Wait for the CONFIG frame of the host, grant a window and the number of
+*   outputs per frame, and start receiving the samples in the background.
+*
+* Parameters:
+*   sw: windowed session
+*   uart: UART connected to the host
+*   input_size: elements per sample
+*   output_size: elements per output
+*   elem_size: bytes per element
+*   data_type: 1 for float32, 2 for int8 and 3 for int16
+*   timeout_ms: timeout of each transfer
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+cy_rslt_t ml_stream_window_open(ml_stream_window_t *sw, cyhal_uart_t *uart,
+                                uint32_t input_size, uint32_t output_size,
+                                uint32_t elem_size, uint16_t data_type,
+                                uint32_t timeout_ms)
+{
+    uint8_t frame[sizeof(ml_sw_frame_header_t) + sizeof(ml_sw_ack_t) + ML_SW_CHECKSUM_SIZE];
+    ml_sw_frame_header_t header;
+    ml_sw_config_t config;
+    ml_sw_ack_t ack;
+    uint16_t checksum;
+    uint16_t sync = 0;
+    uint32_t saved_intr;
+    cy_rslt_t result;
+
+    memset(sw, 0, sizeof(*sw));
+    sw->uart = uart;
+    sw->timeout_ms = timeout_ms;
+    sw->output_size = output_size;
+    sw->elem_size = elem_size;
+    sw->data_type = data_type;
+    sw->rx_frame_size = sizeof(ml_sw_frame_header_t) + (input_size * elem_size) + ML_SW_CHECKSUM_SIZE;
+
+    /* Look for the start of a frame, waiting for the host as long as needed */
+    while (sync != ML_SW_MAGIC)
+    {
+        uint8_t byte;
+        size_t length = 1;
+
+        result = cyhal_uart_read(sw->uart, &byte, &length);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        if (length == 0)
+        {
+            cyhal_system_delay_us(POLL_PERIOD_US);
+        }
+        else
+        {
+            sync = (uint16_t) ((sync >> 8) | (byte << 8));
+        }
+    }
+    memcpy(frame, &sync, sizeof(sync));
+
+    result = ml_sw_read(sw, &frame[2], sizeof(header) + sizeof(config) + ML_SW_CHECKSUM_SIZE - 2u);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    memcpy(&header, frame, sizeof(header));
+    memcpy(&config, &frame[sizeof(header)], sizeof(config));
+    memcpy(&checksum, &frame[sizeof(header) + sizeof(config)], sizeof(checksum));
+    if ((header.type != ML_SW_MSG_CONFIG) || (header.length != sizeof(config)) ||
+        (checksum != ml_sw_checksum(frame, sizeof(header) + sizeof(config))))
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    /* Grant at most ML_SW_MAX_WINDOW samples in flight, and no more outputs
+     * per frame than samples in flight, otherwise the host would stall */
+    sw->num_of_samples = config.num_of_samples;
+    sw->window = (config.window == 0) ? 1u : config.window;
+    sw->window = (sw->window > ML_SW_MAX_WINDOW) ? ML_SW_MAX_WINDOW : sw->window;
+    sw->coalesce = (config.coalesce == 0) ? 1u : config.coalesce;
+    sw->coalesce = (sw->coalesce > sw->window) ? sw->window : sw->coalesce;
+
+    /* Anything but the full tensor is reduced to the top-k on the device */
+    sw->output_mode = config.output_mode;
+    sw->top_k = (config.output_mode == ML_SW_OUTPUT_LABEL) ? 1u : config.top_k;
+    sw->top_k = (sw->top_k > ML_SW_MAX_TOP_K) ? ML_SW_MAX_TOP_K : sw->top_k;
+    sw->top_k = (sw->top_k > output_size) ? output_size : sw->top_k;
+    if ((sw->output_mode > ML_SW_OUTPUT_LABEL) || (sw->top_k == 0))
+    {
+        sw->output_mode = ML_SW_OUTPUT_FULL;
+    }
+
+    switch (sw->output_mode)
+    {
+        case ML_SW_OUTPUT_TOP_K:
+            sw->output_bytes = sw->top_k * (sizeof(uint16_t) + elem_size);
+            break;
+        case ML_SW_OUTPUT_LABEL:
+            sw->output_bytes = sizeof(uint16_t);
+            break;
+        default:
+            sw->output_bytes = output_size * elem_size;
+            sw->top_k = 0;
+            break;
+    }
+
+    if ((input_size * elem_size > UINT16_MAX) || (sw->coalesce * sw->output_bytes > UINT16_MAX))
+    {
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+
+    sw->rx_slots = (uint8_t *) malloc(sw->window * ((sw->rx_frame_size + 3u) & ~3u));
+    sw->tx_frame = (uint8_t *) malloc(sizeof(header) + (sw->coalesce * sw->output_bytes) + ML_SW_CHECKSUM_SIZE);
+    if ((sw->rx_slots == NULL) || (sw->tx_frame == NULL))
+    {
+        ml_stream_window_close(sw);
+        return MTB_ML_RESULT_ALLOC_ERR;
+    }
+
+    /* Receive the first samples before the host is told to send them */
+    cyhal_uart_register_callback(sw->uart, ml_sw_uart_event, sw);
+    cyhal_uart_enable_event(sw->uart, CYHAL_UART_IRQ_RX_DONE, RX_EVENT_PRIORITY, true);
+    saved_intr = cyhal_system_critical_section_enter();
+    ml_sw_post_rx(sw);
+    cyhal_system_critical_section_exit(saved_intr);
+
+    ack.input_size = input_size;
+    ack.output_size = output_size;
+    ack.data_type = data_type;
+    ack.window = (uint16_t) sw->window;
+    ack.coalesce = (uint16_t) sw->coalesce;
+    ack.output_mode = (uint8_t) sw->output_mode;
+    ack.top_k = (uint8_t) sw->top_k;
+    memcpy(&frame[sizeof(header)], &ack, sizeof(ack));
+
+    result = ml_sw_send_frame(sw, frame, ML_SW_MSG_ACK, 0, 0, sizeof(ack));
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ml_stream_window_close(sw);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: ml_stream_window_get_input
+********************************************************************************
+* Summary:
+*   Wait for the next sample. The sample stays valid until it is released by
+*   ml_stream_window_put_output().
+*
+* Parameters:
+*   sw: windowed session
+*
+* Return:
+*   const void *: sample data, or NULL on timeout or invalid frame.
+*******************************************************************************/
+const void *ml_stream_window_get_input(ml_stream_window_t *sw)
+{
+    uint32_t polls = sw->timeout_ms * POLLS_PER_MS;
+    uint32_t stride = (sw->rx_frame_size + 3u) & ~3u;
+    uint32_t length = sw->rx_frame_size - sizeof(ml_sw_frame_header_t) - ML_SW_CHECKSUM_SIZE;
+    const uint8_t *frame;
+    ml_sw_frame_header_t header;
+    uint16_t checksum;
+
+    while (sw->rx_count == 0)
+    {
+        if (polls-- == 0)
+        {
+            return NULL;
+        }
+        cyhal_system_delay_us(POLL_PERIOD_US);
+    }
+
+    frame = &sw->rx_slots[sw->rx_tail * stride];
+    memcpy(&header, frame, sizeof(header));
+    memcpy(&checksum, &frame[sizeof(header) + length], sizeof(checksum));
+
+    if ((header.magic != ML_SW_MAGIC) || (header.type != ML_SW_MSG_SAMPLE) ||
+        (header.length != length) || (header.seq != (uint16_t) sw->received) ||
+        (checksum != ml_sw_checksum(frame, sizeof(header) + length)))
+    {
+        return NULL;
+    }
+
+    sw->received++;
+
+    return &frame[sizeof(header)];
+}
+
+/*******************************************************************************
+* Function Name: ml_stream_window_put_output
+********************************************************************************
+* Summary:
+*   Release the current sample and queue its output. The outputs are sent when
+*   the frame is full, at the last sample, or when the host cannot send more
+*   samples until it gets outputs back.
+*
+* Parameters:
+*   sw: windowed session
+*   output: model output
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+cy_rslt_t ml_stream_window_put_output(ml_stream_window_t *sw, const void *output)
+{
+    uint8_t *record = &sw->tx_frame[sizeof(ml_sw_frame_header_t) + (sw->tx_count * sw->output_bytes)];
+    uint32_t saved_intr;
+    uint32_t rx_count;
+
+    if (sw->output_mode == ML_SW_OUTPUT_FULL)
+    {
+        memcpy(record, output, sw->output_bytes);
+    }
+    else
+    {
+        ml_sw_top_k(sw, output, record);
+    }
+    sw->tx_count++;
+
+    saved_intr = cyhal_system_critical_section_enter();
+    sw->rx_tail = (sw->rx_tail + 1u) % sw->window;
+    sw->rx_count--;
+    rx_count = sw->rx_count;
+    ml_sw_post_rx(sw);
+    cyhal_system_critical_section_exit(saved_intr);
+
+    if ((sw->tx_count == sw->coalesce) ||
+        ((sw->sent + sw->tx_count) == sw->num_of_samples) ||
+        ((rx_count == 0) && ((sw->received - sw->sent) >= sw->window)))
+    {
+        return ml_sw_flush(sw);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_stream_window_finish
+********************************************************************************
+* Summary:
+*   Send the pending outputs and the DONE frame.
+*
+* Parameters:
+*   sw: windowed session
+*
+* Return:
+*   cy_rslt_t: the status of the operation.
+*******************************************************************************/
+cy_rslt_t ml_stream_window_finish(ml_stream_window_t *sw)
+{
+    uint8_t frame[sizeof(ml_sw_frame_header_t) + sizeof(uint32_t) + ML_SW_CHECKSUM_SIZE];
+    cy_rslt_t result;
+
+    result = ml_sw_flush(sw);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    memcpy(&frame[sizeof(ml_sw_frame_header_t)], &sw->sent, sizeof(sw->sent));
+
+    return ml_sw_send_frame(sw, frame, ML_SW_MSG_DONE, 0, sw->sent, sizeof(sw->sent));
+}
+
+/*******************************************************************************
+* Function Name: ml_stream_window_close
+********************************************************************************
+* Summary:
+*   Stop the background reception and release the session buffers.
+*
+* Parameters:
+*   sw: windowed session
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_stream_window_close(ml_stream_window_t *sw)
+{
+    cyhal_uart_enable_event(sw->uart, CYHAL_UART_IRQ_RX_DONE, RX_EVENT_PRIORITY, false);
+    if (sw->rx_posted)
+    {
+        cyhal_uart_read_abort(sw->uart);
+        sw->rx_posted = false;
+    }
+    cyhal_uart_register_callback(sw->uart, NULL, NULL);
+
+    free(sw->rx_slots);
+    free(sw->tx_frame);
+    sw->rx_slots = NULL;
+    sw->tx_frame = NULL;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,159 @@
+/******************************************************************************
+* File Name:   ml_stream_window.h
+*
+* Description: This file contains the frame layout, data types and
+*   function prototypes of the windowed streaming protocol implemented
+*   in ml_stream_window.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_STREAM_WINDOW_H
+#define ML_STREAM_WINDOW_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cyhal.h"
+#include "mtb_ml.h"
+
+/*******************************************************************************
+* Defines
+*******************************************************************************/
+/* "MW" read as a little-endian half word */
+#define ML_SW_MAGIC             (0x574Du)
+
+/* Maximum number of samples the host can have in flight */
+#define ML_SW_MAX_WINDOW        (8u)
+
+/* Message types */
+#define ML_SW_MSG_CONFIG        (1u)    /* Host: ml_sw_config_t */
+#define ML_SW_MSG_ACK           (2u)    /* Device: ml_sw_ack_t */
+#define ML_SW_MSG_SAMPLE        (3u)    /* Host: one input sample */
+#define ML_SW_MSG_OUTPUT        (4u)    /* Device: count model outputs */
+#define ML_SW_MSG_DONE          (5u)    /* Device: number of samples run */
+
+/* Content of each output in the OUTPUT frames:
+ * - FULL:  the output tensor
+ * - TOP_K: uint16_t index[top_k] of the largest scores, in decreasing order,
+ *          followed by the scores, in the tensor type
+ * - LABEL: uint16_t index of the largest score */
+#define ML_SW_OUTPUT_FULL       (0u)
+#define ML_SW_OUTPUT_TOP_K      (1u)
+#define ML_SW_OUTPUT_LABEL      (2u)
+
+#define ML_SW_MAX_TOP_K         (16u)
+
+/* Every frame is a header, a payload of header.length bytes and the
+ * Fletcher-16 checksum of both */
+#define ML_SW_CHECKSUM_SIZE     (2u)
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+typedef struct
+{
+    uint16_t magic;
+    uint8_t  type;
+    uint8_t  count;         /* Samples in the frame */
+    uint16_t seq;           /* Index of the first sample, modulo 2^16 */
+    uint16_t length;        /* Payload bytes */
+} ml_sw_frame_header_t;
+
+typedef struct
+{
+    uint32_t num_of_samples;
+    uint16_t window;        /* Samples the host wants in flight */
+    uint16_t coalesce;      /* Outputs per OUTPUT frame */
+    uint8_t  output_mode;   /* ML_SW_OUTPUT_x */
+    uint8_t  top_k;         /* Indices per output in TOP_K mode */
+    uint16_t reserved;
+} ml_sw_config_t;
+
+typedef struct
+{
+    uint32_t input_size;    /* Elements per sample */
+    uint32_t output_size;   /* Elements per output */
+    uint16_t data_type;     /* 1: float32, 2: int8, 3: int16 */
+    uint16_t window;        /* Granted window */
+    uint16_t coalesce;      /* Granted outputs per frame */
+    uint8_t  output_mode;   /* Granted output mode */
+    uint8_t  top_k;         /* Granted indices per output */
+} ml_sw_ack_t;
+
+/* Device side of a windowed session. Up to window SAMPLE frames are received
+ * in the background into a ring of slots, while the outputs are gathered into
+ * a single OUTPUT frame. */
+typedef struct
+{
+    cyhal_uart_t        *uart;
+    uint8_t             *rx_slots;
+    uint8_t             *tx_frame;
+    uint32_t            rx_frame_size;
+    uint32_t            output_bytes;   /* Bytes per output in the frame */
+    uint32_t            output_size;    /* Elements of the output tensor */
+    uint32_t            elem_size;
+    uint32_t            data_type;
+    uint32_t            output_mode;
+    uint32_t            top_k;
+    uint32_t            num_of_samples;
+    uint32_t            window;
+    uint32_t            coalesce;
+    uint32_t            timeout_ms;
+    volatile uint32_t   rx_head;        /* Slot being received */
+    volatile uint32_t   rx_count;       /* Slots received, not yet released */
+    volatile bool       rx_posted;
+    volatile uint32_t   rx_requested;   /* SAMPLE frames requested so far */
+    uint32_t            rx_tail;        /* Slot handed to the inference */
+    uint32_t            received;
+    uint32_t            tx_count;
+    uint32_t            sent;
+} ml_stream_window_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+cy_rslt_t ml_stream_window_open(ml_stream_window_t *sw, cyhal_uart_t *uart,
+                                uint32_t input_size, uint32_t output_size,
+                                uint32_t elem_size, uint16_t data_type,
+                                uint32_t timeout_ms);
+const void *ml_stream_window_get_input(ml_stream_window_t *sw);
+cy_rslt_t ml_stream_window_put_output(ml_stream_window_t *sw, const void *output);
+cy_rslt_t ml_stream_window_finish(ml_stream_window_t *sw);
+void ml_stream_window_close(ml_stream_window_t *sw);
+
+#endif /* ML_STREAM_WINDOW_H */
+
+/* [] END OF FILE */
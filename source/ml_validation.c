@@ -40,77 +40,1303 @@
 * so agrees to indemnify Cypress against all liability.
 *******************************************************************************/
 #include "ml_validation.h"
+#include "ml_regression.h"
+#include "elapsed_timer.h"
+#include "ml_boot_profile.h"
+#ifdef ML_STREAM_WINDOWED
+#include "ml_stream_window.h"
+#endif
+#ifdef ML_WARMUP_PROFILE
+/* Cold and warm inferences reported apart */
+#include "ml_warmup.h"
+#endif
+#ifdef ML_LAYER_PROFILE
+/* Cycles of each node of the tflm_less model */
+#include "ml_layer_profile.h"
+#endif
+#ifdef ML_ARENA_REPORT
+/* Tensor arena used by the tflm interpreter, of the size set by the model */
+#include "ml_arena.h"
+#include MTB_ML_INCLUDE_MODEL_FILE(MODEL_NAME)
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
+#include <math.h>
+
+#define ML_VALIDATION_STR_(x)       #x
+#define ML_VALIDATION_STR(x)        ML_VALIDATION_STR_(x)
+#define ML_VALIDATION_CAT_(a, b)    a##b
+#define ML_VALIDATION_CAT(a, b)     ML_VALIDATION_CAT_(a, b)
+#define ML_VALIDATION_COUNT_OF(a)   (sizeof(a) / sizeof((a)[0]))
 
 #ifndef USE_STREAM_DATA
+#ifdef ML_PREDICT_ARGMAX
+/* The interpreter-less model can stop before its monotonic tail layers */
+#include MTB_ML_INCLUDE_MODEL_FILE(MODEL_NAME)
+#if defined(RNN_STREAMING)
+#error "ML_PREDICT_MODE=argmax does not support RNN models"
+#endif
+#endif /* ML_PREDICT_ARGMAX */
+
 /* Include regression files */
+#ifdef ML_REGRESSION_FLOAT_MASTER
+/* Float regression data quantized on the fly to the model input type */
+#include "ml_quantize.h"
+#include ML_VALIDATION_STR(ML_VALIDATION_CAT(MODEL_NAME, _tflm_x_data_float).h)
+#ifndef ML_REGRESSION_V3
+#include ML_VALIDATION_STR(ML_VALIDATION_CAT(MODEL_NAME, _tflm_y_data_float).h)
+#endif
+typedef float REGRESSION_DATA_T;
+#else
 #include MTB_ML_INCLUDE_MODEL_X_DATA_FILE(MODEL_NAME)
+#ifndef ML_REGRESSION_V3
 #include MTB_ML_INCLUDE_MODEL_Y_DATA_FILE(MODEL_NAME)
 #endif
+typedef MTB_ML_DATA_T REGRESSION_DATA_T;
+#endif /* ML_REGRESSION_FLOAT_MASTER */
+#ifdef ML_REGRESSION_PREFETCH
+/* Raw samples are staged in SRAM by DMA while the previous one is inferred */
+#include "ml_prefetch.h"
+#endif /* ML_REGRESSION_PREFETCH */
+#if defined(ML_SPARSE_FC) || defined(ML_SPARSE_INPUT) || defined(ML_INT4_FC) || defined(ML_PER_CHANNEL_FC)
+/* Fully connected layers with other weight formats, profiled against the model */
+#define ML_FC_KERNELS
+#include "ml_sparse_fc.h"
+#include ML_VALIDATION_STR(ML_VALIDATION_CAT(MODEL_NAME, _sparse_fc_int8x8).h)
+#define ML_VALIDATION_FC_DENSE          ML_VALIDATION_CAT(MODEL_NAME, _fc_dense)
+#if !defined(COMPONENT_ML_INT8x8) || defined(RNN_STREAMING) || defined(ML_REGRESSION_FLOAT_MASTER)
+#error "ML_SPARSE_FC, ML_SPARSE_INPUT, ML_INT4_FC and ML_PER_CHANNEL_FC support int8x8 non-RNN models with native regression data"
+#endif
+#endif /* ML_SPARSE_FC || ML_SPARSE_INPUT || ML_INT4_FC || ML_PER_CHANNEL_FC */
+#ifdef ML_SOFTMAX_LUT
+/* Softmax with lookup tables in flash, profiled against the model softmax */
+#include MTB_ML_INCLUDE_MODEL_FILE(MODEL_NAME)
+#include "ml_softmax_s16.h"
+#include ML_VALIDATION_STR(ML_VALIDATION_CAT(MODEL_NAME, _softmax_lut_int16x8).h)
+#define ML_VALIDATION_SOFTMAX           ML_VALIDATION_CAT(MODEL_NAME, _softmax)
+#if !defined(COMPONENT_ML_INT16x8) || defined(RNN_STREAMING)
+#error "ML_SOFTMAX_LUT supports int16x8 non-RNN models"
+#endif
+/* Largest difference with the model output, in LSBs, for a sample to pass */
+#ifndef ML_SOFTMAX_LUT_TOLERANCE
+#define ML_SOFTMAX_LUT_TOLERANCE    (0)
+#endif
+#endif /* ML_SOFTMAX_LUT */
+#if defined(ML_FLOAT_FC) || defined(ML_FP16_FC)
+/* Float fully connected layers unrolled for the FPU, profiled against the model */
+#define ML_FLOAT_FC_KERNELS
+#include "ml_fc_f32.h"
+#include ML_VALIDATION_STR(ML_VALIDATION_CAT(MODEL_NAME, _fc_float).h)
+#define ML_VALIDATION_FC_F32            ML_VALIDATION_CAT(MODEL_NAME, _fc_float)
+#if !defined(COMPONENT_ML_FLOAT32) || defined(RNN_STREAMING)
+#error "ML_FLOAT_FC and ML_FP16_FC support float non-RNN models"
+#endif
+#endif /* ML_FLOAT_FC || ML_FP16_FC */
+#ifdef ML_BENCHMARK
+/* Interpreter-less models of several types linked in one image, run on the
+ * same float samples as the configured model */
+#include "ml_benchmark.h"
+#include ML_VALIDATION_STR(ML_VALIDATION_CAT(MODEL_NAME, _benchmark).h)
+#define ML_VALIDATION_BENCH_VARIANTS    ML_VALIDATION_CAT(MODEL_NAME, _benchmark_variants)
+#define ML_VALIDATION_BENCH_COUNT       ML_VALIDATION_CAT(MODEL_NAME, _BENCHMARK_NUM_OF_VARIANTS)
+#if !(defined(ML_REGRESSION_FLOAT_MASTER) || defined(COMPONENT_ML_FLOAT32)) || defined(RNN_STREAMING)
+#error "ML_BENCHMARK supports non-RNN models with float regression data (ML_REGRESSION_TYPE=float)"
+#endif
+#if defined(COMPONENT_ML_IFX)
+#error "ML_BENCHMARK links the TFLM kernels, use the tflm or tflm_less inference engine"
+#endif
+#endif /* ML_BENCHMARK */
+#endif
 
 /*******************************************************************************
 * Constants
 *******************************************************************************/
-#define SUCCESS_RATE       (98.0f)
-
-/* Timeout value for streaming */
-#define DEFAULT_TIMEOUT_MS (5000u)
+#define SUCCESS_RATE       (98.0f)
+
+/* Timeout value for streaming */
+#define DEFAULT_TIMEOUT_MS (5000u)
+
+/* Data type announced to the host by the windowed streaming protocol */
+#if defined(COMPONENT_ML_FLOAT32)
+#define STREAM_DATA_TYPE   ML_REG_TYPE_FLOAT32
+#elif defined(COMPONENT_ML_INT16x8)
+#define STREAM_DATA_TYPE   ML_REG_TYPE_INT16
+#else
+#define STREAM_DATA_TYPE   ML_REG_TYPE_INT8
+#endif
+
+/* Subset of the local regression data to run: REGRESSION_SAMPLE_COUNT samples
+ * starting at REGRESSION_FIRST_SAMPLE, taking one every REGRESSION_SAMPLE_STRIDE.
+ * A count of zero runs all the samples available. */
+#ifndef REGRESSION_FIRST_SAMPLE
+#define REGRESSION_FIRST_SAMPLE  (0u)
+#endif
+#ifndef REGRESSION_SAMPLE_STRIDE
+#define REGRESSION_SAMPLE_STRIDE (1u)
+#endif
+#ifndef REGRESSION_SAMPLE_COUNT
+#define REGRESSION_SAMPLE_COUNT  (0u)
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+#ifndef USE_STREAM_DATA
+#ifdef ML_REGRESSION_PREFETCH
+/* Raw samples copied to SRAM by DMA, one sample ahead of the inference */
+typedef struct
+{
+    ml_prefetch_t          dma;
+    ml_regression_iter_t   iter;        /* Lookahead iterator */
+    bool                   enabled;     /* Compressed samples are decoded instead */
+} ml_validation_prefetch_t;
+#endif /* ML_REGRESSION_PREFETCH */
+
+/* Buffers allocated by the local regression task */
+typedef struct
+{
+    uint8_t        *decode_window;
+    uint32_t       decode_window_size;
+    MTB_ML_DATA_T  *quantized_input;
+    MTB_ML_DATA_T  *input_slice;
+#ifdef ML_REGRESSION_PREFETCH
+    ml_validation_prefetch_t prefetch;
+#endif /* ML_REGRESSION_PREFETCH */
+#ifdef ML_FC_KERNELS
+    void           *fc_scratch;
+    int8_t         *fc_output;
+#endif /* ML_FC_KERNELS */
+#ifdef ML_SOFTMAX_LUT
+    int16_t        *softmax_output;
+#endif /* ML_SOFTMAX_LUT */
+#ifdef ML_FLOAT_FC_KERNELS
+    void           *fc_f32_scratch;
+#endif /* ML_FLOAT_FC_KERNELS */
+} ml_validation_local_buffers_t;
+
+#ifdef ML_PREDICT_ARGMAX
+/* Statistics of the argmax path */
+typedef struct
+{
+    uint64_t               cycles;
+    uint32_t               mismatch;    /* Predictions that differ from the full path */
+} ml_validation_argmax_stats_t;
+#endif /* ML_PREDICT_ARGMAX */
+
+#ifdef ML_FC_KERNELS
+/* Fully connected layers in one weight format, and their statistics */
+typedef struct
+{
+    const char             *name;
+    const ml_fc_s8_model_t *model;
+    uint64_t               cycles;
+    uint32_t               mismatch;    /* Predictions that differ from the model */
+    uint32_t               correct;     /* Predictions that match the expected class */
+} ml_validation_fc_variant_t;
+#endif /* ML_FC_KERNELS */
+
+#ifdef ML_SPARSE_INPUT
+/* Statistics of the first layer, with and without skipping the input blocks
+ * equal to the zero point */
+typedef struct
+{
+    uint64_t               dense_cycles;
+    uint64_t               skip_cycles;
+    uint32_t               active_blocks;   /* Blocks that differ from the zero point */
+    uint32_t               skip_count;      /* Samples that took the skipping path */
+} ml_validation_sparse_input_stats_t;
+#endif /* ML_SPARSE_INPUT */
+
+#ifdef ML_SOFTMAX_LUT
+/* Statistics of the LUT softmax */
+typedef struct
+{
+    uint64_t               cycles;
+    int32_t                max_diff;    /* Largest difference with the model output */
+    uint32_t               mismatch;    /* Samples over ML_SOFTMAX_LUT_TOLERANCE */
+} ml_validation_softmax_stats_t;
+#endif /* ML_SOFTMAX_LUT */
+
+#ifdef ML_FLOAT_FC_KERNELS
+/* Float fully connected layers in one weight format, and their statistics */
+typedef struct
+{
+    const char              *name;
+    const ml_fc_f32_model_t *model;
+    uint64_t                cycles;
+    uint32_t                mismatch;   /* Predictions that differ from the model */
+    uint32_t                correct;    /* Predictions that match the expected class */
+    float                   max_diff;   /* Largest difference with the model output */
+} ml_validation_f32_variant_t;
+#endif /* ML_FLOAT_FC_KERNELS */
+
+#ifdef ML_BENCHMARK
+/* Statistics of one benchmark variant */
+typedef struct
+{
+    uint64_t               cycles;
+    uint32_t               correct;     /* Predictions that match the expected class */
+} ml_validation_bench_stats_t;
+#endif /* ML_BENCHMARK */
+#endif /* USE_STREAM_DATA */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* NN Model Object */
+static mtb_ml_model_t *model_obj;
+
+/* Output/result buffers for the inference engine */
+static MTB_ML_DATA_T *result_buffer;
+
+/* Model Output Size */
+static int model_output_size;
+
+#ifdef ML_WARMUP_PROFILE
+/* Cycles of the inferences since the model initialization */
+static ml_warmup_t warmup;
+#endif /* ML_WARMUP_PROFILE */
+
+#ifdef ML_ARENA_REPORT
+/* Tensor arena of TEST_MODEL_ARENA_SIZE bytes, given to the interpreter instead
+ * of the one allocated by the middleware, so the bytes it used can be found */
+static uint32_t tensor_arena[ML_VALIDATION_CAT(MODEL_NAME, _ARENA_SIZE) / sizeof(uint32_t)]
+    __attribute__((aligned(16)));
+#endif /* ML_ARENA_REPORT */
+
+/*******************************************************************************
+* Function Name: ml_validation_init
+********************************************************************************
+* Summary:
+*   Initialize the Neural Network based on the given model and setup to start
+*   regression of the model and profiling configuration.
+*
+* Parameters:
+*   profile_cfg: profiling configuration
+*   model_bin: pointer to the model data
+*
+* Return:
+*   cy_rslt_t: the status of the initialization.
+*******************************************************************************/
+cy_rslt_t ml_validation_init(mtb_ml_profile_config_t profile_cfg,
+                             mtb_ml_model_bin_t *model_bin)
+{
+    cy_rslt_t result;
+    const mtb_ml_model_buffer_t *model_buffer = NULL;
+#ifdef ML_ARENA_REPORT
+    ml_arena_usage_t arena_usage;
+    static const mtb_ml_model_buffer_t arena_buffer = {
+        .tensor_arena = (uint8_t *) tensor_arena,
+        .tensor_arena_size = sizeof(tensor_arena),
+    };
+
+    ml_arena_fill(tensor_arena, sizeof(tensor_arena));
+    model_buffer = &arena_buffer;
+#endif /* ML_ARENA_REPORT */
+
+    /* Initialize the neural network */
+    ML_BOOT_PHASE_BEGIN("mtb_ml_model_init", ML_BOOT_PROFILE_NO_INDEX);
+    result = mtb_ml_model_init(model_bin,
+                               model_buffer,
+                               &model_obj);
+    ML_BOOT_PHASE_END();
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("MTB ML initialization failure: %lu\r\n", (unsigned long) result);
+#ifdef ML_ARENA_REPORT
+        ml_arena_log_init_failure(sizeof(tensor_arena));
+#endif /* ML_ARENA_REPORT */
+        return result;
+    }
+
+#ifdef ML_ARENA_REPORT
+    /* The prepare of the operators is done, the tail holds the persistent
+     * data. The head is only written by the inferences. */
+    ml_arena_get_usage(tensor_arena, sizeof(tensor_arena), &arena_usage);
+    ml_arena_log("after prepare", &arena_usage);
+#endif /* ML_ARENA_REPORT */
+
+    mtb_ml_model_profile_config(model_obj, profile_cfg);
+
+    mtb_ml_model_get_output(model_obj, &result_buffer, &model_output_size);
+
+#ifdef ML_WARMUP_PROFILE
+    /* The next inference is the first one with a cold cache */
+    ml_warmup_init(&warmup);
+#endif /* ML_WARMUP_PROFILE */
+#ifdef ML_LAYER_PROFILE
+    ml_layer_profile_init();
+#endif /* ML_LAYER_PROFILE */
+
+    /* Print information about the model */
+    ML_BOOT_PHASE_BEGIN("mtb_ml_utils_print_model_info", ML_BOOT_PROFILE_NO_INDEX);
+    mtb_ml_utils_print_model_info(model_obj);
+    ML_BOOT_PHASE_END();
+
+    return CY_RSLT_SUCCESS;
+}
+
+#ifdef ML_ARENA_REPORT
+/*******************************************************************************
+* Function Name: ml_validation_arena_log
+********************************************************************************
+* Summary:
+*   Print the tensor arena used by the model after the inferences, which have
+*   written the tensors of the memory plan and the scratch buffers.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_arena_log(void)
+{
+    ml_arena_usage_t arena_usage;
+
+    ml_arena_get_usage(tensor_arena, sizeof(tensor_arena), &arena_usage);
+    ml_arena_log("after the inferences", &arena_usage);
+}
+#endif /* ML_ARENA_REPORT */
+
+#ifndef USE_STREAM_DATA
+#ifndef ML_REGRESSION_V3
+/*******************************************************************************
+* Function Name: ml_validation_find_max
+********************************************************************************
+* Summary:
+*   Return the index of the largest value of the reference output.
+*
+* Parameters:
+*   data: reference output
+*   size: number of values
+*
+* Return:
+*   int: index of the largest value.
+*******************************************************************************/
+static int ml_validation_find_max(const REGRESSION_DATA_T *data, int size)
+{
+    int max_idx = 0;
+
+    for (int i = 1; i < size; i++)
+    {
+        if (data[i] > data[max_idx])
+        {
+            max_idx = i;
+        }
+    }
+
+    return max_idx;
+}
+#endif /* ML_REGRESSION_V3 */
+
+/*******************************************************************************
+* Function Name: ml_validation_free_buffers
+********************************************************************************
+* Summary:
+*   Release the buffers allocated by the local regression task.
+*
+* Parameters:
+*   buffers: buffers to release
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_free_buffers(ml_validation_local_buffers_t *buffers)
+{
+    free(buffers->decode_window);
+    free(buffers->quantized_input);
+    free(buffers->input_slice);
+#ifdef ML_REGRESSION_PREFETCH
+    ml_prefetch_free(&buffers->prefetch.dma);
+#endif /* ML_REGRESSION_PREFETCH */
+#ifdef ML_FC_KERNELS
+    free(buffers->fc_scratch);
+    free(buffers->fc_output);
+#endif /* ML_FC_KERNELS */
+#ifdef ML_SOFTMAX_LUT
+    free(buffers->softmax_output);
+#endif /* ML_SOFTMAX_LUT */
+#ifdef ML_FLOAT_FC_KERNELS
+    free(buffers->fc_f32_scratch);
+#endif /* ML_FLOAT_FC_KERNELS */
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_alloc_buffers
+********************************************************************************
+* Summary:
+*   Allocate the buffers of the sample decoding, of the quantization and of
+*   the kernels compared with the model. The buffers are released on failure.
+*
+* Parameters:
+*   buffers: buffers to allocate, zeroed
+*   regression: regression data
+*   input_size: number of values in a sample
+*
+* Return:
+*   cy_rslt_t: the status of the allocation.
+*******************************************************************************/
+static cy_rslt_t ml_validation_alloc_buffers(ml_validation_local_buffers_t *buffers,
+                                             const ml_regression_t *regression, int input_size)
+{
+    /* Compressed samples are decoded one at a time into a small SRAM window */
+    if (ml_regression_is_compressed(regression))
+    {
+        buffers->decode_window_size = ml_regression_sample_bytes(regression);
+        buffers->decode_window = (uint8_t *) malloc(buffers->decode_window_size);
+        if (buffers->decode_window == NULL)
+        {
+            printf("ERROR: Allocating memory for decode window\r\n");
+            ml_validation_free_buffers(buffers);
+            return MTB_ML_RESULT_ALLOC_ERR;
+        }
+    }
+
+#ifdef ML_REGRESSION_FLOAT_MASTER
+    /* Float samples are quantized to the model input type */
+    buffers->quantized_input = (MTB_ML_DATA_T *) malloc(input_size * sizeof(MTB_ML_DATA_T));
+    if (buffers->quantized_input == NULL)
+    {
+        printf("ERROR: Allocating memory for quantized input\r\n");
+        ml_validation_free_buffers(buffers);
+        return MTB_ML_RESULT_ALLOC_ERR;
+    }
+#else
+    CY_UNUSED_PARAMETER(input_size);
+#endif /* ML_REGRESSION_FLOAT_MASTER */
+
+#ifdef ML_FC_KERNELS
+    buffers->fc_scratch = malloc(ml_fc_s8_scratch_size(&ML_VALIDATION_FC_DENSE));
+    buffers->fc_output = (int8_t *) malloc(ML_VALIDATION_FC_DENSE.max_width);
+    if ((buffers->fc_scratch == NULL) || (buffers->fc_output == NULL))
+    {
+        printf("ERROR: Allocating memory for the sparse FC buffers\r\n");
+        ml_validation_free_buffers(buffers);
+        return MTB_ML_RESULT_ALLOC_ERR;
+    }
+#endif /* ML_FC_KERNELS */
+
+#ifdef ML_SOFTMAX_LUT
+    if ((ML_VALIDATION_SOFTMAX.num_of_rows * ML_VALIDATION_SOFTMAX.row_size) != (uint32_t) model_output_size)
+    {
+        printf("ERROR: The softmax tables do not match the model output\r\n");
+        ml_validation_free_buffers(buffers);
+        return MTB_ML_RESULT_BAD_MODEL;
+    }
+    buffers->softmax_output = (int16_t *) malloc(model_output_size * sizeof(int16_t));
+    if (buffers->softmax_output == NULL)
+    {
+        printf("ERROR: Allocating memory for the softmax output\r\n");
+        ml_validation_free_buffers(buffers);
+        return MTB_ML_RESULT_ALLOC_ERR;
+    }
+#endif /* ML_SOFTMAX_LUT */
+
+#ifdef ML_FLOAT_FC_KERNELS
+    buffers->fc_f32_scratch = malloc(ml_fc_f32_scratch_size(&ML_VALIDATION_FC_F32));
+    if (buffers->fc_f32_scratch == NULL)
+    {
+        printf("ERROR: Allocating memory for the float FC buffers\r\n");
+        ml_validation_free_buffers(buffers);
+        return MTB_ML_RESULT_ALLOC_ERR;
+    }
+#endif /* ML_FLOAT_FC_KERNELS */
+
+    return CY_RSLT_SUCCESS;
+}
+
+#ifdef ML_REGRESSION_PREFETCH
+/*******************************************************************************
+* Function Name: ml_validation_prefetch_init
+********************************************************************************
+* Summary:
+*   Start copying the first sample of the iteration from flash to SRAM. Raw
+*   samples are then copied one sample ahead of the inference, compressed
+*   samples are already decoded into SRAM and are not prefetched.
+*
+* Parameters:
+*   prefetch: prefetch state, zeroed
+*   regression: regression data
+*   iter: iterator of the inferences, not started
+*
+* Return:
+*   cy_rslt_t: the status of the DMA setup.
+*******************************************************************************/
+static cy_rslt_t ml_validation_prefetch_init(ml_validation_prefetch_t *prefetch,
+                                             const ml_regression_t *regression,
+                                             const ml_regression_iter_t *iter)
+{
+    uint32_t  sample_idx;
+    cy_rslt_t result;
+
+    if (ml_regression_is_compressed(regression))
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    result = ml_prefetch_init(&prefetch->dma, ml_regression_sample_bytes(regression));
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("ERROR: Initializing the sample prefetch\r\n");
+        return result;
+    }
+    prefetch->enabled = true;
+
+    /* Lookahead iterator, one sample ahead of the inference */
+    prefetch->iter = *iter;
+    if (ml_regression_iter_next(&prefetch->iter, &sample_idx))
+    {
+        ml_prefetch_start(&prefetch->dma, ml_regression_get_sample(regression, sample_idx, NULL, 0));
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_prefetch_next
+********************************************************************************
+* Summary:
+*   Take the sample staged in SRAM and start copying the next one.
+*
+* Parameters:
+*   prefetch: prefetch state
+*   regression: regression data
+*
+* Return:
+*   const void *: the staged sample.
+*******************************************************************************/
+static const void *ml_validation_prefetch_next(ml_validation_prefetch_t *prefetch,
+                                               const ml_regression_t *regression)
+{
+    const void *sample = ml_prefetch_wait(&prefetch->dma);
+    uint32_t   sample_idx;
+
+    if (ml_regression_iter_next(&prefetch->iter, &sample_idx))
+    {
+        ml_prefetch_start(&prefetch->dma, ml_regression_get_sample(regression, sample_idx, NULL, 0));
+    }
+    return sample;
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_prefetch_log
+********************************************************************************
+* Summary:
+*   Print the waits of the inferences on the sample copies, and the copies
+*   done synchronously because the DMA refused them. These copies did not
+*   overlap the inference, so the run does not measure the prefetch.
+*
+* Parameters:
+*   prefetch: prefetch state
+*   total_count: number of samples run
+*
+* Return:
+*   bool: false if a copy was done synchronously.
+*******************************************************************************/
+static bool ml_validation_prefetch_log(const ml_validation_prefetch_t *prefetch, uint32_t total_count)
+{
+    if (!prefetch->enabled)
+    {
+        return true;
+    }
+
+    printf("\r\nRegression data prefetch: stalls=%lu/%lu, stall cycles=%lu, synchronous copies=%lu\r\n",
+           (unsigned long) prefetch->dma.stall_count,
+           (unsigned long) total_count,
+           (unsigned long) prefetch->dma.stall_cycles,
+           (unsigned long) prefetch->dma.fallback_count);
+    if (prefetch->dma.fallback_count != 0u)
+    {
+        printf("ERROR: The DMA refused %lu sample copies, the prefetch was not measured\r\n",
+               (unsigned long) prefetch->dma.fallback_count);
+        return false;
+    }
+    return true;
+}
+#endif /* ML_REGRESSION_PREFETCH */
+
+/*******************************************************************************
+* Function Name: ml_validation_get_sample
+********************************************************************************
+* Summary:
+*   Return a regression sample in memory that the inference can read: the
+*   sample prefetched to SRAM, the sample decoded into the decode window, or
+*   the raw sample in flash. Decoding is timed apart, so it is not accounted
+*   as inference time.
+*
+* Parameters:
+*   regression: regression data
+*   sample_idx: index of the sample
+*   buffers: buffers of the local regression task
+*   decode_cycles: cycles of the decoding, accumulated
+*
+* Return:
+*   const REGRESSION_DATA_T *: the sample, NULL if it cannot be read.
+*******************************************************************************/
+static const REGRESSION_DATA_T *ml_validation_get_sample(const ml_regression_t *regression,
+                                                         uint32_t sample_idx,
+                                                         ml_validation_local_buffers_t *buffers,
+                                                         uint64_t *decode_cycles)
+{
+    const REGRESSION_DATA_T *sample;
+    uint64_t start_tick;
+    uint64_t end_tick;
+
+#ifdef ML_REGRESSION_PREFETCH
+    if (buffers->prefetch.enabled)
+    {
+        return (const REGRESSION_DATA_T *) ml_validation_prefetch_next(&buffers->prefetch, regression);
+    }
+#endif /* ML_REGRESSION_PREFETCH */
+
+    elapsed_timer_get_tick(&start_tick);
+    sample = (const REGRESSION_DATA_T *) ml_regression_get_sample(regression, sample_idx,
+                                                                  buffers->decode_window,
+                                                                  buffers->decode_window_size);
+    elapsed_timer_get_tick(&end_tick);
+    *decode_cycles += end_tick - start_tick;
+    return sample;
+}
+
+#ifdef ML_REGRESSION_FLOAT_MASTER
+/*******************************************************************************
+* Function Name: ml_validation_quantize
+********************************************************************************
+* Summary:
+*   Quantize a float sample with the input tensor parameters, right before the
+*   inference.
+*
+* Parameters:
+*   sample: float sample
+*   output: quantized sample
+*   size: number of values
+*   quantize_cycles: cycles of the quantization, accumulated
+*
+* Return:
+*   const MTB_ML_DATA_T *: the quantized sample.
+*******************************************************************************/
+static const MTB_ML_DATA_T *ml_validation_quantize(const float *sample, MTB_ML_DATA_T *output, int size,
+                                                   uint64_t *quantize_cycles)
+{
+    uint64_t start_tick;
+    uint64_t end_tick;
+
+    elapsed_timer_get_tick(&start_tick);
+#if defined(COMPONENT_ML_INT16x8)
+    ml_quantize_s16(sample, output, size, model_obj->input_scale, model_obj->input_zero_point);
+#else
+    ml_quantize_s8(sample, output, size, model_obj->input_scale, model_obj->input_zero_point);
+#endif /* COMPONENT_ML_INT16x8 */
+    elapsed_timer_get_tick(&end_tick);
+    *quantize_cycles += end_tick - start_tick;
+    return output;
+}
+#endif /* ML_REGRESSION_FLOAT_MASTER */
+
+/*******************************************************************************
+* Function Name: ml_validation_model_run
+********************************************************************************
+* Summary:
+*   Run the model on a sample and return the index of its largest output. An
+*   RNN model runs once per time step, and the inference is the whole
+*   sequence. The inference and the scan of the output are timed together.
+*
+* Parameters:
+*   input: model input, all the time steps of an RNN model
+*   input_slice: input of one time step of an RNN model
+*   input_size: number of inputs of the model
+*   cycles: cycles of the inference, accumulated
+*   predicted_label: index of the largest output
+*
+* Return:
+*   cy_rslt_t: the status of the inference.
+*******************************************************************************/
+static cy_rslt_t ml_validation_model_run(const MTB_ML_DATA_T *input, MTB_ML_DATA_T *input_slice,
+                                         int input_size, uint64_t *cycles, int *predicted_label)
+{
+    uint64_t  start_tick;
+    uint64_t  end_tick;
+    cy_rslt_t result;
+
+#if defined(RNN_STREAMING)
+    result = mtb_ml_model_rnn_reset_all_parameters(model_obj);
+    if (MTB_ML_RESULT_SUCCESS != result)
+    {
+        printf("ERROR: failed to reset model parameters\r\n");
+        return MTB_ML_RESULT_INFERENCE_ERROR;
+    }
+
+    elapsed_timer_get_tick(&start_tick);
+    for (int i = 0; i < model_obj->recurrent_ts_size; i++)
+    {
+        /* Input data is 2D array squashed to 1D array by Coretools */
+        for (int z = 0; z < input_size; z++)
+        {
+            input_slice[z] = input[i*input_size+z];
+        }
+
+        result = mtb_ml_model_run(model_obj, input_slice);
+
+        /* Check if the inferencing return any error */
+        if (MTB_ML_RESULT_SUCCESS != result)
+        {
+            return result;
+        }
+    }
+#else
+    CY_UNUSED_PARAMETER(input_slice);
+    CY_UNUSED_PARAMETER(input_size);
+
+    elapsed_timer_get_tick(&start_tick);
+    result = mtb_ml_model_run(model_obj, (MTB_ML_DATA_T *) input);
+
+    /* Check if the inferencing return any error */
+    if (MTB_ML_RESULT_SUCCESS != result)
+    {
+        return result;
+    }
+#endif /* RNN_STREAMING */
+    *predicted_label = mtb_ml_utils_find_max(result_buffer, model_output_size);
+    elapsed_timer_get_tick(&end_tick);
+    *cycles += end_tick - start_tick;
+#ifdef ML_WARMUP_PROFILE
+    ml_warmup_add(&warmup, end_tick - start_tick);
+#endif /* ML_WARMUP_PROFILE */
+
+    return CY_RSLT_SUCCESS;
+}
+
+#ifdef ML_PREDICT_ARGMAX
+/*******************************************************************************
+* Function Name: ml_validation_argmax_run
+********************************************************************************
+* Summary:
+*   Run the layers of the model up to the last one that can change the order
+*   of the scores, take the index of the largest score, and compare it with
+*   the prediction of the full path.
+*
+* Parameters:
+*   stats: statistics of the argmax path
+*   input: model input
+*   full_label: class predicted by the full path
+*   predicted_label: class predicted by the argmax path
+*
+* Return:
+*   cy_rslt_t: the status of the inference.
+*******************************************************************************/
+static cy_rslt_t ml_validation_argmax_run(ml_validation_argmax_stats_t *stats, const MTB_ML_DATA_T *input,
+                                          int full_label, int *predicted_label)
+{
+    uint64_t start_tick;
+    uint64_t end_tick;
+
+    elapsed_timer_get_tick(&start_tick);
+    memcpy(ML_VALIDATION_CAT(MODEL_NAME, _input_ptr)(0), input,
+           ML_VALIDATION_CAT(MODEL_NAME, _input_size)(0));
+    if (kTfLiteOk != ML_VALIDATION_CAT(MODEL_NAME, _invoke_classify)(predicted_label))
+    {
+        return MTB_ML_RESULT_INFERENCE_ERROR;
+    }
+    elapsed_timer_get_tick(&end_tick);
+    stats->cycles += end_tick - start_tick;
+
+    if (*predicted_label != full_label)
+    {
+        stats->mismatch++;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_argmax_log
+********************************************************************************
+* Summary:
+*   Print the cycles of the full path and of the argmax path.
+*
+* Parameters:
+*   stats: statistics of the argmax path
+*   full_cycles: cycles of the full path
+*   total_count: number of samples run
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_argmax_log(const ml_validation_argmax_stats_t *stats, uint64_t full_cycles,
+                                     uint32_t total_count)
+{
+    printf("\r\nPredicted class: full path cycles per sample=%lu, argmax path cycles per sample=%lu, mismatches=%lu\r\n",
+           (unsigned long) (full_cycles / total_count),
+           (unsigned long) (stats->cycles / total_count),
+           (unsigned long) stats->mismatch);
+}
+#endif /* ML_PREDICT_ARGMAX */
+
+#ifdef ML_FC_KERNELS
+/*******************************************************************************
+* Function Name: ml_validation_fc_run
+********************************************************************************
+* Summary:
+*   Run the fully connected layers of each weight format on a sample, and
+*   update their statistics.
+*
+* Parameters:
+*   variants: weight formats and their statistics
+*   num_of_variants: number of weight formats
+*   input: model input
+*   scratch: ml_fc_s8_scratch_size() bytes
+*   predicted_label: class predicted by the model
+*   expected_label: expected class
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_fc_run(ml_validation_fc_variant_t *variants, uint32_t num_of_variants,
+                                 const int8_t *input, void *scratch, int predicted_label, int expected_label)
+{
+    for (uint32_t v = 0; v < num_of_variants; v++)
+    {
+        ml_validation_fc_variant_t *variant = &variants[v];
+        uint64_t start_tick;
+        uint64_t end_tick;
+        int      label;
+
+        elapsed_timer_get_tick(&start_tick);
+        label = ml_fc_s8_classify(variant->model, input, scratch, 0u);
+        elapsed_timer_get_tick(&end_tick);
+        variant->cycles += end_tick - start_tick;
+
+        if (label != predicted_label)
+        {
+            variant->mismatch++;
+        }
+        if (label == expected_label)
+        {
+            variant->correct++;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_fc_log
+********************************************************************************
+* Summary:
+*   Print the statistics of each weight format, and the blocks removed from
+*   the block-sparse layers.
+*
+* Parameters:
+*   variants: weight formats and their statistics
+*   num_of_variants: number of weight formats
+*   total_count: number of samples run
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_fc_log(const ml_validation_fc_variant_t *variants, uint32_t num_of_variants,
+                                 uint32_t total_count)
+{
+    printf("\r\n");
+    for (uint32_t v = 0; v < num_of_variants; v++)
+    {
+        printf("%s FC: cycles per sample=%lu, weight bytes=%lu, mismatches=%lu, accuracy=%3.2f\r\n",
+               variants[v].name,
+               (unsigned long) (variants[v].cycles / total_count),
+               (unsigned long) variants[v].model->weight_bytes,
+               (unsigned long) variants[v].mismatch,
+               ((float) variants[v].correct) * 100.0f / ((float) total_count));
+    }
+#ifdef ML_SPARSE_FC
+    printf("Block-sparse int8 FC: zero blocks=%lu%%\r\n",
+           (unsigned long) (100u - ((100u * ml_fc_s8_num_of_blocks(&ML_VALIDATION_CAT(MODEL_NAME, _fc_sparse))) /
+                                    ml_fc_s8_num_of_blocks(&ML_VALIDATION_FC_DENSE))));
+#endif /* ML_SPARSE_FC */
+}
+#endif /* ML_FC_KERNELS */
+
+#ifdef ML_SPARSE_INPUT
+/*******************************************************************************
+* Function Name: ml_validation_sparse_input_run
+********************************************************************************
+* Summary:
+*   Run the first dense layer on a sample reading all the input blocks, then
+*   skipping the blocks equal to the zero point if they dominate, and print
+*   the input density and the cycles saved.
+*
+* Parameters:
+*   stats: statistics of the first layer
+*   input: model input
+*   buffers: buffers of the local regression task
+*   sample_idx: index of the sample
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_sparse_input_run(ml_validation_sparse_input_stats_t *stats, const int8_t *input,
+                                           const ml_validation_local_buffers_t *buffers, uint32_t sample_idx)
+{
+    const ml_fc_s8_layer_t *layer = &ML_VALIDATION_FC_DENSE.layers[0];
+    uint64_t start_tick;
+    uint64_t end_tick;
+    uint64_t dense_cycles;
+    uint64_t skip_cycles;
+    uint32_t active_blocks;
+
+    elapsed_timer_get_tick(&start_tick);
+    (void) ml_fc_s8(layer, input, buffers->fc_output, buffers->fc_scratch, 0u);
+    elapsed_timer_get_tick(&end_tick);
+    dense_cycles = end_tick - start_tick;
+
+    elapsed_timer_get_tick(&start_tick);
+    active_blocks = ml_fc_s8(layer, input, buffers->fc_output, buffers->fc_scratch,
+                             ML_FC_INPUT_DENSITY_THRESHOLD);
+    elapsed_timer_get_tick(&end_tick);
+    skip_cycles = end_tick - start_tick;
+
+    stats->dense_cycles += dense_cycles;
+    stats->skip_cycles += skip_cycles;
+    stats->active_blocks += active_blocks;
+    if ((active_blocks * 100u) < (ML_FC_INPUT_DENSITY_THRESHOLD * (layer->cols / ML_FC_BLOCK_SIZE)))
+    {
+        stats->skip_count++;
+    }
+
+    printf("Sample %lu: input density=%lu%%, first layer cycles=%lu, saved=%ld\r\n",
+           (unsigned long) sample_idx,
+           (unsigned long) ((active_blocks * 100u * ML_FC_BLOCK_SIZE) / layer->cols),
+           (unsigned long) skip_cycles,
+           (long) dense_cycles - (long) skip_cycles);
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_sparse_input_log
+********************************************************************************
+* Summary:
+*   Print the mean input density of the first layer, and its cycles with and
+*   without skipping the input blocks.
+*
+* Parameters:
+*   stats: statistics of the first layer
+*   total_count: number of samples run
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_sparse_input_log(const ml_validation_sparse_input_stats_t *stats,
+                                           uint32_t total_count)
+{
+    printf("\r\nInput sparsity: mean density=%lu%%, threshold=%lu%%, skipped on %lu/%lu samples\r\n",
+           (unsigned long) ((stats->active_blocks * 100u * ML_FC_BLOCK_SIZE) /
+                            (ML_VALIDATION_FC_DENSE.layers[0].cols * total_count)),
+           (unsigned long) ML_FC_INPUT_DENSITY_THRESHOLD,
+           (unsigned long) stats->skip_count,
+           (unsigned long) total_count);
+    printf("First layer: dense cycles per sample=%lu, input-sparse cycles per sample=%lu\r\n",
+           (unsigned long) (stats->dense_cycles / total_count),
+           (unsigned long) (stats->skip_cycles / total_count));
+}
+#endif /* ML_SPARSE_INPUT */
+
+#ifdef ML_SOFTMAX_LUT
+/*******************************************************************************
+* Function Name: ml_validation_softmax_run
+********************************************************************************
+* Summary:
+*   Run the LUT softmax on the scores left by the model, and compare it with
+*   the model output.
+*
+* Parameters:
+*   stats: statistics of the LUT softmax
+*   output: output of the LUT softmax
+*   model_output: model output, to compare with
+*   output_size: number of outputs
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_softmax_run(ml_validation_softmax_stats_t *stats, int16_t *output,
+                                      const int16_t *model_output, int output_size)
+{
+    uint64_t start_tick;
+    uint64_t end_tick;
+    int32_t  sample_diff = 0;
+
+    elapsed_timer_get_tick(&start_tick);
+    ml_softmax_s16(&ML_VALIDATION_SOFTMAX, (const int16_t *) ML_VALIDATION_CAT(MODEL_NAME, _classify_scores)(),
+                   output);
+    elapsed_timer_get_tick(&end_tick);
+    stats->cycles += end_tick - start_tick;
+
+    for (int i = 0; i < output_size; i++)
+    {
+        int32_t diff = abs((int32_t) model_output[i] - (int32_t) output[i]);
+
+        sample_diff = (diff > sample_diff) ? diff : sample_diff;
+    }
+    if (sample_diff > ML_SOFTMAX_LUT_TOLERANCE)
+    {
+        stats->mismatch++;
+    }
+    stats->max_diff = (sample_diff > stats->max_diff) ? sample_diff : stats->max_diff;
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_softmax_log
+********************************************************************************
+* Summary:
+*   Print the statistics of the LUT softmax.
+*
+* Parameters:
+*   stats: statistics of the LUT softmax
+*   total_count: number of samples run
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_softmax_log(const ml_validation_softmax_stats_t *stats, uint32_t total_count)
+{
+    printf("\r\nLUT softmax: cycles per sample=%lu, table bytes=%lu, largest difference=%ld, samples over tolerance=%lu\r\n",
+           (unsigned long) (stats->cycles / total_count),
+           (unsigned long) (2u * ML_SOFTMAX_S16_LUT_SIZE * sizeof(int16_t)),
+           (long) stats->max_diff,
+           (unsigned long) stats->mismatch);
+}
+#endif /* ML_SOFTMAX_LUT */
 
+#ifdef ML_FLOAT_FC_KERNELS
 /*******************************************************************************
-* Global Variables
+* Function Name: ml_validation_f32_run
+********************************************************************************
+* Summary:
+*   Run the float fully connected layers of each weight format on a sample,
+*   and update their statistics.
+*
+* Parameters:
+*   variants: weight formats and their statistics
+*   num_of_variants: number of weight formats
+*   input: model input
+*   scratch: ml_fc_f32_scratch_size() bytes
+*   model_output: model output, to compare with
+*   output_size: number of outputs
+*   predicted_label: class predicted by the model
+*   expected_label: expected class
+*
+* Return:
+*   void
 *******************************************************************************/
-/* NN Model Object */
-static mtb_ml_model_t *model_obj;
+static void ml_validation_f32_run(ml_validation_f32_variant_t *variants, uint32_t num_of_variants,
+                                  const float *input, void *scratch, const float *model_output,
+                                  int output_size, int predicted_label, int expected_label)
+{
+    for (uint32_t v = 0; v < num_of_variants; v++)
+    {
+        ml_validation_f32_variant_t *variant = &variants[v];
+        const float *output;
+        uint64_t    start_tick;
+        uint64_t    end_tick;
+        int         label;
 
-/* Output/result buffers for the inference engine */
-static MTB_ML_DATA_T *result_buffer;
+        elapsed_timer_get_tick(&start_tick);
+        output = ml_fc_f32_run(variant->model, input, scratch);
+        elapsed_timer_get_tick(&end_tick);
+        variant->cycles += end_tick - start_tick;
 
-/* Model Output Size */
-static int model_output_size;
+        label = mtb_ml_utils_find_max((MTB_ML_DATA_T *) output, output_size);
+        if (label != predicted_label)
+        {
+            variant->mismatch++;
+        }
+        if (label == expected_label)
+        {
+            variant->correct++;
+        }
+        for (int i = 0; i < output_size; i++)
+        {
+            float diff = fabsf(output[i] - model_output[i]);
+
+            variant->max_diff = (diff > variant->max_diff) ? diff : variant->max_diff;
+        }
+    }
+}
 
 /*******************************************************************************
-* Function Name: ml_validation_init
+* Function Name: ml_validation_f32_log
 ********************************************************************************
 * Summary:
-*   Initialize the Neural Network based on the given model and setup to start
-*   regression of the model and profiling configuration.
+*   Print the statistics of each float weight format.
 *
 * Parameters:
-*   profile_cfg: profiling configuration
-*   model_bin: pointer to the model data
+*   variants: weight formats and their statistics
+*   num_of_variants: number of weight formats
+*   total_count: number of samples run
 *
 * Return:
-*   cy_rslt_t: the status of the initialization.
+*   void
 *******************************************************************************/
-cy_rslt_t ml_validation_init(mtb_ml_profile_config_t profile_cfg,
-                             mtb_ml_model_bin_t *model_bin)
+static void ml_validation_f32_log(const ml_validation_f32_variant_t *variants, uint32_t num_of_variants,
+                                  uint32_t total_count)
 {
-    cy_rslt_t result;
+    printf("\r\n");
+    for (uint32_t v = 0; v < num_of_variants; v++)
+    {
+        printf("%s FC: cycles per sample=%lu, weight bytes=%lu, mismatches=%lu, accuracy=%3.2f, largest output difference=%e\r\n",
+               variants[v].name,
+               (unsigned long) (variants[v].cycles / total_count),
+               (unsigned long) variants[v].model->weight_bytes,
+               (unsigned long) variants[v].mismatch,
+               ((float) variants[v].correct) * 100.0f / ((float) total_count),
+               (double) variants[v].max_diff);
+    }
+}
+#endif /* ML_FLOAT_FC_KERNELS */
 
-    /* Initialize the neural network */
-    result = mtb_ml_model_init(model_bin,
-                               NULL,
-                               &model_obj);
-    if (CY_RSLT_SUCCESS != result)
+#ifdef ML_BENCHMARK
+/*******************************************************************************
+* Function Name: ml_validation_bench_init
+********************************************************************************
+* Summary:
+*   Initialize the benchmark variants.
+*
+* Parameters:
+*   void
+*
+* Return:
+*   cy_rslt_t: MTB_ML_RESULT_BAD_MODEL if a variant fails to initialize.
+*******************************************************************************/
+static cy_rslt_t ml_validation_bench_init(void)
+{
+    for (uint32_t v = 0; v < ML_VALIDATION_BENCH_COUNT; v++)
     {
-        printf("MTB ML initialization failure: %lu\r\n", (unsigned long) result);
-        return result;
+        if (kTfLiteOk != ML_VALIDATION_BENCH_VARIANTS[v].init())
+        {
+            printf("ERROR: Initializing %s\r\n", ML_VALIDATION_BENCH_VARIANTS[v].name);
+            return MTB_ML_RESULT_BAD_MODEL;
+        }
     }
+    return CY_RSLT_SUCCESS;
+}
 
-    mtb_ml_model_profile_config(model_obj, profile_cfg);
+/*******************************************************************************
+* Function Name: ml_validation_bench_run
+********************************************************************************
+* Summary:
+*   Run each benchmark variant on a float sample, quantized to its input type,
+*   and update its statistics. The quantization is not timed.
+*
+* Parameters:
+*   stats: statistics of the variants
+*   sample: float sample
+*   input_size: number of values in the sample
+*   output_size: number of classes
+*   expected_label: expected class
+*
+* Return:
+*   cy_rslt_t: the status of the inferences.
+*******************************************************************************/
+static cy_rslt_t ml_validation_bench_run(ml_validation_bench_stats_t *stats, const float *sample,
+                                         int input_size, int output_size, int expected_label)
+{
+    for (uint32_t v = 0; v < ML_VALIDATION_BENCH_COUNT; v++)
+    {
+        const ml_benchmark_variant_t *variant = &ML_VALIDATION_BENCH_VARIANTS[v];
+        uint64_t  start_tick;
+        uint64_t  end_tick;
+        cy_rslt_t result;
+        int       label;
 
-    mtb_ml_model_get_output(model_obj, &result_buffer, &model_output_size);
+        result = ml_benchmark_set_input(variant, sample, (uint32_t) input_size);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            printf("ERROR: %s does not take the regression samples\r\n", variant->name);
+            return result;
+        }
 
-    /* Print information about the model */
-    mtb_ml_utils_print_model_info(model_obj);
+        elapsed_timer_get_tick(&start_tick);
+        result = ml_benchmark_classify(variant, (uint32_t) output_size, &label);
+        elapsed_timer_get_tick(&end_tick);
+        stats[v].cycles += end_tick - start_tick;
+        if (CY_RSLT_SUCCESS != result)
+        {
+            printf("ERROR: %s inference failed\r\n", variant->name);
+            return result;
+        }
 
+        if (label == expected_label)
+        {
+            stats[v].correct++;
+        }
+    }
     return CY_RSLT_SUCCESS;
 }
 
-#ifndef USE_STREAM_DATA
+/*******************************************************************************
+* Function Name: ml_validation_bench_log_row
+********************************************************************************
+* Summary:
+*   Print the row of one variant in the benchmark table. The memory columns
+*   are only known for the linked variants.
+*
+* Parameters:
+*   name: variant name
+*   variant: linked variant, or NULL for the configured model
+*   stats: statistics of the variant
+*   total_count: number of samples run
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_bench_log_row(const char *name, const ml_benchmark_variant_t *variant,
+                                        const ml_validation_bench_stats_t *stats, uint32_t total_count)
+{
+    if (variant != NULL)
+    {
+        printf("%-20s %12lu %12lu %12lu %12lu %8.2f%%\r\n",
+               name,
+               (unsigned long) (stats->cycles / total_count),
+               (unsigned long) variant->arena_bytes,
+               (unsigned long) variant->flash_bytes,
+               (unsigned long) variant->ram_bytes,
+               ((float) stats->correct) * 100.0f / ((float) total_count));
+    }
+    else
+    {
+        printf("%-20s %12lu %12s %12s %12s %8.2f%%\r\n",
+               name,
+               (unsigned long) (stats->cycles / total_count),
+               "-", "-", "-",
+               ((float) stats->correct) * 100.0f / ((float) total_count));
+    }
+}
+
+/*******************************************************************************
+* Function Name: ml_validation_bench_log
+********************************************************************************
+* Summary:
+*   Print the benchmark table: the configured model, then each variant.
+*
+* Parameters:
+*   stats: statistics of the variants
+*   model_stats: statistics of the configured model, on its full path
+*   total_count: number of samples run
+*
+* Return:
+*   void
+*******************************************************************************/
+static void ml_validation_bench_log(const ml_validation_bench_stats_t *stats,
+                                    const ml_validation_bench_stats_t *model_stats, uint32_t total_count)
+{
+    printf("\r\n%-20s %12s %12s %12s %12s %9s\r\n",
+           "Benchmark", "Cycles", "Arena bytes", "Flash bytes", "RAM bytes", "Accuracy");
+    ml_validation_bench_log_row("Configured model", NULL, model_stats, total_count);
+    for (uint32_t v = 0; v < ML_VALIDATION_BENCH_COUNT; v++)
+    {
+        ml_validation_bench_log_row(ML_VALIDATION_BENCH_VARIANTS[v].name, &ML_VALIDATION_BENCH_VARIANTS[v],
+                                    &stats[v], total_count);
+    }
+}
+#endif /* ML_BENCHMARK */
+
 /*******************************************************************************
 * Function Name: ml_validation_local_task
 ********************************************************************************
@@ -125,38 +1351,84 @@ cy_rslt_t ml_validation_init(mtb_ml_profile_config_t profile_cfg,
 *******************************************************************************/
 cy_rslt_t ml_validation_local_task(void)
 {
-    /* Regression pointers */
-    MTB_ML_DATA_T  *input_reference;
-    MTB_ML_DATA_T  *output_reference;
-       
-    uint32_t     num_loop;
+    /* Regression data */
+    ml_regression_t        regression;
+    ml_regression_iter_t   iter;
+    const REGRESSION_DATA_T *regression_sample;
+    const MTB_ML_DATA_T    *input_reference;
+#ifndef ML_REGRESSION_V3
+    const REGRESSION_DATA_T *output_reference = (const REGRESSION_DATA_T *) MTB_ML_MODEL_Y_DATA_BIN(MODEL_NAME);
+#endif
+    ml_validation_local_buffers_t buffers = {0};
+
+    uint32_t     sample_idx;
+    uint64_t     model_cycles = 0;
+    uint64_t     decode_cycles = 0;
+    uint64_t     quantize_cycles = 0;
     uint32_t     correct_result = 0;
     bool         test_result;
     uint32_t     total_count = 0;
     cy_rslt_t    result;
     int          file_input_size;
+    int          expected_label;
+    int          predicted_label;
+#ifdef ML_PREDICT_ARGMAX
+    ml_validation_argmax_stats_t argmax_stats = {0};
+#endif /* ML_PREDICT_ARGMAX */
+#ifdef ML_SOFTMAX_LUT
+    ml_validation_softmax_stats_t softmax_stats = {0};
+#endif /* ML_SOFTMAX_LUT */
+#ifdef ML_FLOAT_FC_KERNELS
+    ml_validation_f32_variant_t f32_variants[] =
+    {
+        {"Float32", &ML_VALIDATION_FC_F32, 0, 0, 0, 0.0f},
+#ifdef ML_FP16_FC
+        {"Float16 weights", &ML_VALIDATION_CAT(MODEL_NAME, _fc_fp16), 0, 0, 0, 0.0f},
+#endif /* ML_FP16_FC */
+    };
+#endif /* ML_FLOAT_FC_KERNELS */
+#ifdef ML_BENCHMARK
+    ml_validation_bench_stats_t bench_stats[ML_VALIDATION_BENCH_COUNT] = {0};
+#endif /* ML_BENCHMARK */
+#ifdef ML_FC_KERNELS
+    ml_validation_fc_variant_t fc_variants[] =
+    {
+        {"Dense int8", &ML_VALIDATION_FC_DENSE, 0, 0, 0},
+#ifdef ML_SPARSE_FC
+        {"Block-sparse int8", &ML_VALIDATION_CAT(MODEL_NAME, _fc_sparse), 0, 0, 0},
+#endif /* ML_SPARSE_FC */
+#ifdef ML_PER_CHANNEL_FC
+        {"Per-channel int8", &ML_VALIDATION_CAT(MODEL_NAME, _fc_perchannel), 0, 0, 0},
+#endif /* ML_PER_CHANNEL_FC */
+#ifdef ML_INT4_FC
+        {"Dense int4x8", &ML_VALIDATION_CAT(MODEL_NAME, _fc_int4x8), 0, 0, 0},
+#endif /* ML_INT4_FC */
+    };
+#endif /* ML_FC_KERNELS */
+#ifdef ML_SPARSE_INPUT
+    ml_validation_sparse_input_stats_t sparse_input_stats = {0};
+#endif /* ML_SPARSE_INPUT */
     int          model_input_size = mtb_ml_model_get_input_size(model_obj);
 
     /* Parse input data information: 
      * - Data type (TFLM only)
      * - Number of samples
      * - Frame size
+     * - Chunk table, sample index and labels (v3 container only)
      */
-    mtb_ml_x_file_header_t *x_file_header = (mtb_ml_x_file_header_t *) MTB_ML_MODEL_X_DATA_BIN(MODEL_NAME);
-
-    /* Point to regression data */
-    input_reference  = (MTB_ML_DATA_T *) (((uint32_t) x_file_header) + sizeof(*x_file_header));
-    output_reference = (MTB_ML_DATA_T *) MTB_ML_MODEL_Y_DATA_BIN(MODEL_NAME);
-
-    /* Get the number of loops for this regression */
-    num_loop = x_file_header->num_of_samples;
+    result = ml_regression_open(&regression, MTB_ML_MODEL_X_DATA_BIN(MODEL_NAME), sizeof(REGRESSION_DATA_T));
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("Regression data format error: %lu, aborting...\r\n", (unsigned long) result);
+        return result;
+    }
 
     /* Get the number of inputs of the NN */
-    file_input_size = x_file_header->input_size;
+    file_input_size = (int) regression.input_size;
 
 #if defined(RNN_STREAMING)
 
-    model_obj->recurrent_ts_size = x_file_header->recurrent_ts_size;
+    model_obj->recurrent_ts_size = regression.recurrent_ts_size;
 
     /* Check if it is a non-RNN model */
     if (model_obj->recurrent_ts_size <= 0)
@@ -175,9 +1447,9 @@ cy_rslt_t ml_validation_local_task(void)
     }
 
     /* Allocate memory for the RNN input slice */
-    MTB_ML_DATA_T * input_slice = (MTB_ML_DATA_T *) malloc (model_input_size * sizeof(MTB_ML_DATA_T));
+    buffers.input_slice = (MTB_ML_DATA_T *) malloc (model_input_size * sizeof(MTB_ML_DATA_T));
 
-    if (input_slice == NULL)
+    if (buffers.input_slice == NULL)
     {
         printf("ERROR: Allocating memory for input slice\r\n");
         return MTB_ML_RESULT_ALLOC_ERR;
@@ -193,65 +1465,126 @@ cy_rslt_t ml_validation_local_task(void)
     }
 #endif /* RNN_STREAMING */
 
-    /* The following loop runs for number of examples used in regression */
-    for (int j = 0; j < num_loop; j++)
+#ifdef ML_REGRESSION_V3
+    /* The v3 container replaces the reference output with the expected labels */
+    if (!ml_regression_has_labels(&regression))
     {
+        printf("Regression data has no labels, aborting...\r\n");
+        ml_validation_free_buffers(&buffers);
+        return MTB_ML_RESULT_BAD_ARG;
+    }
+#endif /* ML_REGRESSION_V3 */
 
-#if defined(RNN_STREAMING)
-        result = mtb_ml_model_rnn_reset_all_parameters(model_obj);
-        if (MTB_ML_RESULT_SUCCESS != result)
-        {
-            printf("ERROR: failed to reset model parameters\r\n");
-            free(input_slice);
-            return MTB_ML_RESULT_INFERENCE_ERROR;
-        }
+    result = ml_validation_alloc_buffers(&buffers, &regression, file_input_size);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
 
-        for (int i = 0; i < model_obj->recurrent_ts_size; i++)
-        {
-            /* Input data is 2D array squashed to 1D array by Coretools */
-            for (int z = 0; z < model_input_size; z++)
-            {
-                input_slice[z] = input_reference[i*model_input_size+z];
-            }
+#ifdef ML_BENCHMARK
+    result = ml_validation_bench_init();
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ml_validation_free_buffers(&buffers);
+        return result;
+    }
+#endif /* ML_BENCHMARK */
 
-            result = mtb_ml_model_run(model_obj, input_slice);
+    /* The following loop runs for the subset of examples used in regression */
+    ml_regression_iter_init(&iter, &regression, REGRESSION_FIRST_SAMPLE,
+                            REGRESSION_SAMPLE_STRIDE, REGRESSION_SAMPLE_COUNT);
 
-            /* Check if the inferencing return any error */
-            if (MTB_ML_RESULT_SUCCESS != result)
-            {
-                free(input_slice);
-                return result;
-            }
+#ifdef ML_REGRESSION_PREFETCH
+    result = ml_validation_prefetch_init(&buffers.prefetch, &regression, &iter);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ml_validation_free_buffers(&buffers);
+        return result;
+    }
+#endif /* ML_REGRESSION_PREFETCH */
+
+    while (ml_regression_iter_next(&iter, &sample_idx))
+    {
+        regression_sample = ml_validation_get_sample(&regression, sample_idx, &buffers, &decode_cycles);
+        if (regression_sample == NULL)
+        {
+            printf("ERROR: failed to read regression sample %lu\r\n", (unsigned long) sample_idx);
+            ml_validation_free_buffers(&buffers);
+            return MTB_ML_RESULT_BAD_ARG;
         }
 
+#ifdef ML_REGRESSION_FLOAT_MASTER
+        input_reference = ml_validation_quantize(regression_sample, buffers.quantized_input, file_input_size,
+                                                 &quantize_cycles);
 #else
-        result = mtb_ml_model_run(model_obj, input_reference);
+        input_reference = regression_sample;
+#endif /* ML_REGRESSION_FLOAT_MASTER */
 
-        /* Check if the inferencing return any error */
-        if (MTB_ML_RESULT_SUCCESS != result)
+        result = ml_validation_model_run(input_reference, buffers.input_slice, model_input_size,
+                                         &model_cycles, &predicted_label);
+        if (CY_RSLT_SUCCESS != result)
         {
+            ml_validation_free_buffers(&buffers);
             return result;
         }
-#endif /* RNN_STREAMING */
+
+#ifdef ML_PREDICT_ARGMAX
+        /* The class is taken from the argmax path, checked against the full path */
+        result = ml_validation_argmax_run(&argmax_stats, input_reference, predicted_label, &predicted_label);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            ml_validation_free_buffers(&buffers);
+            return result;
+        }
+#endif /* ML_PREDICT_ARGMAX */
+
+        /* Get the expected class from the labels or from the reference output */
+#ifdef ML_REGRESSION_V3
+        expected_label = ml_regression_get_label(&regression, sample_idx);
+#else
+        expected_label = ml_validation_find_max(&output_reference[sample_idx * model_output_size],
+                                                model_output_size);
+#endif /* ML_REGRESSION_V3 */
 
         /* Check if the results are accurate enough */
-        if (mtb_ml_utils_find_max(result_buffer, model_output_size) ==
-            mtb_ml_utils_find_max(output_reference, model_output_size))
+        if (predicted_label == expected_label)
         {
             correct_result++;
         }
 
-        /* Increment buffers */
-        input_reference  += file_input_size;
-        output_reference += model_output_size;
+#ifdef ML_BENCHMARK
+        /* Same sample through each linked variant, in its own input type */
+        result = ml_validation_bench_run(bench_stats, regression_sample, file_input_size, model_output_size,
+                                         expected_label);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            ml_validation_free_buffers(&buffers);
+            return result;
+        }
+#endif /* ML_BENCHMARK */
+
+#ifdef ML_SOFTMAX_LUT
+        ml_validation_softmax_run(&softmax_stats, buffers.softmax_output, result_buffer, model_output_size);
+#endif /* ML_SOFTMAX_LUT */
+
+#ifdef ML_FLOAT_FC_KERNELS
+        ml_validation_f32_run(f32_variants, ML_VALIDATION_COUNT_OF(f32_variants), input_reference,
+                              buffers.fc_f32_scratch, result_buffer, model_output_size, predicted_label,
+                              expected_label);
+#endif /* ML_FLOAT_FC_KERNELS */
+
+#ifdef ML_FC_KERNELS
+        ml_validation_fc_run(fc_variants, ML_VALIDATION_COUNT_OF(fc_variants), input_reference,
+                             buffers.fc_scratch, predicted_label, expected_label);
+#endif /* ML_FC_KERNELS */
+
+#ifdef ML_SPARSE_INPUT
+        ml_validation_sparse_input_run(&sparse_input_stats, input_reference, &buffers, sample_idx);
+#endif /* ML_SPARSE_INPUT */
 
         total_count++;
     }
 
-#if defined(RNN_STREAMING)
-    free(input_slice);
-#endif /* RNN_STREAMING */
-
     /* Print PASS or FAIL with Accuracy percentage 
      * Only for regression ... 
      */
@@ -271,6 +1604,62 @@ cy_rslt_t ml_validation_local_task(void)
         test_result = (success_rate >= SUCCESS_RATE);
 
         mtb_ml_model_profile_log(model_obj);
+#ifdef ML_WARMUP_PROFILE
+        ml_warmup_log(&warmup);
+#endif /* ML_WARMUP_PROFILE */
+#ifdef ML_LAYER_PROFILE
+        ml_layer_profile_log();
+#endif /* ML_LAYER_PROFILE */
+#ifdef ML_ARENA_REPORT
+        ml_validation_arena_log();
+#endif /* ML_ARENA_REPORT */
+
+        if ((buffers.decode_window_size != 0) && (total_count > 0))
+        {
+            printf("\r\nRegression data decoding: total cycles=%lu, cycles per sample=%lu\r\n",
+                   (unsigned long) decode_cycles,
+                   (unsigned long) (decode_cycles / total_count));
+        }
+
+        if ((quantize_cycles != 0) && (total_count > 0))
+        {
+            printf("\r\nRegression data quantization: total cycles=%lu, cycles per sample=%lu\r\n",
+                   (unsigned long) quantize_cycles,
+                   (unsigned long) (quantize_cycles / total_count));
+        }
+
+        if (total_count > 0)
+        {
+#ifdef ML_PREDICT_ARGMAX
+            ml_validation_argmax_log(&argmax_stats, model_cycles, total_count);
+#endif /* ML_PREDICT_ARGMAX */
+#ifdef ML_SOFTMAX_LUT
+            ml_validation_softmax_log(&softmax_stats, total_count);
+#endif /* ML_SOFTMAX_LUT */
+#ifdef ML_BENCHMARK
+            {
+                const ml_validation_bench_stats_t model_stats = {model_cycles, correct_result};
+
+                ml_validation_bench_log(bench_stats, &model_stats, total_count);
+            }
+#endif /* ML_BENCHMARK */
+#ifdef ML_FLOAT_FC_KERNELS
+            ml_validation_f32_log(f32_variants, ML_VALIDATION_COUNT_OF(f32_variants), total_count);
+#endif /* ML_FLOAT_FC_KERNELS */
+#ifdef ML_FC_KERNELS
+            ml_validation_fc_log(fc_variants, ML_VALIDATION_COUNT_OF(fc_variants), total_count);
+#endif /* ML_FC_KERNELS */
+#ifdef ML_SPARSE_INPUT
+            ml_validation_sparse_input_log(&sparse_input_stats, total_count);
+#endif /* ML_SPARSE_INPUT */
+        }
+
+#ifdef ML_REGRESSION_PREFETCH
+        if (!ml_validation_prefetch_log(&buffers.prefetch, total_count))
+        {
+            test_result = false;
+        }
+#endif /* ML_REGRESSION_PREFETCH */
         
         printf("\r\n***************************************************\r\n");
         if (test_result == true)
@@ -284,6 +1673,8 @@ cy_rslt_t ml_validation_local_task(void)
         printf("\r\n***************************************************\r\n");
     }
 
+    ml_validation_free_buffers(&buffers);
+
     return CY_RSLT_SUCCESS;
 }
 #endif /* USE_STREAM_DATA */
@@ -303,6 +1694,10 @@ cy_rslt_t ml_validation_local_task(void)
 cy_rslt_t ml_validation_stream_task(mtb_ml_stream_interface_t *iface)
 {
     cy_rslt_t result = MTB_ML_RESULT_SUCCESS;
+#ifdef ML_WARMUP_PROFILE
+    uint64_t  start_tick;
+    uint64_t  end_tick;
+#endif /* ML_WARMUP_PROFILE */
 
     /* Initialize the streaming interface */
     result = mtb_ml_stream_init(iface, model_obj);
@@ -358,6 +1753,9 @@ cy_rslt_t ml_validation_stream_task(mtb_ml_stream_interface_t *iface)
             break;
         }
 
+#ifdef ML_WARMUP_PROFILE
+        elapsed_timer_get_tick(&start_tick);
+#endif /* ML_WARMUP_PROFILE */
 #if defined(RNN_STREAMING)
         for (int j = 0; j < model_obj->recurrent_ts_size; j++)
         {
@@ -386,6 +1784,10 @@ cy_rslt_t ml_validation_stream_task(mtb_ml_stream_interface_t *iface)
         }
 
 #endif /* RNN_STREAMING */
+#ifdef ML_WARMUP_PROFILE
+        elapsed_timer_get_tick(&end_tick);
+        ml_warmup_add(&warmup, end_tick - start_tick);
+#endif /* ML_WARMUP_PROFILE */
 
         /* Send output data */
         result = mtb_ml_stream_output_data(iface, model_obj->output, DEFAULT_TIMEOUT_MS);
@@ -411,8 +1813,123 @@ cy_rslt_t ml_validation_stream_task(mtb_ml_stream_interface_t *iface)
         printf("ERROR: Failed to generate profile log.\r\n");
         return MTB_ML_RESULT_BAD_MODEL;
     }
+#ifdef ML_WARMUP_PROFILE
+    ml_warmup_log(&warmup);
+#endif /* ML_WARMUP_PROFILE */
+#ifdef ML_LAYER_PROFILE
+    ml_layer_profile_log();
+#endif /* ML_LAYER_PROFILE */
+#ifdef ML_ARENA_REPORT
+    ml_validation_arena_log();
+#endif /* ML_ARENA_REPORT */
 
     return mtb_ml_inform_host_done(iface, DEFAULT_TIMEOUT_MS);
 }
 
+#ifdef ML_STREAM_WINDOWED
+/*******************************************************************************
+* Function Name: ml_validation_window_task
+********************************************************************************
+* Summary:
+*   Run the Neural Network Inference Engine based on the data streamed with the
+*   windowed protocol. The host keeps several samples in flight, and the
+*   outputs are sent back in multi-sample frames.
+*
+* Parameters:
+*   uart: UART connected to the host
+*
+* Return:
+*   cy_rslt_t: the status of the task execution.
+*******************************************************************************/
+cy_rslt_t ml_validation_window_task(cyhal_uart_t *uart)
+{
+#if defined(RNN_STREAMING)
+    CY_UNUSED_PARAMETER(uart);
+    printf("The windowed streaming protocol does not support RNN models, aborting...\r\n");
+    return MTB_ML_RESULT_BAD_ARG;
+#else
+    ml_stream_window_t session;
+    const MTB_ML_DATA_T *input;
+    cy_rslt_t result;
+#ifdef ML_WARMUP_PROFILE
+    uint64_t  start_tick;
+    uint64_t  end_tick;
+#endif /* ML_WARMUP_PROFILE */
+
+    /* Wait for the host and agree on the window */
+    result = ml_stream_window_open(&session, uart, mtb_ml_model_get_input_size(model_obj),
+                                   model_output_size, sizeof(MTB_ML_DATA_T), STREAM_DATA_TYPE,
+                                   DEFAULT_TIMEOUT_MS);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("MTB ML windowed streaming init failure: %lu\r\n", (unsigned long) result);
+        return result;
+    }
+
+    /* The next samples are received while the current one is inferred */
+    for (uint32_t i = 0; i < session.num_of_samples; i++)
+    {
+        input = (const MTB_ML_DATA_T *) ml_stream_window_get_input(&session);
+        if (input == NULL)
+        {
+            printf("ERROR: Failed to receive input data from host.\r\n");
+            result = MTB_ML_RESULT_BAD_ARG;
+            break;
+        }
+
+#ifdef ML_WARMUP_PROFILE
+        elapsed_timer_get_tick(&start_tick);
+#endif /* ML_WARMUP_PROFILE */
+        result = mtb_ml_model_run(model_obj, (MTB_ML_DATA_T *) input);
+        if (MTB_ML_RESULT_SUCCESS != result)
+        {
+            break;
+        }
+#ifdef ML_WARMUP_PROFILE
+        elapsed_timer_get_tick(&end_tick);
+        ml_warmup_add(&warmup, end_tick - start_tick);
+#endif /* ML_WARMUP_PROFILE */
+
+        result = ml_stream_window_put_output(&session, model_obj->output);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            printf("ERROR: Failed to send output data to host\r\n");
+            break;
+        }
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = ml_stream_window_finish(&session);
+    }
+
+    ml_stream_window_close(&session);
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    /* Generate profiling log if it is enabled. It follows the DONE frame. */
+    result = mtb_ml_model_profile_log(model_obj);
+    if (MTB_ML_RESULT_SUCCESS != result)
+    {
+        printf("ERROR: Failed to generate profile log.\r\n");
+        return MTB_ML_RESULT_BAD_MODEL;
+    }
+#ifdef ML_WARMUP_PROFILE
+    ml_warmup_log(&warmup);
+#endif /* ML_WARMUP_PROFILE */
+#ifdef ML_LAYER_PROFILE
+    ml_layer_profile_log();
+#endif /* ML_LAYER_PROFILE */
+#ifdef ML_ARENA_REPORT
+    ml_validation_arena_log();
+#endif /* ML_ARENA_REPORT */
+
+    return CY_RSLT_SUCCESS;
+#endif /* RNN_STREAMING */
+}
+#endif /* ML_STREAM_WINDOWED */
+
 /* [] END OF FILE */
\ No newline at end of file
@@ -43,6 +43,9 @@
 #define ML_VALIDATION_H
 
 #include "mtb_ml.h"
+#ifdef ML_STREAM_WINDOWED
+#include "cyhal.h"
+#endif
 
 /*******************************************************************************
 * Functions
@@ -53,6 +56,9 @@ cy_rslt_t ml_validation_init(mtb_ml_profile_config_t profile_cfg,
 cy_rslt_t ml_validation_local_task(void);
 #endif
 cy_rslt_t ml_validation_stream_task(mtb_ml_stream_interface_t *iface);
+#ifdef ML_STREAM_WINDOWED
+cy_rslt_t ml_validation_window_task(cyhal_uart_t *uart);
+#endif
 
 #endif /* ML_VALIDATION_H */
 
@@ -0,0 +1,157 @@
+/******************************************************************************
+* File Name:   ml_warmup.c
+*
+* Description: This file contains the profiling of the first inferences after
+*              the model initialization apart from the steady state.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#include "ml_warmup.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Function Name: ml_warmup_init
+********************************************************************************
+* Summary:
+*   Clear the cycles recorded. Call it right after the model initialization,
+*   so the first inference added is the cold one.
+*
+* Parameters:
+*   warmup: pointer to the warm-up statistics
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_warmup_init(ml_warmup_t *warmup)
+{
+    memset(warmup, 0, sizeof(*warmup));
+    warmup->warm_min = UINT64_MAX;
+}
+
+/*******************************************************************************
+* Function Name: ml_warmup_add
+********************************************************************************
+* Summary:
+*   Record the cycles of one inference. The first ML_WARMUP_RUNS inferences are
+*   kept one by one, the next ones are accumulated as the warm steady state.
+*
+* Parameters:
+*   warmup: pointer to the warm-up statistics
+*   cycles: cycles of the inference
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_warmup_add(ml_warmup_t *warmup, uint64_t cycles)
+{
+    if (warmup->count < ML_WARMUP_RUNS)
+    {
+        warmup->first[warmup->count] = cycles;
+    }
+    else
+    {
+        warmup->warm_cycles += cycles;
+        if (cycles < warmup->warm_min)
+        {
+            warmup->warm_min = cycles;
+        }
+        if (cycles > warmup->warm_max)
+        {
+            warmup->warm_max = cycles;
+        }
+    }
+    warmup->count++;
+}
+
+/*******************************************************************************
+* Function Name: ml_warmup_log
+********************************************************************************
+* Summary:
+*   Print the cold start latency, the warm steady state latency and the cycles
+*   of each of the first inferences against the warm average.
+*
+* Parameters:
+*   warmup: pointer to the warm-up statistics
+*
+* Return:
+*   void
+*******************************************************************************/
+void ml_warmup_log(const ml_warmup_t *warmup)
+{
+    uint32_t first_count = (warmup->count < ML_WARMUP_RUNS) ? warmup->count : ML_WARMUP_RUNS;
+    uint32_t warm_count = warmup->count - first_count;
+    uint64_t warm_avg;
+
+    if (warmup->count == 0)
+    {
+        return;
+    }
+
+    printf("\r\nCold start: first inference cycles=%lu\r\n", (unsigned long) warmup->first[0]);
+
+    if (warm_count == 0)
+    {
+        /* Every inference is in the warm-up window, none is known to be warm */
+        printf("Warm steady state: not measured, more than %lu inferences are needed\r\n",
+               (unsigned long) ML_WARMUP_RUNS);
+        for (uint32_t i = 0; i < first_count; i++)
+        {
+            printf("Inference %lu: cycles=%lu\r\n", (unsigned long) (i + 1u),
+                   (unsigned long) warmup->first[i]);
+        }
+        return;
+    }
+
+    warm_avg = warmup->warm_cycles / warm_count;
+    printf("Warm steady state: inferences=%lu, cycles per inference=%lu, min=%lu, max=%lu\r\n",
+           (unsigned long) warm_count, (unsigned long) warm_avg,
+           (unsigned long) warmup->warm_min, (unsigned long) warmup->warm_max);
+    printf("Cold start penalty: cycles=%ld, ratio=%3.2f\r\n",
+           (long) warmup->first[0] - (long) warm_avg,
+           (double) warmup->first[0] / (double) warm_avg);
+
+    /* Warm-up curve: how fast the first inferences converge to the average */
+    for (uint32_t i = 0; i < first_count; i++)
+    {
+        printf("Inference %lu: cycles=%lu, %3.1f%% of warm average\r\n",
+               (unsigned long) (i + 1u), (unsigned long) warmup->first[i],
+               (double) warmup->first[i] * 100.0 / (double) warm_avg);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,78 @@
+/******************************************************************************
+* File Name:   ml_warmup.h
+*
+* Description: This file contains the data types and function prototypes used
+*   in ml_warmup.c.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ML_WARMUP_H
+#define ML_WARMUP_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+/* Number of inferences after the model initialization recorded one by one */
+#ifndef ML_WARMUP_RUNS
+#define ML_WARMUP_RUNS      (8u)
+#endif
+
+/*******************************************************************************
+* Data types
+*******************************************************************************/
+/* Cycles of the first inferences, while the flash cache is cold and the lazy
+ * initialization of the engine is pending, kept apart from the warm ones */
+typedef struct
+{
+    uint32_t    count;                      /* Inferences recorded */
+    uint64_t    first[ML_WARMUP_RUNS];      /* Cycles of each of the first inferences */
+    uint64_t    warm_cycles;                /* Cycles of the inferences after them */
+    uint64_t    warm_min;
+    uint64_t    warm_max;
+} ml_warmup_t;
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+void ml_warmup_init(ml_warmup_t *warmup);
+void ml_warmup_add(ml_warmup_t *warmup, uint64_t cycles);
+void ml_warmup_log(const ml_warmup_t *warmup);
+
+#endif /* ML_WARMUP_H */
+
+/* [] END OF FILE */